@@ -47,15 +47,21 @@ def ifftshift(data: torch.Tensor, dims) -> torch.Tensor:
 
 class FFT(torch.autograd.Function):
     @staticmethod
-    def symbolic(g, x, inverse, centered, dims):
+    def symbolic(g, x, inverse, centered, dims, onesided=False):
         dims = torch.tensor(dims)
         dims = g.op("Constant", value_t=dims)
 
-        return g.op('FFT', x, dims, inverse_i=inverse, centered_i=centered)
+        return g.op('FFT', x, dims, inverse_i=inverse, centered_i=centered, onesided_i=onesided)
 
     @staticmethod
-    def forward(self, x, inverse, centered, dims):
+    def forward(self, x, inverse, centered, dims, onesided=False):
         # https://pytorch.org/docs/stable/torch.html#torch.fft
+        if onesided:
+            # Real signals along the innermost dimension and their Hermitian-packed spectrums
+            if inverse:
+                return torch.fft.irfft(torch.view_as_complex(x), dim=dims[0], norm="ortho")
+            return torch.view_as_real(torch.fft.rfft(x, dim=dims[0], norm="ortho"))
+
         if centered:
             x = ifftshift(x, dims)
 
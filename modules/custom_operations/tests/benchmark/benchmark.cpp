@@ -0,0 +1,374 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Times evaluate() of the custom operations over sweeps of shapes and numbers of threads:
+//   user_ov_extensions_benchmark [--threads 1,2,4] [--iterations 10] [--filter GridSample] [--sp-model model.bin]
+// SentencepieceTokenizer is measured only with a SentencePiece model file.
+
+#include <openvino/core/extension.hpp>
+#include <openvino/core/op_extension.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef BENCHMARK_WITH_TBB
+#    include <tbb/task_arena.h>
+#endif
+
+// Defined by OPENVINO_CREATE_EXTENSIONS of the extension library
+extern "C" void create_extensions(std::vector<ov::Extension::Ptr>& ext);
+
+namespace {
+
+// Sets attributes of an operation from their string values
+class AttributeSetter : public ov::AttributeVisitor {
+public:
+    explicit AttributeSetter(const std::map<std::string, std::string>& values) : values_(values) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {}
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        const auto value = values_.find(name);
+        if (value != values_.end())
+            adapter.set(value->second);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        const auto value = values_.find(name);
+        if (value != values_.end())
+            adapter.set(value->second == "1" || value->second == "true");
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        const auto value = values_.find(name);
+        if (value != values_.end())
+            adapter.set(std::stoll(value->second));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        const auto value = values_.find(name);
+        if (value != values_.end())
+            adapter.set(std::stod(value->second));
+    }
+
+private:
+    std::map<std::string, std::string> values_;
+};
+
+// An operation with its inputs. Constant inputs are folded into the operation, like the model of SentencePiece
+struct Case {
+    std::string op;
+    std::string description;
+    std::map<std::string, std::string> attributes;
+    std::vector<ov::Tensor> inputs;
+    std::vector<bool> constants;
+    // Amount of work of one evaluation in units, like output elements or points
+    double work;
+    std::string unit;
+};
+
+std::mt19937 generator{42};
+
+ov::Tensor uniform(const ov::Shape& shape, float low, float high) {
+    ov::Tensor tensor(ov::element::f32, shape);
+    std::uniform_real_distribution<float> distribution{low, high};
+    float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i)
+        data[i] = distribution(generator);
+    return tensor;
+}
+
+template <typename T>
+ov::Tensor values(const ov::element::Type& type, const std::vector<T>& data) {
+    ov::Tensor tensor(type, ov::Shape{data.size()});
+    std::copy(data.begin(), data.end(), tensor.data<T>());
+    return tensor;
+}
+
+// Centers of voxels of the grid of the given extent
+ov::Tensor voxels(size_t numPoints, int extent) {
+    ov::Tensor tensor(ov::element::f32, ov::Shape{numPoints, 3});
+    std::uniform_int_distribution<int> distribution{0, extent - 1};
+    float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i)
+        data[i] = distribution(generator) + 0.5f;
+    return tensor;
+}
+
+// Packed string tensor of SentencepieceTokenizer: batch size, offsets of the sentences and their data
+ov::Tensor sentences(size_t batch, size_t wordsPerSentence) {
+    static const char* words[] = {"the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+                                  "inference", "of", "neural", "networks", "runs", "on", "many", "cores"};
+    std::uniform_int_distribution<size_t> distribution{0, sizeof(words) / sizeof(words[0]) - 1};
+    std::vector<std::string> batchSentences(batch);
+    size_t dataSize = 0;
+    for (auto& sentence : batchSentences) {
+        for (size_t w = 0; w < wordsPerSentence; ++w)
+            sentence += std::string(w ? " " : "") + words[distribution(generator)];
+        dataSize += sentence.size();
+    }
+    ov::Tensor tensor(ov::element::u8, ov::Shape{4 + 4 + 4 * batch + dataSize});
+    uint8_t* packed = tensor.data<uint8_t>();
+    auto offsets = reinterpret_cast<int32_t*>(packed + 4);
+    uint8_t* data = packed + 4 + 4 + 4 * batch;
+    *reinterpret_cast<int32_t*>(packed) = static_cast<int32_t>(batch);
+    offsets[0] = 0;
+    for (size_t i = 0; i < batch; ++i) {
+        std::memcpy(data + offsets[i], batchSentences[i].data(), batchSentences[i].size());
+        offsets[i + 1] = offsets[i] + static_cast<int32_t>(batchSentences[i].size());
+    }
+    return tensor;
+}
+
+std::string shapeString(const ov::Shape& shape) {
+    std::ostringstream stream;
+    stream << shape;
+    return stream.str();
+}
+
+std::vector<Case> makeCases(const std::string& spModel) {
+    std::vector<Case> cases;
+
+    // Complex signals of the innermost dimension of 2 values, transformed along the signal dimensions
+    struct FftShape {
+        ov::Shape shape;
+        std::vector<int32_t> dims;
+        bool onesided;
+    };
+    for (const auto& fft : std::vector<FftShape>{{{1, 512, 512, 2}, {1, 2}, false},
+                                                 {{16, 128, 128, 2}, {1, 2}, false},
+                                                 {{64, 4096, 2}, {1}, false},
+                                                 {{64, 4096}, {1}, true}}) {
+        Case c;
+        c.op = "FFT";
+        c.description = shapeString(fft.shape) + (fft.onesided ? " onesided" : "");
+        c.attributes = {{"inverse", "0"}, {"centered", "0"}, {"onesided", fft.onesided ? "1" : "0"}};
+        c.inputs = {uniform(fft.shape, -1.0f, 1.0f), values(ov::element::i32, fft.dims)};
+        c.constants = {false, false};
+        c.work = static_cast<double>(ov::shape_size(fft.shape));
+        c.unit = "values";
+        cases.push_back(c);
+    }
+
+    for (const auto& mode : {"bilinear", "nearest", "bicubic"}) {
+        for (const auto& shapes : std::vector<std::pair<ov::Shape, ov::Shape>>{{{1, 64, 128, 128}, {1, 128, 128, 2}},
+                                                                               {{8, 16, 256, 256}, {8, 64, 64, 2}}}) {
+            Case c;
+            c.op = "GridSample";
+            c.description = shapeString(shapes.first) + " grid " + shapeString(shapes.second) + " " + mode;
+            c.attributes = {{"mode", mode}, {"padding_mode", "zeros"}, {"align_corners", "1"}};
+            c.inputs = {uniform(shapes.first, -1.0f, 1.0f), uniform(shapes.second, -1.1f, 1.1f)};
+            c.constants = {false, false};
+            c.work = static_cast<double>(shapes.first[0] * shapes.first[1] * shapes.second[1] * shapes.second[2]);
+            c.unit = "values";
+            cases.push_back(c);
+        }
+    }
+
+    for (const auto& op : {"SparseConv", "SparseConvTranspose"}) {
+        for (const size_t numPoints : {size_t(10000), size_t(50000)}) {
+            for (const size_t channels : {size_t(16), size_t(64)}) {
+                Case c;
+                c.op = op;
+                c.description = std::to_string(numPoints) + " points, " + std::to_string(channels) + " channels";
+                c.inputs = {uniform({numPoints, channels}, -1.0f, 1.0f),
+                            voxels(numPoints, 64),
+                            voxels(numPoints, 64),
+                            uniform({3, 3, 3, channels, channels}, -1.0f, 1.0f),
+                            values(ov::element::f32, std::vector<float>{0.0f, 0.0f, 0.0f})};
+                c.constants = {false, false, false, false, false};
+                c.work = static_cast<double>(numPoints);
+                c.unit = "points";
+                cases.push_back(c);
+            }
+        }
+    }
+
+    for (const size_t numPoints : {size_t(100000), size_t(1000000)}) {
+        Case c;
+        c.op = "CalculateGrid";
+        c.description = std::to_string(numPoints) + " points";
+        c.inputs = {uniform({numPoints, 3}, 0.0f, 256.0f)};
+        c.constants = {false};
+        c.work = static_cast<double>(numPoints);
+        c.unit = "points";
+        cases.push_back(c);
+    }
+
+    for (const auto& shapes : std::vector<std::pair<ov::Shape, ov::Shape>>{{{4, 16, 128, 128, 2}, {4, 16, 128, 128, 2}},
+                                                                           {{4, 16, 128, 128, 2}, {1, 16, 128, 128, 2}},
+                                                                           {{4, 16, 128, 128, 2}, {4, 16, 1, 1, 2}}}) {
+        Case c;
+        c.op = "ComplexMultiplication";
+        c.description = shapeString(shapes.first) + " x " + shapeString(shapes.second);
+        c.inputs = {uniform(shapes.first, -1.0f, 1.0f), uniform(shapes.second, -1.0f, 1.0f)};
+        c.constants = {false, false};
+        c.work = static_cast<double>(ov::shape_size(shapes.first) / 2);
+        c.unit = "values";
+        cases.push_back(c);
+    }
+
+    if (!spModel.empty()) {
+        std::ifstream file(spModel, std::ios::binary);
+        if (!file)
+            throw std::runtime_error("Can't read SentencePiece model " + spModel);
+        const std::vector<char> model{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        for (const size_t batch : {size_t(1), size_t(64), size_t(1024)}) {
+            Case c;
+            c.op = "SentencepieceTokenizer";
+            c.description = std::to_string(batch) + " sentences";
+            c.attributes = {{"nbest_size", "0"}, {"alpha", "1.0"}};
+            c.inputs = {values(ov::element::u8, std::vector<uint8_t>(model.begin(), model.end())),
+                        sentences(batch, 16)};
+            c.constants = {true, false};
+            c.work = static_cast<double>(batch);
+            c.unit = "sentences";
+            cases.push_back(c);
+        }
+    }
+    return cases;
+}
+
+std::shared_ptr<ov::Node> createNode(const ov::BaseOpExtension& extension, const Case& c) {
+    ov::OutputVector arguments;
+    for (size_t i = 0; i < c.inputs.size(); ++i) {
+        const auto& input = c.inputs[i];
+        if (c.constants[i])
+            arguments.push_back(
+                std::make_shared<ov::op::v0::Constant>(input.get_element_type(), input.get_shape(), input.data()));
+        else
+            arguments.push_back(std::make_shared<ov::op::v0::Parameter>(input.get_element_type(), input.get_shape()));
+    }
+    AttributeSetter attributes(c.attributes);
+    const auto outputs = extension.create(arguments, attributes);
+    return outputs.at(0).get_node_shared_ptr();
+}
+
+// Output tensors of dynamic shapes are resized by evaluate()
+ov::TensorVector createOutputs(const ov::Node& node) {
+    ov::TensorVector outputs;
+    for (const auto& output : node.outputs()) {
+        const auto& shape = output.get_partial_shape();
+        outputs.emplace_back(output.get_element_type(),
+                             shape.is_static() ? shape.to_shape() : ov::Shape(shape.rank().get_length(), 0));
+    }
+    return outputs;
+}
+
+// Average time of an evaluation in seconds, after a warm up one
+double measure(const ov::Node& node, const ov::TensorVector& inputs, size_t iterations) {
+    ov::TensorVector outputs = createOutputs(node);
+    if (!node.evaluate(outputs, inputs))
+        throw std::runtime_error(std::string("evaluate() of ") + node.get_type_name() + " failed");
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+        node.evaluate(outputs, inputs);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+double measureWithThreads(const ov::Node& node, const ov::TensorVector& inputs, size_t iterations, int threads) {
+#ifdef BENCHMARK_WITH_TBB
+    tbb::task_arena arena(threads);
+    double seconds = 0;
+    arena.execute([&] {
+        seconds = measure(node, inputs, iterations);
+    });
+    return seconds;
+#else
+    return measure(node, inputs, iterations);
+#endif
+}
+
+std::vector<int> parseThreads(const std::string& list) {
+    std::vector<int> threads;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ','))
+        threads.push_back(std::stoi(item));
+    return threads;
+}
+
+std::vector<int> defaultThreads() {
+    std::vector<int> threads;
+    const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int n = 1; n < maxThreads; n *= 2)
+        threads.push_back(n);
+    threads.push_back(maxThreads);
+    return threads;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<int> threads = defaultThreads();
+    size_t iterations = 10;
+    std::string filter;
+    std::string spModel;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--threads") {
+            threads = parseThreads(argv[i + 1]);
+        } else if (option == "--iterations") {
+            iterations = std::stoul(argv[i + 1]);
+        } else if (option == "--filter") {
+            filter = argv[i + 1];
+        } else if (option == "--sp-model") {
+            spModel = argv[i + 1];
+        } else {
+            std::fprintf(stderr, "Unknown option %s\n", option.c_str());
+            return 1;
+        }
+    }
+#ifndef BENCHMARK_WITH_TBB
+    std::fprintf(stderr, "Built without TBB, numbers of threads of the operations aren't limited\n");
+#endif
+
+    std::vector<ov::Extension::Ptr> extensions;
+    create_extensions(extensions);
+    std::map<std::string, std::shared_ptr<ov::BaseOpExtension>> operations;
+    for (const auto& extension : extensions) {
+        if (const auto op = std::dynamic_pointer_cast<ov::BaseOpExtension>(extension))
+            operations[op->get_type_info().name] = op;
+    }
+
+    // Scaling efficiency is the speedup over the first number of threads divided by the ratio of the numbers
+    std::printf(
+        "%-24s %-48s %8s %12s %16s %10s\n", "operation", "case", "threads", "time, ms", "throughput", "scaling");
+    for (const auto& c : makeCases(spModel)) {
+        if (!filter.empty() && c.op != filter)
+            continue;
+        const auto op = operations.find(c.op);
+        if (op == operations.end()) {
+            std::printf("%-24s %-48s %s\n", c.op.c_str(), c.description.c_str(), "not built in the extension");
+            continue;
+        }
+        const auto node = createNode(*op->second, c);
+        double baseSeconds = 0;
+        for (const int n : threads) {
+            const double seconds = measureWithThreads(*node, c.inputs, iterations, n);
+            if (n == threads.front())
+                baseSeconds = seconds;
+            const double efficiency = baseSeconds / seconds * threads.front() / n;
+            std::printf("%-24s %-48s %8d %12.3f %9.2f M%-6s %9.0f%%\n",
+                        c.op.c_str(),
+                        c.description.c_str(),
+                        n,
+                        seconds * 1e3,
+                        c.work / seconds * 1e-6,
+                        (c.unit + "/s").c_str(),
+                        efficiency * 100);
+        }
+    }
+    return 0;
+}
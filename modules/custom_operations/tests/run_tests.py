@@ -53,7 +53,18 @@ def test_fft(shape, inverse, centered, test_onnx, dims):
     run_test(inp, ref, test_onnx=test_onnx)
 
 
-@pytest.mark.parametrize("shape", [[3, 2, 4, 8, 2], [3, 1, 4, 8, 2]])
+@pytest.mark.parametrize("shape", [[5, 120], [4, 3, 256], [4, 3, 65, 2]])
+@pytest.mark.parametrize("test_onnx", [False, True])
+def test_onesided_fft(shape, test_onnx):
+    from examples.fft.export_model import export
+
+    # Spectrums of 2 * (65 - 1) real values are inverse transformed
+    inverse = shape[-1] == 2
+    inp, ref = export(shape, inverse, centered=False, dims=[len(shape) - (2 if inverse else 1)], onesided=True)
+    run_test(inp, ref, test_onnx=test_onnx)
+
+
+@pytest.mark.parametrize("shape", [[3, 2, 4, 8, 2], [3, 1, 4, 8, 2], [1, 2, 4, 8, 2], [3, 2, 1, 1, 2], [1, 1, 4, 8, 2]])
 @pytest.mark.parametrize("test_onnx", [False, True])
 def test_complex_mul(shape, test_onnx):
     from examples.complex_mul.export_model import export
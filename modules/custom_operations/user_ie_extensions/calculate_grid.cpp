@@ -4,6 +4,14 @@
 
 #include "calculate_grid.hpp"
 
+#include <openvino/core/parallel.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
 using namespace TemplateExtension;
 
 CalculateGrid::CalculateGrid(const ov::Output<ov::Node>& inp_pos) : Op({inp_pos}) {
@@ -24,39 +32,47 @@ bool CalculateGrid::evaluate(ov::TensorVector& outputs, const ov::TensorVector&
     const float* inpPos = reinterpret_cast<float*>(inputs[0].data());
     float* out = reinterpret_cast<float*>(outputs[0].data());
 
-    std::set<std::tuple<int, int, int> > outPos;
-
     const size_t numPoints = inputs[0].get_shape()[0];
-    static const std::vector<std::vector<int> > filters {{-1, -1, -1}, {-1, -1, 0}, {-1, 0, -1},
-                                                         {-1, 0, 0}, {0, -1, -1}, {0, -1, 0},
-                                                         {0, 0, -1}, {0, 0, 0}};
+    const uint64_t invalid = std::numeric_limits<uint64_t>::max();
+    const int maxCoordinate = 1 << 21;
 
-    std::vector<int> pos(3);
-    for (size_t i = 0; i < numPoints; ++i) {
-        for (size_t j = 0; j < filters.size(); ++j) {
-            bool isValid = true;
-            for (size_t k = 0; k < 3; ++k) {
-                int val = static_cast<int>(inpPos[i * 3 + k]) + filters[j][k];
-                if (val < 0 || val % 2) {
-                    isValid = false;
-                    break;
-                }
-                pos[k] = val;
+    // Candidates of a point are its coordinates minus 0 or 1 by axis, which are kept if they are even
+    // and not negative. Exactly one of v and v - 1 is even, so a point has at most one cell.
+    // Cells are packed by 21 bits per axis, so the order of keys is the lexicographical order of cells
+    std::vector<uint64_t> cells(numPoints);
+    std::vector<char> overflow(numPoints, 0);
+    ov::parallel_for(numPoints, [&](size_t i) {
+        uint64_t key = 0;
+        for (size_t k = 0; k < 3; ++k) {
+            const int val = static_cast<int>(inpPos[i * 3 + k]);
+            if (val < 0) {
+                cells[i] = invalid;
+                return;
             }
-            if (isValid)
-                outPos.insert(std::make_tuple(pos[0], pos[1], pos[2]));
+            overflow[i] |= val >= maxCoordinate;
+            key = key << 21 | static_cast<uint64_t>(val & ~1);
         }
+        cells[i] = key;
+    });
+    OPENVINO_ASSERT(std::find(overflow.begin(), overflow.end(), 1) == overflow.end(),
+                    "CalculateGrid supports coordinates less than ", maxCoordinate);
+    ov::parallel_sort(cells.begin(), cells.end(), std::less<uint64_t>());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+    if (!cells.empty() && cells.back() == invalid) {
+        cells.pop_back();
     }
 
-    int i = 0;
-    for (const auto& it : outPos) {
-        out[i * 3] = 0.5f + std::get<0>(it);
-        out[i * 3 + 1] = 0.5f + std::get<1>(it);
-        out[i * 3 + 2] = 0.5f + std::get<2>(it);
-        i += 1;
+    const uint64_t mask = maxCoordinate - 1;
+    const size_t numCells = cells.size();
+    ov::parallel_for(numCells, [&](size_t i) {
+        out[i * 3] = 0.5f + static_cast<float>(cells[i] >> 42 & mask);
+        out[i * 3 + 1] = 0.5f + static_cast<float>(cells[i] >> 21 & mask);
+        out[i * 3 + 2] = 0.5f + static_cast<float>(cells[i] & mask);
+    });
+    memset(out + numCells * 3, 0, sizeof(float) * 3 * (numPoints - numCells));
+    if (numCells < numPoints) {
+        out[numCells * 3] = -1.0f;
     }
-    memset(out + i * 3, 0, sizeof(float) * 3 * (numPoints - i));
-    out[i * 3] = -1.0f;
     return true;
 }
 
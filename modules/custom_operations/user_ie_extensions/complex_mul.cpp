@@ -6,6 +6,8 @@
 #include <openvino/core/parallel.hpp>
 #include <ie_common.h>
 
+#include <algorithm>
+
 using namespace TemplateExtension;
 
 ComplexMultiplication::ComplexMultiplication(const ov::OutputVector& args) : Op(args) {
@@ -22,46 +24,97 @@ std::shared_ptr<ov::Node> ComplexMultiplication::clone_with_new_inputs(const ov:
     return std::make_shared<ComplexMultiplication>(new_args);
 }
 
+namespace {
+
+const size_t kChunkLength = 4096;
+
+// Products of n interleaved complex numbers, a plain loop over contiguous data which compilers vectorize
+void multiply(const float* x, const float* y, float* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        const float xr = x[i * 2];
+        const float xi = x[i * 2 + 1];
+        const float yr = y[i * 2];
+        const float yi = y[i * 2 + 1];
+        out[i * 2] = xr * yr - xi * yi;
+        out[i * 2 + 1] = xr * yi + xi * yr;
+    }
+}
+
+// Products of n interleaved complex numbers by a single one
+void multiply(const float* x, float yr, float yi, float* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        const float xr = x[i * 2];
+        const float xi = x[i * 2 + 1];
+        out[i * 2] = xr * yr - xi * yi;
+        out[i * 2 + 1] = xr * yi + xi * yr;
+    }
+}
+
+}  // namespace
+
 bool ComplexMultiplication::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
     const float* inp0 = reinterpret_cast<float*>(inputs[0].data());
     const float* inp1 = reinterpret_cast<float*>(inputs[1].data());
     float* out = reinterpret_cast<float*>(outputs[0].data());
 
-    size_t channels0 = inputs[0].get_shape()[1];
-    size_t channels1 = inputs[1].get_shape()[1];
-    size_t batch = inputs[0].get_shape()[0];
-    size_t spatialSize = inputs[0].get_shape()[2] * inputs[0].get_shape()[3];
-
-    // x1 = x_r * y_r - x_i * y_i
-    // x2 = x_r * y_i + x_i * y_r
-    if (channels0 == channels1)
-        ov::parallel_for(channels0 * batch, [&](size_t ch) {
-            for (size_t i = 0; i < spatialSize; ++i) {
-                    size_t outIdx = (ch * spatialSize + i) * 2;
-                    float real0 = inp0[outIdx];
-                    float imag0 = inp0[outIdx + 1];
-                    float real1 = inp1[outIdx];
-                    float imag1 = inp1[outIdx + 1];
-                    out[outIdx] = real0 * real1 - imag0 * imag1;
-                    out[outIdx + 1] = real0 * imag1 + imag0 * real1;
-            }
-        });
-    else if (channels1 == 1)
-        ov::parallel_for(channels0 * batch, [&](size_t ch) {
-            size_t b = ch / channels0;
-            for (size_t i = 0; i < spatialSize; ++i) {
-                size_t outIdx = (ch * spatialSize + i) * 2;
-                size_t inpIdx = (b * spatialSize + i) * 2;
-                float real0 = inp0[outIdx];
-                float imag0 = inp0[outIdx + 1];
-                float real1 = inp1[inpIdx];
-                float imag1 = inp1[inpIdx + 1];
-                out[outIdx] = real0 * real1 - imag0 * imag1;
-                out[outIdx + 1] = real0 * imag1 + imag0 * real1;
-            }
-        });
-    else
-        IE_THROW() << "Wrong number of channels for second input!";
+    // Complex numbers are pairs of the innermost dimension. Dimensions of the second input are
+    // either equal to the ones of the first input or 1 to broadcast it (for example, a filter for all channels)
+    std::vector<size_t> dims0 = inputs[0].get_shape();
+    std::vector<size_t> dims1 = inputs[1].get_shape();
+    if (dims0.size() != dims1.size() || dims0.back() != 2 || dims1.back() != 2)
+        IE_THROW() << "ComplexMultiplication inputs should have the same rank and 2 values of the innermost dimension";
+    dims0.pop_back();
+    dims1.pop_back();
+    for (size_t i = 0; i < dims0.size(); ++i) {
+        if (dims1[i] != dims0[i] && dims1[i] != 1)
+            IE_THROW() << "Second input of ComplexMultiplication can't be broadcasted to the first one";
+    }
+
+    // Outer dimensions are split from the innermost run, which is either the same for both inputs
+    // or multiplied by a single number of the second input
+    size_t split = dims0.size();
+    while (split > 0 && dims1[split - 1] == dims0[split - 1])
+        --split;
+    bool broadcastRun = false;
+    if (split == dims0.size()) {
+        broadcastRun = true;
+        while (split > 0 && dims1[split - 1] == 1)
+            --split;
+    }
+    size_t runLength = 1;
+    for (size_t i = split; i < dims0.size(); ++i)
+        runLength *= dims0[i];
+    size_t numRuns = 1;
+    for (size_t i = 0; i < split; ++i)
+        numRuns *= dims0[i];
+
+    // Offsets of runs of the second input, which are 0 along broadcasted dimensions
+    std::vector<size_t> strides1(split);
+    size_t stride1 = broadcastRun ? 1 : runLength;
+    for (size_t i = split; i > 0; --i) {
+        strides1[i - 1] = dims1[i - 1] == 1 ? 0 : stride1;
+        stride1 *= dims1[i - 1];
+    }
+
+    // Long runs are split into chunks, so equal shapes are processed in parallel too
+    const size_t chunkLength = std::min(runLength, kChunkLength);
+    const size_t chunksPerRun = chunkLength ? (runLength + chunkLength - 1) / chunkLength : 0;
+    ov::parallel_for(numRuns * chunksPerRun, [&](size_t chunk) {
+        const size_t run = chunk / chunksPerRun;
+        const size_t begin = (chunk % chunksPerRun) * chunkLength;
+        const size_t length = std::min(chunkLength, runLength - begin);
+        size_t offset1 = 0;
+        for (size_t i = split, index = run; i > 0; --i) {
+            offset1 += (index % dims0[i - 1]) * strides1[i - 1];
+            index /= dims0[i - 1];
+        }
+        const float* x = inp0 + (run * runLength + begin) * 2;
+        float* res = out + (run * runLength + begin) * 2;
+        if (broadcastRun)
+            multiply(x, inp1[offset1 * 2], inp1[offset1 * 2 + 1], res, length);
+        else
+            multiply(x, inp1 + (offset1 + begin) * 2, res, length);
+    });
 
     return true;
 }
@@ -7,129 +7,152 @@
 #include <ie_common.h>
 #include <openvino/core/parallel.hpp>
 #include <details/ie_so_loader.h>
-#include <opencv2/core/core_c.h>
+#include <opencv2/core.hpp>
 
-using namespace TemplateExtension;
-
-void fftshift(CvMat* src, bool inverse) {
-    // tl | tr        br | bl
-    // ---+---   ->   ---+---
-    // bl | br        tr | tl
-
-    float* data;
-    int step;
-    CvSize size;
-    cvGetRawData(src, (uchar**)&data, &step, &size);
-
-    int height = size.height;
-    int width = size.width;
-    int h2 = height / 2;
-    int w2 = width / 2;
-
-    if (height % 2 || width % 2) {
-        // Swap rows.
-        CvMat* srcTop = new CvMat();
-        CvMat* srcBot = new CvMat();
-        CvMat* dstTop = new CvMat();
-        CvMat* dstBot = new CvMat();
-        int topH = inverse ? h2 : (h2 + height % 2);
-        int botH = height - topH;
-        cvInitMatHeader(srcTop, topH, width, CV_32FC2, data, step);
-        cvInitMatHeader(srcBot, botH, width, CV_32FC2, data + topH * width * 2, step);
-        cvInitMatHeader(dstTop, topH, width, CV_32FC2, data + botH * width * 2, step);
-        cvInitMatHeader(dstBot, botH, width, CV_32FC2, data, step);
-
-        CvMat* tmp = cvCloneMat(srcTop);
-        cvCopy(srcBot, dstBot, 0);
-        cvCopy(tmp, dstTop, 0);
-
-        cvReleaseMat(&tmp);
-        delete srcTop;
-        delete srcBot;
-        delete dstTop;
-        delete dstBot;
+#include <cmath>
+#include <functional>
+#include <numeric>
 
-        // Swap columns.
-        CvMat* srcL = new CvMat();
-        CvMat* srcR = new CvMat();
-        CvMat* dstL = new CvMat();
-        CvMat* dstR = new CvMat();
-        int leftW = inverse ? w2 : (w2 + width % 2);
-        int rightW = width - leftW;
-
-        cvInitMatHeader(srcL, height, leftW, CV_32FC2, data, step);
-        cvInitMatHeader(srcR, height, rightW, CV_32FC2, data + leftW * 2, step);
-        cvInitMatHeader(dstL, height, leftW, CV_32FC2, data + rightW * 2, step);
-        cvInitMatHeader(dstR, height, rightW, CV_32FC2, data, step);
-
-        tmp = cvCloneMat(srcL);
-        cvCopy(srcR, dstR, 0);
-        cvCopy(tmp, dstL, 0);
-
-        cvReleaseMat(&tmp);
-        delete srcL;
-        delete srcR;
-        delete dstL;
-        delete dstR;
+using namespace TemplateExtension;
 
-        return;
+namespace {
+
+// Layout of complex elements of 2D signals of a tensor. Signal d starts at complex element
+// (d / interleave) * batchStride + d % interleave, so interleave > 1 means signals are interleaved by columns
+struct SignalLayout {
+    int rows;
+    int cols;
+    size_t rowStride;
+    size_t colStride;
+    size_t interleave;
+    size_t batchStride;
+};
+
+// fftshift of the input (ifftshift if centered) and of the output are index remappings of copying the signal
+// into and out of the workspace of the thread, so neither the input is modified nor temporaries are allocated
+void transformSignal(const float* inpData,
+                     float* outData,
+                     size_t d,
+                     const SignalLayout& layout,
+                     bool inverse,
+                     bool centered) {
+    static thread_local cv::Mat signal;
+    static thread_local cv::Mat spectrum;
+    const int rows = layout.rows;
+    const int cols = layout.cols;
+    const size_t base = (d / layout.interleave) * layout.batchStride + d % layout.interleave;
+
+    // ifftshift moves element (i + n / 2) % n to i, fftshift moves element (i + (n + 1) / 2) % n to i
+    const int inpRowShift = centered ? rows / 2 : 0;
+    const int inpColShift = centered ? cols / 2 : 0;
+    signal.create(rows, cols, CV_32FC2);
+    for (int r = 0; r < rows; ++r) {
+        cv::Vec2f* dst = signal.ptr<cv::Vec2f>(r);
+        const size_t srcRow = base + ((r + inpRowShift) % rows) * layout.rowStride;
+        for (int c = 0; c < cols; ++c) {
+            const float* src = inpData + 2 * (srcRow + ((c + inpColShift) % cols) * layout.colStride);
+            dst[c] = cv::Vec2f(src[0], src[1]);
+        }
     }
 
-    CvMat* tl = new CvMat();
-    CvMat* tr = new CvMat();
-    CvMat* bl = new CvMat();
-    CvMat* br = new CvMat();
-
-    cvInitMatHeader(tl, h2, w2, CV_32FC2, data, step);
-    cvInitMatHeader(tr, h2, w2, CV_32FC2, data + width, step);
-    cvInitMatHeader(bl, h2, w2, CV_32FC2, data + height * width, step);
-    cvInitMatHeader(br, h2, w2, CV_32FC2, data + height * width + width, step);
-
-    CvArr* mask = 0;
-    CvMat* tmp = cvCloneMat(tl);
-    cvCopy(br, tl, mask);
-    cvCopy(tmp, br, mask);
-
-    cvCopy(tr, tmp, mask);
-    cvCopy(bl, tr, mask);
-    cvCopy(tmp, bl, mask);
-
-    cvReleaseMat(&tmp);
+    cv::dft(signal, spectrum, inverse ? cv::DFT_INVERSE : 0);
+
+    const float scale = static_cast<float>(1.0 / std::sqrt(static_cast<double>(rows) * cols));
+    const int outRowShift = centered ? (rows + 1) / 2 : 0;
+    const int outColShift = centered ? (cols + 1) / 2 : 0;
+    for (int r = 0; r < rows; ++r) {
+        const cv::Vec2f* src = spectrum.ptr<cv::Vec2f>((r + outRowShift) % rows);
+        const size_t dstRow = base + r * layout.rowStride;
+        for (int c = 0; c < cols; ++c) {
+            const cv::Vec2f& value = src[(c + outColShift) % cols];
+            float* dst = outData + 2 * (dstRow + c * layout.colStride);
+            dst[0] = value[0] * scale;
+            dst[1] = value[1] * scale;
+        }
+    }
+}
 
-    delete tl;
-    delete tr;
-    delete bl;
-    delete br;
+// Signals of length n are the innermost dimension of real data, spectrums are n / 2 + 1 complex values
+void transformRealSignals(const float* inpData, float* outData, size_t numSignals, int n, bool inverse) {
+    const int m = n / 2 + 1;
+    const float scale = static_cast<float>(1.0 / std::sqrt(static_cast<double>(n)));
+    ov::parallel_for(numSignals, [&](size_t d) {
+        static thread_local cv::Mat spectrum;
+        spectrum.create(1, n, CV_32FC2);
+        cv::Vec2f* values = spectrum.ptr<cv::Vec2f>(0);
+        if (inverse) {
+            // The rest of the spectrum of real signal is conjugate of the packed one. Imaginary parts of
+            // the zero and the Nyquist frequencies are ignored like by irfft
+            const float* src = inpData + d * m * 2;
+            for (int k = 0; k < m; ++k) {
+                values[k] = cv::Vec2f(src[k * 2], src[k * 2 + 1]);
+            }
+            values[0][1] = 0.0f;
+            values[m - 1][1] = 0.0f;
+            for (int k = m; k < n; ++k) {
+                values[k] = cv::Vec2f(values[n - k][0], -values[n - k][1]);
+            }
+            cv::Mat signal(1, n, CV_32F, outData + d * n);
+            cv::dft(spectrum, signal, cv::DFT_INVERSE | cv::DFT_REAL_OUTPUT);
+            signal *= scale;
+        } else {
+            const cv::Mat signal(1, n, CV_32F, const_cast<float*>(inpData) + d * n);
+            cv::dft(signal, spectrum, cv::DFT_COMPLEX_OUTPUT);
+            float* dst = outData + d * m * 2;
+            for (int k = 0; k < m; ++k) {
+                dst[k * 2] = values[k][0] * scale;
+                dst[k * 2 + 1] = values[k][1] * scale;
+            }
+        }
+    });
 }
 
-FFT::FFT(const ov::OutputVector& args, bool inverse, bool centered) : Op(args) {
-    constructor_validate_and_infer_types();
+}  // namespace
+
+FFT::FFT(const ov::OutputVector& args, bool inverse, bool centered, bool onesided) : Op(args) {
     this->inverse = inverse;
     this->centered = centered;
+    this->onesided = onesided;
+    constructor_validate_and_infer_types();
 }
 
 void FFT::validate_and_infer_types() {
     auto outShape = get_input_partial_shape(0);
+    if (onesided && outShape.rank().is_static()) {
+        // N real values have N / 2 + 1 complex values of the spectrum, even N is restored by the inverse one
+        if (inverse) {
+            outShape.resize(outShape.size() - 1);
+            auto& length = outShape[outShape.size() - 1];
+            length = length.is_static() ? ov::Dimension(2 * (length.get_length() - 1)) : ov::Dimension::dynamic();
+        } else {
+            auto& length = outShape[outShape.size() - 1];
+            length = length.is_static() ? ov::Dimension(length.get_length() / 2 + 1) : ov::Dimension::dynamic();
+            outShape.push_back(2);
+        }
+    }
     set_output_type(0, get_input_element_type(0), outShape);
 }
 
 std::shared_ptr<ov::Node> FFT::clone_with_new_inputs(const ov::OutputVector& new_args) const {
     OPENVINO_ASSERT(new_args.size() == 2, "Incorrect number of new arguments");
-    return std::make_shared<FFT>(new_args, inverse, centered);
+    return std::make_shared<FFT>(new_args, inverse, centered, onesided);
 }
 
 bool FFT::visit_attributes(ov::AttributeVisitor& visitor) {
     int inverse_i = static_cast<int>(inverse);
     int centered_i = static_cast<int>(centered);
+    int onesided_i = static_cast<int>(onesided);
     visitor.on_attribute("inverse", inverse_i);
     visitor.on_attribute("centered", centered_i);
+    visitor.on_attribute("onesided", onesided_i);
     inverse = static_cast<bool>(inverse_i);
     centered = static_cast<bool>(centered_i);
+    onesided = static_cast<bool>(onesided_i);
     return true;
 }
 
 bool FFT::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
-    float* inpData = reinterpret_cast<float*>(inputs[0].data());
+    const float* inpData = reinterpret_cast<const float*>(inputs[0].data());
 
     if (inputs[1].get_element_type() != ov::element::i32)
         IE_THROW() << "Unexpected dims type: " << inputs[1].get_element_type();
@@ -139,6 +162,20 @@ bool FFT::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) co
     std::vector<size_t> dims = inputs[0].get_shape();
     const size_t numSignalDims = inputs[1].get_shape()[0];
 
+    if (onesided) {
+        // Only the innermost dimension of real signals (the one before pairs of complex values of spectrums)
+        const size_t axis = inverse ? dims.size() - 2 : dims.size() - 1;
+        if (centered || dims.size() < (inverse ? 2u : 1u) || numSignalDims != 1 ||
+            static_cast<size_t>(signalDimsData[0]) != axis || (inverse && (dims[axis] < 2 || dims.back() != 2)))
+            IE_THROW() << "Unsupported configuration of onesided FFT: Input dims " << dims.size() << ", centered "
+                       << centered << " and " << numSignalDims << " signal dims";
+        const size_t numSignals =
+            std::accumulate(dims.begin(), dims.begin() + axis, size_t{1}, std::multiplies<size_t>());
+        const int n = static_cast<int>(inverse ? 2 * (dims[axis] - 1) : dims[axis]);
+        transformRealSignals(inpData, outData, numSignals, n, inverse);
+        return true;
+    }
+
     if (!((dims.size() == 3 && numSignalDims == 1 && signalDimsData[0] == 1) ||
           (dims.size() == 4 && ((numSignalDims == 1 && signalDimsData[0] == 1) ||
                                 (numSignalDims == 2 && signalDimsData[0] == 1 && signalDimsData[1] == 2))) ||
@@ -150,152 +187,46 @@ bool FFT::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) co
         IE_THROW() << "Unsupported configuration: Input dims " << dims.size() << " and signal dims " << ss.str();
     }
 
-    const int batch = dims[0];
-
+    const size_t batch = dims[0];
+    SignalLayout layout;
+    size_t numSignals;
+    bool shift = centered;
     if (dims.size() == 5 && numSignalDims == 2 && signalDimsData[0] == 1 && signalDimsData[1] == 2) {
-        const int channels = dims[1];
-        int rows = dims[2];
-        int cols = dims[3];
-        const int planeSize = channels * rows * cols;
-        ov::parallel_for(batch * cols, [&](size_t d) {
-            int b = d / cols;
-            int col = d % cols;
-            // Copy a slice from input
-            CvMat* inpSlice = cvCreateMatHeader(channels * rows, 1, CV_32FC2);
-            CvMat* outSlice = cvCreateMatHeader(channels * rows, 1, CV_32FC2);
-            cvSetData(inpSlice, reinterpret_cast<void*>(inpData + (b * planeSize + col) * 2), cols * 2 * sizeof(float));
-            cvSetData(outSlice, reinterpret_cast<void*>(outData + (b * planeSize + col) * 2), cols * 2 * sizeof(float));
-
-            CvMat* inp_col = cvCloneMat(inpSlice);
-
-            CvMat inp_header, *inp;
-            inp = cvReshape(inp_col, &inp_header, 2, channels);
-
-            CvMat* out = cvCreateMatHeader(channels, rows, CV_32FC2);
-            cvCreateData(out);
-
-            if (centered)
-                fftshift(inp, true);
-
-            if (inverse)
-                cvDFT(inp, out, CV_DXT_INVERSE, 0);
-            else
-                cvDFT(inp, out, CV_DXT_FORWARD, 0);
-            cvScale(out, out, 1.0 / sqrtf(channels * rows), 0);
-
-            if (centered)
-                fftshift(out, false);
-
-            CvMat out_col_header, *out_col;
-            out_col = cvReshape(out, &out_col_header, 2, channels * rows);
-
-            cvCopy(out_col, outSlice, 0);
-
-            cvReleaseData(inp_col);
-            cvReleaseMat(&inp_col);
-
-            cvReleaseData(out);
-            cvReleaseMat(&out);
-
-            cvReleaseMat(&inpSlice);
-            cvReleaseMat(&outSlice);
-        });
+        // Signals of channels x rows for each column
+        const size_t channels = dims[1];
+        const size_t rows = dims[2];
+        const size_t cols = dims[3];
+        layout = {static_cast<int>(channels), static_cast<int>(rows), rows * cols, cols, cols, channels * rows * cols};
+        numSignals = batch * cols;
     } else if (dims.size() == 5 && numSignalDims == 2 && signalDimsData[0] == 2 && signalDimsData[1] == 3) {
-        const int channels = dims[1];
-        int rows = dims[2];
-        int cols = dims[3];
-        int planeSize = rows * cols * 2;  // 2 is last dimension size
-        ov::parallel_for(batch * channels, [&](size_t d) {
-            CvMat* inp = cvCreateMatHeader(rows, cols, CV_32FC2);
-            CvMat* out = cvCreateMatHeader(rows, cols, CV_32FC2);
-            cvSetData(inp, reinterpret_cast<void*>(inpData + d * planeSize), cols * 2 * sizeof(float));
-            cvSetData(out, reinterpret_cast<void*>(outData + d * planeSize), cols * 2 * sizeof(float));
-
-            if (centered)
-                fftshift(inp, true);
-
-            if (inverse)
-                cvDFT(inp, out, CV_DXT_INVERSE, 0);
-            else
-                cvDFT(inp, out, CV_DXT_FORWARD, 0);
-            cvScale(out, out, 1.0 / sqrtf(cols * rows), 0);
-
-            if (centered)
-                fftshift(out, false);
-
-            cvReleaseMat(&inp);
-            cvReleaseMat(&out);
-        });
+        const size_t channels = dims[1];
+        const size_t rows = dims[2];
+        const size_t cols = dims[3];
+        layout = {static_cast<int>(rows), static_cast<int>(cols), cols, 1, 1, rows * cols};
+        numSignals = batch * channels;
     } else if (dims.size() == 4 && numSignalDims == 2 && signalDimsData[0] == 1 && signalDimsData[1] == 2) {
-        int rows = dims[1];
-        int cols = dims[2];
-        int planeSize = rows * cols * 2;  // 2 is last dimension size
-        ov::parallel_for(batch, [&](size_t d) {
-            CvMat* inp = cvCreateMatHeader(rows, cols, CV_32FC2);
-            CvMat* out = cvCreateMatHeader(rows, cols, CV_32FC2);
-            cvSetData(inp, reinterpret_cast<void*>(inpData + d * planeSize), cols * 2 * sizeof(float));
-            cvSetData(out, reinterpret_cast<void*>(outData + d * planeSize), cols * 2 * sizeof(float));
-
-            if (centered)
-                fftshift(inp, true);
-
-            if (inverse)
-                cvDFT(inp, out, CV_DXT_INVERSE, 0);
-            else
-                cvDFT(inp, out, CV_DXT_FORWARD, 0);
-            cvScale(out, out, 1.0 / sqrtf(cols * rows), 0);
-
-            if (centered)
-                fftshift(out, false);
-
-            cvReleaseMat(&inp);
-            cvReleaseMat(&out);
-        });
+        const size_t rows = dims[1];
+        const size_t cols = dims[2];
+        layout = {static_cast<int>(rows), static_cast<int>(cols), cols, 1, 1, rows * cols};
+        numSignals = batch;
     } else if (dims.size() == 4 && numSignalDims == 1 && signalDimsData[0] == 1) {
-        int rows = dims[1];
-        int cols = dims[2];
-
-        const int planeSize = rows;
-        ov::parallel_for(batch * cols, [&](size_t d) {
-            int b = d / cols;
-            int col = d % cols;
-            CvMat* inp = cvCreateMatHeader(rows, 1, CV_32FC2);
-            CvMat* out = cvCreateMatHeader(rows, 1, CV_32FC2);
-            cvSetData(inp, reinterpret_cast<void*>(inpData + (b * planeSize * cols + col) * 2), cols * 2 * sizeof(float));
-            cvSetData(out, reinterpret_cast<void*>(outData + (b * planeSize * cols + col) * 2), cols * 2 * sizeof(float));
-
-            if (centered)
-                fftshift(inp, true);
-
-            if (inverse)
-                cvDFT(inp, out, CV_DXT_INVERSE, 0);
-            else
-                cvDFT(inp, out, CV_DXT_FORWARD, 0);
-            cvScale(out, out, 1.0 / sqrtf(rows), 0);
-
-            if (centered)
-                fftshift(out, false);
-
-            cvReleaseMat(&inp);
-            cvReleaseMat(&out);
-        });
-    } else if (dims.size() == 3) {
-        int rows = dims[0];
-        int cols = dims[1];
-        CvMat* inp = cvCreateMatHeader(rows, cols, CV_32FC2);
-        CvMat* out = cvCreateMatHeader(rows, cols, CV_32FC2);
-        cvSetData(inp, reinterpret_cast<void*>(inpData), cols * 2 * sizeof(float));
-        cvSetData(out, reinterpret_cast<void*>(outData), cols * 2 * sizeof(float));
-
-        if (inverse)
-            cvDFT(inp, out, CV_DXT_INVERSE | CV_DXT_ROWS, 0);
-        else
-            cvDFT(inp, out, CV_DXT_FORWARD | CV_DXT_ROWS, 0);
-        cvScale(out, out, 1.0 / sqrtf(cols), 0);
-
-        cvReleaseMat(&inp);
-        cvReleaseMat(&out);
+        // Signals of rows for each column
+        const size_t rows = dims[1];
+        const size_t cols = dims[2];
+        layout = {static_cast<int>(rows), 1, cols, 1, cols, rows * cols};
+        numSignals = batch * cols;
+    } else {
+        // Signals are rows, which are never shifted
+        const size_t rows = dims[0];
+        const size_t cols = dims[1];
+        layout = {1, static_cast<int>(cols), cols, 1, 1, cols};
+        numSignals = rows;
+        shift = false;
     }
+
+    ov::parallel_for(numSignals, [&](size_t d) {
+        transformSignal(inpData, outData, d, layout, inverse, shift);
+    });
     return true;
 }
 
@@ -13,7 +13,7 @@ public:
     OPENVINO_OP("FFT");
 
     FFT() = default;
-    FFT(const ov::OutputVector& args, bool inverse, bool centered);
+    FFT(const ov::OutputVector& args, bool inverse, bool centered, bool onesided = false);
     void validate_and_infer_types() override;
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
     bool visit_attributes(ov::AttributeVisitor& visitor) override;
@@ -24,6 +24,8 @@ public:
 private:
     bool inverse = false;
     bool centered = false;
+    // Real signals and Hermitian-packed spectrums of their innermost dimension (like torch.fft.rfft and irfft)
+    bool onesided = false;
 };
 
 }  // namespace TemplateExtension
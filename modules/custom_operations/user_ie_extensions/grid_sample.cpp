@@ -5,13 +5,83 @@
 #include "grid_sample.hpp"
 #include <openvino/core/parallel.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace TemplateExtension;
 
-GridSample::GridSample(const ov::OutputVector& args) : Op(args) {
+namespace {
+
+// Taps of an output point: offsets in an input plane and their weights
+const size_t kBilinearTaps = 4;
+const size_t kNearestTaps = 1;
+const size_t kBicubicTaps = 16;
+
+enum class Padding { Zeros, Border, Reflection };
+
+// Grid values in [-1, 1] to input coordinates
+float unnormalize(float coord, size_t size, bool alignCorners) {
+    return alignCorners ? 0.5f * (coord + 1) * (size - 1) : 0.5f * ((coord + 1) * size - 1);
+}
+
+float clip(float coord, size_t size) {
+    return std::min(static_cast<float>(size - 1), std::max(coord, 0.0f));
+}
+
+// Reflects coordinate by the borders [twiceLow / 2, twiceHigh / 2]
+float reflect(float coord, int twiceLow, int twiceHigh) {
+    if (twiceLow == twiceHigh) {
+        return 0.0f;
+    }
+    const float low = twiceLow * 0.5f;
+    const float span = (twiceHigh - twiceLow) * 0.5f;
+    coord = std::fabs(coord - low);
+    const float extra = std::fmod(coord, span);
+    const int flips = static_cast<int>(std::floor(coord / span));
+    return flips % 2 == 0 ? extra + low : span - extra + low;
+}
+
+float pad(float coord, size_t size, Padding padding, bool alignCorners) {
+    switch (padding) {
+    case Padding::Border:
+        return clip(coord, size);
+    case Padding::Reflection:
+        if (alignCorners) {
+            return clip(reflect(coord, 0, 2 * (static_cast<int>(size) - 1)), size);
+        }
+        return clip(reflect(coord, -1, 2 * static_cast<int>(size) - 1), size);
+    default:
+        return coord;
+    }
+}
+
+// Cubic convolution coefficients of taps at -1, 0, 1 and 2 for a fraction t (A = -0.75 like in PyTorch)
+void cubicCoefficients(float t, float coeffs[4]) {
+    const float A = -0.75f;
+    const float t1 = t + 1;
+    const float t2 = 1 - t;
+    const float t3 = 2 - t;
+    coeffs[0] = ((A * t1 - 5 * A) * t1 + 8 * A) * t1 - 4 * A;
+    coeffs[1] = ((A + 2) * t - (A + 3)) * t * t + 1;
+    coeffs[2] = ((A + 2) * t2 - (A + 3)) * t2 * t2 + 1;
+    coeffs[3] = ((A * t3 - 5 * A) * t3 + 8 * A) * t3 - 4 * A;
+}
+
+}  // namespace
+
+GridSample::GridSample(const ov::OutputVector& args,
+                       const std::string& mode,
+                       const std::string& padding_mode,
+                       bool align_corners)
+    : Op(args), mode(mode), padding_mode(padding_mode), align_corners(align_corners) {
     constructor_validate_and_infer_types();
 }
 
 void GridSample::validate_and_infer_types() {
+    OPENVINO_ASSERT(mode == "bilinear" || mode == "nearest" || mode == "bicubic",
+                    "Unsupported GridSample mode: ", mode);
+    OPENVINO_ASSERT(padding_mode == "zeros" || padding_mode == "border" || padding_mode == "reflection",
+                    "Unsupported GridSample padding mode: ", padding_mode);
     auto outShape = get_input_partial_shape(0);  // NC
     // Grid input has a shape NxHxWx2
     auto gridShape = get_input_partial_shape(1);
@@ -22,7 +92,16 @@ void GridSample::validate_and_infer_types() {
 
 std::shared_ptr<ov::Node> GridSample::clone_with_new_inputs(const ov::OutputVector& new_args) const {
     OPENVINO_ASSERT(new_args.size() == 2, "Incorrect number of new arguments");
-    return std::make_shared<GridSample>(new_args);
+    return std::make_shared<GridSample>(new_args, mode, padding_mode, align_corners);
+}
+
+bool GridSample::visit_attributes(ov::AttributeVisitor& visitor) {
+    int align_corners_i = static_cast<int>(align_corners);
+    visitor.on_attribute("mode", mode);
+    visitor.on_attribute("padding_mode", padding_mode);
+    visitor.on_attribute("align_corners", align_corners_i);
+    align_corners = static_cast<bool>(align_corners_i);
+    return true;
 }
 
 bool GridSample::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
@@ -42,63 +121,77 @@ bool GridSample::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inp
     const size_t inpPlane  = inpHeight * inpWidth;
     const size_t outPlane  = height * width;
 
-    std::vector<float> zerosPlane(inpDims[1] * inpDims[2] * inpDims[3], 0);
-    float* zeros = zerosPlane.data();
+    const Padding padding = padding_mode == "border"       ? Padding::Border
+                            : padding_mode == "reflection" ? Padding::Reflection
+                                                           : Padding::Zeros;
+    const bool alignCorners = align_corners;
+    const size_t numTaps = mode == "nearest" ? kNearestTaps : mode == "bicubic" ? kBicubicTaps : kBilinearTaps;
 
-    ov::parallel_for(batch, [&](size_t d) {
-        const float* inp  = inpData + d * channels * inpPlane;
-        const float* grid = gridData + d * outPlane * 2;
-        for (size_t y = 0; y < height; ++y) {
-            for (size_t x = 0; x < width; ++x) {
-                size_t offset = y * width + x;
-
-                float input_x = 0.5f * (grid[offset * 2] + 1) * (inpWidth - 1);
-                int x0 = static_cast<int>(std::floor(input_x));
-                int x1 = x0 + 1;
-
-                float input_y = 0.5f * (grid[offset * 2 + 1] + 1) * (inpHeight - 1);
-                int y0 = static_cast<int>(std::floor(input_y));
-                int y1 = y0 + 1;
-
-                const float* inp_row0 = (0 <= y0 && y0 < inpHeight) ? inp + y0 * inpWidth : zeros;
-                const float* inp_row1 = (0 <= y1 && y1 < inpHeight) ? inp + y1 * inpWidth : zeros;
-                float* out = outData + d * channels * outPlane;
-                if ((x1 < 0 || inpWidth <= x1) && (x0 < 0 || inpWidth <= x0)) {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] = 0;
-                        out += outPlane;
-                    }
-                }
-                else if (x1 < 0 || inpWidth <= x1) {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] = inp_row0[x0] +
-                            (input_y - y0) * (inp_row1[x0] - inp_row0[x0]) +
-                            (input_x - x0) * (-inp_row0[x0] +
-                            (input_y - y0) * (inp_row0[x0] - inp_row1[x0]));
-                        out += outPlane;
-                        inp_row0 += inpPlane;
-                        inp_row1 += inpPlane;
+    // Each row of the output computes offsets and weights of the taps of its points once and reuses them
+    // for all the channels. Taps outside of the input have zero weight
+    ov::parallel_for2d(batch, height, [&](size_t d, size_t y) {
+        thread_local std::vector<size_t> offsets;
+        thread_local std::vector<float> weights;
+        offsets.assign(width * numTaps, 0);
+        weights.assign(width * numTaps, 0.0f);
+
+        const auto addTap = [&](size_t tap, int tx, int ty, float weight) {
+            if (0 <= tx && tx < static_cast<int>(inpWidth) && 0 <= ty && ty < static_cast<int>(inpHeight)) {
+                offsets[tap] = ty * inpWidth + tx;
+                weights[tap] = weight;
+            }
+        };
+        const float* grid = gridData + (d * outPlane + y * width) * 2;
+        for (size_t x = 0; x < width; ++x) {
+            const size_t tap = x * numTaps;
+            const float ix = unnormalize(grid[x * 2], inpWidth, alignCorners);
+            const float iy = unnormalize(grid[x * 2 + 1], inpHeight, alignCorners);
+            if (numTaps == kNearestTaps) {
+                addTap(tap,
+                       static_cast<int>(std::nearbyint(pad(ix, inpWidth, padding, alignCorners))),
+                       static_cast<int>(std::nearbyint(pad(iy, inpHeight, padding, alignCorners))),
+                       1.0f);
+            } else if (numTaps == kBilinearTaps) {
+                const float px = pad(ix, inpWidth, padding, alignCorners);
+                const float py = pad(iy, inpHeight, padding, alignCorners);
+                const int x0 = static_cast<int>(std::floor(px));
+                const int y0 = static_cast<int>(std::floor(py));
+                const float wx = px - x0;
+                const float wy = py - y0;
+                addTap(tap, x0, y0, (1 - wx) * (1 - wy));
+                addTap(tap + 1, x0 + 1, y0, wx * (1 - wy));
+                addTap(tap + 2, x0, y0 + 1, (1 - wx) * wy);
+                addTap(tap + 3, x0 + 1, y0 + 1, wx * wy);
+            } else {
+                // Padding applies to each of 4x4 taps around the unpadded coordinate
+                const float fx = std::floor(ix);
+                const float fy = std::floor(iy);
+                float cx[4], cy[4];
+                cubicCoefficients(ix - fx, cx);
+                cubicCoefficients(iy - fy, cy);
+                for (int j = 0; j < 4; ++j) {
+                    const int ty = static_cast<int>(pad(fy - 1 + j, inpHeight, padding, alignCorners));
+                    for (int i = 0; i < 4; ++i) {
+                        const int tx = static_cast<int>(pad(fx - 1 + i, inpWidth, padding, alignCorners));
+                        addTap(tap + j * 4 + i, tx, ty, cx[i] * cy[j]);
                     }
                 }
-                else if (x0 < 0 || inpWidth <= x0) {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] =
-                            (input_x - x0) * (inp_row0[x1] + (input_y - y0) * (inp_row1[x1] - inp_row0[x1]));
-                        out += outPlane;
-                        inp_row0 += inpPlane;
-                        inp_row1 += inpPlane;
-                    }
-                } else {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] = inp_row0[x0] +
-                            (input_y - y0) * (inp_row1[x0] - inp_row0[x0]) +
-                            (input_x - x0) * (inp_row0[x1] - inp_row0[x0] +
-                            (input_y - y0) * (inp_row1[x1] - inp_row0[x1] - inp_row1[x0] + inp_row0[x0]));
-                        out += outPlane;
-                        inp_row0 += inpPlane;
-                        inp_row1 += inpPlane;
-                    }
+            }
+        }
+
+        const float* inp = inpData + d * channels * inpPlane;
+        float* out = outData + d * channels * outPlane + y * width;
+        for (size_t c = 0; c < channels; ++c) {
+            const float* plane = inp + c * inpPlane;
+            float* row = out + c * outPlane;
+            for (size_t x = 0; x < width; ++x) {
+                const size_t* tapOffsets = &offsets[x * numTaps];
+                const float* tapWeights = &weights[x * numTaps];
+                float sum = 0.0f;
+                for (size_t t = 0; t < numTaps; ++t) {
+                    sum += tapWeights[t] * plane[tapOffsets[t]];
                 }
+                row[x] = sum;
             }
         }
     });
@@ -13,12 +13,23 @@ public:
     OPENVINO_OP("GridSample");
 
     GridSample() = default;
-    GridSample(const ov::OutputVector& new_args);
+    GridSample(const ov::OutputVector& new_args,
+               const std::string& mode = "bilinear",
+               const std::string& padding_mode = "zeros",
+               bool align_corners = true);
     void validate_and_infer_types() override;
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
 
     bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override;
     bool has_evaluate() const override;
+
+private:
+    // Interpolation of torch.nn.functional.grid_sample: "bilinear", "nearest" or "bicubic"
+    std::string mode = "bilinear";
+    // Values outside of the input: "zeros", "border" or "reflection"
+    std::string padding_mode = "zeros";
+    bool align_corners = true;
 };
 
 }  // namespace TemplateExtension
@@ -34,6 +34,15 @@
 #    define FFT_EXT
 #endif
 
+#ifdef grid_sample
+#    include "grid_sample.hpp"
+// Frontends have GridSample of their own, so the operation is created by IR or by the API only
+#    define GRID_SAMPLE_EXT                                                                            \
+            std::make_shared<ov::OpExtension<TemplateExtension::GridSample>>(),
+#else
+#    define GRID_SAMPLE_EXT
+#endif
+
 #ifdef sparse_conv_transpose
 #    include "sparse_conv_transpose.hpp"
 #    define S_CONV_TRANSPOSE_EXT                                                                      \
@@ -56,6 +65,7 @@
 #    include "sentence_piece/sentence_piece.hpp"
 #    define SENTENSE_PIECE_EXT                                                                                              \
             std::make_shared<ov::OpExtension<TemplateExtension::SentencepieceTokenizer>>(),                                 \
+            std::make_shared<ov::OpExtension<TemplateExtension::SentencepieceDetokenizer>>(),                               \
             std::make_shared<ov::frontend::ConversionExtension>("SentencepieceOp", translate_sentencepiece_op),             \
             std::make_shared<ov::frontend::ConversionExtension>("RaggedTensorToSparse", translate_sentencepiece_tokenizer),
 #else
@@ -66,6 +76,7 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>(
     {
         CALCULATE_GRID_EXT
         FFT_EXT
+        GRID_SAMPLE_EXT
         S_CONV_TRANSPOSE_EXT
         S_CONV_EXT
         COMPLEX_MUL_EXT
@@ -6,6 +6,7 @@
 #include "sentence_piece.hpp"
 
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/core/parallel.hpp"
 
 using sentencepiece::SentencePieceProcessor;
 using namespace TemplateExtension;
@@ -22,39 +23,27 @@ namespace {
         FRONT_END_GENERAL_CHECK(const_value.size() == 1, "Conversion expects " + const_name + " to be a scalar.");
         return const_value[0];
     }
+
+    std::shared_ptr<SentencePieceProcessor> load_sp_model(const OutputVector& args, const std::string& op_name,
+        const std::string& input_name) {
+        FRONT_END_GENERAL_CHECK(args.size() == 2, op_name + " expects two inputs: sp model and " + input_name);
+        auto sp_model_const = as_type_ptr<Constant>(args[0].get_node_shared_ptr());
+        FRONT_END_GENERAL_CHECK(sp_model_const, op_name + " expects SentencePiece model to be constant.");
+        auto spm_model = static_cast<const char*>(sp_model_const->get_data_ptr());
+        auto spm_model_size = sp_model_const->get_byte_size();
+
+        // configure SentencePieceProcessor
+        auto sp = std::make_shared<SentencePieceProcessor>();
+        std::string model_proto(spm_model, spm_model_size);
+        CHECK_OK(sp->LoadFromSerializedProto(model_proto));
+        return sp;
+    }
 }  // namespace
 
 SentencepieceTokenizer::SentencepieceTokenizer(const OutputVector& args, int32_t nbest_size, float alpha,
-    bool add_bos, bool add_eos, bool reverse) : m_sp(std::make_shared<SentencePieceProcessor>()),
+    bool add_bos, bool add_eos, bool reverse) :
     m_nbest_size(nbest_size), m_alpha(alpha), m_add_bos(add_bos), m_add_eos(add_eos),
     m_reverse(reverse), Op(args) {
-    FRONT_END_GENERAL_CHECK(args.size() == 2, "SentencepieceTokenizer expects two inputs: sp model and input sentences");
-    auto sp_model_const = as_type_ptr<Constant>(args[0].get_node_shared_ptr());
-    FRONT_END_GENERAL_CHECK(sp_model_const, "SentencepieceTokenizer expects SentencePiece model to be constant.");
-    auto spm_model = static_cast<const char*>(sp_model_const->get_data_ptr());
-    auto spm_model_size = sp_model_const->get_byte_size();
-
-    // configure SentencePieceProcessor
-    std::string model_proto(spm_model, spm_model_size);
-    CHECK_OK(m_sp->LoadFromSerializedProto(model_proto));
-
-    // form extra options to configure SentencePieceProcessor
-    std::string extra_options = "";
-    if (m_add_bos) {
-        extra_options += "bos";
-    }
-    if (m_add_eos) {
-        extra_options = extra_options.empty() ? extra_options : extra_options + ":";
-        extra_options += "eos";
-    }
-    /* TODO: TF ignores this option, so we are ignoring it as well; need to understand what should we do
-    if (m_reverse) {
-        extra_options = extra_options.empty() ? extra_options : extra_options + ":";
-        extra_options += "reverse";
-    }
-    */
-    // example of extra_options, if "bos:eos:reverse"
-    CHECK_OK(m_sp->SetEncodeExtraOptions(extra_options));
     constructor_validate_and_infer_types();
 }
 
@@ -66,6 +55,30 @@ SentencepieceTokenizer::SentencepieceTokenizer(const OutputVector& args, const s
 }
 
 void SentencepieceTokenizer::validate_and_infer_types() {
+    // operations created by the default constructor, like the ones read from IR,
+    // load the model once their inputs and attributes are set
+    if (!m_sp) {
+        m_sp = load_sp_model(input_values(), "SentencepieceTokenizer", "input sentences");
+
+        // form extra options to configure SentencePieceProcessor
+        std::string extra_options = "";
+        if (m_add_bos) {
+            extra_options += "bos";
+        }
+        if (m_add_eos) {
+            extra_options = extra_options.empty() ? extra_options : extra_options + ":";
+            extra_options += "eos";
+        }
+        /* TODO: TF ignores this option, so we are ignoring it as well; need to understand what should we do
+        if (m_reverse) {
+            extra_options = extra_options.empty() ? extra_options : extra_options + ":";
+            extra_options += "reverse";
+        }
+        */
+        // example of extra_options, if "bos:eos:reverse"
+        CHECK_OK(m_sp->SetEncodeExtraOptions(extra_options));
+    }
+
     // The operation SentencepieceTokenizerExtensionOp has three outputs: sparse indices, sparse values
     // and dense shape
     set_output_type(0, element::i64, PartialShape{ Dimension(), Dimension(2) });
@@ -83,10 +96,6 @@ bool SentencepieceTokenizer::visit_attributes(AttributeVisitor& visitor) {
 }
 
 bool SentencepieceTokenizer::evaluate(TensorVector& outputs, const TensorVector& inputs) const {
-    std::vector<int64_t> sparse_indices;
-    std::vector<int32_t> sparse_values;
-    std::vector<int64_t> sparse_dense_shape;
-
     FRONT_END_GENERAL_CHECK(inputs.size() == 2, "SentencepieceTokenizer expects two inputs: sp model and input sentences");
 
     const uint8_t* strings = inputs[1].data<uint8_t>();
@@ -99,32 +108,47 @@ bool SentencepieceTokenizer::evaluate(TensorVector& outputs, const TensorVector&
         "Incorrect packed string tensor format: the packed string tensor must contain first string offset and end indices");
     auto begin_ids = reinterpret_cast<const int32_t*>(strings + 4);
     auto end_ids = begin_ids + 1;
-    auto data = strings + 4 + 4 + 4 * batch_size;
+    auto data = reinterpret_cast<const char*>(strings + 4 + 4 + 4 * batch_size);
+
+    // sentences are tokenized in parallel right from the input tensor,
+    // nbest_size 0 and 1 disable sampling, so the greedy encoding is called directly
+    const bool sampling = m_nbest_size != 0 && m_nbest_size != 1;
+    std::vector<std::vector<int>> ids(batch_size);
+    ov::parallel_for(static_cast<size_t>(batch_size), [&](size_t batch_ind) {
+        absl::string_view sentence(data + begin_ids[batch_ind], end_ids[batch_ind] - begin_ids[batch_ind]);
+        if (sampling) {
+            CHECK_OK(m_sp->SampleEncode(sentence, m_nbest_size, m_alpha, &ids[batch_ind]));
+        } else {
+            CHECK_OK(m_sp->Encode(sentence, &ids[batch_ind]));
+        }
+    });
 
+    // tokens of each sentence start at the total number of tokens of the previous ones
+    std::vector<size_t> token_offsets(batch_size + 1, 0);
     size_t max_token_id = 0;
     for (size_t batch_ind = 0; batch_ind < batch_size; ++batch_ind) {
-        auto begin_ind = begin_ids[batch_ind];
-        auto end_ind = end_ids[batch_ind];
-        std::vector<int32_t> ids;
-        std::string sentence(data + begin_ind, data + end_ind);
-        CHECK_OK(m_sp->SampleEncode(sentence, m_nbest_size, m_alpha, &ids));
-        // put into resulted vectors
-        for (size_t token_id = 0; token_id < ids.size(); ++token_id) {
-            sparse_indices.push_back(static_cast<int64_t>(batch_ind));
-            sparse_indices.push_back(static_cast<int64_t>(token_id));
-            sparse_values.push_back(static_cast<int32_t>(ids[token_id]));
-        }
-        max_token_id = max_token_id < ids.size() ? ids.size() : max_token_id;
+        token_offsets[batch_ind + 1] = token_offsets[batch_ind] + ids[batch_ind].size();
+        max_token_id = max_token_id < ids[batch_ind].size() ? ids[batch_ind].size() : max_token_id;
     }
-    sparse_dense_shape.push_back(static_cast<int64_t>(batch_size));
-    sparse_dense_shape.push_back(static_cast<int64_t>(max_token_id));
+    const size_t num_tokens = token_offsets[batch_size];
 
-    outputs[0].set_shape({ sparse_indices.size() / 2, 2 });
-    memcpy(outputs[0].data(), sparse_indices.data(), sizeof(int64_t) * sparse_indices.size());
-    outputs[1].set_shape({ sparse_values.size() });
-    memcpy(outputs[1].data(), sparse_values.data(), sizeof(int32_t) * sparse_values.size());
+    outputs[0].set_shape({ num_tokens, 2 });
+    outputs[1].set_shape({ num_tokens });
     outputs[2].set_shape({ 2 });
-    memcpy(outputs[2].data(), sparse_dense_shape.data(), sizeof(int64_t) * sparse_dense_shape.size());
+    auto sparse_indices = outputs[0].data<int64_t>();
+    auto sparse_values = outputs[1].data<int32_t>();
+    auto sparse_dense_shape = outputs[2].data<int64_t>();
+    ov::parallel_for(static_cast<size_t>(batch_size), [&](size_t batch_ind) {
+        const auto& sentence_ids = ids[batch_ind];
+        const size_t offset = token_offsets[batch_ind];
+        for (size_t token_id = 0; token_id < sentence_ids.size(); ++token_id) {
+            sparse_indices[(offset + token_id) * 2] = static_cast<int64_t>(batch_ind);
+            sparse_indices[(offset + token_id) * 2 + 1] = static_cast<int64_t>(token_id);
+            sparse_values[offset + token_id] = static_cast<int32_t>(sentence_ids[token_id]);
+        }
+    });
+    sparse_dense_shape[0] = static_cast<int64_t>(batch_size);
+    sparse_dense_shape[1] = static_cast<int64_t>(max_token_id);
     return true;
 }
 
@@ -136,6 +160,77 @@ std::shared_ptr<Node> SentencepieceTokenizer::clone_with_new_inputs(const Output
     return std::make_shared<SentencepieceTokenizer>(new_args, m_sp, m_nbest_size, m_alpha, m_add_bos, m_add_eos, m_reverse);
 }
 
+SentencepieceDetokenizer::SentencepieceDetokenizer(const OutputVector& args) : Op(args) {
+    constructor_validate_and_infer_types();
+}
+
+SentencepieceDetokenizer::SentencepieceDetokenizer(const OutputVector& args,
+    const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp) : m_sp(sp), Op(args) {
+    constructor_validate_and_infer_types();
+}
+
+void SentencepieceDetokenizer::validate_and_infer_types() {
+    if (!m_sp) {
+        m_sp = load_sp_model(input_values(), "SentencepieceDetokenizer", "token ids");
+    }
+    FRONT_END_GENERAL_CHECK(get_input_partial_shape(1).rank().compatible(2),
+        "SentencepieceDetokenizer expects token ids of shape [batch, length]");
+    FRONT_END_GENERAL_CHECK(get_input_element_type(1).is_dynamic() || get_input_element_type(1) == element::i32 ||
+        get_input_element_type(1) == element::i64, "SentencepieceDetokenizer expects i32 or i64 token ids");
+    // The output is the packed string tensor
+    set_output_type(0, element::u8, PartialShape{ Dimension() });
+}
+
+bool SentencepieceDetokenizer::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+bool SentencepieceDetokenizer::evaluate(TensorVector& outputs, const TensorVector& inputs) const {
+    FRONT_END_GENERAL_CHECK(inputs.size() == 2, "SentencepieceDetokenizer expects two inputs: sp model and token ids");
+    const auto& shape = inputs[1].get_shape();
+    const size_t batch_size = shape[0];
+    const size_t length = shape[1];
+    const bool i64_ids = inputs[1].get_element_type() == element::i64;
+    const int64_t* ids_i64 = i64_ids ? inputs[1].data<int64_t>() : nullptr;
+    const int32_t* ids_i32 = i64_ids ? nullptr : inputs[1].data<int32_t>();
+
+    std::vector<std::string> sentences(batch_size);
+    ov::parallel_for(batch_size, [&](size_t batch_ind) {
+        std::vector<int> ids(length);
+        for (size_t token_id = 0; token_id < length; ++token_id) {
+            const size_t index = batch_ind * length + token_id;
+            ids[token_id] = i64_ids ? static_cast<int>(ids_i64[index]) : ids_i32[index];
+        }
+        CHECK_OK(m_sp->Decode(ids, &sentences[batch_ind]));
+    });
+
+    // pack sentences into the batch size, offsets of the sentences and their data
+    size_t total_size = 0;
+    for (const auto& sentence : sentences) {
+        total_size += sentence.size();
+    }
+    outputs[0].set_shape({ 4 + 4 + 4 * batch_size + total_size });
+    auto strings = outputs[0].data<uint8_t>();
+    auto offsets = reinterpret_cast<int32_t*>(strings + 4);
+    auto data = strings + 4 + 4 + 4 * batch_size;
+    *reinterpret_cast<int32_t*>(strings) = static_cast<int32_t>(batch_size);
+    offsets[0] = 0;
+    for (size_t batch_ind = 0; batch_ind < batch_size; ++batch_ind) {
+        const auto& sentence = sentences[batch_ind];
+        memcpy(data + offsets[batch_ind], sentence.data(), sentence.size());
+        offsets[batch_ind + 1] = offsets[batch_ind] + static_cast<int32_t>(sentence.size());
+    }
+    return true;
+}
+
+bool SentencepieceDetokenizer::has_evaluate() const {
+    return true;
+}
+
+std::shared_ptr<Node> SentencepieceDetokenizer::clone_with_new_inputs(const OutputVector& new_args) const {
+    return std::make_shared<SentencepieceDetokenizer>(new_args, m_sp);
+}
+
 OutputVector translate_sentencepiece_op(const NodeContext& node) {
     // extract model to configure SentencePieceTokenizer
     auto sp_model_ov_any = node.get_attribute_as_any("model");
@@ -33,11 +33,35 @@ namespace TemplateExtension {
 
     private:
         std::shared_ptr<sentencepiece::SentencePieceProcessor> m_sp;
-        int32_t m_nbest_size;
-        float m_alpha;
-        bool m_add_bos;
-        bool m_add_eos;
-        bool m_reverse;
+        int32_t m_nbest_size = 0;
+        float m_alpha = 0.0f;
+        bool m_add_bos = false;
+        bool m_add_eos = false;
+        bool m_reverse = false;
+    };
+
+    // Turns token ids of the input 1 of shape [batch, length] back into sentences of the packed string tensor
+    // of the format of SentencepieceTokenizer input. Control tokens, like padding and end of sentence, are skipped
+    class SentencepieceDetokenizer : public ov::op::Op {
+    public:
+        OPENVINO_OP("SentencepieceDetokenizer");
+
+        SentencepieceDetokenizer() = default;
+        SentencepieceDetokenizer(const ov::OutputVector& args);
+        SentencepieceDetokenizer(const ov::OutputVector& args, const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp);
+
+        bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+        void validate_and_infer_types() override;
+
+        std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+        bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override;
+
+        bool has_evaluate() const override;
+
+    private:
+        std::shared_ptr<sentencepiece::SentencePieceProcessor> m_sp;
     };
 }  // namespace TemplateExtension
 
@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace TemplateExtension {
+
+// Voxel hash of input positions of SparseConv and SparseConvTranspose. Points are bucketed into cells of
+// the size of the kernel, so the points within the kernel of an output point are searched in at most
+// 2x2x2 cells around it instead of among all the input points
+class SparseConvIndex {
+public:
+    SparseConvIndex(const float* positions, size_t numPoints, float cellW, float cellH, float cellD)
+        : positions_(positions), cellW_(cellW), cellH_(cellH), cellD_(cellD) {
+        std::vector<std::pair<uint64_t, size_t>> keys(numPoints);
+        for (size_t j = 0; j < numPoints; ++j) {
+            const float* pos = positions + j * 3;
+            keys[j] = {key(cell(pos[0], cellW_), cell(pos[1], cellH_), cell(pos[2], cellD_)), j};
+        }
+        // Points of a cell are kept in ascending order of indices
+        std::sort(keys.begin(), keys.end());
+        order_.resize(numPoints);
+        for (size_t k = 0; k < numPoints; ++k) {
+            order_[k] = keys[k].second;
+            auto& range = cells_[keys[k].first];
+            if (range.second == 0) {
+                range.first = k;
+            }
+            range.second = k + 1;
+        }
+    }
+
+    // Collects indices of the points within [x - rw, x + rw] x [y - rh, y + rh] x [z - rd, z + rd]
+    // in ascending order, so the result doesn't depend on the order of cells
+    void query(float x, float y, float z, float rw, float rh, float rd, std::vector<size_t>& neighbours) const {
+        neighbours.clear();
+        for (int64_t cd = cell(z - rd, cellD_); cd <= cell(z + rd, cellD_); ++cd) {
+            for (int64_t ch = cell(y - rh, cellH_); ch <= cell(y + rh, cellH_); ++ch) {
+                for (int64_t cw = cell(x - rw, cellW_); cw <= cell(x + rw, cellW_); ++cw) {
+                    const auto range = cells_.find(key(cw, ch, cd));
+                    if (range == cells_.end()) {
+                        continue;
+                    }
+                    for (size_t k = range->second.first; k < range->second.second; ++k) {
+                        const size_t j = order_[k];
+                        const float* pos = positions_ + j * 3;
+                        if (x - rw <= pos[0] && pos[0] <= x + rw &&
+                            y - rh <= pos[1] && pos[1] <= y + rh &&
+                            z - rd <= pos[2] && pos[2] <= z + rd) {
+                            neighbours.push_back(j);
+                        }
+                    }
+                }
+            }
+        }
+        std::sort(neighbours.begin(), neighbours.end());
+    }
+
+private:
+    static int64_t cell(float coordinate, float size) {
+        return static_cast<int64_t>(std::floor(coordinate / size));
+    }
+
+    // Cells are packed by 21 bits per axis. Cells sharing a key only add points, which fail the exact check
+    static uint64_t key(int64_t cw, int64_t ch, int64_t cd) {
+        const uint64_t mask = (1u << 21) - 1;
+        return (static_cast<uint64_t>(cw) & mask) | (static_cast<uint64_t>(ch) & mask) << 21 |
+               (static_cast<uint64_t>(cd) & mask) << 42;
+    }
+
+    const float* positions_;
+    float cellW_;
+    float cellH_;
+    float cellD_;
+    std::vector<size_t> order_;
+    // Range [first, second) of order_ by key of the cell
+    std::unordered_map<uint64_t, std::pair<size_t, size_t>> cells_;
+};
+
+}  // namespace TemplateExtension
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/parallel.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "sparse_conv_index.hpp"
+
+namespace TemplateExtension {
+
+// Convolution of features of sparse points shared by SparseConv and SparseConvTranspose.
+// Neighbours are turned into a rulebook: pairs of (input, output) points for each offset of the kernel.
+// Then each offset gathers features of its inputs into a dense matrix, multiplies it by the IC x OC slice
+// of the kernel and scatter-adds the products to its outputs
+class SparseConvRulebook {
+public:
+    // Kernel layout is DxHxWxICxOC
+    SparseConvRulebook(const float* inpPos, size_t numInpPoints, const float* outPos, size_t numOutPoints,
+                       const float* offset, int kd, int kh, int kw, bool transposed)
+        : pairs_(static_cast<size_t>(kd) * kh * kw) {
+        // See https://github.com/isl-org/Open3D/blob/master/python/open3d/ml/torch/python/layers/convolutions.py
+        const float rw = kw * 0.51f;
+        const float rh = kh * 0.51f;
+        const float rd = kd * 0.51f;
+        const SparseConvIndex index(inpPos, numInpPoints, 2 * rw, 2 * rh, 2 * rd);
+
+        // Offsets of the kernel and inputs of each output point, which are merged into the rulebook in order
+        std::vector<std::vector<std::pair<size_t, size_t>>> rules(numOutPoints);
+        ov::parallel_for(numOutPoints, [&](size_t i) {
+            const float xi = outPos[i * 3] - offset[0];
+            const float yi = outPos[i * 3 + 1] - offset[1];
+            const float zi = outPos[i * 3 + 2] - offset[2];
+            std::vector<size_t> neighbours;
+            index.query(xi, yi, zi, rw, rh, rd, neighbours);
+            for (const size_t j : neighbours) {
+                int w = std::min(static_cast<int>(inpPos[j * 3] - xi + kw * 0.5f), kw - 1);
+                int h = std::min(static_cast<int>(inpPos[j * 3 + 1] - yi + kh * 0.5f), kh - 1);
+                int d = std::min(static_cast<int>(inpPos[j * 3 + 2] - zi + kd * 0.5f), kd - 1);
+                if (transposed) {
+                    w = kw - 1 - w;
+                    h = kh - 1 - h;
+                    d = kd - 1 - d;
+                }
+                rules[i].emplace_back(w + kw * (h + kh * d), j);
+            }
+        });
+        for (size_t i = 0; i < numOutPoints; ++i) {
+            for (const auto& rule : rules[i]) {
+                pairs_[rule.first].emplace_back(rule.second, i);
+            }
+        }
+    }
+
+    // Accumulates convolution of features [numInpPoints x IC] into zeroed output [numOutPoints x OC]
+    void convolve(const float* features, const float* kernel, int IC, int OC, float* out) const {
+        std::vector<float> gathered;
+        std::vector<float> products;
+        for (size_t k = 0; k < pairs_.size(); ++k) {
+            const auto& pairs = pairs_[k];
+            if (pairs.empty()) {
+                continue;
+            }
+            const size_t numPairs = pairs.size();
+            gathered.resize(numPairs * IC);
+            products.assign(numPairs * OC, 0.0f);
+            ov::parallel_for(numPairs, [&](size_t p) {
+                std::memcpy(&gathered[p * IC], features + pairs[p].first * IC, IC * sizeof(float));
+            });
+            // Rows of products are independent, each of them is a vectorizable sum of rows of the kernel slice
+            const float* weights = kernel + static_cast<size_t>(OC) * IC * k;
+            const size_t numBlocks = (numPairs + kRowsPerBlock - 1) / kRowsPerBlock;
+            ov::parallel_for(numBlocks, [&](size_t block) {
+                const size_t end = std::min(numPairs, (block + 1) * kRowsPerBlock);
+                for (size_t p = block * kRowsPerBlock; p < end; ++p) {
+                    float* row = &products[p * OC];
+                    for (int ic = 0; ic < IC; ++ic) {
+                        const float value = gathered[p * IC + ic];
+                        const float* weightsRow = weights + static_cast<size_t>(OC) * ic;
+                        for (int oc = 0; oc < OC; ++oc) {
+                            row[oc] += value * weightsRow[oc];
+                        }
+                    }
+                }
+            });
+            // Several inputs may fall into the same offset of an output, so products are added sequentially
+            for (size_t p = 0; p < numPairs; ++p) {
+                float* outRow = out + pairs[p].second * OC;
+                const float* row = &products[p * OC];
+                for (int oc = 0; oc < OC; ++oc) {
+                    outRow[oc] += row[oc];
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kRowsPerBlock = 64;
+
+    // Pairs of (input, output) points by offset of the kernel
+    std::vector<std::vector<std::pair<size_t, size_t>>> pairs_;
+};
+
+}  // namespace TemplateExtension
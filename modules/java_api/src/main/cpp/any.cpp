@@ -17,6 +17,14 @@ JNIEXPORT jint JNICALL Java_org_intel_openvino_Any_asInt(JNIEnv *env, jobject ob
     return 0;
 }
 
+JNIEXPORT jstring JNICALL Java_org_intel_openvino_Any_asString(JNIEnv *env, jobject obj, jlong addr) {
+    JNI_METHOD("asString",
+        Any *obj = (Any *)addr;
+        return env->NewStringUTF(obj->as<std::string>().c_str());
+    )
+    return 0;
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_Any_delete(JNIEnv *, jobject, jlong addr)
 {
     Any *obj = (Any *)addr;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <jni.h> // JNI header provided by JDK
+#include <fstream>
 #include "openvino/openvino.hpp"
 
 #include "openvino_java.hpp"
@@ -22,6 +23,33 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_CompiledModel_CreateInferRequest
     return 0;
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_CompiledModel_ExportModel(JNIEnv *env, jobject obj, jlong addr, jstring path)
+{
+    JNI_METHOD("ExportModel",
+        std::string n_path = jstringToString(env, path);
+        CompiledModel *compiled_model = (CompiledModel *)addr;
+
+        std::ofstream stream(n_path, std::ios::binary);
+        if (!stream.is_open())
+            throw std::runtime_error("Cannot open " + n_path);
+        compiled_model->export_model(stream);
+    )
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_CompiledModel_GetProperty(JNIEnv *env, jobject obj, jlong addr, jstring name)
+{
+    JNI_METHOD("GetProperty",
+        std::string n_name = jstringToString(env, name);
+        CompiledModel *compiled_model = (CompiledModel *)addr;
+
+        Any *property = new Any();
+        *property = compiled_model->get_property(n_name);
+
+        return (jlong)property;
+    )
+    return 0;
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_CompiledModel_delete(JNIEnv *, jobject, jlong addr)
 {
     CompiledModel *compiled_model = (CompiledModel *)addr;
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <jni.h> // JNI header provided by JDK
+#include <fstream>
+#include <istream>
 #include "openvino/openvino.hpp"
 
 #include "openvino_java.hpp"
@@ -9,6 +11,29 @@
 
 using namespace ov;
 
+namespace {
+
+// Reads a memory of a direct ByteBuffer, e.g. a memory-mapped file, without copying it
+class BufferStreamBuf : public std::streambuf {
+public:
+    BufferStreamBuf(char *data, size_t size) {
+        setg(data, data, data + size);
+    }
+};
+
+AnyMap toAnyMap(JNIEnv *env, jobject prop)
+{
+    AnyMap map;
+    if (prop) {
+        for (const auto& it : javaMapToMap(env, prop)) {
+            map[it.first] = it.second;
+        }
+    }
+    return map;
+}
+
+}  // namespace
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_GetCore(JNIEnv *env, jobject obj)
 {
 
@@ -76,6 +101,76 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModel(JNIEnv *env, j
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModel1(JNIEnv *env, jobject obj, jlong coreAddr, jlong netAddr, jstring device, jobject prop)
+{
+    JNI_METHOD("CompileModel1",
+        std::string n_device = jstringToString(env, device);
+
+        Core *core = (Core *)coreAddr;
+        std::shared_ptr<Model> *model = reinterpret_cast<std::shared_ptr<Model> *>(netAddr);
+
+        CompiledModel *compiled_model = new CompiledModel();
+        *compiled_model = core->compile_model(*model, n_device, toAnyMap(env, prop));
+
+        return (jlong)compiled_model;
+    )
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModelFile(JNIEnv *env, jobject obj, jlong coreAddr, jstring modelPath, jstring device, jobject prop)
+{
+    JNI_METHOD("CompileModelFile",
+        std::string n_path = jstringToString(env, modelPath);
+        std::string n_device = jstringToString(env, device);
+        Core *core = (Core *)coreAddr;
+
+        CompiledModel *compiled_model = new CompiledModel();
+        *compiled_model = core->compile_model(n_path, n_device, toAnyMap(env, prop));
+
+        return (jlong)compiled_model;
+    )
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ImportModel(JNIEnv *env, jobject obj, jlong coreAddr, jstring path, jstring device, jobject prop)
+{
+    JNI_METHOD("ImportModel",
+        std::string n_path = jstringToString(env, path);
+        std::string n_device = jstringToString(env, device);
+        Core *core = (Core *)coreAddr;
+
+        std::ifstream stream(n_path, std::ios::binary);
+        if (!stream.is_open())
+            throw std::runtime_error("Cannot open " + n_path);
+
+        CompiledModel *compiled_model = new CompiledModel();
+        *compiled_model = core->import_model(stream, n_device, toAnyMap(env, prop));
+
+        return (jlong)compiled_model;
+    )
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ImportModelBuffer(JNIEnv *env, jobject obj, jlong coreAddr, jobject buffer, jstring device, jobject prop)
+{
+    JNI_METHOD("ImportModelBuffer",
+        std::string n_device = jstringToString(env, device);
+        Core *core = (Core *)coreAddr;
+
+        char *data = static_cast<char *>(env->GetDirectBufferAddress(buffer));
+        if (!data)
+            throw std::runtime_error("Models can be imported from direct buffers only!");
+        BufferStreamBuf buf(data, static_cast<size_t>(env->GetDirectBufferCapacity(buffer)));
+        std::istream stream(&buf);
+
+        CompiledModel *compiled_model = new CompiledModel();
+        *compiled_model = core->import_model(stream, n_device, toAnyMap(env, prop));
+
+        return (jlong)compiled_model;
+    )
+    return 0;
+}
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_GetProperty(JNIEnv *env, jobject obj, jlong coreAddr, jstring device, jstring name)
 {
     JNI_METHOD("GetProperty",
@@ -96,11 +191,7 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_Core_SetProperty(JNIEnv *env, job
     JNI_METHOD("SetProperty",
         std::string n_device = jstringToString(env, device);
         Core *core = (Core *)coreAddr;
-        AnyMap map;
-        for (const auto& it : javaMapToMap(env, prop)) {
-            map[it.first] = it.second;
-        }
-        core->set_property(n_device, map);
+        core->set_property(n_device, toAnyMap(env, prop));
     )
 }
 
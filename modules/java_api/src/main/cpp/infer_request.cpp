@@ -9,6 +9,106 @@
 
 using namespace ov;
 
+namespace {
+
+/**
+ * Attaches threads of inference to the JVM as daemons once and detaches them at their exit, so
+ * callbacks don't pay for attaching on every completed request
+ */
+class ThreadAttachment {
+public:
+    JNIEnv *get(JavaVM *jvm, jint version) {
+        if (env_)
+            return env_;
+        if (jvm->GetEnv((void **)&env_, version) == JNI_OK)
+            return env_;
+        JavaVMAttachArgs args;
+        args.version = version;
+        args.name = NULL;
+        args.group = NULL;
+#ifdef _JAVASOFT_JNI_H_
+        jvm->AttachCurrentThreadAsDaemon((void **)&env_, &args);
+#else
+        jvm->AttachCurrentThreadAsDaemon(&env_, &args);
+#endif
+        jvm_ = jvm;
+        return env_;
+    }
+
+    ~ThreadAttachment() {
+        if (jvm_)
+            jvm_->DetachCurrentThread();
+    }
+
+private:
+    JNIEnv *env_ = nullptr;
+    JavaVM *jvm_ = nullptr;  // Set only when the thread was attached here
+};
+
+/**
+ * Java consumer of completion errors. It's referenced weakly, because InferRequest keeps it, and
+ * a global reference would keep both the consumer and InferRequest alive forever
+ */
+class Callback {
+public:
+    Callback(JNIEnv *env, jobject consumer)
+        : consumer_(env->NewWeakGlobalRef(consumer)),
+          accept_(env->GetMethodID(env->GetObjectClass(consumer), "accept", "(Ljava/lang/Object;)V")),
+          version_(env->GetVersion()) {
+        env->GetJavaVM(&jvm_);
+    }
+
+    Callback(const Callback &) = delete;
+    Callback &operator=(const Callback &) = delete;
+
+    ~Callback() {
+        JNIEnv *env = nullptr;
+        if (jvm_->GetEnv((void **)&env, version_) == JNI_OK)
+            env->DeleteWeakGlobalRef(consumer_);
+        else
+            attachment().get(jvm_, version_)->DeleteWeakGlobalRef(consumer_);
+    }
+
+    void operator()(std::exception_ptr error) {
+        JNIEnv *env = attachment().get(jvm_, version_);
+        jobject consumer = env->NewLocalRef(consumer_);
+        if (!consumer)
+            return;
+        jstring message = NULL;
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const std::exception &e) {
+                message = env->NewStringUTF(e.what());
+            } catch (...) {
+                message = env->NewStringUTF("Unknown exception");
+            }
+        }
+        env->CallVoidMethod(consumer, accept_, message);
+        // An exception of a callback can't be propagated anywhere
+        if (env->ExceptionCheck()) {
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+        }
+        if (message)
+            env->DeleteLocalRef(message);
+        env->DeleteLocalRef(consumer);
+    }
+
+private:
+    static ThreadAttachment &attachment() {
+        static thread_local ThreadAttachment attachment;
+        return attachment;
+    }
+
+    jweak consumer_;
+    jmethodID accept_;
+    jint version_;
+    JavaVM *jvm_ = nullptr;
+};
+
+}  // namespace
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *env, jobject obj, jlong addr)
 {
     JNI_METHOD("Infer",
@@ -16,6 +116,29 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *env, j
         infer_request->infer();)
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_InferWith(JNIEnv *env, jobject obj, jlong addr, jlongArray inputs, jlongArray outputs)
+{
+    JNI_METHOD("InferWith",
+        InferRequest *infer_request = (InferRequest *)addr;
+        // Addresses of tensors are copied by one call, which doesn't pin the arrays
+        const auto set_tensors = [&](jlongArray tensors, bool input) {
+            if (!tensors)
+                return;
+            std::vector<jlong> addrs(env->GetArrayLength(tensors));
+            env->GetLongArrayRegion(tensors, 0, addrs.size(), addrs.data());
+            for (size_t i = 0; i < addrs.size(); ++i) {
+                if (input)
+                    infer_request->set_input_tensor(i, *(Tensor *)addrs[i]);
+                else
+                    infer_request->set_output_tensor(i, *(Tensor *)addrs[i]);
+            }
+        };
+        set_tensors(inputs, true);
+        set_tensors(outputs, false);
+        infer_request->infer();
+    )
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_StartAsync(JNIEnv *env, jobject obj, jlong addr)
 {
     JNI_METHOD("StartAsync",
@@ -32,6 +155,15 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *env, jo
     )
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCallback(JNIEnv *env, jobject, jlong addr, jobject consumer)
+{
+    JNI_METHOD("SetCallback",
+        InferRequest *infer_request = (InferRequest *)addr;
+        auto callback = std::make_shared<Callback>(env, consumer);
+        infer_request->set_callback([callback](std::exception_ptr error) { (*callback)(error); });
+    )
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *env, jobject, jlong addr, jlong tensorAddr)
 {
     JNI_METHOD("SetInputTensor",
@@ -75,13 +207,7 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetTensor(JNIEnv *e
     return 0;
 }
 
-JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_delete(JNIEnv *env, jobject obj, jlong addr)
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Delete(JNIEnv *env, jobject obj, jlong addr)
 {
-    jclass cls = env->GetObjectClass(obj);
-    jfieldID field = env->GetFieldID(cls, "isReleased", "Z");
-    jboolean isReleased = env->GetBooleanField(obj, field);
-    if (!isReleased) {
-      InferRequest *req = (InferRequest *)addr;
-      delete req;
-    }
+    delete (InferRequest *)addr;
 }
@@ -49,6 +49,15 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_SetSpatialDynamic
     )
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_SetColorFormat(JNIEnv *env, jobject obj, jlong addr, jint format)
+{
+    JNI_METHOD("SetColorFormat",
+        preprocess::InputTensorInfo *info = (preprocess::InputTensorInfo *)addr;
+
+        info->set_color_format(preprocess::ColorFormat(format));
+    )
+}
+
 /*  We don't use delete operator for native object because we don't own this object:
     no new operator has been used to allocate memory for it */
 JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_delete(JNIEnv *, jobject, jlong) {}
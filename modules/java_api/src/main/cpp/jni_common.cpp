@@ -0,0 +1,52 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+#include <string>
+
+#include "jni_common.hpp"
+
+JavaClasses java_classes;
+
+namespace {
+
+jclass findClass(JNIEnv *env, const char *name)
+{
+    jclass local = env->FindClass(name);
+    jclass global = local ? (jclass)env->NewGlobalRef(local) : nullptr;
+    env->DeleteLocalRef(local);
+    return global;
+}
+
+}  // namespace
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *)
+{
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv((void **)&env, JNI_VERSION_1_6) != JNI_OK)
+        return JNI_ERR;
+
+    java_classes.exception = findClass(env, "java/lang/Exception");
+    java_classes.array_list = findClass(env, "java/util/ArrayList");
+    java_classes.output = findClass(env, "org/intel/openvino/Output");
+    if (!java_classes.exception || !java_classes.array_list || !java_classes.output)
+        return JNI_ERR;
+
+    java_classes.array_list_init = env->GetMethodID(java_classes.array_list, "<init>", "()V");
+    java_classes.array_list_add = env->GetMethodID(java_classes.array_list, "add", "(Ljava/lang/Object;)Z");
+    java_classes.output_init = env->GetMethodID(java_classes.output, "<init>", "(J)V");
+    if (!java_classes.array_list_init || !java_classes.array_list_add || !java_classes.output_init)
+        return JNI_ERR;
+
+    return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL JNI_OnUnload(JavaVM *vm, void *)
+{
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv((void **)&env, JNI_VERSION_1_6) != JNI_OK)
+        return;
+    env->DeleteGlobalRef(java_classes.exception);
+    env->DeleteGlobalRef(java_classes.array_list);
+    env->DeleteGlobalRef(java_classes.output);
+}
@@ -4,6 +4,21 @@
 #include <jni.h>   // JNI header provided by JDK
 #include <stdio.h> // C Standard IO Header
 
+/**
+ * Classes and methods used by native methods, which are looked up once in JNI_OnLoad instead of
+ * on every call
+ */
+struct JavaClasses {
+    jclass exception;
+    jclass array_list;
+    jmethodID array_list_init;
+    jmethodID array_list_add;
+    jclass output;
+    jmethodID output_init;
+};
+
+extern JavaClasses java_classes;
+
 #define JNI_METHOD(name, body)                    \
     static const char method_name[] = name;       \
     try                                           \
@@ -31,7 +46,7 @@ static void throwJavaException(JNIEnv *env, const std::exception *e, const char
     }
 
     if (!je)
-        je = env->FindClass("java/lang/Exception");
+        je = java_classes.exception;
 
     env->ThrowNew(je, what.c_str());
 
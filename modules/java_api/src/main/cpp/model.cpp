@@ -36,21 +36,16 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_Model_getOutputs(JNIEnv * env,
         std::shared_ptr<Model> *model = reinterpret_cast<std::shared_ptr<Model> *>(modelAddr);
         const std::vector<ov::Output<ov::Node>>& outputs_vec = (*model)->outputs();
 
-        jclass arrayClass = env->FindClass("java/util/ArrayList");
-        jmethodID arrayInit = env->GetMethodID(arrayClass, "<init>", "()V");
-        jobject arrayObj = env->NewObject(arrayClass, arrayInit);
-        jmethodID arrayAdd = env->GetMethodID(arrayClass, "add", "(Ljava/lang/Object;)Z");
-
-        jclass outputClass = env->FindClass("org/intel/openvino/Output");
-        jmethodID outputConstructor = env->GetMethodID(outputClass,"<init>","(J)V");
+        jobject arrayObj = env->NewObject(java_classes.array_list, java_classes.array_list_init);
 
         Output<Node> *output;
         for (const auto &item : outputs_vec) {
             output = new Output<Node>();
             *output = item;
 
-            jobject outputObj = env->NewObject(outputClass, outputConstructor, (jlong)(output));
-            env->CallObjectMethod(arrayObj, arrayAdd, outputObj);
+            jobject outputObj = env->NewObject(java_classes.output, java_classes.output_init, (jlong)(output));
+            env->CallObjectMethod(arrayObj, java_classes.array_list_add, outputObj);
+            env->DeleteLocalRef(outputObj);
         }
 
         return arrayObj;
@@ -133,12 +133,17 @@ extern "C"
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ReadModel(JNIEnv *, jobject, jlong, jstring);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ReadModel1(JNIEnv *, jobject, jlong, jstring, jstring);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModel(JNIEnv *, jobject, jlong, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModel1(JNIEnv *, jobject, jlong, jlong, jstring, jobject);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModelFile(JNIEnv *, jobject, jlong, jstring, jstring, jobject);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ImportModel(JNIEnv *, jobject, jlong, jstring, jstring, jobject);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ImportModelBuffer(JNIEnv *, jobject, jlong, jobject, jstring, jobject);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_GetProperty(JNIEnv *, jobject, jlong, jstring, jstring);
     JNIEXPORT void JNICALL Java_org_intel_openvino_Core_SetProperty(JNIEnv *, jobject, jlong, jstring, jobject);
     JNIEXPORT void JNICALL Java_org_intel_openvino_Core_delete(JNIEnv *, jobject, jlong);
 
     // ov::Any
     JNIEXPORT jint JNICALL Java_org_intel_openvino_Any_asInt(JNIEnv *, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_org_intel_openvino_Any_asString(JNIEnv *, jobject, jlong);
 
     // ov::Model
     JNIEXPORT jstring JNICALL Java_org_intel_openvino_Model_getName(JNIEnv *, jobject, jlong);
@@ -151,24 +156,37 @@ extern "C"
 
     // ov::CompiledModel
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_CompiledModel_CreateInferRequest(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_CompiledModel_ExportModel(JNIEnv *, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_CompiledModel_GetProperty(JNIEnv *, jobject, jlong, jstring);
     JNIEXPORT void JNICALL Java_org_intel_openvino_CompiledModel_delete(JNIEnv *, jobject, jlong);
 
     // ov::InferRequest
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_InferWith(JNIEnv *, jobject, jlong, jlongArray, jlongArray);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_StartAsync(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCallback(JNIEnv *, jobject, jlong, jobject);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetOutputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetOutputTensor(JNIEnv *, jobject, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetTensor(JNIEnv *, jobject, jlong, jstring);
-    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_delete(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Delete(JNIEnv *, jobject, jlong);
 
     // ov::Tensor
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorCArray(JNIEnv *, jobject, jint, jintArray, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorFloat(JNIEnv *, jobject, jintArray, jfloatArray);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorByteBuffer(JNIEnv *, jobject, jint, jintArray, jobject);
     JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetSize(JNIEnv *, jobject, jlong);
     JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_GetShape(JNIEnv *, jobject, jlong);
     JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *, jobject, jlong);
+    JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_asInt(JNIEnv *, jobject, jlong);
+    JNIEXPORT jlongArray JNICALL Java_org_intel_openvino_Tensor_asLong(JNIEnv *, jobject, jlong);
+    JNIEXPORT jbyteArray JNICALL Java_org_intel_openvino_Tensor_asByte(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToFloat(JNIEnv *, jobject, jlong, jfloatArray, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToInt(JNIEnv *, jobject, jlong, jintArray, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToLong(JNIEnv *, jobject, jlong, jlongArray, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToByte(JNIEnv *, jobject, jlong, jbyteArray, jint);
+    JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_GetByteBuffer(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_delete(JNIEnv *, jobject, jlong);
 
     // ov::PrePostProcessor
@@ -189,6 +207,7 @@ extern "C"
     JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_SetLayout(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_SetSpatialStaticShape(JNIEnv *, jobject, jlong, jint, jint);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_SetSpatialDynamicShape(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_SetColorFormat(JNIEnv *, jobject, jlong, jint);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InputTensorInfo_delete(JNIEnv *, jobject, jlong);
 
     // ov::Layout
@@ -199,6 +218,12 @@ extern "C"
 
     // ov::preprocess::PreProcessSteps
     JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_Resize(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ConvertElementType(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ConvertLayout(JNIEnv *, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ConvertColor(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_Mean(JNIEnv *, jobject, jlong, jfloatArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_Scale(JNIEnv *, jobject, jlong, jfloatArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ReverseChannels(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_delete(JNIEnv *, jobject, jlong);
 
     // ov::preprocess::InputModelInfo
@@ -207,8 +232,19 @@ extern "C"
 
     // ov::preprocess::OutputInfo
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_OutputInfo_getTensor(JNIEnv *, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_OutputInfo_getPostprocess(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_OutputInfo_delete(JNIEnv *, jobject, jlong);
 
+    // ov::preprocess::OutputTensorInfo
+    JNIEXPORT void JNICALL Java_org_intel_openvino_OutputTensorInfo_SetElementType(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_OutputTensorInfo_SetLayout(JNIEnv *, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_OutputTensorInfo_delete(JNIEnv *, jobject, jlong);
+
+    // ov::preprocess::PostProcessSteps
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PostProcessSteps_ConvertElementType(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PostProcessSteps_ConvertLayout(JNIEnv *, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_PostProcessSteps_delete(JNIEnv *, jobject, jlong);
+
     // ov::Dimension
     JNIEXPORT jint JNICALL Java_org_intel_openvino_Dimension_getLength(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_Dimension_delete(JNIEnv *, jobject, jlong);
@@ -18,6 +18,15 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_OutputInfo_getTensor(JNIEnv *env
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_OutputInfo_getPostprocess(JNIEnv *env, jobject obj, jlong addr)
+{
+    JNI_METHOD("getPostprocess",
+        preprocess::OutputInfo *info = (preprocess::OutputInfo *)addr;
+        return (jlong)(&info->postprocess());
+    )
+    return 0;
+}
+
 /*  We don't use delete operator for native object because we don't own this object:
     no new operator has been used to allocate memory for it */
 JNIEXPORT void JNICALL Java_org_intel_openvino_OutputInfo_delete(JNIEnv *, jobject, jlong) {}
@@ -0,0 +1,31 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+#include "openvino/openvino.hpp"
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace ov;
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_OutputTensorInfo_SetElementType(JNIEnv *env, jobject obj, jlong addr, jint type)
+{
+    JNI_METHOD("SetElementType",
+        preprocess::OutputTensorInfo *info = (preprocess::OutputTensorInfo *)addr;
+        info->set_element_type(element::Type_t(type));
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_OutputTensorInfo_SetLayout(JNIEnv *env, jobject obj, jlong addr, jlong l_addr)
+{
+    JNI_METHOD("SetLayout",
+        preprocess::OutputTensorInfo *info = (preprocess::OutputTensorInfo *)addr;
+        const Layout *layout = (Layout *)(l_addr);
+        info->set_layout(*layout);
+    )
+}
+
+/*  We don't use delete operator for native object because we don't own this object:
+    no new operator has been used to allocate memory for it */
+JNIEXPORT void JNICALL Java_org_intel_openvino_OutputTensorInfo_delete(JNIEnv *, jobject, jlong) {}
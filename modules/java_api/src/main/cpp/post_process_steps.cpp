@@ -0,0 +1,31 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+#include "openvino/openvino.hpp"
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace ov;
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_PostProcessSteps_ConvertElementType(JNIEnv *env, jobject, jlong addr, jint type)
+{
+    JNI_METHOD("ConvertElementType",
+        preprocess::PostProcessSteps *pps = (preprocess::PostProcessSteps *)addr;
+        pps->convert_element_type(element::Type_t(type));
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_PostProcessSteps_ConvertLayout(JNIEnv *env, jobject, jlong addr, jlong l_addr)
+{
+    JNI_METHOD("ConvertLayout",
+        preprocess::PostProcessSteps *pps = (preprocess::PostProcessSteps *)addr;
+        const Layout *layout = (Layout *)(l_addr);
+        pps->convert_layout(*layout);
+    )
+}
+
+/*  We don't use delete operator for native object because we don't own this object:
+    no new operator has been used to allocate memory for it */
+JNIEXPORT void JNICALL Java_org_intel_openvino_PostProcessSteps_delete(JNIEnv *, jobject, jlong) {}
@@ -19,6 +19,65 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_Resize(JNIEnv *en
     )
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ConvertElementType(JNIEnv *env, jobject, jlong addr, jint type)
+{
+    JNI_METHOD("ConvertElementType",
+        preprocess::PreProcessSteps *pps = (preprocess::PreProcessSteps *)addr;
+        pps->convert_element_type(element::Type_t(type));
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ConvertLayout(JNIEnv *env, jobject, jlong addr, jlong l_addr)
+{
+    JNI_METHOD("ConvertLayout",
+        preprocess::PreProcessSteps *pps = (preprocess::PreProcessSteps *)addr;
+        const Layout *layout = (Layout *)(l_addr);
+        pps->convert_layout(*layout);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ConvertColor(JNIEnv *env, jobject, jlong addr, jint format)
+{
+    JNI_METHOD("ConvertColor",
+        preprocess::PreProcessSteps *pps = (preprocess::PreProcessSteps *)addr;
+        pps->convert_color(preprocess::ColorFormat(format));
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_Mean(JNIEnv *env, jobject, jlong addr, jfloatArray values)
+{
+    JNI_METHOD("Mean",
+        preprocess::PreProcessSteps *pps = (preprocess::PreProcessSteps *)addr;
+        std::vector<float> mean(env->GetArrayLength(values));
+        env->GetFloatArrayRegion(values, 0, mean.size(), mean.data());
+        if (mean.size() == 1)
+            pps->mean(mean[0]);
+        else
+            pps->mean(mean);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_Scale(JNIEnv *env, jobject, jlong addr, jfloatArray values)
+{
+    JNI_METHOD("Scale",
+        preprocess::PreProcessSteps *pps = (preprocess::PreProcessSteps *)addr;
+        std::vector<float> scale(env->GetArrayLength(values));
+        env->GetFloatArrayRegion(values, 0, scale.size(), scale.data());
+        if (scale.size() == 1)
+            pps->scale(scale[0]);
+        else
+            pps->scale(scale);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_ReverseChannels(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD("ReverseChannels",
+        preprocess::PreProcessSteps *pps = (preprocess::PreProcessSteps *)addr;
+        pps->reverse_channels();
+    )
+}
+
 /*  We don't use delete operator for native object because we don't own this object:
     no new operator has been used to allocate memory for it */
 JNIEXPORT void JNICALL Java_org_intel_openvino_PreProcessSteps_delete(JNIEnv *, jobject, jlong) {}
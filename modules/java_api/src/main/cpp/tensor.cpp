@@ -9,6 +9,95 @@
 
 using namespace ov;
 
+namespace {
+
+/**
+ * Memory of a direct ByteBuffer for ov::Tensor. A global reference keeps the buffer alive until the
+ * tensor and all the tensors sharing its memory, like the ones of infer requests, are released
+ */
+class DirectBufferAllocator {
+public:
+    DirectBufferAllocator(JNIEnv *env, jobject buffer)
+        : buffer_(env->NewGlobalRef(buffer)),
+          data_(env->GetDirectBufferAddress(buffer)),
+          capacity_(static_cast<size_t>(env->GetDirectBufferCapacity(buffer))),
+          version_(env->GetVersion()) {
+        env->GetJavaVM(&jvm_);
+    }
+
+    void *allocate(size_t bytes, size_t) {
+        if (bytes > capacity_)
+            throw std::runtime_error("The buffer is smaller than the tensor!");
+        return data_;
+    }
+
+    // Tensors may be released by threads of inference, which are attached to release the reference
+    void deallocate(void *, size_t, size_t) {
+        JNIEnv *env = nullptr;
+        if (jvm_->GetEnv((void **)&env, version_) == JNI_OK) {
+            env->DeleteGlobalRef(buffer_);
+            return;
+        }
+        JavaVMAttachArgs args;
+        args.version = version_;
+        args.name = NULL;
+        args.group = NULL;
+#ifdef _JAVASOFT_JNI_H_
+        jvm_->AttachCurrentThread((void **)&env, &args);
+#else
+        jvm_->AttachCurrentThread(&env, &args);
+#endif
+        env->DeleteGlobalRef(buffer_);
+        jvm_->DetachCurrentThread();
+    }
+
+    bool is_equal(const DirectBufferAllocator &other) const {
+        return data_ == other.data_;
+    }
+
+private:
+    jobject buffer_;
+    void *data_;
+    size_t capacity_;
+    jint version_;
+    JavaVM *jvm_ = nullptr;
+};
+
+void checkRegion(JNIEnv *env, const Tensor &tensor, jarray dst, jint offset)
+{
+    if (offset < 0 || offset + tensor.get_size() > static_cast<size_t>(env->GetArrayLength(dst)))
+        throw std::runtime_error("The array is too small for the tensor data!");
+}
+
+/**
+ * Copies the tensor data of the given element type into a Java array at the offset by a single
+ * Set<Type>ArrayRegion call, which doesn't pin or copy the whole array
+ */
+template <typename JArray, typename JType>
+void copyRegion(JNIEnv *env, const Tensor &tensor, element::Type type, JArray dst, jint offset,
+                void (JNIEnv::*setRegion)(JArray, jsize, jsize, const JType *))
+{
+    if (tensor.get_element_type() != type)
+        throw std::runtime_error("Unsupported element type " + tensor.get_element_type().get_type_name() + "!");
+    checkRegion(env, tensor, dst, offset);
+    (env->*setRegion)(dst, offset, tensor.get_size(), reinterpret_cast<const JType *>(tensor.data()));
+}
+
+// f32 data is copied as is, f16 data is converted
+void copyFloats(JNIEnv *env, const Tensor &tensor, jfloatArray dst, jint offset)
+{
+    if (tensor.get_element_type() == element::f16) {
+        checkRegion(env, tensor, dst, offset);
+        const float16 *data = static_cast<const float16 *>(tensor.data());
+        std::vector<float> values(data, data + tensor.get_size());
+        env->SetFloatArrayRegion(dst, offset, values.size(), values.data());
+        return;
+    }
+    copyRegion(env, tensor, element::f32, dst, offset, &JNIEnv::SetFloatArrayRegion);
+}
+
+}  // namespace
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorCArray(JNIEnv *env, jobject, jint type, jintArray shape, jlong matDataAddr)
 {
     JNI_METHOD(
@@ -55,6 +144,25 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorFloat(JNIEnv *env,
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorByteBuffer(JNIEnv *env, jobject, jint type, jintArray shape, jobject buffer)
+{
+    JNI_METHOD(
+        "TensorByteBuffer",
+        if (!env->GetDirectBufferAddress(buffer)) {
+            throw std::runtime_error("The buffer should be direct!");
+        }
+        element::Type input_type = element::Type_t(type);
+        Shape input_shape = jintArrayToVector(env, shape);
+        size_t byte_size = (input_type.bitwidth() * shape_size(input_shape) + 7) / 8;
+        if (byte_size > static_cast<size_t>(env->GetDirectBufferCapacity(buffer))) {
+            throw std::runtime_error("The buffer is smaller than the tensor!");
+        }
+        Tensor *ov_tensor = new Tensor(input_type, input_shape, DirectBufferAllocator(env, buffer));
+        return (jlong)ov_tensor;
+    )
+    return 0;
+}
+
 JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetSize(JNIEnv *env, jobject, jlong addr)
 {
     JNI_METHOD(
@@ -75,12 +183,9 @@ JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_GetShape(JNIEnv *env,
         jintArray result = env->NewIntArray(shape.size());
         if (!result) {
             throw std::runtime_error("Out of memory!");
-        } jint *arr = env->GetIntArrayElements(result, nullptr);
-
-        for (int i = 0; i < shape.size(); ++i)
-            arr[i] = shape[i];
-
-        env->ReleaseIntArrayElements(result, arr, 0);
+        }
+        std::vector<jint> dims(shape.begin(), shape.end());
+        env->SetIntArrayRegion(result, 0, dims.size(), dims.data());
         return result;
     )
     return 0;
@@ -92,18 +197,105 @@ JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *env
         "asFloat",
         Tensor *ov_tensor = (Tensor *)addr;
 
-        size_t size = ov_tensor->get_size();
-        const float *data = ov_tensor->data<const float>();
+        jfloatArray result = env->NewFloatArray(ov_tensor->get_size());
+        if (!result) {
+            throw std::runtime_error("Out of memory!");
+        }
+        copyFloats(env, *ov_tensor, result, 0);
+        return result;
+    )
+    return 0;
+}
+
+JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_asInt(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "asInt",
+        Tensor *ov_tensor = (Tensor *)addr;
 
-        jfloatArray result = env->NewFloatArray(size);
+        jintArray result = env->NewIntArray(ov_tensor->get_size());
         if (!result) {
             throw std::runtime_error("Out of memory!");
-        } jfloat *arr = env->GetFloatArrayElements(result, nullptr);
+        }
+        copyRegion(env, *ov_tensor, element::i32, result, 0, &JNIEnv::SetIntArrayRegion);
+        return result;
+    )
+    return 0;
+}
 
-        for (size_t i = 0; i < size; ++i)
-            arr[i] = data[i];
+JNIEXPORT jlongArray JNICALL Java_org_intel_openvino_Tensor_asLong(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "asLong",
+        Tensor *ov_tensor = (Tensor *)addr;
+
+        jlongArray result = env->NewLongArray(ov_tensor->get_size());
+        if (!result) {
+            throw std::runtime_error("Out of memory!");
+        }
+        copyRegion(env, *ov_tensor, element::i64, result, 0, &JNIEnv::SetLongArrayRegion);
+        return result;
+    )
+    return 0;
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_intel_openvino_Tensor_asByte(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "asByte",
+        Tensor *ov_tensor = (Tensor *)addr;
+
+        jbyteArray result = env->NewByteArray(ov_tensor->get_size());
+        if (!result) {
+            throw std::runtime_error("Out of memory!");
+        }
+        copyRegion(env, *ov_tensor, element::u8, result, 0, &JNIEnv::SetByteArrayRegion);
+        return result;
+    )
+    return 0;
+}
 
-        env->ReleaseFloatArrayElements(result, arr, 0);
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToFloat(JNIEnv *env, jobject, jlong addr, jfloatArray dst, jint offset)
+{
+    JNI_METHOD(
+        "CopyToFloat",
+        copyFloats(env, *(Tensor *)addr, dst, offset);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToInt(JNIEnv *env, jobject, jlong addr, jintArray dst, jint offset)
+{
+    JNI_METHOD(
+        "CopyToInt",
+        copyRegion(env, *(Tensor *)addr, element::i32, dst, offset, &JNIEnv::SetIntArrayRegion);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToLong(JNIEnv *env, jobject, jlong addr, jlongArray dst, jint offset)
+{
+    JNI_METHOD(
+        "CopyToLong",
+        copyRegion(env, *(Tensor *)addr, element::i64, dst, offset, &JNIEnv::SetLongArrayRegion);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_CopyToByte(JNIEnv *env, jobject, jlong addr, jbyteArray dst, jint offset)
+{
+    JNI_METHOD(
+        "CopyToByte",
+        copyRegion(env, *(Tensor *)addr, element::u8, dst, offset, &JNIEnv::SetByteArrayRegion);
+    )
+}
+
+JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_GetByteBuffer(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "GetByteBuffer",
+        Tensor *ov_tensor = (Tensor *)addr;
+        jobject result = env->NewDirectByteBuffer(ov_tensor->data(), ov_tensor->get_byte_size());
+        if (!result) {
+            throw std::runtime_error("Out of memory!");
+        }
         return result;
     )
     return 0;
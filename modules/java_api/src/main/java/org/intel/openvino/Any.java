@@ -14,9 +14,15 @@ public class Any extends Wrapper {
         return asInt(nativeObj);
     }
 
+    public String asString() {
+        return asString(nativeObj);
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native int asInt(long addr);
 
+    private static native String asString(long addr);
+
     @Override
     protected native void delete(long nativeObj);
 }
@@ -0,0 +1,28 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+/** Color formats of images, values match ov::preprocess::ColorFormat */
+public enum ColorFormat {
+    UNDEFINED(0),
+    NV12_SINGLE_PLANE(1),
+    NV12_TWO_PLANES(2),
+    I420_SINGLE_PLANE(3),
+    I420_THREE_PLANES(4),
+    RGB(5),
+    BGR(6),
+    GRAY(7),
+    RGBX(8),
+    BGRX(9);
+
+    private int value;
+
+    private ColorFormat(int value) {
+        this.value = value;
+    }
+
+    public int getValue() {
+        return value;
+    }
+}
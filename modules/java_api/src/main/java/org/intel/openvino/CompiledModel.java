@@ -25,9 +25,33 @@ public class CompiledModel extends Wrapper {
         return new InferRequest(CreateInferRequest(nativeObj));
     }
 
+    /**
+     * Exports the compiled model to a file, which can be imported by {@link Core#import_model}
+     * without compilation.
+     *
+     * @param modelPath Path to write a model to.
+     */
+    public void export_model(final String modelPath) {
+        ExportModel(nativeObj, modelPath);
+    }
+
+    /**
+     * Gets a property of the compiled model, like OPTIMAL_NUMBER_OF_INFER_REQUESTS.
+     *
+     * @param name Property name.
+     * @return Value of a property corresponding to the property name.
+     */
+    public Any get_property(final String name) {
+        return new Any(GetProperty(nativeObj, name));
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native long CreateInferRequest(long addr);
 
+    private static native void ExportModel(long addr, final String modelPath);
+
+    private static native long GetProperty(long addr, final String name);
+
     @Override
     protected native void delete(long nativeObj);
 }
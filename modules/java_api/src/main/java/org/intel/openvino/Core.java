@@ -3,6 +3,7 @@
 
 package org.intel.openvino;
 
+import java.nio.ByteBuffer;
 import java.util.Map;
 import java.util.logging.Logger;
 
@@ -69,6 +70,65 @@ public class Core extends Wrapper {
         return new CompiledModel(CompileModel(nativeObj, model.getNativeObjAddr(), device));
     }
 
+    /**
+     * Creates a compiled model from a source model object with properties of the model, like
+     * performance hints, number of streams or device specific configuration.
+     *
+     * @param model Model object acquired from {@link Core#read_model}.
+     * @param device Name of a device to load a model to.
+     * @param prop Map of pairs: (property name, property value) for this compiled model only.
+     * @return A compiled model.
+     */
+    public CompiledModel compile_model(
+            Model model, final String device, final Map<String, String> prop) {
+        return new CompiledModel(
+                CompileModel1(nativeObj, model.getNativeObjAddr(), device, prop));
+    }
+
+    /**
+     * Reads a model and creates a compiled model from it in one call. With the CACHE_DIR property
+     * a compiled model is imported from the cache, and the model isn't read at all.
+     *
+     * @param modelPath Path to a model.
+     * @param device Name of a device to load a model to.
+     * @param prop Map of pairs: (property name, property value) for this compiled model only.
+     * @return A compiled model.
+     */
+    public CompiledModel compile_model(
+            final String modelPath, final String device, final Map<String, String> prop) {
+        return new CompiledModel(CompileModelFile(nativeObj, modelPath, device, prop));
+    }
+
+    /**
+     * Imports a compiled model from a file written by {@link CompiledModel#export_model}.
+     *
+     * @param modelPath Path to an exported model.
+     * @param device Name of a device to import a model to, it should be the device of export.
+     * @param prop Map of pairs: (property name, property value) or null.
+     * @return A compiled model.
+     */
+    public CompiledModel import_model(
+            final String modelPath, final String device, final Map<String, String> prop) {
+        return new CompiledModel(ImportModel(nativeObj, modelPath, device, prop));
+    }
+
+    /**
+     * Imports a compiled model from a direct buffer, e.g. a memory-mapped file, without copying
+     * it.
+     *
+     * @param buffer Direct buffer with an exported model.
+     * @param device Name of a device to import a model to, it should be the device of export.
+     * @param prop Map of pairs: (property name, property value) or null.
+     * @return A compiled model.
+     */
+    public CompiledModel import_model(
+            ByteBuffer buffer, final String device, final Map<String, String> prop) {
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException("Models can be imported from direct buffers only");
+        }
+        return new CompiledModel(ImportModelBuffer(nativeObj, buffer, device, prop));
+    }
+
     /**
      * Gets properties related to device behaviour.
      *
@@ -106,6 +166,18 @@ public class Core extends Wrapper {
 
     private static native long CompileModel(long core, long net, final String device);
 
+    private static native long CompileModel1(
+            long core, long net, final String device, final Map<String, String> prop);
+
+    private static native long CompileModelFile(
+            long core, final String modelPath, final String device, final Map<String, String> prop);
+
+    private static native long ImportModel(
+            long core, final String modelPath, final String device, final Map<String, String> prop);
+
+    private static native long ImportModelBuffer(
+            long core, ByteBuffer buffer, final String device, final Map<String, String> prop);
+
     private static native long GetProperty(long core, final String device, final String name);
 
     private static native void SetProperty(
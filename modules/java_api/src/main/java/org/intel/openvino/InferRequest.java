@@ -3,11 +3,17 @@
 
 package org.intel.openvino;
 
+import java.util.concurrent.CompletableFuture;
+import java.util.function.Consumer;
+
 /** This is a class of infer request that can be run in asynchronous or synchronous manners. */
 public class InferRequest extends Wrapper {
 
     private boolean isReleased = false;
 
+    /** Native code references the callback weakly, so it's kept here */
+    private Consumer<String> callback;
+
     protected InferRequest(long addr) {
         super(addr);
     }
@@ -22,6 +28,29 @@ public class InferRequest extends Wrapper {
         Infer(nativeObj);
     }
 
+    /**
+     * Sets input and output tensors by their indices and infers them in synchronous mode by a
+     * single native call, which is cheaper than separate calls for small models.
+     *
+     * @param inputs Input tensors in the order of model inputs.
+     * @param outputs Output tensors in the order of model outputs, or null to use the tensors of
+     *     the request.
+     */
+    public void infer(Tensor[] inputs, Tensor[] outputs) {
+        InferWith(nativeObj, addresses(inputs), addresses(outputs));
+    }
+
+    private static long[] addresses(Tensor[] tensors) {
+        if (tensors == null) {
+            return null;
+        }
+        long[] addrs = new long[tensors.length];
+        for (int i = 0; i < tensors.length; ++i) {
+            addrs[i] = tensors[i].nativeObj;
+        }
+        return addrs;
+    }
+
     /**
      * Sets an input tensor to infer models with single input.
      *
@@ -57,6 +86,45 @@ public class InferRequest extends Wrapper {
         Wait(nativeObj);
     }
 
+    /**
+     * Sets a callback called on completion of asynchronous inference.
+     *
+     * <p>The callback is called by a thread of inference with null on success or with an exception
+     * describing the failure. It shouldn't block, and exceptions thrown by it are ignored.
+     *
+     * @param callback Callback to call, it replaces the previous one.
+     */
+    public void set_callback(Consumer<RuntimeException> callback) {
+        setNativeCallback(
+                error -> callback.accept(error == null ? null : new RuntimeException(error)));
+    }
+
+    /**
+     * Starts inference in asynchronous mode and returns a future completed with this request when
+     * the inference ends, so no thread is blocked waiting for it.
+     *
+     * <p>It replaces a callback set by {@link #set_callback}. The request should be kept reachable
+     * until the future completes.
+     */
+    public CompletableFuture<InferRequest> infer_async() {
+        CompletableFuture<InferRequest> future = new CompletableFuture<>();
+        setNativeCallback(
+                error -> {
+                    if (error == null) {
+                        future.complete(this);
+                    } else {
+                        future.completeExceptionally(new RuntimeException(error));
+                    }
+                });
+        StartAsync(nativeObj);
+        return future;
+    }
+
+    private void setNativeCallback(Consumer<String> callback) {
+        SetCallback(nativeObj, callback);
+        this.callback = callback;
+    }
+
     /**
      * Sets an output tensor to infer models with single output.
      *
@@ -86,16 +154,19 @@ public class InferRequest extends Wrapper {
      */
     public void release() {
         delete(nativeObj);
-        isReleased = true;
     }
 
     /*----------------------------------- native methods -----------------------------------*/
     private static native void Infer(long addr);
 
+    private static native void InferWith(long addr, long[] inputs, long[] outputs);
+
     private static native void StartAsync(long addr);
 
     private static native void Wait(long addr);
 
+    private static native void SetCallback(long addr, Consumer<String> callback);
+
     private static native void SetInputTensor(long addr, long tensorAddr);
 
     private static native void SetOutputTensor(long addr, long tensorAddr);
@@ -104,6 +175,13 @@ public class InferRequest extends Wrapper {
 
     private static native long GetTensor(long addr, String tensorName);
 
+    private static native void Delete(long addr);
+
     @Override
-    protected native void delete(long nativeObj);
+    protected void delete(long nativeObj) {
+        if (!isReleased) {
+            isReleased = true;
+            Delete(nativeObj);
+        }
+    }
 }
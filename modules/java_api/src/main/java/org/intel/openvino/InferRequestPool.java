@@ -0,0 +1,96 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+import java.util.function.Function;
+
+/**
+ * A pool of infer requests of a compiled model, which are created once and reused between calls.
+ *
+ * <p>Tensors of a request are allocated once at its creation, so reusing requests avoids the
+ * allocation per call. Inputs can be written and outputs read through {@link
+ * Tensor#asByteBuffer} without copies.
+ */
+public class InferRequestPool implements AutoCloseable {
+
+    private final InferRequest[] requests;
+    private final BlockingQueue<InferRequest> idle;
+
+    /**
+     * Creates OPTIMAL_NUMBER_OF_INFER_REQUESTS requests of the compiled model.
+     *
+     * @param compiledModel Compiled model to create requests of.
+     */
+    public InferRequestPool(CompiledModel compiledModel) {
+        this(compiledModel, compiledModel.get_property("OPTIMAL_NUMBER_OF_INFER_REQUESTS").asInt());
+    }
+
+    /**
+     * Creates the given number of requests of the compiled model.
+     *
+     * @param compiledModel Compiled model to create requests of.
+     * @param size Number of requests.
+     */
+    public InferRequestPool(CompiledModel compiledModel, int size) {
+        if (size <= 0) {
+            throw new IllegalArgumentException("Pool size should be positive");
+        }
+        requests = new InferRequest[size];
+        idle = new ArrayBlockingQueue<>(size);
+        for (int i = 0; i < size; ++i) {
+            requests[i] = compiledModel.create_infer_request();
+            idle.add(requests[i]);
+        }
+    }
+
+    /** Returns the number of requests of the pool */
+    public int size() {
+        return requests.length;
+    }
+
+    /**
+     * Takes an idle request, waiting for one if all of them are in use. The request should be
+     * returned by {@link #release}.
+     */
+    public InferRequest acquire() throws InterruptedException {
+        return idle.take();
+    }
+
+    /** Takes an idle request or returns null if all of them are in use. */
+    public InferRequest tryAcquire() {
+        return idle.poll();
+    }
+
+    /** Returns a request taken by {@link #acquire} to the pool. */
+    public void release(InferRequest request) {
+        if (!idle.offer(request)) {
+            throw new IllegalStateException("The request doesn't belong to the pool");
+        }
+    }
+
+    /**
+     * Runs an action with an idle request and returns the request to the pool after it.
+     *
+     * @param action Action, which sets inputs, infers and reads outputs of the request.
+     * @return Result of the action.
+     */
+    public <T> T run(Function<InferRequest, T> action) throws InterruptedException {
+        InferRequest request = acquire();
+        try {
+            return action.apply(request);
+        } finally {
+            release(request);
+        }
+    }
+
+    /** Releases all the requests. The pool shouldn't be used after it. */
+    @Override
+    public void close() {
+        for (InferRequest request : requests) {
+            request.release();
+        }
+    }
+}
@@ -63,6 +63,18 @@ public class InputTensorInfo extends Wrapper {
         return this;
     }
 
+    /**
+     * Set color format for user's input tensor. Formats of several planes, like NV12_TWO_PLANES,
+     * split the input into several ones.
+     *
+     * @param format Color format of user's input tensor.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public InputTensorInfo set_color_format(ColorFormat format) {
+        SetColorFormat(nativeObj, format.getValue());
+        return this;
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native void SetElementType(long addr, int type);
 
@@ -72,6 +84,8 @@ public class InputTensorInfo extends Wrapper {
 
     private static native void SetSpatialDynamicShape(long addr);
 
+    private static native void SetColorFormat(long addr, int format);
+
     @Override
     protected native void delete(long nativeObj);
 }
@@ -26,14 +26,25 @@ public class OutputInfo extends Wrapper {
      *
      * @return Reference to current output tensor structure
      */
-    public InputTensorInfo tensor() {
-        return new InputTensorInfo(getTensor(nativeObj));
+    public OutputTensorInfo tensor() {
+        return new OutputTensorInfo(getTensor(nativeObj));
+    }
+
+    /**
+     * Get current output post-process steps structure
+     *
+     * @return Reference to current post-process steps structure
+     */
+    public PostProcessSteps postprocess() {
+        return new PostProcessSteps(getPostprocess(nativeObj));
     }
 
     /*----------------------------------- native methods -----------------------------------*/
 
     private static native long getTensor(long addr);
 
+    private static native long getPostprocess(long addr);
+
     @Override
     protected native void delete(long nativeObj);
 }
@@ -0,0 +1,47 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+/**
+ * Information about user's desired output tensor. By default, it will be initialized to same data
+ * (type/shape/etc) as model's output parameter. User application can override particular parameters
+ * (like 'element_type') according to application's data and specify appropriate conversions in
+ * post-processing steps
+ */
+public class OutputTensorInfo extends Wrapper {
+
+    public OutputTensorInfo(long addr) {
+        super(addr);
+    }
+
+    /**
+     * Set element type for user's output tensor
+     *
+     * @param type Element type for user's output tensor.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner
+     */
+    public OutputTensorInfo set_element_type(ElementType type) {
+        SetElementType(nativeObj, type.getValue());
+        return this;
+    }
+
+    /**
+     * Set layout for user's output tensor
+     *
+     * @param layout Layout for user's output tensor.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner
+     */
+    public OutputTensorInfo set_layout(Layout layout) {
+        SetLayout(nativeObj, layout.nativeObj);
+        return this;
+    }
+
+    /*----------------------------------- native methods -----------------------------------*/
+    private static native void SetElementType(long addr, int type);
+
+    private static native void SetLayout(long addr, long layout);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+/**
+ * Postprocessing steps. Each step typically intends adding of some operation to output parameter.
+ * User application can specify sequence of postprocessing steps in a builder-like manner.
+ */
+public class PostProcessSteps extends Wrapper {
+
+    public PostProcessSteps(long addr) {
+        super(addr);
+    }
+
+    /**
+     * Converts the element type of the model's output to the given one.
+     *
+     * @param type Element type to convert to.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PostProcessSteps convert_element_type(ElementType type) {
+        ConvertElementType(nativeObj, type.getValue());
+        return this;
+    }
+
+    /**
+     * Converts the layout of the model's output to the given one.
+     *
+     * @param layout Layout to convert to.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PostProcessSteps convert_layout(Layout layout) {
+        ConvertLayout(nativeObj, layout.nativeObj);
+        return this;
+    }
+
+    /*---------------------------------- native methods -----------------------------------*/
+    private static native void ConvertElementType(long nativeObj, int type);
+
+    private static native void ConvertLayout(long nativeObj, long layout);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
@@ -24,9 +24,110 @@ public class PreProcessSteps extends Wrapper {
         return this;
     }
 
+    /**
+     * Converts the element type of the input tensor to the given one, e.g. u8 frames to f32.
+     *
+     * @param type Element type to convert to.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps convert_element_type(ElementType type) {
+        ConvertElementType(nativeObj, type.getValue());
+        return this;
+    }
+
+    /**
+     * Converts the layout of the input tensor to the given one, e.g. NHWC to NCHW.
+     *
+     * @param layout Layout to convert to.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps convert_layout(Layout layout) {
+        ConvertLayout(nativeObj, layout.nativeObj);
+        return this;
+    }
+
+    /**
+     * Converts the color format of the input tensor, which is set by {@link
+     * InputTensorInfo#set_color_format}, to the given one, e.g. NV12 to RGB.
+     *
+     * @param format Color format to convert to.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps convert_color(ColorFormat format) {
+        ConvertColor(nativeObj, format.getValue());
+        return this;
+    }
+
+    /**
+     * Subtracts the mean value from all the elements.
+     *
+     * @param value Value to subtract.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps mean(float value) {
+        Mean(nativeObj, new float[] {value});
+        return this;
+    }
+
+    /**
+     * Subtracts the mean value of each channel, which requires the channel dimension in layout.
+     *
+     * @param values Values to subtract for each channel.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps mean(float[] values) {
+        Mean(nativeObj, values);
+        return this;
+    }
+
+    /**
+     * Divides all the elements by the value.
+     *
+     * @param value Value to divide by.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps scale(float value) {
+        Scale(nativeObj, new float[] {value});
+        return this;
+    }
+
+    /**
+     * Divides elements of each channel by the value, which requires the channel dimension in
+     * layout.
+     *
+     * @param values Values to divide by for each channel.
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps scale(float[] values) {
+        Scale(nativeObj, values);
+        return this;
+    }
+
+    /**
+     * Reverses the order of channels, e.g. RGB to BGR.
+     *
+     * @return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+     */
+    public PreProcessSteps reverse_channels() {
+        ReverseChannels(nativeObj);
+        return this;
+    }
+
     /*---------------------------------- native methods -----------------------------------*/
     private static native void Resize(long nativeObj, int alg);
 
+    private static native void ConvertElementType(long nativeObj, int type);
+
+    private static native void ConvertLayout(long nativeObj, long layout);
+
+    private static native void ConvertColor(long nativeObj, int format);
+
+    private static native void Mean(long nativeObj, float[] values);
+
+    private static native void Scale(long nativeObj, float[] values);
+
+    private static native void ReverseChannels(long nativeObj);
+
     @Override
     protected native void delete(long nativeObj);
 }
@@ -3,6 +3,9 @@
 
 package org.intel.openvino;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 /**
  * Tensor API holding host memory
  *
@@ -22,6 +25,19 @@ public class Tensor extends Wrapper {
         super(TensorFloat(dims, data));
     }
 
+    /**
+     * Creates a tensor over the memory of a direct buffer without copying it. The buffer is kept alive
+     * until the tensor and all the tensors sharing its memory, like the ones of infer requests, are
+     * released
+     *
+     * @param type Element type of the tensor
+     * @param dims Shape of the tensor
+     * @param buffer Direct buffer of at least the size of the tensor data
+     */
+    public Tensor(ElementType type, int[] dims, ByteBuffer buffer) {
+        super(TensorByteBuffer(type.getValue(), dims, checkDirect(buffer)));
+    }
+
     /**
      * Returns the total number of elements (a product of all the dims or 1 for scalar)
      *
@@ -41,15 +57,86 @@ public class Tensor extends Wrapper {
         return asFloat(nativeObj);
     }
 
+    /** Returns a data of i32 tensor as integer array. */
+    public int[] asInt() {
+        return asInt(nativeObj);
+    }
+
+    /** Returns a data of i64 tensor as long array. */
+    public long[] asLong() {
+        return asLong(nativeObj);
+    }
+
+    /** Returns a data of u8 tensor as byte array. */
+    public byte[] asByte() {
+        return asByte(nativeObj);
+    }
+
+    /**
+     * Copies a data of f32 or f16 tensor into the array starting from the offset, so an array may
+     * be reused between inferences
+     */
+    public void copyTo(float[] dst, int offset) {
+        CopyToFloat(nativeObj, dst, offset);
+    }
+
+    /** Copies a data of i32 tensor into the array starting from the offset */
+    public void copyTo(int[] dst, int offset) {
+        CopyToInt(nativeObj, dst, offset);
+    }
+
+    /** Copies a data of i64 tensor into the array starting from the offset */
+    public void copyTo(long[] dst, int offset) {
+        CopyToLong(nativeObj, dst, offset);
+    }
+
+    /** Copies a data of u8 tensor into the array starting from the offset */
+    public void copyTo(byte[] dst, int offset) {
+        CopyToByte(nativeObj, dst, offset);
+    }
+
+    /**
+     * Returns a direct buffer of the native byte order over the tensor data without copying it. The
+     * buffer is valid while the tensor is alive
+     */
+    public ByteBuffer asByteBuffer() {
+        return GetByteBuffer(nativeObj).order(ByteOrder.nativeOrder());
+    }
+
+    private static ByteBuffer checkDirect(ByteBuffer buffer) {
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException("Tensor can be created over direct buffers only");
+        }
+        return buffer;
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native long TensorCArray(int type, int[] shape, long cArray);
 
     private static native long TensorFloat(int[] shape, float[] data);
 
+    private static native long TensorByteBuffer(int type, int[] shape, ByteBuffer buffer);
+
     private static native int[] GetShape(long addr);
 
     private static native float[] asFloat(long addr);
 
+    private static native int[] asInt(long addr);
+
+    private static native long[] asLong(long addr);
+
+    private static native byte[] asByte(long addr);
+
+    private static native void CopyToFloat(long addr, float[] dst, int offset);
+
+    private static native void CopyToInt(long addr, int[] dst, int offset);
+
+    private static native void CopyToLong(long addr, long[] dst, int offset);
+
+    private static native void CopyToByte(long addr, byte[] dst, int offset);
+
+    private static native ByteBuffer GetByteBuffer(long addr);
+
     private static native int GetSize(long addr);
 
     @Override
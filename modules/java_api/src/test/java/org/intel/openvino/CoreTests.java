@@ -4,6 +4,10 @@ import static org.junit.Assert.*;
 
 import org.junit.Test;
 
+import java.io.File;
+import java.io.RandomAccessFile;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
 import java.util.HashMap;
 import java.util.Map;
 
@@ -53,6 +57,20 @@ public class CoreTests extends OVTest {
         assertTrue(compiledModel instanceof CompiledModel);
     }
 
+    @Test
+    public void testCompileModelWithProperties() {
+        Model net = core.read_model(modelXml);
+        Map<String, String> config = new HashMap<String, String>();
+        config.put("PERFORMANCE_HINT", "THROUGHPUT");
+        config.put("PERFORMANCE_HINT_NUM_REQUESTS", "2");
+        CompiledModel compiledModel = core.compile_model(net, "CPU", config);
+
+        assertEquals(
+                "THROUGHPUT", compiledModel.get_property("PERFORMANCE_HINT").asString());
+        int nireq = compiledModel.get_property("OPTIMAL_NUMBER_OF_INFER_REQUESTS").asInt();
+        assertTrue(nireq > 0 && nireq <= 2);
+    }
+
     @Test
     public void testProperty() {
         int nireq1 = core.get_property("CPU", "OPTIMAL_NUMBER_OF_INFER_REQUESTS").asInt();
@@ -72,4 +90,23 @@ public class CoreTests extends OVTest {
         config.put("CPU_THROUGHPUT_STREAMS", "1");
         core.set_property("CPU", config); // Restore
     }
+
+    @Test
+    public void testExportImportModel() throws Exception {
+        Model net = core.read_model(modelXml);
+        CompiledModel compiledModel = core.compile_model(net, "CPU");
+        File exported = File.createTempFile("test_model", ".blob");
+        exported.deleteOnExit();
+        compiledModel.export_model(exported.getPath());
+
+        CompiledModel imported = core.import_model(exported.getPath(), "CPU", null);
+        assertNotNull(imported.create_infer_request());
+
+        try (RandomAccessFile file = new RandomAccessFile(exported, "r")) {
+            ByteBuffer buffer =
+                    file.getChannel().map(FileChannel.MapMode.READ_ONLY, 0, file.length());
+            imported = core.import_model(buffer, "CPU", null);
+            assertNotNull(imported.create_infer_request());
+        }
+    }
 }
@@ -0,0 +1,47 @@
+package org.intel.openvino;
+
+import static org.junit.Assert.*;
+
+import org.junit.Test;
+
+import java.util.Arrays;
+
+public class InferRequestPoolTests extends OVTest {
+    Core core = new Core();
+
+    @Test
+    public void testAcquireRelease() throws Exception {
+        CompiledModel compiledModel = core.compile_model(core.read_model(modelXml), device);
+        try (InferRequestPool pool = new InferRequestPool(compiledModel, 2)) {
+            InferRequest first = pool.acquire();
+            InferRequest second = pool.acquire();
+            assertNotSame(first, second);
+            assertNull(pool.tryAcquire());
+
+            pool.release(first);
+            assertSame(first, pool.tryAcquire());
+            pool.release(first);
+            pool.release(second);
+        }
+    }
+
+    @Test
+    public void testRun() throws Exception {
+        CompiledModel compiledModel = core.compile_model(core.read_model(modelXml), device);
+        try (InferRequestPool pool = new InferRequestPool(compiledModel)) {
+            assertTrue(pool.size() > 0);
+
+            float[] inputData = new float[3 * 32 * 32];
+            Arrays.fill(inputData, 1);
+            Tensor input = new Tensor(new int[] {1, 3, 32, 32}, inputData);
+            float[] outputData =
+                    pool.run(
+                            request -> {
+                                request.set_input_tensor(input);
+                                request.infer();
+                                return request.get_output_tensor().data();
+                            });
+            assertEquals(10, outputData.length);
+        }
+    }
+}
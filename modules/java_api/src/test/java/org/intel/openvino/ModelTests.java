@@ -7,6 +7,7 @@ import org.junit.Test;
 
 import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.concurrent.CompletableFuture;
 
 public class ModelTests extends OVTest {
     Core core;
@@ -81,4 +82,41 @@ public class ModelTests extends OVTest {
             assertNotEquals(outputData[i], 0.0f);
         }
     }
+
+    @Test
+    public void testInferAsync() throws Exception {
+        CompiledModel compiledModel = core.compile_model(net, device);
+        InferRequest req = compiledModel.create_infer_request();
+
+        float[] inputData = new float[3 * 32 * 32];
+        Arrays.fill(inputData, 1);
+        req.set_input_tensor(new Tensor(new int[] {1, 3, 32, 32}, inputData));
+
+        CompletableFuture<InferRequest> future = req.infer_async();
+        float[] outputData = future.get().get_output_tensor().data();
+        for (int i = 0; i < outputData.length; ++i) {
+            assertNotEquals(outputData[i], 0.0f);
+        }
+
+        // The request may be started again with a new future
+        assertSame(req.infer_async().get(), req);
+    }
+
+    @Test
+    public void testInferWithTensors() {
+        CompiledModel compiledModel = core.compile_model(net, device);
+        InferRequest req = compiledModel.create_infer_request();
+
+        float[] inputData = new float[3 * 32 * 32];
+        Arrays.fill(inputData, 1);
+        Tensor input = new Tensor(new int[] {1, 3, 32, 32}, inputData);
+        Tensor output = new Tensor(new int[] {1, 10}, new float[10]);
+
+        req.infer(new Tensor[] {input}, new Tensor[] {output});
+
+        float[] outputData = output.data();
+        for (int i = 0; i < outputData.length; ++i) {
+            assertNotEquals(outputData[i], 0.0f);
+        }
+    }
 }
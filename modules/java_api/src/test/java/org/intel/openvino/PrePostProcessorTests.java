@@ -6,6 +6,8 @@ import org.junit.Before;
 import org.junit.Ignore;
 import org.junit.Test;
 
+import java.nio.ByteBuffer;
+
 public class PrePostProcessorTests extends OVTest {
     Core core;
     Model net;
@@ -80,4 +82,35 @@ public class PrePostProcessorTests extends OVTest {
                         "[ PARAMETER_MISMATCH ] Failed to set input blob with precision: FP32, if"
                                 + " CNNNetwork input blob precision is: U8"));
     }
+
+    @Test
+    public void testPreprocessInGraph() {
+        PrePostProcessor p = new PrePostProcessor(net);
+        p.input().tensor().set_element_type(ElementType.u8).set_layout(new Layout("NHWC"));
+        p.input()
+                .preprocess()
+                .convert_element_type(ElementType.f32)
+                .reverse_channels()
+                .mean(new float[] {1.0f, 2.0f, 3.0f})
+                .scale(255.0f)
+                .convert_layout(new Layout("NCHW"));
+        p.input().model().set_layout(new Layout("NCHW"));
+        p.output().tensor().set_layout(new Layout("NC"));
+        p.output().postprocess().convert_element_type(ElementType.f32);
+        p.build();
+
+        CompiledModel compiledModel = core.compile_model(net, "CPU");
+        InferRequest inferRequest = compiledModel.create_infer_request();
+
+        // Raw u8 NHWC frame
+        int[] frameDims = {1, 32, 32, 3};
+        ByteBuffer frame = ByteBuffer.allocateDirect(32 * 32 * 3);
+        for (int i = 0; i < frame.capacity(); ++i) {
+            frame.put(i, (byte) i);
+        }
+        inferRequest.set_input_tensor(new Tensor(ElementType.u8, frameDims, frame));
+        inferRequest.infer();
+
+        assertArrayEquals(new int[] {1, 10}, inferRequest.get_output_tensor().get_shape());
+    }
 }
@@ -4,6 +4,10 @@ import static org.junit.Assert.*;
 
 import org.junit.Test;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
 public class TensorTests extends OVTest {
     int[] dimsArr = {1, 3, 2, 2};
     float[] data = {0.0f, 1.1f, 2.2f, 3.3f, 4.4f, 5.5f, 6.6f, 7.7f, 8.8f, 9.9f, 1.1f, 2.2f};
@@ -15,4 +19,67 @@ public class TensorTests extends OVTest {
         assertArrayEquals(tensor.get_shape(), dimsArr);
         assertArrayEquals(tensor.data(), data, 0.0f);
     }
+
+    @Test
+    public void testTensorOverDirectBuffer() {
+        ByteBuffer buffer =
+                ByteBuffer.allocateDirect(data.length * 4).order(ByteOrder.nativeOrder());
+        buffer.asFloatBuffer().put(data);
+        Tensor tensor = new Tensor(ElementType.f32, dimsArr, buffer);
+
+        assertArrayEquals(tensor.get_shape(), dimsArr);
+        assertArrayEquals(tensor.data(), data, 0.0f);
+
+        // The tensor shares memory of the buffer
+        buffer.putFloat(0, 42.0f);
+        assertEquals(tensor.data()[0], 42.0f, 0.0f);
+    }
+
+    @Test
+    public void testAsByteBuffer() {
+        Tensor tensor = new Tensor(dimsArr, data);
+        FloatBuffer view = tensor.asByteBuffer().asFloatBuffer();
+
+        assertEquals(view.capacity(), data.length);
+        for (int i = 0; i < data.length; ++i) {
+            assertEquals(view.get(i), data[i], 0.0f);
+        }
+
+        view.put(1, 42.0f);
+        assertEquals(tensor.data()[1], 42.0f, 0.0f);
+    }
+
+    @Test
+    public void testCopyTo() {
+        Tensor tensor = new Tensor(dimsArr, data);
+        float[] dst = new float[data.length + 2];
+        tensor.copyTo(dst, 2);
+
+        for (int i = 0; i < data.length; ++i) {
+            assertEquals(dst[i + 2], data[i], 0.0f);
+        }
+    }
+
+    @Test
+    public void testAsInt() {
+        int[] values = {0, -1, 2, -3, 4, -5, 6, -7, 8, -9, 10, -11};
+        ByteBuffer buffer =
+                ByteBuffer.allocateDirect(values.length * 4).order(ByteOrder.nativeOrder());
+        buffer.asIntBuffer().put(values);
+        Tensor tensor = new Tensor(ElementType.i32, dimsArr, buffer);
+
+        assertArrayEquals(tensor.asInt(), values);
+
+        int[] dst = new int[values.length + 1];
+        tensor.copyTo(dst, 1);
+        for (int i = 0; i < values.length; ++i) {
+            assertEquals(dst[i + 1], values[i]);
+        }
+    }
+
+    @Test(expected = Exception.class)
+    public void testCopyToSmallArray() {
+        Tensor tensor = new Tensor(dimsArr, data);
+        tensor.copyTo(new float[data.length], 1);
+    }
 }
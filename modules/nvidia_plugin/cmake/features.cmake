@@ -0,0 +1,7 @@
+# Copyright (C) 2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+
+ov_option(ENABLE_MICROBENCHMARKS "Build ov_nvidia_microbenchmarks suite of operations on Google Benchmark" OFF)
+ov_option(ENABLE_MODEL_BENCHMARK "Build ov_nvidia_model_benchmark tool sweeping configurations of the plugin on a model" OFF)
+ov_option(ENABLE_OFFLINE_TUNING "Build ov_nvidia_offline_tuning tool populating the tuning cache of the GPU for a set of models" OFF)
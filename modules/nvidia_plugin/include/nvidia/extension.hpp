@@ -0,0 +1,121 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Interface of libraries, which implement operations of the NVIDIA plugin for custom nodes
+ *        (e.g. nodes of OpenVINO extensions), so models with such nodes are executed on the device entirely
+ * @file extension.hpp
+ */
+
+#pragma once
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/extension.hpp"
+#include "openvino/core/node.hpp"
+
+struct cublasContext;
+typedef struct cublasContext* cublasHandle_t;
+struct cudnnContext;
+typedef struct cudnnContext* cudnnHandle_t;
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Resources of the thread an operation is executed by. Work of the operation should be launched on the stream
+ *        only, handles of libraries are bound to it
+ */
+struct ExtensionContext {
+    int device_id;
+    cudaStream_t stream;
+    cublasHandle_t cublas;
+    cudnnHandle_t cudnn;
+};
+
+/**
+ * @brief Operation created for a node of the model once the model is compiled
+ */
+class ExtensionOperation {
+public:
+    using Ptr = std::shared_ptr<ExtensionOperation>;
+
+    virtual ~ExtensionOperation() = default;
+
+    /**
+     * Launches the operation on the stream of the context, it should not synchronize with the host
+     * @param inputs Device memory of dense tensors of inputs of the node
+     * @param outputs Device memory of dense tensors of outputs of the node
+     * @param immutable_workbuffers Device buffers filled by init_immutable_workbuffers()
+     * @param mutable_workbuffers Device buffers of mutable_workbuffer_sizes(), which contents aren't preserved
+     *                            between executions
+     */
+    virtual void execute(const ExtensionContext& context,
+                         const std::vector<const void*>& inputs,
+                         const std::vector<void*>& outputs,
+                         const std::vector<const void*>& immutable_workbuffers,
+                         const std::vector<void*>& mutable_workbuffers) const = 0;
+
+    /**
+     * @returns Sizes of device buffers the operation fills once (e.g. with preprocessed weights)
+     */
+    virtual std::vector<std::size_t> immutable_workbuffer_sizes() const { return {}; }
+
+    /**
+     * @returns Sizes of scratch device buffers of the operation, their memory is shared with other operations
+     */
+    virtual std::vector<std::size_t> mutable_workbuffer_sizes() const { return {}; }
+
+    /**
+     * Fills immutable work buffers, it's called once after the model is compiled and may synchronize with the device
+     */
+    virtual void init_immutable_workbuffers(const std::vector<void*>& buffers) {}
+
+    /**
+     * @returns true if execute() launches the same work for the same buffers and doesn't synchronize with the host,
+     *          so it may be captured into CUDA graphs of the model
+     */
+    virtual bool is_cuda_graph_compatible() const { return false; }
+};
+
+/**
+ * @brief Creates operations for nodes of a type
+ */
+class OperationExtension {
+public:
+    using Ptr = std::shared_ptr<OperationExtension>;
+
+    virtual ~OperationExtension() = default;
+
+    /**
+     * @returns Name of the type of nodes (ov::DiscreteTypeInfo::name) the extension creates operations for
+     */
+    virtual std::string get_type() const = 0;
+
+    /**
+     * @param node Node with static shapes of inputs and outputs
+     */
+    virtual ExtensionOperation::Ptr create(const ov::Node& node) const = 0;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
+
+/**
+ * @brief Defines the entry point of a library of extensions, which is loaded by the plugin
+ *        (see ov::nvidia_gpu::extensions)
+ * @param extensions Vector of ov::nvidia_gpu::OperationExtension::Ptr
+ */
+#define OPENVINO_NVIDIA_GPU_CREATE_EXTENSIONS(extensions)                                 \
+    OPENVINO_EXTENSION_C_API void create_nvidia_gpu_extensions(                           \
+        std::vector<::ov::nvidia_gpu::OperationExtension::Ptr>& ext);                     \
+    OPENVINO_EXTENSION_C_API void create_nvidia_gpu_extensions(                           \
+        std::vector<::ov::nvidia_gpu::OperationExtension::Ptr>& ext) {                    \
+        ext = extensions;                                                                 \
+    }
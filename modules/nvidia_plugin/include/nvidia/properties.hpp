@@ -10,6 +10,11 @@
  */
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
 #include "openvino/runtime/properties.hpp"
 
 namespace ov {
@@ -29,10 +34,423 @@ static constexpr Property<bool, PropertyMutability::RW> operation_benchmark{"NVI
  */
 static constexpr Property<bool, PropertyMutability::RW> use_cuda_graph{"NVIDIA_USE_CUDA_GRAPH"};
 
+/**
+ * @brief Specifies if Parameter/Result buffers are bound to the device memory of I/O tensors (e.g. remote tensors)
+ *        instead of being copied into/from memory block of an infer request
+ */
+static constexpr Property<bool, PropertyMutability::RW> bind_io_tensors{"NVIDIA_BIND_IO_TENSORS"};
+
+/**
+ * @brief Maximum number of concurrent single-sample infer requests which are collected by NVIDIA plugin
+ *        into one batched inference. Value 1 disables dynamic batching
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> dynamic_batch_size{"NVIDIA_DYNAMIC_BATCH_SIZE"};
+
+/**
+ * @brief Maximum time in milliseconds which the first collected infer request waits for other requests
+ *        before an incomplete batch is executed
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> dynamic_batch_timeout{"NVIDIA_DYNAMIC_BATCH_TIMEOUT"};
+
+/**
+ * @brief Batch size the static batch-independent model is compiled for, when its batch (the first dimension of all
+ *        inputs and outputs) is larger. Batch of each inference is split into micro-batches of this size, which are
+ *        executed concurrently over memory blocks of infer requests of the smaller model. 0 (default) disables it
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> micro_batch_size{"NVIDIA_MICRO_BATCH_SIZE"};
+
+/**
+ * @brief Size of square tiles of the last two (spatial) dimensions the fully convolutional model with a single 4D input
+ *        is compiled for, when its image is larger. Image of each inference is split into overlapping tiles, which
+ *        are executed concurrently over memory blocks of infer requests of the tile model and stitched into outputs.
+ *        0 (default) disables it
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> tile_size{"NVIDIA_TILE_SIZE"};
+
+/**
+ * @brief Comma separated list of device IDs (e.g. "0,1,2,3") the compiled model is replicated to.
+ *        Each infer request is executed on the device with the least number of inferences in flight.
+ *        Empty list (default) means the model is compiled for the single device specified by ov::device::id
+ */
+static constexpr Property<std::string, PropertyMutability::RW> multi_device_ids{"NVIDIA_MULTI_DEVICE_IDS"};
+
+/**
+ * @brief Comma separated list of device IDs (e.g. "0,1") the compiled model is split across.
+ *        Operations of the model are partitioned into consecutive pipeline stages, one per listed device,
+ *        and activations crossing the stage boundary are copied peer-to-peer between devices.
+ *        Empty list (default) means the whole model is compiled for the single device specified by ov::device::id
+ */
+static constexpr Property<std::string, PropertyMutability::RW> pipeline_device_ids{"NVIDIA_PIPELINE_DEVICE_IDS"};
+
+/**
+ * @brief Time in milliseconds after which device memory of infer request which stays unused is released,
+ *        so that it could be used by other models on the same device. 0 (default) means memory is never released
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> memory_pool_idle_timeout{"NVIDIA_MEMORY_POOL_IDLE_TIMEOUT"};
+
+/**
+ * @brief Time in milliseconds an inference waits for device memory of infer request when all of memory blocks
+ *        are in use, after which the inference fails with ov::Busy. 0 (default) means the inference waits infinitely
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> memory_pool_wait_timeout{"NVIDIA_MEMORY_POOL_WAIT_TIMEOUT"};
+
+/**
+ * @brief Latency budget in milliseconds of an inference from its start, 0 (default) means inferences have no deadlines.
+ *        Submissions of inferences with deadlines are ordered earliest deadline first, and inferences which deadlines
+ *        pass before they are launched on the device are dropped with ov::Cancelled
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> latency_budget{"NVIDIA_LATENCY_BUDGET"};
+
+/**
+ * @brief Number of bytes of freed device memory which the stream-ordered memory pool of the device keeps for next
+ *        allocations instead of releasing it to the system. The pool is shared by all models compiled for the device,
+ *        by default freed memory is never released
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> memory_pool_release_threshold{
+    "NVIDIA_MEMORY_POOL_RELEASE_THRESHOLD"};
+
+/**
+ * @brief Specifies if nodes of the model are reordered to reduce peak size of memory block of an infer request.
+ *        The order is applied only if the memory taken by tensors is actually reduced
+ */
+static constexpr Property<bool, PropertyMutability::RW> memory_aware_ordering{"NVIDIA_MEMORY_AWARE_ORDERING"};
+
+/**
+ * @brief Limit of device memory the compiled model may take. Values in range (0, 1] are treated as a fraction of
+ *        total memory of the device, values greater than 1 as a number of bytes. 0 (default) means no limit.
+ *        The budget bounds the number of infer requests which memory pool holds and work spaces of
+ *        cuDNN convolutions, for which algorithms with smaller work spaces are chosen
+ */
+static constexpr Property<double, PropertyMutability::RW> memory_budget{"NVIDIA_MEMORY_BUDGET"};
+
+/**
+ * @brief Element type (ov::element::i8 or ov::element::i4) large constant weights of MatMul and FullyConnected
+ *        operations are stored in with per output channel scales. Weights are dequantized on the fly while
+ *        multiplied. ov::element::undefined (default) means weights are kept in the inference precision
+ */
+static constexpr Property<ov::element::Type, PropertyMutability::RW> weights_compression{
+    "NVIDIA_WEIGHTS_COMPRESSION"};
+
+/**
+ * @brief Specifies if MatMul and FullyConnected operations with constant weights are executed by FP8 (E4M3)
+ *        tensor cores of devices which have them (compute capability 8.9 and newer). Weights are converted to FP8
+ *        with a per-tensor scale at compilation, activations are scaled by their maximal absolute value on every
+ *        inference. Other operations are executed in the inference precision
+ */
+static constexpr Property<bool, PropertyMutability::RW> fp8_matmul{"NVIDIA_FP8_MATMUL"};
+
+/**
+ * @brief Specifies if large constants may be placed out of device memory. Tables read only by Gather are placed
+ *        in mapped page-locked host memory, other large constants are placed in unified memory prefetched to
+ *        the device, the largest first, if constants and memory of an infer request don't fit the device memory
+ *        (or ov::nvidia_gpu::memory_budget)
+ */
+static constexpr Property<bool, PropertyMutability::RW> constants_offload{"NVIDIA_CONSTANTS_OFFLOAD"};
+
+/**
+ * @brief Maximal number of elements of outputs of element-wise operations (e.g. Add, Multiply, Relu), which are
+ *        executed together by one launch of a persistent kernel when they follow each other in the execution order,
+ *        to save launch latencies of small batches. 0 (default) disables the persistent kernel
+ */
+static constexpr Property<size_t, PropertyMutability::RW> persistent_kernel_max_elements{
+    "NVIDIA_PERSISTENT_KERNEL_MAX_ELEMENTS"};
+
+/**
+ * @brief Specifies if the optimal number of infer requests estimated at compilation is refined by benchmarks
+ *        of every number of concurrent infer requests, which run in background after the model is compiled
+ */
+static constexpr Property<bool, PropertyMutability::RW> infer_requests_refinement{
+    "NVIDIA_INFER_REQUESTS_REFINEMENT"};
+
+/**
+ * @brief Specifies if algorithms of operations are benchmarked in background (requires
+ *        ov::nvidia_gpu::operation_benchmark). The model is compiled with heuristic algorithms and serves inferences,
+ *        while a copy with benchmarked algorithms is compiled and replaces it once it is ready
+ */
+static constexpr Property<bool, PropertyMutability::RW> background_tuning{"NVIDIA_BACKGROUND_TUNING"};
+
+/**
+ * @brief Specifies if every memory block of infer requests the memory pool may hold is allocated and executed once
+ *        before compile_model returns, so that first inferences don't pay for allocation and capture of CUDA Graphs
+ */
+static constexpr Property<bool, PropertyMutability::RW> warmup_on_compile{"NVIDIA_WARMUP_ON_COMPILE"};
+
+/**
+ * @brief Specifies if operations and stages of inferences are annotated by NVTX ranges named by the friendly name,
+ *        type and category of the operation, which line kernels up with operations in Nsight Systems timelines
+ */
+static constexpr Property<bool, PropertyMutability::RW> nvtx_ranges{"NVIDIA_NVTX_RANGES"};
+
+/**
+ * @brief Path of the Chrome trace JSON file (opened by chrome://tracing or Perfetto) with the timeline of stages
+ *        of inferences of all infer requests and of operations executed on the device, which is written when
+ *        the compiled model is destroyed. Empty (default) disables tracing
+ */
+static constexpr Property<std::string, PropertyMutability::RW> trace_file{"NVIDIA_TRACE_FILE"};
+
+/**
+ * @brief Specifies if hardware metrics of kernels of operations (see ov::nvidia_gpu::hardware_metrics) are collected
+ *        by CUPTI while ov::enable_profiling is enabled. Kernels are replayed to collect the metrics, so inferences
+ *        are much slower. Requires the plugin built with -DENABLE_CUPTI_METRICS=ON
+ */
+static constexpr Property<bool, PropertyMutability::RW> hardware_counters{"NVIDIA_HARDWARE_COUNTERS"};
+
+/**
+ * @brief Path of the file the placement of buffers in memory blocks of the model is written to at compilation:
+ *        producer and last consumer of each buffer, its size and offset in the mutable block of an infer request,
+ *        in the block of constants or of immutable work buffers. The file is CSV if the path ends with ".csv" and
+ *        JSON otherwise. Empty (default) disables the dump
+ */
+static constexpr Property<std::string, PropertyMutability::RW> memory_layout_file{"NVIDIA_MEMORY_LAYOUT_FILE"};
+
+/**
+ * @brief Comma separated list of names of outputs (e.g. auxiliary heads), which tensors aren't downloaded from
+ *        the device by inferences, so that their host tensors keep previous contents. It may be changed on the
+ *        compiled model between inferences. Empty (default) means all outputs are downloaded
+ */
+static constexpr Property<std::string, PropertyMutability::RW> skipped_outputs{"NVIDIA_SKIPPED_OUTPUTS"};
+
+/**
+ * @brief Specifies if query_model reports only operations, whose execution on the device is estimated to be faster
+ *        than on CPU including transfers of tensors crossing the boundary of the device subgraphs (e.g. for HETERO)
+ */
+static constexpr Property<bool, PropertyMutability::RW> cost_aware_query{"NVIDIA_COST_AWARE_QUERY"};
+
+/**
+ * @brief Specifies if numerically sensitive operations (e.g. Softmax, MVN, Exp and large reductions) are kept in f32
+ *        when the model is converted to f16 by ov::hint::inference_precision
+ */
+static constexpr Property<bool, PropertyMutability::RW> mixed_precision{"NVIDIA_MIXED_PRECISION"};
+
+/**
+ * @brief Specifies if f32 inputs and outputs of the model converted to f16 (bf16) by ov::hint::inference_precision
+ *        are transferred to and from the device in f16 (bf16). They are converted on the host during inferences
+ */
+static constexpr Property<bool, PropertyMutability::RW> device_precision_io{"NVIDIA_DEVICE_PRECISION_IO"};
+
+/**
+ * @brief Fraction of SMs of the device reserved for the compiled model, 1 (default) means that the model is
+ *        executed on all SMs. Inferences of the model are executed in a CUDA green context (CUDA 12.4) of a partition
+ *        of SMs, which aren't reserved by other models, so a latency sensitive model isn't slowed down by models
+ *        filling the rest of the device. Models reserving the same number of SMs share the partition
+ */
+static constexpr Property<float, PropertyMutability::RW> sm_fraction{"NVIDIA_SM_FRACTION"};
+
+/**
+ * @brief Maximum number of CUDA streams independent branches of the model (e.g. of Inception blocks, heads of
+ *        attention or levels of FPN) are executed on within a single inference, 1 (default) executes operations one by
+ *        one. Branches are forked from the stream of the infer request and joined by events, so captured CUDA graphs
+ *        have parallel branches. Buffers of concurrent branches don't share memory, so the memory of an infer request
+ *        may grow
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> parallel_branches{"NVIDIA_PARALLEL_BRANCHES"};
+
+/**
+ * @brief Specifies if activations (Gelu, Mish, Swish, Sigmoid, Tanh and Elu) use fast approximations of exp, tanh and
+ *        erf instead of full precision device math, false by default. Errors of approximations are listed in README
+ */
+static constexpr Property<bool, PropertyMutability::RW> fast_math{"NVIDIA_FAST_MATH"};
+
+/**
+ * @brief Directory, which processes compiling models on the same device publish CUDA IPC handles of their large
+ *        constants in, so identical constants are stored on the device once for all of them. Empty (default) shares
+ *        constants only within the process. Supported on Linux only
+ */
+static constexpr Property<std::string, PropertyMutability::RW> ipc_constants_dir{"NVIDIA_IPC_CONSTANTS_DIR"};
+
+/**
+ * @brief Comma separated list of paths of libraries, which implement operations for custom nodes
+ *        (see OPENVINO_NVIDIA_GPU_CREATE_EXTENSIONS in nvidia/extension.hpp), so models with such nodes aren't split
+ *        by HETERO. Libraries are loaded once by the process, they should be set before models are compiled
+ */
+static constexpr Property<std::string, PropertyMutability::RW> extensions{"NVIDIA_EXTENSIONS"};
+
+/**
+ * @brief Write-only property of a compiled model, which replaces its weights by constants of the given model of the
+ *        same topology while the model serves inferences. Inferences started after the call are executed with new
+ *        weights, inferences in flight complete with the previous ones, whose memory is released afterwards
+ */
+static constexpr Property<std::shared_ptr<ov::Model>, PropertyMutability::WO> weights_update{"NVIDIA_WEIGHTS_UPDATE"};
+
+/**
+ * @brief Read-only property showing if the model executes benchmarked algorithms of operations
+ *        (see ov::nvidia_gpu::background_tuning)
+ */
+static constexpr Property<bool, PropertyMutability::RO> background_tuning_completed{
+    "NVIDIA_BACKGROUND_TUNING_COMPLETED"};
+
+/**
+ * @brief Read-only property showing size in bytes of memory block of an infer request taken by tensors
+ *        in the default order of nodes (0 if ov::nvidia_gpu::memory_aware_ordering is disabled)
+ */
+static constexpr Property<size_t, PropertyMutability::RO> default_order_tensors_memory_size{
+    "NVIDIA_DEFAULT_ORDER_TENSORS_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing size in bytes of memory block of an infer request taken by tensors
+ *        in the applied order of nodes (0 if ov::nvidia_gpu::memory_aware_ordering is disabled)
+ */
+static constexpr Property<size_t, PropertyMutability::RO> tensors_memory_size{"NVIDIA_TENSORS_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing size in bytes of device memory taken by constants of the compiled model.
+ *        Large constants which are shared with other models compiled for the same device are excluded
+ */
+static constexpr Property<size_t, PropertyMutability::RO> constants_memory_size{"NVIDIA_CONSTANTS_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing size in bytes of constants placed out of device memory
+ *        (see ov::nvidia_gpu::constants_offload)
+ */
+static constexpr Property<size_t, PropertyMutability::RO> offloaded_constants_memory_size{
+    "NVIDIA_OFFLOADED_CONSTANTS_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing size in bytes of device memory taken by immutable work buffers of operations
+ */
+static constexpr Property<size_t, PropertyMutability::RO> immutable_workbuffers_memory_size{
+    "NVIDIA_IMMUTABLE_WORKBUFFERS_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing size in bytes of device memory block allocated for each infer request
+ */
+static constexpr Property<size_t, PropertyMutability::RO> infer_request_memory_size{
+    "NVIDIA_INFER_REQUEST_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing total size in bytes of mutable work buffers of all operations
+ *        as if each of them took separate memory
+ */
+static constexpr Property<size_t, PropertyMutability::RO> mutable_workbuffers_memory_size{
+    "NVIDIA_MUTABLE_WORKBUFFERS_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing size in bytes of memory block of an infer request actually taken
+ *        by mutable work buffers, which share memory with each other and with dead tensors
+ */
+static constexpr Property<size_t, PropertyMutability::RO> shared_mutable_workbuffers_memory_size{
+    "NVIDIA_SHARED_MUTABLE_WORKBUFFERS_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property showing number of device memory blocks of infer requests which are allocated now
+ */
+static constexpr Property<size_t, PropertyMutability::RO> number_of_memory_blocks{"NVIDIA_NUMBER_OF_MEMORY_BLOCKS"};
+
+/**
+ * @brief Read-only property showing number of inferences which wait for device memory blocks now
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_queue_depth{"NVIDIA_MEMORY_POOL_QUEUE_DEPTH"};
+
+/**
+ * @brief Read-only property showing the greatest number of inferences which waited for device memory blocks at once
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_max_queue_depth{
+    "NVIDIA_MEMORY_POOL_MAX_QUEUE_DEPTH"};
+
+/**
+ * @brief Read-only property showing average time in milliseconds inferences waited for device memory blocks
+ */
+static constexpr Property<double, PropertyMutability::RO> memory_pool_average_wait_time{
+    "NVIDIA_MEMORY_POOL_AVERAGE_WAIT_TIME"};
+
+/**
+ * @brief Read-only property showing the longest time in milliseconds an inference waited for device memory block
+ */
+static constexpr Property<double, PropertyMutability::RO> memory_pool_max_wait_time{"NVIDIA_MEMORY_POOL_MAX_WAIT_TIME"};
+
+/**
+ * @brief Read-only property showing number of inferences failed because of ov::nvidia_gpu::memory_pool_wait_timeout
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_wait_timeouts{
+    "NVIDIA_MEMORY_POOL_WAIT_TIMEOUTS"};
+
+/**
+ * @brief Read-only property showing number of device memory blocks which are used by inferences now
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_busy_blocks{"NVIDIA_MEMORY_POOL_BUSY_BLOCKS"};
+
+/**
+ * @brief Read-only property showing number of allocated device memory blocks which are available to inferences now
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_free_blocks{"NVIDIA_MEMORY_POOL_FREE_BLOCKS"};
+
+/**
+ * @brief Read-only property showing total time in milliseconds inferences waited for device memory blocks
+ */
+static constexpr Property<double, PropertyMutability::RO> memory_pool_total_wait_time{
+    "NVIDIA_MEMORY_POOL_TOTAL_WAIT_TIME"};
+
+/**
+ * @brief Read-only property showing number of inferences of the model which are started and aren't completed yet
+ */
+static constexpr Property<size_t, PropertyMutability::RO> inflight_requests{"NVIDIA_INFLIGHT_REQUESTS"};
+
+/**
+ * @brief Read-only property showing number of inferences dropped because of ov::nvidia_gpu::latency_budget
+ */
+static constexpr Property<size_t, PropertyMutability::RO> expired_requests{"NVIDIA_EXPIRED_REQUESTS"};
+
+/**
+ * @brief Read-only property showing number of tasks queued to threads of the device which submit device work
+ */
+static constexpr Property<size_t, PropertyMutability::RO> thread_pool_queue_length{
+    "NVIDIA_THREAD_POOL_QUEUE_LENGTH"};
+
+/**
+ * @brief Read-only property showing size in bytes of memory of an infer request (tensors and work buffers)
+ *        which is alive while each operation is executed, by the operation name
+ */
+static constexpr Property<std::map<std::string, size_t>, PropertyMutability::RO> operations_memory_usage{
+    "NVIDIA_OPERATIONS_MEMORY_USAGE"};
+
 /**
  * @brief Read-only property showing number of used CUDA Graphs
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_cuda_graphs{"NVIDIA_NUMBER_OF_CUDA_GRAPHS"};
 
+/**
+ * @brief Read-only property showing number of inferences which reused already captured CUDA Graphs
+ */
+static constexpr Property<size_t, PropertyMutability::RO> cuda_graph_capture_hits{"NVIDIA_CUDA_GRAPH_CAPTURE_HITS"};
+
+/**
+ * @brief Read-only property showing number of inferences which (re)captured CUDA Graphs
+ */
+static constexpr Property<size_t, PropertyMutability::RO> cuda_graph_capture_misses{
+    "NVIDIA_CUDA_GRAPH_CAPTURE_MISSES"};
+
+/**
+ * @brief Read-only property showing number of inferences which recaptured CUDA Graphs already captured
+ *        for their memory block
+ */
+static constexpr Property<size_t, PropertyMutability::RO> cuda_graph_recaptures{"NVIDIA_CUDA_GRAPH_RECAPTURES"};
+
+/**
+ * @brief Read-only property showing number of launches of CUDA Graphs
+ */
+static constexpr Property<size_t, PropertyMutability::RO> cuda_graph_launches{"NVIDIA_CUDA_GRAPH_LAUNCHES"};
+
+/**
+ * @brief Read-only property showing number of executions of sequences of operations which are launched eagerly,
+ *        i.e. of the whole model without CUDA Graphs or of its parts which can't be captured
+ */
+static constexpr Property<size_t, PropertyMutability::RO> eager_launches{"NVIDIA_EAGER_LAUNCHES"};
+
+/**
+ * @brief Read-only property showing p50, p90, p99 and maximal latency in microseconds of operations (by friendly
+ *        name) and stages of inferences (by names of ov::ProfilingInfo of stages) of all infer requests, which
+ *        are recorded into log-bucketed histograms if ov::enable_profiling is enabled
+ */
+static constexpr Property<std::map<std::string, std::vector<uint64_t>>, PropertyMutability::RO> latency_percentiles{
+    "NVIDIA_LATENCY_PERCENTILES"};
+
+/**
+ * @brief Read-only property showing achieved occupancy, DRAM throughput, L2 hit rate and tensor core utilization
+ *        in percents of operations (by friendly name) averaged over their kernels weighted by device time, which
+ *        are collected if ov::nvidia_gpu::hardware_counters is enabled. Metrics the device doesn't support are NaN
+ */
+static constexpr Property<std::map<std::string, std::vector<double>>, PropertyMutability::RO> hardware_metrics{
+    "NVIDIA_HARDWARE_METRICS"};
+
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -0,0 +1,30 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for properties of NVIDIA plugin remote context and remote tensors
+ *        To use in create_context, create_tensor and get_params methods
+ *
+ * @file nvidia/remote_properties.hpp
+ */
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+/**
+ * @brief Namespace with NVIDIA GPU specific properties
+ */
+namespace nvidia_gpu {
+
+/**
+ * @brief Raw CUDA device pointer of the memory which backs a remote tensor.
+ *        If it is passed to RemoteContext::create_tensor(), the tensor wraps user memory without copying it,
+ *        otherwise the memory is allocated by plugin on the device of the remote context
+ */
+static constexpr Property<void*> device_ptr{"NVIDIA_DEVICE_PTR"};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
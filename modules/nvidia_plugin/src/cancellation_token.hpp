@@ -7,8 +7,11 @@
 #include <ie_extension.h>
 
 #include <atomic>
+#include <chrono>
 #include <error.hpp>
 #include <functional>
+#include <openvino/runtime/exception.hpp>
+#include <optional>
 #include <utility>
 
 namespace ov {
@@ -16,6 +19,8 @@ namespace nvidia_gpu {
 
 class CancellationToken {
 public:
+    using Clock = std::chrono::steady_clock;
+
     /**
      * Constructor
      * @param callback Callback that will be called on token cancelled check
@@ -27,13 +32,45 @@ public:
      * Set token status as cancelled
      */
     void cancel() {
+        cancelled_.store(true, std::memory_order_release);
         if (cancel_callback_) {
             cancel_callback_();
         };
     }
 
+    /**
+     * Clears cancellation of the previous inference, should be called before the next inference starts
+     */
+    void reset() noexcept { cancelled_.store(false, std::memory_order_release); }
+
+    /**
+     * @returns true if the inference is cancelled, e.g. waits of the inference should stop
+     */
+    bool isCancelled() const noexcept { return cancelled_.load(std::memory_order_acquire); }
+
+    /**
+     * Sets the time after which the inference isn't worth launching any more (see ov::nvidia_gpu::latency_budget)
+     * @param deadline Deadline of the inference, std::nullopt if it has none
+     */
+    void setDeadline(std::optional<Clock::time_point> deadline) noexcept { deadline_ = deadline; }
+
+    std::optional<Clock::time_point> deadline() const noexcept { return deadline_; }
+
+    bool isExpired() const noexcept { return deadline_ && Clock::now() >= *deadline_; }
+
+    /**
+     * @throws ov::Cancelled if the deadline of the inference has passed
+     */
+    void throwIfExpired() const {
+        if (isExpired()) {
+            ov::Cancelled::create("Inference is dropped as its deadline has passed");
+        }
+    }
+
 private:
     std::function<void()> cancel_callback_;
+    std::optional<Clock::time_point> deadline_;
+    std::atomic<bool> cancelled_{false};
 };
 
 }  // namespace nvidia_gpu
@@ -54,6 +54,17 @@ class CuBlasHandle : public Handle<cublasHandle_t> {
 public:
     CuBlasHandle() : Handle((cublasCreate), cublasDestroy) {}
     void setStream(Stream& stream) { throwIfError(cublasSetStream(get(), stream.get())); }
+    /**
+     * Makes cuBLAS use the given device memory instead of allocating its own work space on first use of each shape
+     */
+    void setWorkspace(void* workspace, std::size_t size) {
+#if CUDART_VERSION >= 11020
+        throwIfError(cublasSetWorkspace(get(), workspace, size));
+#else
+        (void)workspace;
+        (void)size;
+#endif
+    }
 };
 
 }  // namespace CUDA
@@ -0,0 +1,52 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cublasLt.h>
+
+#include "blas.hpp"
+
+namespace CUDA {
+
+/**
+ * cuBLAS handle encapsulates a cuBLASLt handle, so that it may be used for cuBLASLt calls by a simple cast
+ */
+inline cublasLtHandle_t toLtHandle(const CuBlasHandle& handle) {
+    return reinterpret_cast<cublasLtHandle_t>(handle.get());
+}
+
+class CuBlasLtMatmulDescriptor : public Handle<cublasLtMatmulDesc_t> {
+public:
+    CuBlasLtMatmulDescriptor(cublasComputeType_t computeType, cudaDataType_t scaleType)
+        : Handle((cublasLtMatmulDescCreate), cublasLtMatmulDescDestroy, computeType, scaleType) {}
+    template <typename T>
+    auto& set(cublasLtMatmulDescAttributes_t attribute, const T& value) {
+        throwIfError(cublasLtMatmulDescSetAttribute(get(), attribute, &value, sizeof(value)));
+        return *this;
+    }
+};
+
+class CuBlasLtMatrixLayout : public Handle<cublasLtMatrixLayout_t> {
+public:
+    CuBlasLtMatrixLayout(cudaDataType_t type, uint64_t rows, uint64_t cols, int64_t ld)
+        : Handle((cublasLtMatrixLayoutCreate), cublasLtMatrixLayoutDestroy, type, rows, cols, ld) {}
+    template <typename T>
+    auto& set(cublasLtMatrixLayoutAttribute_t attribute, const T& value) {
+        throwIfError(cublasLtMatrixLayoutSetAttribute(get(), attribute, &value, sizeof(value)));
+        return *this;
+    }
+};
+
+class CuBlasLtMatmulPreference : public Handle<cublasLtMatmulPreference_t> {
+public:
+    CuBlasLtMatmulPreference() : Handle((cublasLtMatmulPreferenceCreate), cublasLtMatmulPreferenceDestroy) {}
+    template <typename T>
+    auto& set(cublasLtMatmulPreferenceAttributes_t attribute, const T& value) {
+        throwIfError(cublasLtMatmulPreferenceSetAttribute(get(), attribute, &value, sizeof(value)));
+        return *this;
+    }
+};
+
+}  // namespace CUDA
@@ -0,0 +1,314 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_CUPTI_METRICS
+
+#include "cupti.hpp"
+
+#include <cupti_profiler_target.h>
+#include <cupti_target.h>
+#include <fmt/format.h>
+#include <nvperf_cuda_host.h>
+#include <nvperf_target.h>
+
+#include <error.hpp>
+#include <limits>
+
+namespace {
+
+void throwIfError(
+    const CUptiResult result,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (result != CUPTI_SUCCESS) {
+        const char* message = nullptr;
+        cuptiGetResultString(result, &message);
+        ov::nvidia_gpu::throw_ov_exception(fmt::format("CUPTI: {}", message ? message : "unknown error"), location);
+    }
+}
+
+void throwIfError(
+    const NVPA_Status status,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (status != NVPA_STATUS_SUCCESS) {
+        ov::nvidia_gpu::throw_ov_exception(fmt::format("NVIDIA PerfWorks error {}", static_cast<int>(status)),
+                                           location);
+    }
+}
+
+void initializeProfiler() {
+    static std::once_flag initialized;
+    std::call_once(initialized, [] {
+        CUpti_Profiler_Initialize_Params profilerParams{CUpti_Profiler_Initialize_Params_STRUCT_SIZE};
+        throwIfError(cuptiProfilerInitialize(&profilerParams));
+        NVPW_InitializeHost_Params hostParams{NVPW_InitializeHost_Params_STRUCT_SIZE};
+        throwIfError(NVPW_InitializeHost(&hostParams));
+    });
+}
+
+}  // namespace
+
+namespace CUDA {
+
+MetricsProfiler::MetricsProfiler(const int deviceId, std::vector<std::string> metrics, const size_t maxRanges)
+    : metrics_{std::move(metrics)}, maxRanges_{maxRanges} {
+    initializeProfiler();
+    CUpti_Device_GetChipName_Params chipParams{CUpti_Device_GetChipName_Params_STRUCT_SIZE};
+    chipParams.deviceIndex = static_cast<size_t>(deviceId);
+    throwIfError(cuptiDeviceGetChipName(&chipParams));
+    chip_ = chipParams.pChipName;
+
+    NVPW_CUDA_MetricsEvaluator_CalculateScratchBufferSize_Params scratchParams{
+        NVPW_CUDA_MetricsEvaluator_CalculateScratchBufferSize_Params_STRUCT_SIZE};
+    scratchParams.pChipName = chip_.c_str();
+    throwIfError(NVPW_CUDA_MetricsEvaluator_CalculateScratchBufferSize(&scratchParams));
+    evaluatorScratch_.resize(scratchParams.scratchBufferSize);
+    NVPW_CUDA_MetricsEvaluator_Initialize_Params evaluatorParams{
+        NVPW_CUDA_MetricsEvaluator_Initialize_Params_STRUCT_SIZE};
+    evaluatorParams.pScratchBuffer = evaluatorScratch_.data();
+    evaluatorParams.scratchBufferSize = evaluatorScratch_.size();
+    evaluatorParams.pChipName = chip_.c_str();
+    throwIfError(NVPW_CUDA_MetricsEvaluator_Initialize(&evaluatorParams));
+    evaluator_ = evaluatorParams.pMetricsEvaluator;
+
+    // Counters (raw metrics) the metrics are computed from are collected
+    std::vector<NVPA_RawMetricRequest> rawRequests;
+    evalRequests_.resize(metrics_.size());
+    supported_.resize(metrics_.size());
+    for (size_t i = 0; i < metrics_.size(); ++i) {
+        NVPW_MetricsEvaluator_ConvertMetricNameToMetricEvalRequest_Params convertParams{
+            NVPW_MetricsEvaluator_ConvertMetricNameToMetricEvalRequest_Params_STRUCT_SIZE};
+        convertParams.pMetricsEvaluator = evaluator_;
+        convertParams.pMetricName = metrics_[i].c_str();
+        convertParams.pMetricEvalRequest = &evalRequests_[i];
+        convertParams.metricEvalRequestStructSize = NVPW_MetricEvalRequest_STRUCT_SIZE;
+        // Metrics the chip doesn't support are reported as NaN
+        supported_[i] =
+            NVPW_MetricsEvaluator_ConvertMetricNameToMetricEvalRequest(&convertParams) == NVPA_STATUS_SUCCESS;
+        if (!supported_[i]) {
+            continue;
+        }
+        NVPW_MetricsEvaluator_GetMetricRawDependencies_Params dependenciesParams{
+            NVPW_MetricsEvaluator_GetMetricRawDependencies_Params_STRUCT_SIZE};
+        dependenciesParams.pMetricsEvaluator = evaluator_;
+        dependenciesParams.pMetricEvalRequests = &evalRequests_[i];
+        dependenciesParams.numMetricEvalRequests = 1;
+        dependenciesParams.metricEvalRequestStructSize = NVPW_MetricEvalRequest_STRUCT_SIZE;
+        dependenciesParams.metricEvalRequestStrideSize = sizeof(NVPW_MetricEvalRequest);
+        throwIfError(NVPW_MetricsEvaluator_GetMetricRawDependencies(&dependenciesParams));
+        std::vector<const char*> dependencies(dependenciesParams.numRawDependencies);
+        dependenciesParams.ppRawDependencies = dependencies.data();
+        throwIfError(NVPW_MetricsEvaluator_GetMetricRawDependencies(&dependenciesParams));
+        for (const auto dependency : dependencies) {
+            NVPA_RawMetricRequest request{NVPA_RAW_METRIC_REQUEST_STRUCT_SIZE};
+            request.pMetricName = dependency;
+            request.isolated = true;
+            request.keepInstances = true;
+            rawRequests.push_back(request);
+        }
+    }
+
+    NVPW_CUDA_RawMetricsConfig_Create_V2_Params configParams{NVPW_CUDA_RawMetricsConfig_Create_V2_Params_STRUCT_SIZE};
+    configParams.activityKind = NVPA_ACTIVITY_KIND_PROFILER;
+    configParams.pChipName = chip_.c_str();
+    throwIfError(NVPW_CUDA_RawMetricsConfig_Create_V2(&configParams));
+    const auto rawConfig = configParams.pRawMetricsConfig;
+    try {
+        NVPW_RawMetricsConfig_BeginPassGroup_Params beginParams{
+            NVPW_RawMetricsConfig_BeginPassGroup_Params_STRUCT_SIZE};
+        beginParams.pRawMetricsConfig = rawConfig;
+        throwIfError(NVPW_RawMetricsConfig_BeginPassGroup(&beginParams));
+        NVPW_RawMetricsConfig_AddMetrics_Params addParams{NVPW_RawMetricsConfig_AddMetrics_Params_STRUCT_SIZE};
+        addParams.pRawMetricsConfig = rawConfig;
+        addParams.pRawMetricRequests = rawRequests.data();
+        addParams.numMetricRequests = rawRequests.size();
+        throwIfError(NVPW_RawMetricsConfig_AddMetrics(&addParams));
+        NVPW_RawMetricsConfig_EndPassGroup_Params endParams{NVPW_RawMetricsConfig_EndPassGroup_Params_STRUCT_SIZE};
+        endParams.pRawMetricsConfig = rawConfig;
+        throwIfError(NVPW_RawMetricsConfig_EndPassGroup(&endParams));
+        NVPW_RawMetricsConfig_GenerateConfigImage_Params generateParams{
+            NVPW_RawMetricsConfig_GenerateConfigImage_Params_STRUCT_SIZE};
+        generateParams.pRawMetricsConfig = rawConfig;
+        throwIfError(NVPW_RawMetricsConfig_GenerateConfigImage(&generateParams));
+        NVPW_RawMetricsConfig_GetConfigImage_Params imageParams{
+            NVPW_RawMetricsConfig_GetConfigImage_Params_STRUCT_SIZE};
+        imageParams.pRawMetricsConfig = rawConfig;
+        throwIfError(NVPW_RawMetricsConfig_GetConfigImage(&imageParams));
+        config_.resize(imageParams.bytesCopied);
+        imageParams.bytesAllocated = config_.size();
+        imageParams.pBuffer = config_.data();
+        throwIfError(NVPW_RawMetricsConfig_GetConfigImage(&imageParams));
+    } catch (...) {
+        NVPW_RawMetricsConfig_Destroy_Params destroyParams{NVPW_RawMetricsConfig_Destroy_Params_STRUCT_SIZE};
+        destroyParams.pRawMetricsConfig = rawConfig;
+        NVPW_RawMetricsConfig_Destroy(&destroyParams);
+        throw;
+    }
+    NVPW_RawMetricsConfig_Destroy_Params destroyConfigParams{NVPW_RawMetricsConfig_Destroy_Params_STRUCT_SIZE};
+    destroyConfigParams.pRawMetricsConfig = rawConfig;
+    NVPW_RawMetricsConfig_Destroy(&destroyConfigParams);
+
+    NVPW_CUDA_CounterDataBuilder_Create_Params builderParams{NVPW_CUDA_CounterDataBuilder_Create_Params_STRUCT_SIZE};
+    builderParams.pChipName = chip_.c_str();
+    throwIfError(NVPW_CUDA_CounterDataBuilder_Create(&builderParams));
+    const auto builder = builderParams.pCounterDataBuilder;
+    NVPW_CounterDataBuilder_AddMetrics_Params addParams{NVPW_CounterDataBuilder_AddMetrics_Params_STRUCT_SIZE};
+    addParams.pCounterDataBuilder = builder;
+    addParams.pRawMetricRequests = rawRequests.data();
+    addParams.numMetricRequests = rawRequests.size();
+    auto status = NVPW_CounterDataBuilder_AddMetrics(&addParams);
+    NVPW_CounterDataBuilder_GetCounterDataPrefix_Params prefixParams{
+        NVPW_CounterDataBuilder_GetCounterDataPrefix_Params_STRUCT_SIZE};
+    prefixParams.pCounterDataBuilder = builder;
+    if (status == NVPA_STATUS_SUCCESS) {
+        status = NVPW_CounterDataBuilder_GetCounterDataPrefix(&prefixParams);
+    }
+    if (status == NVPA_STATUS_SUCCESS) {
+        counterDataPrefix_.resize(prefixParams.bytesCopied);
+        prefixParams.bytesAllocated = counterDataPrefix_.size();
+        prefixParams.pBuffer = counterDataPrefix_.data();
+        status = NVPW_CounterDataBuilder_GetCounterDataPrefix(&prefixParams);
+    }
+    NVPW_CounterDataBuilder_Destroy_Params destroyBuilderParams{NVPW_CounterDataBuilder_Destroy_Params_STRUCT_SIZE};
+    destroyBuilderParams.pCounterDataBuilder = builder;
+    NVPW_CounterDataBuilder_Destroy(&destroyBuilderParams);
+    throwIfError(status);
+}
+
+MetricsProfiler::~MetricsProfiler() {
+    cancel();
+    if (evaluator_) {
+        NVPW_MetricsEvaluator_Destroy_Params params{NVPW_MetricsEvaluator_Destroy_Params_STRUCT_SIZE};
+        params.pMetricsEvaluator = evaluator_;
+        NVPW_MetricsEvaluator_Destroy(&params);
+    }
+}
+
+std::mutex& MetricsProfiler::sessionMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+void MetricsProfiler::begin() {
+    session_ = std::unique_lock<std::mutex>{sessionMutex()};
+    try {
+        // Counter data is initialized for each session, since it keeps ranges of the previous one
+        CUpti_Profiler_CounterDataImageOptions options{CUpti_Profiler_CounterDataImageOptions_STRUCT_SIZE};
+        options.pCounterDataPrefix = counterDataPrefix_.data();
+        options.counterDataPrefixSize = counterDataPrefix_.size();
+        options.maxNumRanges = maxRanges_;
+        options.maxNumRangeTreeNodes = maxRanges_;
+        options.maxRangeNameLength = 64;
+        CUpti_Profiler_CounterDataImage_CalculateSize_Params sizeParams{
+            CUpti_Profiler_CounterDataImage_CalculateSize_Params_STRUCT_SIZE};
+        sizeParams.pOptions = &options;
+        sizeParams.sizeofCounterDataImageOptions = CUpti_Profiler_CounterDataImageOptions_STRUCT_SIZE;
+        throwIfError(cuptiProfilerCounterDataImageCalculateSize(&sizeParams));
+        counterData_.resize(sizeParams.counterDataImageSize);
+        CUpti_Profiler_CounterDataImage_Initialize_Params initializeParams{
+            CUpti_Profiler_CounterDataImage_Initialize_Params_STRUCT_SIZE};
+        initializeParams.sizeofCounterDataImageOptions = CUpti_Profiler_CounterDataImageOptions_STRUCT_SIZE;
+        initializeParams.pOptions = &options;
+        initializeParams.counterDataImageSize = counterData_.size();
+        initializeParams.pCounterDataImage = counterData_.data();
+        throwIfError(cuptiProfilerCounterDataImageInitialize(&initializeParams));
+        CUpti_Profiler_CounterDataImage_CalculateScratchBufferSize_Params scratchSizeParams{
+            CUpti_Profiler_CounterDataImage_CalculateScratchBufferSize_Params_STRUCT_SIZE};
+        scratchSizeParams.counterDataImageSize = counterData_.size();
+        scratchSizeParams.pCounterDataImage = counterData_.data();
+        throwIfError(cuptiProfilerCounterDataImageCalculateScratchBufferSize(&scratchSizeParams));
+        counterDataScratch_.resize(scratchSizeParams.counterDataScratchBufferSize);
+        CUpti_Profiler_CounterDataImage_InitializeScratchBuffer_Params scratchParams{
+            CUpti_Profiler_CounterDataImage_InitializeScratchBuffer_Params_STRUCT_SIZE};
+        scratchParams.counterDataImageSize = counterData_.size();
+        scratchParams.pCounterDataImage = counterData_.data();
+        scratchParams.counterDataScratchBufferSize = counterDataScratch_.size();
+        scratchParams.pCounterDataScratchBuffer = counterDataScratch_.data();
+        throwIfError(cuptiProfilerCounterDataImageInitializeScratchBuffer(&scratchParams));
+
+        // Each kernel is a range, which is replayed until all its counters are collected
+        CUpti_Profiler_BeginSession_Params sessionParams{CUpti_Profiler_BeginSession_Params_STRUCT_SIZE};
+        sessionParams.ctx = nullptr;
+        sessionParams.counterDataImageSize = counterData_.size();
+        sessionParams.pCounterDataImage = counterData_.data();
+        sessionParams.counterDataScratchBufferSize = counterDataScratch_.size();
+        sessionParams.pCounterDataScratchBuffer = counterDataScratch_.data();
+        sessionParams.range = CUPTI_AutoRange;
+        sessionParams.replayMode = CUPTI_KernelReplay;
+        sessionParams.maxRangesPerPass = maxRanges_;
+        sessionParams.maxLaunchesPerPass = maxRanges_;
+        throwIfError(cuptiProfilerBeginSession(&sessionParams));
+        CUpti_Profiler_SetConfig_Params configParams{CUpti_Profiler_SetConfig_Params_STRUCT_SIZE};
+        configParams.pConfig = config_.data();
+        configParams.configSize = config_.size();
+        configParams.passIndex = 0;
+        throwIfError(cuptiProfilerSetConfig(&configParams));
+        CUpti_Profiler_EnableProfiling_Params enableParams{CUpti_Profiler_EnableProfiling_Params_STRUCT_SIZE};
+        throwIfError(cuptiProfilerEnableProfiling(&enableParams));
+    } catch (...) {
+        cancel();
+        throw;
+    }
+}
+
+size_t MetricsProfiler::flush() {
+    CUpti_Profiler_FlushCounterData_Params flushParams{CUpti_Profiler_FlushCounterData_Params_STRUCT_SIZE};
+    throwIfError(cuptiProfilerFlushCounterData(&flushParams));
+    NVPW_CounterData_GetNumRanges_Params rangesParams{NVPW_CounterData_GetNumRanges_Params_STRUCT_SIZE};
+    rangesParams.pCounterDataImage = counterData_.data();
+    throwIfError(NVPW_CounterData_GetNumRanges(&rangesParams));
+    return rangesParams.numRanges;
+}
+
+std::vector<std::vector<double>> MetricsProfiler::end() {
+    const auto ranges = flush();
+    cancel();
+
+    NVPW_MetricsEvaluator_SetDeviceAttributes_Params attributesParams{
+        NVPW_MetricsEvaluator_SetDeviceAttributes_Params_STRUCT_SIZE};
+    attributesParams.pMetricsEvaluator = evaluator_;
+    attributesParams.pCounterDataImage = counterData_.data();
+    attributesParams.counterDataImageSize = counterData_.size();
+    throwIfError(NVPW_MetricsEvaluator_SetDeviceAttributes(&attributesParams));
+    const auto unknown = std::numeric_limits<double>::quiet_NaN();
+    std::vector<std::vector<double>> values(ranges, std::vector<double>(metrics_.size(), unknown));
+    for (size_t range = 0; range < ranges; ++range) {
+        for (size_t i = 0; i < metrics_.size(); ++i) {
+            if (!supported_[i]) {
+                continue;
+            }
+            NVPW_MetricsEvaluator_EvaluateToGpuValues_Params evaluateParams{
+                NVPW_MetricsEvaluator_EvaluateToGpuValues_Params_STRUCT_SIZE};
+            evaluateParams.pMetricsEvaluator = evaluator_;
+            evaluateParams.pMetricEvalRequests = &evalRequests_[i];
+            evaluateParams.numMetricEvalRequests = 1;
+            evaluateParams.metricEvalRequestStructSize = NVPW_MetricEvalRequest_STRUCT_SIZE;
+            evaluateParams.metricEvalRequestStrideSize = sizeof(NVPW_MetricEvalRequest);
+            evaluateParams.pCounterDataImage = counterData_.data();
+            evaluateParams.counterDataImageSize = counterData_.size();
+            evaluateParams.rangeIndex = range;
+            evaluateParams.isolated = true;
+            evaluateParams.pMetricValues = &values[range][i];
+            throwIfError(NVPW_MetricsEvaluator_EvaluateToGpuValues(&evaluateParams));
+        }
+    }
+    return values;
+}
+
+void MetricsProfiler::cancel() noexcept {
+    if (!session_.owns_lock()) {
+        return;
+    }
+    // Calls fail harmlessly for the steps of the session which haven't been reached
+    CUpti_Profiler_DisableProfiling_Params disableParams{CUpti_Profiler_DisableProfiling_Params_STRUCT_SIZE};
+    cuptiProfilerDisableProfiling(&disableParams);
+    CUpti_Profiler_UnsetConfig_Params unsetParams{CUpti_Profiler_UnsetConfig_Params_STRUCT_SIZE};
+    cuptiProfilerUnsetConfig(&unsetParams);
+    CUpti_Profiler_EndSession_Params endParams{CUpti_Profiler_EndSession_Params_STRUCT_SIZE};
+    cuptiProfilerEndSession(&endParams);
+    session_.unlock();
+}
+
+}  // namespace CUDA
+
+#endif  // ENABLE_CUPTI_METRICS
@@ -0,0 +1,74 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <nvperf_host.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CUDA {
+
+/**
+ * Collects hardware metrics of kernels by CUPTI Profiling API (built with -DENABLE_CUPTI_METRICS=ON).
+ * Each kernel launched within a session is a range of its own, which CUPTI replays as many times as
+ * its metrics require, so kernels are serialized and slowed down while the session lasts.
+ * Sessions of all profilers are serialized, since CUPTI allows a single session per context
+ */
+class MetricsProfiler {
+public:
+    /**
+     * @param deviceId Device the kernels are launched on
+     * @param metrics Names of CUPTI metrics (e.g. sm__warps_active.avg.pct_of_peak_sustained_active)
+     * @param maxRanges Maximal number of kernels of a session, metrics of further kernels are dropped
+     * Metrics the device doesn't support are reported as NaN
+     */
+    MetricsProfiler(int deviceId, std::vector<std::string> metrics, size_t maxRanges);
+    ~MetricsProfiler();
+    MetricsProfiler(const MetricsProfiler&) = delete;
+    MetricsProfiler& operator=(const MetricsProfiler&) = delete;
+
+    /**
+     * Starts profiling of kernels launched by the current context
+     */
+    void begin();
+
+    /**
+     * Waits for metrics of kernels launched so far
+     * @returns Number of kernels profiled since the beginning of the session
+     */
+    size_t flush();
+
+    /**
+     * Stops profiling
+     * @returns Values of the metrics (in the order of the constructor) of each kernel of the session
+     */
+    std::vector<std::vector<double>> end();
+
+    /**
+     * Stops profiling discarding metrics, e.g. if the execution is failed
+     */
+    void cancel() noexcept;
+
+private:
+    static std::mutex& sessionMutex();
+
+    std::string chip_;
+    std::vector<std::string> metrics_;
+    std::vector<std::uint8_t> evaluatorScratch_;
+    NVPW_MetricsEvaluator* evaluator_ = nullptr;
+    std::vector<NVPW_MetricEvalRequest> evalRequests_;
+    std::vector<bool> supported_;
+    std::vector<std::uint8_t> config_;
+    std::vector<std::uint8_t> counterDataPrefix_;
+    std::vector<std::uint8_t> counterData_;
+    std::vector<std::uint8_t> counterDataScratch_;
+    size_t maxRanges_;
+    std::unique_lock<std::mutex> session_;
+};
+
+}  // namespace CUDA
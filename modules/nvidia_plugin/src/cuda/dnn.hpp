@@ -285,6 +285,28 @@ public:
     }
 };
 
+class DnnReduceNorm1Descriptor : public DnnReduceTensorDescriptor {
+public:
+    explicit DnnReduceNorm1Descriptor(cudnnDataType_t compType) {
+        set(CUDNN_REDUCE_TENSOR_NORM1,
+            compType,
+            CUDNN_PROPAGATE_NAN,
+            CUDNN_REDUCE_TENSOR_NO_INDICES,
+            CUDNN_32BIT_INDICES);
+    }
+};
+
+class DnnReduceNorm2Descriptor : public DnnReduceTensorDescriptor {
+public:
+    explicit DnnReduceNorm2Descriptor(cudnnDataType_t compType) {
+        set(CUDNN_REDUCE_TENSOR_NORM2,
+            compType,
+            CUDNN_PROPAGATE_NAN,
+            CUDNN_REDUCE_TENSOR_NO_INDICES,
+            CUDNN_32BIT_INDICES);
+    }
+};
+
 class DnnScaleFactor {
 public:
     constexpr const void* get() const noexcept { return scaling_factor_; }
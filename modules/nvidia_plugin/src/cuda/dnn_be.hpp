@@ -428,7 +428,6 @@ public:
         return is_knob_set;
     }
 
-private:
     class Knob {
     public:
         Knob(cudnnBackendKnobType_t type_, int64_t max, int64_t min, int64_t stride_)
@@ -442,7 +441,7 @@ private:
 
         int64_t getMinValue() const { return minValue; }
 
-        int64_t getMaxValue() const { return minValue; }
+        int64_t getMaxValue() const { return maxValue; }
 
         int64_t getStride() const { return stride; }
 
@@ -452,6 +451,24 @@ private:
         int64_t choice = -1;                             //!< Choice set by the user
     };
 
+    const std::vector<Knob>& getKnobs() const { return knobs_; }
+
+    /**
+     * Sets the value of the knob of the given type, which is passed to engine configs built for the engine
+     * @returns false if the engine has no knob of the type
+     */
+    bool setKnobChoice(cudnnBackendKnobType_t type, int64_t value) {
+        for (auto& knob : knobs_) {
+            if (knob.getKnobType() == type) {
+                knob.setChoice(value);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+
     void buildKnobs() {
         for (auto i = 0; i < num_knobs_; i++) {
             auto bKnob = bknobs_[i]->get();
@@ -538,18 +555,22 @@ public:
 
     auto& setEngine(const std::shared_ptr<DnnBEEngine>& engine) {
         desc_->engine_ = engine;
-        auto& knobs = engine->knobs_;
-        desc_->num_knobs_ = knobs.size();
         desc_->set_knobs_attr_ = engine->isKnobsSet();
 
-        for (std::uint32_t i = 0; i < knobs.size(); i++) {
-            cudnnBackendKnobType_t type = knobs[i].getKnobType();
-            int64_t value = knobs[i].getChoice();
+        // Only knobs with chosen values are passed, others keep defaults of the engine
+        desc_->num_knobs_ = 0;
+        for (const auto& knob : engine->knobs_) {
+            if (knob.getChoice() == -1) {
+                continue;
+            }
+            cudnnBackendKnobType_t type = knob.getKnobType();
+            int64_t value = knob.getChoice();
+            const auto& choice = desc_->bchoices_[desc_->num_knobs_++];
             throwIfError(cudnnBackendSetAttribute(
-                desc_->bchoices_[i]->get(), CUDNN_ATTR_KNOB_CHOICE_KNOB_TYPE, CUDNN_TYPE_KNOB_TYPE, 1, &type));
+                choice->get(), CUDNN_ATTR_KNOB_CHOICE_KNOB_TYPE, CUDNN_TYPE_KNOB_TYPE, 1, &type));
             throwIfError(cudnnBackendSetAttribute(
-                desc_->bchoices_[i]->get(), CUDNN_ATTR_KNOB_CHOICE_KNOB_VALUE, CUDNN_TYPE_INT64, 1, &value));
-            throwIfError(cudnnBackendFinalize(desc_->bchoices_[i]->get()));
+                choice->get(), CUDNN_ATTR_KNOB_CHOICE_KNOB_VALUE, CUDNN_TYPE_INT64, 1, &value));
+            throwIfError(cudnnBackendFinalize(choice->get()));
         }
 
         auto handle = engine->get();
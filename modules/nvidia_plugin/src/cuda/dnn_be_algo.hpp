@@ -4,8 +4,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <memory_manager/model/details/cuda_memory_utils.hpp>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "dnn_be.hpp"
@@ -50,6 +57,187 @@ inline std::vector<std::shared_ptr<DnnBEExecutionPlan>> getAllExecutionPlansFrom
     return std::move(plans);
 }
 
+inline std::vector<std::shared_ptr<DnnBEExecutionPlan>> filterPlansByWorkspaceSize(
+    const std::vector<std::shared_ptr<DnnBEExecutionPlan>>& plans, const size_t max_workspace_size) {
+    auto filtered_plans = plans;
+    auto erased = std::remove_if(filtered_plans.begin(), filtered_plans.end(), [max_workspace_size](const auto& plan) {
+        return static_cast<size_t>(plan->getWorkspaceSize()) > max_workspace_size;
+    });
+    filtered_plans.erase(erased, filtered_plans.end());
+    return filtered_plans;
+}
+
+/**
+ * Formats the execution plan for the cache of benchmarked algorithms as "<index> <number of plans>",
+ * as the index is valid only for the same list of plans
+ */
+inline std::string formatCachedPlan(const std::vector<std::shared_ptr<DnnBEExecutionPlan>>& plans,
+                                    const std::shared_ptr<DnnBEExecutionPlan>& plan) {
+    const auto index = std::distance(plans.begin(), std::find(plans.begin(), plans.end(), plan));
+    return std::to_string(index) + " " + std::to_string(plans.size());
+}
+
+/**
+ * @returns Execution plan stored by formatCachedPlan() or nullptr if the list of plans has changed
+ */
+inline std::shared_ptr<DnnBEExecutionPlan> findCachedPlan(
+    const std::vector<std::shared_ptr<DnnBEExecutionPlan>>& plans, const std::optional<std::string>& cachedPlan) {
+    if (!cachedPlan) {
+        return nullptr;
+    }
+    size_t index = 0;
+    size_t numPlans = 0;
+    std::istringstream stream{*cachedPlan};
+    if (!(stream >> index >> numPlans) || numPlans != plans.size() || index >= plans.size()) {
+        return nullptr;
+    }
+    return plans[index];
+}
+
+/**
+ * Execution plan of an engine, which is built with default values of knobs or with one knob set to another value.
+ * It is identified in the cache of benchmarked algorithms by "engine <global index> [<knob type> <value>]"
+ */
+struct DnnBETunedPlan {
+    std::shared_ptr<DnnBEExecutionPlan> plan;
+    std::string config;
+};
+
+/**
+ * @param knob Type and value of the knob, which is changed from its default value
+ * @returns Execution plan or nullptr if the engine has no such knob
+ * @throws ov::Exception if the engine doesn't support the graph or the value of the knob
+ */
+inline std::shared_ptr<DnnBEExecutionPlan> buildTunedPlan(
+    const std::shared_ptr<DnnBEOperationGraphDescriptor>& graph,
+    const CUDA::DnnHandle& dnnHandle,
+    const int64_t engineIndex,
+    const std::optional<std::pair<cudnnBackendKnobType_t, int64_t>>& knob = std::nullopt) {
+    auto engine = CUDA::DnnBEEngineBuilder().setOpEngineGraph(graph).setGlobalIndex(engineIndex).build();
+    if (knob && !engine->setKnobChoice(knob->first, knob->second)) {
+        return nullptr;
+    }
+    auto config = CUDA::DnnBEEngineConfigDescriptorBuilder().setEngine(engine).build();
+    return CUDA::DnnBEExecutionPlanBuilder().setDnnHandle(dnnHandle).setEngineConfig(config).build();
+}
+
+/**
+ * Provides plans of all engines of the graph, including those skipped by heuristics, with default values of knobs
+ * and with each knob set to each of its values in turn. Wide ranges of values are sampled evenly
+ * @param maxWorkspaceSize Plans, which need larger workspaces, are skipped
+ */
+inline std::vector<DnnBETunedPlan> getTunedExecutionPlans(const std::shared_ptr<DnnBEOperationGraphDescriptor>& graph,
+                                                          const CUDA::DnnHandle& dnnHandle,
+                                                          const size_t maxWorkspaceSize) {
+    constexpr int64_t kMaxKnobValues = 8;
+    constexpr size_t kMaxTunedPlans = 128;
+    std::vector<DnnBETunedPlan> result;
+    const auto numEngines = graph->getEngineCount();
+    for (int64_t index = 0; index < numEngines && result.size() < kMaxTunedPlans; ++index) {
+        std::shared_ptr<DnnBEEngine> engine;
+        try {
+            engine = CUDA::DnnBEEngineBuilder().setOpEngineGraph(graph).setGlobalIndex(index).build();
+        } catch (const ov::Exception&) {
+            continue;
+        }
+        auto addPlan = [&](const std::optional<std::pair<cudnnBackendKnobType_t, int64_t>>& knob) {
+            try {
+                auto plan = buildTunedPlan(graph, dnnHandle, index, knob);
+                if (plan && static_cast<size_t>(plan->getWorkspaceSize()) <= maxWorkspaceSize) {
+                    auto config = "engine " + std::to_string(index);
+                    if (knob) {
+                        config += " " + std::to_string(knob->first) + " " + std::to_string(knob->second);
+                    }
+                    result.push_back({std::move(plan), std::move(config)});
+                }
+            } catch (const ov::Exception&) {
+                // Value isn't supported for the graph
+            }
+        };
+        addPlan(std::nullopt);
+        for (const auto& knob : engine->getKnobs()) {
+            const auto stride = std::max<int64_t>(knob.getStride(), 1);
+            const auto numValues = (knob.getMaxValue() - knob.getMinValue()) / stride + 1;
+            const auto step = stride * ((numValues + kMaxKnobValues - 1) / kMaxKnobValues);
+            for (auto value = knob.getMinValue(); value <= knob.getMaxValue(); value += step) {
+                addPlan(std::make_pair(knob.getKnobType(), value));
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * Formats the execution plan for the cache of benchmarked algorithms: plans of heuristics are stored by
+ * formatCachedPlan(), tuned plans by their configs
+ */
+inline std::string formatCachedPlan(const std::vector<std::shared_ptr<DnnBEExecutionPlan>>& plans,
+                                    const std::vector<DnnBETunedPlan>& tunedPlans,
+                                    const std::shared_ptr<DnnBEExecutionPlan>& plan) {
+    const auto tuned = std::find_if(
+        tunedPlans.begin(), tunedPlans.end(), [&plan](const auto& tunedPlan) { return tunedPlan.plan == plan; });
+    return tuned != tunedPlans.end() ? tuned->config : formatCachedPlan(plans, plan);
+}
+
+/**
+ * @returns Tuned execution plan stored by formatCachedPlan() or nullptr if it isn't a tuned plan
+ *          or it isn't supported anymore
+ */
+inline std::shared_ptr<DnnBEExecutionPlan> findTunedPlan(const std::shared_ptr<DnnBEOperationGraphDescriptor>& graph,
+                                                         const CUDA::DnnHandle& dnnHandle,
+                                                         const std::optional<std::string>& cachedPlan) {
+    if (!cachedPlan) {
+        return nullptr;
+    }
+    std::istringstream stream{*cachedPlan};
+    std::string tag;
+    int64_t index = 0;
+    if (!(stream >> tag >> index) || tag != "engine") {
+        return nullptr;
+    }
+    std::optional<std::pair<cudnnBackendKnobType_t, int64_t>> knob;
+    int type = 0;
+    int64_t value = 0;
+    if (stream >> type >> value) {
+        knob = std::make_pair(static_cast<cudnnBackendKnobType_t>(type), value);
+    }
+    try {
+        return buildTunedPlan(graph, dnnHandle, index, knob);
+    } catch (const ov::Exception&) {
+        return nullptr;
+    }
+}
+
+/**
+ * Execution plans of the engine config, which are built once per cuDNN handle of thread contexts, since finalizing
+ * a plan may compile kernels. A plan can be built while the stream of the handle is captured into a CUDA Graph
+ */
+class DnnBEExecutionPlanCache {
+public:
+    const DnnBEExecutionPlan& get(const DnnHandle& dnnHandle,
+                                  const std::shared_ptr<DnnBEEngineConfigDescriptor>& engineConfig) const {
+        std::lock_guard<std::mutex> lock{mutex_};
+        auto& plan = plans_[dnnHandle.get()];
+        if (!plan) {
+            cudaStreamCaptureMode mode = cudaStreamCaptureModeRelaxed;
+            throwIfError(cudaThreadExchangeStreamCaptureMode(&mode));
+            try {
+                plan = DnnBEExecutionPlanBuilder().setDnnHandle(dnnHandle).setEngineConfig(engineConfig).build();
+            } catch (...) {
+                cudaThreadExchangeStreamCaptureMode(&mode);
+                plans_.erase(dnnHandle.get());
+                throw;
+            }
+            throwIfError(cudaThreadExchangeStreamCaptureMode(&mode));
+        }
+        return *plan;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<cudnnHandle_t, std::shared_ptr<DnnBEExecutionPlan>> plans_;
+};
+
 template <size_t NumBenchmarks>
 std::shared_ptr<CUDA::DnnBEExecutionPlan> performBenchmarks(
     const CUDA::DnnHandle& dnnHandle,
@@ -79,17 +267,6 @@ std::shared_ptr<CUDA::DnnBEExecutionPlan> performBenchmarks(
         return std::nullopt;
     };
 
-    auto filterPlansByWorkspaceSize = [](const std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans,
-                                         const size_t max_workspace_size) {
-        auto filtered_plans = plans;
-        auto erased =
-            std::remove_if(filtered_plans.begin(), filtered_plans.end(), [max_workspace_size](const auto& plan) {
-                return plan->getWorkspaceSize() > max_workspace_size;
-            });
-        filtered_plans.erase(erased, filtered_plans.end());
-        return filtered_plans;
-    };
-
     const auto& workspace_sizes = getDescendSortedWorkspaceSizes(plans);
     auto max_workspace = tryAllocateMaxWorkspace(workspace_sizes);
     auto [workspace, max_workspace_size] = max_workspace.value();
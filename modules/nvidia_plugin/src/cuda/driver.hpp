@@ -0,0 +1,27 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda.h>
+
+#include <error.hpp>
+#include <string>
+
+inline std::string cuDriverGetErrorString(CUresult err) {
+    const char* message = nullptr;
+    return cuGetErrorString(err, &message) == CUDA_SUCCESS && message ? message : "CUDA driver unknown error";
+}
+
+inline void throwIfError(
+    CUresult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUDA_SUCCESS) ov::nvidia_gpu::throw_ov_exception(cuDriverGetErrorString(err), location);
+}
+
+inline void logIfError(
+    CUresult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUDA_SUCCESS) ov::nvidia_gpu::logError(cuDriverGetErrorString(err), location);
+}
@@ -16,6 +16,7 @@ public:
     };
 
     Event() : Handle((static_cast<__host__ cudaError_t (*)(cudaEvent_t* event)>(cudaEventCreate)), cudaEventDestroy) {}
+    explicit Event(unsigned int flags) : Handle(cudaEventCreateWithFlags, cudaEventDestroy, flags) {}
     auto& record(const Stream& stream, RecordMode flags = RecordMode::Default) {
         throwIfError(cudaEventRecordWithFlags(get(), stream.get(), flags));
         return *this;
@@ -25,6 +26,10 @@ public:
         return std::move(*this);
     }
     void synchronize() { throwIfError(cudaEventSynchronize(get())); }
+    /**
+     * Makes all future work submitted to the stream wait for completion of the work captured by this event
+     */
+    void streamWait(const Stream& stream) const { throwIfError(cudaStreamWaitEvent(stream.get(), get(), 0)); }
     float elapsedSince(const Event& start) const { return createFirstArg(cudaEventElapsedTime, start.get(), get()); }
 };
 
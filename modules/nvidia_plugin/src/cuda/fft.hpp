@@ -0,0 +1,60 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cufft.h>
+
+#include "runtime.hpp"
+
+inline std::string cufftGetErrorString(cufftResult status) {
+    switch (status) {
+        case CUFFT_SUCCESS:
+            return "cuFFT Success";
+        case CUFFT_INVALID_PLAN:
+            return "cuFFT Invalid Plan";
+        case CUFFT_ALLOC_FAILED:
+            return "cuFFT Allocation Failed";
+        case CUFFT_INVALID_VALUE:
+            return "cuFFT Invalid Value";
+        case CUFFT_INTERNAL_ERROR:
+            return "cuFFT Internal Error";
+        case CUFFT_EXEC_FAILED:
+            return "cuFFT Execution Failed";
+        case CUFFT_SETUP_FAILED:
+            return "cuFFT Setup Failed";
+        case CUFFT_INVALID_SIZE:
+            return "cuFFT Invalid Size";
+        case CUFFT_NOT_SUPPORTED:
+            return "cuFFT Not Supported";
+        default:
+            return "cuFFT Unknown Status";
+    }
+}
+
+inline void throwIfError(
+    cufftResult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUFFT_SUCCESS) ov::nvidia_gpu::throw_ov_exception(cufftGetErrorString(err), location);
+}
+
+inline void logIfError(
+    cufftResult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUFFT_SUCCESS) ov::nvidia_gpu::logError(cufftGetErrorString(err), location);
+}
+
+namespace CUDA {
+
+/**
+ * cuFFT plan, which doesn't allocate its work area, so it is given on execution
+ */
+class FftPlan : public Handle<cufftHandle> {
+public:
+    FftPlan() : Handle((cufftCreate), cufftDestroy) { throwIfError(cufftSetAutoAllocation(get(), 0)); }
+    void setStream(const Stream& stream) const { throwIfError(cufftSetStream(get(), stream.get())); }
+    void setWorkArea(void* workArea) const { throwIfError(cufftSetWorkArea(get(), workArea)); }
+};
+
+}  // namespace CUDA
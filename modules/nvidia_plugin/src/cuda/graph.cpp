@@ -7,8 +7,117 @@
 #include "openvino/core/except.hpp"
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 namespace CUDA {
 
+namespace {
+
+/**
+ * Appends nodes of the graph in the order they are created, nodes of a child graph follow their parent node
+ */
+void collectNodes(cudaGraph_t graph, std::vector<cudaGraphNode_t>& nodes) {
+    std::size_t count = 0;
+    throwIfError(cudaGraphGetNodes(graph, nullptr, &count));
+    std::vector<cudaGraphNode_t> graphNodes(count);
+    throwIfError(cudaGraphGetNodes(graph, graphNodes.data(), &count));
+    for (auto node : graphNodes) {
+        nodes.push_back(node);
+        cudaGraphNodeType type;
+        throwIfError(cudaGraphNodeGetType(node, &type));
+        if (type == cudaGraphNodeTypeGraph) {
+            // The embedded graph is owned by the node, changes of its nodes are reflected in the node
+            cudaGraph_t child;
+            throwIfError(cudaGraphChildGraphNodeGetGraph(node, &child));
+            collectNodes(child, nodes);
+        }
+    }
+}
+
+std::vector<cudaGraphNode_t> collectNodes(cudaGraph_t graph) {
+    std::vector<cudaGraphNode_t> nodes;
+    collectNodes(graph, nodes);
+    return nodes;
+}
+
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 12040
+/**
+ * Parameters of a kernel node with copies of values of the kernel parameters
+ */
+struct KernelNodeParams {
+    CUDA_KERNEL_NODE_PARAMS params{};
+    CUfunction func = nullptr;
+    std::vector<std::vector<std::uint8_t>> values;
+};
+
+std::optional<KernelNodeParams> getKernelNodeParams(cudaGraphNode_t node) {
+    KernelNodeParams kernel;
+    auto& params = kernel.params;
+    if (cuGraphKernelNodeGetParams(node, &params) != CUDA_SUCCESS || params.kernelParams == nullptr) {
+        return std::nullopt;
+    }
+    kernel.func = params.func;
+    if (kernel.func == nullptr &&
+        (params.kern == nullptr || cuKernelGetFunction(&kernel.func, params.kern) != CUDA_SUCCESS)) {
+        return std::nullopt;
+    }
+    for (std::size_t i = 0;; ++i) {
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        const auto result = cuFuncGetParamInfo(kernel.func, i, &offset, &size);
+        if (result == CUDA_ERROR_INVALID_VALUE) {
+            break;
+        }
+        if (result != CUDA_SUCCESS) {
+            return std::nullopt;
+        }
+        const auto* value = static_cast<const std::uint8_t*>(params.kernelParams[i]);
+        kernel.values.emplace_back(value, value + size);
+    }
+    return kernel;
+}
+
+bool equalLaunches(const CUDA_KERNEL_NODE_PARAMS& lhs, const CUDA_KERNEL_NODE_PARAMS& rhs) {
+    return lhs.gridDimX == rhs.gridDimX && lhs.gridDimY == rhs.gridDimY && lhs.gridDimZ == rhs.gridDimZ &&
+           lhs.blockDimX == rhs.blockDimX && lhs.blockDimY == rhs.blockDimY && lhs.blockDimZ == rhs.blockDimZ &&
+           lhs.sharedMemBytes == rhs.sharedMemBytes;
+}
+#endif
+
+const void* readPointer(const std::vector<std::uint8_t>& value, std::size_t offset) {
+    const void* ptr = nullptr;
+    std::memcpy(&ptr, value.data() + offset, sizeof(ptr));
+    return ptr;
+}
+
+/**
+ * @returns true if both pointers are the same or the second one is the first one moved by the relocation
+ */
+bool isSameOrRelocated(const void* ptr, const void* other, const Relocation& relocation, bool& relocated) {
+    relocated = ptr != other;
+    return !relocated || relocation.apply(ptr) == other;
+}
+
+bool equalMemcpyExtents(const cudaMemcpy3DParms& lhs, const cudaMemcpy3DParms& rhs) {
+    return lhs.srcArray == nullptr && rhs.srcArray == nullptr && lhs.dstArray == nullptr && rhs.dstArray == nullptr &&
+           lhs.srcPtr.pitch == rhs.srcPtr.pitch && lhs.srcPtr.xsize == rhs.srcPtr.xsize &&
+           lhs.srcPtr.ysize == rhs.srcPtr.ysize && lhs.dstPtr.pitch == rhs.dstPtr.pitch &&
+           lhs.dstPtr.xsize == rhs.dstPtr.xsize && lhs.dstPtr.ysize == rhs.dstPtr.ysize &&
+           lhs.srcPos.x == rhs.srcPos.x && lhs.srcPos.y == rhs.srcPos.y && lhs.srcPos.z == rhs.srcPos.z &&
+           lhs.dstPos.x == rhs.dstPos.x && lhs.dstPos.y == rhs.dstPos.y && lhs.dstPos.z == rhs.dstPos.z &&
+           lhs.extent.width == rhs.extent.width && lhs.extent.height == rhs.extent.height &&
+           lhs.extent.depth == rhs.extent.depth && lhs.kind == rhs.kind;
+}
+
+bool equalMemsets(const cudaMemsetParams& lhs, const cudaMemsetParams& rhs) {
+    return lhs.pitch == rhs.pitch && lhs.value == rhs.value && lhs.elementSize == rhs.elementSize &&
+           lhs.width == rhs.width && lhs.height == rhs.height;
+}
+
+}  // namespace
+
 Graph::Graph(unsigned int flags) :
         Graph { createNativeWithFlags(flags) } {
 }
@@ -28,6 +137,158 @@ cudaGraph_t Graph::createNativeWithFlags(unsigned int flags) {
     return g;
 }
 
+std::optional<GraphRelocations> GraphRelocations::find(const Graph& graph,
+                                                       const Graph& other,
+                                                       const Relocation& relocation,
+                                                       const std::vector<cudaGraphNode_t>& skipped) {
+    const auto nodes = collectNodes(graph.get());
+    const auto otherNodes = collectNodes(other.get());
+    if (nodes.size() != otherNodes.size()) {
+        return std::nullopt;
+    }
+    GraphRelocations relocations;
+    auto& pointers = relocations.pointers_;
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        cudaGraphNodeType type;
+        cudaGraphNodeType otherType;
+        throwIfError(cudaGraphNodeGetType(nodes[i], &type));
+        throwIfError(cudaGraphNodeGetType(otherNodes[i], &otherType));
+        if (type != otherType) {
+            return std::nullopt;
+        }
+        if (std::find(skipped.begin(), skipped.end(), nodes[i]) != skipped.end()) {
+            continue;
+        }
+        bool relocated = false;
+        switch (type) {
+            case cudaGraphNodeTypeEmpty:
+            case cudaGraphNodeTypeGraph:
+                break;
+            case cudaGraphNodeTypeKernel: {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 12040
+                const auto kernel = getKernelNodeParams(nodes[i]);
+                const auto otherKernel = getKernelNodeParams(otherNodes[i]);
+                if (!kernel || !otherKernel || kernel->func != otherKernel->func ||
+                    !equalLaunches(kernel->params, otherKernel->params)) {
+                    return std::nullopt;
+                }
+                for (std::size_t p = 0; p < kernel->values.size(); ++p) {
+                    const auto& value = kernel->values[p];
+                    const auto& otherValue = otherKernel->values[p];
+                    std::size_t offset = 0;
+                    for (; offset + sizeof(void*) <= value.size(); offset += sizeof(void*)) {
+                        if (!isSameOrRelocated(
+                                readPointer(value, offset), readPointer(otherValue, offset), relocation, relocated)) {
+                            return std::nullopt;
+                        }
+                        if (relocated) {
+                            pointers.push_back({i, Field::KernelParameter, p, offset});
+                        }
+                    }
+                    if (!std::equal(value.begin() + offset, value.end(), otherValue.begin() + offset)) {
+                        return std::nullopt;
+                    }
+                }
+                break;
+#else
+                // Parameter layout of a kernel can't be queried before CUDA 12.4
+                return std::nullopt;
+#endif
+            }
+            case cudaGraphNodeTypeMemcpy: {
+                cudaMemcpy3DParms params{};
+                cudaMemcpy3DParms otherParams{};
+                throwIfError(cudaGraphMemcpyNodeGetParams(nodes[i], &params));
+                throwIfError(cudaGraphMemcpyNodeGetParams(otherNodes[i], &otherParams));
+                if (!equalMemcpyExtents(params, otherParams)) {
+                    return std::nullopt;
+                }
+                if (!isSameOrRelocated(params.srcPtr.ptr, otherParams.srcPtr.ptr, relocation, relocated)) {
+                    return std::nullopt;
+                }
+                if (relocated) {
+                    pointers.push_back({i, Field::Source});
+                }
+                if (!isSameOrRelocated(params.dstPtr.ptr, otherParams.dstPtr.ptr, relocation, relocated)) {
+                    return std::nullopt;
+                }
+                if (relocated) {
+                    pointers.push_back({i, Field::Destination});
+                }
+                break;
+            }
+            case cudaGraphNodeTypeMemset: {
+                cudaMemsetParams params{};
+                cudaMemsetParams otherParams{};
+                throwIfError(cudaGraphMemsetNodeGetParams(nodes[i], &params));
+                throwIfError(cudaGraphMemsetNodeGetParams(otherNodes[i], &otherParams));
+                if (!equalMemsets(params, otherParams) ||
+                    !isSameOrRelocated(params.dst, otherParams.dst, relocation, relocated)) {
+                    return std::nullopt;
+                }
+                if (relocated) {
+                    pointers.push_back({i, Field::Destination});
+                }
+                break;
+            }
+            default:
+                return std::nullopt;
+        }
+    }
+    return relocations;
+}
+
+Graph GraphRelocations::apply(const Graph& graph, const Relocation& relocation) const {
+    cudaGraph_t clone;
+    throwIfError(cudaGraphClone(&clone, graph.get()));
+    Graph relocated{clone};
+    const auto nodes = collectNodes(relocated.get());
+    for (auto pointer = pointers_.begin(); pointer != pointers_.end();) {
+        const auto node = nodes.at(pointer->node);
+        const auto end = std::find_if(
+            pointer, pointers_.end(), [&](const auto& next) { return next.node != pointer->node; });
+        if (pointer->field == Field::KernelParameter) {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 12040
+            auto kernel = getKernelNodeParams(node);
+            OPENVINO_ASSERT(kernel, "Parameters of the relocated kernel node can't be queried");
+            for (; pointer != end; ++pointer) {
+                auto& value = kernel->values.at(pointer->parameter);
+                const void* ptr = relocation.apply(readPointer(value, pointer->offset));
+                std::memcpy(value.data() + pointer->offset, &ptr, sizeof(ptr));
+            }
+            std::vector<void*> args;
+            args.reserve(kernel->values.size());
+            for (auto& value : kernel->values) {
+                args.push_back(value.data());
+            }
+            kernel->params.kernelParams = args.data();
+            OPENVINO_ASSERT(cuGraphKernelNodeSetParams(node, &kernel->params) == CUDA_SUCCESS,
+                            "Parameters of the relocated kernel node can't be set");
+#endif
+            pointer = end;
+            continue;
+        }
+        cudaGraphNodeType type;
+        throwIfError(cudaGraphNodeGetType(node, &type));
+        if (type == cudaGraphNodeTypeMemcpy) {
+            cudaMemcpy3DParms params{};
+            throwIfError(cudaGraphMemcpyNodeGetParams(node, &params));
+            for (; pointer != end; ++pointer) {
+                auto& ptr = pointer->field == Field::Source ? params.srcPtr.ptr : params.dstPtr.ptr;
+                ptr = relocation.apply(ptr);
+            }
+            throwIfError(cudaGraphMemcpyNodeSetParams(node, &params));
+        } else {
+            cudaMemsetParams params{};
+            throwIfError(cudaGraphMemsetNodeGetParams(node, &params));
+            params.dst = relocation.apply(params.dst);
+            throwIfError(cudaGraphMemsetNodeSetParams(node, &params));
+            pointer = end;
+        }
+    }
+    return relocated;
+}
+
 bool operator==(const Graph &rhs, const Graph &lhs) { return rhs.get() == lhs.get(); }
 
 GraphExec::GraphExec(const Graph &g)
@@ -67,6 +328,24 @@ cudaGraphExecUpdateResult GraphExec::update(const Graph &g) const {
 }
 #endif
 
+bool GraphExec::try_update(const Graph &g) const {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 12020
+    cudaGraphExecUpdateResultInfo res;
+    const auto err = cudaGraphExecUpdate(get(), g.get(), &res);
+    const auto result = res.result;
+#else
+    cudaGraphExecUpdateResult result;
+    const auto err = cudaGraphExecUpdate(get(), g.get(), nullptr, &result);
+#endif
+    if (err == cudaErrorGraphExecUpdateFailure) {
+        // Clear sticky error state, the graph is expected to be recaptured by the caller
+        cudaGetLastError();
+        return false;
+    }
+    throwIfError(err);
+    return result == cudaGraphExecUpdateSuccess;
+}
+
 void GraphExec::launch(const Stream &stream) const {
     throwIfError(cudaGraphLaunch(get(), stream.get()));
 }
@@ -108,7 +387,7 @@ CaptureInfo::CaptureInfo(const Stream &capturedStream) : stream_{capturedStream}
 UploadNode CaptureInfo::addUploadNode(DevicePointer<void*> dst, const void *src, std::size_t size) {
     cudaGraphNode_t newNode;
     throwIfError(cudaGraphAddMemcpyNode1D(&newNode, capturingGraph_, deps_, depCount_,
-            dst.get(), src, size, cudaMemcpyHostToDevice));
+            dst.get(), src, size, cudaMemcpyDefault));
     throwIfError(cudaStreamUpdateCaptureDependencies(stream_.get(), &newNode, 1, 1));
     return UploadNode{newNode, dst, src, size};
 }
@@ -117,17 +396,60 @@ DownloadNode CaptureInfo::addDownloadNode(void *dst, DevicePointer<const void*>
                                                        std::size_t size) {
     cudaGraphNode_t newNode;
     throwIfError(cudaGraphAddMemcpyNode1D(&newNode, capturingGraph_, deps_, depCount_,
-            dst, src.get(), size, cudaMemcpyDeviceToHost));
+            dst, src.get(), size, cudaMemcpyDefault));
     throwIfError(cudaStreamUpdateCaptureDependencies(stream_.get(), &newNode, 1, 1));
     return DownloadNode{newNode, dst, src, size};
 }
 
-void UploadNode::update_src(const GraphExec& exec, const void *src) {
-    if (src_ != src) {
-        throwIfError(cudaGraphExecMemcpyNodeSetParams1D(exec.get(), node_,
-                dst_.get(), src, size_, cudaMemcpyHostToDevice));
-        src_ = src;
+void CaptureInfo::addChildGraphNode(const Graph& graph) {
+    cudaGraphNode_t newNode;
+    throwIfError(cudaGraphAddChildGraphNode(&newNode, capturingGraph_, deps_, depCount_, graph.get()));
+    throwIfError(cudaStreamUpdateCaptureDependencies(stream_.get(), &newNode, 1, 1));
+}
+
+#if CUDART_VERSION >= 12030
+cudaGraphConditionalHandle CaptureInfo::createConditionalHandle() {
+    cudaGraphConditionalHandle handle;
+    throwIfError(cudaGraphConditionalHandleCreate(&handle, capturingGraph_, 0, cudaGraphCondAssignDefault));
+    return handle;
+}
+
+ConditionalNode CaptureInfo::addConditionalNode(cudaGraphConditionalHandle handle,
+                                                cudaGraphConditionalNodeType type) {
+    cudaGraphNodeParams params{};
+    params.type = cudaGraphNodeTypeConditional;
+    params.conditional.handle = handle;
+    params.conditional.type = type;
+    params.conditional.size = 1;
+    cudaGraphNode_t newNode;
+    throwIfError(cudaGraphAddNode(&newNode, capturingGraph_, deps_, depCount_, &params));
+    throwIfError(cudaStreamUpdateCaptureDependencies(stream_.get(), &newNode, 1, 1));
+    return ConditionalNode{params.conditional.phGraph_out[0]};
+}
+
+ConditionalNode::ConditionalNode(cudaGraph_t body) : body_{body} {}
+
+void ConditionalNode::setBody(const Graph& graph) {
+    cudaGraphNode_t newNode;
+    throwIfError(cudaGraphAddChildGraphNode(&newNode, body_, nullptr, 0, graph.get()));
+}
+#endif
+
+bool UploadNode::set_src(const void *src) {
+    if (src_ == src) {
+        return false;
     }
+    throwIfError(cudaGraphMemcpyNodeSetParams1D(node_, dst_.get(), src, size_, cudaMemcpyDefault));
+    src_ = src;
+    return true;
+}
+
+UploadNode UploadNode::relocate(const Graph& graph, const Relocation& relocation) const {
+    cudaGraphNode_t node;
+    throwIfError(cudaGraphNodeFindInClone(&node, node_, graph.get()));
+    const DevicePointer<void*> dst{relocation.apply(dst_.get())};
+    throwIfError(cudaGraphMemcpyNodeSetParams1D(node, dst.get(), src_, size_, cudaMemcpyDefault));
+    return UploadNode{node, dst, src_, size_};
 }
 
 UploadNode::UploadNode(cudaGraphNode_t node, DevicePointer<void*> dst, const void *src,
@@ -138,12 +460,34 @@ UploadNode::UploadNode(cudaGraphNode_t node, DevicePointer<void*> dst, const voi
       size_{size} {
 }
 
-void DownloadNode::update_dst(const GraphExec& exec, void *dst) {
-    if (dst_ != dst) {
-        throwIfError(cudaGraphExecMemcpyNodeSetParams1D(exec.get(), node_,
-                dst, src_.get(), size_, cudaMemcpyDeviceToHost));
-        dst_ = dst;
+bool DownloadNode::set_dst(void *dst) {
+    if (dst_ == dst) {
+        return false;
+    }
+    throwIfError(cudaGraphMemcpyNodeSetParams1D(node_, dst, src_.get(), size_, cudaMemcpyDefault));
+    dst_ = dst;
+    return true;
+}
+
+void DownloadNode::set_enabled(const GraphExec &graphExec, bool enabled) {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11060
+    if (enabled_ == enabled) {
+        return;
     }
+    throwIfError(cudaGraphNodeSetEnabled(graphExec.get(), node_, enabled));
+    enabled_ = enabled;
+#else
+    (void)graphExec;
+    (void)enabled;
+#endif
+}
+
+DownloadNode DownloadNode::relocate(const Graph& graph, const Relocation& relocation) const {
+    cudaGraphNode_t node;
+    throwIfError(cudaGraphNodeFindInClone(&node, node_, graph.get()));
+    const DevicePointer<const void*> src{relocation.apply(src_.get())};
+    throwIfError(cudaGraphMemcpyNodeSetParams1D(node, dst_, src.get(), size_, cudaMemcpyDefault));
+    return DownloadNode{node, dst_, src, size_};
 }
 
 DownloadNode::DownloadNode(cudaGraphNode_t node, void *dst, DevicePointer<const void*> src,
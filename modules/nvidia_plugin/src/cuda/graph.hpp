@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <optional>
+#include <vector>
 
 #include "runtime.hpp"
 
@@ -12,6 +14,28 @@ namespace CUDA {
 
 class GraphCapture;
 class CaptureInfo;
+class GraphRelocations;
+
+/**
+ * @brief Moves device pointers, which point into the memory range [from, from + size),
+ *        to the same offsets within the memory range starting at `to`
+ */
+struct Relocation {
+    const void* from;
+    const void* to;
+    std::size_t size;
+
+    const void* apply(const void* ptr) const {
+        const auto p = reinterpret_cast<std::uintptr_t>(ptr);
+        const auto begin = reinterpret_cast<std::uintptr_t>(from);
+        if (p < begin || p >= begin + size) {
+            return ptr;
+        }
+        return static_cast<const std::uint8_t*>(to) + (p - begin);
+    }
+
+    void* apply(void* ptr) const { return const_cast<void*>(apply(static_cast<const void*>(ptr))); }
+};
 
 class Graph : public Handle<cudaGraph_t> {
 public:
@@ -20,6 +44,7 @@ public:
     friend bool operator==(const Graph& lhs, const Graph& rhs);
 
     friend GraphCapture;
+    friend GraphRelocations;
 
 private:
     Graph(cudaGraph_t graph);
@@ -31,6 +56,49 @@ private:
 
 bool operator==(const Graph& rhs, const Graph& lhs);
 
+/**
+ * @brief Parameters of nodes of a captured graph, which are pointers into the memory block the graph is captured
+ *        against. They are found explicitly by comparing captures of the same work against two memory blocks, and
+ *        a copy of the graph is moved to another block by updating exactly these parameters (like I/O nodes are
+ *        updated by UploadNode::set_src() and DownloadNode::set_dst()) instead of capturing the work again
+ */
+class GraphRelocations {
+public:
+    /**
+     * @param graph Graph captured against the memory block at relocation.from
+     * @param other Graph of the same work captured against the memory block at relocation.to
+     * @param skipped Nodes of the graph, which aren't compared, e.g. I/O nodes relocated on their own
+     * @returns Parameters of the graph, which differ from the ones of the other graph exactly by the relocation,
+     *          std::nullopt if the graphs differ otherwise (e.g. by other parameters, topology or nodes which can't
+     *          be updated, like host nodes) or if parameters of kernels can't be queried (before CUDA 12.4)
+     */
+    static std::optional<GraphRelocations> find(const Graph& graph,
+                                                 const Graph& other,
+                                                 const Relocation& relocation,
+                                                 const std::vector<cudaGraphNode_t>& skipped);
+
+    /**
+     * @param graph Graph the relocations are found for
+     * @returns Copy of the graph with the found parameters moved by the relocation
+     */
+    Graph apply(const Graph& graph, const Relocation& relocation) const;
+
+private:
+    enum class Field { KernelParameter, Source, Destination };
+
+    struct Pointer {
+        // Index of the node in the order of creation, nodes of a child graph follow their parent node
+        std::size_t node;
+        Field field;
+        // Index of the kernel parameter and offset of the pointer within it
+        std::size_t parameter = 0;
+        std::size_t offset = 0;
+    };
+
+    // Pointers are ordered by their nodes
+    std::vector<Pointer> pointers_;
+};
+
 class GraphExec : public Handle<cudaGraphExec_t> {
 public:
     GraphExec(const Graph& g);
@@ -41,6 +109,12 @@ public:
     cudaGraphExecUpdateResult update(const Graph& g) const;
 #endif
 
+    /**
+     * Applies node parameters of the graph, which has the same topology as the instantiated one, in a single call.
+     * @returns false if the graph can't be updated in place, e.g. memory type of a memcpy operand is changed
+     */
+    [[nodiscard]] bool try_update(const Graph& g) const;
+
     void launch(const Stream& stream) const;
 
     friend bool operator==(const GraphExec& lhs, const GraphExec& rhs);
@@ -87,7 +161,22 @@ class UploadNode {
     friend CaptureInfo;
 
 public:
-    void update_src(const GraphExec& exec, const void* src);
+    /**
+     * Sets source pointer of the memcpy node in the captured graph.
+     * Executable graph picks the change up after GraphExec::try_update().
+     * @returns true if the pointer is changed
+     */
+    bool set_src(const void* src);
+
+    /**
+     * Moves the device pointer of the same node of the relocated graph, which isn't moved by GraphRelocations
+     * @param graph Graph which is relocated from the graph of this node by GraphRelocations::apply()
+     * @returns The same node of the relocated graph
+     */
+    UploadNode relocate(const Graph& graph, const Relocation& relocation) const;
+
+    cudaGraphNode_t get() const { return node_; }
+
     bool operator==(const UploadNode& rhs) const;
 
 private:
@@ -102,7 +191,28 @@ class DownloadNode {
     friend CaptureInfo;
 
 public:
-    void update_dst(const GraphExec& exec, void* dst);
+    /**
+     * Sets destination pointer of the memcpy node in the captured graph.
+     * Executable graph picks the change up after GraphExec::try_update().
+     * @returns true if the pointer is changed
+     */
+    bool set_dst(void* dst);
+
+    /**
+     * Enables or disables the memcpy node in the executable graph instantiated from the graph of this node,
+     * disabled node is skipped by launches. Nodes can't be disabled before CUDA 11.6, so they stay enabled
+     */
+    void set_enabled(const GraphExec& graphExec, bool enabled);
+
+    /**
+     * Moves the device pointer of the same node of the relocated graph, which isn't moved by GraphRelocations
+     * @param graph Graph which is relocated from the graph of this node by GraphRelocations::apply()
+     * @returns The same node of the relocated graph
+     */
+    DownloadNode relocate(const Graph& graph, const Relocation& relocation) const;
+
+    cudaGraphNode_t get() const { return node_; }
+
     bool operator==(const DownloadNode& rhs) const;
 
 private:
@@ -111,13 +221,46 @@ private:
     void* dst_;
     CUDA::DevicePointer<const void*> src_;
     std::size_t size_;
+    bool enabled_ = true;
+};
+
+#if CUDART_VERSION >= 12030
+class ConditionalNode {
+    friend CaptureInfo;
+
+public:
+    /**
+     * Adds a node, which executes a clone of the graph, to the body of the conditional node
+     */
+    void setBody(const Graph& graph);
+
+private:
+    ConditionalNode(cudaGraph_t body);
+    cudaGraph_t body_;
 };
+#endif
 
 class CaptureInfo {
 public:
     CaptureInfo(const Stream& capturedStream);
     UploadNode addUploadNode(CUDA::DevicePointer<void*> dst, const void* src, std::size_t size);
     DownloadNode addDownloadNode(void* dst, CUDA::DevicePointer<const void*> src, std::size_t size);
+    /**
+     * Adds a node, which executes a clone of the graph, after the work captured so far
+     */
+    void addChildGraphNode(const Graph& graph);
+#if CUDART_VERSION >= 12030
+    /**
+     * Creates a handle of a conditional node of the captured graph, which is reset to 0 by each launch
+     * and is set by kernels captured before the node or within its body with cudaGraphSetConditional()
+     */
+    cudaGraphConditionalHandle createConditionalHandle();
+    /**
+     * Adds a conditional node after the work captured so far, whose body is executed once if the handle is
+     * non-zero (cudaGraphCondTypeIf) or as long as it is non-zero (cudaGraphCondTypeWhile)
+     */
+    ConditionalNode addConditionalNode(cudaGraphConditionalHandle handle, cudaGraphConditionalNodeType type);
+#endif
 
 private:
     const Stream& stream_;
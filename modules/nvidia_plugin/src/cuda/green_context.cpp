@@ -0,0 +1,111 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "green_context.hpp"
+
+#include <fmt/format.h>
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "driver.hpp"
+
+namespace CUDA {
+
+#if CUDA_VERSION >= 12040
+
+namespace {
+
+/**
+ * SMs of the device, which aren't reserved by partitions, and partitions reserved so far
+ */
+struct DevicePartitions {
+    CUdevResource free_sms{};
+    std::map<unsigned, std::shared_ptr<GreenContext>> partitions;
+};
+
+CUdevice driverDevice(const Device device) {
+    throwIfError(cuInit(0));
+    CUdevice result{};
+    throwIfError(cuDeviceGet(&result, device.getId()));
+    return result;
+}
+
+}  // namespace
+
+GreenContext::GreenContext(const Device device, const CUdevResource& resource)
+    : device_{device}, sm_count_{resource.sm.smCount} {
+    CUdevResourceDesc desc{};
+    throwIfError(cuDevResourceGenerateDesc(&desc, const_cast<CUdevResource*>(&resource), 1));
+    throwIfError(cuGreenCtxCreate(&green_context_, desc, driverDevice(device_), CU_GREEN_CTX_DEFAULT_STREAM));
+    try {
+        throwIfError(cuCtxFromGreenCtx(&context_, green_context_));
+    } catch (...) {
+        logIfError(cuGreenCtxDestroy(green_context_));
+        throw;
+    }
+}
+
+GreenContext::~GreenContext() { logIfError(cuGreenCtxDestroy(green_context_)); }
+
+bool GreenContext::isSupported() {
+    int version = 0;
+    return cudaDriverGetVersion(&version) == cudaSuccess && version >= 12040;
+}
+
+std::shared_ptr<GreenContext> GreenContext::reserve(const Device device, const unsigned smCount) {
+    if (!isSupported()) {
+        ov::nvidia_gpu::throw_ov_exception("Partitions of SMs need CUDA driver 12.4 supporting green contexts");
+    }
+    static std::mutex mutex;
+    static std::unordered_map<int, DevicePartitions> devices;
+    std::lock_guard<std::mutex> lock{mutex};
+    auto found = devices.find(device.getId());
+    if (found == devices.end()) {
+        DevicePartitions partitions;
+        throwIfError(cuDeviceGetDevResource(driverDevice(device), &partitions.free_sms, CU_DEV_RESOURCE_TYPE_SM));
+        found = devices.emplace(device.getId(), std::move(partitions)).first;
+    }
+    auto& partitions = found->second;
+    auto& partition = partitions.partitions[smCount];
+    if (!partition) {
+        if (smCount == 0 || smCount > partitions.free_sms.sm.smCount) {
+            partitions.partitions.erase(smCount);
+            ov::nvidia_gpu::throw_ov_exception(fmt::format("Can't reserve {} SMs of device {}: {} SMs are free",
+                                                           smCount,
+                                                           device.getId(),
+                                                           partitions.free_sms.sm.smCount));
+        }
+        CUdevResource group{};
+        CUdevResource remaining{};
+        unsigned numGroups = 1;
+        throwIfError(cuDevSmResourceSplitByCount(&group, &numGroups, &partitions.free_sms, &remaining, 0, smCount));
+        partition = std::shared_ptr<GreenContext>{new GreenContext{device, group}};
+        partitions.free_sms = remaining;
+    }
+    return partition;
+}
+
+const GreenContext& GreenContext::setCurrent() const {
+    device_.setCurrent();
+    throwIfError(cuCtxSetCurrent(context_));
+    return *this;
+}
+
+#else
+
+GreenContext::~GreenContext() = default;
+
+bool GreenContext::isSupported() { return false; }
+
+std::shared_ptr<GreenContext> GreenContext::reserve(Device, unsigned) {
+    ov::nvidia_gpu::throw_ov_exception("Partitions of SMs need the plugin built with CUDA 12.4");
+}
+
+const GreenContext& GreenContext::setCurrent() const { return *this; }
+
+#endif
+
+}  // namespace CUDA
@@ -0,0 +1,63 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda.h>
+
+#include <memory>
+
+#include "runtime.hpp"
+
+namespace CUDA {
+
+/**
+ * Green context, which executes kernels of its streams only on a partition of SMs of the device (CUDA 12.4).
+ * Partitions are carved from SMs of the device, which aren't reserved by other partitions, so models executed
+ * in different partitions don't compete for SMs. Device memory is shared with the primary context
+ */
+class GreenContext {
+public:
+    GreenContext(const GreenContext&) = delete;
+    GreenContext& operator=(const GreenContext&) = delete;
+    ~GreenContext();
+
+    /**
+     * @returns true if both runtime and driver support green contexts
+     */
+    static bool isSupported();
+
+    /**
+     * Partitions live as long as the process, since SMs of a partition can't be returned to the device.
+     * Reservations of the same number of SMs share the partition
+     * @param smCount Number of SMs of the partition, it is rounded up to the granularity of the architecture
+     * @returns Partition of the device
+     * @throws ov::Exception if green contexts aren't supported or not enough SMs are left unreserved
+     */
+    static std::shared_ptr<GreenContext> reserve(Device device, unsigned smCount);
+
+    Device device() const noexcept { return device_; }
+    unsigned smCount() const noexcept { return sm_count_; }
+
+    /**
+     * Makes the context current for the calling thread, so streams, events, library handles and CUDA Graphs
+     * created by the thread execute kernels on SMs of the partition
+     */
+    const GreenContext& setCurrent() const;
+
+private:
+    Device device_;
+    unsigned sm_count_ = 0;
+#if CUDA_VERSION >= 12040
+    /**
+     * @param resource SMs of the partition
+     */
+    GreenContext(Device device, const CUdevResource& resource);
+
+    CUgreenCtx green_context_{};
+    CUcontext context_{};
+#endif
+};
+
+}  // namespace CUDA
@@ -315,6 +315,61 @@ inline __device__ __nv_bfloat16 log<__nv_bfloat16>(__nv_bfloat16 x) {
 #endif  // defined (CUDA_HAS_BF16_MATH)
 #endif  // defined (CUDA_HAS_BF16_TYPE)
 /* ================================================= */
+
+/* ====================== fast ===================== */
+/**
+ * Approximations of activations of ov::nvidia_gpu::fast_math, which are computed in float for all types.
+ * Their maximum errors are listed in README
+ */
+namespace fast {
+
+inline __device__ float expf(float x) { return ::__expf(x); }
+
+inline __device__ float logf(float x) { return ::__logf(x); }
+
+inline __device__ float tanhf(float x) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 750
+    float y;
+    asm("tanh.approx.f32 %0, %1;" : "=f"(y) : "f"(x));
+    return y;
+#else
+    // Saturates to +-1 without overflow, as __fdividef returns 0 for huge denominators
+    return 1.0f - ::__fdividef(2.0f, ::__expf(2.0f * x) + 1.0f);
+#endif
+}
+
+/**
+ * Abramowitz and Stegun 7.1.26, which absolute error is 1.5e-7
+ */
+inline __device__ float erff(float x) {
+    const float t = ::__fdividef(1.0f, 1.0f + 0.3275911f * ::fabsf(x));
+    const float poly =
+        t * (0.254829592f + t * (-0.284496736f + t * (1.421413741f + t * (-1.453152027f + t * 1.061405429f))));
+    return ::copysignf(1.0f - poly * ::__expf(-x * x), x);
+}
+
+template <typename T>
+inline __device__ T exp(T x) {
+    return static_cast<T>(expf(static_cast<float>(x)));
+}
+
+template <typename T>
+inline __device__ T log(T x) {
+    return static_cast<T>(logf(static_cast<float>(x)));
+}
+
+template <typename T>
+inline __device__ T tanh(T x) {
+    return static_cast<T>(tanhf(static_cast<float>(x)));
+}
+
+template <typename T>
+inline __device__ T erff(T x) {
+    return static_cast<T>(erff(static_cast<float>(x)));
+}
+
+}  // namespace fast
+/* ================================================= */
 #endif  // __CUDACC__
 
 }  // namespace math
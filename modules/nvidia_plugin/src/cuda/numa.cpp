@@ -0,0 +1,148 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <string>
+
+#include "runtime.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace CUDA {
+
+namespace {
+
+#ifdef __linux__
+// Policy of mbind(), which allocates pages on the given node and falls back to other nodes when it is exhausted
+constexpr int kMemoryPolicyPreferred = 1;
+
+int numNodes() {
+    int count = 0;
+    while (std::ifstream{fmt::format("/sys/devices/system/node/node{}/cpulist", count)}) {
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * @param cpuList List of CPUs in the format of sysfs, e.g. "0-15,32-47"
+ */
+cpu_set_t parseCpuList(const std::string& cpuList) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    std::size_t pos = 0;
+    while (pos < cpuList.size()) {
+        const auto end = std::min(cpuList.find(',', pos), cpuList.size());
+        const auto range = cpuList.substr(pos, end - pos);
+        const auto dash = range.find('-');
+        try {
+            const auto first = std::stoi(range.substr(0, dash));
+            const auto last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+                CPU_SET(cpu, &cpus);
+            }
+        } catch (const std::exception&) {
+            // Malformed range is skipped
+        }
+        pos = end + 1;
+    }
+    return cpus;
+}
+
+thread_local int boundNode = -1;
+#endif
+
+}  // namespace
+
+NumaNode NumaNode::of(const Device& device) {
+#ifdef __linux__
+    if (numNodes() <= 1) {
+        return {};
+    }
+    char busId[32]{};
+    if (cudaDeviceGetPCIBusId(busId, sizeof(busId), device.getId()) != cudaSuccess) {
+        return {};
+    }
+    // Bus id is reported by CUDA in upper case, e.g. "0000:3B:00.0", and is listed by sysfs in lower case
+    std::string path = busId;
+    std::transform(path.begin(), path.end(), path.begin(), [](unsigned char c) { return std::tolower(c); });
+    std::ifstream file{fmt::format("/sys/bus/pci/devices/{}/numa_node", path)};
+    int node = -1;
+    if (!(file >> node)) {
+        return {};
+    }
+    return NumaNode{node};
+#else
+    return {};
+#endif
+}
+
+bool NumaNode::bindCurrentThread() const {
+#ifdef __linux__
+    if (!isKnown()) {
+        return false;
+    }
+    if (boundNode == id_) {
+        return true;
+    }
+    std::ifstream file{fmt::format("/sys/devices/system/node/node{}/cpulist", id_)};
+    std::string cpuList;
+    if (!std::getline(file, cpuList)) {
+        return false;
+    }
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return false;
+    }
+    auto cpus = parseCpuList(cpuList);
+    CPU_AND(&cpus, &cpus, &allowed);
+    if (CPU_COUNT(&cpus) == 0 || sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+        return false;
+    }
+    boundNode = id_;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void* NumaNode::allocate(const std::size_t bytes) const {
+#ifdef __linux__
+    if (!isKnown() || bytes == 0 || id_ >= static_cast<int>(sizeof(unsigned long) * 8)) {
+        return nullptr;
+    }
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        return nullptr;
+    }
+    // Pages aren't populated yet, so they are placed on the node when they are touched or pinned
+    // The last bit of the mask is ignored by mbind(), so the number of nodes is one more than the mask has
+    const unsigned long nodeMask = 1UL << id_;
+    syscall(SYS_mbind, p, bytes, kMemoryPolicyPreferred, &nodeMask, sizeof(nodeMask) * 8 + 1, 0);
+    return p;
+#else
+    return nullptr;
+#endif
+}
+
+void NumaNode::free(void* p, const std::size_t bytes) noexcept {
+#ifdef __linux__
+    if (p != nullptr) {
+        munmap(p, bytes);
+    }
+#endif
+}
+
+}  // namespace CUDA
@@ -0,0 +1,51 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace CUDA {
+
+class Device;
+
+/**
+ * NUMA node of the host, which host threads and host memory are placed on, so transfers between host memory and
+ * the device don't cross the interconnect of sockets. Placement is supported on Linux only, elsewhere and on hosts
+ * with a single node the node is unknown and nothing is placed
+ */
+class NumaNode {
+public:
+    NumaNode() = default;
+    explicit NumaNode(int id) noexcept : id_{id} {}
+
+    /**
+     * @returns Node of the PCIe root complex the device is attached to, which is read from sysfs by the PCI bus id
+     *          of the device, or unknown node
+     */
+    static NumaNode of(const Device& device);
+
+    bool isKnown() const noexcept { return id_ >= 0; }
+    int id() const noexcept { return id_; }
+
+    /**
+     * Binds the calling thread to CPUs of the node, which are allowed for the process. The thread is bound once,
+     * binding to the node it is bound to already does nothing
+     * @returns false if the node is unknown or none of its CPUs are allowed
+     */
+    bool bindCurrentThread() const;
+
+    /**
+     * @returns Page-aligned host memory, which pages are preferably placed on the node, or nullptr if the node is
+     *          unknown or the memory isn't allocated. The memory is freed by free()
+     */
+    void* allocate(std::size_t bytes) const;
+
+    static void free(void* p, std::size_t bytes) noexcept;
+
+private:
+    int id_ = -1;
+};
+
+}  // namespace CUDA
@@ -0,0 +1,70 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nvrtc.hpp"
+
+#include <fmt/format.h>
+
+#include <iterator>
+#include <memory>
+#include <openvino/core/except.hpp>
+#include <vector>
+
+namespace CUDA {
+
+namespace {
+
+int virtualArchitecture(const Device& device) {
+    const auto props = device.props();
+    const int deviceArch = props.major * 10 + props.minor;
+#if CUDA_VERSION >= 11020
+    int numArchs = 0;
+    throwIfError(nvrtcGetNumSupportedArchs(&numArchs));
+    std::vector<int> archs(numArchs);
+    throwIfError(nvrtcGetSupportedArchs(archs.data()));
+    // PTX of an older architecture is compiled by the driver for newer devices, which NVRTC doesn't know yet
+    int arch = 0;
+    for (const auto supported : archs) {
+        if (supported <= deviceArch && supported > arch) {
+            arch = supported;
+        }
+    }
+    OPENVINO_ASSERT(arch != 0, "NVRTC doesn't support architecture ", deviceArch);
+    return arch;
+#else
+    return deviceArch;
+#endif
+}
+
+}  // namespace
+
+std::string compileToPtx(const std::string& source, const std::string& name, const Device& device) {
+    nvrtcProgram program = nullptr;
+    throwIfError(nvrtcCreateProgram(&program, source.c_str(), name.c_str(), 0, nullptr, nullptr));
+    const auto destroy = [](nvrtcProgram* program) { nvrtcDestroyProgram(program); };
+    std::unique_ptr<nvrtcProgram, decltype(destroy)> programGuard{&program, destroy};
+
+    const auto archOption = fmt::format("--gpu-architecture=compute_{}", virtualArchitecture(device));
+    const char* options[] = {archOption.c_str(), "--std=c++14"};
+    const auto result = nvrtcCompileProgram(program, std::size(options), options);
+    if (result != NVRTC_SUCCESS) {
+        size_t logSize = 0;
+        throwIfError(nvrtcGetProgramLogSize(program, &logSize));
+        std::string log(logSize, '\0');
+        throwIfError(nvrtcGetProgramLog(program, log.data()));
+        ov::nvidia_gpu::throw_ov_exception(
+            fmt::format("Failed to compile {}: {}\n{}", name, nvrtcGetErrorString(result), log));
+    }
+    size_t ptxSize = 0;
+    throwIfError(nvrtcGetPTXSize(program, &ptxSize));
+    std::string ptx(ptxSize, '\0');
+    throwIfError(nvrtcGetPTX(program, ptx.data()));
+    // The size includes the terminating null character
+    if (!ptx.empty() && ptx.back() == '\0') {
+        ptx.pop_back();
+    }
+    return ptx;
+}
+
+}  // namespace CUDA
@@ -0,0 +1,49 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <nvrtc.h>
+
+#include <string>
+
+#include "driver.hpp"
+#include "runtime.hpp"
+
+inline void throwIfError(
+    nvrtcResult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != NVRTC_SUCCESS) ov::nvidia_gpu::throw_ov_exception(nvrtcGetErrorString(err), location);
+}
+
+namespace CUDA {
+
+/**
+ * Compiles CUDA source of kernels into PTX of the newest virtual architecture supported by both NVRTC and the
+ * device, so that the driver compiles it for the device when it is loaded
+ * @param source CUDA source, which doesn't include any headers
+ * @param name Name of the source used in compilation messages
+ * @throws ov::Exception with the compilation log if the source isn't compiled
+ */
+std::string compileToPtx(const std::string& source, const std::string& name, const Device& device);
+
+/**
+ * Module of kernels loaded from PTX into the current context
+ */
+class Module : public Handle<CUmodule> {
+public:
+    explicit Module(const std::string& ptx)
+        : Handle((cuModuleLoadData), cuModuleUnload, static_cast<const void*>(ptx.c_str())) {}
+    CUfunction function(const char* name) const { return createFirstArg(cuModuleGetFunction, get(), name); }
+};
+
+inline void launchKernel(CUfunction function,
+                         unsigned numBlocks,
+                         unsigned threadsPerBlock,
+                         const Stream& stream,
+                         void** args) {
+    throwIfError(cuLaunchKernel(function, numBlocks, 1, 1, threadsPerBlock, 1, 1, 0, stream.get(), args, nullptr));
+}
+
+}  // namespace CUDA
@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <nvtx3/nvToolsExt.h>
+
+#include <string>
+
+namespace CUDA {
+
+/**
+ * Range of Nsight Systems timelines in the domain of the plugin, which is pushed by the constructor and popped
+ * by the destructor on the same thread. Ranges cost nothing but a call into an empty stub unless a tool is attached
+ */
+class NvtxRange {
+public:
+    explicit NvtxRange(const std::string& message) {
+        nvtxEventAttributes_t attributes{};
+        attributes.version = NVTX_VERSION;
+        attributes.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+        attributes.messageType = NVTX_MESSAGE_TYPE_ASCII;
+        attributes.message.ascii = message.c_str();
+        nvtxDomainRangePushEx(domain(), &attributes);
+    }
+    ~NvtxRange() { nvtxDomainRangePop(domain()); }
+    NvtxRange(const NvtxRange&) = delete;
+    NvtxRange& operator=(const NvtxRange&) = delete;
+
+private:
+    static nvtxDomainHandle_t domain() {
+        static const nvtxDomainHandle_t domain = nvtxDomainCreateA("OpenVINO NVIDIA");
+        return domain;
+    }
+};
+
+}  // namespace CUDA
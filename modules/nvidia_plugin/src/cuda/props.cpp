@@ -25,11 +25,15 @@ std::unordered_map<std::string, size_t> cudaConcurrentKernels = {
     {"7.5", 128},
     {"8.0", 128},
     {"8.6", 128},
+    {"8.9", 128},
+    {"9.0", 128},
 };
 
 // NOTE: This list created based on data from the following table:
 //       https://docs.nvidia.com/deeplearning/tensorrt/support-matrix/index.html#hardware-precision-matrix
 std::unordered_set<std::string> fp16SupportedArchitecture = {
+    "9.0",
+    "8.9",
     "8.6",
     "8.0",
     "7.5",
@@ -43,6 +47,8 @@ std::unordered_set<std::string> fp16SupportedArchitecture = {
 // NOTE: This list created based on data from the following table:
 //       https://docs.nvidia.com/deeplearning/tensorrt/support-matrix/index.html#hardware-precision-matrix
 std::unordered_set<std::string> int8SupportedArchitecture = {
+    "9.0",
+    "8.9",
     "8.6",
     "8.0",
     "7.5",
@@ -51,4 +57,10 @@ std::unordered_set<std::string> int8SupportedArchitecture = {
     "6.1",
 };
 
+// NOTE: FP8 tensor cores are present since Ada Lovelace and Hopper
+std::unordered_set<std::string> fp8SupportedArchitecture = {
+    "9.0",
+    "8.9",
+};
+
 }  // namespace CUDA
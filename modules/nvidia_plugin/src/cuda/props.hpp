@@ -13,5 +13,6 @@ namespace CUDA {
 extern std::unordered_map<std::string, size_t> cudaConcurrentKernels;
 extern std::unordered_set<std::string> fp16SupportedArchitecture;
 extern std::unordered_set<std::string> int8SupportedArchitecture;
+extern std::unordered_set<std::string> fp8SupportedArchitecture;
 
 }  // namespace CUDA
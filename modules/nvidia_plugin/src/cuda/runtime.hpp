@@ -6,11 +6,20 @@
 
 #include <cuda_runtime_api.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cuda/device_pointers.hpp>
 #include <error.hpp>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
+#include "numa.hpp"
 #include "props.hpp"
 
 inline void throwIfError(
@@ -67,14 +76,87 @@ public:
     explicit Device(int id) noexcept : id{id} {}
     static int currentId() { return createFirstArg(cudaGetDevice); }
     static int count() { return createFirstArg(cudaGetDeviceCount); }
+    int getId() const noexcept { return id; }
     cudaDeviceProp props() const { return createFirstArg(cudaGetDeviceProperties, id); }
+    /**
+     * @returns Size of blocks keeping the most threads resident on a multiprocessor, the largest one of sizes with
+     *          the same occupancy. It is the size cudaOccupancyMaxPotentialBlockSize suggests for kernels which
+     *          aren't limited by registers or shared memory (e.g. element-wise kernels)
+     */
+    unsigned occupancyBlockSize() const {
+        const auto p = props();
+        const unsigned warp = std::max(p.warpSize, 1);
+        unsigned best = warp;
+        unsigned bestResident = 0;
+        for (unsigned size = warp; size <= static_cast<unsigned>(p.maxThreadsPerBlock); size += warp) {
+            const auto blocks = std::min<unsigned>(p.maxThreadsPerMultiProcessor / size, p.maxBlocksPerMultiProcessor);
+            if (blocks * size >= bestResident) {
+                best = size;
+                bestResident = blocks * size;
+            }
+        }
+        return best;
+    }
+    /**
+     * @returns true if the device is an instance of a GPU partitioned by MIG, whose name has the profile of
+     *          the instance (e.g. "NVIDIA A100-SXM4-40GB MIG 1g.5gb"). SMs and memory reported for it are those of
+     *          the instance
+     */
+    bool isMigInstance() const { return std::string{props().name}.find(" MIG ") != std::string::npos; }
+    /**
+     * @returns UUID of the device as listed by nvidia-smi -L, i.e. GPU-xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx or
+     *          MIG-xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx of a MIG instance
+     */
+    std::string uuid() const {
+        const auto p = props();
+        std::string result = isMigInstance() ? "MIG" : "GPU";
+        for (std::size_t i = 0; i < sizeof(p.uuid.bytes); ++i) {
+            if (i == 0 || i == 4 || i == 6 || i == 8 || i == 10) {
+                result += '-';
+            }
+            char hex[3];
+            std::snprintf(hex, sizeof(hex), "%02x", static_cast<unsigned char>(p.uuid.bytes[i]));
+            result += hex;
+        }
+        return result;
+    }
     const Device& setCurrent() const {
         throwIfError(cudaSetDevice(id));
         return *this;
     }
     void synchronize() { throwIfError(::cudaDeviceSynchronize()); }
+    bool canAccessPeer(const Device& peer) const {
+        return id == peer.id || createFirstArg(cudaDeviceCanAccessPeer, id, peer.id) != 0;
+    }
+    /**
+     * Enables direct access of kernels and copies of this device to memory of the peer device
+     */
+    void enablePeerAccess(const Device& peer) const;
+};
+
+/**
+ * Makes the device current for the calling thread and restores the previous current device when it goes out of scope
+ */
+class CurrentDeviceScope {
+public:
+    explicit CurrentDeviceScope(const Device& device) : previous_{Device::currentId()} { device.setCurrent(); }
+    CurrentDeviceScope(const CurrentDeviceScope&) = delete;
+    CurrentDeviceScope& operator=(const CurrentDeviceScope&) = delete;
+    ~CurrentDeviceScope() { logIfError(cudaSetDevice(previous_)); }
+
+private:
+    int previous_;
 };
 
+/**
+ * @returns Memory type of the pointer, cudaMemoryTypeUnregistered for pageable host memory
+ */
+inline cudaMemoryType memoryType(const void* p) {
+    cudaPointerAttributes attributes{};
+    throwIfError(cudaPointerGetAttributes(&attributes, p));
+    return attributes.type;
+}
+
 constexpr auto memoryAlignment = 256;
 constexpr auto defaultResidentGrids = 16;
 
@@ -116,11 +198,15 @@ inline int residentGrids(const cudaDeviceProp& p) {
     return defaultResidentGrids;
 }
 
+/**
+ * Each concurrent kernel takes at least one SM, so a MIG instance (e.g. 1g.5gb of 14 SMs) runs fewer streams
+ * than the whole GPU of its architecture
+ */
 inline int max_concurrent_streams(CUDA::Device d) {
     auto p = d.props();
     int r = p.asyncEngineCount;
     if (!p.concurrentKernels) return r + 1;
-    return r + residentGrids(p);
+    return r + std::min(residentGrids(p), p.multiProcessorCount);
 }
 
 inline bool isHalfSupported(CUDA::Device d) {
@@ -128,11 +214,39 @@ inline bool isHalfSupported(CUDA::Device d) {
     return fp16SupportedArchitecture.count(computeCompatabilityVersion) > 0;
 }
 
+/**
+ * BF16 tensor cores, which have the range of FP32, are present since Ampere
+ */
+inline bool isBf16Supported(CUDA::Device d) { return d.props().major >= 8; }
+
 inline bool isInt8Supported(CUDA::Device d) {
     const auto computeCompatabilityVersion = std::to_string(d.props().major) + "." + std::to_string(d.props().minor);
     return int8SupportedArchitecture.count(computeCompatabilityVersion) > 0;
 }
 
+inline bool isFp8Supported(CUDA::Device d) {
+    const auto computeCompatabilityVersion = std::to_string(d.props().major) + "." + std::to_string(d.props().minor);
+    return fp8SupportedArchitecture.count(computeCompatabilityVersion) > 0;
+}
+
+/**
+ * Sparse tensor cores executing 2:4 structured sparse matrices are present since Ampere
+ */
+inline bool isSparseSupported(CUDA::Device d) { return d.props().major >= 8; }
+
+/**
+ * Conditional graph nodes, whose bodies are executed depending on a value set by kernels, need CUDA 12.3 runtime
+ * and driver
+ */
+inline bool isConditionalNodeSupported() {
+#if CUDART_VERSION >= 12030
+    int version = 0;
+    return cudaDriverGetVersion(&version) == cudaSuccess && version >= 12030;
+#else
+    return false;
+#endif
+}
+
 template <typename T>
 class Handle {
 public:
@@ -193,6 +307,8 @@ class DefaultAllocation {
 
 public:
     explicit DefaultAllocation(void* p) noexcept : p{p, Deleter{}} {}
+    template <typename CustomDeleter>
+    DefaultAllocation(void* p, CustomDeleter deleter) : p{p, std::move(deleter)} {}
     void* get() const noexcept { return p.get(); }
     template <typename T, typename std::enable_if<std::is_void<T>::value>::type* = nullptr>
     operator DevicePointer<T*>() const noexcept {
@@ -228,9 +344,68 @@ public:
     }
 };
 
+/**
+ * @brief Allocator of page-locked host memory compatible with ov::Allocator.
+ *
+ * Transfers from/to page-locked memory are performed by DMA engine directly
+ * and are truly asynchronous with respect to the host, while transfers from
+ * pageable memory are staged through driver's internal bounce buffer.
+ * Memory is placed on the NUMA node of the device, if it is known.
+ */
+class PinnedHostAllocator {
+public:
+    PinnedHostAllocator() = default;
+    explicit PinnedHostAllocator(NumaNode node) noexcept : node_{node} {}
+
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) const {
+        if (bytes == 0) {
+            return nullptr;
+        }
+        void* p = nullptr;
+        if (node_.isKnown()) {
+            p = node_.allocate(bytes);
+            if (p == nullptr) {
+                throwIfError(cudaErrorMemoryAllocation);
+            }
+            const auto status = cudaHostRegister(p, bytes, cudaHostRegisterPortable);
+            if (status != cudaSuccess) {
+                NumaNode::free(p, bytes);
+                throwIfError(status);
+            }
+            return p;
+        }
+        throwIfError(cudaHostAlloc(&p, bytes, cudaHostAllocPortable));
+        return p;
+    }
+    void deallocate(void* p, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) const noexcept {
+        if (p == nullptr) {
+            return;
+        }
+        if (node_.isKnown()) {
+            logIfError(cudaHostUnregister(p));
+            NumaNode::free(p, bytes);
+            return;
+        }
+        logIfError(cudaFreeHost(p));
+    }
+    bool is_equal(const PinnedHostAllocator& other) const noexcept { return node_.id() == other.node_.id(); }
+
+private:
+    NumaNode node_;
+};
+
 class Stream : public Handle<cudaStream_t> {
 public:
     Stream() : Handle((cudaStreamCreate), cudaStreamDestroy) {}
+    /**
+     * @param priority Priority of the stream, lower numbers are higher priorities
+     *                 (see cudaDeviceGetStreamPriorityRange)
+     */
+    explicit Stream(int priority)
+        : Handle((cudaStreamCreateWithPriority),
+                 cudaStreamDestroy,
+                 static_cast<unsigned int>(cudaStreamDefault),
+                 priority) {}
 
     Allocation malloc(std::size_t size) const { return {mallocImpl(size), *this}; }
     void upload(CUDA::DevicePointer<void*> dst, const void* src, std::size_t count) const {
@@ -239,6 +414,13 @@ public:
     void transfer(CUDA::DevicePointer<void*> dst, CUDA::DevicePointer<const void*> src, std::size_t count) const {
         throwIfError(cudaMemcpyAsync(dst.get(), src.get(), count, cudaMemcpyDeviceToDevice, get()));
     }
+    /**
+     * Copies memory without assumptions of its location, uses unified virtual addressing to deduce the direction.
+     * Suitable when a pointer may refer either to host or device memory, e.g. user tensors of an infer request
+     */
+    void copy(void* dst, const void* src, std::size_t count) const {
+        throwIfError(cudaMemcpyAsync(dst, src, count, cudaMemcpyDefault, get()));
+    }
     void upload(const Allocation& dst, const void* src, std::size_t count) const { uploadImpl(dst.get(), src, count); }
     void download(void* dst, const Allocation& src, std::size_t count) const { downloadImpl(dst, src.get(), count); }
     void download(void* dst, CUDA::DevicePointer<const void*> src, std::size_t count) const {
@@ -284,6 +466,147 @@ private:
     }
 };
 
+/**
+ * @brief Stream-ordered memory pool of the device shared by all compiled models of the device.
+ *
+ * Memory freed to the pool is kept by it up to the release threshold and is reused by next allocations
+ * without synchronizing cudaMalloc/cudaFree calls, so that compiling and destroying models doesn't fragment
+ * device memory. While the pool is registered for its device, DefaultStream allocations are served by it.
+ *
+ * Memory is allocated and freed in a non-blocking stream of the pool, so neither of them waits for work of other
+ * streams of the device. Owners of the memory complete work using it before they free it (e.g. DeviceMemBlock
+ * waits for the inference which released it last), the same as they would before cudaFree.
+ */
+class DeviceMemoryPool : public std::enable_shared_from_this<DeviceMemoryPool> {
+public:
+    /**
+     * @param device Device of the pool
+     * @param releaseThreshold Number of bytes of freed memory the pool keeps instead of releasing it to the system
+     */
+    DeviceMemoryPool(int device, std::uint64_t releaseThreshold) : device_{device} {
+#if CUDART_VERSION >= 11020
+        cudaMemPoolProps props{};
+        props.allocType = cudaMemAllocationTypePinned;
+        props.location.type = cudaMemLocationTypeDevice;
+        props.location.id = device;
+        throwIfError(cudaMemPoolCreate(&pool_, &props));
+        try {
+            setReleaseThreshold(releaseThreshold);
+            CurrentDeviceScope deviceScope{Device{device}};
+            throwIfError(cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking));
+        } catch (...) {
+            logIfError(cudaMemPoolDestroy(pool_));
+            throw;
+        }
+#endif
+    }
+    DeviceMemoryPool(const DeviceMemoryPool&) = delete;
+    DeviceMemoryPool& operator=(const DeviceMemoryPool&) = delete;
+    ~DeviceMemoryPool() {
+#if CUDART_VERSION >= 11020
+        // Only frees of the pool are waited for, allocations of the pool have been freed already
+        logIfError(cudaStreamSynchronize(stream_));
+        logIfError(cudaStreamDestroy(stream_));
+        logIfError(cudaMemPoolDestroy(pool_));
+#endif
+    }
+
+    /**
+     * Makes the pool serve allocations of its device, the registry doesn't prolong lifetime of the pool
+     */
+    static void registerPool(const std::shared_ptr<DeviceMemoryPool>& pool) {
+        std::lock_guard<std::mutex> lock{registryMutex()};
+        registry()[pool->device_] = pool;
+    }
+
+    /**
+     * @returns Pool registered for the device or nullptr
+     */
+    static std::shared_ptr<DeviceMemoryPool> registered(int device) {
+        std::lock_guard<std::mutex> lock{registryMutex()};
+        auto it = registry().find(device);
+        return it != registry().end() ? it->second.lock() : nullptr;
+    }
+
+    void setReleaseThreshold(std::uint64_t releaseThreshold) {
+#if CUDART_VERSION >= 11020
+        throwIfError(cudaMemPoolSetAttribute(pool_, cudaMemPoolAttrReleaseThreshold, &releaseThreshold));
+#endif
+    }
+
+    /**
+     * Allows the peer device to access memory allocated from the pool
+     */
+    void enableAccess(int peerDevice) {
+#if CUDART_VERSION >= 11020
+        cudaMemAccessDesc desc{};
+        desc.location.type = cudaMemLocationTypeDevice;
+        desc.location.id = peerDevice;
+        desc.flags = cudaMemAccessFlagsProtReadWrite;
+        throwIfError(cudaMemPoolSetAccess(pool_, &desc, 1));
+#endif
+    }
+
+    /**
+     * Allocates memory of the device of the pool, which is usable by any stream once the call returns.
+     * The allocation is waited for in the stream of the pool only, which isn't ordered with other streams
+     */
+    DefaultAllocation malloc(std::size_t size) {
+#if CUDART_VERSION >= 11020
+        void* p = nullptr;
+        throwIfError(cudaMallocFromPoolAsync(&p, size, pool_, stream_));
+        const auto status = cudaStreamSynchronize(stream_);
+        if (status != cudaSuccess) {
+            logIfError(cudaFreeAsync(p, stream_));
+            throwIfError(status);
+        }
+        return DefaultAllocation{p, [pool = shared_from_this()](void* ptr) { pool->free(ptr); }};
+#else
+        return DefaultAllocation{createFirstArg<void*, cudaError_t>(cudaMalloc, size)};
+#endif
+    }
+
+private:
+#if CUDART_VERSION >= 11020
+    void free(void* ptr) const noexcept { logIfError(cudaFreeAsync(ptr, stream_)); }
+#endif
+
+    static std::mutex& registryMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+    static std::unordered_map<int, std::weak_ptr<DeviceMemoryPool>>& registry() {
+        static std::unordered_map<int, std::weak_ptr<DeviceMemoryPool>> pools;
+        return pools;
+    }
+
+    int device_;
+#if CUDART_VERSION >= 11020
+    cudaMemPool_t pool_{};
+    cudaStream_t stream_{};
+#endif
+};
+
+inline void Device::enablePeerAccess(const Device& peer) const {
+    if (id == peer.id) {
+        return;
+    }
+    if (auto pool = DeviceMemoryPool::registered(peer.id)) {
+        // Memory of the plugin pool isn't covered by peer access of the device
+        pool->enableAccess(id);
+    }
+    const auto status = [&] {
+        CurrentDeviceScope scope{*this};
+        return cudaDeviceEnablePeerAccess(peer.id, 0);
+    }();
+    if (status == cudaErrorPeerAccessAlreadyEnabled) {
+        // Access is enabled for the whole process, e.g. by another compiled model, the error is cleared
+        cudaGetLastError();
+        return;
+    }
+    throwIfError(status);
+}
+
 class DefaultStream {
     void uploadImpl(void* dst, const void* src, std::size_t count) const {
         throwIfError(cudaMemcpy(dst, src, count, cudaMemcpyHostToDevice));
@@ -300,7 +623,10 @@ public:
         return stream;
     }
 
-    auto malloc(std::size_t size) const {
+    DefaultAllocation malloc(std::size_t size) const {
+        if (auto pool = DeviceMemoryPool::registered(Device::currentId())) {
+            return pool->malloc(size);
+        }
         return DefaultAllocation{createFirstArg<void*, cudaError_t>(cudaMalloc, size)};
     }
     void upload(DevicePointer<void*> dst, const void* src, std::size_t count) const {
@@ -309,6 +635,9 @@ public:
     void upload(const DefaultAllocation& dst, const void* src, std::size_t count) const {
         uploadImpl(dst.get(), src, count);
     }
+    void transfer(DevicePointer<void*> dst, DevicePointer<const void*> src, std::size_t count) const {
+        throwIfError(cudaMemcpy(dst.get(), src.get(), count, cudaMemcpyDeviceToDevice));
+    }
     void download(void* dst, const DefaultAllocation& src, std::size_t count) const {
         downloadImpl(dst, src.get(), count);
     }
@@ -0,0 +1,150 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_CUSPARSELT
+
+#include "sparse_lt.hpp"
+
+#include <fmt/format.h>
+
+#include <error.hpp>
+
+namespace {
+
+std::string cusparseLtGetErrorString(cusparseStatus_t status) {
+    switch (status) {
+        case CUSPARSE_STATUS_NOT_INITIALIZED:
+            return "cuSPARSELt Status Not Initialized";
+        case CUSPARSE_STATUS_ALLOC_FAILED:
+            return "cuSPARSELt Status Allocation Failed";
+        case CUSPARSE_STATUS_INVALID_VALUE:
+            return "cuSPARSELt Status Invalid Value";
+        case CUSPARSE_STATUS_ARCH_MISMATCH:
+            return "cuSPARSELt Status Architecture Mismatched";
+        case CUSPARSE_STATUS_EXECUTION_FAILED:
+            return "cuSPARSELt Status Execution Failed";
+        case CUSPARSE_STATUS_INTERNAL_ERROR:
+            return "cuSPARSELt Status Internal Error";
+        case CUSPARSE_STATUS_NOT_SUPPORTED:
+            return "cuSPARSELt Status Not Supported";
+        default:
+            return fmt::format("cuSPARSELt Status {}", static_cast<int>(status));
+    }
+}
+
+void throwIfError(
+    cusparseStatus_t err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUSPARSE_STATUS_SUCCESS) ov::nvidia_gpu::throw_ov_exception(cusparseLtGetErrorString(err), location);
+}
+
+void logIfError(
+    cusparseStatus_t err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUSPARSE_STATUS_SUCCESS) ov::nvidia_gpu::logError(cusparseLtGetErrorString(err), location);
+}
+
+// Products of f16 matrices are accumulated in FP32
+#if CUSPARSELT_VERSION >= 500
+constexpr cusparseComputeType kComputeType = CUSPARSE_COMPUTE_32F;
+#else
+constexpr cusparseComputeType kComputeType = CUSPARSE_COMPUTE_16F;
+#endif
+
+constexpr uint32_t kAlignment = 16;
+constexpr float kOne = 1.0f;
+
+}  // namespace
+
+namespace CUDA {
+
+/**
+ * cuSPARSELt objects are opaque structures, which are initialized in place and can't be moved
+ */
+struct SparseLtMatmul::Descriptors {
+    cusparseLtHandle_t handle{};
+    cusparseLtMatDescriptor_t weights{};
+    cusparseLtMatDescriptor_t x{};
+    cusparseLtMatDescriptor_t d{};
+    cusparseLtMatmulDescriptor_t matmul{};
+    cusparseLtMatmulAlgSelection_t selection{};
+    cusparseLtMatmulPlan_t plan{};
+    bool has_handle = false;
+    int num_matrices = 0;
+    bool has_plan = false;
+
+    ~Descriptors() {
+        if (has_plan) {
+            logIfError(cusparseLtMatmulPlanDestroy(&plan));
+        }
+        cusparseLtMatDescriptor_t* matrices[] = {&weights, &x, &d};
+        for (int i = 0; i < num_matrices; ++i) {
+            logIfError(cusparseLtMatDescriptorDestroy(matrices[i]));
+        }
+        if (has_handle) {
+            logIfError(cusparseLtDestroy(&handle));
+        }
+    }
+};
+
+SparseLtMatmul::SparseLtMatmul(cudaDataType_t type, size_t m, size_t k, size_t n)
+    : descriptors_{std::make_unique<Descriptors>()} {
+    auto& ds = *descriptors_;
+    throwIfError(cusparseLtInit(&ds.handle));
+    ds.has_handle = true;
+    throwIfError(cusparseLtStructuredDescriptorInit(
+        &ds.handle, &ds.weights, k, n, k, kAlignment, type, CUSPARSE_ORDER_COL, CUSPARSELT_SPARSITY_50_PERCENT));
+    ++ds.num_matrices;
+    throwIfError(cusparseLtDenseDescriptorInit(&ds.handle, &ds.x, k, m, k, kAlignment, type, CUSPARSE_ORDER_COL));
+    ++ds.num_matrices;
+    throwIfError(cusparseLtDenseDescriptorInit(&ds.handle, &ds.d, n, m, n, kAlignment, type, CUSPARSE_ORDER_COL));
+    ++ds.num_matrices;
+    // C and D share the descriptor, since they have the same layout
+    throwIfError(cusparseLtMatmulDescriptorInit(&ds.handle,
+                                                &ds.matmul,
+                                                CUSPARSE_OPERATION_TRANSPOSE,
+                                                CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                &ds.weights,
+                                                &ds.x,
+                                                &ds.d,
+                                                &ds.d,
+                                                kComputeType));
+    throwIfError(
+        cusparseLtMatmulAlgSelectionInit(&ds.handle, &ds.selection, &ds.matmul, CUSPARSELT_MATMUL_ALG_DEFAULT));
+    throwIfError(cusparseLtMatmulPlanInit(&ds.handle, &ds.plan, &ds.matmul, &ds.selection));
+    ds.has_plan = true;
+    throwIfError(cusparseLtMatmulGetWorkspace(&ds.handle, &ds.plan, &workspace_size_));
+    throwIfError(cusparseLtSpMMACompressedSize(&ds.handle, &ds.plan, &compressed_size_, &compress_buffer_size_));
+}
+
+SparseLtMatmul::~SparseLtMatmul() = default;
+
+void SparseLtMatmul::compress(cudaStream_t stream, const void* weights, void* compressed, void* buffer) const {
+    throwIfError(
+        cusparseLtSpMMACompress(&descriptors_->handle, &descriptors_->plan, weights, compressed, buffer, stream));
+}
+
+void SparseLtMatmul::operator()(cudaStream_t stream,
+                                const void* compressed,
+                                const void* x,
+                                const float beta,
+                                const void* c,
+                                void* d,
+                                void* workspace) const {
+    throwIfError(cusparseLtMatmul(&descriptors_->handle,
+                                  &descriptors_->plan,
+                                  &kOne,
+                                  compressed,
+                                  x,
+                                  &beta,
+                                  c,
+                                  d,
+                                  workspace,
+                                  &stream,
+                                  1));
+}
+
+}  // namespace CUDA
+
+#endif  // ENABLE_CUSPARSELT
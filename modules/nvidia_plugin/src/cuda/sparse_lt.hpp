@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#ifdef ENABLE_CUSPARSELT
+
+#include <cusparseLt.h>
+
+#include <memory>
+
+#include "runtime.hpp"
+
+namespace CUDA {
+
+/**
+ * Multiplication D = op(W) x X + beta * C of column-major matrices by cuSPARSELt (built with -DENABLE_CUSPARSELT=ON),
+ * where W [K, N] is pruned to 2:4 structured sparsity along K and transposed, X is [K, M] and C, D are [N, M].
+ * W is compressed once for sparse tensor cores and then multiplied by any number of matrices X
+ */
+class SparseLtMatmul {
+public:
+    SparseLtMatmul(cudaDataType_t type, size_t m, size_t k, size_t n);
+    ~SparseLtMatmul();
+    SparseLtMatmul(const SparseLtMatmul&) = delete;
+    SparseLtMatmul& operator=(const SparseLtMatmul&) = delete;
+
+    size_t workspaceSize() const noexcept { return workspace_size_; }
+    size_t compressedSize() const noexcept { return compressed_size_; }
+    /**
+     * Size of the temporary buffer required by compress()
+     */
+    size_t compressBufferSize() const noexcept { return compress_buffer_size_; }
+
+    /**
+     * Compresses dense weights W, which should be pruned to 2:4 sparsity, into compressedSize() bytes
+     */
+    void compress(cudaStream_t stream, const void* weights, void* compressed, void* buffer) const;
+
+    void operator()(cudaStream_t stream,
+                    const void* compressed,
+                    const void* x,
+                    float beta,
+                    const void* c,
+                    void* d,
+                    void* workspace) const;
+
+private:
+    struct Descriptors;
+    std::unique_ptr<Descriptors> descriptors_;
+    size_t workspace_size_ = 0;
+    size_t compressed_size_ = 0;
+    size_t compress_buffer_size_ = 0;
+};
+
+}  // namespace CUDA
+
+#endif  // ENABLE_CUSPARSELT
@@ -0,0 +1,268 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cuda/float16.hpp>
+#include <type_traits>
+
+namespace CUDA {
+namespace algorithms {
+
+/**
+ * Maps values to unsigned keys, which are ordered as the values
+ */
+template <typename T>
+struct OrderedKey {
+    using type = std::make_unsigned_t<T>;
+    __device__ static type get(T value) {
+        constexpr type sign = std::is_signed<T>::value ? static_cast<type>(type{1} << (sizeof(T) * 8 - 1)) : type{0};
+        return static_cast<type>(static_cast<type>(value) ^ sign);
+    }
+};
+
+template <>
+struct OrderedKey<float> {
+    using type = std::uint32_t;
+    __device__ static type get(float value) {
+        const type bits = __float_as_uint(value);
+        return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    }
+};
+
+template <>
+struct OrderedKey<__half> {
+    using type = std::uint16_t;
+    __device__ static type get(__half value) {
+        const type bits = __half_as_ushort(value);
+        return static_cast<type>((bits & 0x8000u) ? ~bits : bits | 0x8000u);
+    }
+};
+
+#ifdef CUDA_HAS_BF16_TYPE
+template <>
+struct OrderedKey<__nv_bfloat16> {
+    using type = std::uint16_t;
+    __device__ static type get(__nv_bfloat16 value) {
+        const type bits = __bfloat16_as_ushort(value);
+        return static_cast<type>((bits & 0x8000u) ? ~bits : bits | 0x8000u);
+    }
+};
+#endif
+
+namespace block {
+
+constexpr unsigned kWarpSize = 32;
+constexpr unsigned kRadixBits = 8;
+constexpr unsigned kRadixBins = 1u << kRadixBits;
+
+/**
+ * Block-wide exclusive prefix count of the flags of the threads in the order of threadIdx.x.
+ * All threads of the block should call it, blockDim.x should be a multiple of the warp size
+ * @param total Number of set flags of the block
+ * @returns Number of set flags of the threads before the calling one
+ */
+__device__ inline unsigned exclusive_count(const bool flag, unsigned& total) {
+    __shared__ unsigned warp_counts[kWarpSize];
+    const unsigned lane = threadIdx.x % kWarpSize;
+    const unsigned warp = threadIdx.x / kWarpSize;
+    const unsigned ballot = __ballot_sync(0xFFFFFFFFu, flag);
+    if (lane == 0) {
+        warp_counts[warp] = __popc(ballot);
+    }
+    __syncthreads();
+    unsigned count = __popc(ballot & ((1u << lane) - 1u));
+    total = 0;
+    for (unsigned w = 0; w < blockDim.x / kWarpSize; ++w) {
+        count += w < warp ? warp_counts[w] : 0;
+        total += warp_counts[w];
+    }
+    // warp_counts may be overwritten by the next call
+    __syncthreads();
+    return count;
+}
+
+/**
+ * Block-wide exclusive prefix sum of the values of the threads in the order of threadIdx.x.
+ * All threads of the block should call it, blockDim.x should be a multiple of the warp size
+ * @param total Sum of the values of the block
+ * @returns Sum of the values of the threads before the calling one
+ */
+template <typename T>
+__device__ T exclusive_sum(const T value, T& total) {
+    __shared__ T warp_sums[kWarpSize];
+    const unsigned lane = threadIdx.x % kWarpSize;
+    const unsigned warp = threadIdx.x / kWarpSize;
+    T inclusive = value;
+    for (unsigned offset = 1; offset < kWarpSize; offset *= 2) {
+        const T other = __shfl_up_sync(0xFFFFFFFFu, inclusive, offset);
+        if (lane >= offset) {
+            inclusive += other;
+        }
+    }
+    if (lane == kWarpSize - 1) {
+        warp_sums[warp] = inclusive;
+    }
+    __syncthreads();
+    T sum = inclusive - value;
+    total = T{0};
+    for (unsigned w = 0; w < blockDim.x / kWarpSize; ++w) {
+        sum += w < warp ? warp_sums[w] : T{0};
+        total += warp_sums[w];
+    }
+    // warp_sums may be overwritten by the next call
+    __syncthreads();
+    return sum;
+}
+
+/**
+ * States of tiles of single-pass scans with decoupled look-back, which are zeroed before each scan
+ */
+template <typename T>
+struct ScanTileStates {
+    enum Flag : unsigned { kInvalid = 0, kAggregate, kInclusivePrefix };
+
+    // Counter of tiles started by blocks
+    unsigned* num_started;
+    unsigned* flags;
+    T* aggregates;
+    T* inclusive_prefixes;
+
+    /**
+     * @returns Number of bytes of states of numTiles tiles
+     */
+    __host__ __device__ static std::size_t size(const std::size_t numTiles) {
+        return numTiles * (2 * sizeof(T) + sizeof(unsigned)) + sizeof(unsigned);
+    }
+
+    /**
+     * @param states Buffer of size(numTiles) bytes aligned for T
+     */
+    __host__ __device__ static ScanTileStates create(void* states, const std::size_t numTiles) {
+        ScanTileStates tiles{};
+        tiles.aggregates = static_cast<T*>(states);
+        tiles.inclusive_prefixes = tiles.aggregates + numTiles;
+        tiles.flags = reinterpret_cast<unsigned*>(tiles.inclusive_prefixes + numTiles);
+        tiles.num_started = tiles.flags + numTiles;
+        return tiles;
+    }
+};
+
+/**
+ * @returns Index of the tile of the block in the order in which blocks have started, so every tile looks back
+ * only at tiles of running or finished blocks. All threads of the block should call it
+ */
+template <typename T>
+__device__ unsigned next_tile(const ScanTileStates<T>& states) {
+    __shared__ unsigned tile;
+    if (threadIdx.x == 0) {
+        tile = atomicAdd(states.num_started, 1u);
+    }
+    __syncthreads();
+    const unsigned result = tile;
+    // tile may be overwritten by the next call
+    __syncthreads();
+    return result;
+}
+
+/**
+ * Decoupled look-back of a single-pass scan called by a single thread of the block: publishes the aggregate of the
+ * tile, sums aggregates of preceding tiles back to the first inclusive prefix and publishes the inclusive prefix
+ * of the tile
+ * @param firstTile First tile of the scanned sequence, which doesn't look back
+ * @returns Exclusive prefix of the tile
+ */
+template <typename T>
+__device__ T decoupled_lookback(const ScanTileStates<T>& states,
+                                const unsigned tile,
+                                const unsigned firstTile,
+                                const T aggregate) {
+    volatile unsigned* flags = states.flags;
+    volatile T* aggregates = states.aggregates;
+    volatile T* inclusive_prefixes = states.inclusive_prefixes;
+    T prefix{0};
+    if (tile != firstTile) {
+        aggregates[tile] = aggregate;
+        __threadfence();
+        flags[tile] = ScanTileStates<T>::kAggregate;
+        for (unsigned predecessor = tile - 1;; --predecessor) {
+            unsigned flag;
+            while ((flag = flags[predecessor]) == ScanTileStates<T>::kInvalid) {
+            }
+            __threadfence();
+            if (flag == ScanTileStates<T>::kInclusivePrefix) {
+                prefix += inclusive_prefixes[predecessor];
+                break;
+            }
+            prefix += aggregates[predecessor];
+        }
+    }
+    inclusive_prefixes[tile] = prefix + aggregate;
+    __threadfence();
+    flags[tile] = ScanTileStates<T>::kInclusivePrefix;
+    return prefix;
+}
+
+/**
+ * The k-th greatest key and the number of keys equal to it among the k greatest ones
+ */
+template <typename Key>
+struct RadixSelection {
+    Key threshold;
+    std::size_t num_equal;
+};
+
+/**
+ * Block-wide radix select of the k-th greatest of count unsigned keys, 0 < k <= count. Each pass over the keys
+ * produced by keyOf(j) fixes the next digit of the k-th key among the keys with the digits fixed before.
+ * All threads of the block should call it
+ */
+template <typename Key, typename KeyOf>
+__device__ RadixSelection<Key> radix_select(KeyOf keyOf, const std::size_t count, const std::size_t k) {
+    static_assert(std::is_unsigned<Key>::value, "Keys should be unsigned, see OrderedKey");
+    __shared__ unsigned histogram[kRadixBins];
+    __shared__ Key prefix;
+    __shared__ std::size_t remaining;
+    if (threadIdx.x == 0) {
+        prefix = 0;
+        remaining = k;
+    }
+    Key mask = 0;
+    for (int shift = sizeof(Key) * 8 - kRadixBits; shift >= 0; shift -= kRadixBits) {
+        for (unsigned bin = threadIdx.x; bin < kRadixBins; bin += blockDim.x) {
+            histogram[bin] = 0;
+        }
+        __syncthreads();
+        const Key current_prefix = prefix;
+        for (std::size_t j = threadIdx.x; j < count; j += blockDim.x) {
+            const Key key = keyOf(j);
+            if ((key & mask) == current_prefix) {
+                atomicAdd(&histogram[(key >> shift) & (kRadixBins - 1)], 1u);
+            }
+        }
+        __syncthreads();
+        if (threadIdx.x == 0) {
+            std::size_t greater = 0;
+            unsigned digit = kRadixBins - 1;
+            while (greater + histogram[digit] < remaining) {
+                greater += histogram[digit];
+                --digit;
+            }
+            remaining -= greater;
+            prefix = static_cast<Key>(current_prefix | static_cast<Key>(static_cast<Key>(digit) << shift));
+        }
+        mask = static_cast<Key>(mask | static_cast<Key>(static_cast<Key>(kRadixBins - 1) << shift));
+        __syncthreads();
+    }
+    const RadixSelection<Key> selection{prefix, remaining};
+    // prefix and remaining may be overwritten by the next call
+    __syncthreads();
+    return selection;
+}
+
+}  // namespace block
+}  // namespace algorithms
+}  // namespace CUDA
@@ -0,0 +1,212 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cub/device/device_radix_sort.cuh>
+#include <cub/device/device_scan.cuh>
+#include <cub/device/device_segmented_radix_sort.cuh>
+#include <cub/device/device_select.cuh>
+
+#include <cstdint>
+#include <cuda/float16.hpp>
+#include <cuda/runtime.hpp>
+
+#include "device.hpp"
+
+namespace CUDA {
+namespace algorithms {
+namespace device {
+
+template <typename Key>
+RadixSortKeys<Key>::RadixSortKeys(const std::size_t numItems, const int endBit)
+    : num_items_{static_cast<int>(numItems)}, end_bit_{endBit}, temp_storage_size_{0} {
+    throwIfError(cub::DeviceRadixSort::SortKeys(nullptr,
+                                                temp_storage_size_,
+                                                static_cast<const Key*>(nullptr),
+                                                static_cast<Key*>(nullptr),
+                                                num_items_,
+                                                0,
+                                                end_bit_));
+}
+
+template <typename Key>
+void RadixSortKeys<Key>::operator()(const cudaStream_t stream,
+                                    void* tempStorage,
+                                    const Key* keysIn,
+                                    Key* keysOut) const {
+    std::size_t tempStorageSize = temp_storage_size_;
+    throwIfError(cub::DeviceRadixSort::SortKeys(
+        tempStorage, tempStorageSize, keysIn, keysOut, num_items_, 0, end_bit_, stream));
+}
+
+namespace {
+
+template <typename Key, typename Value>
+cudaError_t segmentedRadixSortPairs(void* tempStorage,
+                                    std::size_t& tempStorageSize,
+                                    const Key* keysIn,
+                                    Key* keysOut,
+                                    const Value* valuesIn,
+                                    Value* valuesOut,
+                                    const int numItems,
+                                    const int numSegments,
+                                    const int* beginOffsets,
+                                    const int* endOffsets,
+                                    const bool descending,
+                                    const cudaStream_t stream) {
+    constexpr int endBit = sizeof(Key) * 8;
+    if (descending) {
+        return cub::DeviceSegmentedRadixSort::SortPairsDescending(tempStorage,
+                                                                  tempStorageSize,
+                                                                  keysIn,
+                                                                  keysOut,
+                                                                  valuesIn,
+                                                                  valuesOut,
+                                                                  numItems,
+                                                                  numSegments,
+                                                                  beginOffsets,
+                                                                  endOffsets,
+                                                                  0,
+                                                                  endBit,
+                                                                  stream);
+    }
+    return cub::DeviceSegmentedRadixSort::SortPairs(tempStorage,
+                                                    tempStorageSize,
+                                                    keysIn,
+                                                    keysOut,
+                                                    valuesIn,
+                                                    valuesOut,
+                                                    numItems,
+                                                    numSegments,
+                                                    beginOffsets,
+                                                    endOffsets,
+                                                    0,
+                                                    endBit,
+                                                    stream);
+}
+
+}  // namespace
+
+template <typename Key, typename Value>
+SegmentedRadixSortPairs<Key, Value>::SegmentedRadixSortPairs(const std::size_t numItems,
+                                                             const std::size_t numSegments,
+                                                             const bool descending)
+    : num_items_{static_cast<int>(numItems)},
+      num_segments_{static_cast<int>(numSegments)},
+      descending_{descending},
+      temp_storage_size_{0} {
+    throwIfError(segmentedRadixSortPairs(nullptr,
+                                         temp_storage_size_,
+                                         static_cast<const Key*>(nullptr),
+                                         static_cast<Key*>(nullptr),
+                                         static_cast<const Value*>(nullptr),
+                                         static_cast<Value*>(nullptr),
+                                         num_items_,
+                                         num_segments_,
+                                         static_cast<const int*>(nullptr),
+                                         static_cast<const int*>(nullptr),
+                                         descending_,
+                                         nullptr));
+}
+
+template <typename Key, typename Value>
+void SegmentedRadixSortPairs<Key, Value>::operator()(const cudaStream_t stream,
+                                                     void* tempStorage,
+                                                     const Key* keysIn,
+                                                     Key* keysOut,
+                                                     const Value* valuesIn,
+                                                     Value* valuesOut,
+                                                     const int* beginOffsets,
+                                                     const int* endOffsets) const {
+    std::size_t tempStorageSize = temp_storage_size_;
+    throwIfError(segmentedRadixSortPairs(tempStorage,
+                                         tempStorageSize,
+                                         keysIn,
+                                         keysOut,
+                                         valuesIn,
+                                         valuesOut,
+                                         num_items_,
+                                         num_segments_,
+                                         beginOffsets,
+                                         endOffsets,
+                                         descending_,
+                                         stream));
+}
+
+template <typename T>
+ExclusiveSum<T>::ExclusiveSum(const std::size_t numItems)
+    : num_items_{static_cast<int>(numItems)}, temp_storage_size_{0} {
+    throwIfError(cub::DeviceScan::ExclusiveSum(
+        nullptr, temp_storage_size_, static_cast<const T*>(nullptr), static_cast<T*>(nullptr), num_items_));
+}
+
+template <typename T>
+void ExclusiveSum<T>::operator()(const cudaStream_t stream, void* tempStorage, const T* in, T* out) const {
+    std::size_t tempStorageSize = temp_storage_size_;
+    throwIfError(cub::DeviceScan::ExclusiveSum(tempStorage, tempStorageSize, in, out, num_items_, stream));
+}
+
+template <typename T>
+SelectFlagged<T>::SelectFlagged(const std::size_t numItems)
+    : num_items_{static_cast<int>(numItems)}, temp_storage_size_{0} {
+    throwIfError(cub::DeviceSelect::Flagged(nullptr,
+                                            temp_storage_size_,
+                                            static_cast<const T*>(nullptr),
+                                            static_cast<const bool*>(nullptr),
+                                            static_cast<T*>(nullptr),
+                                            static_cast<int*>(nullptr),
+                                            num_items_));
+}
+
+template <typename T>
+void SelectFlagged<T>::operator()(const cudaStream_t stream,
+                                  void* tempStorage,
+                                  const T* in,
+                                  const bool* flags,
+                                  T* out,
+                                  int* numSelected) const {
+    std::size_t tempStorageSize = temp_storage_size_;
+    throwIfError(
+        cub::DeviceSelect::Flagged(tempStorage, tempStorageSize, in, flags, out, numSelected, num_items_, stream));
+}
+
+template <typename T>
+Unique<T>::Unique(const std::size_t numItems) : num_items_{static_cast<int>(numItems)}, temp_storage_size_{0} {
+    throwIfError(cub::DeviceSelect::Unique(nullptr,
+                                           temp_storage_size_,
+                                           static_cast<const T*>(nullptr),
+                                           static_cast<T*>(nullptr),
+                                           static_cast<int*>(nullptr),
+                                           num_items_));
+}
+
+template <typename T>
+void Unique<T>::operator()(
+    const cudaStream_t stream, void* tempStorage, const T* in, T* out, int* numSelected) const {
+    std::size_t tempStorageSize = temp_storage_size_;
+    throwIfError(cub::DeviceSelect::Unique(tempStorage, tempStorageSize, in, out, numSelected, num_items_, stream));
+}
+
+#define INSTANTIATE_FOR_TYPE(T)                              \
+    template class RadixSortKeys<T>;                         \
+    template class ExclusiveSum<T>;                          \
+    template class SelectFlagged<T>;                         \
+    template class Unique<T>;                                \
+    template class SegmentedRadixSortPairs<T, std::int32_t>; \
+    template class SegmentedRadixSortPairs<T, std::int64_t>;
+
+INSTANTIATE_FOR_TYPE(std::int32_t)
+INSTANTIATE_FOR_TYPE(std::uint32_t)
+INSTANTIATE_FOR_TYPE(std::int64_t)
+INSTANTIATE_FOR_TYPE(unsigned long long)
+INSTANTIATE_FOR_TYPE(float)
+
+template class RadixSortKeys<__half>;
+template class SegmentedRadixSortPairs<__half, std::int32_t>;
+template class SegmentedRadixSortPairs<__half, std::int64_t>;
+
+#undef INSTANTIATE_FOR_TYPE
+
+}  // namespace device
+}  // namespace algorithms
+}  // namespace CUDA
@@ -0,0 +1,145 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace CUDA {
+namespace algorithms {
+namespace device {
+
+/**
+ * Device-wide primitives over CUB, which are sized once on construction. Temporary storage of tempStorageSize()
+ * bytes is owned by the caller, so an operation requests it among its workbuffers and launches the primitive
+ * in any stream, including stream capture. Primitives are instantiated in device.cu for the types used by
+ * the plugin
+ */
+
+/**
+ * Ascending radix sort of keys
+ */
+template <typename Key>
+class RadixSortKeys {
+public:
+    /**
+     * @param endBit Bits of keys from this one are ignored by the sort
+     */
+    explicit RadixSortKeys(std::size_t numItems, int endBit = sizeof(Key) * 8);
+
+    void operator()(cudaStream_t stream, void* tempStorage, const Key* keysIn, Key* keysOut) const;
+
+    std::size_t tempStorageSize() const noexcept { return temp_storage_size_; }
+
+private:
+    int num_items_;
+    int end_bit_;
+    std::size_t temp_storage_size_;
+};
+
+/**
+ * Stable radix sort of key-value pairs within each segment
+ */
+template <typename Key, typename Value>
+class SegmentedRadixSortPairs {
+public:
+    SegmentedRadixSortPairs(std::size_t numItems, std::size_t numSegments, bool descending);
+
+    /**
+     * Segment i takes items from beginOffsets[i] up to endOffsets[i]
+     */
+    void operator()(cudaStream_t stream,
+                    void* tempStorage,
+                    const Key* keysIn,
+                    Key* keysOut,
+                    const Value* valuesIn,
+                    Value* valuesOut,
+                    const int* beginOffsets,
+                    const int* endOffsets) const;
+
+    std::size_t tempStorageSize() const noexcept { return temp_storage_size_; }
+
+private:
+    int num_items_;
+    int num_segments_;
+    bool descending_;
+    std::size_t temp_storage_size_;
+};
+
+/**
+ * Exclusive prefix sum
+ */
+template <typename T>
+class ExclusiveSum {
+public:
+    explicit ExclusiveSum(std::size_t numItems);
+
+    void operator()(cudaStream_t stream, void* tempStorage, const T* in, T* out) const;
+
+    std::size_t tempStorageSize() const noexcept { return temp_storage_size_; }
+
+private:
+    int num_items_;
+    std::size_t temp_storage_size_;
+};
+
+/**
+ * Stable compaction of items with set flags
+ */
+template <typename T>
+class SelectFlagged {
+public:
+    explicit SelectFlagged(std::size_t numItems);
+
+    /**
+     * @param numSelected Device pointer to the number of selected items
+     */
+    void operator()(cudaStream_t stream,
+                    void* tempStorage,
+                    const T* in,
+                    const bool* flags,
+                    T* out,
+                    int* numSelected) const;
+
+    std::size_t tempStorageSize() const noexcept { return temp_storage_size_; }
+
+private:
+    int num_items_;
+    std::size_t temp_storage_size_;
+};
+
+/**
+ * Compaction of the first item of each run of equal items
+ */
+template <typename T>
+class Unique {
+public:
+    explicit Unique(std::size_t numItems);
+
+    /**
+     * @param numSelected Device pointer to the number of unique items
+     */
+    void operator()(cudaStream_t stream, void* tempStorage, const T* in, T* out, int* numSelected) const;
+
+    std::size_t tempStorageSize() const noexcept { return temp_storage_size_; }
+
+private:
+    int num_items_;
+    std::size_t temp_storage_size_;
+};
+
+/**
+ * @returns Size of temporary storage shared by primitives launched one after another in the same stream
+ */
+template <typename... Primitives>
+std::size_t sharedTempStorageSize(const Primitives&... primitives) {
+    return std::max({primitives.tempStorageSize()...});
+}
+
+}  // namespace device
+}  // namespace algorithms
+}  // namespace CUDA
@@ -0,0 +1,86 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "virtual_memory.hpp"
+
+#include <fmt/format.h>
+
+#include "driver.hpp"
+
+namespace CUDA {
+
+namespace {
+
+CUmemAllocationProp allocationProperties(const Device device) {
+    CUmemAllocationProp properties{};
+    properties.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    properties.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    properties.location.id = device.getId();
+    return properties;
+}
+
+}  // namespace
+
+VirtualMemory::VirtualMemory(const Device device, const std::size_t reservedSize) : device_{device} {
+    throwIfError(cuInit(0));
+    const auto properties = allocationProperties(device_);
+    throwIfError(cuMemGetAllocationGranularity(&granularity_, &properties, CU_MEM_ALLOC_GRANULARITY_RECOMMENDED));
+    reserved_size_ = (std::max<std::size_t>(reservedSize, 1) + granularity_ - 1) / granularity_ * granularity_;
+    throwIfError(cuMemAddressReserve(&base_, reserved_size_, granularity_, 0, 0));
+}
+
+VirtualMemory::~VirtualMemory() {
+    unmapFrom(0);
+    logIfError(cuMemAddressFree(base_, reserved_size_));
+}
+
+bool VirtualMemory::isSupported(const Device device) {
+    if (cuInit(0) != CUDA_SUCCESS) {
+        return false;
+    }
+    CUdevice driverDevice{};
+    int supported = 0;
+    return cuDeviceGet(&driverDevice, device.getId()) == CUDA_SUCCESS &&
+           cuDeviceGetAttribute(&supported, CU_DEVICE_ATTRIBUTE_VIRTUAL_MEMORY_MANAGEMENT_SUPPORTED, driverDevice) ==
+               CUDA_SUCCESS &&
+           supported != 0;
+}
+
+void VirtualMemory::resize(const std::size_t size) {
+    if (size > reserved_size_) {
+        ov::nvidia_gpu::throw_ov_exception(
+            fmt::format("Virtual memory can't grow to {} bytes beyond its reserved size {}", size, reserved_size_));
+    }
+    const auto count = (size + granularity_ - 1) / granularity_;
+    if (count <= chunks_.size()) {
+        unmapFrom(count);
+        return;
+    }
+    const auto properties = allocationProperties(device_);
+    CUmemAccessDesc access{};
+    access.location = properties.location;
+    access.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+    chunks_.reserve(count);
+    while (chunks_.size() < count) {
+        const auto address = base_ + chunks_.size() * granularity_;
+        CUmemGenericAllocationHandle chunk{};
+        throwIfError(cuMemCreate(&chunk, granularity_, &properties, 0));
+        if (const auto status = cuMemMap(address, granularity_, 0, chunk, 0); status != CUDA_SUCCESS) {
+            logIfError(cuMemRelease(chunk));
+            throwIfError(status);
+        }
+        chunks_.push_back(chunk);
+        throwIfError(cuMemSetAccess(address, granularity_, &access, 1));
+    }
+}
+
+void VirtualMemory::unmapFrom(const std::size_t count) noexcept {
+    while (chunks_.size() > count) {
+        logIfError(cuMemUnmap(base_ + (chunks_.size() - 1) * granularity_, granularity_));
+        logIfError(cuMemRelease(chunks_.back()));
+        chunks_.pop_back();
+    }
+}
+
+}  // namespace CUDA
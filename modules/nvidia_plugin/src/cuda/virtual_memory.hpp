@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "runtime.hpp"
+
+namespace CUDA {
+
+/**
+ * Device memory at a stable base address, which grows and shrinks in place. The range of addresses is reserved
+ * upfront by the virtual memory management API, physical memory is created in chunks of the allocation granularity
+ * and mapped to the end of the range on growth or unmapped from it on shrinking, so pointers into the memory stay
+ * valid while the memory keeps them mapped
+ */
+class VirtualMemory {
+public:
+    /**
+     * @param device Device of physical memory
+     * @param reservedSize Size of the range of addresses, it is rounded up to the granularity. Memory can't grow
+     *                     beyond it
+     * @throws ov::Exception if the range isn't reserved
+     */
+    VirtualMemory(Device device, std::size_t reservedSize);
+    VirtualMemory(const VirtualMemory&) = delete;
+    VirtualMemory& operator=(const VirtualMemory&) = delete;
+    ~VirtualMemory();
+
+    /**
+     * @returns true if the device and its driver support virtual memory management
+     */
+    static bool isSupported(Device device);
+
+    void* get() const noexcept { return reinterpret_cast<void*>(base_); }
+
+    /**
+     * @returns Size of mapped memory, a multiple of the granularity
+     */
+    std::size_t size() const noexcept { return chunks_.size() * granularity_; }
+
+    std::size_t reservedSize() const noexcept { return reserved_size_; }
+
+    /**
+     * Maps chunks up to the given size or unmaps chunks beyond it. Memory which stays mapped keeps its content.
+     * Chunks are unmapped immediately, so the caller makes sure work using them is completed (e.g. by waiting for
+     * an event recorded after the work) instead of synchronizing the whole device
+     * @param size Size of memory, it is rounded up to the granularity
+     * @throws ov::Exception if the size exceeds the reserved size or physical memory isn't available, already
+     *         mapped memory is kept then
+     */
+    void resize(std::size_t size);
+
+private:
+    void unmapFrom(std::size_t count) noexcept;
+
+    Device device_;
+    std::size_t granularity_ = 0;
+    std::size_t reserved_size_ = 0;
+    CUdeviceptr base_{};
+    std::vector<CUmemGenericAllocationHandle> chunks_;
+};
+
+}  // namespace CUDA
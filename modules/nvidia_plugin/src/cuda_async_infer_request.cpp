@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "cuda_async_infer_request.hpp"
+#include "cuda_compiled_model.hpp"
+#include "cuda_completion_executor.hpp"
+#include "cuda_delegate_stage_executor.hpp"
 #include "cuda_itt.hpp"
 #include "cuda_thread_pool.hpp"
 
@@ -11,7 +14,8 @@ namespace nvidia_gpu {
 CudaAsyncInferRequest::CudaAsyncInferRequest(const CudaInferRequest::Ptr& request,
                                              const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                              const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
-                                             const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+                                             const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                                             const std::shared_ptr<BatchScheduler>& batch_scheduler)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       request_(request) {
     // In current implementation we have CPU only tasks and no needs in 2 executors
@@ -21,24 +25,71 @@ CudaAsyncInferRequest::CudaAsyncInferRequest(const CudaInferRequest::Ptr& reques
     // and waiting tasks. Waiting tasks can lock execution thread so they use separate threads from other executor.
     constexpr const auto remoteDevice = true;
 
+    if (batch_scheduler) {
+        // Request is executed as a part of the batch, so device work is submitted by the batched request
+        auto batch_executor = std::make_shared<BatchStageExecutor>(batch_scheduler, *request_, task_executor);
+        m_pipeline = {{task_executor,
+                       [this] {
+                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::infer_preprocess");
+                           request_->infer_preprocess();
+                       }},
+                      {batch_executor, [this, batch_executor] {
+                           batch_executor->rethrow_if_failed();
+                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::infer_postprocess");
+                           request_->infer_postprocess();
+                       }}};
+        return;
+    }
+
+    auto compiled_model = std::dynamic_pointer_cast<const CompiledModel>(request_->get_compiled_model());
+    if (compiled_model && (compiled_model->get_shape_buckets() || compiled_model->get_device_replicas() ||
+                           compiled_model->get_pipeline_stages() || compiled_model->get_micro_batches() ||
+                           compiled_model->get_tiles())) {
+        // Dynamic model is executed by infer request of the model compiled for the shape bucket,
+        // replicated model is executed by infer request of the least loaded replica,
+        // split model is executed by infer requests of its pipeline stages one after another,
+        // micro-batched and tiled models are executed by concurrent lanes of infer requests of the smaller model
+        auto delegate_executor = std::make_shared<DelegateStageExecutor>(*request_, task_executor);
+        m_pipeline = {{task_executor,
+                       [this] {
+                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::infer_preprocess");
+                           request_->infer_preprocess();
+                       }},
+                      {delegate_executor, [this, delegate_executor] {
+                           delegate_executor->rethrow_if_failed();
+                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::infer_postprocess");
+                           request_->infer_postprocess();
+                       }}};
+        return;
+    }
+
     auto cuda_thread_pool = std::dynamic_pointer_cast<CudaThreadPool>(wait_executor);
+    // Submission of device work is queued ahead of requests of models with lower priority,
+    // and earliest deadline first among requests of the same priority
+    const auto priority = compiled_model
+                              ? compiled_model->get_property(ov::hint::model_priority.name()).as<ov::hint::Priority>()
+                              : ov::hint::Priority::MEDIUM;
+    auto start_executor = std::make_shared<CudaPriorityExecutor>(
+        cuda_thread_pool, priority, [request = request_.get()] { return request->deadline(); });
+    // Completion of device work is signaled by CUDA stream itself, so CudaThreadPool thread is released
+    // right after the inference is submitted and isn't blocked for the whole execution time
+    auto completion_executor = std::make_shared<CudaCompletionExecutor>(cuda_thread_pool, task_executor);
     if (remoteDevice) {
         m_pipeline = {{task_executor,
                       [this] {
                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::infer_preprocess");
                           request_->infer_preprocess();
                       }},
-                     {wait_executor,
+                     {start_executor,
                       [this, cuda_thread_pool] {
                           auto& threadContext = cuda_thread_pool->get_thread_context();
-                          {
-                              OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::start_pipeline");
-                              request_->start_pipeline(threadContext);
-                          }
-                          {
-                              OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::wait_pipeline");
-                              request_->wait_pipeline(threadContext);
-                          }
+                          OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::start_pipeline");
+                          request_->start_pipeline(threadContext);
+                      }},
+                     {completion_executor,
+                      [this] {
+                          OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::wait_pipeline");
+                          request_->wait_pipeline(CudaCompletionExecutor::completionStatus());
                       }},
                      {task_executor, [this] {
                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::infer_postprocess");
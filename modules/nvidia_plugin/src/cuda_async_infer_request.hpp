@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "cuda_batch_scheduler.hpp"
 #include "cuda_infer_request.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
@@ -16,7 +17,8 @@ public:
     CudaAsyncInferRequest(const CudaInferRequest::Ptr& request,
                           const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                           const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
-                          const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
+                          const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                          const std::shared_ptr<BatchScheduler>& batch_scheduler = nullptr);
 
     ~CudaAsyncInferRequest();
     void cancel() override;
@@ -0,0 +1,216 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_batch_scheduler.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "cuda_infer_request.hpp"
+#include "cuda_variable_state.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+using Time = std::chrono::steady_clock;
+
+namespace {
+
+std::size_t sample_size(const ov::SoPtr<ov::ITensor>& batched_tensor, std::size_t batch_size) {
+    return batched_tensor->get_byte_size() / batch_size;
+}
+
+}  // namespace
+
+BatchScheduler::BatchScheduler(const std::shared_ptr<const ov::ICompiledModel>& batched_model,
+                               std::size_t batch_size,
+                               std::chrono::milliseconds timeout)
+    : batched_model_{batched_model}, batch_size_{batch_size}, timeout_{timeout} {
+    OPENVINO_ASSERT(batched_model_ && batch_size_ > 0);
+    // Several batches are in flight to overlap gathering of the next batch with execution of the current one
+    const auto number_of_batches =
+        std::max(1u, batched_model_->get_property(ov::optimal_number_of_infer_requests.name()).as<unsigned>());
+    for (unsigned i = 0; i < number_of_batches; ++i) {
+        auto batch = std::make_unique<Batch>();
+        batch->request = batched_model_->create_infer_request();
+        for (const auto& state : batch->request->query_state()) {
+            auto variable_state = std::dynamic_pointer_cast<VariableState>(state._ptr);
+            OPENVINO_ASSERT(variable_state, "State ", state->get_name(), " of batched request isn't on the device");
+            batch->states.push_back(std::move(variable_state));
+        }
+        batch->request->set_callback([this, b = batch.get()](std::exception_ptr error) { complete(*b, error); });
+        idle_batches_.push_back(batch.get());
+        batches_.push_back(std::move(batch));
+    }
+    worker_ = std::thread{[this] { process(); }};
+}
+
+BatchScheduler::~BatchScheduler() {
+    std::deque<Item> pending;
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        stopped_ = true;
+        pending.swap(queue_);
+    }
+    cond_var_.notify_all();
+    worker_.join();
+    std::exception_ptr error;
+    try {
+        OPENVINO_THROW("Batch scheduler is destroyed");
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (auto& item : pending) {
+        item.callback(error);
+    }
+    // Destruction of batched requests waits for inferences which are still in flight
+    batches_.clear();
+}
+
+void BatchScheduler::enqueue(CudaInferRequest& request, Callback callback) {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        OPENVINO_ASSERT(!stopped_, "Batch scheduler is destroyed");
+        queue_.push_back({&request, std::move(callback)});
+    }
+    cond_var_.notify_all();
+}
+
+void BatchScheduler::process() {
+    std::unique_lock<std::mutex> lock{mtx_};
+    while (true) {
+        cond_var_.wait(lock, [this] { return stopped_ || !queue_.empty(); });
+        if (stopped_) {
+            return;
+        }
+        const auto deadline = Time::now() + timeout_;
+        cond_var_.wait_until(lock, deadline, [this] { return stopped_ || queue_.size() >= batch_size_; });
+        cond_var_.wait(lock, [this] { return stopped_ || !idle_batches_.empty(); });
+        if (stopped_) {
+            return;
+        }
+        auto* batch = idle_batches_.back();
+        idle_batches_.pop_back();
+        const auto batch_size = std::min(batch_size_, queue_.size());
+        batch->items.assign(std::make_move_iterator(queue_.begin()),
+                            std::make_move_iterator(queue_.begin() + batch_size));
+        queue_.erase(queue_.begin(), queue_.begin() + batch_size);
+        lock.unlock();
+        start(*batch);
+        lock.lock();
+    }
+}
+
+void BatchScheduler::start(Batch& batch) {
+    try {
+        const auto& inputs = batched_model_->inputs();
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            auto batched_tensor = batch.request->get_tensor(inputs[i]);
+            const auto size = sample_size(batched_tensor, batch_size_);
+            auto* dst = static_cast<std::uint8_t*>(batched_tensor->data());
+            // Samples which are not filled by requests of incomplete batch keep stale data, their outputs are ignored
+            for (std::size_t k = 0; k < batch.items.size(); ++k) {
+                const auto& tensor = batch.items[k].request->input_tensors_.at(i);
+                OPENVINO_ASSERT(tensor->get_byte_size() == size,
+                                "Input ",
+                                i,
+                                " of the request doesn't match the sample of batched model");
+                std::memcpy(dst + k * size, tensor->data(), size);
+            }
+        }
+        gather_states(batch);
+        batch.request->start_async();
+    } catch (...) {
+        complete(batch, std::current_exception());
+    }
+}
+
+void BatchScheduler::complete(Batch& batch, std::exception_ptr error) {
+    if (!error) {
+        try {
+            const auto& outputs = batched_model_->outputs();
+            for (std::size_t i = 0; i < outputs.size(); ++i) {
+                auto batched_tensor = batch.request->get_tensor(outputs[i]);
+                const auto size = sample_size(batched_tensor, batch_size_);
+                const auto* src = static_cast<const std::uint8_t*>(batched_tensor->data());
+                for (std::size_t k = 0; k < batch.items.size(); ++k) {
+                    const auto& tensor = batch.items[k].request->output_tensors_.at(i);
+                    OPENVINO_ASSERT(tensor->get_byte_size() == size,
+                                    "Output ",
+                                    i,
+                                    " of the request doesn't match the sample of batched model");
+                    std::memcpy(tensor->data(), src + k * size, size);
+                }
+            }
+            scatter_states(batch);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    auto items = std::move(batch.items);
+    batch.items.clear();
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        idle_batches_.push_back(&batch);
+    }
+    cond_var_.notify_all();
+    for (auto& item : items) {
+        item.callback(error);
+    }
+}
+
+void BatchScheduler::gather_states(Batch& batch) {
+    // Copies are ordered with inferences by the legacy default stream, since streams of requests are blocking
+    for (const auto& batched_state : batch.states) {
+        const auto size = batched_state->size() / batch_size_;
+        auto* dst = static_cast<std::uint8_t*>(batched_state->data());
+        for (std::size_t k = 0; k < batch.items.size(); ++k) {
+            const auto& state = batch.items[k].request->variable_states_by_id_.at(batched_state->get_name());
+            OPENVINO_ASSERT(state->size() == size,
+                            "State ",
+                            state->get_name(),
+                            " of the request doesn't match the sample of batched model");
+            CUDA::DefaultStream::stream().transfer(CUDA::DevicePointer<void*>{dst + k * size},
+                                                   CUDA::DevicePointer<const void*>{state->data()},
+                                                   size);
+        }
+    }
+}
+
+void BatchScheduler::scatter_states(Batch& batch) {
+    for (const auto& batched_state : batch.states) {
+        const auto size = batched_state->size() / batch_size_;
+        const auto* src = static_cast<const std::uint8_t*>(batched_state->data());
+        for (std::size_t k = 0; k < batch.items.size(); ++k) {
+            const auto& state = batch.items[k].request->variable_states_by_id_.at(batched_state->get_name());
+            CUDA::DefaultStream::stream().transfer(CUDA::DevicePointer<void*>{state->data()},
+                                                   CUDA::DevicePointer<const void*>{src + k * size},
+                                                   size);
+        }
+    }
+}
+
+BatchStageExecutor::BatchStageExecutor(std::shared_ptr<BatchScheduler> scheduler,
+                                       CudaInferRequest& request,
+                                       std::shared_ptr<ov::threading::ITaskExecutor> executor)
+    : scheduler_{std::move(scheduler)}, request_{request}, executor_{std::move(executor)} {
+    OPENVINO_ASSERT(scheduler_ && executor_, "BatchStageExecutor requires scheduler and executor");
+}
+
+void BatchStageExecutor::run(ov::threading::Task task) {
+    error_ = nullptr;
+    scheduler_->enqueue(request_, [this, task = std::move(task)](std::exception_ptr error) mutable {
+        error_ = error;
+        executor_->run(std::move(task));
+    });
+}
+
+void BatchStageExecutor::rethrow_if_failed() {
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
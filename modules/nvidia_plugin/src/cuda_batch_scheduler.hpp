@@ -0,0 +1,120 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class CudaInferRequest;
+class VariableState;
+
+/**
+ * @brief Collects concurrent single-sample infer requests into batches.
+ *
+ * Inputs of collected requests are gathered into an infer request of the model compiled for the larger batch,
+ * which is executed once the batch is full or the timeout is expired. Outputs are scattered back to each request
+ * after the batched inference is completed.
+ * Requests of stateful models are batched step by step: states of the requests are gathered into states of
+ * the batched request before each inference and scattered back after it, so sequences join and leave the batch
+ * between steps while their states stay with their requests.
+ */
+class BatchScheduler {
+public:
+    using Callback = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @param batched_model Model compiled for the batch of @p batch_size samples
+     * @param batch_size Maximum number of requests in a batch
+     * @param timeout Maximum time the first request of a batch waits for other requests
+     */
+    BatchScheduler(const std::shared_ptr<const ov::ICompiledModel>& batched_model,
+                   std::size_t batch_size,
+                   std::chrono::milliseconds timeout);
+    ~BatchScheduler();
+
+    BatchScheduler(const BatchScheduler&) = delete;
+    BatchScheduler& operator=(const BatchScheduler&) = delete;
+
+    /**
+     * Enqueues request into the next batch
+     * @param request Request with prepared input/output tensors, should be alive until callback is called
+     * @param callback Callback which is called once outputs of the request are ready or an error occured
+     */
+    void enqueue(CudaInferRequest& request, Callback callback);
+
+private:
+    struct Item {
+        CudaInferRequest* request;
+        Callback callback;
+    };
+
+    struct Batch {
+        std::shared_ptr<ov::IAsyncInferRequest> request;
+        std::vector<std::shared_ptr<VariableState>> states;
+        std::vector<Item> items;
+    };
+
+    void process();
+    void start(Batch& batch);
+    void complete(Batch& batch, std::exception_ptr error);
+    void gather_states(Batch& batch);
+    void scatter_states(Batch& batch);
+
+    std::shared_ptr<const ov::ICompiledModel> batched_model_;
+    std::size_t batch_size_;
+    std::chrono::milliseconds timeout_;
+    std::mutex mtx_;
+    std::condition_variable cond_var_;
+    std::deque<Item> queue_;
+    std::vector<std::unique_ptr<Batch>> batches_;
+    std::vector<Batch*> idle_batches_;
+    bool stopped_ = false;
+    std::thread worker_;
+};
+
+/**
+ * @brief Executor of the pipeline stage which runs the task after the request is executed as a part of a batch
+ */
+class BatchStageExecutor : public ov::threading::ITaskExecutor {
+public:
+    /**
+     * @param scheduler Scheduler executing the request
+     * @param request Request of the pipeline
+     * @param executor Executor which runs tasks after batch completion
+     */
+    BatchStageExecutor(std::shared_ptr<BatchScheduler> scheduler,
+                       CudaInferRequest& request,
+                       std::shared_ptr<ov::threading::ITaskExecutor> executor);
+
+    void run(ov::threading::Task task) override;
+
+    /**
+     * Rethrows an error of the batched inference, should be called by the task of the stage
+     */
+    void rethrow_if_failed();
+
+private:
+    std::shared_ptr<BatchScheduler> scheduler_;
+    CudaInferRequest& request_;
+    std::shared_ptr<ov::threading::ITaskExecutor> executor_;
+    std::exception_ptr error_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
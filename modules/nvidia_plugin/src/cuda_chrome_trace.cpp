@@ -0,0 +1,120 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_chrome_trace.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <unordered_map>
+#include <utility>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr int kHostProcess = 0;
+constexpr int kDeviceProcess = 1;
+
+void writeString(std::ostream& stream, const std::string& value) {
+    stream << '"';
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+void writeProcessName(std::ostream& stream, const int pid, const std::string& name) {
+    stream << R"({"name":"process_name","ph":"M","pid":)" << pid << R"(,"args":{"name":)";
+    writeString(stream, name);
+    stream << "}}";
+}
+
+}  // namespace
+
+ChromeTrace::Scope::Scope(ChromeTrace* trace, const char* name, const Tags& tags)
+    : trace_{trace}, name_{name}, tags_{tags} {
+    if (trace_) {
+        start_ = Clock::now();
+    }
+}
+
+ChromeTrace::Scope::~Scope() {
+    if (trace_) {
+        trace_->add({name_, "stage", start_, Clock::now() - start_, tags_, false});
+    }
+}
+
+ChromeTrace::ChromeTrace(std::string path, const std::size_t capacity)
+    : path_{std::move(path)}, capacity_{std::max<std::size_t>(capacity, 1)} {
+    events_.reserve(std::min(capacity_, kDefaultCapacity));
+}
+
+std::shared_ptr<ChromeTrace> ChromeTrace::get(const std::string& path) {
+    static std::mutex mtx;
+    static std::unordered_map<std::string, std::weak_ptr<ChromeTrace>> traces;
+    std::lock_guard<std::mutex> lock{mtx};
+    if (auto it = traces.find(path); it != traces.end()) {
+        if (auto trace = it->second.lock()) {
+            return trace;
+        }
+    }
+    auto trace = std::make_shared<ChromeTrace>(path);
+    traces[path] = trace;
+    return trace;
+}
+
+ChromeTrace::~ChromeTrace() {
+    // The trace is only a debugging aid, so failure to write it is ignored
+    std::ofstream file{path_};
+    if (file) {
+        write(file);
+    }
+}
+
+void ChromeTrace::add(Event event) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (events_.size() < capacity_) {
+        events_.push_back(std::move(event));
+        return;
+    }
+    events_[next_] = std::move(event);
+    next_ = (next_ + 1) % capacity_;
+}
+
+void ChromeTrace::write(std::ostream& stream) const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+    writeProcessName(stream, kHostProcess, "Host");
+    stream << ',';
+    writeProcessName(stream, kDeviceProcess, "Device");
+    stream << std::fixed << std::setprecision(3);
+    for (std::size_t i = 0; i < events_.size(); ++i) {
+        const auto& event = events_[(next_ + i) % events_.size()];
+        stream << ",\n{\"name\":";
+        writeString(stream, event.name);
+        stream << ",\"cat\":";
+        writeString(stream, event.category);
+        stream << R"(,"ph":"X","ts":)" << Duration{event.start - origin_}.count();
+        stream << ",\"dur\":" << event.duration.count();
+        stream << ",\"pid\":" << (event.device ? kDeviceProcess : kHostProcess);
+        stream << ",\"tid\":" << event.tags.request;
+        stream << R"(,"args":{"request":)" << event.tags.request;
+        if (event.tags.block) {
+            stream << ",\"block\":" << *event.tags.block;
+        }
+        stream << "}}";
+    }
+    stream << "]}\n";
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,111 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Timeline of inferences in Chrome trace JSON format, which is opened by chrome://tracing or Perfetto.
+ *
+ * Events of all infer requests are kept in a ring buffer, so a long run keeps its latest events only.
+ * Host stages of a request are shown in the row of the request of the host process, operations executed
+ * on the device are shown in the row of the request of the device process.
+ * Compiled models tracing into the same file (e.g. shape buckets or replicas of a model) share the trace,
+ * which writes the file when the last of them and their infer requests are destroyed (see ov::nvidia_gpu::trace_file)
+ */
+class ChromeTrace {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Duration = std::chrono::duration<double, std::micro>;
+
+    static constexpr std::size_t kDefaultCapacity = 1 << 16;
+
+    /**
+     * Identifiers an event is tagged with
+     */
+    struct Tags {
+        std::size_t request = 0;
+        // Memory block of the memory pool the inference is executed with, if it is taken already
+        std::optional<std::size_t> block;
+    };
+
+    struct Event {
+        std::string name;
+        std::string category;
+        Clock::time_point start;
+        Duration duration;
+        Tags tags;
+        bool device = false;
+    };
+
+    /**
+     * Records a host event of the lifetime of the scope
+     */
+    class Scope {
+    public:
+        /**
+         * @param trace Trace or nullptr if tracing is disabled, then the scope does nothing
+         * @param name Name of the event, a string literal, so a disabled scope doesn't allocate
+         */
+        Scope(ChromeTrace* trace, const char* name, const Tags& tags);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ChromeTrace* trace_;
+        const char* name_;
+        Tags tags_;
+        Clock::time_point start_;
+    };
+
+    explicit ChromeTrace(std::string path, std::size_t capacity = kDefaultCapacity);
+    ~ChromeTrace();
+    ChromeTrace(const ChromeTrace&) = delete;
+    ChromeTrace& operator=(const ChromeTrace&) = delete;
+
+    /**
+     * @returns Trace of the file, created if no compiled model traces into it
+     */
+    static std::shared_ptr<ChromeTrace> get(const std::string& path);
+
+    void add(Event event);
+
+    /**
+     * @returns Identifier of a new infer request, which is unique among infer requests of the trace
+     */
+    std::size_t nextRequest() noexcept { return next_request_.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * Writes events of the ring buffer in the order of their addition
+     */
+    void write(std::ostream& stream) const;
+
+    const std::string& path() const noexcept { return path_; }
+
+private:
+    std::string path_;
+    std::size_t capacity_;
+    std::atomic<std::size_t> next_request_{0};
+    Clock::time_point origin_ = Clock::now();
+    mutable std::mutex mtx_;
+    std::vector<Event> events_;
+    // Position of the oldest event once the ring buffer is full
+    std::size_t next_ = 0;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
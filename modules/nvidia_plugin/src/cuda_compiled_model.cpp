@@ -8,19 +8,27 @@
 
 #include <fmt/format.h>
 
+#include <cstring>
+#include <numeric>
 #include <memory_manager/cuda_memory_manager.hpp>
 #include <ops/nop_op.hpp>
 #include <ops/subgraph.hpp>
+#include <optional>
 #include <threading/ie_executor_manager.hpp>
 #include <utility>
 
+#include "cuda/nvtx.hpp"
 #include "cuda_compiled_model.hpp"
 #include "cuda_eager_topology_runner.hpp"
 #include "cuda_graph_topology_runner.hpp"
+#include "cuda_implementation_selection.hpp"
 #include "cuda_itt.hpp"
+#include "cuda_memory_layout.hpp"
 #include "cuda_operation_registry.hpp"
 #include "cuda_perf_counts.hpp"
 #include "cuda_plugin.hpp"
+#include "cuda_thread_pool.hpp"
+#include "cuda_topology_hash.hpp"
 #include "memory_manager/cuda_immutable_memory_block_builder.hpp"
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/model/cuda_memory_model_builder.hpp"
@@ -31,7 +39,9 @@
 #include "ops/result.hpp"
 #include "transformations/utils/utils.hpp"
 #include "transformer/cuda_graph_transformer.hpp"
+#include "utils/roofline.hpp"
 
+#include "openvino/op/util/read_value_base.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
@@ -40,6 +50,8 @@ namespace {
 static constexpr const char* nv_stream_executor_name = "NvidiaStreamExecutor";
 static constexpr const char* nv_exclusive_executor = "NvidiaExecutor";
 static constexpr const char* nv_callback_executor_name = "NvidiaCallbackExecutor";
+// Work space of a single operation may take at most this part of the memory budget
+static constexpr size_t memory_budget_part_per_workspace = 8;
 }  // namespace
 
 namespace ov {
@@ -51,18 +63,36 @@ CompiledModel::CompiledModel(const std::shared_ptr<const ov::Model>& model,
                              const Configuration& cfg,
                              const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
-                             bool loaded_from_cache)
+                             bool loaded_from_cache,
+                             std::shared_ptr<TuningCache> tuning_cache,
+                             std::shared_ptr<MemoryArenas> memory_arenas)
     : ov::ICompiledModel(model, plugin, nullptr, nullptr),
       config_(std::move(cfg)),
+      skipped_outputs_{std::make_shared<const std::vector<std::string>>(config_.get_skipped_outputs())},
+      numa_node_{CUDA::NumaNode::of(CUDA::Device{config_.get_device_id()})},
       cuda_stream_executor_(std::move(wait_executor)),
+      memory_arenas_(std::move(memory_arenas)),
+      tuning_cache_(std::move(tuning_cache)),
+      trace_{config_.get_trace_file().empty() ? nullptr : ChromeTrace::get(config_.get_trace_file())},
       loaded_from_cache_(loaded_from_cache),
-      use_cuda_graph_{get_property(ov::nvidia_gpu::use_cuda_graph.name()).as<bool>() &&
-                      !get_property(ov::enable_profiling.name()).as<bool>()},
-      number_of_cuda_graphs_{0} {
+      use_cuda_graph_{get_property(ov::nvidia_gpu::use_cuda_graph.name()).as<bool>()} {
     try {
         compile_model(model);
         init_executor();  // creates thread-based executor using for async requests
-        benchmark_optimal_number_of_requests();
+        estimate_optimal_number_of_requests();
+        init_batch_scheduler(model);
+        if (config_.is_warmup_on_compile_enabled()) {
+            warm_up();
+        }
+        if (is_background_tuning_required()) {
+            background_tuning_ = std::async(std::launch::async, [this] {
+                try {
+                    tune_in_background();
+                } catch (...) {
+                    // The model keeps serving with heuristic algorithms if the tuning fails
+                }
+            });
+        }
     } catch (const ov::Exception& e) {
         OPENVINO_THROW(e.what());
     } catch (const std::exception& e) {
@@ -75,7 +105,13 @@ CompiledModel::CompiledModel(const std::shared_ptr<const ov::Model>& model,
 void CompiledModel::init_executor() {
     // Default multi-threaded configuration is balanced for throughtput and latency cases and takes into account
     // real hardware cores and NUMA nodes.
-    config_.streams_executor_config_.set_property({ ov::num_streams(ov::streams::Num(memory_pool_->Size())) });
+    const auto num_streams = memory_pool_        ? memory_pool_->Size()
+                             : device_replicas_  ? device_replicas_->get_optimal_number_of_infer_requests()
+                             : pipeline_stages_ ? pipeline_stages_->get_optimal_number_of_infer_requests()
+                             : micro_batches_   ? micro_batches_->get_optimal_number_of_infer_requests()
+                             : tiles_           ? tiles_->get_optimal_number_of_infer_requests()
+                                                 : config_.get_optimal_number_of_streams();
+    config_.streams_executor_config_.set_property({ ov::num_streams(ov::streams::Num(num_streams)) });
     auto streams_executor_config = ov::threading::IStreamsExecutor::Config::make_default_multi_threaded(config_.streams_executor_config_);
     streams_executor_config._name = nv_stream_executor_name;
     // As OpenVINO CPU Streams Executor creates some additional threads
@@ -87,10 +123,270 @@ void CompiledModel::init_executor() {
     } else {
         set_task_executor(get_plugin()->get_executor_manager()->get_idle_cpu_streams_executor(streams_executor_config));
     }
-    set_callback_executor(get_plugin()->get_executor_manager()->get_idle_cpu_streams_executor({nv_callback_executor_name}));
+    auto callback_executor =
+        get_plugin()->get_executor_manager()->get_idle_cpu_streams_executor({nv_callback_executor_name});
+    // Callbacks read outputs from host staging memory placed on the NUMA node of the device
+    if (numa_node_.isKnown()) {
+        callback_executor = std::make_shared<NumaBoundExecutor>(std::move(callback_executor), numa_node_);
+    }
+    set_callback_executor(callback_executor);
+}
+
+void CompiledModel::init_batch_scheduler(const std::shared_ptr<const ov::Model>& model) {
+    const auto batch_size = config_.get_dynamic_batch_size();
+    // Replicas and pipeline stages batch requests on their own devices, micro-batched model is already batched,
+    // tiles of an image occupy all lanes of the tile model
+    if (batch_size <= 1 || device_replicas_ || pipeline_stages_ || micro_batches_ || tiles_) {
+        return;
+    }
+    // Only models which process a single sample along the first dimension of all inputs/outputs are batched
+    auto is_single_sample = [](const ov::PartialShape& shape) {
+        return shape.is_static() && shape.rank().get_length() > 0 && shape[0] == 1;
+    };
+    for (const auto& variable : model->get_variables()) {
+        if (!is_single_sample(variable->get_info().data_shape)) {
+            return;
+        }
+    }
+    // States of all samples of a batched request share one initialized flag, so only variables which start
+    // from zeros are batched
+    for (const auto& node : model->get_ops()) {
+        if (ov::is_type<ov::op::util::ReadValueBase>(node) && node->get_input_size() > 0) {
+            return;
+        }
+    }
+    for (const auto& parameter : model->get_parameters()) {
+        if (!is_single_sample(parameter->get_output_partial_shape(0))) {
+            return;
+        }
+    }
+    for (const auto& result : model->get_results()) {
+        if (!is_single_sample(result->get_output_partial_shape(0))) {
+            return;
+        }
+    }
+    auto batched_model = model->clone();
+    try {
+        std::map<ov::Output<ov::Node>, ov::PartialShape> batched_shapes;
+        for (const auto& parameter : batched_model->get_parameters()) {
+            auto shape = parameter->get_output_partial_shape(0);
+            shape[0] = batch_size;
+            batched_shapes.emplace(parameter->output(0), shape);
+        }
+        for (const auto& variable : batched_model->get_variables()) {
+            auto info = variable->get_info();
+            info.data_shape[0] = batch_size;
+            variable->update(info);
+        }
+        batched_model->reshape(batched_shapes);
+    } catch (const ov::Exception&) {
+        // Model can't be reshaped (e.g. it has hardcoded target shapes), so it is executed without batching
+        return;
+    }
+    for (const auto& result : batched_model->get_results()) {
+        const auto& shape = result->get_output_partial_shape(0);
+        if (shape.is_dynamic() || shape[0] != batch_size) {
+            return;
+        }
+    }
+    auto batched_config = Configuration{ov::AnyMap{ov::nvidia_gpu::dynamic_batch_size(1)}, config_};
+    auto batched_compiled_model = std::make_shared<CompiledModel>(
+        batched_model, batched_config, cuda_stream_executor_, get_plugin(), loaded_from_cache_);
+    batch_scheduler_ = std::make_shared<BatchScheduler>(
+        batched_compiled_model, batch_size, std::chrono::milliseconds{config_.get_dynamic_batch_timeout()});
+}
+
+void CompiledModel::init_device_replicas(const std::shared_ptr<const ov::Model>& model) {
+    auto plugin = std::dynamic_pointer_cast<const Plugin>(get_plugin());
+    OPENVINO_ASSERT(plugin, "Model can be replicated only by NVIDIA plugin");
+    std::vector<std::shared_ptr<const ov::ICompiledModel>> replicas;
+    for (const auto device_id : config_.get_multi_device_ids()) {
+        auto replica_config = Configuration{
+            ov::AnyMap{ov::device::id(std::to_string(device_id)), ov::nvidia_gpu::multi_device_ids("")}, config_};
+        replicas.push_back(std::make_shared<CompiledModel>(
+            model, replica_config, plugin->get_stream_executor(replica_config), get_plugin(), loaded_from_cache_));
+    }
+    device_replicas_ = std::make_unique<DeviceReplicas>(std::move(replicas));
+}
+
+void CompiledModel::init_pipeline_stages(const std::shared_ptr<const ov::Model>& model) {
+    auto plugin = std::dynamic_pointer_cast<const Plugin>(get_plugin());
+    OPENVINO_ASSERT(plugin, "Model can be split into pipeline stages only by NVIDIA plugin");
+    const auto& device_ids = config_.get_pipeline_device_ids();
+    auto partition = PipelineStages::split(model, device_ids.size());
+    std::vector<std::shared_ptr<const ov::ICompiledModel>> stages;
+    std::vector<std::shared_ptr<RemoteContextImpl>> contexts;
+    for (std::size_t i = 0; i < device_ids.size(); ++i) {
+        const CUDA::Device device{device_ids[i]};
+        for (const auto& source : partition.stages[i].inputs) {
+            if (!source.stage) {
+                continue;
+            }
+            const CUDA::Device producer{device_ids[*source.stage]};
+            if (!device.canAccessPeer(producer)) {
+                throw_ov_exception(fmt::format("Device {} can't access memory of device {} peer-to-peer",
+                                               device_ids[i],
+                                               device_ids[*source.stage]));
+            }
+            device.enablePeerAccess(producer);
+        }
+        const auto device_id = ov::device::id(std::to_string(device_ids[i]));
+        auto stage_config = Configuration{
+            ov::AnyMap{device_id, ov::nvidia_gpu::pipeline_device_ids(""), ov::nvidia_gpu::dynamic_batch_size(1)},
+            config_};
+        // Stage models are cut out of the original model, so they are always transformed for their devices
+        auto stage = std::make_shared<CompiledModel>(partition.stages[i].model,
+                                                     stage_config,
+                                                     plugin->get_stream_executor(stage_config),
+                                                     get_plugin(),
+                                                     false);
+        for (std::size_t input = 0; input < partition.stages[i].inputs.size(); ++input) {
+            if (const auto& source = partition.stages[i].inputs[input]; source.stage) {
+                stage->peer_inputs_.emplace(input, device_ids[*source.stage]);
+            }
+        }
+        stages.push_back(std::move(stage));
+        contexts.push_back(plugin->get_context_impl(ov::AnyMap{device_id}));
+    }
+    pipeline_stages_ = std::make_unique<PipelineStages>(std::move(partition), std::move(stages), std::move(contexts));
+}
+
+bool CompiledModel::is_micro_batching_required(const std::shared_ptr<const ov::Model>& model) const {
+    const std::size_t micro_batch_size = config_.get_micro_batch_size();
+    if (micro_batch_size == 0 || model->is_dynamic() || !model->get_variables().empty()) {
+        return false;
+    }
+    // Only models whose batch is the first dimension of all inputs and outputs are split into micro-batches
+    std::optional<std::size_t> batch_size;
+    auto is_batched = [&](const ov::Shape& shape) {
+        if (shape.empty() || (batch_size && shape[0] != *batch_size)) {
+            return false;
+        }
+        batch_size = shape[0];
+        return true;
+    };
+    for (const auto& parameter : model->get_parameters()) {
+        if (!is_batched(parameter->get_output_shape(0))) {
+            return false;
+        }
+    }
+    for (const auto& result : model->get_results()) {
+        if (!is_batched(result->get_output_shape(0))) {
+            return false;
+        }
+    }
+    if (!batch_size || *batch_size <= micro_batch_size) {
+        return false;
+    }
+    if (*batch_size % micro_batch_size != 0) {
+        throw_ov_exception(fmt::format(
+            "Batch {} of the model isn't divisible by micro-batch size {}", *batch_size, micro_batch_size));
+    }
+    return true;
+}
+
+void CompiledModel::init_micro_batches(const std::shared_ptr<const ov::Model>& model) {
+    const std::size_t micro_batch_size = config_.get_micro_batch_size();
+    const std::size_t batch_size = model->get_parameters().front()->get_output_shape(0)[0];
+    auto micro_batch_model = model->clone();
+    std::map<ov::Output<ov::Node>, ov::PartialShape> micro_batch_shapes;
+    for (const auto& parameter : micro_batch_model->get_parameters()) {
+        auto shape = parameter->get_output_partial_shape(0);
+        shape[0] = micro_batch_size;
+        micro_batch_shapes.emplace(parameter->output(0), shape);
+    }
+    try {
+        micro_batch_model->reshape(micro_batch_shapes);
+    } catch (const ov::Exception& e) {
+        throw_ov_exception(fmt::format("Model can't be reshaped to micro-batch {}: {}", micro_batch_size, e.what()));
+    }
+    for (const auto& result : micro_batch_model->get_results()) {
+        const auto& shape = result->get_output_partial_shape(0);
+        if (shape.is_dynamic() || shape[0] != micro_batch_size) {
+            throw_ov_exception(
+                fmt::format("Outputs of the model don't follow its batch when reshaped to micro-batch {}",
+                            micro_batch_size));
+        }
+    }
+    auto micro_batch_config = Configuration{
+        ov::AnyMap{ov::nvidia_gpu::micro_batch_size(0), ov::nvidia_gpu::dynamic_batch_size(1)}, config_};
+    // Model is exported untransformed, so the model of a micro-batch is always transformed
+    auto micro_batch_compiled_model = std::make_shared<CompiledModel>(
+        micro_batch_model, micro_batch_config, cuda_stream_executor_, get_plugin(), false);
+    micro_batches_ =
+        std::make_unique<MicroBatches>(std::move(micro_batch_compiled_model), batch_size, micro_batch_size);
+}
+
+bool CompiledModel::is_tiling_required(const std::shared_ptr<const ov::Model>& model) const {
+    const std::size_t tile_size = config_.get_tile_size();
+    if (tile_size == 0 || !model->get_variables().empty() || model->get_parameters().size() != 1) {
+        return false;
+    }
+    const auto& shape = model->get_parameters().front()->get_output_partial_shape(0);
+    if (shape.rank().is_dynamic() || shape.size() != 4 || shape[0].is_dynamic() || shape[1].is_dynamic()) {
+        return false;
+    }
+    // Static images, which fit into a single tile, are executed as is
+    return shape[2].is_dynamic() || shape[3].is_dynamic() ||
+           static_cast<std::size_t>(shape[2].get_length()) > tile_size ||
+           static_cast<std::size_t>(shape[3].get_length()) > tile_size;
+}
+
+void CompiledModel::init_tiles(const std::shared_ptr<const ov::Model>& model) {
+    const std::size_t tile_size = config_.get_tile_size();
+    auto geometry = Tiles::analyze(*model);
+    // Tiles begin at multiples of strides of all outputs, so their pixels are computed at the same positions
+    // as by the whole image
+    std::size_t alignment = 1;
+    for (const auto stride : geometry.output_strides) {
+        alignment = std::lcm(alignment, stride);
+    }
+    geometry.halo = (geometry.halo + alignment - 1) / alignment * alignment;
+    if (tile_size % alignment != 0 || tile_size <= 2 * geometry.halo) {
+        throw_ov_exception(fmt::format("Tile size {} should be a multiple of {} and larger than {}, which is twice "
+                                       "the halo of the receptive field of the model",
+                                       tile_size,
+                                       alignment,
+                                       2 * geometry.halo));
+    }
+    auto tile_model = model->clone();
+    auto tile_shape = tile_model->get_parameters().front()->get_output_partial_shape(0);
+    tile_shape[2] = tile_size;
+    tile_shape[3] = tile_size;
+    try {
+        tile_model->reshape(tile_shape);
+    } catch (const ov::Exception& e) {
+        throw_ov_exception(fmt::format("Model can't be reshaped to tile {}: {}", tile_size, e.what()));
+    }
+    const auto& results = tile_model->get_results();
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& shape = results[i]->get_output_partial_shape(0);
+        const auto size = static_cast<std::int64_t>(tile_size / geometry.output_strides[i]);
+        if (shape.is_dynamic() || shape.size() != 4 || shape[2] != size || shape[3] != size) {
+            throw_ov_exception(fmt::format("Output {} of the model doesn't follow the tile {} by the stride {}",
+                                           results[i]->get_friendly_name(),
+                                           tile_size,
+                                           geometry.output_strides[i]));
+        }
+    }
+    auto tile_config = Configuration{ov::AnyMap{ov::nvidia_gpu::tile_size(0),
+                                                ov::nvidia_gpu::micro_batch_size(0),
+                                                ov::nvidia_gpu::dynamic_batch_size(1)},
+                                     config_};
+    // Model is exported untransformed, so the model of a tile is always transformed
+    auto tile_compiled_model =
+        std::make_shared<CompiledModel>(tile_model, tile_config, cuda_stream_executor_, get_plugin(), false);
+    tiles_ = std::make_unique<Tiles>(std::move(tile_compiled_model), tile_size, std::move(geometry));
 }
 
 CompiledModel::~CompiledModel() {
+    stop_infer_requests_refinement_ = true;
+    if (infer_requests_refinement_.valid()) {
+        infer_requests_refinement_.wait();
+    }
+    if (background_tuning_.valid()) {
+        background_tuning_.wait();
+    }
     get_plugin()->get_executor_manager()->clear(nv_stream_executor_name);
     get_plugin()->get_executor_manager()->clear(nv_callback_executor_name);
 }
@@ -100,13 +396,32 @@ void CompiledModel::compile_model(const std::shared_ptr<const ov::Model>& model)
     GraphTransformer transformer;
     // Clone model
     model_ = model->clone();
-    if (!loaded_from_cache_) {
+    // States of variables are kept by infer requests of the model itself
+    OPENVINO_ASSERT(model->get_variables().empty() || (config_.get_multi_device_ids().size() <= 1 &&
+                                                       config_.get_pipeline_device_ids().size() <= 1 &&
+                                                       !model->is_dynamic()),
+                    "Stateful models are supported only if they are static and compiled for a single device");
+    if (config_.get_multi_device_ids().size() > 1) {
+        // Model is kept as is, each replica is transformed and compiled for its own device
+        init_device_replicas(model);
+    } else if (config_.get_pipeline_device_ids().size() > 1) {
+        // Model is kept as is, so it is exported untransformed, each stage is transformed for its own device
+        init_pipeline_stages(model);
+    } else if (is_tiling_required(model)) {
+        // Model is kept as is, the model of a tile is transformed and compiled on its own
+        init_tiles(model);
+    } else if (is_micro_batching_required(model)) {
+        // Model is kept as is, the model of a micro-batch is transformed and compiled on its own
+        init_micro_batches(model);
+    } else if (model->is_dynamic()) {
+        // Dynamic model is kept as is, static models of shape buckets are transformed and compiled on demand
+        shape_buckets_ = std::make_unique<ShapeBuckets>(model, config_, cuda_stream_executor_, get_plugin());
+    } else if (!loaded_from_cache_) {
         // Apply transformations pipeline
+        OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "GraphTransformer::transform");
+        const CUDA::NvtxRange nvtxRange{"Transform model"};
         transformer.transform(device, model_, config_);
     }
-    if (model->is_dynamic()) {
-        throw_ov_exception("Dynamic models are not supported by NVIDIA plugin yet!");
-    }
     // Generate backend specific blob mappings. For example Inference Engine uses not ov::Result nodes friendly name
     // as inference request output names but the name of the layer before.
     for (auto& result : model_->get_results()) {
@@ -124,29 +439,184 @@ void CompiledModel::compile_model(const std::shared_ptr<const ov::Model>& model)
     // Integrate performance counters to the compiled model
     for (const auto& op : model_->get_ops()) {
         auto& rt_info = op->get_rt_info();
-        rt_info[ov::nvidia_gpu::PERF_COUNTER_NAME] = std::make_shared<ov::nvidia_gpu::PerfCounts>();
+        auto perf_counts = std::make_shared<ov::nvidia_gpu::PerfCounts>();
+        perf_counts->flops = utils::estimateFlops(*op);
+        perf_counts->bytes = utils::estimateBytes(*op);
+        rt_info[ov::nvidia_gpu::PERF_COUNTER_NAME] = perf_counts;
+    }
+    if (shape_buckets_ || device_replicas_ || pipeline_stages_ || micro_batches_ || tiles_) {
+        return;
     }
 
     // Perform any other steps like allocation and filling backend specific memory handles and so on
-    const bool opBenchOption = config_.get(ov::nvidia_gpu::operation_benchmark.name()).as<bool>();
-    const auto creationContext = CreationContext{device, opBenchOption};
+    if (!tuning_cache_) {
+        // Models of the same topology (e.g. fine-tuned versions of a model) share selected algorithms,
+        // so the model which differs only in weights is compiled without benchmarks
+        tuning_cache_ = TuningCache::createForModel(config_.get_cache_dir(), device, topologyHash(*model_));
+    }
+    // Operations are benchmarked later in background, if background tuning is enabled
+    const bool opBenchOption = config_.get(ov::nvidia_gpu::operation_benchmark.name()).as<bool>() &&
+                               !is_background_tuning_required();
+    topology_runner_ = create_topology_runner(create_creation_context(opBenchOption), model_);
+    if (!config_.get_memory_layout_file().empty()) {
+        writeMemoryLayout(config_.get_memory_layout_file(), topology_runner_->GetSubGraph().memoryLayout());
+    }
+    memory_pool_ = create_memory_pool(*topology_runner_);
+}
 
+CreationContext CompiledModel::create_creation_context(const bool opBenchOption) const {
+    CUDA::Device device{config_.get_device_id()};
+    const auto memoryBudget = config_.get_memory_budget(device.props().totalGlobalMem);
+    CreationOptions options;
+    options.bind_io_tensors = config_.get(ov::nvidia_gpu::bind_io_tensors.name()).as<bool>();
+    options.memory_aware_ordering = config_.get(ov::nvidia_gpu::memory_aware_ordering.name()).as<bool>();
+    options.max_workspace_size = memoryBudget == std::numeric_limits<size_t>::max()
+                                     ? memoryBudget
+                                     : memoryBudget / memory_budget_part_per_workspace;
+    if (config_.is_constants_offload_enabled()) {
+        size_t free;
+        size_t total;
+        throwIfError(cudaMemGetInfo(&free, &total));
+        options.constants_offload_limit = std::min(free, memoryBudget);
+    }
+    options.tuning_cache = tuning_cache_;
+    options.compilation_num_threads = config_.get_compilation_num_threads();
+    options.persistent_kernel_max_elements = config_.get_persistent_kernel_max_elements();
+    options.memory_layout = !config_.get_memory_layout_file().empty();
+    options.tf32 = config_.get_execution_mode() == ov::hint::ExecutionMode::PERFORMANCE && device.props().major >= 8;
+    options.parallel_branches = config_.get_parallel_branches();
+    options.fast_math = config_.is_fast_math_enabled();
+    options.ipc_constants_dir = config_.get_ipc_constants_dir();
+    return CreationContext{device, opBenchOption, std::move(options)};
+}
+
+std::shared_ptr<ITopologyRunner> CompiledModel::create_topology_runner(
+    const CreationContext& creationContext, const std::shared_ptr<const ov::Model>& model) const {
     if (use_cuda_graph_) {
-        auto cudaGraphTopologyRunner = std::make_unique<CudaGraphTopologyRunner>(creationContext, model_);
-        number_of_cuda_graphs_ = cudaGraphTopologyRunner->GetCudaGraphsCount();
-        topology_runner_ = std::move(cudaGraphTopologyRunner);
-    } else {
-        topology_runner_ = std::make_unique<EagerTopologyRunner>(creationContext, model_);
+        return std::make_shared<CudaGraphTopologyRunner>(creationContext, model, !config_.is_profiler_required());
+    }
+    return std::make_shared<EagerTopologyRunner>(creationContext, model);
+}
+
+bool CompiledModel::is_background_tuning_required() const {
+    // Profiler of an infer request is bound to operations of the topology runner, so it can't be replaced
+    return config_.is_background_tuning_enabled() &&
+           config_.get(ov::nvidia_gpu::operation_benchmark.name()).as<bool>() &&
+           !config_.is_profiler_required() && !shape_buckets_ && !device_replicas_ &&
+           !pipeline_stages_ && !micro_batches_ && !tiles_;
+}
+
+void CompiledModel::tune_in_background() {
+    // Inferences are executed concurrently, so benchmarks measure the device which is partially busy
+    auto topology_runner = create_topology_runner(create_creation_context(true), model_);
+    auto memory_pool = create_memory_pool(*topology_runner);
+    const auto max_number_of_requests = static_cast<unsigned>(memory_pool->Size());
+    memory_pool->Resize(std::min(memory_pool->Size(), get_executable().memory_pool->Size()));
+    {
+        // Inferences in flight keep the previous topology runner and memory pool until they are completed
+        std::lock_guard<std::mutex> lock{executable_mtx_};
+        topology_runner_ = std::move(topology_runner);
+        memory_pool_ = std::move(memory_pool);
+    }
+    background_tuning_completed_ = true;
+    if (config_.is_infer_requests_refinement_enabled() && config_.auto_streams_detection_required() &&
+        !stop_infer_requests_refinement_) {
+        refine_optimal_number_of_requests(max_number_of_requests);
     }
+}
 
-    memory_pool_ = create_memory_pool();
+void CompiledModel::update_weights(const std::shared_ptr<const ov::Model>& model) {
+    OPENVINO_ASSERT(model, "Model with new weights is empty");
+    // Profiler of an infer request is bound to operations of the topology runner, so it can't be replaced
+    OPENVINO_ASSERT(!config_.is_profiler_required(), "Weights can't be updated for profiled models");
+    std::lock_guard<std::mutex> update_lock{weights_update_mtx_};
+    // Background tuning would replace the topology runner by the one compiled with previous weights
+    if (background_tuning_.valid()) {
+        background_tuning_.wait();
+    }
+    const auto previous = get_executable();
+    OPENVINO_ASSERT(previous.topology_runner,
+                    "Weights can't be updated for models executed by shape buckets, device replicas, pipeline stages, "
+                    "micro-batches or tiles");
+    CUDA::Device device{config_.get_device_id()};
+    auto weights_model = model->clone();
+    GraphTransformer{}.transform(device, weights_model, config_);
+    if (topologyHash(*weights_model) != topologyHash(*model_)) {
+        throw_ov_exception(fmt::format("Topology of model {} with new weights differs from the compiled model",
+                                       model->get_friendly_name()));
+    }
+    // Algorithms are taken from the tuning cache of the topology, so operations aren't benchmarked again.
+    // Constants are uploaded alongside the previous ones, which are released with the previous topology runner
+    auto topology_runner = create_topology_runner(create_creation_context(false), weights_model);
+    auto memory_pool = create_memory_pool(*topology_runner);
+    // Blocks are allocated on demand, so the capacity of the previous pool is kept, while its blocks are released
+    // by inferences in flight
+    memory_pool->Resize(previous.memory_pool->Size());
+    {
+        // Inferences in flight keep the previous topology runner and memory pool until they are completed
+        std::lock_guard<std::mutex> lock{executable_mtx_};
+        topology_runner_ = std::move(topology_runner);
+        memory_pool_ = std::move(memory_pool);
+        weights_model_ = std::move(weights_model);
+    }
 }
 
-void CompiledModel::benchmark_optimal_number_of_requests() {
-    if (!config_.auto_streams_detection_required()) {
+void CompiledModel::estimate_optimal_number_of_requests() {
+    if (!config_.auto_streams_detection_required() || shape_buckets_ || device_replicas_ || pipeline_stages_ ||
+        micro_batches_ || tiles_) {
         return;
     }
+    const auto max_number_of_requests = static_cast<unsigned>(memory_pool_->Size());
+    const auto key = get_infer_requests_tuning_key(max_number_of_requests);
+    if (const auto cached = tuning_cache_->find(key)) {
+        try {
+            memory_pool_->Resize(std::min<size_t>(std::stoul(*cached), max_number_of_requests));
+            return;
+        } catch (const std::exception&) {
+            // Malformed entry is replaced by the new estimate
+        }
+    }
+
+    create_benchmark_infer_request()->infer();
+
+    // Throughput grows with the number of concurrent infer requests until the device becomes busy,
+    // so the optimal number is the one which reaches the throughput of all infer requests the memory allows
+    std::mutex mtx;
+    std::condition_variable cond_var;
+    const auto single_fps = std::max(run_benchmark_for(1, mtx, cond_var), 1u);
+    const auto max_fps = max_number_of_requests > 1 ? run_benchmark_for(max_number_of_requests, mtx, cond_var)
+                                                    : single_fps;
+    constexpr auto kMaxFpsRelativeDiff = 0.01;
+    const auto saturation = (1 - kMaxFpsRelativeDiff) * max_fps / single_fps;
+    const auto optimal_number_of_requests =
+        std::clamp(static_cast<unsigned>(std::ceil(saturation)), 1u, max_number_of_requests);
+    memory_pool_->Resize(optimal_number_of_requests);
+    tuning_cache_->store(key, std::to_string(optimal_number_of_requests));
+
+    // Background tuning refines the number of infer requests of its own memory pool
+    if (config_.is_infer_requests_refinement_enabled() && !is_background_tuning_required()) {
+        infer_requests_refinement_ = std::async(std::launch::async, [this, max_number_of_requests] {
+            try {
+                refine_optimal_number_of_requests(max_number_of_requests);
+            } catch (...) {
+                // The estimated number of infer requests is kept if the refinement fails
+            }
+        });
+    }
+}
 
+std::string CompiledModel::get_infer_requests_tuning_key(const unsigned max_number_of_requests) const {
+    const auto topology_runner = get_executable().topology_runner;
+    const auto& memory_manager = *topology_runner->GetSubGraph().memoryManager();
+    return fmt::format("infer_requests:{}:{}:{}:{}:{}",
+                       model_->get_friendly_name(),
+                       model_->get_ops().size(),
+                       memory_manager.immutableTensors().memoryModel()->deviceMemoryBlockSize(),
+                       memory_manager.mutableTensorsMemoryModel()->deviceMemoryBlockSize(),
+                       max_number_of_requests);
+}
+
+void CompiledModel::refine_optimal_number_of_requests(const unsigned max_number_of_requests) {
     struct BenchmarkResult {
         unsigned numberOfInferRequests;
         unsigned fps;
@@ -154,22 +624,23 @@ void CompiledModel::benchmark_optimal_number_of_requests() {
         bool operator<(const BenchmarkResult& other) const { return other.fps < this->fps; }
     };
 
-    auto start = Time::now();
-
-    create_benchmark_infer_request()->infer();
-
-    auto numMemManagers = memory_pool_->Size();
+    const auto estimated_number_of_requests = memory_pool_->Size();
+    memory_pool_->Resize(max_number_of_requests);
     std::mutex mtx;
     std::condition_variable cond_var;
 
     constexpr auto kTimesBenchmarkRun = 3;
     std::vector<BenchmarkResult> benchmarks;
-    benchmarks.reserve(numMemManagers);
-    for (unsigned numInfers = 1; numInfers <= numMemManagers; ++numInfers) {
+    benchmarks.reserve(max_number_of_requests);
+    for (unsigned numInfers = 1; numInfers <= max_number_of_requests; ++numInfers) {
         std::array<unsigned, kTimesBenchmarkRun> allFps{};
-        std::for_each(allFps.begin(), allFps.end(), [this, &mtx, &cond_var, &numInfers](auto& fps) {
+        for (auto& fps : allFps) {
+            if (stop_infer_requests_refinement_) {
+                memory_pool_->Resize(estimated_number_of_requests);
+                return;
+            }
             fps = run_benchmark_for(numInfers, mtx, cond_var);
-        });
+        }
         const unsigned fps = std::accumulate(allFps.begin(), allFps.end(), 0) / allFps.size();
         benchmarks.push_back({numInfers, fps});
     }
@@ -197,15 +668,33 @@ void CompiledModel::benchmark_optimal_number_of_requests() {
             optimalBenchmarkResult = benchmark;
         }
     }
-    //fmt::print("Optimal number infer-requests = {}\n", optimalBenchmarkResult.numberOfInferRequests);
-    if (optimalBenchmarkResult.numberOfInferRequests < numMemManagers) {
-        memory_pool_->Resize(optimalBenchmarkResult.numberOfInferRequests);
-        //fmt::print(
-        //    "Resize MemoryManagerPool from {} to {}\n", numMemManagers, optimalBenchmarkResult.numberOfInferRequests);
+    memory_pool_->Resize(optimalBenchmarkResult.numberOfInferRequests);
+    tuning_cache_->store(get_infer_requests_tuning_key(max_number_of_requests),
+                         std::to_string(optimalBenchmarkResult.numberOfInferRequests));
+}
+
+void CompiledModel::warm_up() {
+    const auto memory_pool = get_executable().memory_pool;
+    if (!memory_pool) {
+        return;
+    }
+    // Blocks which are already warmed up are held, so that the next inference has to take a new one.
+    // Inferences are executed one by one, as graphs of the first two blocks are captured and the rest relocate them
+    CancellationToken cancellation_token;
+    std::vector<MemoryPool::Proxy> warmed_up_blocks;
+    const auto num_blocks = memory_pool->Size();
+    warmed_up_blocks.reserve(num_blocks);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        auto request = create_benchmark_infer_request();
+        // Zeros are valid indices for operations like Gather, while memory of new tensors is uninitialized
+        for (const auto& input : inputs()) {
+            const auto tensor = request->get_tensor(input);
+            std::memset(tensor->data(), 0, tensor->get_byte_size());
+        }
+        request->infer();
+        request.reset();
+        warmed_up_blocks.push_back(memory_pool->WaitAndGet(cancellation_token));
     }
-    [[maybe_unused]] auto duration = Time::now() - start;
-    [[maybe_unused]] auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
-    //fmt::print("Time of benchmark for optimal number infer-requests = {} ms\n", durationMs.count());
 }
 
 unsigned int CompiledModel::run_benchmark_for(const int numInfers,
@@ -243,10 +732,17 @@ size_t CompiledModel::get_optimal_number_of_streams(size_t const_blob_size,
     CUDA::Device device{config_.get_device_id()};
     device.setCurrent();
     size_t free;
-    [[maybe_unused]] size_t total;
+    size_t total;
     throwIfError(cudaMemGetInfo(&free, &total));
     const size_t max_streams_supported = max_concurrent_streams(device);
-    const auto available_infer_requests = (free - const_blob_size) / memory_blob_size;
+    const size_t available_memory = std::min(free, config_.get_memory_budget(total));
+    if (available_memory <= const_blob_size) {
+        throw_ov_exception(fmt::format("Not enough memory even for constants of the model: {} bytes available, "
+                                       "{} bytes required",
+                                       available_memory,
+                                       const_blob_size));
+    }
+    const auto available_infer_requests = (available_memory - const_blob_size) / memory_blob_size;
     if (0 == available_infer_requests) {
         throw_ov_exception("Not enough memory even for single InferRequest!");
     }
@@ -254,14 +750,21 @@ size_t CompiledModel::get_optimal_number_of_streams(size_t const_blob_size,
     return std::min({max_streams_supported, available_infer_requests, num_streams});
 }
 
-std::shared_ptr<MemoryPool> CompiledModel::create_memory_pool() {
-    const auto& memory_manager = *(topology_runner_->GetSubGraph().memoryManager());
+std::shared_ptr<MemoryPool> CompiledModel::create_memory_pool(const ITopologyRunner& topology_runner) {
+    const auto& memory_manager = *(topology_runner.GetSubGraph().memoryManager());
     const auto const_blob_size = memory_manager.immutableTensors().memoryModel()->deviceMemoryBlockSize();
     const auto immutable_work_buffers_size = memory_manager.immutableWorkbuffers().memoryModel()->deviceMemoryBlockSize();
     const auto& memory_model = memory_manager.mutableTensorsMemoryModel();
     const auto memory_blob_size = memory_model->deviceMemoryBlockSize();
     const auto num_streams = get_optimal_number_of_streams(const_blob_size + immutable_work_buffers_size, memory_blob_size);
-    return std::make_shared<MemoryPool>(num_streams, memory_model);
+    // Only memory of a single infer request is allocated upfront, the rest is allocated by inferences on demand,
+    // so that models compiled for the same device don't take memory which might be never used
+    return std::make_shared<MemoryPool>(num_streams,
+                                        memory_model,
+                                        1,
+                                        config_.get_memory_pool_idle_timeout(),
+                                        config_.get_memory_pool_wait_timeout(),
+                                        memory_arenas_);
 }
 
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_benchmark_sync_infer_request() {
@@ -289,14 +792,30 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
         std::static_pointer_cast<CudaInferRequest>(internal_request),
         get_task_executor(),
         cuda_stream_executor_,
-        get_callback_executor());
+        get_callback_executor(),
+        batch_scheduler_);
 }
 
 void CompiledModel::set_property(const ov::AnyMap& properties) {
-    config_ = Configuration{properties, config_};
+    auto config = properties;
+    if (const auto update = config.find(ov::nvidia_gpu::weights_update.name()); update != config.end()) {
+        update_weights(update->second.as<std::shared_ptr<ov::Model>>());
+        config.erase(update);
+    }
+    std::lock_guard lock{config_mtx_};
+    config_ = Configuration{config, config_};
+    skipped_outputs_ = std::make_shared<const std::vector<std::string>>(config_.get_skipped_outputs());
+}
+
+std::shared_ptr<const std::vector<std::string>> CompiledModel::get_skipped_outputs() const {
+    std::lock_guard lock{config_mtx_};
+    return skipped_outputs_;
 }
 
 ov::Any CompiledModel::get_property(const std::string& name) const {
+    // Topology runner and memory pool may be replaced by background tuning concurrently
+    const auto [topology_runner, memory_pool] = get_executable();
+    std::lock_guard lock{config_mtx_};
     if (ov::supported_properties == name) {
         std::vector<ov::PropertyName> supported_properties;
         supported_properties.push_back(ov::PropertyName(ov::supported_properties.name(), PropertyMutability::RO));
@@ -307,6 +826,63 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         supported_properties.push_back(ov::PropertyName(ov::loaded_from_cache.name(), PropertyMutability::RO));
         supported_properties.push_back(ov::PropertyName(ov::nvidia_gpu::number_of_cuda_graphs.name(),
                                        PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::cuda_graph_capture_hits.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::background_tuning_completed.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::cuda_graph_capture_misses.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::cuda_graph_recaptures.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::cuda_graph_launches.name(), PropertyMutability::RO));
+        supported_properties.push_back(ov::PropertyName(ov::nvidia_gpu::eager_launches.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::latency_percentiles.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::hardware_metrics.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::default_order_tensors_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::tensors_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::constants_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::offloaded_constants_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::immutable_workbuffers_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::infer_request_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::mutable_workbuffers_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::shared_mutable_workbuffers_memory_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::number_of_memory_blocks.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_queue_depth.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_max_queue_depth.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_average_wait_time.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_max_wait_time.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_wait_timeouts.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_busy_blocks.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_free_blocks.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_total_wait_time.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::inflight_requests.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::expired_requests.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::thread_pool_queue_length.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::operations_memory_usage.name(), PropertyMutability::RO));
         auto rw_properties = config_.get_rw_properties();
         for (auto& rw_property : rw_properties)
             supported_properties.emplace_back(ov::PropertyName(rw_property, PropertyMutability::RO));
@@ -328,14 +904,141 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         auto model_name = model_->get_friendly_name();
         return decltype(ov::model_name)::value_type{model_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
-        const unsigned value = memory_pool_->Size();
+        const unsigned value = memory_pool        ? memory_pool->Size()
+                               : device_replicas_  ? device_replicas_->get_optimal_number_of_infer_requests()
+                               : pipeline_stages_ ? pipeline_stages_->get_optimal_number_of_infer_requests()
+                               : micro_batches_   ? micro_batches_->get_optimal_number_of_infer_requests()
+                               : tiles_           ? tiles_->get_optimal_number_of_infer_requests()
+                                                   : config_.get_optimal_number_of_streams();
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
+        if (device_replicas_ || pipeline_stages_) {
+            decltype(ov::execution_devices)::value_type devices;
+            const auto& device_ids =
+                device_replicas_ ? config_.get_multi_device_ids() : config_.get_pipeline_device_ids();
+            for (const auto device_id : device_ids) {
+                devices.push_back(get_plugin()->get_device_name() + "." + std::to_string(device_id));
+            }
+            return devices;
+        }
         return decltype(ov::execution_devices)::value_type{get_plugin()->get_device_name() + "." + std::to_string(config_.get_device_id())};
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{loaded_from_cache_};
     } else if (ov::nvidia_gpu::number_of_cuda_graphs == name) {
-        return decltype(ov::nvidia_gpu::number_of_cuda_graphs)::value_type{number_of_cuda_graphs_};
+        const auto* runner = dynamic_cast<const CudaGraphTopologyRunner*>(topology_runner.get());
+        return decltype(ov::nvidia_gpu::number_of_cuda_graphs)::value_type{runner ? runner->GetCudaGraphsCount() : 0};
+    } else if (ov::nvidia_gpu::background_tuning_completed == name) {
+        return decltype(ov::nvidia_gpu::background_tuning_completed)::value_type{background_tuning_completed_};
+    } else if (ov::nvidia_gpu::cuda_graph_capture_hits == name) {
+        const auto* runner = dynamic_cast<const CudaGraphTopologyRunner*>(topology_runner.get());
+        return decltype(ov::nvidia_gpu::cuda_graph_capture_hits)::value_type{runner ? runner->GetCaptureHits() : 0};
+    } else if (ov::nvidia_gpu::cuda_graph_capture_misses == name) {
+        const auto* runner = dynamic_cast<const CudaGraphTopologyRunner*>(topology_runner.get());
+        return decltype(ov::nvidia_gpu::cuda_graph_capture_misses)::value_type{runner ? runner->GetCaptureMisses()
+                                                                                      : 0};
+    } else if (ov::nvidia_gpu::cuda_graph_recaptures == name) {
+        const auto* runner = dynamic_cast<const CudaGraphTopologyRunner*>(topology_runner.get());
+        return decltype(ov::nvidia_gpu::cuda_graph_recaptures)::value_type{runner ? runner->GetRecaptures() : 0};
+    } else if (ov::nvidia_gpu::cuda_graph_launches == name) {
+        return decltype(ov::nvidia_gpu::cuda_graph_launches)::value_type{
+            topology_runner ? topology_runner->GetGraphLaunches() : 0};
+    } else if (ov::nvidia_gpu::eager_launches == name) {
+        return decltype(ov::nvidia_gpu::eager_launches)::value_type{
+            topology_runner ? topology_runner->GetEagerLaunches() : 0};
+    } else if (ov::nvidia_gpu::latency_percentiles == name) {
+        auto percentiles = stage_latencies_->summaries();
+        for (const auto& op : model_->get_ordered_ops()) {
+            const auto& info = op->get_rt_info();
+            const auto it = info.find(ov::nvidia_gpu::PERF_COUNTER_NAME);
+            if (it == info.end()) {
+                continue;
+            }
+            if (auto summary = it->second.as<std::shared_ptr<PerfCounts>>()->latency.summary(); !summary.empty()) {
+                percentiles.emplace(op->get_friendly_name(), std::move(summary));
+            }
+        }
+        return decltype(ov::nvidia_gpu::latency_percentiles)::value_type{std::move(percentiles)};
+    } else if (ov::nvidia_gpu::hardware_metrics == name) {
+        std::map<std::string, std::vector<double>> metrics;
+        for (const auto& op : model_->get_ordered_ops()) {
+            const auto& info = op->get_rt_info();
+            const auto it = info.find(ov::nvidia_gpu::PERF_COUNTER_NAME);
+            if (it == info.end()) {
+                continue;
+            }
+            if (auto averages = it->second.as<std::shared_ptr<PerfCounts>>()->hardware_metrics.averages();
+                !averages.empty()) {
+                metrics.emplace(op->get_friendly_name(), std::move(averages));
+            }
+        }
+        return decltype(ov::nvidia_gpu::hardware_metrics)::value_type{std::move(metrics)};
+    } else if (ov::nvidia_gpu::default_order_tensors_memory_size == name) {
+        const auto size = topology_runner ? topology_runner->GetSubGraph().defaultOrderTensorsMemorySize() : 0;
+        return decltype(ov::nvidia_gpu::default_order_tensors_memory_size)::value_type{size};
+    } else if (ov::nvidia_gpu::tensors_memory_size == name) {
+        const auto size = topology_runner ? topology_runner->GetSubGraph().tensorsMemorySize() : 0;
+        return decltype(ov::nvidia_gpu::tensors_memory_size)::value_type{size};
+    } else if (ov::nvidia_gpu::offloaded_constants_memory_size == name) {
+        const auto size = topology_runner ? topology_runner->GetSubGraph().offloadedConstantsMemorySize() : 0;
+        return decltype(ov::nvidia_gpu::offloaded_constants_memory_size)::value_type{size};
+    } else if (ov::nvidia_gpu::constants_memory_size == name ||
+               ov::nvidia_gpu::immutable_workbuffers_memory_size == name ||
+               ov::nvidia_gpu::infer_request_memory_size == name) {
+        if (!topology_runner) {
+            return size_t{0};
+        }
+        const auto& memory_manager = *topology_runner->GetSubGraph().memoryManager();
+        const auto& memory_model = ov::nvidia_gpu::constants_memory_size == name
+                                       ? memory_manager.immutableTensors().memoryModel()
+                                   : ov::nvidia_gpu::immutable_workbuffers_memory_size == name
+                                       ? memory_manager.immutableWorkbuffers().memoryModel()
+                                       : memory_manager.mutableTensorsMemoryModel();
+        return size_t{memory_model->deviceMemoryBlockSize()};
+    } else if (ov::nvidia_gpu::mutable_workbuffers_memory_size == name) {
+        const auto size = topology_runner ? topology_runner->GetSubGraph().mutableWorkbuffersMemorySize() : 0;
+        return decltype(ov::nvidia_gpu::mutable_workbuffers_memory_size)::value_type{size};
+    } else if (ov::nvidia_gpu::shared_mutable_workbuffers_memory_size == name) {
+        const auto size = topology_runner ? topology_runner->GetSubGraph().sharedMutableWorkbuffersMemorySize() : 0;
+        return decltype(ov::nvidia_gpu::shared_mutable_workbuffers_memory_size)::value_type{size};
+    } else if (ov::nvidia_gpu::number_of_memory_blocks == name) {
+        return decltype(ov::nvidia_gpu::number_of_memory_blocks)::value_type{
+            memory_pool ? memory_pool->NumAllocated() : 0};
+    } else if (ov::nvidia_gpu::memory_pool_queue_depth == name ||
+               ov::nvidia_gpu::memory_pool_max_queue_depth == name ||
+               ov::nvidia_gpu::memory_pool_wait_timeouts == name) {
+        const auto statistics = memory_pool ? memory_pool->GetWaitStatistics() : MemoryPool::WaitStatistics{};
+        return size_t{ov::nvidia_gpu::memory_pool_queue_depth == name       ? statistics.queueDepth
+                      : ov::nvidia_gpu::memory_pool_max_queue_depth == name ? statistics.maxQueueDepth
+                                                                            : statistics.numTimeouts};
+    } else if (ov::nvidia_gpu::memory_pool_busy_blocks == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_busy_blocks)::value_type{memory_pool ? memory_pool->NumBusy() : 0};
+    } else if (ov::nvidia_gpu::memory_pool_free_blocks == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_free_blocks)::value_type{memory_pool ? memory_pool->NumFree() : 0};
+    } else if (ov::nvidia_gpu::memory_pool_total_wait_time == name) {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        return Milliseconds{memory_pool ? memory_pool->TotalWaitTime() : std::chrono::microseconds{0}}.count();
+    } else if (ov::nvidia_gpu::inflight_requests == name) {
+        return decltype(ov::nvidia_gpu::inflight_requests)::value_type{
+            inflight_requests_.load(std::memory_order_relaxed)};
+    } else if (ov::nvidia_gpu::expired_requests == name) {
+        return decltype(ov::nvidia_gpu::expired_requests)::value_type{
+            expired_requests_.load(std::memory_order_relaxed)};
+    } else if (ov::nvidia_gpu::thread_pool_queue_length == name) {
+        const auto thread_pool = std::dynamic_pointer_cast<CudaThreadPool>(cuda_stream_executor_);
+        return decltype(ov::nvidia_gpu::thread_pool_queue_length)::value_type{
+            thread_pool ? thread_pool->queue_length() : 0};
+    } else if (ov::nvidia_gpu::memory_pool_average_wait_time == name ||
+               ov::nvidia_gpu::memory_pool_max_wait_time == name) {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        const auto statistics = memory_pool ? memory_pool->GetWaitStatistics() : MemoryPool::WaitStatistics{};
+        if (ov::nvidia_gpu::memory_pool_max_wait_time == name) {
+            return Milliseconds{statistics.maxWaitTime}.count();
+        }
+        const auto numWaits = statistics.numWaits + statistics.numTimeouts;
+        return numWaits == 0 ? 0.0 : Milliseconds{statistics.totalWaitTime}.count() / numWaits;
+    } else if (ov::nvidia_gpu::operations_memory_usage == name) {
+        return topology_runner ? topology_runner->GetSubGraph().liveMemorySizes()
+                                : decltype(ov::nvidia_gpu::operations_memory_usage)::value_type{};
     } else {
         return config_.get(name);
     }
@@ -343,6 +1046,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
     auto model = model_->clone();
+    const utils::DevicePeak peak{CUDA::Device{config_.get_device_id()}.props()};
     // Add execution information into the model
     size_t exec_order = 0;
     for (const auto& op : model->get_ordered_ops()) {
@@ -353,11 +1057,34 @@ std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
         OPENVINO_ASSERT(perf_count, "Performance counter is empty");
         info[ov::exec_model_info::LAYER_TYPE] = op->get_type_info().name;
         info[ov::exec_model_info::EXECUTION_ORDER] = std::to_string(exec_order++);
-        info[ov::exec_model_info::IMPL_TYPE] = perf_count->impl_type;
+        // Implementation selected by benchmarks is reported even if the model isn't profiled
+        const auto implementation = info.find(IMPLEMENTATION_NAME);
+        info[ov::exec_model_info::IMPL_TYPE] = perf_count->impl_type.empty() && implementation != info.end()
+                                                   ? implementation->second.as<std::string>()
+                                                   : perf_count->impl_type;
         auto perf_count_enabled = config_.get(ov::enable_profiling.name()).as<bool>();
         info[ov::exec_model_info::PERF_COUNTER] = perf_count_enabled && perf_count->average() != 0
                                                       ? std::to_string(perf_count->average())
                                                       : "not_executed";
+        info[ESTIMATED_FLOPS] = fmt::format("{:.0f}", perf_count->flops);
+        info[ESTIMATED_BYTES] = fmt::format("{:.0f}", perf_count->bytes);
+        if (perf_count->bytes > 0) {
+            const auto intensity = perf_count->flops / perf_count->bytes;
+            info[ARITHMETIC_INTENSITY] = fmt::format("{:.3f}", intensity);
+            info[ROOFLINE_BOUND] = intensity < peak.ridgePoint() ? "memory" : "compute";
+            // Fraction of the roofline achieved by the average execution, ops far below 1 are inefficient
+            info[PEAK_FRACTION] = perf_count_enabled && perf_count->average() != 0
+                                      ? fmt::format("{:.3f}",
+                                                    peak.fraction(perf_count->flops,
+                                                                  perf_count->bytes,
+                                                                  perf_count->average() / 1e6))
+                                      : "not_executed";
+        }
+        if (const auto averages = perf_count->hardware_metrics.averages(); !averages.empty()) {
+            for (size_t i = 0; i < HARDWARE_METRICS.size() && i < averages.size(); ++i) {
+                info[HARDWARE_METRICS[i].name] = fmt::format("{:.1f}", averages[i]);
+            }
+        }
 
         std::string original_names = ov::getFusedNames(op);
         if (original_names.empty()) {
@@ -380,19 +1107,41 @@ std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
 
 void CompiledModel::export_model(std::ostream& model_stream) const {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CompiledModel::export_model");
+    // Parameters and Results of the transformed model are in the precision of the device, so the imported model
+    // would have other ports
+    OPENVINO_ASSERT(!config_.is_device_precision_io_enabled(),
+                    "Models compiled with ",
+                    ov::nvidia_gpu::device_precision_io.name(),
+                    " can't be exported");
+    if (device_replicas_) {
+        // Transformed model is the same for all replicas
+        device_replicas_->get_replica(0)->export_model(model_stream);
+        return;
+    }
 
+    std::shared_ptr<ov::Model> exported_model;
+    {
+        std::lock_guard<std::mutex> lock{executable_mtx_};
+        exported_model = weights_model_ ? weights_model_ : model_;
+    }
     std::stringstream xml_file, bin_file;
     int64_t version = 11;
-    if (model_->has_rt_info("version")) {
-        version = model_->get_rt_info<int64_t>("version");
+    if (exported_model->has_rt_info("version")) {
+        version = exported_model->get_rt_info<int64_t>("version");
     }
 
     ov::pass::Serialize serializer(xml_file, bin_file, static_cast<ov::pass::Serialize::Version>(version));
-    serializer.run_on_model(model_);
+    serializer.run_on_model(exported_model);
 
     auto weights = bin_file.str();
     auto model = xml_file.str();
 
+    const auto props = CUDA::Device{config_.get_device_id()}.props();
+    const std::int32_t compute_capability[] = {props.major, props.minor};
+    model_stream.write(reinterpret_cast<const char*>(&export_magic), sizeof(export_magic));
+    model_stream.write(reinterpret_cast<const char*>(&export_version), sizeof(export_version));
+    model_stream.write(reinterpret_cast<const char*>(compute_capability), sizeof(compute_capability));
+
     auto data_size = static_cast<std::uint64_t>(model.size());
     model_stream.write(reinterpret_cast<char*>(&data_size), sizeof(data_size));
     model_stream.write(model.c_str(), data_size);
@@ -400,14 +1149,54 @@ void CompiledModel::export_model(std::ostream& model_stream) const {
     data_size = static_cast<std::uint64_t>(weights.size());
     model_stream.write(reinterpret_cast<char*>(&data_size), sizeof(data_size));
     model_stream.write(reinterpret_cast<char*>(&weights[0]), data_size);
+
+    // Weights are exported already transformed (e.g. converted or compressed) and the transformations aren't
+    // applied on import, algorithms of operations are exported, so that they aren't benchmarked again
+    std::stringstream tuning_file;
+    if (tuning_cache_) {
+        tuning_cache_->write(tuning_file);
+    }
+    const auto tuning = tuning_file.str();
+    data_size = static_cast<std::uint64_t>(tuning.size());
+    model_stream.write(reinterpret_cast<char*>(&data_size), sizeof(data_size));
+    model_stream.write(tuning.c_str(), data_size);
+}
+
+CompiledModel::Executable CompiledModel::get_executable() const {
+    std::lock_guard<std::mutex> lock{executable_mtx_};
+    return {topology_runner_, memory_pool_};
 }
 
 const ITopologyRunner& CompiledModel::get_topology_runner() const {
+    std::lock_guard<std::mutex> lock{executable_mtx_};
+    OPENVINO_ASSERT(topology_runner_, "Dynamic model is executed by models of shape buckets");
     return *topology_runner_;
 }
 
-const std::shared_ptr<MemoryPool>& CompiledModel::get_memory_pool() const {
-    return memory_pool_;
+std::shared_ptr<MemoryPool> CompiledModel::get_memory_pool() const { return get_executable().memory_pool; }
+
+const std::shared_ptr<BatchScheduler>& CompiledModel::get_batch_scheduler() const {
+    return batch_scheduler_;
+}
+
+ShapeBuckets* CompiledModel::get_shape_buckets() const {
+    return shape_buckets_.get();
+}
+
+DeviceReplicas* CompiledModel::get_device_replicas() const {
+    return device_replicas_.get();
+}
+
+PipelineStages* CompiledModel::get_pipeline_stages() const {
+    return pipeline_stages_.get();
+}
+
+MicroBatches* CompiledModel::get_micro_batches() const {
+    return micro_batches_.get();
+}
+
+Tiles* CompiledModel::get_tiles() const {
+    return tiles_.get();
 }
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -4,11 +4,24 @@
 
 #pragma once
 
+#include <future>
+#include <map>
+#include <mutex>
+
 #include "cuda_async_infer_request.hpp"
+#include "cuda_batch_scheduler.hpp"
+#include "cuda_chrome_trace.hpp"
 #include "cuda_config.hpp"
+#include "cuda_creation_context.hpp"
+#include "cuda_device_replicas.hpp"
+#include "cuda_pipeline_stages.hpp"
 #include "cuda_infer_request.hpp"
 #include "cuda_itopology_runner.hpp"
+#include "cuda_micro_batches.hpp"
+#include "cuda_tiles.hpp"
 #include "cuda_op_buffers_extractor.hpp"
+#include "cuda_shape_buckets.hpp"
+#include "cuda_tuning_cache.hpp"
 #include "memory_manager/cuda_device_mem_block.hpp"
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/cuda_memory_pool.hpp"
@@ -16,6 +29,7 @@
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "ops/subgraph.hpp"
+#include "utils/latency_histogram.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -28,11 +42,25 @@ class Plugin;
  */
 class CompiledModel : public ov::ICompiledModel {
 public:
+    /**
+     * Exported model starts with the magic and the version of the format followed by the compute capability
+     * of the device, so that the model isn't imported for another GPU architecture
+     */
+    static constexpr std::uint32_t export_magic = 0x4C42564E;  // "NVBL"
+    static constexpr std::uint32_t export_version = 1;
+
+    /**
+     * @param tuning_cache Algorithms of operations imported with the model, nullptr if the model isn't imported
+     * @param memory_arenas Growable arenas mutable blobs of the model are taken from (e.g. shared by shape buckets),
+     *                      nullptr if memory blocks allocate their own blobs
+     */
     CompiledModel(const std::shared_ptr<const ov::Model>& model,
                   const Configuration& cfg,
                   const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
                   const std::shared_ptr<const ov::IPlugin>& plugin,
-                  bool loaded_from_cache = false);
+                  bool loaded_from_cache = false,
+                  std::shared_ptr<TuningCache> tuning_cache = nullptr,
+                  std::shared_ptr<MemoryArenas> memory_arenas = nullptr);
 
     ~CompiledModel();
 
@@ -48,9 +76,75 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
+    /**
+     * Topology runner and memory pool an inference is executed by, they are replaced together by
+     * ov::nvidia_gpu::background_tuning, so an inference keeps them until it is completed
+     */
+    struct Executable {
+        std::shared_ptr<const ITopologyRunner> topology_runner;
+        std::shared_ptr<MemoryPool> memory_pool;
+    };
+
+    Executable get_executable() const;
+
+    /**
+     * @returns Current topology runner, which is valid only while it can't be replaced (e.g. for profiled models).
+     * Inferences keep the one of get_executable()
+     */
     const ITopologyRunner& get_topology_runner() const;
 
-    const std::shared_ptr<MemoryPool>& get_memory_pool() const;
+    /**
+     * @returns Names of the outputs which aren't downloaded (see ov::nvidia_gpu::skipped_outputs). The list may be
+     * replaced by set_property while requests run, so an inference keeps the returned one until it is completed
+     */
+    std::shared_ptr<const std::vector<std::string>> get_skipped_outputs() const;
+
+    std::shared_ptr<MemoryPool> get_memory_pool() const;
+
+    /**
+     * @returns Scheduler of dynamic batching or nullptr if dynamic batching isn't used for the model
+     */
+    const std::shared_ptr<BatchScheduler>& get_batch_scheduler() const;
+
+    /**
+     * @returns Shape buckets of dynamic model or nullptr if the model is static
+     */
+    ShapeBuckets* get_shape_buckets() const;
+
+    /**
+     * @returns Replicas of the model on several devices or nullptr if the model is compiled for a single device
+     */
+    DeviceReplicas* get_device_replicas() const;
+
+    /**
+     * @returns Pipeline stages of the model split across several devices or nullptr if the model isn't split
+     */
+    PipelineStages* get_pipeline_stages() const;
+
+    /**
+     * @returns Model compiled for micro-batches of the batch of the model or nullptr if micro-batching isn't used
+     */
+    MicroBatches* get_micro_batches() const;
+
+    /**
+     * @returns Model compiled for tiles of images of the model or nullptr if tiling isn't used
+     */
+    Tiles* get_tiles() const;
+
+    /**
+     * Allocates every memory block the memory pool may hold and executes an inference with zero inputs in each of
+     * them, so that CUDA Graphs of all blocks are captured before the first inference (see
+     * ov::nvidia_gpu::warmup_on_compile). Does nothing for models without their own memory pool
+     */
+    void warm_up();
+
+    /**
+     * Replaces weights of the model by constants of the model of the same topology (see
+     * ov::nvidia_gpu::weights_update). The model is transformed and compiled with algorithms of the tuning cache of
+     * the topology, and replaces the topology runner and the memory pool like background tuning does
+     * @throws ov::Exception if the topology of the transformed model differs from the compiled one
+     */
+    void update_weights(const std::shared_ptr<const ov::Model>& model);
 
 protected:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
@@ -60,24 +154,75 @@ private:
     friend class Plugin;
     void compile_model(const std::shared_ptr<const ov::Model>& model);
     void init_executor();
+    void init_batch_scheduler(const std::shared_ptr<const ov::Model>& model);
+    void init_device_replicas(const std::shared_ptr<const ov::Model>& model);
+    void init_pipeline_stages(const std::shared_ptr<const ov::Model>& model);
+    bool is_micro_batching_required(const std::shared_ptr<const ov::Model>& model) const;
+    void init_micro_batches(const std::shared_ptr<const ov::Model>& model);
+    bool is_tiling_required(const std::shared_ptr<const ov::Model>& model) const;
+    void init_tiles(const std::shared_ptr<const ov::Model>& model);
     std::size_t get_optimal_number_of_streams(std::size_t const_blob_size, std::size_t memory_blob_size) const;
     std::shared_ptr<ov::ISyncInferRequest> create_benchmark_sync_infer_request();
     std::shared_ptr<ov::IAsyncInferRequest> create_benchmark_infer_request();
-    std::shared_ptr<MemoryPool> create_memory_pool();
-    void benchmark_optimal_number_of_requests();
+    std::shared_ptr<MemoryPool> create_memory_pool(const ITopologyRunner& topology_runner);
+    CreationContext create_creation_context(bool op_bench_option) const;
+    std::shared_ptr<ITopologyRunner> create_topology_runner(const CreationContext& creation_context,
+                                                           const std::shared_ptr<const ov::Model>& model) const;
+    bool is_background_tuning_required() const;
+    void tune_in_background();
+    void estimate_optimal_number_of_requests();
+    std::string get_infer_requests_tuning_key(unsigned max_number_of_requests) const;
+    void refine_optimal_number_of_requests(unsigned max_number_of_requests);
     unsigned int run_benchmark_for(int numInfers, std::mutex& mtx, std::condition_variable& cond_var);
 
     mutable std::atomic<std::size_t> request_id_ = {0};
+    // Inferences of all infer requests in flight (see ov::nvidia_gpu::inflight_requests)
+    mutable std::atomic<std::size_t> inflight_requests_{0};
+    // Inferences dropped because their deadlines passed (see ov::nvidia_gpu::expired_requests)
+    mutable std::atomic<std::size_t> expired_requests_{0};
+    // Guards replacement of the configuration by set_property
+    mutable std::mutex config_mtx_;
     Configuration config_;
+    std::shared_ptr<const std::vector<std::string>> skipped_outputs_;
+    // NUMA node of the device, which host staging memory of infer requests and callbacks are placed on
+    CUDA::NumaNode numa_node_;
     std::shared_ptr<ov::threading::ITaskExecutor> cuda_stream_executor_ = nullptr;
     std::shared_ptr<ov::Model> model_;
     std::map<std::string, std::size_t> input_index_;
     std::map<std::string, std::size_t> output_index_;
-    std::unique_ptr<ITopologyRunner> topology_runner_;
+    // Guards replacement of topology runner and memory pool by background tuning
+    mutable std::mutex executable_mtx_;
+    std::shared_ptr<ITopologyRunner> topology_runner_;
     std::shared_ptr<MemoryPool> memory_pool_;
+    std::shared_ptr<MemoryArenas> memory_arenas_;
+    // Model with the weights of the latest ov::nvidia_gpu::weights_update, which is exported instead of the compiled
+    // one, nullptr if weights weren't updated. It is replaced together with the topology runner
+    std::shared_ptr<ov::Model> weights_model_;
+    // Serializes updates of weights
+    std::mutex weights_update_mtx_;
+    std::shared_ptr<BatchScheduler> batch_scheduler_;
+    std::unique_ptr<ShapeBuckets> shape_buckets_;
+    std::unique_ptr<DeviceReplicas> device_replicas_;
+    std::unique_ptr<PipelineStages> pipeline_stages_;
+    // Inputs of the pipeline stage produced by stages on other devices (input index -> device), which are read
+    // peer-to-peer. Remote tensors of other inputs and outputs must be located on the device of the model
+    std::map<std::size_t, int> peer_inputs_;
+    std::unique_ptr<MicroBatches> micro_batches_;
+    std::unique_ptr<Tiles> tiles_;
+    // Algorithms selected by benchmarks of operations of the model, which are exported with the model
+    std::shared_ptr<TuningCache> tuning_cache_;
+    // Background benchmarks of ov::nvidia_gpu::infer_requests_refinement
+    std::future<void> infer_requests_refinement_;
+    std::atomic<bool> stop_infer_requests_refinement_{false};
+    // Compilation of the model with benchmarked algorithms of ov::nvidia_gpu::background_tuning
+    std::future<void> background_tuning_;
+    std::atomic<bool> background_tuning_completed_{false};
+    // Latencies of stages of profiled inferences of all infer requests (see ov::nvidia_gpu::latency_percentiles)
+    std::shared_ptr<utils::LatencyHistograms> stage_latencies_ = std::make_shared<utils::LatencyHistograms>();
+    // Timeline of inferences shared with models of shape buckets, replicas and stages (see ov::nvidia_gpu::trace_file)
+    std::shared_ptr<ChromeTrace> trace_;
     const bool loaded_from_cache_;
     bool use_cuda_graph_;
-    size_t number_of_cuda_graphs_;
 };
 
 }  // namespace nvidia_gpu
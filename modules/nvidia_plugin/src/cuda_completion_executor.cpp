@@ -0,0 +1,63 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_completion_executor.hpp"
+
+#include <error.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+thread_local cudaError_t completion_status = cudaSuccess;
+
+}  // namespace
+
+CudaCompletionExecutor::CudaCompletionExecutor(std::shared_ptr<CudaThreadPool> threadPool,
+                                               std::shared_ptr<ov::threading::ITaskExecutor> executor)
+    : thread_pool_{std::move(threadPool)}, executor_{std::move(executor)} {
+    OPENVINO_ASSERT(thread_pool_ && executor_, "CudaCompletionExecutor requires thread pool and executor");
+}
+
+void CudaCompletionExecutor::run(ov::threading::Task task) {
+    const auto& threadContext = thread_pool_->get_thread_context();
+    auto completion = std::make_unique<Completion>(Completion{executor_, std::move(task)});
+    // Download stream is the last one in the chain: upload -> compute -> download
+    threadContext.joinCompute();
+    // Unlike host functions, stream callbacks are called with the error of the device, so a faulting kernel
+    // neither completes the request successfully nor leaves it waiting for the callback forever
+    const auto err =
+        cudaStreamAddCallback(threadContext.downloadStream().get(), onCompletion, completion.get(), 0);
+    if (err == cudaSuccess) {
+        completion.release();
+        return;
+    }
+    logIfError(err);
+    runCompleted(*completion, cudaStreamSynchronize(threadContext.downloadStream().get()));
+}
+
+cudaError_t CudaCompletionExecutor::completionStatus() noexcept { return completion_status; }
+
+void CUDART_CB CudaCompletionExecutor::onCompletion(cudaStream_t, cudaError_t status, void* data) noexcept {
+    std::unique_ptr<Completion> completion{static_cast<Completion*>(data)};
+    try {
+        runCompleted(*completion, status);
+    } catch (const std::exception& e) {
+        logError(e.what());
+    } catch (...) {
+        logError("Unknown error while scheduling task after CUDA stream completion");
+    }
+}
+
+void CudaCompletionExecutor::runCompleted(Completion& completion, const cudaError_t status) {
+    completion.executor->run([status, task = std::move(completion.task)] {
+        completion_status = status;
+        task();
+        completion_status = cudaSuccess;
+    });
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,60 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "cuda_thread_pool.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Executor which runs a task once the work submitted to CUDA streams of the current
+ * CudaThreadPool thread is completed.
+ *
+ * Completion is signaled by callback enqueued into the stream, so no thread is blocked while
+ * the device executes an inference. The task itself is forwarded to another executor, because
+ * CUDA API calls are not allowed within callbacks. Errors of the device (e.g. a faulting kernel) are reported
+ * to the task by completionStatus(), as the callback is called with the error status of the stream even if
+ * the context is broken by a sticky error.
+ */
+class CudaCompletionExecutor : public ov::threading::ITaskExecutor {
+public:
+    /**
+     * @param threadPool Thread pool which threads submit the work to be waited for
+     * @param executor Executor which runs tasks after completion
+     */
+    CudaCompletionExecutor(std::shared_ptr<CudaThreadPool> threadPool,
+                           std::shared_ptr<ov::threading::ITaskExecutor> executor);
+
+    /**
+     * Schedules the task after the work submitted so far. Should be called from CudaThreadPool thread
+     * @param task Task to run
+     */
+    void run(ov::threading::Task task) override;
+
+    /**
+     * @returns Status of the streams the task, which is currently run on the calling thread, has waited for:
+     *          cudaSuccess or the error of the device work submitted before the task
+     */
+    static cudaError_t completionStatus() noexcept;
+
+private:
+    struct Completion {
+        std::shared_ptr<ov::threading::ITaskExecutor> executor;
+        ov::threading::Task task;
+    };
+
+    static void CUDART_CB onCompletion(cudaStream_t stream, cudaError_t status, void* data) noexcept;
+    static void runCompleted(Completion& completion, cudaError_t status);
+
+    std::shared_ptr<CudaThreadPool> thread_pool_;
+    std::shared_ptr<ov::threading::ITaskExecutor> executor_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -8,8 +8,14 @@
 
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <error.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cuda/runtime.hpp>
 #include <regex>
+#include <thread>
 
+#include "cuda_extension_loader.hpp"
+#include "memory_manager/cuda_constant_cache.hpp"
 #include "nvidia/properties.hpp"
 
 using namespace ov::nvidia_gpu;
@@ -40,9 +46,45 @@ std::vector<ov::PropertyName> Configuration::get_rw_properties() {
         ov::PropertyName{ov::hint::num_requests.name(), ov::PropertyMutability::RW},
         ov::PropertyName{ov::hint::performance_mode.name(), ov::PropertyMutability::RW},
         ov::PropertyName{ov::hint::execution_mode.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::hint::model_priority.name(), ov::PropertyMutability::RW},
         ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::cache_dir.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::compilation_num_threads.name(), ov::PropertyMutability::RW},
         ov::PropertyName{ov::nvidia_gpu::operation_benchmark.name(), ov::PropertyMutability::RW},
         ov::PropertyName{ov::nvidia_gpu::use_cuda_graph.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::bind_io_tensors.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::dynamic_batch_size.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::dynamic_batch_timeout.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::micro_batch_size.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::tile_size.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::multi_device_ids.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::pipeline_device_ids.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_pool_idle_timeout.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_pool_wait_timeout.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::latency_budget.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_pool_release_threshold.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_aware_ordering.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_budget.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::weights_compression.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::fp8_matmul.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::constants_offload.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::persistent_kernel_max_elements.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::infer_requests_refinement.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::background_tuning.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::warmup_on_compile.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::nvtx_ranges.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::trace_file.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::hardware_counters.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_layout_file.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::skipped_outputs.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::cost_aware_query.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::mixed_precision.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::device_precision_io.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::sm_fraction.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::parallel_branches.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::fast_math.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::ipc_constants_dir.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::extensions.name(), ov::PropertyMutability::RW},
     };
     return rw_properties;
 }
@@ -78,32 +120,70 @@ std::vector<ov::PropertyName> Configuration::get_caching_properties() {
     return caching_properties;
 }
 
+namespace {
+
+std::vector<int> parse_multi_device_ids(const std::string& value) {
+    std::vector<int> device_ids;
+    if (value.empty()) {
+        return device_ids;
+    }
+    std::size_t begin = 0;
+    while (true) {
+        const auto end = value.find(',', begin);
+        const auto device_id = Configuration::parse_device_id(value.substr(begin, end - begin));
+        if (std::find(device_ids.begin(), device_ids.end(), device_id) != device_ids.end()) {
+            throw_ov_exception(fmt::format("Device ID {} is listed more than once in {}", device_id, value));
+        }
+        device_ids.push_back(device_id);
+        if (end == std::string::npos) {
+            break;
+        }
+        begin = end + 1;
+    }
+    return device_ids;
+}
+
+std::vector<std::string> parse_output_names(const std::string& value) {
+    std::vector<std::string> names;
+    std::size_t begin = 0;
+    while (begin <= value.size()) {
+        const auto end = std::min(value.find(',', begin), value.size());
+        if (end > begin) {
+            names.push_back(value.substr(begin, end - begin));
+        }
+        begin = end + 1;
+    }
+    return names;
+}
+
+}  // namespace
+
+int Configuration::parse_device_id(const std::string& value) {
+    std::smatch match;
+    const std::regex re_device_id(R"(\s*(NVIDIA\.)?(\d+|(GPU|MIG)-[0-9a-fA-F-]+)\s*)");
+    if (!std::regex_match(value, match, re_device_id)) {
+        throw_ov_exception(fmt::format("Device ID {} is not supported. Supported device IDs: 0, 1, NVIDIA.0, NVIDIA.1 "
+                                       "and etc. or UUIDs of devices: GPU-<uuid>, NVIDIA.MIG-<uuid> and etc.",
+                                       value));
+    }
+    const std::string id = match[2].str();
+    if (!match[3].matched) {
+        return std::stoi(id);
+    }
+    std::string uuid = id;
+    std::transform(uuid.begin() + 3, uuid.end(), uuid.begin() + 3, [](unsigned char c) { return std::tolower(c); });
+    for (int i = 0; i < CUDA::Device::count(); ++i) {
+        if (CUDA::Device{i}.uuid() == uuid) {
+            return i;
+        }
+    }
+    throw_ov_exception(fmt::format("Device with UUID {} is not found", id));
+}
+
 void Configuration::update_device_id(const ov::AnyMap& config) {
     auto it = config.find(ov::device::id.name());
     if (it != config.end()) {
-        auto value = it->second.as<std::string>();
-        std::smatch match;
-        std::regex re_device_id(R"((NVIDIA\.)?(\d+))");
-        if (std::regex_match(value, match, re_device_id)) {
-            const std::string device_id_prefix = match[1].str();
-            const std::string device_id_value = match[2].str();
-            if (!device_id_prefix.empty() && "NVIDIA." != device_id_prefix) {
-                throw_ov_exception(
-                    fmt::format("Prefix for deviceId should be 'NVIDIA.' (user deviceId = {}). "
-                                "For example: NVIDIA.0, NVIDIA.1 and etc.",
-                                value));
-            }
-            device_id = std::stoi(device_id_value);
-            if (device_id < 0) {
-                throw_ov_exception(fmt::format(
-                    "Device ID {} is not supported. Index should be >= 0 (user index = {})", value, device_id));
-            }
-        } else {
-            throw_ov_exception(
-                fmt::format("Device ID {} is not supported. Supported deviceIds: 0, 1, 2, NVIDIA.0, NVIDIA.1, "
-                            "NVIDIA.2 and etc.",
-                            value));
-        }
+        device_id = parse_device_id(it->second.as<std::string>());
     }
 }
 
@@ -133,6 +213,23 @@ uint32_t Configuration::get_optimal_number_of_streams() const noexcept {
     return optimal_number_of_streams;
 }
 
+size_t Configuration::get_memory_budget(size_t device_memory_size) const noexcept {
+    if (memory_budget == 0) {
+        return std::numeric_limits<size_t>::max();
+    }
+    if (memory_budget <= 1) {
+        return static_cast<size_t>(memory_budget * device_memory_size);
+    }
+    return static_cast<size_t>(std::min(memory_budget, static_cast<double>(std::numeric_limits<size_t>::max())));
+}
+
+uint32_t Configuration::get_compilation_num_threads() const noexcept {
+    if (compilation_num_threads > 0) {
+        return static_cast<uint32_t>(compilation_num_threads);
+    }
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
 bool Configuration::is_stream_executor_property(const std::string& name) const {
     auto stream_executor_properties = streams_executor_config_.get_property(
         ov::supported_properties.name()).as<std::vector<std::string>>();
@@ -176,6 +273,112 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
             operation_benchmark = value.as<bool>();
         } else if (ov::nvidia_gpu::use_cuda_graph == key) {
             use_cuda_graph = value.as<bool>();
+        } else if (ov::nvidia_gpu::bind_io_tensors == key) {
+            bind_io_tensors = value.as<bool>();
+        } else if (ov::nvidia_gpu::dynamic_batch_size == key) {
+            dynamic_batch_size = value.as<uint32_t>();
+            if (dynamic_batch_size == 0) {
+                throw_ov_exception("Dynamic batch size should be greater than 0");
+            }
+        } else if (ov::nvidia_gpu::dynamic_batch_timeout == key) {
+            dynamic_batch_timeout = value.as<uint32_t>();
+        } else if (ov::nvidia_gpu::micro_batch_size == key) {
+            micro_batch_size = value.as<uint32_t>();
+        } else if (ov::nvidia_gpu::tile_size == key) {
+            tile_size = value.as<uint32_t>();
+        } else if (ov::nvidia_gpu::multi_device_ids == key) {
+            multi_device_ids = parse_multi_device_ids(value.as<std::string>());
+        } else if (ov::nvidia_gpu::pipeline_device_ids == key) {
+            pipeline_device_ids = parse_multi_device_ids(value.as<std::string>());
+        } else if (ov::cache_dir == key) {
+            cache_dir = value.as<std::string>();
+        } else if (ov::compilation_num_threads == key) {
+            compilation_num_threads = value.as<int32_t>();
+            if (compilation_num_threads < 0) {
+                throw_ov_exception(
+                    fmt::format("Compilation number of threads {} should be a non-negative number",
+                                compilation_num_threads));
+            }
+        } else if (ov::nvidia_gpu::memory_pool_idle_timeout == key) {
+            memory_pool_idle_timeout = value.as<uint32_t>();
+        } else if (ov::nvidia_gpu::memory_pool_wait_timeout == key) {
+            memory_pool_wait_timeout = value.as<uint32_t>();
+        } else if (ov::nvidia_gpu::latency_budget == key) {
+            latency_budget = value.as<uint32_t>();
+        } else if (ov::nvidia_gpu::memory_pool_release_threshold == key) {
+            memory_pool_release_threshold = value.as<uint64_t>();
+        } else if (ov::nvidia_gpu::memory_aware_ordering == key) {
+            memory_aware_ordering = value.as<bool>();
+        } else if (ov::nvidia_gpu::memory_budget == key) {
+            memory_budget = value.as<double>();
+            if (!(memory_budget >= 0)) {
+                throw_ov_exception(fmt::format("Memory budget {} should be a non-negative number", memory_budget));
+            }
+        } else if (ov::nvidia_gpu::weights_compression == key) {
+            auto element_type = value.as<ov::element::Type>();
+            const std::set<ov::element::Type> supported_types = {
+                ov::element::undefined, ov::element::i8, ov::element::i4,
+            };
+            if (supported_types.count(element_type) == 0) {
+                throw_ov_exception(
+                    fmt::format("Weights compression to {} is not supported by plugin", value.as<std::string>()));
+            }
+            weights_compression = element_type;
+        } else if (ov::nvidia_gpu::fp8_matmul == key) {
+            fp8_matmul = value.as<bool>();
+        } else if (ov::nvidia_gpu::constants_offload == key) {
+            constants_offload = value.as<bool>();
+        } else if (ov::nvidia_gpu::persistent_kernel_max_elements == key) {
+            persistent_kernel_max_elements = value.as<size_t>();
+        } else if (ov::nvidia_gpu::infer_requests_refinement == key) {
+            infer_requests_refinement = value.as<bool>();
+        } else if (ov::nvidia_gpu::background_tuning == key) {
+            background_tuning = value.as<bool>();
+        } else if (ov::nvidia_gpu::warmup_on_compile == key) {
+            warmup_on_compile = value.as<bool>();
+        } else if (ov::nvidia_gpu::nvtx_ranges == key) {
+            nvtx_ranges = value.as<bool>();
+        } else if (ov::nvidia_gpu::trace_file == key) {
+            trace_file = value.as<std::string>();
+        } else if (ov::nvidia_gpu::hardware_counters == key) {
+            hardware_counters = value.as<bool>();
+#ifndef ENABLE_CUPTI_METRICS
+            if (hardware_counters) {
+                throw_ov_exception("Hardware counters require NVIDIA plugin built with -DENABLE_CUPTI_METRICS=ON");
+            }
+#endif
+        } else if (ov::nvidia_gpu::memory_layout_file == key) {
+            memory_layout_file = value.as<std::string>();
+        } else if (ov::nvidia_gpu::skipped_outputs == key) {
+            skipped_outputs = parse_output_names(value.as<std::string>());
+        } else if (ov::nvidia_gpu::cost_aware_query == key) {
+            cost_aware_query = value.as<bool>();
+        } else if (ov::nvidia_gpu::mixed_precision == key) {
+            mixed_precision = value.as<bool>();
+        } else if (ov::nvidia_gpu::device_precision_io == key) {
+            device_precision_io = value.as<bool>();
+        } else if (ov::nvidia_gpu::sm_fraction == key) {
+            sm_fraction = value.as<float>();
+            if (!(sm_fraction > 0.0f && sm_fraction <= 1.0f)) {
+                throw_ov_exception(fmt::format("Fraction of SMs {} should be in (0, 1]", sm_fraction));
+            }
+        } else if (ov::nvidia_gpu::parallel_branches == key) {
+            parallel_branches = value.as<uint32_t>();
+            if (parallel_branches == 0) {
+                throw_ov_exception("Number of streams of parallel branches should be greater than 0");
+            }
+        } else if (ov::nvidia_gpu::fast_math == key) {
+            fast_math = value.as<bool>();
+        } else if (ov::nvidia_gpu::ipc_constants_dir == key) {
+            ipc_constants_dir = value.as<std::string>();
+            if (!ipc_constants_dir.empty() && !ConstantCache::isIpcSupported()) {
+                throw_ov_exception("Constants can't be shared across processes by CUDA IPC on this platform");
+            }
+        } else if (ov::nvidia_gpu::extensions == key) {
+            extensions = parse_output_names(value.as<std::string>());
+            for (const auto& path : extensions) {
+                loadExtensions(path);
+            }
         } else if (ov::enable_profiling == key) {
             is_profiling_enabled = value.as<bool>();
         } else if (ov::hint::num_requests == key) {
@@ -183,7 +386,7 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
         } else if (ov::hint::inference_precision == key) {
             auto element_type = value.as<ov::element::Type>();
             const std::set<ov::element::Type> supported_types = {
-                ov::element::f16, ov::element::f32,
+                ov::element::f16, ov::element::bf16, ov::element::f32,
             };
             if (supported_types.count(element_type) == 0) {
                 throw_ov_exception(fmt::format("Inference precision {} is not supported by plugin", value.as<std::string>()));
@@ -193,12 +396,23 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
             performance_mode = value.as<ov::hint::PerformanceMode>();
         } else if (ov::hint::execution_mode == key) {
             execution_mode = value.as<ov::hint::ExecutionMode>();
+        } else if (ov::hint::model_priority == key) {
+            model_priority = value.as<ov::hint::Priority>();
         } else if (ov::internal::exclusive_async_requests == key) {
             exclusive_async_requests = value.as<bool>();
         } else if (throwOnUnsupported) {
             throw_ov_exception(key);
         }
     }
+    if (!multi_device_ids.empty() && !pipeline_device_ids.empty()) {
+        throw_ov_exception("Model can't be both replicated to several devices and split into pipeline stages");
+    }
+    // The model is neither replicated nor split for a single device of the list, it's compiled for that device
+    for (const auto* device_ids : {&multi_device_ids, &pipeline_device_ids}) {
+        if (device_ids->size() == 1) {
+            device_id = device_ids->front();
+        }
+    }
 }
 
 ov::Any Configuration::get(const std::string& name) const {
@@ -212,6 +426,87 @@ ov::Any Configuration::get(const std::string& name) const {
         return operation_benchmark;
     } else if (name == ov::nvidia_gpu::use_cuda_graph) {
         return use_cuda_graph;
+    } else if (name == ov::nvidia_gpu::bind_io_tensors) {
+        return bind_io_tensors;
+    } else if (name == ov::nvidia_gpu::dynamic_batch_size) {
+        return dynamic_batch_size;
+    } else if (name == ov::nvidia_gpu::dynamic_batch_timeout) {
+        return dynamic_batch_timeout;
+    } else if (name == ov::nvidia_gpu::micro_batch_size) {
+        return micro_batch_size;
+    } else if (name == ov::nvidia_gpu::tile_size) {
+        return tile_size;
+    } else if (name == ov::nvidia_gpu::multi_device_ids || name == ov::nvidia_gpu::pipeline_device_ids) {
+        const auto& device_ids = name == ov::nvidia_gpu::multi_device_ids ? multi_device_ids : pipeline_device_ids;
+        std::string value;
+        for (const auto device_id : device_ids) {
+            value += (value.empty() ? "" : ",") + std::to_string(device_id);
+        }
+        return value;
+    } else if (name == ov::cache_dir) {
+        return cache_dir;
+    } else if (name == ov::compilation_num_threads) {
+        return static_cast<int32_t>(get_compilation_num_threads());
+    } else if (name == ov::nvidia_gpu::memory_pool_idle_timeout) {
+        return memory_pool_idle_timeout;
+    } else if (name == ov::nvidia_gpu::memory_pool_wait_timeout) {
+        return memory_pool_wait_timeout;
+    } else if (name == ov::nvidia_gpu::latency_budget) {
+        return latency_budget;
+    } else if (name == ov::nvidia_gpu::memory_pool_release_threshold) {
+        return memory_pool_release_threshold;
+    } else if (name == ov::nvidia_gpu::memory_aware_ordering) {
+        return memory_aware_ordering;
+    } else if (name == ov::nvidia_gpu::memory_budget) {
+        return memory_budget;
+    } else if (name == ov::nvidia_gpu::weights_compression) {
+        return weights_compression;
+    } else if (name == ov::nvidia_gpu::fp8_matmul) {
+        return fp8_matmul;
+    } else if (name == ov::nvidia_gpu::constants_offload) {
+        return constants_offload;
+    } else if (name == ov::nvidia_gpu::persistent_kernel_max_elements) {
+        return persistent_kernel_max_elements;
+    } else if (name == ov::nvidia_gpu::infer_requests_refinement) {
+        return infer_requests_refinement;
+    } else if (name == ov::nvidia_gpu::background_tuning) {
+        return background_tuning;
+    } else if (name == ov::nvidia_gpu::warmup_on_compile) {
+        return warmup_on_compile;
+    } else if (name == ov::nvidia_gpu::nvtx_ranges) {
+        return nvtx_ranges;
+    } else if (name == ov::nvidia_gpu::trace_file) {
+        return trace_file;
+    } else if (name == ov::nvidia_gpu::hardware_counters) {
+        return hardware_counters;
+    } else if (name == ov::nvidia_gpu::memory_layout_file) {
+        return memory_layout_file;
+    } else if (name == ov::nvidia_gpu::skipped_outputs) {
+        std::string value;
+        for (const auto& output_name : skipped_outputs) {
+            value += (value.empty() ? "" : ",") + output_name;
+        }
+        return value;
+    } else if (name == ov::nvidia_gpu::cost_aware_query) {
+        return cost_aware_query;
+    } else if (name == ov::nvidia_gpu::mixed_precision) {
+        return mixed_precision;
+    } else if (name == ov::nvidia_gpu::device_precision_io) {
+        return device_precision_io;
+    } else if (name == ov::nvidia_gpu::sm_fraction) {
+        return sm_fraction;
+    } else if (name == ov::nvidia_gpu::parallel_branches) {
+        return parallel_branches;
+    } else if (name == ov::nvidia_gpu::fast_math) {
+        return fast_math;
+    } else if (name == ov::nvidia_gpu::ipc_constants_dir) {
+        return ipc_constants_dir;
+    } else if (name == ov::nvidia_gpu::extensions) {
+        std::string value;
+        for (const auto& path : extensions) {
+            value += (value.empty() ? "" : ",") + path;
+        }
+        return value;
     } else if (name == ov::num_streams) {
         return (num_streams == 0) ?
             ov::streams::Num(get_optimal_number_of_streams()) : num_streams;
@@ -228,6 +523,8 @@ ov::Any Configuration::get(const std::string& name) const {
         return performance_mode;
     } else if (name == ov::hint::execution_mode) {
         return execution_mode;
+    } else if (name == ov::hint::model_priority) {
+        return model_priority;
     } else if (name == ov::internal::exclusive_async_requests) {
         return exclusive_async_requests;
     } else {
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <chrono>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "nvidia/nvidia_config.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -37,12 +40,68 @@ struct Configuration {
     static std::vector<ov::PropertyName> get_caching_properties();
     static bool is_rw_property(const std::string& name);
     bool is_stream_executor_property(const std::string& name) const;
+    /**
+     * @param value Ordinal of the device (e.g. 0 or NVIDIA.0) or its UUID listed by nvidia-smi -L (e.g. GPU-<uuid>
+     *              or NVIDIA.MIG-<uuid> of a MIG instance)
+     * @returns Ordinal of the device
+     */
+    static int parse_device_id(const std::string& value);
     void update_device_id(const ov::AnyMap& config);
     int get_device_id() const { return device_id; };
     ov::element::Type get_inference_precision() const noexcept;
+    ov::hint::ExecutionMode get_execution_mode() const noexcept { return execution_mode; }
+    ov::element::Type get_weights_compression() const noexcept { return weights_compression; }
+    bool is_fp8_matmul_enabled() const noexcept { return fp8_matmul; }
+    bool is_constants_offload_enabled() const noexcept { return constants_offload; }
+    size_t get_persistent_kernel_max_elements() const noexcept { return persistent_kernel_max_elements; }
+    bool is_infer_requests_refinement_enabled() const noexcept { return infer_requests_refinement; }
+    bool is_background_tuning_enabled() const noexcept { return background_tuning; }
+    bool is_warmup_on_compile_enabled() const noexcept { return warmup_on_compile; }
+    bool is_nvtx_ranges_enabled() const noexcept { return nvtx_ranges; }
+    const std::string& get_trace_file() const noexcept { return trace_file; }
+    bool is_hardware_counters_enabled() const noexcept { return hardware_counters; }
+    const std::string& get_memory_layout_file() const noexcept { return memory_layout_file; }
+    const std::vector<std::string>& get_skipped_outputs() const noexcept { return skipped_outputs; }
+    bool is_cost_aware_query_enabled() const noexcept { return cost_aware_query; }
+    bool is_mixed_precision_enabled() const noexcept { return mixed_precision; }
+    bool is_device_precision_io_enabled() const noexcept { return device_precision_io; }
+    float get_sm_fraction() const noexcept { return sm_fraction; }
+    uint32_t get_parallel_branches() const noexcept { return parallel_branches; }
+    bool is_fast_math_enabled() const noexcept { return fast_math; }
+    const std::string& get_ipc_constants_dir() const noexcept { return ipc_constants_dir; }
+    const std::vector<std::string>& get_extensions() const noexcept { return extensions; }
+    /**
+     * Returns whether operations are timed by the profiler, which is the case for traced models too
+     */
+    bool is_profiler_required() const noexcept { return is_profiling_enabled || !trace_file.empty(); }
+    const std::string& get_cache_dir() const noexcept { return cache_dir; }
+    /**
+     * Returns number of threads operations are created on, the number of hardware threads by default
+     */
+    uint32_t get_compilation_num_threads() const noexcept;
     uint32_t get_optimal_number_of_streams() const noexcept;
     bool auto_streams_detection_required() const noexcept;
     bool is_exclusive_async_requests() const noexcept;
+    uint32_t get_dynamic_batch_size() const noexcept { return dynamic_batch_size; }
+    uint32_t get_dynamic_batch_timeout() const noexcept { return dynamic_batch_timeout; }
+    uint32_t get_micro_batch_size() const noexcept { return micro_batch_size; }
+    uint32_t get_tile_size() const noexcept { return tile_size; }
+    ov::hint::Priority get_model_priority() const noexcept { return model_priority; }
+    const std::vector<int>& get_multi_device_ids() const noexcept { return multi_device_ids; }
+    const std::vector<int>& get_pipeline_device_ids() const noexcept { return pipeline_device_ids; }
+    uint64_t get_memory_pool_release_threshold() const noexcept { return memory_pool_release_threshold; }
+    std::chrono::milliseconds get_memory_pool_idle_timeout() const noexcept {
+        return std::chrono::milliseconds{memory_pool_idle_timeout};
+    }
+    std::chrono::milliseconds get_memory_pool_wait_timeout() const noexcept {
+        return std::chrono::milliseconds{memory_pool_wait_timeout};
+    }
+    std::chrono::milliseconds get_latency_budget() const noexcept { return std::chrono::milliseconds{latency_budget}; }
+    /**
+     * Returns memory budget in bytes for the device with the given total memory;
+     * std::numeric_limits<size_t>::max() if the budget isn't limited
+     */
+    size_t get_memory_budget(size_t device_memory_size) const noexcept;
 
     // Plugin configuration parameters
     static constexpr uint32_t reasonable_limit_of_streams = 10;
@@ -53,11 +112,47 @@ private:
     bool is_profiling_enabled = false;
     bool operation_benchmark = false;
     bool use_cuda_graph = true;
+    bool bind_io_tensors = false;
+    uint32_t dynamic_batch_size = 1;
+    uint32_t dynamic_batch_timeout = 1;
+    uint32_t micro_batch_size = 0;
+    uint32_t tile_size = 0;
+    std::vector<int> multi_device_ids;
+    std::vector<int> pipeline_device_ids;
+    uint32_t memory_pool_idle_timeout = 0;
+    uint32_t memory_pool_wait_timeout = 0;
+    uint32_t latency_budget = 0;
+    uint64_t memory_pool_release_threshold = std::numeric_limits<uint64_t>::max();
+    bool memory_aware_ordering = false;
+    double memory_budget = 0;
+    ov::element::Type weights_compression = ov::element::undefined;
+    bool fp8_matmul = false;
+    bool constants_offload = false;
+    size_t persistent_kernel_max_elements = 0;
+    bool infer_requests_refinement = false;
+    bool background_tuning = false;
+    bool warmup_on_compile = false;
+    bool nvtx_ranges = false;
+    std::string trace_file;
+    bool hardware_counters = false;
+    std::string memory_layout_file;
+    std::vector<std::string> skipped_outputs;
+    bool cost_aware_query = false;
+    bool mixed_precision = true;
+    bool device_precision_io = false;
+    float sm_fraction = 1.0f;
+    uint32_t parallel_branches = 1;
+    bool fast_math = false;
+    std::string ipc_constants_dir;
+    std::vector<std::string> extensions;
+    std::string cache_dir;
+    int32_t compilation_num_threads = 0;
     bool exclusive_async_requests = false;
     uint32_t hint_num_requests = 0;
     ov::streams::Num num_streams = 0;
     ov::hint::PerformanceMode performance_mode = ov::hint::PerformanceMode::LATENCY;
     ov::hint::ExecutionMode execution_mode = ov::hint::ExecutionMode::PERFORMANCE;
+    ov::hint::Priority model_priority = ov::hint::Priority::MEDIUM;
     ov::element::Type inference_precision = ov::element::undefined;
 };
 
@@ -5,6 +5,15 @@
 #pragma once
 
 #include <cuda_config.hpp>
+#include <algorithm>
+#include <cuda_tuning_cache.hpp>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
 
 #include "cuda/blas.hpp"
 #include "cuda/dnn.hpp"
@@ -13,17 +22,133 @@
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * Options of operations created for a compiled model, which it derives from its configuration
+ * (see CompiledModel::create_creation_context)
+ */
+struct CreationOptions {
+    bool bind_io_tensors = false;
+    bool memory_aware_ordering = false;
+    size_t max_workspace_size = std::numeric_limits<size_t>::max();
+    std::optional<size_t> constants_offload_limit;
+    std::shared_ptr<TuningCache> tuning_cache;
+    unsigned compilation_num_threads = 1;
+    size_t persistent_kernel_max_elements = 0;
+    bool memory_layout = false;
+    bool tf32 = false;
+    unsigned parallel_branches = 1;
+    bool fast_math = false;
+    std::string ipc_constants_dir;
+};
+
 class CreationContext {
     CUDA::Device device_;
     CUDA::DnnHandle dnn_handle_;
+    CUDA::CuBlasHandle cublas_handle_;
     bool op_bench_option_;
+    CreationOptions options_;
+    unsigned max_threads_per_block_;
 
 public:
-    explicit CreationContext(CUDA::Device d, bool opBenchOption)
-        : device_{d.setCurrent()}, op_bench_option_{opBenchOption} {}
+    explicit CreationContext(CUDA::Device d, bool opBenchOption, CreationOptions options = {})
+        : device_{d.setCurrent()},
+          op_bench_option_{opBenchOption},
+          options_{std::move(options)},
+          max_threads_per_block_{device_.occupancyBlockSize()} {
+        options_.compilation_num_threads = std::max(options_.compilation_num_threads, 1u);
+        options_.parallel_branches = std::max(options_.parallel_branches, 1u);
+    }
     CUDA::Device device() const { return device_; }
     const CUDA::DnnHandle& dnnHandle() const { return dnn_handle_; }
+    /**
+     * cuBLAS handle of the creating thread, which is used for queries of cuBLASLt algorithms
+     */
+    const CUDA::CuBlasHandle& cuBlasHandle() const { return cublas_handle_; }
     bool opBenchOption() const noexcept { return op_bench_option_; }
+    bool bindIoTensors() const noexcept { return options_.bind_io_tensors; }
+    bool memoryAwareOrdering() const noexcept { return options_.memory_aware_ordering; }
+    /**
+     * Maximal size of work space an operation should request for its library calls (e.g. cuDNN algorithms)
+     */
+    size_t maxWorkspaceSize() const noexcept { return options_.max_workspace_size; }
+    /**
+     * Device memory constants and an infer request should fit in, large constants exceeding it are offloaded
+     * (see OperationBuffersExtractor::offloadConstants); std::nullopt if constants offload is disabled
+     */
+    const std::optional<size_t>& constantsOffloadLimit() const noexcept { return options_.constants_offload_limit; }
+    /**
+     * Cache of benchmarked algorithms of operations of the compiled model, which is backed by the file
+     * in ov::cache_dir if it is set; nullptr if operations are created outside of the compiled model
+     */
+    const std::shared_ptr<TuningCache>& tuningCache() const noexcept { return options_.tuning_cache; }
+    /**
+     * Number of threads operations of a model are created on (see ov::compilation_num_threads)
+     */
+    unsigned compilationNumThreads() const noexcept { return options_.compilation_num_threads; }
+    /**
+     * Maximal number of elements of outputs of element-wise operations executed by one persistent kernel,
+     * 0 if the persistent kernel is disabled (see ov::nvidia_gpu::persistent_kernel_max_elements)
+     */
+    size_t persistentKernelMaxElements() const noexcept { return options_.persistent_kernel_max_elements; }
+    /**
+     * Whether subgraphs keep placement of their buffers in memory blocks (see ov::nvidia_gpu::memory_layout_file)
+     */
+    bool memoryLayout() const noexcept { return options_.memory_layout; }
+    /**
+     * Whether fp32 matrix multiplications and convolutions may use TF32 Tensor Cores, otherwise they keep
+     * strict fp32 precision (see ov::hint::execution_mode)
+     */
+    bool tf32() const noexcept { return options_.tf32; }
+    /**
+     * Maximal number of streams independent branches of the model are executed on, 1 if operations are executed
+     * one by one (see ov::nvidia_gpu::parallel_branches)
+     */
+    unsigned parallelBranches() const noexcept { return options_.parallel_branches; }
+    /**
+     * Whether activations use fast approximations of device math (see ov::nvidia_gpu::fast_math)
+     */
+    bool fastMath() const noexcept { return options_.fast_math; }
+    /**
+     * Directory of CUDA IPC handles of large constants shared across processes, empty if constants are shared only
+     * within the process (see ov::nvidia_gpu::ipc_constants_dir)
+     */
+    const std::string& ipcConstantsDir() const noexcept { return options_.ipc_constants_dir; }
+    /**
+     * Maximal number of threads per block of kernels of operations tuning their launch configuration
+     * (see IOperationMeta::kTunedBlockSize): the size selected by benchmarks or the occupancy block size of the
+     * device by default (see CUDA::Device::occupancyBlockSize)
+     */
+    unsigned maxThreadsPerBlock() const noexcept { return max_threads_per_block_; }
+    /**
+     * @returns Copy of the context, which operations limit their blocks to the given number of threads
+     */
+    CreationContext withMaxThreadsPerBlock(unsigned maxThreadsPerBlock) const {
+        auto context = *this;
+        context.max_threads_per_block_ = maxThreadsPerBlock;
+        return context;
+    }
+    /**
+     * Locks benchmarks of algorithms on the device, so that their timings aren't contended by benchmarks of
+     * operations created concurrently (see ov::compilation_num_threads) or by other compiled models of the device
+     */
+    std::unique_lock<std::mutex> lockBenchmarks() const {
+        static std::mutex mutex;
+        static std::map<int, std::mutex> benchmarkMutexes;
+        std::unique_lock<std::mutex> lock{mutex};
+        auto& benchmarkMutex = benchmarkMutexes[device_.getId()];
+        lock.unlock();
+        return std::unique_lock<std::mutex>{benchmarkMutex};
+    }
+    /**
+     * Creates context of a thread, which creates operations concurrently with other threads.
+     * It has its own cuDNN and cuBLAS handles and creates nested operations (e.g. bodies of TensorIterator) on that thread.
+     * Should be called on the thread, which uses the context, to make the device current for it
+     */
+    CreationContext forWorkerThread() const {
+        auto options = options_;
+        options.compilation_num_threads = 1;
+        return CreationContext{device_, op_bench_option_, std::move(options)};
+    }
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,106 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_delegate_stage_executor.hpp"
+
+#include "cuda_compiled_model.hpp"
+#include "cuda_infer_request.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+DelegateStageExecutor::DelegateStageExecutor(CudaInferRequest& request,
+                                             std::shared_ptr<ov::threading::ITaskExecutor> executor)
+    : request_{request}, executor_{std::move(executor)} {
+    OPENVINO_ASSERT(executor_, "DelegateStageExecutor requires executor");
+}
+
+void DelegateStageExecutor::run(ov::threading::Task task) {
+    error_ = nullptr;
+    failed_ = false;
+    OPENVINO_ASSERT(!request_.delegate_requests_.empty(), "Delegate infer request isn't prepared");
+    task_ = std::move(task);
+    const auto compiled_model = request_.get_nvidia_model();
+    if (compiled_model->get_micro_batches() || compiled_model->get_tiles()) {
+        // Lanes are executed concurrently, each lane takes the next pending micro-batch or tile when it is finished
+        const auto& lanes = request_.delegate_requests_;
+        tiles_ = compiled_model->get_tiles() != nullptr;
+        num_parts_ = tiles_ ? request_.get_number_of_tiles() : compiled_model->get_micro_batches()->size();
+        next_part_ = 0;
+        running_lanes_ = lanes.size();
+        for (const auto& lane : lanes) {
+            start_next_part(*lane);
+        }
+        return;
+    }
+    start(0);
+}
+
+void DelegateStageExecutor::start_next_part(ov::IAsyncInferRequest& lane) {
+    const auto index = next_part_.fetch_add(1);
+    if (!failed_ && index < num_parts_) {
+        try {
+            if (tiles_) {
+                request_.set_tile_tensors(lane, index);
+            } else {
+                request_.set_micro_batch_tensors(lane, index);
+            }
+            // Callback is set before every start, since the lane may be restarted from its own callback
+            lane.set_callback([this, &lane, index](std::exception_ptr error) {
+                if (error) {
+                    fail(error);
+                } else if (tiles_) {
+                    // Output of the tile is stitched before the lane reuses its tensors for the next tile
+                    try {
+                        request_.complete_tile(lane, index);
+                    } catch (...) {
+                        fail(std::current_exception());
+                    }
+                }
+                start_next_part(lane);
+            });
+            lane.start_async();
+            return;
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    }
+    // The last completed lane resumes the pipeline
+    if (running_lanes_.fetch_sub(1) == 1) {
+        executor_->run(std::move(task_));
+    }
+}
+
+void DelegateStageExecutor::fail(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock{error_mtx_};
+    if (!error_) {
+        error_ = error;
+    }
+    failed_ = true;
+}
+
+void DelegateStageExecutor::start(std::size_t index) {
+    auto& delegate_request = request_.delegate_requests_.at(index);
+    delegate_request->set_callback([this, index](std::exception_ptr error) {
+        // Delegate requests are executed one by one, the next one consumes outputs of the previous one
+        if (!error && index + 1 < request_.delegate_requests_.size()) {
+            start(index + 1);
+            return;
+        }
+        error_ = error;
+        // Device of the replica is loaded until the delegate request is completed
+        request_.replica_lease_.reset();
+        executor_->run(std::move(task_));
+    });
+    delegate_request->start_async();
+}
+
+void DelegateStageExecutor::rethrow_if_failed() {
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class CudaInferRequest;
+
+/**
+ * @brief Executor of the pipeline stage which runs the task after the request is executed by infer requests
+ *        of other compiled models, e.g. model of the shape bucket, replica of the model on another device,
+ *        chain of pipeline stages of the split model or concurrent lanes of micro-batches or tiles
+ */
+class DelegateStageExecutor : public ov::threading::ITaskExecutor {
+public:
+    /**
+     * @param request Request of the pipeline
+     * @param executor Executor which runs tasks after completion of the delegate request
+     */
+    DelegateStageExecutor(CudaInferRequest& request, std::shared_ptr<ov::threading::ITaskExecutor> executor);
+
+    void run(ov::threading::Task task) override;
+
+    /**
+     * Rethrows an error of the delegate requests, should be called by the task of the stage
+     */
+    void rethrow_if_failed();
+
+private:
+    void start(std::size_t index);
+    /**
+     * Starts the next pending micro-batch or tile by the request of the lane or completes the lane if there are none
+     */
+    void start_next_part(ov::IAsyncInferRequest& lane);
+    void fail(std::exception_ptr error);
+
+    CudaInferRequest& request_;
+    std::shared_ptr<ov::threading::ITaskExecutor> executor_;
+    ov::threading::Task task_;
+    std::mutex error_mtx_;
+    std::exception_ptr error_;
+    std::atomic<bool> failed_{false};
+    // Lanes execute tiles of the image rather than micro-batches
+    bool tiles_ = false;
+    std::size_t num_parts_ = 0;
+    std::atomic<std::size_t> next_part_{0};
+    std::atomic<std::size_t> running_lanes_{0};
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
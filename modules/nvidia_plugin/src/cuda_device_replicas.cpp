@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_device_replicas.hpp"
+
+#include <algorithm>
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+DeviceReplicas::DeviceReplicas(std::vector<std::shared_ptr<const ov::ICompiledModel>> replicas)
+    : replicas_{std::move(replicas)}, loads_(replicas_.size(), 0) {
+    OPENVINO_ASSERT(!replicas_.empty());
+}
+
+DeviceReplicas::Lease DeviceReplicas::acquire() {
+    std::lock_guard<std::mutex> lock{mtx_};
+    const auto index = static_cast<std::size_t>(std::min_element(loads_.begin(), loads_.end()) - loads_.begin());
+    ++loads_[index];
+    return Lease{*this, index};
+}
+
+void DeviceReplicas::release(std::size_t index) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    --loads_.at(index);
+}
+
+const std::shared_ptr<const ov::ICompiledModel>& DeviceReplicas::get_replica(std::size_t index) const {
+    return replicas_.at(index);
+}
+
+std::size_t DeviceReplicas::size() const { return replicas_.size(); }
+
+unsigned DeviceReplicas::get_optimal_number_of_infer_requests() const {
+    unsigned result = 0;
+    for (const auto& replica : replicas_) {
+        result += replica->get_property(ov::optimal_number_of_infer_requests.name()).as<unsigned>();
+    }
+    return result;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
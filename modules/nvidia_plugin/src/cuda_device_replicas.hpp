@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "openvino/runtime/icompiled_model.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Replicas of the model compiled for several devices.
+ *
+ * Each replica owns constants and memory pool on its device. Every inference is executed by the replica
+ * with the least number of inferences in flight.
+ */
+class DeviceReplicas {
+public:
+    /**
+     * @brief Keeps the replica loaded by the inference while the lease is alive
+     */
+    class Lease {
+    public:
+        Lease(DeviceReplicas& replicas, std::size_t index) : replicas_{&replicas}, index_{index} {}
+        Lease(Lease&& other) noexcept : replicas_{other.replicas_}, index_{other.index_} { other.replicas_ = nullptr; }
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&&) = delete;
+        ~Lease() {
+            if (replicas_) {
+                replicas_->release(index_);
+            }
+        }
+
+        std::size_t index() const { return index_; }
+
+    private:
+        DeviceReplicas* replicas_;
+        std::size_t index_;
+    };
+
+    explicit DeviceReplicas(std::vector<std::shared_ptr<const ov::ICompiledModel>> replicas);
+
+    /**
+     * @returns Lease of the least loaded replica
+     */
+    Lease acquire();
+
+    const std::shared_ptr<const ov::ICompiledModel>& get_replica(std::size_t index) const;
+
+    std::size_t size() const;
+
+    /**
+     * @returns Sum of optimal numbers of infer requests of all replicas
+     */
+    unsigned get_optimal_number_of_infer_requests() const;
+
+private:
+    void release(std::size_t index);
+
+    std::vector<std::shared_ptr<const ov::ICompiledModel>> replicas_;
+    std::mutex mtx_;
+    std::vector<std::size_t> loads_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -11,9 +11,8 @@ EagerTopologyRunner::EagerTopologyRunner(const CreationContext& context, const s
     : SubGraph(context, model) {}
 
 void EagerTopologyRunner::Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const {
-    Workbuffers workbuffers{};
-    workbuffers.mutable_buffers.emplace_back(memoryBlock.view().data());
-    SubGraph::Execute(context, {}, {}, workbuffers);
+    SubGraph::Execute(context, {}, {}, memoryBlock.workbuffers());
+    launches_.fetch_add(1, std::memory_order_relaxed);
 }
 
 const SubGraph& EagerTopologyRunner::GetSubGraph() const {
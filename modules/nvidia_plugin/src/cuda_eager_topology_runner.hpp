@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <ops/subgraph.hpp>
 
 #include "cuda_itopology_runner.hpp"
@@ -19,6 +20,11 @@ public:
     void Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const override;
     void UpdateContext(InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const override{};
     const SubGraph& GetSubGraph() const override;
+    std::size_t GetGraphLaunches() const override { return 0; }
+    std::size_t GetEagerLaunches() const override { return launches_.load(std::memory_order_relaxed); }
+
+private:
+    mutable std::atomic<std::size_t> launches_{0};
 };
 
 }  // namespace nvidia_gpu
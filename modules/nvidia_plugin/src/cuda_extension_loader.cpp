@@ -0,0 +1,94 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_extension_loader.hpp"
+
+#include <fmt/format.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <error.hpp>
+#include <memory>
+#include <mutex>
+#include <nvidia/extension.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "cuda_operation_registry.hpp"
+#include "ops/extension.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr auto kCreateExtensionsSymbol = "create_nvidia_gpu_extensions";
+
+using CreateExtensions = void (*)(std::vector<OperationExtension::Ptr>&);
+
+std::shared_ptr<void> loadLibrary(const std::string& path) {
+#ifdef _WIN32
+    auto* library = LoadLibraryA(path.c_str());
+    if (library == nullptr) {
+        throw_ov_exception(fmt::format("Failed to load library of extensions {}: error {}", path, GetLastError()));
+    }
+    return {library, [](void* library) { FreeLibrary(static_cast<HMODULE>(library)); }};
+#else
+    auto* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (library == nullptr) {
+        throw_ov_exception(fmt::format("Failed to load library of extensions {}: {}", path, dlerror()));
+    }
+    return {library, [](void* library) { dlclose(library); }};
+#endif
+}
+
+CreateExtensions findCreateExtensions(const std::string& path, const std::shared_ptr<void>& library) {
+#ifdef _WIN32
+    auto* symbol = GetProcAddress(static_cast<HMODULE>(library.get()), kCreateExtensionsSymbol);
+#else
+    auto* symbol = dlsym(library.get(), kCreateExtensionsSymbol);
+#endif
+    if (symbol == nullptr) {
+        throw_ov_exception(fmt::format("Library {} doesn't define NVIDIA extensions ({} isn't found)",
+                                       path,
+                                       kCreateExtensionsSymbol));
+    }
+    return reinterpret_cast<CreateExtensions>(symbol);
+}
+
+}  // namespace
+
+void loadExtensions(const std::string& path) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<void>> libraries;
+    std::lock_guard lock{mutex};
+    if (libraries.count(path) > 0) {
+        return;
+    }
+    auto library = loadLibrary(path);
+    std::vector<OperationExtension::Ptr> extensions;
+    findCreateExtensions(path, library)(extensions);
+    for (auto& extension : extensions) {
+        OPENVINO_ASSERT(extension, "Library of extensions ", path, " returned null extension");
+        const auto type = extension->get_type();
+        // Builder keeps the library loaded as long as operations created by its code may exist
+        OperationRegistry::Register<OperationBase>{
+            type,
+            [extension, library](const CreationContext& context,
+                                 const std::shared_ptr<ov::Node>& node,
+                                 OperationBase::IndexCollection&& inputs,
+                                 OperationBase::IndexCollection&& outputs) -> OperationBase::Ptr {
+                return std::make_shared<ExtensionOp>(
+                    context, *node, std::move(inputs), std::move(outputs), extension->create(*node), library);
+            }};
+    }
+    libraries.emplace(path, std::move(library));
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
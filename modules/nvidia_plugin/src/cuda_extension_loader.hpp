@@ -0,0 +1,21 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Loads the library of extensions (see OPENVINO_NVIDIA_GPU_CREATE_EXTENSIONS) and registers operations of its
+ * extensions in OperationRegistry. The library is kept loaded until the process exits, so loading it again does
+ * nothing
+ * @param path Path of the library
+ */
+void loadExtensions(const std::string& path);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -4,11 +4,14 @@
 
 #include "cuda_graph_context.hpp"
 
+#include <algorithm>
+
 namespace ov {
 namespace nvidia_gpu {
 
 void CudaGraphContext::reset() {
     graphs_.clear();
+    externalBuffers_.clear();
     currentGraphIndex_ = 0;
 }
 
@@ -35,19 +38,76 @@ void CudaGraphContext::add_result(const std::string& tensorName,
     graphs_[currentGraphIndex_].add_result(tensorName, stream, dst, src, size);
 }
 
+void CudaGraphContext::add_packed_parameters(std::shared_ptr<const IoPack> pack,
+                                             const CUDA::Stream& stream,
+                                             CUDA::DevicePointer<void*> dst,
+                                             const void* src) {
+    OPENVINO_ASSERT(currentGraphIndex_ < graphs_.size(), "Graph index/vector size incosistency");
+    graphs_[currentGraphIndex_].add_packed_parameters(std::move(pack), stream, dst, src);
+}
+
+void CudaGraphContext::add_packed_results(std::shared_ptr<const IoPack> pack,
+                                          const CUDA::Stream& stream,
+                                          void* dst,
+                                          CUDA::DevicePointer<const void*> src) {
+    OPENVINO_ASSERT(currentGraphIndex_ < graphs_.size(), "Graph index/vector size incosistency");
+    graphs_[currentGraphIndex_].add_packed_results(std::move(pack), stream, dst, src);
+}
+
 void CudaGraphContext::add_graph(const CUDA::Graph& graph) {
     OPENVINO_ASSERT(currentGraphIndex_ < graphs_.size(), "Graph index/vector size incosistency");
     graphs_[currentGraphIndex_].set_graph(graph);
 }
 
+void CudaGraphContext::set_external_buffers(const ExternalBuffers& externalBuffers) {
+    externalBuffers_ = externalBuffers;
+}
+
+bool CudaGraphContext::is_external_buffers_equal(const ExternalBuffers& externalBuffers) const {
+    return externalBuffers_ == externalBuffers;
+}
+
 bool CudaGraphContext::is_initialized() const {
     const auto size = graphs_.size();
     return size != 0 && graphs_[size - 1].is_initialized();
 }
 
-void CudaGraphContext::update_capture(const TensorMappingContext& context) {
+bool CudaGraphContext::update_capture(const TensorMappingContext& context) {
     for (currentGraphIndex_ = 0; currentGraphIndex_ < graphs_.size(); ++currentGraphIndex_) {
-        graphs_[currentGraphIndex_].update_capture(context);
+        if (!graphs_[currentGraphIndex_].update_capture(context)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<CudaGraphContext::Relocations> CudaGraphContext::find_relocations(
+    const CudaGraphContext& other, const CUDA::Relocation& relocation) const {
+    if (graphs_.size() != other.graphs_.size()) {
+        return std::nullopt;
+    }
+    Relocations relocations;
+    relocations.reserve(graphs_.size());
+    for (std::size_t i = 0; i < graphs_.size(); ++i) {
+        auto graphRelocations = graphs_[i].find_relocations(other.graphs_[i], relocation);
+        if (!graphRelocations) {
+            return std::nullopt;
+        }
+        relocations.push_back(std::move(graphRelocations.value()));
+    }
+    return relocations;
+}
+
+void CudaGraphContext::relocate(const CudaGraphContext& other,
+                                const Relocations& relocations,
+                                const CUDA::Relocation& relocation,
+                                bool instantiate) {
+    OPENVINO_ASSERT(relocations.size() == other.graphs_.size(), "Relocations/graphs count mismatch");
+    reset();
+    externalBuffers_ = other.externalBuffers_;
+    for (std::size_t i = 0; i < other.graphs_.size(); ++i) {
+        start_next_graph_addition();
+        graphs_[currentGraphIndex_].relocate(other.graphs_[i], relocations[i], relocation, instantiate);
     }
 }
 
@@ -81,7 +141,7 @@ void CudaGraphContext::CudaGraphInfo::add_parameter(const std::string& tensorNam
                                                     const void* src,
                                                     std::size_t size) {
     CUDA::CaptureInfo captureInfo{stream};
-    parameterNodes_.emplace(tensorName, captureInfo.addUploadNode(dst, src, size));
+    parameterNodes_[tensorName].push_back(captureInfo.addUploadNode(dst, src, size));
 }
 
 void CudaGraphContext::CudaGraphInfo::add_result(const std::string& tensorName,
@@ -93,6 +153,22 @@ void CudaGraphContext::CudaGraphInfo::add_result(const std::string& tensorName,
     resultNodes_.emplace(tensorName, captureInfo.addDownloadNode(dst, src, size));
 }
 
+void CudaGraphContext::CudaGraphInfo::add_packed_parameters(std::shared_ptr<const IoPack> pack,
+                                                            const CUDA::Stream& stream,
+                                                            CUDA::DevicePointer<void*> dst,
+                                                            const void* src) {
+    add_parameter(pack->entries.front().name, stream, dst, src, pack->size);
+    packedParameters_.push_back(std::move(pack));
+}
+
+void CudaGraphContext::CudaGraphInfo::add_packed_results(std::shared_ptr<const IoPack> pack,
+                                                         const CUDA::Stream& stream,
+                                                         void* dst,
+                                                         CUDA::DevicePointer<const void*> src) {
+    add_result(pack->entries.front().name, stream, dst, src, pack->size);
+    packedResults_.push_back(std::move(pack));
+}
+
 void CudaGraphContext::CudaGraphInfo::set_graph(const CUDA::Graph& graph) {
     graph_.emplace(graph);
     graphExec_.emplace(graph);
@@ -100,12 +176,94 @@ void CudaGraphContext::CudaGraphInfo::set_graph(const CUDA::Graph& graph) {
 
 bool CudaGraphContext::CudaGraphInfo::is_initialized() const { return graph_.has_value() && graphExec_.has_value(); }
 
-void CudaGraphContext::CudaGraphInfo::update_capture(const TensorMappingContext& context) {
-    for (auto&& [tensorName, node] : parameterNodes_) {
-        node.update_src(graphExec_.value(), (context.get_input_tensor(tensorName)->data()));
+bool CudaGraphContext::CudaGraphInfo::update_capture(const TensorMappingContext& context) {
+    // Node of a pack covers tensors of all its entries, so it can't be updated once they are apart
+    for (const auto& pack : packedParameters_) {
+        if (packedInputs(context, *pack) == nullptr) {
+            return false;
+        }
+    }
+    for (const auto& pack : packedResults_) {
+        if (packedOutputs(context, *pack) == nullptr) {
+            return false;
+        }
+    }
+    // Pack is downloaded as a whole, even if the output of its first entry is skipped
+    const auto isDownloaded = [&](const std::string& tensorName) {
+        return !context.is_output_skipped(tensorName) ||
+               std::any_of(packedResults_.begin(), packedResults_.end(), [&](const auto& pack) {
+                   return pack->entries.front().name == tensorName;
+               });
+    };
+    bool changed = false;
+    for (auto&& [tensorName, nodes] : parameterNodes_) {
+        const auto& samples = context.get_input_samples(tensorName);
+        if (samples.empty()) {
+            if (nodes.size() != 1) {
+                return false;
+            }
+            changed |= nodes.front().set_src(context.get_input_tensor(tensorName)->data());
+            continue;
+        }
+        // Graph is recaptured if the number of samples the input is uploaded by changes
+        if (nodes.size() != samples.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            changed |= nodes[i].set_src(samples[i]->data());
+        }
     }
     for (auto&& [tensorName, node] : resultNodes_) {
-        node.update_dst(graphExec_.value(), context.get_output_tensor(tensorName)->data());
+        if (isDownloaded(tensorName)) {
+            changed |= node.set_dst(context.get_output_tensor(tensorName)->data());
+        }
+    }
+    if (changed && !graphExec_.value().try_update(graph_.value())) {
+        return false;
+    }
+    // Downloads of skipped outputs are disabled in the executable graph, so the graph itself stays the same
+    for (auto&& [tensorName, node] : resultNodes_) {
+        node.set_enabled(graphExec_.value(), isDownloaded(tensorName));
+    }
+    return true;
+}
+
+std::optional<CUDA::GraphRelocations> CudaGraphContext::CudaGraphInfo::find_relocations(
+    const CudaGraphInfo& other, const CUDA::Relocation& relocation) const {
+    if (!graph_ || !other.graph_) {
+        return std::nullopt;
+    }
+    std::vector<cudaGraphNode_t> ioNodes;
+    for (const auto& [tensorName, nodes] : parameterNodes_) {
+        for (const auto& node : nodes) {
+            ioNodes.push_back(node.get());
+        }
+    }
+    for (const auto& [tensorName, node] : resultNodes_) {
+        ioNodes.push_back(node.get());
+    }
+    return CUDA::GraphRelocations::find(graph_.value(), other.graph_.value(), relocation, ioNodes);
+}
+
+void CudaGraphContext::CudaGraphInfo::relocate(const CudaGraphInfo& other,
+                                              const CUDA::GraphRelocations& relocations,
+                                              const CUDA::Relocation& relocation,
+                                              bool instantiate) {
+    const auto graph = relocations.apply(other.graph_.value(), relocation);
+    for (const auto& [tensorName, nodes] : other.parameterNodes_) {
+        auto& relocatedNodes = parameterNodes_[tensorName];
+        for (const auto& node : nodes) {
+            relocatedNodes.push_back(node.relocate(graph, relocation));
+        }
+    }
+    for (const auto& [tensorName, node] : other.resultNodes_) {
+        resultNodes_.emplace(tensorName, node.relocate(graph, relocation));
+    }
+    packedParameters_ = other.packedParameters_;
+    packedResults_ = other.packedResults_;
+    graph_.emplace(graph);
+    if (instantiate) {
+        graphExec_.emplace(graph);
     }
 }
 
@@ -117,7 +275,8 @@ std::size_t CudaGraphContext::CudaGraphInfo::get_results_count() const { return
 
 bool operator==(const CudaGraphContext::CudaGraphInfo& lhs, const CudaGraphContext::CudaGraphInfo& rhs) {
     return lhs.graph_ == rhs.graph_ && lhs.graphExec_ == rhs.graphExec_ && lhs.parameterNodes_ == rhs.parameterNodes_ &&
-           lhs.resultNodes_ == rhs.resultNodes_;
+           lhs.resultNodes_ == rhs.resultNodes_ && lhs.packedParameters_ == rhs.packedParameters_ &&
+           lhs.packedResults_ == rhs.packedResults_;
 }
 
 bool operator!=(const CudaGraphContext::CudaGraphInfo& lhs, const CudaGraphContext::CudaGraphInfo& rhs) {
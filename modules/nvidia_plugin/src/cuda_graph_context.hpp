@@ -5,7 +5,12 @@
 #pragma once
 
 #include <cuda/graph.hpp>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <memory_manager/tensor_types.hpp>
 
+#include "cuda_io_pack.hpp"
 #include "cuda_tensor_mapping_context.hpp"
 
 namespace ov {
@@ -29,11 +34,67 @@ public:
                     CUDA::DevicePointer<const void*> src,
                     std::size_t size);
 
+    /**
+     * Adds upload of the whole pack of inputs by a single node, which is updated by the tensor of the first entry.
+     * Graphs are recaptured once input tensors aren't packed anymore (see packedInputs)
+     */
+    void add_packed_parameters(std::shared_ptr<const IoPack> pack,
+                               const CUDA::Stream& stream,
+                               CUDA::DevicePointer<void*> dst,
+                               const void* src);
+
+    /**
+     * Adds download of the whole pack of outputs by a single node, which is updated by the tensor of the first entry.
+     * Graphs are recaptured once output tensors aren't packed anymore (see packedOutputs)
+     */
+    void add_packed_results(std::shared_ptr<const IoPack> pack,
+                            const CUDA::Stream& stream,
+                            void* dst,
+                            CUDA::DevicePointer<const void*> src);
+
     void add_graph(const CUDA::Graph& graph);
 
+    /**
+     * Remembers external buffers which are baked into captured graphs
+     */
+    void set_external_buffers(const ExternalBuffers& externalBuffers);
+
+    /**
+     * @returns true if captured graphs use the same external buffers
+     */
+    bool is_external_buffers_equal(const ExternalBuffers& externalBuffers) const;
+
     bool is_initialized() const;
 
-    void update_capture(const TensorMappingContext& context);
+    /**
+     * Updates I/O memcpy nodes of captured graphs with pointers of the current tensors.
+     * Changed nodes of each graph are applied to its executable graph by a single cudaGraphExecUpdate call.
+     * @returns false if some graph can't be updated in place and graphs should be recaptured
+     */
+    [[nodiscard]] bool update_capture(const TensorMappingContext& context);
+
+    // Pointers into the memory block of each graph of the context
+    using Relocations = std::vector<CUDA::GraphRelocations>;
+
+    /**
+     * Finds pointers into the memory block in graphs of this context by comparing them with graphs of the same
+     * work captured by another context against another memory block (see CUDA::GraphRelocations::find).
+     * I/O nodes aren't compared, they are relocated on their own
+     * @returns std::nullopt if some graph can't be relocated
+     */
+    std::optional<Relocations> find_relocations(const CudaGraphContext& other,
+                                                const CUDA::Relocation& relocation) const;
+
+    /**
+     * Replaces graphs of this context with copies of graphs of another context with the found pointers
+     * relocated, e.g. from the memory block the graphs are captured against to another memory block.
+     * @param relocations Pointers found for graphs of the other context, empty ones just copy the graphs
+     * @param instantiate Whether executable graphs are instantiated for the copies
+     */
+    void relocate(const CudaGraphContext& other,
+                  const Relocations& relocations,
+                  const CUDA::Relocation& relocation,
+                  bool instantiate = true);
 
     void launch(std::size_t index, const CUDA::Stream& stream) const;
 
@@ -59,11 +120,29 @@ private:
                         CUDA::DevicePointer<const void*> src,
                         std::size_t size);
 
+        void add_packed_parameters(std::shared_ptr<const IoPack> pack,
+                                   const CUDA::Stream& stream,
+                                   CUDA::DevicePointer<void*> dst,
+                                   const void* src);
+
+        void add_packed_results(std::shared_ptr<const IoPack> pack,
+                                const CUDA::Stream& stream,
+                                void* dst,
+                                CUDA::DevicePointer<const void*> src);
+
         void set_graph(const CUDA::Graph& graph);
 
         bool is_initialized() const;
 
-        void update_capture(const TensorMappingContext& context);
+        [[nodiscard]] bool update_capture(const TensorMappingContext& context);
+
+        std::optional<CUDA::GraphRelocations> find_relocations(const CudaGraphInfo& other,
+                                                               const CUDA::Relocation& relocation) const;
+
+        void relocate(const CudaGraphInfo& other,
+                      const CUDA::GraphRelocations& relocations,
+                      const CUDA::Relocation& relocation,
+                      bool instantiate);
 
         void launch(const CUDA::Stream& stream) const;
 
@@ -76,14 +155,19 @@ private:
     private:
         std::optional<CUDA::Graph> graph_{};
         std::optional<CUDA::GraphExec> graphExec_{};
-        std::map<std::string, CUDA::UploadNode> parameterNodes_;
+        // Input set by samples (see TensorMappingContext::get_input_samples) has a node per sample
+        std::map<std::string, std::vector<CUDA::UploadNode>> parameterNodes_;
         std::map<std::string, CUDA::DownloadNode> resultNodes_;
+        // Packs transferred by single nodes, which are stored under the names of their first entries
+        std::vector<std::shared_ptr<const IoPack>> packedParameters_;
+        std::vector<std::shared_ptr<const IoPack>> packedResults_;
     };
 
     friend bool operator==(const CudaGraphInfo& lhs, const CudaGraphInfo& rhs);
     friend bool operator!=(const CudaGraphInfo& lhs, const CudaGraphInfo& rhs);
 
     std::vector<CudaGraphInfo> graphs_{};
+    ExternalBuffers externalBuffers_{};
     mutable std::size_t currentGraphIndex_ = 0;
 };
 
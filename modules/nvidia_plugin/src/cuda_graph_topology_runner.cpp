@@ -5,14 +5,18 @@
 #include "cuda_graph_topology_runner.hpp"
 
 #include "cuda/event.hpp"
+#include "cuda/nvtx.hpp"
+#include "cuda_itt.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
 CudaGraphTopologyRunner::CudaGraphTopologyRunner(const CreationContext& context,
-                                                 const std::shared_ptr<const ov::Model>& model)
+                                                 const std::shared_ptr<const ov::Model>& model,
+                                                 const bool shareCaptures)
     : orig_subgraph_{context, model},
-      cuda_graphs_count_{0} {
+      cuda_graphs_count_{0},
+      share_captures_{shareCaptures} {
     std::vector<SubGraph::ExecSequence> sequences;
     SubGraph::ExecSequence currentSequence;
     const auto& origSequence = orig_subgraph_.getExecSequence();
@@ -43,34 +47,40 @@ CudaGraphTopologyRunner::CudaGraphTopologyRunner(const CreationContext& context,
 
 void CudaGraphTopologyRunner::Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const {
     const auto& stream = context.getThreadContext().stream();
+    auto& executionDelegator = context.getExecutionDelegator();
+    executionDelegator.set_stream(stream);
+    executionDelegator.start_graph_launch();
     std::size_t graphIndex = 0;
     for (auto& subgraph : subgraphs_) {
         if (subgraph.IsCudaGraphCompatible()) {
             context.getCudaGraphContext().launch(graphIndex, stream);
             graphIndex++;
+            graph_launches_.fetch_add(1, std::memory_order_relaxed);
         } else {
-            Workbuffers workbuffers{};
-            workbuffers.mutable_buffers.emplace_back(memoryBlock.view().data());
-            subgraph.Execute(context, {}, {}, workbuffers);
+            subgraph.Execute(context, {}, {}, memoryBlock.workbuffers());
+            eager_launches_.fetch_add(1, std::memory_order_relaxed);
         }
     }
+    executionDelegator.stop_graph_launch();
 }
 
 void CudaGraphTopologyRunner::Capture(InferenceRequestContext& context,
                                       const DeviceMemBlock& memoryBlock) const {
+    OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaGraphTopologyRunner::Capture");
+    const CUDA::NvtxRange nvtxRange{"Capture CUDA graphs"};
     const auto& stream = context.getThreadContext().stream();
     auto& graphContext = context.getCudaGraphContext();
 
     graphContext.reset();
+    graphContext.set_external_buffers(context.getExternalBuffers());
+    context.getExecutionDelegator().start_graph_capture();
     for (const auto& subgraph : subgraphs_) {
         if (subgraph.IsCudaGraphCompatible()) {
             graphContext.start_next_graph_addition();
             CUDA::GraphCapture capture{stream};
             {
                 auto scope = capture.getScope();
-                Workbuffers workbuffers{};
-                workbuffers.mutable_buffers.emplace_back(memoryBlock.view().data());
-                subgraph.Capture(context, {}, {}, workbuffers);
+                subgraph.Capture(context, {}, {}, memoryBlock.workbuffers());
             }
             const auto& graph = capture.getGraph();
             graphContext.add_graph(graph);
@@ -78,6 +88,43 @@ void CudaGraphTopologyRunner::Capture(InferenceRequestContext& context,
     }
     OPENVINO_ASSERT(graphContext.get_graphs_count() == GetCudaGraphsCount(),
                     "CudaGraphTopologyRunner/CudaGraphContext graphs count mismatch");
+    if (!share_captures_) {
+        return;
+    }
+
+    const auto memory = memoryBlock.view();
+    std::lock_guard<std::mutex> lock{canonical_mtx_};
+    if (canonical_context_ && !relocations_ && canonical_block_ != memory.data() &&
+        canonical_context_->is_external_buffers_equal(context.getExternalBuffers())) {
+        // Pointers into memory blocks are the parameters, which differ between captures against different blocks
+        relocations_ =
+            canonical_context_->find_relocations(graphContext, {canonical_block_, memory.data(), memory.size()});
+        if (relocations_) {
+            return;
+        }
+    }
+    CudaGraphContext canonicalContext;
+    canonicalContext.relocate(graphContext,
+                              CudaGraphContext::Relocations(graphContext.get_graphs_count()),
+                              {memory.data(), memory.data(), memory.size()},
+                              false);
+    canonical_context_.emplace(std::move(canonicalContext));
+    canonical_block_ = memory.data();
+    relocations_.reset();
+}
+
+bool CudaGraphTopologyRunner::Relocate(InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const {
+    if (!share_captures_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock{canonical_mtx_};
+    if (!relocations_ || !canonical_context_->is_external_buffers_equal(context.getExternalBuffers())) {
+        return false;
+    }
+    const auto memory = memoryBlock.view();
+    context.getCudaGraphContext().relocate(
+        canonical_context_.value(), relocations_.value(), {canonical_block_, memory.data(), memory.size()});
+    return true;
 }
 
 const SubGraph& CudaGraphTopologyRunner::GetSubGraph() const {
@@ -86,16 +133,45 @@ const SubGraph& CudaGraphTopologyRunner::GetSubGraph() const {
 
 std::size_t CudaGraphTopologyRunner::GetCudaGraphsCount() const { return cuda_graphs_count_; }
 
+std::size_t CudaGraphTopologyRunner::GetCaptureHits() const { return capture_hits_.load(std::memory_order_relaxed); }
+
+std::size_t CudaGraphTopologyRunner::GetCaptureMisses() const {
+    return capture_misses_.load(std::memory_order_relaxed);
+}
+
+std::size_t CudaGraphTopologyRunner::GetRecaptures() const { return recaptures_.load(std::memory_order_relaxed); }
+
+std::size_t CudaGraphTopologyRunner::GetGraphLaunches() const {
+    return graph_launches_.load(std::memory_order_relaxed);
+}
+
+std::size_t CudaGraphTopologyRunner::GetEagerLaunches() const {
+    return eager_launches_.load(std::memory_order_relaxed);
+}
+
 void CudaGraphTopologyRunner::UpdateContext(InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const {
-    if (context.getCudaGraphContext().is_initialized()) {
-        UpdateCapture(context);
-    } else {
-        Capture(context, memoryBlock);
+    // Graph is recaptured when I/O memory type changes, e.g. host tensor is replaced by remote one,
+    // or when device pointers of external I/O buffers captured by kernels are changed.
+    // Memory block which hasn't been used yet relocates graphs captured against another block
+    const auto& graphContext = context.getCudaGraphContext();
+    if (graphContext.is_initialized() && graphContext.is_external_buffers_equal(context.getExternalBuffers()) &&
+        UpdateCapture(context)) {
+        capture_hits_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!graphContext.is_initialized() && Relocate(context, memoryBlock) && UpdateCapture(context)) {
+        capture_hits_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    capture_misses_.fetch_add(1, std::memory_order_relaxed);
+    if (graphContext.is_initialized()) {
+        recaptures_.fetch_add(1, std::memory_order_relaxed);
     }
+    Capture(context, memoryBlock);
 }
 
-void CudaGraphTopologyRunner::UpdateCapture(InferenceRequestContext& context) const {
-    context.getCudaGraphContext().update_capture(context.getTensorMappingContext());
+bool CudaGraphTopologyRunner::UpdateCapture(InferenceRequestContext& context) const {
+    return context.getCudaGraphContext().update_capture(context.getTensorMappingContext());
 }
 
 }  // namespace nvidia_gpu
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <optional>
+
 #include "cuda_itopology_runner.hpp"
 
 namespace ov {
@@ -11,7 +15,14 @@ namespace nvidia_gpu {
 
 class CudaGraphTopologyRunner final : public ITopologyRunner {
 public:
-    CudaGraphTopologyRunner(const CreationContext& context, const std::shared_ptr<const ov::Model>& model);
+    /**
+     * @param shareCaptures Whether graphs captured by an infer request are relocated to memory blocks of others.
+     *                      Graphs captured for profiling record events of the profiler of their infer request,
+     *                      so they aren't shared
+     */
+    CudaGraphTopologyRunner(const CreationContext& context,
+                            const std::shared_ptr<const ov::Model>& model,
+                            bool shareCaptures = true);
     ~CudaGraphTopologyRunner() override = default;
 
     void Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const override;
@@ -20,13 +31,45 @@ public:
 
     std::size_t GetCudaGraphsCount() const;
 
+    /**
+     * @returns Number of inferences which reused captured graphs, possibly with updated I/O nodes
+     *          or relocated from another memory block
+     */
+    std::size_t GetCaptureHits() const;
+
+    /**
+     * @returns Number of inferences which (re)captured graphs
+     */
+    std::size_t GetCaptureMisses() const;
+
+    /**
+     * @returns Number of inferences which recaptured graphs already captured for their memory block
+     */
+    std::size_t GetRecaptures() const;
+
+    std::size_t GetGraphLaunches() const override;
+    std::size_t GetEagerLaunches() const override;
+
 private:
     void Capture(InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const;
-    void UpdateCapture(InferenceRequestContext& context) const;
+    bool UpdateCapture(InferenceRequestContext& context) const;
+    bool Relocate(InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const;
 
     std::vector<SubGraph> subgraphs_;
     SubGraph orig_subgraph_;
     std::size_t cuda_graphs_count_;
+    bool share_captures_;
+    mutable std::atomic<std::size_t> capture_hits_{0};
+    mutable std::atomic<std::size_t> capture_misses_{0};
+    mutable std::atomic<std::size_t> recaptures_{0};
+    mutable std::atomic<std::size_t> graph_launches_{0};
+    mutable std::atomic<std::size_t> eager_launches_{0};
+    // Copy of the latest captured graphs, which other memory blocks relocate instead of capturing their own,
+    // once pointers into the memory block are found by comparing it with graphs captured against another block
+    mutable std::mutex canonical_mtx_;
+    mutable std::optional<CudaGraphContext> canonical_context_;
+    mutable const void* canonical_block_ = nullptr;
+    mutable std::optional<CudaGraphContext::Relocations> relocations_;
 };
 
 }  // namespace nvidia_gpu
@@ -5,8 +5,11 @@
 #pragma once
 
 #include <cuda/event.hpp>
+#include <cuda/nvtx.hpp>
+#include <cuda_chrome_trace.hpp>
 #include <cuda/runtime.hpp>
 #include <cuda_perf_counts.hpp>
+#include <optional>
 
 #include "openvino/runtime/profiling_info.hpp"
 #include "ops/subgraph.hpp"
@@ -14,6 +17,19 @@
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * Creates NVTX range of the operation, which lines up its kernels with it in Nsight Systems timelines
+ * @param enabled Whether NVTX ranges are enabled (see ov::nvidia_gpu::nvtx_ranges)
+ * @return NVTX range or std::nullopt if ranges are disabled
+ */
+inline std::optional<CUDA::NvtxRange> make_nvtx_range(bool enabled, const IOperationMeta& op) {
+    if (!enabled) {
+        return std::nullopt;
+    }
+    return std::optional<CUDA::NvtxRange>{
+        std::in_place, op.GetName() + " (" + op.GetTypeName() + ", " + std::string{op.GetCategory()} + ")"};
+}
+
 /**
  * Interface for Profiler class or other Delegators
  */
@@ -40,6 +56,21 @@ public:
      */
     virtual void stop_stage(PerfStages stage) = 0;
 
+    /**
+     * Notifies that CUDA graphs of the topology are (re)captured, graphs captured before are discarded
+     */
+    virtual void start_graph_capture() = 0;
+
+    /**
+     * Start time measurement of the launch of captured CUDA graphs, which replaces execution of the topology
+     */
+    virtual void start_graph_launch() = 0;
+
+    /**
+     * Stop time measurement of the launch of captured CUDA graphs
+     */
+    virtual void stop_graph_launch() = 0;
+
     /**
      * Execute sequence from SubGraph/TensorIterator class
      * @param subGraphPtr Pointer to SubGraph
@@ -80,6 +111,12 @@ public:
      * @param mode Value of CUDA::Event::RecordMode to set
      */
     virtual void set_cuda_event_record_mode(CUDA::Event::RecordMode mode) = 0;
+
+    /**
+     * Sets tags of trace events of operations of the inference (see ov::nvidia_gpu::trace_file)
+     * @param tags Request and memory block of the inference
+     */
+    virtual void set_trace_tags(const ChromeTrace::Tags& tags) = 0;
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,211 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_implementation_selection.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda/event.hpp>
+#include <cuda_graph_context.hpp>
+#include <cuda_inference_request_context.hpp>
+#include <cuda_simple_execution_delegator.hpp>
+#include <cuda_thread_context_pool.hpp>
+#include <error.hpp>
+#include <limits>
+#include <optional>
+#include <sstream>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr auto kNumBenchmarkRuns = 10;
+constexpr unsigned kMinTunedBlockSize = 128;
+
+std::vector<CUDA::Allocation> allocate(const CUDA::Stream& stream, const std::vector<size_t>& sizes) {
+    std::vector<CUDA::Allocation> allocations;
+    allocations.reserve(sizes.size());
+    for (const auto size : sizes) {
+        allocations.push_back(stream.malloc(std::max<size_t>(size, 1)));
+        // Inputs are zeroed, so that timings don't depend on NaNs or denormals of uninitialized memory
+        throwIfError(cudaMemsetAsync(allocations.back().get(), 0, std::max<size_t>(size, 1), stream.get()));
+    }
+    return allocations;
+}
+
+/**
+ * @returns Average time of execution of the operation in milliseconds on buffers of shapes of the node
+ */
+float benchmark(const CreationContext& context, const ov::Node& node, OperationBase& operation) {
+    // Streams and handles of the device are reused by benchmarks of all operations instead of being created for each
+    context.device().setCurrent();
+    const auto lease = ThreadContextPool::forDevice(context.device())->acquire();
+    const auto& threadContext = lease.get();
+    const auto& stream = threadContext.stream();
+    std::vector<size_t> inputSizes;
+    for (const auto& input : node.inputs()) {
+        inputSizes.push_back(input.get_tensor().size());
+    }
+    std::vector<size_t> outputSizes;
+    for (const auto& output : node.outputs()) {
+        outputSizes.push_back(output.get_tensor().size());
+    }
+    const auto request = operation.GetWorkBufferRequest();
+    const auto inputAllocations = allocate(stream, inputSizes);
+    const auto outputAllocations = allocate(stream, outputSizes);
+    const auto immutableAllocations = allocate(stream, request.immutable_sizes);
+    const auto mutableAllocations = allocate(stream, request.mutable_sizes);
+    std::vector<CUDA::DevicePointer<const void*>> inputs(inputAllocations.begin(), inputAllocations.end());
+    std::vector<CUDA::DevicePointer<void*>> outputs(outputAllocations.begin(), outputAllocations.end());
+    IOperationExec::Buffers immutableBuffers(immutableAllocations.begin(), immutableAllocations.end());
+    if (!immutableBuffers.empty()) {
+        operation.InitSharedImmutableWorkbuffers(immutableBuffers);
+    }
+    Workbuffers workbuffers{{immutableBuffers.begin(), immutableBuffers.end()},
+                            {mutableAllocations.begin(), mutableAllocations.end()}};
+
+    const std::vector<std::shared_ptr<ov::Tensor>> emptyTensors;
+    const std::map<std::string, std::size_t> emptyMapping;
+    CancellationToken token;
+    SimpleExecutionDelegator executionDelegator;
+    CudaGraphContext cudaGraphContext;
+    const InferenceRequestContext inferRequestContext{emptyTensors,
+                                                      emptyMapping,
+                                                      emptyTensors,
+                                                      emptyMapping,
+                                                      threadContext,
+                                                      token,
+                                                      executionDelegator,
+                                                      cudaGraphContext,
+                                                      true};
+    const auto lock = context.lockBenchmarks();
+    // The first run includes lazy initialization (e.g. loading of kernels), so it isn't measured
+    operation.Execute(inferRequestContext, inputs, outputs, workbuffers);
+    CUDA::Event start;
+    CUDA::Event stop;
+    start.record(stream);
+    for (int i = 0; i < kNumBenchmarkRuns; ++i) {
+        operation.Execute(inferRequestContext, inputs, outputs, workbuffers);
+    }
+    stop.record(stream);
+    stop.synchronize();
+    return stop.elapsedSince(start) / kNumBenchmarkRuns;
+}
+
+}  // namespace
+
+std::string shapesTuningKey(const ov::Node& node) {
+    std::ostringstream key;
+    key << node.get_type_info().name;
+    for (const auto& input : node.inputs()) {
+        key << ';' << input.get_element_type() << input.get_shape();
+    }
+    key << "->";
+    for (const auto& output : node.outputs()) {
+        key << ';' << output.get_element_type() << output.get_shape();
+    }
+    return key.str();
+}
+
+OperationBase::Ptr createFastestImplementation(const CreationContext& context,
+                                               ov::Node& node,
+                                               const std::string& key,
+                                               const std::vector<ImplementationCandidate>& candidates) {
+    const auto& tuningCache = context.tuningCache();
+    const auto cacheKey = "implementation:" + key;
+    const auto cached = tuningCache ? tuningCache->find(cacheKey) : std::nullopt;
+    std::stringstream exception_msg;
+    auto create = [&](const ImplementationCandidate& candidate) -> OperationBase::Ptr {
+        try {
+            return candidate.create();
+        } catch (const std::exception& e) {
+            exception_msg << fmt::format("\nFailed to create {} impl: {}", candidate.name, e.what());
+            return nullptr;
+        }
+    };
+    auto select = [&](const ImplementationCandidate& candidate, OperationBase::Ptr operation) {
+        node.get_rt_info()[IMPLEMENTATION_NAME] = candidate.name;
+        return operation;
+    };
+    if (cached) {
+        for (const auto& candidate : candidates) {
+            if (candidate.name == *cached) {
+                if (auto operation = create(candidate)) {
+                    return select(candidate, std::move(operation));
+                }
+            }
+        }
+    }
+    if (!context.opBenchOption()) {
+        for (const auto& candidate : candidates) {
+            if (candidate.benchmarkOnly) {
+                continue;
+            }
+            if (auto operation = create(candidate)) {
+                return operation;
+            }
+        }
+        throw_ov_exception(
+            fmt::format("{} node is not supported:{}", node.get_type_info().name, exception_msg.str()));
+    }
+
+    const ImplementationCandidate* fastest = nullptr;
+    OperationBase::Ptr fastestOperation;
+    float fastestTime = std::numeric_limits<float>::max();
+    size_t numSupported = 0;
+    for (const auto& candidate : candidates) {
+        auto operation = create(candidate);
+        if (!operation) {
+            continue;
+        }
+        ++numSupported;
+        try {
+            const auto time = benchmark(context, node, *operation);
+            if (time < fastestTime) {
+                fastest = &candidate;
+                fastestTime = time;
+                fastestOperation = std::move(operation);
+            }
+        } catch (const std::exception& e) {
+            exception_msg << fmt::format("\nFailed to execute {} impl: {}", candidate.name, e.what());
+        }
+    }
+    if (!fastest) {
+        throw_ov_exception(
+            fmt::format("{} node is not supported:{}", node.get_type_info().name, exception_msg.str()));
+    }
+    if (tuningCache && numSupported > 1) {
+        tuningCache->store(cacheKey, fastest->name);
+    }
+    if (!fastestOperation->GetWorkBufferRequest().immutable_sizes.empty()) {
+        // Immutable work buffers of the benchmarked operation are initialized already, so it is created again
+        fastestOperation = create(*fastest);
+        OPENVINO_ASSERT(fastestOperation, "Failed to create ", fastest->name, " impl again:", exception_msg.str());
+    }
+    return select(*fastest, std::move(fastestOperation));
+}
+
+OperationBase::Ptr createWithTunedBlockSize(const CreationContext& context,
+                                            ov::Node& node,
+                                            const std::function<OperationBase::Ptr(const CreationContext&)>& create) {
+    const auto defaultSize = context.maxThreadsPerBlock();
+    std::vector<unsigned> sizes{defaultSize};
+    const auto maxSize = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    for (unsigned size = kMinTunedBlockSize; size <= maxSize; size *= 2) {
+        if (size != defaultSize) {
+            sizes.push_back(size);
+        }
+    }
+    std::vector<ImplementationCandidate> candidates;
+    candidates.reserve(sizes.size());
+    for (const auto size : sizes) {
+        candidates.push_back({fmt::format("ThreadsPerBlock{}", size),
+                              [&context, &create, size] { return create(context.withMaxThreadsPerBlock(size)); }});
+    }
+    return createFastestImplementation(context, node, "block_size:" + shapesTuningKey(node), candidates);
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
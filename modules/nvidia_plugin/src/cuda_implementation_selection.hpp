@@ -0,0 +1,64 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_creation_context.hpp>
+#include <cuda_operation_base.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Key of rt_info of a node, which contains name of the implementation selected by benchmarks
+ */
+static const char IMPLEMENTATION_NAME[] = "nvidia_implementation";
+
+/**
+ * @brief Implementation of an operation, which may be created for a node
+ */
+struct ImplementationCandidate {
+    std::string name;
+    std::function<OperationBase::Ptr()> create;
+    // Candidate is tried only if implementations are benchmarked (e.g. it is slower in most cases)
+    bool benchmarkOnly = false;
+};
+
+/**
+ * @brief Creates an operation by one of candidate implementations of the node.
+ *
+ * The first candidate which supports the node is created by default. If ov::nvidia_gpu::operation_benchmark
+ * is enabled, all candidates supporting the node are executed on its shapes and the fastest one is created.
+ * The selected implementation is cached in CreationContext::tuningCache, so that it is reused without
+ * benchmarks, and is recorded in rt_info of the node (see IMPLEMENTATION_NAME)
+ * @param key Part of the key of the cache, which identifies parameters of the node (e.g. shapes and attributes)
+ * @throws ov::Exception if none of the candidates supports the node
+ */
+OperationBase::Ptr createFastestImplementation(const CreationContext& context,
+                                               ov::Node& node,
+                                               const std::string& key,
+                                               const std::vector<ImplementationCandidate>& candidates);
+
+/**
+ * @brief Creates an operation with the number of threads per block of its kernels selected by benchmarks.
+ *
+ * Candidates are the occupancy block size of the device (CreationContext::maxThreadsPerBlock), which is created
+ * by default, and powers of two from 128 up to the limit of the device. They are selected and cached like
+ * implementations of createFastestImplementation()
+ * @param create Creates the operation with the given context, which limits the size of blocks
+ */
+OperationBase::Ptr createWithTunedBlockSize(const CreationContext& context,
+                                            ov::Node& node,
+                                            const std::function<OperationBase::Ptr(const CreationContext&)>& create);
+
+/**
+ * @returns Key of the node which is identified by element types and shapes of its inputs and outputs
+ */
+std::string shapesTuningKey(const ov::Node& node);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -9,22 +9,29 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <description_buffer.hpp>
 #include <gsl/span_ext>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <threading/ie_executor_manager.hpp>
+#include <unordered_map>
 #include <utility>
 
 #include "cuda_compiled_model.hpp"
 #include "cuda_graph_topology_runner.hpp"
+#include "cuda_io_pack.hpp"
 #include "cuda_itt.hpp"
 #include "cuda_plugin.hpp"
 #include "cuda_profiler.hpp"
+#include "cuda_remote_tensor.hpp"
 #include "cuda_simple_execution_delegator.hpp"
 #include "nvidia/properties.hpp"
 #include "openvino/runtime/make_tensor.hpp"
+#include "utils/precision_conversion.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -33,20 +40,213 @@ using namespace utils;
 using Time = std::chrono::steady_clock;
 
 namespace {
-void allocate_tensor_impl(ov::SoPtr<ov::ITensor>& tensor, const ov::element::Type& element_type, const ov::Shape& shape) {
+void allocate_tensor_impl(ov::SoPtr<ov::ITensor>& tensor,
+                          const ov::element::Type& element_type,
+                          const ov::Shape& shape,
+                          const ov::Allocator& allocator = {}) {
     if (!tensor || tensor->get_element_type() != element_type) {
-        tensor = ov::SoPtr<ov::ITensor>{ov::make_tensor(element_type, shape), nullptr};
+        tensor = ov::SoPtr<ov::ITensor>{ov::make_tensor(element_type, shape, allocator), nullptr};
     } else {
         tensor->set_shape(shape);
     }
 }
 
-inline std::unique_ptr<IExecutionDelegator> create_execution_delegator(bool is_profiling_enabled,
-                                                                       const SubGraph& subGraph) {
-    if (is_profiling_enabled) {
-        return std::make_unique<Profiler>(subGraph);
+/**
+ * Places a host tensor at the offset of its entry in the page-locked arena of the pack, so tensors of all entries
+ * are transferred by a single copy (see IoPack). Tensors of other sizes are allocated separately
+ */
+class IoPackSlotAllocator {
+public:
+    IoPackSlotAllocator(std::shared_ptr<void> arena, const IoPack::Entry& entry, ov::Allocator fallback)
+        : arena_{std::move(arena)}, offset_{entry.offset}, size_{entry.size}, fallback_{std::move(fallback)} {}
+
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+        if (bytes == size_) {
+            return static_cast<std::uint8_t*>(arena_.get()) + offset_;
+        }
+        return fallback_.allocate(bytes, alignment);
+    }
+    void deallocate(void* p, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+        if (p != static_cast<std::uint8_t*>(arena_.get()) + offset_) {
+            fallback_.deallocate(p, bytes, alignment);
+        }
+    }
+    bool is_equal(const IoPackSlotAllocator& other) const noexcept {
+        return arena_ == other.arena_ && offset_ == other.offset_;
+    }
+
+private:
+    std::shared_ptr<void> arena_;
+    std::size_t offset_;
+    std::size_t size_;
+    ov::Allocator fallback_;
+};
+
+/**
+ * @returns Allocators of host tensors of the entries of the pack by index of their Parameter (or Result)
+ */
+std::unordered_map<std::size_t, ov::Allocator> allocate_io_pack(const IoPack* pack, ov::Allocator allocator) {
+    std::unordered_map<std::size_t, ov::Allocator> allocators;
+    if (pack == nullptr) {
+        return allocators;
+    }
+    std::shared_ptr<void> arena{allocator.allocate(pack->size),
+                                [allocator, size = pack->size](void* p) mutable { allocator.deallocate(p, size); }};
+    for (const auto& entry : pack->entries) {
+        allocators.emplace(entry.index, IoPackSlotAllocator{arena, entry, allocator});
+    }
+    return allocators;
+}
+
+/**
+ * @returns Staging tensor of the port, which the model transfers in the given precision of the device,
+ *          nullptr if the port is transferred as is (see ov::nvidia_gpu::device_precision_io)
+ */
+std::shared_ptr<ov::Tensor> make_converted_tensor(const ov::Output<const ov::Node>& port,
+                                                  const ov::element::Type& device_type,
+                                                  const ov::Allocator& allocator) {
+    if (port.get_element_type() == device_type) {
+        return nullptr;
+    }
+    OPENVINO_ASSERT(utils::isConvertiblePrecision(port.get_element_type(), device_type),
+                    "Port ",
+                    port,
+                    " can't be transferred in ",
+                    device_type,
+                    " by ",
+                    ov::nvidia_gpu::device_precision_io.name());
+    return std::make_shared<ov::Tensor>(device_type, port.get_shape(), allocator);
+}
+
+/**
+ * Converts precision of the tensor, user tensors may be ROIs, which are converted via continuous copies
+ */
+void convert_tensor(const ov::Tensor& src, ov::Tensor& dst) {
+    if (!src.is_continuous()) {
+        ov::Tensor continuous{src.get_element_type(), src.get_shape()};
+        src.copy_to(continuous);
+        convert_tensor(continuous, dst);
+    } else if (!dst.is_continuous()) {
+        ov::Tensor continuous{dst.get_element_type(), dst.get_shape()};
+        convert_tensor(src, continuous);
+        continuous.copy_to(dst);
+    } else {
+        utils::convertPrecision(src, dst);
+    }
+}
+
+/**
+ * @param peer_device_id Device of the pipeline stage producing the input, which is accessed peer-to-peer
+ */
+std::shared_ptr<ov::Tensor> wrap_remote_tensor(const ov::SoPtr<ov::ITensor>& tensor,
+                                               int device_id,
+                                               std::optional<int> peer_device_id = std::nullopt) {
+    auto remote_tensor = std::dynamic_pointer_cast<RemoteTensorImpl>(tensor._ptr);
+    OPENVINO_ASSERT(remote_tensor, "NVIDIA plugin supports only remote tensors created by its own remote context");
+    const auto tensor_device_id = remote_tensor->get_context()->get_device_id();
+    OPENVINO_ASSERT(tensor_device_id == device_id || tensor_device_id == peer_device_id,
+                    "Remote tensor is located on device ",
+                    tensor_device_id,
+                    " while the model is compiled for device ",
+                    device_id);
+    // Device memory of the tensor is bound directly, Parameter/Result perform device-to-device copies,
+    // output of the previous pipeline stage is accessed peer-to-peer
+    return std::make_shared<ov::Tensor>(
+        remote_tensor->get_element_type(), remote_tensor->get_shape(), remote_tensor->get_device_ptr());
+}
+
+inline std::unique_ptr<IExecutionDelegator> create_execution_delegator(
+    const CompiledModel& compiled_model,
+    std::shared_ptr<utils::LatencyHistograms> stage_latencies,
+    std::shared_ptr<ChromeTrace> trace) {
+    // Operations of dynamic, replicated, split, micro-batched and tiled models are profiled by infer requests of
+    // shape buckets, replicas, pipeline stages, micro-batches and tiles
+    const bool nvtx_ranges = compiled_model.get_property(ov::nvidia_gpu::nvtx_ranges.name()).as<bool>();
+    const bool profiling = compiled_model.get_property(ov::enable_profiling.name()).as<bool>() || trace;
+    if (profiling && !compiled_model.get_shape_buckets() && !compiled_model.get_device_replicas() &&
+        !compiled_model.get_pipeline_stages() && !compiled_model.get_micro_batches() && !compiled_model.get_tiles()) {
+        std::optional<int> hardware_counters_device;
+        if (compiled_model.get_property(ov::nvidia_gpu::hardware_counters.name()).as<bool>() &&
+            compiled_model.get_property(ov::enable_profiling.name()).as<bool>()) {
+            hardware_counters_device = std::stoi(compiled_model.get_property(ov::device::id.name()).as<std::string>());
+        }
+        return std::make_unique<Profiler>(compiled_model.get_topology_runner().GetSubGraph(),
+                                          nvtx_ranges,
+                                          std::move(stage_latencies),
+                                          std::move(trace),
+                                          hardware_counters_device);
     }
-    return std::make_unique<SimpleExecutionDelegator>();
+    return std::make_unique<SimpleExecutionDelegator>(nvtx_ranges);
+}
+
+void copy_block(const std::uint8_t* src,
+                const ov::Strides& src_strides,
+                std::uint8_t* dst,
+                const ov::Strides& dst_strides,
+                const ov::Shape& block,
+                std::size_t dim) {
+    if (dim + 1 >= block.size()) {
+        // The innermost dimension is contiguous in both tensors, strides are in bytes
+        std::memcpy(dst, src, block.empty() ? src_strides.back() : block.back() * src_strides.back());
+        return;
+    }
+    for (std::size_t i = 0; i < block[dim]; ++i) {
+        copy_block(src + i * src_strides[dim], src_strides, dst + i * dst_strides[dim], dst_strides, block, dim + 1);
+    }
+}
+
+/**
+ * Copies block of elements at the given coordinates between dense tensors of the same rank and element type
+ */
+void copy_block(const void* src,
+                const ov::Shape& src_shape,
+                const ov::Coordinate& src_begin,
+                void* dst,
+                const ov::Shape& dst_shape,
+                const ov::Coordinate& dst_begin,
+                const ov::Shape& block,
+                const ov::element::Type& element_type) {
+    OPENVINO_ASSERT(element_type.bitwidth() % 8 == 0, "Element type ", element_type, " isn't supported");
+    OPENVINO_ASSERT(src_shape.size() == block.size() && dst_shape.size() == block.size());
+    OPENVINO_ASSERT(src_begin.size() == block.size() && dst_begin.size() == block.size());
+    auto byte_strides = [&element_type](const ov::Shape& shape) {
+        ov::Strides strides(std::max<std::size_t>(shape.size(), 1), element_type.size());
+        for (std::size_t i = shape.size(); i > 1; --i) {
+            strides[i - 2] = strides[i - 1] * shape[i - 1];
+        }
+        return strides;
+    };
+    auto byte_offset = [](const ov::Coordinate& begin, const ov::Strides& strides) {
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < begin.size(); ++i) {
+            offset += begin[i] * strides[i];
+        }
+        return offset;
+    };
+    if (ov::shape_size(block) == 0) {
+        return;
+    }
+    const auto src_strides = byte_strides(src_shape);
+    const auto dst_strides = byte_strides(dst_shape);
+    copy_block(static_cast<const std::uint8_t*>(src) + byte_offset(src_begin, src_strides),
+               src_strides,
+               static_cast<std::uint8_t*>(dst) + byte_offset(dst_begin, dst_strides),
+               dst_strides,
+               block,
+               0);
+}
+
+/**
+ * Copies leading block of elements between dense tensors of the same rank and element type
+ */
+void copy_block(const void* src,
+                const ov::Shape& src_shape,
+                void* dst,
+                const ov::Shape& dst_shape,
+                const ov::Shape& block,
+                const ov::element::Type& element_type) {
+    const ov::Coordinate origin(block.size(), 0);
+    copy_block(src, src_shape, origin, dst, dst_shape, origin, block, element_type);
 }
 
 }  // namespace
@@ -54,10 +254,11 @@ inline std::unique_ptr<IExecutionDelegator> create_execution_delegator(bool is_p
 CudaInferRequest::CudaInferRequest(const std::shared_ptr<const CompiledModel>& compiled_model)
     : ov::ISyncInferRequest(compiled_model),
       cancellation_token_{[this] { memory_proxy_.reset(); }},
+      trace_{compiled_model->trace_},
       executionDelegator_{
-          create_execution_delegator(compiled_model->get_property(ov::enable_profiling.name()).as<bool>(),
-                                     compiled_model->get_topology_runner().GetSubGraph())},
-      is_benchmark_mode_{compiled_model->get_property(ov::nvidia_gpu::operation_benchmark.name()).as<bool>()} {
+          create_execution_delegator(*compiled_model, compiled_model->stage_latencies_, compiled_model->trace_)},
+      is_benchmark_mode_{compiled_model->get_property(ov::nvidia_gpu::operation_benchmark.name()).as<bool>()},
+      pinned_allocator_{CUDA::PinnedHostAllocator{compiled_model->numa_node_}} {
     create_infer_request();
 }
 
@@ -73,49 +274,159 @@ void CudaInferRequest::create_infer_request() {
         openvino::itt::handle(name + "_StartPipline"),
         openvino::itt::handle(name + "_WaitPipline"),
     };
+    if (compiled_model->config_.is_nvtx_ranges_enabled()) {
+        nvtx_stage_names_ = {
+            name + "_Preprocess",
+            name + "_Postprocess",
+            name + "_StartPipeline",
+            name + "_WaitPipeline",
+        };
+    }
+    if (trace_) {
+        // Requests of shape buckets, replicas and stages share the trace, so they are numbered by the trace
+        trace_tags_.request = trace_->nextRequest();
+    }
+
+    for (const auto& variable : compiled_model->model_->get_variables()) {
+        auto state = std::make_shared<VariableState>(variable->get_info());
+        variable_states_by_id_.emplace(state->get_name(), state);
+        variable_states_.push_back(std::move(state));
+    }
 
     // Allocate plugin backend specific memory handles
     input_tensors_.resize(get_inputs().size());
     output_tensors_.resize(get_outputs().size());
+    wrapped_inputs_.resize(get_inputs().size());
+    wrapped_outputs_.resize(get_outputs().size());
 
     // Allocate input/output tensors
-    for (const auto& input : get_inputs()) {
-        allocate_tensor(input, [input](ov::SoPtr<ov::ITensor>& tensor) {
+    // NOTE: Tensors handed out by get_tensor() are backed by page-locked staging memory owned by this request,
+    //       so that Parameter/Result transfers are performed asynchronously by DMA engine.
+    //       Small inputs and outputs packed by the model share an arena laid out as their device buffers
+    std::unordered_map<std::size_t, ov::Allocator> input_allocators;
+    std::unordered_map<std::size_t, ov::Allocator> output_allocators;
+    // Topology runner may be replaced by background tuning or weights updates, which keep the layout of I/O packs
+    const auto topology_runner = compiled_model->get_executable().topology_runner;
+    if (topology_runner) {
+        const auto& subgraph = topology_runner->GetSubGraph();
+        input_allocators = allocate_io_pack(subgraph.inputPack(), pinned_allocator_);
+        output_allocators = allocate_io_pack(subgraph.outputPack(), pinned_allocator_);
+    }
+    const auto allocator_of = [this](const auto& allocators, std::size_t index) -> const ov::Allocator& {
+        const auto allocator = allocators.find(index);
+        return allocator != allocators.end() ? allocator->second : pinned_allocator_;
+    };
+    for (std::size_t i = 0; i < get_inputs().size(); ++i) {
+        const auto& input = get_inputs()[i];
+        const auto& allocator = allocator_of(input_allocators, i);
+        allocate_tensor(input, [&input, &allocator](ov::SoPtr<ov::ITensor>& tensor) {
             // Can add a check to avoid double work in case of shared tensors
             allocate_tensor_impl(tensor,
                                  input.get_element_type(),
-                                 input.get_partial_shape().is_dynamic() ? ov::Shape{0} : input.get_shape());
+                                 input.get_partial_shape().is_dynamic() ? ov::Shape{0} : input.get_shape(),
+                                 allocator);
         });
     }
-    for (const auto& output : get_outputs()) {
-        allocate_tensor(output, [output](ov::SoPtr<ov::ITensor>& tensor) {
+    for (std::size_t i = 0; i < get_outputs().size(); ++i) {
+        const auto& output = get_outputs()[i];
+        const auto& allocator = allocator_of(output_allocators, i);
+        allocate_tensor(output, [&output, &allocator](ov::SoPtr<ov::ITensor>& tensor) {
             // Can add a check to avoid double work in case of shared tensors
             allocate_tensor_impl(tensor,
                                  output.get_element_type(),
-                                 output.get_partial_shape().is_dynamic() ? ov::Shape{0} : output.get_shape());
+                                 output.get_partial_shape().is_dynamic() ? ov::Shape{0} : output.get_shape(),
+                                 allocator);
         });
     }
+    // Parameters and Results of the model may be in the precision of the device, then staging tensors of their
+    // size take the places of user tensors in the pack. Inputs of batched models are converted by batched requests
+    converted_inputs_.resize(get_inputs().size());
+    converted_outputs_.resize(get_outputs().size());
+    if (topology_runner && !compiled_model->get_batch_scheduler()) {
+        const auto& parameters = compiled_model->model_->get_parameters();
+        const auto& results = compiled_model->model_->get_results();
+        for (std::size_t i = 0; i < get_inputs().size(); ++i) {
+            converted_inputs_[i] = make_converted_tensor(
+                get_inputs()[i], parameters.at(i)->get_element_type(), allocator_of(input_allocators, i));
+        }
+        for (std::size_t i = 0; i < get_outputs().size(); ++i) {
+            converted_outputs_[i] = make_converted_tensor(
+                get_outputs()[i], results.at(i)->get_element_type(), allocator_of(output_allocators, i));
+        }
+    }
 }
 
 void CudaInferRequest::infer_preprocess() {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[PerfStages::Preprocess]);
+    const auto nvtxRange = make_stage_nvtx_range(PerfStages::Preprocess);
+    const auto traceScope = make_trace_scope("preprocess");
     executionDelegator_->start_stage();
 
-    convert_batched_tensors();
+    const auto latency_budget = get_nvidia_model()->config_.get_latency_budget();
+    cancellation_token_.reset();
+    cancellation_token_.setDeadline(latency_budget.count() > 0
+                                        ? std::make_optional(CancellationToken::Clock::now() + latency_budget)
+                                        : std::nullopt);
+    gather_batched_tensors();
     check_tensors();
+    inflight_.emplace(get_nvidia_model()->inflight_requests_);
 
+    if (get_nvidia_model()->get_device_replicas()) {
+        prepare_replica_request();
+        executionDelegator_->stop_stage(PerfStages::Preprocess);
+        return;
+    }
+    if (get_nvidia_model()->get_pipeline_stages()) {
+        prepare_stage_requests();
+        executionDelegator_->stop_stage(PerfStages::Preprocess);
+        return;
+    }
+    if (get_nvidia_model()->get_micro_batches()) {
+        prepare_micro_batch_requests();
+        executionDelegator_->stop_stage(PerfStages::Preprocess);
+        return;
+    }
+    if (get_nvidia_model()->get_tiles()) {
+        prepare_tile_requests();
+        executionDelegator_->stop_stage(PerfStages::Preprocess);
+        return;
+    }
+
+    const auto device_id = get_nvidia_model()->config_.get_device_id();
+    // Inputs/outputs of batched and dynamic models are staged via host tensors of another infer request
+    const auto is_delegated =
+        get_nvidia_model()->get_batch_scheduler() != nullptr || get_nvidia_model()->get_shape_buckets() != nullptr;
     // Allocate host input tensors
     OPENVINO_ASSERT(get_inputs().size() == input_tensors_.size());
     for (size_t i = 0; i < get_inputs().size(); i++) {
-        auto tensor = ov::make_tensor(get_tensor(get_inputs()[i]));
+        const auto& input_tensor = get_tensor(get_inputs()[i]);
+        if (const auto& converted = converted_inputs_[i]) {
+            // Contents of the same user tensor may change, so it is converted by every inference
+            const auto tensor = ov::make_tensor(input_tensor);
+            OPENVINO_ASSERT(!tensor.is<ov::RemoteTensor>(),
+                            "Remote tensors can't be set to inputs converted by ",
+                            ov::nvidia_gpu::device_precision_io.name());
+            convert_tensor(tensor, *converted);
+            input_tensors_.at(i) = converted;
+            continue;
+        }
+        if (is_wrapped(input_tensor, wrapped_inputs_[i])) {
+            continue;
+        }
+        wrapped_inputs_[i] = {};
+        auto tensor = ov::make_tensor(input_tensor);
         ov::element::Type element_type = tensor.get_element_type();
         ov::Shape shape = tensor.get_shape();
         if (tensor.is<ov::RemoteTensor>()) {
-            OPENVINO_ASSERT(true, "NVIDIA plugin doesn't support remote tensor.");
+            OPENVINO_ASSERT(!is_delegated, "Remote tensors are not supported with dynamic batching and shapes");
+            const auto& peer_inputs = get_nvidia_model()->peer_inputs_;
+            const auto peer = peer_inputs.find(i);
+            input_tensors_.at(i) = wrap_remote_tensor(
+                input_tensor, device_id, peer != peer_inputs.end() ? std::optional<int>{peer->second} : std::nullopt);
         } else if (tensor.is_continuous()) {
-            // No ROI extraction is needed
-            input_tensors_.at(i) =
-                std::make_shared<ov::Tensor>(element_type, shape, tensor.data());
+            // No ROI extraction is needed, the wrapper is reused while the memory of the tensor is the same
+            input_tensors_.at(i) = std::make_shared<ov::Tensor>(element_type, shape, tensor.data());
+            wrapped_inputs_[i] = {input_tensor, tensor.data(), shape};
         } else {
             OPENVINO_ASSERT(element_type.bitwidth() % 8 == 0,
                             "Template plugin: Unsupported ROI tensor with element type having ",
@@ -137,26 +448,346 @@ void CudaInferRequest::infer_preprocess() {
             output_tensors_.at(i) = std::make_shared<ov::Tensor>();
             continue;
         }
-        auto tensor = ov::make_tensor(get_tensor(get_outputs()[i]));
+        const auto& output_tensor = get_tensor(get_outputs()[i]);
+        if (converted_outputs_[i]) {
+            // Downloaded staging tensor is converted into the user tensor by postprocessing
+            OPENVINO_ASSERT(!ov::make_tensor(output_tensor).is<ov::RemoteTensor>(),
+                            "Remote tensors can't be set to outputs converted by ",
+                            ov::nvidia_gpu::device_precision_io.name());
+            output_tensors_.at(i) = converted_outputs_[i];
+            continue;
+        }
+        if (is_wrapped(output_tensor, wrapped_outputs_[i])) {
+            continue;
+        }
+        wrapped_outputs_[i] = {};
+        auto tensor = ov::make_tensor(output_tensor);
         ov::element::Type element_type = tensor.get_element_type();
         ov::Shape shape = tensor.get_shape();
-        if (tensor.is_continuous() && !tensor.is<ov::RemoteTensor>())
+        if (tensor.is<ov::RemoteTensor>()) {
+            OPENVINO_ASSERT(!is_delegated, "Remote tensors are not supported with dynamic batching and shapes");
+            output_tensors_.at(i) = wrap_remote_tensor(output_tensor, device_id);
+        } else if (tensor.is_continuous()) {
             output_tensors_.at(i) = std::make_shared<ov::Tensor>(element_type, shape, tensor.data());
-        else
+            wrapped_outputs_[i] = {output_tensor, tensor.data(), shape};
+        } else {
             output_tensors_.at(i) = std::make_shared<ov::Tensor>(element_type, shape);
+        }
+    }
+    // The list of outputs which aren't downloaded may be changed on the compiled model between inferences, so it's
+    // taken once per inference
+    const auto& output_index = get_nvidia_model()->output_index_;
+    const auto skipped_outputs = get_nvidia_model()->get_skipped_outputs();
+    skipped_outputs_.assign(output_tensors_.size(), false);
+    for (const auto& name : *skipped_outputs) {
+        const auto it = output_index.find(name);
+        OPENVINO_ASSERT(it != output_index.end(), "Output ", name, " of ", ov::nvidia_gpu::skipped_outputs.name(),
+                        " isn't found in the model");
+        skipped_outputs_[it->second] = true;
+    }
+    if (get_nvidia_model()->get_shape_buckets()) {
+        prepare_bucket_request();
     }
     executionDelegator_->stop_stage(PerfStages::Preprocess);
 }
 
+std::optional<CUDA::NvtxRange> CudaInferRequest::make_stage_nvtx_range(const PerfStages stage) const {
+    const auto& name = nvtx_stage_names_[static_cast<std::size_t>(stage)];
+    if (name.empty()) {
+        return std::nullopt;
+    }
+    return std::optional<CUDA::NvtxRange>{std::in_place, name};
+}
+
+bool CudaInferRequest::is_wrapped(const ov::SoPtr<ov::ITensor>& tensor, const WrappedTensor& wrapped) {
+    // Checks of remote and continuous tensors allocate, so they are skipped for the same host memory
+    return wrapped.tensor._ptr == tensor._ptr && wrapped.data == tensor->data() && wrapped.shape == tensor->get_shape();
+}
+
+ChromeTrace::Scope CudaInferRequest::make_trace_scope(const char* name) const {
+    return ChromeTrace::Scope{trace_.get(), name, trace_tags_};
+}
+
+void CudaInferRequest::prepare_bucket_request() {
+    auto& shape_buckets = *get_nvidia_model()->get_shape_buckets();
+    std::vector<ov::Shape> input_shapes;
+    input_shapes.reserve(input_tensors_.size());
+    for (const auto& tensor : input_tensors_) {
+        input_shapes.push_back(tensor->get_shape());
+    }
+    const auto bucket_shapes = shape_buckets.get_bucket_shapes(input_shapes);
+    auto& bucket_request = bucket_requests_[bucket_shapes];
+    if (!bucket_request) {
+        bucket_request = shape_buckets.get_bucket(bucket_shapes)->create_infer_request();
+    }
+    const auto& bucket_inputs = bucket_request->get_inputs();
+    for (size_t i = 0; i < input_tensors_.size(); i++) {
+        const auto& tensor = *input_tensors_[i];
+        auto bucket_tensor = bucket_request->get_tensor(bucket_inputs[i]);
+        if (tensor.get_shape() != bucket_tensor->get_shape()) {
+            // Padded elements are zeroed, e.g. attention mask of NLP models excludes them from computations
+            std::memset(bucket_tensor->data(), 0, bucket_tensor->get_byte_size());
+        }
+        copy_block(tensor.data(),
+                   tensor.get_shape(),
+                   bucket_tensor->data(),
+                   bucket_tensor->get_shape(),
+                   tensor.get_shape(),
+                   tensor.get_element_type());
+    }
+    bucket_output_shapes_ = shape_buckets.get_output_shapes(input_shapes);
+    delegate_requests_ = {bucket_request};
+}
+
+void CudaInferRequest::prepare_replica_request() {
+    auto& replicas = *get_nvidia_model()->get_device_replicas();
+    replica_lease_.reset();
+    auto lease = replicas.acquire();
+    replica_requests_.resize(replicas.size());
+    auto& replica_request = replica_requests_[lease.index()];
+    if (!replica_request) {
+        replica_request = replicas.get_replica(lease.index())->create_infer_request();
+    }
+    // User tensors are passed to the replica as is, so the replica writes outputs directly into them
+    const auto& replica_inputs = replica_request->get_inputs();
+    for (size_t i = 0; i < get_inputs().size(); i++) {
+        auto tensor = get_tensor(get_inputs()[i]);
+        OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr),
+                        "Remote tensors are not supported with several devices");
+        replica_request->set_tensor(replica_inputs[i], tensor);
+    }
+    const auto& replica_outputs = replica_request->get_outputs();
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        if (get_outputs()[i].get_partial_shape().is_dynamic()) {
+            continue;
+        }
+        auto tensor = get_tensor(get_outputs()[i]);
+        OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr),
+                        "Remote tensors are not supported with several devices");
+        replica_request->set_tensor(replica_outputs[i], tensor);
+    }
+    replica_lease_.emplace(std::move(lease));
+    delegate_requests_ = {replica_request};
+}
+
+void CudaInferRequest::prepare_stage_requests() {
+    auto& stages = *get_nvidia_model()->get_pipeline_stages();
+    if (stage_requests_.empty()) {
+        for (size_t s = 0; s < stages.size(); s++) {
+            stage_requests_.push_back(stages.get_stage(s)->create_infer_request());
+        }
+        // Activations crossing the stage boundary stay on the device of the producing stage,
+        // the consuming stage reads them peer-to-peer
+        std::map<std::pair<size_t, size_t>, ov::SoPtr<ov::ITensor>> transfer_tensors;
+        for (size_t s = 0; s < stages.size(); s++) {
+            const auto& stage_inputs = stage_requests_[s]->get_inputs();
+            const auto& sources = stages.get_stage_inputs(s);
+            for (size_t i = 0; i < sources.size(); i++) {
+                if (!sources[i].stage) {
+                    continue;
+                }
+                const auto producer = *sources[i].stage;
+                auto& tensor = transfer_tensors[{producer, sources[i].index}];
+                if (!tensor) {
+                    tensor = stages.create_transfer_tensor(producer, sources[i].index);
+                    const auto& producer_request = stage_requests_[producer];
+                    producer_request->set_tensor(producer_request->get_outputs()[sources[i].index], tensor);
+                }
+                stage_requests_[s]->set_tensor(stage_inputs[i], tensor);
+            }
+        }
+    }
+    // User tensors are passed to stages as is, so stages read inputs and write outputs directly
+    for (size_t s = 0; s < stages.size(); s++) {
+        const auto& stage_inputs = stage_requests_[s]->get_inputs();
+        const auto& sources = stages.get_stage_inputs(s);
+        for (size_t i = 0; i < sources.size(); i++) {
+            if (!sources[i].stage) {
+                stage_requests_[s]->set_tensor(stage_inputs[i], get_tensor(get_inputs()[sources[i].index]));
+            }
+        }
+    }
+    const auto& outputs = stages.get_outputs();
+    for (size_t i = 0; i < outputs.size(); i++) {
+        const auto& stage_request = stage_requests_[*outputs[i].stage];
+        stage_request->set_tensor(stage_request->get_outputs()[outputs[i].index], get_tensor(get_outputs()[i]));
+    }
+    delegate_requests_ = stage_requests_;
+}
+
+void CudaInferRequest::prepare_micro_batch_requests() {
+    auto& micro_batches = *get_nvidia_model()->get_micro_batches();
+    while (micro_batch_requests_.size() < micro_batches.get_number_of_lanes()) {
+        micro_batch_requests_.push_back(micro_batches.get_model()->create_infer_request());
+    }
+    delegate_requests_ = micro_batch_requests_;
+}
+
+void CudaInferRequest::set_micro_batch_tensors(ov::IAsyncInferRequest& request, std::size_t index) {
+    const auto micro_batch_size = get_nvidia_model()->get_micro_batches()->get_micro_batch_size();
+    // Micro-batch reads inputs and writes outputs directly in slices of user tensors
+    auto set_slice = [&](const ov::Output<const ov::Node>& port, const ov::SoPtr<ov::ITensor>& tensor) {
+        OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr),
+                        "Remote tensors are not supported with micro-batches");
+        OPENVINO_ASSERT(ov::make_tensor(tensor).is_continuous(),
+                        "Non-contiguous tensors are not supported with micro-batches");
+        auto shape = tensor->get_shape();
+        const auto slice_size = tensor->get_byte_size() / shape[0] * micro_batch_size;
+        shape[0] = micro_batch_size;
+        auto* data = static_cast<std::uint8_t*>(tensor->data()) + index * slice_size;
+        request.set_tensor(port, {ov::make_tensor(tensor->get_element_type(), shape, data), nullptr});
+    };
+    const auto& inputs = request.get_inputs();
+    for (size_t i = 0; i < get_inputs().size(); i++) {
+        set_slice(inputs[i], get_tensor(get_inputs()[i]));
+    }
+    const auto& outputs = request.get_outputs();
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        set_slice(outputs[i], get_tensor(get_outputs()[i]));
+    }
+}
+
+void CudaInferRequest::prepare_tile_requests() {
+    const auto& tiles = *get_nvidia_model()->get_tiles();
+    while (tile_requests_.size() < tiles.get_number_of_lanes()) {
+        tile_requests_.push_back(tiles.get_model()->create_infer_request());
+    }
+    const auto input = get_tensor(get_inputs().front());
+    OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(input._ptr),
+                    "Remote tensors are not supported with tiles");
+    OPENVINO_ASSERT(ov::make_tensor(input).is_continuous(), "Non-contiguous tensors are not supported with tiles");
+    const auto& shape = input->get_shape();
+    const auto& geometry = tiles.get_geometry();
+    const auto tile_size = tiles.get_tile_size();
+    for (const auto stride : geometry.output_strides) {
+        if (shape[2] < tile_size || shape[3] < tile_size || shape[2] % stride != 0 || shape[3] % stride != 0) {
+            throw_ov_exception(fmt::format("Image {}x{} should be at least as large as the tile {} and divisible by "
+                                           "the stride {} of outputs",
+                                           shape[2],
+                                           shape[3],
+                                           tile_size,
+                                           stride));
+        }
+    }
+    tile_rows_ = Tiles::split(shape[2], tile_size, geometry.halo);
+    tile_columns_ = Tiles::split(shape[3], tile_size, geometry.halo);
+    const auto& tile_outputs = tiles.get_model()->outputs();
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        auto output_shape = tile_outputs[i].get_shape();
+        output_shape[2] = shape[2] / geometry.output_strides[i];
+        output_shape[3] = shape[3] / geometry.output_strides[i];
+        const auto element_type = tile_outputs[i].get_element_type();
+        allocate_tensor(get_outputs()[i], [this, &element_type, &output_shape](ov::SoPtr<ov::ITensor>& tensor) {
+            allocate_tensor_impl(tensor, element_type, output_shape, pinned_allocator_);
+        });
+        OPENVINO_ASSERT(ov::make_tensor(get_tensor(get_outputs()[i])).is_continuous(),
+                        "Non-contiguous tensors are not supported with tiles");
+    }
+    delegate_requests_ = tile_requests_;
+}
+
+std::size_t CudaInferRequest::get_number_of_tiles() const { return tile_rows_.size() * tile_columns_.size(); }
+
+void CudaInferRequest::set_tile_tensors(ov::IAsyncInferRequest& request, std::size_t index) {
+    const auto& row = tile_rows_.at(index / tile_columns_.size());
+    const auto& column = tile_columns_.at(index % tile_columns_.size());
+    const auto input = get_tensor(get_inputs().front());
+    auto tile_input = request.get_tensor(request.get_inputs().front());
+    copy_block(input->data(),
+               input->get_shape(),
+               ov::Coordinate{0, 0, row.origin, column.origin},
+               tile_input->data(),
+               tile_input->get_shape(),
+               ov::Coordinate(4, 0),
+               tile_input->get_shape(),
+               tile_input->get_element_type());
+}
+
+void CudaInferRequest::complete_tile(ov::IAsyncInferRequest& request, std::size_t index) {
+    const auto& row = tile_rows_.at(index / tile_columns_.size());
+    const auto& column = tile_columns_.at(index % tile_columns_.size());
+    const auto& output_strides = get_nvidia_model()->get_tiles()->get_geometry().output_strides;
+    const auto& tile_outputs = request.get_outputs();
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        const auto stride = output_strides[i];
+        const auto tile_output = request.get_tensor(tile_outputs[i]);
+        const auto output = get_tensor(get_outputs()[i]);
+        // Only the core of the tile is taken, pixels of its halo are computed from the incomplete receptive field
+        auto core = tile_output->get_shape();
+        core[2] = (row.end - row.begin) / stride;
+        core[3] = (column.end - column.begin) / stride;
+        copy_block(tile_output->data(),
+                   tile_output->get_shape(),
+                   ov::Coordinate{0, 0, (row.begin - row.origin) / stride, (column.begin - column.origin) / stride},
+                   output->data(),
+                   output->get_shape(),
+                   ov::Coordinate{0, 0, row.begin / stride, column.begin / stride},
+                   core,
+                   output->get_element_type());
+    }
+}
+
+void CudaInferRequest::complete_replica_request() {
+    const auto& replica_request = delegate_requests_.front();
+    const auto& replica_outputs = replica_request->get_outputs();
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        if (!get_outputs()[i].get_partial_shape().is_dynamic()) {
+            continue;
+        }
+        // Dynamic outputs are allocated by the replica request
+        auto replica_tensor = replica_request->get_tensor(replica_outputs[i]);
+        allocate_tensor(get_outputs()[i], [this, &replica_tensor](ov::SoPtr<ov::ITensor>& tensor) {
+            allocate_tensor_impl(
+                tensor, replica_tensor->get_element_type(), replica_tensor->get_shape(), pinned_allocator_);
+        });
+        std::memcpy(get_tensor(get_outputs()[i])->data(), replica_tensor->data(), replica_tensor->get_byte_size());
+    }
+}
+
+void CudaInferRequest::complete_bucket_request() {
+    const auto& bucket_request = delegate_requests_.front();
+    const auto& bucket_outputs = bucket_request->get_outputs();
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        auto bucket_tensor = bucket_request->get_tensor(bucket_outputs[i]);
+        const auto& shape = bucket_output_shapes_.at(i);
+        allocate_tensor(get_outputs()[i], [this, &bucket_tensor, &shape](ov::SoPtr<ov::ITensor>& tensor) {
+            allocate_tensor_impl(tensor, bucket_tensor->get_element_type(), shape, pinned_allocator_);
+        });
+        auto tensor = get_tensor(get_outputs()[i]);
+        // Output of the bucket is cropped to the shape inferred for actual inputs
+        copy_block(bucket_tensor->data(),
+                   bucket_tensor->get_shape(),
+                   tensor->data(),
+                   tensor->get_shape(),
+                   shape,
+                   tensor->get_element_type());
+    }
+}
+
 void CudaInferRequest::start_pipeline(const ThreadContext& threadContext) {
     try {
         OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[PerfStages::StartPipeline])
+        const auto nvtxRange = make_stage_nvtx_range(PerfStages::StartPipeline);
         executionDelegator_->start_stage();
         auto compiled_model = get_nvidia_model();
-        memory_proxy_ = compiled_model->memory_pool_->WaitAndGet(cancellation_token_);
+        // Submissions are ordered by deadlines, but the inference may still be taken after its deadline
+        cancellation_token_.throwIfExpired();
+        auto executable = compiled_model->get_executable();
+        trace_tags_.block.reset();
+        {
+            const auto traceScope = make_trace_scope("memory pool wait");
+            memory_proxy_ = executable.memory_pool->WaitAndGet(cancellation_token_);
+        }
+        executable_topology_runner_ = std::move(executable.topology_runner);
         auto& memory = memory_proxy_->Get();
+        // The previous inference might have released the block before its work on other streams is completed
+        memory.waitRelease(threadContext.uploadStream());
+        memory.waitRelease(threadContext.stream());
+        memory.waitRelease(threadContext.downloadStream());
+        trace_tags_.block = memory.id();
+        executionDelegator_->set_trace_tags(trace_tags_);
         auto& cudaGraphContext = memory.cudaGraphContext();
-        auto& topology_runner = compiled_model->get_topology_runner();
+        const auto& topology_runner = *executable_topology_runner_;
         InferenceRequestContext inferRequestContext{input_tensors_,
                                                     compiled_model->input_index_,
                                                     output_tensors_,
@@ -165,31 +796,130 @@ void CudaInferRequest::start_pipeline(const ThreadContext& threadContext) {
                                                     cancellation_token_,
                                                     *executionDelegator_,
                                                     cudaGraphContext,
-                                                    is_benchmark_mode_};
-        topology_runner.UpdateContext(inferRequestContext, memory);
-        topology_runner.Run(inferRequestContext, memory);
+                                                    is_benchmark_mode_,
+                                                    &skipped_outputs_,
+                                                    input_samples_.empty() ? nullptr : &input_samples_};
+        const auto& memory_manager = *topology_runner.GetSubGraph().memoryManager();
+        // Constants are uploaded in background during compilation, only the first inference actually waits
+        memory_manager.waitForConstants();
+        bind_external_buffers(memory_manager);
+        inferRequestContext.setExternalBuffers(external_buffers_);
+        {
+            const auto traceScope = make_trace_scope("capture/update");
+            topology_runner.UpdateContext(inferRequestContext, memory);
+        }
+        {
+            const auto traceScope = make_trace_scope("launch");
+            topology_runner.Run(inferRequestContext, memory);
+        }
+        // The block is returned to the pool as soon as the work is submitted, so the next inference submits its work
+        // ordered after this one while this inference waits for completion and postprocesses outputs on the host.
+        // Outputs are downloaded into tensors of the request, so nothing but the device reads the block afterwards
+        threadContext.joinCompute();
+        memory.recordRelease(threadContext.downloadStream());
+        memory_proxy_.reset();
+        launch_end_ = ChromeTrace::Clock::now();
         executionDelegator_->stop_stage(PerfStages::StartPipeline);
     } catch (...) {
         // TODO:
         // Log error once logger is available
+        if (!memory_proxy_ && cancellation_token_.isExpired()) {
+            get_nvidia_model()->expired_requests_.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (memory_proxy_) {
+            // Work submitted before the failure may still use the block, so it's completed before the block is
+            // returned to the pool. Errors of the device are already reported by the rethrown exception
+            try {
+                threadContext.uploadStream().synchronize();
+                threadContext.synchronize();
+            } catch (...) {
+            }
+        }
         memory_proxy_.reset();
+        executable_topology_runner_.reset();
+        inflight_.reset();
         throw;
     }
 }
 
-void CudaInferRequest::wait_pipeline(const ThreadContext& threadContext) {
+void CudaInferRequest::bind_external_buffers(const MemoryManager& memory_manager) {
+    auto compiled_model = get_nvidia_model();
+    for (const auto& binding : memory_manager.externalBufferBindings()) {
+        if (!binding.variable.empty()) {
+            // State is kept in device memory of the request between inferences
+            external_buffers_[binding.bufferId] = variable_states_by_id_.at(binding.variable)->data();
+            continue;
+        }
+        std::shared_ptr<ov::Tensor> tensor;
+        for (const auto& name : binding.tensorNames) {
+            const auto& index = binding.isInput ? compiled_model->input_index_ : compiled_model->output_index_;
+            if (auto it = index.find(name); it != index.end()) {
+                tensor = binding.isInput ? input_tensors_.at(it->second) : output_tensors_.at(it->second);
+                break;
+            }
+        }
+        OPENVINO_ASSERT(tensor != nullptr, "Couldn't find tensor for external buffer ", binding.bufferId);
+        void* data = tensor->get_byte_size() == binding.size ? tensor->data() : nullptr;
+        const auto memory_type = data != nullptr ? CUDA::memoryType(data) : cudaMemoryTypeUnregistered;
+        if (memory_type == cudaMemoryTypeDevice || memory_type == cudaMemoryTypeManaged) {
+            // Device memory (e.g. of remote tensor) is used by operations directly without Parameter/Result copies
+            external_buffers_[binding.bufferId] = data;
+        } else {
+            // Host memory is staged via request specific device buffer, which is allocated once on demand
+            auto staging = external_staging_buffers_.find(binding.bufferId);
+            if (staging == external_staging_buffers_.end()) {
+                staging = external_staging_buffers_
+                              .emplace(binding.bufferId, CUDA::DefaultStream::stream().malloc(binding.size))
+                              .first;
+            }
+            external_buffers_[binding.bufferId] = staging->second.get();
+        }
+    }
+}
+
+void CudaInferRequest::wait_pipeline(const cudaError_t deviceStatus) {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[PerfStages::WaitPipeline])
+    const auto nvtxRange = make_stage_nvtx_range(PerfStages::WaitPipeline);
+    if (trace_ && executable_topology_runner_) {
+        // The stage is scheduled once the device completes the work, so the request waits since the launch
+        trace_->add({"synchronize", "stage", launch_end_, ChromeTrace::Clock::now() - launch_end_, trace_tags_});
+    }
     executionDelegator_->start_stage();
-    // TODO: probably all time will be spent in synchonize, out of reach of ThrowIfCanceled
-    threadContext.stream().synchronize();
-    memory_proxy_.reset();
+    // Device work is completed already, the stage is scheduled by CudaCompletionExecutor. The memory block has been
+    // returned to the pool by start_pipeline
+    executable_topology_runner_.reset();
+    if (deviceStatus != cudaSuccess) {
+        // Outputs aren't postprocessed, so the inference is completed here
+        inflight_.reset();
+        throw_ov_exception(fmt::format("Inference failed on the device: {}", cudaGetErrorString(deviceStatus)));
+    }
     executionDelegator_->stop_stage(PerfStages::WaitPipeline);
 }
 
 void CudaInferRequest::infer_postprocess() {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[PerfStages::Postprocess]);
+    const auto nvtxRange = make_stage_nvtx_range(PerfStages::Postprocess);
+    const auto traceScope = make_trace_scope("postprocess");
+    // The inference is completed when postprocessing returns
+    const auto inflight = std::exchange(inflight_, std::nullopt);
     executionDelegator_->start_stage();
 
+    if (get_nvidia_model()->get_shape_buckets()) {
+        complete_bucket_request();
+        executionDelegator_->stop_stage(PerfStages::Postprocess);
+        return;
+    }
+    if (get_nvidia_model()->get_device_replicas()) {
+        complete_replica_request();
+        executionDelegator_->stop_stage(PerfStages::Postprocess);
+        return;
+    }
+    if (get_nvidia_model()->get_pipeline_stages() || get_nvidia_model()->get_micro_batches() ||
+        get_nvidia_model()->get_tiles()) {
+        // Outputs are written by stages, micro-batches and tiles directly into user tensors
+        executionDelegator_->stop_stage(PerfStages::Postprocess);
+        return;
+    }
     OPENVINO_ASSERT(get_outputs().size() == output_tensors_.size());
     OPENVINO_ASSERT(get_outputs().size() == get_nvidia_model()->model_->get_results().size());
     for (size_t i = 0; i < get_outputs().size(); i++) {
@@ -198,15 +928,21 @@ void CudaInferRequest::infer_postprocess() {
         auto tensor = ov::make_tensor(get_tensor(get_outputs()[i]));
         if (result->get_output_partial_shape(0).is_dynamic()) {
             ov::Output<const ov::Node> output{result->output(0).get_node(), result->output(0).get_index()};
-            allocate_tensor(output, [host_tensor](ov::SoPtr<ov::ITensor>& tensor) {
-                allocate_tensor_impl(tensor, host_tensor.get_element_type(), host_tensor.get_shape());
+            allocate_tensor(output, [this, host_tensor](ov::SoPtr<ov::ITensor>& tensor) {
+                allocate_tensor_impl(
+                    tensor, host_tensor.get_element_type(), host_tensor.get_shape(), pinned_allocator_);
                 auto ov_tensor = ov::make_tensor(tensor);
                 host_tensor.copy_to(ov_tensor);
             });
-        } else if (!tensor.is_continuous()) {
-            host_tensor.copy_to(tensor);
+        } else if (converted_outputs_[i]) {
+            if (!skipped_outputs_[i]) {
+                convert_tensor(host_tensor, tensor);
+            }
         } else if (tensor.is<ov::RemoteTensor>()) {
-            OPENVINO_ASSERT(true, "NVIDIA plugin doesn't support RemoteTensor.");
+            // Result has already been written directly to the device memory of the remote tensor
+            continue;
+        } else if (!tensor.is_continuous() && !skipped_outputs_[i]) {
+            host_tensor.copy_to(tensor);
         }
     }
     executionDelegator_->stop_stage(PerfStages::Postprocess);
@@ -214,8 +950,14 @@ void CudaInferRequest::infer_postprocess() {
 }
 
 void CudaInferRequest::cancel() {
+    // The cancelled inference leaves the queue of memory pool waiters once the pool is interrupted
     cancellation_token_.cancel();
-    get_nvidia_model()->get_memory_pool()->Interrupt();
+    for (const auto& delegate_request : delegate_requests_) {
+        delegate_request->cancel();
+    }
+    if (const auto memory_pool = get_nvidia_model()->get_executable().memory_pool) {
+        memory_pool->Interrupt();
+    }
 }
 
 void CudaInferRequest::infer() {
@@ -229,6 +971,43 @@ std::shared_ptr<const CompiledModel> CudaInferRequest::get_nvidia_model() {
     return nvidia_model;
 }
 
+void CudaInferRequest::gather_batched_tensors() {
+    const auto compiled_model = get_nvidia_model();
+    input_samples_.clear();
+    // Inputs of batched, dynamic, replicated, split, micro-batched and tiled models are staged via host tensors
+    // of other infer requests, inputs converted to the precision of the device are staged via converted tensors
+    const auto is_converted = std::any_of(
+        converted_inputs_.begin(), converted_inputs_.end(), [](const auto& tensor) { return tensor != nullptr; });
+    if (m_batched_tensors.empty() || compiled_model->get_batch_scheduler() || compiled_model->get_shape_buckets() ||
+        compiled_model->get_device_replicas() || compiled_model->get_pipeline_stages() ||
+        compiled_model->get_micro_batches() || compiled_model->get_tiles() || is_converted) {
+        convert_batched_tensors();
+        return;
+    }
+    for (const auto& [input, samples] : m_batched_tensors) {
+        for (const auto& sample : samples) {
+            const auto tensor = ov::make_tensor(sample);
+            if (tensor.is<ov::RemoteTensor>() || !tensor.is_continuous()) {
+                convert_batched_tensors();
+                return;
+            }
+        }
+    }
+    // Samples are uploaded by Parameter operations into slices of the batch on the device,
+    // which saves concatenation of the batch in host memory
+    input_samples_.resize(get_inputs().size());
+    for (size_t i = 0; i < get_inputs().size(); i++) {
+        const auto samples = m_batched_tensors.find(get_inputs()[i].get_tensor_ptr());
+        if (samples == m_batched_tensors.end()) {
+            continue;
+        }
+        input_samples_[i].reserve(samples->second.size());
+        for (const auto& sample : samples->second) {
+            input_samples_[i].push_back(std::make_shared<ov::Tensor>(ov::make_tensor(sample)));
+        }
+    }
+}
+
 void CudaInferRequest::set_tensors_impl(const ov::Output<const ov::Node> port,
                                         const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
     for (const auto& input : get_inputs()) {
@@ -241,10 +1020,23 @@ void CudaInferRequest::set_tensors_impl(const ov::Output<const ov::Node> port,
 }
 
 std::vector<ov::SoPtr<ov::IVariableState>> CudaInferRequest::query_state() const {
-    OPENVINO_NOT_IMPLEMENTED;
+    std::vector<ov::SoPtr<ov::IVariableState>> states;
+    states.reserve(variable_states_.size());
+    for (const auto& state : variable_states_) {
+        states.push_back({state, nullptr});
+    }
+    return states;
 }
 
 std::vector<ov::ProfilingInfo> CudaInferRequest::get_profiling_info() const {
+    if (!delegate_requests_.empty()) {
+        std::vector<ov::ProfilingInfo> profiling_info;
+        for (const auto& delegate_request : delegate_requests_) {
+            auto delegate_info = delegate_request->get_profiling_info();
+            profiling_info.insert(profiling_info.end(), delegate_info.begin(), delegate_info.end());
+        }
+        return profiling_info;
+    }
     return executionDelegator_->get_performance_counts();
 }
 }  // namespace nvidia_gpu
@@ -11,15 +11,24 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "cancellation_token.hpp"
+#include "cuda/runtime.hpp"
+#include "cuda_chrome_trace.hpp"
 #include "cuda_config.hpp"
+#include "cuda_device_replicas.hpp"
 #include "cuda_iexecution_delegator.hpp"
+#include "cuda_itopology_runner.hpp"
 #include "cuda_operation_base.hpp"
+#include "cuda_tiles.hpp"
+#include "cuda_variable_state.hpp"
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/cuda_memory_pool.hpp"
 #include "openvino/itt.hpp"
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "utils/perf_timing.hpp"
@@ -27,7 +36,9 @@
 namespace ov {
 namespace nvidia_gpu {
 
+class BatchScheduler;
 class CompiledModel;
+class DelegateStageExecutor;
 
 // ! [infer_request:header]
 class CudaInferRequest : public ov::ISyncInferRequest {
@@ -45,24 +56,141 @@ public:
     // executor
     void infer_preprocess();
     void start_pipeline(const ThreadContext& threadContext);
-    void wait_pipeline(const ThreadContext& threadContext);
+    /**
+     * @param deviceStatus Status of the streams the inference was submitted to, which is reported by
+     *                     CudaCompletionExecutor once they complete
+     * @throws ov::Exception if the device failed to execute the inference
+     */
+    void wait_pipeline(cudaError_t deviceStatus = cudaSuccess);
     void infer_postprocess();
     void cancel();
 
+    /**
+     * @returns Deadline of the current inference, std::nullopt if it has none (see ov::nvidia_gpu::latency_budget)
+     */
+    std::optional<CancellationToken::Clock::time_point> deadline() const noexcept {
+        return cancellation_token_.deadline();
+    }
+
     void set_tensors_impl(const ov::Output<const ov::Node> port,
                           const std::vector<ov::SoPtr<ov::ITensor>>& tensors) override;
 
 private:
+    /**
+     * Counts the inference in ov::nvidia_gpu::inflight_requests of the model while it is alive
+     */
+    class InflightInference {
+    public:
+        explicit InflightInference(std::atomic<std::size_t>& counter) : counter_{&counter} {
+            counter_->fetch_add(1, std::memory_order_relaxed);
+        }
+        InflightInference(InflightInference&& other) noexcept : counter_{std::exchange(other.counter_, nullptr)} {}
+        InflightInference& operator=(InflightInference&&) = delete;
+        ~InflightInference() {
+            if (counter_) {
+                counter_->fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::atomic<std::size_t>* counter_;
+    };
+
+    friend class BatchScheduler;
+    friend class DelegateStageExecutor;
     std::shared_ptr<const CompiledModel> get_nvidia_model();
     void create_infer_request();
+    void bind_external_buffers(const MemoryManager& memory_manager);
+    void prepare_bucket_request();
+    void complete_bucket_request();
+    void prepare_replica_request();
+    void complete_replica_request();
+    void prepare_stage_requests();
+    void prepare_micro_batch_requests();
+    /**
+     * Sets slices of user tensors of the micro-batch with the given index as tensors of the request of a lane
+     */
+    void set_micro_batch_tensors(ov::IAsyncInferRequest& request, std::size_t index);
+    /**
+     * Splits the image of the input into tiles and allocates outputs stitched from them
+     */
+    void prepare_tile_requests();
+    std::size_t get_number_of_tiles() const;
+    /**
+     * Copies the tile with the given index of the user input into the input of the request of a lane
+     */
+    void set_tile_tensors(ov::IAsyncInferRequest& request, std::size_t index);
+    /**
+     * Copies cores of outputs of the tile with the given index from the request of a lane into user outputs
+     */
+    void complete_tile(ov::IAsyncInferRequest& request, std::size_t index);
+    /**
+     * Collects samples of inputs set by set_tensors(), which are uploaded into the device buffer of the input
+     * directly, or concatenates them on host if the inputs are staged by other infer requests
+     */
+    void gather_batched_tensors();
+    /**
+     * User tensor, which memory a host tensor of an input or output wraps
+     */
+    struct WrappedTensor {
+        ov::SoPtr<ov::ITensor> tensor;
+        const void* data = nullptr;
+        ov::Shape shape;
+    };
+    /**
+     * @returns true if the wrapper of the previous inference wraps the same memory and shape of the same tensor,
+     * so it is reused without allocations
+     */
+    static bool is_wrapped(const ov::SoPtr<ov::ITensor>& tensor, const WrappedTensor& wrapped);
+    std::optional<CUDA::NvtxRange> make_stage_nvtx_range(PerfStages stage) const;
+    ChromeTrace::Scope make_trace_scope(const char* name) const;
 
     std::array<openvino::itt::handle_t, static_cast<std::size_t>(PerfStages::NumOfStages)> _profilingTask;
+    // Names of NVTX ranges of stages, which are empty if ranges are disabled (see ov::nvidia_gpu::nvtx_ranges)
+    std::array<std::string, static_cast<std::size_t>(PerfStages::NumOfStages)> nvtx_stage_names_;
+    // Timeline the stages of inferences are added to, nullptr if tracing is disabled (see ov::nvidia_gpu::trace_file)
+    std::shared_ptr<ChromeTrace> trace_;
+    ChromeTrace::Tags trace_tags_;
+    ChromeTrace::Clock::time_point launch_end_;
+    // Topology runner of the inference in flight, which may be replaced in the model by background tuning
+    std::shared_ptr<const ITopologyRunner> executable_topology_runner_;
     std::optional<MemoryPool::Proxy> memory_proxy_;
+    // Inference which failed before postprocessing is counted until the next one starts
+    std::optional<InflightInference> inflight_;
     CancellationToken cancellation_token_;
     std::unique_ptr<IExecutionDelegator> executionDelegator_;
     std::vector<std::shared_ptr<ov::Tensor>> input_tensors_;
+    // Samples of inputs set by set_tensors() in the order of inputs, empty if no input is gathered on the device
+    std::vector<std::vector<std::shared_ptr<ov::Tensor>>> input_samples_;
     std::vector<std::shared_ptr<ov::Tensor>> output_tensors_;
+    // User tensors which host tensors of inputs and outputs wrap, the wrappers are reused by the next inference
+    std::vector<WrappedTensor> wrapped_inputs_;
+    std::vector<WrappedTensor> wrapped_outputs_;
+    // Staging tensors of inputs and outputs transferred in the precision of the device, nullptr for other ones
+    // (see ov::nvidia_gpu::device_precision_io)
+    std::vector<std::shared_ptr<ov::Tensor>> converted_inputs_;
+    std::vector<std::shared_ptr<ov::Tensor>> converted_outputs_;
+    // Flags of outputs which aren't downloaded by the inference (see ov::nvidia_gpu::skipped_outputs)
+    std::vector<bool> skipped_outputs_;
     bool is_benchmark_mode_;
+    ov::Allocator pinned_allocator_;
+    ExternalBuffers external_buffers_;
+    std::unordered_map<BufferID, CUDA::DefaultAllocation> external_staging_buffers_;
+    // States of variables in the order of the model variables, they are preserved between inferences
+    std::vector<VariableState::Ptr> variable_states_;
+    std::unordered_map<std::string, VariableState::Ptr> variable_states_by_id_;
+    std::map<std::vector<ov::Shape>, std::shared_ptr<ov::IAsyncInferRequest>> bucket_requests_;
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> delegate_requests_;
+    std::vector<ov::Shape> bucket_output_shapes_;
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> replica_requests_;
+    std::optional<DeviceReplicas::Lease> replica_lease_;
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> stage_requests_;
+    // Requests of lanes, which execute micro-batches of the inference concurrently
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> micro_batch_requests_;
+    // Requests of lanes, which execute tiles of the inference concurrently, and spans of tiles along rows and columns
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> tile_requests_;
+    std::vector<Tiles::Span> tile_rows_;
+    std::vector<Tiles::Span> tile_columns_;
 };
 // ! [infer_request:header]
 
@@ -32,14 +32,32 @@ public:
                             CancellationToken& token,
                             IExecutionDelegator& executionDelegator,
                             CudaGraphContext& cudaGraphContext,
-                            bool isBenchmarkMode = false)
+                            bool isBenchmarkMode = false,
+                            const std::vector<bool>* skippedOutputs = nullptr,
+                            const std::vector<std::vector<std::shared_ptr<ov::Tensor>>>* inputSamples = nullptr)
         : threadContext{threadContext},
           token{token},
           executionDelegator{executionDelegator},
-          tensor_mapping_context_{inputs, inputMapping, outputs, outputMapping},
+          tensor_mapping_context_{inputs, inputMapping, outputs, outputMapping, skippedOutputs, inputSamples},
           cuda_graph_context_{cudaGraphContext},
           is_benchmark_mode_{isBenchmarkMode} {}
 
+    /**
+     * Context of a nested body (e.g. of TensorIterator), which is executed within the outer context
+     * on the given thread context with its own external buffers
+     * @param externalBuffers External buffers of the body, should outlive the context
+     */
+    InferenceRequestContext(const InferenceRequestContext& outer,
+                            const ThreadContext& threadContext,
+                            const ExternalBuffers& externalBuffers)
+        : threadContext{threadContext},
+          token{outer.token},
+          executionDelegator{outer.executionDelegator},
+          tensor_mapping_context_{outer.tensor_mapping_context_},
+          cuda_graph_context_{outer.cuda_graph_context_},
+          is_benchmark_mode_{outer.is_benchmark_mode_},
+          external_buffers_{&externalBuffers} {}
+
     // don't allow storing references to temporary
     template <typename... Args>
     InferenceRequestContext(std::vector<std::shared_ptr<ov::Tensor>>&& inputs,
@@ -61,14 +79,27 @@ public:
     [[nodiscard]] const TensorMappingContext& getTensorMappingContext() const { return tensor_mapping_context_; }
     [[nodiscard]] const CudaGraphContext& getCudaGraphContext() const { return cuda_graph_context_; }
     [[nodiscard]] CudaGraphContext& getCudaGraphContext() { return cuda_graph_context_; }
+    [[nodiscard]] const ExternalBuffers& getExternalBuffers() const noexcept { return *external_buffers_; }
+
+    /**
+     * Sets device pointers of Parameter/Result buffers which aren't allocated within mutable memory block.
+     * @param externalBuffers External buffers, should outlive the context
+     */
+    void setExternalBuffers(const ExternalBuffers& externalBuffers) noexcept { external_buffers_ = &externalBuffers; }
 
 private:
+    static const ExternalBuffers& emptyExternalBuffers() noexcept {
+        static const ExternalBuffers empty{};
+        return empty;
+    }
+
     const ThreadContext& threadContext;
     CancellationToken& token;
     IExecutionDelegator& executionDelegator;
     const TensorMappingContext tensor_mapping_context_;
     CudaGraphContext& cuda_graph_context_;
     bool is_benchmark_mode_;
+    const ExternalBuffers* external_buffers_ = &emptyExternalBuffers();
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,54 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_io_pack.hpp"
+
+#include <cstdint>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+template <typename GetTensor>
+std::uint8_t* packedTensors(const IoPack& pack, GetTensor&& getTensor) {
+    if (pack.entries.empty()) {
+        return nullptr;
+    }
+    const auto first = getTensor(pack.entries.front());
+    if (first == nullptr) {
+        return nullptr;
+    }
+    auto* data = static_cast<std::uint8_t*>(first->data());
+    for (const auto& entry : pack.entries) {
+        const auto tensor = getTensor(entry);
+        if (tensor == nullptr || tensor->data() != data + entry.offset || tensor->get_byte_size() != entry.size) {
+            return nullptr;
+        }
+    }
+    return data;
+}
+
+}  // namespace
+
+const void* packedInputs(const TensorMappingContext& context, const IoPack& pack) {
+    return packedTensors(pack, [&context](const IoPack::Entry& entry) -> std::shared_ptr<ov::Tensor> {
+        if (!context.has_input_tensor(entry.name) || !context.get_input_samples(entry.name).empty()) {
+            return nullptr;
+        }
+        return context.get_input_tensor(entry.name);
+    });
+}
+
+void* packedOutputs(const TensorMappingContext& context, const IoPack& pack) {
+    return packedTensors(pack, [&context](const IoPack::Entry& entry) -> std::shared_ptr<ov::Tensor> {
+        if (!context.has_output_tensor(entry.name)) {
+            return nullptr;
+        }
+        return context.get_output_tensor(entry.name);
+    });
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,50 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "cuda_tensor_mapping_context.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Small inputs (or outputs) of the model, which buffers are placed one after another into a single buffer
+ *        of the mutable memory block. Infer requests place their host tensors at the same offsets, so the whole
+ *        pack is transferred by a single copy instead of a copy per tensor
+ */
+struct IoPack {
+    struct Entry {
+        // Index of the Parameter (or Result) in the model
+        std::size_t index;
+        // Name of the tensor in TensorMappingContext
+        std::string name;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    // Size of the pack including alignment of the entries
+    std::size_t size = 0;
+    // The first entry is at offset 0, the operation of the entry transfers the whole pack
+    std::vector<Entry> entries;
+};
+
+/**
+ * @returns Memory of input tensors of the pack, if each of them is located at the offset of its entry from the tensor
+ *          of the first entry, nullptr otherwise (e.g. if tensors are set by the user or by samples)
+ */
+const void* packedInputs(const TensorMappingContext& context, const IoPack& pack);
+
+/**
+ * @returns Memory of output tensors of the pack, if each of them is located at the offset of its entry from the tensor
+ *          of the first entry, nullptr otherwise
+ */
+void* packedOutputs(const TensorMappingContext& context, const IoPack& pack);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -13,6 +13,14 @@ struct ITopologyRunner {
     virtual void Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const = 0;
     virtual void UpdateContext(InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const = 0;
     virtual const SubGraph& GetSubGraph() const = 0;
+    /**
+     * @returns Number of launches of CUDA graphs
+     */
+    virtual std::size_t GetGraphLaunches() const = 0;
+    /**
+     * @returns Number of executions of sequences of operations which are launched without CUDA graphs
+     */
+    virtual std::size_t GetEagerLaunches() const = 0;
     virtual ~ITopologyRunner() = default;
 };
 
@@ -0,0 +1,136 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_aware_ordering.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/result.hpp>
+#include <unordered_map>
+
+#include "cuda_op_buffers_extractor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr size_t kNoBuffer = std::numeric_limits<size_t>::max();
+
+}  // namespace
+
+std::vector<MemoryAwareOrdering::NodePtr> MemoryAwareOrdering::reorder(const std::vector<NodePtr>& ordered_nodes) {
+    const auto num_nodes = ordered_nodes.size();
+    std::unordered_map<const ov::Node*, size_t> node_indices;
+    for (size_t i = 0; i < num_nodes; ++i) {
+        node_indices.emplace(ordered_nodes[i].get(), i);
+    }
+
+    // Buffers are tracked in the same way as OperationBuffersExtractor allocates them:
+    // constants aren't part of mutable memory, reshape-only nodes and results reuse buffer of their input
+    std::vector<size_t> buffer_sizes;
+    std::vector<size_t> buffer_uses;
+    std::vector<std::vector<size_t>> output_buffers(num_nodes);
+    std::vector<std::vector<size_t>> input_buffers(num_nodes);
+    std::vector<std::vector<size_t>> new_buffers(num_nodes);
+    std::vector<std::vector<size_t>> successors(num_nodes);
+    std::vector<size_t> num_pending_predecessors(num_nodes, 0);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        const auto& node = *ordered_nodes[i];
+        std::vector<size_t> predecessors;
+        for (const auto& input : node.inputs()) {
+            const auto source = input.get_source_output();
+            const auto producer = node_indices.at(source.get_node());
+            const auto buffer = output_buffers[producer].at(source.get_index());
+            input_buffers[i].push_back(buffer);
+            if (buffer != kNoBuffer) {
+                ++buffer_uses[buffer];
+            }
+            predecessors.push_back(producer);
+        }
+        for (const auto& dependency : node.get_control_dependencies()) {
+            const auto found = node_indices.find(dependency.get());
+            if (found != node_indices.end()) {
+                predecessors.push_back(found->second);
+            }
+        }
+        std::sort(predecessors.begin(), predecessors.end());
+        predecessors.erase(std::unique(predecessors.begin(), predecessors.end()), predecessors.end());
+        for (const auto predecessor : predecessors) {
+            successors[predecessor].push_back(i);
+        }
+        num_pending_predecessors[i] = predecessors.size();
+
+        const bool is_alias =
+            ov::is_type<ov::op::v0::Result>(&node) || OperationBuffersExtractor::isReshapeOnlyNode(node);
+        for (const auto& output : node.outputs()) {
+            if (ov::is_type<ov::op::v0::Constant>(&node)) {
+                output_buffers[i].push_back(kNoBuffer);
+            } else if (is_alias && !input_buffers[i].empty()) {
+                output_buffers[i].push_back(input_buffers[i].front());
+            } else {
+                output_buffers[i].push_back(buffer_sizes.size());
+                new_buffers[i].push_back(buffer_sizes.size());
+                buffer_sizes.push_back(OperationBuffersExtractor::GetTensorByteSize(output));
+                buffer_uses.push_back(0);
+            }
+        }
+    }
+
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < num_nodes; ++i) {
+        if (num_pending_predecessors[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+    std::vector<NodePtr> result;
+    result.reserve(num_nodes);
+    std::unordered_map<size_t, size_t> node_uses;
+    while (!ready.empty()) {
+        auto best = ready.end();
+        auto best_gain = std::numeric_limits<int64_t>::min();
+        for (auto candidate = ready.begin(); candidate != ready.end(); ++candidate) {
+            node_uses.clear();
+            for (const auto buffer : input_buffers[*candidate]) {
+                if (buffer != kNoBuffer) {
+                    ++node_uses[buffer];
+                }
+            }
+            int64_t gain = 0;
+            for (const auto& [buffer, uses] : node_uses) {
+                if (buffer_uses[buffer] == uses) {
+                    gain += static_cast<int64_t>(buffer_sizes[buffer]);
+                }
+            }
+            for (const auto buffer : new_buffers[*candidate]) {
+                gain -= static_cast<int64_t>(buffer_sizes[buffer]);
+            }
+            // Ties are resolved in favor of the original order
+            if (gain > best_gain || (gain == best_gain && *candidate < *best)) {
+                best = candidate;
+                best_gain = gain;
+            }
+        }
+        const auto node_idx = *best;
+        ready.erase(best);
+        result.push_back(ordered_nodes[node_idx]);
+        for (const auto buffer : input_buffers[node_idx]) {
+            if (buffer != kNoBuffer) {
+                --buffer_uses[buffer];
+            }
+        }
+        for (const auto successor : successors[node_idx]) {
+            if (--num_pending_predecessors[successor] == 0) {
+                ready.push_back(successor);
+            }
+        }
+    }
+    OPENVINO_ASSERT(result.size() == num_nodes, "Nodes of the model can't be ordered topologically");
+    return result;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
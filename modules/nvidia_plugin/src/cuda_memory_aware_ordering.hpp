@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "openvino/core/node.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Reorders nodes of a model to reduce peak size of mutable memory block.
+ * Nodes are list-scheduled in topological order: among nodes which are ready to be executed,
+ * the one which frees the most bytes of tensors for which it is the last consumer
+ * minus bytes of its own outputs is executed first.
+ */
+class MemoryAwareOrdering {
+public:
+    using NodePtr = std::shared_ptr<ov::Node>;
+
+    /**
+     * @param [in] ordered_nodes Nodes of a model in a valid execution order
+     * @returns The same nodes in another valid execution order
+     */
+    static std::vector<NodePtr> reorder(const std::vector<NodePtr>& ordered_nodes);
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,107 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_layout.hpp"
+
+#include <fmt/format.h>
+
+#include <error.hpp>
+#include <fstream>
+#include <iomanip>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+void writeJsonString(std::ostream& stream, const std::string& value) {
+    stream << '"';
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+void writeCsvString(std::ostream& stream, const std::string& value) {
+    if (value.find_first_of(",\"\n") == std::string::npos) {
+        stream << value;
+        return;
+    }
+    stream << '"';
+    for (const char c : value) {
+        if (c == '"') {
+            stream << '"';
+        }
+        stream << c;
+    }
+    stream << '"';
+}
+
+std::string joinTensors(const MemoryLayoutEntry& entry) {
+    std::string tensors;
+    for (const auto& tensor : entry.tensors) {
+        tensors += tensors.empty() ? tensor : " " + tensor;
+    }
+    return tensors;
+}
+
+}  // namespace
+
+void writeMemoryLayoutJson(std::ostream& stream, gsl::span<const MemoryLayoutEntry> layout) {
+    stream << '[';
+    for (std::size_t i = 0; i < layout.size(); ++i) {
+        const auto& entry = layout[i];
+        stream << (i == 0 ? "\n" : ",\n") << "{\"block\":";
+        writeJsonString(stream, entry.block);
+        stream << ",\"id\":" << entry.id << ",\"kind\":";
+        writeJsonString(stream, entry.kind);
+        stream << ",\"producer\":" << entry.producer << ",\"last_consumer\":" << entry.last_consumer;
+        stream << ",\"op\":";
+        writeJsonString(stream, entry.op);
+        stream << ",\"size\":" << entry.size << ",\"offset\":" << entry.offset << ",\"tensors\":[";
+        for (std::size_t j = 0; j < entry.tensors.size(); ++j) {
+            if (j > 0) {
+                stream << ',';
+            }
+            writeJsonString(stream, entry.tensors[j]);
+        }
+        stream << "]}";
+    }
+    stream << "\n]\n";
+}
+
+void writeMemoryLayoutCsv(std::ostream& stream, gsl::span<const MemoryLayoutEntry> layout) {
+    stream << "block,id,kind,producer,last_consumer,op,size,offset,tensors\n";
+    for (const auto& entry : layout) {
+        stream << entry.block << ',' << entry.id << ',' << entry.kind << ',' << entry.producer << ','
+               << entry.last_consumer << ',';
+        writeCsvString(stream, entry.op);
+        stream << ',' << entry.size << ',' << entry.offset << ',';
+        writeCsvString(stream, joinTensors(entry));
+        stream << '\n';
+    }
+}
+
+void writeMemoryLayout(const std::string& path, gsl::span<const MemoryLayoutEntry> layout) {
+    std::ofstream file{path};
+    if (!file) {
+        throw_ov_exception(fmt::format("Memory layout file {} can't be opened", path));
+    }
+    const std::string csvExtension = ".csv";
+    if (path.size() >= csvExtension.size() &&
+        path.compare(path.size() - csvExtension.size(), csvExtension.size(), csvExtension) == 0) {
+        writeMemoryLayoutCsv(file, layout);
+    } else {
+        writeMemoryLayoutJson(file, layout);
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <gsl/span>
+#include <memory_manager/tensor_types.hpp>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Placement of a buffer in a memory block of the model, which is dumped to the file set by
+ *        ov::nvidia_gpu::memory_layout_file to show which tensors drive the peak of memory
+ */
+struct MemoryLayoutEntry {
+    // "mutable" block of an infer request, "constants" or "immutable_workbuffers" shared by infer requests
+    std::string block;
+    BufferID id;
+    // "tensor", "workbuffer" or "constant"
+    std::string kind;
+    // Execution order indices of the first and the last node using the buffer, -1 for immutable buffers
+    int producer = -1;
+    int last_consumer = -1;
+    // Friendly name of the node producing the buffer or owning the work buffer
+    std::string op;
+    std::size_t size = 0;
+    // Offset within the block, -1 for constants shared with other models out of the block
+    std::ptrdiff_t offset = -1;
+    // Outputs of nodes located in the buffer as "<friendly name>:<output index>"
+    std::vector<std::string> tensors;
+};
+
+/**
+ * Writes the layout as JSON array of objects with the fields of MemoryLayoutEntry
+ */
+void writeMemoryLayoutJson(std::ostream& stream, gsl::span<const MemoryLayoutEntry> layout);
+
+/**
+ * Writes the layout as CSV with a header row, tensors of a buffer are separated by spaces
+ */
+void writeMemoryLayoutCsv(std::ostream& stream, gsl::span<const MemoryLayoutEntry> layout);
+
+/**
+ * Writes the layout to the file as CSV if the path ends with ".csv" and as JSON otherwise
+ * @throws ov::Exception if the file can't be written
+ */
+void writeMemoryLayout(const std::string& path, gsl::span<const MemoryLayoutEntry> layout);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
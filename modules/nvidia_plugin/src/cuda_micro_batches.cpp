@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_micro_batches.hpp"
+
+#include <algorithm>
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+MicroBatches::MicroBatches(std::shared_ptr<const ov::ICompiledModel> model,
+                           std::size_t batch_size,
+                           std::size_t micro_batch_size)
+    : model_{std::move(model)},
+      size_{micro_batch_size > 0 ? batch_size / micro_batch_size : 0},
+      micro_batch_size_{micro_batch_size},
+      model_optimal_number_of_infer_requests_{
+          std::max(1u, model_->get_property(ov::optimal_number_of_infer_requests.name()).as<unsigned>())} {
+    OPENVINO_ASSERT(size_ > 0 && size_ * micro_batch_size_ == batch_size);
+}
+
+const std::shared_ptr<const ov::ICompiledModel>& MicroBatches::get_model() const { return model_; }
+
+std::size_t MicroBatches::size() const { return size_; }
+
+std::size_t MicroBatches::get_micro_batch_size() const { return micro_batch_size_; }
+
+std::size_t MicroBatches::get_number_of_lanes() const {
+    return std::min<std::size_t>(size_, model_optimal_number_of_infer_requests_);
+}
+
+unsigned MicroBatches::get_optimal_number_of_infer_requests() const {
+    return std::max(1u, model_optimal_number_of_infer_requests_ / static_cast<unsigned>(get_number_of_lanes()));
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
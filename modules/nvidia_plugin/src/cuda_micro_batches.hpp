@@ -0,0 +1,52 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/runtime/icompiled_model.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Model compiled for a micro-batch of the batch of the original model (see ov::nvidia_gpu::micro_batch_size).
+ *
+ * Inputs and outputs of every inference are split into micro-batches along the first dimension, which are executed
+ * by several lanes of infer requests of the smaller model. Each lane starts the next pending micro-batch as soon as
+ * its previous one is finished, so micro-batches are executed concurrently over memory blocks of the smaller model.
+ */
+class MicroBatches {
+public:
+    MicroBatches(std::shared_ptr<const ov::ICompiledModel> model, std::size_t batch_size, std::size_t micro_batch_size);
+
+    const std::shared_ptr<const ov::ICompiledModel>& get_model() const;
+
+    /**
+     * @returns Number of micro-batches of the inference
+     */
+    std::size_t size() const;
+
+    std::size_t get_micro_batch_size() const;
+
+    /**
+     * @returns Number of infer requests of the smaller model, which execute micro-batches of an inference concurrently
+     */
+    std::size_t get_number_of_lanes() const;
+
+    /**
+     * @returns Number of inferences, which are executed concurrently by lanes of the smaller model
+     */
+    unsigned get_optimal_number_of_infer_requests() const;
+
+private:
+    std::shared_ptr<const ov::ICompiledModel> model_;
+    std::size_t size_;
+    std::size_t micro_batch_size_;
+    unsigned model_optimal_number_of_infer_requests_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,17 +6,33 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <error.hpp>
+#include <functional>
+#include <limits>
 #include <gsl/span_ext>
+#include <memory_manager/cuda_constant_cache.hpp>
+#include <memory_manager/model/details/cuda_memory_utils.hpp>
+#include <map>
+#include <numeric>
 #include <openvino/op/constant.hpp>
+#include <openvino/op/pad.hpp>
 #include <openvino/op/reshape.hpp>
 #include <openvino/op/result.hpp>
+#include <openvino/op/split.hpp>
 #include <openvino/op/squeeze.hpp>
+#include <openvino/op/strided_slice.hpp>
 #include <openvino/op/tensor_iterator.hpp>
 #include <openvino/op/transpose.hpp>
 #include <openvino/op/unsqueeze.hpp>
+#include <openvino/op/util/assign_base.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <openvino/op/util/read_value_base.hpp>
+#include <openvino/op/variadic_split.hpp>
 #include <stdexcept>
 #include <transformer/nodes/concat_optimized.hpp>
+#include <tuple>
 #include <utility>
 
 namespace ov {
@@ -24,10 +40,24 @@ namespace nvidia_gpu {
 
 OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> ordered_nodes,
                                                      bool is_stable_params,
-                                                     bool is_stable_results)
+                                                     bool is_stable_results,
+                                                     bool is_external_io,
+                                                     const InPlacePredicate& is_in_place)
     : is_stable_params_{is_stable_params},
       is_stable_results_{is_stable_results},
       num_ordered_nodes_{static_cast<unsigned long>(ordered_nodes.size())} {
+    if (is_in_place) {
+        // Stable results are used till the end of the graph
+        for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
+            const auto& node = ordered_nodes[node_idx];
+            const int lastUse =
+                is_stable_results_ && IsResultNode(*node) ? static_cast<int>(num_ordered_nodes_) : node_idx;
+            for (const auto& input : node->inputs()) {
+                auto& tensorLastUse = tensor_last_uses_[GetTensorKey(input)];
+                tensorLastUse = std::max(tensorLastUse, lastUse);
+            }
+        }
+    }
     for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
         const auto& node = ordered_nodes[node_idx];
         if (IsParameterNode(*node))
@@ -36,18 +66,25 @@ OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> or
             extractResultTensors(node);
         else if (IsConstantNode(*node))
             extractImmutableTensors(node);
+        else if (IsAssignNode(*node))
+            extractAssignTensors(node, node_idx);
         else if (IsConcatOptimizedNode(*node))
             mergeConcatMutableTensors(node, node_idx);
         else if (isReshapeOnlyNode(*node))
             extractReshapeTensors(node, node_idx);
+        else if (extractTailPadTensors(node, node_idx))
+            continue;
+        else if (is_in_place && extractInPlaceTensors(node, node_idx, is_in_place))
+            continue;
+        else if (extractViewTensors(node))
+            continue;
         else
             extractMutableTensors(node, node_idx);
     }
     for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
         for (const auto& input : ordered_nodes[node_idx]->inputs()) {
             try {
-                const auto tensorName = GetTensorNameInternal(input);
-                const BufferID bufferId = tensor_names_.at(tensorName)->GetBuffer().GetId();
+                const BufferID bufferId = tensor_names_.at(GetTensorKey(input))->GetBuffer().GetId();
                 const bool isImmutableBuffer = immutable_buffers_.find(bufferId) != immutable_buffers_.end();
                 if (!isImmutableBuffer) {
                     auto& mutableBuffer = mutable_buffers_.at(bufferId);
@@ -63,14 +100,21 @@ OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> or
             }
         }
     }
+    extractVariableBuffers(ordered_nodes);
+    if (is_external_io) {
+        extractExternalBuffers(ordered_nodes);
+    }
 }
 
 std::vector<TensorID> OperationBuffersExtractor::inputTensorIds(const ov::Node& node) const {
     std::vector<TensorID> result{};
     for (const auto& input : node.inputs()) {
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor_names_.at(GetTensorKey(input));
         result.push_back(*tensorId);
     }
+    if (const auto readValue = dynamic_cast<const ov::op::util::ReadValueBase*>(&node)) {
+        result.push_back(*variable_tensors_.at(readValue->get_variable_id()));
+    }
     return result;
 }
 
@@ -78,9 +122,12 @@ std::vector<TensorID> OperationBuffersExtractor::outputTensorIds(const ov::Node&
     if (IsResultNode(node)) return {};
     std::vector<TensorID> result{};
     for (const auto& output : node.outputs()) {
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(output));
+        const auto& tensorId = tensor_names_.at(GetTensorKey(output));
         result.push_back(*tensorId);
     }
+    if (const auto assign = dynamic_cast<const ov::op::util::AssignBase*>(&node)) {
+        result.push_back(*variable_tensors_.at(assign->get_variable_id()));
+    }
     return result;
 }
 
@@ -124,6 +171,23 @@ std::vector<BufferID> OperationBuffersExtractor::mutableBuffersIds() const {
     return result;
 }
 
+std::vector<std::size_t> OperationBuffersExtractor::liveMutableBuffersSizes() const {
+    // Lifespan of stable buffers ends after the last node
+    std::vector<std::int64_t> sizeChanges(num_ordered_nodes_ + 2, 0);
+    // Mutable work buffers are among mutable buffers, which live only while their node is executed
+    for (const auto& [id, buffer] : mutable_buffers_) {
+        sizeChanges.at(buffer.lifespan_start) += static_cast<std::int64_t>(buffer.size);
+        sizeChanges.at(buffer.lifespan_end + 1) -= static_cast<std::int64_t>(buffer.size);
+    }
+    std::vector<std::size_t> result(num_ordered_nodes_);
+    std::int64_t liveSize = 0;
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        liveSize += sizeChanges[i];
+        result[i] = liveSize;
+    }
+    return result;
+}
+
 std::vector<BufferID> OperationBuffersExtractor::immutableBuffersIds() const {
     std::vector<BufferID> result{};
     for (const auto& pair : immutable_buffers_) {
@@ -133,13 +197,13 @@ std::vector<BufferID> OperationBuffersExtractor::immutableBuffersIds() const {
 }
 
 void OperationBuffersExtractor::mergeConcatMutableTensors(const NodePtr& node, int node_idx) {
-    std::vector<std::pair<std::string, TensorID::Ptr>> mergedTensors;
+    std::vector<std::pair<TensorKey, TensorID::Ptr>> mergedTensors;
     mergedTensors.reserve(node->inputs().size());
     for (const auto& input : node->inputs()) {
-        const auto& tensorName = GetTensorNameInternal(input.get_source_output());
-        const auto& tensorId = tensor_names_.at(tensorName);
+        const auto tensorKey = GetTensorKey(input);
+        const auto& tensorId = tensor_names_.at(tensorKey);
         OPENVINO_ASSERT(&tensorId->GetBuffer() == tensorId.get());
-        mergedTensors.emplace_back(tensorName, tensorId);
+        mergedTensors.emplace_back(tensorKey, tensorId);
     }
     OPENVINO_ASSERT(!mergedTensors.empty());
 
@@ -160,18 +224,35 @@ void OperationBuffersExtractor::mergeConcatMutableTensors(const NodePtr& node, i
     auto mergedTensorByteSize = GetTensorByteSize(output);
     auto parentTensor = std::make_shared<TensorID>(next_buffer_id_);
     next_buffer_id_ += 1;
-    tensor_names_.emplace(GetTensorNameInternal(output), parentTensor);
+    tensor_names_.emplace(GetTensorKey(output), parentTensor);
 
     mutable_buffers_.emplace(std::make_pair(parentTensor->GetBuffer().GetId(),
                                             BufferDesc{minLifespanStart, node_idx, mergedTensorByteSize}));
+    updateBufferLastUse(parentTensor->GetId(), GetTensorKey(output));
     for (const auto& bufferId : mergedBufferIds) {
         mutable_buffers_.erase(bufferId);
+        const auto lastUse = buffer_last_uses_.find(bufferId);
+        if (lastUse != buffer_last_uses_.end()) {
+            auto& parentLastUse = buffer_last_uses_[parentTensor->GetId()];
+            parentLastUse = std::max(parentLastUse, lastUse->second);
+        }
     }
 
+    // Every input starts at its position along the axis in the first block above the axis, so that inputs of
+    // a concat along an inner axis occupy strided slices (see ConcatOptimized::get_strided_slice)
+    const auto& outputShape = output.get_shape();
+    const auto concat = ov::as_type_ptr<ov::op::v0::Concat>(node);
+    OPENVINO_ASSERT(concat);
+    const auto axis =
+        static_cast<size_t>(concat->get_axis() < 0 ? concat->get_axis() + outputShape.size() : concat->get_axis());
+    const size_t sizeBelowAxis = std::accumulate(
+        outputShape.begin() + axis + 1, outputShape.end(), output.get_element_type().size(), std::multiplies<size_t>());
     size_t totalSize = 0;
-    for (const auto& t : mergedTensors) {
-        auto& tensor = tensor_names_.at(t.first);
-        tensor->SetParent(parentTensor, totalSize);
+    size_t positionAlongAxis = 0;
+    for (size_t i = 0; i < mergedTensors.size(); ++i) {
+        auto& tensor = tensor_names_.at(mergedTensors[i].first);
+        tensor->SetParent(parentTensor, positionAlongAxis * sizeBelowAxis);
+        positionAlongAxis += node->get_input_shape(i).at(axis);
         totalSize += mutable_tensor_sizes_.at(tensor->GetId());
     }
     mutable_tensor_sizes_[parentTensor->GetId()] = totalSize;
@@ -183,20 +264,226 @@ void OperationBuffersExtractor::extractReshapeTensors(const NodePtr& node, int n
         OPENVINO_ASSERT(node->inputs().size() >= 1);
         OPENVINO_ASSERT(node->outputs().size() == 1);
         const auto input = node->inputs().at(0);
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor_names_.at(GetTensorKey(input));
         const auto output = node->outputs().at(0);
-        tensor_names_.emplace(GetTensorNameInternal(output), tensorId);
+        tensor_names_.emplace(GetTensorKey(output), tensorId);
+        updateBufferLastUse(tensorId->GetBuffer().GetId(), GetTensorKey(output));
     } catch (std::out_of_range&) {
         throw_ov_exception(fmt::format("Failed to extract output buffer for reshape only node '{}'", node->get_name()));
     }
 }
 
+bool OperationBuffersExtractor::extractInPlaceTensors(const NodePtr& node,
+                                                      int node_idx,
+                                                      const InPlacePredicate& is_in_place) {
+    if (node->get_output_size() != 1) {
+        return false;
+    }
+    const auto& output = node->output(0);
+    for (const auto& input : node->inputs()) {
+        if (!is_in_place(*node, input.get_index()) || input.get_element_type() != output.get_element_type() ||
+            input.get_shape() != output.get_shape()) {
+            continue;
+        }
+        const auto& tensorId = tensor_names_.at(GetTensorKey(input));
+        const BufferID bufferId = tensorId->GetId();
+        // Tensors merged into a bigger buffer (e.g. by ConcatOptimized), parameters and inputs of Assign,
+        // which may become state of a variable, are left intact
+        if (&tensorId->GetBuffer() != tensorId.get() || parameter_buffers_.count(bufferId) > 0 ||
+            assign_buffers_.count(bufferId) > 0) {
+            continue;
+        }
+        const auto mutableBuffer = mutable_buffers_.find(bufferId);
+        const auto lastUse = buffer_last_uses_.find(bufferId);
+        if (mutableBuffer == mutable_buffers_.end() || mutableBuffer->second.size != GetTensorByteSize(output) ||
+            lastUse == buffer_last_uses_.end() || lastUse->second != node_idx) {
+            continue;
+        }
+        tensor_names_.emplace(GetTensorKey(output), tensorId);
+        updateBufferLastUse(bufferId, GetTensorKey(output));
+        return true;
+    }
+    return false;
+}
+
+bool OperationBuffersExtractor::extractViewTensors(const NodePtr& node) {
+    const auto offsets = getViewOffsets(*node);
+    if (!offsets) {
+        return false;
+    }
+    const auto& tensorId = tensor_names_.at(GetTensorKey(node->input(0)));
+    const BufferID bufferId = tensorId->GetBuffer().GetId();
+    if (immutable_buffers_.count(bufferId) > 0) {
+        return false;
+    }
+    // ConcatOptimized merges only tensors which occupy their own buffers
+    for (const auto& output : node->outputs()) {
+        if (isMergedByConcat(output)) {
+            return false;
+        }
+    }
+    for (const auto& output : node->outputs()) {
+        const auto tensorKey = GetTensorKey(output);
+        auto view = std::make_shared<TensorID>(next_buffer_id_);
+        view->SetParent(tensorId, offsets->at(output.get_index()));
+        mutable_tensor_sizes_[next_buffer_id_] = GetTensorByteSize(output);
+        tensor_names_.emplace(tensorKey, view);
+        updateBufferLastUse(bufferId, tensorKey);
+        next_buffer_id_++;
+    }
+    view_nodes_.insert(node.get());
+    return true;
+}
+
+bool OperationBuffersExtractor::extractTailPadTensors(const NodePtr& node, int node_idx) {
+    if (!isTailPadNode(*node)) {
+        return false;
+    }
+    const auto& input = node->input(0);
+    const auto& output = node->output(0);
+    const auto& tensorId = tensor_names_.at(GetTensorKey(input));
+    const BufferID bufferId = tensorId->GetId();
+    // Only a buffer taken by the input alone is grown, parameters are left intact
+    if (&tensorId->GetBuffer() != tensorId.get() || parameter_buffers_.count(bufferId) > 0) {
+        return false;
+    }
+    const auto mutableBuffer = mutable_buffers_.find(bufferId);
+    if (mutableBuffer == mutable_buffers_.end() || mutableBuffer->second.size != GetTensorByteSize(input)) {
+        return false;
+    }
+    if (isMergedByConcat(input.get_source_output()) || isMergedByConcat(output)) {
+        return false;
+    }
+    mutableBuffer->second.size = GetTensorByteSize(output);
+    mutable_tensor_sizes_[bufferId] = GetTensorByteSize(output);
+    tensor_names_.emplace(GetTensorKey(output), tensorId);
+    updateBufferLastUse(bufferId, GetTensorKey(output));
+    return true;
+}
+
+bool OperationBuffersExtractor::isMergedByConcat(const ov::Output<ov::Node>& output) {
+    for (const auto& input : output.get_target_inputs()) {
+        const auto& consumer = *input.get_node();
+        if (IsConcatOptimizedNode(consumer) ||
+            (isReshapeOnlyNode(consumer) && input.get_index() == 0 && isMergedByConcat(consumer.output(0)))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::optional<std::vector<std::size_t>> OperationBuffersExtractor::getViewOffsets(const ov::Node& node) {
+    const bool isSplit =
+        ov::is_type<const ov::op::v1::Split>(&node) || ov::is_type<const ov::op::v1::VariadicSplit>(&node);
+    const auto stridedSlice = ov::as_type<const ov::op::v1::StridedSlice>(&node);
+    if ((!isSplit && !stridedSlice) || node.get_input_partial_shape(0).is_dynamic()) {
+        return std::nullopt;
+    }
+    const auto& inputShape = node.get_input_shape(0);
+    const auto elementSize = node.get_input_element_type(0).size();
+    const auto innerSize = [&](std::size_t axis) {
+        return elementSize * shape_size(ov::Shape(inputShape.begin() + axis + 1, inputShape.end()));
+    };
+    const auto isOutermostAxis = [&](std::size_t axis) {
+        return shape_size(ov::Shape(inputShape.begin(), inputShape.begin() + axis)) == 1;
+    };
+    for (const auto& output : node.outputs()) {
+        if (output.get_partial_shape().is_dynamic() || output.get_shape().size() != inputShape.size() ||
+            output.get_element_type() != node.get_input_element_type(0)) {
+            return std::nullopt;
+        }
+    }
+
+    if (isSplit) {
+        const auto axisNode = ov::as_type<const ov::op::v0::Constant>(node.get_input_node_ptr(1));
+        if (!axisNode) {
+            return std::nullopt;
+        }
+        auto axis = axisNode->cast_vector<int64_t>().at(0);
+        if (axis < 0) {
+            axis += static_cast<int64_t>(inputShape.size());
+        }
+        if (axis < 0 || axis >= static_cast<int64_t>(inputShape.size()) || !isOutermostAxis(axis)) {
+            return std::nullopt;
+        }
+        std::vector<std::size_t> offsets;
+        std::size_t offset = 0;
+        for (const auto& output : node.outputs()) {
+            offsets.push_back(offset);
+            offset += output.get_shape()[axis] * innerSize(axis);
+        }
+        return offsets;
+    }
+
+    const auto isZero = [](const std::vector<int64_t>& mask) {
+        return std::all_of(mask.begin(), mask.end(), [](auto bit) { return bit == 0; });
+    };
+    if (!isZero(stridedSlice->get_new_axis_mask()) || !isZero(stridedSlice->get_shrink_axis_mask()) ||
+        !isZero(stridedSlice->get_ellipsis_mask())) {
+        return std::nullopt;
+    }
+    const auto beginNode = ov::as_type<const ov::op::v0::Constant>(node.get_input_node_ptr(1));
+    const auto stridesNode =
+        node.get_input_size() > 3 ? ov::as_type<const ov::op::v0::Constant>(node.get_input_node_ptr(3)) : nullptr;
+    if (!beginNode || (node.get_input_size() > 3 && !stridesNode)) {
+        return std::nullopt;
+    }
+    if (stridesNode) {
+        const auto strides = stridesNode->cast_vector<int64_t>();
+        if (std::any_of(strides.begin(), strides.end(), [](auto stride) { return stride != 1; })) {
+            return std::nullopt;
+        }
+    }
+    // Only one axis may be sliced
+    const auto& outputShape = node.get_output_shape(0);
+    std::size_t axis = 0;
+    while (axis < inputShape.size() && inputShape[axis] == outputShape[axis]) {
+        ++axis;
+    }
+    if (axis == inputShape.size()) {
+        return std::vector<std::size_t>{0};
+    }
+    if (!isOutermostAxis(axis) ||
+        !std::equal(inputShape.begin() + axis + 1, inputShape.end(), outputShape.begin() + axis + 1)) {
+        return std::nullopt;
+    }
+    const auto begin = beginNode->cast_vector<int64_t>();
+    const auto& beginMask = stridedSlice->get_begin_mask();
+    const auto dim = static_cast<int64_t>(inputShape[axis]);
+    int64_t start = 0;
+    if (axis < begin.size() && (axis >= beginMask.size() || beginMask[axis] == 0)) {
+        start = begin[axis] < 0 ? begin[axis] + dim : begin[axis];
+        start = std::clamp<int64_t>(start, 0, dim);
+    }
+    if (start + static_cast<int64_t>(outputShape[axis]) > dim) {
+        return std::nullopt;
+    }
+    return std::vector<std::size_t>{static_cast<std::size_t>(start) * innerSize(axis)};
+}
+
+bool OperationBuffersExtractor::isViewNode(const ov::Node& node) const { return view_nodes_.count(&node) > 0; }
+
+void OperationBuffersExtractor::updateBufferLastUse(BufferID buffer_id, const TensorKey& tensor_key) {
+    const auto tensorLastUse = tensor_last_uses_.find(tensor_key);
+    if (tensorLastUse != tensor_last_uses_.end()) {
+        auto& lastUse = buffer_last_uses_[buffer_id];
+        lastUse = std::max(lastUse, tensorLastUse->second);
+    }
+}
+
+void OperationBuffersExtractor::extractAssignTensors(const NodePtr& node, int node_idx) {
+    // Output of Assign is its input
+    extractReshapeTensors(node, node_idx);
+    assign_buffers_.insert(tensor_names_.at(GetTensorKey(node->input(0)))->GetBuffer().GetId());
+}
+
 void OperationBuffersExtractor::extractMutableTensors(const NodePtr& node, int node_idx) {
     for (const auto& output : node->outputs()) {
         auto tensorByteSize = GetTensorByteSize(output);
         mutable_tensor_sizes_[next_buffer_id_] = tensorByteSize;
         mutable_buffers_.emplace(std::make_pair(next_buffer_id_, BufferDesc{node_idx, node_idx, tensorByteSize}));
-        tensor_names_.emplace(GetTensorNameInternal(output), std::make_shared<TensorID>(next_buffer_id_));
+        tensor_names_.emplace(GetTensorKey(output), std::make_shared<TensorID>(next_buffer_id_));
+        updateBufferLastUse(next_buffer_id_, GetTensorKey(output));
         next_buffer_id_++;
     }
 }
@@ -205,9 +492,10 @@ void OperationBuffersExtractor::extractParameterTensors(const NodePtr& node, int
     if (node->inputs().size() > 0) {
         OPENVINO_ASSERT(node->get_output_size() > 0);
         auto input = node->inputs().front().get_source_output();
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor_names_.at(GetTensorKey(input));
         for (auto& output : node->outputs()) {
-            tensor_names_.emplace(GetTensorNameInternal(output), tensorId);
+            tensor_names_.emplace(GetTensorKey(output), tensorId);
+            updateBufferLastUse(tensorId->GetBuffer().GetId(), GetTensorKey(output));
         }
     } else {
         const int lastNodeIdx = is_stable_params_ ? num_ordered_nodes_ : node_idx;
@@ -216,7 +504,8 @@ void OperationBuffersExtractor::extractParameterTensors(const NodePtr& node, int
             mutable_tensor_sizes_[next_buffer_id_] = tensorByteSize;
             mutable_buffers_.emplace(
                 std::make_pair(next_buffer_id_, BufferDesc{node_idx, lastNodeIdx, tensorByteSize}));
-            tensor_names_.emplace(GetTensorNameInternal(output), std::make_shared<TensorID>(next_buffer_id_));
+            tensor_names_.emplace(GetTensorKey(output), std::make_shared<TensorID>(next_buffer_id_));
+            parameter_buffers_.insert(next_buffer_id_);
             next_buffer_id_++;
         }
     }
@@ -225,16 +514,21 @@ void OperationBuffersExtractor::extractParameterTensors(const NodePtr& node, int
 void OperationBuffersExtractor::extractResultTensors(const NodePtr& node) {
     if (node->get_output_size() > 0) {
         auto input = node->inputs().front().get_source_output();
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor_names_.at(GetTensorKey(input));
         for (auto& output : node->outputs()) {
-            tensor_names_.emplace(GetTensorNameInternal(output), tensorId);
+            tensor_names_.emplace(GetTensorKey(output), tensorId);
+            updateBufferLastUse(tensorId->GetBuffer().GetId(), GetTensorKey(output));
         }
     }
     if (is_stable_results_) {
         auto input = node->inputs().front().get_source_output();
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor_names_.at(GetTensorKey(input));
+        if (immutable_buffers_.count(tensorId->GetBuffer().GetId()) > 0) {
+            // Constant is alive for the whole graph's life time anyway
+            return;
+        }
         auto resultBuffer = std::find_if(mutable_buffers_.begin(), mutable_buffers_.end(), [&tensorId](const auto& mb) {
-            return mb.first == tensorId->GetId();
+            return mb.first == tensorId->GetBuffer().GetId();
         });
         if (resultBuffer == mutable_buffers_.end()) {
             throw_ov_exception(fmt::format("Cannot find mutable buffer for Result with name {}", node->get_name()));
@@ -249,52 +543,304 @@ void OperationBuffersExtractor::extractImmutableTensors(const NodePtr& node) {
     auto span = gsl::make_span(ptr, GetTensorByteSize(node->output(0)));
     auto tensor = std::make_shared<TensorID>(next_buffer_id_);
     immutable_buffers_.emplace(std::make_pair(tensor->GetId(), span));
-    tensor_names_.emplace(GetTensorNameInternal(node->output(0)), tensor);
+    const auto consumers = node->output(0).get_target_inputs();
+    if (!consumers.empty() && std::all_of(consumers.begin(), consumers.end(), [](const auto& input) {
+            return input.get_index() == 0 && ov::is_type<ov::op::util::GatherBase>(input.get_node());
+        })) {
+        gather_table_buffers_.insert(tensor->GetId());
+    }
+    tensor_names_.emplace(GetTensorKey(node->output(0)), tensor);
     next_buffer_id_++;
 }
 
+void OperationBuffersExtractor::extractExternalBuffers(gsl::span<const NodePtr> ordered_nodes) {
+    auto addExternalBuffer = [this](const NodePtr& node, const TensorKey& tensorKey, std::size_t tensorByteSize) {
+        const auto& tensorId = tensor_names_.at(tensorKey);
+        const BufferID bufferId = tensorId->GetId();
+        if (tensorId->GetBuffer().GetId() != bufferId || tensorId->GetOffset() != 0) {
+            return;
+        }
+        const auto mutableBuffer = mutable_buffers_.find(bufferId);
+        if (mutableBuffer == mutable_buffers_.end() || mutableBuffer->second.size != tensorByteSize) {
+            // Buffer is either external already (e.g. Parameter is connected to Result directly) or
+            // it is occupied by several tensors
+            return;
+        }
+        external_buffers_.push_back({bufferId, node, tensorByteSize});
+        mutable_buffers_.erase(mutableBuffer);
+    };
+    for (const auto& node : ordered_nodes) {
+        if (IsParameterNode(*node) && node->get_input_size() == 0 && node->get_output_size() == 1) {
+            const auto& output = node->output(0);
+            if (shape_size(output.get_shape()) > 0) {
+                addExternalBuffer(node, GetTensorKey(output), GetTensorByteSize(output));
+            }
+        } else if (IsResultNode(*node)) {
+            const auto& input = node->input(0);
+            if (shape_size(input.get_shape()) > 0) {
+                addExternalBuffer(node, GetTensorKey(input), GetTensorByteSize(input));
+            }
+        }
+    }
+}
+
+void OperationBuffersExtractor::extractVariableBuffers(gsl::span<const NodePtr> ordered_nodes) {
+    struct Variable {
+        std::vector<int> read_values;
+        std::vector<int> assigns;
+    };
+    // Ordered by identifiers, so buffers of variables are the same for the same model
+    std::map<std::string, Variable> variables;
+    for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
+        const auto& node = ordered_nodes[node_idx];
+        if (const auto readValue = ov::as_type_ptr<ov::op::util::ReadValueBase>(node)) {
+            variables[readValue->get_variable_id()].read_values.push_back(node_idx);
+        } else if (const auto assign = ov::as_type_ptr<ov::op::util::AssignBase>(node)) {
+            variables[assign->get_variable_id()].assigns.push_back(node_idx);
+        }
+    }
+    // Mutable buffer which is taken by the tensor from its beginning to the end
+    auto ownBuffer = [this](const TensorKey& tensorKey, std::size_t size) -> std::optional<BufferID> {
+        const auto& tensorId = tensor_names_.at(tensorKey);
+        const auto mutableBuffer = mutable_buffers_.find(tensorId->GetId());
+        if (&tensorId->GetBuffer() != tensorId.get() || mutableBuffer == mutable_buffers_.end() ||
+            mutableBuffer->second.size != size) {
+            return std::nullopt;
+        }
+        return tensorId->GetId();
+    };
+    auto bufferId = [this](const TensorKey& tensorKey) { return tensor_names_.at(tensorKey)->GetBuffer().GetId(); };
+    for (const auto& [variableId, variable] : variables) {
+        const auto& anyNode = ordered_nodes[variable.read_values.empty() ? variable.assigns.front()
+                                                                         : variable.read_values.front()];
+        const auto size = GetTensorByteSize(anyNode->output(0));
+        // The state is read until the last use of buffers of ReadValue outputs
+        int lastRead = -1;
+        for (const auto node_idx : variable.read_values) {
+            const auto mutableBuffer =
+                mutable_buffers_.find(bufferId(GetTensorKey(ordered_nodes[node_idx]->output(0))));
+            const int end = mutableBuffer != mutable_buffers_.end() ? mutableBuffer->second.lifespan_end : node_idx;
+            lastRead = std::max(lastRead, end);
+        }
+        std::optional<BufferID> readBuffer;
+        if (variable.read_values.size() == 1) {
+            const auto& output = ordered_nodes[variable.read_values.front()]->output(0);
+            readBuffer = ownBuffer(GetTensorKey(output), size);
+            const auto consumers = output.get_target_inputs();
+            // Results are downloaded asynchronously, while Assign may already write the state
+            const bool isDownloaded =
+                std::any_of(consumers.begin(),
+                            consumers.end(),
+                            [](const auto& input) { return IsResultNode(*input.get_node()); }) ||
+                (readBuffer && mutable_buffers_.at(*readBuffer).lifespan_end >= static_cast<int>(num_ordered_nodes_));
+            // Assign which copies the state must not overwrite it while it is still read
+            const bool isOverwritten = std::any_of(
+                variable.assigns.begin(), variable.assigns.end(), [&](const int node_idx) {
+                    return node_idx <= lastRead &&
+                           bufferId(GetTensorKey(ordered_nodes[node_idx]->input(0))) != readBuffer;
+                });
+            if (isDownloaded || isOverwritten) {
+                readBuffer.reset();
+            }
+        }
+        std::optional<BufferID> assignBuffer;
+        if (variable.assigns.size() == 1) {
+            const auto& input = ordered_nodes[variable.assigns.front()]->input(0);
+            assignBuffer = ownBuffer(GetTensorKey(input), size);
+            if (assignBuffer && (assignBuffer == readBuffer || parameter_buffers_.count(*assignBuffer) > 0 ||
+                                 mutable_buffers_.at(*assignBuffer).lifespan_start <= lastRead)) {
+                assignBuffer.reset();
+            }
+        }
+        auto moveToState = [&](const BufferID id, const NodePtr& node) {
+            external_buffers_.push_back({id, node, size, variableId});
+            mutable_buffers_.erase(id);
+        };
+        if (readBuffer) {
+            variable_tensors_.emplace(variableId, tensor_names_.at(GetTensorKey(anyNode->output(0))));
+            moveToState(*readBuffer, anyNode);
+        } else {
+            variable_tensors_.emplace(variableId, std::make_shared<TensorID>(next_buffer_id_));
+            external_buffers_.push_back({next_buffer_id_, anyNode, size, variableId});
+            next_buffer_id_++;
+        }
+        if (assignBuffer) {
+            moveToState(*assignBuffer, ordered_nodes[variable.assigns.front()]);
+        }
+    }
+}
+
 WorkbufferIds OperationBuffersExtractor::processWorkbufferRequest(int node_idx, const WorkbufferRequest& request) {
     WorkbufferIds result{};
     for (auto size : request.immutable_sizes) {
         immutable_workbuffers_.emplace(next_buffer_id_, size);
+        immutable_workbuffer_nodes_.emplace(next_buffer_id_, node_idx);
         result.immutableIds.push_back(next_buffer_id_);
         next_buffer_id_++;
     }
     for (auto size : request.mutable_sizes) {
         // mutable workbuffers share the same memory space with mutable I/O buffers
         mutable_buffers_.emplace(std::make_pair(next_buffer_id_, BufferDesc{node_idx, node_idx, size}));
+        mutable_workbuffers_.insert(next_buffer_id_);
         result.mutableIds.push_back(next_buffer_id_);
         next_buffer_id_++;
     }
     return result;
 }
 
-void OperationBuffersExtractor::initConstantMemory(DeviceMemBlock::Ptr memory_block) const {
+void OperationBuffersExtractor::extendLifespans(gsl::span<const std::size_t> concurrency_ends) {
+    OPENVINO_ASSERT(concurrency_ends.size() == num_ordered_nodes_);
+    for (auto& [id, buffer] : mutable_buffers_) {
+        // Lifespan of stable buffers ends after the last node
+        const auto last = std::min<std::size_t>(buffer.lifespan_end, num_ordered_nodes_ - 1);
+        for (std::size_t node_idx = std::max(buffer.lifespan_start, 0); node_idx <= last; ++node_idx) {
+            buffer.lifespan_end = std::max(buffer.lifespan_end, static_cast<int>(concurrency_ends[node_idx]));
+        }
+    }
+}
+
+OperationBuffersExtractor::PackedTensors OperationBuffersExtractor::packTensors(
+    const std::vector<std::pair<NodePtr, ov::Output<ov::Node>>>& tensors) {
+    std::vector<std::pair<NodePtr, TensorID::Ptr>> packable;
+    std::unordered_set<BufferID> packableBuffers;
+    for (const auto& [node, output] : tensors) {
+        const auto tensor = tensor_names_.find(GetTensorKey(output));
+        if (tensor == tensor_names_.end()) {
+            continue;
+        }
+        const auto& tensorId = tensor->second;
+        const auto buffer = mutable_buffers_.find(tensorId->GetId());
+        if (&tensorId->GetBuffer() != tensorId.get() || buffer == mutable_buffers_.end() ||
+            buffer->second.size != GetTensorByteSize(output) || !packableBuffers.insert(tensorId->GetId()).second) {
+            continue;
+        }
+        packable.emplace_back(node, tensorId);
+    }
+    PackedTensors packed;
+    if (packable.size() < 2) {
+        return packed;
+    }
+    auto packTensor = std::make_shared<TensorID>(next_buffer_id_++);
+    int lifespanStart = std::numeric_limits<int>::max();
+    int lifespanEnd = std::numeric_limits<int>::min();
+    for (const auto& [node, tensorId] : packable) {
+        const auto buffer = mutable_buffers_.find(tensorId->GetId());
+        lifespanStart = std::min(lifespanStart, buffer->second.lifespan_start);
+        lifespanEnd = std::max(lifespanEnd, buffer->second.lifespan_end);
+        tensorId->SetParent(packTensor, packed.size);
+        packed.offsets.emplace_back(node, packed.size);
+        packed.size += applyAllignment(buffer->second.size);
+        mutable_buffers_.erase(buffer);
+    }
+    mutable_buffers_.emplace(packTensor->GetId(), BufferDesc{lifespanStart, lifespanEnd, packed.size});
+    mutable_tensor_sizes_[packTensor->GetId()] = packed.size;
+    return packed;
+}
+
+std::unique_ptr<ConstantsUpload> OperationBuffersExtractor::initConstantMemory(
+    DeviceMemBlock::Ptr memory_block, const std::string& ipc_constants_dir) const {
+    std::vector<ConstantsUpload::Region> regions;
     for (const auto& buffer_id : memory_block->bufferIds()) {
         auto span = immutableBuffer(buffer_id);
         void* device_ptr = memory_block->deviceBufferPtr(buffer_id);
         OPENVINO_ASSERT(device_ptr != nullptr);
-        throwIfError(::cudaMemcpy(device_ptr, span.data(), span.size_bytes(), cudaMemcpyHostToDevice));
+        regions.push_back({device_ptr, span});
+    }
+    for (auto id : immutableBuffersIds()) {
+        auto span = immutableBuffer(id);
+        if (auto offloaded = offloaded_constants_.find(id); offloaded != offloaded_constants_.end()) {
+            memory_block->bindSharedBuffer(id, OffloadedConstant::create(span, offloaded->second));
+        } else if (isSharedConstant(span)) {
+            memory_block->bindSharedBuffer(id, ConstantCache::instance().getOrUpload(span, ipc_constants_dir));
+        }
     }
+    return std::make_unique<ConstantsUpload>(std::move(regions));
 }
 
 MemoryModel::Ptr OperationBuffersExtractor::createConstantMemoryModel() const {
     ImmutableMemoryModelBuilder constants_block_builder;
-    // Process nGraph and add allocations
+    // Process nGraph and add allocations, large constants are shared with other models instead
     for (auto id : immutableBuffersIds()) {
         auto span = immutableBuffer(id);
-        constants_block_builder.addAllocation(id, span.size());
+        if (!isSharedConstant(span)) {
+            constants_block_builder.addAllocation(id, span.size());
+        }
     }
     return constants_block_builder.build();
 }
 
-MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel() const {
+bool OperationBuffersExtractor::isSharedConstant(gsl::span<const Byte> buffer) {
+    return buffer.size_bytes() >= ConstantCache::kMinSharedConstantSize;
+}
+
+void OperationBuffersExtractor::offloadConstants(std::size_t device_memory_limit) {
+    offloaded_constants_.clear();
+    std::size_t resident_size = createConstantMemoryModel()->deviceMemoryBlockSize() +
+                                createMutableMemoryModel()->deviceMemoryBlockSize();
+    std::vector<BufferID> candidates;
+    for (auto id : immutableBuffersIds()) {
+        const auto span = immutableBuffer(id);
+        if (!isSharedConstant(span)) {
+            continue;
+        }
+        if (gather_table_buffers_.count(id) > 0) {
+            offloaded_constants_.emplace(id, OffloadedConstant::Placement::MappedHost);
+        } else {
+            resident_size += span.size();
+            candidates.push_back(id);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [this](BufferID lhs, BufferID rhs) {
+        return immutableBuffer(lhs).size() > immutableBuffer(rhs).size();
+    });
+    for (auto id : candidates) {
+        if (resident_size <= device_memory_limit) {
+            break;
+        }
+        offloaded_constants_.emplace(id, OffloadedConstant::Placement::Managed);
+        resident_size -= immutableBuffer(id).size();
+    }
+}
+
+std::size_t OperationBuffersExtractor::offloadedConstantsSize() const {
+    std::size_t size = 0;
+    for (const auto& offloaded : offloaded_constants_) {
+        size += immutableBuffer(offloaded.first).size();
+    }
+    return size;
+}
+
+MemoryModelBuilder OperationBuffersExtractor::mutableMemoryModelBuilder() const {
     MemoryModelBuilder mutable_model_builder;
     for (auto id : mutableBuffersIds()) {
-        mutable_model_builder.addAllocation(
-            id, mutableBufferLifespanStart(id), mutableBufferLifespanEnd(id), mutableBufferSize(id));
+        // Work buffers of operations, which may be executed concurrently with others, aren't scratch memory
+        if (mutable_workbuffers_.count(id) > 0 &&
+            mutableBufferLifespanStart(id) == mutableBufferLifespanEnd(id)) {
+            mutable_model_builder.addScratchAllocation(id, mutableBufferLifespanStart(id), mutableBufferSize(id));
+        } else {
+            mutable_model_builder.addAllocation(
+                id, mutableBufferLifespanStart(id), mutableBufferLifespanEnd(id), mutableBufferSize(id));
+        }
+    }
+    return mutable_model_builder;
+}
+
+MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel() const {
+    return mutableMemoryModelBuilder().build();
+}
+
+std::size_t OperationBuffersExtractor::mutableWorkbuffersSize() const {
+    std::size_t size = 0;
+    for (auto id : mutable_workbuffers_) {
+        size += applyAllignment(mutableBufferSize(id));
     }
-    return mutable_model_builder.build();
+    return size;
+}
+
+std::size_t OperationBuffersExtractor::sharedMutableWorkbuffersSize() const {
+    auto mutable_model_builder = mutableMemoryModelBuilder();
+    mutable_model_builder.build();
+    return mutable_model_builder.scratchMemorySize();
 }
 
 MemoryModel::Ptr OperationBuffersExtractor::createImmutableMemoryModel() const {
@@ -306,6 +852,75 @@ MemoryModel::Ptr OperationBuffersExtractor::createImmutableMemoryModel() const {
     return immutable_workbuffer_model_builder.build();
 }
 
+std::vector<MemoryLayoutEntry> OperationBuffersExtractor::memoryLayout(gsl::span<const NodePtr> ordered_nodes) const {
+    const auto nodeName = [&](const int node_idx) {
+        return node_idx >= 0 && static_cast<std::size_t>(node_idx) < ordered_nodes.size()
+                   ? ordered_nodes[node_idx]->get_friendly_name()
+                   : std::string{};
+    };
+    std::unordered_map<BufferID, std::vector<std::string>> buffer_tensors;
+    std::unordered_map<BufferID, std::string> constant_nodes;
+    for (const auto& node : ordered_nodes) {
+        for (const auto& output : node->outputs()) {
+            const auto tensor = tensor_names_.find(GetTensorKey(output));
+            if (tensor == tensor_names_.end()) {
+                continue;
+            }
+            const auto buffer_id = tensor->second->GetBuffer().GetId();
+            buffer_tensors[buffer_id].push_back(fmt::format("{}:{}", node->get_friendly_name(), output.get_index()));
+            if (IsConstantNode(*node)) {
+                constant_nodes.emplace(buffer_id, node->get_friendly_name());
+            }
+        }
+    }
+
+    std::vector<MemoryLayoutEntry> layout;
+    const auto mutable_model = createMutableMemoryModel();
+    for (const auto& [id, buffer] : mutable_buffers_) {
+        auto& entry = layout.emplace_back();
+        entry.block = "mutable";
+        entry.id = id;
+        entry.kind = mutable_workbuffers_.count(id) > 0 ? "workbuffer" : "tensor";
+        entry.producer = buffer.lifespan_start;
+        entry.last_consumer = buffer.lifespan_end;
+        entry.op = nodeName(buffer.lifespan_start);
+        entry.size = buffer.size;
+        mutable_model->offsetForBuffer(id, entry.offset);
+        entry.tensors = buffer_tensors[id];
+    }
+    // Constants shared with other models aren't placed in the block and keep offset -1
+    const auto constant_model = createConstantMemoryModel();
+    for (const auto& [id, span] : immutable_buffers_) {
+        auto& entry = layout.emplace_back();
+        entry.block = "constants";
+        entry.id = id;
+        entry.kind = "constant";
+        entry.op = constant_nodes[id];
+        entry.size = span.size();
+        constant_model->offsetForBuffer(id, entry.offset);
+        entry.tensors = buffer_tensors[id];
+    }
+    const auto immutable_model = createImmutableMemoryModel();
+    for (const auto& [id, size] : immutable_workbuffers_) {
+        auto& entry = layout.emplace_back();
+        entry.block = "immutable_workbuffers";
+        entry.id = id;
+        entry.kind = "workbuffer";
+        entry.op = nodeName(immutable_workbuffer_nodes_.at(id));
+        entry.size = size;
+        immutable_model->offsetForBuffer(id, entry.offset);
+    }
+
+    const auto blockRank = [](const MemoryLayoutEntry& entry) {
+        return entry.block == "mutable" ? 0 : entry.block == "constants" ? 1 : 2;
+    };
+    std::sort(layout.begin(), layout.end(), [&](const MemoryLayoutEntry& lhs, const MemoryLayoutEntry& rhs) {
+        return std::make_tuple(blockRank(lhs), lhs.offset, lhs.id) <
+               std::make_tuple(blockRank(rhs), rhs.offset, rhs.id);
+    });
+    return layout;
+}
+
 bool OperationBuffersExtractor::IsParameterNode(const ov::Node& node) {
     return dynamic_cast<const ov::op::v0::Parameter*>(&node) != nullptr;
 }
@@ -318,6 +933,10 @@ bool OperationBuffersExtractor::IsConstantNode(const ov::Node& node) {
     return dynamic_cast<const ov::op::v0::Constant*>(&node) != nullptr;
 }
 
+bool OperationBuffersExtractor::IsAssignNode(const ov::Node& node) {
+    return dynamic_cast<const ov::op::util::AssignBase*>(&node) != nullptr;
+}
+
 bool OperationBuffersExtractor::IsConcatOptimizedNode(const ov::Node& node) {
     return dynamic_cast<const nodes::ConcatOptimized*>(&node) != nullptr;
 }
@@ -327,6 +946,46 @@ bool OperationBuffersExtractor::isReshapeOnlyNode(const ov::Node& node) {
            ov::is_type<const ov::op::v0::Unsqueeze>(&node);
 }
 
+bool OperationBuffersExtractor::isTailPadNode(const ov::Node& node) {
+    const auto pad = ov::as_type<const ov::op::v1::Pad>(&node);
+    if (!pad || pad->get_pad_mode() != ov::op::PadMode::CONSTANT || node.get_input_partial_shape(0).is_dynamic() ||
+        node.get_output_partial_shape(0).is_dynamic() ||
+        node.get_input_element_type(0) != node.get_output_element_type(0)) {
+        return false;
+    }
+    const auto padsBegin = ov::as_type<const ov::op::v0::Constant>(node.get_input_node_ptr(1));
+    const auto padsEnd = ov::as_type<const ov::op::v0::Constant>(node.get_input_node_ptr(2));
+    if (!padsBegin || !padsEnd) {
+        return false;
+    }
+    if (node.get_input_size() > 3) {
+        const auto padValue = ov::as_type<const ov::op::v0::Constant>(node.get_input_node_ptr(3));
+        if (!padValue) {
+            return false;
+        }
+        const auto values = padValue->cast_vector<double>();
+        if (std::any_of(values.begin(), values.end(), [](auto value) { return value != 0.0; })) {
+            return false;
+        }
+    }
+    const auto begin = padsBegin->cast_vector<int64_t>();
+    if (std::any_of(begin.begin(), begin.end(), [](auto pad) { return pad != 0; })) {
+        return false;
+    }
+    // Zeros are appended after the input, if only the outermost non-trivial axis is padded at its end
+    const auto end = padsEnd->cast_vector<int64_t>();
+    const auto& inputShape = node.get_input_shape(0);
+    bool outerAxes = true;
+    for (std::size_t axis = 0; axis < inputShape.size(); ++axis) {
+        const auto pad = axis < end.size() ? end[axis] : 0;
+        if (pad < 0 || (pad > 0 && !outerAxes)) {
+            return false;
+        }
+        outerAxes = outerAxes && inputShape[axis] == 1 && pad == 0;
+    }
+    return shape_size(inputShape) > 0;
+}
+
 void OperationBuffersExtractor::ThrowBufferSizesAreNotMatchError(const ov::Input<ov::Node>& input) {
     throw_ov_exception(
         fmt::format("Buffer size of Input #{} of {} node and corresponding "
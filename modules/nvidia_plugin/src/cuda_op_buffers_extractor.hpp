@@ -4,14 +4,20 @@
 
 #pragma once
 
+#include <cuda_memory_layout.hpp>
+#include <functional>
 #include <gsl/span>
 #include <memory>
+#include <memory_manager/cuda_constants_upload.hpp>
+#include <optional>
 #include <memory_manager/cuda_device_mem_block.hpp>
+#include <memory_manager/cuda_offloaded_constant.hpp>
 #include <memory_manager/model/cuda_immutable_memory_model_builder.hpp>
 #include <memory_manager/model/cuda_memory_model.hpp>
 #include <memory_manager/model/cuda_memory_model_builder.hpp>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "memory_manager/cuda_workbuffers.hpp"
@@ -29,7 +35,7 @@ class OperationBuffersExtractor {
 public:
     using NodePtr = std::shared_ptr<ov::Node>;
     using Byte = char;
-    static constexpr char kOutputNumberSeparator = '_';
+    using InPlacePredicate = std::function<bool(const ov::Node& node, size_t input_idx)>;
 
     /**
      * c-tor
@@ -37,21 +43,41 @@ public:
      * Nodes are ordered in their execution order.
      * @param [in] is_stable_params Makes input parameters alive for whole graph's life time
      * @param [in] is_stable_results Makes output results alive for till end of the graph's life time
+     * @param [in] is_external_io Makes Parameter/Result buffers external, i.e. not allocated within mutable
+     * memory block, but bound to the I/O tensors of an inference
+     * @param [in] is_in_place Checks if output of the node could be written in place of its input input_idx
+     * which isn't used by subsequent nodes (see IOperationMeta::kInPlace)
      * @throws ov::Exception if the given subgraph is bad formed
      */
     OperationBuffersExtractor(gsl::span<const NodePtr> ordered_nodes,
                               bool is_stable_params = false,
-                              bool is_stable_results = false);
+                              bool is_stable_results = false,
+                              bool is_external_io = false,
+                              const InPlacePredicate& is_in_place = {});
 
     /**
-     * Provides input tensors ids of the given ngraph node
+     * Buffer of Parameter/Result node which isn't allocated within mutable memory block,
+     * or state of a variable, which is kept by an infer request between inferences (see ReadValue/Assign)
+     */
+    struct ExternalBuffer {
+        BufferID id;
+        NodePtr node;
+        std::size_t size;
+        // Identifier of the variable if the buffer is its state
+        std::string variable{};
+    };
+
+    /**
+     * Provides input tensors ids of the given ngraph node.
+     * State of the variable is appended to the inputs of ReadValue
      * @param node ngraph node for which input tensors ids should be provided
      * @returns Input tensors ids
      */
     std::vector<TensorID> inputTensorIds(const ov::Node& node) const;
 
     /**
-     * Provides output tensors ids of the given ngraph node
+     * Provides output tensors ids of the given ngraph node.
+     * State of the variable is appended to the outputs of Assign
      * @param node ngraph node for which output tensors ids should be provided
      * @returns Output tensors ids
      */
@@ -101,11 +127,24 @@ public:
      */
     std::vector<BufferID> mutableBuffersIds() const;
 
+    /**
+     * Mutable work buffers are counted at their node, since processWorkbufferRequest adds them to mutable buffers,
+     * so it must be called after work buffers of all nodes are requested
+     * @returns Total size of mutable buffers (tensors and mutable work buffers) which are alive
+     * at each node in execution order
+     */
+    std::vector<std::size_t> liveMutableBuffersSizes() const;
+
     /**
      * @returns immutable buffers ids
      */
     std::vector<BufferID> immutableBuffersIds() const;
 
+    /**
+     * @returns external buffers of Parameter/Result nodes in execution order
+     */
+    const std::vector<ExternalBuffer>& externalBuffers() const { return external_buffers_; }
+
     /**
      * Handles work buffers request for the named operation
      * @param node_idx node index
@@ -114,6 +153,33 @@ public:
      */
     WorkbufferIds processWorkbufferRequest(int node_idx, const WorkbufferRequest& request);
 
+    /**
+     * Extends lifespans of mutable buffers (including work buffers) by nodes, which may be executed concurrently
+     * with their users on other streams (see ParallelBranches), so their memory isn't reused by those nodes.
+     * Must be called after work buffers of all nodes are requested
+     * @param concurrency_ends For each node the index of the last node, which may be executed concurrently with it
+     */
+    void extendLifespans(gsl::span<const std::size_t> concurrency_ends);
+
+    /**
+     * Tensors placed one after another into a single mutable buffer (see packTensors)
+     */
+    struct PackedTensors {
+        // Size of the buffer including alignment of the tensors
+        std::size_t size = 0;
+        // Offset of the tensor of each packed node within the buffer
+        std::vector<std::pair<NodePtr, std::size_t>> offsets;
+    };
+
+    /**
+     * Places tensors one after another into a single mutable buffer, which lives as long as any of them, so they
+     * are transferred by a single copy. Tensors sharing their buffers with other tensors (e.g. reused in place or
+     * merged by ConcatOptimized) are left as is. Must be called before tensor ids of nodes are taken
+     * @param tensors Nodes (e.g. Parameter or Result) with their tensors in the order of offsets
+     * @returns Packed tensors, no offsets if less than two tensors could be packed, then nothing is changed
+     */
+    PackedTensors packTensors(const std::vector<std::pair<NodePtr, ov::Output<ov::Node>>>& tensors);
+
     /**
      * @returns sizes of immutable workbuffers
      */
@@ -122,8 +188,12 @@ public:
     /**
      * Initialize constant memory
      * @param memory_block Memory block to initialize
+     * @param ipc_constants_dir Directory of CUDA IPC handles large constants are shared across processes by,
+     *                          empty if they are shared only within the process
+     * @returns Upload of constants into the memory block, which is performed in background
      */
-    void initConstantMemory(DeviceMemBlock::Ptr memory_block) const;
+    std::unique_ptr<ConstantsUpload> initConstantMemory(DeviceMemBlock::Ptr memory_block,
+                                                        const std::string& ipc_constants_dir = {}) const;
 
     /**
      * Create constant memory model
@@ -131,26 +201,72 @@ public:
      */
     MemoryModel::Ptr createConstantMemoryModel() const;
 
+    /**
+     * Checks if constant is stored in the device-wide cache of constants instead of the constants blob
+     * @param buffer Content of the constant
+     * @returns true if the constant is shared with other compiled models
+     */
+    static bool isSharedConstant(gsl::span<const Byte> buffer);
+
+    /**
+     * Places large constants out of device memory, must be called before initConstantMemory().
+     * Tables read only by Gather are placed in mapped host memory. Other large constants are placed in unified
+     * memory, the largest first, until the rest of constants and tensors of an infer request fit the limit
+     * @param device_memory_limit Device memory available for the model
+     */
+    void offloadConstants(std::size_t device_memory_limit);
+
+    /**
+     * @returns Total size of constants placed out of device memory by offloadConstants()
+     */
+    std::size_t offloadedConstantsSize() const;
+
     /**
      * Create mutable memory model
      * @return MemoryModel for mutable buffers
      */
     MemoryModel::Ptr createMutableMemoryModel() const;
 
+    /**
+     * @returns Total size of mutable work buffers of all operations, as if each of them took separate memory
+     */
+    std::size_t mutableWorkbuffersSize() const;
+
+    /**
+     * @returns Size of memory taken by mutable work buffers in the mutable memory model in addition to tensors.
+     * Work buffers are alive only while their operation is executed, so they share memory with each other
+     * and with dead tensors
+     */
+    std::size_t sharedMutableWorkbuffersSize() const;
+
     /**
      * Create immutable memory model
      * @return MemoryModel for immutable buffers
      */
     MemoryModel::Ptr createImmutableMemoryModel() const;
 
+    /**
+     * Provides placement of buffers in memory models created by createMutableMemoryModel(),
+     * createConstantMemoryModel() and createImmutableMemoryModel()
+     * @param ordered_nodes Nodes the extractor is created for
+     * @returns Buffers of the mutable block, constants and immutable work buffers in the order of their offsets
+     */
+    std::vector<MemoryLayoutEntry> memoryLayout(gsl::span<const NodePtr> ordered_nodes) const;
+
     /**
      * Provides tensor size for the given node like object
      * @param node Node like object to process
-     * @returns Tensor size in bytes for the given node
+     * @returns Tensor size in bytes for the given node, tensors of sub-byte elements are packed into 32-bit words
      */
     template <typename TNode>
     static std::size_t GetTensorByteSize(const TNode& node) {
-        return node.get_element_type().size() * std::max(std::size_t(1), shape_size(node.get_shape()));
+        const auto& type = node.get_element_type();
+        const auto size = std::max(std::size_t(1), shape_size(node.get_shape()));
+        if (type.bitwidth() < 8) {
+            constexpr std::size_t word_bits = 32;
+            return (size * type.bitwidth() + word_bits - 1) / word_bits * (word_bits / 8);
+        }
+        return type.size() * size;
     }
 
     /**
@@ -160,6 +276,18 @@ public:
      */
     static bool isReshapeOnlyNode(const ov::Node& node);
 
+    /**
+     * Checks whether the given node is a Pad with zeros, which are appended after the input in memory,
+     * i.e. only the outermost non-trivial axis is padded at its end
+     */
+    static bool isTailPadNode(const ov::Node& node);
+
+    /**
+     * Checks whether outputs of the given node were extracted as views into its input buffer
+     * (e.g. Split along the outermost non-trivial axis). Such node doesn't need to be executed.
+     */
+    bool isViewNode(const ov::Node& node) const;
+
 private:
     /**
      * Internal buffer representation
@@ -173,6 +301,23 @@ private:
         std::size_t size;
     };
 
+    /**
+     * Tensor is identified by the node producing it and the index of the output, so lookups of tensors don't
+     * build strings from names of nodes. Nodes outlive the extractor, since they are owned by the model
+     */
+    struct TensorKey {
+        const ov::Node* node;
+        std::size_t index;
+
+        bool operator==(const TensorKey& other) const { return node == other.node && index == other.index; }
+    };
+
+    struct TensorKeyHash {
+        std::size_t operator()(const TensorKey& key) const {
+            return std::hash<const ov::Node*>{}(key.node) * 31 + key.index;
+        }
+    };
+
     /**
      * Encapsulates mutable tensors extraction for the ov::Parameter node
      * @param node ov::Parameter node from which tensors to be extracted
@@ -192,6 +337,62 @@ private:
      */
     void extractReshapeTensors(const NodePtr& node, int node_idx);
 
+    /**
+     * Encapsulates mutable tensors extraction for the node capable of in-place execution.
+     * Output tensor reuses buffer of the input of the same shape and type,
+     * if the node is the last one which uses the buffer
+     * @param node Node from which tensors to be extracted
+     * @param node_idx Current node index
+     * @returns false if there is no input, which buffer could be reused
+     */
+    bool extractInPlaceTensors(const NodePtr& node, int node_idx, const InPlacePredicate& is_in_place);
+
+    /**
+     * Encapsulates mutable tensors extraction for Split, VariadicSplit and StridedSlice nodes
+     * which outputs are contiguous sub-ranges of the input.
+     * Output tensors become views at offsets within buffer of the input tensor
+     * @param node Node from which tensors to be extracted
+     * @returns false if outputs of the node can't be views into its input
+     */
+    bool extractViewTensors(const NodePtr& node);
+
+    /**
+     * Encapsulates mutable tensors extraction for Pad nodes, which only append zeros to the input
+     * (see isTailPadNode). Buffer of the input is grown to the size of the output, which starts at the input,
+     * so the node only clears the tail of the buffer
+     * @param node Node from which tensors to be extracted
+     * @param node_idx Current node index
+     * @returns false if the node isn't such Pad or the buffer of its input can't be grown
+     */
+    bool extractTailPadTensors(const NodePtr& node, int node_idx);
+
+    /**
+     * Checks whether the output is merged into a bigger buffer by ConcatOptimized, directly or through Reshape
+     */
+    static bool isMergedByConcat(const ov::Output<ov::Node>& output);
+
+    /**
+     * Provides byte offsets of outputs within the input of the node if they are contiguous sub-ranges of it
+     * @param node Split, VariadicSplit or StridedSlice node
+     * @returns std::nullopt if any output isn't a contiguous sub-range of the input
+     */
+    static std::optional<std::vector<std::size_t>> getViewOffsets(const ov::Node& node);
+
+    /**
+     * Extends index of the last node which uses the buffer by uses of the tensor
+     * @param buffer_id Identifier of a buffer the tensor is located in
+     * @param tensor_key Key of the tensor
+     */
+    void updateBufferLastUse(BufferID buffer_id, const TensorKey& tensor_key);
+
+    /**
+     * Encapsulates tensors extraction for the Assign node. Output of the node is its input,
+     * buffer of which isn't reused in place by subsequent nodes, since it may become state of the variable
+     * @param node Assign node from which tensors to be extracted
+     * @param node_idx Current node index
+     */
+    void extractAssignTensors(const NodePtr& node, int node_idx);
+
     /**
      * Encapsulates mutable tensors extraction for the given node
      * @param node ngraph node from which tensors to be extracted
@@ -213,24 +414,40 @@ private:
     void extractImmutableTensors(const NodePtr& node);
 
     /**
-     * Provides internal tensor name
+     * Moves buffers of Parameter/Result nodes out of mutable memory block.
+     * Only buffers which are fully occupied by a single tensor are moved,
+     * e.g. buffers merged by ConcatOptimized into a bigger one stay mutable
+     * @param ordered_nodes Subgraph nodes in execution order
+     */
+    void extractExternalBuffers(gsl::span<const NodePtr> ordered_nodes);
+
+    /**
+     * Allocates state of each variable as an external buffer.
+     * Output of the only ReadValue of the variable becomes the state itself if it isn't read after the state is
+     * written by Assign. Input of the only Assign becomes the state if it is produced after the last read of
+     * ReadValue output. Otherwise ReadValue and Assign copy the state
+     * @param ordered_nodes Subgraph nodes in execution order
+     */
+    void extractVariableBuffers(gsl::span<const NodePtr> ordered_nodes);
+
+    /**
+     * Provides key of the tensor produced by the output
      * @param [in] output Output to process
-     * @returns internal tensor name
+     * @returns key of the tensor
      */
     template <class Node>
-    static inline std::string GetTensorNameInternal(const ov::Output<Node>& output) {
-        return output.get_node()->get_name() + kOutputNumberSeparator + std::to_string(output.get_index());
+    static inline TensorKey GetTensorKey(const ov::Output<Node>& output) {
+        return {output.get_node(), output.get_index()};
     }
 
     /**
-     * Provides internal tensor name
+     * Provides key of the tensor consumed by the input
      * @param [in] input Input to process
-     * @returns internal tensor name
+     * @returns key of the tensor
      */
     template <class Node>
-    static inline std::string GetTensorNameInternal(const ov::Input<Node>& input) {
-        const auto output = input.get_source_output();
-        return output.get_node()->get_name() + kOutputNumberSeparator + std::to_string(output.get_index());
+    static inline TensorKey GetTensorKey(const ov::Input<Node>& input) {
+        return GetTensorKey(input.get_source_output());
     }
 
     /**
@@ -248,6 +465,11 @@ private:
      */
     static bool IsConstantNode(const ov::Node& node);
 
+    /**
+     * Checks whether the given node is an Assign node
+     */
+    static bool IsAssignNode(const ov::Node& node);
+
     /**
      * Checks whether the given node is a ConcatOptimized node (concat optimized)
      */
@@ -264,11 +486,28 @@ private:
     static void ThrowGraphIsBadFormedError(const ov::Input<ov::Node>& input);
 
 private:
+    /**
+     * @returns MemoryModelBuilder filled with mutable buffers
+     */
+    MemoryModelBuilder mutableMemoryModelBuilder() const;
+
     std::unordered_map<BufferID, BufferDesc> mutable_buffers_;
     std::unordered_map<BufferID, size_t> mutable_tensor_sizes_;
     std::unordered_map<BufferID, gsl::span<const Byte>> immutable_buffers_;
     std::unordered_map<BufferID, size_t> immutable_workbuffers_;
-    std::unordered_map<std::string, TensorID::Ptr> tensor_names_;
+    // Index of the node, which owns the immutable work buffer
+    std::unordered_map<BufferID, int> immutable_workbuffer_nodes_;
+    std::unordered_set<BufferID> mutable_workbuffers_;
+    std::vector<ExternalBuffer> external_buffers_;
+    std::unordered_map<TensorKey, TensorID::Ptr, TensorKeyHash> tensor_names_;
+    std::unordered_map<TensorKey, int, TensorKeyHash> tensor_last_uses_;
+    std::unordered_map<BufferID, int> buffer_last_uses_;
+    std::unordered_set<BufferID> parameter_buffers_;
+    std::unordered_set<BufferID> assign_buffers_;
+    std::unordered_map<std::string, TensorID::Ptr> variable_tensors_;
+    std::unordered_set<const ov::Node*> view_nodes_;
+    std::unordered_set<BufferID> gather_table_buffers_;
+    std::unordered_map<BufferID, OffloadedConstant::Placement> offloaded_constants_;
     unsigned next_buffer_id_{};
     const bool is_stable_params_ = false;
     const bool is_stable_results_ = false;
@@ -62,6 +62,26 @@ public:
         static constexpr std::string_view cuTENSOR{"cuTENSOR"};
     };
 
+    /**
+     * Operations which set it to true compute each output element only from input elements at the same position,
+     * so their output could be written in place of an input of the same shape and type
+     * which isn't used by subsequent operations
+     */
+    static constexpr bool kInPlace = false;
+
+    /**
+     * Operations which set it to true start from a copy of their first input and update some of its elements,
+     * so their output could be written in place of the first input of the same shape and type
+     * which isn't used by subsequent operations. The copy is skipped when the buffers are the same
+     */
+    static constexpr bool kInPlaceFirstInput = false;
+
+    /**
+     * Operations which set it to true launch blocks of at most CreationContext::maxThreadsPerBlock() threads,
+     * so that the registry creates them with block sizes tuned by benchmarks (see createWithTunedBlockSize)
+     */
+    static constexpr bool kTunedBlockSize = false;
+
     virtual ~IOperationMeta() = default;
     virtual const std::string_view& GetCategory() const = 0;
     virtual const std::string& GetName() const = 0;
@@ -4,6 +4,8 @@
 
 #include "cuda_operation_registry.hpp"
 
+#include <algorithm>
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -13,7 +15,7 @@ OperationRegistry& OperationRegistry::getInstance() {
 }
 
 void OperationRegistry::registerOp(const std::string& opName, OperationBuilder&& builder) {
-    if (!registered_operations_.try_emplace(opName, move(builder)).second)
+    if (!registered_operations_.try_emplace(intern(opName), move(builder)).second)
         throw std::runtime_error{"Operation " + opName + " is already registered !!"};
 }
 
@@ -22,13 +24,30 @@ bool OperationRegistry::hasOperation(const std::shared_ptr<ov::Node>& node) {
 }
 
 std::optional<std::type_index> OperationRegistry::getOperationType(const std::shared_ptr<ov::Node>& node) const {
-    if (registered_type_operations_.count(node->get_type_info().name) > 0) {
-        return registered_type_operations_.at(node->get_type_info().name);
+    const auto type = registered_type_operations_.find(node->get_type_info().name);
+    if (type != registered_type_operations_.end()) {
+        return type->second;
     }
     return std::nullopt;
 }
 
-bool OperationRegistry::hasOperation(const std::string& name) {
+bool OperationRegistry::isInPlaceOperation(const ov::Node& node, size_t input_idx) const {
+    const std::string_view name = node.get_type_info().name;
+    return in_place_operations_.count(name) > 0 ||
+           (input_idx == 0 && in_place_first_input_operations_.count(name) > 0);
+}
+
+std::vector<std::string> OperationRegistry::getOperationNames() const {
+    std::vector<std::string> names;
+    names.reserve(registered_operations_.size());
+    for (const auto& [name, builder] : registered_operations_) {
+        names.emplace_back(name);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+bool OperationRegistry::hasOperation(const std::string_view name) {
     return registered_operations_.end() != registered_operations_.find(name);
 }
 
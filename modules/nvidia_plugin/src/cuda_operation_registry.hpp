@@ -5,10 +5,15 @@
 #pragma once
 
 #include <functional>
+#include <string>
+#include <string_view>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "cuda_implementation_selection.hpp"
 #include "cuda_operation_base.hpp"
 
 namespace ov {
@@ -59,19 +64,38 @@ public:
                 [](const CreationContext& context,
                    const std::shared_ptr<ov::Node>& node,
                    IndexCollection&& inputs,
-                   IndexCollection&& outputs) {
-                    if constexpr (details::isConstructibleWithNodeOpRef<TOperation>) {
-                        return std::make_shared<TOperation>(
-                            context, downcast<const typename TOperation::NodeOp>(node), move(inputs), move(outputs));
+                   IndexCollection&& outputs) -> OperationBase::Ptr {
+                    if constexpr (TOperation::kTunedBlockSize) {
+                        return createWithTunedBlockSize(context, *node, [&](const CreationContext& tunedContext) {
+                            return create(tunedContext, node, IndexCollection{inputs}, IndexCollection{outputs});
+                        });
                     } else {
-                        if constexpr (details::isConstructibleWithNodeRef<TOperation>) {
-                            return std::make_shared<TOperation>(context, *node, move(inputs), move(outputs));
-                        } else {
-                            return std::make_shared<TOperation>(context, node, move(inputs), move(outputs));
-                        }
+                        return create(context, node, move(inputs), move(outputs));
                     }
                 });
             getInstance().registerOpType<TOperation>(opName);
+            if constexpr (TOperation::kInPlace) {
+                getInstance().registerInPlaceOp(opName);
+            } else if constexpr (TOperation::kInPlaceFirstInput) {
+                getInstance().registerInPlaceFirstInputOp(opName);
+            }
+        }
+
+    private:
+        static OperationBase::Ptr create(const CreationContext& context,
+                                         const std::shared_ptr<ov::Node>& node,
+                                         IndexCollection&& inputs,
+                                         IndexCollection&& outputs) {
+            if constexpr (details::isConstructibleWithNodeOpRef<TOperation>) {
+                return std::make_shared<TOperation>(
+                    context, downcast<const typename TOperation::NodeOp>(node), move(inputs), move(outputs));
+            } else {
+                if constexpr (details::isConstructibleWithNodeRef<TOperation>) {
+                    return std::make_shared<TOperation>(context, *node, move(inputs), move(outputs));
+                } else {
+                    return std::make_shared<TOperation>(context, node, move(inputs), move(outputs));
+                }
+            }
         }
     };
 
@@ -81,6 +105,17 @@ public:
 
     std::optional<std::type_index> getOperationType(const std::shared_ptr<ov::Node>& node) const;
 
+    /**
+     * @returns true if output of the operation created for the node could reuse buffer of its input input_idx
+     * (see IOperationMeta::kInPlace and IOperationMeta::kInPlaceFirstInput)
+     */
+    bool isInPlaceOperation(const ov::Node& node, size_t input_idx) const;
+
+    /**
+     * @returns Sorted names of registered operations
+     */
+    std::vector<std::string> getOperationNames() const;
+
     OperationBase::Ptr createOperation(const CreationContext& context,
                                        const std::shared_ptr<ov::Node>& node,
                                        IndexCollection&& inIds,
@@ -95,23 +130,39 @@ private:
     void registerOp(const std::string& opName, OperationBuilder&& builder);
     template <typename TOperation>
     void registerOpType(const std::string& opName) {
-        if (!registered_type_operations_.try_emplace(opName, std::type_index(typeid(TOperation))).second) {
+        if (!registered_type_operations_.try_emplace(intern(opName), std::type_index(typeid(TOperation))).second) {
             throw std::runtime_error{"Operation " + opName + " is already registered !!"};
         }
     }
 
-    bool hasOperation(const std::string& name);
+    void registerInPlaceOp(const std::string& opName) { in_place_operations_.insert(intern(opName)); }
+    void registerInPlaceFirstInputOp(const std::string& opName) {
+        in_place_first_input_operations_.insert(intern(opName));
+    }
+
+    /**
+     * @returns View of the name owned by the registry, so operations are looked up by type names of nodes
+     *          without building strings
+     */
+    std::string_view intern(const std::string& opName) { return *names_.insert(opName).first; }
+
+    bool hasOperation(std::string_view name);
 
-    std::unordered_map<std::type_index, std::unordered_set<std::string>> type_registered_operations_;
-    std::unordered_map<std::string, OperationBuilder> registered_operations_;
-    std::unordered_map<std::string, std::type_index> registered_type_operations_;
+    std::unordered_set<std::string> names_;
+    std::unordered_map<std::string_view, OperationBuilder> registered_operations_;
+    std::unordered_map<std::string_view, std::type_index> registered_type_operations_;
+    std::unordered_set<std::string_view> in_place_operations_;
+    std::unordered_set<std::string_view> in_place_first_input_operations_;
 };
 
 template <>
 class OperationRegistry::Register<OperationBase> {
 public:
-    explicit Register(const std::string& opName, OperationBuilder&& builder) {
+    explicit Register(const std::string& opName, OperationBuilder&& builder, bool inPlace = false) {
         getInstance().registerOp(opName, move(builder));
+        if (inPlace) {
+            getInstance().registerInPlaceOp(opName);
+        }
     }
 };
 
@@ -140,3 +191,13 @@ public:
     [[maybe_unused]] const ::ov::nvidia_gpu::OperationRegistry::Register<OperationBase> \
         openvino_cuda_op_register_##name{#name, factory};                               \
     }
+
+/**
+ * @macro OPERATION_REGISTER_IN_PLACE_FACTORY
+ * @brief Registers factory which creates only operations capable of in-place execution (see IOperationMeta::kInPlace)
+ */
+#define OPERATION_REGISTER_IN_PLACE_FACTORY(factory, name)                              \
+    extern "C" {                                                                        \
+    [[maybe_unused]] const ::ov::nvidia_gpu::OperationRegistry::Register<OperationBase> \
+        openvino_cuda_op_register_##name{#name, factory, true};                         \
+    }
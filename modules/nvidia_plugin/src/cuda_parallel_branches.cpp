@@ -0,0 +1,231 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_parallel_branches.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <unordered_map>
+
+#include "cuda_inference_request_context.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr auto kNone = std::numeric_limits<std::size_t>::max();
+
+// Event, which forks streams of branches from the compute stream, events recorded after operations follow it
+constexpr std::size_t kForkEvent = 0;
+
+}  // namespace
+
+ParallelBranches::Dependencies ParallelBranches::dependencies(const Sequence& sequence) {
+    Dependencies result(sequence.size());
+    std::unordered_map<BufferID, std::size_t> writers;
+    std::unordered_map<BufferID, std::vector<std::size_t>> readers;
+    std::optional<std::size_t> barrier;
+    std::vector<std::size_t> sinceBarrier;
+    for (std::size_t i = 0; i < sequence.size(); ++i) {
+        auto& deps = result[i];
+        const auto& op = *sequence[i];
+        const auto addDependency = [&](const std::size_t j) {
+            // Inputs of some operations include their own outputs (e.g. PersistentSequenceOp)
+            if (j != i) {
+                deps.push_back(j);
+            }
+        };
+        if (!op.IsCudaGraphCompatible()) {
+            // Operation may synchronize the compute stream, so it follows all the previous ones
+            deps = std::move(sinceBarrier);
+            if (barrier) {
+                deps.push_back(*barrier);
+            }
+            sinceBarrier.clear();
+            barrier = i;
+        } else {
+            if (barrier) {
+                deps.push_back(*barrier);
+            }
+            sinceBarrier.push_back(i);
+        }
+        for (const auto& id : op.GetInputIds()) {
+            const auto buffer = id.GetBuffer().GetId();
+            if (auto writer = writers.find(buffer); writer != writers.end()) {
+                addDependency(writer->second);
+            }
+            readers[buffer].push_back(i);
+        }
+        for (const auto& id : op.GetOutputIds()) {
+            const auto buffer = id.GetBuffer().GetId();
+            if (auto writer = writers.find(buffer); writer != writers.end()) {
+                addDependency(writer->second);
+            }
+            auto& bufferReaders = readers[buffer];
+            for (const auto reader : bufferReaders) {
+                addDependency(reader);
+            }
+            bufferReaders.clear();
+            writers[buffer] = i;
+        }
+        std::sort(deps.begin(), deps.end());
+        deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+    }
+    return result;
+}
+
+std::vector<std::size_t> ParallelBranches::concurrencyEnds(const Dependencies& dependencies) {
+    const auto size = dependencies.size();
+    const auto numWords = (size + 63) / 64;
+    // Bit j of ancestors[i] is set if operation i follows operation j directly or transitively
+    std::vector<std::vector<std::uint64_t>> ancestors(size, std::vector<std::uint64_t>(numWords, 0));
+    for (std::size_t i = 0; i < size; ++i) {
+        auto& bits = ancestors[i];
+        for (const auto j : dependencies[i]) {
+            const auto& inherited = ancestors[j];
+            for (std::size_t w = 0; w < numWords; ++w) {
+                bits[w] |= inherited[w];
+            }
+            bits[j / 64] |= std::uint64_t{1} << (j % 64);
+        }
+    }
+    std::vector<std::size_t> result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        result[i] = i;
+        for (std::size_t j = size - 1; j > i; --j) {
+            if (!(ancestors[j][i / 64] & (std::uint64_t{1} << (i % 64)))) {
+                result[i] = j;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+ParallelBranches::ParallelBranches(const Sequence& sequence, const unsigned maxStreams) : steps_(sequence.size()) {
+    const auto deps = dependencies(sequence);
+    const std::size_t numStreams = std::max(maxStreams, 1u);
+    std::vector<std::size_t> tails(numStreams, kNone);
+    // seen[s][t] is the last operation of stream t, which stream s is synchronized with (vector clock)
+    std::vector<std::vector<std::int64_t>> seen(numStreams, std::vector<std::int64_t>(numStreams, -1));
+    std::vector<std::vector<std::int64_t>> clocks(sequence.size());
+    std::vector<std::vector<std::size_t>> waitedOps(sequence.size());
+    for (std::size_t i = 0; i < sequence.size(); ++i) {
+        std::size_t stream = kNone;
+        if (!sequence[i]->IsCudaGraphCompatible()) {
+            stream = 0;
+        } else {
+            // Operation continues the branch of the latest operation it depends on, if that one is the last
+            // operation of its stream so far
+            for (auto dep = deps[i].rbegin(); dep != deps[i].rend() && stream == kNone; ++dep) {
+                if (tails[steps_[*dep].stream] == *dep) {
+                    stream = steps_[*dep].stream;
+                }
+            }
+            if (stream == kNone && num_streams_ < numStreams && tails[0] != kNone) {
+                stream = num_streams_++;
+            } else if (stream == kNone) {
+                stream = std::min_element(tails.begin(), tails.begin() + num_streams_,
+                                          [](const auto lhs, const auto rhs) {
+                                              return lhs == kNone || (rhs != kNone && lhs < rhs);
+                                          }) -
+                         tails.begin();
+            }
+        }
+        std::vector<std::int64_t> latest(numStreams, -1);
+        for (const auto dep : deps[i]) {
+            const auto depStream = steps_[dep].stream;
+            if (depStream != stream) {
+                latest[depStream] = std::max(latest[depStream], static_cast<std::int64_t>(dep));
+            }
+        }
+        auto& clock = seen[stream];
+        for (std::size_t t = 0; t < numStreams; ++t) {
+            if (latest[t] > clock[t]) {
+                waitedOps[i].push_back(latest[t]);
+                const auto& waited = clocks[latest[t]];
+                std::transform(clock.begin(), clock.end(), waited.begin(), clock.begin(), [](auto lhs, auto rhs) {
+                    return std::max(lhs, rhs);
+                });
+            }
+        }
+        clock[stream] = i;
+        clocks[i] = clock;
+        steps_[i].stream = stream;
+        tails[stream] = i;
+    }
+    std::vector<std::size_t> joinedOps;
+    for (std::size_t t = 1; t < num_streams_; ++t) {
+        if (static_cast<std::int64_t>(tails[t]) > seen[0][t]) {
+            joinedOps.push_back(tails[t]);
+        }
+    }
+    // Events are recorded only after operations, which are waited for by other streams
+    std::map<std::size_t, std::size_t> events;
+    for (const auto& ops : waitedOps) {
+        for (const auto op : ops) {
+            events.emplace(op, 0);
+        }
+    }
+    for (const auto op : joinedOps) {
+        events.emplace(op, 0);
+    }
+    std::size_t nextEvent = kForkEvent + 1;
+    for (auto& [op, event] : events) {
+        event = nextEvent++;
+        steps_[op].record = event;
+    }
+    for (std::size_t i = 0; i < sequence.size(); ++i) {
+        for (const auto op : waitedOps[i]) {
+            steps_[i].waits.push_back(events.at(op));
+        }
+    }
+    for (const auto op : joinedOps) {
+        joins_.push_back(events.at(op));
+    }
+}
+
+std::vector<std::size_t> ParallelBranches::streams() const {
+    std::vector<std::size_t> result;
+    result.reserve(steps_.size());
+    for (const auto& step : steps_) {
+        result.push_back(step.stream);
+    }
+    return result;
+}
+
+void ParallelBranches::launch(InferenceRequestContext& context, const Launch& launch) const {
+    const auto& threadContext = context.getThreadContext();
+    std::deque<InferenceRequestContext> branchContexts;
+    std::vector<InferenceRequestContext*> streamContexts{&context};
+    auto& forkEvent = threadContext.branchEvent(kForkEvent);
+    forkEvent.record(threadContext.stream());
+    for (std::size_t stream = 1; stream < num_streams_; ++stream) {
+        const auto& branch = threadContext.branch(stream - 1);
+        forkEvent.streamWait(branch.stream());
+        streamContexts.push_back(&branchContexts.emplace_back(context, branch, context.getExternalBuffers()));
+    }
+    for (std::size_t i = 0; i < steps_.size(); ++i) {
+        const auto& step = steps_[i];
+        auto& stepContext = *streamContexts[step.stream];
+        const auto& stream = stepContext.getThreadContext().stream();
+        for (const auto event : step.waits) {
+            threadContext.branchEvent(event).streamWait(stream);
+        }
+        launch(stepContext, i);
+        if (step.record) {
+            threadContext.branchEvent(*step.record).record(stream);
+        }
+    }
+    for (const auto event : joins_) {
+        threadContext.branchEvent(event).streamWait(threadContext.stream());
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,83 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "cuda_operation_base.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class InferenceRequestContext;
+
+/**
+ * Schedule of a sequence of operations on several streams (see ov::nvidia_gpu::parallel_branches).
+ * Operations are ordered by the buffers they read and write. An operation continues the stream of one of
+ * the operations it depends on, otherwise it starts a new branch. Streams of branches are forked from
+ * the compute stream of the inference request and joined back to it, so the schedule is captured
+ * into CUDA graphs as well as executed eagerly. Operations, which can't be captured into CUDA graphs,
+ * are executed on the compute stream after all the previous operations
+ */
+class ParallelBranches {
+public:
+    using Sequence = std::vector<OperationBase::Ptr>;
+    using Dependencies = std::vector<std::vector<std::size_t>>;
+    using Launch = std::function<void(InferenceRequestContext& context, std::size_t index)>;
+
+    /**
+     * @param sequence Operations in the order of execution on a single stream
+     * @param maxStreams Maximum number of streams, including the compute stream
+     */
+    ParallelBranches(const Sequence& sequence, unsigned maxStreams);
+
+    /**
+     * @param sequence Operations in the order of execution on a single stream
+     * @returns Ascending indices of operations, which each operation must wait for, because it reads buffers
+     *          they write or writes buffers they read or write
+     */
+    static Dependencies dependencies(const Sequence& sequence);
+
+    /**
+     * @param dependencies Dependencies of operations (see dependencies())
+     * @returns For each operation the index of the last operation, which isn't ordered with it by dependencies,
+     *          so it may be executed concurrently. The index of the operation itself if there is no such one
+     */
+    static std::vector<std::size_t> concurrencyEnds(const Dependencies& dependencies);
+
+    /**
+     * @returns Number of streams the operations are executed on, including the compute stream
+     */
+    std::size_t numStreams() const noexcept { return num_streams_; }
+
+    /**
+     * @returns Stream of each operation, 0 is the compute stream of the inference request
+     */
+    std::vector<std::size_t> streams() const;
+
+    /**
+     * Launches the operations on streams of branch contexts of the thread context (see ThreadContext::branch)
+     * @param context Context of the inference request, whose compute stream the branches are forked from
+     * @param launch Launches the operation with the given index within the context of its stream
+     */
+    void launch(InferenceRequestContext& context, const Launch& launch) const;
+
+private:
+    struct Step {
+        std::size_t stream = 0;
+        std::vector<std::size_t> waits;
+        std::optional<std::size_t> record;
+    };
+
+    std::vector<Step> steps_;
+    std::vector<std::size_t> joins_;
+    std::size_t num_streams_ = 1;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
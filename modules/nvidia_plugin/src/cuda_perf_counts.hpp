@@ -4,14 +4,78 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <mutex>
 #include <string>
+#include <vector>
+
+#include "utils/latency_histogram.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
 static const char PERF_COUNTER_NAME[] = "nvidia_perf_counter";
 
+// Keys of the roofline of operations in rt_info of the runtime model
+static const char ESTIMATED_FLOPS[] = "estimatedFlops";
+static const char ESTIMATED_BYTES[] = "estimatedBytes";
+static const char ARITHMETIC_INTENSITY[] = "arithmeticIntensity";
+static const char ROOFLINE_BOUND[] = "rooflineBound";
+static const char PEAK_FRACTION[] = "peakFraction";
+
+/**
+ * Hardware metric of kernels of operations collected by CUPTI (see ov::nvidia_gpu::hardware_counters)
+ */
+struct HardwareMetric {
+    // Key in rt_info of the runtime model
+    const char* name;
+    const char* cupti_name;
+};
+
+// Percents of the peak, the order is the order of values of ov::nvidia_gpu::hardware_metrics
+static constexpr std::array<HardwareMetric, 4> HARDWARE_METRICS{{
+    {"achievedOccupancy", "sm__warps_active.avg.pct_of_peak_sustained_active"},
+    {"dramThroughput", "dram__throughput.avg.pct_of_peak_sustained_elapsed"},
+    {"l2HitRate", "lts__t_sector_hit_rate.pct"},
+    {"tensorCoreUtilization", "sm__pipe_tensor_cycles_active.avg.pct_of_peak_sustained_active"},
+}};
+
+/**
+ * Averages of hardware metrics of executions of an operation weighted by device time of its kernels,
+ * which are accumulated concurrently by infer requests of the same compiled model
+ */
+class HardwareMetricsAverages {
+public:
+    void add(const std::vector<double>& weighted_sums, double weight) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        sums_.resize(weighted_sums.size());
+        for (size_t i = 0; i < weighted_sums.size(); ++i) {
+            sums_[i] += weighted_sums[i];
+        }
+        weight_ += weight;
+    }
+
+    /**
+     * @returns Averages in the order of HARDWARE_METRICS, empty if nothing is collected
+     */
+    std::vector<double> averages() const {
+        std::lock_guard<std::mutex> lock{mutex_};
+        std::vector<double> averages;
+        if (weight_ > 0) {
+            for (const auto sum : sums_) {
+                averages.push_back(sum / weight_);
+            }
+        }
+        return averages;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<double> sums_;
+    double weight_ = 0;
+};
+
 enum class PerfStages { Preprocess, Postprocess, StartPipeline, WaitPipeline, NumOfStages };
 
 struct PerfCounts {
@@ -19,6 +83,13 @@ struct PerfCounts {
     uint32_t num;
     std::string impl_type;
     std::string runtime_precision;
+    // Latencies of the operation in each inference, which show spikes hidden by average()
+    utils::LatencyHistogram latency;
+    // Floating point operations and bytes of inputs and outputs of an execution estimated from shapes,
+    // which place the operation on the roofline of the device
+    double flops = 0;
+    double bytes = 0;
+    HardwareMetricsAverages hardware_metrics;
 
     PerfCounts() : total_duration{0}, num(0) {}
 
@@ -0,0 +1,255 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_pipeline_stages.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+std::size_t byte_size(const ov::Output<ov::Node>& output) {
+    return (ov::shape_size(output.get_shape()) * output.get_element_type().bitwidth() + 7) / 8;
+}
+
+bool is_compute_op(const ov::Node* node) {
+    return !ov::is_type<ov::op::v0::Parameter>(node) && !ov::is_type<ov::op::v0::Constant>(node) &&
+           !ov::is_type<ov::op::v0::Result>(node);
+}
+
+/**
+ * Finds positions of compute operations the stages start from
+ */
+std::vector<std::size_t> find_cut_points(const std::vector<ov::Node*>& ops,
+                                         const std::unordered_map<const ov::Node*, std::size_t>& positions,
+                                         std::size_t num_stages) {
+    const auto num_ops = ops.size();
+    // Size of constants and activations of the operation
+    std::vector<std::size_t> cumulative_weights(num_ops + 1, 0);
+    // Size of activations which are produced before the cut and are consumed after it
+    std::vector<std::ptrdiff_t> crossing_bytes(num_ops + 1, 0);
+    for (std::size_t i = 0; i < num_ops; ++i) {
+        std::size_t weight = 0;
+        for (const auto& input : ops[i]->inputs()) {
+            const auto source = input.get_source_output();
+            if (ov::is_type<ov::op::v0::Constant>(source.get_node())) {
+                weight += byte_size(source);
+            }
+        }
+        for (const auto& output : ops[i]->outputs()) {
+            const auto bytes = byte_size(output);
+            weight += bytes;
+            std::size_t last_consumer = i;
+            for (const auto& target : output.get_target_inputs()) {
+                if (auto it = positions.find(target.get_node()); it != positions.end()) {
+                    last_consumer = std::max(last_consumer, it->second);
+                }
+            }
+            if (last_consumer > i) {
+                crossing_bytes[i + 1] += static_cast<std::ptrdiff_t>(bytes);
+                crossing_bytes[last_consumer + 1] -= static_cast<std::ptrdiff_t>(bytes);
+            }
+        }
+        cumulative_weights[i + 1] = cumulative_weights[i] + weight;
+    }
+    for (std::size_t i = 1; i <= num_ops; ++i) {
+        crossing_bytes[i] += crossing_bytes[i - 1];
+    }
+
+    const auto total_weight = cumulative_weights.back();
+    const auto tolerance = total_weight / (4 * num_stages);
+    std::vector<std::size_t> cut_points;
+    std::size_t first = 1;
+    for (std::size_t k = 1; k < num_stages; ++k) {
+        const auto target = total_weight / num_stages * k;
+        // Every following stage keeps at least one operation
+        const auto last = num_ops - (num_stages - k);
+        auto distance = [&](std::size_t p) {
+            const auto weight = cumulative_weights[p];
+            return weight > target ? weight - target : target - weight;
+        };
+        auto best = first;
+        for (auto p = first; p <= last; ++p) {
+            const auto in_window = distance(p) <= tolerance;
+            const auto best_in_window = distance(best) <= tolerance;
+            if (in_window && best_in_window) {
+                if (crossing_bytes[p] < crossing_bytes[best] ||
+                    (crossing_bytes[p] == crossing_bytes[best] && distance(p) < distance(best))) {
+                    best = p;
+                }
+            } else if (in_window || (!best_in_window && distance(p) < distance(best))) {
+                best = p;
+            }
+        }
+        cut_points.push_back(best);
+        first = best + 1;
+    }
+    return cut_points;
+}
+
+}  // namespace
+
+PipelineStages::Partition PipelineStages::split(const std::shared_ptr<const ov::Model>& model,
+                                                std::size_t num_stages) {
+    OPENVINO_ASSERT(num_stages > 0, "Model should be split into at least one stage");
+    OPENVINO_ASSERT(!model->is_dynamic(), "Only static models can be split into pipeline stages");
+    OPENVINO_ASSERT(model->get_sinks().empty(), "Models with state can't be split into pipeline stages");
+
+    std::vector<ov::Node*> ops;
+    std::unordered_map<const ov::Node*, std::size_t> positions;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (is_compute_op(op.get())) {
+            positions.emplace(op.get(), ops.size());
+            ops.push_back(op.get());
+        }
+    }
+    OPENVINO_ASSERT(ops.size() >= num_stages,
+                    "Model with ",
+                    ops.size(),
+                    " operations can't be split into ",
+                    num_stages,
+                    " stages");
+
+    const auto cut_points = find_cut_points(ops, positions, num_stages);
+    std::unordered_map<const ov::Node*, std::size_t> stage_of;
+    for (std::size_t i = 0; i < ops.size(); ++i) {
+        stage_of.emplace(ops[i], std::upper_bound(cut_points.begin(), cut_points.end(), i) - cut_points.begin());
+    }
+    // Results stay in the stage of the producer, results of parameters or constants are in the first stage
+    auto result_stage = [&stage_of](const ov::op::v0::Result& result) -> std::size_t {
+        const auto it = stage_of.find(result.get_input_node_ptr(0));
+        return it != stage_of.end() ? it->second : 0;
+    };
+
+    Partition partition;
+    partition.stages.resize(num_stages);
+    partition.outputs.resize(model->get_results().size());
+    std::vector<ov::ResultVector> results(num_stages);
+    std::vector<std::map<ov::Output<ov::Node>, std::size_t>> exported(num_stages);
+    std::vector<std::unordered_map<ov::Node*, std::shared_ptr<ov::Node>>> node_maps(num_stages);
+    std::vector<std::shared_ptr<ov::Model>> clones(num_stages);
+    for (std::size_t s = 0; s < num_stages; ++s) {
+        // Every stage is cut out of its own copy of the model
+        clones[s] = ov::clone_ov_model(*model, node_maps[s]);
+    }
+    for (std::size_t i = 0; i < model->get_results().size(); ++i) {
+        const auto& result = model->get_results()[i];
+        const auto s = result_stage(*result);
+        partition.outputs[i] = Source{s, results[s].size()};
+        results[s].push_back(ov::as_type_ptr<ov::op::v0::Result>(node_maps[s].at(result.get())));
+    }
+    // Activations consumed by the following stages become additional outputs of the producing stage
+    for (const auto* op : ops) {
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            const auto it = stage_of.find(source.get_node());
+            if (it == stage_of.end() || it->second == stage_of.at(op)) {
+                continue;
+            }
+            const auto s = it->second;
+            if (exported[s].emplace(source, results[s].size()).second) {
+                const auto& clone = node_maps[s].at(source.get_node());
+                results[s].push_back(std::make_shared<ov::op::v0::Result>(clone->output(source.get_index())));
+            }
+        }
+    }
+
+    for (std::size_t s = 0; s < num_stages; ++s) {
+        auto& stage = partition.stages[s];
+        ov::ParameterVector parameters;
+        std::map<ov::Output<ov::Node>, std::shared_ptr<ov::op::v0::Parameter>> stage_parameters;
+        auto rewire = [&](ov::Node* node) {
+            for (const auto& input : node->inputs()) {
+                const auto source = input.get_source_output();
+                auto* source_node = source.get_node();
+                if (ov::is_type<ov::op::v0::Constant>(source_node)) {
+                    continue;
+                }
+                const auto producer = stage_of.find(source_node);
+                if (producer != stage_of.end() && producer->second == s) {
+                    continue;
+                }
+                auto& parameter = stage_parameters[source];
+                if (!parameter) {
+                    parameter =
+                        std::make_shared<ov::op::v0::Parameter>(source.get_element_type(), source.get_partial_shape());
+                    parameters.push_back(parameter);
+                    if (producer != stage_of.end()) {
+                        stage.inputs.push_back(Source{producer->second, exported[producer->second].at(source)});
+                    } else {
+                        const auto model_parameter =
+                            ov::as_type_ptr<ov::op::v0::Parameter>(source_node->shared_from_this());
+                        stage.inputs.push_back(
+                            Source{std::nullopt, static_cast<std::size_t>(model->get_parameter_index(model_parameter))});
+                    }
+                }
+                node_maps[s].at(node)->input(input.get_index()).replace_source_output(parameter);
+            }
+        };
+        for (auto* op : ops) {
+            if (stage_of.at(op) == s) {
+                rewire(op);
+            }
+        }
+        for (const auto& result : model->get_results()) {
+            if (result_stage(*result) == s) {
+                rewire(result.get());
+            }
+        }
+        stage.model = std::make_shared<ov::Model>(
+            results[s], parameters, model->get_friendly_name() + "_stage" + std::to_string(s));
+    }
+    return partition;
+}
+
+PipelineStages::PipelineStages(Partition partition,
+                               std::vector<std::shared_ptr<const ov::ICompiledModel>> stages,
+                               std::vector<std::shared_ptr<RemoteContextImpl>> contexts)
+    : outputs_{std::move(partition.outputs)}, stages_{std::move(stages)}, contexts_{std::move(contexts)} {
+    OPENVINO_ASSERT(partition.stages.size() == stages_.size() && contexts_.size() == stages_.size(),
+                    "Every pipeline stage should be compiled for its own device");
+    for (auto& stage : partition.stages) {
+        inputs_.push_back(std::move(stage.inputs));
+    }
+}
+
+const std::shared_ptr<const ov::ICompiledModel>& PipelineStages::get_stage(std::size_t index) const {
+    return stages_.at(index);
+}
+
+const std::vector<PipelineStages::Source>& PipelineStages::get_stage_inputs(std::size_t index) const {
+    return inputs_.at(index);
+}
+
+const std::vector<PipelineStages::Source>& PipelineStages::get_outputs() const { return outputs_; }
+
+std::size_t PipelineStages::size() const { return stages_.size(); }
+
+ov::SoPtr<ov::ITensor> PipelineStages::create_transfer_tensor(std::size_t stage, std::size_t output) const {
+    const auto& port = stages_.at(stage)->outputs().at(output);
+    return contexts_.at(stage)->create_tensor(port.get_element_type(), port.get_shape());
+}
+
+unsigned PipelineStages::get_optimal_number_of_infer_requests() const {
+    auto value = std::numeric_limits<unsigned>::max();
+    for (const auto& stage : stages_) {
+        value = std::min(value, stage->get_property(ov::optimal_number_of_infer_requests.name()).as<unsigned>());
+    }
+    return value;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,93 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "cuda_remote_context.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Model split into consecutive pipeline stages, each compiled for its own device.
+ *
+ * Every stage owns constants and memory pool of its part of the model only, so the model which doesn't fit
+ * a single device could be served by several ones. Activations crossing the stage boundary are written by
+ * the producing stage into its device memory and are read by the consuming stage peer-to-peer.
+ */
+class PipelineStages {
+public:
+    /**
+     * @brief Source of the stage input or of the model output
+     */
+    struct Source {
+        /// Index of the producing stage, std::nullopt for the input of the whole model
+        std::optional<std::size_t> stage;
+        /// Index of the output of the producing stage or of the input of the whole model
+        std::size_t index;
+
+        bool operator==(const Source& other) const { return stage == other.stage && index == other.index; }
+    };
+
+    struct Stage {
+        std::shared_ptr<ov::Model> model;
+        std::vector<Source> inputs;
+    };
+
+    struct Partition {
+        std::vector<Stage> stages;
+        std::vector<Source> outputs;
+    };
+
+    /**
+     * Splits operations of the model in topological order into stages with balanced size of constants and
+     * activations. Each cut is placed where the minimal number of bytes crosses the boundary.
+     * @param model Static model to split
+     * @param num_stages Number of stages
+     * @return Models of stages and mapping of their inputs/outputs
+     */
+    static Partition split(const std::shared_ptr<const ov::Model>& model, std::size_t num_stages);
+
+    /**
+     * @param partition Partition of the model
+     * @param stages Models of the partition compiled for devices of the stages
+     * @param contexts Remote contexts of devices of the stages
+     */
+    PipelineStages(Partition partition,
+                   std::vector<std::shared_ptr<const ov::ICompiledModel>> stages,
+                   std::vector<std::shared_ptr<RemoteContextImpl>> contexts);
+
+    const std::shared_ptr<const ov::ICompiledModel>& get_stage(std::size_t index) const;
+
+    const std::vector<Source>& get_stage_inputs(std::size_t index) const;
+
+    const std::vector<Source>& get_outputs() const;
+
+    std::size_t size() const;
+
+    /**
+     * @returns Device tensor of the stage output which is consumed by the following stages
+     */
+    ov::SoPtr<ov::ITensor> create_transfer_tensor(std::size_t stage, std::size_t output) const;
+
+    /**
+     * @returns Minimal optimal number of infer requests of stages, every inference occupies all of them
+     */
+    unsigned get_optimal_number_of_infer_requests() const;
+
+private:
+    std::vector<std::vector<Source>> inputs_;
+    std::vector<Source> outputs_;
+    std::vector<std::shared_ptr<const ov::ICompiledModel>> stages_;
+    std::vector<std::shared_ptr<RemoteContextImpl>> contexts_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -3,9 +3,14 @@
 //
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
 #include "ie_metric_helpers.hpp"
 
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "cuda/green_context.hpp"
 #include "cuda/props.hpp"
 #include "cuda_compiled_model.hpp"
 #include "cuda_infer_request.hpp"
@@ -19,28 +24,85 @@
 #include "openvino/runtime/properties.hpp"
 #include "threading/ie_executor_manager.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
+#include "utils/cost_partition.hpp"
 
 using namespace ov::nvidia_gpu;
 
+namespace {
+
+/**
+ * Reads weights of the exported model into page-locked memory, so that constants referencing them are uploaded
+ * to the device by DMA without staging copies (see ConstantsUpload); falls back to pageable memory if
+ * page-locked memory of the size can't be allocated. The memory is placed on the NUMA node of the device
+ */
+ov::Tensor read_weights(std::istream& model_stream, const size_t size, const CUDA::Device& device) {
+    const ov::Shape shape{static_cast<ov::Shape::size_type>(size)};
+    ov::Tensor weights;
+    try {
+        weights = ov::Tensor(ov::element::from<char>(),
+                             shape,
+                             ov::Allocator{CUDA::PinnedHostAllocator{CUDA::NumaNode::of(device)}});
+    } catch (const ov::Exception&) {
+        weights = ov::Tensor(ov::element::from<char>(), shape);
+    }
+    // Stream buffer is read directly, so the weights aren't copied through buffers of the stream
+    auto* const data = weights.data<char>();
+    size_t read = 0;
+    while (read < size) {
+        const auto count = model_stream.rdbuf()->sgetn(data + read, size - read);
+        OPENVINO_ASSERT(count > 0, "Unexpected end of the exported model");
+        read += static_cast<size_t>(count);
+    }
+    return weights;
+}
+
+}  // namespace
+
 Plugin::Plugin() {
     set_device_name("NVIDIA");
     for (int i = 0; i < CUDA::Device::count(); ++i) {
         CUDA::Device device{i};
         const size_t num_concurrent_streams = max_concurrent_streams(device);
         device_thread_pool_[std::to_string(i)] = std::make_shared<CudaThreadPool>(device, num_concurrent_streams);
+        default_contexts_[std::to_string(i)] =
+            std::make_shared<RemoteContextImpl>(get_device_name() + "." + std::to_string(i), i);
         configs_.insert({std::to_string(i),
             Configuration({ov::device::id(i),
                             ov::hint::inference_precision(isHalfSupported(device) ? ov::element::f16 : ov::element::f32)})});
+        // Device memory of all models compiled for the device is allocated from the same stream-ordered pool
+        auto memory_pool = std::make_shared<CUDA::DeviceMemoryPool>(
+            i, configs_.at(std::to_string(i)).get_memory_pool_release_threshold());
+        CUDA::DeviceMemoryPool::registerPool(memory_pool);
+        memory_pools_[std::to_string(i)] = std::move(memory_pool);
     }
 }
 
 Plugin::~Plugin() {
 }
 
+void Plugin::update_memory_pool(const Configuration& config) const {
+    auto memory_pool = memory_pools_.find(std::to_string(config.get_device_id()));
+    if (memory_pool != memory_pools_.end()) {
+        memory_pool->second->setReleaseThreshold(config.get_memory_pool_release_threshold());
+    }
+}
+
 std::shared_ptr<ov::threading::ITaskExecutor> Plugin::get_stream_executor(const Configuration& config) const {
     auto device_id = std::to_string(config.get_device_id());
     OPENVINO_ASSERT(device_thread_pool_.count(device_id), "Couldn't find config for NVIDIA with id ", device_id);
-    return device_thread_pool_.at(device_id);
+    if (config.get_sm_fraction() >= 1.0f) {
+        return device_thread_pool_.at(device_id);
+    }
+    CUDA::Device device{config.get_device_id()};
+    const auto num_sms = static_cast<unsigned>(device.props().multiProcessorCount);
+    const auto sm_count = std::max(1u, static_cast<unsigned>(std::ceil(config.get_sm_fraction() * num_sms)));
+    std::lock_guard<std::mutex> lock{partition_thread_pools_mutex_};
+    auto& thread_pool = partition_thread_pools_[fmt::format("{}:{}", device_id, sm_count)];
+    if (!thread_pool) {
+        thread_pool = std::make_shared<CudaThreadPool>(
+            device, max_concurrent_streams(device), CUDA::GreenContext::reserve(device, sm_count));
+    }
+    return thread_pool;
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -51,11 +113,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
 Configuration Plugin::get_full_config(const ov::AnyMap& properties, const bool throw_on_unsupported) const {
     std::string device_id = default_device_id;
     if (properties.find(ov::device::id.name()) != properties.end()) {
-        device_id = properties.find(ov::device::id.name())->second.as<std::string>();
-        auto pos = device_id.find_last_of("NVIDIA.");
-        if (pos != std::string::npos) {
-            device_id = device_id.substr(pos + 1);
-        }
+        device_id = std::to_string(
+            Configuration::parse_device_id(properties.find(ov::device::id.name())->second.as<std::string>()));
     }
     OPENVINO_ASSERT(configs_.find(device_id) != configs_.end(), "Couldn't find config for NVIDIA with id ", device_id);
     return Configuration{properties, configs_.at(device_id), throw_on_unsupported};
@@ -67,11 +126,21 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "Plugin::compile_model");
 
     auto full_config = get_full_config(properties);
+    if (context) {
+        // Model is compiled for the device of the remote context regardless of ov::device::id in properties
+        auto remote_context = std::dynamic_pointer_cast<RemoteContextImpl>(context._ptr);
+        OPENVINO_ASSERT(remote_context, "NVIDIA plugin can't compile model with remote context of other plugin");
+        auto properties_with_device = properties;
+        properties_with_device[ov::device::id.name()] = std::to_string(remote_context->get_device_id());
+        full_config = get_full_config(properties_with_device);
+    }
     CUDA::Device device{full_config.get_device_id()};
+    update_memory_pool(full_config);
 
     // Create stream executor for given device
     auto wait_executor = get_stream_executor(full_config);
-    auto compiled_model = std::make_shared<CompiledModel>(model->clone(),
+    // Model is cloned by the compiled model itself, so it isn't cloned here once more
+    auto compiled_model = std::make_shared<CompiledModel>(model,
                                                           full_config,
                                                           wait_executor,
                                                           shared_from_this());
@@ -88,6 +157,27 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& model_str
                                                          const ov::AnyMap& properties) const {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "ov::nvidia_gpu::import_model");
 
+    auto full_config = get_full_config(properties);
+    const CUDA::Device device{full_config.get_device_id()};
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    std::int32_t compute_capability[] = {0, 0};
+    model_stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    model_stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    model_stream.read(reinterpret_cast<char*>(compute_capability), sizeof(compute_capability));
+    OPENVINO_ASSERT(model_stream && magic == CompiledModel::export_magic && version == CompiledModel::export_version,
+                    "Model was exported by another version of NVIDIA plugin");
+    const auto props = device.props();
+    OPENVINO_ASSERT(compute_capability[0] == props.major && compute_capability[1] == props.minor,
+                    "Model was exported for device with compute capability ",
+                    compute_capability[0],
+                    ".",
+                    compute_capability[1],
+                    ", but the device has ",
+                    props.major,
+                    ".",
+                    props.minor);
+
     // Read XML content
     std::string xml_string;
     std::uint64_t data_size = 0;
@@ -99,19 +189,26 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& model_str
     ov::Tensor weights;
     model_stream.read(reinterpret_cast<char*>(&data_size), sizeof(data_size));
     if (0 != data_size) {
-        weights = ov::Tensor(ov::element::from<char>(), ov::Shape{static_cast<ov::Shape::size_type>(data_size)});
-        model_stream.read(weights.data<char>(), data_size);
+        weights = read_weights(model_stream, data_size, device);
     }
 
+    // Read algorithms of operations selected by benchmarks on export
+    model_stream.read(reinterpret_cast<char*>(&data_size), sizeof(data_size));
+    std::string tuning_string(data_size, '\0');
+    model_stream.read(tuning_string.data(), data_size);
+    auto tuning_cache = TuningCache::createForModel(full_config.get_cache_dir(), device);
+    std::istringstream tuning_stream{tuning_string};
+    tuning_cache->read(tuning_stream);
+
     auto model = get_core()->read_model(xml_string, weights);
 
-    auto full_config = get_full_config(properties);
     auto wait_executor = get_stream_executor(full_config);
     auto compiled_model= std::make_shared<CompiledModel>(model,
                                                          full_config,
                                                          wait_executor,
                                                          shared_from_this(),
-                                                         true);
+                                                         true,
+                                                         std::move(tuning_cache));
     return compiled_model;
 }
 
@@ -128,6 +225,11 @@ ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>&
     [&](const std::shared_ptr<ov::Node>& op) {
         return is_operation_supported(op, full_config);
     });
+    if (full_config.is_cost_aware_query_enabled()) {
+        // Operations which are cheaper on CPU including transfers across the boundary are left to other devices
+        const utils::PartitionCosts costs{CUDA::Device{full_config.get_device_id()}.props()};
+        supported = utils::partitionByCost(*model, supported, costs);
+    }
 
     ov::SupportedOpsMap res;
     for (auto&& op_name : supported) {
@@ -136,14 +238,29 @@ ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>&
     return res;
 }
 
+std::shared_ptr<RemoteContextImpl> Plugin::get_context_impl(const ov::AnyMap& properties) const {
+    std::string device_id = default_device_id;
+    for (auto&& [key, value] : properties) {
+        if (ov::device::id == key) {
+            device_id = std::to_string(Configuration::parse_device_id(value.as<std::string>()));
+        } else {
+            OPENVINO_THROW("Not supported remote context parameter: ", key);
+        }
+    }
+    auto context = default_contexts_.find(device_id);
+    OPENVINO_ASSERT(context != default_contexts_.end(), "Couldn't find NVIDIA device with id ", device_id);
+    return context->second;
+}
+
 ov::SoPtr<ov::IRemoteContext> Plugin::create_context(
     const ov::AnyMap& remote_properties) const {
-    OPENVINO_NOT_IMPLEMENTED;
+    const auto& context = get_context_impl(remote_properties);
+    return {std::make_shared<RemoteContextImpl>(context->get_device_name(), context->get_device_id()), nullptr};
 }
 
 ov::SoPtr<ov::IRemoteContext> Plugin::get_default_context(
     const ov::AnyMap& remote_properties) const {
-    OPENVINO_NOT_IMPLEMENTED;
+    return {get_context_impl(remote_properties), nullptr};
 }
 
 bool Plugin::is_operation_supported(const std::shared_ptr<ov::Node>& node, const Configuration& config) const {
@@ -176,13 +293,15 @@ void Plugin::set_property(const ov::AnyMap& properties) {
         config = Configuration{config_properties, config};
     };
     if (has_property_value(ov::internal::config_device_id.name())) {
-        std::string device_id = get_property_value(ov::internal::config_device_id.name());
+        std::string device_id =
+            std::to_string(Configuration::parse_device_id(get_property_value(ov::internal::config_device_id.name())));
         auto properties_for_device = properties;
         properties_for_device.erase(ov::internal::config_device_id.name());
         update_config(properties_for_device, configs_.at(device_id));
     } else {
         if (has_property_value(ov::device::id.name())) {
-            default_device_id = get_property_value(ov::device::id.name());
+            const auto device_id = Configuration::parse_device_id(get_property_value(ov::device::id.name()));
+            default_device_id = std::to_string(device_id);
             update_config(properties, configs_.at(default_device_id));
         } else {
             for (auto& conf : configs_) {
@@ -190,6 +309,9 @@ void Plugin::set_property(const ov::AnyMap& properties) {
             }
         }
     }
+    for (const auto& conf : configs_) {
+        update_memory_pool(conf.second);
+    }
 }
 
 ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& properties) const {
@@ -225,9 +347,12 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& properti
     } else if (ov::internal::caching_properties == name) {
         return decltype(ov::internal::caching_properties)::value_type{Configuration::get_caching_properties()};
     } else if (ov::available_devices == name) {
+        // MIG instances are listed by UUID, so a device name (e.g. NVIDIA.MIG-<uuid>) selects the same instance
+        // regardless of the order of instances in CUDA_VISIBLE_DEVICES
         std::vector<std::string> available_devices = {};
-        for (size_t i = 0; i < CUDA::Device::count(); ++i) {
-            available_devices.push_back(std::to_string(i));
+        for (int i = 0; i < CUDA::Device::count(); ++i) {
+            const CUDA::Device device{i};
+            available_devices.push_back(device.isMigInstance() ? device.uuid() : std::to_string(i));
         }
         return decltype(ov::available_devices)::value_type{available_devices};
     } else if (ov::device::uuid == name) {
@@ -252,10 +377,12 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& properti
         ss << "." << props.minor;
         return decltype(ov::device::architecture)::value_type{ss.str()};
     } else if (ov::device::capabilities == name) {
-        return decltype(ov::device::capabilities)::value_type{{
-            ov::device::capability::EXPORT_IMPORT,
-            ov::device::capability::FP32,
-            ov::device::capability::FP16}};
+        std::vector<std::string> capabilities = {
+            ov::device::capability::EXPORT_IMPORT, ov::device::capability::FP32, ov::device::capability::FP16};
+        if (isBf16Supported(CUDA::Device{full_config.get_device_id()})) {
+            capabilities.push_back(ov::device::capability::BF16);
+        }
+        return decltype(ov::device::capabilities)::value_type{capabilities};
     } else if (METRIC_KEY(OPTIMIZATION_CAPABILITIES) == name) {
         std::vector<std::string> capabilities = {METRIC_VALUE(FP32)};
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "cuda_compiled_model.hpp"
 #include "cuda_config.hpp"
+#include "cuda_remote_context.hpp"
 #include "cuda_thread_pool.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/iplugin.hpp"
@@ -54,7 +57,7 @@ private:
     enum class cuda_attribute { name };
 
     /**
-     * Gets CudaThreadPool
+     * Gets CudaThreadPool, the pool of the partition of SMs is created by the first model reserving it
      * @param config Configuration used for CudaThreadPool selection
      * @return CudaThreadPool
      */
@@ -69,10 +72,28 @@ private:
 
     Configuration get_full_config(const ov::AnyMap& properties, const bool throw_on_unsupported = true) const;
 
+    /**
+     * Gets remote context of the device specified by ov::device::id in properties or of the default device
+     * @param properties Properties with optional ov::device::id
+     * @return Remote context
+     */
+    std::shared_ptr<RemoteContextImpl> get_context_impl(const ov::AnyMap& properties) const;
+
+    /**
+     * Applies release threshold of the configuration to the memory pool of its device
+     * @param config Configuration of the device
+     */
+    void update_memory_pool(const Configuration& config) const;
+
     GraphTransformer transformer_{};
     std::string default_device_id = "0";
     std::map<std::string, Configuration> configs_;
     std::unordered_map<std::string, std::shared_ptr<CudaThreadPool>> device_thread_pool_;
+    // Thread pools of partitions of SMs (see ov::nvidia_gpu::sm_fraction) by device ID and number of SMs
+    mutable std::mutex partition_thread_pools_mutex_;
+    mutable std::unordered_map<std::string, std::shared_ptr<CudaThreadPool>> partition_thread_pools_;
+    std::unordered_map<std::string, std::shared_ptr<RemoteContextImpl>> default_contexts_;
+    std::unordered_map<std::string, std::shared_ptr<CUDA::DeviceMemoryPool>> memory_pools_;
 };
 
 }  // namespace nvidia_gpu
@@ -4,9 +4,15 @@
 
 #include "cuda_profiler.hpp"
 
+#include <ops/if.hpp>
+#include <ops/loop.hpp>
 #include <ops/parameter.hpp>
 #include <ops/result.hpp>
 
+#ifdef ENABLE_CUPTI_METRICS
+#include "cuda/cupti.hpp"
+#endif
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -34,7 +40,12 @@ std::pair<std::string, ov::ProfilingInfo> make_profile_info(std::string stage_na
 }
 }  // namespace
 
-Profiler::Profiler(const SubGraph& graph) {
+Profiler::Profiler(const SubGraph& graph,
+                   const bool nvtxRanges,
+                   std::shared_ptr<utils::LatencyHistograms> stageLatencies,
+                   std::shared_ptr<ChromeTrace> trace,
+                   const std::optional<int> hardwareCountersDevice)
+    : nvtx_ranges_{nvtxRanges}, stage_latencies_{std::move(stageLatencies)}, trace_{std::move(trace)} {
     std::vector<OperationBase::Ptr> execSequence;
     collect_subgraphs(graph, execSequence);
 
@@ -43,8 +54,24 @@ Profiler::Profiler(const SubGraph& graph) {
         perf_counters_.emplace(make_profile_info(op));
         execution_order_.push_back(op.GetName());
     }
+#ifdef ENABLE_CUPTI_METRICS
+    if (hardwareCountersDevice) {
+        // Device time of kernels weights their metrics in averages of operations
+        std::vector<std::string> metrics{"gpu__time_duration.sum"};
+        for (const auto& metric : HARDWARE_METRICS) {
+            metrics.emplace_back(metric.cupti_name);
+        }
+        // Operations launch a few kernels each, TensorIterator launches kernels of its body per iteration
+        const auto maxRanges = std::max<size_t>(1024, 8 * execSequence.size());
+        metrics_profiler_ = std::make_unique<CUDA::MetricsProfiler>(*hardwareCountersDevice, metrics, maxRanges);
+    }
+#else
+    OPENVINO_ASSERT(!hardwareCountersDevice, "Hardware counters require NVIDIA plugin built with CUPTI metrics");
+#endif
 }
 
+Profiler::~Profiler() = default;
+
 void Profiler::process_events() {
     if (infer_count_ == 0) return;
     auto ms_to_us = [](float timing) {
@@ -54,18 +81,29 @@ void Profiler::process_events() {
         return ms_to_us(timing / infer_count_);
     };
     std::map<std::string, float> layer_timing{};
+    // Time of the last inference, which is recorded into latency histograms
+    std::map<std::string, float> layer_last_timing{};
     for (auto& timing_map : subgraph_perf_steps_map_) {
         auto graph = static_cast<const ov::nvidia_gpu::SubGraph*>(timing_map.first);
         OPENVINO_ASSERT(graph, "Performance counter graph is empty");
         auto& timings = timing_map.second;
         for (auto& timing : timings) {
+            if (!timing.executed()) {
+                continue;
+            }
+            if (trace_) {
+                timing.trace(*trace_, exec_timing_, exec_start_host_, trace_tags_);
+            }
+            const auto previous_duration = timing.duration();
             timing.measure();
+            const auto last_duration = timing.duration() - previous_duration;
             const auto perf = perf_counters_.find(timing.get_op_name());
             if (perf != perf_counters_.cend()) {
                 perf->second.real_time = time_per_infer_us(timing.duration());
                 perf->second.status = ov::ProfilingInfo::Status::EXECUTED;
                 if (perf->second.node_type[0]) {
                     layer_timing[perf->second.node_type] += timing.duration();
+                    layer_last_timing[perf->second.node_type] += last_duration;
                 }
                 auto ops = graph->getModel()->get_ops();
                 const auto& op = std::find_if(ops.begin(), ops.end(),
@@ -77,6 +115,8 @@ void Profiler::process_events() {
                     auto info_perf_count = it->second.as<std::shared_ptr<ov::nvidia_gpu::PerfCounts>>();
                     info_perf_count->total_duration += ms_to_us(timing.duration());
                     info_perf_count->num += infer_count_;
+                    info_perf_count->latency.record(ms_to_us(last_duration));
+                    timing.take_hardware_metrics(info_perf_count->hardware_metrics);
                     auto pos = perf->second.exec_type.find('_');
                     if (pos != std::string::npos) {
                         info_perf_count->impl_type = perf->second.exec_type.substr(0, pos);
@@ -116,46 +156,147 @@ void Profiler::process_events() {
         auto const result = stage_counters_.insert(value);
         if (!result.second) { result.first->second = value.second; }
     };
+    const auto previous_exec_time = exec_timing_.duration();
+    const auto exec_time = exec_timing_.measure();
     insert_stage(make_profile_info("1. input preprocessing", zero_time, stage_time_ms(PerfStages::Preprocess)));
     insert_stage(make_profile_info("2. input transfer to a device", parameter_ms));
-    insert_stage(make_profile_info("3. execution time", time_per_infer_us(exec_timing_.measure()), stage_time_ms(PerfStages::StartPipeline)));
+    insert_stage(make_profile_info("3. execution time", time_per_infer_us(exec_time), stage_time_ms(PerfStages::StartPipeline)));
     insert_stage(make_profile_info("4. output transfer from a device", result_ms));
     insert_stage(make_profile_info("5. output postprocessing", zero_time, stage_time_ms(PerfStages::Postprocess)));
+
+    if (stage_latencies_) {
+        auto& latencies = *stage_latencies_;
+        latencies["1. input preprocessing"].record(stage_time_ms(PerfStages::Preprocess));
+        latencies["2. input transfer to a device"].record(ms_to_us(layer_last_timing["Parameter"]));
+        latencies["3. execution time"].record(ms_to_us(exec_time - previous_exec_time));
+        latencies["4. output transfer from a device"].record(ms_to_us(layer_last_timing["Result"]));
+        latencies["5. output postprocessing"].record(stage_time_ms(PerfStages::Postprocess));
+    }
+}
+
+void Profiler::start_graph_capture() {
+    for (auto& [graph, perfSteps] : subgraph_perf_steps_map_) {
+        for (auto& perfStep : perfSteps) {
+            perfStep.discard_graph_timings();
+        }
+    }
+}
+
+void Profiler::start_graph_launch() {
+    OPENVINO_ASSERT(active_stream_);
+    ++infer_count_;
+    graph_launch_ = true;
+    exec_timing_.setStart(*active_stream_, cuda_event_record_mode_);
+    exec_start_host_ = ChromeTrace::Clock::now();
+}
+
+void Profiler::stop_graph_launch() {
+    exec_timing_.setStop(*active_stream_, cuda_event_record_mode_);
+    graph_launch_ = false;
 }
 
 void Profiler::execute_sequence(const SubGraph* subGraphPtr,
                                 const MemoryManager& memoryManager,
                                 const Workbuffers::mutable_buffer& buffer,
                                 const InferenceRequestContext& context) {
-    for (const auto& op : create_exec_sequence(subGraphPtr)) {
-        const auto& inTensors = memoryManager.inputTensorPointers(*op, buffer);
-        const auto& outTensors = memoryManager.outputTensorPointers(*op, buffer);
-        const auto& workBuffers = memoryManager.workBuffers(*op, buffer);
-        op->execute(context, inTensors, outTensors, workBuffers);
+    const bool metricsSession = begin_metrics_session();
+    try {
+        for (const auto& op : create_exec_sequence(subGraphPtr, !graph_launch_)) {
+            const auto& inTensors = memoryManager.inputTensorPointers(*op, buffer, context.getExternalBuffers());
+            const auto& outTensors = memoryManager.outputTensorPointers(*op, buffer, context.getExternalBuffers());
+            const auto& workBuffers = memoryManager.workBuffers(*op, buffer);
+            op->execute(context, inTensors, outTensors, workBuffers);
+        }
+    } catch (...) {
+        if (metricsSession) {
+            cancel_metrics_session();
+        }
+        throw;
+    }
+    if (metricsSession) {
+        end_metrics_session();
+    }
+}
+
+bool Profiler::begin_metrics_session() {
+#ifdef ENABLE_CUPTI_METRICS
+    // Kernels of captured CUDA graphs are launched by the graphs, which CUPTI can't replay per kernel
+    if (!metrics_profiler_ || graph_launch_ || metrics_session_) {
+        return false;
     }
+    metrics_profiler_->begin();
+    metrics_steps_.clear();
+    metrics_ranges_ = 0;
+    metrics_session_ = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Profiler::end_metrics_session() {
+#ifdef ENABLE_CUPTI_METRICS
+    metrics_session_ = false;
+    const auto kernelMetrics = metrics_profiler_->end();
+    for (const auto& [step, first, last] : metrics_steps_) {
+        for (size_t range = first; range < last && range < kernelMetrics.size(); ++range) {
+            if (kernelMetrics[range].front() > 0) {
+                step->add_hardware_metrics(kernelMetrics[range]);
+            }
+        }
+    }
+    metrics_steps_.clear();
+#endif
+}
+
+void Profiler::cancel_metrics_session() noexcept {
+#ifdef ENABLE_CUPTI_METRICS
+    metrics_session_ = false;
+    metrics_profiler_->cancel();
+    metrics_steps_.clear();
+#endif
+}
+
+void Profiler::record_metrics_ranges(const ProfileExecStep& step, const size_t firstRange) {
+#ifdef ENABLE_CUPTI_METRICS
+    metrics_ranges_ = metrics_profiler_->flush();
+    if (metrics_ranges_ > firstRange) {
+        metrics_steps_.emplace_back(&step, firstRange, metrics_ranges_);
+    }
+#endif
 }
 
 void Profiler::capture_sequence(const SubGraph* subGraphPtr,
                                 const MemoryManager& memoryManager,
                                 const Workbuffers::mutable_buffer& buffer,
                                 InferenceRequestContext& context) {
-    for (const auto& op : create_exec_sequence(subGraphPtr)) {
-        const auto& inputTensors = memoryManager.inputTensorPointers(*op, buffer);
-        const auto& outputTensors = memoryManager.outputTensorPointers(*op, buffer);
+    for (const auto& op : create_exec_sequence(subGraphPtr, false)) {
+        const auto& inputTensors = memoryManager.inputTensorPointers(*op, buffer, context.getExternalBuffers());
+        const auto& outputTensors = memoryManager.outputTensorPointers(*op, buffer, context.getExternalBuffers());
         const auto& workBuffers = memoryManager.workBuffers(*op, buffer);
         op->capture(context, inputTensors, outputTensors, workBuffers);
     }
 }
 
-Profiler::ProfilerSequence Profiler::create_exec_sequence(const SubGraph* subGraphPtr) {
+Profiler::ProfilerSequence Profiler::create_exec_sequence(const SubGraph* subGraphPtr, const bool timed) {
     OPENVINO_ASSERT(active_stream_);
-    ++infer_count_;
+    if (timed) {
+        ++infer_count_;
+    }
     auto foundPerfStepsIter = std::find_if(subgraph_perf_steps_map_.begin(),
                                            subgraph_perf_steps_map_.end(),
                                            [subGraphPtr](const auto& ps) { return ps.first == subGraphPtr; });
-    OPENVINO_ASSERT(foundPerfStepsIter != subgraph_perf_steps_map_.end());
+    if (foundPerfStepsIter == subgraph_perf_steps_map_.end()) {
+        // Parts of the topology split by CudaGraphTopologyRunner share operations with the whole topology
+        std::vector<OperationBase::Ptr> execSequence;
+        collect_subgraphs(*subGraphPtr, execSequence);
+        foundPerfStepsIter = std::find_if(subgraph_perf_steps_map_.begin(),
+                                          subgraph_perf_steps_map_.end(),
+                                          [subGraphPtr](const auto& ps) { return ps.first == subGraphPtr; });
+    }
     return ProfilerSequence{*this,
-                            static_cast<size_t>(std::distance(subgraph_perf_steps_map_.begin(), foundPerfStepsIter))};
+                            static_cast<size_t>(std::distance(subgraph_perf_steps_map_.begin(), foundPerfStepsIter)),
+                            timed};
 }
 
 void Profiler::collect_subgraphs(const SubGraph& graph, std::vector<OperationBase::Ptr>& allExecSequence) {
@@ -175,6 +316,11 @@ void Profiler::collect_node_visitor(const OperationBase::Ptr& execStep,
     perfSteps.emplace_back(*this, op);
     if (const auto tensorIteratorPtr = dynamic_cast<const TensorIteratorOp*>(&op)) {
         collect_subgraphs(*tensorIteratorPtr, allExecSequence);
+    } else if (const auto loopPtr = dynamic_cast<const LoopOp*>(&op)) {
+        collect_subgraphs(*loopPtr, allExecSequence);
+    } else if (const auto ifPtr = dynamic_cast<const IfOp*>(&op)) {
+        collect_subgraphs(ifPtr->branch(IfOp::NodeOp::THEN_BODY_INDEX), allExecSequence);
+        collect_subgraphs(ifPtr->branch(IfOp::NodeOp::ELSE_BODY_INDEX), allExecSequence);
     }
 }
 
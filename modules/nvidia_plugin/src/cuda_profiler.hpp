@@ -4,11 +4,18 @@
 
 #pragma once
 
+#include <optional>
 #include <ops/tensor_iterator.hpp>
+#include <tuple>
+#include <utils/latency_histogram.hpp>
 #include <utils/perf_timing.hpp>
 
 #include "cuda_iexecution_delegator.hpp"
 
+namespace CUDA {
+class MetricsProfiler;
+}  // namespace CUDA
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -26,9 +33,19 @@ public:
 
     /**
      * Constructor of Profiler class
-     * @param perfCount Option that indicates if performance counters are enabled
+     * @param graph Topology which operations are profiled
+     * @param nvtxRanges Whether operations are annotated by NVTX ranges
+     * @param stageLatencies Histograms of latencies of stages shared by infer requests of the compiled model
+     * @param trace Trace the device time of operations is added to, nullptr if tracing is disabled
+     * @param hardwareCountersDevice Device hardware metrics of kernels of operations are collected on by CUPTI,
+     *                               std::nullopt if they aren't collected (see ov::nvidia_gpu::hardware_counters)
      */
-    explicit Profiler(const SubGraph& graph);
+    explicit Profiler(const SubGraph& graph,
+                      bool nvtxRanges = false,
+                      std::shared_ptr<utils::LatencyHistograms> stageLatencies = nullptr,
+                      std::shared_ptr<ChromeTrace> trace = nullptr,
+                      std::optional<int> hardwareCountersDevice = std::nullopt);
+    ~Profiler() override;
 
     /**
      * Start time measurement of stage
@@ -46,6 +63,21 @@ public:
      */
     void stop_stage(PerfStages stage) override { durations_[static_cast<std::size_t>(stage)] = Time::now() - start_; }
 
+    /**
+     * Drops events recorded by operations of the CUDA graphs captured before
+     */
+    void start_graph_capture() override;
+
+    /**
+     * Start time measurement of the launch of captured CUDA graphs
+     */
+    void start_graph_launch() override;
+
+    /**
+     * Stop time measurement of the launch of captured CUDA graphs
+     */
+    void stop_graph_launch() override;
+
     /**
      * Execute sequence from SubGraph/TensorIterator class
      * @param subGraphPtr Pointer to SubGraph
@@ -87,18 +119,37 @@ public:
      */
     void set_cuda_event_record_mode(CUDA::Event::RecordMode mode) override { cuda_event_record_mode_ = mode; }
 
+    /**
+     * Sets tags of trace events of operations of the inference
+     * @param tags Request and memory block of the inference
+     */
+    void set_trace_tags(const ChromeTrace::Tags& tags) override { trace_tags_ = tags; }
+
 private:
     /**
      * Creates profiler sequence and increase infer request counter
+     * @param timed Whether the sequence is the execution of the topology, which is measured as a whole
      * @return ProfilerSequence for single InferRequest
      */
-    Profiler::ProfilerSequence create_exec_sequence(const SubGraph* subGraphPtr);
+    Profiler::ProfilerSequence create_exec_sequence(const SubGraph* subGraphPtr, bool timed);
 
     void collect_subgraphs(const SubGraph& graph, std::vector<OperationBase::Ptr>& vector);
     void collect_node_visitor(const OperationBase::Ptr& execStep,
                               std::vector<ProfileExecStep>& perfSteps,
                               std::vector<OperationBase::Ptr>& allExecSequence);
 
+    /**
+     * Starts collection of hardware metrics by the outermost eagerly executed sequence
+     * @return Whether the session is started by this call and should be ended by end_metrics_session()
+     */
+    bool begin_metrics_session();
+    void end_metrics_session();
+    void cancel_metrics_session() noexcept;
+    /**
+     * Remembers kernels launched by the step since the range firstRange of the session
+     */
+    void record_metrics_ranges(const ProfileExecStep& step, size_t firstRange);
+
     const CUDA::Stream* active_stream_ = nullptr;
     std::vector<std::pair<const void*, std::vector<ProfileExecStep>>> subgraph_perf_steps_map_;
     PerformaceCounters perf_counters_{};
@@ -109,7 +160,22 @@ private:
     std::array<Duration, static_cast<std::size_t>(PerfStages::NumOfStages)> durations_;
     Time::time_point start_{};
     size_t infer_count_{};
+    // Captured CUDA graphs are being launched, their eagerly executed parts aren't measured as a whole
+    bool graph_launch_{};
+    bool nvtx_ranges_{};
+    std::shared_ptr<utils::LatencyHistograms> stage_latencies_;
+    std::shared_ptr<ChromeTrace> trace_;
+    ChromeTrace::Tags trace_tags_{};
+    // Host time the execution is started at, device times of operations are placed relative to it in the trace
+    ChromeTrace::Clock::time_point exec_start_host_{};
     CUDA::Event::RecordMode cuda_event_record_mode_{CUDA::Event::RecordMode::Default};
+#ifdef ENABLE_CUPTI_METRICS
+    std::unique_ptr<CUDA::MetricsProfiler> metrics_profiler_;
+#endif
+    // Steps executed in the active session of the metrics profiler and ranges [first, last) of their kernels
+    std::vector<std::tuple<const ProfileExecStep*, size_t, size_t>> metrics_steps_;
+    size_t metrics_ranges_{};
+    bool metrics_session_{};
 };
 
 class Profiler::ProfileExecStep {
@@ -128,16 +194,37 @@ public:
      */
     template <typename... TArgs>
     void execute(TArgs&&... args) const {
+        executed_ = true;
+        const auto nvtxRange = make_nvtx_range(profiler_.nvtx_ranges_, exec_step_);
         timing_.setStart(*this->profiler_.active_stream_, profiler_.cuda_event_record_mode_);
+        const auto firstRange = profiler_.metrics_ranges_;
         exec_step_.Execute(std::forward<TArgs>(args)...);
         timing_.setStop(*this->profiler_.active_stream_, profiler_.cuda_event_record_mode_);
+        if (profiler_.metrics_session_) {
+            profiler_.record_metrics_ranges(*this, firstRange);
+        }
     }
 
+    /**
+     * Capture method wrapper that surrounds kernels of the operation with event record nodes of the graph,
+     * so each launch of the graph records time of the operation.
+     * Operation is captured more than once by bodies of TensorIterator with different buffers
+     */
     template <typename... TArgs>
     void capture(TArgs&&... args) const {
-        timing_.setStart(*this->profiler_.active_stream_, profiler_.cuda_event_record_mode_);
+        executed_ = true;
+        const auto nvtxRange = make_nvtx_range(profiler_.nvtx_ranges_, exec_step_);
+        // Timings of discarded graphs are reused with their events, since the same graphs are usually captured again
+        if (spare_graph_timings_.empty()) {
+            graph_timings_.emplace_back();
+        } else {
+            graph_timings_.push_back(std::move(spare_graph_timings_.back()));
+            spare_graph_timings_.pop_back();
+        }
+        auto& timing = graph_timings_.back();
+        timing.setStart(*this->profiler_.active_stream_, CUDA::Event::RecordMode::External);
         exec_step_.Capture(std::forward<TArgs>(args)...);
-        timing_.setStop(*this->profiler_.active_stream_, profiler_.cuda_event_record_mode_);
+        timing.setStop(*this->profiler_.active_stream_, CUDA::Event::RecordMode::External);
     }
 
     /**
@@ -162,13 +249,96 @@ public:
      * measure time for this execution step
      * @return Time for this step
      */
-    float measure() { return timing_.measure(); }
+    float measure() {
+        timing_.measure();
+        for (auto& timing : graph_timings_) {
+            timing.measure(true);
+        }
+        return duration();
+    }
 
     /**
      * Get time for this execution step
      * @return Time for this step
      */
-    [[nodiscard]] float duration() const noexcept { return timing_.duration(); }
+    [[nodiscard]] float duration() const noexcept {
+        float duration = timing_.duration() + discarded_graphs_duration_;
+        for (const auto& timing : graph_timings_) {
+            duration += timing.duration();
+        }
+        return duration;
+    }
+
+    /**
+     * Adds device time of the last execution of this step to the trace, before it is measured
+     * @param reference Measurement of the execution of the topology the step belongs to
+     * @param referenceHost Host time the reference measurement is started at
+     */
+    void trace(ChromeTrace& trace,
+               const utils::PerformaceTiming& reference,
+               ChromeTrace::Clock::time_point referenceHost,
+               const ChromeTrace::Tags& tags) const {
+        const auto add = [&](const utils::PerformaceTiming& timing) {
+            const auto start = timing.startedSince(reference);
+            const auto elapsed = timing.elapsed();
+            if (start && elapsed) {
+                using Milliseconds = std::chrono::duration<float, std::milli>;
+                const auto offset = std::chrono::duration_cast<ChromeTrace::Clock::duration>(Milliseconds{*start});
+                trace.add({exec_step_.GetName(),
+                           exec_step_.GetTypeName(),
+                           referenceHost + offset,
+                           Milliseconds{*elapsed},
+                           tags,
+                           true});
+            }
+        };
+        add(timing_);
+        for (const auto& timing : graph_timings_) {
+            add(timing);
+        }
+    }
+
+    /**
+     * Keeps time measured by the events of captured graphs and spares the events for the next capture,
+     * since the graphs are discarded
+     */
+    void discard_graph_timings() {
+        for (auto& timing : graph_timings_) {
+            discarded_graphs_duration_ += timing.duration();
+            timing.reset();
+            spare_graph_timings_.push_back(std::move(timing));
+        }
+        graph_timings_.clear();
+    }
+
+    /**
+     * Accumulates hardware metrics of a kernel of this step weighted by its device time
+     * @param kernelMetrics Device time of the kernel followed by values of HARDWARE_METRICS
+     */
+    void add_hardware_metrics(const std::vector<double>& kernelMetrics) const {
+        const auto weight = kernelMetrics.front();
+        metrics_sums_.resize(kernelMetrics.size() - 1);
+        for (size_t i = 1; i < kernelMetrics.size(); ++i) {
+            metrics_sums_[i - 1] += kernelMetrics[i] * weight;
+        }
+        metrics_weight_ += weight;
+    }
+
+    /**
+     * Moves hardware metrics accumulated since the last call to averages of the performance counter
+     */
+    void take_hardware_metrics(HardwareMetricsAverages& averages) {
+        if (metrics_weight_ > 0) {
+            averages.add(metrics_sums_, metrics_weight_);
+        }
+        metrics_sums_.clear();
+        metrics_weight_ = 0;
+    }
+
+    /**
+     * @return Whether this execution step has been executed or captured at least once
+     */
+    [[nodiscard]] bool executed() const noexcept { return executed_; }
 
     /**
      * Get name of the operation
@@ -180,6 +350,12 @@ private:
     Profiler& profiler_;
     const OperationBase& exec_step_;
     mutable utils::PerformaceTiming timing_;
+    mutable std::vector<utils::PerformaceTiming> graph_timings_;
+    mutable std::vector<utils::PerformaceTiming> spare_graph_timings_;
+    float discarded_graphs_duration_{};
+    mutable bool executed_{};
+    mutable std::vector<double> metrics_sums_;
+    mutable double metrics_weight_{};
 };
 
 class Profiler::ProfilerSequence {
@@ -187,10 +363,14 @@ public:
     /**
      * Constructor for profiler sequence
      * @param profiler Profiler class
-     * @param stream CUDA stream
+     * @param timed Whether the sequence is measured as a whole
      */
-    ProfilerSequence(Profiler& profiler, size_t index) : profiler_{profiler}, index_{index} {
-        profiler_.exec_timing_.setStart(*profiler_.active_stream_, profiler.cuda_event_record_mode_);
+    ProfilerSequence(Profiler& profiler, size_t index, bool timed)
+        : profiler_{profiler}, index_{index}, timed_{timed} {
+        if (timed_) {
+            profiler_.exec_timing_.setStart(*profiler_.active_stream_, profiler.cuda_event_record_mode_);
+            profiler_.exec_start_host_ = ChromeTrace::Clock::now();
+        }
     }
 
     /**
@@ -198,7 +378,9 @@ public:
      * Stops time measurement
      */
     ~ProfilerSequence() {
-        profiler_.exec_timing_.setStop(*profiler_.active_stream_, profiler_.cuda_event_record_mode_);
+        if (timed_) {
+            profiler_.exec_timing_.setStop(*profiler_.active_stream_, profiler_.cuda_event_record_mode_);
+        }
     }
 
     /**
@@ -228,6 +410,7 @@ public:
 private:
     Profiler& profiler_;
     const size_t index_;
+    const bool timed_;
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,43 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_remote_context.hpp"
+
+#include <cuda/runtime.hpp>
+
+#include "cuda_remote_tensor.hpp"
+#include "nvidia/remote_properties.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+RemoteContextImpl::RemoteContextImpl(const std::string& device_name, int device_id)
+    : device_name_{device_name}, device_id_{device_id}, properties_{{ov::device::id.name(), device_id}} {}
+
+const std::string& RemoteContextImpl::get_device_name() const { return device_name_; }
+
+const ov::AnyMap& RemoteContextImpl::get_property() const { return properties_; }
+
+ov::SoPtr<ov::IRemoteTensor> RemoteContextImpl::create_tensor(const ov::element::Type& type,
+                                                              const ov::Shape& shape,
+                                                              const ov::AnyMap& params) {
+    void* user_device_ptr = nullptr;
+    for (auto&& [key, value] : params) {
+        if (ov::nvidia_gpu::device_ptr == key) {
+            user_device_ptr = value.as<void*>();
+        } else {
+            OPENVINO_THROW("Not supported remote tensor parameter: ", key);
+        }
+    }
+    auto context = std::static_pointer_cast<RemoteContextImpl>(shared_from_this());
+    return {std::make_shared<RemoteTensorImpl>(context, type, shape, user_device_ptr), nullptr};
+}
+
+ov::SoPtr<ov::ITensor> RemoteContextImpl::create_host_tensor(const ov::element::Type type, const ov::Shape& shape) {
+    return {ov::make_tensor(type, shape, ov::Allocator{CUDA::PinnedHostAllocator{}}), nullptr};
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
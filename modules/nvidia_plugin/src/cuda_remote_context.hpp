@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/runtime/iremote_context.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Remote context of NVIDIA GPU device.
+ *
+ * Creates device resident tensors which could be passed to an infer request
+ * as inputs/outputs without staging them through the host memory.
+ */
+class RemoteContextImpl : public ov::IRemoteContext {
+public:
+    using Ptr = std::shared_ptr<RemoteContextImpl>;
+
+    RemoteContextImpl(const std::string& device_name, int device_id);
+
+    const std::string& get_device_name() const override;
+
+    const ov::AnyMap& get_property() const override;
+
+    /**
+     * Creates device resident tensor.
+     * @param type Element type of the tensor
+     * @param shape Shape of the tensor
+     * @param params Optional ov::nvidia_gpu::device_ptr to wrap user memory instead of allocating a new one
+     * @return Remote tensor
+     */
+    ov::SoPtr<ov::IRemoteTensor> create_tensor(const ov::element::Type& type,
+                                               const ov::Shape& shape,
+                                               const ov::AnyMap& params = {}) override;
+
+    /**
+     * Creates host tensor backed by page-locked memory, which is the most efficient for transfers to the device
+     */
+    ov::SoPtr<ov::ITensor> create_host_tensor(const ov::element::Type type, const ov::Shape& shape) override;
+
+    int get_device_id() const noexcept { return device_id_; }
+
+private:
+    std::string device_name_;
+    int device_id_;
+    ov::AnyMap properties_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,89 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_remote_tensor.hpp"
+
+#include "nvidia/remote_properties.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+RemoteTensorImpl::RemoteTensorImpl(const RemoteContextImpl::Ptr& context,
+                                   const ov::element::Type& type,
+                                   const ov::Shape& shape,
+                                   void* user_device_ptr)
+    : context_{context},
+      element_type_{type},
+      shape_{shape},
+      device_ptr_{user_device_ptr},
+      user_memory_{user_device_ptr != nullptr} {
+    OPENVINO_ASSERT(context_, "Remote tensor requires a remote context");
+    update_strides();
+    if (device_ptr_ == nullptr) {
+        allocate();
+    } else {
+        capacity_ = ov::shape_size(shape_) * element_type_.size();
+    }
+    update_properties();
+}
+
+const ov::AnyMap& RemoteTensorImpl::get_properties() const { return properties_; }
+
+const std::string& RemoteTensorImpl::get_device_name() const { return context_->get_device_name(); }
+
+void RemoteTensorImpl::set_shape(ov::Shape shape) {
+    const auto new_size = ov::shape_size(shape) * element_type_.size();
+    if (new_size > capacity_) {
+        // Memory of a tensor created with the empty shape is allocated by the first shape which isn't empty
+        OPENVINO_ASSERT(!user_memory_,
+                        "Can't enlarge remote tensor which wraps user provided device memory of ",
+                        capacity_,
+                        " bytes up to ",
+                        new_size,
+                        " bytes");
+        shape_ = std::move(shape);
+        allocate();
+    } else {
+        shape_ = std::move(shape);
+    }
+    update_strides();
+    update_properties();
+}
+
+const ov::element::Type& RemoteTensorImpl::get_element_type() const { return element_type_; }
+
+const ov::Shape& RemoteTensorImpl::get_shape() const { return shape_; }
+
+const ov::Strides& RemoteTensorImpl::get_strides() const { return strides_; }
+
+void RemoteTensorImpl::update_strides() {
+    strides_.clear();
+    if (shape_.empty()) {
+        return;
+    }
+    strides_.resize(shape_.size());
+    strides_.back() = element_type_.size();
+    for (std::size_t i = shape_.size() - 1; i > 0; --i) {
+        strides_[i - 1] = strides_[i] * shape_[i];
+    }
+}
+
+void RemoteTensorImpl::update_properties() { properties_ = {{ov::nvidia_gpu::device_ptr.name(), device_ptr_}}; }
+
+void RemoteTensorImpl::allocate() {
+    const auto size = ov::shape_size(shape_) * element_type_.size();
+    allocation_.reset();
+    device_ptr_ = nullptr;
+    capacity_ = size;
+    if (size == 0) {
+        return;
+    }
+    // Memory is allocated on the device of the context, the device of the calling thread is kept
+    CUDA::CurrentDeviceScope deviceScope{CUDA::Device{context_->get_device_id()}};
+    allocation_.emplace(CUDA::DefaultStream::stream().malloc(size));
+    device_ptr_ = allocation_->get();
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,77 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/runtime.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "cuda_remote_context.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Tensor which memory is located on NVIDIA GPU device.
+ *
+ * Memory is either allocated by the tensor itself or provided by the user
+ * via ov::nvidia_gpu::device_ptr property. In the latter case the user is
+ * responsible for keeping memory alive while the tensor is used.
+ */
+class RemoteTensorImpl : public ov::IRemoteTensor {
+public:
+    using Ptr = std::shared_ptr<RemoteTensorImpl>;
+
+    /**
+     * @param context Remote context which created the tensor
+     * @param type Element type of the tensor
+     * @param shape Shape of the tensor
+     * @param user_device_ptr User memory to wrap or nullptr if memory should be allocated
+     */
+    RemoteTensorImpl(const RemoteContextImpl::Ptr& context,
+                     const ov::element::Type& type,
+                     const ov::Shape& shape,
+                     void* user_device_ptr = nullptr);
+
+    const ov::AnyMap& get_properties() const override;
+
+    const std::string& get_device_name() const override;
+
+    void set_shape(ov::Shape shape) override;
+
+    const ov::element::Type& get_element_type() const override;
+
+    const ov::Shape& get_shape() const override;
+
+    const ov::Strides& get_strides() const override;
+
+    /**
+     * @returns Device pointer to the tensor memory
+     */
+    void* get_device_ptr() const noexcept { return device_ptr_; }
+
+    const RemoteContextImpl::Ptr& get_context() const noexcept { return context_; }
+
+private:
+    void update_strides();
+    void update_properties();
+    void allocate();
+
+    RemoteContextImpl::Ptr context_;
+    ov::element::Type element_type_;
+    ov::Shape shape_;
+    ov::Strides strides_;
+    std::size_t capacity_ = 0;
+    std::optional<CUDA::DefaultAllocation> allocation_;
+    void* device_ptr_ = nullptr;
+    // Memory is provided by the user, so the tensor can't be enlarged
+    bool user_memory_ = false;
+    ov::AnyMap properties_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
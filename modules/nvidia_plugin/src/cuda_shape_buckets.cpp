@@ -0,0 +1,262 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_shape_buckets.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <error.hpp>
+#include <optional>
+
+#include "cuda_compiled_model.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/elu.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/hsigmoid.hpp"
+#include "openvino/op/hswish.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/mish.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/normalize_l2.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/softplus.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/arithmetic_reduction.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+#include "openvino/op/util/logical_reduction.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+bool is_elementwise(const ov::Node& node) {
+    return ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(&node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(&node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseComparison>(&node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseLogical>(&node) || ov::is_type<ov::op::v0::Clamp>(&node) ||
+           ov::is_type<ov::op::v0::Elu>(&node) || ov::is_type<ov::op::v0::Gelu>(&node) ||
+           ov::is_type<ov::op::v7::Gelu>(&node) || ov::is_type<ov::op::v4::Swish>(&node) ||
+           ov::is_type<ov::op::v4::HSwish>(&node) || ov::is_type<ov::op::v5::HSigmoid>(&node) ||
+           ov::is_type<ov::op::v4::Mish>(&node) || ov::is_type<ov::op::v4::SoftPlus>(&node) ||
+           ov::is_type<ov::op::v0::Convert>(&node) || ov::is_type<ov::op::v1::Select>(&node);
+}
+
+/**
+ * Operations, which only move elements of their input between axes or add/remove axes of size 1
+ */
+bool is_layout_only(const ov::Node& node) {
+    return ov::is_type<ov::op::v1::Transpose>(&node) || ov::is_type<ov::op::v0::Squeeze>(&node) ||
+           ov::is_type<ov::op::v0::Unsqueeze>(&node);
+}
+
+/**
+ * @returns Axes the node combines elements of its first input along, nullopt if they aren't known
+ */
+std::optional<std::vector<std::int64_t>> combined_axes(const ov::Node& node) {
+    const auto constant_axes = [&]() -> std::optional<std::vector<std::int64_t>> {
+        const auto axes = ov::as_type_ptr<ov::op::v0::Constant>(node.get_input_node_shared_ptr(1));
+        if (!axes) {
+            return std::nullopt;
+        }
+        return axes->cast_vector<std::int64_t>();
+    };
+    if (ov::is_type<ov::op::util::ArithmeticReduction>(&node) || ov::is_type<ov::op::util::LogicalReduction>(&node) ||
+        ov::is_type<ov::op::v0::NormalizeL2>(&node) || ov::is_type<ov::op::v6::MVN>(&node)) {
+        return constant_axes();
+    }
+    if (const auto softmax = dynamic_cast<const ov::op::v1::Softmax*>(&node)) {
+        return std::vector<std::int64_t>{static_cast<std::int64_t>(softmax->get_axis())};
+    }
+    if (const auto softmax = dynamic_cast<const ov::op::v8::Softmax*>(&node)) {
+        return std::vector<std::int64_t>{softmax->get_axis()};
+    }
+    if (const auto softmax = dynamic_cast<const ov::op::v5::LogSoftmax*>(&node)) {
+        return std::vector<std::int64_t>{softmax->get_axis()};
+    }
+    return std::nullopt;
+}
+
+/**
+ * Checks that zeros inputs are padded with don't affect elements of outputs, which are kept after cropping.
+ * Padded axes are the ones, which are dynamic in the model. Elements along them may be combined only element-wise
+ * (e.g. a sum over a padded axis would include padding, which isn't zero anymore after Add of a bias or Exp),
+ * while other axes may be reduced, normalized or contracted by MatMul
+ */
+void validate_padded_axes(const ov::Model& model) {
+    const auto is_padded = [](const ov::PartialShape& shape, std::int64_t axis) {
+        if (shape.rank().is_dynamic()) {
+            return true;
+        }
+        const auto rank = static_cast<std::int64_t>(shape.size());
+        if (axis < 0) {
+            axis += rank;
+        }
+        return axis < 0 || axis >= rank || shape[axis].is_dynamic();
+    };
+    for (const auto& node : model.get_ordered_ops()) {
+        if (!node->is_dynamic() || ov::is_type<ov::op::v0::Parameter>(node) ||
+            ov::is_type<ov::op::v0::Result>(node) || is_elementwise(*node) || is_layout_only(*node)) {
+            continue;
+        }
+        const auto& name = node->get_friendly_name();
+        if (const auto concat = ov::as_type_ptr<ov::op::v0::Concat>(node)) {
+            // Padding of the inputs but the last one would be placed in the middle of the output
+            for (const auto& input : node->inputs()) {
+                if (is_padded(input.get_partial_shape(), concat->get_axis())) {
+                    throw_ov_exception(fmt::format(
+                        "Shape buckets: {} concatenates along a dynamic axis, which would be padded", name));
+                }
+            }
+            continue;
+        }
+        const auto axes = node->get_input_size() > 0 ? combined_axes(*node) : std::nullopt;
+        if (!axes && !ov::is_type<ov::op::v0::MatMul>(node)) {
+            throw_ov_exception(fmt::format(
+                "Shape buckets: {} of type {} with dynamic shapes isn't element-wise, so padding may affect its output",
+                name,
+                node->get_type_name()));
+        }
+        const auto& shape = node->get_input_partial_shape(0);
+        if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(node)) {
+            // Contracted axis is the last one of the first input and the one before the last of the second input,
+            // unless the input is transposed or a vector
+            const auto contracted_axis = [](const ov::PartialShape& input, bool transposed, bool first) {
+                if (input.rank().is_static() && input.size() == 1) {
+                    return std::int64_t{0};
+                }
+                return std::int64_t{transposed == first ? -2 : -1};
+            };
+            const auto& other = node->get_input_partial_shape(1);
+            if (is_padded(shape, contracted_axis(shape, matmul->get_transpose_a(), true)) ||
+                is_padded(other, contracted_axis(other, matmul->get_transpose_b(), false))) {
+                throw_ov_exception(
+                    fmt::format("Shape buckets: {} contracts a dynamic dimension, which would be padded", name));
+            }
+            continue;
+        }
+        for (const auto axis : *axes) {
+            if (is_padded(shape, axis)) {
+                throw_ov_exception(
+                    fmt::format("Shape buckets: {} combines elements along dynamic axis {}, which would be padded",
+                                name,
+                                axis));
+            }
+        }
+    }
+}
+
+std::size_t round_up_to_power_of_two(std::size_t value) {
+    std::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return value == 0 ? 0 : result;
+}
+
+}  // namespace
+
+ShapeBuckets::ShapeBuckets(const std::shared_ptr<const ov::Model>& model,
+                           const Configuration& config,
+                           const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
+                           const std::shared_ptr<const ov::IPlugin>& plugin)
+    : model_{model->clone()}, config_{config}, wait_executor_{wait_executor}, plugin_{plugin} {
+    validate_padded_axes(*model_);
+    CUDA::Device device{config_.get_device_id()};
+    if (CUDA::VirtualMemory::isSupported(device)) {
+        // Addresses are reserved for the largest blob the memory budget allows, only mapped memory is allocated
+        const auto total = device.props().totalGlobalMem;
+        memory_arenas_ = std::make_shared<MemoryArenas>(device, std::min(config_.get_memory_budget(total), total));
+    }
+}
+
+ShapeBuckets::Shapes ShapeBuckets::get_bucket_shapes(const Shapes& input_shapes) const {
+    const auto& parameters = model_->get_parameters();
+    OPENVINO_ASSERT(input_shapes.size() == parameters.size());
+    Shapes bucket_shapes;
+    bucket_shapes.reserve(input_shapes.size());
+    for (std::size_t i = 0; i < input_shapes.size(); ++i) {
+        const auto& partial_shape = parameters[i]->get_partial_shape();
+        const auto& shape = input_shapes[i];
+        OPENVINO_ASSERT(partial_shape.compatible(shape),
+                        "Shape ",
+                        shape,
+                        " of input ",
+                        i,
+                        " isn't compatible with ",
+                        partial_shape);
+        auto bucket_shape = shape;
+        for (std::size_t d = 0; d < shape.size(); ++d) {
+            if (partial_shape.rank().is_static() && partial_shape[d].is_static()) {
+                continue;
+            }
+            bucket_shape[d] = round_up_to_power_of_two(shape[d]);
+            if (partial_shape.rank().is_static() && partial_shape[d].get_max_length() >= 0) {
+                bucket_shape[d] =
+                    std::min(bucket_shape[d], static_cast<std::size_t>(partial_shape[d].get_max_length()));
+            }
+        }
+        bucket_shapes.push_back(std::move(bucket_shape));
+    }
+    return bucket_shapes;
+}
+
+std::shared_ptr<const ov::ICompiledModel> ShapeBuckets::get_bucket(const Shapes& bucket_shapes) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    auto& bucket = buckets_[bucket_shapes];
+    if (!bucket) {
+        // Model of the dynamic compiled model isn't transformed, so the bucket is always compiled from scratch
+        bucket = std::make_shared<CompiledModel>(
+            reshape(bucket_shapes), config_, wait_executor_, plugin_, false, nullptr, memory_arenas_);
+    }
+    return bucket;
+}
+
+const ShapeBuckets::Shapes& ShapeBuckets::get_output_shapes(const Shapes& input_shapes) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    auto it = output_shapes_.find(input_shapes);
+    if (it == output_shapes_.end()) {
+        const auto model = reshape(input_shapes);
+        Shapes output_shapes;
+        for (const auto& result : model->get_results()) {
+            output_shapes.push_back(result->get_output_shape(0));
+        }
+        it = output_shapes_.emplace(input_shapes, std::move(output_shapes)).first;
+    }
+    return it->second;
+}
+
+std::size_t ShapeBuckets::size() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return buckets_.size();
+}
+
+std::shared_ptr<ov::Model> ShapeBuckets::reshape(const Shapes& input_shapes) const {
+    auto model = model_->clone();
+    std::map<ov::Output<ov::Node>, ov::PartialShape> new_shapes;
+    const auto& parameters = model->get_parameters();
+    for (std::size_t i = 0; i < parameters.size(); ++i) {
+        new_shapes.emplace(parameters[i]->output(0), input_shapes.at(i));
+    }
+    model->reshape(new_shapes);
+    return model;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,88 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cuda_config.hpp"
+#include "memory_manager/cuda_memory_arenas.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/iplugin.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Set of static models compiled for shape buckets of a dynamic model.
+ *
+ * Each dynamic dimension of an input is rounded up to the nearest power of two (limited by an upper bound of
+ * the dimension), so inputs of different shapes share the same bucket. Inputs are padded with zeros up to the shape
+ * of the bucket and outputs are cropped to the shapes inferred for the actual input shapes, so models, which combine
+ * elements along dynamic axes other than element-wise (e.g. reduce, normalize or contract them), are rejected, since
+ * padding would affect their outputs. Model of a bucket is
+ * compiled lazily the first time the bucket is used. Mutable blobs of buckets are taken from growable arenas shared
+ * by all buckets if the device supports virtual memory management, so a larger bucket grows memory released by
+ * a smaller one in place instead of allocating its own.
+ */
+class ShapeBuckets {
+public:
+    using Shapes = std::vector<ov::Shape>;
+
+    /**
+     * @throws ov::Exception if padding of dynamic axes of the model may affect its outputs
+     */
+    ShapeBuckets(const std::shared_ptr<const ov::Model>& model,
+                 const Configuration& config,
+                 const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
+                 const std::shared_ptr<const ov::IPlugin>& plugin);
+
+    /**
+     * @param input_shapes Actual shapes of model inputs
+     * @returns Shapes of model inputs in the bucket
+     */
+    Shapes get_bucket_shapes(const Shapes& input_shapes) const;
+
+    /**
+     * @param bucket_shapes Shapes of model inputs in the bucket
+     * @returns Model compiled for the bucket
+     */
+    std::shared_ptr<const ov::ICompiledModel> get_bucket(const Shapes& bucket_shapes);
+
+    /**
+     * @param input_shapes Actual shapes of model inputs
+     * @returns Shapes of model outputs for the given input shapes
+     */
+    const Shapes& get_output_shapes(const Shapes& input_shapes);
+
+    /**
+     * @returns Number of compiled buckets
+     */
+    std::size_t size() const;
+
+    /**
+     * @returns Arenas shared by mutable blobs of buckets, nullptr if virtual memory management isn't supported
+     */
+    const std::shared_ptr<MemoryArenas>& memory_arenas() const { return memory_arenas_; }
+
+private:
+    std::shared_ptr<ov::Model> reshape(const Shapes& input_shapes) const;
+
+    std::shared_ptr<const ov::Model> model_;
+    Configuration config_;
+    std::shared_ptr<ov::threading::ITaskExecutor> wait_executor_;
+    std::shared_ptr<const ov::IPlugin> plugin_;
+    std::shared_ptr<MemoryArenas> memory_arenas_;
+    mutable std::mutex mtx_;
+    std::map<Shapes, std::shared_ptr<const ov::ICompiledModel>> buckets_;
+    std::map<Shapes, Shapes> output_shapes_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -20,8 +20,9 @@ class SimpleExecutionDelegator : public IExecutionDelegator {
 public:
     /**
      * Constructor of SimpleExecutionDelegator class
+     * @param nvtxRanges Whether operations are annotated by NVTX ranges
      */
-    SimpleExecutionDelegator() = default;
+    explicit SimpleExecutionDelegator(bool nvtxRanges = false) : nvtx_ranges_{nvtxRanges} {}
 
     /**
      * Dummy set_stream implementation
@@ -38,6 +39,21 @@ public:
      */
     virtual void stop_stage(PerfStages stage) override{};
 
+    /**
+     * Dummy start_graph_capture implementation
+     */
+    void start_graph_capture() override {}
+
+    /**
+     * Dummy start_graph_launch implementation
+     */
+    void start_graph_launch() override {}
+
+    /**
+     * Dummy stop_graph_launch implementation
+     */
+    void stop_graph_launch() override {}
+
     /**
      * Execute sequence from SubGraph/TensorIterator class
      * @param subGraphPtr Pointer to SubGraph
@@ -49,11 +65,22 @@ public:
                                   const MemoryManager& memoryManager,
                                   const Workbuffers::mutable_buffer& buffer,
                                   const InferenceRequestContext& context) override {
-        for (auto& op : subGraphPtr->getExecSequence()) {
-            const auto& inputTensors = memoryManager.inputTensorPointers(*op, buffer);
-            const auto& outputTensors = memoryManager.outputTensorPointers(*op, buffer);
-            const auto& workBuffers = memoryManager.workBuffers(*op, buffer);
-            op->Execute(context, inputTensors, outputTensors, workBuffers);
+        const auto& sequence = subGraphPtr->getExecSequence();
+        const auto pointers = subGraphPtr->executionPointers(buffer, context.getExternalBuffers());
+        if (const auto* branches = subGraphPtr->parallelBranches()) {
+            // Contexts of branches are nested into a context of the same stream, which can be passed to them
+            InferenceRequestContext branchesContext{context, context.getThreadContext(), context.getExternalBuffers()};
+            branches->launch(branchesContext, [&](InferenceRequestContext& opContext, std::size_t i) {
+                const auto& op = sequence[i];
+                const auto nvtxRange = make_nvtx_range(nvtx_ranges_, *op);
+                op->Execute(opContext, pointers->inputs(i), pointers->outputs(i), pointers->workbuffers(i));
+            });
+            return;
+        }
+        for (std::size_t i = 0; i < sequence.size(); ++i) {
+            const auto& op = sequence[i];
+            const auto nvtxRange = make_nvtx_range(nvtx_ranges_, *op);
+            op->Execute(context, pointers->inputs(i), pointers->outputs(i), pointers->workbuffers(i));
         }
     };
 
@@ -68,11 +95,20 @@ public:
                                   const MemoryManager& memoryManager,
                                   const Workbuffers::mutable_buffer& buffer,
                                   InferenceRequestContext& context) override {
-        for (auto& op : subGraphPtr->getExecSequence()) {
-            const auto& inputTensors = memoryManager.inputTensorPointers(*op, buffer);
-            const auto& outputTensors = memoryManager.outputTensorPointers(*op, buffer);
-            const auto& workBuffers = memoryManager.workBuffers(*op, buffer);
-            op->Capture(context, inputTensors, outputTensors, workBuffers);
+        const auto& sequence = subGraphPtr->getExecSequence();
+        const auto pointers = subGraphPtr->executionPointers(buffer, context.getExternalBuffers());
+        if (const auto* branches = subGraphPtr->parallelBranches()) {
+            branches->launch(context, [&](InferenceRequestContext& opContext, std::size_t i) {
+                const auto& op = sequence[i];
+                const auto nvtxRange = make_nvtx_range(nvtx_ranges_, *op);
+                op->Capture(opContext, pointers->inputs(i), pointers->outputs(i), pointers->workbuffers(i));
+            });
+            return;
+        }
+        for (std::size_t i = 0; i < sequence.size(); ++i) {
+            const auto& op = sequence[i];
+            const auto nvtxRange = make_nvtx_range(nvtx_ranges_, *op);
+            op->Capture(context, pointers->inputs(i), pointers->outputs(i), pointers->workbuffers(i));
         }
     };
 
@@ -92,6 +128,14 @@ public:
      * Dummy set_cuda_event_record_mode implementation
      */
     virtual void set_cuda_event_record_mode(CUDA::Event::RecordMode mode) override{};
+
+    /**
+     * Dummy set_trace_tags implementation
+     */
+    void set_trace_tags(const ChromeTrace::Tags& tags) override {}
+
+private:
+    bool nvtx_ranges_;
 };
 
 }  // namespace nvidia_gpu
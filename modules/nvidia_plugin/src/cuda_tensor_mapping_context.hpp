@@ -14,17 +14,37 @@ class TensorMappingContext {
     using MappingMap = std::map<std::string, std::size_t>;
 
 public:
+    /**
+     * @param skippedOutputs Flags of outputs (by index) which aren't downloaded, nullptr if all outputs are downloaded
+     * @param inputSamples Tensors of samples of inputs (by index) set by set_tensors(), empty for other inputs;
+     *                     nullptr if no input is set by samples
+     */
     TensorMappingContext(const TensorVec& inputs,
                          const MappingMap& inputMapping,
                          const TensorVec& outputs,
-                         const MappingMap& outputMapping)
-        : blob_inputs{inputs}, inputs_mapping{inputMapping}, blob_outputs{outputs}, outputs_mapping{outputMapping} {}
+                         const MappingMap& outputMapping,
+                         const std::vector<bool>* skippedOutputs = nullptr,
+                         const std::vector<TensorVec>* inputSamples = nullptr)
+        : blob_inputs{inputs},
+          inputs_mapping{inputMapping},
+          blob_outputs{outputs},
+          outputs_mapping{outputMapping},
+          skipped_outputs{skippedOutputs},
+          input_samples{inputSamples} {}
     /**
      * @brief get_input_tensor(name) returns an tensor blob with the given name
      */
     inline std::shared_ptr<ov::Tensor> get_input_tensor(const std::string& input_name) const {
         return blob_inputs.at(inputs_mapping.at(input_name));
     }
+    /**
+     * @brief get_input_samples(name) returns tensors of consecutive samples of the input with the given name,
+     *        which are uploaded instead of the input tensor; empty if the input isn't set by samples
+     */
+    inline const TensorVec& get_input_samples(const std::string& input_name) const {
+        static const TensorVec empty{};
+        return input_samples != nullptr ? input_samples->at(inputs_mapping.at(input_name)) : empty;
+    }
     /**
      * @brief get_output_tensor(name) returns an output tensor with the given name
      */
@@ -43,12 +63,20 @@ public:
     inline bool has_output_tensor(const std::string& output_name) const noexcept {
         return outputs_mapping.find(output_name) != outputs_mapping.end();
     }
+    /**
+     * @brief is_output_skipped(name) returns true if the output tensor with the given name isn't downloaded
+     */
+    inline bool is_output_skipped(const std::string& output_name) const {
+        return skipped_outputs != nullptr && skipped_outputs->at(outputs_mapping.at(output_name));
+    }
 
 private:
     const TensorVec& blob_inputs;
     const MappingMap& inputs_mapping;
     const TensorVec& blob_outputs;
     const MappingMap& outputs_mapping;
+    const std::vector<bool>* skipped_outputs;
+    const std::vector<TensorVec>* input_samples;
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_thread_context.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+/**
+ * Streams, events and library handles can't be created by the thread, which captures a graph, in the default mode
+ */
+template <typename TCreate>
+void createRelaxed(const TCreate& create) {
+    cudaStreamCaptureMode mode = cudaStreamCaptureModeRelaxed;
+    throwIfError(cudaThreadExchangeStreamCaptureMode(&mode));
+    try {
+        create();
+    } catch (...) {
+        cudaThreadExchangeStreamCaptureMode(&mode);
+        throw;
+    }
+    throwIfError(cudaThreadExchangeStreamCaptureMode(&mode));
+}
+
+}  // namespace
+
+const ThreadContext& ThreadContext::branch(const std::size_t index) const {
+    if (index >= branches_.size()) {
+        createRelaxed([&] {
+            while (branches_.size() <= index) {
+                branches_.push_back(std::make_unique<ThreadContext>(device_, priority_, partition_));
+            }
+        });
+    }
+    return *branches_[index];
+}
+
+CUDA::Event& ThreadContext::branchEvent(const std::size_t index) const {
+    if (index >= branch_events_.size()) {
+        createRelaxed([&] {
+            while (branch_events_.size() <= index) {
+                branch_events_.emplace_back(cudaEventDisableTiming);
+            }
+        });
+    }
+    return branch_events_[index];
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,25 +6,109 @@
 
 #include "cuda/blas.hpp"
 #include "cuda/dnn.hpp"
+#include "cuda/event.hpp"
+#include "cuda/green_context.hpp"
 #include "cuda/tensor.hpp"
 
+#include <deque>
+#include <memory>
+#include <vector>
+
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * @brief CUDA resources which run inferences: streams and library handles bound to them.
+ *
+ * Operations are executed on the compute stream, while transfers of I/O tensors
+ * are performed on separate upload/download streams. They are joined by events,
+ * so transfers of one inference may overlap with computations of another one
+ * and both copy engines are kept busy. Contexts are leased by threads from
+ * ThreadContextPool of the device for the time of a task. Contexts of a partition of SMs of the device
+ * are created in its green context, so their kernels are executed only on SMs of the partition.
+ * Independent branches of a model may be executed on streams of branch contexts, which are forked from
+ * the compute stream and joined back to it (see ParallelBranches).
+ */
 class ThreadContext {
     CUDA::Device device_;
     CUDA::Stream stream_;
+    CUDA::Stream uploadStream_;
+    CUDA::Stream downloadStream_;
+    mutable CUDA::Event uploadEvent_{cudaEventDisableTiming};
+    mutable CUDA::Event computeEvent_{cudaEventDisableTiming};
     CUDA::DnnHandle dnnHandle_;
     CUDA::CuBlasHandle cuBlasHandle_;
     CUDA::CuTensorHandle cuTensorHandle_;
+    CUDA::DefaultAllocation cuBlasWorkspace_;
+    int priority_;
+    const CUDA::GreenContext* partition_;
+    mutable std::vector<std::unique_ptr<ThreadContext>> branches_;
+    mutable std::deque<CUDA::Event> branch_events_;
+
+    /**
+     * @returns Size of cuBLAS work space recommended for the architecture of the device
+     */
+    static std::size_t cuBlasWorkspaceSize(const CUDA::Device& device) {
+        return device.props().major >= 9 ? 32 * 1024 * 1024 : 4 * 1024 * 1024;
+    }
 
 public:
-    explicit ThreadContext(CUDA::Device d) : device_{d.setCurrent()} {
+    /**
+     * @param priority Priority of CUDA streams of the context, lower numbers are higher priorities
+     * @param partition Partition of SMs of the device, nullptr if kernels are executed on all SMs. It is left
+     *                  current for the calling thread
+     */
+    explicit ThreadContext(CUDA::Device d, int priority = 0, const CUDA::GreenContext* partition = nullptr)
+        : device_{partition ? partition->setCurrent().device() : d.setCurrent()},
+          stream_{priority},
+          uploadStream_{priority},
+          downloadStream_{priority},
+          cuBlasWorkspace_{CUDA::DefaultStream::stream().malloc(cuBlasWorkspaceSize(device_))},
+          priority_{priority},
+          partition_{partition} {
         dnnHandle_.setStream(stream_);
         cuBlasHandle_.setStream(stream_);
+        // Work space is allocated from the memory pool of the device once, so cuBLAS doesn't allocate memory
+        // on first use of each shape (e.g. while CUDA graphs are captured)
+        cuBlasHandle_.setWorkspace(cuBlasWorkspace_.get(), cuBlasWorkspaceSize(device_));
     }
     CUDA::Device device() const { return device_; }
     const CUDA::Stream& stream() const noexcept { return stream_; }
+    const CUDA::Stream& uploadStream() const noexcept { return uploadStream_; }
+    const CUDA::Stream& downloadStream() const noexcept { return downloadStream_; }
+
+    /**
+     * Makes compute stream wait for transfers submitted to upload stream so far
+     */
+    void joinUpload() const { uploadEvent_.record(uploadStream_).streamWait(stream_); }
+
+    /**
+     * Makes download stream wait for computations submitted to compute stream so far
+     */
+    void joinCompute() const { computeEvent_.record(stream_).streamWait(downloadStream_); }
+
+    /**
+     * Waits for completion of all the work submitted to the compute and transfer streams
+     */
+    void synchronize() const {
+        stream_.synchronize();
+        downloadStream_.synchronize();
+    }
+
+    /**
+     * Branch contexts are created on first use and live as long as this context. They may be created
+     * while the compute stream is captured into a CUDA graph
+     * @param index Index of the branch
+     * @returns Context with its own compute stream and library handles for the index-th parallel branch
+     */
+    const ThreadContext& branch(std::size_t index) const;
+
+    /**
+     * @param index Index of the event
+     * @returns Event, which forks and joins streams of parallel branches, created on first use
+     */
+    CUDA::Event& branchEvent(std::size_t index) const;
+
     const CUDA::DnnHandle& dnnHandle() const noexcept { return dnnHandle_; }
     const CUDA::CuBlasHandle& cuBlasHandle() const noexcept { return cuBlasHandle_; }
     const CUDA::CuTensorHandle& cuTensorHandle() const noexcept { return cuTensorHandle_; }
@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_thread_context_pool.hpp"
+
+#include <unordered_map>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+int highest_stream_priority() {
+    int leastPriority = 0;
+    int greatestPriority = 0;
+    throwIfError(cudaDeviceGetStreamPriorityRange(&leastPriority, &greatestPriority));
+    return greatestPriority;
+}
+
+}  // namespace
+
+std::shared_ptr<ThreadContextPool> ThreadContextPool::forDevice(CUDA::Device device) {
+    static std::mutex mutex;
+    static std::unordered_map<int, std::weak_ptr<ThreadContextPool>> pools;
+    std::lock_guard<std::mutex> lock{mutex};
+    auto& pool = pools[device.getId()];
+    auto result = pool.lock();
+    if (!result) {
+        result = std::make_shared<ThreadContextPool>(device);
+        pool = result;
+    }
+    return result;
+}
+
+ThreadContextPool::Lease ThreadContextPool::acquire(const bool highPriority) {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        auto& contexts = free_contexts_[highPriority ? 1 : 0];
+        if (!contexts.empty()) {
+            auto context = std::move(contexts.back());
+            contexts.pop_back();
+            return Lease{shared_from_this(), std::move(context), highPriority};
+        }
+    }
+    // Streams and handles are created outside of the lock, so other threads lease free contexts meanwhile
+    const int priority = highPriority ? highest_stream_priority() : 0;
+    auto context = std::make_unique<ThreadContext>(device_, priority, partition_.get());
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        ++size_;
+    }
+    return Lease{shared_from_this(), std::move(context), highPriority};
+}
+
+std::size_t ThreadContextPool::size() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return size_;
+}
+
+void ThreadContextPool::release(std::unique_ptr<ThreadContext> context, const bool highPriority) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    free_contexts_[highPriority ? 1 : 0].push_back(std::move(context));
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
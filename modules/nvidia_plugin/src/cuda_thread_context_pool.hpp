@@ -0,0 +1,84 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cuda_thread_context.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Pool of thread contexts (CUDA streams and cuDNN/cuBLAS/cuTENSOR handles) of a device.
+ *
+ * Threads of all CudaThreadPool instances of the device lease a context for the time of a task, so the number
+ * of contexts follows the number of tasks executed concurrently rather than the number of threads. Contexts are
+ * created on demand and kept until the pool is destroyed; the most recently released context is leased first,
+ * so a thread which executes tasks one after another keeps using the same streams.
+ */
+class ThreadContextPool : public std::enable_shared_from_this<ThreadContextPool> {
+public:
+    /**
+     * @brief Returns the context to the pool when it is destroyed
+     */
+    class Lease {
+    public:
+        Lease(std::shared_ptr<ThreadContextPool> pool, std::unique_ptr<ThreadContext> context, bool highPriority)
+            : pool_{std::move(pool)}, context_{std::move(context)}, high_priority_{highPriority} {}
+        Lease(Lease&&) noexcept = default;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&&) = delete;
+        ~Lease() {
+            if (pool_ && context_) {
+                pool_->release(std::move(context_), high_priority_);
+            }
+        }
+
+        const ThreadContext& get() const noexcept { return *context_; }
+
+    private:
+        std::shared_ptr<ThreadContextPool> pool_;
+        std::unique_ptr<ThreadContext> context_;
+        bool high_priority_;
+    };
+
+    /**
+     * @param partition Partition of SMs of the device the contexts are created in, nullptr for all SMs
+     */
+    explicit ThreadContextPool(CUDA::Device device, std::shared_ptr<CUDA::GreenContext> partition = nullptr)
+        : device_{device}, partition_{std::move(partition)} {}
+
+    /**
+     * @returns Pool shared by all thread pools of the device, it is created by the first call for the device
+     */
+    static std::shared_ptr<ThreadContextPool> forDevice(CUDA::Device device);
+
+    /**
+     * @param highPriority Whether CUDA streams of the context have the greatest priority of the device
+     * @returns Lease of a free context, a new context is created if all contexts are leased
+     */
+    Lease acquire(bool highPriority = false);
+
+    /**
+     * @returns Number of contexts created by the pool so far
+     */
+    std::size_t size() const;
+
+private:
+    void release(std::unique_ptr<ThreadContext> context, bool highPriority);
+
+    CUDA::Device device_;
+    std::shared_ptr<CUDA::GreenContext> partition_;
+    mutable std::mutex mtx_;
+    std::vector<std::unique_ptr<ThreadContext>> free_contexts_[2];
+    std::size_t size_ = 0;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
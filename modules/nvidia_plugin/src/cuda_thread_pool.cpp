@@ -6,6 +6,10 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <functional>
+#include <optional>
+
 #include <details/ie_exception.hpp>
 
 #include "cuda_latch.hpp"
@@ -13,32 +17,135 @@
 namespace ov {
 namespace nvidia_gpu {
 
-static thread_local ThreadContext* contextPtr = nullptr;
+static thread_local const ThreadContext* contextPtr = nullptr;
+static thread_local const CudaThreadPool* ownerPoolPtr = nullptr;
+static thread_local std::size_t ownQueueIndex = 0;
+
+namespace {
+
+/**
+ * @returns Index of the queue level, tasks of the lower level are taken first
+ */
+std::size_t priority_level(ov::hint::Priority priority) {
+    switch (priority) {
+        case ov::hint::Priority::HIGH:
+            return 0;
+        case ov::hint::Priority::LOW:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+}  // namespace
+
+void CudaThreadPool::TaskQueue::push(Task task, std::size_t level) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    tasks_[level].push_back(std::move(task));
+    sizes_[level].fetch_add(1);
+}
 
-CudaThreadPool::CudaThreadPool(CUDA::Device d, unsigned _numThreads) {
+bool CudaThreadPool::TaskQueue::try_pop(std::size_t level, Task& task) {
+    // Queue is checked without locking first, so scanning of empty queues doesn't contend with producers
+    if (sizes_[level].load() == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& tasks = tasks_[level];
+    if (tasks.empty()) {
+        return false;
+    }
+    task = std::move(tasks.front());
+    tasks.pop_front();
+    sizes_[level].fetch_sub(1);
+    return true;
+}
+
+void CudaThreadPool::DeadlineQueue::push(Task task, std::size_t level, Clock::time_point deadline) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& tasks = tasks_[level];
+    tasks.push_back({deadline, sequence_++, std::move(task)});
+    std::push_heap(tasks.begin(), tasks.end(), std::greater<Entry>{});
+    sizes_[level].fetch_add(1);
+}
+
+bool CudaThreadPool::DeadlineQueue::try_pop(std::size_t level, Task& task) {
+    if (sizes_[level].load() == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& tasks = tasks_[level];
+    if (tasks.empty()) {
+        return false;
+    }
+    std::pop_heap(tasks.begin(), tasks.end(), std::greater<Entry>{});
+    task = std::move(tasks.back().task);
+    tasks.pop_back();
+    sizes_[level].fetch_sub(1);
+    return true;
+}
+
+CudaThreadPool::CudaThreadPool(CUDA::Device d, unsigned _numThreads, std::shared_ptr<CUDA::GreenContext> partition)
+    : contexts_{partition ? std::make_shared<ThreadContextPool>(d, partition) : ThreadContextPool::forDevice(d)} {
+    for (unsigned i = 0; i < _numThreads; ++i) {
+        queues_.push_back(std::make_unique<TaskQueue>());
+    }
+    {
+        // Contexts for all threads are created up front, so first inferences don't create streams and handles
+        std::vector<ThreadContextPool::Lease> leases;
+        for (unsigned i = 0; i < _numThreads; ++i) {
+            leases.push_back(contexts_->acquire());
+        }
+    }
+    if (partition) {
+        // Contexts of the partition leave its green context current, the calling thread continues in the primary one
+        d.setCurrent();
+    }
     try {
+        const auto node = CUDA::NumaNode::of(d);
         CudaLatch latch{_numThreads};
-        for (int i = 0; i < _numThreads; ++i) {
-            threads_.emplace_back([this, d, &latch] {
-                ThreadContext context{d};
-                contextPtr = &context;
+        for (unsigned i = 0; i < _numThreads; ++i) {
+            threads_.emplace_back([this, d, partition, node, i, &latch] {
+                if (partition) {
+                    partition->setCurrent();
+                } else {
+                    d.setCurrent();
+                }
+                // Host-to-device copies and kernel launches of tasks don't cross sockets
+                node.bindCurrentThread();
+                ownerPoolPtr = this;
+                ownQueueIndex = i;
                 latch.count_down();
-                while (true) {
+                while (!is_stopped_.load()) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(mtx_);
-                        queue_cond_var_.wait(lock, [&] { return !task_queue_.empty() || is_stopped_; });
-                        if (is_stopped_) {
-                            break;
+                    std::size_t level = 0;
+                    if (try_pop(i, task, level)) {
+                        std::optional<ThreadContextPool::Lease> lease;
+                        if (level == priority_level(ov::hint::Priority::HIGH)) {
+                            try {
+                                lease.emplace(contexts_->acquire(true));
+                            } catch (...) {
+                                // Task is executed with default priority streams
+                            }
                         }
-                        if (!task_queue_.empty()) {
-                            task = std::move(task_queue_.front());
-                            task_queue_.pop_front();
+                        try {
+                            if (!lease) {
+                                lease.emplace(contexts_->acquire());
+                            }
+                        } catch (...) {
+                            // Task fails when it requests the thread context
                         }
-                    }
-                    if (task) {
+                        contextPtr = lease ? &lease->get() : nullptr;
                         task();
+                        contextPtr = nullptr;
+                        continue;
                     }
+                    std::unique_lock<std::mutex> lock(mtx_);
+                    // Producer increments number of pending tasks before it checks number of sleeping threads,
+                    // so either the task is seen here or the producer notifies this thread
+                    sleeping_threads_.fetch_add(1);
+                    queue_cond_var_.wait(lock, [&] { return pending_tasks_.load() != 0 || is_stopped_.load(); });
+                    sleeping_threads_.fetch_sub(1);
                 }
             });
         }
@@ -54,7 +161,7 @@ CudaThreadPool::~CudaThreadPool() { stop_thread_pool(); }
 void CudaThreadPool::stop_thread_pool() noexcept {
     {
         std::lock_guard<std::mutex> lock(mtx_);
-        is_stopped_ = true;
+        is_stopped_.store(true);
     }
     queue_cond_var_.notify_all();
     threads_.clear();
@@ -63,18 +170,53 @@ void CudaThreadPool::stop_thread_pool() noexcept {
 const ThreadContext& CudaThreadPool::get_thread_context() {
     if (!contextPtr) {
         throw_ov_exception(
-            "Call get_thread_context() not from ThreadPool owned thread is not "
-            "allowed !!");
+            "Call get_thread_context() not from a task of ThreadPool or without available thread context "
+            "is not allowed !!");
     }
     return *contextPtr;
 }
 
-void CudaThreadPool::run(Task task) {
-    {
+void CudaThreadPool::run(Task task) { run(std::move(task), ov::hint::Priority::MEDIUM); }
+
+void CudaThreadPool::run(Task task, ov::hint::Priority priority) {
+    // Task scheduled from a thread of the pool stays in its queue, other threads steal it if they are idle
+    const auto index = ownerPoolPtr == this ? ownQueueIndex : next_queue_.fetch_add(1) % queues_.size();
+    queues_[index]->push(std::move(task), priority_level(priority));
+    notify_task();
+}
+
+void CudaThreadPool::run(Task task, ov::hint::Priority priority, std::optional<Clock::time_point> deadline) {
+    if (!deadline) {
+        run(std::move(task), priority);
+        return;
+    }
+    deadline_queue_.push(std::move(task), priority_level(priority), *deadline);
+    notify_task();
+}
+
+void CudaThreadPool::notify_task() {
+    pending_tasks_.fetch_add(1);
+    if (sleeping_threads_.load() != 0) {
         std::lock_guard<std::mutex> lock(mtx_);
-        task_queue_.push_back(task);
+        queue_cond_var_.notify_one();
+    }
+}
+
+bool CudaThreadPool::try_pop(std::size_t index, Task& task, std::size_t& level) {
+    const auto numQueues = queues_.size();
+    for (level = 0; level < kNumPriorities; ++level) {
+        if (deadline_queue_.try_pop(level, task)) {
+            pending_tasks_.fetch_sub(1);
+            return true;
+        }
+        for (std::size_t k = 0; k < numQueues; ++k) {
+            if (queues_[(index + k) % numQueues]->try_pop(level, task)) {
+                pending_tasks_.fetch_sub(1);
+                return true;
+            }
+        }
     }
-    queue_cond_var_.notify_one();
+    return false;
 }
 
 }  // namespace nvidia_gpu
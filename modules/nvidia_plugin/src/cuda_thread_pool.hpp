@@ -4,38 +4,177 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <cuda_thread_context.hpp>
+#include <cuda_thread_context_pool.hpp>
 #include <deque>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <thread>
 #include <threading/ie_itask_executor.hpp>
 
 #include "cuda_jthread.hpp"
+#include "openvino/runtime/properties.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * @brief Pool of threads executing tasks with CUDA thread contexts.
+ *
+ * Each thread has its own task queue, tasks are distributed over queues in a round robin manner
+ * (or put into the queue of the calling thread if it belongs to the pool), idle threads steal tasks
+ * from queues of other threads. Tasks of higher priority are taken by threads before queued tasks of
+ * lower priority. Among tasks of the same priority, tasks with deadlines are taken first in the order of their
+ * deadlines (earliest deadline first) from a queue shared by all threads. Tasks of high priority are executed
+ * with a thread context which CUDA streams have the greatest priority of the device, so their kernels are
+ * scheduled ahead of kernels of other tasks.
+ * Threads don't own thread contexts: each task is executed with a context leased from ThreadContextPool
+ * shared by all thread pools of the device. A pool of a partition of SMs of the device has its own contexts
+ * created in the green context of the partition, which is current for its threads.
+ * Threads are bound to CPUs of the NUMA node the device is attached to (see CUDA::NumaNode).
+ */
 class CudaThreadPool : public ov::threading::ITaskExecutor {
 public:
     using Task = std::function<void()>;
+    using Clock = std::chrono::steady_clock;
 
-    CudaThreadPool(CUDA::Device d, unsigned _numThreads);
+    /**
+     * @param partition Partition of SMs of the device tasks are executed on, nullptr for all SMs
+     */
+    CudaThreadPool(CUDA::Device d, unsigned _numThreads, std::shared_ptr<CUDA::GreenContext> partition = nullptr);
     ~CudaThreadPool() override;
     const ThreadContext& get_thread_context();
     void run(Task task) override;
 
+    /**
+     * Schedules the task ahead of already queued tasks of lower priority
+     */
+    void run(Task task, ov::hint::Priority priority);
+
+    /**
+     * Schedules the task ahead of already queued tasks of lower priority and tasks of the same priority with later
+     * deadlines or without them
+     * @param deadline Deadline of the task, std::nullopt if the task is queued in the order of arrival
+     */
+    void run(Task task, ov::hint::Priority priority, std::optional<Clock::time_point> deadline);
+
+    /**
+     * @returns Number of queued tasks which aren't taken by threads yet
+     */
+    std::size_t queue_length() const noexcept {
+        // The task may be taken before it is counted, so the counter transiently wraps below zero
+        const auto length = pending_tasks_.load(std::memory_order_relaxed);
+        return static_cast<std::ptrdiff_t>(length) < 0 ? 0 : length;
+    }
+
 private:
+    static constexpr std::size_t kNumPriorities = 3;
+
+    class TaskQueue {
+    public:
+        void push(Task task, std::size_t level);
+        bool try_pop(std::size_t level, Task& task);
+
+    private:
+        std::mutex mtx_;
+        std::array<std::atomic<std::size_t>, kNumPriorities> sizes_{};
+        std::array<std::deque<Task>, kNumPriorities> tasks_;
+    };
+
+    /**
+     * Tasks with deadlines of all threads, which are ordered by deadlines and then by arrival
+     */
+    class DeadlineQueue {
+    public:
+        void push(Task task, std::size_t level, Clock::time_point deadline);
+        bool try_pop(std::size_t level, Task& task);
+
+    private:
+        struct Entry {
+            Clock::time_point deadline;
+            std::size_t sequence;
+            Task task;
+
+            bool operator>(const Entry& other) const {
+                return deadline != other.deadline ? deadline > other.deadline : sequence > other.sequence;
+            }
+        };
+
+        std::mutex mtx_;
+        std::size_t sequence_ = 0;
+        std::array<std::atomic<std::size_t>, kNumPriorities> sizes_{};
+        // Min-heaps of deadlines
+        std::array<std::vector<Entry>, kNumPriorities> tasks_;
+    };
+
+    bool try_pop(std::size_t index, Task& task, std::size_t& level);
+    void notify_task();
     void stop_thread_pool() noexcept;
 
+    std::shared_ptr<ThreadContextPool> contexts_;
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    DeadlineQueue deadline_queue_;
+    std::atomic<std::size_t> next_queue_{0};
+    std::atomic<std::size_t> pending_tasks_{0};
+    std::atomic<std::size_t> sleeping_threads_{0};
+    std::atomic<bool> is_stopped_{false};
     std::mutex mtx_;
-    bool is_stopped_ = false;
     std::condition_variable queue_cond_var_;
-    std::deque<Task> task_queue_;
     std::vector<CudaJThread> threads_;
 };
 
+/**
+ * @brief Executor which schedules tasks to CudaThreadPool with the given priority and the deadline of the inference
+ */
+class CudaPriorityExecutor : public ov::threading::ITaskExecutor {
+public:
+    using Deadline = std::function<std::optional<CudaThreadPool::Clock::time_point>()>;
+
+    /**
+     * @param deadline Returns the deadline of the task being scheduled, nullptr if tasks have no deadlines
+     */
+    CudaPriorityExecutor(std::shared_ptr<CudaThreadPool> threadPool,
+                         ov::hint::Priority priority,
+                         Deadline deadline = nullptr)
+        : thread_pool_{std::move(threadPool)}, priority_{priority}, deadline_{std::move(deadline)} {}
+
+    void run(ov::threading::Task task) override {
+        thread_pool_->run(std::move(task), priority_, deadline_ ? deadline_() : std::nullopt);
+    }
+
+private:
+    std::shared_ptr<CudaThreadPool> thread_pool_;
+    ov::hint::Priority priority_;
+    Deadline deadline_;
+};
+
+/**
+ * @brief Executor which executes tasks of another executor on threads bound to CPUs of the NUMA node. Threads shared
+ * with executors of other nodes are rebound by tasks of each of them
+ */
+class NumaBoundExecutor : public ov::threading::ITaskExecutor {
+public:
+    NumaBoundExecutor(std::shared_ptr<ov::threading::ITaskExecutor> executor, CUDA::NumaNode node)
+        : executor_{std::move(executor)}, node_{node} {}
+
+    void run(ov::threading::Task task) override {
+        executor_->run([node = node_, task = std::move(task)] {
+            node.bindCurrentThread();
+            task();
+        });
+    }
+
+private:
+    std::shared_ptr<ov::threading::ITaskExecutor> executor_;
+    CUDA::NumaNode node_;
+};
+
 }  // namespace nvidia_gpu
 }  // namespace ov
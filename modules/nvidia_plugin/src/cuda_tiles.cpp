@@ -0,0 +1,316 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_tiles.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <error.hpp>
+#include <map>
+
+#include "openvino/op/avg_pool.hpp"
+#include "openvino/op/batch_norm.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/elu.hpp"
+#include "openvino/op/fake_quantize.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/hsigmoid.hpp"
+#include "openvino/op/hswish.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/mish.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/prelu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softplus.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+/**
+ * Tensor, which depends on the input of the model: its pixel x depends on pixels of the input in
+ * [x * stride - halo, x * stride + stride - 1 + halo]
+ */
+struct SpatialTensor {
+    std::size_t stride;
+    std::size_t halo;
+};
+
+using SpatialTensors = std::map<ov::Output<ov::Node>, SpatialTensor>;
+
+bool isElementwise(const ov::Node& node) {
+    return ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(&node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(&node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseComparison>(&node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseLogical>(&node) || ov::is_type<ov::op::v0::Clamp>(&node) ||
+           ov::is_type<ov::op::v0::Elu>(&node) || ov::is_type<ov::op::v0::Gelu>(&node) ||
+           ov::is_type<ov::op::v7::Gelu>(&node) || ov::is_type<ov::op::v4::Swish>(&node) ||
+           ov::is_type<ov::op::v4::HSwish>(&node) || ov::is_type<ov::op::v5::HSigmoid>(&node) ||
+           ov::is_type<ov::op::v4::Mish>(&node) || ov::is_type<ov::op::v4::SoftPlus>(&node) ||
+           ov::is_type<ov::op::v0::Convert>(&node) || ov::is_type<ov::op::v0::FakeQuantize>(&node) ||
+           ov::is_type<ov::op::v1::Select>(&node);
+}
+
+/**
+ * Operations, which parameters are aligned to channels of the data rather than broadcasted by numpy rules
+ */
+bool isPerChannel(const ov::Node& node) {
+    return ov::is_type<ov::op::v0::PRelu>(&node) || ov::is_type<ov::op::v0::BatchNormInference>(&node) ||
+           ov::is_type<ov::op::v5::BatchNormInference>(&node);
+}
+
+/**
+ * @returns true if the operand is the same for all pixels of the data it's broadcasted to
+ */
+bool isSpatiallyBroadcasted(const ov::Output<ov::Node>& operand) {
+    const auto& shape = operand.get_partial_shape();
+    if (shape.rank().is_dynamic()) {
+        return false;
+    }
+    const auto rank = shape.size();
+    for (std::size_t i = rank > 2 ? rank - 2 : 0; i < rank; ++i) {
+        if (shape[i] != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @returns Tensor computed by a sliding window over the spatial tensor
+ */
+template <typename Pads>
+SpatialTensor window(const ov::Node& node,
+                     const SpatialTensor& input,
+                     const std::array<std::size_t, 2>& extents,
+                     const ov::Strides& strides,
+                     const Pads& pads_begin,
+                     ov::op::PadType auto_pad) {
+    if (strides.size() != 2 || strides[0] != strides[1]) {
+        throw_ov_exception(
+            fmt::format("Tiles: strides of {} differ along spatial dimensions", node.get_friendly_name()));
+    }
+    std::size_t extension = 0;
+    for (std::size_t i = 0; i < extents.size(); ++i) {
+        std::size_t pad = 0;
+        if (auto_pad == ov::op::PadType::SAME_UPPER || auto_pad == ov::op::PadType::SAME_LOWER) {
+            // Padding depends on the size of the input, so the largest one is assumed
+            pad = extents[i] - 1;
+        } else if (auto_pad != ov::op::PadType::VALID) {
+            pad = static_cast<std::size_t>(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(pads_begin[i]), 0));
+        }
+        const std::size_t before = pad;
+        const std::size_t after = extents[i] > strides[i] + pad ? extents[i] - strides[i] - pad : 0;
+        extension = std::max({extension, before, after});
+    }
+    return SpatialTensor{input.stride * strides[0], input.halo + extension * input.stride};
+}
+
+std::array<std::size_t, 2> extentsOf(const ov::Node& node,
+                                     const ov::PartialShape& kernel,
+                                     const ov::Strides& dilations) {
+    const auto rank = kernel.rank();
+    if (rank.is_dynamic() || kernel.size() < 2 || kernel[kernel.size() - 2].is_dynamic() ||
+        kernel[kernel.size() - 1].is_dynamic()) {
+        throw_ov_exception(fmt::format("Tiles: kernel of {} isn't static", node.get_friendly_name()));
+    }
+    std::array<std::size_t, 2> extents;
+    for (std::size_t i = 0; i < extents.size(); ++i) {
+        const auto size = static_cast<std::size_t>(kernel[kernel.size() - 2 + i].get_length());
+        const auto dilation = dilations.empty() ? 1 : dilations[i];
+        extents[i] = dilation * (size - 1) + 1;
+    }
+    return extents;
+}
+
+SpatialTensor merge(const ov::Node& node, const std::vector<SpatialTensor>& inputs) {
+    SpatialTensor output = inputs.front();
+    for (const auto& input : inputs) {
+        if (input.stride != output.stride) {
+            throw_ov_exception(
+                fmt::format("Tiles: inputs of {} have different spatial strides", node.get_friendly_name()));
+        }
+        output.halo = std::max(output.halo, input.halo);
+    }
+    return output;
+}
+
+SpatialTensor propagate(const ov::Node& node, const SpatialTensors& tensors) {
+    std::vector<SpatialTensor> spatial_inputs;
+    std::vector<ov::Output<ov::Node>> other_inputs;
+    for (const auto& input : node.inputs()) {
+        const auto source = input.get_source_output();
+        if (const auto found = tensors.find(source); found != tensors.end()) {
+            spatial_inputs.push_back(found->second);
+        } else {
+            other_inputs.push_back(source);
+        }
+    }
+    const auto& name = node.get_friendly_name();
+    if (const auto conv = dynamic_cast<const ov::op::v1::Convolution*>(&node)) {
+        if (tensors.count(conv->input_value(1))) {
+            throw_ov_exception(fmt::format("Tiles: weights of {} depend on the input", name));
+        }
+        return window(node,
+                      spatial_inputs.front(),
+                      extentsOf(node, conv->get_input_partial_shape(1), conv->get_dilations()),
+                      conv->get_strides(),
+                      conv->get_pads_begin(),
+                      conv->get_auto_pad());
+    }
+    if (const auto conv = dynamic_cast<const ov::op::v1::GroupConvolution*>(&node)) {
+        if (tensors.count(conv->input_value(1))) {
+            throw_ov_exception(fmt::format("Tiles: weights of {} depend on the input", name));
+        }
+        return window(node,
+                      spatial_inputs.front(),
+                      extentsOf(node, conv->get_input_partial_shape(1), conv->get_dilations()),
+                      conv->get_strides(),
+                      conv->get_pads_begin(),
+                      conv->get_auto_pad());
+    }
+    if (const auto pool = dynamic_cast<const ov::op::v1::MaxPool*>(&node)) {
+        return window(node,
+                      spatial_inputs.front(),
+                      extentsOf(node, ov::PartialShape{pool->get_kernel()}, {}),
+                      pool->get_strides(),
+                      pool->get_pads_begin(),
+                      pool->get_auto_pad());
+    }
+    if (const auto pool = dynamic_cast<const ov::op::v8::MaxPool*>(&node)) {
+        // Indices are absolute positions in the input, so they differ between tiles
+        if (!pool->output(1).get_target_inputs().empty()) {
+            throw_ov_exception(fmt::format("Tiles: indices of {} are used", name));
+        }
+        return window(node,
+                      spatial_inputs.front(),
+                      extentsOf(node, ov::PartialShape{pool->get_kernel()}, pool->get_dilations()),
+                      pool->get_strides(),
+                      pool->get_pads_begin(),
+                      pool->get_auto_pad());
+    }
+    if (const auto pool = dynamic_cast<const ov::op::v1::AvgPool*>(&node)) {
+        return window(node,
+                      spatial_inputs.front(),
+                      extentsOf(node, ov::PartialShape{pool->get_kernel()}, {}),
+                      pool->get_strides(),
+                      pool->get_pads_begin(),
+                      pool->get_auto_pad());
+    }
+    if (const auto concat = dynamic_cast<const ov::op::v0::Concat*>(&node)) {
+        if (concat->get_concatenation_axis() != 1 || !other_inputs.empty()) {
+            throw_ov_exception(
+                fmt::format("Tiles: {} concatenates tensors along other dimensions than channels", name));
+        }
+        return merge(node, spatial_inputs);
+    }
+    if (isPerChannel(node)) {
+        return merge(node, spatial_inputs);
+    }
+    if (isElementwise(node)) {
+        for (const auto& input : other_inputs) {
+            if (!isSpatiallyBroadcasted(input)) {
+                throw_ov_exception(
+                    fmt::format("Tiles: {} has an operand, which isn't broadcasted over pixels", name));
+            }
+        }
+        return merge(node, spatial_inputs);
+    }
+    throw_ov_exception(fmt::format("Tiles: operation {} of type {} depends on pixels of the input in unsupported way",
+                                   name,
+                                   node.get_type_name()));
+}
+
+}  // namespace
+
+Tiles::Geometry Tiles::analyze(const ov::Model& model) {
+    const auto& parameters = model.get_parameters();
+    if (parameters.size() != 1 || parameters.front()->get_output_partial_shape(0).rank() != 4) {
+        throw_ov_exception("Tiles: model should have a single 4D input");
+    }
+    SpatialTensors tensors;
+    for (const auto& node : model.get_ordered_ops()) {
+        if (ov::is_type<ov::op::v0::Parameter>(node)) {
+            tensors.emplace(node->output(0), SpatialTensor{1, 0});
+            continue;
+        }
+        if (ov::is_type<ov::op::v0::Result>(node)) {
+            continue;
+        }
+        const auto& inputs = node->input_values();
+        const bool is_spatial = std::any_of(inputs.begin(), inputs.end(), [&tensors](const auto& input) {
+            return tensors.count(input) > 0;
+        });
+        if (!is_spatial) {
+            continue;
+        }
+        const auto tensor = propagate(*node, tensors);
+        for (const auto& output : node->outputs()) {
+            tensors.emplace(output, tensor);
+        }
+    }
+    Geometry geometry;
+    for (const auto& result : model.get_results()) {
+        const auto found = tensors.find(result->input_value(0));
+        if (found == tensors.end()) {
+            throw_ov_exception(
+                fmt::format("Tiles: output {} doesn't depend on the input", result->get_friendly_name()));
+        }
+        geometry.halo = std::max(geometry.halo, found->second.halo);
+        geometry.output_strides.push_back(found->second.stride);
+    }
+    return geometry;
+}
+
+std::vector<Tiles::Span> Tiles::split(std::size_t size, std::size_t tile_size, std::size_t halo) {
+    OPENVINO_ASSERT(size >= tile_size && tile_size > 2 * halo);
+    // Tiles are shifted inside of the image at its borders, so their cores begin at multiples of the core size
+    const std::size_t core_size = tile_size - 2 * halo;
+    std::vector<Span> spans;
+    for (std::size_t begin = 0; begin < size; begin += core_size) {
+        const std::size_t end = std::min(begin + core_size, size);
+        const std::size_t origin = std::min(begin > halo ? begin - halo : 0, size - tile_size);
+        spans.push_back(Span{origin, begin, end});
+    }
+    return spans;
+}
+
+Tiles::Tiles(std::shared_ptr<const ov::ICompiledModel> model, std::size_t tile_size, Geometry geometry)
+    : model_{std::move(model)},
+      tile_size_{tile_size},
+      geometry_{std::move(geometry)},
+      model_optimal_number_of_infer_requests_{
+          std::max(1u, model_->get_property(ov::optimal_number_of_infer_requests.name()).as<unsigned>())} {
+    OPENVINO_ASSERT(tile_size_ > 2 * geometry_.halo);
+}
+
+const std::shared_ptr<const ov::ICompiledModel>& Tiles::get_model() const { return model_; }
+
+std::size_t Tiles::get_tile_size() const { return tile_size_; }
+
+const Tiles::Geometry& Tiles::get_geometry() const { return geometry_; }
+
+std::size_t Tiles::get_number_of_lanes() const { return model_optimal_number_of_infer_requests_; }
+
+unsigned Tiles::get_optimal_number_of_infer_requests() const {
+    // Images usually consist of more tiles than lanes, so an inference occupies all of them
+    return 1;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
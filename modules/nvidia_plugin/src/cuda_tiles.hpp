@@ -0,0 +1,92 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Model compiled for square tiles of the spatial dimensions of a fully convolutional model
+ *        (see ov::nvidia_gpu::tile_size).
+ *
+ * Input [N, C, H, W] of every inference is split into overlapping tiles, each of them extends the region of
+ * the image its output is taken from (the core of the tile) by the halo of the receptive field of the model.
+ * Tiles are executed concurrently by lanes of infer requests of the tile model like micro-batches, cores of their
+ * outputs are stitched into outputs of the inference, so device memory doesn't depend on the size of the image.
+ * Tiles are kept inside of the image, so borders of the image are padded by operations like in the original model.
+ */
+class Tiles {
+public:
+    /**
+     * @brief Spatial geometry of a fully convolutional model: the pixel x of an output of the stride S depends on
+     *        pixels of the input in [x * S - halo, x * S + S - 1 + halo]
+     */
+    struct Geometry {
+        std::size_t halo = 0;
+        // Strides of outputs of the model relative to the input in the order of results
+        std::vector<std::size_t> output_strides;
+    };
+
+    /**
+     * @brief Region of a tile along a spatial dimension in pixels of the input
+     */
+    struct Span {
+        // The first pixel of the tile
+        std::size_t origin;
+        // Pixels of the core of the tile [begin, end), which outputs are taken from the tile
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    /**
+     * @param model Model with a single input [N, C, H, W], which depends on it through convolutions, poolings,
+     *              element-wise operations and concatenations of channels only
+     * @throws ov::Exception if other operations depend on the input
+     */
+    static Geometry analyze(const ov::Model& model);
+
+    /**
+     * @returns Spans of tiles of the given size, which cover the dimension. Cores of tiles are at least halo pixels
+     *          away from borders of tiles, which aren't borders of the dimension
+     */
+    static std::vector<Span> split(std::size_t size, std::size_t tile_size, std::size_t halo);
+
+    /**
+     * @param model Model compiled for the input [N, C, tile_size, tile_size]
+     * @param geometry Geometry of the model, which halo is aligned to strides of its outputs
+     */
+    Tiles(std::shared_ptr<const ov::ICompiledModel> model, std::size_t tile_size, Geometry geometry);
+
+    const std::shared_ptr<const ov::ICompiledModel>& get_model() const;
+
+    std::size_t get_tile_size() const;
+
+    const Geometry& get_geometry() const;
+
+    /**
+     * @returns Number of infer requests of the tile model, which execute tiles of an inference concurrently
+     */
+    std::size_t get_number_of_lanes() const;
+
+    /**
+     * @returns Number of inferences, which are executed concurrently by lanes of the tile model
+     */
+    unsigned get_optimal_number_of_infer_requests() const;
+
+private:
+    std::shared_ptr<const ov::ICompiledModel> model_;
+    std::size_t tile_size_;
+    Geometry geometry_;
+    unsigned model_optimal_number_of_infer_requests_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
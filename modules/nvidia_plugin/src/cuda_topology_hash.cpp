@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_topology_hash.hpp"
+
+#include <fmt/format.h>
+
+#include <functional>
+#include <sstream>
+#include <unordered_map>
+
+#include "openvino/core/attribute_visitor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+/**
+ * Writes attributes of a node into the stream; attributes which aren't of primitive types (e.g. data of constants)
+ * are represented only by their names
+ */
+class AttributesWriter : public ov::AttributeVisitor {
+public:
+    explicit AttributesWriter(std::ostream& stream) : stream_{stream} {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override { stream_ << name << ';'; }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int>>& adapter) override {
+        writeVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        writeVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        writeVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        writeVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        writeVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        // Bodies of TensorIterator, Loop, If
+        write(name, topologyHash(*adapter.get()));
+    }
+
+private:
+    template <typename T>
+    void write(const std::string& name, const T& value) {
+        stream_ << name << '=' << value << ';';
+    }
+    template <typename T>
+    void writeVector(const std::string& name, const std::vector<T>& values) {
+        stream_ << name << "=[";
+        for (const auto& value : values) {
+            stream_ << value << ',';
+        }
+        stream_ << "];";
+    }
+
+    std::ostream& stream_;
+};
+
+}  // namespace
+
+std::string topologyHash(const ov::Model& model) {
+    std::ostringstream topology;
+    std::unordered_map<const ov::Node*, size_t> indices;
+    for (const auto& node : model.get_ordered_ops()) {
+        indices.emplace(node.get(), indices.size());
+        topology << node->get_type_info().name << '/' << node->get_type_info().get_version() << '(';
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            topology << indices.at(source.get_node()) << ':' << source.get_index() << ',';
+        }
+        topology << ")->(";
+        for (const auto& output : node->outputs()) {
+            topology << output.get_element_type() << output.get_partial_shape() << ',';
+        }
+        topology << "){";
+        AttributesWriter attributes{topology};
+        node->visit_attributes(attributes);
+        topology << "}\n";
+    }
+    return fmt::format("{:016x}", std::hash<std::string>{}(topology.str()));
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,24 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Computes hash of the structure of the model, which doesn't depend on values of constants.
+ *
+ * Types, attributes, element types and shapes of nodes and connections between them are hashed,
+ * so models which differ only in weights (e.g. fine-tuned versions of the same model) have the same hash
+ * @returns Hexadecimal string of the hash
+ */
+std::string topologyHash(const ov::Model& model);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
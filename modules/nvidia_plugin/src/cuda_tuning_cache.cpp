@@ -0,0 +1,136 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_tuning_cache.hpp"
+
+#include <cudnn.h>
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr char kKeySeparator = '\t';
+
+/**
+ * Algorithms selected on one GPU model or with other versions of libraries may be slower or unsupported,
+ * so each combination of them has its own file
+ */
+std::string environmentTag(const CUDA::Device& device) {
+    const auto props = device.props();
+    int driverVersion = 0;
+    throwIfError(cudaDriverGetVersion(&driverVersion));
+    return fmt::format("{};{}.{};{};{}", props.name, props.major, props.minor, driverVersion, cudnnGetVersion());
+}
+
+}  // namespace
+
+std::shared_ptr<TuningCache> TuningCache::open(const std::string& cacheDir, const CUDA::Device& device) {
+    if (cacheDir.empty()) {
+        return nullptr;
+    }
+    const auto tag = environmentTag(device);
+    const auto fileName = fmt::format("nvidia_tuning_{:016x}.cache", std::hash<std::string>{}(tag));
+    const auto path = (std::filesystem::path{cacheDir} / fileName).string();
+    static std::mutex registryMutex;
+    static std::unordered_map<std::string, std::weak_ptr<TuningCache>> registry;
+    std::lock_guard<std::mutex> lock{registryMutex};
+    auto& registered = registry[path];
+    auto cache = registered.lock();
+    if (!cache) {
+        std::error_code error;
+        std::filesystem::create_directories(cacheDir, error);
+        cache = std::make_shared<TuningCache>(path);
+        registered = cache;
+    }
+    return cache;
+}
+
+std::shared_ptr<TuningCache> TuningCache::createForModel(const std::string& cacheDir,
+                                                         const CUDA::Device& device,
+                                                         const std::string& topologyHash) {
+    if (topologyHash.empty()) {
+        return std::make_shared<TuningCache>(std::string{}, open(cacheDir, device));
+    }
+    const auto key = fmt::format("{}\n{}\n{}", environmentTag(device), cacheDir, topologyHash);
+    static std::mutex registryMutex;
+    static std::unordered_map<std::string, std::weak_ptr<TuningCache>> registry;
+    std::shared_ptr<TuningCache> topologyCache;
+    {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        auto& registered = registry[key];
+        topologyCache = registered.lock();
+        if (!topologyCache) {
+            topologyCache = std::make_shared<TuningCache>(std::string{}, open(cacheDir, device));
+            registered = topologyCache;
+        }
+    }
+    return std::make_shared<TuningCache>(std::string{}, std::move(topologyCache));
+}
+
+TuningCache::TuningCache(std::string path, std::shared_ptr<TuningCache> parent)
+    : path_{std::move(path)}, parent_{std::move(parent)} {
+    if (!path_.empty()) {
+        std::ifstream file{path_};
+        read(file);
+    }
+}
+
+void TuningCache::read(std::istream& stream) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    std::string line;
+    while (std::getline(stream, line)) {
+        const auto separator = line.find(kKeySeparator);
+        // Partially written lines (e.g. of a process which was killed) are skipped
+        if (separator == std::string::npos || separator + 1 == line.size()) {
+            continue;
+        }
+        entries_[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+}
+
+std::optional<std::string> TuningCache::find(const std::string& key) {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        const auto entry = entries_.find(key);
+        if (entry != entries_.end()) {
+            return entry->second;
+        }
+    }
+    auto value = parent_ ? parent_->find(key) : std::nullopt;
+    if (value) {
+        // Algorithm found in the on-disk cache is recorded, so that it is exported with the model
+        std::lock_guard<std::mutex> lock{mtx_};
+        entries_.emplace(key, *value);
+    }
+    return value;
+}
+
+void TuningCache::store(const std::string& key, const std::string& value) {
+    if (parent_) {
+        parent_->store(key, value);
+    }
+    std::lock_guard<std::mutex> lock{mtx_};
+    entries_[key] = value;
+    if (!path_.empty()) {
+        // The cache is only an optimization, so failure to write it doesn't fail the compilation
+        std::ofstream file{path_, std::ios::app};
+        file << key << kKeySeparator << value << '\n';
+    }
+}
+
+void TuningCache::write(std::ostream& stream) const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    for (const auto& entry : entries_) {
+        stream << entry.first << kKeySeparator << entry.second << '\n';
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,88 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/runtime.hpp>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief On-disk cache of algorithms selected by benchmarks of operations (e.g. cuDNN convolutions).
+ *
+ * Entries are stored in a file of ov::cache_dir, which is specific for the GPU model, CUDA driver and cuDNN
+ * versions, so that benchmarked algorithms are reused by next compilations and processes without benchmarking.
+ * The file is appended on each new entry, the last entry of the same key wins.
+ * Each compiled model has its own in-memory cache on top of the on-disk one, which records algorithms
+ * used by the model, so that they are exported together with the model
+ */
+class TuningCache {
+public:
+    /**
+     * Opens the cache of the device located in the directory, the same instance is shared by all compilations
+     * @param cacheDir Directory of the cache (ov::cache_dir)
+     * @param device Device which algorithms are cached
+     * @returns Cache or nullptr if the directory is empty
+     */
+    static std::shared_ptr<TuningCache> open(const std::string& cacheDir, const CUDA::Device& device);
+
+    /**
+     * Creates in-memory cache of a compiled model
+     * @param cacheDir Directory of the on-disk cache (ov::cache_dir), which is used if the algorithm isn't cached
+     *                 in memory; no on-disk cache is used if the directory is empty
+     * @param device Device which algorithms are cached
+     * @param topologyHash Hash of the transformed model (see topologyHash()); if it isn't empty, the cache is
+     *                     on top of an in-memory cache shared by all live models of the same topology, so that
+     *                     a model which differs only in weights reuses their algorithms even without ov::cache_dir
+     */
+    static std::shared_ptr<TuningCache> createForModel(const std::string& cacheDir,
+                                                       const CUDA::Device& device,
+                                                       const std::string& topologyHash = {});
+
+    /**
+     * @param key Key of the operation (operation type and parameters)
+     * @returns Cached algorithm of the operation
+     */
+    std::optional<std::string> find(const std::string& key);
+
+    /**
+     * Stores algorithm of the operation in the cache and in the file of the cache
+     * @param key Key of the operation (operation type and parameters), shouldn't contain tabs and new lines
+     * @param value Algorithm of the operation, shouldn't contain new lines
+     */
+    void store(const std::string& key, const std::string& value);
+
+    /**
+     * Writes entries of the cache (but not of the on-disk cache under the in-memory one)
+     */
+    void write(std::ostream& stream) const;
+
+    /**
+     * Reads entries written by write() into the cache
+     */
+    void read(std::istream& stream);
+
+    /**
+     * @param path File of the cache, empty path means the cache is kept only in memory
+     * @param parent Cache which is used if the algorithm isn't found in this one
+     */
+    explicit TuningCache(std::string path, std::shared_ptr<TuningCache> parent = nullptr);
+
+private:
+    const std::string path_;
+    const std::shared_ptr<TuningCache> parent_;
+    mutable std::mutex mtx_;
+    std::unordered_map<std::string, std::string> entries_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
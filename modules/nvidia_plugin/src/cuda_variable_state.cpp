@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_variable_state.hpp"
+
+#include <cstdint>
+#include <memory_manager/model/details/cuda_memory_utils.hpp>
+#include <openvino/core/except.hpp>
+
+#include "openvino/runtime/iremote_tensor.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+VariableState::VariableState(const ov::op::util::VariableInfo& info)
+    : ov::IVariableState{info.variable_id},
+      element_type_{info.data_type},
+      shape_{[&info] {
+          OPENVINO_ASSERT(info.data_shape.is_static(),
+                          "NVIDIA plugin supports only variables of static shape, variable ",
+                          info.variable_id,
+                          " has shape ",
+                          info.data_shape);
+          return info.data_shape.to_shape();
+      }()},
+      size_{element_type_.size() * ov::shape_size(shape_)},
+      memory_{CUDA::DefaultStream::stream().malloc(initializedFlagOffset(size_) + sizeof(bool))} {
+    reset();
+}
+
+std::size_t VariableState::initializedFlagOffset(std::size_t size) { return applyAllignment(size); }
+
+bool* VariableState::initializedFlag() const {
+    return reinterpret_cast<bool*>(static_cast<std::uint8_t*>(memory_.get()) + initializedFlagOffset(size_));
+}
+
+void VariableState::reset() {
+    CUDA::DefaultStream::stream().memset(memory_, 0, initializedFlagOffset(size_) + sizeof(bool));
+}
+
+void VariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
+    OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(state._ptr),
+                    "Remote tensors can't be set as state of variable ",
+                    get_name());
+    OPENVINO_ASSERT(state->get_element_type() == element_type_ && state->get_shape() == shape_,
+                    "State of variable ",
+                    get_name(),
+                    " should have type ",
+                    element_type_,
+                    " and shape ",
+                    shape_);
+    auto tensor = ov::make_tensor(state);
+    if (!tensor.is_continuous()) {
+        ov::Tensor continuous{element_type_, shape_};
+        tensor.copy_to(continuous);
+        tensor = continuous;
+    }
+    const bool initialized = true;
+    CUDA::DefaultStream::stream().upload(memory_, tensor.data(), size_);
+    CUDA::DefaultStream::stream().upload(CUDA::DevicePointer<void*>{initializedFlag()}, &initialized, sizeof(bool));
+}
+
+ov::SoPtr<ov::ITensor> VariableState::get_state() const {
+    auto tensor = ov::make_tensor(element_type_, shape_);
+    CUDA::DefaultStream::stream().download(tensor->data(), memory_, size_);
+    return {tensor, nullptr};
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/runtime.hpp>
+#include <memory>
+#include <string>
+
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/ivariable_state.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief State of a variable (see ReadValue/Assign) which is kept in device memory of an infer request.
+ *
+ * Memory of the state is allocated out of the memory block of the infer request, so it is preserved between
+ * inferences. Buffers of ReadValue outputs and Assign inputs are bound to it as external buffers, so the state
+ * isn't transferred to the host unless the user reads or sets it.
+ * The state is followed by a flag which tells whether it has been initialized (see kernel::ReadValue).
+ */
+class VariableState : public ov::IVariableState {
+public:
+    using Ptr = std::shared_ptr<VariableState>;
+
+    /**
+     * @param info Variable with static shape
+     * @throws ov::Exception if shape of the variable isn't static
+     */
+    explicit VariableState(const ov::op::util::VariableInfo& info);
+
+    /**
+     * Zeroes the state and marks it as not initialized, so ReadValue produces its initial value
+     */
+    void reset() override;
+
+    /**
+     * Uploads the value to the device and marks the state as initialized
+     */
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override;
+
+    /**
+     * Downloads the state from the device
+     */
+    ov::SoPtr<ov::ITensor> get_state() const override;
+
+    /**
+     * @returns Device memory of the state
+     */
+    void* data() const { return memory_.get(); }
+
+    /**
+     * @returns Size of the state in bytes
+     */
+    std::size_t size() const { return size_; }
+
+    /**
+     * @param size Size of the state in bytes
+     * @returns Offset of the initialized flag from the beginning of the state
+     */
+    static std::size_t initializedFlagOffset(std::size_t size);
+
+private:
+    bool* initializedFlag() const;
+
+    ov::element::Type element_type_;
+    ov::Shape shape_;
+    std::size_t size_;
+    CUDA::DefaultAllocation memory_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
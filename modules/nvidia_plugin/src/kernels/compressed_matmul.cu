@@ -0,0 +1,167 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "compressed_matmul.hpp"
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned gemv_warps_per_block = 4;
+
+template <bool IsI4>
+__device__ __forceinline__ float quantized_value(const uint8_t* row, size_t ik) {
+    if constexpr (IsI4) {
+        const int nibble = (row[ik / 2] >> ((ik % 2) * 4)) & 0x0F;
+        return static_cast<float>((nibble ^ 0x08) - 0x08);
+    } else {
+        return static_cast<float>(static_cast<int8_t>(row[ik]));
+    }
+}
+
+}  // namespace
+
+/**
+ * Each warp computes one output column for all rows, so that each quantized weight is read once
+ */
+template <typename T, bool IsI4>
+static __global__ void compressed_gemv(size_t rows,
+                                       size_t k,
+                                       size_t n,
+                                       const T* a,
+                                       const uint8_t* weights,
+                                       const T* scales,
+                                       const T* bias,
+                                       T* out) {
+    const size_t in = blockIdx.x * gemv_warps_per_block + threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (in >= n) {
+        return;
+    }
+    const size_t row_size = IsI4 ? (k + 1) / 2 : k;
+    const uint8_t* weights_row = weights + in * row_size;
+
+    float acc[CompressedMatMul::max_gemv_rows] = {};
+    for (size_t ik = lane; ik < k; ik += warp_size) {
+        const float w = quantized_value<IsI4>(weights_row, ik);
+#pragma unroll
+        for (size_t r = 0; r < CompressedMatMul::max_gemv_rows; ++r) {
+            if (r < rows) {
+                acc[r] += static_cast<float>(a[r * k + ik]) * w;
+            }
+        }
+    }
+    const float scale = static_cast<float>(scales[in]);
+#pragma unroll
+    for (size_t r = 0; r < CompressedMatMul::max_gemv_rows; ++r) {
+        if (r < rows) {
+            float sum = acc[r];
+            for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+                sum += __shfl_down_sync(0xFFFFFFFF, sum, offset);
+            }
+            if (lane == 0) {
+                const float b = bias ? static_cast<float>(bias[r * n + in]) : 0.0f;
+                out[r * n + in] = static_cast<T>(sum * scale + b);
+            }
+        }
+    }
+}
+
+template <typename T, bool IsI4>
+static __global__ void dequantize_weights(size_t k, size_t n, const uint8_t* weights, const T* scales, T* out) {
+    const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= n * k) {
+        return;
+    }
+    const size_t in = idx / k;
+    const size_t ik = idx % k;
+    const size_t row_size = IsI4 ? (k + 1) / 2 : k;
+    out[idx] = static_cast<T>(quantized_value<IsI4>(weights + in * row_size, ik) * static_cast<float>(scales[in]));
+}
+
+CompressedMatMul::CompressedMatMul(Type_t element_type,
+                                   Type_t weights_type,
+                                   size_t rows,
+                                   size_t k,
+                                   size_t n,
+                                   size_t max_threads_per_block)
+    : element_type_{element_type},
+      weights_type_{weights_type},
+      rows_{rows},
+      k_{k},
+      n_{n},
+      max_threads_per_block_{max_threads_per_block} {
+    if (element_type_ != Type_t::f32 && element_type_ != Type_t::f16) {
+        throw_ov_exception(
+            fmt::format("Element type = {} is not supported by CompressedMatMul operation !!", element_type_));
+    }
+    if (weights_type_ != Type_t::i8 && weights_type_ != Type_t::i4) {
+        throw_ov_exception(
+            fmt::format("Weights type = {} is not supported by CompressedMatMul operation !!", weights_type_));
+    }
+}
+
+void CompressedMatMul::gemv(cudaStream_t stream,
+                            const void* a,
+                            const void* weights,
+                            const void* scales,
+                            const void* bias,
+                            void* out) const {
+    const bool is_i4 = weights_type_ == Type_t::i4;
+    if (element_type_ == Type_t::f16) {
+        return is_i4 ? callGemv<__half, true>(stream, a, weights, scales, bias, out)
+                     : callGemv<__half, false>(stream, a, weights, scales, bias, out);
+    }
+    return is_i4 ? callGemv<float, true>(stream, a, weights, scales, bias, out)
+                 : callGemv<float, false>(stream, a, weights, scales, bias, out);
+}
+
+void CompressedMatMul::dequantize(cudaStream_t stream, const void* weights, const void* scales, void* out) const {
+    const bool is_i4 = weights_type_ == Type_t::i4;
+    if (element_type_ == Type_t::f16) {
+        return is_i4 ? callDequantize<__half, true>(stream, weights, scales, out)
+                     : callDequantize<__half, false>(stream, weights, scales, out);
+    }
+    return is_i4 ? callDequantize<float, true>(stream, weights, scales, out)
+                 : callDequantize<float, false>(stream, weights, scales, out);
+}
+
+template <typename T, bool IsI4>
+void CompressedMatMul::callGemv(cudaStream_t stream,
+                                const void* a,
+                                const void* weights,
+                                const void* scales,
+                                const void* bias,
+                                void* out) const {
+    const unsigned num_blocks = (n_ + gemv_warps_per_block - 1) / gemv_warps_per_block;
+    compressed_gemv<T, IsI4><<<num_blocks, gemv_warps_per_block * warp_size, 0, stream>>>(
+        rows_,
+        k_,
+        n_,
+        static_cast<const T*>(a),
+        static_cast<const uint8_t*>(weights),
+        static_cast<const T*>(scales),
+        static_cast<const T*>(bias),
+        static_cast<T*>(out));
+}
+
+template <typename T, bool IsI4>
+void CompressedMatMul::callDequantize(cudaStream_t stream, const void* weights, const void* scales, void* out) const {
+    const auto [num_blocks, threads_per_block] = calculateElementwiseGrid(n_ * k_, max_threads_per_block_);
+    dequantize_weights<T, IsI4><<<num_blocks, threads_per_block, 0, stream>>>(
+        k_, n_, static_cast<const uint8_t*>(weights), static_cast<const T*>(scales), static_cast<T*>(out));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Multiplies activations [rows, k] by weights [n, k], which are quantized to i8 or i4 (two values per byte)
+ * with a scale per row of weights
+ */
+class CompressedMatMul {
+public:
+    // Maximal number of rows of activations multiplied by the fused kernel
+    static constexpr size_t max_gemv_rows = 8;
+
+    CompressedMatMul(Type_t element_type,
+                     Type_t weights_type,
+                     size_t rows,
+                     size_t k,
+                     size_t n,
+                     size_t max_threads_per_block);
+    CompressedMatMul(CompressedMatMul&&) = default;
+    CompressedMatMul& operator=(CompressedMatMul&&) = default;
+
+    /**
+     * Computes out[rows, n] = a[rows, k] x dequantized(weights)^T (+ bias[rows, n]) reading quantized weights
+     * directly, which requires rows <= max_gemv_rows
+     */
+    void gemv(cudaStream_t stream,
+              const void* a,
+              const void* weights,
+              const void* scales,
+              const void* bias,
+              void* out) const;
+
+    /**
+     * Writes dequantized weights [n, k] of the element type to out
+     */
+    void dequantize(cudaStream_t stream, const void* weights, const void* scales, void* out) const;
+
+private:
+    template <typename T, bool IsI4>
+    void callGemv(cudaStream_t stream,
+                  const void* a,
+                  const void* weights,
+                  const void* scales,
+                  const void* bias,
+                  void* out) const;
+
+    template <typename T, bool IsI4>
+    void callDequantize(cudaStream_t stream, const void* weights, const void* scales, void* out) const;
+
+    Type_t element_type_{};
+    Type_t weights_type_{};
+    size_t rows_{};
+    size_t k_{};
+    size_t n_{};
+    size_t max_threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -7,6 +7,7 @@
 #include <cuda/float16.hpp>
 
 #include "concat.hpp"
+#include "convert.cuh"
 #include "details/error.hpp"
 #include "details/type_validator.hpp"
 
@@ -14,13 +15,24 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
-template <typename T>
+namespace {
+
+// Element types between which Concat converts data on the fly (see FuseConvertsToConcat)
+using ConvertedElementTypesSwitch = ElementTypesSwitch<Type_t::f32,
+#ifdef CUDA_HAS_BF16_TYPE
+                                                       Type_t::bf16,
+#endif
+                                                       Type_t::f16>;
+
+}  // namespace
+
+template <typename TInput, typename TOutput>
 static __global__ void concat(const Concat::Chunk* chunks,
                               const size_t allChunkSize,
                               const size_t numInputChunks,
                               const size_t chunkSize,
-                              const T* const* src,
-                              T* dst) {
+                              const TInput* const* src,
+                              TOutput* dst) {
     const unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
     if (i >= allChunkSize) {
         return;
@@ -28,10 +40,11 @@ static __global__ void concat(const Concat::Chunk* chunks,
     const unsigned chunkIdx = (i / chunkSize) % numInputChunks;
     const unsigned dataIdx = i % chunkSize;
     const auto& chunk = chunks[chunkIdx];
-    dst[chunkIdx * chunkSize + dataIdx] = (src[chunk.input] + chunk.offset)[dataIdx];
+    dst[chunkIdx * chunkSize + dataIdx] = cast<TOutput>((src[chunk.input] + chunk.offset)[dataIdx]);
 }
 
 Concat::Concat(Type_t element_type,
+               Type_t output_type,
                size_t num_inputs,
                std::vector<Chunk>&& chunks,
                size_t chunk_size,
@@ -39,6 +52,7 @@ Concat::Concat(Type_t element_type,
                size_t num_blocks,
                size_t threadsPerBlock)
     : element_type_{element_type},
+      output_type_{output_type},
       num_inputs_{num_inputs},
       chunks_{std::move(chunks)},
       chunk_size_{chunk_size},
@@ -46,52 +60,99 @@ Concat::Concat(Type_t element_type,
       num_blocks_{num_blocks},
       threads_per_block_{threadsPerBlock} {
     TypeValidator<AllElementTypesSwitch>::check(element_type_);
+    if (output_type_ != element_type_) {
+        TypeValidator<ConvertedElementTypesSwitch>::check(element_type_);
+        TypeValidator<ConvertedElementTypesSwitch>::check(output_type_);
+    }
 }
 
 void Concat::operator()(const cudaStream_t stream, const void* chunks, const void* const* src, void* dst) const {
+    if (output_type_ != element_type_) {
+        return CallByConvertedType(stream, chunks, src, dst);
+    }
     switch (element_type_) {
         case Type_t::boolean:
-            return Call<bool>(stream, chunks, src, dst);
+            return Call<bool, bool>(stream, chunks, src, dst);
 #ifdef CUDA_HAS_BF16_TYPE
         case Type_t::bf16:
-            return Call<__nv_bfloat16>(stream, chunks, src, dst);
+            return Call<__nv_bfloat16, __nv_bfloat16>(stream, chunks, src, dst);
 #endif
         case Type_t::f16:
-            return Call<__half>(stream, chunks, src, dst);
+            return Call<__half, __half>(stream, chunks, src, dst);
         case Type_t::f32:
-            return Call<float>(stream, chunks, src, dst);
+            return Call<float, float>(stream, chunks, src, dst);
         case Type_t::f64:
-            return Call<double>(stream, chunks, src, dst);
+            return Call<double, double>(stream, chunks, src, dst);
         case Type_t::i8:
-            return Call<int8_t>(stream, chunks, src, dst);
+            return Call<int8_t, int8_t>(stream, chunks, src, dst);
         case Type_t::i16:
-            return Call<int16_t>(stream, chunks, src, dst);
+            return Call<int16_t, int16_t>(stream, chunks, src, dst);
         case Type_t::i32:
-            return Call<int32_t>(stream, chunks, src, dst);
+            return Call<int32_t, int32_t>(stream, chunks, src, dst);
         case Type_t::i64:
-            return Call<int64_t>(stream, chunks, src, dst);
+            return Call<int64_t, int64_t>(stream, chunks, src, dst);
         case Type_t::u8:
-            return Call<uint8_t>(stream, chunks, src, dst);
+            return Call<uint8_t, uint8_t>(stream, chunks, src, dst);
         case Type_t::u16:
-            return Call<uint16_t>(stream, chunks, src, dst);
+            return Call<uint16_t, uint16_t>(stream, chunks, src, dst);
         case Type_t::u32:
-            return Call<uint32_t>(stream, chunks, src, dst);
+            return Call<uint32_t, uint32_t>(stream, chunks, src, dst);
         case Type_t::u64:
-            return Call<uint64_t>(stream, chunks, src, dst);
+            return Call<uint64_t, uint64_t>(stream, chunks, src, dst);
         default:
             throw_ov_exception(fmt::format("Input element type = {} is not supported by Split operation !!",
                                          static_cast<Type_t>(element_type_)));
     }
 }
 
-template <typename T>
+void Concat::CallByConvertedType(const cudaStream_t stream,
+                                 const void* chunks,
+                                 const void* const* src,
+                                 void* dst) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return CallByOutputType<__nv_bfloat16>(stream, chunks, src, dst);
+#endif
+        case Type_t::f16:
+            return CallByOutputType<__half>(stream, chunks, src, dst);
+        case Type_t::f32:
+            return CallByOutputType<float>(stream, chunks, src, dst);
+        default:
+            throw_ov_exception(fmt::format("Input element type = {} can't be converted by Concat operation !!",
+                                           static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename TInput>
+void Concat::CallByOutputType(const cudaStream_t stream,
+                              const void* chunks,
+                              const void* const* src,
+                              void* dst) const {
+    switch (output_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return Call<TInput, __nv_bfloat16>(stream, chunks, src, dst);
+#endif
+        case Type_t::f16:
+            return Call<TInput, __half>(stream, chunks, src, dst);
+        case Type_t::f32:
+            return Call<TInput, float>(stream, chunks, src, dst);
+        default:
+            throw_ov_exception(fmt::format("Output element type = {} is not supported by Concat operation !!",
+                                           static_cast<Type_t>(output_type_)));
+    }
+}
+
+template <typename TInput, typename TOutput>
 void Concat::Call(const cudaStream_t stream, const void* chunks, const void* const* src, void* dst) const {
-    concat<T><<<num_blocks_, threads_per_block_, 0, stream>>>(reinterpret_cast<const Chunk*>(chunks),
-                                                              all_chunk_size_,
-                                                              chunks_.size(),
-                                                              chunk_size_,
-                                                              reinterpret_cast<const T* const*>(src),
-                                                              reinterpret_cast<T*>(dst));
+    concat<TInput, TOutput>
+        <<<num_blocks_, threads_per_block_, 0, stream>>>(reinterpret_cast<const Chunk*>(chunks),
+                                                         all_chunk_size_,
+                                                         chunks_.size(),
+                                                         chunk_size_,
+                                                         reinterpret_cast<const TInput* const*>(src),
+                                                         reinterpret_cast<TOutput*>(dst));
 }
 
 }  // namespace kernel
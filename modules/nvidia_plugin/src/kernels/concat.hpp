@@ -21,6 +21,7 @@ public:
     };
 
     Concat(Type_t element_type,
+           Type_t output_type,
            size_t numInputs,
            std::vector<Chunk>&& chunks,
            size_t chunkSize,
@@ -37,10 +38,16 @@ public:
     [[nodiscard]] const void* immutableWbData() const { return chunks_.data(); }
 
 private:
-    template <typename T>
+    void CallByConvertedType(cudaStream_t stream, const void* chunks, const void* const* src, void* dst) const;
+
+    template <typename TInput>
+    void CallByOutputType(cudaStream_t stream, const void* chunks, const void* const* src, void* dst) const;
+
+    template <typename TInput, typename TOutput>
     void Call(cudaStream_t stream, const void* chunks, const void* const* src, void* dst) const;
 
     Type_t element_type_{};
+    Type_t output_type_{};
     size_t num_inputs_{};
     std::vector<Chunk> chunks_;
     size_t chunk_size_{};
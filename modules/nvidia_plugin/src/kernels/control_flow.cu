@@ -0,0 +1,142 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "control_flow.hpp"
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+__device__ void setCondition(const ConditionalHandle handle, const bool condition) {
+#if CUDART_VERSION >= 12030
+    if (handle.valid) {
+        cudaGraphSetConditional(handle.value, condition ? 1u : 0u);
+    }
+#endif
+}
+
+__device__ bool withinLimits(const LoopState& state, const std::int64_t maxIterations) {
+    return (state.trip_count < 0 || state.iteration < state.trip_count) &&
+           (maxIterations < 0 || state.iteration < maxIterations);
+}
+
+}  // namespace
+
+static __global__ void loop_begin(const void* tripCount,
+                                  const bool isTripCount64,
+                                  const bool* executionCondition,
+                                  const std::int64_t maxIterations,
+                                  LoopState* state,
+                                  const ConditionalHandle handle) {
+    LoopState next{};
+    next.trip_count = isTripCount64 ? *static_cast<const std::int64_t*>(tripCount)
+                                    : *static_cast<const std::int32_t*>(tripCount);
+    const bool condition = *executionCondition && withinLimits(next, maxIterations);
+    next.condition = condition;
+    *state = next;
+    setCondition(handle, condition);
+}
+
+static __global__ void loop_iteration(const LoopState* state, void* dst, const bool isIteration64) {
+    if (isIteration64) {
+        *static_cast<std::int64_t*>(dst) = state->iteration;
+    } else {
+        *static_cast<std::int32_t*>(dst) = static_cast<std::int32_t>(state->iteration);
+    }
+}
+
+static __global__ void loop_next(const bool* bodyCondition,
+                                 const std::int64_t maxIterations,
+                                 LoopState* state,
+                                 const ConditionalHandle handle) {
+    ++state->iteration;
+    const bool condition = *bodyCondition && withinLimits(*state, maxIterations);
+    state->condition = condition;
+    setCondition(handle, condition);
+}
+
+static __global__ void if_condition(const bool* condition,
+                                    std::int32_t* flag,
+                                    const ConditionalHandle thenHandle,
+                                    const ConditionalHandle elseHandle) {
+    const bool value = *condition;
+    *flag = value;
+    setCondition(thenHandle, value);
+    setCondition(elseHandle, !value);
+}
+
+static __global__ void iteration_slice(const IterationSlice::Props props,
+                                       const bool isInsert,
+                                       const std::size_t size,
+                                       const LoopState* state,
+                                       const unsigned char* src,
+                                       unsigned char* dst) {
+    const std::size_t i = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= size) {
+        return;
+    }
+    const std::size_t partBytes = props.part_size * props.inner_bytes;
+    const std::size_t outer = i / partBytes;
+    const std::size_t offset = i % partBytes;
+    const std::int64_t start = props.start + state->iteration * props.stride;
+    const std::size_t whole = (outer * props.axis_size + start) * props.inner_bytes + offset;
+    const std::size_t part = outer * partBytes + offset;
+    if (isInsert) {
+        dst[whole] = src[part];
+    } else {
+        dst[part] = src[whole];
+    }
+}
+
+void loopBegin(cudaStream_t stream,
+               const void* tripCount,
+               const bool isTripCount64,
+               const bool* executionCondition,
+               const std::int64_t maxIterations,
+               LoopState* state,
+               const ConditionalHandle handle) {
+    loop_begin<<<1, 1, 0, stream>>>(tripCount, isTripCount64, executionCondition, maxIterations, state, handle);
+}
+
+void loopIteration(cudaStream_t stream, const LoopState* state, void* dst, const bool isIteration64) {
+    loop_iteration<<<1, 1, 0, stream>>>(state, dst, isIteration64);
+}
+
+void loopNext(cudaStream_t stream,
+              const bool* bodyCondition,
+              const std::int64_t maxIterations,
+              LoopState* state,
+              const ConditionalHandle handle) {
+    loop_next<<<1, 1, 0, stream>>>(bodyCondition, maxIterations, state, handle);
+}
+
+void ifCondition(cudaStream_t stream,
+                 const bool* condition,
+                 std::int32_t* flag,
+                 const ConditionalHandle thenHandle,
+                 const ConditionalHandle elseHandle) {
+    if_condition<<<1, 1, 0, stream>>>(condition, flag, thenHandle, elseHandle);
+}
+
+IterationSlice::IterationSlice(const Props& props, const bool isInsert, const std::size_t maxThreadsPerBlock)
+    : props_{props}, is_insert_{isInsert}, size_{props.outer * props.part_size * props.inner_bytes} {
+    std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(size_, maxThreadsPerBlock);
+}
+
+void IterationSlice::operator()(cudaStream_t stream, const LoopState* state, const void* src, void* dst) const {
+    iteration_slice<<<num_blocks_, threads_per_block_, 0, stream>>>(props_,
+                                                                   is_insert_,
+                                                                   size_,
+                                                                   state,
+                                                                   static_cast<const unsigned char*>(src),
+                                                                   static_cast<unsigned char*>(dst));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,106 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Handle of a conditional node of CUDA Graph (cudaGraphConditionalHandle), which the kernels set to the evaluated
+ * condition in addition to device memory. Ignored unless valid, e.g. when the kernels aren't executed by a graph
+ */
+struct ConditionalHandle {
+    unsigned long long value{};
+    bool valid{false};
+};
+
+/**
+ * State of Loop in device memory, which is updated by its kernels, so the condition is never read by the host
+ * in a CUDA Graph
+ */
+struct LoopState {
+    std::int64_t iteration;
+    std::int64_t trip_count;
+    std::int32_t condition;
+};
+
+/**
+ * Initializes the state before the first iteration
+ * @param tripCount Trip count of i32 or i64 type, negative for an infinite loop
+ * @param executionCondition Boolean condition of the first iteration
+ * @param maxIterations Number of iterations, which are never exceeded, negative if unlimited
+ */
+void loopBegin(cudaStream_t stream,
+               const void* tripCount,
+               bool isTripCount64,
+               const bool* executionCondition,
+               std::int64_t maxIterations,
+               LoopState* state,
+               ConditionalHandle handle);
+
+/**
+ * Writes the number of the current iteration into the Parameter of the body
+ */
+void loopIteration(cudaStream_t stream, const LoopState* state, void* dst, bool isIteration64);
+
+/**
+ * Advances the state after an iteration
+ * @param bodyCondition Boolean condition computed by the body for the next iteration
+ */
+void loopNext(cudaStream_t stream,
+              const bool* bodyCondition,
+              std::int64_t maxIterations,
+              LoopState* state,
+              ConditionalHandle handle);
+
+/**
+ * Sets the condition of If, then and else handles are set to the condition and its negation respectively
+ * @param flag Device memory, where the condition is written for the host
+ */
+void ifCondition(cudaStream_t stream,
+                 const bool* condition,
+                 std::int32_t* flag,
+                 ConditionalHandle thenHandle,
+                 ConditionalHandle elseHandle);
+
+/**
+ * Copies a slice of a tensor along an axis to a tensor of the slice (or back, for insert) at the position of the
+ * current iteration of Loop, which is read from its state
+ */
+class IterationSlice {
+public:
+    struct Props {
+        // Product of dimensions before the axis
+        std::size_t outer;
+        // Dimension of the axis in the whole tensor
+        std::size_t axis_size;
+        std::size_t part_size;
+        // Bytes of a single position along the axis
+        std::size_t inner_bytes;
+        std::int64_t start;
+        std::int64_t stride;
+    };
+
+    IterationSlice(const Props& props, bool isInsert, std::size_t maxThreadsPerBlock);
+
+    void operator()(cudaStream_t stream, const LoopState* state, const void* src, void* dst) const;
+
+private:
+    Props props_;
+    bool is_insert_;
+    std::size_t size_;
+    unsigned num_blocks_;
+    unsigned threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -2,6 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+
 #include "convert.cuh"
 #include "convert.hpp"
 #include "details/error.hpp"
@@ -12,12 +17,93 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
+namespace {
+
+constexpr unsigned pack_size = 4;
+
+template <typename T>
+struct alignas(sizeof(T) * pack_size) Pack {
+    T values[pack_size];
+};
+
+/**
+ * Packs of elements of up to 4 bytes are accessed by single loads and stores of up to 16 bytes
+ */
 template <typename TOutput, typename TInput>
-__global__ void convert_impl(size_t inputSize, TOutput* out, const TInput* in) {
-    const size_t i = blockIdx.x * blockDim.x + threadIdx.x;
-    if (i < inputSize) {
-        out[i] = cast<TOutput>(in[i]);
+constexpr bool is_packed = sizeof(TOutput) <= 4 && sizeof(TInput) <= 4;
+
+/**
+ * @returns Number of packs the elements are converted by, 0 if the buffers aren't aligned to packs
+ */
+template <typename TOutput, typename TInput>
+size_t packCount(size_t size, const void* output, const void* input) {
+    if constexpr (is_packed<TOutput, TInput>) {
+        if (reinterpret_cast<std::uintptr_t>(output) % sizeof(Pack<TOutput>) == 0 &&
+            reinterpret_cast<std::uintptr_t>(input) % sizeof(Pack<TInput>) == 0) {
+            return size / pack_size;
+        }
     }
+    return 0;
+}
+
+/**
+ * Each thread converts a pack or one of the remaining elements
+ */
+size_t threadCount(size_t size, size_t numPacks) { return numPacks + (size - numPacks * pack_size); }
+
+unsigned blockSize(size_t numThreads, unsigned maxThreadsPerBlock) {
+    return static_cast<unsigned>(std::min<size_t>(numThreads, maxThreadsPerBlock));
+}
+
+unsigned blockCount(size_t numThreads, unsigned blockSize) {
+    return static_cast<unsigned>((numThreads + blockSize - 1) / blockSize);
+}
+
+}  // namespace
+
+/**
+ * Functor F is applied to the element of index i by f(x, i)
+ */
+template <typename TOutput, typename TInput, typename F>
+__device__ __forceinline__ void convert_element(
+    size_t size, size_t numPacks, TOutput* out, const TInput* in, const F& f) {
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if constexpr (is_packed<TOutput, TInput>) {
+        if (i < numPacks) {
+            const auto x = reinterpret_cast<const Pack<TInput>*>(in)[i];
+            Pack<TOutput> y;
+#pragma unroll
+            for (unsigned k = 0; k < pack_size; ++k) {
+                y.values[k] = f(x.values[k], i * pack_size + k);
+            }
+            reinterpret_cast<Pack<TOutput>*>(out)[i] = y;
+            return;
+        }
+    }
+    const size_t j = numPacks * pack_size + (i - numPacks);
+    if (j < size) {
+        out[j] = f(in[j], j);
+    }
+}
+
+template <typename TOutput, typename TInput>
+__global__ void convert_impl(size_t size, size_t numPacks, TOutput* out, const TInput* in) {
+    convert_element(size, numPacks, out, in, [](TInput x, size_t) { return cast<TOutput>(x); });
+}
+
+template <typename TOutput, typename TInput>
+__global__ void convert_normalize_impl(size_t size,
+                                       size_t numPacks,
+                                       size_t channels,
+                                       size_t inner,
+                                       const float* scale,
+                                       const float* shift,
+                                       TOutput* out,
+                                       const TInput* in) {
+    convert_element(size, numPacks, out, in, [=](TInput x, size_t index) {
+        const size_t c = channels == 1 ? 0 : index / inner % channels;
+        return cast<TOutput>(fmaf(cast<float>(x), scale[c], shift[c]));
+    });
 }
 
 template <typename TOutput, typename TInput, typename sfinae_helper = void>
@@ -25,12 +111,8 @@ struct ConvertFunctor;
 
 template <typename TOutput, typename TInput>
 struct ConvertFunctor<TOutput, TInput, typename std::enable_if<std::is_same<TOutput, TInput>::value>::type> {
-    static void function(cudaStream_t stream,
-                         size_t size,
-                         void* output,
-                         const void* input,
-                         unsigned /*numBlocks*/,
-                         unsigned /*threadsPerBlock*/) {
+    static void function(
+        cudaStream_t stream, size_t size, void* output, const void* input, unsigned /*maxThreadsPerBlock*/) {
         if (output == input) return;
         throwIfError(cudaMemcpyAsync(output, input, size * sizeof(TOutput), cudaMemcpyDeviceToDevice, stream));
     }
@@ -38,20 +120,20 @@ struct ConvertFunctor<TOutput, TInput, typename std::enable_if<std::is_same<TOut
 
 template <typename TOutput, typename TInput>
 struct ConvertFunctor<TOutput, TInput, typename std::enable_if<!std::is_same<TOutput, TInput>::value>::type> {
-    static void function(cudaStream_t stream,
-                         size_t size,
-                         void* output,
-                         const void* input,
-                         unsigned numBlocks,
-                         unsigned threadsPerBlock) {
-        ov::nvidia_gpu::kernel::convert_impl<TOutput, TInput><<<numBlocks, threadsPerBlock, 0, stream>>>(
-            size, static_cast<TOutput*>(output), static_cast<const TInput*>(input));
+    static void function(cudaStream_t stream, size_t size, void* output, const void* input, unsigned maxThreadsPerBlock) {
+        if (size == 0) return;
+        const size_t numPacks = packCount<TOutput, TInput>(size, output, input);
+        const size_t numThreads = threadCount(size, numPacks);
+        const unsigned threadsPerBlock = blockSize(numThreads, maxThreadsPerBlock);
+        ov::nvidia_gpu::kernel::convert_impl<TOutput, TInput>
+            <<<blockCount(numThreads, threadsPerBlock), threadsPerBlock, 0, stream>>>(
+                size, numPacks, static_cast<TOutput*>(output), static_cast<const TInput*>(input));
+        throwIfError(cudaPeekAtLastError());
     }
 };
 
-Convert::Convert(
-    Type_t output_element_type, Type_t input_element_type, size_t size, size_t numBlocks, size_t threadsPerBlock)
-    : size_{size}, num_blocks_{numBlocks}, threads_per_block_{threadsPerBlock} {
+Convert::Convert(Type_t output_element_type, Type_t input_element_type, size_t size, unsigned maxThreadsPerBlock)
+    : size_{size}, max_threads_per_block_{maxThreadsPerBlock} {
     TypeValidator<AllElementTypesSwitch>::check(output_element_type);
     TypeValidator<AllElementTypesSwitch>::check(input_element_type);
     static constexpr TypedFunctor<ConvertFunctor, convert_t, DIM_2D> combinations{};
@@ -59,7 +141,110 @@ Convert::Convert(
 }
 
 void Convert::operator()(cudaStream_t stream, void* output, const void* src) const {
-    convert_kernel_(stream, size_, output, src, num_blocks_, threads_per_block_);
+    convert_kernel_(stream, size_, output, src, max_threads_per_block_);
+}
+
+ConvertNormalize::ConvertNormalize(Type_t output_element_type,
+                                   Type_t input_element_type,
+                                   size_t size,
+                                   size_t channels,
+                                   size_t inner,
+                                   unsigned maxThreadsPerBlock)
+    : output_element_type_{output_element_type},
+      input_element_type_{input_element_type},
+      size_{size},
+      channels_{channels},
+      inner_{inner},
+      max_threads_per_block_{maxThreadsPerBlock} {
+    if (!isTypeSupported(output_element_type, input_element_type)) {
+        throw_ov_exception(fmt::format("ConvertNormalize: conversion of {} to {} is not supported !!",
+                                       input_element_type,
+                                       output_element_type));
+    }
+    if (channels_ == 0 || inner_ == 0) {
+        throw_ov_exception("ConvertNormalize: channels and inner should be positive !!");
+    }
+}
+
+bool ConvertNormalize::isTypeSupported(Type_t output_element_type, Type_t input_element_type) {
+    switch (output_element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            break;
+        default:
+            return false;
+    }
+    switch (input_element_type) {
+        case Type_t::u8:
+        case Type_t::i8:
+        case Type_t::u16:
+        case Type_t::i16:
+        case Type_t::i32:
+        case Type_t::f16:
+        case Type_t::f32:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void ConvertNormalize::operator()(
+    cudaStream_t stream, void* output, const void* input, const void* scale, const void* shift) const {
+    switch (output_element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, output, input, scale, shift);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, output, input, scale, shift);
+#endif
+        default:
+            return call<float>(stream, output, input, scale, shift);
+    }
+}
+
+template <typename TOutput>
+void ConvertNormalize::call(
+    cudaStream_t stream, void* output, const void* input, const void* scale, const void* shift) const {
+    switch (input_element_type_) {
+        case Type_t::u8:
+            return launch<TOutput, std::uint8_t>(stream, output, input, scale, shift);
+        case Type_t::i8:
+            return launch<TOutput, std::int8_t>(stream, output, input, scale, shift);
+        case Type_t::u16:
+            return launch<TOutput, std::uint16_t>(stream, output, input, scale, shift);
+        case Type_t::i16:
+            return launch<TOutput, std::int16_t>(stream, output, input, scale, shift);
+        case Type_t::i32:
+            return launch<TOutput, std::int32_t>(stream, output, input, scale, shift);
+        case Type_t::f16:
+            return launch<TOutput, __half>(stream, output, input, scale, shift);
+        default:
+            return launch<TOutput, float>(stream, output, input, scale, shift);
+    }
+}
+
+template <typename TOutput, typename TInput>
+void ConvertNormalize::launch(
+    cudaStream_t stream, void* output, const void* input, const void* scale, const void* shift) const {
+    if (size_ == 0) {
+        return;
+    }
+    const size_t numPacks = packCount<TOutput, TInput>(size_, output, input);
+    const size_t numThreads = threadCount(size_, numPacks);
+    const unsigned threadsPerBlock = blockSize(numThreads, max_threads_per_block_);
+    convert_normalize_impl<TOutput, TInput>
+        <<<blockCount(numThreads, threadsPerBlock), threadsPerBlock, 0, stream>>>(size_,
+                                                                                  numPacks,
+                                                                                  channels_,
+                                                                                  inner_,
+                                                                                  static_cast<const float*>(scale),
+                                                                                  static_cast<const float*>(shift),
+                                                                                  static_cast<TOutput*>(output),
+                                                                                  static_cast<const TInput*>(input));
+    throwIfError(cudaPeekAtLastError());
 }
 
 }  // namespace kernel
@@ -10,21 +10,67 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
+/**
+ * Converts elements between any pair of types. Elements of up to 4 bytes are converted by packs of 4, which are
+ * loaded and stored by single vector accesses when both buffers are aligned to packs, e.g. u8 -> f32 loads 4 bytes
+ * and stores 16 bytes per thread. The remaining elements are converted one per thread.
+ */
 class Convert {
 public:
-    Convert(
-        Type_t output_element_type, Type_t input_element_type, size_t size, size_t numBlocks, size_t threadsPerBlock);
+    Convert(Type_t output_element_type, Type_t input_element_type, size_t size, unsigned maxThreadsPerBlock);
     Convert(Convert&&) = default;
     Convert& operator=(Convert&&) = default;
 
     void operator()(cudaStream_t, void*, const void*) const;
-    using convert_t = void (*)(cudaStream_t, size_t, void*, const void*, unsigned, unsigned);
+    using convert_t = void (*)(cudaStream_t, size_t, void*, const void*, unsigned);
 
 private:
     convert_t convert_kernel_;
     size_t size_;
-    size_t num_blocks_;
-    size_t threads_per_block_;
+    unsigned max_threads_per_block_;
+};
+
+/**
+ * Converts integer or floating point elements to a floating point type and applies the per-channel affine
+ * transform of preprocessing in FP32 on the way:
+ *   y = float(x) * scale[c] + shift[c]
+ * where c is the index along the channel axis of the tensor viewed as [outer, channels, inner].
+ * Elements are processed by packs like by Convert.
+ */
+class ConvertNormalize {
+public:
+    ConvertNormalize(Type_t output_element_type,
+                     Type_t input_element_type,
+                     size_t size,
+                     size_t channels,
+                     size_t inner,
+                     unsigned maxThreadsPerBlock);
+    ConvertNormalize(ConvertNormalize&&) = default;
+    ConvertNormalize& operator=(ConvertNormalize&&) = default;
+
+    /**
+     * @param scale, shift FP32 vectors of channels values
+     */
+    void operator()(cudaStream_t stream, void* output, const void* input, const void* scale, const void* shift) const;
+
+    /**
+     * @returns true if the kernel supports the pair of types
+     */
+    static bool isTypeSupported(Type_t output_element_type, Type_t input_element_type);
+
+private:
+    template <typename TOutput>
+    void call(cudaStream_t stream, void* output, const void* input, const void* scale, const void* shift) const;
+
+    template <typename TOutput, typename TInput>
+    void launch(cudaStream_t stream, void* output, const void* input, const void* scale, const void* shift) const;
+
+    Type_t output_element_type_{};
+    Type_t input_element_type_{};
+    size_t size_{};
+    size_t channels_{};
+    size_t inner_{};
+    unsigned max_threads_per_block_{};
 };
 
 }  // namespace kernel
@@ -0,0 +1,201 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <cuda/float16.hpp>
+#include <tuple>
+
+#include "convert_color.hpp"
+#include "convert_color_preprocess.hpp"
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+struct Pixel {
+    float c[3];
+};
+
+template <ConvertColorPreprocess::Format F, typename T>
+__device__ __forceinline__ Pixel source_pixel(const ConvertColorPreprocess::Params& p,
+                                              const T* y_plane,
+                                              const T* u_plane,
+                                              const T* v_plane,
+                                              size_t batch,
+                                              size_t h,
+                                              size_t w) {
+    const auto y_val = static_cast<float>(y_plane[batch * p.stride_y + h * p.in_w + w]);
+    float u_val;
+    float v_val;
+    if constexpr (F == ConvertColorPreprocess::Format::NV12) {
+        const T* uv = u_plane + p.offset_u + batch * p.stride_u + (h / 2) * p.in_w + (w / 2) * 2;
+        u_val = static_cast<float>(uv[0]);
+        v_val = static_cast<float>(uv[1]);
+    } else {
+        const size_t uv_index = (h / 2) * (p.in_w / 2) + w / 2;
+        u_val = static_cast<float>(u_plane[p.offset_u + batch * p.stride_u + uv_index]);
+        v_val = static_cast<float>(v_plane[p.offset_v + batch * p.stride_v + uv_index]);
+    }
+    float r, g, b;
+    yuv_pixel_to_rgb(y_val, u_val, v_val, r, g, b);
+    if (p.round) {
+        r = roundf(r);
+        g = roundf(g);
+        b = roundf(b);
+    }
+    return p.bgr ? Pixel{{b, g, r}} : Pixel{{r, g, b}};
+}
+
+/**
+ * @returns Integer source coordinate, the next one clamped to the image and the weight of the next one
+ */
+__device__ __forceinline__ void source_coordinate(
+    size_t out, float scale, float offset, size_t size, size_t& first, size_t& second, float& weight) {
+    const float coordinate = fminf(fmaxf(out * scale + offset, 0.0f), static_cast<float>(size - 1));
+    first = static_cast<size_t>(coordinate);
+    second = min(first + 1, size - 1);
+    weight = coordinate - static_cast<float>(first);
+}
+
+}  // namespace
+
+template <ConvertColorPreprocess::Format F, typename TInput, typename TOutput, bool Resize>
+static __global__ void convert_color_preprocess(ConvertColorPreprocess::Params p,
+                                                const TInput* y_plane,
+                                                const TInput* u_plane,
+                                                const TInput* v_plane,
+                                                TOutput* out) {
+    const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= p.batch_size * p.out_h * p.out_w) {
+        return;
+    }
+    const size_t x = idx % p.out_w;
+    const size_t y = idx / p.out_w % p.out_h;
+    const size_t batch = idx / (p.out_w * p.out_h);
+
+    Pixel pixel;
+    if constexpr (Resize) {
+        size_t y0, y1, x0, x1;
+        float dy, dx;
+        source_coordinate(y, p.scale_y, p.offset_y, p.in_h, y0, y1, dy);
+        source_coordinate(x, p.scale_x, p.offset_x, p.in_w, x0, x1, dx);
+        const auto p00 = source_pixel<F>(p, y_plane, u_plane, v_plane, batch, y0, x0);
+        const auto p01 = source_pixel<F>(p, y_plane, u_plane, v_plane, batch, y0, x1);
+        const auto p10 = source_pixel<F>(p, y_plane, u_plane, v_plane, batch, y1, x0);
+        const auto p11 = source_pixel<F>(p, y_plane, u_plane, v_plane, batch, y1, x1);
+#pragma unroll
+        for (unsigned c = 0; c < 3; ++c) {
+            const float top = p00.c[c] + (p01.c[c] - p00.c[c]) * dx;
+            const float bottom = p10.c[c] + (p11.c[c] - p10.c[c]) * dx;
+            pixel.c[c] = top + (bottom - top) * dy;
+        }
+    } else {
+        pixel = source_pixel<F>(p, y_plane, u_plane, v_plane, batch, y, x);
+    }
+
+#pragma unroll
+    for (unsigned c = 0; c < 3; ++c) {
+        const auto value = static_cast<TOutput>(fmaf(pixel.c[c], p.scale[c], p.shift[c]));
+        if (p.nchw) {
+            out[((batch * 3 + c) * p.out_h + y) * p.out_w + x] = value;
+        } else {
+            out[idx * 3 + c] = value;
+        }
+    }
+}
+
+ConvertColorPreprocess::ConvertColorPreprocess(Format format,
+                                               Type_t input_element_type,
+                                               Type_t output_element_type,
+                                               const Params& params,
+                                               size_t max_threads_per_block)
+    : format_{format},
+      input_element_type_{input_element_type},
+      output_element_type_{output_element_type},
+      params_{params},
+      resize_{params.in_h != params.out_h || params.in_w != params.out_w} {
+    if (!isTypeSupported(input_element_type, output_element_type)) {
+        throw_ov_exception(fmt::format("ConvertColorPreprocess: conversion of {} to {} is not supported !!",
+                                       input_element_type,
+                                       output_element_type));
+    }
+    std::tie(num_blocks_, threads_per_block_) =
+        calculateElementwiseGrid(params.batch_size * params.out_h * params.out_w, max_threads_per_block);
+}
+
+bool ConvertColorPreprocess::isTypeSupported(Type_t input_element_type, Type_t output_element_type) {
+    switch (input_element_type) {
+        case Type_t::u8:
+        case Type_t::f16:
+        case Type_t::f32:
+            break;
+        default:
+            return false;
+    }
+    switch (output_element_type) {
+        case Type_t::f16:
+        case Type_t::f32:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void ConvertColorPreprocess::operator()(
+    cudaStream_t stream, const void* y, const void* u, const void* v, void* out) const {
+    switch (input_element_type_) {
+        case Type_t::u8:
+            return call<std::uint8_t>(stream, y, u, v, out);
+        case Type_t::f16:
+            return call<__half>(stream, y, u, v, out);
+        default:
+            return call<float>(stream, y, u, v, out);
+    }
+}
+
+template <typename TInput>
+void ConvertColorPreprocess::call(cudaStream_t stream, const void* y, const void* u, const void* v, void* out) const {
+    if (output_element_type_ == Type_t::f16) {
+        return launch<TInput, __half>(stream, y, u, v, out);
+    }
+    return launch<TInput, float>(stream, y, u, v, out);
+}
+
+template <typename TInput, typename TOutput>
+void ConvertColorPreprocess::launch(
+    cudaStream_t stream, const void* y, const void* u, const void* v, void* out) const {
+    if (num_blocks_ == 0) {
+        return;
+    }
+    const auto* y_plane = static_cast<const TInput*>(y);
+    const auto* u_plane = static_cast<const TInput*>(u);
+    const auto* v_plane = static_cast<const TInput*>(v);
+    auto* output = static_cast<TOutput*>(out);
+    constexpr auto NV12 = Format::NV12;
+    constexpr auto I420 = Format::I420;
+    if (format_ == NV12 && resize_) {
+        convert_color_preprocess<NV12, TInput, TOutput, true>
+            <<<num_blocks_, threads_per_block_, 0, stream>>>(params_, y_plane, u_plane, v_plane, output);
+    } else if (format_ == NV12) {
+        convert_color_preprocess<NV12, TInput, TOutput, false>
+            <<<num_blocks_, threads_per_block_, 0, stream>>>(params_, y_plane, u_plane, v_plane, output);
+    } else if (resize_) {
+        convert_color_preprocess<I420, TInput, TOutput, true>
+            <<<num_blocks_, threads_per_block_, 0, stream>>>(params_, y_plane, u_plane, v_plane, output);
+    } else {
+        convert_color_preprocess<I420, TInput, TOutput, false>
+            <<<num_blocks_, threads_per_block_, 0, stream>>>(params_, y_plane, u_plane, v_plane, output);
+    }
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,89 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Preprocessing of NV12 or I420 images by a single kernel. Each thread computes the three channels of an output
+ * pixel:
+ *  - RGB (or BGR) values of the source pixels are computed from their Y, U and V values, rounded to integers when
+ *    the color conversion produces integers;
+ *  - when the output size differs from the input size, the four source pixels around the pixel's source
+ *    coordinates are interpolated bilinearly, source coordinates are out * scale + offset clamped to the image;
+ *  - the per-channel affine transform y = x * scale[c] + shift[c] is applied;
+ *  - channels are stored in the NHWC or NCHW layout.
+ */
+class ConvertColorPreprocess {
+public:
+    enum class Format { NV12, I420 };
+
+    struct Params {
+        size_t batch_size{};
+        size_t in_h{};
+        size_t in_w{};
+        size_t out_h{};
+        size_t out_w{};
+        // Elements between planes of neighbouring images
+        size_t stride_y{};
+        size_t stride_u{};
+        size_t stride_v{};
+        // Offsets of the first U and V elements from the U and V plane pointers, NV12 V values follow U values
+        size_t offset_u{};
+        size_t offset_v{};
+        float scale_y{1.0f};
+        float offset_y{};
+        float scale_x{1.0f};
+        float offset_x{};
+        float scale[3]{1.0f, 1.0f, 1.0f};
+        float shift[3]{};
+        bool bgr{};
+        bool round{};
+        bool nchw{};
+    };
+
+    ConvertColorPreprocess(Format format,
+                           Type_t input_element_type,
+                           Type_t output_element_type,
+                           const Params& params,
+                           size_t max_threads_per_block);
+    ConvertColorPreprocess(ConvertColorPreprocess&&) = default;
+    ConvertColorPreprocess& operator=(ConvertColorPreprocess&&) = default;
+
+    /**
+     * @param u, v Plane pointers, V is ignored for NV12
+     */
+    void operator()(cudaStream_t stream, const void* y, const void* u, const void* v, void* out) const;
+
+    /**
+     * @returns true if the kernel supports the pair of types
+     */
+    static bool isTypeSupported(Type_t input_element_type, Type_t output_element_type);
+
+private:
+    template <typename TInput>
+    void call(cudaStream_t stream, const void* y, const void* u, const void* v, void* out) const;
+
+    template <typename TInput, typename TOutput>
+    void launch(cudaStream_t stream, const void* y, const void* u, const void* v, void* out) const;
+
+    Format format_{};
+    Type_t input_element_type_{};
+    Type_t output_element_type_{};
+    Params params_{};
+    bool resize_{};
+    unsigned num_blocks_{};
+    unsigned threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,215 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <cuda/float16.hpp>
+#include <cuda/stl/algorithms/block.cuh>
+
+#include "cumsum.hpp"
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+namespace block = CUDA::algorithms::block;
+
+constexpr unsigned lookback_block_size = 256;
+constexpr unsigned items_per_thread = 8;
+constexpr unsigned tile_size = lookback_block_size * items_per_thread;
+// Sequences up to this size are always scanned by a thread each
+constexpr size_t max_thread_sequence_size = 64;
+
+struct Args {
+    size_t num_sequences;
+    size_t axis_size;
+    size_t inner_size;
+    bool exclusive;
+    bool reverse;
+};
+
+/**
+ * Offsets of elements of a sequence, which is strided by the inner size and goes backwards if reversed
+ */
+struct Sequence {
+    size_t base;
+    size_t stride;
+    size_t axis_size;
+    bool reverse;
+
+    __device__ Sequence(const Args& args, const size_t sequence)
+        : base{sequence / args.inner_size * args.axis_size * args.inner_size + sequence % args.inner_size},
+          stride{args.inner_size},
+          axis_size{args.axis_size},
+          reverse{args.reverse} {}
+
+    __device__ size_t operator[](const size_t j) const { return base + (reverse ? axis_size - 1 - j : j) * stride; }
+};
+
+template <typename T, typename TAcc>
+__global__ void cumsum_per_thread(const Args args, const T* in, T* out) {
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= args.num_sequences) {
+        return;
+    }
+    const Sequence sequence{args, i};
+    TAcc sum{0};
+    for (size_t j = 0; j < args.axis_size; ++j) {
+        const auto offset = sequence[j];
+        const TAcc value = static_cast<TAcc>(in[offset]);
+        if (args.exclusive) {
+            out[offset] = static_cast<T>(sum);
+            sum += value;
+        } else {
+            sum += value;
+            out[offset] = static_cast<T>(sum);
+        }
+    }
+}
+
+/**
+ * Scans a tile of a sequence per block. Every thread sums its consecutive items, the block sums threads and the
+ * tile takes its prefix from preceding tiles of the sequence by decoupled look-back
+ */
+template <typename T, typename TAcc>
+__global__ void cumsum_lookback(const Args args,
+                                const unsigned tiles_per_sequence,
+                                const T* in,
+                                T* out,
+                                const block::ScanTileStates<TAcc> states) {
+    const unsigned tile = block::next_tile(states);
+    const unsigned tile_in_sequence = tile % tiles_per_sequence;
+    const Sequence sequence{args, tile / tiles_per_sequence};
+    const size_t first = static_cast<size_t>(tile_in_sequence) * tile_size + threadIdx.x * items_per_thread;
+
+    TAcc items[items_per_thread];
+    TAcc thread_sum{0};
+#pragma unroll
+    for (unsigned k = 0; k < items_per_thread; ++k) {
+        items[k] = first + k < args.axis_size ? static_cast<TAcc>(in[sequence[first + k]]) : TAcc{0};
+        thread_sum += items[k];
+    }
+    TAcc tile_sum;
+    const TAcc thread_prefix = block::exclusive_sum(thread_sum, tile_sum);
+
+    __shared__ TAcc tile_prefix;
+    if (threadIdx.x == 0) {
+        tile_prefix = block::decoupled_lookback(states, tile, tile - tile_in_sequence, tile_sum);
+    }
+    __syncthreads();
+
+    TAcc sum = tile_prefix + thread_prefix;
+#pragma unroll
+    for (unsigned k = 0; k < items_per_thread; ++k) {
+        if (first + k < args.axis_size) {
+            const TAcc inclusive = sum + items[k];
+            out[sequence[first + k]] = static_cast<T>(args.exclusive ? sum : inclusive);
+            sum = inclusive;
+        }
+    }
+}
+
+}  // namespace
+
+bool CumSum::isSupportedType(const Type_t element_type) {
+    switch (element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+        case Type_t::i32:
+        case Type_t::i64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+CumSum::CumSum(const Params& params, const size_t num_multiprocessors, const size_t max_threads_per_block)
+    : params_{params}, max_threads_per_block_{max_threads_per_block}, tiles_per_sequence_{0} {
+    if (!isSupportedType(params_.element_type)) {
+        throw_ov_exception(
+            fmt::format("Element type = {} is not supported by CumSum operation !!", params_.element_type));
+    }
+    const size_t num_sequences = params_.outer_size * params_.inner_size;
+    // Threads scanning a sequence each keep the device busy or sequences are too short to be split
+    if (params_.axis_size > max_thread_sequence_size && num_sequences < num_multiprocessors * max_threads_per_block &&
+        max_threads_per_block >= lookback_block_size) {
+        tiles_per_sequence_ = static_cast<unsigned>((params_.axis_size + tile_size - 1) / tile_size);
+    }
+    switch (params_.element_type) {
+        case Type_t::i32:
+            accumulator_size_ = sizeof(int32_t);
+            break;
+        case Type_t::i64:
+            accumulator_size_ = sizeof(int64_t);
+            break;
+        default:
+            accumulator_size_ = sizeof(float);
+            break;
+    }
+}
+
+size_t CumSum::workspaceSize() const {
+    if (tiles_per_sequence_ == 0) {
+        return 0;
+    }
+    const size_t num_tiles = params_.outer_size * params_.inner_size * tiles_per_sequence_;
+    return accumulator_size_ == sizeof(int64_t) ? block::ScanTileStates<int64_t>::size(num_tiles)
+                                                : block::ScanTileStates<float>::size(num_tiles);
+}
+
+void CumSum::operator()(const cudaStream_t stream, const void* in, void* out, void* workspace) const {
+    switch (params_.element_type) {
+        case Type_t::f16:
+            return call<__half, float>(stream, in, out, workspace);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16, float>(stream, in, out, workspace);
+#endif
+        case Type_t::i32:
+            return call<int32_t, int32_t>(stream, in, out, workspace);
+        case Type_t::i64:
+            return call<int64_t, int64_t>(stream, in, out, workspace);
+        default:
+            return call<float, float>(stream, in, out, workspace);
+    }
+}
+
+template <typename T, typename TAcc>
+void CumSum::call(const cudaStream_t stream, const void* in, void* out, void* workspace) const {
+    const Args args{params_.outer_size * params_.inner_size,
+                    params_.axis_size,
+                    params_.inner_size,
+                    params_.exclusive,
+                    params_.reverse};
+    if (args.num_sequences == 0 || args.axis_size == 0) {
+        return;
+    }
+    if (tiles_per_sequence_ == 0) {
+        const auto [num_blocks, threads_per_block] = calculateElementwiseGrid(args.num_sequences, max_threads_per_block_);
+        cumsum_per_thread<T, TAcc>
+            <<<num_blocks, threads_per_block, 0, stream>>>(args, static_cast<const T*>(in), static_cast<T*>(out));
+    } else {
+        const size_t num_tiles = args.num_sequences * tiles_per_sequence_;
+        throwIfError(cudaMemsetAsync(workspace, 0, block::ScanTileStates<TAcc>::size(num_tiles), stream));
+        cumsum_lookback<T, TAcc><<<num_tiles, lookback_block_size, 0, stream>>>(
+            args,
+            tiles_per_sequence_,
+            static_cast<const T*>(in),
+            static_cast<T*>(out),
+            block::ScanTileStates<TAcc>::create(workspace, num_tiles));
+    }
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
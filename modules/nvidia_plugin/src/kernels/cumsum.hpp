@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Cumulative sum of a tensor viewed as [outer, axis, inner] along the axis. Many short sequences are scanned by a
+ * thread each, while few long ones are split into tiles scanned by single-pass decoupled look-back, so every element
+ * is read and written once
+ */
+class CumSum {
+public:
+    struct Params {
+        Type_t element_type;
+        size_t outer_size;
+        size_t axis_size;
+        size_t inner_size;
+        bool exclusive;
+        bool reverse;
+    };
+
+    /**
+     * @returns true if elements of the type are supported
+     */
+    static bool isSupportedType(Type_t element_type);
+
+    CumSum(const Params& params, size_t num_multiprocessors, size_t max_threads_per_block);
+
+    /**
+     * @returns Size in bytes of states of tiles of the look-back scan, 0 if sequences are scanned by threads
+     */
+    size_t workspaceSize() const;
+
+    void operator()(cudaStream_t stream, const void* in, void* out, void* workspace) const;
+
+private:
+    template <typename T, typename TAcc>
+    void call(cudaStream_t stream, const void* in, void* out, void* workspace) const;
+
+    Params params_;
+    size_t max_threads_per_block_;
+    // Tiles of each sequence scanned by look-back, 0 if sequences are scanned by threads
+    unsigned tiles_per_sequence_;
+    size_t accumulator_size_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
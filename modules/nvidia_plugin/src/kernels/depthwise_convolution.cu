@@ -0,0 +1,197 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "depthwise_convolution.hpp"
+#include "details/error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned block_size = 256;
+// Grid-stride loop covers the rest of outputs of large tensors
+constexpr unsigned max_blocks = 65535;
+
+__device__ __forceinline__ float activate(DepthwiseConvolution::Activation activation, float x) {
+    switch (activation) {
+        case DepthwiseConvolution::Activation::Relu:
+            return fmaxf(x, 0.0f);
+        case DepthwiseConvolution::Activation::Sigmoid:
+            return 1.0f / (1.0f + __expf(-x));
+        case DepthwiseConvolution::Activation::Tanh:
+            return tanhf(x);
+        case DepthwiseConvolution::Activation::Swish:
+            return x / (1.0f + __expf(-x));
+        default:
+            return x;
+    }
+}
+
+/**
+ * @returns Output (oh, ow) of the convolution of the channel c of the image n
+ */
+template <typename T, bool Nhwc, unsigned K>
+__device__ __forceinline__ float convolve(const DepthwiseConvolution::Params& params,
+                                          const T* x,
+                                          const T* channel_filter,
+                                          size_t n,
+                                          size_t c,
+                                          size_t oh,
+                                          size_t ow) {
+    const int top = static_cast<int>(oh * params.stride_height) - params.pad_top;
+    const int left = static_cast<int>(ow * params.stride_width) - params.pad_left;
+    float sum = 0.0f;
+#pragma unroll
+    for (unsigned ky = 0; ky < K; ++ky) {
+        const int ih = top + static_cast<int>(ky * params.dilation_height);
+        if (ih < 0 || ih >= static_cast<int>(params.input_height)) {
+            continue;
+        }
+#pragma unroll
+        for (unsigned kx = 0; kx < K; ++kx) {
+            const int iw = left + static_cast<int>(kx * params.dilation_width);
+            if (iw < 0 || iw >= static_cast<int>(params.input_width)) {
+                continue;
+            }
+            const size_t input_idx =
+                Nhwc ? ((n * params.input_height + ih) * params.input_width + iw) * params.channels + c
+                     : ((n * params.channels + c) * params.input_height + ih) * params.input_width + iw;
+            sum += static_cast<float>(x[input_idx]) * static_cast<float>(channel_filter[ky * K + kx]);
+        }
+    }
+    return sum;
+}
+
+}  // namespace
+
+template <typename T, bool Nhwc, unsigned K>
+static __global__ void depthwise_convolution(DepthwiseConvolution::Params params,
+                                             size_t num_outputs,
+                                             const T* x,
+                                             const T* filter,
+                                             const T* bias,
+                                             const T* add,
+                                             T* y) {
+    // Outputs of the kernel are pooled ones if outputs of the convolution are pooled
+    const size_t height = params.output_height / params.pool_size;
+    const size_t width = params.output_width / params.pool_size;
+    for (size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < num_outputs;
+         i += static_cast<size_t>(gridDim.x) * blockDim.x) {
+        size_t n, c, oh, ow;
+        if constexpr (Nhwc) {
+            c = i % params.channels;
+            size_t rest = i / params.channels;
+            ow = rest % width;
+            rest /= width;
+            oh = rest % height;
+            n = rest / height;
+        } else {
+            ow = i % width;
+            size_t rest = i / width;
+            oh = rest % height;
+            rest /= height;
+            c = rest % params.channels;
+            n = rest / params.channels;
+        }
+        const T* channel_filter = filter + c * K * K;
+        const float channel_bias = bias ? static_cast<float>(bias[c]) : 0.0f;
+        if (params.pool_size > 1) {
+            float max = -INFINITY;
+            for (size_t py = 0; py < params.pool_size; ++py) {
+                for (size_t px = 0; px < params.pool_size; ++px) {
+                    const float sum = convolve<T, Nhwc, K>(params,
+                                                           x,
+                                                           channel_filter,
+                                                           n,
+                                                           c,
+                                                           oh * params.pool_size + py,
+                                                           ow * params.pool_size + px);
+                    max = fmaxf(max, activate(params.activation, sum + channel_bias));
+                }
+            }
+            y[i] = static_cast<T>(max);
+            continue;
+        }
+        float sum = convolve<T, Nhwc, K>(params, x, channel_filter, n, c, oh, ow) + channel_bias;
+        if (add) {
+            sum += static_cast<float>(add[i]);
+        }
+        y[i] = static_cast<T>(activate(params.activation, sum));
+    }
+}
+
+DepthwiseConvolution::DepthwiseConvolution(const Params& params)
+    : params_{params},
+      num_outputs_{params.batch * params.channels * (params.output_height / std::max<size_t>(params.pool_size, 1)) *
+                   (params.output_width / std::max<size_t>(params.pool_size, 1))},
+      num_blocks_{static_cast<unsigned>(
+          std::min<size_t>((num_outputs_ + block_size - 1) / block_size, max_blocks))} {
+    switch (params_.element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            break;
+        default:
+            throw_ov_exception(fmt::format("Element type = {} is not supported by DepthwiseConvolution operation !!",
+                                           params_.element_type));
+    }
+    if (params_.pool_size == 0) {
+        throw_ov_exception("Pool size = 0 is not supported by DepthwiseConvolution operation !!");
+    }
+    if (!isSupportedKernelSize(params_.kernel_size)) {
+        throw_ov_exception(
+            fmt::format("Filter size = {} is not supported by DepthwiseConvolution operation !!", params_.kernel_size));
+    }
+}
+
+void DepthwiseConvolution::operator()(
+    cudaStream_t stream, const void* x, const void* filter, const void* bias, const void* add, void* y) const {
+    switch (params_.element_type) {
+        case Type_t::f16:
+            return call<__half>(stream, x, filter, bias, add, y);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, x, filter, bias, add, y);
+#endif
+        default:
+            return call<float>(stream, x, filter, bias, add, y);
+    }
+}
+
+template <typename T>
+void DepthwiseConvolution::call(
+    cudaStream_t stream, const void* x, const void* filter, const void* bias, const void* add, void* y) const {
+    if (params_.nhwc) {
+        return params_.kernel_size == 3 ? launch<T, true, 3>(stream, x, filter, bias, add, y)
+                                        : launch<T, true, 5>(stream, x, filter, bias, add, y);
+    }
+    return params_.kernel_size == 3 ? launch<T, false, 3>(stream, x, filter, bias, add, y)
+                                    : launch<T, false, 5>(stream, x, filter, bias, add, y);
+}
+
+template <typename T, bool Nhwc, unsigned K>
+void DepthwiseConvolution::launch(
+    cudaStream_t stream, const void* x, const void* filter, const void* bias, const void* add, void* y) const {
+    depthwise_convolution<T, Nhwc, K><<<num_blocks_, block_size, 0, stream>>>(params_,
+                                                                              num_outputs_,
+                                                                              static_cast<const T*>(x),
+                                                                              static_cast<const T*>(filter),
+                                                                              static_cast<const T*>(bias),
+                                                                              static_cast<const T*>(add),
+                                                                              static_cast<T*>(y));
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,80 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Depthwise 2D convolution (each channel is convolved with its own KxK filter) of NCHW or NHWC tensors
+ * followed by optional bias, addition of a tensor of the output shape and activation.
+ * Activated outputs may be max pooled by non-overlapping PxP windows, then each thread computes the convolution
+ * of a window and writes only its maximum, so the convolution output isn't written to and read from memory.
+ * Each thread computes one output element, threads are ordered as outputs in memory, so reads of inputs
+ * by neighbour threads are coalesced in both layouts
+ */
+class DepthwiseConvolution {
+public:
+    enum class Activation { None, Relu, Sigmoid, Tanh, Swish };
+
+    struct Params {
+        Type_t element_type;
+        bool nhwc;
+        size_t batch;
+        size_t channels;
+        size_t input_height;
+        size_t input_width;
+        size_t output_height;
+        size_t output_width;
+        // Filter is KxK, where K is one of supported kernel sizes
+        size_t kernel_size;
+        size_t stride_height;
+        size_t stride_width;
+        size_t dilation_height;
+        size_t dilation_width;
+        int pad_top;
+        int pad_left;
+        Activation activation;
+        // Size and stride of windows of max pooling of activated outputs, 1 if outputs aren't pooled.
+        // Output height and width above are the ones of the convolution, partial windows are dropped
+        size_t pool_size = 1;
+    };
+
+    /**
+     * @returns true if filters of the size are supported
+     */
+    static bool isSupportedKernelSize(size_t kernel_size) { return kernel_size == 3 || kernel_size == 5; }
+
+    explicit DepthwiseConvolution(const Params& params);
+
+    /**
+     * @param filter [channels, K, K]
+     * @param bias [channels] or nullptr
+     * @param add Tensor of the output shape or nullptr, it isn't supported with pooling
+     */
+    void operator()(
+        cudaStream_t stream, const void* x, const void* filter, const void* bias, const void* add, void* y) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* x, const void* filter, const void* bias, const void* add, void* y) const;
+
+    template <typename T, bool Nhwc, unsigned K>
+    void launch(cudaStream_t stream, const void* x, const void* filter, const void* bias, const void* add, void* y)
+        const;
+
+    Params params_;
+    size_t num_outputs_;
+    unsigned num_blocks_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,96 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+namespace nms {
+
+constexpr unsigned warp_size = 32;
+
+/**
+ * Sorts size items by all threads of the block with a bitonic network, where every merge orders both halves in the
+ * same direction. The network is built for the next power of 2 of size, and as the missing items would be the last
+ * ones in the sorted order, comparisons with them are skipped
+ * @param precedes (a, b) -> true if a goes before b
+ */
+template <typename T, typename TPrecedes>
+__device__ void block_sort(T* items, const unsigned size, TPrecedes precedes) {
+    unsigned network_size = 1;
+    while (network_size < size) {
+        network_size *= 2;
+    }
+    auto compare_exchange = [items, size, &precedes](unsigned lo, unsigned hi) {
+        if (hi < size && precedes(items[hi], items[lo])) {
+            const auto item = items[lo];
+            items[lo] = items[hi];
+            items[hi] = item;
+        }
+    };
+    for (unsigned merge_size = 2; merge_size <= network_size; merge_size *= 2) {
+        const unsigned half = merge_size / 2;
+        for (unsigned i = threadIdx.x; i < network_size / 2; i += blockDim.x) {
+            const unsigned first = i / half * merge_size;
+            const unsigned offset = i % half;
+            compare_exchange(first + offset, first + merge_size - 1 - offset);
+        }
+        __syncthreads();
+        for (unsigned distance = half / 2; distance > 0; distance /= 2) {
+            for (unsigned i = threadIdx.x; i < network_size / 2; i += blockDim.x) {
+                const unsigned lo = i / distance * 2 * distance + i % distance;
+                compare_exchange(lo, lo + distance);
+            }
+            __syncthreads();
+        }
+    }
+}
+
+/**
+ * @returns Number of words of the bitmask of block_greedy_nms() for num candidates
+ */
+__host__ __device__ constexpr unsigned bitmask_words(const unsigned num) { return (num + warp_size - 1) / warp_size; }
+
+/**
+ * Greedy NMS over num candidates sorted by descending scores performed by all threads of the block. Candidates
+ * suppressed by each kept one are marked in a bitmask in shared memory, so overlaps with a kept candidate are computed
+ * by all threads in parallel
+ * @param suppressed Bitmask of bitmask_words(num) words in shared memory
+ * @param suppresses (i, j) -> true if the kept candidate i suppresses the candidate j > i
+ * @param keep (i, n) is called by the thread 0 for the n-th kept candidate i
+ * @returns Number of kept candidates, which is at most max_kept
+ */
+template <typename TSuppresses, typename TKeep>
+__device__ unsigned block_greedy_nms(
+    const unsigned num, const unsigned max_kept, unsigned* suppressed, TSuppresses suppresses, TKeep keep) {
+    for (unsigned i = threadIdx.x; i < bitmask_words(num); i += blockDim.x) {
+        suppressed[i] = 0;
+    }
+    __syncthreads();
+    unsigned num_kept = 0;
+    for (unsigned i = 0; i < num && num_kept < max_kept; ++i) {
+        if (suppressed[i / warp_size] & (1u << (i % warp_size))) {
+            continue;
+        }
+        if (threadIdx.x == 0) {
+            keep(i, num_kept);
+        }
+        ++num_kept;
+        for (unsigned j = i + 1 + threadIdx.x; j < num; j += blockDim.x) {
+            if (!(suppressed[j / warp_size] & (1u << (j % warp_size))) && suppresses(i, j)) {
+                atomicOr(&suppressed[j / warp_size], 1u << (j % warp_size));
+            }
+        }
+        __syncthreads();
+    }
+    return num_kept;
+}
+
+}  // namespace nms
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
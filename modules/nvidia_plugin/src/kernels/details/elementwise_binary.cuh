@@ -11,6 +11,7 @@
 
 #include "cuda_type_traits.hpp"
 #include "element_types_switch.hpp"
+#include "elementwise_vectorized.cuh"
 #include "numpy_broadcast_mapper.cuh"
 #include "tensor_helpers.hpp"
 #include "type_validator.hpp"
@@ -29,6 +30,21 @@ __global__ void elementwise_binary(const T* in0, const T* in1, T* out, size_t ou
     }
 }
 
+template <typename T, typename OP, typename... Args>
+__global__ void elementwise_binary_vectorized(
+    const Vector<T>* in0, const Vector<T>* in1, Vector<T>* out, size_t num_vectors, Args... args) {
+    for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < num_vectors; i += gridDim.x * blockDim.x) {
+        const Vector<T> x0 = in0[i];
+        const Vector<T> x1 = in1[i];
+        Vector<T> y;
+#pragma unroll
+        for (size_t j = 0; j < Vector<T>::size; ++j) {
+            y.values[j] = OP::op(x0.values[j], x1.values[j], args...);
+        }
+        out[i] = y;
+    }
+}
+
 template <typename T, typename OP, typename... Args>
 __global__ void elementwise_binary_broadcasting(const T* in0,
                                                 NumpyBroadcastMapper in0_mapper,
@@ -45,13 +61,82 @@ __global__ void elementwise_binary_broadcasting(const T* in0,
     }
 }
 
+template <typename OP, bool ConstantFirst, typename T, typename... Args>
+__device__ inline auto constant_operand_op(T x, T constant, Args... args) {
+    if constexpr (ConstantFirst) {
+        return OP::op(constant, x, args...);
+    } else {
+        return OP::op(x, constant, args...);
+    }
+}
+
+template <typename T, typename OP, bool ConstantFirst, typename... Args>
+__global__ void elementwise_binary_scalar(const T* in, T scalar, T* out, size_t out_num_elements, Args... args) {
+    const unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < out_num_elements) {
+        out[i] = constant_operand_op<OP, ConstantFirst>(in[i], scalar, args...);
+    }
+}
+
+template <typename T, typename OP, bool ConstantFirst, typename... Args>
+__global__ void elementwise_binary_scalar_vectorized(
+    const Vector<T>* in, T scalar, Vector<T>* out, size_t num_vectors, Args... args) {
+    for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < num_vectors; i += gridDim.x * blockDim.x) {
+        const Vector<T> x = in[i];
+        Vector<T> y;
+#pragma unroll
+        for (size_t j = 0; j < Vector<T>::size; ++j) {
+            y.values[j] = constant_operand_op<OP, ConstantFirst>(x.values[j], scalar, args...);
+        }
+        out[i] = y;
+    }
+}
+
+/**
+ * The per-channel vector is loaded into shared memory once per block, each block then processes
+ * elements in a grid-stride loop
+ */
+template <typename T, typename OP, bool ConstantFirst, typename... Args>
+__global__ void elementwise_binary_per_channel(const T* in,
+                                               const T* channel_values,
+                                               FastDivmod inner_size,
+                                               FastDivmod num_channels,
+                                               T* out,
+                                               size_t out_num_elements,
+                                               Args... args) {
+    extern __shared__ __align__(16) unsigned char elementwise_binary_shared[];
+    T* channels = reinterpret_cast<T*>(elementwise_binary_shared);
+    for (unsigned c = threadIdx.x; c < num_channels.divisor(); c += blockDim.x) {
+        channels[c] = channel_values[c];
+    }
+    __syncthreads();
+    for (unsigned i = blockIdx.x * blockDim.x + threadIdx.x; i < out_num_elements; i += gridDim.x * blockDim.x) {
+        unsigned outer = 0;
+        unsigned channel = 0;
+        num_channels.divmod(inner_size.div(i), outer, channel);
+        out[i] = constant_operand_op<OP, ConstantFirst>(in[i], channels[channel], args...);
+    }
+}
+
 #endif  // __CUDACC__
 
+/**
+ * Tag of the variant of ElementwiseBinary, where one of inputs is a constant described by
+ * NumpyBroadcastMapper::scalar() or NumpyBroadcastMapper::perChannel() and the other one isn't broadcasted
+ */
+template <bool ConstantFirst>
+struct ConstantOperand {};
+
 template <typename ElementTypes, template <typename> typename OP>
 class ElementwiseBinary {
 public:
     ElementwiseBinary(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block)
-        : num_blocks_{}, threads_per_block_{}, element_type_{element_type}, out_num_elements_{out_num_elements} {
+        : num_blocks_{},
+          threads_per_block_{},
+          max_threads_per_block_{max_threads_per_block},
+          max_resident_blocks_{maxResidentBlocks(max_threads_per_block)},
+          element_type_{element_type},
+          out_num_elements_{out_num_elements} {
         TypeValidator<ElementTypes>::check(element_type);
         std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(out_num_elements, max_threads_per_block);
     }
@@ -66,6 +151,26 @@ public:
                     Args&&... args) const {
         if (in0_mapper.identity() && in1_mapper.identity()) {
             (*this)(stream, in0, in1, out, std::forward<Args>(args)...);
+        } else if (in0_mapper.identity() && (in1_mapper.scalar() || in1_mapper.perChannel())) {
+            ElementTypes::switch_(element_type_,
+                                  *this,
+                                  ConstantOperand<false>{},
+                                  stream,
+                                  in0,
+                                  in1,
+                                  in1_mapper,
+                                  out,
+                                  std::forward<Args>(args)...);
+        } else if (in1_mapper.identity() && (in0_mapper.scalar() || in0_mapper.perChannel())) {
+            ElementTypes::switch_(element_type_,
+                                  *this,
+                                  ConstantOperand<true>{},
+                                  stream,
+                                  in1,
+                                  in0,
+                                  in0_mapper,
+                                  out,
+                                  std::forward<Args>(args)...);
         } else {
             ElementTypes::switch_(
                 element_type_, *this, stream, in0, in0_mapper, in1, in1_mapper, out, std::forward<Args>(args)...);
@@ -75,6 +180,8 @@ public:
     /**
      * Simple variant of elementwise invocation for the case when all input and output shapes are the same.
      * It is expected to be more quick then generic variant which supports broadcasting.
+     * When all buffers are 16-byte aligned and the size is a multiple of the vector width,
+     * elements are loaded and stored with 128-bit accesses in a grid-stride loop.
      */
     template <typename... Args>
     void operator()(cudaStream_t stream, const void* in0, const void* in1, void* out, Args&&... args) const {
@@ -116,10 +223,83 @@ private:
         throwTypeNotSupported(t);
     }
 
+    template <typename T, bool ConstantFirst, typename... Args>
+    constexpr void case_(ConstantOperand<ConstantFirst>,
+                         cudaStream_t stream,
+                         const void* in,
+                         const void* constant,
+                         const NumpyBroadcastMapper& constant_mapper,
+                         void* out,
+                         Args&&... args) const noexcept {
+#ifdef __CUDACC__
+        if (constant_mapper.scalar()) {
+            const T scalar = constant_mapper.scalarValue<T>();
+            if (out_num_elements_ % Vector<T>::size == 0 && isVectorAligned(in) && isVectorAligned(out)) {
+                const size_t num_vectors = out_num_elements_ / Vector<T>::size;
+                unsigned num_blocks{}, threads_per_block{};
+                std::tie(num_blocks, threads_per_block) =
+                    calculateGridStrideGrid(num_vectors, max_threads_per_block_, max_resident_blocks_);
+                elementwise_binary_scalar_vectorized<T, OP<T>, ConstantFirst>
+                    <<<num_blocks, threads_per_block, 0, stream>>>(static_cast<const Vector<T>*>(in),
+                                                                   scalar,
+                                                                   static_cast<Vector<T>*>(out),
+                                                                   num_vectors,
+                                                                   std::forward<Args>(args)...);
+                return;
+            }
+            elementwise_binary_scalar<T, OP<T>, ConstantFirst>
+                <<<num_blocks_, threads_per_block_, 0, stream>>>(static_cast<const T*>(in),
+                                                                 scalar,
+                                                                 static_cast<T*>(out),
+                                                                 out_num_elements_,
+                                                                 std::forward<Args>(args)...);
+            return;
+        }
+        unsigned num_blocks{}, threads_per_block{};
+        std::tie(num_blocks, threads_per_block) =
+            calculateGridStrideGrid(out_num_elements_, max_threads_per_block_, max_resident_blocks_);
+        const size_t shared_size = constant_mapper.numChannels().divisor() * sizeof(T);
+        elementwise_binary_per_channel<T, OP<T>, ConstantFirst>
+            <<<num_blocks, threads_per_block, shared_size, stream>>>(static_cast<const T*>(in),
+                                                                     static_cast<const T*>(constant),
+                                                                     constant_mapper.innerSize(),
+                                                                     constant_mapper.numChannels(),
+                                                                     static_cast<T*>(out),
+                                                                     out_num_elements_,
+                                                                     std::forward<Args>(args)...);
+#endif  // __CUDACC__
+    }
+
+    template <typename T, bool ConstantFirst, typename... Args>
+    void default_(T t,
+                  ConstantOperand<ConstantFirst>,
+                  cudaStream_t,
+                  const void*,
+                  const void*,
+                  const NumpyBroadcastMapper&,
+                  void*,
+                  Args...) const noexcept {
+        throwTypeNotSupported(t);
+    }
+
     template <typename T, typename... Args>
     constexpr void case_(cudaStream_t stream, const void* in0, const void* in1, void* out, Args&&... args) const
         noexcept {
 #ifdef __CUDACC__
+        if (out_num_elements_ % Vector<T>::size == 0 && isVectorAligned(in0) && isVectorAligned(in1) &&
+            isVectorAligned(out)) {
+            const size_t num_vectors = out_num_elements_ / Vector<T>::size;
+            unsigned num_blocks{}, threads_per_block{};
+            std::tie(num_blocks, threads_per_block) =
+                calculateGridStrideGrid(num_vectors, max_threads_per_block_, max_resident_blocks_);
+            elementwise_binary_vectorized<T, OP<T>>
+                <<<num_blocks, threads_per_block, 0, stream>>>(static_cast<const Vector<T>*>(in0),
+                                                               static_cast<const Vector<T>*>(in1),
+                                                               static_cast<Vector<T>*>(out),
+                                                               num_vectors,
+                                                               std::forward<Args>(args)...);
+            return;
+        }
         elementwise_binary<T, OP<T>><<<num_blocks_, threads_per_block_, 0, stream>>>(static_cast<const T*>(in0),
                                                                                      static_cast<const T*>(in1),
                                                                                      static_cast<T*>(out),
@@ -136,6 +316,8 @@ private:
 private:
     size_t num_blocks_;
     size_t threads_per_block_;
+    size_t max_threads_per_block_;
+    size_t max_resident_blocks_;
     Type_t element_type_;
     size_t out_num_elements_;
 };
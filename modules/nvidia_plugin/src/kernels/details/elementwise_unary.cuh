@@ -11,6 +11,7 @@
 
 #include "cuda_type_traits.hpp"
 #include "element_types_switch.hpp"
+#include "elementwise_vectorized.cuh"
 #include "tensor_helpers.hpp"
 #include "type_validator.hpp"
 #ifdef __CUDACC__
@@ -31,6 +32,19 @@ __global__ void elementwise_unary(const T* in, size_t num_elements, T* out, Args
     }
 }
 
+template <typename T, typename OP, typename... Args>
+__global__ void elementwise_unary_vectorized(const Vector<T>* in, size_t num_vectors, Vector<T>* out, Args... args) {
+    for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < num_vectors; i += gridDim.x * blockDim.x) {
+        const Vector<T> x = in[i];
+        Vector<T> y;
+#pragma unroll
+        for (size_t j = 0; j < Vector<T>::size; ++j) {
+            y.values[j] = OP::op(x.values[j], args...);
+        }
+        out[i] = y;
+    }
+}
+
 #endif  // __CUDACC__
 
 template <typename ElementTypes, template <typename> typename OP>
@@ -40,6 +54,8 @@ public:
         : element_type_{element_type}, num_elements_{num_elements} {
         TypeValidator<ElementTypes>::check(element_type);
         std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(num_elements_, max_threads_per_block);
+        max_threads_per_block_ = max_threads_per_block;
+        max_resident_blocks_ = maxResidentBlocks(max_threads_per_block);
     }
 
     /**
@@ -53,6 +69,18 @@ public:
     template <typename T, typename... Args>
     constexpr void callKernel(cudaStream_t stream, const void* in, void* out, Args&&... args) const noexcept {
 #ifdef __CUDACC__
+        if (num_elements_ % Vector<T>::size == 0 && isVectorAligned(in) && isVectorAligned(out)) {
+            const size_t num_vectors = num_elements_ / Vector<T>::size;
+            unsigned num_blocks{}, threads_per_block{};
+            std::tie(num_blocks, threads_per_block) =
+                calculateGridStrideGrid(num_vectors, max_threads_per_block_, max_resident_blocks_);
+            elementwise_unary_vectorized<T, OP<T>>
+                <<<num_blocks, threads_per_block, 0, stream>>>(static_cast<const Vector<T>*>(in),
+                                                               num_vectors,
+                                                               static_cast<Vector<T>*>(out),
+                                                               std::forward<Args>(args)...);
+            return;
+        }
         elementwise_unary<T, OP<T>><<<num_blocks_, threads_per_block_, 0, stream>>>(
             static_cast<const T*>(in), num_elements_, static_cast<T*>(out), std::forward<Args>(args)...);
 #endif  // __CUDACC__
@@ -73,6 +101,40 @@ private:
     size_t num_elements_;
     size_t num_blocks_;
     size_t threads_per_block_;
+    size_t max_threads_per_block_;
+    size_t max_resident_blocks_;
+};
+
+/**
+ * ElementwiseUnary of OP<T, false> with full precision math or of OP<T, true> with fast approximations
+ * (see ov::nvidia_gpu::fast_math), which one is chosen at construction
+ */
+template <typename ElementTypes, template <typename, bool> typename OP>
+class ElementwiseUnaryMath {
+    template <typename T>
+    using PreciseOp = OP<T, false>;
+    template <typename T>
+    using FastOp = OP<T, true>;
+
+public:
+    ElementwiseUnaryMath(Type_t element_type, size_t max_threads_per_block, size_t num_elements, bool fast_math)
+        : precise_{element_type, max_threads_per_block, num_elements},
+          fast_{element_type, max_threads_per_block, num_elements},
+          fast_math_{fast_math} {}
+
+    template <typename... Args>
+    void operator()(cudaStream_t stream, const void* in, void* out, Args&&... args) const {
+        if (fast_math_) {
+            fast_(stream, in, out, std::forward<Args>(args)...);
+        } else {
+            precise_(stream, in, out, std::forward<Args>(args)...);
+        }
+    }
+
+private:
+    ElementwiseUnary<ElementTypes, PreciseOp> precise_;
+    ElementwiseUnary<ElementTypes, FastOp> fast_;
+    bool fast_math_;
 };
 
 }  // namespace kernel
@@ -0,0 +1,69 @@
+// Copyright (C) 2021-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Width of the widest global memory transaction a single thread can issue
+ */
+constexpr size_t kVectorizedAccessBytes = 16;
+
+/**
+ * Pack of elements, which is loaded and stored with a single 128-bit instruction.
+ * Element-wise kernels use it when every buffer is aligned to kVectorizedAccessBytes
+ * and the number of elements is a multiple of Vector<T>::size.
+ */
+template <typename T>
+struct alignas(kVectorizedAccessBytes) Vector {
+    static_assert(sizeof(T) <= kVectorizedAccessBytes);
+    static constexpr size_t size = kVectorizedAccessBytes / sizeof(T);
+    T values[size];
+};
+
+inline bool isVectorAligned(const void* ptr) noexcept {
+    return reinterpret_cast<std::uintptr_t>(ptr) % kVectorizedAccessBytes == 0;
+}
+
+/**
+ * @returns Number of blocks of the given size, which the current device keeps resident at once
+ */
+inline size_t maxResidentBlocks(const size_t threads_per_block) {
+    int device = 0;
+    int num_multiprocessors = 0;
+    int max_threads_per_multiprocessor = 0;
+    throwIfError(cudaGetDevice(&device));
+    throwIfError(cudaDeviceGetAttribute(&num_multiprocessors, cudaDevAttrMultiProcessorCount, device));
+    throwIfError(
+        cudaDeviceGetAttribute(&max_threads_per_multiprocessor, cudaDevAttrMaxThreadsPerMultiProcessor, device));
+    const size_t blocks_per_multiprocessor = std::max<size_t>(max_threads_per_multiprocessor / threads_per_block, 1);
+    return num_multiprocessors * blocks_per_multiprocessor;
+}
+
+/**
+ * Grid for a grid-stride loop over size items: no more blocks than the device keeps resident,
+ * so that every thread processes several items instead of a tail of short-living blocks being scheduled.
+ */
+inline std::pair<unsigned, unsigned> calculateGridStrideGrid(const size_t size,
+                                                             const size_t max_threads_per_block,
+                                                             const size_t max_resident_blocks) {
+    const auto threads_per_block = std::max<size_t>(std::min(size, max_threads_per_block), 1);
+    const auto num_blocks = std::min((size + threads_per_block - 1) / threads_per_block, max_resident_blocks);
+    return {std::max<size_t>(num_blocks, 1), threads_per_block};
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime_api.h>
+
+#include <cstdint>
+
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Division of 32-bit unsigned integers by a divisor known on the host.
+ * The quotient is computed with a multiply-high and a shift by magic constants, which are precomputed
+ * on the host (Granlund & Montgomery), instead of the much slower hardware integer division.
+ */
+class FastDivmod {
+public:
+    FastDivmod() = default;
+
+    __host__ explicit FastDivmod(unsigned divisor) : divisor_{divisor} {
+        assertThrow(divisor != 0, "FastDivmod: divisor == 0");
+        while ((std::uint64_t{1} << shift_) < divisor) {
+            ++shift_;
+        }
+        const std::uint64_t magic = (std::uint64_t{1} << 32) * ((std::uint64_t{1} << shift_) - divisor) / divisor + 1;
+        multiplier_ = static_cast<unsigned>(magic);
+    }
+
+    __host__ __device__ unsigned divisor() const { return divisor_; }
+
+#ifdef __CUDACC__
+    __device__ unsigned div(unsigned n) const {
+        return static_cast<unsigned>((static_cast<unsigned long long>(__umulhi(n, multiplier_)) + n) >> shift_);
+    }
+
+    __device__ void divmod(unsigned n, unsigned& quotient, unsigned& remainder) const {
+        quotient = div(n);
+        remainder = n - quotient * divisor_;
+    }
+#endif  // __CUDACC__
+
+private:
+    unsigned divisor_ = 1;
+    unsigned multiplier_ = 1;
+    unsigned shift_ = 0;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -7,16 +7,62 @@
 #include <cuda.h>
 #include <cuda_runtime_api.h>
 
+#include <cstring>
+#include <vector>
+
 #include "error.hpp"
+#include "fast_divmod.cuh"
 
 namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
+/**
+ * Maps an index of an element of the output tensor to the index of the element of
+ * a numpy-broadcasted input tensor.
+ *
+ * Shapes of up to kMaxInlineRank dimensions (after the dimensions, which are broadcasted
+ * in the same way, were merged on the host) are passed to kernels by value together with
+ * precomputed fast-divmod constants. Larger shapes fall back to strides kept in global memory.
+ *
+ * Constant inputs, which are a single value or a per-channel vector of the output, are described
+ * by scalar() and perChannel() mappers, so kernels may pass the value by argument or keep the vector
+ * in shared memory instead of doing the index math for each element.
+ */
 class NumpyBroadcastMapper {
 public:
+    static constexpr size_t kMaxInlineRank = 6;
+    static constexpr size_t kMaxScalarSize = 8;
+
+    /**
+     * Identity mapping: input and output shapes are the same
+     */
     __host__ NumpyBroadcastMapper()
-        : src_strides_{nullptr}, dst_strides_{nullptr}, broadcasted_dims_{nullptr}, shape_rank_{0} {}
+        : kind_{Kind::Identity},
+          rank_{0},
+          inner_src_stride_{0},
+          src_strides_{nullptr},
+          dst_strides_{nullptr},
+          broadcasted_dims_{nullptr} {}
+
+    /**
+     * @param src_strides Source tensor strides, 0 for broadcasted dimensions.
+     * @param dst_strides Output tensor strides. The innermost stride is expected to be 1.
+     */
+    __host__ NumpyBroadcastMapper(const std::vector<size_t>& src_strides, const std::vector<size_t>& dst_strides)
+        : NumpyBroadcastMapper{} {
+        assertThrow(src_strides.size() == dst_strides.size(), "src_strides.size() != dst_strides.size()");
+        assertThrow(!dst_strides.empty() && dst_strides.size() <= kMaxInlineRank,
+                    "NumpyBroadcastMapper: unsupported rank");
+        assertThrow(dst_strides.back() == 1, "dst_strides.back() != 1");
+        kind_ = Kind::Inline;
+        rank_ = static_cast<unsigned>(dst_strides.size());
+        for (unsigned r = 0; r + 1 < rank_; ++r) {
+            dst_divmods_[r] = FastDivmod{static_cast<unsigned>(dst_strides[r])};
+            inline_src_strides_[r] = static_cast<unsigned>(src_strides[r]);
+        }
+        inner_src_stride_ = static_cast<unsigned>(src_strides.back());
+    }
 
     /**
      * @param broadcasted_dims for each dimension, indicates whether a dimension is broadcasted.
@@ -29,39 +75,113 @@ public:
                                   const size_t* dst_strides,
                                   const size_t* broadcasted_dims,
                                   size_t shape_rank)
-        : src_strides_{src_strides},
+        : kind_{Kind::Global},
+          rank_{static_cast<unsigned>(shape_rank)},
+          inner_src_stride_{0},
+          src_strides_{src_strides},
           dst_strides_{dst_strides},
-          broadcasted_dims_{broadcasted_dims},
-          shape_rank_{shape_rank} {
+          broadcasted_dims_{broadcasted_dims} {
         assertThrow(src_strides_ != 0, "src_strides_ == 0");
         assertThrow(dst_strides_ != 0, "dst_strides_ == 0");
         assertThrow(broadcasted_dims_ != 0, "broadcasted_dims_ == 0");
     }
 
-    __host__ __device__ bool identity() const { return broadcasted_dims_ == nullptr; }
+    /**
+     * Input of a single element
+     * @param value Host copy of the element, it's passed to kernels by value
+     * @param size Size of the element in bytes, up to kMaxScalarSize
+     */
+    __host__ static NumpyBroadcastMapper scalar(const void* value, size_t size) {
+        assertThrow(size <= kMaxScalarSize, "NumpyBroadcastMapper: unsupported scalar size");
+        NumpyBroadcastMapper mapper;
+        mapper.kind_ = Kind::Scalar;
+        std::memcpy(mapper.scalar_value_, value, size);
+        return mapper;
+    }
 
+    /**
+     * Input, which elements are broadcasted along the outer and the inner dimensions of the output,
+     * i.e. the element of the output index i is (i / inner_size) % num_channels
+     */
+    __host__ static NumpyBroadcastMapper perChannel(size_t num_channels, size_t inner_size) {
+        NumpyBroadcastMapper mapper;
+        mapper.kind_ = Kind::PerChannel;
+        mapper.rank_ = 2;
+        mapper.dst_divmods_[0] = FastDivmod{static_cast<unsigned>(inner_size)};
+        mapper.dst_divmods_[1] = FastDivmod{static_cast<unsigned>(num_channels)};
+        return mapper;
+    }
+
+    __host__ __device__ bool identity() const { return kind_ == Kind::Identity; }
+    __host__ __device__ bool scalar() const { return kind_ == Kind::Scalar; }
+    __host__ __device__ bool perChannel() const { return kind_ == Kind::PerChannel; }
+
+    template <typename T>
+    __host__ __device__ T scalarValue() const {
+        static_assert(sizeof(T) <= kMaxScalarSize, "NumpyBroadcastMapper: unsupported scalar size");
+        T value;
+        memcpy(&value, scalar_value_, sizeof(T));
+        return value;
+    }
+
+    __host__ __device__ const FastDivmod& innerSize() const { return dst_divmods_[0]; }
+    __host__ __device__ const FastDivmod& numChannels() const { return dst_divmods_[1]; }
+
+#ifdef __CUDACC__
     __device__ unsigned srcIndex(unsigned dst_index) const {
-        if (identity()) {
-            return dst_index;
-        } else {
-            unsigned src_idx = 0;
-            unsigned i = dst_index;
-            for (unsigned r = 0; r < shape_rank_; r++) {
-                const unsigned dst_stride = dst_strides_[r];
-                const unsigned dst_coord = i / dst_stride;
-                i = i % dst_stride;
-                const unsigned src_coord = broadcasted_dims_[r] * dst_coord;
-                src_idx += src_coord * src_strides_[r];
+        switch (kind_) {
+            case Kind::Identity:
+                return dst_index;
+            case Kind::Scalar:
+                return 0;
+            case Kind::PerChannel: {
+                unsigned outer = 0;
+                unsigned channel = 0;
+                dst_divmods_[1].divmod(dst_divmods_[0].div(dst_index), outer, channel);
+                return channel;
+            }
+            case Kind::Inline: {
+                unsigned src_idx = 0;
+                unsigned i = dst_index;
+#pragma unroll
+                for (unsigned r = 0; r + 1 < kMaxInlineRank; r++) {
+                    if (r + 1 >= rank_) {
+                        break;
+                    }
+                    unsigned dst_coord = 0;
+                    dst_divmods_[r].divmod(i, dst_coord, i);
+                    src_idx += dst_coord * inline_src_strides_[r];
+                }
+                return src_idx + i * inner_src_stride_;
+            }
+            default: {
+                unsigned src_idx = 0;
+                unsigned i = dst_index;
+                for (unsigned r = 0; r < rank_; r++) {
+                    const unsigned dst_stride = dst_strides_[r];
+                    const unsigned dst_coord = i / dst_stride;
+                    i = i % dst_stride;
+                    const unsigned src_coord = broadcasted_dims_[r] * dst_coord;
+                    src_idx += src_coord * src_strides_[r];
+                }
+                return src_idx;
             }
-            return src_idx;
         }
     }
+#endif  // __CUDACC__
 
 private:
+    enum class Kind : unsigned { Identity, Inline, Global, Scalar, PerChannel };
+
+    Kind kind_;
+    unsigned rank_;
+    FastDivmod dst_divmods_[kMaxInlineRank - 1];
+    unsigned inline_src_strides_[kMaxInlineRank - 1] = {};
+    unsigned inner_src_stride_;
     const size_t* src_strides_;
     const size_t* dst_strides_;
     const size_t* broadcasted_dims_;
-    size_t shape_rank_;
+    alignas(kMaxScalarSize) unsigned char scalar_value_[kMaxScalarSize] = {};
 };
 
 }  // namespace kernel
@@ -0,0 +1,63 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime_api.h>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+#ifdef __CUDACC__
+
+/**
+ * Running mean and sum of squared deviations (Welford's algorithm), which are numerically stable
+ * and are computed by a single pass over values
+ */
+struct Welford {
+    float count = 0.0f;
+    float mean = 0.0f;
+    float m2 = 0.0f;
+
+    __device__ __forceinline__ void add(float value) {
+        count += 1.0f;
+        const float delta = value - mean;
+        mean += delta / count;
+        m2 += delta * (value - mean);
+    }
+
+    __device__ __forceinline__ void merge(const Welford& other) {
+        const float total = count + other.count;
+        if (total == 0.0f) {
+            return;
+        }
+        const float delta = other.mean - mean;
+        const float other_fraction = other.count / total;
+        mean += delta * other_fraction;
+        m2 += other.m2 + delta * delta * count * other_fraction;
+        count = total;
+    }
+};
+
+/**
+ * @returns Statistics merged over all lanes of the warp, each lane gets the result
+ */
+__device__ __forceinline__ Welford warp_reduce(Welford value) {
+    constexpr unsigned warp_size = 32;
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        Welford other;
+        other.count = __shfl_xor_sync(0xFFFFFFFF, value.count, offset);
+        other.mean = __shfl_xor_sync(0xFFFFFFFF, value.mean, offset);
+        other.m2 = __shfl_xor_sync(0xFFFFFFFF, value.m2, offset);
+        value.merge(other);
+    }
+    return value;
+}
+
+#endif  // __CUDACC__
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
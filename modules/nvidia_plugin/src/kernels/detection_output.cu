@@ -7,6 +7,7 @@
 
 #include <cuda/float16.hpp>
 #include <cuda/math.cuh>
+#include <cuda/stl/algorithms/block.cuh>
 #include <cuda/stl/algorithms/sort.cuh>
 #include <cuda/stl/array.cuh>
 #include <cuda/stl/atomic.cuh>
@@ -14,6 +15,7 @@
 #include <cuda/stl/mdvector.cuh>
 #include <cuda/stl/span.cuh>
 
+#include "details/block_nms.cuh"
 #include "details/error.hpp"
 #include "details/type_validator.hpp"
 #include "detection_output.hpp"
@@ -24,6 +26,8 @@ namespace kernel {
 
 namespace cumath = CUDA::math;
 
+constexpr unsigned caffe_nms_block_size = 256;
+
 __device__ unsigned get_image_idx() { return blockIdx.x; }
 __device__ int get_image_idx(const DetectionOutput::Attrs& attrs) {
     const int i = get_image_idx() * blockDim.x + threadIdx.x;
@@ -455,6 +459,23 @@ __global__ void detection_output_stage_0_get_loc_predictions_with_arm(
     get_loc_predictions(attrs, armLocData, armLocPreds);
 }
 
+/**
+ * Candidates are ordered by descending scores, candidates with equal scores by ascending prior indices
+ */
+template <typename TDataType>
+__device__ bool precedes(const CUDA::Pair<TDataType, CUDA::Pair<int, int>>& pair1,
+                         const CUDA::Pair<TDataType, CUDA::Pair<int, int>>& pair2) {
+    return pair1.first > pair2.first ||
+           (!(pair2.first > pair1.first) && pair1.second.second < pair2.second.second);
+}
+
+/**
+ * Each block of caffe_nms_block_size threads processes one class of one image:
+ *  - candidates above the confidence threshold are compacted in the order of priors by a block-wide prefix sum;
+ *  - candidates are sorted by the block;
+ *  - greedy NMS over top_k best candidates is performed by the block (see nms::block_greedy_nms).
+ * The bitmask of NMS takes nms::bitmask_words(num_priors) words of dynamic shared memory
+ */
 template <typename TDataType>
 __global__ void detection_output_stage_1_caffe_nms(
     const DetectionOutput::Attrs& attrs,
@@ -463,51 +484,52 @@ __global__ void detection_output_stage_1_caffe_nms(
     CUDA::MDVector<CUDA::Pair<TDataType, CUDA::Pair<int, int>>, 2> scorePerClassPrioIdxs,
     CUDA::MDVector<int, 2> prioBoxIdxsByClass,
     CUDA::Span<CUDA::DeviceAtomic<unsigned>> numDets) {
+    extern __shared__ unsigned suppressed[];
+
     const auto image_idx = get_image_idx();
     const auto class_idx = get_class_idx();
-    // TODO: Check if performance with changes after moving class_idx in warp dimensions
-    //    const auto class_idx = get_class_idx(attrs);
-    //    if (class_idx == -1) { return; }
-
     if (class_idx == attrs.background_label_id) {
         return;
     }
 
-    int label = attrs.share_location ? 0 : class_idx;
-    auto& numDet = numDets[image_idx];
+    const int label = attrs.share_location ? 0 : class_idx;
+    const unsigned num_priors = confPreds.extent(2);
     CUDA::Span<const NormalizedBBox<TDataType>> bboxes{&decodeBboxes(image_idx, label, 0), decodeBboxes.extent(2)};
     CUDA::Span<const TDataType> scores{&confPreds(image_idx, class_idx, 0), confPreds.extent(2)};
-    auto localScorePerClassPrioIdxs = scorePerClassPrioIdxs(image_idx, class_idx);
-    for (int priorIdx = 0; priorIdx < scores.size(); ++priorIdx) {
-        TDataType conf = scores[priorIdx];
-        if (conf > TDataType{attrs.confidence_threshold}) {
-            localScorePerClassPrioIdxs.push_back(CUDA::make_pair(conf, CUDA::make_pair(class_idx, priorIdx)));
+    auto* candidates = scorePerClassPrioIdxs(image_idx, class_idx).data();
+
+    unsigned num_candidates = 0;
+    for (unsigned first = 0; first < num_priors; first += caffe_nms_block_size) {
+        const unsigned priorIdx = first + threadIdx.x;
+        const bool candidate = priorIdx < num_priors && scores[priorIdx] > TDataType{attrs.confidence_threshold};
+        unsigned block_candidates = 0;
+        const unsigned offset = num_candidates + CUDA::algorithms::block::exclusive_count(candidate, block_candidates);
+        if (candidate) {
+            candidates[offset] =
+                CUDA::make_pair(scores[priorIdx], CUDA::make_pair(class_idx, static_cast<int>(priorIdx)));
         }
+        num_candidates += block_candidates;
     }
-    CUDA::algorithms::partial_quick_sort_iterative(localScorePerClassPrioIdxs.begin(),
-                                                   localScorePerClassPrioIdxs.end(),
-                                                   attrs.top_k,
-                                                   SortScorePairDescend<TDataType, CUDA::Pair<int, int>>{});
-
-    if (-1 != attrs.top_k && localScorePerClassPrioIdxs.size() > static_cast<size_t>(attrs.top_k)) {
-        localScorePerClassPrioIdxs.resize(attrs.top_k);
-    }
+    __syncthreads();
+    nms::block_sort(candidates, num_candidates, [](const auto& pair1, const auto& pair2) {
+        return precedes(pair1, pair2);
+    });
 
+    const unsigned num_top = (-1 != attrs.top_k && num_candidates > static_cast<unsigned>(attrs.top_k))
+                                 ? static_cast<unsigned>(attrs.top_k)
+                                 : num_candidates;
     auto prioBoxIdxs = prioBoxIdxsByClass(image_idx, class_idx);
-    for (const auto& scorePerPrioIdx : localScorePerClassPrioIdxs) {
-        const int priorIdx = scorePerPrioIdx.second.second;
-        bool keep = true;
-        for (const auto& keptPrioIdx : prioBoxIdxs) {
-            const TDataType overlap = jaccard_overlap(bboxes[priorIdx], bboxes[keptPrioIdx]);
-            if (overlap > TDataType{attrs.nms_threshold}) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            prioBoxIdxs.push_back(priorIdx);
-            numDet += 1;
-        }
+    const unsigned num_kept = nms::block_greedy_nms(
+        num_top,
+        num_top,
+        suppressed,
+        [&](unsigned i, unsigned j) {
+            return jaccard_overlap(bboxes[candidates[i].second.second], bboxes[candidates[j].second.second]) >
+                   TDataType{attrs.nms_threshold};
+        },
+        [&](unsigned i, unsigned) { prioBoxIdxs.push_back(candidates[i].second.second); });
+    if (threadIdx.x == 0) {
+        numDets[image_idx] += num_kept;
     }
 }
 
@@ -1202,7 +1224,11 @@ void DetectionOutput::call(const CUDA::Stream& stream,
 #endif
 
     if (!attrs_.decrease_label_id) {
-        detection_output_stage_1_caffe_nms<<<dim3(attrs_.num_images, attrs_.num_classes, 1), 1, 0, stream.get()>>>(
+        const size_t suppressed_size = nms::bitmask_words(attrs_.num_priors) * sizeof(unsigned);
+        detection_output_stage_1_caffe_nms<<<dim3(attrs_.num_images, attrs_.num_classes),
+                                             caffe_nms_block_size,
+                                             suppressed_size,
+                                             stream.get()>>>(
             dattrs, decodeBboxes, confPreds, tempScorePerClassPrioIdxs0, prioBoxIdxsByClass, numDets);
     } else {
         detection_output_stage_1_mxnet_nms<<<dim3(attrs_.num_images), 1, 0, stream.get()>>>(
@@ -12,15 +12,18 @@ namespace nvidia_gpu {
 namespace kernel {
 
 namespace cumath = CUDA::math;
-template <typename T>
+template <typename T, bool Fast>
 struct EluOpImpl {
     __device__ static inline T op(T x, float alpha) {
-        return x >= static_cast<T>(0.0) ? x : static_cast<T>(alpha) * (cumath::exp(x) - static_cast<T>(1.0));
+        if (x >= static_cast<T>(0.0)) {
+            return x;
+        }
+        return static_cast<T>(alpha) * ((Fast ? cumath::fast::exp(x) : cumath::exp(x)) - static_cast<T>(1.0));
     }
 };
 
-Elu::Elu(Type_t element_type, size_t max_threads_per_block, size_t num_elements, float alpha)
-    : impl_{element_type, max_threads_per_block, num_elements}, alpha_{alpha} {}
+Elu::Elu(Type_t element_type, size_t max_threads_per_block, size_t num_elements, float alpha, bool fast_math)
+    : impl_{element_type, max_threads_per_block, num_elements, fast_math}, alpha_{alpha} {}
 
 void Elu::operator()(cudaStream_t stream, const void* in, void* out) const { impl_(stream, in, out, alpha_); }
 
@@ -11,17 +11,17 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
-template <typename T>
+template <typename T, bool Fast>
 struct EluOpImpl;
 
 class Elu {
 public:
-    Elu(Type_t element_type, size_t max_threads_per_block, size_t num_elements, float alpha);
+    Elu(Type_t element_type, size_t max_threads_per_block, size_t num_elements, float alpha, bool fast_math = false);
 
     void operator()(cudaStream_t stream, const void* in, void* out) const;
 
 private:
-    ElementwiseUnary<FloatElementTypesSwitch, EluOpImpl> impl_;
+    ElementwiseUnaryMath<FloatElementTypesSwitch, EluOpImpl> impl_;
     float alpha_;
 };
 
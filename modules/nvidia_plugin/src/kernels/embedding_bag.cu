@@ -0,0 +1,119 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "embedding_bag.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename T, typename TIndex>
+static __global__ void embedding_bag(size_t num_embeddings,
+                                     size_t embedding_size,
+                                     size_t bag_size,
+                                     const T* table,
+                                     const TIndex* indices,
+                                     const T* weights,
+                                     T* out) {
+    const size_t column = static_cast<size_t>(blockIdx.y) * blockDim.x + threadIdx.x;
+    if (column >= embedding_size) {
+        return;
+    }
+    const size_t bag = blockIdx.x;
+    const TIndex* bag_indices = indices + bag * bag_size;
+    float sum = 0.0f;
+    for (size_t i = 0; i < bag_size; ++i) {
+        const auto index = static_cast<long long>(bag_indices[i]);
+        // Negative indices count from the end of the table as in Gather
+        const size_t row = index < 0 ? static_cast<size_t>(index + num_embeddings) : static_cast<size_t>(index);
+        const float value = static_cast<float>(table[row * embedding_size + column]);
+        sum += weights ? value * static_cast<float>(weights[bag * bag_size + i]) : value;
+    }
+    out[bag * embedding_size + column] = static_cast<T>(sum);
+}
+
+EmbeddingBag::EmbeddingBag(Type_t element_type,
+                           Type_t index_type,
+                           size_t num_embeddings,
+                           size_t embedding_size,
+                           size_t num_bags,
+                           size_t bag_size,
+                           unsigned max_threads_per_block)
+    : element_type_{element_type},
+      index_type_{index_type},
+      num_embeddings_{num_embeddings},
+      embedding_size_{embedding_size},
+      num_bags_{num_bags},
+      bag_size_{bag_size},
+      threads_per_block_{static_cast<unsigned>(std::min<size_t>(embedding_size, max_threads_per_block))} {
+    if (!isTypeSupported(element_type_, index_type_)) {
+        throw_ov_exception(fmt::format("Element type = {}, index type = {} are not supported by EmbeddingBag operation !!",
+                                       element_type_,
+                                       index_type_));
+    }
+}
+
+bool EmbeddingBag::isTypeSupported(Type_t element_type, Type_t index_type) {
+    if (index_type != Type_t::i32 && index_type != Type_t::i64) {
+        return false;
+    }
+    switch (element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+void EmbeddingBag::operator()(
+    cudaStream_t stream, const void* table, const void* indices, const void* weights, void* out) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, table, indices, weights, out);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, table, indices, weights, out);
+#endif
+        default:
+            return call<float>(stream, table, indices, weights, out);
+    }
+}
+
+template <typename T>
+void EmbeddingBag::call(
+    cudaStream_t stream, const void* table, const void* indices, const void* weights, void* out) const {
+    if (index_type_ == Type_t::i32) {
+        return launch<T, int32_t>(stream, table, indices, weights, out);
+    }
+    return launch<T, int64_t>(stream, table, indices, weights, out);
+}
+
+template <typename T, typename TIndex>
+void EmbeddingBag::launch(
+    cudaStream_t stream, const void* table, const void* indices, const void* weights, void* out) const {
+    const dim3 grid{static_cast<unsigned>(num_bags_),
+                    static_cast<unsigned>((embedding_size_ + threads_per_block_ - 1) / threads_per_block_)};
+    embedding_bag<T, TIndex><<<grid, threads_per_block_, 0, stream>>>(num_embeddings_,
+                                                                      embedding_size_,
+                                                                      bag_size_,
+                                                                      static_cast<const T*>(table),
+                                                                      static_cast<const TIndex*>(indices),
+                                                                      static_cast<const T*>(weights),
+                                                                      static_cast<T*>(out));
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,60 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Sums rows of an embedding table [num_embeddings, embedding_size] selected by packed indices [num_bags, bag_size],
+ * optionally multiplied by per sample weights of the same shape as indices. Each thread accumulates one column of
+ * one bag in FP32, so the gathered rows are never stored and neighbouring threads read neighbouring values of a row
+ */
+class EmbeddingBag {
+public:
+    EmbeddingBag(Type_t element_type,
+                 Type_t index_type,
+                 size_t num_embeddings,
+                 size_t embedding_size,
+                 size_t num_bags,
+                 size_t bag_size,
+                 unsigned max_threads_per_block);
+    EmbeddingBag(EmbeddingBag&&) = default;
+    EmbeddingBag& operator=(EmbeddingBag&&) = default;
+
+    /**
+     * @param weights Per sample weights or nullptr
+     */
+    void operator()(cudaStream_t stream, const void* table, const void* indices, const void* weights, void* out) const;
+
+    /**
+     * @returns true if the kernel supports the element type of the table and the type of indices
+     */
+    static bool isTypeSupported(Type_t element_type, Type_t index_type);
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* table, const void* indices, const void* weights, void* out) const;
+
+    template <typename T, typename TIndex>
+    void launch(cudaStream_t stream, const void* table, const void* indices, const void* weights, void* out) const;
+
+    Type_t element_type_{};
+    Type_t index_type_{};
+    size_t num_embeddings_{};
+    size_t embedding_size_{};
+    size_t num_bags_{};
+    size_t bag_size_{};
+    unsigned threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
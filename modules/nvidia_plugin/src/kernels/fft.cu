@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "details/error.hpp"
+#include "fft.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+__global__ void fft_normalize(float* data, size_t num_elements, float scale) {
+    const size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < num_elements) {
+        data[i] *= scale;
+    }
+}
+
+}  // namespace
+
+FftNormalize::FftNormalize(const size_t num_elements, const float scale, const size_t max_threads_per_block)
+    : num_elements_{num_elements},
+      scale_{scale},
+      num_blocks_{(num_elements + max_threads_per_block - 1) / max_threads_per_block},
+      threads_per_block_{max_threads_per_block} {}
+
+void FftNormalize::operator()(const cudaStream_t stream, float* data) const {
+    if (num_elements_ == 0) {
+        return;
+    }
+    fft_normalize<<<num_blocks_, threads_per_block_, 0, stream>>>(data, num_elements_, scale_);
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
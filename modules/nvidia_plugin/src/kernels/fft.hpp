@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Orthonormal scaling of results of cuFFT, which doesn't normalize transforms
+ */
+class FftNormalize {
+public:
+    FftNormalize(size_t num_elements, float scale, size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, float* data) const;
+
+private:
+    size_t num_elements_;
+    float scale_;
+    size_t num_blocks_;
+    size_t threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
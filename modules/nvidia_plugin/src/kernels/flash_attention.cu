@@ -0,0 +1,203 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "flash_attention.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned warps_per_block = 4;
+// Each lane of a warp computes a score of one key of a tile
+constexpr unsigned tile_length = warp_size;
+constexpr unsigned max_values_per_lane = FlashAttention::max_head_size / warp_size;
+
+__device__ __forceinline__ float warp_max(float value) {
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        value = fmaxf(value, __shfl_xor_sync(0xFFFFFFFF, value, offset));
+    }
+    return value;
+}
+
+__device__ __forceinline__ float warp_sum(float value) {
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        value += __shfl_xor_sync(0xFFFFFFFF, value, offset);
+    }
+    return value;
+}
+
+}  // namespace
+
+/**
+ * Each warp computes one row of queries, warps of a block share tiles of keys and values of one head in shared memory
+ */
+template <typename T>
+static __global__ void flash_attention(
+    FlashAttention::Params p, const T* q, const T* k, const T* v, const T* mask, T* out) {
+    extern __shared__ float shared[];
+    const size_t d = p.head_size;
+    // Rows of keys are padded to avoid bank conflicts, since each lane reads its own row
+    const size_t k_row = d + 1;
+    float* q_shared = shared;
+    float* k_shared = q_shared + warps_per_block * d;
+    float* v_shared = k_shared + tile_length * k_row;
+
+    const unsigned warp = threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    const size_t head = blockIdx.x;
+    const size_t b = head / p.heads;
+    const size_t h = head % p.heads;
+    const size_t i = static_cast<size_t>(blockIdx.y) * warps_per_block + warp;
+    const bool active = i < p.q_length;
+    const T* k_head = k + head * p.kv_length * d;
+    const T* v_head = v + head * p.kv_length * d;
+    float* q_row = q_shared + warp * d;
+    if (active) {
+        for (size_t id = lane; id < d; id += warp_size) {
+            q_row[id] = static_cast<float>(q[(head * p.q_length + i) * d + id]) * p.scale;
+        }
+    }
+
+    float row_max = -INFINITY;
+    float row_sum = 0.0f;
+    float acc[max_values_per_lane] = {};
+    for (size_t j0 = 0; j0 < p.kv_length; j0 += tile_length) {
+        __syncthreads();
+        for (size_t idx = threadIdx.x; idx < tile_length * d; idx += blockDim.x) {
+            const size_t j = j0 + idx / d;
+            const size_t id = idx % d;
+            if (j < p.kv_length) {
+                k_shared[(idx / d) * k_row + id] =
+                    static_cast<float>(k_head[j * p.k_stride_length + id * p.k_stride_head]);
+                v_shared[idx] = static_cast<float>(v_head[j * d + id]);
+            }
+        }
+        __syncthreads();
+        if (!active) {
+            continue;
+        }
+
+        const size_t j = j0 + lane;
+        float score = -INFINITY;
+        if (j < p.kv_length) {
+            score = 0.0f;
+            const float* k_lane = k_shared + lane * k_row;
+            for (size_t id = 0; id < d; ++id) {
+                score += q_row[id] * k_lane[id];
+            }
+            if (mask) {
+                score += static_cast<float>(mask[b * p.mask_strides[0] + h * p.mask_strides[1] +
+                                                 i * p.mask_strides[2] + j * p.mask_strides[3]]);
+            }
+        }
+        const float new_max = fmaxf(row_max, warp_max(score));
+        // Rows masked by -inf so far don't contribute anything
+        const float probability = new_max == -INFINITY ? 0.0f : __expf(score - new_max);
+        const float correction = new_max == -INFINITY ? 1.0f : __expf(row_max - new_max);
+        row_sum = row_sum * correction + warp_sum(probability);
+        row_max = new_max;
+#pragma unroll
+        for (unsigned r = 0; r < max_values_per_lane; ++r) {
+            acc[r] *= correction;
+        }
+        const size_t tile_end = p.kv_length - j0 < tile_length ? p.kv_length - j0 : tile_length;
+        for (size_t jj = 0; jj < tile_end; ++jj) {
+            const float pj = __shfl_sync(0xFFFFFFFF, probability, jj);
+#pragma unroll
+            for (unsigned r = 0; r < max_values_per_lane; ++r) {
+                const size_t id = lane + r * warp_size;
+                if (id < d) {
+                    acc[r] += pj * v_shared[jj * d + id];
+                }
+            }
+        }
+    }
+    if (!active) {
+        return;
+    }
+    const float inverse_sum = row_sum > 0.0f ? 1.0f / row_sum : 0.0f;
+#pragma unroll
+    for (unsigned r = 0; r < max_values_per_lane; ++r) {
+        const size_t id = lane + r * warp_size;
+        if (id < d) {
+            out[(head * p.q_length + i) * d + id] = static_cast<T>(acc[r] * inverse_sum);
+        }
+    }
+}
+
+FlashAttention::FlashAttention(Type_t element_type,
+                               size_t batch,
+                               size_t heads,
+                               size_t q_length,
+                               size_t kv_length,
+                               size_t head_size,
+                               bool transpose_k,
+                               float scale,
+                               const std::array<size_t, 4>& mask_strides)
+    : element_type_{element_type}, batch_{batch} {
+    switch (element_type_) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            break;
+        default:
+            throw_ov_exception(
+                fmt::format("Element type = {} is not supported by FlashAttention operation !!", element_type_));
+    }
+    if (head_size == 0 || head_size > max_head_size) {
+        throw_ov_exception(
+            fmt::format("Head size = {} is not supported by FlashAttention operation !!", head_size));
+    }
+    params_.heads = heads;
+    params_.q_length = q_length;
+    params_.kv_length = kv_length;
+    params_.head_size = head_size;
+    params_.k_stride_length = transpose_k ? head_size : 1;
+    params_.k_stride_head = transpose_k ? 1 : kv_length;
+    std::copy(mask_strides.begin(), mask_strides.end(), params_.mask_strides);
+    params_.scale = scale;
+}
+
+void FlashAttention::operator()(
+    cudaStream_t stream, const void* q, const void* k, const void* v, const void* mask, void* out) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, q, k, v, mask, out);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, q, k, v, mask, out);
+#endif
+        default:
+            return call<float>(stream, q, k, v, mask, out);
+    }
+}
+
+template <typename T>
+void FlashAttention::call(
+    cudaStream_t stream, const void* q, const void* k, const void* v, const void* mask, void* out) const {
+    const size_t d = params_.head_size;
+    const size_t shared_size = (warps_per_block * d + tile_length * (d + 1) + tile_length * d) * sizeof(float);
+    const dim3 grid(batch_ * params_.heads, (params_.q_length + warps_per_block - 1) / warps_per_block);
+    flash_attention<T><<<grid, warps_per_block * warp_size, shared_size, stream>>>(params_,
+                                                                                  static_cast<const T*>(q),
+                                                                                  static_cast<const T*>(k),
+                                                                                  static_cast<const T*>(v),
+                                                                                  static_cast<const T*>(mask),
+                                                                                  static_cast<T*>(out));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <array>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Computes attention Softmax(Q x Kt * scale + mask) x V of tensors [batch, heads, length, head_size] tile by tile
+ * of keys and values with online softmax, so that the attention matrix isn't stored
+ */
+class FlashAttention {
+public:
+    static constexpr size_t max_head_size = 128;
+
+    struct Params {
+        size_t heads;
+        size_t q_length;
+        size_t kv_length;
+        size_t head_size;
+        // Strides of elements of keys along the length and the head dimensions
+        size_t k_stride_length;
+        size_t k_stride_head;
+        // Strides of elements of the mask along batch, heads, queries and keys, 0 for broadcasted dimensions
+        size_t mask_strides[4];
+        float scale;
+    };
+
+    FlashAttention(Type_t element_type,
+                   size_t batch,
+                   size_t heads,
+                   size_t q_length,
+                   size_t kv_length,
+                   size_t head_size,
+                   bool transpose_k,
+                   float scale,
+                   const std::array<size_t, 4>& mask_strides);
+    FlashAttention(FlashAttention&&) = default;
+    FlashAttention& operator=(FlashAttention&&) = default;
+
+    /**
+     * @param mask Additive mask, nullptr if there is no mask
+     */
+    void operator()(
+        cudaStream_t stream, const void* q, const void* k, const void* v, const void* mask, void* out) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* q, const void* k, const void* v, const void* mask, void* out) const;
+
+    Type_t element_type_{};
+    size_t batch_{};
+    Params params_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
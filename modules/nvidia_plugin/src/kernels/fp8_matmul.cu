@@ -0,0 +1,98 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+#include "fp8_matmul.hpp"
+
+#if CUDART_VERSION >= 11080
+#include <cuda_fp8.h>
+#endif
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+#if CUDART_VERSION >= 11080
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned max_amax_blocks = 1024;
+
+}  // namespace
+
+/**
+ * Absolute values aren't negative, so they are ordered the same way as their bits interpreted as integers
+ */
+template <typename T>
+static __global__ void max_abs(size_t size, const T* a, float* amax) {
+    float value = 0.0f;
+    for (size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; idx < size;
+         idx += static_cast<size_t>(gridDim.x) * blockDim.x) {
+        value = fmaxf(value, fabsf(static_cast<float>(a[idx])));
+    }
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        value = fmaxf(value, __shfl_down_sync(0xFFFFFFFF, value, offset));
+    }
+    if (threadIdx.x % warp_size == 0) {
+        atomicMax(reinterpret_cast<int*>(amax), __float_as_int(value));
+    }
+}
+
+template <typename T>
+static __global__ void quantize_fp8(size_t size, const T* a, float* scale, __nv_fp8_e4m3* out) {
+    const float amax = scale[0];
+    const float s = amax > 0.0f ? amax / Fp8MatMul::max_fp8_value : 1.0f;
+    const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx == 0) {
+        scale[1] = s;
+    }
+    if (idx >= size) {
+        return;
+    }
+    out[idx] = __nv_fp8_e4m3{static_cast<float>(a[idx]) / s};
+}
+
+#endif  // CUDART_VERSION >= 11080
+
+Fp8MatMul::Fp8MatMul(Type_t element_type, size_t size, size_t max_threads_per_block)
+    : element_type_{element_type}, size_{size}, max_threads_per_block_{max_threads_per_block} {
+#if CUDART_VERSION >= 11080
+    if (element_type_ != Type_t::f32 && element_type_ != Type_t::f16) {
+        throw_ov_exception(fmt::format("Element type = {} is not supported by Fp8MatMul operation !!", element_type_));
+    }
+#else
+    throw_ov_exception("Fp8MatMul operation requires CUDA 11.8 or newer !!");
+#endif
+}
+
+void Fp8MatMul::quantize(cudaStream_t stream, const void* a, float* scale, void* out) const {
+    if (element_type_ == Type_t::f16) {
+        return callQuantize<__half>(stream, a, scale, out);
+    }
+    return callQuantize<float>(stream, a, scale, out);
+}
+
+template <typename T>
+void Fp8MatMul::callQuantize(cudaStream_t stream, const void* a, float* scale, void* out) const {
+#if CUDART_VERSION >= 11080
+    const auto [num_blocks, threads_per_block] = calculateElementwiseGrid(size_, max_threads_per_block_);
+    throwIfError(cudaMemsetAsync(scale, 0, sizeof(float), stream));
+    // Blocks of the reduction consist of whole warps, since values are reduced by warp shuffles
+    max_abs<T><<<std::min<unsigned>(num_blocks, max_amax_blocks), max_threads_per_block_, 0, stream>>>(
+        size_, static_cast<const T*>(a), scale);
+    quantize_fp8<T><<<num_blocks, threads_per_block, 0, stream>>>(
+        size_, static_cast<const T*>(a), scale, static_cast<__nv_fp8_e4m3*>(out));
+#endif
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,45 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Converts activations [size] to FP8 (E4M3) with a per-tensor scale, so that their maximal absolute value
+ * is mapped to the maximal finite E4M3 value
+ */
+class Fp8MatMul {
+public:
+    // Maximal finite value of E4M3
+    static constexpr float max_fp8_value = 448.0f;
+
+    Fp8MatMul(Type_t element_type, size_t size, size_t max_threads_per_block);
+    Fp8MatMul(Fp8MatMul&&) = default;
+    Fp8MatMul& operator=(Fp8MatMul&&) = default;
+
+    /**
+     * Writes activations a converted to FP8 to out and their scale to scale[1], scale[0] is taken for
+     * their maximal absolute value
+     */
+    void quantize(cudaStream_t stream, const void* a, float* scale, void* out) const;
+
+private:
+    template <typename T>
+    void callQuantize(cudaStream_t stream, const void* a, float* scale, void* out) const;
+
+    Type_t element_type_{};
+    size_t size_{};
+    size_t max_threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
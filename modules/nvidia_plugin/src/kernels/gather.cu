@@ -5,8 +5,13 @@
 #include <cuda_device_runtime_api.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cuda/float16.hpp>
+#include <limits>
+#include <type_traits>
 
+#include "convert.cuh"
 #include "details/type_validator.hpp"
 #include "gather.hpp"
 
@@ -15,52 +20,72 @@ namespace nvidia_gpu {
 
 namespace kernel {
 
-template <typename DataType, typename IndexType>
-static inline __device__ void gather(unsigned data_length,
-                                     size_t index_range,
+namespace {
+
+// Element types between which Gather converts data on the fly (see FuseConvertsToGather)
+using ConvertedElementTypesSwitch = ElementTypesSwitch<Type_t::f32,
+#ifdef CUDA_HAS_BF16_TYPE
+                                                       Type_t::bf16,
+#endif
+                                                       Type_t::f16>;
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned rows_block_size = 256;
+constexpr unsigned max_rows_blocks = 65535;
+
+/**
+ * @returns Index normalized to [0, index_range), index_range if it is out of the range
+ */
+template <typename IndexType>
+__device__ __forceinline__ uint64_t normalize_index(IndexType index, uint64_t index_range) {
+    const auto signed_index = static_cast<int64_t>(index);
+    const auto normalized = signed_index < 0 ? signed_index + static_cast<int64_t>(index_range) : signed_index;
+    return normalized < 0 || static_cast<uint64_t>(normalized) >= index_range ? index_range
+                                                                               : static_cast<uint64_t>(normalized);
+}
+
+}  // namespace
+
+template <typename DataType, typename IndexType, typename OutputType, typename OffsetType>
+static inline __device__ void gather(OffsetType data_length,
+                                     OffsetType index_range,
                                      unsigned els_per_thread,
-                                     unsigned indices_size,
-                                     unsigned indices_index,
-                                     unsigned dict,
-                                     unsigned chunk,
+                                     OffsetType indices_size,
+                                     OffsetType indices_index,
+                                     OffsetType dict,
+                                     OffsetType chunk,
                                      const DataType* src_dict,
                                      const IndexType* src_index,
-                                     DataType* dst_data) {
-    auto dict_index = src_index[indices_index];
-    if (dict_index < 0) {
-        dict_index += index_range;
-    }
-    unsigned thread_offset;
-    for (int el = 0; el < els_per_thread; ++el) {
-        thread_offset = chunk + el;
+                                     OutputType* dst_data) {
+    const auto dict_index = static_cast<OffsetType>(normalize_index(src_index[indices_index], index_range));
+    for (unsigned el = 0; el < els_per_thread; ++el) {
+        const OffsetType thread_offset = chunk + el;
         if (thread_offset >= data_length) {
             return;
         }
-        const auto dst_index = data_length * (indices_index + dict * indices_size) + thread_offset;
+        const OffsetType dst_index = data_length * (indices_index + dict * indices_size) + thread_offset;
         if (dict_index < index_range) {
-            const auto src_index = data_length * (dict_index + dict * index_range) + thread_offset;
-            dst_data[dst_index] = src_dict[src_index];
+            const OffsetType src_index = data_length * (dict_index + dict * index_range) + thread_offset;
+            dst_data[dst_index] = cast<OutputType>(src_dict[src_index]);
         } else {
-            dst_data[dst_index] = static_cast<DataType>(0.0f);
+            dst_data[dst_index] = static_cast<OutputType>(0.0f);
         }
     }
 }
 
-template <typename DataType, typename IndexType>
-static __global__ void chunks_gather(unsigned data_length,
-                                     unsigned indices_size,
-                                     size_t index_range,
-                                     unsigned dicts_batch_stride,
-                                     unsigned indices_batch_stride,
-                                     unsigned out_batch_stride,
+template <typename DataType, typename IndexType, typename OutputType, typename OffsetType>
+static __global__ void chunks_gather(OffsetType data_length,
+                                     OffsetType num_dicts,
+                                     OffsetType indices_size,
+                                     OffsetType index_range,
                                      unsigned els_per_thread,
                                      const DataType* src_dict,
                                      const IndexType* src_index,
-                                     DataType* dst_data) {
-    const auto dict = blockIdx.y;
-    const auto indices_index = blockIdx.x % indices_size;
-    const auto batch = blockIdx.x / indices_size;
-    const auto chunk = (blockIdx.z * blockDim.x + threadIdx.x) * els_per_thread;
+                                     OutputType* dst_data) {
+    const OffsetType dict = blockIdx.y;
+    const OffsetType indices_index = blockIdx.x % indices_size;
+    const OffsetType batch = blockIdx.x / indices_size;
+    const OffsetType chunk = (static_cast<OffsetType>(blockIdx.z) * blockDim.x + threadIdx.x) * els_per_thread;
     gather(data_length,
            index_range,
            els_per_thread,
@@ -68,30 +93,27 @@ static __global__ void chunks_gather(unsigned data_length,
            indices_index,
            dict,
            chunk,
-           src_dict + batch * dicts_batch_stride,
-           src_index + batch * indices_batch_stride,
-           dst_data + batch * out_batch_stride);
+           src_dict + batch * num_dicts * index_range * data_length,
+           src_index + batch * indices_size,
+           dst_data + batch * num_dicts * indices_size * data_length);
 }
 
-template <typename DataType, typename IndexType>
-static __global__ void dicts_gather(unsigned num_dicts,
-                                    unsigned indices_size,
-                                    size_t index_range,
-                                    unsigned dicts_batch_stride,
-                                    unsigned indices_batch_stride,
-                                    unsigned out_batch_stride,
+template <typename DataType, typename IndexType, typename OutputType, typename OffsetType>
+static __global__ void dicts_gather(OffsetType num_dicts,
+                                    OffsetType indices_size,
+                                    OffsetType index_range,
                                     unsigned els_per_thread,
                                     const DataType* src_dict,
                                     const IndexType* src_index,
-                                    DataType* dst_data) {
-    const auto data_length = gridDim.y;
-    const auto chunk = blockIdx.y * els_per_thread;
-    const auto dict = blockIdx.z * blockDim.x + threadIdx.x;
+                                    OutputType* dst_data) {
+    const OffsetType data_length = gridDim.y;
+    const OffsetType chunk = static_cast<OffsetType>(blockIdx.y) * els_per_thread;
+    const OffsetType dict = static_cast<OffsetType>(blockIdx.z) * blockDim.x + threadIdx.x;
     if (dict >= num_dicts) {
         return;
     }
-    const auto indices_index = blockIdx.x % indices_size;
-    const auto batch = blockIdx.x / indices_size;
+    const OffsetType indices_index = blockIdx.x % indices_size;
+    const OffsetType batch = blockIdx.x / indices_size;
     gather(data_length,
            index_range,
            els_per_thread,
@@ -99,45 +121,89 @@ static __global__ void dicts_gather(unsigned num_dicts,
            indices_index,
            dict,
            chunk,
-           src_dict + batch * dicts_batch_stride,
-           src_index + batch * indices_batch_stride,
-           dst_data + batch * out_batch_stride);
+           src_dict + batch * num_dicts * index_range * data_length,
+           src_index + batch * indices_size,
+           dst_data + batch * num_dicts * indices_size * data_length);
+}
+
+/**
+ * Each warp copies whole rows of row_words words, rows of the output are indexed as [batch, dict, indices_index]
+ */
+template <typename Word, typename IndexType>
+static __global__ void rows_gather(size_t num_rows,
+                                   size_t num_dicts,
+                                   size_t indices_size,
+                                   size_t index_range,
+                                   size_t row_bytes,
+                                   const Word* src_dict,
+                                   const IndexType* src_index,
+                                   Word* dst_data) {
+    const unsigned warps_per_block = blockDim.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    const size_t num_warps = static_cast<size_t>(gridDim.x) * warps_per_block;
+    for (size_t row = static_cast<size_t>(blockIdx.x) * warps_per_block + threadIdx.x / warp_size; row < num_rows;
+         row += num_warps) {
+        const size_t indices_index = row % indices_size;
+        const size_t dict_row = row / indices_size;
+        const size_t batch = dict_row / num_dicts;
+        const auto dict_index = normalize_index(src_index[batch * indices_size + indices_index], index_range);
+        Word* dst = dst_data + row * row_words;
+        if (dict_index < index_range) {
+            const Word* src = src_dict + (dict_row * index_range + dict_index) * row_words;
+            for (size_t w = lane; w < row_words; w += warp_size) {
+                dst[w] = src[w];
+            }
+        } else {
+            for (size_t w = lane; w < row_words; w += warp_size) {
+                dst[w] = Word{};
+            }
+        }
+    }
 }
 
 Gather::Gather(Type_t element_type,
+               Type_t output_type,
                Type_t indices_type,
-               unsigned num_dicts,
-               unsigned index_range,
-               unsigned data_length,
-               unsigned indices_size,
+               size_t batch_count,
+               size_t num_dicts,
+               size_t index_range,
+               size_t data_length,
+               size_t indices_size,
                bool gather_chunks,
+               bool gather_rows,
                unsigned blocks_per_grid,
                unsigned threads_per_block,
                unsigned grid_dim_x,
                unsigned grid_dim_y,
-               unsigned dicts_batch_stride,
-               unsigned indices_batch_stride,
-               unsigned out_batch_stride,
                unsigned els_per_thread_chunks,
                unsigned els_per_thread_dicts)
     : element_type_(element_type),
+      output_type_(output_type),
       indices_type_(indices_type),
+      batch_count_(batch_count),
       num_dicts_(num_dicts),
       index_range_(index_range),
       data_length_(data_length),
       indices_size_(indices_size),
       gather_chunks_(gather_chunks),
+      gather_rows_(gather_rows),
+      large_offsets_(batch_count * num_dicts * std::max(index_range, indices_size) * data_length >
+                     std::numeric_limits<unsigned>::max()),
       blocks_per_grid_(blocks_per_grid),
       threads_per_block_(threads_per_block),
       grid_dim_x_(grid_dim_x),
       grid_dim_y_(grid_dim_y),
-      dicts_batch_stride_(dicts_batch_stride),
-      indices_batch_stride_(indices_batch_stride),
-      out_batch_stride_(out_batch_stride),
       els_per_thread_chunks_(els_per_thread_chunks),
       els_per_thread_dicts_(els_per_thread_dicts) {
     TypeValidator<AllElementTypesSwitch>::check(element_type_);
+    if (output_type_ != element_type_) {
+        TypeValidator<ConvertedElementTypesSwitch>::check(element_type_);
+        TypeValidator<ConvertedElementTypesSwitch>::check(output_type_);
+    }
     TypeValidator<ElementTypesSwitch<Type_t::i64, Type_t::i32>>::check(indices_type_);
+    if (gather_rows_ && output_type_ != element_type_) {
+        throw_ov_exception("Gather: rows can't be gathered with conversion of elements");
+    }
 }
 
 void Gather::operator()(const cudaStream_t stream, const void* src_dict, const void* src_index, void* dst_data) const {
@@ -157,67 +223,121 @@ void Gather::CallByDataType(const cudaStream_t stream,
                             const void* src_dict,
                             const void* src_index,
                             void* dst_data) const {
+    if (output_type_ != element_type_) {
+        return CallByConvertedType<IndexType>(stream, src_dict, src_index, dst_data);
+    }
     switch (element_type_) {
         case Type_t::boolean:
-            return Call<bool, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<bool, IndexType, bool>(stream, src_dict, src_index, dst_data);
 #ifdef CUDA_HAS_BF16_TYPE
         case Type_t::bf16:
-            return Call<__nv_bfloat16, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<__nv_bfloat16, IndexType, __nv_bfloat16>(stream, src_dict, src_index, dst_data);
 #endif
         case Type_t::f16:
-            return Call<__half, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<__half, IndexType, __half>(stream, src_dict, src_index, dst_data);
         case Type_t::f32:
-            return Call<float, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<float, IndexType, float>(stream, src_dict, src_index, dst_data);
         case Type_t::f64:
-            return Call<double, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<double, IndexType, double>(stream, src_dict, src_index, dst_data);
         case Type_t::i8:
-            return Call<int8_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<int8_t, IndexType, int8_t>(stream, src_dict, src_index, dst_data);
         case Type_t::i16:
-            return Call<int16_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<int16_t, IndexType, int16_t>(stream, src_dict, src_index, dst_data);
         case Type_t::i32:
-            return Call<int32_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<int32_t, IndexType, int32_t>(stream, src_dict, src_index, dst_data);
         case Type_t::i64:
-            return Call<int64_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<int64_t, IndexType, int64_t>(stream, src_dict, src_index, dst_data);
         case Type_t::u8:
-            return Call<uint8_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<uint8_t, IndexType, uint8_t>(stream, src_dict, src_index, dst_data);
         case Type_t::u16:
-            return Call<uint16_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<uint16_t, IndexType, uint16_t>(stream, src_dict, src_index, dst_data);
         case Type_t::u32:
-            return Call<uint32_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<uint32_t, IndexType, uint32_t>(stream, src_dict, src_index, dst_data);
         case Type_t::u64:
-            return Call<uint64_t, IndexType>(stream, src_dict, src_index, dst_data);
+            return Call<uint64_t, IndexType, uint64_t>(stream, src_dict, src_index, dst_data);
         default:
             throw_ov_exception(
                 fmt::format("Index element type = {} is not supported by Gather operation !!", indices_type_));
     }
 }
 
+template <typename IndexType>
+void Gather::CallByConvertedType(const cudaStream_t stream,
+                                 const void* src_dict,
+                                 const void* src_index,
+                                 void* dst_data) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return CallByOutputType<__nv_bfloat16, IndexType>(stream, src_dict, src_index, dst_data);
+#endif
+        case Type_t::f16:
+            return CallByOutputType<__half, IndexType>(stream, src_dict, src_index, dst_data);
+        case Type_t::f32:
+            return CallByOutputType<float, IndexType>(stream, src_dict, src_index, dst_data);
+        default:
+            throw_ov_exception(
+                fmt::format("Params element type = {} can't be converted by Gather operation !!", element_type_));
+    }
+}
+
 template <typename DataType, typename IndexType>
+void Gather::CallByOutputType(const cudaStream_t stream,
+                              const void* src_dict,
+                              const void* src_index,
+                              void* dst_data) const {
+    switch (output_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return Call<DataType, IndexType, __nv_bfloat16>(stream, src_dict, src_index, dst_data);
+#endif
+        case Type_t::f16:
+            return Call<DataType, IndexType, __half>(stream, src_dict, src_index, dst_data);
+        case Type_t::f32:
+            return Call<DataType, IndexType, float>(stream, src_dict, src_index, dst_data);
+        default:
+            throw_ov_exception(
+                fmt::format("Output element type = {} is not supported by Gather operation !!", output_type_));
+    }
+}
+
+template <typename DataType, typename IndexType, typename OutputType>
 void Gather::Call(const cudaStream_t stream, const void* src_dict, const void* src_index, void* dst_data) const {
+    if constexpr (std::is_same_v<DataType, OutputType>) {
+        if (gather_rows_) {
+            return CallRows<DataType, IndexType>(stream, src_dict, src_index, dst_data);
+        }
+    }
+    if (large_offsets_) {
+        return CallByOffsetType<DataType, IndexType, OutputType, size_t>(stream, src_dict, src_index, dst_data);
+    }
+    return CallByOffsetType<DataType, IndexType, OutputType, unsigned>(stream, src_dict, src_index, dst_data);
+}
+
+template <typename DataType, typename IndexType, typename OutputType, typename OffsetType>
+void Gather::CallByOffsetType(const cudaStream_t stream,
+                              const void* src_dict,
+                              const void* src_index,
+                              void* dst_data) const {
     dim3 grid{grid_dim_x_, grid_dim_y_, blocks_per_grid_};
 
     const auto src_dict_typed = static_cast<const DataType*>(src_dict);
     const auto src_index_typed = static_cast<const IndexType*>(src_index);
-    auto dst_data_typed = static_cast<DataType*>(dst_data);
+    auto dst_data_typed = static_cast<OutputType*>(dst_data);
 
     if (gather_chunks_) {
-        kernel::chunks_gather<<<grid, threads_per_block_, 0, stream>>>(data_length_,
-                                                                       indices_size_,
-                                                                       index_range_,
-                                                                       dicts_batch_stride_,
-                                                                       indices_batch_stride_,
-                                                                       out_batch_stride_,
+        kernel::chunks_gather<<<grid, threads_per_block_, 0, stream>>>(static_cast<OffsetType>(data_length_),
+                                                                       static_cast<OffsetType>(num_dicts_),
+                                                                       static_cast<OffsetType>(indices_size_),
+                                                                       static_cast<OffsetType>(index_range_),
                                                                        els_per_thread_chunks_,
                                                                        src_dict_typed,
                                                                        src_index_typed,
                                                                        dst_data_typed);
     } else {
-        kernel::dicts_gather<<<grid, threads_per_block_, 0, stream>>>(num_dicts_,
-                                                                      indices_size_,
-                                                                      index_range_,
-                                                                      dicts_batch_stride_,
-                                                                      indices_batch_stride_,
-                                                                      out_batch_stride_,
+        kernel::dicts_gather<<<grid, threads_per_block_, 0, stream>>>(static_cast<OffsetType>(num_dicts_),
+                                                                      static_cast<OffsetType>(indices_size_),
+                                                                      static_cast<OffsetType>(index_range_),
                                                                       els_per_thread_dicts_,
                                                                       src_dict_typed,
                                                                       src_index_typed,
@@ -230,6 +350,48 @@ void Gather::Call(const cudaStream_t stream, const void* src_dict, const void* s
     }
 }
 
+template <typename DataType, typename IndexType>
+void Gather::CallRows(const cudaStream_t stream, const void* src_dict, const void* src_index, void* dst_data) const {
+    // Rows are copied by the widest words of up to 16 bytes the rows and the buffers are aligned to
+    const size_t row_bytes = data_length_ * sizeof(DataType);
+    const auto alignment =
+        reinterpret_cast<std::uintptr_t>(src_dict) | reinterpret_cast<std::uintptr_t>(dst_data) | row_bytes;
+    if (alignment % 16 == 0) {
+        return CallRowsByWord<uint4, IndexType>(stream, row_bytes, src_dict, src_index, dst_data);
+    } else if (alignment % 8 == 0) {
+        return CallRowsByWord<std::uint64_t, IndexType>(stream, row_bytes, src_dict, src_index, dst_data);
+    } else if (alignment % 4 == 0) {
+        return CallRowsByWord<std::uint32_t, IndexType>(stream, row_bytes, src_dict, src_index, dst_data);
+    } else if (alignment % 2 == 0) {
+        return CallRowsByWord<std::uint16_t, IndexType>(stream, row_bytes, src_dict, src_index, dst_data);
+    }
+    return CallRowsByWord<std::uint8_t, IndexType>(stream, row_bytes, src_dict, src_index, dst_data);
+}
+
+template <typename Word, typename IndexType>
+void Gather::CallRowsByWord(const cudaStream_t stream,
+                            size_t row_bytes,
+                            const void* src_dict,
+                            const void* src_index,
+                            void* dst_data) const {
+    constexpr unsigned warps_per_block = rows_block_size / warp_size;
+    const size_t num_rows = batch_count_ * num_dicts_ * indices_size_;
+    if (num_rows == 0) {
+        return;
+    }
+    const auto num_blocks = static_cast<unsigned>(
+        std::min<size_t>((num_rows + warps_per_block - 1) / warps_per_block, max_rows_blocks));
+    rows_gather<Word, IndexType><<<num_blocks, rows_block_size, 0, stream>>>(num_rows,
+                                                                             num_dicts_,
+                                                                             indices_size_,
+                                                                             index_range_,
+                                                                             row_bytes / sizeof(Word),
+                                                                             static_cast<const Word*>(src_dict),
+                                                                             static_cast<const IndexType*>(src_index),
+                                                                             static_cast<Word*>(dst_data));
+    throwIfError(cudaPeekAtLastError());
+}
+
 }  // namespace kernel
 }  // namespace nvidia_gpu
 }  // namespace ov
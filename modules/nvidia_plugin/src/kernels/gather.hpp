@@ -13,22 +13,32 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
+/**
+ * Gathers rows of data_length elements of [batch_count, num_dicts, index_range, data_length] dictionaries
+ * by [batch_count, indices_size] indices. Negative indices are counted from the end of the index range,
+ * rows of indices out of the range are filled with zeros. Offsets are computed in 32 bits unless the tensors
+ * have more elements
+ */
 class Gather {
 public:
+    /**
+     * @param gather_rows Rows of data_length elements are copied by warps with the widest words they are aligned to,
+     *                    requires output_type == element_type
+     */
     Gather(Type_t element_type,
+           Type_t output_type,
            Type_t indices_type,
-           unsigned num_dicts,
-           unsigned index_range,
-           unsigned data_length,
-           unsigned indices_size,
+           size_t batch_count,
+           size_t num_dicts,
+           size_t index_range,
+           size_t data_length,
+           size_t indices_size,
            bool gather_chunks,
+           bool gather_rows,
            unsigned blocks_per_grid,
            unsigned threads_per_block,
            unsigned grid_dim_x,
            unsigned grid_dim_y,
-           unsigned dicts_batch_stride,
-           unsigned indices_batch_stride,
-           unsigned out_batch_stride,
            unsigned els_per_thread_chunks,
            unsigned els_per_thread_dicts);
 
@@ -38,23 +48,50 @@ private:
     template <typename IndexType>
     void CallByDataType(const cudaStream_t stream, const void* src_dict, const void* src_index, void* dst_data) const;
 
+    template <typename IndexType>
+    void CallByConvertedType(const cudaStream_t stream,
+                             const void* src_dict,
+                             const void* src_index,
+                             void* dst_data) const;
+
     template <typename DataType, typename IndexType>
+    void CallByOutputType(const cudaStream_t stream,
+                          const void* src_dict,
+                          const void* src_index,
+                          void* dst_data) const;
+
+    template <typename DataType, typename IndexType, typename OutputType>
     void Call(const cudaStream_t stream, const void* src_dict, const void* src_index, void* dst_data) const;
 
+    template <typename DataType, typename IndexType, typename OutputType, typename OffsetType>
+    void CallByOffsetType(const cudaStream_t stream, const void* src_dict, const void* src_index, void* dst_data) const;
+
+    template <typename DataType, typename IndexType>
+    void CallRows(const cudaStream_t stream, const void* src_dict, const void* src_index, void* dst_data) const;
+
+    template <typename Word, typename IndexType>
+    void CallRowsByWord(const cudaStream_t stream,
+                        size_t row_bytes,
+                        const void* src_dict,
+                        const void* src_index,
+                        void* dst_data) const;
+
     Type_t element_type_;
+    Type_t output_type_;
     Type_t indices_type_;
-    unsigned num_dicts_;
-    unsigned index_range_;
-    unsigned data_length_;
-    unsigned indices_size_;
+    size_t batch_count_;
+    size_t num_dicts_;
+    size_t index_range_;
+    size_t data_length_;
+    size_t indices_size_;
     bool gather_chunks_;
+    bool gather_rows_;
+    // Offsets of elements don't fit 32 bits
+    bool large_offsets_;
     unsigned blocks_per_grid_;
     unsigned threads_per_block_;
     unsigned grid_dim_x_;
     unsigned grid_dim_y_;
-    unsigned dicts_batch_stride_;
-    unsigned indices_batch_stride_;
-    unsigned out_batch_stride_;
     unsigned els_per_thread_chunks_;
     unsigned els_per_thread_dicts_;
 };
@@ -11,10 +11,10 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
-template <typename T>
+template <typename T, bool Fast>
 struct GeluErfOpImpl;
 
-template <typename T>
+template <typename T, bool Fast>
 struct GeluTanhOpImpl;
 
 /**
@@ -22,12 +22,12 @@ struct GeluTanhOpImpl;
  */
 class GeluErf {
 public:
-    GeluErf(Type_t element_type, size_t max_threads_per_block, size_t num_elements);
+    GeluErf(Type_t element_type, size_t max_threads_per_block, size_t num_elements, bool fast_math = false);
 
     void operator()(cudaStream_t stream, const void* in0, void* out) const;
 
 private:
-    ElementwiseUnary<FloatElementTypesSwitch, GeluErfOpImpl> impl_;
+    ElementwiseUnaryMath<FloatElementTypesSwitch, GeluErfOpImpl> impl_;
 };
 
 /**
@@ -35,12 +35,12 @@ private:
  */
 class GeluTanh {
 public:
-    GeluTanh(Type_t element_type, size_t max_threads_per_block, size_t num_elements);
+    GeluTanh(Type_t element_type, size_t max_threads_per_block, size_t num_elements, bool fast_math = false);
 
     void operator()(cudaStream_t stream, const void* in0, void* out) const;
 
 private:
-    ElementwiseUnary<FloatElementTypesSwitch, GeluTanhOpImpl> impl_;
+    ElementwiseUnaryMath<FloatElementTypesSwitch, GeluTanhOpImpl> impl_;
 };
 
 }  // namespace kernel
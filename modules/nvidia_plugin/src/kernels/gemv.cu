@@ -0,0 +1,421 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+#include "gemv.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+// Each warp of the kernel for transposed b computes one output column
+constexpr unsigned nt_warps_per_block = 4;
+// Each thread of the kernel for not transposed b computes one vector of output columns
+constexpr unsigned nn_block_size = 128;
+constexpr size_t vector_bytes = 16;
+// K isn't split into slices shorter than this, so that partial products don't outweigh reading of b
+constexpr size_t min_k_per_split = 256;
+constexpr unsigned max_splits = 64;
+// Blocks per SM, which are enough to saturate memory bandwidth
+constexpr size_t blocks_per_multiprocessor = 2;
+// Threads of the kernel for pooled activations, each warp averages one element of the activations at a time
+constexpr unsigned pooled_block_size = 256;
+// Means of a slice of K of all rows are kept in shared memory by each block of the kernel for pooled activations
+constexpr size_t max_pooled_k_per_split = 256;
+
+struct GemvArgs {
+    size_t rows;
+    size_t k;
+    size_t n;
+    size_t k_per_split;
+    Gemv::Activation activation;
+    float alpha;
+    float beta;
+};
+
+GemvArgs make_args(const Gemv::Params& params, size_t k_per_split) {
+    return {params.rows, params.k, params.n, k_per_split, params.activation, params.alpha, params.beta};
+}
+
+/**
+ * V elements loaded by a single instruction, memory blocks are aligned by 256 bytes, so vectors of rows are aligned
+ * if the length of rows is a multiple of V
+ */
+template <typename T, unsigned V>
+struct alignas(sizeof(T) * V) Pack {
+    T values[V];
+};
+
+template <typename T, unsigned V>
+__device__ __forceinline__ Pack<T, V> load(const T* ptr) {
+    return *reinterpret_cast<const Pack<T, V>*>(ptr);
+}
+
+__device__ __forceinline__ float activate(Gemv::Activation activation, float x) {
+    switch (activation) {
+        case Gemv::Activation::Relu:
+            return fmaxf(x, 0.0f);
+        case Gemv::Activation::Gelu:
+            // Tanh approximation as the GELU epilogue of cuBLASLt
+            return 0.5f * x * (1.0f + tanhf(0.7978845608f * (x + 0.044715f * x * x * x)));
+        default:
+            return x;
+    }
+}
+
+template <typename T>
+__device__ __forceinline__ void finish(const GemvArgs& args, size_t r, size_t in, float sum, const T* bias, T* c) {
+    const size_t i = r * args.n + in;
+    float y = args.alpha * sum;
+    if (args.beta != 0.0f) {
+        y += args.beta * static_cast<float>(c[i]);
+    }
+    if (bias) {
+        y += static_cast<float>(bias[in]);
+    }
+    c[i] = static_cast<T>(activate(args.activation, y));
+}
+
+__device__ __forceinline__ float warp_sum(float sum) {
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        sum += __shfl_down_sync(0xFFFFFFFF, sum, offset);
+    }
+    return sum;
+}
+
+/**
+ * Partial products of the split of K are written to the workspace if K is split, otherwise the epilogue is applied
+ */
+template <typename T>
+__device__ __forceinline__ void store(
+    const GemvArgs& args, unsigned split, size_t r, size_t in, float sum, const T* bias, T* c, float* partial) {
+    if (partial) {
+        partial[(split * args.rows + r) * args.n + in] = sum;
+    } else {
+        finish(args, r, in, sum, bias, c);
+    }
+}
+
+}  // namespace
+
+/**
+ * b is [n, k]: each warp reads a row of b by vectors and computes one output column for all rows
+ */
+template <typename T, unsigned V>
+static __global__ void gemv_nt(const GemvArgs args, const T* a, const T* b, const T* bias, T* c, float* partial) {
+    const size_t in = static_cast<size_t>(blockIdx.x) * nt_warps_per_block + threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (in >= args.n) {
+        return;
+    }
+    const size_t k_begin = blockIdx.y * args.k_per_split;
+    const size_t k_end = min(args.k, k_begin + args.k_per_split);
+    const T* b_row = b + in * args.k;
+
+    float acc[Gemv::max_rows] = {};
+    for (size_t ik = k_begin + lane * V; ik < k_end; ik += warp_size * V) {
+        const auto w = load<T, V>(b_row + ik);
+#pragma unroll
+        for (size_t r = 0; r < Gemv::max_rows; ++r) {
+            if (r < args.rows) {
+                const auto x = load<T, V>(a + r * args.k + ik);
+#pragma unroll
+                for (unsigned v = 0; v < V; ++v) {
+                    acc[r] += static_cast<float>(x.values[v]) * static_cast<float>(w.values[v]);
+                }
+            }
+        }
+    }
+#pragma unroll
+    for (size_t r = 0; r < Gemv::max_rows; ++r) {
+        if (r < args.rows) {
+            const float sum = warp_sum(acc[r]);
+            if (lane == 0) {
+                store(args, blockIdx.y, r, in, sum, bias, c, partial);
+            }
+        }
+    }
+}
+
+/**
+ * b is [k, n]: neighbour threads read neighbour vectors of a row of b, each thread computes V output columns
+ * for all rows
+ */
+template <typename T, unsigned V>
+static __global__ void gemv_nn(const GemvArgs args, const T* a, const T* b, const T* bias, T* c, float* partial) {
+    const size_t in = (static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x) * V;
+    if (in >= args.n) {
+        return;
+    }
+    const size_t k_begin = blockIdx.y * args.k_per_split;
+    const size_t k_end = min(args.k, k_begin + args.k_per_split);
+
+    float acc[Gemv::max_rows][V] = {};
+    for (size_t ik = k_begin; ik < k_end; ++ik) {
+        const auto w = load<T, V>(b + ik * args.n + in);
+#pragma unroll
+        for (size_t r = 0; r < Gemv::max_rows; ++r) {
+            if (r < args.rows) {
+                const float x = static_cast<float>(a[r * args.k + ik]);
+#pragma unroll
+                for (unsigned v = 0; v < V; ++v) {
+                    acc[r][v] += x * static_cast<float>(w.values[v]);
+                }
+            }
+        }
+    }
+#pragma unroll
+    for (size_t r = 0; r < Gemv::max_rows; ++r) {
+        if (r < args.rows) {
+#pragma unroll
+            for (unsigned v = 0; v < V; ++v) {
+                store(args, blockIdx.y, r, in + v, acc[r][v], bias, c, partial);
+            }
+        }
+    }
+}
+
+/**
+ * a is [rows, k, pool_size]: each block averages its slice of K of all rows into shared memory, then multiplies
+ * the means by the slice of each column of b
+ */
+template <typename T>
+static __global__ void gemv_pooled(const GemvArgs args,
+                                   const size_t pool_size,
+                                   const bool transpose_b,
+                                   const T* a,
+                                   const T* b,
+                                   const T* bias,
+                                   T* c,
+                                   float* partial) {
+    __shared__ float means[Gemv::max_rows * max_pooled_k_per_split];
+    const size_t k_begin = blockIdx.x * args.k_per_split;
+    const size_t k_count = min(args.k - k_begin, args.k_per_split);
+    const unsigned lane = threadIdx.x % warp_size;
+    const unsigned warp = threadIdx.x / warp_size;
+    const unsigned num_warps = blockDim.x / warp_size;
+
+    // Lanes read neighbour elements of the pool, so reads are coalesced for any pool size
+    const float scale = 1.0f / static_cast<float>(pool_size);
+    for (size_t i = warp; i < args.rows * k_count; i += num_warps) {
+        const size_t r = i / k_count;
+        const size_t ik = i % k_count;
+        const T* pool = a + (r * args.k + k_begin + ik) * pool_size;
+        float sum = 0.0f;
+        for (size_t p = lane; p < pool_size; p += warp_size) {
+            sum += static_cast<float>(pool[p]);
+        }
+        sum = warp_sum(sum);
+        if (lane == 0) {
+            means[r * args.k_per_split + ik] = sum * scale;
+        }
+    }
+    __syncthreads();
+
+    if (transpose_b) {
+        // b is [n, k]: each warp computes one output column at a time from a row of b
+        for (size_t in = warp; in < args.n; in += num_warps) {
+            const T* b_row = b + in * args.k + k_begin;
+            float acc[Gemv::max_rows] = {};
+            for (size_t ik = lane; ik < k_count; ik += warp_size) {
+                const float w = static_cast<float>(b_row[ik]);
+#pragma unroll
+                for (size_t r = 0; r < Gemv::max_rows; ++r) {
+                    if (r < args.rows) {
+                        acc[r] += means[r * args.k_per_split + ik] * w;
+                    }
+                }
+            }
+#pragma unroll
+            for (size_t r = 0; r < Gemv::max_rows; ++r) {
+                if (r < args.rows) {
+                    const float sum = warp_sum(acc[r]);
+                    if (lane == 0) {
+                        store(args, blockIdx.x, r, in, sum, bias, c, partial);
+                    }
+                }
+            }
+        }
+    } else {
+        // b is [k, n]: each thread computes one output column at a time, neighbour threads read neighbour columns
+        for (size_t in = threadIdx.x; in < args.n; in += blockDim.x) {
+            float acc[Gemv::max_rows] = {};
+            for (size_t ik = 0; ik < k_count; ++ik) {
+                const float w = static_cast<float>(b[(k_begin + ik) * args.n + in]);
+#pragma unroll
+                for (size_t r = 0; r < Gemv::max_rows; ++r) {
+                    if (r < args.rows) {
+                        acc[r] += means[r * args.k_per_split + ik] * w;
+                    }
+                }
+            }
+#pragma unroll
+            for (size_t r = 0; r < Gemv::max_rows; ++r) {
+                if (r < args.rows) {
+                    store(args, blockIdx.x, r, in, acc[r], bias, c, partial);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+static __global__ void gemv_reduce_splits(
+    const GemvArgs args, unsigned num_splits, const T* bias, T* c, const float* partial) {
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    const size_t size = args.rows * args.n;
+    if (i >= size) {
+        return;
+    }
+    float sum = 0.0f;
+    for (unsigned split = 0; split < num_splits; ++split) {
+        sum += partial[split * size + i];
+    }
+    finish(args, i / args.n, i % args.n, sum, bias, c);
+}
+
+bool Gemv::isSupportedType(const Type_t element_type) {
+    switch (element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+Gemv::Gemv(const Params& params, const size_t num_multiprocessors, const size_t max_threads_per_block)
+    : params_{params}, max_threads_per_block_{max_threads_per_block} {
+    if (!isSupportedType(params_.element_type)) {
+        throw_ov_exception(
+            fmt::format("Element type = {} is not supported by Gemv operation !!", params_.element_type));
+    }
+    if (params_.rows == 0 || params_.rows > max_rows) {
+        throw_ov_exception(fmt::format("Rows = {} are not supported by Gemv operation !!", params_.rows));
+    }
+    if (params_.pool_size == 0) {
+        throw_ov_exception("Pool size = 0 is not supported by Gemv operation !!");
+    }
+    if (params_.pool_size > 1) {
+        // Blocks split K only, each of them computes all columns, so there are as many splits as blocks wanted
+        const size_t wanted_splits = blocks_per_multiprocessor * num_multiprocessors;
+        k_per_split_ = std::clamp<size_t>(
+            (params_.k + wanted_splits - 1) / wanted_splits, warp_size, max_pooled_k_per_split);
+        num_splits_ = static_cast<unsigned>((params_.k + k_per_split_ - 1) / k_per_split_);
+        vectorized_ = false;
+        return;
+    }
+    const size_t vector_size = vector_bytes / (params_.element_type == Type_t::f32 ? 4 : 2);
+    vectorized_ = (params_.transpose_b ? params_.k : params_.n) % vector_size == 0;
+    const size_t vector = vectorized_ ? vector_size : 1;
+    const size_t num_blocks = params_.transpose_b
+                                  ? (params_.n + nt_warps_per_block - 1) / nt_warps_per_block
+                                  : ((params_.n + vector - 1) / vector + nn_block_size - 1) / nn_block_size;
+    const size_t wanted_splits = (blocks_per_multiprocessor * num_multiprocessors + num_blocks - 1) / num_blocks;
+    const size_t splits = std::clamp<size_t>(
+        std::min(wanted_splits, params_.k / min_k_per_split), 1, static_cast<size_t>(max_splits));
+    k_per_split_ = ((params_.k + splits - 1) / splits + vector - 1) / vector * vector;
+    num_splits_ = static_cast<unsigned>((params_.k + k_per_split_ - 1) / k_per_split_);
+}
+
+size_t Gemv::workspaceSize() const {
+    return num_splits_ > 1 ? num_splits_ * params_.rows * params_.n * sizeof(float) : 0;
+}
+
+void Gemv::operator()(
+    cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace) const {
+    switch (params_.element_type) {
+        case Type_t::f16:
+            return call<__half>(stream, a, b, bias, c, workspace);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, a, b, bias, c, workspace);
+#endif
+        default:
+            return call<float>(stream, a, b, bias, c, workspace);
+    }
+}
+
+template <typename T>
+void Gemv::call(cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace) const {
+    if (params_.pool_size > 1) {
+        return launchPooled<T>(stream, a, b, bias, c, workspace);
+    }
+    if (vectorized_) {
+        return launch<T, vector_bytes / sizeof(T)>(stream, a, b, bias, c, workspace);
+    }
+    return launch<T, 1>(stream, a, b, bias, c, workspace);
+}
+
+template <typename T, unsigned V>
+void Gemv::launch(
+    cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace) const {
+    const auto args = make_args(params_, k_per_split_);
+    auto* partial = num_splits_ > 1 ? static_cast<float*>(workspace) : nullptr;
+    if (params_.transpose_b) {
+        const dim3 grid{static_cast<unsigned>((params_.n + nt_warps_per_block - 1) / nt_warps_per_block), num_splits_};
+        gemv_nt<T, V><<<grid, nt_warps_per_block * warp_size, 0, stream>>>(args,
+                                                                           static_cast<const T*>(a),
+                                                                           static_cast<const T*>(b),
+                                                                           static_cast<const T*>(bias),
+                                                                           static_cast<T*>(c),
+                                                                           partial);
+    } else {
+        const size_t num_threads = (params_.n + V - 1) / V;
+        const dim3 grid{static_cast<unsigned>((num_threads + nn_block_size - 1) / nn_block_size), num_splits_};
+        gemv_nn<T, V><<<grid, nn_block_size, 0, stream>>>(args,
+                                                          static_cast<const T*>(a),
+                                                          static_cast<const T*>(b),
+                                                          static_cast<const T*>(bias),
+                                                          static_cast<T*>(c),
+                                                          partial);
+    }
+    if (partial) {
+        reduceSplits<T>(stream, bias, c, workspace);
+    }
+}
+
+template <typename T>
+void Gemv::launchPooled(
+    cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace) const {
+    auto* partial = num_splits_ > 1 ? static_cast<float*>(workspace) : nullptr;
+    gemv_pooled<T><<<num_splits_, pooled_block_size, 0, stream>>>(make_args(params_, k_per_split_),
+                                                                  params_.pool_size,
+                                                                  params_.transpose_b,
+                                                                  static_cast<const T*>(a),
+                                                                  static_cast<const T*>(b),
+                                                                  static_cast<const T*>(bias),
+                                                                  static_cast<T*>(c),
+                                                                  partial);
+    if (partial) {
+        reduceSplits<T>(stream, bias, c, workspace);
+    }
+}
+
+template <typename T>
+void Gemv::reduceSplits(cudaStream_t stream, const void* bias, void* c, void* workspace) const {
+    const auto [num_blocks, threads_per_block] =
+        calculateElementwiseGrid(params_.rows * params_.n, max_threads_per_block_);
+    gemv_reduce_splits<T><<<num_blocks, threads_per_block, 0, stream>>>(make_args(params_, k_per_split_),
+                                                                        num_splits_,
+                                                                        static_cast<const T*>(bias),
+                                                                        static_cast<T*>(c),
+                                                                        static_cast<const float*>(workspace));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,88 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Multiplies few rows of activations a [rows, k] by matrix b, which is [n, k] if transposed or [k, n] otherwise,
+ * and computes c [rows, n] = activation(alpha * a x b + beta * c + bias [n]).
+ * Such products are bound by reading b, so b is read once by 16-byte vectors for all rows and K is split
+ * between blocks, which sum their partial products in the workspace, if there are too few outputs to load the SMs.
+ * Activations may be pooled: a is [rows, k, pool_size] and each element multiplied by b is the mean of pool_size
+ * consecutive elements of a (e.g. global average pooling of NCHW tensor followed by a fully connected layer).
+ * Each block averages its slice of K into shared memory and multiplies it by all columns of b, so activations
+ * are read once and means aren't stored in between
+ */
+class Gemv {
+public:
+    // Maximal number of rows of activations
+    static constexpr size_t max_rows = 8;
+
+    enum class Activation { None, Relu, Gelu };
+
+    struct Params {
+        Type_t element_type;
+        size_t rows;
+        size_t k;
+        size_t n;
+        bool transpose_b;
+        Activation activation;
+        float alpha;
+        float beta;
+        // Number of consecutive elements of a averaged into each element of the product, 1 if a isn't pooled
+        size_t pool_size = 1;
+    };
+
+    /**
+     * @returns true if elements of the type are supported
+     */
+    static bool isSupportedType(Type_t element_type);
+
+    Gemv(const Params& params, size_t num_multiprocessors, size_t max_threads_per_block);
+
+    /**
+     * @returns Size in bytes of fp32 partial products of splits of K, 0 if K isn't split
+     */
+    size_t workspaceSize() const;
+
+    /**
+     * @param bias [n] or nullptr
+     * @param workspace Buffer of workspaceSize() bytes
+     */
+    void operator()(
+        cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace) const;
+
+    template <typename T, unsigned V>
+    void launch(cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace) const;
+
+    template <typename T>
+    void launchPooled(cudaStream_t stream, const void* a, const void* b, const void* bias, void* c, void* workspace)
+        const;
+
+    template <typename T>
+    void reduceSplits(cudaStream_t stream, const void* bias, void* c, void* workspace) const;
+
+    Params params_;
+    size_t max_threads_per_block_;
+    // Elements of K multiplied by each block, it is a multiple of the vector size
+    size_t k_per_split_;
+    unsigned num_splits_;
+    bool vectorized_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,211 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_fp16.h>
+#include <fmt/format.h>
+
+#include <tuple>
+
+#include "details/tensor_helpers.hpp"
+#include "grid_sample.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+using Props = GridSample::Props;
+
+// Grid values in [-1, 1] to input coordinates
+inline __device__ float unnormalize(float coord, unsigned size, bool align_corners) {
+    return align_corners ? 0.5f * (coord + 1.0f) * (size - 1) : 0.5f * ((coord + 1.0f) * size - 1.0f);
+}
+
+inline __device__ float clip(float coord, unsigned size) {
+    return fminf(static_cast<float>(size - 1), fmaxf(coord, 0.0f));
+}
+
+// Reflects coordinate by the borders [twice_low / 2, twice_high / 2]
+inline __device__ float reflect(float coord, int twice_low, int twice_high) {
+    if (twice_low == twice_high) {
+        return 0.0f;
+    }
+    const float low = twice_low * 0.5f;
+    const float span = (twice_high - twice_low) * 0.5f;
+    coord = fabsf(coord - low);
+    const float extra = fmodf(coord, span);
+    const int flips = static_cast<int>(floorf(coord / span));
+    return flips % 2 == 0 ? extra + low : span - extra + low;
+}
+
+inline __device__ float pad(float coord, unsigned size, const Props& props) {
+    switch (props.padding) {
+        case GridSample::Padding::border:
+            return clip(coord, size);
+        case GridSample::Padding::reflection:
+            if (props.align_corners) {
+                return clip(reflect(coord, 0, 2 * (static_cast<int>(size) - 1)), size);
+            }
+            return clip(reflect(coord, -1, 2 * static_cast<int>(size) - 1), size);
+        default:
+            return coord;
+    }
+}
+
+// Cubic convolution coefficients of taps at -1, 0, 1 and 2 for a fraction t (A = -0.75 like in PyTorch)
+inline __device__ void cubic_coefficients(float t, float coeffs[4]) {
+    constexpr float A = -0.75f;
+    const float t1 = t + 1.0f;
+    const float t2 = 1.0f - t;
+    const float t3 = 2.0f - t;
+    coeffs[0] = ((A * t1 - 5.0f * A) * t1 + 8.0f * A) * t1 - 4.0f * A;
+    coeffs[1] = ((A + 2.0f) * t - (A + 3.0f)) * t * t + 1.0f;
+    coeffs[2] = ((A + 2.0f) * t2 - (A + 3.0f)) * t2 * t2 + 1.0f;
+    coeffs[3] = ((A * t3 - 5.0f * A) * t3 + 8.0f * A) * t3 - 4.0f * A;
+}
+
+template <unsigned NumTaps>
+struct Taps {
+    unsigned offsets[NumTaps];
+    float weights[NumTaps];
+
+    // Taps outside of the input have zero weight
+    inline __device__ void set(unsigned tap, int x, int y, float weight, const Props& props) {
+        const bool inside = 0 <= x && x < static_cast<int>(props.input_width) && 0 <= y &&
+                            y < static_cast<int>(props.input_height);
+        offsets[tap] = inside ? y * props.input_width + x : 0;
+        weights[tap] = inside ? weight : 0.0f;
+    }
+};
+
+inline __device__ void compute_taps(float ix, float iy, const Props& props, Taps<1>& taps) {
+    taps.set(0,
+             static_cast<int>(nearbyintf(pad(ix, props.input_width, props))),
+             static_cast<int>(nearbyintf(pad(iy, props.input_height, props))),
+             1.0f,
+             props);
+}
+
+inline __device__ void compute_taps(float ix, float iy, const Props& props, Taps<4>& taps) {
+    const float px = pad(ix, props.input_width, props);
+    const float py = pad(iy, props.input_height, props);
+    const int x0 = static_cast<int>(floorf(px));
+    const int y0 = static_cast<int>(floorf(py));
+    const float wx = px - x0;
+    const float wy = py - y0;
+    taps.set(0, x0, y0, (1.0f - wx) * (1.0f - wy), props);
+    taps.set(1, x0 + 1, y0, wx * (1.0f - wy), props);
+    taps.set(2, x0, y0 + 1, (1.0f - wx) * wy, props);
+    taps.set(3, x0 + 1, y0 + 1, wx * wy, props);
+}
+
+inline __device__ void compute_taps(float ix, float iy, const Props& props, Taps<16>& taps) {
+    // Padding applies to each of 4x4 taps around the unpadded coordinate
+    const float fx = floorf(ix);
+    const float fy = floorf(iy);
+    float cx[4];
+    float cy[4];
+    cubic_coefficients(ix - fx, cx);
+    cubic_coefficients(iy - fy, cy);
+#pragma unroll
+    for (int j = 0; j < 4; ++j) {
+        const int ty = static_cast<int>(pad(fy - 1.0f + j, props.input_height, props));
+#pragma unroll
+        for (int i = 0; i < 4; ++i) {
+            const int tx = static_cast<int>(pad(fx - 1.0f + i, props.input_width, props));
+            taps.set(j * 4 + i, tx, ty, cx[i] * cy[j], props);
+        }
+    }
+}
+
+template <typename T, unsigned NumTaps>
+__global__ void grid_sample(const T* input, const T* grid, T* output, const Props props) {
+    const unsigned out_plane = props.output_height * props.output_width;
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= props.batch * out_plane) {
+        return;
+    }
+    const unsigned n = idx / out_plane;
+    const unsigned point = idx - n * out_plane;
+
+    const float ix = unnormalize(static_cast<float>(grid[idx * 2]), props.input_width, props.align_corners);
+    const float iy = unnormalize(static_cast<float>(grid[idx * 2 + 1]), props.input_height, props.align_corners);
+    Taps<NumTaps> taps;
+    compute_taps(ix, iy, props, taps);
+
+    const unsigned in_plane = props.input_height * props.input_width;
+    const T* in = input + n * props.channels * in_plane;
+    T* out = output + n * props.channels * out_plane + point;
+    for (unsigned c = 0; c < props.channels; ++c) {
+        float sum = 0.0f;
+#pragma unroll
+        for (unsigned t = 0; t < NumTaps; ++t) {
+            sum += taps.weights[t] * static_cast<float>(in[taps.offsets[t]]);
+        }
+        out[c * out_plane] = static_cast<T>(sum);
+        in += in_plane;
+    }
+}
+
+}  // namespace
+
+GridSample::GridSample(Type_t element_type,
+                       Mode mode,
+                       Padding padding,
+                       bool align_corners,
+                       size_t batch,
+                       size_t channels,
+                       size_t input_height,
+                       size_t input_width,
+                       size_t output_height,
+                       size_t output_width,
+                       size_t max_threads_per_block)
+    : element_type_{element_type}, mode_{mode} {
+    props_.batch = batch;
+    props_.channels = channels;
+    props_.input_height = input_height;
+    props_.input_width = input_width;
+    props_.output_height = output_height;
+    props_.output_width = output_width;
+    props_.padding = padding;
+    props_.align_corners = align_corners;
+    std::tie(num_blocks_, threads_per_block_) =
+        calculateElementwiseGrid(batch * output_height * output_width, max_threads_per_block);
+}
+
+void GridSample::operator()(cudaStream_t stream, const void* input, const void* grid, void* output) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return callKernel<__half>(stream, input, grid, output);
+        case Type_t::f32:
+            return callKernel<float>(stream, input, grid, output);
+        default:
+            throw_ov_exception(
+                fmt::format("Element type = {} is not supported by GridSample operation.", element_type_));
+    }
+}
+
+template <typename T>
+void GridSample::callKernel(cudaStream_t stream, const void* input, const void* grid, void* output) const {
+    const auto* in = static_cast<const T*>(input);
+    const auto* gr = static_cast<const T*>(grid);
+    auto* out = static_cast<T*>(output);
+    switch (mode_) {
+        case Mode::nearest:
+            grid_sample<T, 1><<<num_blocks_, threads_per_block_, 0, stream>>>(in, gr, out, props_);
+            break;
+        case Mode::bicubic:
+            grid_sample<T, 16><<<num_blocks_, threads_per_block_, 0, stream>>>(in, gr, out, props_);
+            break;
+        default:
+            grid_sample<T, 4><<<num_blocks_, threads_per_block_, 0, stream>>>(in, gr, out, props_);
+            break;
+    }
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+#include "details/error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Sampling of an NCHW input at points of an NxHxWx2 grid of x and y in [-1, 1] like torch.nn.functional.grid_sample.
+ * Each thread computes taps of one output point once and reuses them for all the channels, so neighbour threads
+ * read and write neighbour elements of each channel
+ */
+class GridSample {
+public:
+    enum class Mode { bilinear, nearest, bicubic };
+    enum class Padding { zeros, border, reflection };
+
+    struct Props {
+        unsigned batch{};
+        unsigned channels{};
+        unsigned input_height{};
+        unsigned input_width{};
+        unsigned output_height{};
+        unsigned output_width{};
+        Padding padding{};
+        bool align_corners{};
+    };
+
+    GridSample(Type_t element_type,
+               Mode mode,
+               Padding padding,
+               bool align_corners,
+               size_t batch,
+               size_t channels,
+               size_t input_height,
+               size_t input_width,
+               size_t output_height,
+               size_t output_width,
+               size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const void* input, const void* grid, void* output) const;
+
+private:
+    template <typename T>
+    void callKernel(cudaStream_t stream, const void* input, const void* grid, void* output) const;
+
+private:
+    Type_t element_type_;
+    Mode mode_;
+    Props props_;
+    size_t num_blocks_;
+    size_t threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,192 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+#include <limits>
+
+#include "details/error.hpp"
+#include "details/fast_divmod.cuh"
+#include "details/welford.cuh"
+#include "group_norm.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned threads_per_block = 512;
+
+}  // namespace
+
+/**
+ * The block of the group merges statistics of its warps through shared memory. The element i of the group is at
+ * (i / channels_per_group) * channels + i % channels_per_group from the first channel of the group in NHWC layout
+ * (group_divmod divides by channels_per_group) and at i in NCHW layout (group_divmod divides by spatial)
+ */
+template <typename T, bool Nhwc, bool Cached>
+static __global__ void group_norm(unsigned group_size,
+                                  FastDivmod group_divmod,
+                                  unsigned channels,
+                                  unsigned channels_per_group,
+                                  unsigned num_groups,
+                                  float epsilon,
+                                  bool epsilon_inside_sqrt,
+                                  bool silu,
+                                  const T* x,
+                                  const T* scale,
+                                  const T* bias,
+                                  T* y) {
+    extern __shared__ __align__(16) unsigned char group_norm_cache[];
+    __shared__ Welford warp_statistics[threads_per_block / warp_size];
+    T* cache = reinterpret_cast<T*>(group_norm_cache);
+
+    const unsigned sample = blockIdx.x / num_groups;
+    const unsigned group = blockIdx.x % num_groups;
+    const size_t sample_offset = static_cast<size_t>(sample) * group_size * num_groups;
+    const unsigned first_channel = group * channels_per_group;
+    auto locate = [&](unsigned i, size_t& offset, unsigned& channel) {
+        if constexpr (Nhwc) {
+            unsigned position = 0;
+            unsigned c = 0;
+            group_divmod.divmod(i, position, c);
+            offset = sample_offset + static_cast<size_t>(position) * channels + first_channel + c;
+            channel = first_channel + c;
+        } else {
+            offset = sample_offset + static_cast<size_t>(group) * group_size + i;
+            channel = first_channel + group_divmod.div(i);
+        }
+    };
+
+    Welford statistics;
+    for (unsigned i = threadIdx.x; i < group_size; i += blockDim.x) {
+        size_t offset = 0;
+        unsigned channel = 0;
+        locate(i, offset, channel);
+        const T value = x[offset];
+        if constexpr (Cached) {
+            cache[i] = value;
+        }
+        statistics.add(static_cast<float>(value));
+    }
+    statistics = warp_reduce(statistics);
+    const unsigned warp = threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (lane == 0) {
+        warp_statistics[warp] = statistics;
+    }
+    __syncthreads();
+    if (warp == 0) {
+        statistics = lane < blockDim.x / warp_size ? warp_statistics[lane] : Welford{};
+        statistics = warp_reduce(statistics);
+        if (lane == 0) {
+            warp_statistics[0] = statistics;
+        }
+    }
+    __syncthreads();
+    statistics = warp_statistics[0];
+    const float variance = statistics.m2 / static_cast<float>(group_size);
+    const float inverse_deviation =
+        epsilon_inside_sqrt ? rsqrtf(variance + epsilon) : 1.0f / (sqrtf(variance) + epsilon);
+
+    for (unsigned i = threadIdx.x; i < group_size; i += blockDim.x) {
+        size_t offset = 0;
+        unsigned channel = 0;
+        locate(i, offset, channel);
+        const float value = static_cast<float>(Cached ? cache[i] : x[offset]);
+        float normalized = (value - statistics.mean) * inverse_deviation * static_cast<float>(scale[channel]) +
+                           static_cast<float>(bias[channel]);
+        if (silu) {
+            normalized = normalized / (1.0f + __expf(-normalized));
+        }
+        y[offset] = static_cast<T>(normalized);
+    }
+}
+
+GroupNorm::GroupNorm(Type_t element_type,
+                     size_t batch,
+                     size_t channels,
+                     size_t spatial,
+                     size_t num_groups,
+                     float epsilon,
+                     bool epsilon_inside_sqrt,
+                     bool silu,
+                     bool nhwc)
+    : element_type_{element_type},
+      batch_{batch},
+      channels_{channels},
+      spatial_{spatial},
+      num_groups_{num_groups},
+      epsilon_{epsilon},
+      epsilon_inside_sqrt_{epsilon_inside_sqrt},
+      silu_{silu},
+      nhwc_{nhwc} {
+    switch (element_type_) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            break;
+        default:
+            throw_ov_exception(
+                fmt::format("Element type = {} is not supported by GroupNorm operation !!", element_type_));
+    }
+    if (channels_ * spatial_ > std::numeric_limits<unsigned>::max()) {
+        throw_ov_exception(fmt::format("Sample of {} elements is too large for GroupNorm operation !!",
+                                       channels_ * spatial_));
+    }
+}
+
+void GroupNorm::operator()(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, x, scale, bias, y);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, x, scale, bias, y);
+#endif
+        default:
+            return call<float>(stream, x, scale, bias, y);
+    }
+}
+
+template <typename T>
+void GroupNorm::call(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const {
+    const bool cached = channels_ / num_groups_ * spatial_ * sizeof(T) <= max_cached_size;
+    if (nhwc_) {
+        return cached ? launch<T, true, true>(stream, x, scale, bias, y)
+                      : launch<T, true, false>(stream, x, scale, bias, y);
+    }
+    return cached ? launch<T, false, true>(stream, x, scale, bias, y)
+                  : launch<T, false, false>(stream, x, scale, bias, y);
+}
+
+template <typename T, bool Nhwc, bool Cached>
+void GroupNorm::launch(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const {
+    const size_t channels_per_group = channels_ / num_groups_;
+    const size_t group_size = channels_per_group * spatial_;
+    const size_t cache_size = Cached ? group_size * sizeof(T) : 0;
+    const FastDivmod group_divmod{static_cast<unsigned>(Nhwc ? channels_per_group : spatial_)};
+    group_norm<T, Nhwc, Cached>
+        <<<batch_ * num_groups_, threads_per_block, cache_size, stream>>>(static_cast<unsigned>(group_size),
+                                                                          group_divmod,
+                                                                          static_cast<unsigned>(channels_),
+                                                                          static_cast<unsigned>(channels_per_group),
+                                                                          static_cast<unsigned>(num_groups_),
+                                                                          epsilon_,
+                                                                          epsilon_inside_sqrt_,
+                                                                          silu_,
+                                                                          static_cast<const T*>(x),
+                                                                          static_cast<const T*>(scale),
+                                                                          static_cast<const T*>(bias),
+                                                                          static_cast<T*>(y));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Normalizes groups of channels of each sample of data [batch, channels, spatial] (or [batch, spatial, channels]
+ * in NHWC layout) by their mean and variance computed by Welford's algorithm, applies the per-channel affine
+ * transform by scale [channels] and bias [channels] and optionally SiLU. Each group is processed by one block,
+ * which keeps groups of up to max_cached_size bytes in shared memory, so that they are read once
+ */
+class GroupNorm {
+public:
+    static constexpr size_t max_cached_size = 48 * 1024;
+
+    GroupNorm(Type_t element_type,
+              size_t batch,
+              size_t channels,
+              size_t spatial,
+              size_t num_groups,
+              float epsilon,
+              bool epsilon_inside_sqrt,
+              bool silu,
+              bool nhwc);
+    GroupNorm(GroupNorm&&) = default;
+    GroupNorm& operator=(GroupNorm&&) = default;
+
+    void operator()(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const;
+
+    template <typename T, bool Nhwc, bool Cached>
+    void launch(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const;
+
+    Type_t element_type_{};
+    size_t batch_{};
+    size_t channels_{};
+    size_t spatial_{};
+    size_t num_groups_{};
+    float epsilon_{};
+    bool epsilon_inside_sqrt_{};
+    bool silu_{};
+    bool nhwc_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -16,6 +16,82 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
+namespace {
+
+constexpr unsigned tile_width = 32;
+constexpr unsigned tile_height = 8;
+constexpr unsigned max_tile_planes = 65535;
+// Input tiles of 4 taps wide filters of upscaled tiles fit tile + 3 input rows or columns
+constexpr unsigned max_input_tile_width = tile_width + 3;
+constexpr unsigned max_input_tile_height = tile_height + 3;
+
+float originalCoordinate(InterpolateCubic::CoordinateTransformMode mode,
+                         unsigned output_coordinate,
+                         float scale,
+                         unsigned output_dim,
+                         unsigned input_dim) {
+    using CoordinateTransformMode = InterpolateCubic::CoordinateTransformMode;
+    const auto coordinate = static_cast<float>(output_coordinate);
+    switch (mode) {
+        case CoordinateTransformMode::half_pixel:
+            return ((coordinate + 0.5f) / scale) - 0.5f;
+        case CoordinateTransformMode::pytorch_half_pixel:
+            return output_dim > 1 ? ((coordinate + 0.5f) / scale) - 0.5f : 0.0f;
+        case CoordinateTransformMode::asymmetric:
+            return coordinate / scale;
+        case CoordinateTransformMode::tf_half_pixel_for_nn:
+            return (coordinate + 0.5f) / scale;
+        case CoordinateTransformMode::align_corners:
+            if (output_dim == 1) {
+                return 0.0f;
+            }
+            return coordinate * static_cast<float>(input_dim - 1) / static_cast<float>(output_dim - 1);
+        default:
+            throw_ov_exception("InterpolateCubic: unsupported coordinate transform mode");
+    }
+}
+
+/**
+ * Taps of the output coordinate, the same as the coordinates and coefficients computed by interpolate_cubic kernel
+ */
+InterpolateCubic::Taps cubicTaps(InterpolateCubic::CoordinateTransformMode mode,
+                                 unsigned output_coordinate,
+                                 float scale,
+                                 unsigned output_dim,
+                                 unsigned input_dim,
+                                 float a) {
+    const float in_coord = originalCoordinate(mode, output_coordinate, scale, output_dim, input_dim);
+    const float in_coord_int = std::floor(in_coord);
+    const float s = std::abs(in_coord - in_coord_int);
+    InterpolateCubic::Taps taps;
+    taps.weight[0] = ((a * (s + 1.0f) - 5.0f * a) * (s + 1.0f) + 8.0f * a) * (s + 1.0f) - 4.0f * a;
+    taps.weight[1] = ((a + 2.0f) * s - (a + 3.0f)) * s * s + 1.0f;
+    taps.weight[2] = ((a + 2.0f) * (1.0f - s) - (a + 3.0f)) * (1.0f - s) * (1.0f - s) + 1.0f;
+    taps.weight[3] = ((a * (2.0f - s) - 5.0f * a) * (2.0f - s) + 8.0f * a) * (2.0f - s) - 4.0f * a;
+    for (int i = 0; i < 4; ++i) {
+        taps.index[i] = std::clamp(static_cast<int>(in_coord_int) + i - 1, 0, static_cast<int>(input_dim) - 1);
+    }
+    return taps;
+}
+
+/**
+ * @returns true if input rows or columns read by every output tile fit max_input_tile_size
+ */
+bool fitInputTiles(const InterpolateCubic::Taps* taps,
+                   size_t output_dim,
+                   unsigned tile_size,
+                   unsigned max_input_tile_size) {
+    for (size_t first = 0; first < output_dim; first += tile_size) {
+        const size_t last = std::min<size_t>(first + tile_size, output_dim) - 1;
+        if (taps[last].index[3] - taps[first].index[0] + 1 > static_cast<int>(max_input_tile_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
 template <typename CT>
 static inline __device__ void get_cubic_coeff(CT s, CT a, CT coeff[4]) {
     CT abs_s = CUDA::math::abs(s);
@@ -87,6 +163,66 @@ static __global__ void interpolate_cubic(const T* input,
     output[output_idx] = static_cast<T>(summa);
 }
 
+/**
+ * Blocks of tile_width x tile_height threads interpolate tiles of output planes, planes are indexed by blockIdx.z.
+ * The input tile read by the taps is loaded into shared memory once, then it's filtered by a horizontal pass
+ * into tile_width columns and by a vertical pass into the output tile
+ */
+template <typename T>
+static __global__ void interpolate_cubic_tiled(const T* input,
+                                               T* output,
+                                               const InterpolateCubic::Taps* row_taps,
+                                               const InterpolateCubic::Taps* column_taps,
+                                               unsigned num_planes,
+                                               unsigned input_height,
+                                               unsigned input_width,
+                                               unsigned output_height,
+                                               unsigned output_width) {
+    __shared__ float input_tile[max_input_tile_height][max_input_tile_width];
+    __shared__ float columns_tile[max_input_tile_height][tile_width];
+
+    const unsigned x0 = blockIdx.x * tile_width;
+    const unsigned y0 = blockIdx.y * tile_height;
+    const unsigned x = x0 + threadIdx.x;
+    const unsigned y = y0 + threadIdx.y;
+    const int input_x0 = column_taps[x0].index[0];
+    const int input_y0 = row_taps[y0].index[0];
+    const unsigned input_tile_width = column_taps[min(x0 + tile_width, output_width) - 1].index[3] - input_x0 + 1;
+    const unsigned input_tile_height = row_taps[min(y0 + tile_height, output_height) - 1].index[3] - input_y0 + 1;
+
+    for (unsigned plane = blockIdx.z; plane < num_planes; plane += gridDim.z) {
+        const T* input_plane = input + static_cast<size_t>(plane) * input_height * input_width;
+        for (unsigned i = threadIdx.y; i < input_tile_height; i += tile_height) {
+            for (unsigned j = threadIdx.x; j < input_tile_width; j += tile_width) {
+                input_tile[i][j] = static_cast<float>(input_plane[(input_y0 + i) * input_width + input_x0 + j]);
+            }
+        }
+        __syncthreads();
+        if (x < output_width) {
+            const auto& taps = column_taps[x];
+            for (unsigned i = threadIdx.y; i < input_tile_height; i += tile_height) {
+                float sum = 0.0f;
+#pragma unroll
+                for (unsigned k = 0; k < 4; ++k) {
+                    sum += taps.weight[k] * input_tile[i][taps.index[k] - input_x0];
+                }
+                columns_tile[i][threadIdx.x] = sum;
+            }
+        }
+        __syncthreads();
+        if (x < output_width && y < output_height) {
+            const auto& taps = row_taps[y];
+            float sum = 0.0f;
+#pragma unroll
+            for (unsigned k = 0; k < 4; ++k) {
+                sum += taps.weight[k] * columns_tile[taps.index[k] - input_y0][threadIdx.x];
+            }
+            output[(static_cast<size_t>(plane) * output_height + y) * output_width + x] = static_cast<T>(sum);
+        }
+        __syncthreads();
+    }
+}
+
 InterpolateCubic::InterpolateCubic(std::vector<size_t> in_shape,
                                    std::vector<size_t> axes,
                                    std::vector<float> scales,
@@ -125,6 +261,61 @@ InterpolateCubic::InterpolateCubic(std::vector<size_t> in_shape,
 
     std::tie(num_blocks_, threads_per_block_) =
         calculateElementwiseGrid(shape_size(props_.output_shape), max_threads_per_block);
+    tiled_ = initTaps(in_shape, axes, scales, out_shape);
+}
+
+bool InterpolateCubic::initTaps(const std::vector<size_t>& in_shape,
+                                const std::vector<size_t>& axes,
+                                const std::vector<float>& scales,
+                                const std::vector<size_t>& out_shape) {
+    const size_t rank = in_shape.size();
+    if (rank < 2 || std::count(in_shape.begin(), in_shape.end(), 0) > 0) {
+        return false;
+    }
+    // Outer dimensions have to be copied as they are
+    for (size_t i = 0; i < axes.size(); ++i) {
+        const bool identity =
+            scales[i] == 1.0f && props_.transform_mode != CoordinateTransformMode::tf_half_pixel_for_nn;
+        if (axes[i] + 2 < rank && !identity) {
+            return false;
+        }
+    }
+    num_planes_ = 1;
+    for (size_t d = 0; d + 2 < rank; ++d) {
+        if (in_shape[d] != out_shape[d]) {
+            return false;
+        }
+        num_planes_ *= in_shape[d];
+    }
+    auto axisTaps = [&](size_t axis) {
+        const auto it = std::find(axes.begin(), axes.end(), axis);
+        for (unsigned i = 0; i < out_shape[axis]; ++i) {
+            if (it == axes.end()) {
+                Taps taps;
+                std::fill(std::begin(taps.index), std::end(taps.index), static_cast<int>(i));
+                taps.weight[1] = 1.0f;
+                taps_.push_back(taps);
+            } else {
+                taps_.push_back(cubicTaps(props_.transform_mode,
+                                          i,
+                                          scales[it - axes.begin()],
+                                          out_shape[axis],
+                                          in_shape[axis],
+                                          props_.cube_coeff));
+            }
+        }
+    };
+    axisTaps(rank - 2);
+    axisTaps(rank - 1);
+    const size_t output_height = out_shape[rank - 2];
+    const size_t output_width = out_shape[rank - 1];
+    if (num_planes_ == 0 || output_height == 0 || output_width == 0 ||
+        !fitInputTiles(taps_.data(), output_height, tile_height, max_input_tile_height) ||
+        !fitInputTiles(taps_.data() + output_height, output_width, tile_width, max_input_tile_width)) {
+        taps_.clear();
+        return false;
+    }
+    return true;
 }
 
 void InterpolateCubic::operator()(const cudaStream_t stream, const void* input, void* output) const {
@@ -149,6 +340,9 @@ void InterpolateCubic::operator()(const cudaStream_t stream, const void* input,
 
 template <typename T, typename CT>
 void InterpolateCubic::callKernel(const cudaStream_t stream, const void* input, void* output) const {
+    if (tiled_) {
+        return callTiledKernel<T>(stream, input, output);
+    }
     kernel::interpolate_cubic<T, CT>
         <<<num_blocks_, threads_per_block_, 0, stream>>>(static_cast<const T*>(input),
                                                          static_cast<T*>(output),
@@ -157,7 +351,33 @@ void InterpolateCubic::callKernel(const cudaStream_t stream, const void* input,
                                                          indices_.size());
 }
 
+template <typename T>
+void InterpolateCubic::callTiledKernel(const cudaStream_t stream, const void* input, void* output) const {
+    const unsigned rank = static_cast<unsigned>(kernel::rank(props_.input_shape));
+    const unsigned input_height = props_.input_shape[rank - 2];
+    const unsigned input_width = props_.input_shape[rank - 1];
+    const unsigned output_height = props_.output_shape[rank - 2];
+    const unsigned output_width = props_.output_shape[rank - 1];
+    const auto* row_taps = static_cast<const Taps*>(taps_device_ptr_);
+    const dim3 grid((output_width + tile_width - 1) / tile_width,
+                    (output_height + tile_height - 1) / tile_height,
+                    std::min(num_planes_, max_tile_planes));
+    const dim3 block(tile_width, tile_height);
+    kernel::interpolate_cubic_tiled<T><<<grid, block, 0, stream>>>(static_cast<const T*>(input),
+                                                                   static_cast<T*>(output),
+                                                                   row_taps,
+                                                                   row_taps + output_height,
+                                                                   num_planes_,
+                                                                   input_height,
+                                                                   input_width,
+                                                                   output_height,
+                                                                   output_width);
+}
+
 std::vector<size_t> InterpolateCubic::immutableWorkbufferSizes() const {
+    if (tiled_) {
+        return {sizeof(Props), sizeof(Index) * indices_.size(), sizeof(Taps) * taps_.size()};
+    }
     return {sizeof(Props), sizeof(Index) * indices_.size()};
 }
 
@@ -169,6 +389,12 @@ void InterpolateCubic::initImmutableWorkbuffers(const std::vector<void*>& buffer
     kernel::throwIfError(cudaMemcpyAsync(
         buffers[1], static_cast<const void*>(&indices_[0]), sizeof(Index) * indices_.size(), cudaMemcpyHostToDevice));
     indices_device_ptr_ = buffers[1];
+
+    if (tiled_) {
+        kernel::throwIfError(cudaMemcpyAsync(
+            buffers[2], static_cast<const void*>(taps_.data()), sizeof(Taps) * taps_.size(), cudaMemcpyHostToDevice));
+        taps_device_ptr_ = buffers[2];
+    }
 }
 
 }  // namespace kernel
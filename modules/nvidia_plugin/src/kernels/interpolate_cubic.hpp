@@ -43,15 +43,36 @@ public:
         CoordinateTransformMode transform_mode{};
     };
 
+    /**
+     * Clipped input coordinates and weights of the 4 taps of one output coordinate along one axis
+     */
+    struct Taps {
+        int index[4]{};
+        float weight[4]{};
+    };
+
 private:
     template <typename T, typename CT>
     void callKernel(const cudaStream_t stream, const void* input, void* output) const;
 
+    template <typename T>
+    void callTiledKernel(const cudaStream_t stream, const void* input, void* output) const;
+
+    bool initTaps(const std::vector<size_t>& in_shape,
+                  const std::vector<size_t>& axes,
+                  const std::vector<float>& scales,
+                  const std::vector<size_t>& out_shape);
+
 private:
     Props props_;
     const void* props_device_ptr_;
     std::vector<Index> indices_;
     const void* indices_device_ptr_;
+    // Taps of output rows followed by taps of output columns, used when only the 2 innermost axes are interpolated
+    bool tiled_{};
+    std::vector<Taps> taps_;
+    const void* taps_device_ptr_{};
+    unsigned num_planes_{};
 
     size_t num_blocks_;
     size_t threads_per_block_;
@@ -183,10 +183,37 @@ static __global__ void upscale_interpolate(const InterpolateNearest::NearestMode
     }
 }
 
+template <typename T>
+struct alignas(2 * sizeof(T)) Duplicate {
+    T values[2];
+};
+
+/**
+ * Each thread reads one input element and writes it to 2x2 output elements by two vector stores.
+ * Output coordinate o of the 2 innermost axes is expected to map to input coordinate o / 2
+ */
+template <typename T>
+static __global__ void upscale_by_2(const T* src, const size_t input_strides[4], const size_t input_shape[4], T* dst) {
+    enum { N, C, H, W };
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= input_strides[0] * input_shape[0]) {
+        return;
+    }
+    const unsigned width = input_shape[W];
+    const unsigned row = idx / width;
+    const unsigned w = idx % width;
+    const T value = src[idx];
+    const Duplicate<T> values{{value, value}};
+    auto* out = reinterpret_cast<Duplicate<T>*>(dst);
+    out[2 * row * width + w] = values;
+    out[(2 * row + 1) * width + w] = values;
+}
+
 InterpolateNearest::InterpolateNearest(size_t num_blocks,
                                        size_t threads_per_block,
                                        ov::nvidia_gpu::kernel::Type_t element_type,
                                        bool use_optimized_kernel,
+                                       bool upscale_by_2,
                                        NearestMode nearest_mode,
                                        CoordinateTransformMode transform_mode)
     : InterpolateBase{element_type},
@@ -194,6 +221,7 @@ InterpolateNearest::InterpolateNearest(size_t num_blocks,
       threads_per_block_{threads_per_block},
       element_type_{element_type},
       use_optimized_kernel_{use_optimized_kernel},
+      upscale_by_2_{upscale_by_2},
       nearest_mode_{nearest_mode},
       transform_mode_{transform_mode} {}
 
@@ -238,7 +266,10 @@ void InterpolateNearest::callKernel(const cudaStream_t stream,
                                     const size_t* input_shape,
                                     const size_t* output_shape,
                                     void* dst) const {
-    if (use_optimized_kernel_)
+    if (upscale_by_2_)
+        kernel::upscale_by_2<T><<<num_blocks_, threads_per_block_, 0, stream>>>(
+            static_cast<const T*>(src), input_strides, input_shape, static_cast<T*>(dst));
+    else if (use_optimized_kernel_)
         kernel::upscale_interpolate<T><<<num_blocks_, threads_per_block_, 0, stream>>>(nearest_mode_,
                                                                                        transform_mode_,
                                                                                        static_cast<const T*>(src),
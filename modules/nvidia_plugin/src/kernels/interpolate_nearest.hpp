@@ -23,6 +23,7 @@ public:
                        size_t threads_per_block,
                        ov::nvidia_gpu::kernel::Type_t element_type,
                        bool upscale,
+                       bool upscale_by_2,
                        NearestMode nearest_mode,
                        CoordinateTransformMode transform_mode);
 
@@ -51,6 +52,7 @@ private:
     size_t threads_per_block_;
     Type_t element_type_;
     bool use_optimized_kernel_;
+    bool upscale_by_2_;
     NearestMode nearest_mode_;
     CoordinateTransformMode transform_mode_;
 };
@@ -0,0 +1,142 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "details/welford.cuh"
+#include "layer_norm.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned warps_per_block = 4;
+
+}  // namespace
+
+/**
+ * ValuesPerLane is the number of cached values of a row per lane, rows aren't cached if it is 0
+ */
+template <typename T, unsigned ValuesPerLane>
+static __global__ void layer_norm(size_t rows,
+                                  size_t length,
+                                  float epsilon,
+                                  bool epsilon_inside_sqrt,
+                                  const T* x,
+                                  const T* scale,
+                                  const T* bias,
+                                  T* y) {
+    const size_t row = static_cast<size_t>(blockIdx.x) * warps_per_block + threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (row >= rows) {
+        return;
+    }
+    const T* x_row = x + row * length;
+    T* y_row = y + row * length;
+
+    Welford statistics;
+    float cached[ValuesPerLane > 0 ? ValuesPerLane : 1];
+    if constexpr (ValuesPerLane > 0) {
+#pragma unroll
+        for (unsigned r = 0; r < ValuesPerLane; ++r) {
+            const size_t i = lane + r * warp_size;
+            if (i < length) {
+                cached[r] = static_cast<float>(x_row[i]);
+                statistics.add(cached[r]);
+            }
+        }
+    } else {
+        for (size_t i = lane; i < length; i += warp_size) {
+            statistics.add(static_cast<float>(x_row[i]));
+        }
+    }
+    statistics = warp_reduce(statistics);
+    const float variance = statistics.m2 / static_cast<float>(length);
+    const float inverse_deviation =
+        epsilon_inside_sqrt ? rsqrtf(variance + epsilon) : 1.0f / (sqrtf(variance) + epsilon);
+
+    auto normalize = [&](size_t i, float value) {
+        const float normalized = (value - statistics.mean) * inverse_deviation;
+        y_row[i] = static_cast<T>(normalized * static_cast<float>(scale[i]) + static_cast<float>(bias[i]));
+    };
+    if constexpr (ValuesPerLane > 0) {
+#pragma unroll
+        for (unsigned r = 0; r < ValuesPerLane; ++r) {
+            const size_t i = lane + r * warp_size;
+            if (i < length) {
+                normalize(i, cached[r]);
+            }
+        }
+    } else {
+        for (size_t i = lane; i < length; i += warp_size) {
+            normalize(i, static_cast<float>(x_row[i]));
+        }
+    }
+}
+
+LayerNorm::LayerNorm(Type_t element_type, size_t rows, size_t length, float epsilon, bool epsilon_inside_sqrt)
+    : element_type_{element_type},
+      rows_{rows},
+      length_{length},
+      epsilon_{epsilon},
+      epsilon_inside_sqrt_{epsilon_inside_sqrt} {
+    switch (element_type_) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            break;
+        default:
+            throw_ov_exception(
+                fmt::format("Element type = {} is not supported by LayerNorm operation !!", element_type_));
+    }
+}
+
+void LayerNorm::operator()(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, x, scale, bias, y);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, x, scale, bias, y);
+#endif
+        default:
+            return call<float>(stream, x, scale, bias, y);
+    }
+}
+
+template <typename T>
+void LayerNorm::call(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const {
+    if (length_ <= 8 * warp_size) {
+        return launch<T, 8>(stream, x, scale, bias, y);
+    }
+    if (length_ <= max_cached_length) {
+        return launch<T, max_cached_length / warp_size>(stream, x, scale, bias, y);
+    }
+    return launch<T, 0>(stream, x, scale, bias, y);
+}
+
+template <typename T, unsigned ValuesPerLane>
+void LayerNorm::launch(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const {
+    const unsigned num_blocks = (rows_ + warps_per_block - 1) / warps_per_block;
+    layer_norm<T, ValuesPerLane><<<num_blocks, warps_per_block * warp_size, 0, stream>>>(rows_,
+                                                                                         length_,
+                                                                                         epsilon_,
+                                                                                         epsilon_inside_sqrt_,
+                                                                                         static_cast<const T*>(x),
+                                                                                         static_cast<const T*>(scale),
+                                                                                         static_cast<const T*>(bias),
+                                                                                         static_cast<T*>(y));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Normalizes rows [rows, length] by their mean and variance computed by Welford's algorithm and applies
+ * the affine transform by scale [length] and bias [length]. Each row is processed by one warp, which keeps
+ * rows of up to max_cached_length elements in registers, so that they are read once
+ */
+class LayerNorm {
+public:
+    static constexpr size_t max_cached_length = 1024;
+
+    LayerNorm(Type_t element_type, size_t rows, size_t length, float epsilon, bool epsilon_inside_sqrt);
+    LayerNorm(LayerNorm&&) = default;
+    LayerNorm& operator=(LayerNorm&&) = default;
+
+    void operator()(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const;
+
+    template <typename T, unsigned ValuesPerLane>
+    void launch(cudaStream_t stream, const void* x, const void* scale, const void* bias, void* y) const;
+
+    Type_t element_type_{};
+    size_t rows_{};
+    size_t length_{};
+    float epsilon_{};
+    bool epsilon_inside_sqrt_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -10,19 +10,22 @@ namespace kernel {
 
 namespace cumath = CUDA::math;
 
-template <typename T>
+template <typename T, bool Fast>
 struct MishOpImpl {
     __device__ static inline T softplus(T x) {
+        if (Fast) {
+            return cumath::fast::log(static_cast<T>(1.0) + cumath::fast::exp(x));
+        }
         return cumath::log(static_cast<T>(1.0) + cumath::exp(x));
     }
 
     __device__ static inline T op(T x) {
-        return x * cumath::tanh(softplus(x));
+        return x * (Fast ? cumath::fast::tanh(softplus(x)) : cumath::tanh(softplus(x)));
     }
 };
 
-Mish::Mish(Type_t element_type, size_t max_threads_per_block, size_t num_elements)
-    : impl_{element_type, max_threads_per_block, num_elements} {}
+Mish::Mish(Type_t element_type, size_t max_threads_per_block, size_t num_elements, bool fast_math)
+    : impl_{element_type, max_threads_per_block, num_elements, fast_math} {}
 
 void Mish::operator()(cudaStream_t stream, const void* in0, void* out) const {
     impl_(stream, in0, out);
@@ -11,19 +11,19 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
-template <typename T>
+template <typename T, bool Fast>
 struct MishOpImpl;
 /**
  * Elementwise Mish
  */
 class Mish {
 public:
-    Mish(Type_t element_type, size_t max_threads_per_block, size_t num_elements);
+    Mish(Type_t element_type, size_t max_threads_per_block, size_t num_elements, bool fast_math = false);
 
     void operator()(cudaStream_t stream, const void* in0, void* out) const;
 
 private:
-    ElementwiseUnary<FloatElementTypesSwitch, MishOpImpl> impl_;
+    ElementwiseUnaryMath<FloatElementTypesSwitch, MishOpImpl> impl_;
 };
 
 }  // namespace kernel
@@ -0,0 +1,295 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "details/block_nms.cuh"
+#include "details/error.hpp"
+#include "non_max_suppression.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned max_block_size = 512;
+
+struct Args {
+    unsigned num_batches;
+    unsigned num_classes;
+    unsigned num_boxes;
+    // Capacity of selected boxes of a class
+    unsigned max_selected;
+    float iou_threshold;
+    float score_threshold;
+    bool center_point_box;
+    bool sort_result_descending;
+};
+
+/**
+ * Buffers of the workspace, candidates, suppressed and selected are per class of a batch
+ */
+struct Workspace {
+    unsigned* candidates;
+    unsigned* suppressed;
+    unsigned* selected;
+    unsigned* counts;
+    unsigned* offsets;
+    // Slots of selected boxes in the order of outputs
+    unsigned* order;
+};
+
+Workspace workspaceLayout(const Args& args, void* workspace) {
+    const size_t num_classes = static_cast<size_t>(args.num_batches) * args.num_classes;
+    Workspace layout{};
+    layout.candidates = static_cast<unsigned*>(workspace);
+    layout.suppressed = layout.candidates + num_classes * args.num_boxes;
+    layout.selected = layout.suppressed + num_classes * nms::bitmask_words(args.num_boxes);
+    layout.counts = layout.selected + num_classes * args.max_selected;
+    layout.offsets = layout.counts + num_classes;
+    layout.order = layout.offsets + num_classes;
+    return layout;
+}
+
+size_t workspaceElements(const Args& args) {
+    const size_t num_classes = static_cast<size_t>(args.num_batches) * args.num_classes;
+    return num_classes * (args.num_boxes + nms::bitmask_words(args.num_boxes) + 2 * args.max_selected + 2);
+}
+
+struct Box {
+    float y1;
+    float x1;
+    float y2;
+    float x2;
+};
+
+template <typename T>
+__device__ Box load_box(const T* box, const bool center_point_box) {
+    const float b0 = static_cast<float>(box[0]);
+    const float b1 = static_cast<float>(box[1]);
+    const float b2 = static_cast<float>(box[2]);
+    const float b3 = static_cast<float>(box[3]);
+    if (center_point_box) {
+        // [x_center, y_center, width, height]
+        return {b1 - b3 / 2.0f, b0 - b2 / 2.0f, b1 + b3 / 2.0f, b0 + b2 / 2.0f};
+    }
+    // [y1, x1, y2, x2] of any pair of diagonal corners
+    return {fminf(b0, b2), fminf(b1, b3), fmaxf(b0, b2), fmaxf(b1, b3)};
+}
+
+__device__ float intersection_over_union(const Box& a, const Box& b) {
+    const float area_a = (a.y2 - a.y1) * (a.x2 - a.x1);
+    const float area_b = (b.y2 - b.y1) * (b.x2 - b.x1);
+    if (area_a <= 0.0f || area_b <= 0.0f) {
+        return 0.0f;
+    }
+    const float height = fmaxf(fminf(a.y2, b.y2) - fmaxf(a.y1, b.y1), 0.0f);
+    const float width = fmaxf(fminf(a.x2, b.x2) - fmaxf(a.x1, b.x1), 0.0f);
+    const float intersection = height * width;
+    return intersection / (area_a + area_b - intersection);
+}
+
+/**
+ * Selects boxes of a class of a batch per block: boxes with scores above the threshold are sorted by descending
+ * scores, ties by box indices, and greedily suppressed
+ */
+template <typename T>
+__global__ void nms_per_class(const Args args, const T* boxes, const T* scores, const Workspace workspace) {
+    const unsigned batch_class = blockIdx.x;
+    const T* batch_boxes = boxes + static_cast<size_t>(batch_class / args.num_classes) * args.num_boxes * 4;
+    const T* class_scores = scores + static_cast<size_t>(batch_class) * args.num_boxes;
+    unsigned* candidates = workspace.candidates + static_cast<size_t>(batch_class) * args.num_boxes;
+    unsigned* selected = workspace.selected + static_cast<size_t>(batch_class) * args.max_selected;
+
+    __shared__ unsigned num_candidates;
+    if (threadIdx.x == 0) {
+        num_candidates = 0;
+    }
+    __syncthreads();
+    for (unsigned i = threadIdx.x; i < args.num_boxes; i += blockDim.x) {
+        if (static_cast<float>(class_scores[i]) > args.score_threshold) {
+            candidates[atomicAdd(&num_candidates, 1)] = i;
+        }
+    }
+    __syncthreads();
+    const unsigned num = num_candidates;
+
+    nms::block_sort(candidates, num, [class_scores](const unsigned a, const unsigned b) {
+        const float score_a = static_cast<float>(class_scores[a]);
+        const float score_b = static_cast<float>(class_scores[b]);
+        return score_a > score_b || (score_a == score_b && a < b);
+    });
+    const unsigned num_selected = nms::block_greedy_nms(
+        num,
+        args.max_selected,
+        workspace.suppressed + static_cast<size_t>(batch_class) * nms::bitmask_words(args.num_boxes),
+        [&args, batch_boxes, candidates](const unsigned i, const unsigned j) {
+            const Box a = load_box(batch_boxes + candidates[i] * 4, args.center_point_box);
+            const Box b = load_box(batch_boxes + candidates[j] * 4, args.center_point_box);
+            return intersection_over_union(a, b) >= args.iou_threshold;
+        },
+        [selected, candidates](const unsigned i, const unsigned n) { selected[n] = candidates[i]; });
+    if (threadIdx.x == 0) {
+        workspace.counts[batch_class] = num_selected;
+    }
+}
+
+/**
+ * Gathers selected boxes of all classes by a single block in the order of batches and classes or by descending
+ * scores, ties by batches, classes and boxes, and pads outputs with -1
+ */
+template <typename T, typename TIndex>
+__global__ void nms_gather(const Args args,
+                           const T* scores,
+                           const Workspace workspace,
+                           TIndex* selected_indices,
+                           T* selected_scores,
+                           TIndex* valid_outputs) {
+    const unsigned num_classes = args.num_batches * args.num_classes;
+    const unsigned max_selected = args.max_selected;
+    __shared__ unsigned num_selected;
+    if (threadIdx.x == 0) {
+        unsigned offset = 0;
+        for (unsigned i = 0; i < num_classes; ++i) {
+            workspace.offsets[i] = offset;
+            offset += workspace.counts[i];
+        }
+        num_selected = offset;
+        *valid_outputs = static_cast<TIndex>(offset);
+    }
+    __syncthreads();
+    for (unsigned slot = threadIdx.x; slot < num_classes * max_selected; slot += blockDim.x) {
+        const unsigned batch_class = slot / max_selected;
+        const unsigned n = slot % max_selected;
+        if (n < workspace.counts[batch_class]) {
+            workspace.order[workspace.offsets[batch_class] + n] = slot;
+        }
+    }
+    __syncthreads();
+    const unsigned num = num_selected;
+
+    auto score = [&args, scores, &workspace, max_selected](const unsigned slot) {
+        const size_t batch_class = slot / max_selected;
+        return static_cast<float>(scores[batch_class * args.num_boxes + workspace.selected[slot]]);
+    };
+    if (args.sort_result_descending) {
+        nms::block_sort(workspace.order, num, [&score, &workspace, max_selected](const unsigned a, const unsigned b) {
+            const float score_a = score(a);
+            const float score_b = score(b);
+            if (score_a != score_b) {
+                return score_a > score_b;
+            }
+            const unsigned batch_class_a = a / max_selected;
+            const unsigned batch_class_b = b / max_selected;
+            return batch_class_a < batch_class_b ||
+                   (batch_class_a == batch_class_b && workspace.selected[a] < workspace.selected[b]);
+        });
+    }
+
+    for (unsigned i = threadIdx.x; i < num_classes * max_selected; i += blockDim.x) {
+        TIndex* indices = selected_indices + 3 * static_cast<size_t>(i);
+        T* scores_row = selected_scores + 3 * static_cast<size_t>(i);
+        if (i < num) {
+            const unsigned slot = workspace.order[i];
+            const unsigned batch_class = slot / max_selected;
+            const unsigned batch = batch_class / args.num_classes;
+            const unsigned cls = batch_class % args.num_classes;
+            indices[0] = static_cast<TIndex>(batch);
+            indices[1] = static_cast<TIndex>(cls);
+            indices[2] = static_cast<TIndex>(workspace.selected[slot]);
+            scores_row[0] = static_cast<T>(static_cast<float>(batch));
+            scores_row[1] = static_cast<T>(static_cast<float>(cls));
+            scores_row[2] = static_cast<T>(score(slot));
+        } else {
+            indices[0] = indices[1] = indices[2] = static_cast<TIndex>(-1);
+            scores_row[0] = scores_row[1] = scores_row[2] = static_cast<T>(-1.0f);
+        }
+    }
+}
+
+Args makeArgs(const NonMaxSuppression::Params& params) {
+    return {static_cast<unsigned>(params.num_batches),
+            static_cast<unsigned>(params.num_classes),
+            static_cast<unsigned>(params.num_boxes),
+            static_cast<unsigned>(std::min(params.num_boxes, params.max_output_boxes_per_class)),
+            params.iou_threshold,
+            params.score_threshold,
+            params.center_point_box,
+            params.sort_result_descending};
+}
+
+}  // namespace
+
+NonMaxSuppression::NonMaxSuppression(const Params& params, const size_t max_threads_per_block)
+    : params_{params}, block_size_{static_cast<unsigned>(std::min<size_t>(max_threads_per_block, max_block_size))} {
+    switch (params_.element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+            break;
+        default:
+            throw_ov_exception(fmt::format("Element type = {} is not supported by NonMaxSuppression operation !!",
+                                           params_.element_type));
+    }
+    if (params_.index_type != Type_t::i32 && params_.index_type != Type_t::i64) {
+        throw_ov_exception(fmt::format("Index type = {} is not supported by NonMaxSuppression operation !!",
+                                       params_.index_type));
+    }
+}
+
+size_t NonMaxSuppression::workspaceSize() const { return workspaceElements(makeArgs(params_)) * sizeof(unsigned); }
+
+void NonMaxSuppression::operator()(const cudaStream_t stream,
+                                   const void* boxes,
+                                   const void* scores,
+                                   void* selected_indices,
+                                   void* selected_scores,
+                                   void* valid_outputs,
+                                   void* workspace) const {
+    const bool i32 = params_.index_type == Type_t::i32;
+    switch (params_.element_type) {
+        case Type_t::f16:
+            return i32 ? call<__half, int32_t>(
+                             stream, boxes, scores, selected_indices, selected_scores, valid_outputs, workspace)
+                       : call<__half, int64_t>(
+                             stream, boxes, scores, selected_indices, selected_scores, valid_outputs, workspace);
+        default:
+            return i32 ? call<float, int32_t>(
+                             stream, boxes, scores, selected_indices, selected_scores, valid_outputs, workspace)
+                       : call<float, int64_t>(
+                             stream, boxes, scores, selected_indices, selected_scores, valid_outputs, workspace);
+    }
+}
+
+template <typename T, typename TIndex>
+void NonMaxSuppression::call(const cudaStream_t stream,
+                             const void* boxes,
+                             const void* scores,
+                             void* selected_indices,
+                             void* selected_scores,
+                             void* valid_outputs,
+                             void* workspace) const {
+    const auto args = makeArgs(params_);
+    const auto layout = workspaceLayout(args, workspace);
+    const unsigned num_classes = args.num_batches * args.num_classes;
+    if (num_classes > 0 && args.max_selected > 0) {
+        nms_per_class<T><<<num_classes, block_size_, 0, stream>>>(
+            args, static_cast<const T*>(boxes), static_cast<const T*>(scores), layout);
+    } else {
+        throwIfError(cudaMemsetAsync(layout.counts, 0, num_classes * sizeof(unsigned), stream));
+    }
+    nms_gather<T, TIndex><<<1, block_size_, 0, stream>>>(args,
+                                                         static_cast<const T*>(scores),
+                                                         layout,
+                                                         static_cast<TIndex*>(selected_indices),
+                                                         static_cast<T*>(selected_scores),
+                                                         static_cast<TIndex*>(valid_outputs));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * NonMaxSuppression of all classes of all batches, which are processed by a block each with the batched NMS engine
+ * shared with DetectionOutput. Selected boxes are gathered to static outputs padded with -1 by a single block, so the
+ * number of them is written to the device and never read back to the host
+ */
+class NonMaxSuppression {
+public:
+    struct Params {
+        Type_t element_type;
+        Type_t index_type;
+        size_t num_batches;
+        size_t num_classes;
+        size_t num_boxes;
+        size_t max_output_boxes_per_class;
+        float iou_threshold;
+        float score_threshold;
+        bool center_point_box;
+        bool sort_result_descending;
+    };
+
+    NonMaxSuppression(const Params& params, size_t max_threads_per_block);
+
+    /**
+     * @returns Size in bytes of candidates, selected boxes and offsets of all classes
+     */
+    size_t workspaceSize() const;
+
+    /**
+     * @param selected_indices [num_selected, 3] of index_type
+     * @param selected_scores [num_selected, 3] of element_type
+     * @param valid_outputs [1] of index_type
+     */
+    void operator()(cudaStream_t stream,
+                    const void* boxes,
+                    const void* scores,
+                    void* selected_indices,
+                    void* selected_scores,
+                    void* valid_outputs,
+                    void* workspace) const;
+
+private:
+    template <typename T, typename TIndex>
+    void call(cudaStream_t stream,
+              const void* boxes,
+              const void* scores,
+              void* selected_indices,
+              void* selected_scores,
+              void* valid_outputs,
+              void* workspace) const;
+
+    Params params_;
+    unsigned block_size_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,106 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "persistent_sequence.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+__device__ __forceinline__ float apply(PersistentSequence::Op op, float a, float b) {
+    using Op = PersistentSequence::Op;
+    switch (op) {
+        case Op::Add:
+            return a + b;
+        case Op::Subtract:
+            return a - b;
+        case Op::Multiply:
+            return a * b;
+        case Op::Divide:
+            return a / b;
+        case Op::Maximum:
+            return fmaxf(a, b);
+        case Op::Minimum:
+            return fminf(a, b);
+        case Op::Relu:
+            return a > 0.0f ? a : 0.0f;
+        case Op::Sigmoid:
+            return 1.0f / (1.0f + expf(-a));
+        case Op::Tanh:
+            return tanhf(a);
+    }
+    return a;
+}
+
+__device__ __forceinline__ bool isBinary(PersistentSequence::Op op) {
+    using Op = PersistentSequence::Op;
+    return op == Op::Add || op == Op::Subtract || op == Op::Multiply || op == Op::Divide || op == Op::Maximum ||
+           op == Op::Minimum;
+}
+
+}  // namespace
+
+template <typename T>
+static __global__ void persistent_sequence(const PersistentSequence::Steps steps) {
+    for (unsigned s = 0; s < steps.count; ++s) {
+        const auto& step = steps.steps[s];
+        const auto* a = static_cast<const T*>(step.a);
+        const auto* b = static_cast<const T*>(step.b);
+        auto* y = static_cast<T*>(step.y);
+        const bool binary = isBinary(step.op);
+        for (unsigned i = threadIdx.x; i < step.size; i += blockDim.x) {
+            const float rhs = binary ? static_cast<float>(b[i]) : 0.0f;
+            y[i] = static_cast<T>(apply(step.op, static_cast<float>(a[i]), rhs));
+        }
+        __syncthreads();
+    }
+}
+
+PersistentSequence::PersistentSequence(Type_t element_type, size_t max_threads_per_block)
+    : element_type_{element_type}, num_threads_{static_cast<unsigned>(std::min<size_t>(max_threads_per_block, 1024))} {
+    if (!isTypeSupported(element_type_)) {
+        throw_ov_exception(
+            fmt::format("Element type = {} is not supported by PersistentSequence operation !!", element_type_));
+    }
+}
+
+bool PersistentSequence::isTypeSupported(Type_t element_type) {
+    switch (element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void PersistentSequence::operator()(cudaStream_t stream, const Steps& steps) const {
+    if (steps.count == 0) {
+        return;
+    }
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, steps);
+        default:
+            return call<float>(stream, steps);
+    }
+}
+
+template <typename T>
+void PersistentSequence::call(cudaStream_t stream, const Steps& steps) const {
+    persistent_sequence<T><<<1, num_threads_, 0, stream>>>(steps);
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
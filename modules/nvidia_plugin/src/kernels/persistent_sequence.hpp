@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Executes a sequence of element-wise steps over small tensors of the same element type by one launch of one block.
+ * Steps are passed by value as the kernel parameter, the block walks them in order with a block-wide barrier
+ * between them, so a step may read outputs of previous steps and write buffers, which previous steps read.
+ */
+class PersistentSequence {
+public:
+    enum class Op : unsigned { Add, Subtract, Multiply, Divide, Maximum, Minimum, Relu, Sigmoid, Tanh };
+
+    static constexpr size_t max_steps = 48;
+
+    struct Step {
+        Op op{};
+        unsigned size{};
+        const void* a{};
+        const void* b{};
+        void* y{};
+    };
+
+    struct Steps {
+        unsigned count{};
+        Step steps[max_steps]{};
+    };
+
+    PersistentSequence(Type_t element_type, size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const Steps& steps) const;
+
+    /**
+     * @returns true if the kernel supports the element type
+     */
+    static bool isTypeSupported(Type_t element_type);
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const Steps& steps) const;
+
+    Type_t element_type_{};
+    unsigned num_threads_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
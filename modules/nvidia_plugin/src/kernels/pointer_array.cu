@@ -0,0 +1,43 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "pointer_array.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+// Size of a chunk fits into the limit of kernel parameters (4 KB)
+constexpr std::size_t kMaxPointersPerLaunch = 256;
+
+struct PointerChunk {
+    const void* pointers[kMaxPointersPerLaunch];
+};
+
+}  // namespace
+
+static __global__ void fill_pointer_array(const PointerChunk chunk, const std::size_t count, const void** dst) {
+    const unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < count) {
+        dst[i] = chunk.pointers[i];
+    }
+}
+
+void fillPointerArray(cudaStream_t stream, void* dst, const void* const* src, std::size_t count) {
+    auto* dst_pointers = static_cast<const void**>(dst);
+    for (std::size_t offset = 0; offset < count; offset += kMaxPointersPerLaunch) {
+        const auto chunk_size = std::min(kMaxPointersPerLaunch, count - offset);
+        PointerChunk chunk{};
+        std::copy(src + offset, src + offset + chunk_size, chunk.pointers);
+        fill_pointer_array<<<1, chunk_size, 0, stream>>>(chunk, chunk_size, dst_pointers + offset);
+    }
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,28 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Writes an array of device pointers into device memory.
+ * Pointers are passed to kernels by value instead of host-to-device copy of the transient host array,
+ * so the operation is captured into CUDA Graph correctly.
+ * @param stream CUDA stream
+ * @param dst Device memory for @p count pointers
+ * @param src Host array of device pointers
+ * @param count Number of pointers
+ */
+void fillPointerArray(cudaStream_t stream, void* dst, const void* const* src, std::size_t count);
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
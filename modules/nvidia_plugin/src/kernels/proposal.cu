@@ -0,0 +1,285 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cuda/float16.hpp>
+
+#include "details/block_nms.cuh"
+#include "details/error.hpp"
+#include "proposal.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned max_block_size = 512;
+// Caffe boxes include both of their corners
+constexpr float coordinates_offset = 1.0f;
+
+struct Args {
+    unsigned num_anchors;
+    unsigned height;
+    unsigned width;
+    unsigned image_shape_size;
+    unsigned pre_nms_topn;
+    unsigned post_nms_topn;
+    float nms_thresh;
+    float feat_stride;
+    float min_size;
+    bool clip_before_nms;
+    bool clip_after_nms;
+    bool normalize;
+    float box_size_scale;
+    float box_coordinate_scale;
+};
+
+struct Box {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+};
+
+/**
+ * Buffers of the workspace, which are per image
+ */
+struct Workspace {
+    Box* boxes;
+    float* scores;
+    unsigned* order;
+    unsigned* suppressed;
+};
+
+__device__ float intersection_over_union(const Box& a, const Box& b) {
+    const float width = fmaxf(fminf(a.x1, b.x1) - fmaxf(a.x0, b.x0) + coordinates_offset, 0.0f);
+    const float height = fmaxf(fminf(a.y1, b.y1) - fmaxf(a.y0, b.y0) + coordinates_offset, 0.0f);
+    const float intersection = width * height;
+    const float area_a = (a.x1 - a.x0 + coordinates_offset) * (a.y1 - a.y0 + coordinates_offset);
+    const float area_b = (b.x1 - b.x0 + coordinates_offset) * (b.y1 - b.y0 + coordinates_offset);
+    return intersection / (area_a + area_b - intersection);
+}
+
+template <typename T>
+__global__ void proposal(const Args args,
+                         const T* class_probs,
+                         const T* bbox_deltas,
+                         const T* image_shape,
+                         const float* anchors,
+                         T* rois,
+                         T* probs,
+                         const Workspace workspace) {
+    const unsigned batch = blockIdx.x;
+    const unsigned spatial_size = args.height * args.width;
+    const unsigned num_proposals = args.num_anchors * spatial_size;
+    Box* boxes = workspace.boxes + static_cast<size_t>(batch) * num_proposals;
+    float* scores = workspace.scores + static_cast<size_t>(batch) * num_proposals;
+    unsigned* order = workspace.order + static_cast<size_t>(batch) * num_proposals;
+    const T* batch_probs = class_probs + static_cast<size_t>(batch) * 2 * num_proposals;
+    const T* batch_deltas = bbox_deltas + static_cast<size_t>(batch) * 4 * num_proposals;
+
+    const float image_height = static_cast<float>(image_shape[0]);
+    const float image_width = static_cast<float>(image_shape[1]);
+    const float scale_height = static_cast<float>(image_shape[2]);
+    const float scale_width = args.image_shape_size == 4 ? static_cast<float>(image_shape[3]) : scale_height;
+    const float min_box_width = args.min_size * scale_width;
+    const float min_box_height = args.min_size * scale_height;
+
+    // Proposals are enumerated by locations and then by anchors
+    for (unsigned i = threadIdx.x; i < num_proposals; i += blockDim.x) {
+        const unsigned anchor = i % args.num_anchors;
+        const unsigned location = i / args.num_anchors;
+        const float shift_x = (location % args.width) * args.feat_stride;
+        const float shift_y = (location / args.width) * args.feat_stride;
+        const float* anchor_box = anchors + anchor * 4;
+        const float x0 = anchor_box[0] + shift_x;
+        const float y0 = anchor_box[1] + shift_y;
+        const float x1 = anchor_box[2] + shift_x;
+        const float y1 = anchor_box[3] + shift_y;
+
+        const T* deltas = batch_deltas + anchor * 4 * spatial_size + location;
+        const float dx = static_cast<float>(deltas[0]) / args.box_coordinate_scale;
+        const float dy = static_cast<float>(deltas[spatial_size]) / args.box_coordinate_scale;
+        const float dw = static_cast<float>(deltas[2 * spatial_size]) / args.box_size_scale;
+        const float dh = static_cast<float>(deltas[3 * spatial_size]) / args.box_size_scale;
+
+        const float width = x1 - x0 + coordinates_offset;
+        const float height = y1 - y0 + coordinates_offset;
+        const float center_x = x0 + 0.5f * width + dx * width;
+        const float center_y = y0 + 0.5f * height + dy * height;
+        const float pred_width = expf(dw) * width;
+        const float pred_height = expf(dh) * height;
+        Box box{center_x - 0.5f * pred_width,
+                center_y - 0.5f * pred_height,
+                center_x + 0.5f * pred_width,
+                center_y + 0.5f * pred_height};
+        if (args.clip_before_nms) {
+            box.x0 = fmaxf(0.0f, fminf(box.x0, image_width - coordinates_offset));
+            box.y0 = fmaxf(0.0f, fminf(box.y0, image_height - coordinates_offset));
+            box.x1 = fmaxf(0.0f, fminf(box.x1, image_width - coordinates_offset));
+            box.y1 = fmaxf(0.0f, fminf(box.y1, image_height - coordinates_offset));
+        }
+        const bool large_enough = box.x1 - box.x0 + coordinates_offset >= min_box_width &&
+                                  box.y1 - box.y0 + coordinates_offset >= min_box_height;
+        boxes[i] = box;
+        scores[i] = large_enough ? static_cast<float>(batch_probs[(args.num_anchors + anchor) * spatial_size + location])
+                                 : 0.0f;
+        order[i] = i;
+    }
+    __syncthreads();
+
+    nms::block_sort(order, num_proposals, [scores](const unsigned a, const unsigned b) {
+        return scores[a] > scores[b] || (scores[a] == scores[b] && a < b);
+    });
+    T* batch_rois = rois + static_cast<size_t>(batch) * args.post_nms_topn * 5;
+    T* batch_scores = probs ? probs + static_cast<size_t>(batch) * args.post_nms_topn : nullptr;
+    const unsigned num_kept = nms::block_greedy_nms(
+        min(num_proposals, args.pre_nms_topn),
+        args.post_nms_topn,
+        workspace.suppressed + static_cast<size_t>(batch) * nms::bitmask_words(args.pre_nms_topn),
+        [&args, boxes, order](const unsigned i, const unsigned j) {
+            return intersection_over_union(boxes[order[i]], boxes[order[j]]) > args.nms_thresh;
+        },
+        [&](const unsigned i, const unsigned n) {
+            Box box = boxes[order[i]];
+            if (args.clip_after_nms) {
+                box.x0 = fmaxf(0.0f, fminf(box.x0, image_width));
+                box.y0 = fmaxf(0.0f, fminf(box.y0, image_height));
+                box.x1 = fmaxf(0.0f, fminf(box.x1, image_width));
+                box.y1 = fmaxf(0.0f, fminf(box.y1, image_height));
+            }
+            if (args.normalize) {
+                box.x0 /= image_width;
+                box.y0 /= image_height;
+                box.x1 /= image_width;
+                box.y1 /= image_height;
+            }
+            T* roi = batch_rois + n * 5;
+            roi[0] = static_cast<T>(static_cast<float>(batch));
+            roi[1] = static_cast<T>(box.x0);
+            roi[2] = static_cast<T>(box.y0);
+            roi[3] = static_cast<T>(box.x1);
+            roi[4] = static_cast<T>(box.y1);
+            if (batch_scores) {
+                batch_scores[n] = static_cast<T>(scores[order[i]]);
+            }
+        });
+
+    for (unsigned n = num_kept + threadIdx.x; n < args.post_nms_topn; n += blockDim.x) {
+        T* roi = batch_rois + n * 5;
+        roi[0] = static_cast<T>(n == num_kept ? -1.0f : 0.0f);
+        roi[1] = roi[2] = roi[3] = roi[4] = static_cast<T>(0.0f);
+        if (batch_scores) {
+            batch_scores[n] = static_cast<T>(0.0f);
+        }
+    }
+}
+
+}  // namespace
+
+Proposal::Proposal(const Params& params, const size_t max_threads_per_block)
+    : params_{params},
+      num_anchors_{params.ratio.size() * params.scale.size()},
+      block_size_{static_cast<unsigned>(std::min<size_t>(max_threads_per_block, max_block_size))} {
+    switch (params_.element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+            break;
+        default:
+            throw_ov_exception(
+                fmt::format("Element type = {} is not supported by Proposal operation !!", params_.element_type));
+    }
+}
+
+std::vector<float> Proposal::anchors() const {
+    std::vector<float> anchors;
+    anchors.reserve(num_anchors_ * 4);
+    const float base_area = static_cast<float>(params_.base_size * params_.base_size);
+    const float center = 0.5f * (params_.base_size - coordinates_offset);
+    for (const float ratio : params_.ratio) {
+        const float ratio_width = std::round(std::sqrt(base_area / ratio));
+        const float ratio_height = std::round(ratio_width * ratio);
+        for (const float scale : params_.scale) {
+            const float half_width = 0.5f * (ratio_width * scale - coordinates_offset);
+            const float half_height = 0.5f * (ratio_height * scale - coordinates_offset);
+            anchors.insert(anchors.end(),
+                           {center - half_width, center - half_height, center + half_width, center + half_height});
+        }
+    }
+    return anchors;
+}
+
+size_t Proposal::anchorsSize() const { return num_anchors_ * 4 * sizeof(float); }
+
+size_t Proposal::workspaceSize() const {
+    const size_t num_proposals = params_.num_batches * num_anchors_ * params_.height * params_.width;
+    return num_proposals * (sizeof(Box) + sizeof(float) + sizeof(unsigned)) +
+           params_.num_batches * nms::bitmask_words(params_.pre_nms_topn) * sizeof(unsigned);
+}
+
+void Proposal::operator()(const cudaStream_t stream,
+                          const void* class_probs,
+                          const void* bbox_deltas,
+                          const void* image_shape,
+                          const void* anchors,
+                          void* rois,
+                          void* probs,
+                          void* workspace) const {
+    switch (params_.element_type) {
+        case Type_t::f16:
+            return call<__half>(stream, class_probs, bbox_deltas, image_shape, anchors, rois, probs, workspace);
+        default:
+            return call<float>(stream, class_probs, bbox_deltas, image_shape, anchors, rois, probs, workspace);
+    }
+}
+
+template <typename T>
+void Proposal::call(const cudaStream_t stream,
+                    const void* class_probs,
+                    const void* bbox_deltas,
+                    const void* image_shape,
+                    const void* anchors,
+                    void* rois,
+                    void* probs,
+                    void* workspace) const {
+    const Args args{static_cast<unsigned>(num_anchors_),
+                    static_cast<unsigned>(params_.height),
+                    static_cast<unsigned>(params_.width),
+                    static_cast<unsigned>(params_.image_shape_size),
+                    static_cast<unsigned>(params_.pre_nms_topn),
+                    static_cast<unsigned>(params_.post_nms_topn),
+                    params_.nms_thresh,
+                    static_cast<float>(params_.feat_stride),
+                    static_cast<float>(params_.min_size),
+                    params_.clip_before_nms,
+                    params_.clip_after_nms,
+                    params_.normalize,
+                    params_.box_size_scale,
+                    params_.box_coordinate_scale};
+    if (params_.num_batches == 0) {
+        return;
+    }
+    const size_t num_proposals = params_.num_batches * num_anchors_ * params_.height * params_.width;
+    Workspace layout{};
+    layout.boxes = static_cast<Box*>(workspace);
+    layout.scores = reinterpret_cast<float*>(layout.boxes + num_proposals);
+    layout.order = reinterpret_cast<unsigned*>(layout.scores + num_proposals);
+    layout.suppressed = layout.order + num_proposals;
+    proposal<T><<<params_.num_batches, block_size_, 0, stream>>>(args,
+                                                                  static_cast<const T*>(class_probs),
+                                                                  static_cast<const T*>(bbox_deltas),
+                                                                  static_cast<const T*>(image_shape),
+                                                                  static_cast<const float*>(anchors),
+                                                                  static_cast<T*>(rois),
+                                                                  static_cast<T*>(probs),
+                                                                  layout);
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
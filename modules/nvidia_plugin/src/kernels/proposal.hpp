@@ -0,0 +1,89 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <vector>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Proposal-1/4 of the Caffe framework computed by a block per image: proposals of all anchors are decoded, sorted
+ * by descending scores and the best pre_nms_topn of them are greedily suppressed by the batched NMS engine shared with
+ * DetectionOutput
+ */
+class Proposal {
+public:
+    struct Params {
+        Type_t element_type;
+        size_t num_batches;
+        size_t height;
+        size_t width;
+        // Size of the image_shape input, 3 or 4
+        size_t image_shape_size;
+        size_t base_size;
+        size_t pre_nms_topn;
+        size_t post_nms_topn;
+        float nms_thresh;
+        size_t feat_stride;
+        size_t min_size;
+        std::vector<float> ratio;
+        std::vector<float> scale;
+        bool clip_before_nms;
+        bool clip_after_nms;
+        bool normalize;
+        float box_size_scale;
+        float box_coordinate_scale;
+    };
+
+    Proposal(const Params& params, size_t max_threads_per_block);
+
+    /**
+     * @returns Anchors [num_anchors, 4] (x0, y0, x1, y1) for the immutable work buffer of anchorsSize() bytes
+     */
+    std::vector<float> anchors() const;
+    size_t anchorsSize() const;
+    size_t workspaceSize() const;
+
+    /**
+     * @param class_probs [num_batches, 2 * num_anchors, height, width]
+     * @param bbox_deltas [num_batches, 4 * num_anchors, height, width]
+     * @param rois [num_batches * post_nms_topn, 5], rows of (batch, x0, y0, x1, y1), the row after the last proposal
+     *        of an image has the batch -1 and the rest are 0
+     * @param probs [num_batches * post_nms_topn] or nullptr
+     */
+    void operator()(cudaStream_t stream,
+                    const void* class_probs,
+                    const void* bbox_deltas,
+                    const void* image_shape,
+                    const void* anchors,
+                    void* rois,
+                    void* probs,
+                    void* workspace) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream,
+              const void* class_probs,
+              const void* bbox_deltas,
+              const void* image_shape,
+              const void* anchors,
+              void* rois,
+              void* probs,
+              void* workspace) const;
+
+    Params params_;
+    size_t num_anchors_;
+    unsigned block_size_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
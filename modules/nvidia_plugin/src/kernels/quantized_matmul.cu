@@ -0,0 +1,114 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+#include "quantized_matmul.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Rounds values the same way as FakeQuantize and shifts the levels by the zero point into the range of i8
+ */
+template <typename T>
+static __global__ void quantize_activations(size_t size,
+                                            float input_low,
+                                            float input_high,
+                                            float levels_scale,
+                                            float zero_point,
+                                            const T* a,
+                                            int8_t* out) {
+    const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= size) {
+        return;
+    }
+    const float x = fminf(fmaxf(static_cast<float>(a[idx]), input_low), input_high);
+    out[idx] = static_cast<int8_t>(__float2int_rn((x - input_low) * levels_scale) - static_cast<int>(zero_point));
+}
+
+template <typename T>
+static __global__ void dequantize_products(
+    size_t size, size_t n, const int32_t* acc, const T* scales, const T* bias, T* out) {
+    const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= size) {
+        return;
+    }
+    const float b = bias ? static_cast<float>(bias[idx]) : 0.0f;
+    out[idx] = static_cast<T>(static_cast<float>(acc[idx]) * static_cast<float>(scales[idx % n]) + b);
+}
+
+QuantizedMatMul::QuantizedMatMul(Type_t element_type,
+                                 size_t rows,
+                                 size_t k,
+                                 size_t n,
+                                 float input_low,
+                                 float input_high,
+                                 size_t levels,
+                                 size_t max_threads_per_block)
+    : element_type_{element_type},
+      rows_{rows},
+      k_{k},
+      n_{n},
+      input_low_{input_low},
+      input_high_{input_high},
+      levels_scale_{static_cast<float>(levels - 1) / (input_high - input_low)},
+      zero_point_{static_cast<float>(levels / 2)},
+      max_threads_per_block_{max_threads_per_block} {
+    if (element_type_ != Type_t::f32 && element_type_ != Type_t::f16) {
+        throw_ov_exception(
+            fmt::format("Element type = {} is not supported by QuantizedMatMul operation !!", element_type_));
+    }
+    if (levels != 255 && levels != 256) {
+        throw_ov_exception(fmt::format("Levels = {} are not supported by QuantizedMatMul operation !!", levels));
+    }
+}
+
+void QuantizedMatMul::quantize(cudaStream_t stream, const void* a, void* out) const {
+    if (element_type_ == Type_t::f16) {
+        return callQuantize<__half>(stream, a, out);
+    }
+    return callQuantize<float>(stream, a, out);
+}
+
+void QuantizedMatMul::dequantize(
+    cudaStream_t stream, const void* acc, const void* scales, const void* bias, void* out) const {
+    if (element_type_ == Type_t::f16) {
+        return callDequantize<__half>(stream, acc, scales, bias, out);
+    }
+    return callDequantize<float>(stream, acc, scales, bias, out);
+}
+
+template <typename T>
+void QuantizedMatMul::callQuantize(cudaStream_t stream, const void* a, void* out) const {
+    const auto [num_blocks, threads_per_block] = calculateElementwiseGrid(rows_ * k_, max_threads_per_block_);
+    quantize_activations<T><<<num_blocks, threads_per_block, 0, stream>>>(rows_ * k_,
+                                                                          input_low_,
+                                                                          input_high_,
+                                                                          levels_scale_,
+                                                                          zero_point_,
+                                                                          static_cast<const T*>(a),
+                                                                          static_cast<int8_t*>(out));
+}
+
+template <typename T>
+void QuantizedMatMul::callDequantize(
+    cudaStream_t stream, const void* acc, const void* scales, const void* bias, void* out) const {
+    const auto [num_blocks, threads_per_block] = calculateElementwiseGrid(rows_ * n_, max_threads_per_block_);
+    dequantize_products<T><<<num_blocks, threads_per_block, 0, stream>>>(rows_ * n_,
+                                                                         n_,
+                                                                         static_cast<const int32_t*>(acc),
+                                                                         static_cast<const T*>(scales),
+                                                                         static_cast<const T*>(bias),
+                                                                         static_cast<T*>(out));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
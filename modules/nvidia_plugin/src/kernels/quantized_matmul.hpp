@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Quantizes activations [rows, k] to i8 before their multiplication by i8 weights [n, k] with i32 accumulation
+ * and dequantizes the accumulated products afterwards
+ */
+class QuantizedMatMul {
+public:
+    QuantizedMatMul(Type_t element_type,
+                    size_t rows,
+                    size_t k,
+                    size_t n,
+                    float input_low,
+                    float input_high,
+                    size_t levels,
+                    size_t max_threads_per_block);
+    QuantizedMatMul(QuantizedMatMul&&) = default;
+    QuantizedMatMul& operator=(QuantizedMatMul&&) = default;
+
+    /**
+     * Writes activations a [rows, k] of the element type quantized to i8 like FakeQuantize does to out
+     */
+    void quantize(cudaStream_t stream, const void* a, void* out) const;
+
+    /**
+     * Computes out[rows, n] = acc[rows, n] * scales[n] (+ bias[rows, n]) from i32 accumulated products
+     */
+    void dequantize(cudaStream_t stream, const void* acc, const void* scales, const void* bias, void* out) const;
+
+private:
+    template <typename T>
+    void callQuantize(cudaStream_t stream, const void* a, void* out) const;
+
+    template <typename T>
+    void callDequantize(cudaStream_t stream, const void* acc, const void* scales, const void* bias, void* out) const;
+
+    Type_t element_type_{};
+    size_t rows_{};
+    size_t k_{};
+    size_t n_{};
+    float input_low_{};
+    float input_high_{};
+    float levels_scale_{};
+    float zero_point_{};
+    size_t max_threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+#include "read_value.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename T>
+static __global__ void read_value(
+    const bool* initialized, const T* init, const T* state, T* dst, const size_t size) {
+    const T* src = *initialized ? state : init;
+    if (src == dst) {
+        return;
+    }
+    const size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        dst[i] = src[i];
+    }
+}
+
+ReadValue::ReadValue(const size_t size, const size_t max_threads_per_block)
+    : size_{size}, max_threads_per_block_{max_threads_per_block} {}
+
+void ReadValue::operator()(const cudaStream_t stream,
+                           const bool* initialized,
+                           const void* init,
+                           const void* state,
+                           void* dst) const {
+    const auto isWordAligned = [](const void* ptr) { return reinterpret_cast<uintptr_t>(ptr) % sizeof(uint32_t) == 0; };
+    if (size_ % sizeof(uint32_t) == 0 && isWordAligned(init) && isWordAligned(state) && isWordAligned(dst)) {
+        call<uint32_t>(stream, initialized, init, state, dst);
+    } else {
+        call<uint8_t>(stream, initialized, init, state, dst);
+    }
+}
+
+template <typename T>
+void ReadValue::call(const cudaStream_t stream,
+                     const bool* initialized,
+                     const void* init,
+                     const void* state,
+                     void* dst) const {
+    const size_t size = size_ / sizeof(T);
+    const auto [num_blocks, threads_per_block] = calculateElementwiseGrid(size, max_threads_per_block_);
+    read_value<T><<<num_blocks, threads_per_block, 0, stream>>>(
+        initialized, static_cast<const T*>(init), static_cast<const T*>(state), static_cast<T*>(dst), size);
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
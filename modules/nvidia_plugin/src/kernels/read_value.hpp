@@ -0,0 +1,43 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Reads state of a variable which has an initializer: the initial value is taken while the state isn't initialized.
+ * The choice is made on the device by the flag of the state, so the kernel can be captured into a CUDA graph
+ * regardless of the state being reset between inferences.
+ */
+class ReadValue {
+public:
+    /**
+     * @param size Size of the state in bytes
+     */
+    ReadValue(size_t size, size_t max_threads_per_block);
+
+    /**
+     * Copies init into dst if *initialized is false, otherwise copies state into dst unless they are the same memory
+     */
+    void operator()(
+        cudaStream_t stream, const bool* initialized, const void* init, const void* state, void* dst) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const bool* initialized, const void* init, const void* state, void* dst) const;
+
+    size_t size_{};
+    size_t max_threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,298 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "reduce.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned warps_per_block = 4;
+constexpr unsigned row_block_size = 256;
+constexpr unsigned column_block_size = 256;
+
+template <Reduce::Op O>
+struct Reduction {
+    __device__ __forceinline__ static float identity() {
+        if constexpr (O == Reduce::Op::Max) {
+            return -INFINITY;
+        } else if constexpr (O == Reduce::Op::Min) {
+            return INFINITY;
+        } else if constexpr (O == Reduce::Op::Prod) {
+            return 1.0f;
+        } else {
+            return 0.0f;
+        }
+    }
+
+    __device__ __forceinline__ static float pre(float value) {
+        if constexpr (O == Reduce::Op::L1) {
+            return fabsf(value);
+        } else if constexpr (O == Reduce::Op::L2) {
+            return value * value;
+        } else {
+            return value;
+        }
+    }
+
+    /**
+     * NaN values are propagated by Max and Min like by the other reductions
+     */
+    __device__ __forceinline__ static float combine(float a, float b) {
+        if constexpr (O == Reduce::Op::Max) {
+            return (a > b || isnan(a)) ? a : b;
+        } else if constexpr (O == Reduce::Op::Min) {
+            return (a < b || isnan(a)) ? a : b;
+        } else if constexpr (O == Reduce::Op::Prod) {
+            return a * b;
+        } else {
+            return a + b;
+        }
+    }
+
+    __device__ __forceinline__ static float post(float value, size_t length) {
+        if constexpr (O == Reduce::Op::Mean) {
+            return value / static_cast<float>(length);
+        } else if constexpr (O == Reduce::Op::L2) {
+            return sqrtf(value);
+        } else {
+            return value;
+        }
+    }
+};
+
+template <Reduce::Op O>
+__device__ __forceinline__ float warp_reduce(float value) {
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        value = Reduction<O>::combine(value, __shfl_xor_sync(0xFFFFFFFF, value, offset));
+    }
+    return value;
+}
+
+/**
+ * Reduces values of all threads of the block, the result is returned to every thread
+ */
+template <Reduce::Op O>
+__device__ __forceinline__ float block_reduce(float value) {
+    constexpr unsigned num_warps = row_block_size / warp_size;
+    __shared__ float values[num_warps];
+    const unsigned warp = threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    value = warp_reduce<O>(value);
+    if (lane == 0) {
+        values[warp] = value;
+    }
+    __syncthreads();
+    return warp_reduce<O>(lane < num_warps ? values[lane] : Reduction<O>::identity());
+}
+
+/**
+ * Final kernels store the results, the other ones store FP32 partial results of chunks of rows
+ */
+template <typename T, Reduce::Op O, bool Final>
+__device__ __forceinline__ void store(void* y, size_t index, float value, size_t length) {
+    if constexpr (Final) {
+        static_cast<T*>(y)[index] = static_cast<T>(Reduction<O>::post(value, length));
+    } else {
+        static_cast<float*>(y)[index] = value;
+    }
+}
+
+}  // namespace
+
+template <typename T, Reduce::Op O>
+static __global__ void warp_reduce_rows(size_t rows, size_t length, const T* x, T* y) {
+    const size_t row = static_cast<size_t>(blockIdx.x) * warps_per_block + threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (row >= rows) {
+        return;
+    }
+    const T* x_row = x + row * length;
+
+    float value = Reduction<O>::identity();
+    for (size_t i = lane; i < length; i += warp_size) {
+        value = Reduction<O>::combine(value, Reduction<O>::pre(static_cast<float>(x_row[i])));
+    }
+    value = warp_reduce<O>(value);
+    if (lane == 0) {
+        store<T, O, true>(y, row, value, length);
+    }
+}
+
+/**
+ * Each block reduces one of split chunks of a row
+ */
+template <typename T, Reduce::Op O, bool Final>
+static __global__ void block_reduce_rows(size_t length, size_t split, const T* x, void* y) {
+    const size_t row = blockIdx.x / split;
+    const size_t chunk = blockIdx.x % split;
+    const size_t chunk_length = (length + split - 1) / split;
+    const size_t begin = chunk * chunk_length;
+    const size_t end = min(length, begin + chunk_length);
+    const T* x_row = x + row * length;
+
+    float value = Reduction<O>::identity();
+    for (size_t i = begin + threadIdx.x; i < end; i += row_block_size) {
+        value = Reduction<O>::combine(value, Reduction<O>::pre(static_cast<float>(x_row[i])));
+    }
+    value = block_reduce<O>(value);
+    if (threadIdx.x == 0) {
+        store<T, O, Final>(y, blockIdx.x, value, length);
+    }
+}
+
+/**
+ * Each thread reduces one of split chunks of a strided row, chunks are indexed by blockIdx.y
+ */
+template <typename T, Reduce::Op O, bool Final>
+static __global__ void column_reduce(size_t columns, size_t length, size_t inner, size_t split, const T* x, void* y) {
+    const size_t column = static_cast<size_t>(blockIdx.x) * column_block_size + threadIdx.x;
+    if (column >= columns) {
+        return;
+    }
+    const size_t chunk = blockIdx.y;
+    const size_t chunk_length = (length + split - 1) / split;
+    const size_t begin = chunk * chunk_length;
+    const size_t end = min(length, begin + chunk_length);
+    const T* x_column = x + column / inner * length * inner + column % inner;
+
+    float value = Reduction<O>::identity();
+    for (size_t i = begin; i < end; ++i) {
+        value = Reduction<O>::combine(value, Reduction<O>::pre(static_cast<float>(x_column[i * inner])));
+    }
+    store<T, O, Final>(y, column * split + chunk, value, length);
+}
+
+/**
+ * Reduces split partial results of each row by one warp
+ */
+template <typename T, Reduce::Op O>
+static __global__ void reduce_partials(size_t rows, size_t split, size_t length, const float* partials, T* y) {
+    const size_t row = static_cast<size_t>(blockIdx.x) * warps_per_block + threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (row >= rows) {
+        return;
+    }
+    float value = Reduction<O>::identity();
+    for (size_t i = lane; i < split; i += warp_size) {
+        value = Reduction<O>::combine(value, partials[row * split + i]);
+    }
+    value = warp_reduce<O>(value);
+    if (lane == 0) {
+        store<T, O, true>(y, row, value, length);
+    }
+}
+
+Reduce::Reduce(Type_t element_type, Op op, size_t outer, size_t length, size_t inner, size_t num_multiprocessors)
+    : element_type_{element_type}, op_{op}, outer_{outer}, length_{length}, inner_{inner} {
+    if (!isTypeSupported(element_type_)) {
+        throw_ov_exception(fmt::format("Element type = {} is not supported by Reduce operation !!", element_type_));
+    }
+    size_t num_blocks = 0;
+    if (inner_ > 1) {
+        num_blocks = (outer_ * inner_ + column_block_size - 1) / column_block_size;
+    } else if (length_ <= max_warp_length) {
+        num_blocks = (outer_ + warps_per_block - 1) / warps_per_block;
+    } else {
+        num_blocks = outer_;
+    }
+    // Two blocks per multiprocessor are enough to hide the latency of the memory bound reductions
+    const size_t target_num_blocks = 2 * num_multiprocessors;
+    if (num_blocks > 0 && num_blocks < target_num_blocks && length_ >= 2 * min_split_chunk) {
+        split_ = std::min(length_ / min_split_chunk, (target_num_blocks + num_blocks - 1) / num_blocks);
+    }
+}
+
+bool Reduce::isTypeSupported(Type_t element_type) {
+    switch (element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+size_t Reduce::workspaceSize() const { return split_ > 1 ? outer_ * inner_ * split_ * sizeof(float) : 0; }
+
+void Reduce::operator()(cudaStream_t stream, const void* x, void* y, void* workspace) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, x, y, workspace);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, x, y, workspace);
+#endif
+        default:
+            return call<float>(stream, x, y, workspace);
+    }
+}
+
+template <typename T>
+void Reduce::call(cudaStream_t stream, const void* x, void* y, void* workspace) const {
+    switch (op_) {
+        case Op::Sum:
+            return launch<T, Op::Sum>(stream, x, y, workspace);
+        case Op::Mean:
+            return launch<T, Op::Mean>(stream, x, y, workspace);
+        case Op::Max:
+            return launch<T, Op::Max>(stream, x, y, workspace);
+        case Op::Min:
+            return launch<T, Op::Min>(stream, x, y, workspace);
+        case Op::Prod:
+            return launch<T, Op::Prod>(stream, x, y, workspace);
+        case Op::L1:
+            return launch<T, Op::L1>(stream, x, y, workspace);
+        case Op::L2:
+            return launch<T, Op::L2>(stream, x, y, workspace);
+    }
+}
+
+template <typename T, Reduce::Op O>
+void Reduce::launch(cudaStream_t stream, const void* x, void* y, void* workspace) const {
+    const auto* input = static_cast<const T*>(x);
+    auto* output = static_cast<T*>(y);
+    constexpr unsigned warp_block_size = warps_per_block * warp_size;
+    const size_t rows = outer_ * inner_;
+    if (inner_ > 1) {
+        const dim3 grid(static_cast<unsigned>((rows + column_block_size - 1) / column_block_size),
+                        static_cast<unsigned>(split_));
+        if (split_ == 1) {
+            column_reduce<T, O, true><<<grid, column_block_size, 0, stream>>>(rows, length_, inner_, 1, input, output);
+        } else {
+            column_reduce<T, O, false>
+                <<<grid, column_block_size, 0, stream>>>(rows, length_, inner_, split_, input, workspace);
+        }
+    } else if (split_ > 1) {
+        block_reduce_rows<T, O, false>
+            <<<outer_ * split_, row_block_size, 0, stream>>>(length_, split_, input, workspace);
+    } else if (length_ <= max_warp_length) {
+        const unsigned num_blocks = (outer_ + warps_per_block - 1) / warps_per_block;
+        warp_reduce_rows<T, O><<<num_blocks, warp_block_size, 0, stream>>>(outer_, length_, input, output);
+    } else {
+        block_reduce_rows<T, O, true><<<outer_, row_block_size, 0, stream>>>(length_, 1, input, output);
+    }
+    if (split_ > 1) {
+        const unsigned num_blocks = (rows + warps_per_block - 1) / warps_per_block;
+        reduce_partials<T, O><<<num_blocks, warp_block_size, 0, stream>>>(
+            rows, split_, length_, static_cast<const float*>(workspace), output);
+    }
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Reduces a tensor viewed as [outer, length, inner] along its length dimension, accumulating in FP32.
+ * L1 and L2 apply |x| and x^2 to every value before it's accumulated, Mean and L2 apply the scale and the square
+ * root to the result. A strategy is picked per shape:
+ *  - contiguous rows (inner == 1) of up to max_warp_length values are reduced by one warp each,
+ *    longer rows by one block each;
+ *  - strided rows (inner > 1) are reduced by one thread each, so that neighbouring threads read neighbouring values;
+ *  - when the above would not fill the device, long rows are split into chunks, which are reduced by separate blocks
+ *    into FP32 partial results in the workspace, and the partial results are reduced by a second kernel.
+ */
+class Reduce {
+public:
+    enum class Op { Sum, Mean, Max, Min, Prod, L1, L2 };
+
+    static constexpr size_t max_warp_length = 1024;
+    static constexpr size_t min_split_chunk = 2048;
+
+    Reduce(Type_t element_type, Op op, size_t outer, size_t length, size_t inner, size_t num_multiprocessors);
+    Reduce(Reduce&&) = default;
+    Reduce& operator=(Reduce&&) = default;
+
+    void operator()(cudaStream_t stream, const void* x, void* y, void* workspace) const;
+
+    /**
+     * @returns Size of the workspace for partial results of split rows, 0 if rows aren't split
+     */
+    size_t workspaceSize() const;
+
+    /**
+     * @returns true if the kernel supports the element type
+     */
+    static bool isTypeSupported(Type_t element_type);
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* x, void* y, void* workspace) const;
+
+    template <typename T, Op O>
+    void launch(cudaStream_t stream, const void* x, void* y, void* workspace) const;
+
+    Type_t element_type_{};
+    Op op_{};
+    size_t outer_{};
+    size_t length_{};
+    size_t inner_{};
+    size_t split_{1};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,343 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cooperative_groups.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+
+#include "convert.cuh"
+#include "details/error.hpp"
+#include "rnn_sequence_persistent.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned max_block_size = 256;
+// Shared memory which is available to a block without opt-in
+constexpr size_t max_shared_memory_size = 48 * 1024;
+// Accumulated pre-activations per unit and batch item: 4 gates of LSTM or z, r and the input and hidden parts of h
+constexpr unsigned num_accumulators = 4;
+
+constexpr unsigned numGates(RNNSequencePersistent::Cell cell) {
+    return cell == RNNSequencePersistent::Cell::LSTM ? 4 : 3;
+}
+
+size_t sharedMemorySize(const RNNSequencePersistent::Params& params, size_t element_size, size_t units) {
+    const size_t floats = params.batch_size * params.hidden_size + (num_accumulators + 1) * units * params.batch_size;
+    return floats * sizeof(float) + numGates(params.cell) * units * params.hidden_size * element_size;
+}
+
+__device__ __forceinline__ float warp_sum(float value) {
+#pragma unroll
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        value += __shfl_down_sync(0xFFFFFFFF, value, offset);
+    }
+    return value;
+}
+
+__device__ __forceinline__ float sigmoid(float x) { return 1.0f / (1.0f + __expf(-x)); }
+
+__device__ __forceinline__ float clip(float x, float limit) {
+    return limit > 0.0f ? fminf(fmaxf(x, -limit), limit) : x;
+}
+
+}  // namespace
+
+/**
+ * Blocks of a direction follow each other, each block computes units_per_block hidden units of all batch items.
+ * Shared memory of a block holds:
+ *  - hidden states of the previous step of all units, [batch, hidden];
+ *  - accumulated pre-activations of its units, [num_accumulators, units, batch];
+ *  - cell states of its units, [units, batch];
+ *  - rows of the recurrent weights of its units, [gates, units, hidden].
+ */
+template <typename T, RNNSequencePersistent::Cell C>
+static __global__ void rnn_sequence_persistent(RNNSequencePersistent::Params p,
+                                               unsigned units_per_block,
+                                               unsigned blocks_per_direction,
+                                               const T* x,
+                                               const T* hx,
+                                               const T* cx,
+                                               const T* w,
+                                               const T* r,
+                                               const T* b,
+                                               T* y,
+                                               T* hy,
+                                               T* cy,
+                                               float* exchange) {
+    constexpr unsigned gates = numGates(C);
+    extern __shared__ float shared[];
+    const size_t batch_size = p.batch_size;
+    const size_t hidden_size = p.hidden_size;
+    const size_t input_size = p.input_size;
+    const unsigned direction = blockIdx.x / blocks_per_direction;
+    const size_t unit0 = static_cast<size_t>(blockIdx.x % blocks_per_direction) * units_per_block;
+    const unsigned units = static_cast<unsigned>(min(static_cast<size_t>(units_per_block), hidden_size - unit0));
+
+    float* h_prev = shared;
+    float* acc = h_prev + batch_size * hidden_size;
+    float* state = acc + num_accumulators * units_per_block * batch_size;
+    T* r_rows = reinterpret_cast<T*>(state + units_per_block * batch_size);
+
+    const T* w_dir = w + direction * gates * hidden_size * input_size;
+    const T* r_dir = r + direction * gates * hidden_size * hidden_size;
+    // Bias of GRU with linear_before_reset has the fourth part, the bias of the hidden part of h, like LSTM has 4 gates
+    const T* b_dir = b + direction * num_accumulators * hidden_size;
+
+    for (size_t i = threadIdx.x; i < gates * units * hidden_size; i += blockDim.x) {
+        const size_t gate = i / (units * hidden_size);
+        const size_t unit = i / hidden_size % units;
+        const size_t k = i % hidden_size;
+        r_rows[i] = r_dir[(gate * hidden_size + unit0 + unit) * hidden_size + k];
+    }
+    if constexpr (C == RNNSequencePersistent::Cell::LSTM) {
+        for (size_t i = threadIdx.x; i < units * batch_size; i += blockDim.x) {
+            const size_t unit = i / batch_size;
+            const size_t batch = i % batch_size;
+            state[i] = cast<float>(cx[batch * p.cx.batch + direction * p.cx.direction + unit0 + unit]);
+        }
+    }
+
+    const bool reverse = p.reverse || direction == 1;
+    const unsigned warp = threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    const unsigned num_warps = blockDim.x / warp_size;
+    auto grid = cooperative_groups::this_grid();
+    for (size_t step = 0; step < p.seq_length; ++step) {
+        const size_t t = reverse ? p.seq_length - 1 - step : step;
+        // Hidden states of even and odd steps alternate between two halves of the exchange buffer
+        const size_t state_size = batch_size * hidden_size;
+        const float* exchange_prev = exchange + ((step + 1) % 2 * p.num_directions + direction) * state_size;
+        float* exchange_next = exchange + (step % 2 * p.num_directions + direction) * state_size;
+        for (size_t i = threadIdx.x; i < batch_size * hidden_size; i += blockDim.x) {
+            const size_t batch = i / hidden_size;
+            const size_t k = i % hidden_size;
+            h_prev[i] =
+                step == 0 ? cast<float>(hx[batch * p.hx.batch + direction * p.hx.direction + k]) : exchange_prev[i];
+        }
+        __syncthreads();
+
+        // Each warp computes dot products of a gate row of a unit with the input and the hidden state of a batch item
+        for (size_t item = warp; item < gates * units * batch_size; item += num_warps) {
+            const size_t gate = item / (units * batch_size);
+            const size_t unit = item / batch_size % units;
+            const size_t batch = item % batch_size;
+            const size_t row = gate * hidden_size + unit0 + unit;
+            const T* x_t = x + batch * p.x.batch + t * p.x.time;
+            float sum_x = 0.0f;
+            for (size_t k = lane; k < input_size; k += warp_size) {
+                sum_x += cast<float>(w_dir[row * input_size + k]) * cast<float>(x_t[k]);
+            }
+            const T* r_row = r_rows + (gate * units + unit) * hidden_size;
+            const float* h_batch = h_prev + batch * hidden_size;
+            float sum_h = 0.0f;
+            for (size_t k = lane; k < hidden_size; k += warp_size) {
+                sum_h += cast<float>(r_row[k]) * h_batch[k];
+            }
+            sum_x = warp_sum(sum_x);
+            sum_h = warp_sum(sum_h);
+            if (lane == 0) {
+                const size_t offset = unit * batch_size + batch;
+                const float bias = cast<float>(b_dir[row]);
+                if (C == RNNSequencePersistent::Cell::GRU && gate == 2) {
+                    acc[2 * units_per_block * batch_size + offset] = sum_x + bias;
+                    acc[3 * units_per_block * batch_size + offset] =
+                        sum_h + cast<float>(b_dir[3 * hidden_size + unit0 + unit]);
+                } else {
+                    acc[gate * units_per_block * batch_size + offset] = sum_x + sum_h + bias;
+                }
+            }
+        }
+        __syncthreads();
+
+        for (size_t i = threadIdx.x; i < units * batch_size; i += blockDim.x) {
+            const size_t unit = i / batch_size;
+            const size_t batch = i % batch_size;
+            const size_t j = unit0 + unit;
+            const size_t gate_stride = units_per_block * batch_size;
+            float h;
+            if constexpr (C == RNNSequencePersistent::Cell::LSTM) {
+                const float f = sigmoid(clip(acc[i], p.clip));
+                const float in = sigmoid(clip(acc[gate_stride + i], p.clip));
+                const float c = tanhf(clip(acc[2 * gate_stride + i], p.clip));
+                const float o = sigmoid(clip(acc[3 * gate_stride + i], p.clip));
+                state[i] = f * state[i] + in * c;
+                h = o * tanhf(state[i]);
+            } else {
+                const float z = sigmoid(clip(acc[i], p.clip));
+                const float reset = sigmoid(clip(acc[gate_stride + i], p.clip));
+                const float candidate =
+                    tanhf(clip(acc[2 * gate_stride + i] + reset * acc[3 * gate_stride + i], p.clip));
+                h = (1.0f - z) * candidate + z * h_prev[batch * hidden_size + j];
+            }
+            exchange_next[batch * hidden_size + j] = h;
+            y[batch * p.y.batch + direction * p.y.direction + t * p.y.time + j] = cast<T>(h);
+            if (step + 1 == p.seq_length) {
+                hy[batch * p.hy.batch + direction * p.hy.direction + j] = cast<T>(h);
+                if constexpr (C == RNNSequencePersistent::Cell::LSTM) {
+                    cy[batch * p.cy.batch + direction * p.cy.direction + j] = cast<T>(state[i]);
+                }
+            }
+        }
+        // Hidden states of the step are read by all blocks of the direction in the next step
+        grid.sync();
+    }
+}
+
+template <typename T>
+static const void* kernelFunction(RNNSequencePersistent::Cell cell) {
+    if (cell == RNNSequencePersistent::Cell::LSTM) {
+        return reinterpret_cast<const void*>(&rnn_sequence_persistent<T, RNNSequencePersistent::Cell::LSTM>);
+    }
+    return reinterpret_cast<const void*>(&rnn_sequence_persistent<T, RNNSequencePersistent::Cell::GRU>);
+}
+
+static const void* kernelFunction(Type_t element_type, RNNSequencePersistent::Cell cell) {
+    return element_type == Type_t::f16 ? kernelFunction<__half>(cell) : kernelFunction<float>(cell);
+}
+
+RNNSequencePersistent::RNNSequencePersistent(Type_t element_type,
+                                             const Params& params,
+                                             size_t max_threads_per_block,
+                                             size_t multiprocessor_count)
+    : element_type_{element_type},
+      params_{params},
+      grid_{selectGrid(element_type, params, max_threads_per_block, multiprocessor_count)} {
+    if (grid_.blocks_per_direction == 0) {
+        throw_ov_exception(fmt::format(
+            "RNNSequencePersistent: sequence of {} with hidden size = {} and batch size = {} is not supported !!",
+            element_type,
+            params.hidden_size,
+            params.batch_size));
+    }
+}
+
+RNNSequencePersistent::Grid RNNSequencePersistent::selectGrid(Type_t element_type,
+                                                              const Params& params,
+                                                              size_t max_threads_per_block,
+                                                              size_t multiprocessor_count) {
+    if ((element_type != Type_t::f32 && element_type != Type_t::f16) || params.hidden_size == 0 ||
+        params.hidden_size > max_hidden_size || params.batch_size == 0 || params.batch_size > max_batch_size ||
+        params.input_size == 0 || params.num_directions == 0 || params.num_directions > 2) {
+        return {};
+    }
+    const auto threads =
+        static_cast<unsigned>(std::min<size_t>(max_threads_per_block, max_block_size) / warp_size * warp_size);
+    if (threads == 0) {
+        return {};
+    }
+    const size_t element_size = element_type == Type_t::f16 ? sizeof(__half) : sizeof(float);
+    const void* kernel = kernelFunction(element_type, params.cell);
+    // Fewer units per block spread the work over more multiprocessors, but each warp should have a dot product
+    const size_t num_warps = threads / warp_size;
+    const size_t rows_per_unit = numGates(params.cell) * params.batch_size;
+    size_t units = std::max<size_t>(1, (num_warps + rows_per_unit - 1) / rows_per_unit);
+    for (; units <= params.hidden_size; ++units) {
+        const size_t shared_memory_size = sharedMemorySize(params, element_size, units);
+        if (shared_memory_size > max_shared_memory_size) {
+            break;
+        }
+        int blocks_per_multiprocessor = 0;
+        throwIfError(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_multiprocessor, kernel, static_cast<int>(threads), shared_memory_size));
+        const size_t blocks_per_direction = (params.hidden_size + units - 1) / units;
+        if (blocks_per_direction * params.num_directions <= blocks_per_multiprocessor * multiprocessor_count) {
+            return {static_cast<unsigned>(units),
+                    static_cast<unsigned>(blocks_per_direction),
+                    threads,
+                    shared_memory_size};
+        }
+    }
+    return {};
+}
+
+bool RNNSequencePersistent::isSupported(Type_t element_type,
+                                        const Params& params,
+                                        size_t max_threads_per_block,
+                                        size_t multiprocessor_count) {
+    return selectGrid(element_type, params, max_threads_per_block, multiprocessor_count).blocks_per_direction > 0;
+}
+
+bool RNNSequencePersistent::isCudaGraphCompatible() {
+    // Cooperative launches are captured as kernel nodes with the cooperative attribute since CUDA 12.0
+#if CUDART_VERSION >= 12000
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t RNNSequencePersistent::exchangeBufferSize() const {
+    return 2 * params_.num_directions * params_.batch_size * params_.hidden_size * sizeof(float);
+}
+
+void RNNSequencePersistent::operator()(cudaStream_t stream,
+                                       const void* x,
+                                       const void* hx,
+                                       const void* cx,
+                                       const void* w,
+                                       const void* r,
+                                       const void* b,
+                                       void* y,
+                                       void* hy,
+                                       void* cy,
+                                       void* exchange) const {
+    if (params_.seq_length == 0) {
+        return;
+    }
+    if (element_type_ == Type_t::f16) {
+        return call<__half>(stream, x, hx, cx, w, r, b, y, hy, cy, exchange);
+    }
+    return call<float>(stream, x, hx, cx, w, r, b, y, hy, cy, exchange);
+}
+
+template <typename T>
+void RNNSequencePersistent::call(cudaStream_t stream,
+                                 const void* x,
+                                 const void* hx,
+                                 const void* cx,
+                                 const void* w,
+                                 const void* r,
+                                 const void* b,
+                                 void* y,
+                                 void* hy,
+                                 void* cy,
+                                 void* exchange) const {
+    auto* x_ptr = static_cast<const T*>(x);
+    auto* hx_ptr = static_cast<const T*>(hx);
+    auto* cx_ptr = static_cast<const T*>(cx);
+    auto* w_ptr = static_cast<const T*>(w);
+    auto* r_ptr = static_cast<const T*>(r);
+    auto* b_ptr = static_cast<const T*>(b);
+    auto* y_ptr = static_cast<T*>(y);
+    auto* hy_ptr = static_cast<T*>(hy);
+    auto* cy_ptr = static_cast<T*>(cy);
+    auto* exchange_ptr = static_cast<float*>(exchange);
+    void* args[] = {const_cast<Params*>(&params_),
+                    const_cast<unsigned*>(&grid_.units_per_block),
+                    const_cast<unsigned*>(&grid_.blocks_per_direction),
+                    &x_ptr,
+                    &hx_ptr,
+                    &cx_ptr,
+                    &w_ptr,
+                    &r_ptr,
+                    &b_ptr,
+                    &y_ptr,
+                    &hy_ptr,
+                    &cy_ptr,
+                    &exchange_ptr};
+    const dim3 grid(static_cast<unsigned>(grid_.blocks_per_direction * params_.num_directions));
+    throwIfError(cudaLaunchCooperativeKernel(
+        kernelFunction<T>(params_.cell), grid, dim3(grid_.threads_per_block), args, grid_.shared_memory_size, stream));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
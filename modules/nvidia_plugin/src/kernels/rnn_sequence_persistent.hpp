@@ -0,0 +1,137 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Persistent LSTM or GRU (linear_before_reset) sequence for small hidden sizes and batches. A single cooperative
+ * launch runs all time steps: hidden units of a direction are distributed between blocks, each block keeps rows of
+ * the recurrent weights of its units in shared memory for the whole sequence and keeps the cell state of its units.
+ * Hidden states of a step are exchanged between blocks through a global buffer and a grid-wide barrier.
+ *
+ * Gates are computed in FP32 in the OpenVINO order (LSTM: f, i, c, o; GRU: z, r, h) with the default activations.
+ * Direction 1 of a bidirectional sequence and the REVERSE sequence run from the last time step to the first one.
+ */
+class RNNSequencePersistent {
+public:
+    enum class Cell { LSTM, GRU };
+
+    static constexpr size_t max_hidden_size = 256;
+    static constexpr size_t max_batch_size = 8;
+
+    /**
+     * Element strides of a tensor, the innermost dimension (input or hidden) is dense
+     */
+    struct Strides {
+        size_t batch{};
+        size_t direction{};
+        size_t time{};
+    };
+
+    struct Params {
+        Cell cell{};
+        size_t batch_size{};
+        size_t seq_length{};
+        size_t input_size{};
+        size_t hidden_size{};
+        size_t num_directions{};
+        bool reverse{};
+        // Pre-activations of gates are clipped to [-clip, clip] if clip is positive
+        float clip{};
+        Strides x{};
+        Strides hx{};
+        Strides cx{};
+        Strides y{};
+        Strides hy{};
+        Strides cy{};
+    };
+
+    /**
+     * @param multiprocessor_count Blocks of the grid should be resident on the device at the same time
+     */
+    RNNSequencePersistent(Type_t element_type,
+                          const Params& params,
+                          size_t max_threads_per_block,
+                          size_t multiprocessor_count);
+
+    /**
+     * @param cx, cy Cell states, ignored for GRU
+     * @param exchange Buffer of exchangeBufferSize() bytes
+     */
+    void operator()(cudaStream_t stream,
+                    const void* x,
+                    const void* hx,
+                    const void* cx,
+                    const void* w,
+                    const void* r,
+                    const void* b,
+                    void* y,
+                    void* hy,
+                    void* cy,
+                    void* exchange) const;
+
+    /**
+     * @returns Size of the buffer, through which hidden states are exchanged between blocks
+     */
+    size_t exchangeBufferSize() const;
+
+    /**
+     * @returns true if the sequence fits the persistent kernel on the device
+     */
+    static bool isSupported(Type_t element_type,
+                            const Params& params,
+                            size_t max_threads_per_block,
+                            size_t multiprocessor_count);
+
+    /**
+     * @returns true if cooperative launches can be captured into CUDA graphs
+     */
+    static bool isCudaGraphCompatible();
+
+private:
+    struct Grid {
+        unsigned units_per_block{};
+        unsigned blocks_per_direction{};
+        unsigned threads_per_block{};
+        size_t shared_memory_size{};
+    };
+
+    /**
+     * @returns Grid with the least hidden units per block, all blocks of which are resident at the same time,
+     *          Grid with zero blocks if there is no such grid
+     */
+    static Grid selectGrid(Type_t element_type,
+                           const Params& params,
+                           size_t max_threads_per_block,
+                           size_t multiprocessor_count);
+
+    template <typename T>
+    void call(cudaStream_t stream,
+              const void* x,
+              const void* hx,
+              const void* cx,
+              const void* w,
+              const void* r,
+              const void* b,
+              void* y,
+              void* hy,
+              void* cy,
+              void* exchange) const;
+
+    Type_t element_type_{};
+    Params params_{};
+    Grid grid_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,171 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+#include <tuple>
+
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+#include "roi_align.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+/**
+ * @returns Value of the bilinear sample of the channel, or the maximum of its corners multiplied by their weights
+ * for max pooling. Samples outside of [-1, size] are 0
+ */
+template <typename T, bool Max>
+__device__ float bilinear_sample(const T* channel, const int height, const int width, float y, float x) {
+    if (y < -1.0f || y > height || x < -1.0f || x > width) {
+        return 0.0f;
+    }
+    y = fmaxf(y, 0.0f);
+    x = fmaxf(x, 0.0f);
+    int y_low = static_cast<int>(y);
+    int x_low = static_cast<int>(x);
+    int y_high = y_low + 1;
+    int x_high = x_low + 1;
+    if (y_low >= height - 1) {
+        y_high = y_low = height - 1;
+        y = static_cast<float>(y_low);
+    }
+    if (x_low >= width - 1) {
+        x_high = x_low = width - 1;
+        x = static_cast<float>(x_low);
+    }
+    const float ly = y - y_low;
+    const float lx = x - x_low;
+    const float hy = 1.0f - ly;
+    const float hx = 1.0f - lx;
+    const float v1 = hy * hx * static_cast<float>(channel[y_low * width + x_low]);
+    const float v2 = hy * lx * static_cast<float>(channel[y_low * width + x_high]);
+    const float v3 = ly * hx * static_cast<float>(channel[y_high * width + x_low]);
+    const float v4 = ly * lx * static_cast<float>(channel[y_high * width + x_high]);
+    if (Max) {
+        return fmaxf(fmaxf(v1, v2), fmaxf(v3, v4));
+    }
+    return v1 + v2 + v3 + v4;
+}
+
+template <typename T, typename TIndex, bool Max>
+__global__ void roi_align(const ROIAlign::Params params,
+                          const T* data,
+                          const T* rois,
+                          const TIndex* batch_indices,
+                          T* output) {
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    const size_t pooled_size = params.pooled_height * params.pooled_width;
+    if (i >= params.num_rois * params.channels * pooled_size) {
+        return;
+    }
+    const unsigned pw = i % params.pooled_width;
+    const unsigned ph = i / params.pooled_width % params.pooled_height;
+    const size_t c = i / pooled_size % params.channels;
+    const size_t roi = i / pooled_size / params.channels;
+
+    float offset_src = 0.0f;
+    float offset_dst = 0.0f;
+    if (params.aligned_mode == ROIAlign::AlignedMode::HalfPixelForNN) {
+        offset_dst = -0.5f;
+    } else if (params.aligned_mode == ROIAlign::AlignedMode::HalfPixel) {
+        offset_src = 0.5f;
+        offset_dst = -0.5f;
+    }
+    const T* box = rois + roi * 4;
+    const float x1 = (static_cast<float>(box[0]) + offset_src) * params.spatial_scale + offset_dst;
+    const float y1 = (static_cast<float>(box[1]) + offset_src) * params.spatial_scale + offset_dst;
+    const float x2 = (static_cast<float>(box[2]) + offset_src) * params.spatial_scale + offset_dst;
+    const float y2 = (static_cast<float>(box[3]) + offset_src) * params.spatial_scale + offset_dst;
+    float roi_width = x2 - x1;
+    float roi_height = y2 - y1;
+    if (params.aligned_mode == ROIAlign::AlignedMode::Asymmetric) {
+        roi_width = fmaxf(roi_width, 1.0f);
+        roi_height = fmaxf(roi_height, 1.0f);
+    }
+    const float bin_width = roi_width / params.pooled_width;
+    const float bin_height = roi_height / params.pooled_height;
+    const int samples_x = params.sampling_ratio > 0 ? params.sampling_ratio : static_cast<int>(ceilf(bin_width));
+    const int samples_y = params.sampling_ratio > 0 ? params.sampling_ratio : static_cast<int>(ceilf(bin_height));
+    const float sample_width = bin_width / samples_x;
+    const float sample_height = bin_height / samples_y;
+
+    const int height = static_cast<int>(params.height);
+    const int width = static_cast<int>(params.width);
+    const T* channel = data + (static_cast<size_t>(batch_indices[roi]) * params.channels + c) * height * width;
+    float result = 0.0f;
+    bool first = true;
+    for (int iy = 0; iy < samples_y; ++iy) {
+        const float y = y1 + ph * bin_height + (iy + 0.5f) * sample_height;
+        for (int ix = 0; ix < samples_x; ++ix) {
+            const float x = x1 + pw * bin_width + (ix + 0.5f) * sample_width;
+            const float value = bilinear_sample<T, Max>(channel, height, width, y, x);
+            if (Max) {
+                result = first ? value : fmaxf(result, value);
+                first = false;
+            } else {
+                result += value;
+            }
+        }
+    }
+    if (!Max && samples_x * samples_y > 0) {
+        result /= samples_x * samples_y;
+    }
+    output[i] = static_cast<T>(result);
+}
+
+}  // namespace
+
+ROIAlign::ROIAlign(const Params& params, const size_t max_threads_per_block) : params_{params} {
+    switch (params_.element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+            break;
+        default:
+            throw_ov_exception(
+                fmt::format("Element type = {} is not supported by ROIAlign operation !!", params_.element_type));
+    }
+    if (params_.index_type != Type_t::i32 && params_.index_type != Type_t::i64) {
+        throw_ov_exception(
+            fmt::format("Index type = {} is not supported by ROIAlign operation !!", params_.index_type));
+    }
+    std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(
+        params_.num_rois * params_.channels * params_.pooled_height * params_.pooled_width, max_threads_per_block);
+}
+
+void ROIAlign::operator()(
+    const cudaStream_t stream, const void* data, const void* rois, const void* batch_indices, void* output) const {
+    const bool i32 = params_.index_type == Type_t::i32;
+    switch (params_.element_type) {
+        case Type_t::f16:
+            return i32 ? call<__half, int32_t>(stream, data, rois, batch_indices, output)
+                       : call<__half, int64_t>(stream, data, rois, batch_indices, output);
+        default:
+            return i32 ? call<float, int32_t>(stream, data, rois, batch_indices, output)
+                       : call<float, int64_t>(stream, data, rois, batch_indices, output);
+    }
+}
+
+template <typename T, typename TIndex>
+void ROIAlign::call(
+    const cudaStream_t stream, const void* data, const void* rois, const void* batch_indices, void* output) const {
+    if (num_blocks_ == 0) {
+        return;
+    }
+    auto kernel = params_.pooling_mode == PoolingMode::Max ? roi_align<T, TIndex, true> : roi_align<T, TIndex, false>;
+    kernel<<<num_blocks_, threads_per_block_, 0, stream>>>(params_,
+                                                           static_cast<const T*>(data),
+                                                           static_cast<const T*>(rois),
+                                                           static_cast<const TIndex*>(batch_indices),
+                                                           static_cast<T*>(output));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
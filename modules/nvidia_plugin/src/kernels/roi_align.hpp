@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * ROIAlign-3/9 computed by a thread per output element, which averages or takes the maximum of bilinearly
+ * interpolated samples of its bin
+ */
+class ROIAlign {
+public:
+    enum class PoolingMode { Avg, Max };
+    enum class AlignedMode { Asymmetric, HalfPixelForNN, HalfPixel };
+
+    struct Params {
+        Type_t element_type;
+        Type_t index_type;
+        size_t num_rois;
+        size_t channels;
+        size_t height;
+        size_t width;
+        size_t pooled_height;
+        size_t pooled_width;
+        int sampling_ratio;
+        float spatial_scale;
+        PoolingMode pooling_mode;
+        AlignedMode aligned_mode;
+    };
+
+    ROIAlign(const Params& params, size_t max_threads_per_block);
+
+    /**
+     * @param data [num_batches, channels, height, width]
+     * @param rois [num_rois, 4] of element_type
+     * @param batch_indices [num_rois] of index_type
+     * @param output [num_rois, channels, pooled_height, pooled_width]
+     */
+    void operator()(
+        cudaStream_t stream, const void* data, const void* rois, const void* batch_indices, void* output) const;
+
+private:
+    template <typename T, typename TIndex>
+    void call(cudaStream_t stream, const void* data, const void* rois, const void* batch_indices, void* output) const;
+
+    Params params_;
+    unsigned num_blocks_;
+    unsigned threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 #include <stdio.h>
 
+#include <cstdint>
 #include <cuda/float16.hpp>
 #include <numeric>
 
@@ -16,6 +17,18 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
+template <typename IndexType>
+static inline __device__ size_t output_chunk_offset(const size_t indices_last_dim,
+                                                    const size_t* input_data_dim_pading,
+                                                    const size_t update_chunk,
+                                                    const IndexType* indices) {
+    const auto begin = update_chunk * indices_last_dim;
+    const auto end = begin + indices_last_dim;
+    size_t out_index{};
+    for (size_t j{begin}, k{}; j < end; ++j, ++k) out_index += indices[j] * input_data_dim_pading[k];
+    return out_index;
+}
+
 template <typename DataType, typename IndexType>
 static inline __device__ void scatter_nd_update(const size_t indices_last_dim,
                                                 const size_t num_of_update_elements,
@@ -25,11 +38,7 @@ static inline __device__ void scatter_nd_update(const size_t indices_last_dim,
                                                 const IndexType* indices,
                                                 const DataType* updates,
                                                 DataType* output) {
-    const auto begin = update_chunk * indices_last_dim;
-    const auto end = begin + indices_last_dim;
-    size_t out_index{};
-    for (size_t j{begin}, k{}; j < end; ++j, ++k) out_index += indices[j] * input_data_dim_pading[k];
-
+    const auto out_index = output_chunk_offset(indices_last_dim, input_data_dim_pading, update_chunk, indices);
     output[out_index + update_element] = updates[update_chunk * num_of_update_elements + update_element];
 }
 
@@ -78,6 +87,27 @@ static inline __global__ void update_thread_per_chunk(const size_t indices_last_
                       output);
 }
 
+/**
+ * Copies update chunks by words wider than the data elements, chunks and their offsets are expected to be
+ * multiples of the word size
+ */
+template <typename Word, typename IndexType>
+static inline __global__ void update_chunk_words(const size_t indices_last_dim,
+                                                 const size_t num_of_chunk_words,
+                                                 const size_t element_size,
+                                                 const size_t* input_data_dim_pading,
+                                                 const IndexType* indices,
+                                                 const Word* updates,
+                                                 Word* output) {
+    const auto word = blockIdx.y * blockDim.x + threadIdx.x;
+    const auto update_chunk = blockIdx.x;
+
+    if (word >= num_of_chunk_words) return;
+
+    const auto out_index = output_chunk_offset(indices_last_dim, input_data_dim_pading, update_chunk, indices);
+    output[out_index * element_size / sizeof(Word) + word] = updates[update_chunk * num_of_chunk_words + word];
+}
+
 ScatterNDUpdate::ScatterNDUpdate(Type_t data_type,
                                  Type_t indices_type,
                                  size_t indices_last_dim,
@@ -166,15 +196,31 @@ void ScatterNDUpdate::Call(const cudaStream_t stream,
                            const void* updates,
                            const size_t* input_data_dim_pading,
                            void* output) const {
-    // at the beginning we need the output to be the same as the input
-    throwIfError(
-        cudaMemcpyAsync(output, input, num_of_input_elements_ * sizeof(DataType), cudaMemcpyDeviceToDevice, stream));
+    // at the beginning we need the output to be the same as the input, unless it's updated in place
+    if (output != input) {
+        throwIfError(cudaMemcpyAsync(
+            output, input, num_of_input_elements_ * sizeof(DataType), cudaMemcpyDeviceToDevice, stream));
+    }
 
     const auto indices_typed = static_cast<const IndexType*>(indices);
     const auto updates_typed = static_cast<const DataType*>(updates);
     auto output_typed = static_cast<DataType*>(output);
 
     if (thread_per_element_) {
+        // Chunks are copied by the widest words of up to 16 bytes the chunks and the buffers are aligned to
+        const size_t chunk_bytes = num_of_update_elements_ * sizeof(DataType);
+        const auto alignment =
+            reinterpret_cast<std::uintptr_t>(output) | reinterpret_cast<std::uintptr_t>(updates) | chunk_bytes;
+        if (sizeof(DataType) < 16 && alignment % 16 == 0) {
+            return CallChunkWords<uint4, IndexType>(
+                stream, indices, updates, input_data_dim_pading, output, sizeof(DataType));
+        } else if (sizeof(DataType) < 8 && alignment % 8 == 0) {
+            return CallChunkWords<uint2, IndexType>(
+                stream, indices, updates, input_data_dim_pading, output, sizeof(DataType));
+        } else if (sizeof(DataType) < 4 && alignment % 4 == 0) {
+            return CallChunkWords<uint32_t, IndexType>(
+                stream, indices, updates, input_data_dim_pading, output, sizeof(DataType));
+        }
         dim3 grid{static_cast<unsigned int>(num_of_update_chunks_), static_cast<unsigned int>(num_of_blocks_)};
         kernel::update_thread_per_element<<<grid, num_of_threads_, 0, stream>>>(indices_last_dim_,
                                                                                 num_of_update_elements_,
@@ -193,6 +239,26 @@ void ScatterNDUpdate::Call(const cudaStream_t stream,
                                                                               output_typed);
     }
 }
+
+template <typename Word, typename IndexType>
+void ScatterNDUpdate::CallChunkWords(const cudaStream_t stream,
+                                     const void* indices,
+                                     const void* updates,
+                                     const size_t* input_data_dim_pading,
+                                     void* output,
+                                     const size_t element_size) const {
+    const size_t num_of_chunk_words = num_of_update_elements_ * element_size / sizeof(Word);
+    const size_t num_of_blocks = (num_of_chunk_words + num_of_threads_ - 1) / num_of_threads_;
+    dim3 grid{static_cast<unsigned int>(num_of_update_chunks_), static_cast<unsigned int>(num_of_blocks)};
+    kernel::update_chunk_words<<<grid, num_of_threads_, 0, stream>>>(indices_last_dim_,
+                                                                     num_of_chunk_words,
+                                                                     element_size,
+                                                                     input_data_dim_pading,
+                                                                     static_cast<const IndexType*>(indices),
+                                                                     static_cast<const Word*>(updates),
+                                                                     static_cast<Word*>(output));
+}
+
 }  // namespace kernel
 
 }  // namespace nvidia_gpu
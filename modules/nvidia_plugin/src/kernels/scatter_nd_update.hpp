@@ -49,6 +49,14 @@ public:
                         void* output) const;
 
 private:
+    template <typename Word, typename IndexType>
+    void CallChunkWords(const cudaStream_t stream,
+                        const void* indices,
+                        const void* updates,
+                        const size_t* input_data_dim_pading,
+                        void* output,
+                        const size_t element_size) const;
+
     Type_t data_type_;
     Type_t indices_type_;
     size_t indices_last_dim_;
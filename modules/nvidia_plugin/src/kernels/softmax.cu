@@ -0,0 +1,241 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "details/error.hpp"
+#include "softmax.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned warps_per_block = 4;
+constexpr unsigned row_block_size = 256;
+constexpr unsigned column_block_size = 256;
+
+/**
+ * Running maximum and sum of exponents of values relative to it, so that both are computed by one pass
+ */
+struct OnlineSoftmax {
+    float max = -INFINITY;
+    float sum = 0.0f;
+
+    __device__ __forceinline__ void add(float value) {
+        if (value == -INFINITY) {
+            return;
+        }
+        if (value > max) {
+            sum = sum * expf(max - value) + 1.0f;
+            max = value;
+        } else {
+            sum += expf(value - max);
+        }
+    }
+
+    __device__ __forceinline__ void merge(const OnlineSoftmax& other) {
+        const float merged_max = fmaxf(max, other.max);
+        if (merged_max == -INFINITY) {
+            return;
+        }
+        sum = sum * expf(max - merged_max) + other.sum * expf(other.max - merged_max);
+        max = merged_max;
+    }
+};
+
+__device__ __forceinline__ OnlineSoftmax warp_reduce(OnlineSoftmax value) {
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        OnlineSoftmax other;
+        other.max = __shfl_xor_sync(0xFFFFFFFF, value.max, offset);
+        other.sum = __shfl_xor_sync(0xFFFFFFFF, value.sum, offset);
+        value.merge(other);
+    }
+    return value;
+}
+
+/**
+ * Reduces values of all threads of the block, the result is returned to every thread
+ */
+__device__ __forceinline__ OnlineSoftmax block_reduce(OnlineSoftmax value) {
+    constexpr unsigned num_warps = row_block_size / warp_size;
+    __shared__ float maxes[num_warps];
+    __shared__ float sums[num_warps];
+    const unsigned warp = threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    value = warp_reduce(value);
+    if (lane == 0) {
+        maxes[warp] = value.max;
+        sums[warp] = value.sum;
+    }
+    __syncthreads();
+    OnlineSoftmax total;
+    if (lane < num_warps) {
+        total.max = maxes[lane];
+        total.sum = sums[lane];
+    }
+    return warp_reduce(total);
+}
+
+template <bool Log>
+struct Normalizer {
+    float max;
+    // log(sum) for log-softmax and 1 / sum otherwise
+    float scale;
+
+    __device__ __forceinline__ explicit Normalizer(const OnlineSoftmax& statistics)
+        : max{statistics.max}, scale{Log ? logf(statistics.sum) : 1.0f / statistics.sum} {}
+
+    __device__ __forceinline__ float operator()(float value) const {
+        if constexpr (Log) {
+            return value - max - scale;
+        } else {
+            return expf(value - max) * scale;
+        }
+    }
+};
+
+}  // namespace
+
+/**
+ * ValuesPerLane is the number of cached values of a row per lane
+ */
+template <typename T, bool Log, unsigned ValuesPerLane>
+static __global__ void warp_softmax(size_t rows, size_t length, const T* x, T* y) {
+    const size_t row = static_cast<size_t>(blockIdx.x) * warps_per_block + threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (row >= rows) {
+        return;
+    }
+    const T* x_row = x + row * length;
+    T* y_row = y + row * length;
+
+    OnlineSoftmax statistics;
+    float cached[ValuesPerLane];
+#pragma unroll
+    for (unsigned r = 0; r < ValuesPerLane; ++r) {
+        const size_t i = lane + r * warp_size;
+        if (i < length) {
+            cached[r] = static_cast<float>(x_row[i]);
+            statistics.add(cached[r]);
+        }
+    }
+    const Normalizer<Log> normalize{warp_reduce(statistics)};
+#pragma unroll
+    for (unsigned r = 0; r < ValuesPerLane; ++r) {
+        const size_t i = lane + r * warp_size;
+        if (i < length) {
+            y_row[i] = static_cast<T>(normalize(cached[r]));
+        }
+    }
+}
+
+template <typename T, bool Log>
+static __global__ void block_softmax(size_t length, const T* x, T* y) {
+    const T* x_row = x + static_cast<size_t>(blockIdx.x) * length;
+    T* y_row = y + static_cast<size_t>(blockIdx.x) * length;
+
+    OnlineSoftmax statistics;
+    for (size_t i = threadIdx.x; i < length; i += row_block_size) {
+        statistics.add(static_cast<float>(x_row[i]));
+    }
+    const Normalizer<Log> normalize{block_reduce(statistics)};
+    for (size_t i = threadIdx.x; i < length; i += row_block_size) {
+        y_row[i] = static_cast<T>(normalize(static_cast<float>(x_row[i])));
+    }
+}
+
+template <typename T, bool Log>
+static __global__ void column_softmax(size_t columns, size_t length, size_t inner, const T* x, T* y) {
+    const size_t column = static_cast<size_t>(blockIdx.x) * column_block_size + threadIdx.x;
+    if (column >= columns) {
+        return;
+    }
+    const size_t offset = column / inner * length * inner + column % inner;
+    const T* x_column = x + offset;
+    T* y_column = y + offset;
+
+    OnlineSoftmax statistics;
+    for (size_t i = 0; i < length; ++i) {
+        statistics.add(static_cast<float>(x_column[i * inner]));
+    }
+    const Normalizer<Log> normalize{statistics};
+    for (size_t i = 0; i < length; ++i) {
+        y_column[i * inner] = static_cast<T>(normalize(static_cast<float>(x_column[i * inner])));
+    }
+}
+
+Softmax::Softmax(Type_t element_type, size_t outer, size_t length, size_t inner, bool log)
+    : element_type_{element_type}, outer_{outer}, length_{length}, inner_{inner}, log_{log} {
+    if (!isTypeSupported(element_type_)) {
+        throw_ov_exception(fmt::format("Element type = {} is not supported by Softmax operation !!", element_type_));
+    }
+}
+
+bool Softmax::isTypeSupported(Type_t element_type) {
+    switch (element_type) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+void Softmax::operator()(cudaStream_t stream, const void* x, void* y) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, x, y);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, x, y);
+#endif
+        default:
+            return call<float>(stream, x, y);
+    }
+}
+
+template <typename T>
+void Softmax::call(cudaStream_t stream, const void* x, void* y) const {
+    if (log_) {
+        return launch<T, true>(stream, x, y);
+    }
+    return launch<T, false>(stream, x, y);
+}
+
+template <typename T, bool Log>
+void Softmax::launch(cudaStream_t stream, const void* x, void* y) const {
+    const auto* input = static_cast<const T*>(x);
+    auto* output = static_cast<T*>(y);
+    if (inner_ > 1) {
+        const size_t columns = outer_ * inner_;
+        const unsigned num_blocks = (columns + column_block_size - 1) / column_block_size;
+        column_softmax<T, Log><<<num_blocks, column_block_size, 0, stream>>>(columns, length_, inner_, input, output);
+    } else if (length_ <= max_cached_length) {
+        const unsigned num_blocks = (outer_ + warps_per_block - 1) / warps_per_block;
+        constexpr unsigned block_size = warps_per_block * warp_size;
+        if (length_ <= 4 * warp_size) {
+            warp_softmax<T, Log, 4><<<num_blocks, block_size, 0, stream>>>(outer_, length_, input, output);
+        } else if (length_ <= 8 * warp_size) {
+            warp_softmax<T, Log, 8><<<num_blocks, block_size, 0, stream>>>(outer_, length_, input, output);
+        } else {
+            warp_softmax<T, Log, max_cached_length / warp_size>
+                <<<num_blocks, block_size, 0, stream>>>(outer_, length_, input, output);
+        }
+    } else {
+        block_softmax<T, Log><<<outer_, row_block_size, 0, stream>>>(length_, input, output);
+    }
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Computes softmax (or log-softmax) of a tensor viewed as [outer, length, inner] along its length dimension.
+ * The maximum and the sum of exponents are computed by a single (online) pass over the input. Rows of contiguous
+ * values (inner == 1) are processed by one warp, which keeps rows of up to max_cached_length elements in registers,
+ * or by one block if they are longer. Strided rows (inner > 1) are processed by one thread each, so that
+ * neighbouring threads read neighbouring values
+ */
+class Softmax {
+public:
+    static constexpr size_t max_cached_length = 1024;
+
+    Softmax(Type_t element_type, size_t outer, size_t length, size_t inner, bool log);
+    Softmax(Softmax&&) = default;
+    Softmax& operator=(Softmax&&) = default;
+
+    void operator()(cudaStream_t stream, const void* x, void* y) const;
+
+    /**
+     * @returns true if the kernel supports the element type
+     */
+    static bool isTypeSupported(Type_t element_type);
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* x, void* y) const;
+
+    template <typename T, bool Log>
+    void launch(cudaStream_t stream, const void* x, void* y) const;
+
+    Type_t element_type_{};
+    size_t outer_{};
+    size_t length_{};
+    size_t inner_{};
+    bool log_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
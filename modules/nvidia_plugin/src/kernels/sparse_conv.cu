@@ -0,0 +1,386 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "details/error.hpp"
+#include "sparse_conv.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned long long kEmptyKey = ~0ull;
+constexpr unsigned kCoordinateBits = 21;
+constexpr unsigned long long kCoordinateMask = (1ull << kCoordinateBits) - 1;
+// Tile of output points x output channels of a block of the convolution
+constexpr unsigned kTile = 32;
+constexpr unsigned kTileRows = 8;
+constexpr size_t kWorkspaceAlignment = 256;
+
+size_t align(size_t size) { return (size + kWorkspaceAlignment - 1) / kWorkspaceAlignment * kWorkspaceAlignment; }
+
+unsigned numBlocks(size_t num_threads, size_t threads_per_block) {
+    return static_cast<unsigned>((num_threads + threads_per_block - 1) / threads_per_block);
+}
+
+__device__ long long cellOf(float coordinate, float size) { return static_cast<long long>(floorf(coordinate / size)); }
+
+// Cells sharing a key only add points, which fail the exact check
+__device__ unsigned long long cellKey(long long cw, long long ch, long long cd) {
+    return (static_cast<unsigned long long>(cw) & kCoordinateMask) |
+           (static_cast<unsigned long long>(ch) & kCoordinateMask) << kCoordinateBits |
+           (static_cast<unsigned long long>(cd) & kCoordinateMask) << 2 * kCoordinateBits;
+}
+
+__device__ size_t hashSlot(unsigned long long key, size_t mask) {
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+// Returns the first input point of the list of the cell or -1
+__device__ int cellHead(const unsigned long long* keys, const int* heads, size_t mask, unsigned long long key) {
+    for (size_t slot = hashSlot(key, mask);; slot = (slot + 1) & mask) {
+        const auto slotKey = keys[slot];
+        if (slotKey == key) {
+            return heads[slot];
+        }
+        if (slotKey == kEmptyKey) {
+            return -1;
+        }
+    }
+}
+
+__global__ void sparse_conv_terminator(const float* inp_pos, size_t num_inp_points, unsigned* num_valid) {
+    const size_t j = blockIdx.x * blockDim.x + threadIdx.x;
+    if (j < num_inp_points && inp_pos[j * 3] < 0) {
+        atomicMin(num_valid, static_cast<unsigned>(j));
+    }
+}
+
+__global__ void sparse_conv_insert(const float* inp_pos,
+                                   size_t num_inp_points,
+                                   const unsigned* num_valid,
+                                   float cell_w,
+                                   float cell_h,
+                                   float cell_d,
+                                   unsigned long long* keys,
+                                   int* heads,
+                                   int* next,
+                                   size_t mask) {
+    const size_t j = blockIdx.x * blockDim.x + threadIdx.x;
+    if (j >= num_inp_points || j >= *num_valid) {
+        return;
+    }
+    const float* pos = inp_pos + j * 3;
+    const auto key = cellKey(cellOf(pos[0], cell_w), cellOf(pos[1], cell_h), cellOf(pos[2], cell_d));
+    for (size_t slot = hashSlot(key, mask);; slot = (slot + 1) & mask) {
+        const auto prev = atomicCAS(&keys[slot], kEmptyKey, key);
+        if (prev == kEmptyKey || prev == key) {
+            next[j] = atomicExch(&heads[slot], static_cast<int>(j));
+            return;
+        }
+    }
+}
+
+__global__ void sparse_conv_rulebook(const float* features,
+                                     const float* inp_pos,
+                                     const float* out_pos,
+                                     const float* kernel,
+                                     const float* offset,
+                                     size_t num_out_points,
+                                     int kd,
+                                     int kh,
+                                     int kw,
+                                     size_t in_channels,
+                                     size_t out_channels,
+                                     bool transposed,
+                                     float cell_w,
+                                     float cell_h,
+                                     float cell_d,
+                                     const unsigned long long* keys,
+                                     const int* heads,
+                                     const int* next,
+                                     size_t mask,
+                                     int* rulebook,
+                                     float* out) {
+    const size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_out_points) {
+        return;
+    }
+    const float rw = cell_w * 0.5f;
+    const float rh = cell_h * 0.5f;
+    const float rd = cell_d * 0.5f;
+    const float xi = out_pos[i * 3] - offset[0];
+    const float yi = out_pos[i * 3 + 1] - offset[1];
+    const float zi = out_pos[i * 3 + 2] - offset[2];
+    for (long long cd = cellOf(zi - rd, cell_d); cd <= cellOf(zi + rd, cell_d); ++cd) {
+        for (long long ch = cellOf(yi - rh, cell_h); ch <= cellOf(yi + rh, cell_h); ++ch) {
+            for (long long cw = cellOf(xi - rw, cell_w); cw <= cellOf(xi + rw, cell_w); ++cw) {
+                for (int j = cellHead(keys, heads, mask, cellKey(cw, ch, cd)); j >= 0; j = next[j]) {
+                    const float xj = inp_pos[j * 3];
+                    const float yj = inp_pos[j * 3 + 1];
+                    const float zj = inp_pos[j * 3 + 2];
+                    if (xj < xi - rw || xi + rw < xj || yj < yi - rh || yi + rh < yj || zj < zi - rd ||
+                        zi + rd < zj) {
+                        continue;
+                    }
+                    int w = min(static_cast<int>(xj - xi + kw * 0.5f), kw - 1);
+                    int h = min(static_cast<int>(yj - yi + kh * 0.5f), kh - 1);
+                    int d = min(static_cast<int>(zj - zi + kd * 0.5f), kd - 1);
+                    if (transposed) {
+                        w = kw - 1 - w;
+                        h = kh - 1 - h;
+                        d = kd - 1 - d;
+                    }
+                    const size_t k = w + kw * (h + kh * d);
+                    int& rule = rulebook[k * num_out_points + i];
+                    if (rule < 0) {
+                        rule = j;
+                        continue;
+                    }
+                    // The least input stays in the rulebook, so it doesn't depend on the order of the lists
+                    int extra = j;
+                    if (j < rule) {
+                        extra = rule;
+                        rule = j;
+                    }
+                    for (size_t ic = 0; ic < in_channels; ++ic) {
+                        const float feature = features[extra * in_channels + ic];
+                        const float* weights = kernel + out_channels * (ic + in_channels * k);
+                        for (size_t oc = 0; oc < out_channels; ++oc) {
+                            out[i * out_channels + oc] += weights[oc] * feature;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+__global__ void sparse_conv_gemm(const float* features,
+                                 const float* kernel,
+                                 const int* rulebook,
+                                 size_t num_out_points,
+                                 size_t num_offsets,
+                                 size_t in_channels,
+                                 size_t out_channels,
+                                 float* out) {
+    __shared__ int inputs[kTile];
+    __shared__ float gathered[kTile][kTile];
+    __shared__ float weights[kTile][kTile];
+    const unsigned tx = threadIdx.x;
+    const unsigned ty = threadIdx.y;
+    const size_t first_out = static_cast<size_t>(blockIdx.x) * kTile;
+    const size_t oc = static_cast<size_t>(blockIdx.y) * kTile + tx;
+    float acc[kTile / kTileRows] = {};
+    for (size_t k = 0; k < num_offsets; ++k) {
+        if (ty == 0) {
+            const size_t i = first_out + tx;
+            inputs[tx] = i < num_out_points ? rulebook[k * num_out_points + i] : -1;
+        }
+        __syncthreads();
+        if (!__syncthreads_or(inputs[tx] >= 0)) {
+            continue;
+        }
+        for (size_t ic0 = 0; ic0 < in_channels; ic0 += kTile) {
+            for (unsigned r = ty; r < kTile; r += kTileRows) {
+                const int j = inputs[r];
+                const size_t ic = ic0 + tx;
+                gathered[r][tx] = j >= 0 && ic < in_channels ? features[j * in_channels + ic] : 0.0f;
+                const size_t weightsIc = ic0 + r;
+                weights[r][tx] = weightsIc < in_channels && oc < out_channels
+                                     ? kernel[out_channels * (weightsIc + in_channels * k) + oc]
+                                     : 0.0f;
+            }
+            __syncthreads();
+            for (unsigned c = 0; c < kTile; ++c) {
+                const float weight = weights[c][tx];
+                for (unsigned r = 0; r < kTile / kTileRows; ++r) {
+                    acc[r] += gathered[ty + r * kTileRows][c] * weight;
+                }
+            }
+            __syncthreads();
+        }
+    }
+    if (oc >= out_channels) {
+        return;
+    }
+    for (unsigned r = 0; r < kTile / kTileRows; ++r) {
+        const size_t i = first_out + ty + r * kTileRows;
+        if (i < num_out_points) {
+            out[i * out_channels + oc] += acc[r];
+        }
+    }
+}
+
+// Exactly one of v and v - 1 is even, so each point has one cell of the grid unless it is negative
+__global__ void calculate_grid_cells(const float* inp_pos, size_t num_points, unsigned long long* keys) {
+    const size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_points) {
+        return;
+    }
+    unsigned long long key = 0;
+    for (size_t axis = 0; axis < 3; ++axis) {
+        const int value = static_cast<int>(inp_pos[i * 3 + axis]);
+        if (value < 0) {
+            keys[i] = kEmptyKey;
+            return;
+        }
+        key = key << kCoordinateBits | (static_cast<unsigned long long>(value & ~1) & kCoordinateMask);
+    }
+    keys[i] = key;
+}
+
+__global__ void calculate_grid_write(const unsigned long long* unique,
+                                     const int* num_unique,
+                                     size_t num_points,
+                                     float* out) {
+    const size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_points) {
+        return;
+    }
+    size_t count = *num_unique;
+    if (count > 0 && unique[count - 1] == kEmptyKey) {
+        --count;
+    }
+    if (i < count) {
+        const auto key = unique[i];
+        out[i * 3] = 0.5f + static_cast<float>(key >> 2 * kCoordinateBits & kCoordinateMask);
+        out[i * 3 + 1] = 0.5f + static_cast<float>(key >> kCoordinateBits & kCoordinateMask);
+        out[i * 3 + 2] = 0.5f + static_cast<float>(key & kCoordinateMask);
+    } else {
+        out[i * 3] = i == count ? -1.0f : 0.0f;
+        out[i * 3 + 1] = 0.0f;
+        out[i * 3 + 2] = 0.0f;
+    }
+}
+
+}  // namespace
+
+SparseConv::SparseConv(const size_t num_inp_points,
+                       const size_t num_out_points,
+                       const size_t kd,
+                       const size_t kh,
+                       const size_t kw,
+                       const size_t in_channels,
+                       const size_t out_channels,
+                       const bool transposed,
+                       const size_t max_threads_per_block)
+    : num_inp_points_{num_inp_points},
+      num_out_points_{num_out_points},
+      kd_{kd},
+      kh_{kh},
+      kw_{kw},
+      in_channels_{in_channels},
+      out_channels_{out_channels},
+      transposed_{transposed},
+      max_threads_per_block_{max_threads_per_block} {
+    // Open addressing keeps at least half of the slots empty
+    hash_capacity_ = 2;
+    while (hash_capacity_ < 2 * num_inp_points_) {
+        hash_capacity_ *= 2;
+    }
+    keys_offset_ = align(sizeof(unsigned));
+    heads_offset_ = keys_offset_ + align(hash_capacity_ * sizeof(unsigned long long));
+    next_offset_ = heads_offset_ + align(hash_capacity_ * sizeof(int));
+    rulebook_offset_ = next_offset_ + align(num_inp_points_ * sizeof(int));
+    workspace_size_ = rulebook_offset_ + kd_ * kh_ * kw_ * num_out_points_ * sizeof(int);
+}
+
+void SparseConv::operator()(const cudaStream_t stream,
+                            const float* features,
+                            const float* inp_pos,
+                            const float* out_pos,
+                            const float* kernel,
+                            const float* offset,
+                            float* out,
+                            void* workspace) const {
+    auto* bytes = static_cast<char*>(workspace);
+    auto* num_valid = reinterpret_cast<unsigned*>(bytes);
+    auto* keys = reinterpret_cast<unsigned long long*>(bytes + keys_offset_);
+    auto* heads = reinterpret_cast<int*>(bytes + heads_offset_);
+    auto* next = reinterpret_cast<int*>(bytes + next_offset_);
+    auto* rulebook = reinterpret_cast<int*>(bytes + rulebook_offset_);
+    const size_t mask = hash_capacity_ - 1;
+    // See https://github.com/isl-org/Open3D/blob/master/python/open3d/ml/torch/python/layers/convolutions.py
+    const float cell_w = 2 * kw_ * 0.51f;
+    const float cell_h = 2 * kh_ * 0.51f;
+    const float cell_d = 2 * kd_ * 0.51f;
+
+    // All bits set are no terminator, empty slots and rules
+    throwIfError(cudaMemsetAsync(workspace, 0xff, workspace_size_, stream));
+    throwIfError(cudaMemsetAsync(out, 0, num_out_points_ * out_channels_ * sizeof(float), stream));
+    if (num_out_points_ == 0 || out_channels_ == 0) {
+        return;
+    }
+    if (num_inp_points_ > 0) {
+        const unsigned inp_blocks = numBlocks(num_inp_points_, max_threads_per_block_);
+        sparse_conv_terminator<<<inp_blocks, max_threads_per_block_, 0, stream>>>(
+            inp_pos, num_inp_points_, num_valid);
+        sparse_conv_insert<<<inp_blocks, max_threads_per_block_, 0, stream>>>(
+            inp_pos, num_inp_points_, num_valid, cell_w, cell_h, cell_d, keys, heads, next, mask);
+    }
+    sparse_conv_rulebook<<<numBlocks(num_out_points_, max_threads_per_block_), max_threads_per_block_, 0, stream>>>(
+        features,
+        inp_pos,
+        out_pos,
+        kernel,
+        offset,
+        num_out_points_,
+        static_cast<int>(kd_),
+        static_cast<int>(kh_),
+        static_cast<int>(kw_),
+        in_channels_,
+        out_channels_,
+        transposed_,
+        cell_w,
+        cell_h,
+        cell_d,
+        keys,
+        heads,
+        next,
+        mask,
+        rulebook,
+        out);
+    const dim3 grid{numBlocks(num_out_points_, kTile), numBlocks(out_channels_, kTile)};
+    const dim3 block{kTile, kTileRows};
+    sparse_conv_gemm<<<grid, block, 0, stream>>>(
+        features, kernel, rulebook, num_out_points_, kd_ * kh_ * kw_, in_channels_, out_channels_, out);
+    throwIfError(cudaPeekAtLastError());
+}
+
+CalculateGrid::CalculateGrid(const size_t num_points, const size_t max_threads_per_block)
+    : num_points_{num_points}, max_threads_per_block_{max_threads_per_block}, sort_{num_points}, unique_{num_points} {
+    temp_size_ = CUDA::algorithms::device::sharedTempStorageSize(sort_, unique_);
+    const size_t keys_size = align(num_points_ * sizeof(unsigned long long));
+    sorted_offset_ = keys_size;
+    unique_offset_ = sorted_offset_ + keys_size;
+    num_unique_offset_ = unique_offset_ + keys_size;
+    temp_offset_ = num_unique_offset_ + align(sizeof(int));
+    workspace_size_ = temp_offset_ + temp_size_;
+}
+
+void CalculateGrid::operator()(const cudaStream_t stream, const float* inp_pos, float* out, void* workspace) const {
+    if (num_points_ == 0) {
+        return;
+    }
+    auto* bytes = static_cast<char*>(workspace);
+    auto* keys = reinterpret_cast<unsigned long long*>(bytes);
+    auto* sorted = reinterpret_cast<unsigned long long*>(bytes + sorted_offset_);
+    auto* unique = reinterpret_cast<unsigned long long*>(bytes + unique_offset_);
+    auto* num_unique = reinterpret_cast<int*>(bytes + num_unique_offset_);
+    auto* temp = bytes + temp_offset_;
+    const unsigned blocks = numBlocks(num_points_, max_threads_per_block_);
+
+    calculate_grid_cells<<<blocks, max_threads_per_block_, 0, stream>>>(inp_pos, num_points_, keys);
+    // Keys are packed by x, y, z, so their order is the lexicographical order of cells
+    sort_(stream, temp, keys, sorted);
+    unique_(stream, temp, sorted, unique, num_unique);
+    calculate_grid_write<<<blocks, max_threads_per_block_, 0, stream>>>(unique, num_unique, num_points_, out);
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
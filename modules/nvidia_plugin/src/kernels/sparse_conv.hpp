@@ -0,0 +1,97 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <cuda/stl/algorithms/device.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Convolution of features of sparse points of Open3D SparseConv and SparseConvTranspose.
+ * Input points up to the first one with negative x are put into a hash table of cells of the size of the kernel.
+ * Neighbours of each output point found in the table make the rulebook: the input point of each offset of the kernel
+ * for each output point. Then tiles of output points gather features of their inputs of each offset into shared
+ * memory, multiply them by the IC x OC slice of the kernel of the offset and write the accumulated tile once.
+ * Inputs falling into an offset of an output point which already has one are accumulated by the rulebook builder.
+ * Kernel layout is DxHxWxICxOC
+ */
+class SparseConv {
+public:
+    SparseConv(size_t num_inp_points,
+               size_t num_out_points,
+               size_t kd,
+               size_t kh,
+               size_t kw,
+               size_t in_channels,
+               size_t out_channels,
+               bool transposed,
+               size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream,
+                    const float* features,
+                    const float* inp_pos,
+                    const float* out_pos,
+                    const float* kernel,
+                    const float* offset,
+                    float* out,
+                    void* workspace) const;
+
+    /**
+     * @returns Size of the workspace of the hash table and the rulebook
+     */
+    size_t workspaceSize() const { return workspace_size_; }
+
+private:
+    size_t num_inp_points_;
+    size_t num_out_points_;
+    size_t kd_;
+    size_t kh_;
+    size_t kw_;
+    size_t in_channels_;
+    size_t out_channels_;
+    bool transposed_;
+    size_t max_threads_per_block_;
+    size_t hash_capacity_;
+    size_t keys_offset_;
+    size_t heads_offset_;
+    size_t next_offset_;
+    size_t rulebook_offset_;
+    size_t workspace_size_;
+};
+
+/**
+ * Grid of Open3D CalculateGrid: sorted unique even cells around input points shifted by 0.5, followed by zeros
+ * and -1 as x of the point after the last one. Candidate cells are sorted by radix sort of their packed keys,
+ * so coordinates should be less than 2^21
+ */
+class CalculateGrid {
+public:
+    CalculateGrid(size_t num_points, size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const float* inp_pos, float* out, void* workspace) const;
+
+    size_t workspaceSize() const { return workspace_size_; }
+
+private:
+    size_t num_points_;
+    size_t max_threads_per_block_;
+    size_t sorted_offset_;
+    size_t unique_offset_;
+    size_t num_unique_offset_;
+    size_t temp_offset_;
+    size_t temp_size_;
+    size_t workspace_size_;
+    CUDA::algorithms::device::RadixSortKeys<unsigned long long> sort_;
+    CUDA::algorithms::device::Unique<unsigned long long> unique_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,79 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cstdint>
+
+#include "details/error.hpp"
+#include "details/tensor_helpers.hpp"
+#include "sub_pixel_shuffle.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+template <typename T>
+__global__ void sub_pixel_shuffle(const SubPixelShuffle::Params p, const size_t num_elements, const T* x, T* y) {
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= num_elements) {
+        return;
+    }
+    const size_t ox = i % p.out_width;
+    const size_t oy = i / p.out_width % p.out_height;
+    const size_t c = i / (p.out_width * p.out_height) % p.channels;
+    const size_t n = i / (p.out_width * p.out_height * p.channels);
+    const size_t sy = oy + p.begin_y;
+    const size_t sx = ox + p.begin_x;
+    const size_t in_channel = (sy % p.block_size * p.block_size + sx % p.block_size) * p.channels + c;
+    const size_t in_channels = p.block_size * p.block_size * p.channels;
+    y[i] = x[((n * in_channels + in_channel) * p.in_height + sy / p.block_size) * p.in_width + sx / p.block_size];
+}
+
+}  // namespace
+
+SubPixelShuffle::SubPixelShuffle(const Params& params, const size_t max_threads_per_block)
+    : params_{params},
+      num_elements_{params.batch * params.channels * params.out_height * params.out_width},
+      max_threads_per_block_{max_threads_per_block} {
+    if (params_.element_size != 1 && params_.element_size != 2 && params_.element_size != 4 &&
+        params_.element_size != 8) {
+        throw_ov_exception(fmt::format("Element size = {} is not supported by SubPixelShuffle operation !!",
+                                       params_.element_size));
+    }
+    if (params_.block_size == 0 || params_.begin_y + params_.out_height > params_.in_height * params_.block_size ||
+        params_.begin_x + params_.out_width > params_.in_width * params_.block_size) {
+        throw_ov_exception("Crop of SubPixelShuffle operation is out of the shuffled input !!");
+    }
+}
+
+void SubPixelShuffle::operator()(const cudaStream_t stream, const void* x, void* y) const {
+    switch (params_.element_size) {
+        case 1:
+            return call<std::uint8_t>(stream, x, y);
+        case 2:
+            return call<std::uint16_t>(stream, x, y);
+        case 4:
+            return call<std::uint32_t>(stream, x, y);
+        default:
+            return call<std::uint64_t>(stream, x, y);
+    }
+}
+
+template <typename T>
+void SubPixelShuffle::call(const cudaStream_t stream, const void* x, void* y) const {
+    if (num_elements_ == 0) {
+        return;
+    }
+    const auto [num_blocks, threads_per_block] = calculateElementwiseGrid(num_elements_, max_threads_per_block_);
+    sub_pixel_shuffle<T><<<num_blocks, threads_per_block, 0, stream>>>(
+        params_, num_elements_, static_cast<const T*>(x), static_cast<T*>(y));
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
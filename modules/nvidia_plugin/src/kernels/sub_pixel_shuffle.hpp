@@ -0,0 +1,51 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Depth-to-space shuffle of blocks first followed by a crop, of elements of 1, 2, 4 or 8 bytes:
+ *   y[n, c, oy, ox] = x[n, (sy % s * s + sx % s) * C + c, sy / s, sx / s], sy = oy + begin_y, sx = ox + begin_x
+ * where x is [N, s * s * C, H, W] and y is [N, C, out_height, out_width]. Every output element is read and written
+ * once, writes are coalesced
+ */
+class SubPixelShuffle {
+public:
+    struct Params {
+        size_t element_size;
+        size_t batch;
+        size_t channels;
+        size_t in_height;
+        size_t in_width;
+        size_t out_height;
+        size_t out_width;
+        size_t block_size;
+        size_t begin_y;
+        size_t begin_x;
+    };
+
+    SubPixelShuffle(const Params& params, size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const void* x, void* y) const;
+
+private:
+    template <typename T>
+    void call(cudaStream_t stream, const void* x, void* y) const;
+
+    Params params_;
+    size_t num_elements_;
+    size_t max_threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
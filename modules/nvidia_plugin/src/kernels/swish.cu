@@ -12,15 +12,16 @@ namespace nvidia_gpu {
 namespace kernel {
 
 namespace cumath = CUDA::math;
-template <typename T>
+template <typename T, bool Fast>
 struct SwishOpImpl {
     __device__ static inline T op(T x, double beta) {
-        return x / (static_cast<T>(1.0f) + cumath::exp(-x * static_cast<T>(beta)));
+        const T arg = -x * static_cast<T>(beta);
+        return x / (static_cast<T>(1.0f) + (Fast ? cumath::fast::exp(arg) : cumath::exp(arg)));
     }
 };
 
-Swish::Swish(Type_t element_type, size_t max_threads_per_block, size_t num_elements, double beta)
-    : ewu_{element_type, max_threads_per_block, num_elements}, beta_{beta} {}
+Swish::Swish(Type_t element_type, size_t max_threads_per_block, size_t num_elements, double beta, bool fast_math)
+    : ewu_{element_type, max_threads_per_block, num_elements, fast_math}, beta_{beta} {}
 
 void Swish::operator()(cudaStream_t stream, const void* in, void* out) const { ewu_(stream, in, out, beta_); }
 
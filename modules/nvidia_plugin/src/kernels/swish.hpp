@@ -11,19 +11,19 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
-template <typename T>
+template <typename T, bool Fast>
 struct SwishOpImpl;
 
 class Swish {
 public:
-    Swish(Type_t element_type, size_t max_threads_per_block, size_t num_elements, double beta);
+    Swish(Type_t element_type, size_t max_threads_per_block, size_t num_elements, double beta, bool fast_math = false);
     Swish(Swish&&) = default;
     Swish& operator=(Swish&&) = default;
 
     void operator()(cudaStream_t stream, const void* in, void* out) const;
 
 private:
-    ElementwiseUnary<FloatElementTypesSwitch, SwishOpImpl> ewu_;
+    ElementwiseUnaryMath<FloatElementTypesSwitch, SwishOpImpl> ewu_;
     double beta_;
 };
 
@@ -0,0 +1,25 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tanh.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace cumath = CUDA::math;
+
+template <typename T, bool Fast>
+struct TanhOpImpl {
+    __device__ static inline T op(T x) { return Fast ? cumath::fast::tanh(x) : cumath::tanh(x); }
+};
+
+Tanh::Tanh(Type_t element_type, size_t max_threads_per_block, size_t num_elements, bool fast_math)
+    : impl_{element_type, max_threads_per_block, num_elements, fast_math} {}
+
+void Tanh::operator()(cudaStream_t stream, const void* in0, void* out) const { impl_(stream, in0, out); }
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
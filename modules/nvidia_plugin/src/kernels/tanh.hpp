@@ -0,0 +1,31 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "details/cuda_type_traits.hpp"
+#include "details/elementwise_unary.cuh"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename T, bool Fast>
+struct TanhOpImpl;
+/**
+ * Elementwise Tanh, which replaces cuDNN activation when fast math is enabled
+ */
+class Tanh {
+public:
+    Tanh(Type_t element_type, size_t max_threads_per_block, size_t num_elements, bool fast_math = false);
+
+    void operator()(cudaStream_t stream, const void* in0, void* out) const;
+
+private:
+    ElementwiseUnaryMath<FloatElementTypesSwitch, TanhOpImpl> impl_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
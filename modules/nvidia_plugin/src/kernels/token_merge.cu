@@ -0,0 +1,448 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/float16.hpp>
+#include <limits>
+
+#include "details/error.hpp"
+#include "token_merge.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned warps_per_block = 4;
+// Tiles of similarities are 32 x 32, each thread computes rows_per_thread of them
+constexpr unsigned tile = 32;
+constexpr unsigned rows_per_thread = 4;
+constexpr unsigned rank_threads = 1024;
+constexpr unsigned merge_threads = 256;
+
+__device__ __forceinline__ float warp_sum(float value) {
+    for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+        value += __shfl_xor_sync(0xFFFFFFFF, value, offset);
+    }
+    return value;
+}
+
+}  // namespace
+
+struct TokenMerge::Workbuffer {
+    float* inverse_norms;     // [batch, tokens]
+    float* best_scores;       // [batch, even tokens]
+    unsigned* matches;        // [batch, even tokens], odd token with the best score
+    unsigned* ranks;          // [batch, even tokens], rank of the best score in descending order
+    unsigned* unmerged;       // [batch, even tokens - r], even tokens in the order of outputs
+    unsigned* offsets;        // [batch, odd tokens + 1], offsets of merged tokens of each odd token
+    unsigned* merged;         // [batch, r], merged even tokens grouped by their matches
+};
+
+/**
+ * Each warp computes the inverse L2 norm of the metric of a token
+ */
+template <typename T>
+static __global__ void inverse_norms(size_t rows, unsigned channels, const T* metric, float* inverse_norms) {
+    const size_t row = static_cast<size_t>(blockIdx.x) * warps_per_block + threadIdx.x / warp_size;
+    const unsigned lane = threadIdx.x % warp_size;
+    if (row >= rows) {
+        return;
+    }
+    float sum = 0.0f;
+    for (unsigned c = lane; c < channels; c += warp_size) {
+        const float value = static_cast<float>(metric[row * channels + c]);
+        sum += value * value;
+    }
+    sum = warp_sum(sum);
+    if (lane == 0) {
+        inverse_norms[row] = rsqrtf(sum);
+    }
+}
+
+/**
+ * Block (tile x tile / rows_per_thread threads) computes cosine similarities of a tile of even tokens with all odd
+ * tokens of the sample tile by tile and keeps the best match of each even token. Lanes of a warp compute similarities
+ * of the same even tokens with consecutive odd tokens, so the best match is reduced over the warp
+ */
+template <typename T>
+static __global__ void match(unsigned tokens,
+                             unsigned channels,
+                             unsigned even_tokens,
+                             unsigned odd_tokens,
+                             bool class_token,
+                             const T* metric,
+                             const float* inverse_norms,
+                             float* best_scores,
+                             unsigned* matches) {
+    __shared__ float even_tile[tile][tile + 1];
+    __shared__ float odd_tile[tile][tile + 1];
+    const unsigned sample = blockIdx.y;
+    const unsigned first_even = blockIdx.x * tile;
+    const T* sample_metric = metric + static_cast<size_t>(sample) * tokens * channels;
+    const float* sample_norms = inverse_norms + static_cast<size_t>(sample) * tokens;
+    const unsigned lane = threadIdx.x;
+    const unsigned warp = threadIdx.y;
+    constexpr unsigned warps = tile / rows_per_thread;
+
+    float best[rows_per_thread];
+    unsigned best_match[rows_per_thread];
+#pragma unroll
+    for (unsigned k = 0; k < rows_per_thread; ++k) {
+        best[k] = -INFINITY;
+        best_match[k] = 0;
+    }
+    for (unsigned first_odd = 0; first_odd < odd_tokens; first_odd += tile) {
+        float dot[rows_per_thread] = {};
+        for (unsigned first_channel = 0; first_channel < channels; first_channel += tile) {
+            const unsigned channel = first_channel + lane;
+#pragma unroll
+            for (unsigned k = 0; k < rows_per_thread; ++k) {
+                const unsigned row = warp + k * warps;
+                const unsigned even = first_even + row;
+                const unsigned odd = first_odd + row;
+                even_tile[row][lane] =
+                    even < even_tokens && channel < channels
+                        ? static_cast<float>(sample_metric[static_cast<size_t>(2 * even) * channels + channel])
+                        : 0.0f;
+                odd_tile[row][lane] =
+                    odd < odd_tokens && channel < channels
+                        ? static_cast<float>(sample_metric[static_cast<size_t>(2 * odd + 1) * channels + channel])
+                        : 0.0f;
+            }
+            __syncthreads();
+#pragma unroll 8
+            for (unsigned c = 0; c < tile; ++c) {
+                const float odd_value = odd_tile[lane][c];
+#pragma unroll
+                for (unsigned k = 0; k < rows_per_thread; ++k) {
+                    dot[k] += even_tile[warp + k * warps][c] * odd_value;
+                }
+            }
+            __syncthreads();
+        }
+        const unsigned odd = first_odd + lane;
+        if (odd < odd_tokens) {
+            const float odd_norm = sample_norms[2 * odd + 1];
+#pragma unroll
+            for (unsigned k = 0; k < rows_per_thread; ++k) {
+                const unsigned even = first_even + warp + k * warps;
+                if (even < even_tokens) {
+                    const float score = dot[k] * sample_norms[2 * even] * odd_norm;
+                    if (score > best[k]) {
+                        best[k] = score;
+                        best_match[k] = odd;
+                    }
+                }
+            }
+        }
+    }
+#pragma unroll
+    for (unsigned k = 0; k < rows_per_thread; ++k) {
+        // The first of equally similar odd tokens is the match
+        for (unsigned offset = warp_size / 2; offset > 0; offset /= 2) {
+            const float other = __shfl_xor_sync(0xFFFFFFFF, best[k], offset);
+            const unsigned other_match = __shfl_xor_sync(0xFFFFFFFF, best_match[k], offset);
+            if (other > best[k] || (other == best[k] && other_match < best_match[k])) {
+                best[k] = other;
+                best_match[k] = other_match;
+            }
+        }
+        const unsigned even = first_even + warp + k * warps;
+        if (lane == 0 && even < even_tokens) {
+            // The class token is never merged, so it has the lowest score
+            const size_t index = static_cast<size_t>(sample) * even_tokens + even;
+            best_scores[index] = class_token && even == 0 ? -INFINITY : best[k];
+            matches[index] = class_token && even == 0 ? 0 : best_match[k];
+        }
+    }
+}
+
+/**
+ * Block of a sample ranks its even tokens by their best scores (descending, the first of equal scores first), selects
+ * r best ones to be merged, places the rest in the order of outputs and groups merged tokens by their matches
+ */
+static __global__ void rank(unsigned even_tokens,
+                            unsigned odd_tokens,
+                            unsigned num_merged,
+                            bool class_token,
+                            const float* best_scores,
+                            const unsigned* matches,
+                            unsigned* ranks,
+                            unsigned* unmerged,
+                            unsigned* offsets,
+                            unsigned* merged) {
+    const unsigned sample = blockIdx.x;
+    best_scores += static_cast<size_t>(sample) * even_tokens;
+    matches += static_cast<size_t>(sample) * even_tokens;
+    ranks += static_cast<size_t>(sample) * even_tokens;
+    unmerged += static_cast<size_t>(sample) * (even_tokens - num_merged);
+    offsets += static_cast<size_t>(sample) * (odd_tokens + 1);
+    merged += static_cast<size_t>(sample) * num_merged;
+
+    for (unsigned i = threadIdx.x; i < even_tokens; i += blockDim.x) {
+        const float score = best_scores[i];
+        unsigned rank = 0;
+        for (unsigned j = 0; j < even_tokens; ++j) {
+            const float other = best_scores[j];
+            rank += other > score || (other == score && j < i);
+        }
+        ranks[i] = rank;
+    }
+    for (unsigned j = threadIdx.x; j <= odd_tokens; j += blockDim.x) {
+        offsets[j] = 0;
+    }
+    __syncthreads();
+
+    for (unsigned i = threadIdx.x; i < even_tokens; i += blockDim.x) {
+        const unsigned rank = ranks[i];
+        if (rank < num_merged) {
+            atomicAdd(offsets + matches[i] + 1, 1u);
+            continue;
+        }
+        // Unmerged tokens follow the class token in their original order, otherwise they are in the order of scores
+        unsigned position = rank - num_merged;
+        if (class_token) {
+            position = 0;
+            for (unsigned j = 0; j < i; ++j) {
+                position += ranks[j] >= num_merged;
+            }
+        }
+        unmerged[position] = i;
+    }
+    __syncthreads();
+
+    // Counts of merged tokens are turned into offsets by the first warp
+    if (threadIdx.x < warp_size) {
+        unsigned carry = 0;
+        for (unsigned first = 1; first <= odd_tokens; first += warp_size) {
+            const unsigned j = first + threadIdx.x;
+            unsigned value = j <= odd_tokens ? offsets[j] : 0;
+            for (unsigned offset = 1; offset < warp_size; offset *= 2) {
+                const unsigned other = __shfl_up_sync(0xFFFFFFFF, value, offset);
+                value += threadIdx.x >= offset ? other : 0;
+            }
+            if (j <= odd_tokens) {
+                offsets[j] = value + carry;
+            }
+            carry += __shfl_sync(0xFFFFFFFF, value, warp_size - 1);
+        }
+    }
+    __syncthreads();
+
+    for (unsigned i = threadIdx.x; i < even_tokens; i += blockDim.x) {
+        if (ranks[i] >= num_merged) {
+            continue;
+        }
+        const unsigned destination = matches[i];
+        unsigned slot = offsets[destination];
+        for (unsigned j = 0; j < i; ++j) {
+            slot += ranks[j] < num_merged && matches[j] == destination;
+        }
+        merged[slot] = i;
+    }
+}
+
+/**
+ * Block computes an output token: an unmerged even token is copied, an odd token is averaged with tokens merged into
+ * it weighted by their sizes
+ */
+template <typename T>
+static __global__ void merge(unsigned tokens,
+                             unsigned channels,
+                             unsigned even_tokens,
+                             unsigned odd_tokens,
+                             unsigned num_merged,
+                             const T* x,
+                             const T* size,
+                             const unsigned* unmerged,
+                             const unsigned* offsets,
+                             const unsigned* merged,
+                             T* y,
+                             T* y_size) {
+    const unsigned output = blockIdx.x;
+    const unsigned sample = blockIdx.y;
+    const unsigned num_unmerged = even_tokens - num_merged;
+    const unsigned output_tokens = tokens - num_merged;
+    const T* sample_x = x + static_cast<size_t>(sample) * tokens * channels;
+    const T* sample_size = size + static_cast<size_t>(sample) * tokens;
+    const size_t output_index = static_cast<size_t>(sample) * output_tokens + output;
+    T* y_token = y + output_index * channels;
+
+    if (output < num_unmerged) {
+        const unsigned token = 2 * unmerged[static_cast<size_t>(sample) * num_unmerged + output];
+        for (unsigned c = threadIdx.x; c < channels; c += blockDim.x) {
+            y_token[c] = sample_x[static_cast<size_t>(token) * channels + c];
+        }
+        if (threadIdx.x == 0) {
+            y_size[output_index] = sample_size[token];
+        }
+        return;
+    }
+    const unsigned odd = output - num_unmerged;
+    const unsigned token = 2 * odd + 1;
+    const unsigned* sample_offsets = offsets + static_cast<size_t>(sample) * (odd_tokens + 1);
+    const unsigned* sample_merged = merged + static_cast<size_t>(sample) * num_merged;
+    const unsigned begin = sample_offsets[odd];
+    const unsigned end = sample_offsets[odd + 1];
+
+    float total_size = static_cast<float>(sample_size[token]);
+    for (unsigned k = begin; k < end; ++k) {
+        total_size += static_cast<float>(sample_size[2 * sample_merged[k]]);
+    }
+    const float inverse_size = 1.0f / total_size;
+    for (unsigned c = threadIdx.x; c < channels; c += blockDim.x) {
+        float sum = static_cast<float>(sample_x[static_cast<size_t>(token) * channels + c]) *
+                    static_cast<float>(sample_size[token]);
+        for (unsigned k = begin; k < end; ++k) {
+            const unsigned source = 2 * sample_merged[k];
+            sum += static_cast<float>(sample_x[static_cast<size_t>(source) * channels + c]) *
+                   static_cast<float>(sample_size[source]);
+        }
+        y_token[c] = static_cast<T>(sum * inverse_size);
+    }
+    if (threadIdx.x == 0) {
+        y_size[output_index] = static_cast<T>(total_size);
+    }
+}
+
+TokenMerge::TokenMerge(Type_t element_type,
+                       size_t batch,
+                       size_t tokens,
+                       size_t metric_channels,
+                       size_t channels,
+                       size_t num_merged,
+                       bool class_token)
+    : element_type_{element_type},
+      batch_{batch},
+      tokens_{tokens},
+      metric_channels_{metric_channels},
+      channels_{channels},
+      num_merged_{num_merged},
+      class_token_{class_token} {
+    switch (element_type_) {
+        case Type_t::f32:
+        case Type_t::f16:
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+            break;
+        default:
+            throw_ov_exception(
+                fmt::format("Element type = {} is not supported by TokenMerge operation !!", element_type_));
+    }
+    if (num_merged_ == 0 || num_merged_ > (tokens_ - (class_token_ ? 1 : 0)) / 2) {
+        throw_ov_exception(
+            fmt::format("{} of {} tokens can't be merged by TokenMerge operation !!", num_merged_, tokens_));
+    }
+    if (tokens_ * std::max(metric_channels_, channels_) > std::numeric_limits<unsigned>::max()) {
+        throw_ov_exception(fmt::format("Sample of {} tokens is too large for TokenMerge operation !!", tokens_));
+    }
+}
+
+TokenMerge::Workbuffer TokenMerge::layout(void* workbuffer) const {
+    const size_t even_tokens = (tokens_ + 1) / 2;
+    const size_t odd_tokens = tokens_ / 2;
+    auto* data = static_cast<unsigned*>(workbuffer);
+    auto take = [&data](size_t count) {
+        auto* taken = data;
+        data += count;
+        return taken;
+    };
+    Workbuffer buffers{};
+    buffers.inverse_norms = reinterpret_cast<float*>(take(batch_ * tokens_));
+    buffers.best_scores = reinterpret_cast<float*>(take(batch_ * even_tokens));
+    buffers.matches = take(batch_ * even_tokens);
+    buffers.ranks = take(batch_ * even_tokens);
+    buffers.unmerged = take(batch_ * (even_tokens - num_merged_));
+    buffers.offsets = take(batch_ * (odd_tokens + 1));
+    buffers.merged = take(batch_ * num_merged_);
+    return buffers;
+}
+
+size_t TokenMerge::workbuffer_size() const {
+    const size_t even_tokens = (tokens_ + 1) / 2;
+    const size_t odd_tokens = tokens_ / 2;
+    const size_t elements = batch_ * (tokens_ + 4 * even_tokens + odd_tokens + 1);
+    static_assert(sizeof(float) == sizeof(unsigned));
+    return elements * sizeof(unsigned);
+}
+
+void TokenMerge::operator()(cudaStream_t stream,
+                            const void* metric,
+                            const void* x,
+                            const void* size,
+                            void* workbuffer,
+                            void* y,
+                            void* y_size) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return call<__half>(stream, metric, x, size, workbuffer, y, y_size);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return call<__nv_bfloat16>(stream, metric, x, size, workbuffer, y, y_size);
+#endif
+        default:
+            return call<float>(stream, metric, x, size, workbuffer, y, y_size);
+    }
+}
+
+template <typename T>
+void TokenMerge::call(cudaStream_t stream,
+                      const void* metric,
+                      const void* x,
+                      const void* size,
+                      void* workbuffer,
+                      void* y,
+                      void* y_size) const {
+    const auto buffers = layout(workbuffer);
+    const auto even_tokens = static_cast<unsigned>((tokens_ + 1) / 2);
+    const auto odd_tokens = static_cast<unsigned>(tokens_ / 2);
+    const size_t rows = batch_ * tokens_;
+    const auto norm_blocks = static_cast<unsigned>((rows + warps_per_block - 1) / warps_per_block);
+    inverse_norms<T><<<norm_blocks, warps_per_block * warp_size, 0, stream>>>(
+        rows, static_cast<unsigned>(metric_channels_), static_cast<const T*>(metric), buffers.inverse_norms);
+    const dim3 match_grid{(even_tokens + tile - 1) / tile, static_cast<unsigned>(batch_)};
+    const dim3 match_block{warp_size, tile / rows_per_thread};
+    match<T><<<match_grid, match_block, 0, stream>>>(static_cast<unsigned>(tokens_),
+                                                     static_cast<unsigned>(metric_channels_),
+                                                     even_tokens,
+                                                     odd_tokens,
+                                                     class_token_,
+                                                     static_cast<const T*>(metric),
+                                                     buffers.inverse_norms,
+                                                     buffers.best_scores,
+                                                     buffers.matches);
+    rank<<<static_cast<unsigned>(batch_), rank_threads, 0, stream>>>(even_tokens,
+                                              odd_tokens,
+                                              static_cast<unsigned>(num_merged_),
+                                              class_token_,
+                                              buffers.best_scores,
+                                              buffers.matches,
+                                              buffers.ranks,
+                                              buffers.unmerged,
+                                              buffers.offsets,
+                                              buffers.merged);
+    const dim3 merge_grid{static_cast<unsigned>(tokens_ - num_merged_), static_cast<unsigned>(batch_)};
+    merge<T><<<merge_grid, merge_threads, 0, stream>>>(static_cast<unsigned>(tokens_),
+                                                       static_cast<unsigned>(channels_),
+                                                       even_tokens,
+                                                       odd_tokens,
+                                                       static_cast<unsigned>(num_merged_),
+                                                       static_cast<const T*>(x),
+                                                       static_cast<const T*>(size),
+                                                       buffers.unmerged,
+                                                       buffers.offsets,
+                                                       buffers.merged,
+                                                       static_cast<T*>(y),
+                                                       static_cast<T*>(y_size));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
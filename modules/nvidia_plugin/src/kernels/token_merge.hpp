@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "details/cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Merges r of tokens [batch, tokens, channels] by bipartite soft matching of their metric [batch, tokens,
+ * metric_channels] and averages merged tokens weighted by their sizes [batch, tokens, 1] (see nodes::TokenMerge).
+ * Cosine similarities of even and odd tokens are computed by a tiled matrix product fused with the argmax over odd
+ * tokens, so the matrix of similarities isn't stored. Tokens of each sample are ranked by their best similarities
+ * and the merged ones are grouped by their destination in ascending order, so that sums are deterministic
+ */
+class TokenMerge {
+public:
+    TokenMerge(Type_t element_type,
+               size_t batch,
+               size_t tokens,
+               size_t metric_channels,
+               size_t channels,
+               size_t num_merged,
+               bool class_token);
+    TokenMerge(TokenMerge&&) = default;
+    TokenMerge& operator=(TokenMerge&&) = default;
+
+    /**
+     * @returns Size of the mutable workbuffer in bytes, which keeps matches and ranks of tokens
+     */
+    size_t workbuffer_size() const;
+
+    void operator()(cudaStream_t stream,
+                    const void* metric,
+                    const void* x,
+                    const void* size,
+                    void* workbuffer,
+                    void* y,
+                    void* y_size) const;
+
+private:
+    struct Workbuffer;
+
+    template <typename T>
+    void call(cudaStream_t stream,
+              const void* metric,
+              const void* x,
+              const void* size,
+              void* workbuffer,
+              void* y,
+              void* y_size) const;
+
+    Workbuffer layout(void* workbuffer) const;
+
+    Type_t element_type_{};
+    size_t batch_{};
+    size_t tokens_{};
+    size_t metric_channels_{};
+    size_t channels_{};
+    size_t num_merged_{};
+    bool class_token_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -2,10 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 #include <cuda/float16.hpp>
+#include <limits>
+#include <type_traits>
 
+#include "cuda/stl/algorithms/block.cuh"
 #include "cuda/stl/algorithms/sort.cuh"
 #include "details/error.hpp"
 #include "details/tensor_helpers.hpp"
@@ -110,6 +114,113 @@ __global__ void topk_store(TValue* out_val,
     out_idx[output_index] = workspace[workspace_index].second;
 }
 
+constexpr unsigned kWarpSize = CUDA::algorithms::block::kWarpSize;
+
+/**
+ * @returns true if the first selected element goes before the second one in the output
+ */
+template <TopK::SortType Sort, typename Key, typename TIdx>
+__device__ inline bool precedes(Key a_key, TIdx a_index, Key b_key, TIdx b_index) {
+    if (Sort == TopK::SortType::SortIndices) {
+        return a_index < b_index;
+    }
+    return a_key > b_key || (a_key == b_key && a_index < b_index);
+}
+
+template <TopK::ComputeType Compute, TopK::SortType Sort, typename T, typename TIdx>
+__global__ void topk_block_select(const T* in,
+                                  T* out_val,
+                                  TIdx* out_idx,
+                                  const std::size_t chunk_size,
+                                  const std::size_t k,
+                                  const std::size_t sorted_size,
+                                  const TopK::KernelParam* kernel_param) {
+    using Key = typename CUDA::algorithms::OrderedKey<T>::type;
+    extern __shared__ __align__(sizeof(std::uint64_t)) unsigned char shared_memory[];
+    Key* keys = reinterpret_cast<Key*>(shared_memory);
+    TIdx* indices = reinterpret_cast<TIdx*>(
+        shared_memory + (sorted_size * sizeof(Key) + sizeof(TIdx) - 1) / sizeof(TIdx) * sizeof(TIdx));
+    __shared__ unsigned num_better;
+
+    const std::size_t row = blockIdx.x;
+    TopKShape indexes{};
+    calculate_indexes_by_flat_address(indexes, row * chunk_size, kernel_param->input_shape_axis);
+    const std::size_t in_base = flat_address_by_strides(kernel_param->input_strides, indexes);
+    const std::size_t in_stride = kernel_param->input_strides[rank(kernel_param->input_strides) - 1];
+    // Better elements have greater keys in both modes
+    const auto key_of = [&](std::size_t j) {
+        const Key key = CUDA::algorithms::OrderedKey<T>::get(in[in_base + j * in_stride]);
+        return Compute == TopK::ComputeType::Max ? key : static_cast<Key>(~key);
+    };
+
+    if (threadIdx.x == 0) {
+        num_better = 0;
+    }
+    const auto selection = CUDA::algorithms::block::radix_select<Key>(key_of, chunk_size, k);
+
+    // All keys greater than the k-th best one are selected, equal keys are selected in the order of indices
+    const Key threshold = selection.threshold;
+    const std::size_t num_equal = selection.num_equal;
+    const std::size_t first_equal = k - num_equal;
+    std::size_t taken_equal = 0;
+    for (std::size_t base = 0; base < chunk_size; base += blockDim.x) {
+        const std::size_t j = base + threadIdx.x;
+        const bool valid = j < chunk_size;
+        const Key key = valid ? key_of(j) : Key{0};
+        if (valid && key > threshold) {
+            const unsigned slot = atomicAdd(&num_better, 1u);
+            keys[slot] = key;
+            indices[slot] = static_cast<TIdx>(j);
+        }
+        const bool equal = valid && key == threshold;
+        unsigned block_equal = 0;
+        const std::size_t ordinal = taken_equal + CUDA::algorithms::block::exclusive_count(equal, block_equal);
+        if (equal && ordinal < num_equal) {
+            keys[first_equal + ordinal] = key;
+            indices[first_equal + ordinal] = static_cast<TIdx>(j);
+        }
+        taken_equal += block_equal;
+    }
+
+    // Bitonic sort of the selected elements padded by elements, which go after all of them
+    for (std::size_t i = k + threadIdx.x; i < sorted_size; i += blockDim.x) {
+        keys[i] = 0;
+        indices[i] = std::numeric_limits<TIdx>::max();
+    }
+    __syncthreads();
+    for (std::size_t size = 2; size <= sorted_size; size *= 2) {
+        for (std::size_t stride = size / 2; stride > 0; stride /= 2) {
+            for (std::size_t i = threadIdx.x; i < sorted_size; i += blockDim.x) {
+                const std::size_t partner = i ^ stride;
+                if (partner <= i) {
+                    continue;
+                }
+                const bool ascending = (i & size) == 0;
+                const bool swap = ascending ? precedes<Sort>(keys[partner], indices[partner], keys[i], indices[i])
+                                            : precedes<Sort>(keys[i], indices[i], keys[partner], indices[partner]);
+                if (swap) {
+                    const Key key = keys[i];
+                    keys[i] = keys[partner];
+                    keys[partner] = key;
+                    const TIdx index = indices[i];
+                    indices[i] = indices[partner];
+                    indices[partner] = index;
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    calculate_indexes_by_flat_address(indexes, row * k, kernel_param->output_shape_axis);
+    const std::size_t out_base = flat_address_by_strides(kernel_param->output_strides, indexes);
+    const std::size_t out_stride = kernel_param->output_strides[rank(kernel_param->output_strides) - 1];
+    for (std::size_t i = threadIdx.x; i < k; i += blockDim.x) {
+        const TIdx index = indices[i];
+        out_val[out_base + i * out_stride] = in[in_base + index * in_stride];
+        out_idx[out_base + i * out_stride] = index;
+    }
+}
+
 TopK::TopK(const Type_t element_type,
            const Type_t index_element_type,
            const TopK::ComputeType compute_type,
@@ -127,7 +238,10 @@ TopK::TopK(const Type_t element_type,
       num_output_element_{num_output_element},
       k_{k},
       workspace_chunks_{num_input_element / workspace_chunk_size},
-      workspace_chunk_size_{workspace_chunk_size} {
+      workspace_chunk_size_{workspace_chunk_size},
+      block_select_{k <= kMaxBlockSelectK && k <= workspace_chunk_size &&
+                    workspace_chunk_size >= kMinBlockSelectChunkSize},
+      sorted_size_{1} {
     using TopKElementTypesSwitch = ElementTypesSwitch<Type_t::f16,
 #ifdef CUDA_HAS_BF16_TYPE
                                                       Type_t::bf16,
@@ -152,8 +266,19 @@ TopK::TopK(const Type_t element_type,
 
     store_.num_blocks_ = (num_output_element + max_threads_per_block - 1) / max_threads_per_block;
     store_.threads_per_block_ = (store_.num_blocks_ == 1) ? num_output_element : max_threads_per_block;
+
+    while (sorted_size_ < k_) {
+        sorted_size_ *= 2;
+    }
+    // Whole warps are needed to take equal elements in the order of indices
+    const std::size_t max_warps = max_threads_per_block / kWarpSize;
+    select_.num_blocks_ = workspace_chunks_;
+    select_.threads_per_block_ =
+        std::min((workspace_chunk_size_ + kWarpSize - 1) / kWarpSize, max_warps) * kWarpSize;
 }
 
+bool TopK::usesWorkspace() const { return !block_select_; }
+
 template <typename TElementType>
 void TopK::callKernelByElementType(cudaStream_t stream,
                                    const void* in,
@@ -242,6 +367,24 @@ void TopK::callKernelBySortType(cudaStream_t stream,
                                 void* workspace,
                                 const void* kernel_param) const {
     const KernelParam* kernel_param_ptr = static_cast<const KernelParam*>(kernel_param);
+    if (block_select_) {
+        using Key = typename OrderedKey<TElementType>::type;
+        const std::size_t keys_size =
+            (sorted_size_ * sizeof(Key) + sizeof(TIndexElementType) - 1) / sizeof(TIndexElementType) *
+            sizeof(TIndexElementType);
+        const std::size_t shared_size = keys_size + sorted_size_ * sizeof(TIndexElementType);
+        topk_block_select<ComputeType, SortType>
+            <<<select_.num_blocks_, select_.threads_per_block_, shared_size, stream>>>(
+                static_cast<const TElementType*>(in),
+                static_cast<TElementType*>(out_value),
+                static_cast<TIndexElementType*>(out_index),
+                workspace_chunk_size_,
+                k_,
+                sorted_size_,
+                kernel_param_ptr);
+        throwIfError(cudaPeekAtLastError());
+        return;
+    }
     topk_preprocess<<<preprocess_.num_blocks_, preprocess_.threads_per_block_, 0, stream>>>(
         static_cast<const TElementType*>(in),
         static_cast<CUDA::Pair<TElementType, TIndexElementType>*>(workspace),
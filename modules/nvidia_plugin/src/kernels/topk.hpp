@@ -11,6 +11,12 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
+/**
+ * Selects k best elements of every chunk along the axis. Chunks of at least kMinBlockSelectChunkSize elements with
+ * k <= kMaxBlockSelectK are processed by one block each: the k-th best value is found by radix-select over the
+ * digits of order-preserving keys, then the selected elements are sorted by bitonic sort in shared memory.
+ * Other chunks are copied into the workspace and are sorted by one thread each
+ */
 class TopK {
 public:
     enum class SortType {
@@ -25,6 +31,8 @@ public:
     };
 
     static constexpr size_t kNumKernelParamDim = 5;
+    static constexpr size_t kMaxBlockSelectK = 1024;
+    static constexpr size_t kMinBlockSelectChunkSize = 64;
     struct KernelParam {
         size_t input_shape_axis[kNumKernelParamDim]{};
         size_t output_shape_axis[kNumKernelParamDim]{};
@@ -51,6 +59,11 @@ public:
                     void* workspace,
                     const void* kernel_param) const;
 
+    /**
+     * @returns true if the kernel needs the workspace of pairs of values and indices of all input elements
+     */
+    bool usesWorkspace() const;
+
 private:
     template <typename TElementType>
     void callKernelByElementType(cudaStream_t stream,
@@ -96,9 +109,12 @@ private:
     size_t input_iterations_;
     size_t workspace_chunks_;
     size_t workspace_chunk_size_;
+    bool block_select_;
+    size_t sorted_size_;
     KernelGridParam preprocess_;
     KernelGridParam sort_;
     KernelGridParam store_;
+    KernelGridParam select_;
 };
 
 }  // namespace kernel
@@ -0,0 +1,290 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+
+#include "details/error.hpp"
+#include "transpose.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned warp_size = 32;
+constexpr unsigned tile_size = 32;
+constexpr unsigned tile_rows = 8;
+constexpr unsigned max_row_block_size = 256;
+constexpr unsigned max_batch_blocks = 65535;
+
+/**
+ * Offsets of the first input and output bytes of the batch item
+ */
+__device__ __forceinline__ void batchOffsets(const Transpose::Batch& batch,
+                                             size_t index,
+                                             size_t& in_offset,
+                                             size_t& out_offset) {
+    in_offset = 0;
+    out_offset = 0;
+    for (int d = static_cast<int>(batch.rank) - 1; d >= 0; --d) {
+        const size_t coord = index % batch.sizes[d];
+        index /= batch.sizes[d];
+        in_offset += coord * batch.in_strides[d];
+        out_offset += coord * batch.out_strides[d];
+    }
+}
+
+template <typename T>
+__device__ __forceinline__ const T* offset(const void* ptr, size_t bytes) {
+    return reinterpret_cast<const T*>(static_cast<const char*>(ptr) + bytes);
+}
+
+template <typename T>
+__device__ __forceinline__ T* offset(void* ptr, size_t bytes) {
+    return reinterpret_cast<T*>(static_cast<char*>(ptr) + bytes);
+}
+
+}  // namespace
+
+/**
+ * Blocks of tile_size x tile_rows threads transpose tiles of tile_size x tile_size elements, tiles of a matrix are
+ * indexed by blockIdx.x and matrices of the batch by blockIdx.z. The tile is padded by a column, so that threads
+ * reading its columns hit different banks of shared memory
+ */
+template <typename T>
+static __global__ void transpose_tiles(Transpose::Batch batch,
+                                       size_t batch_size,
+                                       size_t rows,
+                                       size_t columns,
+                                       size_t in_row_stride,
+                                       size_t out_column_stride,
+                                       const void* x,
+                                       void* y) {
+    __shared__ T tile[tile_size][tile_size + 1];
+    const size_t tile_columns = (columns + tile_size - 1) / tile_size;
+    const size_t row0 = blockIdx.x / tile_columns * tile_size;
+    const size_t column0 = blockIdx.x % tile_columns * tile_size;
+    for (size_t item = blockIdx.z; item < batch_size; item += gridDim.z) {
+        size_t in_offset = 0;
+        size_t out_offset = 0;
+        batchOffsets(batch, item, in_offset, out_offset);
+        const T* in = offset<T>(x, in_offset);
+        T* out = offset<T>(y, out_offset);
+        for (unsigned j = threadIdx.y; j < tile_size; j += tile_rows) {
+            const size_t row = row0 + j;
+            const size_t column = column0 + threadIdx.x;
+            if (row < rows && column < columns) {
+                tile[j][threadIdx.x] = in[row * in_row_stride + column];
+            }
+        }
+        __syncthreads();
+        for (unsigned j = threadIdx.y; j < tile_size; j += tile_rows) {
+            const size_t column = column0 + j;
+            const size_t row = row0 + threadIdx.x;
+            if (row < rows && column < columns) {
+                out[column * out_column_stride + row] = tile[threadIdx.x][j];
+            }
+        }
+        __syncthreads();
+    }
+}
+
+/**
+ * Each block copies contiguous rows of the batch, T is the widest word the rows and the buffers are aligned to
+ */
+template <typename T>
+static __global__ void copy_rows(Transpose::Batch batch, size_t batch_size, size_t length, const void* x, void* y) {
+    for (size_t item = blockIdx.x; item < batch_size; item += gridDim.x) {
+        size_t in_offset = 0;
+        size_t out_offset = 0;
+        batchOffsets(batch, item, in_offset, out_offset);
+        const T* in = offset<T>(x, in_offset);
+        T* out = offset<T>(y, out_offset);
+        for (size_t i = threadIdx.x; i < length; i += blockDim.x) {
+            out[i] = in[i];
+        }
+    }
+}
+
+Transpose::Simplified Transpose::simplify(const std::vector<size_t>& shape, const std::vector<int>& permutation) {
+    // Dimensions of size 1 are dropped and the remaining ones are renumbered
+    std::vector<int> kept_index(shape.size(), -1);
+    std::vector<size_t> kept_shape;
+    for (size_t d = 0; d < shape.size(); ++d) {
+        if (shape[d] != 1) {
+            kept_index[d] = static_cast<int>(kept_shape.size());
+            kept_shape.push_back(shape[d]);
+        }
+    }
+    // Input dimensions, which follow each other in the output, are merged into groups listed in the output order
+    std::vector<std::vector<int>> groups;
+    for (const auto d : permutation) {
+        const int kept = kept_index.at(d);
+        if (kept < 0) {
+            continue;
+        }
+        if (!groups.empty() && groups.back().back() + 1 == kept) {
+            groups.back().push_back(kept);
+        } else {
+            groups.push_back({kept});
+        }
+    }
+    std::vector<size_t> input_order(groups.size());
+    std::iota(input_order.begin(), input_order.end(), 0);
+    std::sort(input_order.begin(), input_order.end(), [&groups](size_t a, size_t b) {
+        return groups[a].front() < groups[b].front();
+    });
+    Simplified result;
+    result.permutation.resize(groups.size());
+    for (size_t d = 0; d < input_order.size(); ++d) {
+        const auto& group = groups[input_order[d]];
+        result.shape.push_back(std::accumulate(group.begin(), group.end(), size_t{1}, [&kept_shape](size_t a, int g) {
+            return a * kept_shape[g];
+        }));
+        result.permutation[input_order[d]] = static_cast<int>(d);
+    }
+    return result;
+}
+
+bool Transpose::isSupported(size_t element_size,
+                            const std::vector<size_t>& shape,
+                            const std::vector<int>& permutation) {
+    if (element_size != 1 && element_size != 2 && element_size != 4 && element_size != 8) {
+        return false;
+    }
+    if (permutation.size() != shape.size()) {
+        return false;
+    }
+    std::vector<bool> used(shape.size());
+    for (const auto d : permutation) {
+        if (d < 0 || d >= static_cast<int>(shape.size()) || used[d]) {
+            return false;
+        }
+        used[d] = true;
+    }
+    return simplify(shape, permutation).shape.size() <= max_rank;
+}
+
+Transpose::Transpose(size_t element_size, const std::vector<size_t>& shape, const std::vector<int>& permutation)
+    : element_size_{element_size},
+      num_elements_{std::accumulate(shape.begin(), shape.end(), size_t{1}, std::multiplies<size_t>())} {
+    if (!isSupported(element_size, shape, permutation)) {
+        throw_ov_exception(fmt::format("Transpose: unsupported element size = {} or permutation", element_size));
+    }
+    const auto simplified = simplify(shape, permutation);
+    const auto& dims = simplified.shape;
+    const auto& perm = simplified.permutation;
+    const size_t rank = dims.size();
+    if (rank <= 1) {
+        return;
+    }
+    std::vector<size_t> in_strides(rank, 1);
+    std::vector<size_t> out_strides(rank, 1);
+    for (size_t i = rank - 1; i > 0; --i) {
+        in_strides[i - 1] = in_strides[i] * dims[i];
+    }
+    // Output strides are indexed by input dimensions
+    size_t out_stride = 1;
+    for (size_t i = rank; i > 0; --i) {
+        out_strides[perm[i - 1]] = out_stride;
+        out_stride *= dims[perm[i - 1]];
+    }
+    batch_size_ = 1;
+    auto add_to_batch = [&](size_t d) {
+        batch_.sizes[batch_.rank] = dims[d];
+        batch_.in_strides[batch_.rank] = in_strides[d] * element_size_;
+        batch_.out_strides[batch_.rank] = out_strides[d] * element_size_;
+        ++batch_.rank;
+        batch_size_ *= dims[d];
+    };
+    const size_t inner = rank - 1;
+    if (static_cast<size_t>(perm[inner]) == inner) {
+        rows_ = true;
+        row_length_ = dims[inner];
+        for (size_t d = 0; d < inner; ++d) {
+            add_to_batch(d);
+        }
+    } else {
+        tiles_ = true;
+        const size_t row_dim = perm[inner];
+        tile_rows_ = dims[row_dim];
+        tile_columns_ = dims[inner];
+        in_row_stride_ = in_strides[row_dim];
+        out_column_stride_ = out_strides[inner];
+        for (size_t d = 0; d < inner; ++d) {
+            if (d != row_dim) {
+                add_to_batch(d);
+            }
+        }
+    }
+}
+
+void Transpose::operator()(cudaStream_t stream, const void* x, void* y) const {
+    if (num_elements_ == 0) {
+        return;
+    }
+    if (tiles_) {
+        switch (element_size_) {
+            case 1:
+                return transposeTiles<std::uint8_t>(stream, x, y);
+            case 2:
+                return transposeTiles<std::uint16_t>(stream, x, y);
+            case 4:
+                return transposeTiles<std::uint32_t>(stream, x, y);
+            default:
+                return transposeTiles<std::uint64_t>(stream, x, y);
+        }
+    }
+    if (!rows_) {
+        throwIfError(cudaMemcpyAsync(y, x, num_elements_ * element_size_, cudaMemcpyDeviceToDevice, stream));
+        return;
+    }
+    // Rows are copied by the widest words of up to 16 bytes the rows and the buffers are aligned to
+    const size_t row_bytes = row_length_ * element_size_;
+    const auto alignment = reinterpret_cast<std::uintptr_t>(x) | reinterpret_cast<std::uintptr_t>(y) | row_bytes;
+    if (alignment % 16 == 0) {
+        return copyRows<uint4>(stream, x, y);
+    } else if (alignment % 8 == 0) {
+        return copyRows<std::uint64_t>(stream, x, y);
+    } else if (alignment % 4 == 0) {
+        return copyRows<std::uint32_t>(stream, x, y);
+    } else if (alignment % 2 == 0) {
+        return copyRows<std::uint16_t>(stream, x, y);
+    }
+    return copyRows<std::uint8_t>(stream, x, y);
+}
+
+template <typename T>
+void Transpose::transposeTiles(cudaStream_t stream, const void* x, void* y) const {
+    const size_t num_tiles =
+        ((tile_rows_ + tile_size - 1) / tile_size) * ((tile_columns_ + tile_size - 1) / tile_size);
+    const dim3 grid(static_cast<unsigned>(num_tiles),
+                    1,
+                    static_cast<unsigned>(std::min<size_t>(batch_size_, max_batch_blocks)));
+    const dim3 block(tile_size, tile_rows);
+    transpose_tiles<T><<<grid, block, 0, stream>>>(
+        batch_, batch_size_, tile_rows_, tile_columns_, in_row_stride_, out_column_stride_, x, y);
+    throwIfError(cudaPeekAtLastError());
+}
+
+template <typename T>
+void Transpose::copyRows(cudaStream_t stream, const void* x, void* y) const {
+    const size_t length = row_length_ * element_size_ / sizeof(T);
+    const auto block_size =
+        static_cast<unsigned>(std::min<size_t>((length + warp_size - 1) / warp_size * warp_size, max_row_block_size));
+    const auto num_blocks = static_cast<unsigned>(std::min<size_t>(batch_size_, std::numeric_limits<int>::max()));
+    copy_rows<T><<<num_blocks, block_size, 0, stream>>>(batch_, batch_size_, length, x, y);
+    throwIfError(cudaPeekAtLastError());
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
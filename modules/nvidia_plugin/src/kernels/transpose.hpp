@@ -0,0 +1,86 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <optional>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Permutes dimensions of a tensor of elements of 1, 2, 4 or 8 bytes. On the host, dimensions of size 1 are dropped
+ * and input dimensions, which stay adjacent in the output, are merged, so e.g. NCHW -> NHWC becomes a batch of
+ * [C, HW] -> [HW, C] transposes and the transposes of attention heads become permutations of contiguous rows.
+ * The simplified permutation is executed as:
+ *  - a copy, when it is the identity;
+ *  - a copy of contiguous rows with vectorized accesses, when the innermost dimension stays innermost;
+ *  - a batch of 2D transposes through 32x33 tiles in shared memory otherwise, so that both reads and writes
+ *    are coalesced and the tile is accessed without bank conflicts.
+ */
+class Transpose {
+public:
+    static constexpr size_t max_rank = 6;
+
+    /**
+     * Mixed radix of the dimensions, which are iterated by blocks, with their input and output strides in bytes
+     */
+    struct Batch {
+        unsigned rank{};
+        size_t sizes[max_rank]{};
+        size_t in_strides[max_rank]{};
+        size_t out_strides[max_rank]{};
+    };
+
+    /**
+     * @param permutation Output dimension i is the input dimension permutation[i]
+     */
+    Transpose(size_t element_size, const std::vector<size_t>& shape, const std::vector<int>& permutation);
+    Transpose(Transpose&&) = default;
+    Transpose& operator=(Transpose&&) = default;
+
+    void operator()(cudaStream_t stream, const void* x, void* y) const;
+
+    /**
+     * @returns true if the kernel supports the element size and the simplified permutation has at most max_rank
+     * dimensions
+     */
+    static bool isSupported(size_t element_size, const std::vector<size_t>& shape, const std::vector<int>& permutation);
+
+private:
+    struct Simplified {
+        std::vector<size_t> shape;
+        std::vector<int> permutation;
+    };
+
+    static Simplified simplify(const std::vector<size_t>& shape, const std::vector<int>& permutation);
+
+    template <typename T>
+    void transposeTiles(cudaStream_t stream, const void* x, void* y) const;
+
+    template <typename T>
+    void copyRows(cudaStream_t stream, const void* x, void* y) const;
+
+    size_t element_size_{};
+    size_t num_elements_{};
+    Batch batch_{};
+    size_t batch_size_{};
+    // Copy of rows
+    bool rows_{};
+    size_t row_length_{};
+    // Transposes of tiles, input [tile_rows_, tile_columns_] becomes output [tile_columns_, tile_rows_]
+    bool tiles_{};
+    size_t tile_rows_{};
+    size_t tile_columns_{};
+    size_t in_row_stride_{};
+    size_t out_column_stride_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
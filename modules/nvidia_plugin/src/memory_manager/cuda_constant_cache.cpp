@@ -0,0 +1,156 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_constant_cache.hpp"
+
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string_view>
+
+#ifdef __linux__
+#include <signal.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+std::uint64_t fnv1a(gsl::span<const char> data) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const auto byte : data) {
+        hash ^= static_cast<std::uint8_t>(byte);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * Content of a file of the IPC directory, which publishes memory of a constant of a process
+ */
+struct IpcRecord {
+    std::int64_t pid;
+    std::uint64_t size;
+    cudaIpcMemHandle_t handle;
+};
+
+#ifdef __linux__
+bool isAlive(const std::int64_t pid) {
+    return pid > 0 && (kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM);
+}
+#endif
+
+}  // namespace
+
+ConstantCache& ConstantCache::instance() {
+    static ConstantCache cache;
+    return cache;
+}
+
+bool ConstantCache::isIpcSupported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+ConstantCache::Allocation ConstantCache::getOrUpload(gsl::span<const char> data, const std::string& ipcDir) {
+    // Content is compared by two independent hashes instead of bytes, since host data of constants
+    // of other models isn't available any more
+    const Key key{CUDA::Device::currentId(),
+                  data.size(),
+                  fnv1a(data),
+                  std::hash<std::string_view>{}(std::string_view{data.data(), data.size()})};
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        if (auto allocation = it->second.lock()) {
+            return allocation;
+        }
+    }
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        it = it->second.expired() ? entries_.erase(it) : std::next(it);
+    }
+    Allocation allocation;
+    if (!ipcDir.empty() && isIpcSupported()) {
+        const auto path = (std::filesystem::path{ipcDir} / ipcFileName(key)).string();
+        allocation = importIpc(path, data.size());
+        if (!allocation) {
+            allocation = uploadIpc(data, path);
+            exported_.push_back(allocation);
+        }
+    } else {
+        allocation = std::make_shared<const CUDA::DefaultAllocation>(CUDA::DefaultStream::stream().malloc(data.size()));
+        CUDA::DefaultStream::stream().upload(*allocation, data.data(), data.size());
+    }
+    entries_[key] = allocation;
+    return allocation;
+}
+
+std::string ConstantCache::ipcFileName(const Key& key) {
+    // Ordinals of devices differ in processes with different CUDA_VISIBLE_DEVICES, so the device is identified by UUID
+    return fmt::format(
+        "{}-{}-{:016x}-{:016x}.ipc", CUDA::Device{key.device}.uuid(), key.size, key.hash, std::uint64_t{key.check});
+}
+
+ConstantCache::Allocation ConstantCache::importIpc(const std::string& path, const std::size_t size) {
+#ifdef __linux__
+    IpcRecord record{};
+    std::ifstream file{path, std::ios::binary};
+    if (!file.read(reinterpret_cast<char*>(&record), sizeof(record)) || record.size != size ||
+        record.pid == getpid() || !isAlive(record.pid)) {
+        // Memory of an exited process is freed, so the constant is uploaded and published again
+        return nullptr;
+    }
+    void* ptr = nullptr;
+    if (cudaIpcOpenMemHandle(&ptr, record.handle, cudaIpcMemLazyEnablePeerAccess) != cudaSuccess) {
+        // The error isn't sticky, it is cleared so that it isn't reported by next calls
+        cudaGetLastError();
+        return nullptr;
+    }
+    return std::make_shared<const CUDA::DefaultAllocation>(ptr,
+                                                           [](void* ptr) { logIfError(cudaIpcCloseMemHandle(ptr)); });
+#else
+    return nullptr;
+#endif
+}
+
+ConstantCache::Allocation ConstantCache::uploadIpc(gsl::span<const char> data, const std::string& path) {
+    // Memory of stream-ordered pools has no legacy IPC handles, so it is allocated by cudaMalloc
+    auto allocation =
+        std::make_shared<const CUDA::DefaultAllocation>(CUDA::createFirstArg<void*, cudaError_t>(cudaMalloc, data.size()));
+    CUDA::DefaultStream::stream().upload(*allocation, data.data(), data.size());
+#ifdef __linux__
+    IpcRecord record{};
+    record.pid = getpid();
+    record.size = data.size();
+    throwIfError(cudaIpcGetMemHandle(&record.handle, allocation->get()));
+    // The record is renamed into place, so other processes never read a partially written file
+    const auto tmpPath = fmt::format("{}.{}.tmp", path, record.pid);
+    {
+        std::ofstream file{tmpPath, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        if (!file) {
+            // The constant is still used by this process, it just isn't shared
+            return allocation;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tmpPath, path, error);
+    if (error) {
+        std::filesystem::remove(tmpPath, error);
+    }
+#endif
+    return allocation;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,83 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cuda/runtime.hpp>
+#include <gsl/span>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Process-wide cache of constants uploaded to device memory.
+ *
+ * Constants are identified by their device, size and content hashes, so identical weights of different
+ * compiled models (e.g. the same backbone with different heads) are stored on the device once.
+ * The cache doesn't own device memory, it is freed when the last compiled model using it is destroyed.
+ *
+ * Processes compiling the same model (e.g. workers serving it on the same GPU) may share constants by CUDA IPC
+ * (see ov::nvidia_gpu::ipc_constants_dir): the process uploading a constant publishes its IPC handle in a file of
+ * the directory, which other processes import instead of uploading their own copy. Exported memory is kept until
+ * the process exits, as other processes may have it mapped, and constants of exited processes are uploaded again.
+ */
+class ConstantCache {
+public:
+    using Allocation = std::shared_ptr<const CUDA::DefaultAllocation>;
+
+    /**
+     * Constants smaller than this size are kept within the constants blob of the compiled model,
+     * as a separate allocation for each of them costs more than the memory it could save
+     */
+    static constexpr std::size_t kMinSharedConstantSize = 64 * 1024;
+
+    static ConstantCache& instance();
+
+    /**
+     * Finds device memory with the same content on the current device or uploads the content into a new one
+     * @param data Content of the constant
+     * @param ipcDir Directory of IPC handles of constants shared by processes, empty if constants aren't shared
+     *               across processes
+     * @return Device memory with the content
+     */
+    Allocation getOrUpload(gsl::span<const char> data, const std::string& ipcDir = {});
+
+    /**
+     * @returns true if constants may be shared across processes by CUDA IPC on this platform
+     */
+    static bool isIpcSupported();
+
+private:
+    struct Key {
+        int device;
+        std::size_t size;
+        std::uint64_t hash;
+        std::size_t check;
+
+        bool operator==(const Key& other) const {
+            return device == other.device && size == other.size && hash == other.hash && check == other.check;
+        }
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const { return static_cast<std::size_t>(key.hash); }
+    };
+
+    static std::string ipcFileName(const Key& key);
+    static Allocation importIpc(const std::string& path, std::size_t size);
+    static Allocation uploadIpc(gsl::span<const char> data, const std::string& path);
+
+    std::mutex mtx_;
+    std::unordered_map<Key, std::weak_ptr<const CUDA::DefaultAllocation>, KeyHash> entries_;
+    // Memory exported to other processes, which may keep it mapped until this process exits
+    std::vector<Allocation> exported_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,121 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_constants_upload.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <cuda/runtime.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+ConstantsUpload::ConstantsUpload(std::vector<Region> regions)
+    : upload_{std::async(std::launch::async, &ConstantsUpload::upload, CUDA::Device::currentId(), std::move(regions))
+                  .share()} {}
+
+ConstantsUpload::~ConstantsUpload() {
+    // Memory block and host data of constants should outlive the upload
+    upload_.wait();
+}
+
+void ConstantsUpload::wait() const { upload_.get(); }
+
+void ConstantsUpload::upload(const int device, std::vector<Region> regions) {
+    regions.erase(std::remove_if(regions.begin(), regions.end(), [](const auto& r) { return r.data.empty(); }),
+                  regions.end());
+    if (regions.empty()) {
+        return;
+    }
+    CUDA::Device{device}.setCurrent();
+    // Page-locked data is transferred by DMA directly, so only pageable data is staged
+    const auto staged = std::stable_partition(
+        regions.begin(), regions.end(), [](const auto& r) { return isPageLocked(r.data.data()); });
+    std::sort(staged, regions.end(), [](const auto& l, const auto& r) { return l.devicePtr < r.devicePtr; });
+    auto* const begin = staged == regions.end() ? nullptr : static_cast<char*>(staged->devicePtr);
+    auto* const end = staged == regions.end() ? nullptr
+                                              : static_cast<char*>(regions.back().devicePtr) + regions.back().data.size();
+
+    const CUDA::PinnedHostAllocator allocator;
+    const auto chunkSize = std::min<std::size_t>(kChunkSize, end - begin);
+    struct Chunk {
+        char* data = nullptr;
+        cudaEvent_t uploaded = nullptr;
+    };
+    std::array<Chunk, 2> chunks{};
+    cudaStream_t stream = nullptr;
+    // Default stream used by the compiling thread doesn't wait for the non-blocking stream
+    auto status = cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking);
+    for (auto& chunk : chunks) {
+        if (status == cudaSuccess) {
+            status = cudaEventCreateWithFlags(&chunk.uploaded, cudaEventDisableTiming);
+        }
+    }
+    auto release = [&] {
+        if (stream) {
+            logIfError(cudaStreamSynchronize(stream));
+            logIfError(cudaStreamDestroy(stream));
+        }
+        for (auto& chunk : chunks) {
+            if (chunk.uploaded) {
+                logIfError(cudaEventDestroy(chunk.uploaded));
+            }
+            allocator.deallocate(chunk.data, chunkSize);
+        }
+    };
+    try {
+        throwIfError(status);
+        for (auto it = regions.begin(); it != staged; ++it) {
+            throwIfError(
+                cudaMemcpyAsync(it->devicePtr, it->data.data(), it->data.size(), cudaMemcpyHostToDevice, stream));
+        }
+        for (auto& chunk : chunks) {
+            chunk.data = static_cast<char*>(allocator.allocate(chunkSize));
+        }
+        auto region = staged;
+        std::size_t index = 0;
+        // Device range of the block is uploaded window by window, gaps between constants are alignment paddings
+        for (auto* window = begin; window < end; window += chunkSize, ++index) {
+            auto& chunk = chunks[index % chunks.size()];
+            // The chunk is refilled when its previous upload is completed
+            throwIfError(cudaEventSynchronize(chunk.uploaded));
+            auto* const windowEnd = std::min(window + chunkSize, end);
+            auto* usedEnd = window;
+            for (auto it = region; it != regions.end() && static_cast<char*>(it->devicePtr) < windowEnd; ++it) {
+                auto* const regionBegin = static_cast<char*>(it->devicePtr);
+                auto* const regionEnd = regionBegin + it->data.size();
+                auto* const from = std::max(regionBegin, window);
+                auto* const to = std::min(regionEnd, windowEnd);
+                if (from < to) {
+                    std::memcpy(chunk.data + (from - window), it->data.data() + (from - regionBegin), to - from);
+                    usedEnd = std::max(usedEnd, to);
+                }
+            }
+            while (region != regions.end() &&
+                   static_cast<char*>(region->devicePtr) + region->data.size() <= windowEnd) {
+                ++region;
+            }
+            throwIfError(cudaMemcpyAsync(window, chunk.data, usedEnd - window, cudaMemcpyHostToDevice, stream));
+            throwIfError(cudaEventRecord(chunk.uploaded, stream));
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+    release();
+}
+
+bool ConstantsUpload::isPageLocked(const void* data) {
+    cudaPointerAttributes attributes{};
+    if (cudaPointerGetAttributes(&attributes, data) != cudaSuccess) {
+        // Pageable memory isn't known to CUDA runtime of old versions, the error shouldn't be sticky
+        cudaGetLastError();
+        return false;
+    }
+    return attributes.type == cudaMemoryTypeHost;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <future>
+#include <gsl/span>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Background upload of constants into the continuous device memory block.
+ *
+ * Host data of constants is packed into page-locked staging chunks, which are uploaded by
+ * cudaMemcpyAsync on a dedicated non-blocking stream, so that the upload overlaps with creation
+ * of operations (cuDNN descriptors setup, algorithms search, etc.) on the compiling thread.
+ * Constants which host data is already page-locked (e.g. weights of an imported model) are uploaded
+ * directly from it without staging.
+ */
+class ConstantsUpload {
+public:
+    struct Region {
+        void* devicePtr;
+        gsl::span<const char> data;
+    };
+
+    /**
+     * Size of a page-locked staging chunk, two chunks are used in turns
+     */
+    static constexpr std::size_t kChunkSize = 16 * 1024 * 1024;
+
+    /**
+     * Starts upload of constants of the current device
+     * @param regions Constants and their locations, all of them should be a part of the same memory block.
+     *                Host data should be alive until the upload is completed
+     */
+    explicit ConstantsUpload(std::vector<Region> regions);
+
+    /**
+     * Waits for completion of the upload
+     */
+    ~ConstantsUpload();
+
+    /**
+     * Waits for completion of the upload, can be called several times
+     * @throws ov::Exception if the upload failed
+     */
+    void wait() const;
+
+private:
+    static void upload(int device, std::vector<Region> regions);
+    static bool isPageLocked(const void* data);
+
+    std::shared_future<void> upload_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,6 +6,7 @@
 
 #include <cuda_runtime_api.h>
 
+#include <atomic>
 #include <cuda/runtime.hpp>
 #include <details/ie_exception.hpp>
 #include <iostream>
@@ -13,14 +14,68 @@
 namespace ov {
 namespace nvidia_gpu {
 
-DeviceMemBlock::DeviceMemBlock(MemoryModel::Ptr model) : model_{move(model)} {}
+namespace {
+
+std::size_t nextId() {
+    static std::atomic<std::size_t> next_id{0};
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+DeviceMemBlock::DeviceMemBlock(MemoryModel::Ptr model)
+    : model_{move(model)},
+      id_{nextId()},
+      allocation_{CUDA::DefaultStream::stream().malloc(model_->deviceMemoryBlockSize())},
+      device_mem_ptr_{allocation_->get()} {
+    if (device_mem_ptr_ != nullptr) {
+        workbuffers_.mutable_buffers.emplace_back(device_mem_ptr_);
+    }
+}
+
+DeviceMemBlock::DeviceMemBlock(MemoryModel::Ptr model, const std::shared_ptr<MemoryArenas>& arenas)
+    : model_{move(model)}, id_{nextId()} {
+    // Empty blob has no address as the allocated one
+    if (model_->deviceMemoryBlockSize() != 0) {
+        arena_ = arenas->take(model_->deviceMemoryBlockSize());
+        device_mem_ptr_ = arena_->get();
+        workbuffers_.mutable_buffers.emplace_back(device_mem_ptr_);
+    }
+}
+
+DeviceMemBlock::~DeviceMemBlock() {
+    if (release_pending_) {
+        logIfError(cudaEventSynchronize(released_->get()));
+    }
+}
+
+void DeviceMemBlock::recordRelease(const CUDA::Stream& stream) {
+    if (!released_) {
+        released_.emplace(cudaEventDisableTiming);
+    }
+    released_->record(stream);
+    release_pending_ = true;
+}
+
+void DeviceMemBlock::waitRelease(const CUDA::Stream& stream) const {
+    if (release_pending_) {
+        released_->streamWait(stream);
+    }
+}
 
 void* DeviceMemBlock::deviceBufferPtr(const BufferID& id) const {
     if (ptrdiff_t offset = 0; model_->offsetForBuffer(id, offset))
-        return reinterpret_cast<uint8_t*>(device_mem_ptr_.get()) + offset;
+        return reinterpret_cast<uint8_t*>(device_mem_ptr_) + offset;
+    if (auto shared = shared_buffers_.find(id); shared != shared_buffers_.end()) {
+        return shared->second->get();
+    }
     return nullptr;
 }
 
+void DeviceMemBlock::bindSharedBuffer(const BufferID& id, std::shared_ptr<const CUDA::DefaultAllocation> allocation) {
+    shared_buffers_[id] = std::move(allocation);
+}
+
 void* DeviceMemBlock::deviceTensorPtr(const TensorID& id) const {
     if (auto bufferPtr = deviceBufferPtr(id.GetBuffer().GetId()); bufferPtr) {
         return reinterpret_cast<uint8_t*>(bufferPtr) + id.GetOffset();
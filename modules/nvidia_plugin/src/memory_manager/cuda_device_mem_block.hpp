@@ -4,10 +4,17 @@
 
 #pragma once
 
+#include <cuda/event.hpp>
 #include <cuda/runtime.hpp>
 #include <cuda_graph_context.hpp>
+#include <cstddef>
 #include <gsl/pointers>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 
+#include "memory_manager/cuda_memory_arenas.hpp"
+#include "memory_manager/cuda_workbuffers.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
 
 namespace ov {
@@ -30,15 +37,37 @@ public:
      */
     DeviceMemBlock(MemoryModel::Ptr model);
 
+    /**
+     * Takes the blob from growable arenas shared with blocks of other models, so the blob reuses the memory and
+     * the base address of an arena released by another block.
+     *
+     * @throws ov::Exception if device memory isn't available.
+     */
+    DeviceMemBlock(MemoryModel::Ptr model, const std::shared_ptr<MemoryArenas>& arenas);
+
+    /**
+     * Waits for completion of the work which released the block last, so its memory isn't reused before the work
+     * is done.
+     */
+    ~DeviceMemBlock();
+
     /**
      * Provides buffer memory address if any.
      *
      * @param [in] id Buffer identifier.
      * @returns device memory pointer if buffer is located within the blob
-     * or nullptr otherwise.
+     * or bound to it, nullptr otherwise.
      */
     void* deviceBufferPtr(const BufferID& id) const;
 
+    /**
+     * Binds buffer which is located outside of the blob, e.g. constant shared with other compiled models.
+     *
+     * @param [in] id Buffer identifier, which isn't a part of the memory model.
+     * @param [in] allocation Device memory of the buffer, which is kept alive by the block.
+     */
+    void bindSharedBuffer(const BufferID& id, std::shared_ptr<const CUDA::DefaultAllocation> allocation);
+
     /**
      * Provides tensor memory address if any.
      *
@@ -49,7 +78,7 @@ public:
     void* deviceTensorPtr(const TensorID& id) const;
 
     CUDA::DeviceBuffer<uint8_t> view() const {
-        return {static_cast<uint8_t*>(device_mem_ptr_.get()), model_->deviceMemoryBlockSize()};
+        return {static_cast<uint8_t*>(device_mem_ptr_), model_->deviceMemoryBlockSize()};
     }
 
     const std::vector<BufferID>& bufferIds() const { return model_->bufferIds(); }
@@ -58,10 +87,44 @@ public:
 
     CudaGraphContext& cudaGraphContext() { return cuda_graph_context_; }
 
+    /**
+     * Work buffers of topologies executed within the blob, which are built once instead of on every inference
+     */
+    const Workbuffers& workbuffers() const { return workbuffers_; }
+
+    /**
+     * Marks the end of the work using the block, which is submitted to the stream, so the block is returned to
+     * the pool before the work is completed.
+     *
+     * @param [in] stream The last stream of the work using the block.
+     */
+    void recordRelease(const CUDA::Stream& stream);
+
+    /**
+     * Orders the work submitted to the stream after the work which released the block last, if any.
+     *
+     * @param [in] stream Stream of the work using the block next.
+     */
+    void waitRelease(const CUDA::Stream& stream) const;
+
+    /**
+     * Identifier of the block unique within the process, which tags traces of inferences
+     */
+    std::size_t id() const noexcept { return id_; }
+
 private:
     MemoryModel::Ptr model_;
-    CUDA::DefaultAllocation device_mem_ptr_ = CUDA::DefaultStream::stream().malloc(model_->deviceMemoryBlockSize());
+    std::size_t id_;
+    // The blob is either allocated by the block or taken from an arena
+    std::optional<CUDA::DefaultAllocation> allocation_;
+    std::shared_ptr<CUDA::VirtualMemory> arena_;
+    void* device_mem_ptr_ = nullptr;
+    Workbuffers workbuffers_;
+    std::unordered_map<BufferID, std::shared_ptr<const CUDA::DefaultAllocation>> shared_buffers_;
     CudaGraphContext cuda_graph_context_;
+    // Recorded after the work which released the block, it is created on the first release
+    std::optional<CUDA::Event> released_;
+    bool release_pending_ = false;
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,63 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_execution_pointers.hpp"
+
+#include "cuda_memory_manager.hpp"
+#include "cuda_operation_base.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+ExecutionPointers::ExecutionPointers(const MemoryManager& memoryManager,
+                                     gsl::span<const std::shared_ptr<OperationBase>> sequence,
+                                     CUDA::DevicePointer<void*> mutableBufferPtr,
+                                     const ExternalBuffers& externalBuffers) {
+    input_offsets_.reserve(sequence.size() + 1);
+    output_offsets_.reserve(sequence.size() + 1);
+    workbuffers_.reserve(sequence.size());
+    input_offsets_.push_back(0);
+    output_offsets_.push_back(0);
+    for (const auto& op : sequence) {
+        for (const auto& id : op->GetInputIds()) {
+            const void* ptr = memoryManager.internalTensorPtr(id, mutableBufferPtr, false);
+            if (ptr == nullptr) {
+                external_tensors_.push_back({false, inputs_.size(), id});
+                ptr = externalTensorPtr(externalBuffers, id);
+            }
+            inputs_.emplace_back(ptr);
+        }
+        for (const auto& id : op->GetOutputIds()) {
+            void* ptr = memoryManager.internalTensorPtr(id, mutableBufferPtr, true);
+            if (ptr == nullptr) {
+                external_tensors_.push_back({true, outputs_.size(), id});
+                ptr = externalTensorPtr(externalBuffers, id);
+            }
+            outputs_.emplace_back(ptr);
+        }
+        input_offsets_.push_back(inputs_.size());
+        output_offsets_.push_back(outputs_.size());
+        workbuffers_.push_back(memoryManager.workBuffers(*op, mutableBufferPtr));
+    }
+}
+
+void* ExecutionPointers::externalTensorPtr(const ExternalBuffers& externalBuffers, const TensorID& id) {
+    const auto buffer = externalBuffers.find(id.GetBuffer().GetId());
+    OPENVINO_ASSERT(buffer != externalBuffers.end(), "Tensor not found. ID is " + to_string(id));
+    return static_cast<uint8_t*>(buffer->second) + id.GetOffset();
+}
+
+void ExecutionPointers::update(const ExternalBuffers& externalBuffers) {
+    for (const auto& tensor : external_tensors_) {
+        void* ptr = externalTensorPtr(externalBuffers, tensor.id);
+        if (tensor.isOutput) {
+            outputs_[tensor.index] = CUDA::DevicePointer<void*>{ptr};
+        } else {
+            inputs_[tensor.index] = CUDA::DevicePointer<const void*>{ptr};
+        }
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
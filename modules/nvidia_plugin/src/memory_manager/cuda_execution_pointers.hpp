@@ -0,0 +1,79 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/device_pointers.hpp>
+#include <gsl/span>
+#include <memory>
+#include <vector>
+
+#include "cuda_workbuffers.hpp"
+#include "tensor_types.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class MemoryManager;
+class OperationBase;
+
+/**
+ * @brief Device pointers of inputs, outputs and work buffers of a sequence of operations, which are
+ * resolved once for a mutable memory block instead of on every inference.
+ *
+ * Pointers of each operation are contiguous runs of flat arrays. Tensors of external buffers, which
+ * change between inferences, are patched by update().
+ */
+class ExecutionPointers {
+public:
+    using Inputs = gsl::span<const CUDA::DevicePointer<const void*>>;
+    using Outputs = gsl::span<const CUDA::DevicePointer<void*>>;
+
+    /**
+     * @param[in] memoryManager Memory manager of the operations
+     * @param[in] sequence Operations in the order of execution
+     * @param[in] mutableBufferPtr Mutable memory block, which the pointers are resolved for
+     * @param[in] externalBuffers Pointers of external buffers for the current inference
+     * @throws ov::Exception if any of tensor or work buffer pointers is not found
+     */
+    ExecutionPointers(const MemoryManager& memoryManager,
+                      gsl::span<const std::shared_ptr<OperationBase>> sequence,
+                      CUDA::DevicePointer<void*> mutableBufferPtr,
+                      const ExternalBuffers& externalBuffers);
+
+    /**
+     * Sets pointers of tensors of external buffers for the current inference
+     * @throws ov::Exception if any of external tensors is not found
+     */
+    void update(const ExternalBuffers& externalBuffers);
+
+    Inputs inputs(std::size_t index) const {
+        return {inputs_.data() + input_offsets_[index], input_offsets_[index + 1] - input_offsets_[index]};
+    }
+
+    Outputs outputs(std::size_t index) const {
+        return {outputs_.data() + output_offsets_[index], output_offsets_[index + 1] - output_offsets_[index]};
+    }
+
+    const Workbuffers& workbuffers(std::size_t index) const { return workbuffers_[index]; }
+
+private:
+    static void* externalTensorPtr(const ExternalBuffers& externalBuffers, const TensorID& id);
+
+    struct ExternalTensor {
+        bool isOutput;
+        std::size_t index;
+        TensorID id;
+    };
+
+    std::vector<CUDA::DevicePointer<const void*>> inputs_;
+    std::vector<CUDA::DevicePointer<void*>> outputs_;
+    std::vector<std::size_t> input_offsets_;
+    std::vector<std::size_t> output_offsets_;
+    std::vector<Workbuffers> workbuffers_;
+    std::vector<ExternalTensor> external_tensors_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #include "cuda_immutable_memory_block_builder.hpp"
 
+#include "memory_manager/cuda_constants_upload.hpp"
 #include "openvino/core/except.hpp"
 
 namespace ov {
@@ -20,11 +21,14 @@ size_t ImmutableMemoryBlockBuilder::deviceMemoryBlockSize() const { return model
 std::pair<DeviceMemBlock::Ptr, MemoryModel::Ptr> ImmutableMemoryBlockBuilder::build() {
     auto memory_model = model_builder_.build();
     auto memory_block = std::make_shared<DeviceMemBlock>(memory_model);
+    std::vector<ConstantsUpload::Region> regions;
+    regions.reserve(allocations_.size());
     for (const auto& allocation : allocations_) {
         void* device_ptr = memory_block->deviceBufferPtr(allocation.id);
         OPENVINO_ASSERT(device_ptr != nullptr);
-        throwIfError(::cudaMemcpy(device_ptr, allocation.data, allocation.bsize, cudaMemcpyHostToDevice));
+        regions.push_back({device_ptr, {static_cast<const char*>(allocation.data), allocation.bsize}});
     }
+    ConstantsUpload{std::move(regions)}.wait();
     return {memory_block, memory_model};
 }
 
@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_arenas.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace nvidia_gpu {
+
+MemoryArenas::MemoryArenas(const CUDA::Device device, const std::size_t reservedSize)
+    : device_{device}, reserved_size_{reservedSize} {}
+
+std::shared_ptr<CUDA::VirtualMemory> MemoryArenas::take(const std::size_t size) {
+    std::unique_ptr<CUDA::VirtualMemory> arena;
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        if (!idle_arenas_.empty()) {
+            // The arena mapping the most memory is grown the least
+            auto largest = std::max_element(idle_arenas_.begin(), idle_arenas_.end(), [](const auto& a, const auto& b) {
+                return a->size() < b->size();
+            });
+            arena = std::move(*largest);
+            idle_arenas_.erase(largest);
+        } else {
+            ++num_arenas_;
+        }
+    }
+    try {
+        if (!arena) {
+            arena = std::make_unique<CUDA::VirtualMemory>(device_, reserved_size_);
+        }
+        // The arena mapping more memory than the blob needs keeps it, unmapping would gain nothing until it's idle
+        if (arena->size() < size) {
+            arena->resize(size);
+        }
+    } catch (...) {
+        if (arena) {
+            giveBack(std::move(arena));
+        } else {
+            std::lock_guard<std::mutex> lock{mtx_};
+            --num_arenas_;
+        }
+        throw;
+    }
+    auto* taken = arena.release();
+    return std::shared_ptr<CUDA::VirtualMemory>{taken, [arenas = shared_from_this()](CUDA::VirtualMemory* arena) {
+                                                     arenas->giveBack(std::unique_ptr<CUDA::VirtualMemory>{arena});
+                                                 }};
+}
+
+std::size_t MemoryArenas::size() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return num_arenas_;
+}
+
+std::size_t MemoryArenas::idleSize() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    std::size_t size = 0;
+    for (const auto& arena : idle_arenas_) {
+        size += arena->size();
+    }
+    return size;
+}
+
+void MemoryArenas::giveBack(std::unique_ptr<CUDA::VirtualMemory> arena) {
+    std::unique_ptr<CUDA::VirtualMemory> unmapped;
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        idle_arenas_.push_back(std::move(arena));
+        // Only the largest idle arena keeps its memory, the rest of them keep only their addresses
+        auto smallest = idle_arenas_.end();
+        std::size_t numMapped = 0;
+        for (auto it = idle_arenas_.begin(); it != idle_arenas_.end(); ++it) {
+            if ((*it)->size() == 0) {
+                continue;
+            }
+            ++numMapped;
+            if (smallest == idle_arenas_.end() || (*it)->size() < (*smallest)->size()) {
+                smallest = it;
+            }
+        }
+        if (numMapped < 2) {
+            return;
+        }
+        unmapped = std::move(*smallest);
+        idle_arenas_.erase(smallest);
+    }
+    // Work using the arena is completed when its blob releases it, memory is unmapped without holding the lock
+    try {
+        unmapped->resize(0);
+    } catch (const std::exception& e) {
+        logError(e.what());
+    }
+    std::lock_guard<std::mutex> lock{mtx_};
+    idle_arenas_.push_back(std::move(unmapped));
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
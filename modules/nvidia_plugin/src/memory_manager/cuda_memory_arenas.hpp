@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/runtime.hpp>
+#include <cuda/virtual_memory.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Growable arenas of device memory shared by mutable blobs of models compiled for shape buckets.
+ *
+ * Each arena reserves the range of addresses for the largest blob upfront and maps physical memory on demand,
+ * so a blob of a larger bucket grows the arena released by a blob of a smaller one in place at the same base address
+ * instead of allocating its own memory, while a blob of a smaller bucket reuses a larger arena as is. Released
+ * arenas keep their memory for the next blob, except for the largest one of them only
+ */
+class MemoryArenas : public std::enable_shared_from_this<MemoryArenas> {
+public:
+    /**
+     * @param device Device of the memory
+     * @param reservedSize Size of the range of addresses of each arena, i.e. the size of the largest blob
+     */
+    MemoryArenas(CUDA::Device device, std::size_t reservedSize);
+
+    /**
+     * @param size Size of the blob
+     * @returns Arena mapping at least the given size, it is returned to arenas when it is released. It must be
+     *          released only when work using it is completed (see DeviceMemBlock::recordRelease), since memory of
+     *          released arenas may be unmapped without synchronizing the device
+     * @throws ov::Exception if device memory isn't available
+     */
+    std::shared_ptr<CUDA::VirtualMemory> take(std::size_t size);
+
+    /**
+     * @returns Number of arenas including ones taken by blobs
+     */
+    std::size_t size() const;
+
+    /**
+     * @returns Size of memory mapped by arenas which aren't taken by blobs now
+     */
+    std::size_t idleSize() const;
+
+private:
+    void giveBack(std::unique_ptr<CUDA::VirtualMemory> arena);
+
+    CUDA::Device device_;
+    std::size_t reserved_size_;
+    mutable std::mutex mtx_;
+    std::vector<std::unique_ptr<CUDA::VirtualMemory>> idle_arenas_;
+    std::size_t num_arenas_ = 0;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
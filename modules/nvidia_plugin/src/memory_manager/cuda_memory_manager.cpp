@@ -10,17 +10,43 @@ namespace nvidia_gpu {
 
 MemoryManager::MemoryManager(DeviceMemBlock::Ptr immutableTensors,
                              MemoryModel::Ptr mutableMemoryModel,
-                             DeviceMemBlock::Ptr immutableWorkbufferMemory)
+                             DeviceMemBlock::Ptr immutableWorkbufferMemory,
+                             std::vector<ExternalBufferBinding> externalBufferBindings,
+                             std::unique_ptr<ConstantsUpload> constantsUpload)
     : immutable_tensors_{immutableTensors},
       mutable_tensors_model_{mutableMemoryModel},
-      immutable_workbuffers_{immutableWorkbufferMemory} {}
+      immutable_workbuffers_{immutableWorkbufferMemory},
+      external_buffer_bindings_{std::move(externalBufferBindings)},
+      constants_upload_{std::move(constantsUpload)} {}
+
+void MemoryManager::waitForConstants() const {
+    if (constants_upload_) {
+        constants_upload_->wait();
+    }
+}
+
+void* MemoryManager::externalTensorPtr(const ExternalBuffers& externalBuffers, const TensorID& id) {
+    if (auto buffer = externalBuffers.find(id.GetBuffer().GetId()); buffer != externalBuffers.end()) {
+        return static_cast<uint8_t*>(buffer->second) + id.GetOffset();
+    }
+    return nullptr;
+}
+
+void* MemoryManager::internalTensorPtr(const TensorID& id,
+                                       CUDA::DevicePointer<void*> mutableBufferPtr,
+                                       bool isOutput) const {
+    void* ptr = isOutput ? nullptr : immutable_tensors_->deviceTensorPtr(id);
+    if (ptr == nullptr) ptr = mutable_tensors_model_->deviceTensorPtr(mutableBufferPtr.cast<uint8_t*>(), id);
+    return ptr;
+}
 
 MemoryManager::InputTensors MemoryManager::inputTensorPointers(const IOperationMeta& operation,
-                                                               CUDA::DevicePointer<void*> mutableBufferPtr) const {
+                                                               CUDA::DevicePointer<void*> mutableBufferPtr,
+                                                               const ExternalBuffers& externalBuffers) const {
     InputTensors result;
     for (auto id : operation.GetInputIds()) {
-        const void* ptr = immutable_tensors_->deviceTensorPtr(id);
-        if (ptr == nullptr) ptr = mutable_tensors_model_->deviceTensorPtr(mutableBufferPtr.cast<uint8_t*>(), id);
+        const void* ptr = internalTensorPtr(id, mutableBufferPtr, false);
+        if (ptr == nullptr) ptr = externalTensorPtr(externalBuffers, id);
         OPENVINO_ASSERT(ptr != nullptr, "Tensor not found. ID is " + to_string(id));
         result.emplace_back(ptr);
     }
@@ -28,10 +54,12 @@ MemoryManager::InputTensors MemoryManager::inputTensorPointers(const IOperationM
 }
 
 MemoryManager::OutputTensors MemoryManager::outputTensorPointers(const IOperationMeta& operation,
-                                                                 CUDA::DevicePointer<void*> mutableBufferPtr) const {
+                                                                 CUDA::DevicePointer<void*> mutableBufferPtr,
+                                                                 const ExternalBuffers& externalBuffers) const {
     OutputTensors result;
     for (auto id : operation.GetOutputIds()) {
-        void* ptr = mutable_tensors_model_->deviceTensorPtr(mutableBufferPtr.cast<uint8_t*>(), id);
+        void* ptr = internalTensorPtr(id, mutableBufferPtr, true);
+        if (ptr == nullptr) ptr = externalTensorPtr(externalBuffers, id);
 
         OPENVINO_ASSERT(ptr != nullptr, "Tensor not found. ID is " + to_string(id));
         result.emplace_back(ptr);
@@ -6,9 +6,11 @@
 
 #include <gsl/span>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "cuda/device_pointers.hpp"
+#include "cuda_constants_upload.hpp"
 #include "cuda_device_mem_block.hpp"
 #include "cuda_workbuffers.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
@@ -34,36 +36,73 @@ public:
     using InputTensors = std::vector<CUDA::DevicePointer<const void*>>;
     using OutputTensors = std::vector<CUDA::DevicePointer<void*>>;
 
+    /**
+     * @brief Describes buffer of Parameter/Result which is bound to I/O tensor of
+     * an inference instead of being allocated within mutable memory block,
+     * or buffer which is bound to state of a variable kept by an infer request.
+     */
+    struct ExternalBufferBinding {
+        BufferID bufferId;
+        bool isInput;
+        std::vector<std::string> tensorNames;
+        std::size_t size;
+        // Identifier of the variable, which state the buffer is bound to, empty for Parameter/Result buffers
+        std::string variable{};
+    };
+
     /**
      * @param[in] immutableTensors Immutable memory blob which stores constant tensors
      * which are used by multiple infer requests at the same time.
      * @param[in] mutableMemoryModel Infer request specific mutable memory model. It is
      * used to allocate a memory which is used by a single infer request at a time.
      * @param[in] immutableWorkbufferMemory Blob for immutable workbuffers
+     * @param[in] externalBufferBindings Parameter/Result buffers which are not a part of mutable memory model
+     * @param[in] constantsUpload Upload of constant tensors which is still in progress
      */
     MemoryManager(DeviceMemBlock::Ptr immutableTensors,
                   MemoryModel::Ptr mutableMemoryModel,
-                  DeviceMemBlock::Ptr immutableWorkbufferMemory = nullptr);
+                  DeviceMemBlock::Ptr immutableWorkbufferMemory = nullptr,
+                  std::vector<ExternalBufferBinding> externalBufferBindings = {},
+                  std::unique_ptr<ConstantsUpload> constantsUpload = nullptr);
+
+    /**
+     * Waits until constant tensors are uploaded to the device, should be called before an inference
+     * @throws ov::Exception if the upload failed
+     */
+    void waitForConstants() const;
 
     /**
      * Maps input tensor identifiers into device side tensor pointers.
      * @param[in] operation An operation which defines input tensors.
      * @param[in] mutableBufferPtr A memory block based on which mapping is performed.
+     * @param[in] externalBuffers Pointers of external buffers for the current inference.
      * @returns An array of corresponding input tensor pointers.
      * @throws ov::Exception if any of tensor pointers is not found
      */
     InputTensors inputTensorPointers(const IOperationMeta& operation,
-                                     CUDA::DevicePointer<void*> mutableBufferPtr) const;
+                                     CUDA::DevicePointer<void*> mutableBufferPtr,
+                                     const ExternalBuffers& externalBuffers = {}) const;
 
     /**
      * Maps output tensor identifiers into device side tensor pointers.
      * @param[in] operation An operation which defines output tensors.
      * @param[in] mutableBufferPtr A memory block based on which mapping is performed.
+     * @param[in] externalBuffers Pointers of external buffers for the current inference.
      * @returns An array of corresponding output tensor pointers.
      * @throws ov::Exception if any of tensor pointers is not found
      */
     OutputTensors outputTensorPointers(const IOperationMeta& operation,
-                                       CUDA::DevicePointer<void*> mutableBufferPtr) const;
+                                       CUDA::DevicePointer<void*> mutableBufferPtr,
+                                       const ExternalBuffers& externalBuffers = {}) const;
+
+    /**
+     * Maps tensor identifier into a device side pointer within immutable or mutable memory.
+     * @param[in] id Tensor identifier.
+     * @param[in] mutableBufferPtr A memory block based on which mapping is performed.
+     * @param[in] isOutput Whether the tensor is an output, which can't be immutable.
+     * @returns Tensor pointer or nullptr if the tensor is located in an external buffer.
+     */
+    void* internalTensorPtr(const TensorID& id, CUDA::DevicePointer<void*> mutableBufferPtr, bool isOutput) const;
 
     /**
      * Maps operation onto device side work work buffer pointers.
@@ -92,10 +131,23 @@ public:
      */
     [[nodiscard]] const DeviceMemBlock& immutableWorkbuffers() const { return *immutable_workbuffers_; }
 
+    /**
+     * Returns bindings of external buffers
+     * @return Parameter/Result buffers which should be provided for each inference
+     */
+    [[nodiscard]] const std::vector<ExternalBufferBinding>& externalBufferBindings() const {
+        return external_buffer_bindings_;
+    }
+
 private:
+    static void* externalTensorPtr(const ExternalBuffers& externalBuffers, const TensorID& id);
+
     DeviceMemBlock::Ptr immutable_tensors_;
     MemoryModel::Ptr mutable_tensors_model_;
     DeviceMemBlock::Ptr immutable_workbuffers_;
+    std::vector<ExternalBufferBinding> external_buffer_bindings_;
+    // Destroyed first, as the upload writes into immutable tensors
+    std::unique_ptr<ConstantsUpload> constants_upload_;
 };
 
 }  // namespace nvidia_gpu
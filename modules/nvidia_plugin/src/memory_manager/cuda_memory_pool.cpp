@@ -4,18 +4,37 @@
 
 #include "cuda_memory_pool.hpp"
 
-#include <fmt/printf.h>
+#include <algorithm>
+#include <cuda/runtime.hpp>
+#include <fmt/format.h>
+#include <iterator>
+#include <openvino/runtime/exception.hpp>
 
 #include "model/cuda_memory_model.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
-MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryModel) {
-    memory_blocks_.reserve(num);
+MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryModel)
+    : MemoryPool{num, std::move(memoryModel), num, std::chrono::milliseconds{0}} {}
+
+MemoryPool::MemoryPool(const size_t num,
+                       std::shared_ptr<MemoryModel> memoryModel,
+                       const size_t numPreallocated,
+                       const std::chrono::milliseconds idleTimeout,
+                       const std::chrono::milliseconds waitTimeout,
+                       std::shared_ptr<MemoryArenas> arenas)
+    : memory_model_{memoryModel},
+      arenas_{std::move(arenas)},
+      capacity_{num},
+      idle_timeout_{idleTimeout},
+      wait_timeout_{waitTimeout},
+      device_id_{CUDA::Device::currentId()} {
+    const auto numBlocks = std::min(num, std::max<size_t>(numPreallocated, 1));
+    memory_blocks_.reserve(numBlocks);
     try {
-        for (int i = 0; i < num; ++i) {
-            memory_blocks_.push_back(std::make_unique<DeviceMemBlock>(memoryModel));
+        for (int i = 0; i < numBlocks; ++i) {
+            memory_blocks_.push_back(CreateBlock());
         }
     } catch (const std::exception& ex) {
         // TODO: Added log message when logging mechanism will be supported
@@ -26,38 +45,228 @@ MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryMode
         if (memory_blocks_.empty()) {
             throw;
         }
+        if (numPreallocated >= num) {
+            capacity_ = memory_blocks_.size();
+        }
+    }
+    num_allocated_ = memory_blocks_.size();
+    idle_since_.assign(memory_blocks_.size(), Time::now());
+    UpdateOccupancy();
+    if (idle_timeout_.count() > 0) {
+        release_thread_ = std::thread{[this] { ReleaseIdleBlocks(); }};
+    }
+}
+
+MemoryPool::~MemoryPool() {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        is_stopped_ = true;
+    }
+    release_cond_var_.notify_all();
+    if (release_thread_.joinable()) {
+        release_thread_.join();
+    }
+}
+
+void MemoryPool::Interrupt() {
+    // Waiters check their cancellation under the lock, so the notification isn't lost between the check and the wait
+    { std::lock_guard<std::mutex> lock{mtx_}; }
+    cond_var_.notify_all();
+}
+
+template <typename Predicate>
+bool MemoryPool::WaitUntil(std::unique_lock<std::mutex>& lock, Time::time_point deadline, Predicate predicate) {
+    if (deadline == Time::time_point::max()) {
+        cond_var_.wait(lock, predicate);
+        return true;
     }
+    return cond_var_.wait_until(lock, deadline, predicate);
+}
+
+void MemoryPool::LeaveQueue(std::list<Time::time_point>::iterator waiter) {
+    const auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(Time::now() - *waiter);
+    spare_waiters_.splice(spare_waiters_.end(), waiters_, waiter);
+    wait_statistics_.queueDepth = waiters_.size();
+    wait_statistics_.totalWaitTime += waitTime;
+    wait_statistics_.maxWaitTime = std::max(wait_statistics_.maxWaitTime, waitTime);
+    total_wait_time_.store(wait_statistics_.totalWaitTime.count(), std::memory_order_relaxed);
 }
 
-void MemoryPool::Interrupt() { cond_var_.notify_all(); }
+void MemoryPool::UpdateOccupancy() {
+    num_free_.store(memory_blocks_.size(), std::memory_order_relaxed);
+    num_busy_.store(num_allocated_ - memory_blocks_.size(), std::memory_order_relaxed);
+}
 
 MemoryPool::Proxy MemoryPool::WaitAndGet(CancellationToken& cancellationToken) {
     std::unique_lock<std::mutex> lock{mtx_};
-    cond_var_.wait(lock, [this, &cancellationToken] {
-        return !memory_blocks_.empty();
-    });
+    // Inferences are served in the order of arrival, so none of them starves while the pool is exhausted
+    if (spare_waiters_.empty()) {
+        spare_waiters_.emplace_back();
+    }
+    const auto waiter = spare_waiters_.begin();
+    waiters_.splice(waiters_.end(), spare_waiters_, waiter);
+    *waiter = Time::now();
+    // The inference stops waiting when the wait timeout expires or its own deadline passes, whichever is earlier
+    auto deadline = wait_timeout_.count() == 0 ? Time::time_point::max() : *waiter + wait_timeout_;
+    if (const auto inferenceDeadline = cancellationToken.deadline()) {
+        deadline = std::min(deadline, *inferenceDeadline);
+    }
+    wait_statistics_.queueDepth = waiters_.size();
+    wait_statistics_.maxQueueDepth = std::max(wait_statistics_.maxQueueDepth, waiters_.size());
+    const auto throwTimeout = [&] {
+        LeaveQueue(waiter);
+        if (cancellationToken.isExpired()) {
+            lock.unlock();
+            cond_var_.notify_all();
+            cancellationToken.throwIfExpired();
+        }
+        ++wait_statistics_.numTimeouts;
+        const auto message = fmt::format("Device memory block of infer request isn't available within {} ms, {} of {} "
+                                         "blocks are in use",
+                                         wait_timeout_.count(),
+                                         num_allocated_,
+                                         capacity_);
+        lock.unlock();
+        // The next waiter becomes the first one in the queue
+        cond_var_.notify_all();
+        ov::Busy::create(message);
+    };
+    const auto throwCancelled = [&] {
+        // Cancelled inference leaves the queue at once, so the waiters behind it aren't blocked
+        LeaveQueue(waiter);
+        lock.unlock();
+        cond_var_.notify_all();
+        ov::Cancelled::create("Inference is cancelled while waiting for device memory block");
+    };
+    if (!WaitUntil(lock, deadline, [this, waiter, &cancellationToken] {
+            return cancellationToken.isCancelled() ||
+                   (waiters_.begin() == waiter && (!memory_blocks_.empty() || num_allocated_ < capacity_));
+        })) {
+        throwTimeout();
+    }
+    if (cancellationToken.isCancelled()) {
+        throwCancelled();
+    }
+    if (memory_blocks_.empty()) {
+        // Memory of the device is shared with other models, so the block is allocated only when it is needed
+        ++num_allocated_;
+        UpdateOccupancy();
+        lock.unlock();
+        try {
+            auto memoryBlock = CreateBlock();
+            lock.lock();
+            LeaveQueue(waiter);
+            ++wait_statistics_.numWaits;
+            lock.unlock();
+            cond_var_.notify_all();
+            return Proxy{shared_from_this(), std::move(memoryBlock)};
+        } catch (const std::exception&) {
+            lock.lock();
+            --num_allocated_;
+            UpdateOccupancy();
+            if (num_allocated_ == 0) {
+                LeaveQueue(waiter);
+                cond_var_.notify_all();
+                throw;
+            }
+            // Device memory is exhausted, the inference waits for one of already allocated blocks
+            capacity_ = num_allocated_;
+            if (!WaitUntil(lock, deadline, [this, &cancellationToken] {
+                    return cancellationToken.isCancelled() || !memory_blocks_.empty();
+                })) {
+                throwTimeout();
+            }
+            if (cancellationToken.isCancelled()) {
+                throwCancelled();
+            }
+        }
+    }
     Proxy memoryManagerProxy{shared_from_this(), move(memory_blocks_.back())};
     memory_blocks_.pop_back();
+    idle_since_.pop_back();
+    UpdateOccupancy();
+    LeaveQueue(waiter);
+    ++wait_statistics_.numWaits;
+    lock.unlock();
+    cond_var_.notify_all();
     return memoryManagerProxy;
 }
 
-size_t MemoryPool::Size() const { return memory_blocks_.size(); }
+std::unique_ptr<DeviceMemBlock> MemoryPool::CreateBlock() const {
+    if (arenas_) {
+        return std::make_unique<DeviceMemBlock>(memory_model_, arenas_);
+    }
+    return std::make_unique<DeviceMemBlock>(memory_model_);
+}
+
+MemoryPool::WaitStatistics MemoryPool::GetWaitStatistics() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return wait_statistics_;
+}
+
+size_t MemoryPool::Size() const { return capacity_; }
+
+size_t MemoryPool::NumAllocated() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return num_allocated_;
+}
 
 void MemoryPool::Resize(size_t count) {
-    const auto memoryManagersCount = memory_blocks_.size();
-    if (count > memoryManagersCount) {
-        throw_ov_exception(
-            fmt::format("Cannot resize MemoryPool with {} value > than it was {}", count, memoryManagersCount));
+    std::vector<std::unique_ptr<DeviceMemBlock>> releasedBlocks;
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        capacity_ = std::max<size_t>(count, 1);
+        // Blocks which are in use now are released when they are returned to the pool
+        while (num_allocated_ > capacity_ && !memory_blocks_.empty()) {
+            releasedBlocks.push_back(std::move(memory_blocks_.front()));
+            memory_blocks_.erase(memory_blocks_.begin());
+            idle_since_.erase(idle_since_.begin());
+            --num_allocated_;
+        }
+        UpdateOccupancy();
     }
-    memory_blocks_.resize(count);
+    cond_var_.notify_all();
 }
 
 void MemoryPool::PushBack(std::unique_ptr<DeviceMemBlock> memManager) {
     {
         std::lock_guard<std::mutex> lock{mtx_};
+        if (num_allocated_ > capacity_) {
+            --num_allocated_;
+            UpdateOccupancy();
+            memManager.reset();
+            return;
+        }
         memory_blocks_.push_back(std::move(memManager));
+        idle_since_.push_back(Time::now());
+        UpdateOccupancy();
+    }
+    // Only the first waiter in the queue takes the block, so all of them check if they are the first one
+    cond_var_.notify_all();
+}
+
+void MemoryPool::ReleaseIdleBlocks() {
+    // Blocks are freed by this thread, so it works with the device of the pool
+    CUDA::Device{device_id_}.setCurrent();
+    std::unique_lock<std::mutex> lock{mtx_};
+    while (!is_stopped_) {
+        const auto deadline = idle_since_.empty() ? Time::now() + idle_timeout_ : idle_since_.front() + idle_timeout_;
+        release_cond_var_.wait_until(lock, deadline, [this] { return is_stopped_; });
+        std::vector<std::unique_ptr<DeviceMemBlock>> releasedBlocks;
+        const auto now = Time::now();
+        auto expired = std::find_if(
+            idle_since_.begin(), idle_since_.end(), [this, now](const auto& since) { return since + idle_timeout_ > now; });
+        const auto numExpired = std::distance(idle_since_.begin(), expired);
+        std::move(memory_blocks_.begin(), memory_blocks_.begin() + numExpired, std::back_inserter(releasedBlocks));
+        memory_blocks_.erase(memory_blocks_.begin(), memory_blocks_.begin() + numExpired);
+        idle_since_.erase(idle_since_.begin(), expired);
+        num_allocated_ -= releasedBlocks.size();
+        UpdateOccupancy();
+        lock.unlock();
+        // Device memory is freed without holding the lock, so inferences aren't blocked
+        releasedBlocks.clear();
+        lock.lock();
     }
-    cond_var_.notify_one();
 }
 
 }  // namespace nvidia_gpu
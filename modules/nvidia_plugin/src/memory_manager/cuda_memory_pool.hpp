@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <cancellation_token.hpp>
+#include <chrono>
 #include <condition_variable>
+#include <list>
 #include <mutex>
+#include <thread>
 
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
@@ -20,7 +24,10 @@ namespace nvidia_gpu {
  * @brief MemoryPool provides currently available DeviceMemBlock.
  *
  * This class is an owner of bunch of DeviceMemBlock-s and provides on request
- * WaitAndGet currently available DeviceMemBlock from pool
+ * WaitAndGet currently available DeviceMemBlock from pool.
+ * DeviceMemBlock-s beyond preallocated ones are allocated on demand up to the capacity of the pool
+ * and are released after they stay unused for the idle timeout.
+ * Inferences waiting for DeviceMemBlock are served in the order of their arrival
  */
 class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
 public:
@@ -62,6 +69,18 @@ public:
         std::shared_ptr<MemoryPool> pool_;
     };
 
+    /**
+     * @brief Statistics of waiting for DeviceMemBlock-s
+     */
+    struct WaitStatistics {
+        size_t queueDepth = 0;     // Number of inferences waiting now
+        size_t maxQueueDepth = 0;  // The greatest number of inferences waited at once
+        size_t numWaits = 0;       // Number of served requests of DeviceMemBlock-s
+        size_t numTimeouts = 0;    // Number of requests failed because of the wait timeout
+        std::chrono::microseconds totalWaitTime{0};
+        std::chrono::microseconds maxWaitTime{0};
+    };
+
     /**
      * Creates MemoryPool that owns @num DeviceMemBlock-s
      * @param num Number of DeviceMemBlock-s in pool
@@ -73,18 +92,79 @@ public:
     MemoryPool(size_t num, std::shared_ptr<MemoryModel> memoryModel);
 
     /**
-     * Interrupt waiting of DeviceMemBlock Proxy object
+     * Creates MemoryPool that owns up to @num DeviceMemBlock-s
+     * @param num Capacity of the pool
+     * @param memoryModel MemoryModel that is used by each DeviceMemBlock as a layout of memory blob
+     * @param numPreallocated Number of DeviceMemBlock-s allocated right away
+     * @param idleTimeout Time after which unused DeviceMemBlock is released, zero means it is never released
+     * @param waitTimeout Time WaitAndGet waits for DeviceMemBlock before it throws ov::Busy, zero means it waits
+     *                    infinitely
+     * @param arenas Growable arenas shared with pools of other models, which blobs of DeviceMemBlock-s are taken
+     *               from, nullptr means DeviceMemBlock-s allocate their own blobs
+     */
+    MemoryPool(size_t num,
+               std::shared_ptr<MemoryModel> memoryModel,
+               size_t numPreallocated,
+               std::chrono::milliseconds idleTimeout,
+               std::chrono::milliseconds waitTimeout = std::chrono::milliseconds{0},
+               std::shared_ptr<MemoryArenas> arenas = nullptr);
+
+    ~MemoryPool();
+
+    /**
+     * Interrupt waiting of DeviceMemBlock Proxy object, waiters whose tokens are cancelled leave the queue
      */
     void Interrupt();
     /**
      * Wait and return Proxy object
+     * @param cancellationToken Token of the inference, which stops waiting when the deadline of the token passes
+     *                          or when it's cancelled (followed by Interrupt())
      * @return Proxy object through which we can access DeviceMemBlock
+     * @throws ov::Busy if DeviceMemBlock isn't available within the wait timeout
+     * @throws ov::Cancelled if DeviceMemBlock isn't available before the deadline of the inference or the inference
+     *                       is cancelled
      */
     Proxy WaitAndGet(CancellationToken& cancellationToken);
 
+    /**
+     * @returns Capacity of the pool
+     */
     size_t Size() const;
+
+    /**
+     * @returns Number of DeviceMemBlock-s which are allocated now
+     */
+    size_t NumAllocated() const;
+
+    /**
+     * Shrinks or grows capacity of the pool. Added DeviceMemBlock-s are allocated on demand and their
+     * CUDA Graphs are relocated from already captured ones on the first inference
+     * @param count Maximal number of DeviceMemBlock-s
+     */
     void Resize(size_t count);
 
+    /**
+     * @returns Statistics of waiting for DeviceMemBlock-s
+     */
+    WaitStatistics GetWaitStatistics() const;
+
+    /**
+     * @returns Number of DeviceMemBlock-s used by inferences now, it is read without locking the pool
+     */
+    size_t NumBusy() const noexcept { return num_busy_.load(std::memory_order_relaxed); }
+
+    /**
+     * @returns Number of allocated DeviceMemBlock-s available now, it is read without locking the pool
+     */
+    size_t NumFree() const noexcept { return num_free_.load(std::memory_order_relaxed); }
+
+    /**
+     * @returns Total time inferences waited for DeviceMemBlock-s, it is read without locking the pool
+     */
+    std::chrono::microseconds TotalWaitTime() const noexcept {
+        return std::chrono::microseconds{total_wait_time_.load(std::memory_order_relaxed)};
+    }
+
 private:
     friend class ::MemoryPoolTest;
 
@@ -94,9 +174,56 @@ private:
      */
     void PushBack(std::unique_ptr<DeviceMemBlock> memManager);
 
-    std::mutex mtx_;
+    std::unique_ptr<DeviceMemBlock> CreateBlock() const;
+
+    /**
+     * Releases DeviceMemBlock-s which stay unused for the idle timeout
+     */
+    void ReleaseIdleBlocks();
+
+    using Time = std::chrono::steady_clock;
+
+    /**
+     * Waits until predicate is satisfied or the wait timeout expires
+     * @returns false if the wait timeout expired
+     */
+    template <typename Predicate>
+    bool WaitUntil(std::unique_lock<std::mutex>& lock, Time::time_point deadline, Predicate predicate);
+
+    /**
+     * Removes the waiter from the queue and accounts its wait time
+     */
+    void LeaveQueue(std::list<Time::time_point>::iterator waiter);
+
+    /**
+     * Publishes numbers of busy and free DeviceMemBlock-s, it is called under the lock after they change
+     */
+    void UpdateOccupancy();
+
+    mutable std::mutex mtx_;
     std::condition_variable cond_var_;
+    std::shared_ptr<MemoryModel> memory_model_;
+    std::shared_ptr<MemoryArenas> arenas_;
     std::vector<std::unique_ptr<DeviceMemBlock>> memory_blocks_;
+    // Time when each of available DeviceMemBlock-s was returned to the pool, the oldest one is the first
+    std::vector<Time::time_point> idle_since_;
+    size_t capacity_;
+    size_t num_allocated_ = 0;
+    std::chrono::milliseconds idle_timeout_;
+    std::chrono::milliseconds wait_timeout_;
+    // Arrival time of waiting inferences in the order of arrival, only the first one may take DeviceMemBlock
+    std::list<Time::time_point> waiters_;
+    // Nodes of waiters which left the queue, they are spliced back instead of being allocated on every wait
+    std::list<Time::time_point> spare_waiters_;
+    WaitStatistics wait_statistics_;
+    // Copies of counters of the pool which metrics are polled from without taking the lock
+    std::atomic<size_t> num_busy_{0};
+    std::atomic<size_t> num_free_{0};
+    std::atomic<std::chrono::microseconds::rep> total_wait_time_{0};
+    int device_id_;
+    bool is_stopped_ = false;
+    std::condition_variable release_cond_var_;
+    std::thread release_thread_;
 };
 
 }  // namespace nvidia_gpu
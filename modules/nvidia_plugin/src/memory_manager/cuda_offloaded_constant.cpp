@@ -0,0 +1,63 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_offloaded_constant.hpp"
+
+#include <cuda_runtime_api.h>
+
+#include <cstring>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+OffloadedConstant::Allocation createManaged(gsl::span<const char> data) {
+    void* ptr = nullptr;
+    throwIfError(cudaMallocManaged(&ptr, data.size(), cudaMemAttachGlobal));
+    auto allocation = std::make_shared<const CUDA::DefaultAllocation>(ptr);
+    std::memcpy(ptr, data.data(), data.size());
+    const int device = CUDA::Device::currentId();
+    int concurrentManagedAccess = 0;
+    throwIfError(cudaDeviceGetAttribute(&concurrentManagedAccess, cudaDevAttrConcurrentManagedAccess, device));
+    if (concurrentManagedAccess) {
+        // Read-only copies of pages are created on the device, so evicted pages are just dropped
+        // instead of being written back to host
+        throwIfError(cudaMemAdvise(ptr, data.size(), cudaMemAdviseSetReadMostly, device));
+        throwIfError(cudaMemAdvise(ptr, data.size(), cudaMemAdviseSetAccessedBy, device));
+        throwIfError(cudaMemPrefetchAsync(ptr, data.size(), device, nullptr));
+    }
+    return allocation;
+}
+
+OffloadedConstant::Allocation createMappedHost(gsl::span<const char> data) {
+    void* hostPtr = nullptr;
+    // Host never reads the memory, so it is write-combined, which speeds up reads over the bus
+    throwIfError(
+        cudaHostAlloc(&hostPtr, data.size(), cudaHostAllocMapped | cudaHostAllocPortable | cudaHostAllocWriteCombined));
+    std::memcpy(hostPtr, data.data(), data.size());
+    void* devicePtr = nullptr;
+    const auto status = cudaHostGetDevicePointer(&devicePtr, hostPtr, 0);
+    if (status != cudaSuccess) {
+        logIfError(cudaFreeHost(hostPtr));
+        throwIfError(status);
+    }
+    return std::make_shared<const CUDA::DefaultAllocation>(devicePtr,
+                                                           [hostPtr](void*) { logIfError(cudaFreeHost(hostPtr)); });
+}
+
+}  // namespace
+
+OffloadedConstant::Allocation OffloadedConstant::create(gsl::span<const char> data, Placement placement) {
+    switch (placement) {
+        case Placement::Managed:
+            return createManaged(data);
+        case Placement::MappedHost:
+            return createMappedHost(data);
+    }
+    return nullptr;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/runtime.hpp>
+#include <gsl/span>
+#include <memory>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Constant placed out of device memory, so that models which constants don't fit device memory could run.
+ */
+class OffloadedConstant {
+public:
+    using Allocation = std::shared_ptr<const CUDA::DefaultAllocation>;
+
+    enum class Placement {
+        // Unified memory, it is prefetched to the device and may be evicted to host under memory pressure
+        Managed,
+        // Page-locked host memory mapped into the address space of the device and read over the bus in place,
+        // suits tables of which a few rows are read per inference (e.g. embeddings read by Gather)
+        MappedHost,
+    };
+
+    /**
+     * Allocates memory of the current device with the given placement and copies the content into it
+     * @param data Content of the constant
+     * @param placement Placement of the memory
+     * @return Memory accessible by the device
+     */
+    static Allocation create(gsl::span<const char> data, Placement placement);
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -3,6 +3,8 @@
 //
 
 #include "cuda_memory_model_builder.hpp"
+
+#include <algorithm>
 #include "openvino/core/except.hpp"
 #include "memory_manager/model/details/cuda_memory_utils.hpp"
 
@@ -17,12 +19,47 @@ void MemoryModelBuilder::addAllocation(BufferID id, int producerIndex, int lastC
     boxes_.emplace_back(MemorySolver::Box{producerIndex, lastConsumerIndex, aligned_size, id});
 }
 
+void MemoryModelBuilder::addScratchAllocation(BufferID id, int opIndex, size_t bsize) {
+    OPENVINO_ASSERT(bsize > 0, "Allocation size is zero!");
+    auto res = offsets_.emplace(id, 0);
+    OPENVINO_ASSERT(res.second, "ID is not unique!");
+    const int64_t aligned_size = static_cast<int64_t>(applyAllignment(bsize));
+    scratch_boxes_.emplace_back(MemorySolver::Box{opIndex, opIndex, aligned_size, id});
+}
+
 MemoryModel::Ptr MemoryModelBuilder::build() {
-    MemorySolver solver{boxes_};
+    std::vector<MemorySolver::Box> boxes{boxes_};
+    boxes.insert(boxes.end(), scratch_boxes_.begin(), scratch_boxes_.end());
+    MemorySolver solver{boxes};
     const size_t blob_size = solver.solve();
     for (auto& pair : offsets_) pair.second = solver.getOffset(pair.first);
+    scratch_memory_size_ = 0;
+    if (scratch_boxes_.empty()) {
+        return std::make_shared<MemoryModel>(blob_size, offsets_);
+    }
 
-    return std::make_shared<MemoryModel>(blob_size, offsets_);
+    // Scratch buffers of different operations never overlap in time, so all of them fit an arena
+    // placed after tensors and sized to the greatest need of a single operation
+    MemorySolver tensors_solver{boxes_};
+    const size_t tensors_size = applyAllignment(tensors_solver.solve());
+    std::unordered_map<int, int64_t> arena_usage;
+    std::unordered_map<BufferID, ptrdiff_t> arena_offsets;
+    int64_t arena_size = 0;
+    for (const auto& box : scratch_boxes_) {
+        auto& op_usage = arena_usage[box.start];
+        arena_offsets.emplace(box.id, op_usage);
+        op_usage += box.size;
+        arena_size = std::max(arena_size, op_usage);
+    }
+    if (tensors_size + arena_size >= blob_size) {
+        // The solver has packed scratch buffers between dead tensors better than the arena
+        scratch_memory_size_ = blob_size > tensors_size ? blob_size - tensors_size : 0;
+        return std::make_shared<MemoryModel>(blob_size, offsets_);
+    }
+    for (const auto& box : boxes_) offsets_.at(box.id) = tensors_solver.getOffset(box.id);
+    for (const auto& pair : arena_offsets) offsets_.at(pair.first) = tensors_size + pair.second;
+    scratch_memory_size_ = arena_size;
+    return std::make_shared<MemoryModel>(tensors_size + arena_size, offsets_);
 }
 
 }  // namespace nvidia_gpu
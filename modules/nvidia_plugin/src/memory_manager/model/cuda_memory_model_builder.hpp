@@ -31,13 +31,34 @@ public:
      */
     void addAllocation(BufferID id, int producerIndex, int lastConsumerIndex, size_t bsize);
 
+    /**
+     * Defines a scratch allocation (e.g. mutable work buffer) which is alive only while a single
+     * operation is executed. Scratch allocations are either packed between tensors or placed into
+     * a shared scratch arena sized to the greatest need of a single operation, whichever is smaller.
+     *
+     * @param [in] id Buffer identifier.
+     * @param [in] opIndex The execution order index of the operation using the buffer.
+     * @param [in] bsize Buffer memory size in bytes.
+     * @throws ov::Exception if allocation size is zero or buffer
+     * with specified id is already added.
+     */
+    void addScratchAllocation(BufferID id, int opIndex, size_t bsize);
+
     /**
      * Creates and initializes MemoryModel object.
      */
     MemoryModel::Ptr build();
 
+    /**
+     * @returns Size of the memory blob taken by scratch allocations in the last built MemoryModel
+     * in addition to tensors
+     */
+    size_t scratchMemorySize() const { return scratch_memory_size_; }
+
 private:
     std::vector<MemorySolver::Box> boxes_;
+    std::vector<MemorySolver::Box> scratch_boxes_;
+    size_t scratch_memory_size_ = 0;
     std::unordered_map<BufferID, ptrdiff_t> offsets_;
 };
 
@@ -70,6 +70,12 @@ private:
     unsigned offset_{};
 };
 
+/**
+ * Maps external (not allocated by plugin memory blocks) buffers onto device pointers
+ * provided for the current inference
+ */
+using ExternalBuffers = std::unordered_map<BufferID, void*>;
+
 inline std::ostream& operator<<(std::ostream& s, const TensorID& t) {
     s << "ID: " << t.GetId() << ", ";
     s << "BufferID: " << t.GetBuffer().GetId() << ", ";
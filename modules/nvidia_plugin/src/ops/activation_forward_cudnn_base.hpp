@@ -15,6 +15,7 @@ namespace nvidia_gpu {
 
 class ActivationForwardCuDnnOpBase : public OperationCuDnn {
 public:
+    static constexpr bool kInPlace = true;
     static constexpr std::size_t max_shape_size = 5;
 
     static constexpr std::initializer_list<cudnnDataType_t> supported_types{
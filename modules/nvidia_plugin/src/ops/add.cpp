@@ -2,13 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include <fmt/format.h>
-
 #include <openvino/core/except.hpp>
-#include <sstream>
 
 #include "add_cuda.hpp"
 #include "add_cudnn.hpp"
+#include "cuda_implementation_selection.hpp"
 #include "cuda_operation_registry.hpp"
 
 namespace ov {
@@ -24,20 +22,19 @@ static OperationBase::Ptr addFactory(const CreationContext& context,
     const OperationBase::IndexCollection inputs{inputIds};
     const OperationBase::IndexCollection outputs{outputIds};
 
-    std::stringstream exception_msg;
-    try {
-        return std::make_shared<AddCuDnnOp>(
-            context, node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
-    } catch (const std::exception& e) {
-        exception_msg << "Failed to create AddCuDnn impl: " << e.what();
-    }
-    try {
-        return std::make_shared<AddCudaOp>(
-            context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
-    } catch (const std::exception& e) {
-        exception_msg << "\nFailed to create AddCuda impl: " << e.what();
-    }
-    throw_ov_exception(fmt::format("Add node is not supported:\n{}", exception_msg.str()));
+    return createFastestImplementation(
+        context,
+        *node,
+        shapesTuningKey(*node),
+        {{"AddCuDnn",
+          [&] {
+              return std::make_shared<AddCuDnnOp>(
+                  context, node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
+          }},
+         {"AddCuda", [&] {
+              return std::make_shared<AddCudaOp>(
+                  context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
+          }}});
 }
 
 OPERATION_REGISTER_FACTORY(addFactory, Add)
@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "assign.hpp"
+
+#include <cstdint>
+#include <cuda_op_buffers_extractor.hpp>
+#include <cuda_operation_registry.hpp>
+#include <cuda_variable_state.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+namespace ov {
+namespace nvidia_gpu {
+
+AssignOp::AssignOp(const CreationContext& context,
+                   const NodeOp& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)),
+      size_{OperationBuffersExtractor::GetTensorByteSize(node.input(0))} {}
+
+void AssignOp::Execute(const InferenceRequestContext& context,
+                       Inputs inputTensors,
+                       Outputs outputTensors,
+                       const Workbuffers&) const {
+    OPENVINO_ASSERT(inputTensors.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputTensors.size() == 2, "Node name: ", GetName());
+    const auto& stream = context.getThreadContext().stream();
+    const auto state = outputTensors[outputTensors.size() - 1];
+    if (inputTensors[0].get() != state.get()) {
+        stream.transfer(state, inputTensors[0], size_);
+    }
+    stream.memset(CUDA::DevicePointer<void*>{static_cast<std::uint8_t*>(state.get()) +
+                                             VariableState::initializedFlagOffset(size_)},
+                  true,
+                  sizeof(bool));
+}
+
+bool AssignOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(AssignOp, Assign);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <openvino/op/util/assign_base.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Writes state of the variable, which is the last output of the operation (see VariableState),
+ * and marks the state as initialized.
+ *
+ * Input is usually produced right into the state, so there is nothing to copy.
+ */
+class AssignOp : public OperationBase {
+public:
+    using NodeOp = ov::op::util::AssignBase;
+    AssignOp(const CreationContext& context,
+             const NodeOp& node,
+             IndexCollection&& inputIds,
+             IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::size_t size_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,48 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "calculate_grid.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+CalculateGridOp::CalculateGridOp(const CreationContext& context,
+                                 const ov::Node& node,
+                                 IndexCollection&& inputIds,
+                                 IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    if (node.get_input_element_type(0) != ov::element::f32) {
+        throw_ov_exception(fmt::format("CalculateGrid {} supports only f32 input, not {}",
+                                       GetName(),
+                                       node.get_input_element_type(0).get_type_name()));
+    }
+    kernel_.emplace(node.get_input_shape(0)[0], context.device().props().maxThreadsPerBlock);
+}
+
+void CalculateGridOp::Execute(const InferenceRequestContext& context,
+                              Inputs inputs,
+                              Outputs outputs,
+                              const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               static_cast<const float*>(inputs[0].get()),
+               static_cast<float*>(outputs[0].get()),
+               workbuffers.mutable_buffers[0].get());
+}
+
+bool CalculateGridOp::IsCudaGraphCompatible() const { return true; }
+
+WorkbufferRequest CalculateGridOp::GetWorkBufferRequest() const { return {{}, {kernel_->workspaceSize()}}; }
+
+OPERATION_REGISTER(CalculateGridOp, CalculateGrid);
+}  // namespace nvidia_gpu
+}  // namespace ov
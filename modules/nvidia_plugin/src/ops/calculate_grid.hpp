@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/sparse_conv.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * CalculateGrid of the custom operations, which makes output points of SparseConv
+ */
+class CalculateGridOp : public OperationBase {
+public:
+    CalculateGridOp(const CreationContext& context,
+                    const ov::Node& node,
+                    IndexCollection&& inputIds,
+                    IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::CalculateGrid> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
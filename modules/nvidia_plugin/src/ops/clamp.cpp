@@ -6,8 +6,8 @@
 
 #include <cuda_operation_base.hpp>
 #include <cuda_operation_registry.hpp>
+#include <cuda_implementation_selection.hpp>
 #include <openvino/op/clamp.hpp>
-#include <sstream>
 
 #include "clamp_cuda.hpp"
 #include "clamp_cudnn.hpp"
@@ -27,32 +27,29 @@ static OperationBase::Ptr clampFactory(const CreationContext& context,
     const IndexCollection inputs{inputIds};
     const IndexCollection outputs{outputIds};
 
-    std::stringstream exception_msg;
-    try {
-        return std::make_shared<ClippedReluCuDnnOp>(
-            context, node_op, IndexCollection{inputIds}, IndexCollection{outputIds});
-    } catch (const std::exception& e) {
-        exception_msg << "Failed to create ClippedReluCuDnnOp implementation: " << e.what();
-    }
-    // TODO: ClampCuDnnOp is disabled now due to performance lower then both, ClippedReluCuDnnOp and ClampCudaOp
-    // versions (CUDA 11.2 + cuDNN 8.1.0).
-    // It may be enabled in the future if becomes faster in a newer cuDNN version
-    //
-    // try {
-    //     return std::make_shared<ClampCuDnnOp>(context, node_op, IndexCollection{inputIds},
-    //     IndexCollection{outputIds});
-    // } catch (const std::exception& e) {
-    //     exception_msg << "\nFailed to create ClampCuDnnOp implementation: " << e.what();
-    // }
-    try {
-        return std::make_shared<ClampCudaOp>(context, node_op, IndexCollection{inputIds}, IndexCollection{outputIds});
-    } catch (const std::exception& e) {
-        exception_msg << "\nFailed to create ClampCudaOp implementation: " << e.what();
-    }
-    throw_ov_exception(fmt::format("Clamp node is not supported:\n{}", exception_msg.str()));
+    // ClampCuDnnOp is slower than both ClippedReluCuDnnOp and ClampCudaOp (CUDA 11.2 + cuDNN 8.1.0),
+    // so it is created only if it is benchmarked faster with a newer cuDNN version
+    return createFastestImplementation(
+        context,
+        *node,
+        fmt::format("{};{};{}", shapesTuningKey(*node), node_op.get_min(), node_op.get_max()),
+        {{"ClippedReluCuDnn",
+          [&] {
+              return std::make_shared<ClippedReluCuDnnOp>(
+                  context, node_op, IndexCollection{inputs}, IndexCollection{outputs});
+          }},
+         {"ClampCuda",
+          [&] {
+              return std::make_shared<ClampCudaOp>(context, node_op, IndexCollection{inputs}, IndexCollection{outputs});
+          }},
+         {"ClampCuDnn",
+          [&] {
+              return std::make_shared<ClampCuDnnOp>(context, node_op, IndexCollection{inputs}, IndexCollection{outputs});
+          },
+          true}});
 }
 
-OPERATION_REGISTER_FACTORY(clampFactory, Clamp)
+OPERATION_REGISTER_IN_PLACE_FACTORY(clampFactory, Clamp)
 
 }  // namespace nvidia_gpu
 }  // namespace ov
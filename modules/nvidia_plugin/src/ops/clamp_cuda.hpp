@@ -15,6 +15,7 @@ namespace nvidia_gpu {
 class ClampCudaOp : public OperationBase {
 public:
     using NodeOp = ov::op::v0::Clamp;
+    static constexpr bool kInPlace = true;
 
     ClampCudaOp(const CreationContext& context,
                 const NodeOp& node,
@@ -4,11 +4,18 @@
 
 #include "numpy_broadcast_params.h"
 
+#include <algorithm>
 #include <cuda/runtime.hpp>
+#include <limits>
+
+#include "openvino/op/constant.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
+// Per-channel vectors are kept in shared memory of kernels
+constexpr size_t kMaxPerChannelSize = 16 * 1024;
+
 template <typename T>
 static auto size_in_bytes(const std::vector<T>& v) noexcept {
     return sizeof(T) * v.size();
@@ -29,6 +36,45 @@ std::unique_ptr<NumpyBroadcastParams> NumpyBroadcastParams::create(const ov::Sha
     }
 }
 
+std::unique_ptr<NumpyBroadcastParams> NumpyBroadcastParams::create(const ov::Node& node, size_t input_idx) {
+    const auto& in_shape = node.get_input_shape(input_idx);
+    const auto& out_shape = node.get_output_shape(0);
+    const auto* constant = ov::as_type<const ov::op::v0::Constant>(node.get_input_node_ptr(input_idx));
+    const size_t out_size = ov::shape_size(out_shape);
+    if (constant == nullptr || in_shape == out_shape || out_size > std::numeric_limits<unsigned>::max()) {
+        return create(in_shape, out_shape);
+    }
+    const size_t element_size = constant->get_element_type().size();
+    if (ov::shape_size(in_shape) == 1 && element_size <= kernel::NumpyBroadcastMapper::kMaxScalarSize) {
+        return std::make_unique<NumpyBroadcastParamsConstant>(
+            kernel::NumpyBroadcastMapper::scalar(constant->get_data_ptr(), element_size));
+    }
+
+    // Dimensions of the input, which aren't 1, should be a contiguous range of dimensions of the output
+    OPENVINO_ASSERT(in_shape.size() <= out_shape.size());
+    const size_t offset = out_shape.size() - in_shape.size();
+    size_t first = in_shape.size();
+    size_t last = 0;
+    for (size_t i = 0; i < in_shape.size(); ++i) {
+        if (in_shape[i] != 1) {
+            first = std::min(first, i);
+            last = i + 1;
+        }
+    }
+    for (size_t i = first; i < last; ++i) {
+        if (in_shape[i] != out_shape[offset + i]) {
+            return create(in_shape, out_shape);
+        }
+    }
+    const size_t num_channels = ov::shape_size(in_shape);
+    if (first < last && num_channels < out_size && num_channels * element_size <= kMaxPerChannelSize) {
+        const size_t inner_size = ov::shape_size(out_shape.begin() + offset + last, out_shape.end());
+        return std::make_unique<NumpyBroadcastParamsConstant>(
+            kernel::NumpyBroadcastMapper::perChannel(num_channels, inner_size));
+    }
+    return create(in_shape, out_shape);
+}
+
 NumpyBroadcastParamsImpl::NumpyBroadcastParamsImpl(const ov::Shape& in_shape, const ov::Shape& out_shape)
     : shape_rank_{out_shape.size()}, dst_strides_{ov::row_major_strides(out_shape)} {
     ov::Shape broadcasted_shape{in_shape};
@@ -46,16 +92,55 @@ NumpyBroadcastParamsImpl::NumpyBroadcastParamsImpl(const ov::Shape& in_shape, co
         OPENVINO_ASSERT((in_dim == 1) || (in_dim == out_shape.at(i)));
     }
     OPENVINO_ASSERT(broadcasted_dims_.size() == shape_rank_);
+
+    ov::Shape collapsed_in_shape;
+    ov::Shape collapsed_out_shape;
+    for (size_t i = 0; i < shape_rank_; ++i) {
+        if (out_shape[i] == 1) {
+            continue;
+        }
+        const bool broadcasted = broadcasted_shape[i] != out_shape[i];
+        const bool last_broadcasted =
+            !collapsed_out_shape.empty() && collapsed_in_shape.back() != collapsed_out_shape.back();
+        if (!collapsed_out_shape.empty() && broadcasted == last_broadcasted) {
+            collapsed_in_shape.back() *= broadcasted_shape[i];
+            collapsed_out_shape.back() *= out_shape[i];
+        } else {
+            collapsed_in_shape.push_back(broadcasted_shape[i]);
+            collapsed_out_shape.push_back(out_shape[i]);
+        }
+    }
+    if (collapsed_out_shape.empty()) {
+        collapsed_in_shape.push_back(1);
+        collapsed_out_shape.push_back(1);
+    }
+    if (collapsed_out_shape.size() <= kernel::NumpyBroadcastMapper::kMaxInlineRank) {
+        collapsed_dst_strides_ = ov::row_major_strides(collapsed_out_shape);
+        collapsed_src_strides_ = ov::row_major_strides(collapsed_in_shape);
+        for (size_t i = 0; i < collapsed_out_shape.size(); ++i) {
+            if (collapsed_in_shape[i] != collapsed_out_shape[i]) {
+                collapsed_src_strides_[i] = 0;
+            }
+        }
+    }
 }
 
+bool NumpyBroadcastParamsImpl::inline_mapper() const { return !collapsed_dst_strides_.empty(); }
+
 void NumpyBroadcastParamsImpl::addWorkbufferRequests(
     std::vector<WorkbufferRequest::size_in_bytes_t>& immutable_buffer_sizes) {
+    if (inline_mapper()) {
+        return;
+    }
     ib_src_strides_.addRequest(immutable_buffer_sizes, size_in_bytes(src_strides_));
     ib_dst_strides_.addRequest(immutable_buffer_sizes, size_in_bytes(dst_strides_));
     ib_broadcasted_dims_.addRequest(immutable_buffer_sizes, size_in_bytes(broadcasted_dims_));
 }
 
 void NumpyBroadcastParamsImpl::initWorkbuffers(const std::vector<CUDA::DevicePointer<void*>>& buffers) const {
+    if (inline_mapper()) {
+        return;
+    }
     uploadDataToWorkbuffer(CUDA::DevicePointer<void*>{ib_src_strides_.requiredPtr(buffers)}, src_strides_);
     uploadDataToWorkbuffer(CUDA::DevicePointer<void*>{ib_dst_strides_.requiredPtr(buffers)}, dst_strides_);
     uploadDataToWorkbuffer(CUDA::DevicePointer<void*>{ib_broadcasted_dims_.requiredPtr(buffers)}, broadcasted_dims_);
@@ -63,6 +148,11 @@ void NumpyBroadcastParamsImpl::initWorkbuffers(const std::vector<CUDA::DevicePoi
 
 kernel::NumpyBroadcastMapper NumpyBroadcastParamsImpl::mapper(
     const std::vector<CUDA::DevicePointer<const void*>>& immutable_buffers) const {
+    if (inline_mapper()) {
+        const bool identity = collapsed_dst_strides_.size() == 1 && collapsed_src_strides_.front() == 1;
+        return identity ? kernel::NumpyBroadcastMapper{}
+                        : kernel::NumpyBroadcastMapper{collapsed_src_strides_, collapsed_dst_strides_};
+    }
     return kernel::NumpyBroadcastMapper{static_cast<const size_t*>(ib_src_strides_.requiredPtr(immutable_buffers)),
                                         static_cast<const size_t*>(ib_dst_strides_.requiredPtr(immutable_buffers)),
                                         static_cast<const size_t*>(ib_broadcasted_dims_.requiredPtr(immutable_buffers)),
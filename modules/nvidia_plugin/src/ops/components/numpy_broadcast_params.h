@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "kernels/details/numpy_broadcast_mapper.cuh"
+#include "openvino/core/node.hpp"
 #include "openvino/core/shape.hpp"
 #include "workbuffer_desc.hpp"
 
@@ -17,6 +18,12 @@ class NumpyBroadcastParams {
 public:
     virtual ~NumpyBroadcastParams() {}
     static std::unique_ptr<NumpyBroadcastParams> create(const ov::Shape& in_shape, const ov::Shape& out_shape);
+    /**
+     * Same as create() for shapes of the input and the output of the node, but if the input is a Constant node,
+     * which is a single value or a per-channel vector of the output, the mapper is specialized
+     * (see kernel::NumpyBroadcastMapper::scalar() and kernel::NumpyBroadcastMapper::perChannel())
+     */
+    static std::unique_ptr<NumpyBroadcastParams> create(const ov::Node& node, size_t input_idx);
 
     virtual void addWorkbufferRequests(std::vector<WorkbufferRequest::size_in_bytes_t>& immutable_buffer_sizes) = 0;
     virtual void initWorkbuffers(const std::vector<CUDA::DevicePointer<void*>>& buffers) const = 0;
@@ -35,6 +42,27 @@ public:
     }
 };
 
+class NumpyBroadcastParamsConstant : public NumpyBroadcastParams {
+public:
+    explicit NumpyBroadcastParamsConstant(const kernel::NumpyBroadcastMapper& mapper) : mapper_{mapper} {}
+
+    void addWorkbufferRequests(std::vector<WorkbufferRequest::size_in_bytes_t>& immutable_buffer_sizes) override {}
+    void initWorkbuffers(const std::vector<CUDA::DevicePointer<void*>>& buffers) const override {}
+    kernel::NumpyBroadcastMapper mapper(
+        const std::vector<CUDA::DevicePointer<const void*>>& immutable_buffers) const override {
+        return mapper_;
+    }
+
+private:
+    kernel::NumpyBroadcastMapper mapper_;
+};
+
+/**
+ * Dimensions, which are broadcasted in the same way, are merged and dimensions of size 1 are dropped,
+ * so that the typical bias, per-channel and scalar patterns end up with rank 1-3.
+ * Shapes, which are collapsed to at most NumpyBroadcastMapper::kMaxInlineRank dimensions,
+ * are passed to kernels by value, the rest keep strides in immutable workbuffers.
+ */
 class NumpyBroadcastParamsImpl : public NumpyBroadcastParams {
 public:
     NumpyBroadcastParamsImpl(const ov::Shape& in_shape, const ov::Shape& out_shape);
@@ -46,7 +74,11 @@ public:
         const std::vector<CUDA::DevicePointer<const void*>>& immutable_buffers) const override;
 
 private:
+    bool inline_mapper() const;
+
     size_t shape_rank_;
+    std::vector<size_t> collapsed_src_strides_;
+    std::vector<size_t> collapsed_dst_strides_;
     std::vector<size_t> src_strides_;
     std::vector<size_t> dst_strides_;
     std::vector<size_t> broadcasted_dims_;
@@ -0,0 +1,110 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compressed_matmul.hpp"
+
+#include <cuda/blas.hpp>
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+#include "cuda/constant_factory.hpp"
+#include "matmul.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+CompressedMatMulOp::CompressedMatMulOp(const CreationContext& context,
+                                       const NodeOp& node,
+                                       IndexCollection&& inputIds,
+                                       IndexCollection&& outputIds)
+    : OperationCuBlas(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3 || node.get_input_size() == 4, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto& element_type = node.get_input_element_type(0);
+    data_type_ = convertDataType<cudaDataType_t>(element_type);
+    compute_type_ = MatMulOp::GetComputeType(data_type_, data_type_);
+    gemm_compute_type_ = MatMulOp::GetGemmComputeType(data_type_, compute_type_, context.tf32());
+    element_size_ = element_type.size();
+    const auto& input_shape = node.get_input_shape(0);
+    OPENVINO_ASSERT(!input_shape.empty(), "Node name: ", GetName());
+    k_ = input_shape.back();
+    n_ = node.get_input_shape(1)[0];
+    rows_ = ov::shape_size(input_shape) / k_;
+    has_bias_ = node.has_bias();
+    OPENVINO_ASSERT(k_ != 0, "Node name: ", GetName());
+    OPENVINO_ASSERT(n_ != 0, "Node name: ", GetName());
+    OPENVINO_ASSERT(rows_ != 0, "Node name: ", GetName());
+    OPENVINO_ASSERT(!has_bias_ || ov::shape_size(node.get_input_shape(3)) == rows_ * n_, "Node name: ", GetName());
+
+    const auto max_threads_per_block = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    kernel_ = kernel::CompressedMatMul{convertDataType<kernel::Type_t>(element_type),
+                                       convertDataType<kernel::Type_t>(node.get_weights_type()),
+                                       rows_,
+                                       k_,
+                                       n_,
+                                       max_threads_per_block};
+}
+
+WorkbufferRequest CompressedMatMulOp::GetWorkBufferRequest() const {
+    if (isGemv()) {
+        return {};
+    }
+    return {{}, {n_ * k_ * element_size_}};
+}
+
+void CompressedMatMulOp::Execute(const InferenceRequestContext& context,
+                                 Inputs inputs,
+                                 Outputs outputs,
+                                 const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == (has_bias_ ? 4 : 3), "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    auto& stream = context.getThreadContext().stream();
+    const void* bias = has_bias_ ? inputs[3].get() : nullptr;
+
+    if (isGemv()) {
+        kernel_->gemv(stream.get(), inputs[0].get(), inputs[1].get(), inputs[2].get(), bias, outputs[0].get());
+        return;
+    }
+
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    auto weights = workbuffers.mutable_buffers[0];
+    kernel_->dequantize(stream.get(), inputs[1].get(), inputs[2].get(), weights.get());
+    if (has_bias_) {
+        stream.transfer(outputs[0], inputs[3], rows_ * n_ * element_size_);
+    }
+    const auto* beta = has_bias_ ? &CUDA::NumericConst<CUDA::constants::one>(compute_type_)
+                                 : &CUDA::NumericConst<CUDA::constants::zero>(compute_type_);
+    /**
+     * NOTE: Dequantized weights W [n, k] are row-major, so C [rows, n] = A [rows, k] x Wt
+     *       is computed by cuBLAS in column-major as Ct = W x At
+     */
+    throwIfError(cublasGemmEx(context.getThreadContext().cuBlasHandle().get(),
+                              CUBLAS_OP_T,
+                              CUBLAS_OP_N,
+                              n_,
+                              rows_,
+                              k_,
+                              &CUDA::NumericConst<CUDA::constants::one>(compute_type_),
+                              weights.get(),
+                              data_type_,
+                              k_,
+                              inputs[0].get(),
+                              data_type_,
+                              k_,
+                              beta,
+                              outputs[0].get(),
+                              data_type_,
+                              n_,
+                              gemm_compute_type_,
+                              CUBLAS_GEMM_DEFAULT));
+}
+
+bool CompressedMatMulOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(CompressedMatMulOp, CompressedMatMul);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,50 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/compressed_matmul.hpp>
+
+#include "kernels/compressed_matmul.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Multiplies activations by weights quantized to i8/i4. A few rows of activations are multiplied by the fused
+ * dequantizing kernel, more rows are multiplied by cuBLAS after weights are dequantized into a mutable work buffer
+ */
+class CompressedMatMulOp : public OperationCuBlas {
+public:
+    using NodeOp = nodes::CompressedMatMul;
+    CompressedMatMulOp(const CreationContext& context,
+                       const NodeOp& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    bool isGemv() const { return rows_ <= kernel::CompressedMatMul::max_gemv_rows; }
+
+    cudaDataType_t data_type_ = cudaDataType_t::CUDA_R_32F;
+    cudaDataType_t compute_type_ = cudaDataType_t::CUDA_R_32F;
+    cublasComputeType_t gemm_compute_type_ = CUBLAS_COMPUTE_32F;
+    size_t element_size_ = 0;
+    size_t rows_ = 0;
+    size_t k_ = 0;
+    size_t n_ = 0;
+    bool has_bias_ = false;
+    std::optional<kernel::CompressedMatMul> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
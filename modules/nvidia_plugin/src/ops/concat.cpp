@@ -12,6 +12,8 @@
 #include <vector>
 
 #include "converters.hpp"
+#include "kernels/pointer_array.hpp"
+#include "transformer/nodes/concat_convert.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -25,7 +27,10 @@ ConcatOp::ConcatOp(const CreationContext& context,
     const ov::element::Type element_type{concatOp.get_input_element_type(0)};
     auto output_element_type = concatOp.get_output_element_type(0);
     OPENVINO_ASSERT(concatOp.get_output_size() == 1, "Node name: ", GetName());
-    OPENVINO_ASSERT(element_type == output_element_type, "Node name: ", GetName());
+    // Output may be of another type for ConcatConvert
+    OPENVINO_ASSERT(element_type == output_element_type || dynamic_cast<const nodes::ConcatConvert*>(&concatOp),
+                    "Node name: ",
+                    GetName());
     OPENVINO_ASSERT(num_inputs_ == GetInputIds().size(), "Node name: ", GetName());
     OPENVINO_ASSERT(GetOutputIds().size() == 1, "Node name: ", GetName());
     const auto& outputShape = concatOp.get_output_shape(0);
@@ -60,6 +65,7 @@ ConcatOp::ConcatOp(const CreationContext& context,
     const std::size_t threadsPerBlock = (numBlocks == 1) ? allChunkSize : maxBlockSize;
 
     concat_kernel_ = kernel::Concat{convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type),
+                                    convertDataType<ov::nvidia_gpu::kernel::Type_t>(output_element_type),
                                     num_inputs_,
                                     std::move(chunks),
                                     chunk_size,
@@ -88,15 +94,19 @@ void ConcatOp::Execute(const InferenceRequestContext& context,
     OPENVINO_ASSERT(workbuffers.immutable_buffers.size() == 1, "Node name: ", GetName());
     OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
 
-    stream.upload(workbuffers.mutable_buffers[0], inputs.data(), mutableWbSize());
+    kernel::fillPointerArray(stream.get(),
+                             workbuffers.mutable_buffers[0].get(),
+                             reinterpret_cast<const void* const*>(inputs.data()),
+                             num_inputs_);
     (*concat_kernel_)(stream.get(),
                       workbuffers.immutable_buffers[0].get(),
                       reinterpret_cast<const void* const*>(workbuffers.mutable_buffers[0].get()),
                       outputs[0].get());
 }
 
-bool ConcatOp::IsCudaGraphCompatible() const { return false; }
+bool ConcatOp::IsCudaGraphCompatible() const { return true; }
 
 OPERATION_REGISTER(ConcatOp, Concat);
+OPERATION_REGISTER(ConcatOp, ConcatConvert);
 }  // namespace nvidia_gpu
 }  // namespace ov
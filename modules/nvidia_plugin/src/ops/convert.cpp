@@ -31,17 +31,13 @@ ConvertOp::ConvertOp(const CreationContext& context,
         throw_ov_exception("Unsupported data type : Type_t::u1");
     auto input_shape = node->get_input_shape(0);
     auto output_shape = node->get_output_shape(0);
-    const unsigned size = std::accumulate(input_shape.begin(), input_shape.end(), 1, std::multiplies<size_t>());
-    auto output_size = std::accumulate(output_shape.begin(), output_shape.end(), 1, std::multiplies<size_t>());
+    const size_t size = ov::shape_size(input_shape);
+    const size_t output_size = ov::shape_size(output_shape);
     OPENVINO_ASSERT(size == output_size, "Node name: ", GetName());
-    const auto max_block_size = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
-    const auto num_blocks = (size % max_block_size == 0) ? (size / max_block_size) : (size / max_block_size + 1);
-    const auto threads_per_block = (num_blocks == 1) ? size : max_block_size;
     convert_kernel_ = kernel::Convert(convertDataType<ov::nvidia_gpu::kernel::Type_t>(output_element_type),
                                       convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type),
                                       size,
-                                      num_blocks,
-                                      threads_per_block);
+                                      static_cast<unsigned>(context.device().props().maxThreadsPerBlock));
 }
 
 void ConvertOp::Execute(const InferenceRequestContext& context,
@@ -0,0 +1,81 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_color_preprocess.hpp"
+
+#include <algorithm>
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+ConvertColorPreprocessOp::ConvertColorPreprocessOp(const CreationContext& context,
+                                                   const NodeOp& node,
+                                                   IndexCollection&& inputIds,
+                                                   IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto& attrs = node.get_attrs();
+    const auto input_type = convertDataType<kernel::Type_t>(node.get_input_element_type(0));
+    const auto output_type = convertDataType<kernel::Type_t>(node.get_output_element_type(0));
+    OPENVINO_ASSERT(
+        kernel::ConvertColorPreprocess::isTypeSupported(input_type, output_type), "Node name: ", GetName());
+    const bool single_plane = node.get_input_size() == 1;
+
+    kernel::ConvertColorPreprocess::Params params;
+    params.batch_size = node.get_input_shape(0)[0];
+    params.in_h = node.get_image_height();
+    params.in_w = node.get_input_shape(0)[2];
+    params.out_h = static_cast<size_t>(attrs.height);
+    params.out_w = static_cast<size_t>(attrs.width);
+    const size_t image_size = params.in_h * params.in_w;
+    if (single_plane) {
+        // U and V values follow Y values of each image
+        params.stride_y = params.stride_u = params.stride_v = image_size * 3 / 2;
+        params.offset_u = image_size;
+        params.offset_v = image_size + image_size / 4;
+    } else {
+        params.stride_y = image_size;
+        params.stride_u = attrs.i420 ? image_size / 4 : image_size / 2;
+        params.stride_v = image_size / 4;
+    }
+    params.scale_y = attrs.source_coordinates[0];
+    params.offset_y = attrs.source_coordinates[1];
+    params.scale_x = attrs.source_coordinates[2];
+    params.offset_x = attrs.source_coordinates[3];
+    std::copy(attrs.scale.begin(), attrs.scale.end(), params.scale);
+    std::copy(attrs.shift.begin(), attrs.shift.end(), params.shift);
+    params.bgr = attrs.bgr;
+    params.round = attrs.round;
+    params.nchw = attrs.nchw;
+
+    const auto format =
+        attrs.i420 ? kernel::ConvertColorPreprocess::Format::I420 : kernel::ConvertColorPreprocess::Format::NV12;
+    kernel_ = kernel::ConvertColorPreprocess{
+        format, input_type, output_type, params, static_cast<size_t>(context.device().props().maxThreadsPerBlock)};
+}
+
+void ConvertColorPreprocessOp::Execute(const InferenceRequestContext& context,
+                                       Inputs inputs,
+                                       Outputs outputs,
+                                       const Workbuffers&) const {
+    OPENVINO_ASSERT(!inputs.empty() && inputs.size() <= 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    // Planes, which are missing, are read from the last given one at their offsets
+    const void* y = inputs[0].get();
+    const void* u = inputs[std::min<size_t>(1, inputs.size() - 1)].get();
+    const void* v = inputs[std::min<size_t>(2, inputs.size() - 1)].get();
+    (*kernel_)(context.getThreadContext().stream().get(), y, u, v, outputs[0].get());
+}
+
+bool ConvertColorPreprocessOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(ConvertColorPreprocessOp, ConvertColorPreprocess);
+}  // namespace nvidia_gpu
+}  // namespace ov
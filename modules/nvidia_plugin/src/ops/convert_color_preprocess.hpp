@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/convert_color_preprocess.hpp>
+
+#include "kernels/convert_color_preprocess.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Converts NV12 or I420 images to RGB, resizes, normalizes and lays them out by a single kernel
+ */
+class ConvertColorPreprocessOp : public OperationBase {
+public:
+    using NodeOp = nodes::ConvertColorPreprocess;
+    ConvertColorPreprocessOp(const CreationContext& context,
+                             const NodeOp& node,
+                             IndexCollection&& inputIds,
+                             IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::ConvertColorPreprocess> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_normalize.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <numeric>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+ConvertNormalizeOp::ConvertNormalizeOp(const CreationContext& context,
+                                       const NodeOp& node,
+                                       IndexCollection&& inputIds,
+                                       IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto input_type = convertDataType<kernel::Type_t>(node.get_input_element_type(0));
+    const auto output_type = convertDataType<kernel::Type_t>(node.get_output_element_type(0));
+    OPENVINO_ASSERT(kernel::ConvertNormalize::isTypeSupported(output_type, input_type), "Node name: ", GetName());
+    const auto& shape = node.get_input_shape(0);
+    const size_t channels = ov::shape_size(node.get_input_shape(1));
+    OPENVINO_ASSERT(channels > 0 && ov::shape_size(node.get_input_shape(2)) == channels, "Node name: ", GetName());
+    size_t inner = 1;
+    if (channels > 1) {
+        const auto axis = static_cast<size_t>(node.get_axis());
+        OPENVINO_ASSERT(axis < shape.size() && shape[axis] == channels, "Node name: ", GetName());
+        inner = std::accumulate(shape.begin() + axis + 1, shape.end(), size_t{1}, std::multiplies<size_t>());
+    }
+    kernel_ = kernel::ConvertNormalize{output_type,
+                                       input_type,
+                                       ov::shape_size(shape),
+                                       channels,
+                                       inner,
+                                       static_cast<unsigned>(context.device().props().maxThreadsPerBlock)};
+}
+
+void ConvertNormalizeOp::Execute(const InferenceRequestContext& context,
+                                 Inputs inputs,
+                                 Outputs outputs,
+                                 const Workbuffers&) const {
+    OPENVINO_ASSERT(inputs.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               outputs[0].get(),
+               inputs[0].get(),
+               inputs[1].get(),
+               inputs[2].get());
+}
+
+bool ConvertNormalizeOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(ConvertNormalizeOp, ConvertNormalize);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/convert_normalize.hpp>
+
+#include "kernels/convert.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Converts data and applies the per-channel scale and shift of preprocessing by a single kernel
+ */
+class ConvertNormalizeOp : public OperationBase {
+public:
+    using NodeOp = nodes::ConvertNormalize;
+    ConvertNormalizeOp(const CreationContext& context,
+                       const NodeOp& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::ConvertNormalize> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
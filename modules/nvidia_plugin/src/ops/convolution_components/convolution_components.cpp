@@ -3,6 +3,7 @@
 //
 
 #include <gsl/span_ext>
+#include <sstream>
 
 #include "convolution_components.hpp"
 
@@ -37,6 +38,10 @@ ConvolutionParams::ConvolutionParams(const TConvNode& node)
     }
     OPENVINO_ASSERT(groups_ >= 1U);
     filter_shape_[0] *= groups_;
+    if constexpr (std::is_same_v<TConvNode, nodes::FusedConvolution> ||
+                  std::is_same_v<TConvNode, nodes::FusedGroupConvolution>) {
+        nhwc_layout_ = node.is_nhwc_layout();
+    }
 
     InferPadding(node);
 
@@ -101,6 +106,17 @@ void ConvolutionParams::ConvertConv1DToConv2D() {
     padding_after_.insert(padding_after_.begin(), 0);
 }
 
+std::string ConvolutionParams::TuningKey() const {
+    std::ostringstream key;
+    key << "type=" << ov::element::Type{element_type_} << ";groups=" << groups_ << ";input=" << input_shape_
+        << ";filter=" << filter_shape_ << ";output=" << output_shape_ << ";strides=" << strides_
+        << ";dilations=" << dilations_ << ";pads_begin=" << padding_before_ << ";pads_end=" << padding_after_;
+    if (nhwc_layout_) {
+        key << ";nhwc";
+    }
+    return key.str();
+}
+
 template <typename TConvNode>
 ConvolutionBackwardDataParams::ConvolutionBackwardDataParams(const TConvNode& node)
     : element_type_{node.get_input_element_type(ConvBackArgIndices::doutput)},
@@ -183,6 +199,16 @@ FusedConvolutionParams::FusedConvolutionParams(const TConvNode& node)
         add_shape_->insert(add_shape_->begin() + NON_SPATIAL_DIMS_NUMBER, 1);
     }
 }
+
+std::string FusedConvolutionParams::TuningKey() const {
+    std::ostringstream key;
+    key << conv_.TuningKey() << ";bias=" << bias_shape_ << ";add=";
+    if (add_shape_) {
+        key << add_shape_.value();
+    }
+    key << ";activation=" << static_cast<int>(activation_);
+    return key.str();
+}
 template FusedConvolutionParams::FusedConvolutionParams(const nodes::FusedConvolution& node);
 template FusedConvolutionParams::FusedConvolutionParams(const nodes::FusedGroupConvolution& node);
 
@@ -6,6 +6,7 @@
 
 #include <openvino/op/convolution.hpp>
 #include <optional>
+#include <string>
 
 #include "transformer/nodes/fused_convolution.hpp"
 #include "transformer/nodes/fused_convolution_backprop_data.hpp"
@@ -45,9 +46,15 @@ struct ConvolutionParams {
     ov::CoordinateDiff padding_before_;
     ov::CoordinateDiff padding_after_;
     size_t groups_;
+    // Input, filter and output tensors are stored in NHWC order in memory (shapes are still in NCHW order)
+    bool nhwc_layout_ = false;
 
     size_t NumberOfDims() const { return input_shape_.size(); }
     size_t NumberOfSpatialDims() const { return input_shape_.size() - NON_SPATIAL_DIMS_NUMBER; }
+    /**
+     * @returns Key of convolution parameters in TuningCache
+     */
+    std::string TuningKey() const;
 
 private:
     template <typename TConvNode>
@@ -109,6 +116,11 @@ struct FusedConvolutionParams {
     ov::Shape bias_shape_;
     std::optional<ov::Shape> add_shape_;
     ov::nvidia_gpu::nodes::ActivationMode activation_;
+
+    /**
+     * @returns Key of fused convolution parameters in TuningCache
+     */
+    std::string TuningKey() const;
 };
 
 /**
@@ -7,17 +7,117 @@
 #include <cudnn.h>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <cuda_config.hpp>
+#include <sstream>
 #include <openvino/core/except.hpp>
 #include <nvidia/nvidia_config.hpp>
 #include <ops/converters.hpp>
 
 namespace ov::nvidia_gpu::Convolution::Details {
 
+namespace {
+
+/**
+ * Selects the first (i.e. the fastest) of algorithms returned by cuDNN which work space fits the limit
+ */
+template <typename TAlgoPerf>
+bool SelectAlgoFittingWorkspace(const std::vector<TAlgoPerf>& algoPerfs,
+                                int returnedAlgoCount,
+                                size_t maxWorkspaceSize,
+                                TAlgoPerf& selectedAlgoPerf) {
+    const auto end = algoPerfs.begin() + std::min<size_t>(std::max(returnedAlgoCount, 0), algoPerfs.size());
+    const auto found = std::find_if(algoPerfs.begin(), end, [maxWorkspaceSize](const auto& algoPerf) {
+        return algoPerf.status == CUDNN_STATUS_SUCCESS && algoPerf.memory <= maxWorkspaceSize;
+    });
+    if (found == end) {
+        return false;
+    }
+    selectedAlgoPerf = *found;
+    return true;
+}
+
+/**
+ * Formats algorithm selected by benchmarks for TuningCache
+ */
+template <typename TAlgoPerf>
+std::string FormatCachedAlgo(cudnnDataType_t convDescType, const TAlgoPerf& algoPerf) {
+    return fmt::format("{} {} {}",
+                       static_cast<int>(convDescType),
+                       static_cast<int>(algoPerf.algo),
+                       static_cast<int>(algoPerf.mathType));
+}
+
+/**
+ * cuDNN convolves bf16 tensors only with the convolution descriptor accumulating in float
+ */
+cudnnDataType_t ConvolutionDescType(cudnnDataType_t tensorElementType) {
+    return tensorElementType == CUDNN_DATA_BFLOAT16 ? CUDNN_DATA_FLOAT : tensorElementType;
+}
+
+/**
+ * Parses algorithm stored in TuningCache, the data type of convolution descriptor should be one of supported ones
+ */
+template <typename TAlgoPerf>
+bool ParseCachedAlgo(const std::optional<std::string>& cachedAlgo,
+                     cudnnDataType_t tensorElementType,
+                     const std::vector<cudnnDataType_t>& halfDescTypes,
+                     cudnnDataType_t& convDescType,
+                     TAlgoPerf& algoPerf) {
+    if (!cachedAlgo) {
+        return false;
+    }
+    int descType = 0;
+    int algo = 0;
+    int mathType = 0;
+    std::istringstream stream{*cachedAlgo};
+    if (!(stream >> descType >> algo >> mathType)) {
+        return false;
+    }
+    convDescType = static_cast<cudnnDataType_t>(descType);
+    const bool isSupportedDescType =
+        tensorElementType == CUDNN_DATA_HALF
+            ? std::find(halfDescTypes.begin(), halfDescTypes.end(), convDescType) != halfDescTypes.end()
+            : convDescType == ConvolutionDescType(tensorElementType);
+    if (!isSupportedDescType) {
+        return false;
+    }
+    algoPerf = {};
+    algoPerf.algo = static_cast<decltype(algoPerf.algo)>(algo);
+    algoPerf.mathType = static_cast<cudnnMathType_t>(mathType);
+    algoPerf.status = CUDNN_STATUS_SUCCESS;
+    return true;
+}
+
+/**
+ * Selects math type of convolution descriptors. Tensor Core math runs fp32 convolutions in TF32 on Ampere and newer
+ * GPUs, so FMA math is required to keep strict fp32 precision (see CreationContext::tf32)
+ */
+cudnnMathType_t ConvolutionMathType(const CreationContext& context, cudnnDataType_t elementType) {
+    return elementType == CUDNN_DATA_FLOAT && !context.tf32() ? CUDNN_FMA_MATH : CUDNN_TENSOR_OP_MATH;
+}
+
+/**
+ * Algorithms benchmarked with FMA math are cached separately from ones which may use Tensor Cores
+ */
+std::string MathTypeTuningKey(cudnnMathType_t mathType) { return mathType == CUDNN_FMA_MATH ? ";math=fma" : ""; }
+
+template <typename TArray>
+std::string FormatDims(const TArray& array, int count) {
+    std::string dims;
+    for (int i = 0; i < count; ++i) {
+        dims += (i > 0 ? "," : "") + std::to_string(array[i]);
+    }
+    return dims;
+}
+
+}  // namespace
+
 ConvolutionParamsCuDnn::ConvolutionParamsCuDnn(const Convolution::Details::ConvolutionParams& params)
     : number_of_dims_{static_cast<int>(params.NumberOfDims())},
       groups_{static_cast<int>(params.groups_)},
-      data_type_{convertDataType<cudnnDataType_t>(params.element_type_)} {
+      data_type_{convertDataType<cudnnDataType_t>(params.element_type_)},
+      format_{params.nhwc_layout_ ? CUDNN_TENSOR_NHWC : CUDNN_TENSOR_NCHW} {
     if (params.padding_before_ != params.padding_after_) {
         throw_ov_exception(
             fmt::format("Asymmetric padding is not supported: padding_before: "
@@ -46,21 +146,34 @@ ConvolutionParamsCuDnn::ConvolutionParamsCuDnn(const Convolution::Details::Convo
 }
 
 CUDA::DnnTensorDescriptor ConvolutionParamsCuDnn::MakeInputDescriptor() const {
-    return CUDA::DnnTensorDescriptor{}.set(
-        cudnnTensorFormat_t::CUDNN_TENSOR_NCHW, data_type_, number_of_dims_, input_shape_.data());
+    return CUDA::DnnTensorDescriptor{}.set(format_, data_type_, number_of_dims_, input_shape_.data());
 }
 
 CUDA::DnnFilterDescriptor ConvolutionParamsCuDnn::MakeFilterDescriptor() const {
-    return CUDA::DnnFilterDescriptor{}.set(
-        data_type_, cudnnTensorFormat_t::CUDNN_TENSOR_NCHW, number_of_dims_, filter_shape_.data());
+    return CUDA::DnnFilterDescriptor{}.set(data_type_, format_, number_of_dims_, filter_shape_.data());
 }
 
 CUDA::DnnTensorDescriptor ConvolutionParamsCuDnn::MakeOutputDescriptor() const {
-    return CUDA::DnnTensorDescriptor{}.set(
-        cudnnTensorFormat_t::CUDNN_TENSOR_NCHW, data_type_, number_of_dims_, output_shape_.data());
+    return CUDA::DnnTensorDescriptor{}.set(format_, data_type_, number_of_dims_, output_shape_.data());
+}
+
+std::string ConvolutionParamsCuDnn::TuningKey() const {
+    const auto spatialDims = NumberOfSpatialDims();
+    return fmt::format(
+        "type={};format={};groups={};input={};filter={};output={};strides={};dilations={};paddings={}",
+                       static_cast<int>(data_type_),
+                       static_cast<int>(format_),
+                       groups_,
+                       FormatDims(input_shape_, number_of_dims_),
+                       FormatDims(filter_shape_, number_of_dims_),
+                       FormatDims(output_shape_, number_of_dims_),
+                       FormatDims(strides_, spatialDims),
+                       FormatDims(dilations_, spatialDims),
+                       FormatDims(paddings_, spatialDims));
 }
 
-CUDA::DnnConvolutionDescriptor ConvolutionParamsCuDnn::MakeConvolutionDescriptor(cudnnDataType_t convDataType) const {
+CUDA::DnnConvolutionDescriptor ConvolutionParamsCuDnn::MakeConvolutionDescriptor(cudnnDataType_t convDataType,
+                                                                                 cudnnMathType_t mathType) const {
     // According to `ov::op::v1::Convolution` spec, it "computes 1D, 2D or 3D convolution
     // (cross-correlation to be precise)".
     constexpr cudnnConvolutionMode_t mode = CUDNN_CROSS_CORRELATION;
@@ -72,10 +185,9 @@ CUDA::DnnConvolutionDescriptor ConvolutionParamsCuDnn::MakeConvolutionDescriptor
     CUDA::DnnConvolutionDescriptor conv_desc;
     conv_desc.set(NumberOfSpatialDims(), paddings_.data(), strides_.data(), dilations_.data(), mode, datatype);
 
-    // Enable computations on Tensor Core hardware which requires at least Volta GPU
-    // (compute capability 7.0).
-    const cudnnMathType_t math_type = CUDNN_TENSOR_OP_MATH;
-    throwIfError(::cudnnSetConvolutionMathType(conv_desc.get(), math_type));
+    // Tensor Core math (the default) enables computations on Tensor Core hardware which requires
+    // at least Volta GPU (compute capability 7.0).
+    throwIfError(::cudnnSetConvolutionMathType(conv_desc.get(), mathType));
     throwIfError(::cudnnSetConvolutionGroupCount(conv_desc.get(), groups_));
 
     return conv_desc;
@@ -86,21 +198,57 @@ ConvolutionDescriptorsCuDnn::ConvolutionDescriptorsCuDnn(const CreationContext&
                                                          const std::vector<cudnnDataType_t> half_desc_types)
     : params_{params},
       tensor_element_type_{params_.ElementType()},
-      conv_desc_type_{params_.ElementType()},
+      conv_desc_type_{ConvolutionDescType(params_.ElementType())},
       input_{params_.MakeInputDescriptor()},
       filter_{params_.MakeFilterDescriptor()},
       output_{params_.MakeOutputDescriptor()},
       conv_{},
       algo_perf_{},
-      half_desc_types_{half_desc_types} {
+      half_desc_types_{half_desc_types},
+      max_workspace_size_{context.maxWorkspaceSize()},
+      math_type_{ConvolutionMathType(context, params_.ElementType())} {
     auto& dnnHandle = context.dnnHandle();
+    const auto& tuningCache = context.tuningCache();
+    const auto tuningKey =
+        tuningCache ? "cudnn_conv_fwd:" + params_.TuningKey() + MathTypeTuningKey(math_type_) : std::string{};
+    if (tuningCache && SetCachedAlgo(dnnHandle, tuningCache->find(tuningKey))) {
+        return;
+    }
     if (context.opBenchOption()) {
+        const auto lock = context.lockBenchmarks();
         BenchmarkOptimalAlgo(dnnHandle, params_);
+        if (tuningCache) {
+            tuningCache->store(tuningKey, FormatCachedAlgo(conv_desc_type_, algo_perf_));
+        }
     } else {
         GetAlgo(dnnHandle);
     }
 }
 
+bool ConvolutionDescriptorsCuDnn::SetCachedAlgo(const CUDA::DnnHandle& dnnHandle,
+                                                const std::optional<std::string>& cachedAlgo) {
+    cudnnDataType_t convDescType{};
+    cudnnConvolutionFwdAlgoPerf_t algoPerf{};
+    if (!ParseCachedAlgo(cachedAlgo, tensor_element_type_, half_desc_types_, convDescType, algoPerf)) {
+        return false;
+    }
+    auto conv = params_.MakeConvolutionDescriptor(convDescType, math_type_);
+    throwIfError(::cudnnSetConvolutionMathType(conv.get(), algoPerf.mathType));
+    size_t sizeInBytes = 0;
+    // The cached algorithm is benchmarked again if it isn't supported anymore or its work space exceeds the limit
+    if (::cudnnGetConvolutionForwardWorkspaceSize(
+            dnnHandle.get(), input_.get(), filter_.get(), conv.get(), output_.get(), algoPerf.algo, &sizeInBytes) !=
+            CUDNN_STATUS_SUCCESS ||
+        sizeInBytes > max_workspace_size_) {
+        return false;
+    }
+    algoPerf.memory = sizeInBytes;
+    conv_ = std::move(conv);
+    conv_desc_type_ = convDescType;
+    algo_perf_ = algoPerf;
+    return true;
+}
+
 void ConvolutionDescriptorsCuDnn::BenchmarkOptimalAlgo(const CUDA::DnnHandle& dnnHandle,
                                                        const ConvolutionParamsCuDnn& params) {
     constexpr auto kNumSelectAlgo = 3;
@@ -134,7 +282,7 @@ void ConvolutionDescriptorsCuDnn::GetAlgo(const CUDA::DnnHandle& dnnHandle) {
             }
             break;
         default:
-            if (GetAlgoForConvDataType(dnnHandle, tensor_element_type_)) return;
+            if (GetAlgoForConvDataType(dnnHandle, conv_desc_type_)) return;
     }
 
     throw_ov_exception("cuDNN: Unsupported convolution");
@@ -143,8 +291,10 @@ void ConvolutionDescriptorsCuDnn::GetAlgo(const CUDA::DnnHandle& dnnHandle) {
 bool ConvolutionDescriptorsCuDnn::GetAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle,
                                                          cudnnDataType_t convDataType) {
     cudnnStatus_t status = CUDNN_STATUS_NOT_SUPPORTED;
-    conv_ = params_.MakeConvolutionDescriptor(convDataType);
-    const int requestedAlgoCount = 1;
+    conv_ = params_.MakeConvolutionDescriptor(convDataType, math_type_);
+    int requestedAlgoCount = 0;
+    throwIfError(::cudnnGetConvolutionForwardAlgorithmMaxCount(dnnHandle.get(), &requestedAlgoCount));
+    std::vector<cudnnConvolutionFwdAlgoPerf_t> algoPerfs(requestedAlgoCount);
     int returnedAlgoCount = 0;
     status = ::cudnnGetConvolutionForwardAlgorithm_v7(dnnHandle.get(),
                                                       input_.get(),
@@ -153,9 +303,10 @@ bool ConvolutionDescriptorsCuDnn::GetAlgoForConvDataType(const CUDA::DnnHandle&
                                                       output_.get(),
                                                       requestedAlgoCount,
                                                       &returnedAlgoCount,
-                                                      &algo_perf_);
+                                                      algoPerfs.data());
 
-    if ((status != CUDNN_STATUS_SUCCESS) || (algo_perf_.status != CUDNN_STATUS_SUCCESS) || (returnedAlgoCount <= 0)) {
+    if ((status != CUDNN_STATUS_SUCCESS) ||
+        !SelectAlgoFittingWorkspace(algoPerfs, returnedAlgoCount, max_workspace_size_, algo_perf_)) {
         return false;
     }
 
@@ -180,7 +331,7 @@ void ConvolutionDescriptorsCuDnn::FindAlgo(const CUDA::DnnHandle& dnnHandle) {
             }
             break;
         default:
-            if (FindAlgoForConvDataType(dnnHandle, tensor_element_type_)) return;
+            if (FindAlgoForConvDataType(dnnHandle, conv_desc_type_)) return;
     }
 
     throw_ov_exception("cuDNN: Unsupported convolution");
@@ -189,8 +340,10 @@ void ConvolutionDescriptorsCuDnn::FindAlgo(const CUDA::DnnHandle& dnnHandle) {
 bool ConvolutionDescriptorsCuDnn::FindAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle,
                                                           cudnnDataType_t convDataType) {
     cudnnStatus_t status = CUDNN_STATUS_NOT_SUPPORTED;
-    conv_ = params_.MakeConvolutionDescriptor(convDataType);
-    const int requestedAlgoCount = 1;
+    conv_ = params_.MakeConvolutionDescriptor(convDataType, math_type_);
+    int requestedAlgoCount = 0;
+    throwIfError(::cudnnGetConvolutionForwardAlgorithmMaxCount(dnnHandle.get(), &requestedAlgoCount));
+    std::vector<cudnnConvolutionFwdAlgoPerf_t> algoPerfs(requestedAlgoCount);
     int returnedAlgoCount = 0;
     status = ::cudnnFindConvolutionForwardAlgorithm(dnnHandle.get(),
                                                     input_.get(),
@@ -199,9 +352,10 @@ bool ConvolutionDescriptorsCuDnn::FindAlgoForConvDataType(const CUDA::DnnHandle&
                                                     output_.get(),
                                                     requestedAlgoCount,
                                                     &returnedAlgoCount,
-                                                    &algo_perf_);
+                                                    algoPerfs.data());
 
-    if ((status != CUDNN_STATUS_SUCCESS) || (algo_perf_.status != CUDNN_STATUS_SUCCESS) || (returnedAlgoCount <= 0)) {
+    if ((status != CUDNN_STATUS_SUCCESS) ||
+        !SelectAlgoFittingWorkspace(algoPerfs, returnedAlgoCount, max_workspace_size_, algo_perf_)) {
         return false;
     }
 
@@ -230,7 +384,7 @@ void ConvolutionDescriptorsCuDnn::FindAlgo(const CUDA::DnnHandle& dnnHandle,
             }
             break;
         default:
-            if (FindAlgoForConvDataType(dnnHandle, inPtr, filterPtr, outPtr, workspace, tensor_element_type_)) return;
+            if (FindAlgoForConvDataType(dnnHandle, inPtr, filterPtr, outPtr, workspace, conv_desc_type_)) return;
     }
 
     throw_ov_exception("cuDNN: Unsupported convolution");
@@ -243,7 +397,7 @@ bool ConvolutionDescriptorsCuDnn::FindAlgoForConvDataType(const CUDA::DnnHandle&
                                                           CUDA::DeviceBuffer<std::byte> workspace,
                                                           cudnnDataType_t convDataType) {
     cudnnStatus_t status = CUDNN_STATUS_NOT_SUPPORTED;
-    conv_ = params_.MakeConvolutionDescriptor(convDataType);
+    conv_ = params_.MakeConvolutionDescriptor(convDataType, math_type_);
     const int requestedAlgoCount = 1;
     int returnedAlgoCount = 0;
     status = ::cudnnFindConvolutionForwardAlgorithmEx(dnnHandle.get(),
@@ -309,8 +463,21 @@ CUDA::DnnTensorDescriptor ConvolutionBackpropDataParamsCuDnn::MakeDInputDescript
         cudnnTensorFormat_t::CUDNN_TENSOR_NCHW, data_type_, number_of_dims_, dinput_shape_.data());
 }
 
+std::string ConvolutionBackpropDataParamsCuDnn::TuningKey() const {
+    const auto spatialDims = NumberOfSpatialDims();
+    return fmt::format("type={};groups={};doutput={};filter={};dinput={};strides={};dilations={};paddings={}",
+                       static_cast<int>(data_type_),
+                       groups_,
+                       FormatDims(doutput_shape_, number_of_dims_),
+                       FormatDims(filter_shape_, number_of_dims_),
+                       FormatDims(dinput_shape_, number_of_dims_),
+                       FormatDims(strides_, spatialDims),
+                       FormatDims(dilations_, spatialDims),
+                       FormatDims(paddings_, spatialDims));
+}
+
 CUDA::DnnConvolutionDescriptor ConvolutionBackpropDataParamsCuDnn::MakeConvolutionDescriptor(
-    cudnnDataType_t convDataType) const {
+    cudnnDataType_t convDataType, cudnnMathType_t mathType) const {
     // According to `ov::op::v1::Convolution` spec, it "computes 1D, 2D or 3D convolution
     // (cross-correlation to be precise)".
     constexpr cudnnConvolutionMode_t mode = CUDNN_CROSS_CORRELATION;
@@ -322,10 +489,9 @@ CUDA::DnnConvolutionDescriptor ConvolutionBackpropDataParamsCuDnn::MakeConvoluti
     CUDA::DnnConvolutionDescriptor conv_desc;
     conv_desc.set(NumberOfSpatialDims(), paddings_.data(), strides_.data(), dilations_.data(), mode, datatype);
 
-    // Enable computations on Tensor Core hardware which requires at least Volta GPU
-    // (compute capability 7.0).
-    const cudnnMathType_t math_type = CUDNN_TENSOR_OP_MATH;
-    throwIfError(::cudnnSetConvolutionMathType(conv_desc.get(), math_type));
+    // Tensor Core math (the default) enables computations on Tensor Core hardware which requires
+    // at least Volta GPU (compute capability 7.0).
+    throwIfError(::cudnnSetConvolutionMathType(conv_desc.get(), mathType));
     throwIfError(::cudnnSetConvolutionGroupCount(conv_desc.get(), groups_));
 
     return conv_desc;
@@ -337,21 +503,61 @@ ConvolutionBackpropDataDescriptorCuDnn::ConvolutionBackpropDataDescriptorCuDnn(
     const std::vector<cudnnDataType_t> half_desc_types)
     : params_{params},
       tensor_element_type_{params_.ElementType()},
-      conv_desc_type_{params_.ElementType()},
+      conv_desc_type_{ConvolutionDescType(params_.ElementType())},
       filter_desc_{params_.MakeFilterDescriptor()},
       doutput_desc_{params_.MakeDOutputDescriptor()},
       dinput_desc_{params_.MakeDInputDescriptor()},
       conv_{},
       algo_perf_{},
-      half_desc_types_{half_desc_types} {
+      half_desc_types_{half_desc_types},
+      max_workspace_size_{context.maxWorkspaceSize()},
+      math_type_{ConvolutionMathType(context, params_.ElementType())} {
     auto& dnnHandle = context.dnnHandle();
+    const auto& tuningCache = context.tuningCache();
+    const auto tuningKey =
+        tuningCache ? "cudnn_conv_bwd_data:" + params_.TuningKey() + MathTypeTuningKey(math_type_) : std::string{};
+    if (tuningCache && SetCachedAlgo(dnnHandle, tuningCache->find(tuningKey))) {
+        return;
+    }
     if (context.opBenchOption()) {
+        const auto lock = context.lockBenchmarks();
         BenchmarkOptimalAlgo(dnnHandle);
+        if (tuningCache) {
+            tuningCache->store(tuningKey, FormatCachedAlgo(conv_desc_type_, algo_perf_));
+        }
     } else {
         GetAlgo(dnnHandle);
     }
 }
 
+bool ConvolutionBackpropDataDescriptorCuDnn::SetCachedAlgo(const CUDA::DnnHandle& dnnHandle,
+                                                           const std::optional<std::string>& cachedAlgo) {
+    cudnnDataType_t convDescType{};
+    cudnnConvolutionBwdDataAlgoPerf_t algoPerf{};
+    if (!ParseCachedAlgo(cachedAlgo, tensor_element_type_, half_desc_types_, convDescType, algoPerf)) {
+        return false;
+    }
+    auto conv = params_.MakeConvolutionDescriptor(convDescType, math_type_);
+    throwIfError(::cudnnSetConvolutionMathType(conv.get(), algoPerf.mathType));
+    size_t sizeInBytes = 0;
+    // The cached algorithm is benchmarked again if it isn't supported anymore or its work space exceeds the limit
+    if (::cudnnGetConvolutionBackwardDataWorkspaceSize(dnnHandle.get(),
+                                                       filter_desc_.get(),
+                                                       doutput_desc_.get(),
+                                                       conv.get(),
+                                                       dinput_desc_.get(),
+                                                       algoPerf.algo,
+                                                       &sizeInBytes) != CUDNN_STATUS_SUCCESS ||
+        sizeInBytes > max_workspace_size_) {
+        return false;
+    }
+    algoPerf.memory = sizeInBytes;
+    conv_ = std::move(conv);
+    conv_desc_type_ = convDescType;
+    algo_perf_ = algoPerf;
+    return true;
+}
+
 void ConvolutionBackpropDataDescriptorCuDnn::BenchmarkOptimalAlgo(const CUDA::DnnHandle& dnnHandle) {
     constexpr auto kNumSelectAlgo = 3;
     int convBackwardDataAlgorithmMaxCount;
@@ -384,7 +590,7 @@ void ConvolutionBackpropDataDescriptorCuDnn::GetAlgo(const CUDA::DnnHandle& dnnH
             }
             break;
         default:
-            if (GetAlgoForConvDataType(dnnHandle, tensor_element_type_)) return;
+            if (GetAlgoForConvDataType(dnnHandle, conv_desc_type_)) return;
     }
 
     throw_ov_exception("cuDNN: Unsupported convolution");
@@ -393,8 +599,10 @@ void ConvolutionBackpropDataDescriptorCuDnn::GetAlgo(const CUDA::DnnHandle& dnnH
 bool ConvolutionBackpropDataDescriptorCuDnn::GetAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle,
                                                                     cudnnDataType_t convDataType) {
     cudnnStatus_t status = CUDNN_STATUS_NOT_SUPPORTED;
-    conv_ = params_.MakeConvolutionDescriptor(convDataType);
-    const int requestedAlgoCount = 1;
+    conv_ = params_.MakeConvolutionDescriptor(convDataType, math_type_);
+    int requestedAlgoCount = 0;
+    throwIfError(::cudnnGetConvolutionBackwardDataAlgorithmMaxCount(dnnHandle.get(), &requestedAlgoCount));
+    std::vector<cudnnConvolutionBwdDataAlgoPerf_t> algoPerfs(requestedAlgoCount);
     int returnedAlgoCount = 0;
     status = ::cudnnGetConvolutionBackwardDataAlgorithm_v7(dnnHandle.get(),
                                                            filter_desc_.get(),
@@ -403,9 +611,10 @@ bool ConvolutionBackpropDataDescriptorCuDnn::GetAlgoForConvDataType(const CUDA::
                                                            dinput_desc_.get(),
                                                            requestedAlgoCount,
                                                            &returnedAlgoCount,
-                                                           &algo_perf_);
+                                                           algoPerfs.data());
 
-    if ((status != CUDNN_STATUS_SUCCESS) || (algo_perf_.status != CUDNN_STATUS_SUCCESS) || (returnedAlgoCount <= 0)) {
+    if ((status != CUDNN_STATUS_SUCCESS) ||
+        !SelectAlgoFittingWorkspace(algoPerfs, returnedAlgoCount, max_workspace_size_, algo_perf_)) {
         return false;
     }
 
@@ -435,7 +644,7 @@ void ConvolutionBackpropDataDescriptorCuDnn::FindAlgo(const CUDA::DnnHandle& dnn
             }
             break;
         default:
-            if (FindAlgoForConvDataType(dnnHandle, tensor_element_type_)) return;
+            if (FindAlgoForConvDataType(dnnHandle, conv_desc_type_)) return;
     }
 
     throw_ov_exception("cuDNN: Unsupported convolution");
@@ -444,8 +653,10 @@ void ConvolutionBackpropDataDescriptorCuDnn::FindAlgo(const CUDA::DnnHandle& dnn
 bool ConvolutionBackpropDataDescriptorCuDnn::FindAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle,
                                                                      cudnnDataType_t convDataType) {
     cudnnStatus_t status = CUDNN_STATUS_NOT_SUPPORTED;
-    conv_ = params_.MakeConvolutionDescriptor(convDataType);
-    const int requestedAlgoCount = 1;
+    conv_ = params_.MakeConvolutionDescriptor(convDataType, math_type_);
+    int requestedAlgoCount = 0;
+    throwIfError(::cudnnGetConvolutionBackwardDataAlgorithmMaxCount(dnnHandle.get(), &requestedAlgoCount));
+    std::vector<cudnnConvolutionBwdDataAlgoPerf_t> algoPerfs(requestedAlgoCount);
     int returnedAlgoCount = 0;
     status = ::cudnnFindConvolutionBackwardDataAlgorithm(dnnHandle.get(),
                                                          filter_desc_.get(),
@@ -454,9 +665,10 @@ bool ConvolutionBackpropDataDescriptorCuDnn::FindAlgoForConvDataType(const CUDA:
                                                          dinput_desc_.get(),
                                                          requestedAlgoCount,
                                                          &returnedAlgoCount,
-                                                         &algo_perf_);
+                                                         algoPerfs.data());
 
-    if ((status != CUDNN_STATUS_SUCCESS) || (algo_perf_.status != CUDNN_STATUS_SUCCESS) || (returnedAlgoCount <= 0)) {
+    if ((status != CUDNN_STATUS_SUCCESS) ||
+        !SelectAlgoFittingWorkspace(algoPerfs, returnedAlgoCount, max_workspace_size_, algo_perf_)) {
         return false;
     }
 
@@ -486,7 +698,7 @@ void ConvolutionBackpropDataDescriptorCuDnn::FindAlgo(const CUDA::DnnHandle& dnn
             if (FindAlgoForConvDataType(dnnHandle, filterPtr, dInPtr, dOutPtr, workspace, CUDNN_DATA_FLOAT)) return;
             break;
         default:
-            if (FindAlgoForConvDataType(dnnHandle, filterPtr, dInPtr, dOutPtr, workspace, tensor_element_type_)) return;
+            if (FindAlgoForConvDataType(dnnHandle, filterPtr, dInPtr, dOutPtr, workspace, conv_desc_type_)) return;
     }
 
     throw_ov_exception("cuDNN: Unsupported convolution");
@@ -499,7 +711,7 @@ bool ConvolutionBackpropDataDescriptorCuDnn::FindAlgoForConvDataType(const CUDA:
                                                                      CUDA::DeviceBuffer<std::byte> workspace,
                                                                      cudnnDataType_t convDataType) {
     cudnnStatus_t status = CUDNN_STATUS_NOT_SUPPORTED;
-    conv_ = params_.MakeConvolutionDescriptor(convDataType);
+    conv_ = params_.MakeConvolutionDescriptor(convDataType, math_type_);
     const int requestedAlgoCount = 1;
     int returnedAlgoCount = 0;
     status = ::cudnnFindConvolutionBackwardDataAlgorithmEx(dnnHandle.get(),
@@ -519,11 +731,12 @@ bool ConvolutionBackpropDataDescriptorCuDnn::FindAlgoForConvDataType(const CUDA:
 }
 
 std::shared_ptr<CUDA::DnnTensorDescriptor> MakeFusedAddDescriptor(const ov::Shape& shape,
-                                                                  ov::element::Type_t element_type) {
+                                                                  ov::element::Type_t element_type,
+                                                                  cudnnTensorFormat_t format) {
     std::array<int, CUDNN_DIM_MAX> int_shape;
     std::copy(shape.begin(), shape.end(), int_shape.begin());
     auto desc = std::make_shared<CUDA::DnnTensorDescriptor>();
-    desc->set(cudnnTensorFormat_t::CUDNN_TENSOR_NCHW,
+    desc->set(format,
               convertDataType<cudnnDataType_t>(element_type),
               static_cast<int>(shape.size()),
               int_shape.data());
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <cuda_creation_context.hpp>
+#include <optional>
+#include <string>
 
 #include "convolution_components.hpp"
 #include "cuda/dnn.hpp"
@@ -20,16 +22,23 @@ public:
 
     int NumberOfSpatialDims() const { return number_of_dims_ - NON_SPATIAL_DIMS_NUMBER; }
     cudnnDataType_t ElementType() const { return data_type_; }
+    cudnnTensorFormat_t Format() const { return format_; }
 
     CUDA::DnnTensorDescriptor MakeInputDescriptor() const;
     CUDA::DnnFilterDescriptor MakeFilterDescriptor() const;
     CUDA::DnnTensorDescriptor MakeOutputDescriptor() const;
-    CUDA::DnnConvolutionDescriptor MakeConvolutionDescriptor(cudnnDataType_t convDataType) const;
+    CUDA::DnnConvolutionDescriptor MakeConvolutionDescriptor(cudnnDataType_t convDataType,
+                                                             cudnnMathType_t mathType = CUDNN_TENSOR_OP_MATH) const;
+    /**
+     * @returns Key of convolution parameters in TuningCache
+     */
+    std::string TuningKey() const;
 
 private:
     const int number_of_dims_;
     const int groups_;
     const cudnnDataType_t data_type_;
+    const cudnnTensorFormat_t format_;
     using IntArray = std::array<int, CUDNN_DIM_MAX>;
     IntArray input_shape_;
     IntArray filter_shape_;
@@ -52,7 +61,12 @@ public:
     CUDA::DnnTensorDescriptor MakeDOutputDescriptor() const;
     CUDA::DnnFilterDescriptor MakeFilterDescriptor() const;
     CUDA::DnnTensorDescriptor MakeDInputDescriptor() const;
-    CUDA::DnnConvolutionDescriptor MakeConvolutionDescriptor(cudnnDataType_t convDataType) const;
+    CUDA::DnnConvolutionDescriptor MakeConvolutionDescriptor(cudnnDataType_t convDataType,
+                                                             cudnnMathType_t mathType = CUDNN_TENSOR_OP_MATH) const;
+    /**
+     * @returns Key of convolution parameters in TuningCache
+     */
+    std::string TuningKey() const;
 
 private:
     const int number_of_dims_;
@@ -79,6 +93,7 @@ public:
 
     cudnnDataType_t ElementType() const { return tensor_element_type_; }
     cudnnDataType_t DescType() const { return conv_desc_type_; }
+    cudnnTensorFormat_t Format() const { return params_.Format(); }
     const CUDA::DnnTensorDescriptor& Input() const { return input_; }
     const CUDA::DnnFilterDescriptor& Filter() const { return filter_; }
     const CUDA::DnnTensorDescriptor& Output() const { return output_; }
@@ -102,6 +117,7 @@ private:
     bool GetAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle, cudnnDataType_t convDataType);
     void FindAlgo(const CUDA::DnnHandle& dnnHandle);
     bool FindAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle, cudnnDataType_t convDataType);
+    bool SetCachedAlgo(const CUDA::DnnHandle& dnnHandle, const std::optional<std::string>& cachedAlgo);
 
 private:
     ConvolutionParamsCuDnn params_;
@@ -113,6 +129,8 @@ private:
     CUDA::DnnConvolutionDescriptor conv_;
     cudnnConvolutionFwdAlgoPerf_t algo_perf_;
     std::vector<cudnnDataType_t> half_desc_types_;
+    size_t max_workspace_size_;
+    cudnnMathType_t math_type_;
 };
 
 /**
@@ -150,6 +168,7 @@ private:
     bool GetAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle, cudnnDataType_t convDataType);
     void FindAlgo(const CUDA::DnnHandle& dnnHandle);
     bool FindAlgoForConvDataType(const CUDA::DnnHandle& dnnHandle, cudnnDataType_t convDataType);
+    bool SetCachedAlgo(const CUDA::DnnHandle& dnnHandle, const std::optional<std::string>& cachedAlgo);
 
 private:
     ConvolutionBackpropDataParamsCuDnn params_;
@@ -161,10 +180,14 @@ private:
     CUDA::DnnConvolutionDescriptor conv_;
     cudnnConvolutionBwdDataAlgoPerf_t algo_perf_;
     std::vector<cudnnDataType_t> half_desc_types_;
+    size_t max_workspace_size_;
+    cudnnMathType_t math_type_;
 };
 
-std::shared_ptr<CUDA::DnnTensorDescriptor> MakeFusedAddDescriptor(const ov::Shape& shape,
-                                                                  ov::element::Type_t element_type);
+std::shared_ptr<CUDA::DnnTensorDescriptor> MakeFusedAddDescriptor(
+    const ov::Shape& shape,
+    ov::element::Type_t element_type,
+    cudnnTensorFormat_t format = cudnnTensorFormat_t::CUDNN_TENSOR_NCHW);
 std::shared_ptr<CUDA::DnnActivationDescriptor> MakeFusedActivationDescriptor(nodes::ActivationMode mode);
 
 }  // namespace ov::nvidia_gpu::Convolution::Details
@@ -76,14 +76,33 @@ ConvolutionCuDnnBE::ConvolutionCuDnnBE(const CreationContext& context,
     graphBuilder.setOperations(ops);
     auto graph = graphBuilder.build();
 
-    auto plans = CUDA::getAllExecutionPlansFromHeuristics(graph, *dnnHandle);
+    auto plans = CUDA::filterPlansByWorkspaceSize(CUDA::getAllExecutionPlansFromHeuristics(graph, *dnnHandle),
+                                                  context.maxWorkspaceSize());
     if (plans.empty()) {
         throw_ov_exception("cuDNN BE API: Unsupported convolution");
     }
 
-    std::shared_ptr<CUDA::DnnBEExecutionPlan> plan;
-    if (context.opBenchOption()) {
-        plan = performBenchmarks(context.dnnHandle(), plans);
+    const auto& tuningCache = context.tuningCache();
+    const auto tuningKey = tuningCache ? "cudnn_be_conv:" + params_.TuningKey() : std::string{};
+    const auto cachedPlan = tuningCache ? tuningCache->find(tuningKey) : std::nullopt;
+    std::shared_ptr<CUDA::DnnBEExecutionPlan> plan = CUDA::findCachedPlan(plans, cachedPlan);
+    if (!plan) {
+        plan = CUDA::findTunedPlan(graph, *dnnHandle, cachedPlan);
+    }
+    if (plan) {
+        // The plan has been benchmarked by one of previous compilations
+    } else if (context.opBenchOption()) {
+        // Plans of heuristics compete with plans of all engines with other values of their knobs
+        const auto tunedPlans = CUDA::getTunedExecutionPlans(graph, *dnnHandle, context.maxWorkspaceSize());
+        auto candidates = plans;
+        for (const auto& tunedPlan : tunedPlans) {
+            candidates.push_back(tunedPlan.plan);
+        }
+        const auto lock = context.lockBenchmarks();
+        plan = performBenchmarks(context.dnnHandle(), candidates);
+        if (tuningCache) {
+            tuningCache->store(tuningKey, CUDA::formatCachedPlan(plans, tunedPlans, plan));
+        }
     } else {
         plan = std::move(plans[0]);
     }
@@ -129,7 +148,7 @@ void ConvolutionCuDnnBE::Execute(const InferenceRequestContext& context,
     OPENVINO_ASSERT(inputs.size() == 2, "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
 
-    auto dnnHandle = context.getThreadContext().dnnHandle();
+    const auto& dnnHandle = context.getThreadContext().dnnHandle();
     auto workbuffer = workbuffers.mutable_buffers.empty() ? nullptr : workbuffers.mutable_buffers[0].get();
     std::array<const void*, 3> dataPtrs = {inputs[Convolution::Details::FusedConvolutionIndices::input].get(),
                                            inputs[Convolution::Details::FusedConvolutionIndices::filter].get(),
@@ -140,15 +159,11 @@ void ConvolutionCuDnnBE::Execute(const InferenceRequestContext& context,
     variantPackBuilder.setWorkspase(workbuffer);
     const auto variantPack = variantPackBuilder.build();
 
-    const auto plan = CUDA::DnnBEExecutionPlanBuilder()
-                          .setDnnHandle(context.getThreadContext().dnnHandle())
-                          .setEngineConfig(engine_config_)
-                          .build();
-
-    throwIfError(::cudnnBackendExecute(context.getThreadContext().dnnHandle().get(), plan->get(), variantPack->get()));
+    const auto& plan = plans_.get(dnnHandle, engine_config_);
+    throwIfError(::cudnnBackendExecute(dnnHandle.get(), plan.get(), variantPack->get()));
 }
 
-bool ConvolutionCuDnnBE::IsCudaGraphCompatible() const { return false; }
+bool ConvolutionCuDnnBE::IsCudaGraphCompatible() const { return true; }
 
 std::shared_ptr<CUDA::DnnBETensorDescriptor> ConvolutionCuDnnBE::MakeTensorDescriptor(int64_t id,
                                                                                       cudnnDataType_t element_type,
@@ -9,6 +9,7 @@
 
 #include "convolution_components/convolution_components.hpp"
 #include "cuda/dnn_be.hpp"
+#include "cuda/dnn_be_algo.hpp"
 #include "cuda_operation_base.hpp"
 
 namespace ov {
@@ -49,6 +50,7 @@ private:
     const Convolution::Details::ConvolutionParams params_;
     std::shared_ptr<CUDA::DnnBEEngineConfigDescriptor> engine_config_;
     int64_t workspace_size_ = 0;
+    CUDA::DnnBEExecutionPlanCache plans_;
 };
 
 }  // namespace nvidia_gpu
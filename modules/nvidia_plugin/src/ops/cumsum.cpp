@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cumsum.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <functional>
+#include <numeric>
+#include <openvino/op/constant.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+CumSumOp::CumSumOp(const CreationContext& context,
+                   const NodeOp& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    const auto& shape = node.get_input_shape(0);
+    int64_t axis = 0;
+    if (node.get_input_size() > 1) {
+        const auto axisConstant = ov::as_type_ptr<ov::op::v0::Constant>(node.get_input_node_shared_ptr(1));
+        OPENVINO_ASSERT(axisConstant, "Node name: ", GetName(), ", axis should be constant");
+        axis = axisConstant->cast_vector<int64_t>()[0];
+    }
+    const auto rank = static_cast<int64_t>(shape.size());
+    OPENVINO_ASSERT(axis >= -rank && axis < rank, "Node name: ", GetName());
+    const auto axisIndex = static_cast<size_t>(axis < 0 ? axis + rank : axis);
+
+    const kernel::CumSum::Params params{
+        convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+        std::accumulate(shape.begin(), shape.begin() + axisIndex, size_t{1}, std::multiplies<size_t>()),
+        shape[axisIndex],
+        std::accumulate(shape.begin() + axisIndex + 1, shape.end(), size_t{1}, std::multiplies<size_t>()),
+        node.is_exclusive(),
+        node.is_reverse()};
+    const auto& props = context.device().props();
+    kernel_.emplace(params,
+                    static_cast<size_t>(props.multiProcessorCount),
+                    static_cast<size_t>(props.maxThreadsPerBlock));
+}
+
+void CumSumOp::Execute(const InferenceRequestContext& context,
+                       Inputs inputTensors,
+                       Outputs outputTensors,
+                       const Workbuffers& workbuffers) const {
+    const bool hasWorkspace = kernel_.value().workspaceSize() > 0;
+    OPENVINO_ASSERT(!hasWorkspace || workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputTensors[0].get(),
+               outputTensors[0].get(),
+               hasWorkspace ? workbuffers.mutable_buffers[0].get() : nullptr);
+}
+
+bool CumSumOp::IsCudaGraphCompatible() const { return true; }
+
+WorkbufferRequest CumSumOp::GetWorkBufferRequest() const {
+    const auto workspaceSize = kernel_.value().workspaceSize();
+    return workspaceSize > 0 ? WorkbufferRequest{{}, {workspaceSize}} : WorkbufferRequest{};
+}
+
+OPERATION_REGISTER(CumSumOp, CumSum);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/cumsum.hpp>
+#include <openvino/op/cum_sum.hpp>
+#include <optional>
+
+namespace ov {
+namespace nvidia_gpu {
+
+class CumSumOp : public OperationBase {
+public:
+    using NodeOp = ov::op::v0::CumSum;
+    CumSumOp(const CreationContext& context,
+             const NodeOp& node,
+             IndexCollection&& inputIds,
+             IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::CumSum> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
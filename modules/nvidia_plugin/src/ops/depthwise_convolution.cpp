@@ -0,0 +1,139 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "depthwise_convolution.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+#include <error.hpp>
+#include <openvino/core/except.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+kernel::DepthwiseConvolution::Activation convertActivation(const nodes::ActivationMode mode) {
+    using Activation = kernel::DepthwiseConvolution::Activation;
+    switch (mode) {
+        case nodes::ActivationMode::NO_ACTIVATION:
+            return Activation::None;
+        case nodes::ActivationMode::RELU:
+            return Activation::Relu;
+        case nodes::ActivationMode::SIGMOID:
+            return Activation::Sigmoid;
+        case nodes::ActivationMode::TANH:
+            return Activation::Tanh;
+        case nodes::ActivationMode::SWISH:
+            return Activation::Swish;
+        default:
+            throw_ov_exception(
+                fmt::format("Activation mode {} is not supported by DepthwiseConvolution", static_cast<int>(mode)));
+    }
+}
+
+}  // namespace
+
+DepthwiseConvolutionOp::DepthwiseConvolutionOp(const CreationContext& context,
+                                               const ov::Node& node,
+                                               IndexCollection&& inputIds,
+                                               IndexCollection&& outputIds,
+                                               const Convolution::Details::ConvolutionParams& params,
+                                               const nodes::ActivationMode activation)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    // 1D convolutions are converted to 2D ones with filters of width 1 by ConvolutionParams
+    if (params.NumberOfSpatialDims() != 2) {
+        throw_ov_exception("DepthwiseConvolution supports only 2D convolutions");
+    }
+    const auto channels = params.input_shape_[1];
+    const auto& filter = params.filter_shape_;
+    if (params.groups_ != channels || filter[0] != channels || filter[1] != 1 || params.output_shape_[1] != channels) {
+        throw_ov_exception(
+            fmt::format("Convolution with {} groups of {} channels isn't depthwise", params.groups_, channels));
+    }
+    if (filter[2] != filter[3] || !kernel::DepthwiseConvolution::isSupportedKernelSize(filter[2])) {
+        throw_ov_exception(fmt::format("Filter {}x{} is not supported by DepthwiseConvolution", filter[2], filter[3]));
+    }
+    kernel_.emplace(kernel::DepthwiseConvolution::Params{convertDataType<kernel::Type_t>(params.element_type_),
+                                                         params.nhwc_layout_,
+                                                         params.input_shape_[0],
+                                                         channels,
+                                                         params.input_shape_[2],
+                                                         params.input_shape_[3],
+                                                         params.output_shape_[2],
+                                                         params.output_shape_[3],
+                                                         filter[2],
+                                                         params.strides_[0],
+                                                         params.strides_[1],
+                                                         params.dilations_[0],
+                                                         params.dilations_[1],
+                                                         static_cast<int>(params.padding_before_[0]),
+                                                         static_cast<int>(params.padding_before_[1]),
+                                                         convertActivation(activation)});
+}
+
+DepthwiseConvolutionOp::DepthwiseConvolutionOp(const CreationContext& context,
+                                               const nodes::DepthwiseConvolutionMaxPool& node,
+                                               IndexCollection&& inputIds,
+                                               IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    const auto& input = node.get_input_shape(0);
+    const auto& filter = node.get_input_shape(1);
+    const auto output = node.get_convolution_output_shape();
+    if (filter[3] != filter[4] || !kernel::DepthwiseConvolution::isSupportedKernelSize(filter[3])) {
+        throw_ov_exception(fmt::format("Filter {}x{} is not supported by DepthwiseConvolution", filter[3], filter[4]));
+    }
+    kernel_.emplace(kernel::DepthwiseConvolution::Params{convertDataType<kernel::Type_t>(node.get_element_type()),
+                                                         false,
+                                                         input[0],
+                                                         input[1],
+                                                         input[2],
+                                                         input[3],
+                                                         output[2],
+                                                         output[3],
+                                                         filter[3],
+                                                         node.get_strides()[0],
+                                                         node.get_strides()[1],
+                                                         node.get_dilations()[0],
+                                                         node.get_dilations()[1],
+                                                         static_cast<int>(node.get_pads_begin()[0]),
+                                                         static_cast<int>(node.get_pads_begin()[1]),
+                                                         convertActivation(node.get_activation()),
+                                                         node.get_pool_size()});
+}
+
+void DepthwiseConvolutionOp::Execute(const InferenceRequestContext& context,
+                                     Inputs inputTensors,
+                                     Outputs outputTensors,
+                                     const Workbuffers&) const {
+    // Inputs are the input and the filter, followed by the bias and the addend of FusedGroupConvolution
+    OPENVINO_ASSERT(inputTensors.size() >= 2 && inputTensors.size() <= 4, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputTensors.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputTensors[0].get(),
+               inputTensors[1].get(),
+               inputTensors.size() > 2 ? inputTensors[2].get() : nullptr,
+               inputTensors.size() > 3 ? inputTensors[3].get() : nullptr,
+               outputTensors[0].get());
+}
+
+bool DepthwiseConvolutionOp::IsCudaGraphCompatible() const { return true; }
+
+OperationBase::Ptr depthwiseConvolutionMaxPoolFactory(const CreationContext& context,
+                                                      const std::shared_ptr<ov::Node>& node,
+                                                      OperationBase::IndexCollection&& inputIds,
+                                                      OperationBase::IndexCollection&& outputIds) {
+    return std::make_shared<DepthwiseConvolutionOp>(context,
+                                                    dynamic_cast<const nodes::DepthwiseConvolutionMaxPool&>(*node),
+                                                    std::move(inputIds),
+                                                    std::move(outputIds));
+}
+
+OPERATION_REGISTER_FACTORY(depthwiseConvolutionMaxPoolFactory, DepthwiseConvolutionMaxPool);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "convolution_components/convolution_components.hpp"
+#include "kernels/depthwise_convolution.hpp"
+#include "transformer/nodes/activation_type.hpp"
+#include "transformer/nodes/depthwise_convolution_max_pool.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Depthwise convolution of GroupConvolution and FusedGroupConvolution nodes, which have as many groups
+ * as input and output channels and 3x3 or 5x5 filters. cuDNN executes such convolutions at small batches by
+ * generic algorithms, which reach a fraction of memory bandwidth. DepthwiseConvolutionMaxPool nodes are executed
+ * by the same kernel, which pools activated outputs before they are written
+ */
+class DepthwiseConvolutionOp : public OperationBase {
+public:
+    /**
+     * @param params Parameters of the convolution
+     * @param activation Activation of FusedGroupConvolution, which follows the bias and the optional addition
+     * @throws ov::Exception if the convolution isn't a supported depthwise one
+     */
+    DepthwiseConvolutionOp(const CreationContext& context,
+                           const ov::Node& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds,
+                           const Convolution::Details::ConvolutionParams& params,
+                           nodes::ActivationMode activation = nodes::ActivationMode::NO_ACTIVATION);
+
+    /**
+     * @throws ov::Exception if the filter size isn't supported
+     */
+    DepthwiseConvolutionOp(const CreationContext& context,
+                           const nodes::DepthwiseConvolutionMaxPool& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::DepthwiseConvolution> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,436 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "einsum.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda_operation_registry.hpp>
+#include <limits>
+#include <numeric>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+#include "cuda/constant_factory.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+// Modes of dimensions covered by an ellipsis follow modes of letters, the last dimension has the first one
+constexpr int32_t ellipsis_mode = std::numeric_limits<char>::max() + 1;
+
+using Operand = EinsumOp::Operand;
+using Step = EinsumOp::Step;
+
+cutensorComputeType_t toComputeType(const cudaDataType_t type, const bool tf32) {
+    switch (type) {
+        case CUDA_R_64F:
+            return CUTENSOR_COMPUTE_64F;
+        case CUDA_R_32F:
+            return tf32 ? CUTENSOR_COMPUTE_TF32 : CUTENSOR_COMPUTE_32F;
+        case CUDA_R_16F:
+        case CUDA_R_16BF:
+            return CUTENSOR_COMPUTE_32F;
+        default:
+            throw_ov_exception(fmt::format("EinsumOp: unsupported element type: {}", toString(type)));
+    }
+}
+
+/**
+ * @returns Type of alpha and beta, which is defined by the compute type
+ */
+cudaDataType_t toScalarType(const cutensorComputeType_t computeType) {
+    return computeType == CUTENSOR_COMPUTE_64F ? CUDA_R_64F : CUDA_R_32F;
+}
+
+bool contains(const std::vector<int32_t>& modes, const int32_t mode) {
+    return std::find(modes.begin(), modes.end(), mode) != modes.end();
+}
+
+std::vector<int64_t> denseStrides(const std::vector<int64_t>& extents) {
+    std::vector<int64_t> strides(extents.size());
+    int64_t stride = 1;
+    for (size_t i = extents.size(); i-- > 0;) {
+        strides[i] = stride;
+        stride *= extents[i];
+    }
+    return strides;
+}
+
+size_t numElements(const std::vector<int64_t>& extents) {
+    return std::accumulate(extents.begin(), extents.end(), size_t{1}, std::multiplies<size_t>());
+}
+
+/**
+ * Dense tensor of the modes, which are taken from operands in their order
+ */
+Operand makeDense(const Operand::Source source,
+                  const size_t index,
+                  const std::vector<int32_t>& modes,
+                  const std::unordered_map<int32_t, int64_t>& extents) {
+    Operand result{source, index, modes, {}, {}};
+    for (const auto mode : modes) {
+        result.extents.push_back(extents.at(mode));
+    }
+    result.strides = denseStrides(result.extents);
+    return result;
+}
+
+cutensorTensorDescriptor_t initDescriptor(const cutensorHandle_t& handle,
+                                          const Operand& operand,
+                                          const cudaDataType_t dataType) {
+    cutensorTensorDescriptor_t descriptor{};
+    throwIfError(cutensorInitTensorDescriptor(&handle,
+                                              &descriptor,
+                                              static_cast<uint32_t>(operand.modes.size()),
+                                              operand.extents.data(),
+                                              operand.strides.data(),
+                                              dataType,
+                                              CUTENSOR_OP_IDENTITY));
+    return descriptor;
+}
+
+cutensorContractionDescriptor_t initContraction(const cutensorHandle_t& handle,
+                                                const Step& step,
+                                                const cutensorTensorDescriptor_t& a,
+                                                const cutensorTensorDescriptor_t& b,
+                                                const cutensorTensorDescriptor_t& d,
+                                                const cutensorComputeType_t computeType) {
+    // Memory blocks and work buffers are aligned, so are all tensors
+    cutensorContractionDescriptor_t descriptor{};
+    throwIfError(cutensorInitContractionDescriptor(&handle,
+                                                   &descriptor,
+                                                   &a,
+                                                   step.a.modes.data(),
+                                                   CUDA::memoryAlignment,
+                                                   &b,
+                                                   step.b.modes.data(),
+                                                   CUDA::memoryAlignment,
+                                                   &d,
+                                                   step.d.modes.data(),
+                                                   CUDA::memoryAlignment,
+                                                   &d,
+                                                   step.d.modes.data(),
+                                                   CUDA::memoryAlignment,
+                                                   computeType));
+    return descriptor;
+}
+
+}  // namespace
+
+EinsumOp::EinsumOp(const CreationContext& context,
+                   const NodeOp& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds)
+    : OperationCuTensor(context, node, std::move(inputIds), std::move(outputIds)),
+      data_type_{convertDataType<cudaDataType_t>(node.get_output_element_type(0))},
+      compute_type_{toComputeType(data_type_, context.tf32())},
+      element_size_{node.get_output_element_type(0).size()} {
+    OPENVINO_ASSERT(node.get_input_size() >= 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    PlanSteps(node);
+
+    // Workspace sizes are the same for handles of all thread contexts, so they are queried by a temporary one
+    const CUDA::CuTensorHandle handle;
+    for (auto& step : steps_) {
+        if (step.kind == Step::Kind::Contraction) {
+            const auto a = initDescriptor(handle.get(), step.a, data_type_);
+            const auto b = initDescriptor(handle.get(), step.b, data_type_);
+            const auto d = initDescriptor(handle.get(), step.d, data_type_);
+            const auto descriptor = initContraction(handle.get(), step, a, b, d, compute_type_);
+            cutensorContractionFind_t find{};
+            throwIfError(cutensorInitContractionFind(&handle.get(), &find, CUTENSOR_ALGO_DEFAULT));
+            throwIfError(cutensorContractionGetWorkspaceSize(
+                &handle.get(), &descriptor, &find, CUTENSOR_WORKSPACE_RECOMMENDED, &step.workspace_size));
+            if (step.workspace_size > context.maxWorkspaceSize()) {
+                throwIfError(cutensorContractionGetWorkspaceSize(
+                    &handle.get(), &descriptor, &find, CUTENSOR_WORKSPACE_MIN, &step.workspace_size));
+            }
+        } else if (step.kind == Step::Kind::Reduction) {
+            const auto a = initDescriptor(handle.get(), step.a, data_type_);
+            const auto d = initDescriptor(handle.get(), step.d, data_type_);
+            throwIfError(cutensorReductionGetWorkspaceSize(&handle.get(),
+                                                           nullptr,
+                                                           &a,
+                                                           step.a.modes.data(),
+                                                           nullptr,
+                                                           &d,
+                                                           step.d.modes.data(),
+                                                           nullptr,
+                                                           &d,
+                                                           step.d.modes.data(),
+                                                           CUTENSOR_OP_ADD,
+                                                           compute_type_,
+                                                           &step.workspace_size));
+        }
+        workspace_size_ = std::max(workspace_size_, step.workspace_size);
+    }
+}
+
+void EinsumOp::PlanSteps(const NodeOp& node) {
+    std::vector<std::string> inputSubscripts;
+    std::string outputSubscript;
+    NodeOp::parse_equation(node.get_equation(), inputSubscripts, outputSubscript);
+    OPENVINO_ASSERT(inputSubscripts.size() == node.get_input_size(), "Node name: ", GetName());
+
+    // Dimensions covered by ellipses are aligned from the right and broadcast
+    std::unordered_map<int32_t, int64_t> extents;
+    auto addExtent = [&](const int32_t mode, const int64_t extent) {
+        auto& known = extents[mode];
+        if (known > 1 && extent > 1 && known != extent) {
+            throw_ov_exception(fmt::format("EinsumOp: dimensions {} and {} of label {} don't match, node name: {}",
+                                           known,
+                                           extent,
+                                           mode,
+                                           GetName()));
+        }
+        known = std::max(known, extent);
+    };
+    auto subscriptModes = [&](const std::string& subscript, const size_t rank) {
+        const auto labels = NodeOp::extract_labels(subscript);
+        const size_t ellipsisRank = rank + 1 - labels.size();
+        std::vector<int32_t> modes;
+        for (const auto& label : labels) {
+            if (label == "...") {
+                for (size_t i = ellipsisRank; i-- > 0;) {
+                    modes.push_back(ellipsis_mode + static_cast<int32_t>(i));
+                }
+            } else {
+                modes.push_back(static_cast<int32_t>(label[0]));
+            }
+        }
+        OPENVINO_ASSERT(modes.size() == rank, "Node name: ", GetName());
+        return modes;
+    };
+
+    std::vector<Operand> operands;
+    for (size_t i = 0; i < inputSubscripts.size(); ++i) {
+        const auto& shape = node.get_input_shape(i);
+        const auto modes = subscriptModes(inputSubscripts[i], shape.size());
+        const auto strides = denseStrides(std::vector<int64_t>(shape.begin(), shape.end()));
+        Operand operand{Operand::Source::Input, i, {}, {}, {}};
+        for (size_t dim = 0; dim < modes.size(); ++dim) {
+            addExtent(modes[dim], static_cast<int64_t>(shape[dim]));
+            const auto found = std::find(operand.modes.begin(), operand.modes.end(), modes[dim]);
+            if (found != operand.modes.end()) {
+                // Diagonal of repeated labels
+                operand.strides[found - operand.modes.begin()] += strides[dim];
+            } else {
+                operand.modes.push_back(modes[dim]);
+                operand.extents.push_back(static_cast<int64_t>(shape[dim]));
+                operand.strides.push_back(strides[dim]);
+            }
+        }
+        operands.push_back(std::move(operand));
+    }
+    // Dimensions of size 1 broadcast to other operands are dropped, since cuTENSOR requires equal extents of modes
+    for (auto& operand : operands) {
+        for (size_t i = operand.modes.size(); i-- > 0;) {
+            if (operand.extents[i] != extents.at(operand.modes[i])) {
+                operand.modes.erase(operand.modes.begin() + i);
+                operand.extents.erase(operand.extents.begin() + i);
+                operand.strides.erase(operand.strides.begin() + i);
+            }
+        }
+    }
+    const auto outputModes = subscriptModes(outputSubscript, node.get_output_shape(0).size());
+    const auto output = makeDense(Operand::Source::Output, 0, outputModes, extents);
+
+    auto addIntermediate = [&](const std::vector<int32_t>& modes) {
+        intermediate_sizes_.push_back(numElements(makeDense(Operand::Source::Intermediate, 0, modes, extents).extents) *
+                                      element_size_);
+        return makeDense(Operand::Source::Intermediate, intermediate_sizes_.size() - 1, modes, extents);
+    };
+    auto isNeeded = [&](const int32_t mode, const size_t except, const size_t exceptToo) {
+        if (contains(outputModes, mode)) {
+            return true;
+        }
+        for (size_t i = 0; i < operands.size(); ++i) {
+            if (i != except && i != exceptToo && contains(operands[i].modes, mode)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (operands.size() > 1) {
+        // Contractions need each mode in at least two of their tensors, so labels of a single operand are summed
+        for (size_t i = 0; i < operands.size(); ++i) {
+            std::vector<int32_t> kept;
+            std::copy_if(operands[i].modes.begin(),
+                         operands[i].modes.end(),
+                         std::back_inserter(kept),
+                         [&](const int32_t mode) { return isNeeded(mode, i, i); });
+            if (kept.size() != operands[i].modes.size()) {
+                auto reduced = addIntermediate(kept);
+                steps_.push_back(Step{Step::Kind::Reduction, operands[i], {}, reduced, 0});
+                operands[i] = std::move(reduced);
+            }
+        }
+    }
+    while (operands.size() > 1) {
+        // Pair of operands with the smallest product
+        size_t bestI = 0;
+        size_t bestJ = 1;
+        std::vector<int32_t> bestModes;
+        size_t bestSize = std::numeric_limits<size_t>::max();
+        for (size_t i = 0; i < operands.size(); ++i) {
+            for (size_t j = i + 1; j < operands.size(); ++j) {
+                std::vector<int32_t> modes;
+                for (const auto* operand : {&operands[i], &operands[j]}) {
+                    for (const auto mode : operand->modes) {
+                        if (!contains(modes, mode) && isNeeded(mode, i, j)) {
+                            modes.push_back(mode);
+                        }
+                    }
+                }
+                const auto size = numElements(makeDense(Operand::Source::Intermediate, 0, modes, extents).extents);
+                if (size < bestSize) {
+                    bestI = i;
+                    bestJ = j;
+                    bestModes = std::move(modes);
+                    bestSize = size;
+                }
+            }
+        }
+        const bool last = operands.size() == 2;
+        auto product = last ? output : addIntermediate(bestModes);
+        steps_.push_back(Step{Step::Kind::Contraction, operands[bestI], operands[bestJ], product, 0});
+        operands.erase(operands.begin() + bestJ);
+        operands[bestI] = std::move(product);
+    }
+    if (operands.front().source == Operand::Source::Input) {
+        const auto& input = operands.front();
+        const bool reduced = std::any_of(
+            input.modes.begin(), input.modes.end(), [&](const int32_t mode) { return !contains(outputModes, mode); });
+        steps_.push_back(Step{reduced ? Step::Kind::Reduction : Step::Kind::Permutation, input, {}, output, 0});
+    }
+}
+
+EinsumOp::StepPlan EinsumOp::InitPlan(const cutensorHandle_t& handle, const Step& step) const {
+    StepPlan plan;
+    plan.a = initDescriptor(handle, step.a, data_type_);
+    plan.d = initDescriptor(handle, step.d, data_type_);
+    if (step.kind == Step::Kind::Contraction) {
+        plan.b = initDescriptor(handle, step.b, data_type_);
+        const auto descriptor = initContraction(handle, step, plan.a, plan.b, plan.d, compute_type_);
+        cutensorContractionFind_t find{};
+        throwIfError(cutensorInitContractionFind(&handle, &find, CUTENSOR_ALGO_DEFAULT));
+        throwIfError(cutensorInitContractionPlan(&handle, &plan.contraction, &descriptor, &find, step.workspace_size));
+    }
+    return plan;
+}
+
+const std::vector<EinsumOp::StepPlan>& EinsumOp::Plans(const cutensorHandle_t& handle) const {
+    std::lock_guard<std::mutex> lock{plans_mutex_};
+    auto found = plans_.find(&handle);
+    if (found == plans_.end()) {
+        std::vector<StepPlan> plans;
+        plans.reserve(steps_.size());
+        for (const auto& step : steps_) {
+            plans.push_back(InitPlan(handle, step));
+        }
+        found = plans_.emplace(&handle, std::move(plans)).first;
+    }
+    return found->second;
+}
+
+WorkbufferRequest EinsumOp::GetWorkBufferRequest() const {
+    WorkbufferRequest request{{}, intermediate_sizes_};
+    if (workspace_size_ > 0) {
+        request.mutable_sizes.push_back(workspace_size_);
+    }
+    return request;
+}
+
+void EinsumOp::Execute(const InferenceRequestContext& context,
+                       Inputs inputs,
+                       Outputs outputs,
+                       const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() >= 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == intermediate_sizes_.size() + (workspace_size_ > 0),
+                    "Node name: ",
+                    GetName());
+    const auto& threadContext = context.getThreadContext();
+    const auto& handle = threadContext.cuTensorHandle().get();
+    const auto stream = threadContext.stream().get();
+    void* workspace = workspace_size_ > 0 ? workbuffers.mutable_buffers.back().get() : nullptr;
+    auto pointer = [&](const Operand& operand) -> void* {
+        switch (operand.source) {
+            case Operand::Source::Input:
+                return const_cast<void*>(inputs[operand.index].get());
+            case Operand::Source::Intermediate:
+                return workbuffers.mutable_buffers[operand.index].get();
+            default:
+                return outputs[0].get();
+        }
+    };
+    const auto scalarType = toScalarType(compute_type_);
+    const auto* one = &CUDA::NumericConst<CUDA::constants::one>(scalarType);
+    const auto* zero = &CUDA::NumericConst<CUDA::constants::zero>(scalarType);
+
+    const auto& plans = Plans(handle);
+    for (size_t i = 0; i < steps_.size(); ++i) {
+        const auto& step = steps_[i];
+        const auto& plan = plans[i];
+        void* d = pointer(step.d);
+        switch (step.kind) {
+            case Step::Kind::Contraction:
+                throwIfError(cutensorContraction(&handle,
+                                                 &plan.contraction,
+                                                 one,
+                                                 pointer(step.a),
+                                                 pointer(step.b),
+                                                 zero,
+                                                 d,
+                                                 d,
+                                                 workspace,
+                                                 step.workspace_size,
+                                                 stream));
+                break;
+            case Step::Kind::Reduction:
+                throwIfError(cutensorReduction(&handle,
+                                               one,
+                                               pointer(step.a),
+                                               &plan.a,
+                                               step.a.modes.data(),
+                                               zero,
+                                               d,
+                                               &plan.d,
+                                               step.d.modes.data(),
+                                               d,
+                                               &plan.d,
+                                               step.d.modes.data(),
+                                               CUTENSOR_OP_ADD,
+                                               compute_type_,
+                                               workspace,
+                                               step.workspace_size,
+                                               stream));
+                break;
+            case Step::Kind::Permutation:
+                throwIfError(cutensorPermutation(&handle,
+                                                 &CUDA::NumericConst<CUDA::constants::one>(data_type_),
+                                                 pointer(step.a),
+                                                 &plan.a,
+                                                 step.a.modes.data(),
+                                                 d,
+                                                 &plan.d,
+                                                 step.d.modes.data(),
+                                                 data_type_,
+                                                 stream));
+                break;
+        }
+    }
+}
+
+bool EinsumOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(EinsumOp, Einsum);
+}  // namespace nvidia_gpu
+}  // namespace ov
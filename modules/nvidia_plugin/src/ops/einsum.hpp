@@ -0,0 +1,92 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/tensor.hpp>
+#include <cuda_operation_base.hpp>
+#include <mutex>
+#include <openvino/op/einsum.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Computes Einsum by cuTENSOR. Operands are contracted pairwise in the greedy order, which keeps intermediate
+ * tensors smallest, labels summed within a single operand are reduced before contractions, and a single operand
+ * is reduced or permuted to the output. Repeated labels of an operand (diagonals) are addressed by the sum of their
+ * strides. Intermediate tensors and the workspace of cuTENSOR are mutable work buffers
+ */
+class EinsumOp : public OperationCuTensor {
+public:
+    using NodeOp = ov::op::v7::Einsum;
+
+    EinsumOp(const CreationContext& context,
+             const NodeOp& node,
+             IndexCollection&& inputIds,
+             IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    /**
+     * Tensor of a step, modes are labels of its dimensions
+     */
+    struct Operand {
+        enum class Source { Input, Intermediate, Output };
+        Source source;
+        size_t index;
+        std::vector<int32_t> modes;
+        std::vector<int64_t> extents;
+        std::vector<int64_t> strides;
+    };
+
+    struct Step {
+        enum class Kind { Contraction, Reduction, Permutation };
+        Kind kind;
+        Operand a;
+        // Second operand of contractions
+        Operand b;
+        Operand d;
+        uint64_t workspace_size;
+    };
+
+private:
+    /**
+     * cuTENSOR descriptors and contraction plans of steps initialized for a handle of a thread context
+     */
+    struct StepPlan {
+        cutensorTensorDescriptor_t a{};
+        cutensorTensorDescriptor_t b{};
+        cutensorTensorDescriptor_t d{};
+        cutensorContractionPlan_t contraction{};
+    };
+
+    void PlanSteps(const NodeOp& node);
+    StepPlan InitPlan(const cutensorHandle_t& handle, const Step& step) const;
+    /**
+     * @returns Plans of steps for the handle, which are initialized on the first execution by the thread context
+     */
+    const std::vector<StepPlan>& Plans(const cutensorHandle_t& handle) const;
+
+    cudaDataType_t data_type_ = CUDA_R_32F;
+    cutensorComputeType_t compute_type_ = CUTENSOR_COMPUTE_32F;
+    size_t element_size_ = 0;
+    std::vector<Step> steps_;
+    std::vector<size_t> intermediate_sizes_;
+    uint64_t workspace_size_ = 0;
+    mutable std::mutex plans_mutex_;
+    mutable std::unordered_map<const cutensorHandle_t*, std::vector<StepPlan>> plans_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
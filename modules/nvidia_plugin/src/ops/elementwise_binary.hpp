@@ -16,13 +16,15 @@ template <typename nGraphNode, typename Kernel>
 class ElementwiseBinaryOp : public OperationBase {
 public:
     using NodeOp = nGraphNode;
+    static constexpr bool kInPlace = true;
+    static constexpr bool kTunedBlockSize = true;
     ElementwiseBinaryOp(const CreationContext& context,
                         const NodeOp& node,
                         IndexCollection&& inputIds,
                         IndexCollection&& outputIds)
         : OperationBase{context, node, move(inputIds), move(outputIds)},
-          in0_broadcast_params_{NumpyBroadcastParams::create(node.get_input_shape(0), node.get_output_shape(0))},
-          in1_broadcast_params_{NumpyBroadcastParams::create(node.get_input_shape(1), node.get_output_shape(0))} {
+          in0_broadcast_params_{NumpyBroadcastParams::create(node, 0)},
+          in1_broadcast_params_{NumpyBroadcastParams::create(node, 1)} {
         OPENVINO_ASSERT(node.get_input_size() == 2, "Node name: ", GetName());
         OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
 
@@ -36,7 +38,7 @@ public:
         in0_broadcast_params_->addWorkbufferRequests(immutable_buffer_sizes_);
         in1_broadcast_params_->addWorkbufferRequests(immutable_buffer_sizes_);
 
-        const size_t max_threads_per_block = context.device().props().maxThreadsPerBlock;
+        const size_t max_threads_per_block = context.maxThreadsPerBlock();
         const size_t out_num_elements = ov::shape_size(node.get_output_shape(0));
         kernel_ = Kernel{
             convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type), out_num_elements, max_threads_per_block};
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cuda_operation_base.hpp>
+#include <type_traits>
 
 #include "components/numpy_broadcast_params.h"
 #include "converters.hpp"
@@ -16,6 +17,8 @@ template <typename nGraphNode, typename Kernel>
 class ElementwiseUnaryOp : public OperationBase {
 public:
     using NodeOp = nGraphNode;
+    static constexpr bool kInPlace = true;
+    static constexpr bool kTunedBlockSize = true;
     ElementwiseUnaryOp(const CreationContext& context,
                        const NodeOp& node,
                        IndexCollection&& inputIds,
@@ -30,9 +33,14 @@ public:
         const auto output_shape = node.get_output_shape(0);
         OPENVINO_ASSERT(input_shape == output_shape, "Node name: ", GetName());
         size_t num_elements = ov::shape_size(input_shape);
-        const size_t max_threads_per_block = context.device().props().maxThreadsPerBlock;
-        kernel_ = Kernel{
-            convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type), max_threads_per_block, num_elements};
+        const size_t max_threads_per_block = context.maxThreadsPerBlock();
+        const auto element_type = convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type);
+        // Kernels of activations with fast approximations of math (see ov::nvidia_gpu::fast_math)
+        if constexpr (std::is_constructible_v<Kernel, ov::nvidia_gpu::kernel::Type_t, size_t, size_t, bool>) {
+            kernel_ = Kernel{element_type, max_threads_per_block, num_elements, context.fastMath()};
+        } else {
+            kernel_ = Kernel{element_type, max_threads_per_block, num_elements};
+        }
     }
 
     void Execute(const InferenceRequestContext& context,
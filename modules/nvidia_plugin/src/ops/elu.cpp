@@ -30,8 +30,11 @@ EluOp::EluOp(const CreationContext& context,
     const auto elu = dynamic_cast<const ov::op::v0::Elu*>(&node);
     OPENVINO_ASSERT(elu, "Node name: ", GetName());
     const auto alpha = static_cast<float>(elu->get_alpha());
-    kernel_ = kernel::Elu{
-        convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type), max_threads_per_block, num_elements, alpha};
+    kernel_ = kernel::Elu{convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type),
+                          max_threads_per_block,
+                          num_elements,
+                          alpha,
+                          context.fastMath()};
 }
 
 void EluOp::Execute(const InferenceRequestContext& context,
@@ -13,6 +13,7 @@ namespace nvidia_gpu {
 
 class EluOp : public OperationBase {
 public:
+    static constexpr bool kInPlace = true;
     EluOp(const CreationContext& context,
           const ov::Node& node,
           IndexCollection&& inputIds,
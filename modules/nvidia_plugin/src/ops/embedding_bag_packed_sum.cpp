@@ -0,0 +1,64 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_packed_sum.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+EmbeddingBagPackedSumOp::EmbeddingBagPackedSumOp(const CreationContext& context,
+                                                 const NodeOp& node,
+                                                 IndexCollection&& inputIds,
+                                                 IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    OPENVINO_ASSERT(node.get_input_size() == 2 || node.get_input_size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+
+    const auto element_type = convertDataType<kernel::Type_t>(node.get_input_element_type(0));
+    const auto index_type = convertDataType<kernel::Type_t>(node.get_input_element_type(1));
+    if (!kernel::EmbeddingBag::isTypeSupported(element_type, index_type)) {
+        throw_ov_exception(fmt::format("EmbeddingBagPackedSumOp: unsupported argument types: {}, {}",
+                                       node.get_input_element_type(0).get_type_name(),
+                                       node.get_input_element_type(1).get_type_name()));
+    }
+    const auto& table_shape = node.get_input_shape(0);
+    const auto& indices_shape = node.get_input_shape(1);
+    OPENVINO_ASSERT(table_shape.size() >= 1 && indices_shape.size() == 2, "Node name: ", GetName());
+    const size_t embedding_size = ov::shape_size(ov::Shape(table_shape.begin() + 1, table_shape.end()));
+    kernel_ = kernel::EmbeddingBag{element_type,
+                                   index_type,
+                                   table_shape[0],
+                                   embedding_size,
+                                   indices_shape[0],
+                                   indices_shape[1],
+                                   static_cast<unsigned>(context.device().props().maxThreadsPerBlock)};
+}
+
+void EmbeddingBagPackedSumOp::Execute(const InferenceRequestContext& context,
+                                      Inputs inputTensors,
+                                      Outputs outputTensors,
+                                      const Workbuffers&) const {
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    OPENVINO_ASSERT(inputTensors.size() == 2 || inputTensors.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputTensors.size() == 1, "Node name: ", GetName());
+    const void* weights = inputTensors.size() == 3 ? inputTensors[2].get() : nullptr;
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputTensors[0].get(),
+               inputTensors[1].get(),
+               weights,
+               outputTensors[0].get());
+}
+
+bool EmbeddingBagPackedSumOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(EmbeddingBagPackedSumOp, EmbeddingBagPackedSum);
+}  // namespace nvidia_gpu
+}  // namespace ov
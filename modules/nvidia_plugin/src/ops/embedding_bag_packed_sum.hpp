@@ -0,0 +1,37 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <openvino/op/embeddingbag_packedsum.hpp>
+
+#include "kernels/embedding_bag.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class EmbeddingBagPackedSumOp : public OperationBase {
+public:
+    using NodeOp = ov::op::v3::EmbeddingBagPackedSum;
+
+    EmbeddingBagPackedSumOp(const CreationContext& context,
+                            const NodeOp& node,
+                            IndexCollection&& inputIds,
+                            IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::EmbeddingBag> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,66 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "extension.hpp"
+
+#include <openvino/core/except.hpp>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+ExtensionOp::ExtensionOp(const CreationContext& context,
+                         const ov::Node& node,
+                         IndexCollection&& inputIds,
+                         IndexCollection&& outputIds,
+                         ExtensionOperation::Ptr operation,
+                         std::shared_ptr<void> library)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)),
+      library_{std::move(library)},
+      operation_{std::move(operation)} {
+    OPENVINO_ASSERT(operation_, "Extension created no operation, node name: ", GetName());
+}
+
+void ExtensionOp::Execute(const InferenceRequestContext& context,
+                          Inputs inputTensors,
+                          Outputs outputTensors,
+                          const Workbuffers& workbuffers) const {
+    const auto& threadContext = context.getThreadContext();
+    const ExtensionContext extensionContext{threadContext.device().getId(),
+                                            threadContext.stream().get(),
+                                            threadContext.cuBlasHandle().get(),
+                                            threadContext.dnnHandle().get()};
+    const auto pointers = [](const auto& tensors) {
+        std::vector<decltype(tensors.begin()->get())> result;
+        result.reserve(tensors.size());
+        for (const auto& tensor : tensors) {
+            result.push_back(tensor.get());
+        }
+        return result;
+    };
+    operation_->execute(extensionContext,
+                        pointers(inputTensors),
+                        pointers(outputTensors),
+                        pointers(workbuffers.immutable_buffers),
+                        pointers(workbuffers.mutable_buffers));
+}
+
+bool ExtensionOp::IsCudaGraphCompatible() const { return operation_->is_cuda_graph_compatible(); }
+
+WorkbufferRequest ExtensionOp::GetWorkBufferRequest() const {
+    return {operation_->immutable_workbuffer_sizes(), operation_->mutable_workbuffer_sizes()};
+}
+
+void ExtensionOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
+    std::vector<void*> pointers;
+    pointers.reserve(buffers.size());
+    for (const auto& buffer : buffers) {
+        pointers.push_back(buffer.get());
+    }
+    operation_->init_immutable_workbuffers(pointers);
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <memory>
+#include <nvidia/extension.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Executes ExtensionOperation implemented by a library of extensions (see ov::nvidia_gpu::extensions)
+ */
+class ExtensionOp : public OperationBase {
+public:
+    /**
+     * @param library Library, which implements the operation, it's kept loaded while the operation exists
+     */
+    ExtensionOp(const CreationContext& context,
+                const ov::Node& node,
+                IndexCollection&& inputIds,
+                IndexCollection&& outputIds,
+                ExtensionOperation::Ptr operation,
+                std::shared_ptr<void> library);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
+
+private:
+    std::shared_ptr<void> library_;
+    ExtensionOperation::Ptr operation_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,252 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.hpp"
+
+#include <fmt/format.h>
+
+#include <cmath>
+#include <cuda_operation_registry.hpp>
+#include <map>
+#include <openvino/core/attribute_visitor.hpp>
+#include <openvino/op/constant.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr size_t kWorkAreaAlignment = 256;
+
+/**
+ * Reads integer and boolean attributes of a node, whose class isn't known to the plugin
+ */
+class AttributesReader : public ov::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {}
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        values_[name] = adapter.get();
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        values_[name] = adapter.get();
+    }
+
+    bool flag(const std::string& name) const {
+        const auto value = values_.find(name);
+        return value != values_.end() && value->second != 0;
+    }
+
+private:
+    std::map<std::string, int64_t> values_;
+};
+
+}  // namespace
+
+FFTOp::FFTOp(const CreationContext& context,
+             const ov::Node& node,
+             IndexCollection&& inputIds,
+             IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 2, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    if (node.get_input_element_type(0) != ov::element::f32) {
+        throw_ov_exception(fmt::format(
+            "FFT {} supports only f32 input, not {}", GetName(), node.get_input_element_type(0).get_type_name()));
+    }
+    const auto signalDimsNode = ov::as_type_ptr<ov::op::v0::Constant>(node.get_input_node_shared_ptr(1));
+    if (!signalDimsNode) {
+        throw_ov_exception(fmt::format("FFT {}: signal dims should be constant", GetName()));
+    }
+    const auto signalDims = signalDimsNode->cast_vector<int64_t>();
+    AttributesReader attributes;
+    const_cast<ov::Node&>(node).visit_attributes(attributes);
+    const bool inverse = attributes.flag("inverse");
+    const bool onesided = attributes.flag("onesided");
+    if (attributes.flag("centered")) {
+        throw_ov_exception(fmt::format("FFT {}: centered transforms aren't supported", GetName()));
+    }
+
+    const auto& dims = node.get_input_shape(0);
+    std::vector<int> n;
+    std::vector<int> embed;
+    int istride = 1;
+    int ostride = 1;
+    int idist = 0;
+    int odist = 0;
+    int batch = 0;
+    if (onesided) {
+        // Real signals along the innermost dimension, spectrums of length / 2 + 1 complex values
+        const size_t axis = inverse ? dims.size() - 2 : dims.size() - 1;
+        if (dims.size() < (inverse ? 2u : 1u) || signalDims.size() != 1 || static_cast<size_t>(signalDims[0]) != axis ||
+            (inverse && (dims[axis] < 2 || dims.back() != 2))) {
+            throw_ov_exception(fmt::format("FFT {}: unsupported configuration of onesided transform", GetName()));
+        }
+        const size_t length = inverse ? 2 * (dims[axis] - 1) : dims[axis];
+        const size_t packed = length / 2 + 1;
+        n = {static_cast<int>(length)};
+        embed = n;
+        idist = static_cast<int>(inverse ? packed : length);
+        odist = static_cast<int>(inverse ? length : packed);
+        batch = static_cast<int>(shape_size(std::vector<size_t>(dims.begin(), dims.begin() + axis)));
+        type_ = inverse ? CUFFT_C2R : CUFFT_R2C;
+        if (inverse) {
+            input_copy_size_ = shape_size(dims) * sizeof(float);
+        }
+    } else {
+        // Layouts of complex signals of the CPU implementation. Signal d starts at complex element
+        // (d / interleave) * batchStride + d % interleave
+        const auto is = [&](size_t rank, const std::vector<int64_t>& axes) {
+            return dims.size() == rank && signalDims == axes;
+        };
+        size_t rows = 0;
+        size_t cols = 0;
+        size_t rowStride = 0;
+        size_t colStride = 1;
+        size_t interleave = 1;
+        size_t batchStride = 0;
+        size_t numSignals = 0;
+        if (is(5, {1, 2})) {
+            rows = dims[1];
+            cols = dims[2];
+            colStride = dims[3];
+            rowStride = cols * colStride;
+            interleave = dims[3];
+            batchStride = rows * rowStride;
+            numSignals = dims[0] * dims[3];
+        } else if (is(5, {2, 3})) {
+            rows = dims[2];
+            cols = dims[3];
+            rowStride = cols;
+            batchStride = rows * cols;
+            numSignals = dims[0] * dims[1];
+        } else if (is(4, {1, 2})) {
+            rows = dims[1];
+            cols = dims[2];
+            rowStride = cols;
+            batchStride = rows * cols;
+            numSignals = dims[0];
+        } else if (is(4, {1})) {
+            rows = dims[1];
+            cols = 1;
+            rowStride = dims[2];
+            interleave = dims[2];
+            batchStride = rows * rowStride;
+            numSignals = dims[0] * dims[2];
+        } else if (is(3, {1})) {
+            rows = 1;
+            cols = dims[1];
+            rowStride = cols;
+            batchStride = cols;
+            numSignals = dims[0];
+        } else {
+            throw_ov_exception(fmt::format("FFT {}: unsupported configuration of input dims {} and {} signal dims",
+                                           GetName(),
+                                           dims.size(),
+                                           signalDims.size()));
+        }
+        if (cols == 1) {
+            n = {static_cast<int>(rows)};
+            istride = static_cast<int>(rowStride);
+        } else if (rows == 1) {
+            n = {static_cast<int>(cols)};
+            istride = static_cast<int>(colStride);
+        } else {
+            n = {static_cast<int>(rows), static_cast<int>(cols)};
+            istride = static_cast<int>(colStride);
+        }
+        embed = {static_cast<int>(rows), static_cast<int>(rowStride / colStride)};
+        ostride = istride;
+        if (interleave > 1) {
+            idist = 1;
+            batch = static_cast<int>(interleave);
+            num_executions_ = numSignals / interleave;
+            input_execution_stride_ = batchStride * sizeof(cufftComplex);
+            output_execution_stride_ = input_execution_stride_;
+        } else {
+            idist = static_cast<int>(batchStride);
+            batch = static_cast<int>(numSignals);
+        }
+        odist = idist;
+        type_ = CUFFT_C2C;
+        direction_ = inverse ? CUFFT_INVERSE : CUFFT_FORWARD;
+    }
+    throwIfError(cufftMakePlanMany(plan_.get(),
+                                   static_cast<int>(n.size()),
+                                   n.data(),
+                                   embed.data(),
+                                   istride,
+                                   idist,
+                                   embed.data(),
+                                   ostride,
+                                   odist,
+                                   type_,
+                                   batch,
+                                   &work_size_));
+    double length = 1;
+    for (const auto size : n) {
+        length *= size;
+    }
+    normalize_.emplace(shape_size(node.get_output_shape(0)),
+                       static_cast<float>(1.0 / std::sqrt(length)),
+                       context.device().props().maxThreadsPerBlock);
+}
+
+void FFTOp::Execute(const InferenceRequestContext& context,
+                    Inputs inputs,
+                    Outputs outputs,
+                    const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == 2, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    auto& stream = context.getThreadContext().stream();
+    char* workspace = nullptr;
+    if (work_size_ + input_copy_size_ > 0) {
+        OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+        workspace = static_cast<char*>(workbuffers.mutable_buffers[0].get());
+    }
+    auto* input = static_cast<char*>(const_cast<void*>(inputs[0].get()));
+    if (input_copy_size_ > 0) {
+        char* copy = workspace + (work_size_ + kWorkAreaAlignment - 1) / kWorkAreaAlignment * kWorkAreaAlignment;
+        throwIfError(cudaMemcpyAsync(copy, input, input_copy_size_, cudaMemcpyDeviceToDevice, stream.get()));
+        input = copy;
+    }
+    auto* output = static_cast<char*>(outputs[0].get());
+    {
+        std::lock_guard<std::mutex> lock{plan_mutex_};
+        plan_.setStream(stream);
+        plan_.setWorkArea(workspace);
+        for (size_t e = 0; e < num_executions_; ++e) {
+            char* in = input + e * input_execution_stride_;
+            char* out = output + e * output_execution_stride_;
+            switch (type_) {
+                case CUFFT_R2C:
+                    throwIfError(cufftExecR2C(
+                        plan_.get(), reinterpret_cast<cufftReal*>(in), reinterpret_cast<cufftComplex*>(out)));
+                    break;
+                case CUFFT_C2R:
+                    throwIfError(cufftExecC2R(
+                        plan_.get(), reinterpret_cast<cufftComplex*>(in), reinterpret_cast<cufftReal*>(out)));
+                    break;
+                default:
+                    throwIfError(cufftExecC2C(plan_.get(),
+                                              reinterpret_cast<cufftComplex*>(in),
+                                              reinterpret_cast<cufftComplex*>(out),
+                                              direction_));
+                    break;
+            }
+        }
+    }
+    (*normalize_)(stream.get(), reinterpret_cast<float*>(output));
+}
+
+WorkbufferRequest FFTOp::GetWorkBufferRequest() const {
+    if (work_size_ + input_copy_size_ == 0) {
+        return {};
+    }
+    const size_t workAreaSize = (work_size_ + kWorkAreaAlignment - 1) / kWorkAreaAlignment * kWorkAreaAlignment;
+    return {{}, {workAreaSize + input_copy_size_}};
+}
+
+OPERATION_REGISTER(FFTOp, FFT);
+}  // namespace nvidia_gpu
+}  // namespace ov
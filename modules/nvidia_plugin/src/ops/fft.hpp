@@ -0,0 +1,52 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/fft.hpp>
+#include <cuda_operation_base.hpp>
+#include <mutex>
+#include <optional>
+
+#include "kernels/fft.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * FFT of the custom operations (torch.fft with orthonormal scaling) by cuFFT.
+ * The plan is made once for the shape of the node, its work area is the mutable workbuffer
+ */
+class FFTOp : public OperationBase {
+public:
+    FFTOp(const CreationContext& context,
+          const ov::Node& node,
+          IndexCollection&& inputIds,
+          IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    CUDA::FftPlan plan_;
+    // Streams and work areas of infer requests are set to the shared plan before its execution
+    mutable std::mutex plan_mutex_;
+    cufftType type_;
+    int direction_ = CUFFT_FORWARD;
+    // Plans can't batch signals interleaved by columns of several batches, so each batch is executed separately
+    size_t num_executions_ = 1;
+    size_t input_execution_stride_ = 0;
+    size_t output_execution_stride_ = 0;
+    size_t work_size_ = 0;
+    // Size of the copy of the input of complex-to-real transforms, which overwrite it
+    size_t input_copy_size_ = 0;
+    std::optional<kernel::FftNormalize> normalize_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
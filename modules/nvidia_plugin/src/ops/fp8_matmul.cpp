@@ -0,0 +1,136 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fp8_matmul.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+#if CUDART_VERSION >= 11080
+
+namespace {
+
+constexpr float kOne = 1.0f;
+constexpr float kZero = 0.0f;
+
+}  // namespace
+
+Fp8MatMulOp::Fp8MatMulOp(const CreationContext& context,
+                         const NodeOp& node,
+                         IndexCollection&& inputIds,
+                         IndexCollection&& outputIds)
+    : OperationCuBlas(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3 || node.get_input_size() == 4, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(CUDA::isFp8Supported(context.device()),
+                    "FP8 tensor cores are not supported by the device, node name: ",
+                    GetName());
+    const auto& element_type = node.get_input_element_type(0);
+    data_type_ = convertDataType<cudaDataType_t>(element_type);
+    const auto& input_shape = node.get_input_shape(0);
+    OPENVINO_ASSERT(!input_shape.empty(), "Node name: ", GetName());
+    k_ = input_shape.back();
+    n_ = node.get_input_shape(1)[0];
+    rows_ = ov::shape_size(input_shape) / k_;
+    has_bias_ = node.has_bias();
+    OPENVINO_ASSERT(rows_ != 0, "Node name: ", GetName());
+    // FP8 GEMM of cuBLASLt requires dimensions of matrices to be multiples of 16
+    OPENVINO_ASSERT(k_ % 16 == 0 && n_ % 16 == 0 && k_ != 0 && n_ != 0, "Node name: ", GetName());
+    OPENVINO_ASSERT(!has_bias_ || ov::shape_size(node.get_input_shape(3)) == rows_ * n_, "Node name: ", GetName());
+
+    /**
+     * NOTE: FP8 GEMM requires the first matrix to be transposed and the second one not to be transposed,
+     *       so C [rows, n] = A [rows, k] x Wt is computed in column-major as Ct = W x At
+     */
+    weights_layout_.emplace(CUDA_R_8F_E4M3, k_, n_, k_);
+    activations_layout_.emplace(CUDA_R_8F_E4M3, k_, rows_, k_);
+    output_layout_.emplace(data_type_, n_, rows_, n_);
+    const auto descriptor = createDescriptor(nullptr, nullptr);
+    CUDA::CuBlasLtMatmulPreference preference;
+    preference.set(CUBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, static_cast<uint64_t>(workspace_size));
+    cublasLtMatmulHeuristicResult_t heuristic{};
+    int num_results = 0;
+    throwIfError(cublasLtMatmulAlgoGetHeuristic(CUDA::toLtHandle(context.cuBlasHandle()),
+                                                descriptor.get(),
+                                                weights_layout_->get(),
+                                                activations_layout_->get(),
+                                                output_layout_->get(),
+                                                output_layout_->get(),
+                                                preference.get(),
+                                                1,
+                                                &heuristic,
+                                                &num_results));
+    OPENVINO_ASSERT(num_results > 0, "cuBLASLt has no FP8 algorithm for the node, node name: ", GetName());
+    algo_ = heuristic.algo;
+
+    const auto max_threads_per_block = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    kernel_ = kernel::Fp8MatMul{convertDataType<kernel::Type_t>(element_type), rows_ * k_, max_threads_per_block};
+}
+
+CUDA::CuBlasLtMatmulDescriptor Fp8MatMulOp::createDescriptor(const void* weights_scale,
+                                                             const void* activations_scale) const {
+    CUDA::CuBlasLtMatmulDescriptor descriptor{CUBLAS_COMPUTE_32F, CUDA_R_32F};
+    descriptor.set(CUBLASLT_MATMUL_DESC_TRANSA, CUBLAS_OP_T);
+    descriptor.set(CUBLASLT_MATMUL_DESC_TRANSB, CUBLAS_OP_N);
+    if (weights_scale && activations_scale) {
+        descriptor.set(CUBLASLT_MATMUL_DESC_A_SCALE_POINTER, weights_scale);
+        descriptor.set(CUBLASLT_MATMUL_DESC_B_SCALE_POINTER, activations_scale);
+    }
+    return descriptor;
+}
+
+WorkbufferRequest Fp8MatMulOp::GetWorkBufferRequest() const {
+    return {{}, {rows_ * k_, 2 * sizeof(float), workspace_size}};
+}
+
+void Fp8MatMulOp::Execute(const InferenceRequestContext& context,
+                          Inputs inputs,
+                          Outputs outputs,
+                          const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == (has_bias_ ? 4 : 3), "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    auto& stream = context.getThreadContext().stream();
+    auto activations = workbuffers.mutable_buffers[0];
+    auto* scales = static_cast<float*>(workbuffers.mutable_buffers[1].get());
+    auto workspace = workbuffers.mutable_buffers[2];
+
+    kernel_->quantize(stream.get(), inputs[0].get(), scales, activations.get());
+    // Descriptor refers to scales of the infer request, so it isn't shared by concurrent executions
+    const auto descriptor = createDescriptor(inputs[2].get(), scales + 1);
+    // Bias is taken as matrix C, which is added to the product by cuBLASLt
+    const void* bias = has_bias_ ? inputs[3].get() : outputs[0].get();
+    throwIfError(cublasLtMatmul(CUDA::toLtHandle(context.getThreadContext().cuBlasHandle()),
+                                descriptor.get(),
+                                &kOne,
+                                inputs[1].get(),
+                                weights_layout_->get(),
+                                activations.get(),
+                                activations_layout_->get(),
+                                has_bias_ ? &kOne : &kZero,
+                                bias,
+                                output_layout_->get(),
+                                outputs[0].get(),
+                                output_layout_->get(),
+                                &algo_,
+                                workspace.get(),
+                                workspace_size,
+                                stream.get()));
+}
+
+bool Fp8MatMulOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(Fp8MatMulOp, Fp8MatMul);
+
+#endif  // CUDART_VERSION >= 11080
+
+}  // namespace nvidia_gpu
+}  // namespace ov
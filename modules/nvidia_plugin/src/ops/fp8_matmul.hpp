@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#if CUDART_VERSION >= 11080
+
+#include <cuda/blas_lt.hpp>
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/fp8_matmul.hpp>
+
+#include "kernels/fp8_matmul.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Multiplies activations by FP8 weights with cuBLASLt FP8 GEMM. Activations are converted to FP8 into a mutable
+ * work buffer with a per-tensor scale, which is passed to cuBLASLt together with the scale of weights,
+ * products are accumulated in FP32
+ */
+class Fp8MatMulOp : public OperationCuBlas {
+public:
+    using NodeOp = nodes::Fp8MatMul;
+    Fp8MatMulOp(const CreationContext& context,
+                const NodeOp& node,
+                IndexCollection&& inputIds,
+                IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    static constexpr size_t workspace_size = 4 * 1024 * 1024;
+
+private:
+    CUDA::CuBlasLtMatmulDescriptor createDescriptor(const void* weights_scale, const void* activations_scale) const;
+
+    cudaDataType_t data_type_ = cudaDataType_t::CUDA_R_32F;
+    size_t rows_ = 0;
+    size_t k_ = 0;
+    size_t n_ = 0;
+    bool has_bias_ = false;
+    std::optional<CUDA::CuBlasLtMatrixLayout> weights_layout_;
+    std::optional<CUDA::CuBlasLtMatrixLayout> activations_layout_;
+    std::optional<CUDA::CuBlasLtMatrixLayout> output_layout_;
+    cublasLtMatmulAlgo_t algo_{};
+    std::optional<kernel::Fp8MatMul> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
+
+#endif  // CUDART_VERSION >= 11080
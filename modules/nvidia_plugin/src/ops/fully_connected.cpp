@@ -46,6 +46,10 @@ void FullyConnectedOp::Execute(const InferenceRequestContext& context,
     OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
     auto& stream = context.getThreadContext().stream();
 
+    if (matmul_op_.HasBiasEpilogue()) {
+        matmul_op_.Execute(context, inputs, outputs, workbuffers);
+        return;
+    }
     auto bias = inputs[2];
     auto matrixC = outputs[0];
     for (size_t i = 0; i < batch_bias_count_; ++i) {
@@ -56,6 +60,8 @@ void FullyConnectedOp::Execute(const InferenceRequestContext& context,
 
 bool FullyConnectedOp::IsCudaGraphCompatible() const { return true; }
 
+WorkbufferRequest FullyConnectedOp::GetWorkBufferRequest() const { return matmul_op_.GetWorkBufferRequest(); }
+
 OPERATION_REGISTER(FullyConnectedOp, FullyConnected);
 }  // namespace nvidia_gpu
 }  // namespace ov
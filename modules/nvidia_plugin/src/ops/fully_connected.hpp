@@ -27,6 +27,7 @@ public:
                  const Workbuffers& workbuffers) const override;
 
     bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
 
 private:
     MatMulOp matmul_op_;
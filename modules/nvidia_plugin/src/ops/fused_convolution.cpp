@@ -8,9 +8,12 @@
 #include <exception>
 #include <openvino/core/except.hpp>
 #include <memory>
+#include <optional>
 
 #include "convolution_components/convolution_cudnn_components.hpp"
+#include "cuda_implementation_selection.hpp"
 #include "cuda_operation_registry.hpp"
+#include "depthwise_convolution.hpp"
 #include "fused_convolution_cudnn.hpp"
 #include "fused_convolution_cudnn_decomposed.hpp"
 #include "transformer/nodes/activation_type.hpp"
@@ -35,7 +38,6 @@ OperationBase::Ptr fusedConvolutionFactory(const CreationContext& context,
     const bool includesSecondAddition = node->inputs().size() == 4;
     OPENVINO_ASSERT(includesOnlyBiasAdd || includesSecondAddition);  // Conv input, filters, Bias and optional Add
 
-    std::stringstream exception_msg;
     const auto fused_conv = std::dynamic_pointer_cast<nodes::FusedConvolution>(node);
     const auto fused_group_conv = std::dynamic_pointer_cast<nodes::FusedGroupConvolution>(node);
     OPENVINO_ASSERT(fused_conv || fused_group_conv);
@@ -43,75 +45,91 @@ OperationBase::Ptr fusedConvolutionFactory(const CreationContext& context,
     const auto params = fused_conv ? Convolution::Details::FusedConvolutionParams{*fused_conv}
                                    : Convolution::Details::FusedConvolutionParams{*fused_group_conv};
 
+    std::vector<ImplementationCandidate> candidates;
 #ifdef ENABLE_CUDNN_BACKEND_API
     const bool should_try_backend = node->get_type_name() == std::string("FusedConvolution");
     if (should_try_backend) {
-        try {
-            return std::make_shared<FusedConvolutionCuDnnBE>(
-                context, *node, IndexCollection{inputIds}, IndexCollection{outputIds}, params);
-        } catch (const std::exception& e) {
-            exception_msg << fmt::format(
-                "unsupported `{}` node: Failed to create "
-                "FusedConvolutionCuDnnBE impl: {}",
-                node->get_type_info().name,
-                e.what());
-        }
+        candidates.push_back({"FusedConvolutionCuDnnBE", [&] {
+                                  return std::make_shared<FusedConvolutionCuDnnBE>(
+                                      context, *node, IndexCollection{inputIds}, IndexCollection{outputIds}, params);
+                              }});
     }
 #endif  // ENABLE_CUDNN_BACKEND_API
 
-    const auto conv_descs{std::make_shared<Convolution::Details::ConvolutionDescriptorsCuDnn>(context, params.conv_,
-        std::vector<cudnnDataType_t>{CUDNN_DATA_HALF, CUDNN_DATA_FLOAT})}; // 119703: investigate whether we need HALF here
-    const auto bias_desc{Convolution::Details::MakeFusedAddDescriptor(params.bias_shape_, params.conv_.element_type_)};
-    const auto activation_desc{Convolution::Details::MakeFusedActivationDescriptor(params.activation_)};
-    const auto add_desc{params.add_shape_ ? Convolution::Details::MakeFusedAddDescriptor(params.add_shape_.value(),
-                                                                                         params.conv_.element_type_)
-                                          : nullptr};
+    if (fused_group_conv) {
+        candidates.push_back({"DepthwiseConvolution", [&] {
+                                  return std::make_shared<DepthwiseConvolutionOp>(context,
+                                                                                  *node,
+                                                                                  IndexCollection{inputIds},
+                                                                                  IndexCollection{outputIds},
+                                                                                  params.conv_,
+                                                                                  params.activation_);
+                              }});
+    }
+
+    // Descriptors are shared by cuDNN implementations and are created only if one of them is tried
+    struct Descriptors {
+        std::shared_ptr<Convolution::Details::ConvolutionDescriptorsCuDnn> conv;
+        std::shared_ptr<CUDA::DnnTensorDescriptor> bias;
+        std::shared_ptr<CUDA::DnnActivationDescriptor> activation;
+        std::shared_ptr<CUDA::DnnTensorDescriptor> add;
+    };
+    std::optional<Descriptors> descriptors;
+    const auto format = params.conv_.nhwc_layout_ ? CUDNN_TENSOR_NHWC : CUDNN_TENSOR_NCHW;
+    auto get_descriptors = [&]() -> const Descriptors& {
+        if (!descriptors) {
+            descriptors = Descriptors{
+                std::make_shared<Convolution::Details::ConvolutionDescriptorsCuDnn>(
+                    context,
+                    params.conv_,
+                    std::vector<cudnnDataType_t>{CUDNN_DATA_HALF,
+                                                 CUDNN_DATA_FLOAT}),  // 119703: investigate whether we need HALF here
+                Convolution::Details::MakeFusedAddDescriptor(params.bias_shape_, params.conv_.element_type_, format),
+                Convolution::Details::MakeFusedActivationDescriptor(params.activation_),
+                params.add_shape_ ? Convolution::Details::MakeFusedAddDescriptor(
+                                        params.add_shape_.value(), params.conv_.element_type_, format)
+                                  : nullptr};
+        }
+        return *descriptors;
+    };
 
     // cudnnConvolutionBiasActivationForward() doesn't work properly with CUDNN_ACTIVATION_IDENTITY and any algorithm
     // other than CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM, so we should decompose the convolution node and call
     // separate cuDNN functions.
     // For more information see:
     // https://docs.nvidia.com/deeplearning/cudnn/api/index.html#cudnnConvolutionBiasActivationForward
-    const bool should_decompose = params.activation_ == ov::nvidia_gpu::nodes::ActivationMode::NO_ACTIVATION &&
-                                  conv_descs->Algo().algo != CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM;
-
-    if (should_decompose) {
-        try {
-            return std::make_shared<FusedConvolutionCuDnnDecomposed>(context,
-                                                                     *node,
-                                                                     IndexCollection{inputIds},
-                                                                     IndexCollection{outputIds},
-                                                                     conv_descs,
-                                                                     bias_desc,
-                                                                     add_desc,
-                                                                     activation_desc);
-        } catch (const std::exception& e) {
-            throw_ov_exception(
-                fmt::format("unsupported `{}` node: Failed to create "
-                            "FusedConvolutionCuDnnDecomposed impl: {}",
-                            node->get_type_info().name,
-                            e.what()));
-        }
-    }
-
-    try {
-        return std::make_shared<FusedConvolutionCuDnn>(context,
-                                                       *node,
-                                                       IndexCollection{inputIds},
-                                                       IndexCollection{outputIds},
-                                                       conv_descs,
-                                                       bias_desc,
-                                                       add_desc,
-                                                       activation_desc);
-    } catch (const std::exception& e) {
-        exception_msg << fmt::format(
-            "unsupported `{}` node: Failed to create "
-            "FusedConvolutionCuDnn impl: {}",
-            node->get_type_info().name,
-            e.what());
-    }
+    candidates.push_back({"FusedConvolutionCuDnn", [&]() -> OperationBase::Ptr {
+                              const auto& descs = get_descriptors();
+                              const bool should_decompose =
+                                  params.activation_ == ov::nvidia_gpu::nodes::ActivationMode::NO_ACTIVATION &&
+                                  descs.conv->Algo().algo != CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM;
+                              if (should_decompose) {
+                                  throw_ov_exception(
+                                      "cudnnConvolutionBiasActivationForward() without activation requires "
+                                      "CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM algorithm");
+                              }
+                              return std::make_shared<FusedConvolutionCuDnn>(context,
+                                                                             *node,
+                                                                             IndexCollection{inputIds},
+                                                                             IndexCollection{outputIds},
+                                                                             descs.conv,
+                                                                             descs.bias,
+                                                                             descs.add,
+                                                                             descs.activation);
+                          }});
+    candidates.push_back({"FusedConvolutionCuDnnDecomposed", [&] {
+                              const auto& descs = get_descriptors();
+                              return std::make_shared<FusedConvolutionCuDnnDecomposed>(context,
+                                                                                       *node,
+                                                                                       IndexCollection{inputIds},
+                                                                                       IndexCollection{outputIds},
+                                                                                       descs.conv,
+                                                                                       descs.bias,
+                                                                                       descs.add,
+                                                                                       descs.activation);
+                          }});
 
-    throw_ov_exception(fmt::format("Convolution node is not supported:\n{}", exception_msg.str()));
+    return createFastestImplementation(context, *node, params.TuningKey(), candidates);
 }
 
 OPERATION_REGISTER_FACTORY(fusedConvolutionFactory, FusedConvolution);
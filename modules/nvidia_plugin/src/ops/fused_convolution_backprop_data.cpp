@@ -41,6 +41,10 @@ FusedConvolutionBackpropDataOp::FusedConvolutionBackpropDataOp(const CreationCon
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(addConstant->get_data_ptr());
     add_constant_ = gsl::make_span(ptr, GetBufferSize(addNode.get_node()->output(0)));
     OPENVINO_ASSERT(add_constant_.size_bytes() == add_in_bytes_, "Node name: ", GetName());
+
+    if (node.get_activation() != nodes::ActivationMode::NO_ACTIVATION) {
+        activation_desc_ = Convolution::Details::MakeFusedActivationDescriptor(node.get_activation());
+    }
 }
 
 void FusedConvolutionBackpropDataOp::Execute(const InferenceRequestContext& context,
@@ -75,6 +79,15 @@ void FusedConvolutionBackpropDataOp::Execute(const InferenceRequestContext& cont
                                                 &CUDA::NumericConst<CUDA::constants::one>(conv_descs_.ElementType()),
                                                 conv_descs_.dInput().get(),
                                                 outputs[ArgIndices3Ins::dinput].get()));
+    if (activation_desc_) {
+        dnnHandle.activationForward(*activation_desc_,
+                                    &CUDA::NumericConst<CUDA::constants::one>(conv_descs_.ElementType()),
+                                    conv_descs_.dInput(),
+                                    outputs[ArgIndices3Ins::dinput].get(),
+                                    &CUDA::NumericConst<CUDA::constants::zero>(conv_descs_.ElementType()),
+                                    conv_descs_.dInput(),
+                                    outputs[ArgIndices3Ins::dinput].get());
+    }
 }
 
 bool FusedConvolutionBackpropDataOp::IsCudaGraphCompatible() const { return true; }
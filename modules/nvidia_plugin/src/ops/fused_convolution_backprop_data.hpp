@@ -36,6 +36,7 @@ private:
 private:
     const Convolution::Details::FusedConvolutionBackwardDataParams params_;
     Convolution::Details::ConvolutionBackpropDataDescriptorCuDnn conv_descs_;
+    std::shared_ptr<CUDA::DnnActivationDescriptor> activation_desc_;
     std::shared_ptr<ov::Node> add_node_;
     gsl::span<const uint8_t, gsl::dynamic_extent> add_constant_;
     size_t conv_in_bytes_;
@@ -24,9 +24,10 @@ FusedConvolutionCuDnn::FusedConvolutionCuDnn(const CreationContext& context,
     : OperationCuDnn{context, node, std::move(inputIds), std::move(outputIds)},
       conv_descs_{std::make_shared<Convolution::Details::ConvolutionDescriptorsCuDnn>(context, params.conv_,
         std::vector<cudnnDataType_t>{CUDNN_DATA_HALF, CUDNN_DATA_FLOAT})}, // 119703: investigate whether we need HALF here
-      bias_desc_{Convolution::Details::MakeFusedAddDescriptor(params.bias_shape_, params.conv_.element_type_)},
-      add_desc_{params.add_shape_ ? Convolution::Details::MakeFusedAddDescriptor(params.add_shape_.value(),
-                                                                                 params.conv_.element_type_)
+      bias_desc_{Convolution::Details::MakeFusedAddDescriptor(
+          params.bias_shape_, params.conv_.element_type_, conv_descs_->Format())},
+      add_desc_{params.add_shape_ ? Convolution::Details::MakeFusedAddDescriptor(
+                                        params.add_shape_.value(), params.conv_.element_type_, conv_descs_->Format())
                                   : nullptr},
       activation_desc_{Convolution::Details::MakeFusedActivationDescriptor(params.activation_)} {
     ThrowIfShouldDecompose();
@@ -75,6 +75,7 @@ FusedConvolutionCuDnnBE::FusedConvolutionCuDnnBE(const CreationContext& context,
     };
 
     std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>> plans;
+    std::shared_ptr<CUDA::DnnBEOperationGraphDescriptor> graph;
     auto dnnHandle = std::make_shared<CUDA::DnnHandle>();
     auto addPlans = [&](const cudnnTensorFormat_t& format, cudnnDataType_t dataType) {
         auto conv_tensor_desc = MakeTensorDescriptor(DnnTensorID::input,
@@ -215,23 +216,43 @@ FusedConvolutionCuDnnBE::FusedConvolutionCuDnnBE(const CreationContext& context,
         CUDA::DnnBEOperationGraphDescriptorBuilder graphBuilder;
         graphBuilder.setDnnHandle(dnnHandle);
         graphBuilder.setOperations(ops);
-        auto graph = graphBuilder.build();
+        graph = graphBuilder.build();
 
         auto new_plans = CUDA::getAllExecutionPlansFromHeuristics(graph, *dnnHandle);
         plans.insert(plans.end(), new_plans.begin(), new_plans.end());
     };
 
-    addPlans(cudnnTensorFormat_t::CUDNN_TENSOR_NCHW, tensor_element_type);
-    // TODO: Add other modes for testing purposes
-    // addPlans(cudnnTensorFormat_t::CUDNN_TENSOR_NHWC, tensor_element_type);
+    // Tensors are in the layout assigned to the node by NhwcLayoutPropagation
+    const auto format =
+        params.conv_.nhwc_layout_ ? cudnnTensorFormat_t::CUDNN_TENSOR_NHWC : cudnnTensorFormat_t::CUDNN_TENSOR_NCHW;
+    addPlans(format, tensor_element_type);
 
+    plans = CUDA::filterPlansByWorkspaceSize(plans, context.maxWorkspaceSize());
     if (plans.empty()) {
         throw_ov_exception("No available plans for backend version of fused convolution !!");
     }
 
-    std::shared_ptr<CUDA::DnnBEExecutionPlan> plan;
-    if (context.opBenchOption()) {
-        plan = performBenchmarks(context.dnnHandle(), plans);
+    const auto& tuningCache = context.tuningCache();
+    const auto tuningKey = tuningCache ? "cudnn_be_fused_conv:" + params_.TuningKey() : std::string{};
+    const auto cachedPlan = tuningCache ? tuningCache->find(tuningKey) : std::nullopt;
+    std::shared_ptr<CUDA::DnnBEExecutionPlan> plan = CUDA::findCachedPlan(plans, cachedPlan);
+    if (!plan) {
+        plan = CUDA::findTunedPlan(graph, *dnnHandle, cachedPlan);
+    }
+    if (plan) {
+        // The plan has been benchmarked by one of previous compilations
+    } else if (context.opBenchOption()) {
+        // Plans of heuristics compete with plans of all engines with other values of their knobs
+        const auto tunedPlans = CUDA::getTunedExecutionPlans(graph, *dnnHandle, context.maxWorkspaceSize());
+        auto candidates = plans;
+        for (const auto& tunedPlan : tunedPlans) {
+            candidates.push_back(tunedPlan.plan);
+        }
+        const auto lock = context.lockBenchmarks();
+        plan = performBenchmarks(context.dnnHandle(), candidates);
+        if (tuningCache) {
+            tuningCache->store(tuningKey, CUDA::formatCachedPlan(plans, tunedPlans, plan));
+        }
     } else {
         plan = std::move(plans[0]);
     }
@@ -291,7 +312,7 @@ void FusedConvolutionCuDnnBE::Execute(const InferenceRequestContext& context,
     OPENVINO_ASSERT(inputs.size() == 3 || inputs.size() == 4, "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
 
-    auto dnnHandle = context.getThreadContext().dnnHandle();
+    const auto& dnnHandle = context.getThreadContext().dnnHandle();
     auto workbuffer = workbuffers.mutable_buffers.empty() ? nullptr : workbuffers.mutable_buffers[0].get();
     std::array<const void*, 5> dataPtrs;
     if (params_.add_shape_) {
@@ -319,15 +340,11 @@ void FusedConvolutionCuDnnBE::Execute(const InferenceRequestContext& context,
     variantPackBuilder.setWorkspase(workbuffer);
     const auto variantPack = variantPackBuilder.build();
 
-    const auto plan = CUDA::DnnBEExecutionPlanBuilder()
-                          .setDnnHandle(context.getThreadContext().dnnHandle())
-                          .setEngineConfig(engine_config_)
-                          .build();
-
-    throwIfError(::cudnnBackendExecute(context.getThreadContext().dnnHandle().get(), plan->get(), variantPack->get()));
+    const auto& plan = plans_.get(dnnHandle, engine_config_);
+    throwIfError(::cudnnBackendExecute(dnnHandle.get(), plan.get(), variantPack->get()));
 }
 
-bool FusedConvolutionCuDnnBE::IsCudaGraphCompatible() const { return false; }
+bool FusedConvolutionCuDnnBE::IsCudaGraphCompatible() const { return true; }
 
 std::shared_ptr<CUDA::DnnBETensorDescriptor> FusedConvolutionCuDnnBE::MakeTensorDescriptor(
     int64_t id,
@@ -9,6 +9,7 @@
 
 #include "convolution_components/convolution_components.hpp"
 #include "cuda/dnn_be.hpp"
+#include "cuda/dnn_be_algo.hpp"
 #include "cuda_operation_base.hpp"
 #include "ops/convolution_components/convolution_cudnn_components.hpp"
 
@@ -48,6 +49,7 @@ private:
 
     std::shared_ptr<CUDA::DnnBEEngineConfigDescriptor> engine_config_;
     int64_t workspace_size_ = 0;
+    CUDA::DnnBEExecutionPlanCache plans_;
     const Convolution::Details::FusedConvolutionParams params_;
 };
 
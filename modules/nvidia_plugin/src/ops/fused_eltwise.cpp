@@ -0,0 +1,408 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_eltwise.hpp"
+
+#include <fmt/format.h>
+
+#include <cmath>
+#include <cuda_operation_registry.hpp>
+#include <functional>
+#include <kernels/details/tensor_helpers.hpp>
+#include <openvino/core/except.hpp>
+#include <sstream>
+#include <transformer/nodes/concat_optimized.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "openvino/op/abs.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/equal.hpp"
+#include "openvino/op/erf.hpp"
+#include "openvino/op/exp.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/greater.hpp"
+#include "openvino/op/greater_eq.hpp"
+#include "openvino/op/hsigmoid.hpp"
+#include "openvino/op/hswish.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/less_eq.hpp"
+#include "openvino/op/logical_and.hpp"
+#include "openvino/op/logical_not.hpp"
+#include "openvino/op/logical_or.hpp"
+#include "openvino/op/logical_xor.hpp"
+#include "openvino/op/maximum.hpp"
+#include "openvino/op/minimum.hpp"
+#include "openvino/op/mish.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/negative.hpp"
+#include "openvino/op/not_equal.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/power.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/op/softplus.hpp"
+#include "openvino/op/sqrt.hpp"
+#include "openvino/op/squared_difference.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/tanh.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+// Kernel doesn't include any headers, so that NVRTC doesn't need the CUDA toolkit, halves are converted by PTX
+constexpr const char* kPreamble =
+    "__device__ __forceinline__ float h2f(unsigned short h) {\n"
+    "    float f;\n"
+    "    asm(\"cvt.f32.f16 %0, %1;\" : \"=f\"(f) : \"h\"(h));\n"
+    "    return f;\n"
+    "}\n"
+    "__device__ __forceinline__ unsigned short f2h(float f) {\n"
+    "    unsigned short h;\n"
+    "    asm(\"cvt.rn.f16.f32 %0, %1;\" : \"=h\"(h) : \"f\"(f));\n"
+    "    return h;\n"
+    "}\n";
+
+std::string storageType(const ov::element::Type& type) {
+    if (type == ov::element::f32) {
+        return "float";
+    } else if (type == ov::element::f16) {
+        return "unsigned short";
+    } else if (type == ov::element::boolean) {
+        return "unsigned char";
+    } else if (type == ov::element::u1) {
+        // Packed masks are accessed by 32-bit words
+        return "unsigned int";
+    }
+    throw_ov_exception(fmt::format("Unsupported element type {}", type.get_type_name()));
+}
+
+/**
+ * @returns FP32 value of the element of the input at the offset, boolean values are 0 or 1
+ */
+std::string load(const ov::element::Type& type, const std::string& input, const std::string& offset) {
+    if (type == ov::element::f16) {
+        return fmt::format("h2f({}[{}])", input, offset);
+    } else if (type == ov::element::boolean) {
+        return fmt::format("({}[{}] != 0 ? 1.0f : 0.0f)", input, offset);
+    } else if (type == ov::element::u1) {
+        return fmt::format("(float)(({0}[({1}) >> 5] >> (({1}) & 31ull)) & 1u)", input, offset);
+    }
+    return fmt::format("{}[{}]", input, offset);
+}
+
+std::string boolean(const std::string& condition) { return fmt::format("(({}) ? 1.0f : 0.0f)", condition); }
+
+std::string literal(float value) {
+    if (std::isnan(value)) {
+        return "(0.0f / 0.0f)";
+    }
+    if (std::isinf(value)) {
+        return value > 0 ? "(1.0f / 0.0f)" : "(-1.0f / 0.0f)";
+    }
+    return fmt::format("({:.9e}f)", value);
+}
+
+/**
+ * @returns Offset of the element of the input broadcasted to the output element with coordinates c0, c1, ...
+ */
+std::string offset(const ov::Shape& shape, const ov::Shape& outputShape) {
+    if (shape == outputShape) {
+        return "idx";
+    }
+    if (ov::shape_size(shape) == 1) {
+        return "0";
+    }
+    std::string offset;
+    size_t stride = 1;
+    const size_t rankDiff = outputShape.size() - shape.size();
+    for (size_t i = shape.size(); i-- > 0;) {
+        if (shape[i] != 1) {
+            offset += fmt::format("{}c{} * {}ull", offset.empty() ? "" : " + ", i + rankDiff, stride);
+        }
+        stride *= shape[i];
+    }
+    return offset;
+}
+
+std::string expression(const ov::Node& node, const std::vector<std::string>& args) {
+    const auto& a = args.at(0);
+    if (ov::is_type<ov::op::v1::Add>(&node)) {
+        return fmt::format("{} + {}", a, args.at(1));
+    } else if (ov::is_type<ov::op::v1::Subtract>(&node)) {
+        return fmt::format("{} - {}", a, args.at(1));
+    } else if (ov::is_type<ov::op::v1::Multiply>(&node)) {
+        return fmt::format("{} * {}", a, args.at(1));
+    } else if (ov::is_type<ov::op::v1::Divide>(&node)) {
+        return fmt::format("{} / {}", a, args.at(1));
+    } else if (ov::is_type<ov::op::v1::Maximum>(&node)) {
+        return fmt::format("fmaxf({}, {})", a, args.at(1));
+    } else if (ov::is_type<ov::op::v1::Minimum>(&node)) {
+        return fmt::format("fminf({}, {})", a, args.at(1));
+    } else if (ov::is_type<ov::op::v1::Power>(&node)) {
+        return fmt::format("powf({}, {})", a, args.at(1));
+    } else if (ov::is_type<ov::op::v0::SquaredDifference>(&node)) {
+        return fmt::format("({0} - {1}) * ({0} - {1})", a, args.at(1));
+    } else if (ov::is_type<ov::op::v0::Relu>(&node)) {
+        return fmt::format("fmaxf({}, 0.0f)", a);
+    } else if (ov::is_type<ov::op::v0::Sigmoid>(&node)) {
+        return fmt::format("1.0f / (1.0f + expf(-{}))", a);
+    } else if (ov::is_type<ov::op::v0::Tanh>(&node)) {
+        return fmt::format("tanhf({})", a);
+    } else if (ov::is_type<ov::op::v0::Exp>(&node)) {
+        return fmt::format("expf({})", a);
+    } else if (ov::is_type<ov::op::v0::Abs>(&node)) {
+        return fmt::format("fabsf({})", a);
+    } else if (ov::is_type<ov::op::v0::Sqrt>(&node)) {
+        return fmt::format("sqrtf({})", a);
+    } else if (ov::is_type<ov::op::v0::Negative>(&node)) {
+        return fmt::format("-{}", a);
+    } else if (ov::is_type<ov::op::v0::Erf>(&node)) {
+        return fmt::format("erff({})", a);
+    } else if (const auto clamp = ov::as_type<const ov::op::v0::Clamp>(&node)) {
+        return fmt::format("fminf(fmaxf({}, {}), {})",
+                           a,
+                           literal(static_cast<float>(clamp->get_min())),
+                           literal(static_cast<float>(clamp->get_max())));
+    } else if (ov::is_type<ov::op::v1::Equal>(&node)) {
+        return boolean(fmt::format("{} == {}", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::NotEqual>(&node)) {
+        return boolean(fmt::format("{} != {}", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::Less>(&node)) {
+        return boolean(fmt::format("{} < {}", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::LessEqual>(&node)) {
+        return boolean(fmt::format("{} <= {}", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::Greater>(&node)) {
+        return boolean(fmt::format("{} > {}", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::GreaterEqual>(&node)) {
+        return boolean(fmt::format("{} >= {}", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::LogicalAnd>(&node)) {
+        return boolean(fmt::format("{} != 0.0f && {} != 0.0f", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::LogicalOr>(&node)) {
+        return boolean(fmt::format("{} != 0.0f || {} != 0.0f", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::LogicalXor>(&node)) {
+        return boolean(fmt::format("({} != 0.0f) != ({} != 0.0f)", a, args.at(1)));
+    } else if (ov::is_type<ov::op::v1::LogicalNot>(&node)) {
+        return boolean(fmt::format("{} == 0.0f", a));
+    } else if (ov::is_type<ov::op::v1::Select>(&node)) {
+        return fmt::format("({} != 0.0f ? {} : {})", a, args.at(1), args.at(2));
+    } else if (const auto convert = ov::as_type<const ov::op::v0::Convert>(&node)) {
+        // Values are kept in FP32, so that only conversion to FP16 rounds them
+        const auto& type = convert->get_destination_type();
+        if (type == ov::element::boolean) {
+            return boolean(fmt::format("{} != 0.0f", a));
+        }
+        return type == ov::element::f16 ? fmt::format("h2f(f2h({}))", a) : a;
+    } else if (ov::is_type<ov::op::v4::HSwish>(&node)) {
+        return fmt::format("{0} * fminf(fmaxf({0} + 3.0f, 0.0f), 6.0f) / 6.0f", a);
+    } else if (ov::is_type<ov::op::v5::HSigmoid>(&node)) {
+        return fmt::format("fminf(fmaxf({} + 3.0f, 0.0f), 6.0f) / 6.0f", a);
+    } else if (ov::is_type<ov::op::v4::SoftPlus>(&node)) {
+        // log(1 + exp(x)) equals x in FP32 above the threshold, while exp(x) overflows for large x
+        return fmt::format("({0} > 20.0f ? {0} : log1pf(expf({0})))", a);
+    } else if (ov::is_type<ov::op::v4::Mish>(&node)) {
+        return fmt::format("{0} * tanhf({0} > 20.0f ? {0} : log1pf(expf({0})))", a);
+    } else if (ov::is_type<ov::op::v4::Swish>(&node)) {
+        return fmt::format("{0} / (1.0f + expf(-{1} * {0}))", a, args.size() > 1 ? args[1] : "1.0f");
+    } else if (const auto gelu = ov::as_type<const ov::op::v7::Gelu>(&node);
+               gelu && gelu->get_approximation_mode() == ov::op::GeluApproximationMode::TANH) {
+        return fmt::format("0.5f * {0} * (1.0f + tanhf(0.7978845608f * ({0} + 0.044715f * {0} * {0} * {0})))", a);
+    } else if (ov::is_type<ov::op::v0::Gelu>(&node) || ov::is_type<ov::op::v7::Gelu>(&node)) {
+        return fmt::format("0.5f * {0} * (1.0f + erff({0} * 0.7071067812f))", a);
+    }
+    throw_ov_exception(fmt::format("FusedEltwise doesn't support {} node", node.get_type_info().name));
+}
+
+std::string escape(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const auto c : text) {
+        if (c == '\\') {
+            escaped += "\\\\";
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string unescape(const std::string& text) {
+    std::string unescaped;
+    unescaped.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '\\' && i + 1 < text.size()) {
+            unescaped += text[++i] == 'n' ? '\n' : text[i];
+        } else {
+            unescaped += text[i];
+        }
+    }
+    return unescaped;
+}
+
+}  // namespace
+
+FusedEltwiseOp::FusedEltwiseOp(const CreationContext& context,
+                               const NodeOp& node,
+                               IndexCollection&& inputIds,
+                               IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto size = ov::shape_size(node.get_output_shape(0));
+    OPENVINO_ASSERT(size != 0, "Node name: ", GetName());
+    num_inputs_ = node.get_input_size();
+
+    const auto source = GenerateSource(node);
+    // Keys of the same model are equal in all processes, since they are computed from the generated source
+    const auto cacheKey = fmt::format("fused_eltwise:{:016x}", std::hash<std::string>{}(source));
+    const auto& cache = context.tuningCache();
+    if (const auto cached = cache ? cache->find(cacheKey) : std::nullopt) {
+        try {
+            module_.emplace(unescape(*cached));
+        } catch (const std::exception&) {
+            // PTX of another driver may fail to load, so that it is compiled again
+        }
+    }
+    if (!module_) {
+        const auto ptx = CUDA::compileToPtx(source, GetName(), context.device());
+        module_.emplace(ptx);
+        if (cache) {
+            cache->store(cacheKey, escape(ptx));
+        }
+    }
+    function_ = module_->function(kernel_name);
+
+    const auto max_threads_per_block = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    std::tie(num_blocks_, threads_per_block_) = kernel::calculateElementwiseGrid(size, max_threads_per_block);
+    if (node.is_packed_output()) {
+        constexpr unsigned warp_size = 32;
+        threads_per_block_ = (threads_per_block_ + warp_size - 1) / warp_size * warp_size;
+    }
+}
+
+std::string FusedEltwiseOp::GenerateSource(const NodeOp& node) {
+    const auto& body = node.get_body();
+    const auto& outputShape = node.get_output_shape(0);
+    std::ostringstream source;
+    source << kPreamble << "extern \"C\" __global__ void " << kernel_name << "(";
+    for (size_t i = 0; i < node.get_input_size(); ++i) {
+        source << "const " << storageType(node.get_input_element_type(i)) << "* __restrict__ in" << i << ", ";
+    }
+    source << storageType(node.get_output_element_type(0)) << "* __restrict__ out) {\n";
+    const auto size = ov::shape_size(outputShape);
+    if (node.is_packed_output()) {
+        // Threads past the end take part in the ballot of their warp, they compute the last element meanwhile
+        source << "    const unsigned long long gidx = (unsigned long long)blockIdx.x * blockDim.x + threadIdx.x;\n";
+        source << "    const unsigned long long idx = gidx < " << size << "ull ? gidx : " << size - 1 << "ull;\n";
+    } else {
+        source << "    const unsigned long long idx = (unsigned long long)blockIdx.x * blockDim.x + threadIdx.x;\n";
+        source << "    if (idx >= " << size << "ull) return;\n";
+    }
+
+    // Coordinates of the output element are computed only if some inputs are broadcasted
+    bool broadcasted = false;
+    for (size_t i = 0; i < node.get_input_size(); ++i) {
+        const auto& shape = node.get_input_shape(i);
+        broadcasted |= shape != outputShape && ov::shape_size(shape) != 1;
+    }
+    if (broadcasted) {
+        source << "    unsigned long long rest = idx;\n";
+        for (size_t i = outputShape.size(); i-- > 0;) {
+            source << "    const unsigned long long c" << i << " = rest % " << outputShape[i] << "ull;\n";
+            source << "    rest /= " << outputShape[i] << "ull;\n";
+        }
+    }
+
+    std::unordered_map<const ov::Node*, std::string> values;
+    const auto& parameters = body->get_parameters();
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        source << "    const float x" << i << " = "
+               << load(node.get_input_element_type(i),
+                       fmt::format("in{}", i),
+                       offset(node.get_input_shape(i), outputShape))
+               << ";\n";
+        values[parameters[i].get()] = fmt::format("x{}", i);
+    }
+    size_t numValues = 0;
+    std::string result;
+    for (const auto& op : body->get_ordered_ops()) {
+        if (ov::is_type<ov::op::v0::Parameter>(op)) {
+            continue;
+        }
+        if (ov::is_type<ov::op::v0::Result>(op)) {
+            result = values.at(op->get_input_node_ptr(0));
+            continue;
+        }
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            OPENVINO_ASSERT(ov::shape_size(constant->get_shape()) == 1, "Only scalar constants are inlined");
+            values[op.get()] = literal(constant->cast_vector<float>().front());
+            continue;
+        }
+        std::vector<std::string> args;
+        for (const auto& input : op->input_values()) {
+            args.push_back(values.at(input.get_node()));
+        }
+        const auto name = fmt::format("v{}", numValues++);
+        source << "    const float " << name << " = " << expression(*op, args) << ";\n";
+        values[op.get()] = name;
+    }
+    if (node.is_packed_output()) {
+        // Warps write words of 32 consecutive elements, since blocks are multiples of warps
+        source << "    const unsigned int bits = __ballot_sync(0xffffffffu, gidx < " << size << "ull && " << result
+               << " != 0.0f);\n";
+        source << "    if ((threadIdx.x & 31u) == 0u && gidx < " << size << "ull) out[gidx >> 5] = bits;\n}\n";
+        return source.str();
+    }
+    // Output may be a strided slice of ConcatOptimized
+    std::string outputOffset = "idx";
+    if (const auto slice = nodes::ConcatOptimized::get_strided_slice(node.output(0))) {
+        outputOffset = fmt::format("idx / {0}ull * {1}ull + idx % {0}ull", slice->block_size, slice->stride);
+    }
+    std::string stored = result;
+    if (node.get_output_element_type(0) == ov::element::f16) {
+        stored = fmt::format("f2h({})", result);
+    } else if (node.get_output_element_type(0) == ov::element::boolean) {
+        stored = fmt::format("(unsigned char)({} != 0.0f)", result);
+    }
+    source << "    out[" << outputOffset << "] = " << stored << ";\n}\n";
+    return source.str();
+}
+
+void FusedEltwiseOp::Execute(const InferenceRequestContext& context,
+                             Inputs inputs,
+                             Outputs outputs,
+                             const Workbuffers&) const {
+    OPENVINO_ASSERT(inputs.size() == num_inputs_, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    std::vector<const void*> pointers;
+    pointers.reserve(inputs.size() + 1);
+    for (const auto& input : inputs) {
+        pointers.push_back(input.get());
+    }
+    pointers.push_back(outputs[0].get());
+    std::vector<void*> args;
+    args.reserve(pointers.size());
+    for (auto& pointer : pointers) {
+        args.push_back(&pointer);
+    }
+    CUDA::launchKernel(
+        function_, num_blocks_, threads_per_block_, context.getThreadContext().stream(), args.data());
+}
+
+bool FusedEltwiseOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(FusedEltwiseOp, FusedEltwise);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,52 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/nvrtc.hpp>
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <string>
+#include <transformer/nodes/fused_eltwise.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Executes a chain of element-wise operations by a kernel, which is generated for the body of the node and is
+ * compiled by NVRTC. Each input is read and the output is written once, intermediate values are kept in
+ * registers in FP32. PTX of the kernel is kept in CreationContext::tuningCache, so that it is exported with
+ * the model and is reused from ov::cache_dir without compilation
+ */
+class FusedEltwiseOp : public OperationBase {
+public:
+    using NodeOp = nodes::FusedEltwise;
+    FusedEltwiseOp(const CreationContext& context,
+                   const NodeOp& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+    /**
+     * @returns CUDA source of the kernel, which computes the body of the node
+     */
+    static std::string GenerateSource(const NodeOp& node);
+
+    static constexpr const char* kernel_name = "fused_eltwise";
+
+private:
+    std::optional<CUDA::Module> module_;
+    CUfunction function_ = nullptr;
+    size_t num_inputs_ = 0;
+    unsigned num_blocks_ = 0;
+    unsigned threads_per_block_ = 0;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,102 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_multi_head_attention.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+/**
+ * @returns Strides of elements of the mask along batch, heads, queries and keys of the attention matrix
+ *          of the given shape, 0 along dimensions the mask is broadcasted
+ */
+std::array<size_t, 4> maskStrides(const ov::Shape& mask_shape, const ov::Shape& attention_shape) {
+    const auto rank = attention_shape.size();
+    OPENVINO_ASSERT(mask_shape.size() <= rank, "Mask of rank ", mask_shape.size(), " is not broadcastable");
+    ov::Shape shape(rank - mask_shape.size(), 1);
+    shape.insert(shape.end(), mask_shape.begin(), mask_shape.end());
+    std::vector<size_t> strides(rank, 0);
+    size_t stride = 1;
+    for (size_t i = rank; i-- > 0;) {
+        OPENVINO_ASSERT(shape[i] == 1 || shape[i] == attention_shape[i], "Mask of shape ", mask_shape,
+                        " is not broadcastable to ", attention_shape);
+        strides[i] = shape[i] == 1 ? 0 : stride;
+        stride *= shape[i];
+    }
+    // 3D attention has no heads dimension
+    return rank == 4 ? std::array<size_t, 4>{strides[0], strides[1], strides[2], strides[3]}
+                     : std::array<size_t, 4>{strides[0], 0, strides[1], strides[2]};
+}
+
+}  // namespace
+
+FusedMultiHeadAttentionOp::FusedMultiHeadAttentionOp(const CreationContext& context,
+                                                     const NodeOp& node,
+                                                     IndexCollection&& inputIds,
+                                                     IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3 || node.get_input_size() == 4, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto& q_shape = node.get_input_shape(0);
+    const auto& v_shape = node.get_input_shape(2);
+    const auto rank = q_shape.size();
+    OPENVINO_ASSERT(rank == 3 || rank == 4, "Node name: ", GetName());
+    const size_t batch = q_shape[0];
+    const size_t heads = rank == 4 ? q_shape[1] : 1;
+    const size_t q_length = q_shape[rank - 2];
+    const size_t head_size = q_shape[rank - 1];
+    const size_t kv_length = v_shape[rank - 2];
+    OPENVINO_ASSERT(v_shape[rank - 1] == head_size, "Node name: ", GetName());
+    for (size_t i = 0; i < rank - 2; ++i) {
+        OPENVINO_ASSERT(node.get_input_shape(1)[i] == q_shape[i] && v_shape[i] == q_shape[i],
+                        "Broadcasting of queries, keys and values is not supported, node name: ",
+                        GetName());
+    }
+    has_mask_ = node.has_mask();
+    std::array<size_t, 4> mask_strides{};
+    if (has_mask_) {
+        auto attention_shape = q_shape;
+        attention_shape[rank - 1] = kv_length;
+        mask_strides = maskStrides(node.get_input_shape(3), attention_shape);
+    }
+    kernel_ = kernel::FlashAttention{convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                                     batch,
+                                     heads,
+                                     q_length,
+                                     kv_length,
+                                     head_size,
+                                     node.get_transpose_k(),
+                                     node.get_scale(),
+                                     mask_strides};
+}
+
+void FusedMultiHeadAttentionOp::Execute(const InferenceRequestContext& context,
+                                        Inputs inputs,
+                                        Outputs outputs,
+                                        const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == (has_mask_ ? 4 : 3), "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    const void* mask = has_mask_ ? inputs[3].get() : nullptr;
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputs[0].get(),
+               inputs[1].get(),
+               inputs[2].get(),
+               mask,
+               outputs[0].get());
+}
+
+bool FusedMultiHeadAttentionOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(FusedMultiHeadAttentionOp, FusedMultiHeadAttention);
+}  // namespace nvidia_gpu
+}  // namespace ov
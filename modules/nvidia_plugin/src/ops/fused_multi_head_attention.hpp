@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/fused_multi_head_attention.hpp>
+
+#include "kernels/flash_attention.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Executes scaled dot product attention by the flash attention kernel, which takes memory linear in lengths
+ * of queries and keys instead of the attention matrix
+ */
+class FusedMultiHeadAttentionOp : public OperationBase {
+public:
+    using NodeOp = nodes::FusedMultiHeadAttention;
+    FusedMultiHeadAttentionOp(const CreationContext& context,
+                              const NodeOp& node,
+                              IndexCollection&& inputIds,
+                              IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    bool has_mask_ = false;
+    std::optional<kernel::FlashAttention> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -13,6 +13,7 @@
 #include <openvino/op/gather.hpp>
 
 #include "converters.hpp"
+#include "transformer/nodes/gather_convert.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -21,6 +22,7 @@ namespace {
 
 constexpr unsigned ELS_PER_THREAD_CHUNKS = 2;
 constexpr unsigned ELS_PER_THREAD_DICTS = 1;
+constexpr size_t MIN_ROW_LENGTH_OF_WARP = 64;
 
 }  // namespace
 
@@ -54,7 +56,11 @@ GatherOp::GatherOp(const CreationContext& context,
             throw_ov_exception(fmt::format("Params element type = {} is not supported by Gather operation!",
                                            static_cast<ov::element::Type_t>(element_type)));
     }
-    OPENVINO_ASSERT(node.get_output_element_type(0) == element_type, "Node name: ", GetName());
+    const ov::element::Type_t output_type = node.get_output_element_type(0);
+    // Output may be of another type for GatherConvert
+    OPENVINO_ASSERT(output_type == element_type || dynamic_cast<const nodes::GatherConvert*>(&node),
+                    "Node name: ",
+                    GetName());
 
     const auto& dict_shape = node.get_input_shape(0);
     const auto& dict_shape_size = dict_shape.size();
@@ -88,29 +94,22 @@ GatherOp::GatherOp(const CreationContext& context,
         OPENVINO_ASSERT(batch_check_ok, "Node name: ", GetName());
     }
 
-    const unsigned num_dicts =
-        std::accumulate(dict_shape.cbegin() + batch_dims, dict_shape.cbegin() + axis, 1, std::multiplies<unsigned>());
-    const unsigned index_range = dict_shape[axis];
-    const unsigned data_length =
-        std::accumulate(dict_shape.cbegin() + axis + 1, dict_shape.cend(), 1, std::multiplies<unsigned>());
+    const size_t num_dicts = std::accumulate(
+        dict_shape.cbegin() + batch_dims, dict_shape.cbegin() + axis, size_t{1}, std::multiplies<size_t>());
+    const size_t index_range = dict_shape[axis];
+    const size_t data_length =
+        std::accumulate(dict_shape.cbegin() + axis + 1, dict_shape.cend(), size_t{1}, std::multiplies<size_t>());
 
     if (data_length == 0) {
         throw_ov_exception("data_length == 0: incorrect input parameters dimension!");
     }
 
-    const unsigned indices_size =
-        std::accumulate(indices_shape.cbegin() + batch_dims, indices_shape.cend(), 1, std::multiplies<unsigned>());
-    const auto out_size =
-        std::accumulate(out_shape.cbegin() + batch_dims, out_shape.cend(), 1, std::multiplies<unsigned>());
-
-    const auto batch_count =
-        std::accumulate(dict_shape.cbegin(), dict_shape.cbegin() + batch_dims, 1, std::multiplies<unsigned>());
-    const unsigned dicts_batch_stride =
-        std::accumulate(dict_shape.cbegin() + batch_dims, dict_shape.cend(), 1, std::multiplies<unsigned>());
-    const unsigned indices_batch_stride =
-        std::accumulate(indices_shape.cbegin() + batch_dims, indices_shape.cend(), 1, std::multiplies<unsigned>());
-    const unsigned out_batch_stride =
-        std::accumulate(out_shape.cbegin() + batch_dims, out_shape.cend(), 1, std::multiplies<unsigned>());
+    const size_t indices_size = std::accumulate(
+        indices_shape.cbegin() + batch_dims, indices_shape.cend(), size_t{1}, std::multiplies<size_t>());
+    const size_t out_size =
+        std::accumulate(out_shape.cbegin() + batch_dims, out_shape.cend(), size_t{1}, std::multiplies<size_t>());
+    const size_t batch_count =
+        std::accumulate(dict_shape.cbegin(), dict_shape.cbegin() + batch_dims, size_t{1}, std::multiplies<size_t>());
 
     const auto max_indices_index = indices_size - 1;
     const auto max_dict_index = num_dicts - 1;
@@ -119,19 +118,41 @@ GatherOp::GatherOp(const CreationContext& context,
         data_length <= out_size - (data_length * (max_indices_index + max_dict_index * indices_size));
     OPENVINO_ASSERT(boundary_ok, "Node name: ", GetName());
 
-    const unsigned num_chunks = data_length % ELS_PER_THREAD_CHUNKS == 0 ? data_length / ELS_PER_THREAD_CHUNKS
-                                                                         : data_length / ELS_PER_THREAD_CHUNKS + 1;
-
     const auto& device_props = context.device().props();
     const auto max_block_size = device_props.maxThreadsPerBlock;
     const auto max_grid_size = device_props.maxGridSize;
 
+    // Wide rows (e.g. embeddings) are copied by warps with vectorized accesses, which also has no limits of the grid
+    const bool gather_rows = output_type == element_type && data_length >= MIN_ROW_LENGTH_OF_WARP;
+    if (gather_rows) {
+        gather_kernel_ = kernel::Gather{convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type),
+                                        convertDataType<ov::nvidia_gpu::kernel::Type_t>(output_type),
+                                        convertDataType<ov::nvidia_gpu::kernel::Type_t>(indices_type),
+                                        batch_count,
+                                        num_dicts,
+                                        index_range,
+                                        data_length,
+                                        indices_size,
+                                        false,
+                                        true,
+                                        0,
+                                        0,
+                                        0,
+                                        0,
+                                        ELS_PER_THREAD_CHUNKS,
+                                        ELS_PER_THREAD_DICTS};
+        return;
+    }
+
+    const size_t num_chunks = data_length % ELS_PER_THREAD_CHUNKS == 0 ? data_length / ELS_PER_THREAD_CHUNKS
+                                                                       : data_length / ELS_PER_THREAD_CHUNKS + 1;
+
     const bool gather_chunks = std::max(num_chunks, num_dicts) == num_chunks;
 
-    unsigned blocks_per_grid{};
-    unsigned threads_per_block{};
-    unsigned grid_dim_x{};
-    unsigned grid_dim_y{};
+    size_t blocks_per_grid{};
+    size_t threads_per_block{};
+    size_t grid_dim_x{};
+    size_t grid_dim_y{};
 
     if (gather_chunks) {
         blocks_per_grid =
@@ -146,24 +167,24 @@ GatherOp::GatherOp(const CreationContext& context,
         grid_dim_y = data_length;
     }
 
-    OPENVINO_ASSERT(grid_dim_x <= max_grid_size[0], "Node name: ", GetName());
-    OPENVINO_ASSERT(grid_dim_y <= max_grid_size[1], "Node name: ", GetName());
-    OPENVINO_ASSERT(blocks_per_grid <= max_grid_size[2], "Node name: ", GetName());
+    OPENVINO_ASSERT(grid_dim_x <= static_cast<size_t>(max_grid_size[0]), "Node name: ", GetName());
+    OPENVINO_ASSERT(grid_dim_y <= static_cast<size_t>(max_grid_size[1]), "Node name: ", GetName());
+    OPENVINO_ASSERT(blocks_per_grid <= static_cast<size_t>(max_grid_size[2]), "Node name: ", GetName());
 
     gather_kernel_ = kernel::Gather{convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type),
+                                    convertDataType<ov::nvidia_gpu::kernel::Type_t>(output_type),
                                     convertDataType<ov::nvidia_gpu::kernel::Type_t>(indices_type),
+                                    batch_count,
                                     num_dicts,
                                     index_range,
                                     data_length,
                                     indices_size,
                                     gather_chunks,
-                                    blocks_per_grid,
-                                    threads_per_block,
-                                    grid_dim_x,
-                                    grid_dim_y,
-                                    dicts_batch_stride,
-                                    indices_batch_stride,
-                                    out_batch_stride,
+                                    false,
+                                    static_cast<unsigned>(blocks_per_grid),
+                                    static_cast<unsigned>(threads_per_block),
+                                    static_cast<unsigned>(grid_dim_x),
+                                    static_cast<unsigned>(grid_dim_y),
                                     ELS_PER_THREAD_CHUNKS,
                                     ELS_PER_THREAD_DICTS};
 }
@@ -181,5 +202,6 @@ void GatherOp::Execute(const InferenceRequestContext& context,
 bool GatherOp::IsCudaGraphCompatible() const { return true; }
 
 OPERATION_REGISTER(GatherOp, Gather);
+OPERATION_REGISTER(GatherOp, GatherConvert);
 }  // namespace nvidia_gpu
 }  // namespace ov
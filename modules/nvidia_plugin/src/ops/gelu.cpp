@@ -32,7 +32,7 @@ static OperationBase::Ptr gelu_factory(const CreationContext& context,
         context, *node_v0, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
 }
 
-OPERATION_REGISTER_FACTORY(gelu_factory, Gelu)
+OPERATION_REGISTER_IN_PLACE_FACTORY(gelu_factory, Gelu)
 
 }  // namespace nvidia_gpu
 }  // namespace ov
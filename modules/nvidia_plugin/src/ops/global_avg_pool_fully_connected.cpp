@@ -0,0 +1,89 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "global_avg_pool_fully_connected.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+#include <error.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+kernel::Gemv::Activation convertActivation(const nodes::ActivationMode mode) {
+    switch (mode) {
+        case nodes::ActivationMode::NO_ACTIVATION:
+            return kernel::Gemv::Activation::None;
+        case nodes::ActivationMode::RELU:
+            return kernel::Gemv::Activation::Relu;
+        case nodes::ActivationMode::GELU:
+            return kernel::Gemv::Activation::Gelu;
+        default:
+            throw_ov_exception(fmt::format("Activation mode {} is not supported by GlobalAvgPoolFullyConnected",
+                                           static_cast<int>(mode)));
+    }
+}
+
+}  // namespace
+
+GlobalAvgPoolFullyConnectedOp::GlobalAvgPoolFullyConnectedOp(const CreationContext& context,
+                                                             const NodeOp& node,
+                                                             IndexCollection&& inputIds,
+                                                             IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto& shape = node.get_input_shape(0);
+    const auto& outputShape = node.get_output_shape(0);
+    OPENVINO_ASSERT(shape.size() >= 3 && ov::shape_size(shape) != 0, "Node name: ", GetName());
+    const size_t n = outputShape[1];
+    OPENVINO_ASSERT(ov::shape_size(node.get_input_shape(2)) == n, "Node name: ", GetName());
+    const kernel::Gemv::Params params{convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                                      shape[0],
+                                      shape[1],
+                                      n,
+                                      node.get_transpose_b(),
+                                      convertActivation(node.get_activation()),
+                                      node.get_output_scale(),
+                                      0.0f,
+                                      ov::shape_size(shape) / (shape[0] * shape[1])};
+    const auto& props = context.device().props();
+    kernel_.emplace(params,
+                    static_cast<size_t>(props.multiProcessorCount),
+                    static_cast<size_t>(props.maxThreadsPerBlock));
+}
+
+void GlobalAvgPoolFullyConnectedOp::Execute(const InferenceRequestContext& context,
+                                            Inputs inputTensors,
+                                            Outputs outputTensors,
+                                            const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputTensors.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputTensors.size() == 1, "Node name: ", GetName());
+    const bool hasWorkspace = kernel_.value().workspaceSize() > 0;
+    OPENVINO_ASSERT(!hasWorkspace || workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputTensors[0].get(),
+               inputTensors[1].get(),
+               inputTensors[2].get(),
+               outputTensors[0].get(),
+               hasWorkspace ? workbuffers.mutable_buffers[0].get() : nullptr);
+}
+
+bool GlobalAvgPoolFullyConnectedOp::IsCudaGraphCompatible() const { return true; }
+
+WorkbufferRequest GlobalAvgPoolFullyConnectedOp::GetWorkBufferRequest() const {
+    const auto workspaceSize = kernel_.value().workspaceSize();
+    return workspaceSize > 0 ? WorkbufferRequest{{}, {workspaceSize}} : WorkbufferRequest{};
+}
+
+OPERATION_REGISTER(GlobalAvgPoolFullyConnectedOp, GlobalAvgPoolFullyConnected);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/gemv.hpp>
+#include <optional>
+#include <transformer/nodes/global_avg_pool_fully_connected.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Computes means of channels and their product with the weights by a single kernel, so the pooled activations
+ * aren't written to and read from memory in between
+ */
+class GlobalAvgPoolFullyConnectedOp : public OperationBase {
+public:
+    using NodeOp = nodes::GlobalAvgPoolFullyConnected;
+    GlobalAvgPoolFullyConnectedOp(const CreationContext& context,
+                                  const NodeOp& node,
+                                  IndexCollection&& inputIds,
+                                  IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::Gemv> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,116 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "grid_sample.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+#include <map>
+#include <openvino/core/attribute_visitor.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+/**
+ * Reads attributes of a node, whose class isn't known to the plugin.
+ * Attributes of opset9 are enums visited as strings and boolean align_corners, the custom operation has
+ * string modes and integer align_corners
+ */
+class AttributesReader : public ov::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {}
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        strings_[name] = adapter.get();
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        values_[name] = adapter.get();
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        values_[name] = adapter.get();
+    }
+
+    std::string string(const std::string& name, const std::string& defaultValue) const {
+        const auto value = strings_.find(name);
+        return value != strings_.end() ? value->second : defaultValue;
+    }
+    bool flag(const std::string& name) const {
+        const auto value = values_.find(name);
+        return value != values_.end() && value->second != 0;
+    }
+
+private:
+    std::map<std::string, std::string> strings_;
+    std::map<std::string, int64_t> values_;
+};
+
+}  // namespace
+
+GridSampleOp::GridSampleOp(const CreationContext& context,
+                           const ov::Node& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 2, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto elementType = node.get_input_element_type(0);
+    if (elementType != ov::element::f32 && elementType != ov::element::f16) {
+        throw_ov_exception(fmt::format(
+            "GridSample {} supports only f32 and f16 inputs, not {}", GetName(), elementType.get_type_name()));
+    }
+    if (node.get_input_element_type(1) != elementType) {
+        throw_ov_exception(fmt::format("GridSample {}: grid should have the type of the input", GetName()));
+    }
+    const auto& inputShape = node.get_input_shape(0);
+    const auto& outputShape = node.get_output_shape(0);
+    OPENVINO_ASSERT(inputShape.size() == 4 && outputShape.size() == 4, "Node name: ", GetName());
+
+    AttributesReader attributes;
+    const_cast<ov::Node&>(node).visit_attributes(attributes);
+    using Mode = kernel::GridSample::Mode;
+    using Padding = kernel::GridSample::Padding;
+    const std::map<std::string, Mode> modes{
+        {"bilinear", Mode::bilinear}, {"nearest", Mode::nearest}, {"bicubic", Mode::bicubic}};
+    const std::map<std::string, Padding> paddings{
+        {"zeros", Padding::zeros}, {"border", Padding::border}, {"reflection", Padding::reflection}};
+    const auto mode = modes.find(attributes.string("mode", "bilinear"));
+    const auto padding = paddings.find(attributes.string("padding_mode", "zeros"));
+    if (mode == modes.end() || padding == paddings.end()) {
+        throw_ov_exception(fmt::format("GridSample {}: unsupported mode {} or padding mode {}",
+                                       GetName(),
+                                       attributes.string("mode", "bilinear"),
+                                       attributes.string("padding_mode", "zeros")));
+    }
+
+    kernel_.emplace(convertDataType<kernel::Type_t>(elementType),
+                    mode->second,
+                    padding->second,
+                    attributes.flag("align_corners"),
+                    outputShape[0],
+                    outputShape[1],
+                    inputShape[2],
+                    inputShape[3],
+                    outputShape[2],
+                    outputShape[3],
+                    context.device().props().maxThreadsPerBlock);
+}
+
+void GridSampleOp::Execute(const InferenceRequestContext& context,
+                           Inputs inputs,
+                           Outputs outputs,
+                           const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == 2, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(), inputs[0].get(), inputs[1].get(), outputs[0].get());
+}
+
+bool GridSampleOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(GridSampleOp, GridSample);
+}  // namespace nvidia_gpu
+}  // namespace ov
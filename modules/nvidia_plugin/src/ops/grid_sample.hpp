@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/grid_sample.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * GridSample of the custom operations and of opset9, which share the type name and the names of attributes,
+ * so the node is read by its attributes
+ */
+class GridSampleOp : public OperationBase {
+public:
+    GridSampleOp(const CreationContext& context,
+                 const ov::Node& node,
+                 IndexCollection&& inputIds,
+                 IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::GridSample> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
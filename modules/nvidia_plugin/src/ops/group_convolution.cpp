@@ -4,9 +4,13 @@
 
 #include "group_convolution.hpp"
 
+#include <fmt/format.h>
+
+#include <cuda_implementation_selection.hpp>
 #include <cuda_operation_registry.hpp>
 
 #include "convolution_components/convolution_components.hpp"
+#include "depthwise_convolution.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -29,7 +33,29 @@ bool GroupConvolutionOp::IsCudaGraphCompatible() const { return true; }
 
 WorkbufferRequest GroupConvolutionOp::GetWorkBufferRequest() const { return convolution_.GetWorkBufferRequest(); }
 
-OPERATION_REGISTER(GroupConvolutionOp, GroupConvolution);
+static OperationBase::Ptr groupConvolutionFactory(const CreationContext &context,
+                                                  const std::shared_ptr<ov::Node> &node,
+                                                  OperationBase::IndexCollection &&inputIds,
+                                                  OperationBase::IndexCollection &&outputIds) {
+    using IndexCollection = OperationBase::IndexCollection;
+    const auto &groupConvolution = downcast<const GroupConvolutionOp::NodeOp>(node);
+    const Convolution::Details::ConvolutionParams params{groupConvolution};
+    // Depthwise kernel is created by default if the convolution is a supported depthwise one
+    const std::vector<ImplementationCandidate> candidates{
+        {"DepthwiseConvolution",
+         [&] {
+             return std::make_shared<DepthwiseConvolutionOp>(
+                 context, *node, IndexCollection{inputIds}, IndexCollection{outputIds}, params);
+         }},
+        {"GroupConvolutionCuDnn", [&] {
+             return std::make_shared<GroupConvolutionOp>(
+                 context, groupConvolution, IndexCollection{inputIds}, IndexCollection{outputIds});
+         }}};
+    return createFastestImplementation(
+        context, *node, fmt::format("{};{}", node->get_type_name(), params.TuningKey()), candidates);
+}
+
+OPERATION_REGISTER_FACTORY(groupConvolutionFactory, GroupConvolution);
 
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -0,0 +1,57 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "group_norm.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+GroupNormOp::GroupNormOp(const CreationContext& context,
+                         const NodeOp& node,
+                         IndexCollection&& inputIds,
+                         IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto& shape = node.get_input_shape(0);
+    OPENVINO_ASSERT(shape.size() >= 2 && shape[0] != 0 && shape[1] != 0, "Node name: ", GetName());
+    OPENVINO_ASSERT(!node.is_nhwc_layout() || shape.size() == 4, "Node name: ", GetName());
+    const size_t batch = shape[0];
+    const size_t channels = shape[1];
+    kernel_ = kernel::GroupNorm{convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                                batch,
+                                channels,
+                                ov::shape_size(shape) / (batch * channels),
+                                node.get_num_groups(),
+                                node.get_epsilon(),
+                                node.is_epsilon_inside_sqrt(),
+                                node.has_silu(),
+                                node.is_nhwc_layout()};
+}
+
+void GroupNormOp::Execute(const InferenceRequestContext& context,
+                          Inputs inputs,
+                          Outputs outputs,
+                          const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputs[0].get(),
+               inputs[1].get(),
+               inputs[2].get(),
+               outputs[0].get());
+}
+
+bool GroupNormOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(GroupNormOp, GroupNorm);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/group_norm.hpp>
+
+#include "kernels/group_norm.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Executes group normalization, the affine transform and the optional SiLU by a single kernel
+ */
+class GroupNormOp : public OperationBase {
+public:
+    using NodeOp = nodes::GroupNorm;
+    GroupNormOp(const CreationContext& context,
+                const NodeOp& node,
+                IndexCollection&& inputIds,
+                IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::GroupNorm> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
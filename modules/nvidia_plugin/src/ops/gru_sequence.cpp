@@ -9,6 +9,9 @@
 #include <utility>
 #include <vector>
 
+#include "cuda_implementation_selection.hpp"
+#include "rnn_sequence_persistent.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -16,14 +19,27 @@ GRUSequenceOp::GRUSequenceOp(const CreationContext& context,
                              const NodeOp& node,
                              IndexCollection&& inputIds,
                              IndexCollection&& outputIds)
+    : GRUSequenceOp(
+          context, node, RNN::Details::GRUSequenceParams{node}, std::move(inputIds), std::move(outputIds)) {}
+
+GRUSequenceOp::GRUSequenceOp(const CreationContext& context,
+                             const ov::Node& node,
+                             const RNN::Details::GRUSequenceParams& params,
+                             IndexCollection&& inputIds,
+                             IndexCollection&& outputIds)
     : OperationCuDnn(context, node, std::move(inputIds), std::move(outputIds)),
-      params_{node},
+      params_{params},
       descs_{context, params_, config()},
-      is_cuda_graph_compatible_{RNN::Details::isRNNSequenceCudaGraphCompatible(context.device())} {
+      needs_warm_up_{!RNN::Details::isRNNSequenceCudaGraphCompatible(context.device())} {
     ib_seq_lengths_.addRequest(immut_sizes_, descs_.seqLengthArraySizeBytes());
     ib_weight_space_.addRequest(immut_sizes_, descs_.weightSpaceSize());
 
     mb_work_space_.addRequest(mut_sizes_, descs_.workSpaceSize());
+
+    setupLayoutAdapters();
+    if (hx_adapter_) hx_adapter_->requestWorkbuffer(mut_sizes_);
+    if (y_adapter_) y_adapter_->requestWorkbuffer(mut_sizes_);
+    if (hy_adapter_) hy_adapter_->requestWorkbuffer(mut_sizes_);
 }
 
 GRUSequenceOp::Config GRUSequenceOp::config() {
@@ -32,22 +48,62 @@ GRUSequenceOp::Config GRUSequenceOp::config() {
     return config;
 }
 
+void GRUSequenceOp::setupLayoutAdapters() {
+    using InputAdapter = RNN::Details::TransposeInputTensorAdapter;
+    using OutputAdapter = RNN::Details::TransposeOutputTensorAdapter;
+
+    const int64_t batch_size = params_.batch_size_;
+    const int64_t num_directions = params_.numDirections();
+    const int64_t num_states = params_.numStates();
+    const int64_t hidden_size = params_.hidden_size_;
+    const int64_t max_seq_length = params_.max_seq_length_;
+
+    // States of directions (or layers of a stack) are [batch_size, num_states, hidden_size] in OpenVINO
+    // and [num_states, batch_size, hidden_size] in cuDNN
+    const std::vector<int64_t> state_shape_openvino = {batch_size, num_states, hidden_size};
+    const std::vector<int64_t> state_shape_cudnn = {num_states, batch_size, hidden_size};
+    if ((batch_size > 1) && (num_states > 1)) {
+        hx_adapter_ = std::make_unique<InputAdapter>(params_.element_type_cuda_,
+                                                     params_.element_size_,
+                                                     state_shape_openvino,
+                                                     state_shape_cudnn,
+                                                     std::vector<int>{1, 0, 2});
+        hy_adapter_ = std::make_unique<OutputAdapter>(params_.element_type_cuda_,
+                                                      params_.element_size_,
+                                                      state_shape_cudnn,
+                                                      state_shape_openvino,
+                                                      std::vector<int>{1, 0, 2});
+    }
+
+    const std::vector<int64_t> y_shape_openvino = {batch_size, num_directions, max_seq_length, hidden_size};
+    const std::vector<int64_t> y_shape_cudnn = {batch_size, max_seq_length, num_directions, hidden_size};
+    if ((num_directions > 1) && (max_seq_length > 1)) {
+        y_adapter_ = std::make_unique<OutputAdapter>(params_.element_type_cuda_,
+                                                     params_.element_size_,
+                                                     y_shape_cudnn,
+                                                     y_shape_openvino,
+                                                     std::vector<int>{0, 2, 1, 3});
+    }
+}
+
 void GRUSequenceOp::Execute(const InferenceRequestContext& context,
                             Inputs inputs,
                             Outputs outputs,
                             const Workbuffers& workbuffers) const {
     using ArgIndices = ov::nvidia_gpu::RNN::Details::GRUSequenceArgIndices;
-    OPENVINO_ASSERT(inputs.size() == 6, "Node name: ", GetName());
+    OPENVINO_ASSERT(inputs.size() == 3 + 3 * static_cast<size_t>(params_.num_layers_), "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 2, "Node name: ", GetName());
 
     const auto& ib = workbuffers.immutable_buffers;
     const auto& mb = workbuffers.mutable_buffers;
 
+    if (hx_adapter_) hx_adapter_->execute(context, inputs[ArgIndices::hidden_input], mb);
+
     const void* const api_x = inputs[ArgIndices::x].get();
-    const void* const api_hx = inputs[ArgIndices::hidden_input].get();
+    const void* const api_hx = hx_adapter_ ? hx_adapter_->dnnApiPtr(mb) : inputs[ArgIndices::hidden_input].get();
 
-    void* const api_y = outputs[ArgIndices::y].get();
-    void* const api_hy = outputs[ArgIndices::hidden_output].get();
+    void* const api_y = y_adapter_ ? y_adapter_->dnnApiPtr(mb) : outputs[ArgIndices::y].get();
+    void* const api_hy = hy_adapter_ ? hy_adapter_->dnnApiPtr(mb) : outputs[ArgIndices::hidden_output].get();
 
     const auto& dnnHandle = context.getThreadContext().dnnHandle();
     dnnHandle.rnnForward(descs_.rnnDesc(),
@@ -69,18 +125,89 @@ void GRUSequenceOp::Execute(const InferenceRequestContext& context,
                          mb_work_space_.optionalPtr(mb),
                          0,
                          nullptr);
+
+    if (y_adapter_) y_adapter_->execute(context, mb, outputs[ArgIndices::y]);
+    if (hy_adapter_) hy_adapter_->execute(context, mb, outputs[ArgIndices::hidden_output]);
 }
 
-bool GRUSequenceOp::IsCudaGraphCompatible() const { return is_cuda_graph_compatible_; }
+bool GRUSequenceOp::IsCudaGraphCompatible() const { return true; }
 
 void GRUSequenceOp::InitSharedImmutableWorkbuffers(const IOperationExec::Buffers& buffers) {
     descs_.initDevSeqLengthArray(CUDA::DevicePointer<void*>{ib_seq_lengths_.requiredPtr(buffers)});
     descs_.initWeightSpace(CUDA::DevicePointer<void*>{ib_weight_space_.requiredPtr(buffers)});
+    if (needs_warm_up_) {
+        const size_t batch_size = params_.batch_size_;
+        const size_t max_seq_length = params_.max_seq_length_;
+        const size_t hidden_size = params_.hidden_size_;
+        RNN::Details::RNNForwardSizes sizes{};
+        sizes.x = batch_size * max_seq_length * params_.input_size_ * params_.element_size_;
+        sizes.y = batch_size * max_seq_length * params_.numDirections() * hidden_size * params_.element_size_;
+        sizes.state = params_.numStates() * batch_size * hidden_size * params_.element_size_;
+        sizes.work_space = mb_work_space_.size();
+        RNN::Details::warmUpRNNForward(descs_.rnnDesc(),
+                                       descs_.dnnForwardMode(),
+                                       static_cast<const int32_t*>(ib_seq_lengths_.requiredPtr(buffers)),
+                                       descs_.xDesc(),
+                                       descs_.yDesc(),
+                                       descs_.hDesc(),
+                                       std::nullopt,
+                                       ib_weight_space_.size(),
+                                       ib_weight_space_.requiredPtr(buffers),
+                                       sizes);
+    }
 }
 
 WorkbufferRequest GRUSequenceOp::GetWorkBufferRequest() const { return {immut_sizes_, mut_sizes_}; }
 
-OPERATION_REGISTER(GRUSequenceOp, GRUSequence);
+GRUSequenceStackOp::GRUSequenceStackOp(const CreationContext& context,
+                                       const NodeOp& node,
+                                       IndexCollection&& inputIds,
+                                       IndexCollection&& outputIds)
+    : GRUSequenceOp(
+          context, node, RNN::Details::GRUSequenceParams{node}, std::move(inputIds), std::move(outputIds)) {}
+
+static OperationBase::Ptr gruSequenceFactory(const CreationContext& context,
+                                              const std::shared_ptr<ov::Node>& in_node,
+                                              OperationBase::IndexCollection&& inputIds,
+                                              OperationBase::IndexCollection&& outputIds) {
+    auto node = std::dynamic_pointer_cast<GRUSequenceOp::NodeOp>(in_node);
+    OPENVINO_ASSERT(node);
+
+    const OperationBase::IndexCollection inputs{inputIds};
+    const OperationBase::IndexCollection outputs{outputIds};
+
+    return createFastestImplementation(
+        context,
+        *node,
+        shapesTuningKey(*node),
+        {{"GRUSequencePersistent",
+          [&] {
+              auto params = RNNSequencePersistentOp::kernelParams(RNN::Details::GRUSequenceParams{*node});
+              const size_t seq_length = params.seq_length;
+              const size_t input_size = params.input_size;
+              const size_t hidden_size = params.hidden_size;
+              const size_t num_directions = params.num_directions;
+              // x [batch_size, seq_length, input_size]
+              params.x = {seq_length * input_size, 0, input_size};
+              // hx, hy [batch_size, num_directions, hidden_size]
+              params.hx = {num_directions * hidden_size, hidden_size, 0};
+              params.hy = params.hx;
+              // y [batch_size, num_directions, seq_length, hidden_size]
+              params.y = {num_directions * seq_length * hidden_size, seq_length * hidden_size, hidden_size};
+              return std::make_shared<RNNSequencePersistentOp>(context,
+                                                               *node,
+                                                               params,
+                                                               OperationBase::IndexCollection{inputs},
+                                                               OperationBase::IndexCollection{outputs});
+          }},
+         {"GRUSequenceCuDnn", [&] {
+              return std::make_shared<GRUSequenceOp>(
+                  context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
+          }}});
+}
+
+OPERATION_REGISTER_FACTORY(gruSequenceFactory, GRUSequence)
+OPERATION_REGISTER(GRUSequenceStackOp, GRUSequenceStack)
 
 }  // namespace nvidia_gpu
 }  // namespace ov
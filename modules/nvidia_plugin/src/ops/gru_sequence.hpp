@@ -7,6 +7,7 @@
 #include <cuda_operation_base.hpp>
 #include <openvino/op/gru_sequence.hpp>
 #include <ops/components/workbuffer_desc.hpp>
+#include <transformer/nodes/gru_sequence_stack.hpp>
 
 #include "rnn_components/gru_sequence_components.hpp"
 #include "rnn_components/gru_sequence_cudnn_components.hpp"
@@ -34,8 +35,16 @@ public:
 
     bool IsCudaGraphCompatible() const override;
 
+protected:
+    GRUSequenceOp(const CreationContext& context,
+                  const ov::Node& node,
+                  const RNN::Details::GRUSequenceParams& params,
+                  IndexCollection&& inputIds,
+                  IndexCollection&& outputIds);
+
 private:
     static Config config();
+    void setupLayoutAdapters();
     void InitSharedImmutableWorkbuffers(const IOperationExec::Buffers&) override;
     WorkbufferRequest GetWorkBufferRequest() const override;
 
@@ -50,7 +59,24 @@ private:
     WorkbufferDesc ib_weight_space_;
     WorkbufferDesc mb_work_space_;
 
-    bool is_cuda_graph_compatible_;
+    std::unique_ptr<RNN::Details::TransposeInputTensorAdapter> hx_adapter_;
+    std::unique_ptr<RNN::Details::TransposeOutputTensorAdapter> y_adapter_;
+    std::unique_ptr<RNN::Details::TransposeOutputTensorAdapter> hy_adapter_;
+
+    bool needs_warm_up_;
+};
+
+/**
+ * @brief Implements `ov::nvidia_gpu::nodes::GRUSequenceStack` by a single multi-layer cuDNN GRU,
+ *        so cuDNN may overlap computations of the layers
+ */
+class GRUSequenceStackOp : public GRUSequenceOp {
+public:
+    using NodeOp = nodes::GRUSequenceStack;
+    GRUSequenceStackOp(const CreationContext& context,
+                       const NodeOp& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds);
 };
 
 }  // namespace nvidia_gpu
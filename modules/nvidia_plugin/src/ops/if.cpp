@@ -0,0 +1,151 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "if.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/graph.hpp>
+#include <cuda/runtime.hpp>
+#include <cuda_inference_request_context.hpp>
+#include <cuda_iexecution_delegator.hpp>
+
+#include "cuda_operation_registry.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+IfOp::ElseBranch::ElseBranch(const CreationContext& context, const NodeOp& node)
+    : SubGraph(context, node, IndexCollection{}, IndexCollection{}, NodeOp::ELSE_BODY_INDEX) {}
+
+IfOp::IfOp(const CreationContext& context,
+           const NodeOp& op,
+           IndexCollection&& inputIds,
+           IndexCollection&& outputIds)
+    : SubGraph(context, op, std::move(inputIds), std::move(outputIds), NodeOp::THEN_BODY_INDEX),
+      else_branch_{std::make_unique<ElseBranch>(context, op)} {
+    if (op.get_input_element_type(0) != ov::element::boolean) {
+        throw_ov_exception(fmt::format("If {}: condition should be boolean", GetName()));
+    }
+    for (const auto bodyIdx : {NodeOp::THEN_BODY_INDEX, NodeOp::ELSE_BODY_INDEX}) {
+        auto& ports = ports_[bodyIdx];
+        for (const auto& inputDesc : op.get_input_descriptions(bodyIdx)) {
+            const auto inputIdx = inputDesc->m_input_index;
+            const auto size = op.get_input_element_type(inputIdx).size() * shape_size(op.get_input_shape(inputIdx));
+            ports.inputs.push_back({inputIdx, inputDesc->m_body_parameter_index, size});
+        }
+        for (const auto& outputDesc : op.get_output_descriptions(bodyIdx)) {
+            const auto outputIdx = outputDesc->m_output_index;
+            const auto size =
+                op.get_output_element_type(outputIdx).size() * shape_size(op.get_output_shape(outputIdx));
+            ports.outputs.push_back({outputIdx, outputDesc->m_body_value_index, size});
+        }
+    }
+}
+
+void IfOp::Execute(const InferenceRequestContext& context,
+                   Inputs inputTensors,
+                   Outputs outputTensors,
+                   const Workbuffers& workbuffers) const {
+    const auto& stream = context.getThreadContext().stream();
+    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    auto* flag = static_cast<int32_t*>(workbuffers.mutable_buffers.at(1).get());
+    auto& executionDelegator = context.getExecutionDelegator();
+    ExternalBuffers bodyBuffers;
+    const InferenceRequestContext bodyContext{context, context.getThreadContext(), bodyBuffers};
+
+    // Out of a graph the condition evaluated on device is read by the host to select the branch
+    kernel::ifCondition(stream.get(), static_cast<const bool*>(inputTensors[0].get()), flag, {}, {});
+    int32_t condition = 0;
+    stream.download(&condition, CUDA::DevicePointer<const void*>{flag}, sizeof(condition));
+    stream.synchronize();
+    const auto bodyIdx = condition ? NodeOp::THEN_BODY_INDEX : NodeOp::ELSE_BODY_INDEX;
+    const auto& body = branch(bodyIdx);
+    executeBranch(stream, bodyIdx, mutableBuffer, inputTensors, outputTensors, [&] {
+        executionDelegator.set_stream(stream);
+        executionDelegator.execute_sequence(&body, *body.memoryManager(), mutableBuffer, bodyContext);
+    });
+}
+
+bool IfOp::IsCudaGraphCompatible() const {
+    return CUDA::isConditionalNodeSupported() && SubGraph::IsCudaGraphCompatible() &&
+           else_branch_->IsCudaGraphCompatible();
+}
+
+void IfOp::Capture(InferenceRequestContext& context,
+                   Inputs inputTensors,
+                   Outputs outputTensors,
+                   const Workbuffers& workbuffers) const {
+#if CUDART_VERSION >= 12030
+    const auto& stream = context.getThreadContext().stream();
+    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    auto* flag = static_cast<int32_t*>(workbuffers.mutable_buffers.at(1).get());
+    std::array<kernel::ConditionalHandle, 2> handles;
+    {
+        CUDA::CaptureInfo captureInfo{stream};
+        for (auto& handle : handles) {
+            handle = {captureInfo.createConditionalHandle(), true};
+        }
+    }
+    kernel::ifCondition(stream.get(),
+                        static_cast<const bool*>(inputTensors[0].get()),
+                        flag,
+                        handles[NodeOp::THEN_BODY_INDEX],
+                        handles[NodeOp::ELSE_BODY_INDEX]);
+    ExternalBuffers bodyBuffers;
+    // Conditional nodes with two bodies need CUDA 12.8, so each branch has its own node
+    for (const auto bodyIdx : {NodeOp::THEN_BODY_INDEX, NodeOp::ELSE_BODY_INDEX}) {
+        auto node = CUDA::CaptureInfo{stream}.addConditionalNode(handles[bodyIdx].value, cudaGraphCondTypeIf);
+        const auto& body = branch(bodyIdx);
+        node.setBody(captureBody(context, bodyBuffers, [&](InferenceRequestContext& bodyContext) {
+            const auto& bodyStream = bodyContext.getThreadContext().stream();
+            executeBranch(bodyStream, bodyIdx, mutableBuffer, inputTensors, outputTensors, [&] {
+                context.getExecutionDelegator().capture_sequence(
+                    &body, *body.memoryManager(), mutableBuffer, bodyContext);
+            });
+        }));
+    }
+#else
+    throw_ov_exception(fmt::format("If {}: conditional graph nodes need CUDA 12.3", GetName()));
+#endif
+}
+
+const SubGraph& IfOp::branch(const std::size_t bodyIdx) const {
+    if (bodyIdx == NodeOp::THEN_BODY_INDEX) {
+        return *this;
+    }
+    return *else_branch_;
+}
+
+void IfOp::executeBranch(const CUDA::Stream& stream,
+                         const std::size_t bodyIdx,
+                         CUDA::DevicePointer<void*> mutableBuffer,
+                         Inputs inputTensors,
+                         Outputs outputTensors,
+                         const std::function<void()>& launch) const {
+    const auto& body = branch(bodyIdx);
+    const auto& memoryManager = *body.memoryManager();
+    for (const auto& input : ports_[bodyIdx].inputs) {
+        const auto param = memoryManager.outputTensorPointers(*body.getParams()[input.body_index], mutableBuffer);
+        stream.transfer(param[0], inputTensors[input.index], input.size);
+    }
+    launch();
+    for (const auto& output : ports_[bodyIdx].outputs) {
+        const auto result = memoryManager.inputTensorPointers(*body.getResults()[output.body_index], mutableBuffer);
+        stream.transfer(outputTensors[output.index], result[0], output.size);
+    }
+}
+
+WorkbufferRequest IfOp::GetWorkBufferRequest() const {
+    // Only one of the branches is executed, so they share the memory block, which is followed by the condition
+    const auto thenSize = SubGraph::GetWorkBufferRequest().mutable_sizes.at(0);
+    const auto elseSize = else_branch_->memoryManager()->mutableTensorsMemoryModel()->deviceMemoryBlockSize();
+    return {{}, {std::max(thenSize, elseSize), sizeof(int32_t)}};
+}
+
+OPERATION_REGISTER(IfOp, If);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
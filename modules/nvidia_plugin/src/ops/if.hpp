@@ -0,0 +1,94 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cuda_operation_base.hpp>
+#include <kernels/control_flow.hpp>
+#include <memory>
+#include <openvino/op/if.hpp>
+#include <vector>
+
+#include "subgraph.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * If, whose condition is evaluated on device. In a CUDA Graph the branches are bodies of conditional nodes, which
+ * are selected by the handles set by the kernel evaluating the condition; otherwise the host reads the condition
+ */
+class IfOp : public SubGraph {
+public:
+    using NodeOp = ov::op::v8::If;
+    IfOp(const CreationContext& context,
+         const NodeOp& node,
+         IndexCollection&& inputIds,
+         IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    /**
+     * Compatible if conditional graph nodes are supported and all operations of both branches are compatible
+     */
+    bool IsCudaGraphCompatible() const override;
+
+    /**
+     * Captures each branch into a separate graph and adds it as the body of a conditional node, so the graph
+     * is captured once for both values of the condition
+     */
+    void Capture(InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    /**
+     * @returns Body of the then branch (the subgraph of the operation itself) or of the else branch
+     */
+    const SubGraph& branch(std::size_t bodyIdx) const;
+
+private:
+    /**
+     * Else branch, which is executed in the same memory block as the then branch
+     */
+    class ElseBranch : public SubGraph {
+    public:
+        ElseBranch(const CreationContext& context, const NodeOp& node);
+    };
+
+    // Input or output of the operation, the Parameter or Result of the branch and its size
+    struct Port {
+        uint64_t index;
+        uint64_t body_index;
+        std::size_t size;
+    };
+
+    struct BranchPorts {
+        std::vector<Port> inputs;
+        std::vector<Port> outputs;
+    };
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    /**
+     * Copies the inputs to the Parameters of the branch, launches the branch by the function and copies
+     * its Results to the outputs
+     */
+    void executeBranch(const CUDA::Stream& stream,
+                       std::size_t bodyIdx,
+                       CUDA::DevicePointer<void*> mutableBuffer,
+                       Inputs inputTensors,
+                       Outputs outputTensors,
+                       const std::function<void()>& launch) const;
+
+    std::unique_ptr<ElseBranch> else_branch_;
+    std::array<BranchPorts, 2> ports_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -81,6 +81,36 @@ bool canApplyUpscaleOptimizing(const InterpolateNearestOp::NodeOp& node, const s
     return can_be_optimized && !is_downscale;
 }
 
+/**
+ * @returns true if output coordinates o of H and W map to input coordinates o / 2 and N and C are copied as they are
+ */
+bool canApplyUpscaleBy2(const InterpolateNearestOp::NodeOp& node, const std::vector<float>& scales) {
+    const auto& in_shape = node.get_input_shape(0);
+    const auto& out_shape = node.get_output_shape(0);
+    if (scales != std::vector<float>{1.0f, 1.0f, 2.0f, 2.0f} || out_shape[0] != in_shape[0] ||
+        out_shape[1] != in_shape[1] || out_shape[2] != 2 * in_shape[2] || out_shape[3] != 2 * in_shape[3]) {
+        return false;
+    }
+    using CoordinateTransformMode = ov::op::v4::Interpolate::CoordinateTransformMode;
+    using NearestMode = ov::op::v4::Interpolate::NearestMode;
+    const auto nearest_mode = node.get_attrs().nearest_mode;
+    switch (node.get_attrs().coordinate_transformation_mode) {
+        case CoordinateTransformMode::ASYMMETRIC:
+            // o / 2
+            return nearest_mode == NearestMode::FLOOR || nearest_mode == NearestMode::SIMPLE ||
+                   nearest_mode == NearestMode::ROUND_PREFER_FLOOR;
+        case CoordinateTransformMode::HALF_PIXEL:
+        case CoordinateTransformMode::PYTORCH_HALF_PIXEL:
+            // o / 2 - 0.25
+            return nearest_mode == NearestMode::ROUND_PREFER_FLOOR || nearest_mode == NearestMode::ROUND_PREFER_CEIL;
+        case CoordinateTransformMode::TF_HALF_PIXEL_FOR_NN:
+            // o / 2 + 0.25
+            return nearest_mode == NearestMode::FLOOR || nearest_mode == NearestMode::SIMPLE;
+        default:
+            return false;
+    }
+}
+
 void checkLimitations(const InterpolateNearestOp::NodeOp& node) {
     using namespace ov::op::v4;
     if (node.get_input_shape(0).size() != 4u) {
@@ -126,7 +156,9 @@ InterpolateNearestOp::InterpolateNearestOp(const CreationContext& context,
     const auto& prop = context.device().props();
     const auto max_threads_per_block = prop.maxThreadsPerBlock;
 
-    const auto strides = can_use_upscale_optimizing_ ? in_shape_[0] * in_strides_[0] : out_shape_[0] * out_strides_[0];
+    const bool upscale_by_2 = canApplyUpscaleBy2(node, scales_);
+    const auto strides = (can_use_upscale_optimizing_ || upscale_by_2) ? in_shape_[0] * in_strides_[0]
+                                                                       : out_shape_[0] * out_strides_[0];
     const auto blocks_number = 1 + strides / max_threads_per_block;
     const auto threads_per_block = (blocks_number == 1) ? strides : max_threads_per_block;
     const auto element_type = convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_input_element_type(0));
@@ -136,6 +168,7 @@ InterpolateNearestOp::InterpolateNearestOp(const CreationContext& context,
                                    threads_per_block,
                                    element_type,
                                    can_use_upscale_optimizing_,
+                                   upscale_by_2,
                                    static_cast<kernel::InterpolateNearest::NearestMode>(node.get_attrs().nearest_mode),
                                    static_cast<kernel::InterpolateNearest::CoordinateTransformMode>(
                                        node.get_attrs().coordinate_transformation_mode));
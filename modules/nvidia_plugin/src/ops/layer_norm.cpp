@@ -0,0 +1,51 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_norm.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+LayerNormOp::LayerNormOp(const CreationContext& context,
+                         const NodeOp& node,
+                         IndexCollection&& inputIds,
+                         IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto& shape = node.get_input_shape(0);
+    OPENVINO_ASSERT(!shape.empty() && shape.back() != 0, "Node name: ", GetName());
+    const size_t length = shape.back();
+    kernel_ = kernel::LayerNorm{convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                                ov::shape_size(shape) / length,
+                                length,
+                                node.get_epsilon(),
+                                node.is_epsilon_inside_sqrt()};
+}
+
+void LayerNormOp::Execute(const InferenceRequestContext& context,
+                          Inputs inputs,
+                          Outputs outputs,
+                          const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputs[0].get(),
+               inputs[1].get(),
+               inputs[2].get(),
+               outputs[0].get());
+}
+
+bool LayerNormOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(LayerNormOp, LayerNorm);
+}  // namespace nvidia_gpu
+}  // namespace ov
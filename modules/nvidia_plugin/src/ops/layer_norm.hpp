@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/layer_norm.hpp>
+
+#include "kernels/layer_norm.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Executes normalization and the affine transform of the last dimension by a single kernel
+ */
+class LayerNormOp : public OperationBase {
+public:
+    using NodeOp = nodes::LayerNorm;
+    LayerNormOp(const CreationContext& context,
+                const NodeOp& node,
+                IndexCollection&& inputIds,
+                IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::LayerNorm> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
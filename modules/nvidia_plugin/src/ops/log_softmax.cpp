@@ -0,0 +1,54 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "log_softmax.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+LogSoftmaxOp::LogSoftmaxOp(const CreationContext& context,
+                           const NodeOp& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    OPENVINO_ASSERT(node.get_input_size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+
+    const auto element_type = convertDataType<kernel::Type_t>(node.get_input_element_type(0));
+    if (!kernel::Softmax::isTypeSupported(element_type)) {
+        throw_ov_exception(
+            fmt::format("LogSoftmaxOp: unsupported argument type: {}", node.get_input_element_type(0).get_type_name()));
+    }
+    const auto& shape = node.get_input_shape(0);
+    const auto rank = static_cast<int64_t>(shape.size());
+    const int64_t axis = node.get_axis() < 0 ? node.get_axis() + rank : node.get_axis();
+    OPENVINO_ASSERT(axis >= 0 && axis < rank, "Node name: ", GetName());
+
+    const size_t outer = ov::shape_size(ov::Shape(shape.begin(), shape.begin() + axis));
+    const size_t inner = ov::shape_size(ov::Shape(shape.begin() + axis + 1, shape.end()));
+    kernel_ = kernel::Softmax{element_type, outer, shape[axis], inner, true};
+}
+
+void LogSoftmaxOp::Execute(const InferenceRequestContext& context,
+                           Inputs inputTensors,
+                           Outputs outputTensors,
+                           const Workbuffers&) const {
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    OPENVINO_ASSERT(inputTensors.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputTensors.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(), inputTensors[0].get(), outputTensors[0].get());
+}
+
+bool LogSoftmaxOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(LogSoftmaxOp, LogSoftmax);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,37 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <openvino/op/log_softmax.hpp>
+
+#include "kernels/softmax.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class LogSoftmaxOp : public OperationBase {
+public:
+    using NodeOp = ov::op::v5::LogSoftmax;
+
+    LogSoftmaxOp(const CreationContext& context,
+                 const NodeOp& node,
+                 IndexCollection&& inputIds,
+                 IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::Softmax> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
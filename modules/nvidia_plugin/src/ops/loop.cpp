@@ -0,0 +1,276 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "loop.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/graph.hpp>
+#include <cuda/runtime.hpp>
+#include <cuda_inference_request_context.hpp>
+#include <cuda_iexecution_delegator.hpp>
+
+#include "cuda_operation_registry.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+using SubGraphOp = ov::op::util::SubGraphOp;
+
+/**
+ * @returns Slice of the tensor along the axis of the port, whose start moves by the stride each iteration
+ */
+kernel::IterationSlice makeSlice(const ov::Shape& shape,
+                                 const ov::element::Type& type,
+                                 const int64_t start,
+                                 const int64_t stride,
+                                 const int64_t partSize,
+                                 const int64_t axis,
+                                 const bool isInsert,
+                                 const std::size_t maxThreadsPerBlock) {
+    kernel::IterationSlice::Props props{};
+    props.outer = shape_size(ov::Shape(shape.begin(), shape.begin() + axis));
+    props.axis_size = shape[axis];
+    props.part_size = partSize;
+    props.inner_bytes = shape_size(ov::Shape(shape.begin() + axis + 1, shape.end())) * type.size();
+    props.start = start < 0 ? static_cast<int64_t>(shape[axis]) + start : start;
+    props.stride = stride;
+    return kernel::IterationSlice{props, isInsert, maxThreadsPerBlock};
+}
+
+/**
+ * @returns Number of iterations, after which the slices run out of the tensor
+ */
+int64_t numSlices(const ov::Shape& shape, int64_t start, const int64_t stride, const int64_t partSize, int64_t axis) {
+    const auto dim = static_cast<int64_t>(shape[axis]);
+    if (start < 0) {
+        start += dim;
+    }
+    return stride > 0 ? (dim - start - partSize) / stride + 1 : start / -stride + 1;
+}
+
+void limitIterations(int64_t& maxIterations, const int64_t iterations) {
+    maxIterations = maxIterations < 0 ? iterations : std::min(maxIterations, iterations);
+}
+
+}  // namespace
+
+LoopOp::LoopOp(const CreationContext& context,
+               const NodeOp& op,
+               IndexCollection&& inputIds,
+               IndexCollection&& outputIds)
+    : SubGraph(context, op, std::move(inputIds), std::move(outputIds)) {
+    const auto tripCountType = op.get_input_element_type(0);
+    if (tripCountType != ov::element::i32 && tripCountType != ov::element::i64) {
+        throw_ov_exception(fmt::format(
+            "Loop {}: trip count of {} type isn't supported", GetName(), tripCountType.get_type_name()));
+    }
+    is_trip_count_64_ = tripCountType == ov::element::i64;
+    if (op.get_input_element_type(1) != ov::element::boolean) {
+        throw_ov_exception(fmt::format("Loop {}: execution condition should be boolean", GetName()));
+    }
+    const auto& specialPorts = op.get_special_body_ports();
+    body_condition_result_ = specialPorts.body_condition_output_idx;
+    if (body_condition_result_ < 0 || results_info_[body_condition_result_].type_ != ov::element::boolean) {
+        throw_ov_exception(fmt::format("Loop {}: body should have a boolean condition output", GetName()));
+    }
+    current_iteration_param_ = specialPorts.current_iteration_input_idx;
+    if (current_iteration_param_ >= 0) {
+        const auto iterationType = params_info_[current_iteration_param_].type_;
+        if (iterationType != ov::element::i32 && iterationType != ov::element::i64) {
+            throw_ov_exception(fmt::format(
+                "Loop {}: current iteration of {} type isn't supported", GetName(), iterationType.get_type_name()));
+        }
+        is_iteration_64_ = iterationType == ov::element::i64;
+    }
+
+    const auto maxThreadsPerBlock = context.device().props().maxThreadsPerBlock;
+    for (const auto& inputDesc : op.get_input_descriptions()) {
+        const auto inputIdx = inputDesc->m_input_index;
+        const auto paramIdx = inputDesc->m_body_parameter_index;
+        if (const auto slice = std::dynamic_pointer_cast<SubGraphOp::SliceInputDescription>(inputDesc)) {
+            const auto& shape = op.get_input_shape(inputIdx);
+            sliced_inputs_.push_back({inputIdx,
+                                      paramIdx,
+                                      makeSlice(shape,
+                                                op.get_input_element_type(inputIdx),
+                                                slice->m_start,
+                                                slice->m_stride,
+                                                slice->m_part_size,
+                                                slice->m_axis,
+                                                false,
+                                                maxThreadsPerBlock)});
+            limitIterations(max_iterations_,
+                            numSlices(shape, slice->m_start, slice->m_stride, slice->m_part_size, slice->m_axis));
+            continue;
+        }
+        OPENVINO_ASSERT(op.get_input_element_type(inputIdx).size() * shape_size(op.get_input_shape(inputIdx)) ==
+                            params_info_[paramIdx].size_,
+                        "Node name: ",
+                        GetName());
+        initial_inputs_.push_back({inputIdx, paramIdx});
+        if (const auto merged = std::dynamic_pointer_cast<SubGraphOp::MergedInputDescription>(inputDesc)) {
+            back_edges_.push_back({merged->m_body_value_index, paramIdx});
+        }
+    }
+
+    for (const auto& outputDesc : op.get_output_descriptions()) {
+        const auto outputIdx = outputDesc->m_output_index;
+        const auto resultIdx = outputDesc->m_body_value_index;
+        if (const auto concat = std::dynamic_pointer_cast<SubGraphOp::ConcatOutputDescription>(outputDesc)) {
+            const auto& shape = op.get_output_shape(outputIdx);
+            concat_outputs_.push_back({outputIdx,
+                                       resultIdx,
+                                       makeSlice(shape,
+                                                 op.get_output_element_type(outputIdx),
+                                                 concat->m_start,
+                                                 concat->m_stride,
+                                                 concat->m_part_size,
+                                                 concat->m_axis,
+                                                 true,
+                                                 maxThreadsPerBlock)});
+            limitIterations(max_iterations_,
+                            numSlices(shape, concat->m_start, concat->m_stride, concat->m_part_size, concat->m_axis));
+        } else if (const auto body = std::dynamic_pointer_cast<SubGraphOp::BodyOutputDescription>(outputDesc)) {
+            if (body->m_iteration != -1) {
+                throw_ov_exception(fmt::format("Loop {}: only outputs of the last iteration are supported", GetName()));
+            }
+            body_outputs_.push_back({outputIdx, resultIdx});
+        }
+    }
+}
+
+void LoopOp::Execute(const InferenceRequestContext& context,
+                     Inputs inputTensors,
+                     Outputs outputTensors,
+                     const Workbuffers& workbuffers) const {
+    const auto& stream = context.getThreadContext().stream();
+    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    auto* state = static_cast<kernel::LoopState*>(workbuffers.mutable_buffers.at(1).get());
+    auto& executionDelegator = context.getExecutionDelegator();
+    ExternalBuffers bodyBuffers;
+    const InferenceRequestContext bodyContext{context, context.getThreadContext(), bodyBuffers};
+
+    begin(stream, mutableBuffer, inputTensors, state, {});
+    // Out of a graph the condition evaluated on device is read by the host before each iteration
+    for (;;) {
+        int32_t condition = 0;
+        stream.download(&condition, CUDA::DevicePointer<const void*>{&state->condition}, sizeof(condition));
+        stream.synchronize();
+        if (!condition) {
+            break;
+        }
+        iterate(stream, mutableBuffer, inputTensors, outputTensors, state, {}, [&] {
+            executionDelegator.set_stream(stream);
+            executionDelegator.execute_sequence(this, *memory_manager_, mutableBuffer, bodyContext);
+        });
+    }
+}
+
+bool LoopOp::IsCudaGraphCompatible() const {
+    return CUDA::isConditionalNodeSupported() && SubGraph::IsCudaGraphCompatible();
+}
+
+void LoopOp::Capture(InferenceRequestContext& context,
+                     Inputs inputTensors,
+                     Outputs outputTensors,
+                     const Workbuffers& workbuffers) const {
+#if CUDART_VERSION >= 12030
+    const auto& stream = context.getThreadContext().stream();
+    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    auto* state = static_cast<kernel::LoopState*>(workbuffers.mutable_buffers.at(1).get());
+    const kernel::ConditionalHandle handle{CUDA::CaptureInfo{stream}.createConditionalHandle(), true};
+    begin(stream, mutableBuffer, inputTensors, state, handle);
+    auto node = CUDA::CaptureInfo{stream}.addConditionalNode(handle.value, cudaGraphCondTypeWhile);
+    ExternalBuffers bodyBuffers;
+    node.setBody(captureBody(context, bodyBuffers, [&](InferenceRequestContext& bodyContext) {
+        const auto& bodyStream = bodyContext.getThreadContext().stream();
+        iterate(bodyStream, mutableBuffer, inputTensors, outputTensors, state, handle, [&] {
+            context.getExecutionDelegator().capture_sequence(this, *memory_manager_, mutableBuffer, bodyContext);
+        });
+    }));
+#else
+    throw_ov_exception(fmt::format("Loop {}: conditional graph nodes need CUDA 12.3", GetName()));
+#endif
+}
+
+void LoopOp::begin(const CUDA::Stream& stream,
+                   CUDA::DevicePointer<void*> mutableBuffer,
+                   Inputs inputTensors,
+                   kernel::LoopState* state,
+                   const kernel::ConditionalHandle handle) const {
+    for (const auto& [inputIdx, paramIdx] : initial_inputs_) {
+        stream.transfer(paramBuffer(mutableBuffer, paramIdx), inputTensors[inputIdx], params_info_[paramIdx].size_);
+    }
+    kernel::loopBegin(stream.get(),
+                      inputTensors[0].get(),
+                      is_trip_count_64_,
+                      static_cast<const bool*>(inputTensors[1].get()),
+                      max_iterations_,
+                      state,
+                      handle);
+}
+
+void LoopOp::iterate(const CUDA::Stream& stream,
+                     CUDA::DevicePointer<void*> mutableBuffer,
+                     Inputs inputTensors,
+                     Outputs outputTensors,
+                     kernel::LoopState* state,
+                     const kernel::ConditionalHandle handle,
+                     const std::function<void()>& body) const {
+    if (current_iteration_param_ >= 0) {
+        kernel::loopIteration(
+            stream.get(), state, paramBuffer(mutableBuffer, current_iteration_param_).get(), is_iteration_64_);
+    }
+    for (const auto& input : sliced_inputs_) {
+        input.slice(
+            stream.get(), state, inputTensors[input.index].get(), paramBuffer(mutableBuffer, input.body_index).get());
+    }
+    body();
+    // The condition is read before back edges overwrite Parameters, whose buffers the Result may share
+    kernel::loopNext(stream.get(),
+                     static_cast<const bool*>(resultBuffer(mutableBuffer, body_condition_result_).get()),
+                     max_iterations_,
+                     state,
+                     handle);
+    for (const auto& [outputIdx, resultIdx] : body_outputs_) {
+        stream.transfer(
+            outputTensors[outputIdx], resultBuffer(mutableBuffer, resultIdx), results_info_[resultIdx].size_);
+    }
+    for (const auto& output : concat_outputs_) {
+        output.slice(stream.get(),
+                     state,
+                     resultBuffer(mutableBuffer, output.body_index).get(),
+                     outputTensors[output.index].get());
+    }
+    for (const auto& [resultIdx, paramIdx] : back_edges_) {
+        stream.transfer(
+            paramBuffer(mutableBuffer, paramIdx), resultBuffer(mutableBuffer, resultIdx), params_info_[paramIdx].size_);
+    }
+}
+
+CUDA::DevicePointer<void*> LoopOp::paramBuffer(CUDA::DevicePointer<void*> mutableBuffer,
+                                               const uint64_t paramIdx) const {
+    return memory_manager_->outputTensorPointers(*params_[paramIdx], mutableBuffer)[0];
+}
+
+CUDA::DevicePointer<const void*> LoopOp::resultBuffer(CUDA::DevicePointer<void*> mutableBuffer,
+                                                      const uint64_t resultIdx) const {
+    return memory_manager_->inputTensorPointers(*results_[resultIdx], mutableBuffer)[0];
+}
+
+WorkbufferRequest LoopOp::GetWorkBufferRequest() const {
+    // The body memory block is followed by the state of the loop
+    auto mutable_sizes = SubGraph::GetWorkBufferRequest().mutable_sizes;
+    mutable_sizes.push_back(sizeof(kernel::LoopState));
+    return {{}, mutable_sizes};
+}
+
+OPERATION_REGISTER(LoopOp, Loop);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,103 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cuda_operation_base.hpp>
+#include <kernels/control_flow.hpp>
+#include <openvino/op/loop.hpp>
+#include <vector>
+
+#include "subgraph.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Loop, whose trip count and conditions are evaluated on device. In a CUDA Graph the iteration is the body of
+ * a conditional while node, so the graph is captured once for any number of iterations; otherwise the host reads
+ * the condition before each iteration
+ */
+class LoopOp : public SubGraph {
+public:
+    using NodeOp = ov::op::v5::Loop;
+    LoopOp(const CreationContext& context,
+           const NodeOp& node,
+           IndexCollection&& inputIds,
+           IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    /**
+     * Compatible if conditional graph nodes are supported and all operations of the body are compatible
+     */
+    bool IsCudaGraphCompatible() const override;
+
+    /**
+     * Captures the iteration into a separate graph and adds it as the body of a conditional while node,
+     * whose handle is set by the kernels evaluating the condition
+     */
+    void Capture(InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+private:
+    // Input or output of the operation and the Parameter or Result of the body, or Result and Parameter of a back edge
+    struct Port {
+        uint64_t index;
+        uint64_t body_index;
+    };
+
+    struct SlicedPort {
+        uint64_t index;
+        uint64_t body_index;
+        kernel::IterationSlice slice;
+    };
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    /**
+     * Copies initial values of the Parameters of the body and initializes the state
+     */
+    void begin(const CUDA::Stream& stream,
+               CUDA::DevicePointer<void*> mutableBuffer,
+               Inputs inputTensors,
+               kernel::LoopState* state,
+               kernel::ConditionalHandle handle) const;
+    /**
+     * Executes an iteration around the body, which is launched by the function
+     */
+    void iterate(const CUDA::Stream& stream,
+                 CUDA::DevicePointer<void*> mutableBuffer,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 kernel::LoopState* state,
+                 kernel::ConditionalHandle handle,
+                 const std::function<void()>& body) const;
+
+    CUDA::DevicePointer<void*> paramBuffer(CUDA::DevicePointer<void*> mutableBuffer, uint64_t paramIdx) const;
+    CUDA::DevicePointer<const void*> resultBuffer(CUDA::DevicePointer<void*> mutableBuffer, uint64_t resultIdx) const;
+
+    bool is_trip_count_64_{};
+    bool is_iteration_64_{};
+    int64_t current_iteration_param_{-1};
+    int64_t body_condition_result_{-1};
+    // Iterations beyond the slices of sliced inputs and concatenated outputs aren't executed, -1 if unlimited
+    int64_t max_iterations_{-1};
+    // Inputs copied to the Parameters once before the first iteration, including initial values of back edges
+    std::vector<Port> initial_inputs_;
+    std::vector<SlicedPort> sliced_inputs_;
+    // Results copied to the Parameters of the next iteration
+    std::vector<Port> back_edges_;
+    // Results copied to the outputs each iteration, so the outputs hold the values of the last one
+    std::vector<Port> body_outputs_;
+    std::vector<SlicedPort> concat_outputs_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -9,6 +9,9 @@
 #include <utility>
 #include <vector>
 
+#include "cuda_implementation_selection.hpp"
+#include "rnn_sequence_persistent.hpp"
+
 #include "rnn_components/lstm_sequence_components.hpp"
 
 namespace ov {
@@ -130,7 +133,49 @@ void LSTMSequenceOp::setupLayoutAdapters() {
     }
 }
 
-OPERATION_REGISTER(LSTMSequenceOp, LSTMSequence);
+static OperationBase::Ptr lstmSequenceFactory(const CreationContext& context,
+                                               const std::shared_ptr<ov::Node>& in_node,
+                                               OperationBase::IndexCollection&& inputIds,
+                                               OperationBase::IndexCollection&& outputIds) {
+    auto node = std::dynamic_pointer_cast<LSTMSequenceOp::NodeOp>(in_node);
+    OPENVINO_ASSERT(node);
+
+    const OperationBase::IndexCollection inputs{inputIds};
+    const OperationBase::IndexCollection outputs{outputIds};
+
+    return createFastestImplementation(
+        context,
+        *node,
+        shapesTuningKey(*node),
+        {{"LSTMSequencePersistent",
+          [&] {
+              auto params = RNNSequencePersistentOp::kernelParams(RNN::Details::LSTMSequenceParams{*node});
+              const size_t seq_length = params.seq_length;
+              const size_t input_size = params.input_size;
+              const size_t hidden_size = params.hidden_size;
+              const size_t num_directions = params.num_directions;
+              // x [batch_size, seq_length, input_size]
+              params.x = {seq_length * input_size, 0, input_size};
+              // hx, cx, hy, cy [batch_size, num_directions, hidden_size]
+              params.hx = {num_directions * hidden_size, hidden_size, 0};
+              params.cx = params.hx;
+              params.hy = params.hx;
+              params.cy = params.hx;
+              // y [batch_size, num_directions, seq_length, hidden_size]
+              params.y = {num_directions * seq_length * hidden_size, seq_length * hidden_size, hidden_size};
+              return std::make_shared<RNNSequencePersistentOp>(context,
+                                                               *node,
+                                                               params,
+                                                               OperationBase::IndexCollection{inputs},
+                                                               OperationBase::IndexCollection{outputs});
+          }},
+         {"LSTMSequenceCuDnn", [&] {
+              return std::make_shared<LSTMSequenceOp>(
+                  context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
+          }}});
+}
+
+OPERATION_REGISTER_FACTORY(lstmSequenceFactory, LSTMSequence)
 
 }  // namespace nvidia_gpu
 }  // namespace ov
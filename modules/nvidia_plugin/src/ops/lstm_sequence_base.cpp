@@ -20,7 +20,7 @@ LSTMSequenceOpBase::LSTMSequenceOpBase(const CreationContext& context,
     : OperationCuDnn(context, node, std::move(inputIds), std::move(outputIds)),
       params_{params},
       descs_{context, params_, config},
-      is_cuda_graph_compatible_{RNN::Details::isRNNSequenceCudaGraphCompatible(context.device())} {
+      needs_warm_up_{!RNN::Details::isRNNSequenceCudaGraphCompatible(context.device())} {
     ib_seq_lengths_.addRequest(immut_sizes_, descs_.seqLengthArraySizeBytes());
     ib_weight_space_.addRequest(immut_sizes_, descs_.weightSpaceSize());
 
@@ -76,11 +76,31 @@ void LSTMSequenceOpBase::Execute(const InferenceRequestContext& context,
     if (cy_adapter) cy_adapter->execute(context, mb, outputs[ArgIndices::cell_output]);
 }
 
-bool LSTMSequenceOpBase::IsCudaGraphCompatible() const { return is_cuda_graph_compatible_; }
+bool LSTMSequenceOpBase::IsCudaGraphCompatible() const { return true; }
 
 void LSTMSequenceOpBase::InitSharedImmutableWorkbuffers(const IOperationExec::Buffers& buffers) {
     descs_.initDevSeqLengthArray(CUDA::DevicePointer<void*>{ib_seq_lengths_.requiredPtr(buffers)});
     descs_.initWeightSpace(CUDA::DevicePointer<void*>{ib_weight_space_.requiredPtr(buffers)});
+    if (needs_warm_up_) {
+        const size_t batch_size = params_.batch_size_;
+        const size_t max_seq_length = params_.max_seq_length_;
+        const size_t hidden_size = params_.hidden_size_;
+        RNN::Details::RNNForwardSizes sizes{};
+        sizes.x = batch_size * max_seq_length * params_.input_size_ * params_.element_size_;
+        sizes.y = batch_size * max_seq_length * params_.numDirections() * hidden_size * params_.element_size_;
+        sizes.state = params_.numDirections() * batch_size * hidden_size * params_.element_size_;
+        sizes.work_space = mb_work_space_.size();
+        RNN::Details::warmUpRNNForward(descs_.rnnDesc(),
+                                       descs_.dnnForwardMode(),
+                                       static_cast<const int32_t*>(ib_seq_lengths_.requiredPtr(buffers)),
+                                       descs_.xDesc(),
+                                       descs_.yDesc(),
+                                       descs_.hDesc(),
+                                       descs_.cDesc(),
+                                       ib_weight_space_.size(),
+                                       ib_weight_space_.requiredPtr(buffers),
+                                       sizes);
+    }
 }
 
 WorkbufferRequest LSTMSequenceOpBase::GetWorkBufferRequest() const { return {immut_sizes_, mut_sizes_}; }
@@ -59,7 +59,7 @@ protected:
     OutputTensorAdapterPtr cy_adapter;
 
 private:
-    bool is_cuda_graph_compatible_;
+    bool needs_warm_up_;
 };
 
 }  // namespace nvidia_gpu
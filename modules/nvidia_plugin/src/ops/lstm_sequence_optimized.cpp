@@ -9,6 +9,9 @@
 #include <utility>
 #include <vector>
 
+#include "cuda_implementation_selection.hpp"
+#include "rnn_sequence_persistent.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -205,7 +208,64 @@ void LSTMSequenceOptimizedOp::setupSequenceMajorLayoutAdapters() {
     }
 }
 
-OPERATION_REGISTER(LSTMSequenceOptimizedOp, LSTMSequenceOptimized);
+static OperationBase::Ptr lstmSequenceOptimizedFactory(const CreationContext& context,
+                                                        const std::shared_ptr<ov::Node>& in_node,
+                                                        OperationBase::IndexCollection&& inputIds,
+                                                        OperationBase::IndexCollection&& outputIds) {
+    using NodeOp = LSTMSequenceOptimizedOp::NodeOp;
+    auto node = std::dynamic_pointer_cast<NodeOp>(in_node);
+    OPENVINO_ASSERT(node);
+
+    const OperationBase::IndexCollection inputs{inputIds};
+    const OperationBase::IndexCollection outputs{outputIds};
+
+    return createFastestImplementation(
+        context,
+        *node,
+        shapesTuningKey(*node),
+        {{"LSTMSequenceOptimizedPersistent",
+          [&] {
+              auto params = RNNSequencePersistentOp::kernelParams(RNN::Details::LSTMSequenceParams{*node});
+              const size_t batch_size = params.batch_size;
+              const size_t seq_length = params.seq_length;
+              const size_t input_size = params.input_size;
+              const size_t hidden_size = params.hidden_size;
+              const size_t num_directions = params.num_directions;
+              // cell/hidden in [batch_size, num_directions, hidden_size]
+              params.hx = {num_directions * hidden_size, hidden_size, 0};
+              params.cx = params.hx;
+              // cell/hidden out [num_directions, batch_size, hidden_size]
+              params.hy = {hidden_size, batch_size * hidden_size, 0};
+              params.cy = params.hy;
+              switch (node->get_major_format()) {
+                  case NodeOp::BatchMajor:
+                      // in [X] [batch_size, seq_length, input_size]
+                      params.x = {seq_length * input_size, 0, input_size};
+                      // out [Y] [batch_size, seq_length, num_directions, hidden_size]
+                      params.y = {seq_length * num_directions * hidden_size, hidden_size, num_directions * hidden_size};
+                      break;
+                  case NodeOp::SequenceMajor:
+                      // in [X] [seq_length, batch_size, input_size]
+                      params.x = {input_size, 0, batch_size * input_size};
+                      // out [Y] [seq_length, batch_size, num_directions, hidden_size]
+                      params.y = {num_directions * hidden_size, hidden_size, batch_size * num_directions * hidden_size};
+                      break;
+                  default:
+                      OPENVINO_ASSERT(false, "Node name: ", node->get_friendly_name());
+              }
+              return std::make_shared<RNNSequencePersistentOp>(context,
+                                                               *node,
+                                                               params,
+                                                               OperationBase::IndexCollection{inputs},
+                                                               OperationBase::IndexCollection{outputs});
+          }},
+         {"LSTMSequenceOptimizedCuDnn", [&] {
+              return std::make_shared<LSTMSequenceOptimizedOp>(
+                  context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
+          }}});
+}
+
+OPERATION_REGISTER_FACTORY(lstmSequenceOptimizedFactory, LSTMSequenceOptimized)
 
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -19,6 +19,28 @@
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+cublasLtEpilogue_t toEpilogue(nodes::ActivationMode activation, bool bias) {
+    switch (activation) {
+        case nodes::ActivationMode::NO_ACTIVATION:
+            return bias ? CUBLASLT_EPILOGUE_BIAS : CUBLASLT_EPILOGUE_DEFAULT;
+        case nodes::ActivationMode::RELU:
+            return bias ? CUBLASLT_EPILOGUE_RELU_BIAS : CUBLASLT_EPILOGUE_RELU;
+        case nodes::ActivationMode::GELU:
+            return bias ? CUBLASLT_EPILOGUE_GELU_BIAS : CUBLASLT_EPILOGUE_GELU;
+        default:
+            throw_ov_exception(fmt::format("Activation {} isn't supported by cuBLASLt epilogue", activation));
+    }
+}
+
+bool hasBias(cublasLtEpilogue_t epilogue) {
+    return epilogue == CUBLASLT_EPILOGUE_BIAS || epilogue == CUBLASLT_EPILOGUE_RELU_BIAS ||
+           epilogue == CUBLASLT_EPILOGUE_GELU_BIAS;
+}
+
+}  // namespace
+
 template <typename TOperation>
 MatMulOp::MatMulOp(const CreationContext& context,
                    const TOperation& op,
@@ -33,6 +55,7 @@ MatMulOp::MatMulOp(const CreationContext& context,
                     GetName());
     data_type_ = convertDataType<cudaDataType_t>(op.get_input_element_type(0));
     compute_type_ = GetComputeType(data_type_, convertDataType<cudaDataType_t>(op.get_output_element_type(0)));
+    gemm_compute_type_ = GetGemmComputeType(data_type_, compute_type_, context.tf32());
     auto inputAShape = op.get_input_shape(0);
     auto inputBShape = op.get_input_shape(1);
     auto outputCShape = op.get_output_shape(0);
@@ -60,8 +83,13 @@ MatMulOp::MatMulOp(const CreationContext& context,
     stride_c_ = (m_ * n_);
     cublas_transpose_a_ = transposeA ? CUBLAS_OP_T : CUBLAS_OP_N;
     cublas_transpose_b_ = transposeB ? CUBLAS_OP_T : CUBLAS_OP_N;
+    auto activation = nodes::ActivationMode::NO_ACTIVATION;
+    bool vectorBias = false;
     if constexpr (std::is_same_v<TOperation, nodes::FullyConnected>) {
         beta_ = &CUDA::NumericConst<CUDA::constants::one>(compute_type_);
+        activation = op.get_activation();
+        alpha_ = op.get_output_scale();
+        vectorBias = ov::shape_size(op.get_input_shape(2)) == static_cast<size_t>(n_);
     } else {
         beta_ = &CUDA::NumericConst<CUDA::constants::zero>(compute_type_);
     }
@@ -72,6 +100,24 @@ MatMulOp::MatMulOp(const CreationContext& context,
     OPENVINO_ASSERT(ld_b_ != 0, "Node name: ", GetName());
     OPENVINO_ASSERT(ld_c_ != 0, "Node name: ", GetName());
     OPENVINO_ASSERT(batch_count_ != 0, "Node name: ", GetName());
+
+    const float gemvBeta = std::is_same_v<TOperation, nodes::FullyConnected> && !vectorBias ? 1.0f : 0.0f;
+    if (InitGemv(context, op.get_input_element_type(0), activation, vectorBias, gemvBeta)) {
+        epilogue_bias_ = vectorBias;
+    } else if (data_type_ == CUDA_R_32F || data_type_ == CUDA_R_16F || data_type_ == CUDA_R_16BF) {
+        // Bias vector is added by the epilogue, other biases are copied to the output and added as matrix C
+        if (vectorBias && InitLt(context, toEpilogue(activation, true))) {
+            epilogue_bias_ = true;
+        } else {
+            InitLt(context, toEpilogue(activation, false));
+        }
+    }
+    OPENVINO_ASSERT(gemv_ || lt_algo_ || (activation == nodes::ActivationMode::NO_ACTIVATION && alpha_ == 1.0f),
+                    "cuBLASLt doesn't support the epilogue of the node, node name: ",
+                    GetName());
+    if constexpr (std::is_same_v<TOperation, nodes::FullyConnected>) {
+        lt_beta_ = epilogue_bias_ ? 0.0f : 1.0f;
+    }
 }
 template MatMulOp::MatMulOp(const CreationContext& context,
                             const ov::op::v0::MatMul&,
@@ -119,6 +165,22 @@ cudaDataType_t MatMulOp::GetComputeType(const cudaDataType_t abDataType, const c
     }
 }
 
+cublasComputeType_t MatMulOp::GetGemmComputeType(const cudaDataType_t abDataType,
+                                                 const cudaDataType_t computeType,
+                                                 const bool tf32) {
+    switch (computeType) {
+        case CUDA_R_16F:
+            return CUBLAS_COMPUTE_16F;
+        case CUDA_R_32I:
+            return CUBLAS_COMPUTE_32I;
+        case CUDA_R_64F:
+            return CUBLAS_COMPUTE_64F;
+        default:
+            // TF32 Tensor Cores round fp32 inputs to 10 bits of mantissa, products of other types aren't affected
+            return abDataType == CUDA_R_32F && tf32 ? CUBLAS_COMPUTE_32F_FAST_TF32 : CUBLAS_COMPUTE_32F;
+    }
+}
+
 int MatMulOp::GetMatrixNumBatches(const ov::Shape& matrixShape) {
     return matrixShape.size() >= 2
                ? std::accumulate(matrixShape.begin(), matrixShape.end() - 2, 1, std::multiplies<size_t>())
@@ -174,6 +236,130 @@ void MatMulOp::BroadcastShapes(
     *(matrixCShape.end() - 1) = *(matrixBShape.end() - transposeB - 1);
 }
 
+bool MatMulOp::InitLt(const CreationContext& context, cublasLtEpilogue_t epilogue) {
+    lt_algo_.reset();
+    // Batches of A are consecutive rows if B isn't batched, so that they are multiplied as a single matrix
+    const bool singleMatrix = batch_count_ > 1 && stride_b_ == 0 && cublas_transpose_a_ == CUBLAS_OP_N;
+    const int batchCount = singleMatrix ? 1 : batch_count_;
+    const uint64_t rows = singleMatrix ? static_cast<uint64_t>(m_) * batch_count_ : m_;
+    if (batchCount > 1 && hasBias(epilogue)) {
+        return false;
+    }
+    epilogue_ = epilogue;
+
+    /**
+     * NOTE: As for cublasGemmStridedBatchedEx, A and B are switched in places and Ct = Bt x At is computed,
+     *       layouts describe column-major matrices before the transposition
+     */
+    const bool transposeA = cublas_transpose_a_ == CUBLAS_OP_T;
+    const bool transposeB = cublas_transpose_b_ == CUBLAS_OP_T;
+    lt_a_layout_.emplace(data_type_, transposeB ? k_ : n_, transposeB ? n_ : k_, ld_b_);
+    lt_b_layout_.emplace(data_type_, transposeA ? rows : k_, transposeA ? k_ : rows, ld_a_);
+    lt_c_layout_.emplace(data_type_, n_, rows, ld_c_);
+    if (batchCount > 1) {
+        lt_a_layout_->set(CUBLASLT_MATRIX_LAYOUT_BATCH_COUNT, batchCount)
+            .set(CUBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, static_cast<int64_t>(stride_b_));
+        lt_b_layout_->set(CUBLASLT_MATRIX_LAYOUT_BATCH_COUNT, batchCount)
+            .set(CUBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, static_cast<int64_t>(stride_a_));
+        lt_c_layout_->set(CUBLASLT_MATRIX_LAYOUT_BATCH_COUNT, batchCount)
+            .set(CUBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, static_cast<int64_t>(stride_c_));
+    }
+
+    lt_workspace_size_ = std::min(workspace_size, context.maxWorkspaceSize());
+    CUDA::CuBlasLtMatmulPreference preference;
+    preference.set(CUBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, static_cast<uint64_t>(lt_workspace_size_));
+    const auto descriptor = CreateLtDescriptor(nullptr);
+    cublasLtMatmulHeuristicResult_t heuristic{};
+    int numResults = 0;
+    const auto status = cublasLtMatmulAlgoGetHeuristic(CUDA::toLtHandle(context.cuBlasHandle()),
+                                                       descriptor.get(),
+                                                       lt_a_layout_->get(),
+                                                       lt_b_layout_->get(),
+                                                       lt_c_layout_->get(),
+                                                       lt_c_layout_->get(),
+                                                       preference.get(),
+                                                       1,
+                                                       &heuristic,
+                                                       &numResults);
+    if (status != CUBLAS_STATUS_SUCCESS || numResults == 0) {
+        return false;
+    }
+    lt_algo_ = heuristic.algo;
+    return true;
+}
+
+bool MatMulOp::InitGemv(const CreationContext& context,
+                        const ov::element::Type& elementType,
+                        const nodes::ActivationMode activation,
+                        const bool vectorBias,
+                        const float beta) {
+    const auto elementTypeT = convertDataType<kernel::Type_t>(elementType);
+    if (!kernel::Gemv::isSupportedType(elementTypeT)) {
+        return false;
+    }
+    kernel::Gemv::Activation gemvActivation{};
+    switch (activation) {
+        case nodes::ActivationMode::NO_ACTIVATION:
+            gemvActivation = kernel::Gemv::Activation::None;
+            break;
+        case nodes::ActivationMode::RELU:
+            gemvActivation = kernel::Gemv::Activation::Relu;
+            break;
+        case nodes::ActivationMode::GELU:
+            gemvActivation = kernel::Gemv::Activation::Gelu;
+            break;
+        default:
+            return false;
+    }
+    // Batches of A are consecutive rows if B isn't batched, C has the same layout
+    const bool singleMatrix = batch_count_ == 1 || (stride_b_ == 0 && stride_a_ != 0);
+    const bool transposeB = cublas_transpose_b_ == CUBLAS_OP_T;
+    if (!singleMatrix || cublas_transpose_a_ != CUBLAS_OP_N || ld_a_ != k_ || ld_b_ != (transposeB ? k_ : n_) ||
+        ld_c_ != n_) {
+        return false;
+    }
+    const size_t rows = static_cast<size_t>(m_) * batch_count_;
+    if (rows > kernel::Gemv::max_rows) {
+        return false;
+    }
+    const auto& props = context.device().props();
+    gemv_.emplace(kernel::Gemv::Params{elementTypeT,
+                                       rows,
+                                       static_cast<size_t>(k_),
+                                       static_cast<size_t>(n_),
+                                       transposeB,
+                                       gemvActivation,
+                                       alpha_,
+                                       vectorBias ? 0.0f : beta},
+                  static_cast<size_t>(props.multiProcessorCount),
+                  static_cast<size_t>(props.maxThreadsPerBlock));
+    return true;
+}
+
+CUDA::CuBlasLtMatmulDescriptor MatMulOp::CreateLtDescriptor(const void* bias) const {
+    // Products of half precision matrices are accumulated in FP32, so that the epilogue is computed in FP32 too
+    const auto computeType = data_type_ == CUDA_R_32F ? gemm_compute_type_ : CUBLAS_COMPUTE_32F;
+    CUDA::CuBlasLtMatmulDescriptor descriptor{computeType, CUDA_R_32F};
+    descriptor.set(CUBLASLT_MATMUL_DESC_TRANSA, cublas_transpose_b_);
+    descriptor.set(CUBLASLT_MATMUL_DESC_TRANSB, cublas_transpose_a_);
+    descriptor.set(CUBLASLT_MATMUL_DESC_EPILOGUE, epilogue_);
+    if (bias) {
+        descriptor.set(CUBLASLT_MATMUL_DESC_BIAS_POINTER, bias);
+    }
+    return descriptor;
+}
+
+WorkbufferRequest MatMulOp::GetWorkBufferRequest() const {
+    if (gemv_) {
+        const auto workspaceSize = gemv_->workspaceSize();
+        return workspaceSize > 0 ? WorkbufferRequest{{}, {workspaceSize}} : WorkbufferRequest{};
+    }
+    if (lt_algo_ && lt_workspace_size_ > 0) {
+        return {{}, {lt_workspace_size_}};
+    }
+    return {};
+}
+
 void MatMulOp::BroadcastToMatrix(ov::Shape& shape) {
     if (shape.size() < 2) {
         shape.insert(shape.begin(), 2 - shape.size(), 1);
@@ -185,14 +371,50 @@ void MatMulOp::BroadcastToMatrix(ov::Shape& shape) {
 void MatMulOp::Execute(const InferenceRequestContext& context,
                        Inputs inputs,
                        Outputs outputs,
-                       const Workbuffers&) const {
-    OPENVINO_ASSERT(inputs.size() == 2, "Node name: ", GetName());
+                       const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == (epilogue_bias_ ? 3 : 2), "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
     auto& cuBlasHandle = context.getThreadContext().cuBlasHandle();
     auto matrixA = inputs[0];
     auto matrixB = inputs[1];
     auto matrixC = outputs[0];
 
+    if (gemv_) {
+        const bool hasWorkspace = gemv_->workspaceSize() > 0;
+        OPENVINO_ASSERT(!hasWorkspace || workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+        (*gemv_)(context.getThreadContext().stream().get(),
+                 matrixA.get(),
+                 matrixB.get(),
+                 epilogue_bias_ ? inputs[2].get() : nullptr,
+                 matrixC.get(),
+                 hasWorkspace ? workbuffers.mutable_buffers[0].get() : nullptr);
+        return;
+    }
+
+    if (lt_algo_) {
+        const bool hasWorkspace = lt_workspace_size_ > 0;
+        OPENVINO_ASSERT(!hasWorkspace || workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+        // Descriptor refers to the bias of the infer request, so it isn't shared by concurrent executions
+        const auto descriptor = CreateLtDescriptor(epilogue_bias_ ? inputs[2].get() : nullptr);
+        throwIfError(cublasLtMatmul(CUDA::toLtHandle(cuBlasHandle),
+                                    descriptor.get(),
+                                    &alpha_,
+                                    matrixB.get(),
+                                    lt_a_layout_->get(),
+                                    matrixA.get(),
+                                    lt_b_layout_->get(),
+                                    &lt_beta_,
+                                    matrixC.get(),
+                                    lt_c_layout_->get(),
+                                    matrixC.get(),
+                                    lt_c_layout_->get(),
+                                    &lt_algo_.value(),
+                                    hasWorkspace ? workbuffers.mutable_buffers[0].get() : nullptr,
+                                    lt_workspace_size_,
+                                    context.getThreadContext().stream().get()));
+        return;
+    }
+
     /**
      * NOTE: A and B are switched in places. A returns k as leading dimension and B returns n.
      *       Such workaround is done, because cuBlas works with column-major matrices,
@@ -222,7 +444,7 @@ void MatMulOp::Execute(const InferenceRequestContext& context,
                                             ld_c_,
                                             stride_c_,
                                             batch_count_,
-                                            compute_type_,
+                                            gemm_compute_type_,
                                             CUBLAS_GEMM_DEFAULT));
 }
 
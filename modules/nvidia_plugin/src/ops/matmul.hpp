@@ -4,16 +4,25 @@
 
 #pragma once
 
+#include <cuda/blas_lt.hpp>
 #include <cuda/device_pointers.hpp>
 #include <cuda_operation_base.hpp>
+#include <optional>
 #include <transformer/nodes/fully_connected.hpp>
 
 #include "cuda/constant_factory.hpp"
+#include "kernels/gemv.hpp"
 #include "openvino/op/matmul.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * Multiplies matrices by cuBLASLt, so that bias, activation and scaling of FullyConnected are computed by the
+ * epilogue of the matrix multiplication. Types, which aren't supported by cuBLASLt, are multiplied by
+ * cublasGemmStridedBatchedEx. Products of at most kernel::Gemv::max_rows rows, which are bound by reading the
+ * second matrix, are computed by the GEMV kernel
+ */
 class MatMulOp : public OperationCuBlas {
 public:
     using NodeOp = ov::op::v0::MatMul;
@@ -30,9 +39,18 @@ public:
                  const Workbuffers& workbuffers) const override;
 
     bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
 
     int GetBatchCount() const { return batch_count_; }
 
+    /**
+     * @returns true if bias of FullyConnected is added by the epilogue, so that it is passed to Execute() as the
+     * third input instead of being copied to the output
+     */
+    bool HasBiasEpilogue() const { return epilogue_bias_; }
+
+    static constexpr size_t workspace_size = 4 * 1024 * 1024;
+
     /**
      * Get number of batches that equals to product between dimensions in range [matrixShape.begin(),
      * matrixShape.end()-2)
@@ -58,6 +76,15 @@ public:
      */
     static cudaDataType_t GetComputeType(cudaDataType_t abDataType, cudaDataType_t cDataType);
 
+    /**
+     * Get cuBLAS compute type of the given compute data type
+     * @param abDataType A/B matrix data type
+     * @param computeType Compute data type returned by GetComputeType
+     * @param tf32 Whether fp32 matrices may be multiplied by TF32 Tensor Cores (see CreationContext::tf32)
+     * @return cuBLAS compute type
+     */
+    static cublasComputeType_t GetGemmComputeType(cudaDataType_t abDataType, cudaDataType_t computeType, bool tf32);
+
 private:
     /**
      * Broadcast input shapes according OpenVINO documentation:
@@ -69,8 +96,25 @@ private:
     static void BroadcastShapes(
         ov::Shape& matrixAShape, bool& transposeA, ov::Shape& matrixBShape, bool& transposeB, ov::Shape& matrixCShape);
 
+    /**
+     * Creates cuBLASLt layouts and selects an algorithm with the epilogue
+     * @returns false if cuBLASLt doesn't support the multiplication
+     */
+    bool InitLt(const CreationContext& context, cublasLtEpilogue_t epilogue);
+    /**
+     * Creates the GEMV kernel if rows of the product are few and matrices are stored contiguously
+     * @returns false if the kernel doesn't support the multiplication
+     */
+    bool InitGemv(const CreationContext& context,
+                  const ov::element::Type& elementType,
+                  nodes::ActivationMode activation,
+                  bool vectorBias,
+                  float beta);
+    CUDA::CuBlasLtMatmulDescriptor CreateLtDescriptor(const void* bias) const;
+
     cudaDataType_t data_type_ = cudaDataType_t::CUDA_R_32F;
     cudaDataType_t compute_type_ = cudaDataType_t::CUDA_R_32F;
+    cublasComputeType_t gemm_compute_type_ = CUBLAS_COMPUTE_32F;
     int m_ = 0;
     int k_ = 0;
     int n_ = 0;
@@ -84,6 +128,17 @@ private:
     const CUDA::constants::AnyNumeric* beta_ = nullptr;
     cublasOperation_t cublas_transpose_a_ = CUBLAS_OP_N;
     cublasOperation_t cublas_transpose_b_ = CUBLAS_OP_N;
+
+    size_t lt_workspace_size_ = 0;
+    float alpha_ = 1.0f;
+    float lt_beta_ = 0.0f;
+    bool epilogue_bias_ = false;
+    cublasLtEpilogue_t epilogue_ = CUBLASLT_EPILOGUE_DEFAULT;
+    std::optional<CUDA::CuBlasLtMatrixLayout> lt_a_layout_;
+    std::optional<CUDA::CuBlasLtMatrixLayout> lt_b_layout_;
+    std::optional<CUDA::CuBlasLtMatrixLayout> lt_c_layout_;
+    std::optional<cublasLtMatmulAlgo_t> lt_algo_;
+    std::optional<kernel::Gemv> gemv_;
 };
 
 }  // namespace nvidia_gpu
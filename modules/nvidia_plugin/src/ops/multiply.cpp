@@ -2,11 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include <fmt/format.h>
-
 #include <openvino/core/except.hpp>
-#include <sstream>
 
+#include "cuda_implementation_selection.hpp"
 #include "cuda_operation_registry.hpp"
 #include "multiply_cuda.hpp"
 #include "multiply_cudnn.hpp"
@@ -24,20 +22,19 @@ static OperationBase::Ptr multiplyFactory(const CreationContext& context,
     const OperationBase::IndexCollection inputs{inputIds};
     const OperationBase::IndexCollection outputs{outputIds};
 
-    std::stringstream exception_msg;
-    try {
-        return std::make_shared<MultiplyCuDnnOp>(
-            context, node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
-    } catch (const std::exception& e) {
-        exception_msg << "Failed to create MultiplyCuDnn impl: " << e.what();
-    }
-    try {
-        return std::make_shared<MultiplyCudaOp>(
-            context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
-    } catch (const std::exception& e) {
-        exception_msg << "\nFailed to create MultiplyCuda impl: " << e.what();
-    }
-    throw_ov_exception(fmt::format("Multiply node is not supported:\n{}", exception_msg.str()));
+    return createFastestImplementation(
+        context,
+        *node,
+        shapesTuningKey(*node),
+        {{"MultiplyCuDnn",
+          [&] {
+              return std::make_shared<MultiplyCuDnnOp>(
+                  context, node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
+          }},
+         {"MultiplyCuda", [&] {
+              return std::make_shared<MultiplyCudaOp>(
+                  context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
+          }}});
 }
 
 OPERATION_REGISTER_FACTORY(multiplyFactory, Multiply)
@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nhwc_reorder.hpp"
+
+#include <array>
+#include <cuda/constant_factory.hpp>
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+CUDA::DnnTensorDescriptor makeDescriptor(cudnnTensorFormat_t format, cudnnDataType_t type, const ov::Shape& shape) {
+    std::array<int, CUDNN_DIM_MAX> dims{};
+    std::copy(shape.begin(), shape.end(), dims.begin());
+    return CUDA::DnnTensorDescriptor{}.set(format, type, static_cast<int>(shape.size()), dims.data());
+}
+
+}  // namespace
+
+NhwcReorderOp::NhwcReorderOp(const CreationContext& context,
+                             const NodeOp& node,
+                             IndexCollection&& inputIds,
+                             IndexCollection&& outputIds)
+    : OperationCuDnn{context, node, std::move(inputIds), std::move(outputIds)},
+      data_type_{convertDataType<cudnnDataType_t>(node.get_input_element_type(0))},
+      input_desc_{makeDescriptor(node.is_to_nhwc() ? CUDNN_TENSOR_NCHW : CUDNN_TENSOR_NHWC,
+                                 data_type_,
+                                 node.get_input_shape(0))},
+      output_desc_{makeDescriptor(node.is_to_nhwc() ? CUDNN_TENSOR_NHWC : CUDNN_TENSOR_NCHW,
+                                  data_type_,
+                                  node.get_output_shape(0))} {
+    OPENVINO_ASSERT(node.get_input_size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+}
+
+void NhwcReorderOp::Execute(const InferenceRequestContext& context,
+                            Inputs inputTensors,
+                            Outputs outputTensors,
+                            const Workbuffers&) const {
+    OPENVINO_ASSERT(inputTensors.size() == 1 && outputTensors.size() == 1, "Node name: ", GetName());
+    throwIfError(::cudnnTransformTensor(context.getThreadContext().dnnHandle().get(),
+                                        &CUDA::NumericConst<CUDA::constants::one>(data_type_),
+                                        input_desc_.get(),
+                                        inputTensors[0].get(),
+                                        &CUDA::NumericConst<CUDA::constants::zero>(data_type_),
+                                        output_desc_.get(),
+                                        outputTensors[0].get()));
+}
+
+bool NhwcReorderOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(NhwcReorderOp, NhwcReorder);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/dnn.hpp>
+#include <cuda_operation_base.hpp>
+#include <transformer/nodes/nhwc_reorder.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Reorders a tensor between NCHW and NHWC order in memory by cudnnTransformTensor()
+ */
+class NhwcReorderOp : public OperationCuDnn {
+public:
+    using NodeOp = nodes::NhwcReorder;
+    NhwcReorderOp(const CreationContext& context,
+                  const NodeOp& node,
+                  IndexCollection&& inputIds,
+                  IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    cudnnDataType_t data_type_;
+    CUDA::DnnTensorDescriptor input_desc_;
+    CUDA::DnnTensorDescriptor output_desc_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
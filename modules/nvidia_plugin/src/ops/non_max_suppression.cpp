@@ -0,0 +1,60 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_max_suppression.hpp"
+
+#include <algorithm>
+#include <cuda_operation_registry.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+NonMaxSuppressionOp::NonMaxSuppressionOp(const CreationContext& context,
+                                         const NodeOp& node,
+                                         IndexCollection&& inputIds,
+                                         IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    const auto& boxesShape = node.get_input_shape(0);
+    const auto& scoresShape = node.get_input_shape(1);
+    OPENVINO_ASSERT(boxesShape[0] == scoresShape[0] && boxesShape[1] == scoresShape[2], "Node name: ", GetName());
+    const kernel::NonMaxSuppression::Params params{
+        convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+        convertDataType<kernel::Type_t>(node.get_output_type()),
+        scoresShape[0],
+        scoresShape[1],
+        scoresShape[2],
+        static_cast<size_t>(node.get_max_output_boxes_per_class()),
+        node.get_iou_threshold(),
+        node.get_score_threshold(),
+        node.is_center_point_box(),
+        node.is_sort_result_descending()};
+    kernel_.emplace(params, static_cast<size_t>(context.device().props().maxThreadsPerBlock));
+}
+
+void NonMaxSuppressionOp::Execute(const InferenceRequestContext& context,
+                                  Inputs inputTensors,
+                                  Outputs outputTensors,
+                                  const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputTensors.size() == 2 && outputTensors.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputTensors[0].get(),
+               inputTensors[1].get(),
+               outputTensors[0].get(),
+               outputTensors[1].get(),
+               outputTensors[2].get(),
+               workbuffers.mutable_buffers[0].get());
+}
+
+bool NonMaxSuppressionOp::IsCudaGraphCompatible() const { return true; }
+
+WorkbufferRequest NonMaxSuppressionOp::GetWorkBufferRequest() const {
+    return {{}, {std::max<size_t>(kernel_.value().workspaceSize(), 1)}};
+}
+
+OPERATION_REGISTER(NonMaxSuppressionOp, NonMaxSuppression);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,37 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/non_max_suppression.hpp>
+
+#include "kernels/non_max_suppression.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class NonMaxSuppressionOp : public OperationBase {
+public:
+    using NodeOp = nodes::NonMaxSuppression;
+    NonMaxSuppressionOp(const CreationContext& context,
+                        const NodeOp& node,
+                        IndexCollection&& inputIds,
+                        IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::NonMaxSuppression> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
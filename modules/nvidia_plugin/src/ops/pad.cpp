@@ -8,6 +8,7 @@
 
 #include "converters.hpp"
 #include "cuda/runtime.hpp"
+#include "cuda_op_buffers_extractor.hpp"
 #include "cuda_operation_registry.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/op/constant.hpp"
@@ -43,13 +44,23 @@ PadOp::PadOp(const CreationContext& context,
       dst_shape_{node.get_output_shape(0)} {
     OPENVINO_ASSERT(node.get_input_element_type(0) == node.get_output_element_type(0), "Node name: ", GetName());
     OPENVINO_ASSERT(ov::op::PadMode::CONSTANT == node.get_pad_mode(), "Node name: ", GetName());
+    if (OperationBuffersExtractor::isTailPadNode(node)) {
+        tail_offset_ = OperationBuffersExtractor::GetTensorByteSize(node.input(0));
+        tail_size_ = OperationBuffersExtractor::GetTensorByteSize(node.output(0)) - tail_offset_;
+    }
 }
 
 void PadOp::Execute(const InferenceRequestContext& context,
                     Inputs inputTensors,
                     Outputs outputTensors,
                     const Workbuffers& workbuffers) const {
-    kernel_(context.getThreadContext().stream().get(),
+    auto& stream = context.getThreadContext().stream();
+    if (tail_offset_ > 0 && inputTensors[InputIndex::kSrc].get() == outputTensors[OutputIndex::kDst].get()) {
+        // Output was extracted into the buffer of the input, so only the appended zeros are written
+        stream.memset(outputTensors[OutputIndex::kDst] + static_cast<std::ptrdiff_t>(tail_offset_), 0, tail_size_);
+        return;
+    }
+    kernel_(stream.get(),
             inputTensors[InputIndex::kSrc].get(),
             outputTensors[OutputIndex::kDst].get(),
             inputTensors[InputIndex::kPadsBegin].get(),
@@ -47,6 +47,9 @@ private:
     kernel::ConstModePad kernel_;
     ov::Shape src_shape_;
     ov::Shape dst_shape_;
+    // Byte offset and size of the zeros appended after the input (see OperationBuffersExtractor::isTailPadNode)
+    std::size_t tail_offset_ = 0;
+    std::size_t tail_size_ = 0;
 };
 
 }  // namespace nvidia_gpu
@@ -6,6 +6,7 @@
 
 #include <cuda_runtime.h>
 
+#include <cstdint>
 #include <cuda_operation_registry.hpp>
 #include <openvino/core/except.hpp>
 #include <cuda_runtime_api.h>
@@ -27,23 +28,106 @@ void ParameterOp::Execute(const InferenceRequestContext& context,
                           const Workbuffers&) const {
     OPENVINO_ASSERT(inputs.size() == 0, "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
-    OPENVINO_ASSERT(context.getTensorMappingContext().has_input_tensor(input_tensor_name_), "Node name: ", GetName());
-    auto tensor = context.getTensorMappingContext().get_input_tensor(input_tensor_name_);
-    context.getThreadContext().stream().upload(outputs[0], tensor->data(), tensor->get_byte_size());
+    const auto& threadContext = context.getThreadContext();
+    if (pack_) {
+        if (!is_pack_uploader_) {
+            return;
+        }
+        auto* dst = static_cast<std::uint8_t*>(outputs[0].get());
+        if (const void* src = packedInputs(context.getTensorMappingContext(), *pack_)) {
+            threadContext.uploadStream().copy(dst, src, pack_->size);
+        } else {
+            for (const auto& entry : pack_->entries) {
+                upload(context, entry.name, dst + entry.offset);
+            }
+        }
+        threadContext.joinUpload();
+        return;
+    }
+    if (upload(context, input_tensor_name_, outputs[0].get())) {
+        threadContext.joinUpload();
+    }
+}
+
+bool ParameterOp::upload(const InferenceRequestContext& context, const std::string& name, void* dst) {
+    OPENVINO_ASSERT(context.getTensorMappingContext().has_input_tensor(name), "Input name: ", name);
+    const auto& threadContext = context.getThreadContext();
+    const auto& samples = context.getTensorMappingContext().get_input_samples(name);
+    if (!samples.empty()) {
+        // Samples set by set_tensors() are uploaded into their slices of the batch without host concatenation
+        auto* sampleDst = static_cast<std::uint8_t*>(dst);
+        for (const auto& sample : samples) {
+            threadContext.uploadStream().copy(sampleDst, sample->data(), sample->get_byte_size());
+            sampleDst += sample->get_byte_size();
+        }
+        return true;
+    }
+    auto tensor = context.getTensorMappingContext().get_input_tensor(name);
+    if (dst == tensor->data()) {
+        // Input tensor is bound directly as external buffer
+        return false;
+    }
+    // Tensor may reside either in host or device memory (remote tensor), so direction is deduced by UVA.
+    // Transfer is performed on the upload stream, so it may overlap with computations of other inference
+    threadContext.uploadStream().copy(dst, tensor->data(), tensor->get_byte_size());
+    return true;
 }
 
 bool ParameterOp::IsCudaGraphCompatible() const { return true; }
 
 std::string ParameterOp::GetInputTensorName(const ov::Node& node) { return node.get_friendly_name(); }
 
+void ParameterOp::SetPack(std::shared_ptr<const IoPack> pack) {
+    is_pack_uploader_ = pack->entries.front().name == input_tensor_name_;
+    pack_ = std::move(pack);
+}
+
 void ParameterOp::Capture(InferenceRequestContext &context, Inputs inputs, Outputs outputs,
                           const Workbuffers&) const {
     OPENVINO_ASSERT(inputs.size() == 0, "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
-    OPENVINO_ASSERT(context.getTensorMappingContext().has_input_tensor(input_tensor_name_), "Node name: ", GetName());
-    auto tensor = context.getTensorMappingContext().get_input_tensor(input_tensor_name_);
-    context.getCudaGraphContext().add_parameter(
-        input_tensor_name_, context.getThreadContext().stream(), outputs[0], tensor->data(), tensor->get_byte_size());
+    if (pack_) {
+        if (!is_pack_uploader_) {
+            return;
+        }
+        auto* dst = static_cast<std::uint8_t*>(outputs[0].get());
+        if (const void* src = packedInputs(context.getTensorMappingContext(), *pack_)) {
+            context.getCudaGraphContext().add_packed_parameters(
+                pack_, context.getThreadContext().stream(), outputs[0], src);
+        } else {
+            for (const auto& entry : pack_->entries) {
+                captureUpload(context, entry.name, dst + entry.offset);
+            }
+        }
+        return;
+    }
+    captureUpload(context, input_tensor_name_, outputs[0].get());
+}
+
+void ParameterOp::captureUpload(InferenceRequestContext& context, const std::string& name, void* dst) {
+    OPENVINO_ASSERT(context.getTensorMappingContext().has_input_tensor(name), "Input name: ", name);
+    const auto& samples = context.getTensorMappingContext().get_input_samples(name);
+    if (!samples.empty()) {
+        auto* sampleDst = static_cast<std::uint8_t*>(dst);
+        for (const auto& sample : samples) {
+            context.getCudaGraphContext().add_parameter(name,
+                                                        context.getThreadContext().stream(),
+                                                        CUDA::DevicePointer<void*>{sampleDst},
+                                                        sample->data(),
+                                                        sample->get_byte_size());
+            sampleDst += sample->get_byte_size();
+        }
+        return;
+    }
+    auto tensor = context.getTensorMappingContext().get_input_tensor(name);
+    if (dst == tensor->data()) {
+        return;
+    }
+    context.getCudaGraphContext().add_parameter(name,
+                                                context.getThreadContext().stream(),
+                                                CUDA::DevicePointer<void*>{dst},
+                                                tensor->data(),
+                                                tensor->get_byte_size());
 }
 
 OPERATION_REGISTER(ParameterOp, Parameter);
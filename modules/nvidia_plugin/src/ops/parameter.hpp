@@ -5,7 +5,9 @@
 #pragma once
 
 #include <cuda/device_pointers.hpp>
+#include <cuda_io_pack.hpp>
 #include <cuda_operation_base.hpp>
+#include <memory>
 
 namespace ov {
 namespace nvidia_gpu {
@@ -30,8 +32,23 @@ public:
     bool IsCudaGraphCompatible() const override;
     static std::string GetInputTensorName(const ov::Node& node);
 
+    /**
+     * Makes the input a part of the pack of inputs. The operation of the first entry of the pack uploads
+     * the whole pack, operations of other entries do nothing
+     */
+    void SetPack(std::shared_ptr<const IoPack> pack);
+
 private:
+    /**
+     * Uploads the input into the buffer on the upload stream
+     * @returns false if nothing is uploaded, since the tensor is bound as the buffer directly
+     */
+    static bool upload(const InferenceRequestContext& context, const std::string& name, void* dst);
+    static void captureUpload(InferenceRequestContext& context, const std::string& name, void* dst);
+
     std::string input_tensor_name_;
+    std::shared_ptr<const IoPack> pack_;
+    bool is_pack_uploader_ = false;
 };
 
 }  // namespace nvidia_gpu
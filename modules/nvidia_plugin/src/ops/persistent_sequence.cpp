@@ -0,0 +1,126 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "persistent_sequence.hpp"
+
+#include <limits>
+#include <openvino/core/except.hpp>
+#include <openvino/op/add.hpp>
+#include <openvino/op/divide.hpp>
+#include <openvino/op/maximum.hpp>
+#include <openvino/op/minimum.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/relu.hpp>
+#include <openvino/op/sigmoid.hpp>
+#include <openvino/op/subtract.hpp>
+#include <openvino/op/tanh.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+OperationBase::IndexCollection concatIds(const std::vector<OperationBase::Ptr>& operations, bool inputs) {
+    OperationBase::IndexCollection ids;
+    for (const auto& operation : operations) {
+        const auto operationIds = inputs ? operation->GetInputIds() : operation->GetOutputIds();
+        ids.insert(ids.end(), operationIds.begin(), operationIds.end());
+    }
+    return ids;
+}
+
+}  // namespace
+
+PersistentSequenceOp::PersistentSequenceOp(const CreationContext& context,
+                                           const std::vector<std::shared_ptr<ov::Node>>& nodes,
+                                           const std::vector<OperationBase::Ptr>& operations)
+    : OperationBase{context, *nodes.front(), concatIds(operations, true), concatIds(operations, false)} {
+    OPENVINO_ASSERT(nodes.size() == operations.size(), "Node name: ", GetName());
+    OPENVINO_ASSERT(nodes.size() <= kernel::PersistentSequence::max_steps, "Node name: ", GetName());
+    type_name_ = "PersistentSequence";
+    const auto elementType = nodes.front()->get_output_element_type(0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& node = *nodes[i];
+        const auto op = step(node, std::numeric_limits<size_t>::max());
+        OPENVINO_ASSERT(op, "Node name: ", node.get_friendly_name());
+        OPENVINO_ASSERT(node.get_output_element_type(0) == elementType, "Node name: ", node.get_friendly_name());
+        OPENVINO_ASSERT(operations[i]->GetInputIds().size() == node.get_input_size() &&
+                            operations[i]->GetOutputIds().size() == 1,
+                        "Node name: ",
+                        node.get_friendly_name());
+        steps_.push_back({*op,
+                          static_cast<unsigned>(ov::shape_size(node.get_output_shape(0))),
+                          static_cast<unsigned>(node.get_input_size())});
+    }
+    const size_t maxThreadsPerBlock = context.device().props().maxThreadsPerBlock;
+    kernel_.emplace(convertDataType<ov::nvidia_gpu::kernel::Type_t>(elementType), maxThreadsPerBlock);
+}
+
+void PersistentSequenceOp::Execute(const InferenceRequestContext& context,
+                                   Inputs inputTensors,
+                                   Outputs outputTensors,
+                                   const Workbuffers&) const {
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputTensors.size() == steps_.size(), "Node name: ", GetName());
+    kernel::PersistentSequence::Steps steps;
+    size_t input = 0;
+    for (size_t i = 0; i < steps_.size(); ++i) {
+        const auto& step = steps_[i];
+        auto& kernelStep = steps.steps[i];
+        kernelStep.op = step.op;
+        kernelStep.size = step.size;
+        kernelStep.a = inputTensors[input].get();
+        kernelStep.b = step.num_inputs > 1 ? inputTensors[input + 1].get() : nullptr;
+        kernelStep.y = outputTensors[i].get();
+        input += step.num_inputs;
+    }
+    steps.count = static_cast<unsigned>(steps_.size());
+    (*kernel_)(context.getThreadContext().stream().get(), steps);
+}
+
+std::optional<PersistentSequenceOp::Op> PersistentSequenceOp::step(const ov::Node& node, size_t max_elements) {
+    std::optional<Op> op;
+    if (ov::is_type<ov::op::v1::Add>(&node)) {
+        op = Op::Add;
+    } else if (ov::is_type<ov::op::v1::Subtract>(&node)) {
+        op = Op::Subtract;
+    } else if (ov::is_type<ov::op::v1::Multiply>(&node)) {
+        op = Op::Multiply;
+    } else if (ov::is_type<ov::op::v1::Divide>(&node)) {
+        op = Op::Divide;
+    } else if (ov::is_type<ov::op::v1::Maximum>(&node)) {
+        op = Op::Maximum;
+    } else if (ov::is_type<ov::op::v1::Minimum>(&node)) {
+        op = Op::Minimum;
+    } else if (ov::is_type<ov::op::v0::Relu>(&node)) {
+        op = Op::Relu;
+    } else if (ov::is_type<ov::op::v0::Sigmoid>(&node)) {
+        op = Op::Sigmoid;
+    } else if (ov::is_type<ov::op::v0::Tanh>(&node)) {
+        op = Op::Tanh;
+    }
+    if (!op || node.get_output_size() != 1 || node.get_output_partial_shape(0).is_dynamic()) {
+        return std::nullopt;
+    }
+    const auto elementType = node.get_output_element_type(0);
+    if (elementType != ov::element::f32 && elementType != ov::element::f16) {
+        return std::nullopt;
+    }
+    const auto& shape = node.get_output_shape(0);
+    const auto numElements = ov::shape_size(shape);
+    if (numElements == 0 || numElements > max_elements || numElements > std::numeric_limits<unsigned>::max()) {
+        return std::nullopt;
+    }
+    for (size_t i = 0; i < node.get_input_size(); ++i) {
+        if (node.get_input_element_type(i) != elementType || node.get_input_partial_shape(i) != shape) {
+            return std::nullopt;
+        }
+    }
+    return op;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
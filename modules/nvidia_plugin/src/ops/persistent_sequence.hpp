@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/persistent_sequence.hpp>
+#include <optional>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Executes operations of small element-wise nodes, which follow each other in the execution sequence, by one launch
+ * of kernel::PersistentSequence instead of a launch per node (see ov::nvidia_gpu::persistent_kernel_max_elements).
+ * It isn't created from a node of the model, but replaces operations of the nodes in SubGraph, so its inputs and
+ * outputs are the inputs and outputs of the nodes in their order
+ */
+class PersistentSequenceOp : public OperationBase {
+public:
+    using Op = kernel::PersistentSequence::Op;
+
+    /**
+     * @param nodes Nodes, for which step() returns the step, of the same element type
+     * @param operations Operations of the nodes
+     */
+    PersistentSequenceOp(const CreationContext& context,
+                         const std::vector<std::shared_ptr<ov::Node>>& nodes,
+                         const std::vector<OperationBase::Ptr>& operations);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override { return true; }
+
+    /**
+     * @returns Step which computes the node, std::nullopt if the node isn't a supported element-wise operation
+     *          without broadcasting, or its output has more than max_elements elements
+     */
+    static std::optional<Op> step(const ov::Node& node, size_t max_elements);
+
+private:
+    struct Step {
+        Op op;
+        unsigned size;
+        unsigned num_inputs;
+    };
+
+    std::vector<Step> steps_;
+    std::optional<kernel::PersistentSequence> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,90 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "proposal.hpp"
+
+#include <algorithm>
+#include <cuda/runtime.hpp>
+#include <cuda_operation_registry.hpp>
+#include <openvino/op/proposal.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+ProposalOp::ProposalOp(const CreationContext& context,
+                       const ov::Node& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    const auto proposal = dynamic_cast<const ov::op::v0::Proposal*>(&node);
+    OPENVINO_ASSERT(proposal, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_input_size() == 3, "Node name: ", GetName());
+    const auto& attrs = proposal->get_attrs();
+    if (!attrs.framework.empty() && attrs.framework != "caffe") {
+        throw_ov_exception(fmt::format("Proposal {} of framework {} is not supported", GetName(), attrs.framework));
+    }
+    const auto& probsShape = node.get_input_shape(0);
+    const auto& imageShape = node.get_input_shape(2);
+    OPENVINO_ASSERT(probsShape.size() == 4 && imageShape.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(probsShape[1] == 2 * attrs.ratio.size() * attrs.scale.size(), "Node name: ", GetName());
+    OPENVINO_ASSERT(imageShape[0] == 3 || imageShape[0] == 4, "Node name: ", GetName());
+
+    kernel::Proposal::Params params{};
+    params.element_type = convertDataType<kernel::Type_t>(node.get_input_element_type(0));
+    params.num_batches = probsShape[0];
+    params.height = probsShape[2];
+    params.width = probsShape[3];
+    params.image_shape_size = imageShape[0];
+    params.base_size = attrs.base_size;
+    params.pre_nms_topn = attrs.pre_nms_topn;
+    params.post_nms_topn = attrs.post_nms_topn;
+    params.nms_thresh = attrs.nms_thresh;
+    params.feat_stride = attrs.feat_stride;
+    params.min_size = attrs.min_size;
+    params.ratio = attrs.ratio;
+    params.scale = attrs.scale;
+    params.clip_before_nms = attrs.clip_before_nms;
+    params.clip_after_nms = attrs.clip_after_nms;
+    params.normalize = attrs.normalize;
+    params.box_size_scale = attrs.box_size_scale;
+    params.box_coordinate_scale = attrs.box_coordinate_scale;
+    kernel_.emplace(params, static_cast<size_t>(context.device().props().maxThreadsPerBlock));
+}
+
+void ProposalOp::Execute(const InferenceRequestContext& context,
+                         Inputs inputTensors,
+                         Outputs outputTensors,
+                         const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputTensors.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.immutable_buffers.size() == 1 && workbuffers.mutable_buffers.size() == 1,
+                    "Node name: ",
+                    GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputTensors[0].get(),
+               inputTensors[1].get(),
+               inputTensors[2].get(),
+               workbuffers.immutable_buffers[0].get(),
+               outputTensors[0].get(),
+               outputTensors.size() > 1 ? outputTensors[1].get() : nullptr,
+               workbuffers.mutable_buffers[0].get());
+}
+
+bool ProposalOp::IsCudaGraphCompatible() const { return true; }
+
+void ProposalOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
+    OPENVINO_ASSERT(buffers.size() == 1, "Node name: ", GetName());
+    const auto anchors = kernel_.value().anchors();
+    CUDA::DefaultStream::stream().upload(buffers[0], anchors.data(), kernel_.value().anchorsSize());
+}
+
+WorkbufferRequest ProposalOp::GetWorkBufferRequest() const {
+    return {{std::max<size_t>(kernel_.value().anchorsSize(), 1)},
+            {std::max<size_t>(kernel_.value().workspaceSize(), 1)}};
+}
+
+OPERATION_REGISTER(ProposalOp, Proposal);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/proposal.hpp>
+#include <optional>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Proposal-1 and Proposal-4, which also outputs scores of proposals, of the Caffe framework
+ */
+class ProposalOp : public OperationBase {
+public:
+    ProposalOp(const CreationContext& context,
+               const ov::Node& node,
+               IndexCollection&& inputIds,
+               IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+    void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::Proposal> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "quantized_matmul.hpp"
+
+#include <cuda/blas.hpp>
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr int32_t kOne = 1;
+constexpr int32_t kZero = 0;
+
+}  // namespace
+
+QuantizedMatMulOp::QuantizedMatMulOp(const CreationContext& context,
+                                     const NodeOp& node,
+                                     IndexCollection&& inputIds,
+                                     IndexCollection&& outputIds)
+    : OperationCuBlas(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3 || node.get_input_size() == 4, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    const auto& input_shape = node.get_input_shape(0);
+    OPENVINO_ASSERT(!input_shape.empty(), "Node name: ", GetName());
+    k_ = input_shape.back();
+    n_ = node.get_input_shape(1)[0];
+    rows_ = ov::shape_size(input_shape) / k_;
+    has_bias_ = node.has_bias();
+    OPENVINO_ASSERT(k_ != 0 && n_ != 0 && rows_ != 0, "Node name: ", GetName());
+    // Int8 cuBLAS GEMM requires leading dimensions to be multiples of 4
+    OPENVINO_ASSERT(k_ % 4 == 0 && n_ % 4 == 0, "Node name: ", GetName());
+    OPENVINO_ASSERT(!has_bias_ || ov::shape_size(node.get_input_shape(3)) == rows_ * n_, "Node name: ", GetName());
+
+    const auto max_threads_per_block = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    kernel_ = kernel::QuantizedMatMul{convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                                      rows_,
+                                      k_,
+                                      n_,
+                                      node.get_input_low(),
+                                      node.get_input_high(),
+                                      node.get_levels(),
+                                      max_threads_per_block};
+}
+
+WorkbufferRequest QuantizedMatMulOp::GetWorkBufferRequest() const {
+    return {{}, {rows_ * k_ * sizeof(int8_t), rows_ * n_ * sizeof(int32_t)}};
+}
+
+void QuantizedMatMulOp::Execute(const InferenceRequestContext& context,
+                                Inputs inputs,
+                                Outputs outputs,
+                                const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == (has_bias_ ? 4 : 3), "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 2, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    auto& stream = context.getThreadContext().stream();
+    auto quantized = workbuffers.mutable_buffers[0];
+    auto acc = workbuffers.mutable_buffers[1];
+
+    kernel_->quantize(stream.get(), inputs[0].get(), quantized.get());
+    /**
+     * NOTE: Weights W [n, k] are row-major, so C [rows, n] = A [rows, k] x Wt
+     *       is computed by cuBLAS in column-major as Ct = W x At
+     */
+    throwIfError(cublasGemmEx(context.getThreadContext().cuBlasHandle().get(),
+                              CUBLAS_OP_T,
+                              CUBLAS_OP_N,
+                              n_,
+                              rows_,
+                              k_,
+                              &kOne,
+                              inputs[1].get(),
+                              CUDA_R_8I,
+                              k_,
+                              quantized.get(),
+                              CUDA_R_8I,
+                              k_,
+                              &kZero,
+                              acc.get(),
+                              CUDA_R_32I,
+                              n_,
+                              CUBLAS_COMPUTE_32I,
+                              CUBLAS_GEMM_DEFAULT));
+    const void* bias = has_bias_ ? inputs[3].get() : nullptr;
+    kernel_->dequantize(stream.get(), acc.get(), inputs[2].get(), bias, outputs[0].get());
+}
+
+bool QuantizedMatMulOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(QuantizedMatMulOp, QuantizedMatMul);
+}  // namespace nvidia_gpu
+}  // namespace ov
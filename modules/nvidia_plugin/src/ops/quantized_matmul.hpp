@@ -0,0 +1,44 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/quantized_matmul.hpp>
+
+#include "kernels/quantized_matmul.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Multiplies fake quantized activations by i8 weights with int8 cuBLAS GEMM: activations are quantized into
+ * a mutable work buffer, products are accumulated in i32 and dequantized into the output
+ */
+class QuantizedMatMulOp : public OperationCuBlas {
+public:
+    using NodeOp = nodes::QuantizedMatMul;
+    QuantizedMatMulOp(const CreationContext& context,
+                      const NodeOp& node,
+                      IndexCollection&& inputIds,
+                      IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    size_t rows_ = 0;
+    size_t k_ = 0;
+    size_t n_ = 0;
+    bool has_bias_ = false;
+    std::optional<kernel::QuantizedMatMul> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,51 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "read_value.hpp"
+
+#include <cstdint>
+#include <cuda_op_buffers_extractor.hpp>
+#include <cuda_operation_registry.hpp>
+#include <cuda_variable_state.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+namespace ov {
+namespace nvidia_gpu {
+
+ReadValueOp::ReadValueOp(const CreationContext& context,
+                         const NodeOp& node,
+                         IndexCollection&& inputIds,
+                         IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)),
+      size_{OperationBuffersExtractor::GetTensorByteSize(node.output(0))} {
+    OPENVINO_ASSERT(node.get_input_size() <= 1, "Node name: ", GetName());
+    if (node.get_input_size() > 0) {
+        kernel_.emplace(size_, context.device().props().maxThreadsPerBlock);
+    }
+}
+
+void ReadValueOp::Execute(const InferenceRequestContext& context,
+                          Inputs inputTensors,
+                          Outputs outputTensors,
+                          const Workbuffers&) const {
+    OPENVINO_ASSERT(inputTensors.size() == (kernel_ ? 2 : 1), "Node name: ", GetName());
+    OPENVINO_ASSERT(outputTensors.size() == 1, "Node name: ", GetName());
+    const auto& stream = context.getThreadContext().stream();
+    const auto state = inputTensors[inputTensors.size() - 1];
+    if (kernel_) {
+        const auto initialized = reinterpret_cast<const bool*>(static_cast<const std::uint8_t*>(state.get()) +
+                                                               VariableState::initializedFlagOffset(size_));
+        (*kernel_)(stream.get(), initialized, inputTensors[0].get(), state.get(), outputTensors[0].get());
+    } else if (outputTensors[0].get() != state.get()) {
+        stream.transfer(outputTensors[0], state, size_);
+    }
+}
+
+bool ReadValueOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(ReadValueOp, ReadValue);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,42 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/read_value.hpp>
+#include <openvino/op/util/read_value_base.hpp>
+#include <optional>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Reads state of the variable, which is the last input of the operation (see VariableState).
+ *
+ * Output is usually the state itself, so there is nothing to copy. The initial value (the first input of
+ * ReadValue, if any) is taken while the state isn't initialized.
+ */
+class ReadValueOp : public OperationBase {
+public:
+    using NodeOp = ov::op::util::ReadValueBase;
+    ReadValueOp(const CreationContext& context,
+                const NodeOp& node,
+                IndexCollection&& inputIds,
+                IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::size_t size_;
+    std::optional<kernel::ReadValue> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -32,29 +32,76 @@ cudnnDataType_t ReduceOp::reduceCompType(const ov::Node& node) {
     }
 }
 
+std::optional<kernel::Reduce> ReduceOp::makeKernel(const CreationContext& context,
+                                                  const ov::Node& node,
+                                                  kernel::Reduce::Op op) {
+    const auto element_type = convertDataType<kernel::Type_t>(node.get_input_element_type(0));
+    if (!kernel::Reduce::isTypeSupported(element_type)) {
+        return std::nullopt;
+    }
+    // The input is viewed as [outer, length, inner], which requires the reduced axes to be contiguous
+    // once the axes of size 1 are skipped
+    const auto& in_shape = node.get_input_shape(0);
+    const auto& out_shape = node.get_output_shape(0);
+    size_t outer = 1;
+    size_t length = 1;
+    size_t inner = 1;
+    for (size_t i = 0; i < in_shape.size(); ++i) {
+        if (in_shape[i] == 1) {
+            continue;
+        }
+        if (out_shape[i] != in_shape[i]) {
+            if (inner > 1) {
+                return std::nullopt;
+            }
+            length *= in_shape[i];
+        } else if (length > 1) {
+            inner *= in_shape[i];
+        } else {
+            outer *= in_shape[i];
+        }
+    }
+    const auto num_multiprocessors = static_cast<size_t>(context.device().props().multiProcessorCount);
+    return kernel::Reduce{element_type, op, outer, length, inner, num_multiprocessors};
+}
+
 ReduceOp::ReduceOp(const CreationContext& context,
                    const ov::Node& node,
                    IndexCollection&& inputIds,
                    IndexCollection&& outputIds,
-                   const CUDA::DnnReduceTensorDescriptor& reduce_desc)
+                   const CUDA::DnnReduceTensorDescriptor& reduce_desc,
+                   kernel::Reduce::Op op)
     : OperationCuDnn{context, node, move(inputIds), move(outputIds)},
       comp_type_{reduceCompType(node)},
-      a_desc_{CUDA::makeInputDnnTensorDescr(node, 0)},
-      c_desc_{CUDA::makeOutputDnnTensorDescr(node, 0)},
       reduce_desc_(reduce_desc),
-      workspace_size_{context.dnnHandle().getReductionWorkspaceSize(reduce_desc_, a_desc_, c_desc_)} {}
+      kernel_{makeKernel(context, node, op)} {
+    if (kernel_) {
+        workspace_size_ = kernel_->workspaceSize();
+    } else {
+        a_desc_.emplace(CUDA::makeInputDnnTensorDescr(node, 0));
+        c_desc_.emplace(CUDA::makeOutputDnnTensorDescr(node, 0));
+        workspace_size_ = context.dnnHandle().getReductionWorkspaceSize(reduce_desc_, *a_desc_, *c_desc_);
+    }
+}
 
 void ReduceOp::Execute(const InferenceRequestContext& context,
-                          Inputs inputTensors,
-                          Outputs outputTensors,
-                          const Workbuffers& workbuffers) const {
+                       Inputs inputTensors,
+                       Outputs outputTensors,
+                       const Workbuffers& workbuffers) const {
+    if (kernel_) {
+        (*kernel_)(context.getThreadContext().stream().get(),
+                   inputTensors[0].get(),
+                   outputTensors[0].get(),
+                   workspace_size_ > 0 ? workbuffers.mutable_buffers[0].get() : nullptr);
+        return;
+    }
     context.getThreadContext().dnnHandle().reduceTensor(reduce_desc_,
                                                         workbuffers.createMutableSpanFrom<0>(workspace_size_),
                                                         CUDA::DnnScaleFactorOne{comp_type_},
-                                                        a_desc_,
+                                                        *a_desc_,
                                                         inputTensors[0],
                                                         CUDA::DnnScaleFactorZero{comp_type_},
-                                                        c_desc_,
+                                                        *c_desc_,
                                                         outputTensors[0]);
 }
 
@@ -5,17 +5,25 @@
 #pragma once
 
 #include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/reduce.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * Reductions over a contiguous range of axes of f32, f16 and bf16 tensors run on the native kernel::Reduce,
+ * the others on cudnnReduceTensor.
+ */
 class ReduceOp : public OperationCuDnn {
 public:
     ReduceOp(const CreationContext& context,
              const ov::Node& node,
              IndexCollection&& inputIds,
              IndexCollection&& outputIds,
-             const CUDA::DnnReduceTensorDescriptor& reduce_desc);
+             const CUDA::DnnReduceTensorDescriptor& reduce_desc,
+             kernel::Reduce::Op op);
 
     void Execute(const InferenceRequestContext& context,
                  Inputs inputTensors,
@@ -28,10 +36,15 @@ public:
     static cudnnDataType_t reduceCompType(const ov::Node& node);
 
 private:
+    static std::optional<kernel::Reduce> makeKernel(const CreationContext& context,
+                                                    const ov::Node& node,
+                                                    kernel::Reduce::Op op);
+
     cudnnDataType_t comp_type_;
     CUDA::DnnReduceTensorDescriptor reduce_desc_;
-    CUDA::DnnTensorDescriptor a_desc_;
-    CUDA::DnnTensorDescriptor c_desc_;
+    std::optional<kernel::Reduce> kernel_;
+    std::optional<CUDA::DnnTensorDescriptor> a_desc_;
+    std::optional<CUDA::DnnTensorDescriptor> c_desc_;
     size_t workspace_size_;
 };
 
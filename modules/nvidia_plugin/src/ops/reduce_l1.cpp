@@ -0,0 +1,25 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_operation_registry.hpp"
+#include "reduce_l1.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+ReduceL1Op::ReduceL1Op(const CreationContext& context,
+                       const ov::Node& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds)
+    : ReduceOp(context,
+               node,
+               move(inputIds),
+               move(outputIds),
+               CUDA::DnnReduceNorm1Descriptor(reduceCompType(node)),
+               kernel::Reduce::Op::L1) {}
+
+OPERATION_REGISTER(ReduceL1Op, ReduceL1);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,21 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "reduce.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class ReduceL1Op : public ReduceOp {
+public:
+    explicit ReduceL1Op(const CreationContext& context,
+                        const ov::Node& node,
+                        IndexCollection&& inputIds,
+                        IndexCollection&& outputIds);
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,25 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_operation_registry.hpp"
+#include "reduce_l2.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+ReduceL2Op::ReduceL2Op(const CreationContext& context,
+                       const ov::Node& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds)
+    : ReduceOp(context,
+               node,
+               move(inputIds),
+               move(outputIds),
+               CUDA::DnnReduceNorm2Descriptor(reduceCompType(node)),
+               kernel::Reduce::Op::L2) {}
+
+OPERATION_REGISTER(ReduceL2Op, ReduceL2);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
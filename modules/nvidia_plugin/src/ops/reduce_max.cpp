@@ -12,7 +12,12 @@ ReduceMaxOp::ReduceMaxOp(const CreationContext& context,
                          const ov::Node& node,
                          IndexCollection&& inputIds,
                          IndexCollection&& outputIds)
-    : ReduceOp(context, node, move(inputIds), move(outputIds), CUDA::DnnReduceMaxDescriptor(reduceCompType(node))) {}
+    : ReduceOp(context,
+               node,
+               move(inputIds),
+               move(outputIds),
+               CUDA::DnnReduceMaxDescriptor(reduceCompType(node)),
+               kernel::Reduce::Op::Max) {}
 
 OPERATION_REGISTER(ReduceMaxOp, ReduceMax);
 
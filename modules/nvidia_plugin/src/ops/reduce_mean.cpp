@@ -12,7 +12,12 @@ ReduceMeanOp::ReduceMeanOp(const CreationContext& context,
                          const ov::Node& node,
                          IndexCollection&& inputIds,
                          IndexCollection&& outputIds)
-    : ReduceOp(context, node, move(inputIds), move(outputIds), CUDA::DnnReduceAvgDescriptor(reduceCompType(node))) {}
+    : ReduceOp(context,
+               node,
+               move(inputIds),
+               move(outputIds),
+               CUDA::DnnReduceAvgDescriptor(reduceCompType(node)),
+               kernel::Reduce::Op::Mean) {}
 
 OPERATION_REGISTER(ReduceMeanOp, ReduceMean);
 
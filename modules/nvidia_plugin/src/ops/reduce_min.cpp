@@ -12,7 +12,12 @@ ReduceMinOp::ReduceMinOp(const CreationContext& context,
                          const ov::Node& node,
                          IndexCollection&& inputIds,
                          IndexCollection&& outputIds)
-    : ReduceOp(context, node, move(inputIds), move(outputIds), CUDA::DnnReduceMinDescriptor(reduceCompType(node))) {}
+    : ReduceOp(context,
+               node,
+               move(inputIds),
+               move(outputIds),
+               CUDA::DnnReduceMinDescriptor(reduceCompType(node)),
+               kernel::Reduce::Op::Min) {}
 
 OPERATION_REGISTER(ReduceMinOp, ReduceMin);
 
@@ -12,7 +12,12 @@ ReduceProdOp::ReduceProdOp(const CreationContext& context,
                          const ov::Node& node,
                          IndexCollection&& inputIds,
                          IndexCollection&& outputIds)
-    : ReduceOp(context, node, move(inputIds), move(outputIds), CUDA::DnnReduceMulDescriptor(reduceCompType(node))) {}
+    : ReduceOp(context,
+               node,
+               move(inputIds),
+               move(outputIds),
+               CUDA::DnnReduceMulDescriptor(reduceCompType(node)),
+               kernel::Reduce::Op::Prod) {}
 
 OPERATION_REGISTER(ReduceProdOp, ReduceProd);
 
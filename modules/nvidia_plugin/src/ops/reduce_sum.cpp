@@ -12,7 +12,12 @@ ReduceSumOp::ReduceSumOp(const CreationContext& context,
                          const ov::Node& node,
                          IndexCollection&& inputIds,
                          IndexCollection&& outputIds)
-    : ReduceOp(context, node, move(inputIds), move(outputIds), CUDA::DnnReduceAddDescriptor(reduceCompType(node))) {}
+    : ReduceOp(context,
+               node,
+               move(inputIds),
+               move(outputIds),
+               CUDA::DnnReduceAddDescriptor(reduceCompType(node)),
+               kernel::Reduce::Op::Sum) {}
 
 OPERATION_REGISTER(ReduceSumOp, ReduceSum);
 
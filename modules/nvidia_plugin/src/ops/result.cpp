@@ -6,6 +6,7 @@
 
 #include <cuda_runtime.h>
 
+#include <cstdint>
 #include <cuda_operation_registry.hpp>
 #include <exec_graph_info.hpp>
 #include <openvino/core/except.hpp>
@@ -32,15 +33,47 @@ void ResultOp::Execute(const InferenceRequestContext& context,
                        const Workbuffers&) const {
     OPENVINO_ASSERT(inputs.size() == 1, "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 0, "Node name: ", GetName());
-    std::shared_ptr<ov::Tensor> tensor;
+    if (pack_) {
+        if (!is_pack_downloader_) {
+            return;
+        }
+        const auto* src = static_cast<const std::uint8_t*>(inputs[0].get());
+        if (void* dst = packedOutputs(context.getTensorMappingContext(), *pack_)) {
+            const auto& threadContext = context.getThreadContext();
+            threadContext.joinCompute();
+            threadContext.downloadStream().copy(dst, src, pack_->size);
+        } else {
+            for (const auto& entry : pack_->entries) {
+                download(context, entry.name, src + entry.offset);
+            }
+        }
+        return;
+    }
+    std::string outputTensorName{};
     for (const auto& outputName : output_tensor_names_) {
         if (context.getTensorMappingContext().has_output_tensor(outputName)) {
-            tensor = context.getTensorMappingContext().get_output_tensor(outputName);
+            outputTensorName = outputName;
             break;
         }
     }
-    OPENVINO_ASSERT(tensor != nullptr, "Node name: ", GetName());
-    context.getThreadContext().stream().download(tensor->data(), inputs[0], tensor->get_byte_size());
+    OPENVINO_ASSERT(!outputTensorName.empty(), "Node name: ", GetName());
+    download(context, outputTensorName, inputs[0].get());
+}
+
+void ResultOp::download(const InferenceRequestContext& context, const std::string& name, const void* src) {
+    auto tensor = context.getTensorMappingContext().get_output_tensor(name);
+    if (src == tensor->data()) {
+        // Output tensor is bound directly as external buffer
+        return;
+    }
+    if (context.getTensorMappingContext().is_output_skipped(name)) {
+        return;
+    }
+    // Tensor may reside either in host or device memory (remote tensor), so direction is deduced by UVA.
+    // Transfer is performed on the download stream once computations submitted so far are completed
+    const auto& threadContext = context.getThreadContext();
+    threadContext.joinCompute();
+    threadContext.downloadStream().copy(tensor->data(), src, tensor->get_byte_size());
 }
 
 bool ResultOp::IsCudaGraphCompatible() const { return true; }
@@ -80,24 +113,53 @@ std::vector<std::string> ResultOp::GetOutputTensorName(const ov::op::v0::Result&
     return outputNames;
 }
 
+void ResultOp::SetPack(std::shared_ptr<const IoPack> pack) {
+    is_pack_downloader_ = pack->entries.front().name == output_tensor_names_.front();
+    pack_ = std::move(pack);
+}
+
 void ResultOp::Capture(InferenceRequestContext& context,
                        Inputs inputs,
                        Outputs outputs,
                        const Workbuffers&) const {
     OPENVINO_ASSERT(inputs.size() == 1, "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 0, "Node name: ", GetName());
-    std::shared_ptr<ov::Tensor> tensor;
+    if (pack_) {
+        if (!is_pack_downloader_) {
+            return;
+        }
+        const auto* src = static_cast<const std::uint8_t*>(inputs[0].get());
+        if (void* dst = packedOutputs(context.getTensorMappingContext(), *pack_)) {
+            context.getCudaGraphContext().add_packed_results(
+                pack_, context.getThreadContext().stream(), dst, inputs[0]);
+        } else {
+            for (const auto& entry : pack_->entries) {
+                captureDownload(context, entry.name, src + entry.offset);
+            }
+        }
+        return;
+    }
     std::string outputTensorName{};
     for (const auto& outputName : output_tensor_names_) {
         if (context.getTensorMappingContext().has_output_tensor(outputName)) {
-            tensor = context.getTensorMappingContext().get_output_tensor(outputName);
             outputTensorName = outputName;
             break;
         }
     }
-    OPENVINO_ASSERT(tensor != nullptr, "Node name: ", GetName());
-    context.getCudaGraphContext().add_result(
-        outputTensorName, context.getThreadContext().stream(), tensor->data(), inputs[0], tensor->get_byte_size());
+    OPENVINO_ASSERT(!outputTensorName.empty(), "Node name: ", GetName());
+    captureDownload(context, outputTensorName, inputs[0].get());
+}
+
+void ResultOp::captureDownload(InferenceRequestContext& context, const std::string& name, const void* src) {
+    auto tensor = context.getTensorMappingContext().get_output_tensor(name);
+    if (src == tensor->data()) {
+        return;
+    }
+    context.getCudaGraphContext().add_result(name,
+                                             context.getThreadContext().stream(),
+                                             tensor->data(),
+                                             CUDA::DevicePointer<const void*>{src},
+                                             tensor->get_byte_size());
 }
 
 OPERATION_REGISTER(ResultOp, Result);
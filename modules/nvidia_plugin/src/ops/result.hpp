@@ -5,7 +5,9 @@
 #pragma once
 
 #include <cuda/device_pointers.hpp>
+#include <cuda_io_pack.hpp>
 #include <cuda_operation_base.hpp>
+#include <memory>
 #include <openvino/op/result.hpp>
 
 namespace ov {
@@ -33,10 +35,24 @@ public:
 
     static std::vector<std::string> GetOutputTensorName(const ov::op::v0::Result& node);
 
+    /**
+     * Makes the output a part of the pack of outputs. The operation of the first entry of the pack downloads
+     * the whole pack, operations of other entries do nothing
+     */
+    void SetPack(std::shared_ptr<const IoPack> pack);
+
 private:
     static std::optional<std::size_t> GetOutputTensorSubIndex(const ov::Output<ov::Node>& node);
 
+    /**
+     * Downloads the output from the buffer on the download stream
+     */
+    static void download(const InferenceRequestContext& context, const std::string& name, const void* src);
+    static void captureDownload(InferenceRequestContext& context, const std::string& name, const void* src);
+
     std::vector<std::string> output_tensor_names_;
+    std::shared_ptr<const IoPack> pack_;
+    bool is_pack_downloader_ = false;
 };
 
 }  // namespace nvidia_gpu
@@ -11,6 +11,7 @@
 #include <openvino/op/reshape.hpp>
 #include <openvino/op/squeeze.hpp>
 #include <openvino/op/unsqueeze.hpp>
+#include <transformer/nodes/gru_sequence_stack.hpp>
 #include <typeinfo>
 
 namespace ov::nvidia_gpu::RNN::Details {
@@ -62,9 +63,9 @@ GRUSequenceParams::GRUSequenceParams(const ov::op::v5::GRUSequence& node)
             node.get_output_element_type(GRUSequenceArgIndices::y) == element_type_ &&
             node.get_output_element_type(GRUSequenceArgIndices::hidden_output) == element_type_);
 
-    w_host_buffers_ = findInputConstantBuffer(node, GRUSequenceArgIndices::weights);
-    r_host_buffers_ = findInputConstantBuffer(node, GRUSequenceArgIndices::recurrence_weights);
-    b_host_buffers_ = findInputConstantBuffer(node, GRUSequenceArgIndices::biases);
+    w_host_buffers_.push_back(findInputConstantBuffer(node, GRUSequenceArgIndices::weights));
+    r_host_buffers_.push_back(findInputConstantBuffer(node, GRUSequenceArgIndices::recurrence_weights));
+    b_host_buffers_.push_back(findInputConstantBuffer(node, GRUSequenceArgIndices::biases));
 
     const size_t num_directions = (direction_ == ov::op::RecurrentSequenceDirection::BIDIRECTIONAL) ? 2 : 1;
 
@@ -90,9 +91,41 @@ GRUSequenceParams::GRUSequenceParams(const ov::op::v5::GRUSequence& node)
     }
 
     const auto element_type_size = element_type_.size();
-    OPENVINO_ASSERT(w_host_buffers_.size_bytes() == ov::shape_size(w_shape) * element_type_size);
-    OPENVINO_ASSERT(r_host_buffers_.size_bytes() == ov::shape_size(r_shape) * element_type_size);
-    OPENVINO_ASSERT(b_host_buffers_.size_bytes() == ov::shape_size(b_shape) * element_type_size);
+    OPENVINO_ASSERT(w_host_buffers_[0].size_bytes() == ov::shape_size(w_shape) * element_type_size);
+    OPENVINO_ASSERT(r_host_buffers_[0].size_bytes() == ov::shape_size(r_shape) * element_type_size);
+    OPENVINO_ASSERT(b_host_buffers_[0].size_bytes() == ov::shape_size(b_shape) * element_type_size);
+}
+
+GRUSequenceParams::GRUSequenceParams(const nodes::GRUSequenceStack& node)
+    : element_type_{node.get_input_element_type(GRUSequenceArgIndices::x)},
+      direction_{ov::op::RecurrentSequenceDirection::FORWARD},
+      activations_{"sigmoid", "tanh"},
+      clip_{0.0f},
+      linear_before_reset_{node.get_linear_before_reset()},
+      hidden_size_{node.get_hidden_size()},
+      num_layers_{node.get_num_layers()} {
+    OPENVINO_ASSERT(node.get_output_size() == 2);
+    const auto& x_shape = node.get_input_shape(GRUSequenceArgIndices::x);
+    OPENVINO_ASSERT(x_shape.size() == 3);
+    batch_size_ = x_shape[0];
+    max_seq_length_ = x_shape[1];
+    input_size_ = x_shape[2];
+
+    const auto element_type_size = element_type_.size();
+    const size_t num_biases = linear_before_reset_ ? lin_layer_count + 1 : lin_layer_count;
+    for (size_t l = 0; l < num_layers_; ++l) {
+        // Weights of the layer follow the same order as the ones of GRUSequence
+        const size_t weights = GRUSequenceArgIndices::weights + l * lin_layer_count;
+        const size_t layer_input_size = l > 0 ? hidden_size_ : input_size_;
+        w_host_buffers_.push_back(findInputConstantBuffer(node, weights));
+        r_host_buffers_.push_back(findInputConstantBuffer(node, weights + 1));
+        b_host_buffers_.push_back(findInputConstantBuffer(node, weights + 2));
+        OPENVINO_ASSERT(w_host_buffers_[l].size_bytes() ==
+                        lin_layer_count * hidden_size_ * layer_input_size * element_type_size);
+        OPENVINO_ASSERT(r_host_buffers_[l].size_bytes() ==
+                        lin_layer_count * hidden_size_ * hidden_size_ * element_type_size);
+        OPENVINO_ASSERT(b_host_buffers_[l].size_bytes() == num_biases * hidden_size_ * element_type_size);
+    }
 }
 
 }  // namespace ov::nvidia_gpu::RNN::Details
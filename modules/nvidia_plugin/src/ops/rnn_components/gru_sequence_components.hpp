@@ -10,6 +10,10 @@
 
 #include "gru_sequence_components.hpp"
 
+namespace ov::nvidia_gpu::nodes {
+class GRUSequenceStack;
+}  // namespace ov::nvidia_gpu::nodes
+
 namespace ov::nvidia_gpu::RNN::Details {
 
 /**
@@ -31,6 +35,7 @@ struct GRUSequenceArgIndices {
  */
 struct GRUSequenceParams {
     GRUSequenceParams(const ov::op::v5::GRUSequence& node);
+    GRUSequenceParams(const nodes::GRUSequenceStack& node);
 
     static constexpr int lin_layer_count = 3;
 
@@ -40,14 +45,16 @@ struct GRUSequenceParams {
     float clip_;
     bool linear_before_reset_;
 
-    gsl::span<const uint8_t> w_host_buffers_;
-    gsl::span<const uint8_t> r_host_buffers_;
-    gsl::span<const uint8_t> b_host_buffers_;
+    // Weights of each layer, the weights of a layer include all its directions
+    std::vector<gsl::span<const uint8_t>> w_host_buffers_;
+    std::vector<gsl::span<const uint8_t>> r_host_buffers_;
+    std::vector<gsl::span<const uint8_t>> b_host_buffers_;
 
     size_t batch_size_;
     size_t max_seq_length_;
     size_t input_size_;
     size_t hidden_size_;
+    size_t num_layers_ = 1;
 };
 
 }  // namespace ov::nvidia_gpu::RNN::Details
@@ -14,21 +14,20 @@ GRUSequenceParamsCuDnn::GRUSequenceParamsCuDnn(const GRUSequenceParams& params)
     : element_type_{convertDataType<cudnnDataType_t>(params.element_type_)},
       element_type_cuda_{convertDataType<cudaDataType_t>(params.element_type_)},
       element_size_{ov::nvidia_gpu::elementSize(element_type_)},
-      direction_{CUDNN_UNIDIRECTIONAL},
+      direction_{params.direction_ == ov::op::RecurrentSequenceDirection::BIDIRECTIONAL ? CUDNN_BIDIRECTIONAL
+                                                                                         : CUDNN_UNIDIRECTIONAL},
       linear_before_reset_{params.linear_before_reset_},
       batch_size_{static_cast<int32_t>(params.batch_size_)},
       max_seq_length_{static_cast<int32_t>(params.max_seq_length_)},
       input_size_{static_cast<int32_t>(params.input_size_)},
       hidden_size_{static_cast<int32_t>(params.hidden_size_)},
+      num_layers_{static_cast<int32_t>(params.num_layers_)},
       w_host_buffers_{params.w_host_buffers_},
       r_host_buffers_{params.r_host_buffers_},
       b_host_buffers_{params.b_host_buffers_} {
     if (params.direction_ == ov::op::RecurrentSequenceDirection::REVERSE) {
         throw_ov_exception("Currently GRUSequence cuDNN implementation doesn't support REVERSE direction");
     }
-    if (params.direction_ == ov::op::RecurrentSequenceDirection::BIDIRECTIONAL) {
-        throw_ov_exception("Currently GRUSequence cuDNN implementation doesn't support BIDIRECTIONAL direction");
-    }
 
     if (input_size_ == 1 && hidden_size_ == 1) {
         throw_ov_exception(
@@ -52,6 +51,15 @@ GRUSequenceParamsCuDnn::GRUSequenceParamsCuDnn(const GRUSequenceParams& params)
     seq_length_array_.resize(batch_size_, max_seq_length_);
 }
 
+size_t GRUSequenceParamsCuDnn::hostWeightsSizeBytes() const {
+    size_t size = 0;
+    for (int32_t layer = 0; layer < num_layers_; ++layer) {
+        size += w_host_buffers_[layer].size_bytes() + r_host_buffers_[layer].size_bytes() +
+                b_host_buffers_[layer].size_bytes();
+    }
+    return size;
+}
+
 GRUSequenceDescriptorsCuDnn::GRUSequenceDescriptorsCuDnn(const CreationContext& context,
                                                          const GRUSequenceParamsCuDnn& params,
                                                          const Config& config)
@@ -64,8 +72,7 @@ GRUSequenceDescriptorsCuDnn::GRUSequenceDescriptorsCuDnn(const CreationContext&
     CUDA::DnnHandle dnn_handle{};
     weight_space_size_ = 0;
     throwIfError(cudnnGetRNNWeightSpaceSize(dnn_handle.get(), rnn_desc_.get(), &weight_space_size_));
-    OPENVINO_ASSERT(weight_space_size_ >= params_.w_host_buffers_.size_bytes() + params_.r_host_buffers_.size_bytes() +
-                                      params_.b_host_buffers_.size_bytes());
+    OPENVINO_ASSERT(weight_space_size_ >= params_.hostWeightsSizeBytes());
 
     work_space_size_ = 0;
     size_t reserve_space_size = 0;
@@ -83,7 +90,7 @@ void GRUSequenceDescriptorsCuDnn::createRNNDescriptor(const CreationContext& con
     const bool can_use_half = (params_.element_type_ == CUDNN_DATA_HALF) && CUDA::isHalfSupported(context.device());
     const auto math_prec =
         ((params_.element_type_ == CUDNN_DATA_DOUBLE) || can_use_half) ? params_.element_type_ : CUDNN_DATA_FLOAT;
-    const auto numLayers = 1;
+    const auto numLayers = params_.num_layers_;
 
     // Possible optimization: down type conversion can be forced with CUDNN_TENSOR_OP_MATH_ALLOW_CONVERSION option
     // to utilize Tensor Cores on the supported devices at the price of precision
@@ -91,7 +98,7 @@ void GRUSequenceDescriptorsCuDnn::createRNNDescriptor(const CreationContext& con
                                ? CUDNN_DEFAULT_MATH
                                : CUDNN_TENSOR_OP_MATH;
 
-    // A single layer network will have no dropout applied. Dropout is used in the training mode only.
+    // Dropout is used in the training mode only, so it isn't applied between layers either.
     const cudnnDropoutDescriptor_t drop_out_desc = nullptr;
 
     const uint32_t aux_flags =
@@ -139,7 +146,7 @@ void GRUSequenceDescriptorsCuDnn::createYDescriptor() {
 
 void GRUSequenceDescriptorsCuDnn::createHDescriptor() {
     const size_t nbDims = 3;
-    const int h_dim_a[nbDims] = {params_.numDirections(), params_.batch_size_, params_.projSize()};
+    const int h_dim_a[nbDims] = {params_.numStates(), params_.batch_size_, params_.projSize()};
     const int h_stride_a[nbDims] = {params_.batch_size_ * params_.projSize(), params_.projSize(), 1};
     h_desc_.set(params_.element_type_, nbDims, h_dim_a, h_stride_a);
 }
@@ -151,50 +158,59 @@ void GRUSequenceDescriptorsCuDnn::initDevSeqLengthArray(DevPtr buffer) {
 void GRUSequenceDescriptorsCuDnn::initWeightSpace(DevPtr buffer) {
     calculateWeightBuffers(buffer);
 
-    const int num_pseudo_layers = params_.numDirections();
-    const auto dev_buffers_count = GRUSequenceParams::lin_layer_count * num_pseudo_layers;
-
-    const auto w_host_buffer_size = params_.w_host_buffers_.size_bytes() / dev_buffers_count;
-    const auto r_host_buffer_size = params_.r_host_buffers_.size_bytes() / dev_buffers_count;
-    const auto b1_host_layer_size = params_.hidden_size_ * params_.element_size_;
-
-    const uint8_t* w_host_addr = params_.w_host_buffers_.data();
-    const uint8_t* r_host_addr = params_.r_host_buffers_.data();
-    const uint8_t* b1_host_addr = params_.b_host_buffers_.data();
+    const auto lin_layer_count = GRUSequenceParams::lin_layer_count;
+    const int num_directions = params_.numDirections();
+    const size_t b1_host_layer_size = params_.hidden_size_ * params_.element_size_;
+    // B of a direction is [3 * hidden_size] or [4 * hidden_size] if linear_before_reset is set
+    const size_t b_host_direction_size =
+        (params_.linear_before_reset_ ? lin_layer_count + 1 : lin_layer_count) * b1_host_layer_size;
 
     const auto& stream = CUDA::DefaultStream::stream();
 
-    for (int i = 0; i < dev_buffers_count; ++i) {
-        // OpenVINO: linear layer indices are ZRH gates (Z states for update, R for reset and H for output hidden)
-        //      https://docs.openvino.ai/latest/openvino_docs_ops_sequence_GRUSequence_5.html?highlight=grusequence
-        // In cuDNN they are RZH
-        //      https://docs.nvidia.com/deeplearning/cudnn/api/index.html#cudnnGetRNNWeightParams
-        //
-        // So we swap the corresponding buffers:
-        int j = i;
-        j = (j == 0) ? 1 : ((j == 1) ? 0 : j);
-
-        OPENVINO_ASSERT(w_host_buffer_size == w_dev_buffers_[j].size_bytes());
-        stream.upload(DevPtr{w_dev_buffers_[j].data()}, w_host_addr, w_host_buffer_size);
-        w_host_addr += w_host_buffer_size;
-
-        OPENVINO_ASSERT(b1_host_layer_size == b1_dev_buffers_[j].size_bytes());
-        stream.upload(DevPtr{b1_dev_buffers_[j].data()}, b1_host_addr, b1_host_layer_size);
-        b1_host_addr += b1_host_layer_size;
-
-        OPENVINO_ASSERT(r_host_buffer_size == r_dev_buffers_[j].size_bytes());
-        stream.upload(DevPtr{r_dev_buffers_[j].data()}, r_host_addr, r_host_buffer_size);
-        r_host_addr += r_host_buffer_size;
-
-        if (i < b2_dev_buffers_.size()) {
-            if (params_.linear_before_reset_ && (j == 2)) {
-                // the tensor shape is [4 * hidden_size], get the fourth element from an array
-                const size_t offset = b1_host_layer_size * (j + 1);
-                OPENVINO_ASSERT(offset + b1_host_layer_size <= params_.b_host_buffers_.size_bytes());
-                const uint8_t* b2_host_addr = params_.b_host_buffers_.data() + offset;
-                stream.upload(DevPtr{b2_dev_buffers_[j].data()}, b2_host_addr, b1_host_layer_size);
-            } else {
-                stream.memset(DevPtr{b2_dev_buffers_[j].data()}, 0, b2_dev_buffers_[j].size_bytes());
+    for (int32_t layer = 0; layer < params_.num_layers_; ++layer) {
+        const auto dev_buffers_count = lin_layer_count * num_directions;
+        const auto w_host_buffer_size = params_.w_host_buffers_[layer].size_bytes() / dev_buffers_count;
+        const auto r_host_buffer_size = params_.r_host_buffers_[layer].size_bytes() / dev_buffers_count;
+        OPENVINO_ASSERT(params_.b_host_buffers_[layer].size_bytes() == num_directions * b_host_direction_size);
+
+        for (int d = 0; d < num_directions; ++d) {
+            const int pseudo_layer = layer * num_directions + d;
+            const uint8_t* w_host_addr = params_.w_host_buffers_[layer].data() +
+                                         d * lin_layer_count * w_host_buffer_size;
+            const uint8_t* r_host_addr = params_.r_host_buffers_[layer].data() +
+                                         d * lin_layer_count * r_host_buffer_size;
+            const uint8_t* b_host_addr = params_.b_host_buffers_[layer].data() + d * b_host_direction_size;
+            for (int i = 0; i < lin_layer_count; ++i) {
+                // OpenVINO: linear layer indices are ZRH gates
+                //      (Z states for update, R for reset and H for output hidden)
+                //      https://docs.openvino.ai/latest/openvino_docs_ops_sequence_GRUSequence_5.html
+                // In cuDNN they are RZH
+                //      https://docs.nvidia.com/deeplearning/cudnn/api/index.html#cudnnGetRNNWeightParams
+                //
+                // So we swap the corresponding buffers:
+                const int j = pseudo_layer * lin_layer_count + ((i == 0) ? 1 : ((i == 1) ? 0 : i));
+
+                OPENVINO_ASSERT(w_host_buffer_size == w_dev_buffers_[j].size_bytes());
+                stream.upload(
+                    DevPtr{w_dev_buffers_[j].data()}, w_host_addr + i * w_host_buffer_size, w_host_buffer_size);
+
+                OPENVINO_ASSERT(b1_host_layer_size == b1_dev_buffers_[j].size_bytes());
+                stream.upload(
+                    DevPtr{b1_dev_buffers_[j].data()}, b_host_addr + i * b1_host_layer_size, b1_host_layer_size);
+
+                OPENVINO_ASSERT(r_host_buffer_size == r_dev_buffers_[j].size_bytes());
+                stream.upload(
+                    DevPtr{r_dev_buffers_[j].data()}, r_host_addr + i * r_host_buffer_size, r_host_buffer_size);
+
+                if (j < b2_dev_buffers_.size()) {
+                    if (params_.linear_before_reset_ && (i == 2)) {
+                        // the bias of the direction is [4 * hidden_size], the recurrent bias of H is the fourth one
+                        const uint8_t* b2_host_addr = b_host_addr + lin_layer_count * b1_host_layer_size;
+                        stream.upload(DevPtr{b2_dev_buffers_[j].data()}, b2_host_addr, b1_host_layer_size);
+                    } else {
+                        stream.memset(DevPtr{b2_dev_buffers_[j].data()}, 0, b2_dev_buffers_[j].size_bytes());
+                    }
+                }
             }
         }
     }
@@ -258,7 +274,6 @@ void GRUSequenceDescriptorsCuDnn::calculateWeightBuffers(DevPtr buffer) {
     OPENVINO_ASSERT(weight_space);
 
     const auto data_type = params_.element_type_;
-    const auto input_size = params_.input_size_;
     const auto hidden_size = params_.hidden_size_;
     const auto element_size = ov::nvidia_gpu::elementSize(params_.element_type_);
 
@@ -280,8 +295,9 @@ void GRUSequenceDescriptorsCuDnn::calculateWeightBuffers(DevPtr buffer) {
     int wb_stride_a[wb_nb_dims_requested] = {};
     size_t tensor_size_bytes = 0;
 
-    const int num_pseudo_layers = params_.numDirections();
+    const int num_pseudo_layers = params_.numStates();
     for (int32_t pseudo_layer = 0; pseudo_layer < num_pseudo_layers; ++pseudo_layer) {
+        const auto input_size = params_.layerInputSize(pseudo_layer / params_.numDirections());
         const auto lin_layer_count = GRUSequenceParams::lin_layer_count;
         for (int i = 0; i < lin_layer_count; ++i) {
             lin_layer_id = i;
@@ -360,8 +376,13 @@ void GRUSequenceDescriptorsCuDnn::calculateWeightBuffers(DevPtr buffer) {
 
     OPENVINO_ASSERT(weightBuffersFit(buffer));
     OPENVINO_ASSERT(weight_space_size_ >= w_total_bytes + r_total_bytes + b1_total_bytes + b2_total_bytes);
-    OPENVINO_ASSERT(w_total_bytes >= params_.w_host_buffers_.size_bytes() &&
-                    r_total_bytes >= params_.r_host_buffers_.size_bytes());
+    size_t w_host_bytes = 0;
+    size_t r_host_bytes = 0;
+    for (int32_t layer = 0; layer < params_.num_layers_; ++layer) {
+        w_host_bytes += params_.w_host_buffers_[layer].size_bytes();
+        r_host_bytes += params_.r_host_buffers_[layer].size_bytes();
+    }
+    OPENVINO_ASSERT(w_total_bytes >= w_host_bytes && r_total_bytes >= r_host_bytes);
 }
 
 }  // namespace ov::nvidia_gpu::RNN::Details
@@ -30,14 +30,21 @@ public:
     int32_t input_size_;
     int32_t hidden_size_;
 
-    gsl::span<const uint8_t> w_host_buffers_;
-    gsl::span<const uint8_t> r_host_buffers_;
-    gsl::span<const uint8_t> b_host_buffers_;
+    int32_t num_layers_;
+
+    std::vector<gsl::span<const uint8_t>> w_host_buffers_;
+    std::vector<gsl::span<const uint8_t>> r_host_buffers_;
+    std::vector<gsl::span<const uint8_t>> b_host_buffers_;
 
     std::vector<int32_t> seq_length_array_;
 
     int32_t numDirections() const { return direction_ == CUDNN_BIDIRECTIONAL ? 2 : 1; }
     int32_t projSize() const { return hidden_size_; }
+    /// Number of hidden states of all layers and directions, i.e. the outermost dimension of hx and hy in cuDNN
+    int32_t numStates() const { return num_layers_ * numDirections(); }
+    /// Layers after the first one take y of the previous layer
+    int32_t layerInputSize(int32_t layer) const { return layer > 0 ? numDirections() * projSize() : input_size_; }
+    size_t hostWeightsSizeBytes() const;
 };
 
 /**
@@ -19,6 +19,57 @@ bool isRNNSequenceCudaGraphCompatible(const CUDA::Device& device) {
     return isDeviceSupported || isCudnnSupported;
 }
 
+void warmUpRNNForward(const CUDA::DnnRnnDescriptor& rnn_desc,
+                      const cudnnForwardMode_t fwd_mode,
+                      const int32_t* dev_seq_lengths,
+                      const CUDA::DnnRnnDataDescriptor& x_desc,
+                      const CUDA::DnnRnnDataDescriptor& y_desc,
+                      const CUDA::DnnTensorDescriptor& h_desc,
+                      std::optional<CUDA::DnnTensorDescriptor::CRef> c_desc,
+                      const size_t weight_space_size,
+                      const void* weight_space,
+                      const RNNForwardSizes& sizes) {
+    const auto& stream = CUDA::DefaultStream::stream();
+    auto x = stream.malloc(sizes.x);
+    auto y = stream.malloc(sizes.y);
+    auto hx = stream.malloc(sizes.state);
+    auto hy = stream.malloc(sizes.state);
+    stream.memset(x, 0, sizes.x);
+    stream.memset(hx, 0, sizes.state);
+    std::optional<CUDA::DefaultAllocation> cx;
+    std::optional<CUDA::DefaultAllocation> cy;
+    if (c_desc) {
+        cx.emplace(stream.malloc(sizes.state));
+        cy.emplace(stream.malloc(sizes.state));
+        stream.memset(*cx, 0, sizes.state);
+    }
+    std::optional<CUDA::DefaultAllocation> work_space;
+    if (sizes.work_space > 0) {
+        work_space.emplace(stream.malloc(sizes.work_space));
+    }
+    CUDA::DnnHandle dnn_handle{};
+    dnn_handle.rnnForward(rnn_desc,
+                          fwd_mode,
+                          dev_seq_lengths,
+                          x_desc,
+                          x.get(),
+                          y_desc,
+                          y.get(),
+                          h_desc,
+                          hx.get(),
+                          hy.get(),
+                          c_desc,
+                          cx ? cx->get() : nullptr,
+                          cy ? cy->get() : nullptr,
+                          weight_space_size,
+                          weight_space,
+                          sizes.work_space,
+                          work_space ? work_space->get() : nullptr,
+                          0,
+                          nullptr);
+    throwIfError(cudaDeviceSynchronize());
+}
+
 inline bool isTypeSupported(cudaDataType_t type) {
     switch (type) {
         case CUDA_R_16F:
@@ -4,20 +4,51 @@
 
 #pragma once
 
+#include <cuda/dnn.hpp>
 #include <cuda_operation_base.hpp>
 #include <gsl/span>
+#include <optional>
 #include <ops/components/workbuffer_desc.hpp>
 
 namespace ov::nvidia_gpu::RNN::Details {
 
 /**
  * Checks if LSTM/GRU Sequence is supported by the combination of cuDNN runtime and device compute capability
- * cuDNN v8.5.0/v8.6.0 on GTX1080 (compute capabiltiy 6.1) doesn't work properly with stream capturing
+ * cuDNN v8.5.0/v8.6.0 on GTX1080 (compute capabiltiy 6.1) doesn't work properly with stream capturing,
+ * unless cudnnRNNForward has been called before the capture (see warmUpRNNForward())
  * @param device CUDA device to check
  * @returns true if the combination supported and false if it isn't
  */
 bool isRNNSequenceCudaGraphCompatible(const CUDA::Device& device);
 
+/**
+ * Sizes in bytes of arguments of cudnnRNNForward
+ */
+struct RNNForwardSizes {
+    size_t x;
+    size_t y;
+    // Size of each of hx, hy, cx and cy
+    size_t state;
+    size_t work_space;
+};
+
+/**
+ * Calls cudnnRNNForward once on scratch buffers outside of any stream capture, so cuDNN sets up the kernels
+ * and the host state tied to the descriptors on the first call. Subsequent calls with the same descriptors,
+ * which are kept by the operation for its lifetime, can then be captured into CUDA graphs.
+ * @param c_desc Descriptor of cell states, std::nullopt for GRU
+ */
+void warmUpRNNForward(const CUDA::DnnRnnDescriptor& rnn_desc,
+                      cudnnForwardMode_t fwd_mode,
+                      const int32_t* dev_seq_lengths,
+                      const CUDA::DnnRnnDataDescriptor& x_desc,
+                      const CUDA::DnnRnnDataDescriptor& y_desc,
+                      const CUDA::DnnTensorDescriptor& h_desc,
+                      std::optional<CUDA::DnnTensorDescriptor::CRef> c_desc,
+                      size_t weight_space_size,
+                      const void* weight_space,
+                      const RNNForwardSizes& sizes);
+
 /**
  * Base class for `TransposeInputTensorAdapter` and `TransposeOutputTensorAdapter`
  *
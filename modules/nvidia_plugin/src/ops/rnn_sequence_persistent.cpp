@@ -0,0 +1,150 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "rnn_sequence_persistent.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <error.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+#include <vector>
+
+#include "converters.hpp"
+#include "openvino/op/constant.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+using Direction = ov::op::RecurrentSequenceDirection;
+
+void setDirection(RNNSequencePersistentOp::Kernel::Params& params, const Direction direction) {
+    params.num_directions = direction == Direction::BIDIRECTIONAL ? 2 : 1;
+    params.reverse = direction == Direction::REVERSE;
+}
+
+float clip(const float clip) { return std::isinf(clip) ? 0.0f : clip; }
+
+}  // namespace
+
+RNNSequencePersistentOp::RNNSequencePersistentOp(const CreationContext& context,
+                                                 const ov::Node& node,
+                                                 const Kernel::Params& params,
+                                                 IndexCollection&& inputIds,
+                                                 IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)), cell_{params.cell} {
+    type_name_ = cell_ == Kernel::Cell::LSTM ? "LSTMSequencePersistent" : "GRUSequencePersistent";
+    // The kernel runs all steps of each sequence, so shorter sequences are left to cuDNN
+    const auto seqLengths = ov::as_type_ptr<ov::op::v0::Constant>(node.get_input_node_shared_ptr(
+        cell_ == Kernel::Cell::LSTM ? RNN::Details::LSTMSequenceArgIndices::sequence_lengths
+                                    : RNN::Details::GRUSequenceArgIndices::sequence_lengths));
+    if (!seqLengths) {
+        throw_ov_exception("RNNSequencePersistent supports only constant sequence lengths");
+    }
+    const auto lengths = seqLengths->cast_vector<size_t>();
+    const auto isFull = [&params](size_t length) { return length == params.seq_length; };
+    if (!std::all_of(lengths.begin(), lengths.end(), isFull)) {
+        throw_ov_exception("RNNSequencePersistent supports only sequences of the maximum length");
+    }
+    const auto& props = context.device().props();
+    if (!props.cooperativeLaunch) {
+        throw_ov_exception("RNNSequencePersistent: device doesn't support cooperative launches");
+    }
+    kernel_.emplace(convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                    params,
+                    props.maxThreadsPerBlock,
+                    props.multiProcessorCount);
+}
+
+RNNSequencePersistentOp::Kernel::Params RNNSequencePersistentOp::kernelParams(
+    const RNN::Details::LSTMSequenceParams& params) {
+    if (params.activations_ != std::vector<std::string>{"sigmoid", "tanh", "tanh"}) {
+        throw_ov_exception("RNNSequencePersistent supports only default LSTM activations");
+    }
+    const auto isDefault = [](const std::vector<float>& values, const float value) {
+        return std::all_of(values.begin(), values.end(), [value](float v) { return v == value; });
+    };
+    if (!isDefault(params.activations_alpha_, 1.0f) || !isDefault(params.activations_beta_, 0.0f)) {
+        throw_ov_exception("RNNSequencePersistent supports only default activation alphas and betas");
+    }
+    Kernel::Params result;
+    result.cell = Kernel::Cell::LSTM;
+    result.batch_size = params.batch_size_;
+    result.seq_length = params.max_seq_length_;
+    result.input_size = params.input_size_;
+    result.hidden_size = params.hidden_size_;
+    result.clip = clip(params.clip_);
+    setDirection(result, params.direction_);
+    return result;
+}
+
+RNNSequencePersistentOp::Kernel::Params RNNSequencePersistentOp::kernelParams(
+    const RNN::Details::GRUSequenceParams& params) {
+    if (params.activations_ != std::vector<std::string>{"sigmoid", "tanh"}) {
+        throw_ov_exception("RNNSequencePersistent supports only default GRU activations");
+    }
+    // Without linear_before_reset the reset gate of all units is needed before the hidden part of h
+    if (!params.linear_before_reset_) {
+        throw_ov_exception("RNNSequencePersistent supports only GRU with linear_before_reset");
+    }
+    Kernel::Params result;
+    result.cell = Kernel::Cell::GRU;
+    result.batch_size = params.batch_size_;
+    result.seq_length = params.max_seq_length_;
+    result.input_size = params.input_size_;
+    result.hidden_size = params.hidden_size_;
+    result.clip = clip(params.clip_);
+    setDirection(result, params.direction_);
+    return result;
+}
+
+void RNNSequencePersistentOp::Execute(const InferenceRequestContext& context,
+                                      Inputs inputTensors,
+                                      Outputs outputTensors,
+                                      const Workbuffers& workbuffers) const {
+    const auto& stream = context.getThreadContext().stream();
+    const auto& exchange = workbuffers.mutable_buffers.at(0);
+    if (cell_ == Kernel::Cell::LSTM) {
+        using ArgIndices = RNN::Details::LSTMSequenceArgIndices;
+        OPENVINO_ASSERT(inputTensors.size() == 7, "Node name: ", GetName());
+        OPENVINO_ASSERT(outputTensors.size() == 3, "Node name: ", GetName());
+        (*kernel_)(stream.get(),
+                   inputTensors[ArgIndices::x].get(),
+                   inputTensors[ArgIndices::hidden_input].get(),
+                   inputTensors[ArgIndices::cell_input].get(),
+                   inputTensors[ArgIndices::weights].get(),
+                   inputTensors[ArgIndices::recurrence_weights].get(),
+                   inputTensors[ArgIndices::biases].get(),
+                   outputTensors[ArgIndices::y].get(),
+                   outputTensors[ArgIndices::hidden_output].get(),
+                   outputTensors[ArgIndices::cell_output].get(),
+                   exchange.get());
+    } else {
+        using ArgIndices = RNN::Details::GRUSequenceArgIndices;
+        OPENVINO_ASSERT(inputTensors.size() == 6, "Node name: ", GetName());
+        OPENVINO_ASSERT(outputTensors.size() == 2, "Node name: ", GetName());
+        (*kernel_)(stream.get(),
+                   inputTensors[ArgIndices::x].get(),
+                   inputTensors[ArgIndices::hidden_input].get(),
+                   nullptr,
+                   inputTensors[ArgIndices::weights].get(),
+                   inputTensors[ArgIndices::recurrence_weights].get(),
+                   inputTensors[ArgIndices::biases].get(),
+                   outputTensors[ArgIndices::y].get(),
+                   outputTensors[ArgIndices::hidden_output].get(),
+                   nullptr,
+                   exchange.get());
+    }
+}
+
+bool RNNSequencePersistentOp::IsCudaGraphCompatible() const { return Kernel::isCudaGraphCompatible(); }
+
+WorkbufferRequest RNNSequencePersistentOp::GetWorkBufferRequest() const {
+    return {{}, {kernel_->exchangeBufferSize()}};
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
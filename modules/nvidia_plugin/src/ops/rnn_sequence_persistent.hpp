@@ -0,0 +1,63 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/rnn_sequence_persistent.hpp>
+#include <optional>
+
+#include "rnn_components/gru_sequence_components.hpp"
+#include "rnn_components/lstm_sequence_components.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Implements `ov::op::v5::LSTMSequence`, `ov::nvidia_gpu::nodes::LSTMSequenceOptimized` and
+ * `ov::op::v5::GRUSequence` by the persistent kernel (see kernel::RNNSequencePersistent).
+ *
+ * For small hidden sizes and batches (e.g. streaming speech recognition) the sequence is latency bound and
+ * cuDNN spends most of the time launching kernels of each time step, which read the recurrent weights again.
+ * The persistent kernel runs all steps by one launch with the weights kept in shared memory.
+ * Layouts of the node are handled by strides, so no transposes are needed.
+ */
+class RNNSequencePersistentOp : public OperationBase {
+public:
+    using Kernel = kernel::RNNSequencePersistent;
+
+    /**
+     * @param params Parameters of the kernel including strides of the layouts of the node
+     * @throws ov::Exception if the kernel doesn't support the sequence on the device or sequence lengths of the
+     * node aren't constants equal to the length of x
+     */
+    RNNSequencePersistentOp(const CreationContext& context,
+                            const ov::Node& node,
+                            const Kernel::Params& params,
+                            IndexCollection&& inputIds,
+                            IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    /**
+     * @returns Parameters of the kernel without strides
+     * @throws ov::Exception if activations or attributes of the sequence aren't supported by the kernel
+     */
+    static Kernel::Params kernelParams(const RNN::Details::LSTMSequenceParams& params);
+    static Kernel::Params kernelParams(const RNN::Details::GRUSequenceParams& params);
+
+private:
+    Kernel::Cell cell_;
+    std::optional<Kernel> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
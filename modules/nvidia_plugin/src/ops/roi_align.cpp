@@ -0,0 +1,84 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roi_align.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/op/roi_align.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+template <typename TNode>
+kernel::ROIAlign::Params makeParams(const TNode& node) {
+    const auto& dataShape = node.get_input_shape(0);
+    kernel::ROIAlign::Params params{};
+    params.element_type = convertDataType<kernel::Type_t>(node.get_input_element_type(0));
+    params.index_type = convertDataType<kernel::Type_t>(node.get_input_element_type(2));
+    params.num_rois = node.get_input_shape(1)[0];
+    params.channels = dataShape[1];
+    params.height = dataShape[2];
+    params.width = dataShape[3];
+    params.pooled_height = static_cast<size_t>(node.get_pooled_h());
+    params.pooled_width = static_cast<size_t>(node.get_pooled_w());
+    params.sampling_ratio = node.get_sampling_ratio();
+    params.spatial_scale = node.get_spatial_scale();
+    params.pooling_mode = node.get_mode() == TNode::PoolingMode::MAX ? kernel::ROIAlign::PoolingMode::Max
+                                                                      : kernel::ROIAlign::PoolingMode::Avg;
+    params.aligned_mode = kernel::ROIAlign::AlignedMode::Asymmetric;
+    return params;
+}
+
+}  // namespace
+
+ROIAlignOp::ROIAlignOp(const CreationContext& context,
+                       const ov::Node& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    OPENVINO_ASSERT(node.get_input_size() == 3 && node.get_output_size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_input_element_type(0) == node.get_input_element_type(1), "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_input_shape(0).size() == 4, "Node name: ", GetName());
+    kernel::ROIAlign::Params params{};
+    if (const auto roiAlign9 = dynamic_cast<const ov::op::v9::ROIAlign*>(&node)) {
+        params = makeParams(*roiAlign9);
+        switch (roiAlign9->get_aligned_mode()) {
+            case ov::op::v9::ROIAlign::AlignedMode::HALF_PIXEL_FOR_NN:
+                params.aligned_mode = kernel::ROIAlign::AlignedMode::HalfPixelForNN;
+                break;
+            case ov::op::v9::ROIAlign::AlignedMode::HALF_PIXEL:
+                params.aligned_mode = kernel::ROIAlign::AlignedMode::HalfPixel;
+                break;
+            default:
+                break;
+        }
+    } else if (const auto roiAlign3 = dynamic_cast<const ov::op::v3::ROIAlign*>(&node)) {
+        params = makeParams(*roiAlign3);
+    } else {
+        throw_ov_exception(fmt::format("Node {} is not ROIAlign-3 or ROIAlign-9", GetName()));
+    }
+    kernel_.emplace(params, static_cast<size_t>(context.device().props().maxThreadsPerBlock));
+}
+
+void ROIAlignOp::Execute(const InferenceRequestContext& context,
+                         Inputs inputTensors,
+                         Outputs outputTensors,
+                         const Workbuffers&) const {
+    OPENVINO_ASSERT(inputTensors.size() == 3 && outputTensors.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputTensors[0].get(),
+               inputTensors[1].get(),
+               inputTensors[2].get(),
+               outputTensors[0].get());
+}
+
+bool ROIAlignOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(ROIAlignOp, ROIAlign);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/roi_align.hpp>
+#include <optional>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * ROIAlign-3 and ROIAlign-9, which adds aligned modes
+ */
+class ROIAlignOp : public OperationBase {
+public:
+    ROIAlignOp(const CreationContext& context,
+               const ov::Node& node,
+               IndexCollection&& inputIds,
+               IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::ROIAlign> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
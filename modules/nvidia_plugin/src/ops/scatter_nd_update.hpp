@@ -12,6 +12,8 @@ namespace nvidia_gpu {
 
 class ScatterNDUpdateOp : public OperationBase {
 public:
+    static constexpr bool kInPlaceFirstInput = true;
+
     ScatterNDUpdateOp(const CreationContext& context,
                       const ov::Node& node,
                       IndexCollection&& inputIds,
@@ -16,6 +16,17 @@ SigmoidOp::SigmoidOp(const CreationContext& context,
     : ActivationForwardCuDnnOpBase{
           std::make_unique<CUDA::SigmoidDescriptor>(), context, *node, move(inputIds), move(outputIds)} {}
 
-OPERATION_REGISTER(SigmoidOp, Sigmoid);
+static OperationBase::Ptr sigmoidFactory(const CreationContext& context,
+                                         const std::shared_ptr<ov::Node>& node,
+                                         OperationBase::IndexCollection&& inputIds,
+                                         OperationBase::IndexCollection&& outputIds) {
+    if (context.fastMath()) {
+        return std::make_shared<SigmoidFastOp>(
+            context, downcast<const ov::op::v0::Sigmoid>(node), std::move(inputIds), std::move(outputIds));
+    }
+    return std::make_shared<SigmoidOp>(context, node, std::move(inputIds), std::move(outputIds));
+}
+
+OPERATION_REGISTER_IN_PLACE_FACTORY(sigmoidFactory, Sigmoid)
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -7,6 +7,9 @@
 #include <cuda_operation_base.hpp>
 
 #include "activation_forward_cudnn_base.hpp"
+#include "elementwise_unary.hpp"
+#include "kernels/sigmoid.hpp"
+#include "openvino/op/sigmoid.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -19,5 +22,14 @@ public:
               IndexCollection&& outputIds);
 };
 
+/**
+ * Element-wise Sigmoid with fast approximations of math, which replaces cuDNN activation when
+ * ov::nvidia_gpu::fast_math is enabled
+ */
+class SigmoidFastOp : public ElementwiseUnaryOp<ov::op::v0::Sigmoid, kernel::Sigmoid> {
+public:
+    using ElementwiseUnaryOp::ElementwiseUnaryOp;
+};
+
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -16,6 +16,16 @@
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * Views the shape as [outer, length, inner], where length is the dimension of the axis
+ */
+static kernel::Softmax makeKernel(kernel::Type_t element_type, const ov::Shape& shape, size_t axis, bool log) {
+    OPENVINO_ASSERT(axis < shape.size());
+    const size_t outer = ov::shape_size(ov::Shape(shape.begin(), shape.begin() + axis));
+    const size_t inner = ov::shape_size(ov::Shape(shape.begin() + axis + 1, shape.end()));
+    return kernel::Softmax{element_type, outer, shape[axis], inner, log};
+}
+
 static int take(const ov::Shape& shape, size_t i) noexcept { return i < shape.size() ? shape[i] : 1; }
 
 static constexpr long long prod(int a, int b) noexcept { return static_cast<long long>(a) * static_cast<long long>(b); }
@@ -45,6 +55,8 @@ static constexpr long long prod(int a, int b) noexcept { return static_cast<long
  *
  * 3. Design Decisions
  *
+ * 3.0. cuDNN is only a fallback for element types, which aren't supported by kernel::Softmax. The kernel handles
+ *      any rank and axis without reshapes
  * 3.1. In the first release support only tensors of ranks 1-5
  * 3.2. Insert extra dimensions into the shape to get 4D tensor for ranks 1-3
  * 3.3. Merge some dimensions of the shape to get 4D tensor for ranks 4 or 5
@@ -167,6 +179,11 @@ SoftmaxOp::SoftmaxOp(const CreationContext& context,
                      IndexCollection&& outputIds)
     : OperationCuDnn{context, node, move(inputIds), move(outputIds)},
       type_{convertDataType<cudnnDataType_t>(node.input(0).get_element_type())} {
+    const auto element_type = convertDataType<kernel::Type_t>(node.input(0).get_element_type());
+    if (kernel::Softmax::isTypeSupported(element_type)) {
+        kernel_ = makeKernel(element_type, node.input(0).get_shape(), node.get_axis(), false);
+        return;
+    }
     if (!isTypeSupported(type_)) {
         throw_ov_exception(fmt::format("SoftmaxOp: unsupported argument type: {}", toString(type_)));
     }
@@ -181,6 +198,10 @@ void SoftmaxOp::Execute(const InferenceRequestContext& context,
                         const Workbuffers&) const {
     OPENVINO_ASSERT(inputs.size() == 1);
     OPENVINO_ASSERT(outputs.size() == 1);
+    if (kernel_) {
+        (*kernel_)(context.getThreadContext().stream().get(), inputs[0].get(), outputs[0].get());
+        return;
+    }
     throwIfError(cudnnSoftmaxForward(context.getThreadContext().dnnHandle().get(),
                                      cudnnSoftmaxAlgorithm_t::CUDNN_SOFTMAX_ACCURATE,
                                      cudnnSoftmaxMode_t::CUDNN_SOFTMAX_MODE_CHANNEL,
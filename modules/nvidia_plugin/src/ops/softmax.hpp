@@ -8,8 +8,11 @@
 
 #include <cuda/device_pointers.hpp>
 #include <cuda_operation_base.hpp>
+#include <optional>
 #include <openvino/op/softmax.hpp>
 
+#include "kernels/softmax.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -31,6 +34,7 @@ public:
 
 private:
     void mapRankAxis(const ov::Shape& shape, int axis);
+    std::optional<kernel::Softmax> kernel_;
     std::array<int, 4> shape_;
     cudnnDataType_t type_;
     CUDA::DnnTensorDescriptor tensor_descriptor_;
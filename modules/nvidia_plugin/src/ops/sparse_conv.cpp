@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_conv.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+SparseConvOp::SparseConvOp(const CreationContext& context,
+                           const ov::Node& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 5, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    for (size_t i = 0; i < node.get_input_size(); ++i) {
+        if (node.get_input_element_type(i) != ov::element::f32) {
+            throw_ov_exception(fmt::format("{} {} supports only f32 inputs, input {} is {}",
+                                           node.get_type_name(),
+                                           GetName(),
+                                           i,
+                                           node.get_input_element_type(i).get_type_name()));
+        }
+    }
+    const auto& features = node.get_input_shape(FEATURES);
+    const auto& kernel = node.get_input_shape(KERNEL);
+    OPENVINO_ASSERT(features.size() == 2 && kernel.size() == 5 && features[1] == kernel[3], "Node name: ", GetName());
+    const bool transposed = node.get_type_name() == std::string("SparseConvTranspose");
+    kernel_.emplace(node.get_input_shape(INPUT_POSITIONS)[0],
+                    node.get_input_shape(OUTPUT_POSITIONS)[0],
+                    kernel[0],
+                    kernel[1],
+                    kernel[2],
+                    kernel[3],
+                    kernel[4],
+                    transposed,
+                    context.device().props().maxThreadsPerBlock);
+}
+
+void SparseConvOp::Execute(const InferenceRequestContext& context,
+                           Inputs inputs,
+                           Outputs outputs,
+                           const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == 5, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               static_cast<const float*>(inputs[FEATURES].get()),
+               static_cast<const float*>(inputs[INPUT_POSITIONS].get()),
+               static_cast<const float*>(inputs[OUTPUT_POSITIONS].get()),
+               static_cast<const float*>(inputs[KERNEL].get()),
+               static_cast<const float*>(inputs[OFFSET].get()),
+               static_cast<float*>(outputs[0].get()),
+               workbuffers.mutable_buffers[0].get());
+}
+
+bool SparseConvOp::IsCudaGraphCompatible() const { return true; }
+
+WorkbufferRequest SparseConvOp::GetWorkBufferRequest() const { return {{}, {kernel_->workspaceSize()}}; }
+
+OPERATION_REGISTER(SparseConvOp, SparseConv);
+OPERATION_REGISTER(SparseConvOp, SparseConvTranspose);
+}  // namespace nvidia_gpu
+}  // namespace ov
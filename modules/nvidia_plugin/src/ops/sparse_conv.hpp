@@ -0,0 +1,41 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/sparse_conv.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * SparseConv and SparseConvTranspose of the custom operations (Open3D ContinuousConv of voxels),
+ * which are recognized by the type name as their nodes are defined out of the plugin
+ */
+class SparseConvOp : public OperationBase {
+public:
+    enum InputIdx { FEATURES, INPUT_POSITIONS, OUTPUT_POSITIONS, KERNEL, OFFSET };
+
+    SparseConvOp(const CreationContext& context,
+                 const ov::Node& node,
+                 IndexCollection&& inputIds,
+                 IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::SparseConv> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
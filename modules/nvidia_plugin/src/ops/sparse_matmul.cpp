@@ -0,0 +1,83 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_matmul.hpp"
+
+#include <algorithm>
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+#ifdef ENABLE_CUSPARSELT
+
+SparseMatMulOp::SparseMatMulOp(const CreationContext& context,
+                               const NodeOp& node,
+                               IndexCollection&& inputIds,
+                               IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)), weights_{node.get_weights()} {
+    OPENVINO_ASSERT(node.get_input_size() == 1 || node.get_input_size() == 2, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(CUDA::isSparseSupported(context.device()),
+                    "Sparse tensor cores are not supported by the device, node name: ",
+                    GetName());
+    const auto& input_shape = node.get_input_shape(0);
+    OPENVINO_ASSERT(!input_shape.empty(), "Node name: ", GetName());
+    const size_t k = input_shape.back();
+    const size_t n = weights_->get_shape()[0];
+    const size_t m = ov::shape_size(input_shape) / k;
+    has_bias_ = node.has_bias();
+    OPENVINO_ASSERT(!has_bias_ || ov::shape_size(node.get_input_shape(1)) == m * n, "Node name: ", GetName());
+    matmul_.emplace(convertDataType<cudaDataType_t>(node.get_input_element_type(0)), m, k, n);
+}
+
+WorkbufferRequest SparseMatMulOp::GetWorkBufferRequest() const {
+    WorkbufferRequest request{{matmul_->compressedSize()}, {}};
+    if (matmul_->workspaceSize() > 0) {
+        request.mutable_sizes.push_back(matmul_->workspaceSize());
+    }
+    return request;
+}
+
+void SparseMatMulOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
+    OPENVINO_ASSERT(buffers.size() == 1, "Node name: ", GetName());
+    const auto& stream = CUDA::DefaultStream::stream();
+    const auto weights = stream.malloc(weights_->get_byte_size());
+    stream.upload(weights, weights_->get_data_ptr(), weights_->get_byte_size());
+    const auto buffer = stream.malloc(std::max<size_t>(matmul_->compressBufferSize(), 1));
+    matmul_->compress(nullptr, weights.get(), buffers[0].get(), buffer.get());
+    throwIfError(cudaStreamSynchronize(nullptr));
+}
+
+void SparseMatMulOp::Execute(const InferenceRequestContext& context,
+                             Inputs inputs,
+                             Outputs outputs,
+                             const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == (has_bias_ ? 2 : 1), "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.immutable_buffers.size() == 1, "Node name: ", GetName());
+    const bool has_workspace = matmul_->workspaceSize() > 0;
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == (has_workspace ? 1 : 0), "Node name: ", GetName());
+    // Bias is taken as matrix C, which is added to the product by cuSPARSELt
+    (*matmul_)(context.getThreadContext().stream().get(),
+               workbuffers.immutable_buffers[0].get(),
+               inputs[0].get(),
+               has_bias_ ? 1.0f : 0.0f,
+               has_bias_ ? inputs[1].get() : outputs[0].get(),
+               outputs[0].get(),
+               has_workspace ? workbuffers.mutable_buffers[0].get() : nullptr);
+}
+
+bool SparseMatMulOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(SparseMatMulOp, SparseMatMul);
+
+#endif  // ENABLE_CUSPARSELT
+
+}  // namespace nvidia_gpu
+}  // namespace ov
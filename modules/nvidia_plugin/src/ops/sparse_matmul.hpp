@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#ifdef ENABLE_CUSPARSELT
+
+#include <cuda/sparse_lt.hpp>
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/sparse_matmul.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Multiplies activations by 2:4 structured sparse weights on sparse tensor cores with cuSPARSELt.
+ * Weights are compressed into a shared immutable work buffer when it is initialized, so the device keeps
+ * only non-zero values of weights and their metadata
+ */
+class SparseMatMulOp : public OperationBase {
+public:
+    using NodeOp = nodes::SparseMatMul;
+    SparseMatMulOp(const CreationContext& context,
+                   const NodeOp& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+    void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
+
+private:
+    std::shared_ptr<ov::op::v0::Constant> weights_;
+    bool has_bias_ = false;
+    std::optional<CUDA::SparseLtMatmul> matmul_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
+
+#endif  // ENABLE_CUSPARSELT
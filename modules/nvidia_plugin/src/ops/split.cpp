@@ -15,6 +15,7 @@
 
 #include "converters.hpp"
 #include "cuda/runtime.hpp"
+#include "kernels/pointer_array.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -84,12 +85,13 @@ void SplitOp::Execute(const InferenceRequestContext& context,
     auto& threadContext = context.getThreadContext();
     auto& stream = threadContext.stream();
     auto outputPtrs = buffers.mutable_buffers[0];
-    stream.upload(outputPtrs, outputs.data(), sizeof(void*) * num_splits_);
+    kernel::fillPointerArray(
+        stream.get(), outputPtrs.get(), reinterpret_cast<const void* const*>(outputs.data()), num_splits_);
     auto in = inputs[0];
     (*split_kernel_)(stream.get(), reinterpret_cast<const void*>(in.get()), reinterpret_cast<void**>(outputPtrs.get()));
 }
 
-bool SplitOp::IsCudaGraphCompatible() const { return false; }
+bool SplitOp::IsCudaGraphCompatible() const { return true; }
 
 OPERATION_REGISTER(SplitOp, Split);
 }  // namespace nvidia_gpu
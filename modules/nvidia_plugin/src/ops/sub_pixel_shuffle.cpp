@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sub_pixel_shuffle.hpp"
+
+#include <cuda_operation_registry.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+SubPixelShuffleOp::SubPixelShuffleOp(const CreationContext& context,
+                                     const NodeOp& node,
+                                     IndexCollection&& inputIds,
+                                     IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    const auto& in_shape = node.get_input_shape(0);
+    const auto& out_shape = node.get_output_shape(0);
+    OPENVINO_ASSERT(in_shape.size() == 4 && out_shape.size() == 4, "Node name: ", GetName());
+    const auto& crop_begin = node.get_crop_begin();
+    const kernel::SubPixelShuffle::Params params{node.get_input_element_type(0).size(),
+                                                 out_shape[0],
+                                                 out_shape[1],
+                                                 in_shape[2],
+                                                 in_shape[3],
+                                                 out_shape[2],
+                                                 out_shape[3],
+                                                 node.get_block_size(),
+                                                 crop_begin[0],
+                                                 crop_begin[1]};
+    kernel_.emplace(params, static_cast<size_t>(context.device().props().maxThreadsPerBlock));
+}
+
+void SubPixelShuffleOp::Execute(const InferenceRequestContext& context,
+                                Inputs inputTensors,
+                                Outputs outputTensors,
+                                const Workbuffers&) const {
+    OPENVINO_ASSERT(inputTensors.size() == 1 && outputTensors.size() == 1, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(), inputTensors[0].get(), outputTensors[0].get());
+}
+
+bool SubPixelShuffleOp::IsCudaGraphCompatible() const { return true; }
+
+OPERATION_REGISTER(SubPixelShuffleOp, SubPixelShuffle);
+}  // namespace nvidia_gpu
+}  // namespace ov
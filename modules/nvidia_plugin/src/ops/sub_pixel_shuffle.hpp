@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/sub_pixel_shuffle.hpp>
+#include <optional>
+
+#include "transformer/nodes/sub_pixel_shuffle.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class SubPixelShuffleOp : public OperationBase {
+public:
+    using NodeOp = nodes::SubPixelShuffle;
+    SubPixelShuffleOp(const CreationContext& context,
+                      const NodeOp& node,
+                      IndexCollection&& inputIds,
+                      IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+private:
+    std::optional<kernel::SubPixelShuffle> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,108 +6,390 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <numeric>
+
+#include <cuda/nvtx.hpp>
+#include <cuda_inference_request_context.hpp>
+#include <cuda_itt.hpp>
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_operation_registry.hpp>
 #include <cuda_iexecution_delegator.hpp>
+#include <cuda_memory_aware_ordering.hpp>
+#include <openvino/op/constant.hpp>
 #include <openvino/op/parameter.hpp>
 #include <openvino/op/result.hpp>
 #include <openvino/op/tensor_iterator.hpp>
 
 #include "nop_op.hpp"
 #include "parameter.hpp"
+#include "persistent_sequence.hpp"
 #include "result.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+// Larger tensors gain nothing from being transferred together with others
+constexpr std::size_t kMaxPackedIoTensorSize = 64 * 1024;
+
+bool isPacked(const IoPack* pack, const std::int64_t index) {
+    return pack != nullptr &&
+           std::any_of(pack->entries.begin(), pack->entries.end(), [index](const IoPack::Entry& entry) {
+               return entry.index == static_cast<std::size_t>(index);
+           });
+}
+
+}  // namespace
+
 SubGraph::SubGraph(const CreationContext& context,
                    const SubGraphOp& op,
                    IndexCollection&& inputIds,
-                   IndexCollection&& outputIds)
-    : OperationBase(context, op, std::move(inputIds), std::move(outputIds)), model_{op.get_function()} {
-    const bool isStableParamsAndResultsNeeded = nullptr != dynamic_cast<const ov::op::v0::TensorIterator*>(&op);
-    initExecuteSequence(context, isStableParamsAndResultsNeeded, isStableParamsAndResultsNeeded);
+                   IndexCollection&& outputIds,
+                   const std::size_t bodyIdx)
+    : OperationBase(context, op, std::move(inputIds), std::move(outputIds)),
+      model_{op.get_function(static_cast<int>(bodyIdx))} {
+    // Parameter/Result buffers of TensorIterator body are bound by the operation per iteration, other bodies
+    // keep them in their memory block, where they are filled and read by the operation around the body
+    const bool isTensorIterator = nullptr != dynamic_cast<const ov::op::v0::TensorIterator*>(&op);
+    initExecuteSequence(context, true, true, isTensorIterator);
+    exec_sequence_.erase(std::remove_if(exec_sequence_.begin(),
+                                        exec_sequence_.end(),
+                                        [](const auto& operation) {
+                                            return dynamic_cast<const ParameterOp*>(operation.get()) ||
+                                                   dynamic_cast<const ResultOp*>(operation.get());
+                                        }),
+                         exec_sequence_.end());
+    // Nested subgraph is executed by the operation of the outer one, which doesn't wait for its constants
+    if (memory_manager_) {
+        memory_manager_->waitForConstants();
+    }
 }
 
 SubGraph::SubGraph(const CreationContext& context, const std::shared_ptr<const ov::Model>& model)
     : OperationBase(context, nullptr), model_{model} {
-      initExecuteSequence(context, false, false);
+      // Results are downloaded on a separate stream, so their buffers can't be reused by subsequent operations
+      // Inputs and outputs bound directly or transferred by concurrent branches are left out of packs
+      const bool packIo = !context.bindIoTensors() && context.parallelBranches() <= 1;
+      initExecuteSequence(context, false, true, context.bindIoTensors(), context.parallelBranches(), packIo);
+      initParallelBranches(context.parallelBranches());
 }
 
 SubGraph::SubGraph(const CreationContext& context,
                    const std::shared_ptr<const ov::Model>& model,
                    ExecSequence&& sequence,
                    std::shared_ptr<MemoryManager> memoryManager)
-    : OperationBase{context, nullptr}, model_{model}, exec_sequence_{sequence}, memory_manager_{memoryManager} {}
+    : OperationBase{context, nullptr}, model_{model}, exec_sequence_{sequence}, memory_manager_{memoryManager} {
+    // Lifespans of buffers in the memory manager are already extended for parallel branches of the whole model
+    initParallelBranches(context.parallelBranches());
+}
 
-void SubGraph::initExecuteSequence(const CreationContext& context, bool isStableParams, bool isStableResults) {
+void SubGraph::initExecuteSequence(const CreationContext& context,
+                                   bool isStableParams,
+                                   bool isStableResults,
+                                   bool isExternalIo,
+                                   unsigned parallelBranches,
+                                   bool packIo) {
     static constexpr auto InitNeeded = IOperationExec::WorkbufferStatus::InitNeeded;
 
     if (!model_) {
         return;
     }
-    const auto& orderedNodes = model_->get_ordered_ops();
+    const auto isInPlace = [](const ov::Node& node, size_t input_idx) {
+        return OperationRegistry::getInstance().isInPlaceOperation(node, input_idx);
+    };
+    auto orderedNodes = model_->get_ordered_ops();
+    std::unique_ptr<OperationBuffersExtractor> opBuffersExtractor;
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "SubGraph::extractBuffers");
+        const CUDA::NvtxRange nvtxRange{"Solve memory"};
+        opBuffersExtractor = std::make_unique<OperationBuffersExtractor>(
+            orderedNodes, isStableParams, isStableResults, isExternalIo, isInPlace);
+    }
+    if (context.memoryAwareOrdering()) {
+        OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "SubGraph::memoryAwareOrdering");
+        const CUDA::NvtxRange nvtxRange{"Solve memory aware order"};
+        // Memory aware order is applied only if it actually reduces memory block taken by tensors
+        default_order_tensors_memory_size_ = opBuffersExtractor->createMutableMemoryModel()->deviceMemoryBlockSize();
+        tensors_memory_size_ = default_order_tensors_memory_size_;
+        auto memoryAwareNodes = MemoryAwareOrdering::reorder(orderedNodes);
+        auto memoryAwareExtractor = std::make_unique<OperationBuffersExtractor>(
+            memoryAwareNodes, isStableParams, isStableResults, isExternalIo, isInPlace);
+        const auto memoryAwareSize = memoryAwareExtractor->createMutableMemoryModel()->deviceMemoryBlockSize();
+        if (memoryAwareSize < tensors_memory_size_) {
+            orderedNodes = std::move(memoryAwareNodes);
+            opBuffersExtractor = std::move(memoryAwareExtractor);
+            tensors_memory_size_ = memoryAwareSize;
+        }
+    }
 
     std::vector<Ptr> init_sequence{};
-    OperationBuffersExtractor opBuffersExtractor{orderedNodes, isStableParams, isStableResults};
     const auto paramSize = model_->get_parameters().size();
     params_ = std::vector<OperationBase::Ptr>(paramSize);
     params_info_ = std::vector<OperationInfo>(paramSize);
     const auto resultSize = model_->get_results().size();
     results_ = std::vector<OperationBase::Ptr>(resultSize);
     results_info_ = std::vector<OperationInfo>(resultSize);
+    if (context.constantsOffloadLimit()) {
+        opBuffersExtractor->offloadConstants(*context.constantsOffloadLimit());
+        offloaded_constants_memory_size_ = opBuffersExtractor->offloadedConstantsSize();
+    }
+    // Constants are uploaded in background while operations are created
+    auto shared_constants_blob = std::make_shared<DeviceMemBlock>(opBuffersExtractor->createConstantMemoryModel());
+    std::unique_ptr<ConstantsUpload> constants_upload;
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "SubGraph::initConstantMemory");
+        const CUDA::NvtxRange nvtxRange{"Upload constants"};
+        constants_upload = opBuffersExtractor->initConstantMemory(shared_constants_blob, context.ipcConstantsDir());
+    }
+    if (packIo) {
+        initIoPacks(orderedNodes, *opBuffersExtractor);
+    }
+    auto operations = createOperations(context, orderedNodes, *opBuffersExtractor);
+    std::vector<std::shared_ptr<ov::Node>> execNodes;
+    std::vector<std::size_t> execNodeIndices;
     for (unsigned node_idx = 0; node_idx < orderedNodes.size(); node_idx++) {
         const auto& node = orderedNodes[node_idx];
-        if (!OperationRegistry::getInstance().hasOperation(node)) {
-            throw_ov_exception(fmt::format("Node: name = {}, description = {}; Is not found in OperationRegistry",
-                                         node->get_name(),
-                                         node->description()));
-        }
-        auto inIds = opBuffersExtractor.inputTensorIds(*node);
-        auto outIds = opBuffersExtractor.outputTensorIds(*node);
-        auto operation = OperationRegistry::getInstance().createOperation(context, node, move(inIds), move(outIds));
-        if (dynamic_cast<NopOp*>(operation.get())) {
+        auto& operation = operations[node_idx];
+        if (!operation || dynamic_cast<NopOp*>(operation.get())) {
             continue;
         }
-        operation->SetWorkbufferIds(
-            opBuffersExtractor.processWorkbufferRequest(node_idx, operation->GetWorkBufferRequest()));
-        if (InitNeeded == operation->SetWorkbufferIds(opBuffersExtractor.processWorkbufferRequest(
+        if (InitNeeded == operation->SetWorkbufferIds(opBuffersExtractor->processWorkbufferRequest(
                               node_idx, operation->GetWorkBufferRequest()))) {
             init_sequence.push_back(operation);
         }
-        if (dynamic_cast<ParameterOp*>(operation.get())) {
+        if (auto* parameterOp = dynamic_cast<ParameterOp*>(operation.get())) {
             const auto paramIdx =
                 model_->get_parameter_index(std::dynamic_pointer_cast<ov::op::v0::Parameter>(node));
+            if (isPacked(input_pack_.get(), paramIdx)) {
+                parameterOp->SetPack(input_pack_);
+            }
             params_[paramIdx] = operation;
             params_info_[paramIdx].size_ = getTensorByteSize(*node);
             params_info_[paramIdx].type_ = node->get_element_type();
             params_info_[paramIdx].shape_ = node->get_shape();
-        } else if (dynamic_cast<ResultOp*>(operation.get())) {
+        } else if (auto* resultOp = dynamic_cast<ResultOp*>(operation.get())) {
             const auto resultIdx = model_->get_result_index(std::dynamic_pointer_cast<ov::op::v0::Result>(node));
+            if (isPacked(output_pack_.get(), resultIdx)) {
+                resultOp->SetPack(output_pack_);
+            }
             results_[resultIdx] = operation;
             results_info_[resultIdx].size_ = getTensorByteSize(*node);
             results_info_[resultIdx].type_ = node->get_element_type();
             results_info_[resultIdx].shape_ = node->get_shape();
         }
         exec_sequence_.push_back(operation);
+        execNodes.push_back(node);
+        execNodeIndices.push_back(node_idx);
     }
-    memory_manager_ = createMemoryManager(opBuffersExtractor);
+    if (parallelBranches > 1) {
+        // Operations of other branches may be executed while buffers are used, so they can't reuse their memory
+        const auto ends = ParallelBranches::concurrencyEnds(ParallelBranches::dependencies(exec_sequence_));
+        std::vector<std::size_t> nodeEnds(orderedNodes.size());
+        std::iota(nodeEnds.begin(), nodeEnds.end(), 0);
+        for (std::size_t i = 0; i < ends.size(); ++i) {
+            nodeEnds[execNodeIndices[i]] = execNodeIndices[ends[i]];
+        }
+        opBuffersExtractor->extendLifespans(nodeEnds);
+    }
+    if (context.persistentKernelMaxElements() > 0) {
+        exec_sequence_ = createPersistentSequences(context, exec_sequence_, execNodes);
+    }
+    mutable_workbuffers_memory_size_ = opBuffersExtractor->mutableWorkbuffersSize();
+    shared_mutable_workbuffers_memory_size_ = opBuffersExtractor->sharedMutableWorkbuffersSize();
+    const auto liveSizes = opBuffersExtractor->liveMutableBuffersSizes();
+    for (unsigned node_idx = 0; node_idx < orderedNodes.size(); node_idx++) {
+        if (!ov::is_type<ov::op::v0::Constant>(orderedNodes[node_idx])) {
+            live_memory_sizes_.emplace(orderedNodes[node_idx]->get_friendly_name(), liveSizes[node_idx]);
+        }
+    }
+    if (context.memoryLayout()) {
+        memory_layout_ = opBuffersExtractor->memoryLayout(orderedNodes);
+    }
+    memory_manager_ = createMemoryManager(*opBuffersExtractor, shared_constants_blob, std::move(constants_upload));
     initSharedImmutableWorkbuffers(init_sequence);
 }
 
-std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor) {
+void SubGraph::initIoPacks(const std::vector<std::shared_ptr<ov::Node>>& nodes,
+                           OperationBuffersExtractor& opBuffersExtractor) {
+    std::vector<std::pair<OperationBuffersExtractor::NodePtr, ov::Output<ov::Node>>> parameters;
+    std::vector<std::pair<OperationBuffersExtractor::NodePtr, ov::Output<ov::Node>>> results;
+    for (const auto& node : nodes) {
+        if (ov::is_type<ov::op::v0::Parameter>(node) && getTensorByteSize(*node) <= kMaxPackedIoTensorSize) {
+            parameters.emplace_back(node, node->output(0));
+        }
+    }
+    // The last Result is executed after all other ones are computed, so it downloads the pack
+    for (auto node = nodes.rbegin(); node != nodes.rend(); ++node) {
+        if (ov::is_type<ov::op::v0::Result>(*node) && getTensorByteSize(**node) <= kMaxPackedIoTensorSize) {
+            results.emplace_back(*node, (*node)->input_value(0));
+        }
+    }
+    const auto packedParameters = opBuffersExtractor.packTensors(parameters);
+    if (!packedParameters.offsets.empty()) {
+        auto pack = std::make_shared<IoPack>();
+        pack->size = packedParameters.size;
+        for (const auto& [node, offset] : packedParameters.offsets) {
+            const auto parameter = std::dynamic_pointer_cast<ov::op::v0::Parameter>(node);
+            pack->entries.push_back({static_cast<std::size_t>(model_->get_parameter_index(parameter)),
+                                     ParameterOp::GetInputTensorName(*node),
+                                     offset,
+                                     getTensorByteSize(*node)});
+        }
+        input_pack_ = std::move(pack);
+    }
+    const auto packedResults = opBuffersExtractor.packTensors(results);
+    if (!packedResults.offsets.empty()) {
+        auto pack = std::make_shared<IoPack>();
+        pack->size = packedResults.size;
+        for (const auto& [node, offset] : packedResults.offsets) {
+            const auto result = std::dynamic_pointer_cast<ov::op::v0::Result>(node);
+            pack->entries.push_back({static_cast<std::size_t>(model_->get_result_index(result)),
+                                     ResultOp::GetOutputTensorName(*result).front(),
+                                     offset,
+                                     getTensorByteSize(*node)});
+        }
+        output_pack_ = std::move(pack);
+    }
+}
+
+void SubGraph::initParallelBranches(const unsigned maxStreams) {
+    if (maxStreams <= 1) {
+        return;
+    }
+    auto branches = std::make_shared<const ParallelBranches>(exec_sequence_, maxStreams);
+    if (branches->numStreams() > 1) {
+        parallel_branches_ = std::move(branches);
+    }
+}
+
+std::vector<OperationBase::Ptr> SubGraph::createPersistentSequences(
+    const CreationContext& context,
+    const std::vector<OperationBase::Ptr>& sequence,
+    const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+    const auto maxElements = context.persistentKernelMaxElements();
+    std::vector<OperationBase::Ptr> result;
+    size_t begin = 0;
+    while (begin < sequence.size()) {
+        size_t end = begin;
+        while (end < sequence.size() && end - begin < kernel::PersistentSequence::max_steps &&
+               PersistentSequenceOp::step(*nodes[end], maxElements) &&
+               nodes[end]->get_output_element_type(0) == nodes[begin]->get_output_element_type(0)) {
+            ++end;
+        }
+        // A single operation gains nothing from the persistent kernel
+        if (end - begin > 1) {
+            result.push_back(std::make_shared<PersistentSequenceOp>(
+                context,
+                std::vector<std::shared_ptr<ov::Node>>(nodes.begin() + begin, nodes.begin() + end),
+                std::vector<OperationBase::Ptr>(sequence.begin() + begin, sequence.begin() + end)));
+            begin = end;
+        } else {
+            result.push_back(sequence[begin]);
+            ++begin;
+        }
+    }
+    return result;
+}
+
+std::vector<OperationBase::Ptr> SubGraph::createOperations(const CreationContext& context,
+                                                           const std::vector<std::shared_ptr<ov::Node>>& nodes,
+                                                           const OperationBuffersExtractor& opBuffersExtractor) {
+    OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "SubGraph::createOperations");
+    const CUDA::NvtxRange nvtxRange{"Create operations"};
+    std::vector<OperationBase::Ptr> operations(nodes.size());
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& node = nodes[i];
+        if (opBuffersExtractor.isViewNode(*node)) {
+            // Outputs are views into the input, so there is nothing to execute
+            continue;
+        }
+        if (!OperationRegistry::getInstance().hasOperation(node)) {
+            throw_ov_exception(fmt::format("Node: name = {}, description = {}; Is not found in OperationRegistry",
+                                         node->get_name(),
+                                         node->description()));
+        }
+        indices.push_back(i);
+    }
+    auto create = [&](const CreationContext& threadContext, const size_t i) {
+        const auto& node = nodes[i];
+        operations[i] = OperationRegistry::getInstance().createOperation(threadContext,
+                                                                         node,
+                                                                         opBuffersExtractor.inputTensorIds(*node),
+                                                                         opBuffersExtractor.outputTensorIds(*node));
+    };
+    const auto numThreads = std::min<size_t>(context.compilationNumThreads(), indices.size());
+    if (numThreads <= 1) {
+        for (const auto i : indices) {
+            create(context, i);
+        }
+        return operations;
+    }
+    // Operations are independent at creation, each thread takes the next one; the result keeps the order of nodes
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    auto work = [&] {
+        const auto threadContext = context.forWorkerThread();
+        for (auto n = next++; n < indices.size() && !failed; n = next++) {
+            try {
+                create(threadContext, indices[n]);
+            } catch (...) {
+                failed = true;
+                throw;
+            }
+        }
+    };
+    std::vector<std::future<void>> workers;
+    workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers.push_back(std::async(std::launch::async, work));
+    }
+    for (auto& worker : workers) {
+        worker.wait();
+    }
+    for (auto& worker : workers) {
+        worker.get();
+    }
+    return operations;
+}
+
+std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor,
+                                                             DeviceMemBlock::Ptr sharedConstantsBlob,
+                                                             std::unique_ptr<ConstantsUpload> constantsUpload) {
+    OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "SubGraph::createMemoryManager");
+    const CUDA::NvtxRange nvtxRange{"Build memory models"};
     // Build memory model for mutable memory block
-    auto constants_model = opBuffersExtractor.createConstantMemoryModel();
     auto memory_model = opBuffersExtractor.createMutableMemoryModel();
     auto immutable_workbuffer_model = opBuffersExtractor.createImmutableMemoryModel();
 
-    // Build shared constants memory block
-    auto shared_constants_blob = std::make_shared<DeviceMemBlock>(constants_model);
-    opBuffersExtractor.initConstantMemory(shared_constants_blob);
-
     auto immutable_workbuffers = std::make_shared<DeviceMemBlock>(immutable_workbuffer_model);
     // Later on, for each infer request
-    return std::make_unique<MemoryManager>(shared_constants_blob, memory_model, immutable_workbuffers);
+    return std::make_unique<MemoryManager>(sharedConstantsBlob,
+                                           memory_model,
+                                           immutable_workbuffers,
+                                           createExternalBufferBindings(opBuffersExtractor),
+                                           std::move(constantsUpload));
+}
+
+std::vector<MemoryManager::ExternalBufferBinding> SubGraph::createExternalBufferBindings(
+    const OperationBuffersExtractor& opBuffersExtractor) {
+    std::vector<MemoryManager::ExternalBufferBinding> bindings;
+    for (const auto& buffer : opBuffersExtractor.externalBuffers()) {
+        if (!buffer.variable.empty()) {
+            bindings.push_back({buffer.id, false, {}, buffer.size, buffer.variable});
+        } else if (ov::is_type<ov::op::v0::Parameter>(buffer.node)) {
+            bindings.push_back({buffer.id, true, {ParameterOp::GetInputTensorName(*buffer.node)}, buffer.size});
+        } else {
+            const auto result = ov::as_type<const ov::op::v0::Result>(buffer.node.get());
+            bindings.push_back({buffer.id, false, ResultOp::GetOutputTensorName(*result), buffer.size});
+        }
+    }
+    return bindings;
 }
 
 void SubGraph::initSharedImmutableWorkbuffers(const std::vector<OperationBase::Ptr>& init_sequence) {
@@ -139,6 +421,34 @@ void SubGraph::Capture(InferenceRequestContext &context, Inputs, Outputs,
     executionDelegator.capture_sequence(this, memoryManager, mutableBuffer, context);
 }
 
+CUDA::Graph SubGraph::captureBody(InferenceRequestContext& context,
+                                  const ExternalBuffers& bodyBuffers,
+                                  const std::function<void(InferenceRequestContext&)>& launch) const {
+    std::lock_guard<std::mutex> lock{body_capture_mutex_};
+    if (!body_thread_context_) {
+        // Streams and library handles can't be created by the thread, which captures a graph, in the default mode
+        cudaStreamCaptureMode mode = cudaStreamCaptureModeRelaxed;
+        throwIfError(cudaThreadExchangeStreamCaptureMode(&mode));
+        try {
+            body_thread_context_ = std::make_unique<ThreadContext>(context.getThreadContext().device());
+        } catch (...) {
+            cudaThreadExchangeStreamCaptureMode(&mode);
+            throw;
+        }
+        throwIfError(cudaThreadExchangeStreamCaptureMode(&mode));
+    }
+    InferenceRequestContext bodyContext{context, *body_thread_context_, bodyBuffers};
+    auto& executionDelegator = context.getExecutionDelegator();
+    CUDA::GraphCapture capture{body_thread_context_->stream()};
+    {
+        auto scope = capture.getScope();
+        executionDelegator.set_stream(body_thread_context_->stream());
+        launch(bodyContext);
+    }
+    executionDelegator.set_stream(context.getThreadContext().stream());
+    return capture.getGraph();
+}
+
 WorkbufferRequest SubGraph::GetWorkBufferRequest() const {
     const auto memoryBlockSize = memory_manager_->mutableTensorsMemoryModel()->deviceMemoryBlockSize();
     return {{}, {memoryBlockSize}};
@@ -154,6 +464,29 @@ void SubGraph::Execute(const InferenceRequestContext& context, Inputs, Outputs,
     executionDelegator.execute_sequence(this, memoryManager, mutableBuffer, context);
 }
 
+std::shared_ptr<ExecutionPointers> SubGraph::executionPointers(CUDA::DevicePointer<void*> mutableBuffer,
+                                                               const ExternalBuffers& externalBuffers) const {
+    // Memory blocks beyond the preallocated ones may be freed and allocated elsewhere
+    constexpr std::size_t kMaxCachedBuffers = 64;
+    auto& cache = *execution_pointers_;
+    {
+        std::lock_guard<std::mutex> lock{cache.mutex};
+        if (auto found = cache.pointers.find(mutableBuffer.get()); found != cache.pointers.end()) {
+            // A mutable buffer is used by a single inference at a time
+            auto pointers = found->second;
+            pointers->update(externalBuffers);
+            return pointers;
+        }
+    }
+    auto pointers = std::make_shared<ExecutionPointers>(*memory_manager_, exec_sequence_, mutableBuffer, externalBuffers);
+    std::lock_guard<std::mutex> lock{cache.mutex};
+    if (cache.pointers.size() >= kMaxCachedBuffers) {
+        cache.pointers.clear();
+    }
+    cache.pointers.emplace(mutableBuffer.get(), pointers);
+    return pointers;
+}
+
 bool SubGraph::IsCudaGraphCompatible() const {
     if (is_cuda_graph_compatible_ == CompatibleState::NOT_INITIALIZED) {
         is_cuda_graph_compatible_ = CompatibleState::COMPATIBLE;
@@ -4,10 +4,19 @@
 
 #pragma once
 
+#include <cuda/graph.hpp>
+#include <cuda_io_pack.hpp>
 #include <cuda_op_buffers_extractor.hpp>
+#include <cuda_parallel_branches.hpp>
+#include <cuda_thread_context.hpp>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <cuda_operation_base.hpp>
+#include <memory_manager/cuda_execution_pointers.hpp>
 #include <memory_manager/cuda_memory_manager.hpp>
 #include <memory_manager/cuda_memory_pool.hpp>
+#include <unordered_map>
 
 #include "openvino/op/util/sub_graph_base.hpp"
 
@@ -45,25 +54,141 @@ public:
 
     inline const std::shared_ptr<const ov::Model> getModel() const { return model_; };
 
+    /**
+     * @param mutableBuffer Mutable memory of an infer request, which the sequence is executed in
+     * @param externalBuffers Pointers of external buffers for the current inference
+     * @returns Pointers of inputs, outputs and work buffers of the operations of the sequence, which are resolved
+     *          once per mutable buffer and reused by later inferences
+     */
+    std::shared_ptr<ExecutionPointers> executionPointers(CUDA::DevicePointer<void*> mutableBuffer,
+                                                         const ExternalBuffers& externalBuffers) const;
+
+    /**
+     * @returns Size of mutable memory block taken by tensors (without work buffers) in the default order of nodes,
+     *          0 if memory aware ordering is disabled
+     */
+    std::size_t defaultOrderTensorsMemorySize() const noexcept { return default_order_tensors_memory_size_; }
+
+    /**
+     * @returns Size of mutable memory block taken by tensors (without work buffers) in the applied order of nodes,
+     *          0 if memory aware ordering is disabled
+     */
+    std::size_t tensorsMemorySize() const noexcept { return tensors_memory_size_; }
+
+    /**
+     * @returns Size of mutable memory (tensors and work buffers) which is alive at each operation, by operation name
+     */
+    const std::map<std::string, std::size_t>& liveMemorySizes() const noexcept { return live_memory_sizes_; }
+
+    /**
+     * @returns Placement of buffers in memory blocks, empty unless CreationContext::memoryLayout() is enabled
+     */
+    const std::vector<MemoryLayoutEntry>& memoryLayout() const noexcept { return memory_layout_; }
+
+    /**
+     * @returns Size of constants placed out of device memory, 0 if constants offload is disabled
+     */
+    std::size_t offloadedConstantsMemorySize() const noexcept { return offloaded_constants_memory_size_; }
+
+    /**
+     * @returns Total size of mutable work buffers of all operations, as if each of them took separate memory
+     */
+    std::size_t mutableWorkbuffersMemorySize() const noexcept { return mutable_workbuffers_memory_size_; }
+
+    /**
+     * @returns Size of memory actually taken by mutable work buffers in the memory block of an infer request
+     */
+    std::size_t sharedMutableWorkbuffersMemorySize() const noexcept { return shared_mutable_workbuffers_memory_size_; }
+
+    /**
+     * @returns Schedule of the sequence on streams of parallel branches, nullptr if the sequence is executed
+     *          on the compute stream only (see ov::nvidia_gpu::parallel_branches)
+     */
+    const ParallelBranches* parallelBranches() const noexcept { return parallel_branches_.get(); }
+
+    /**
+     * @returns Small inputs, which buffers are packed into a single buffer uploaded by a single copy,
+     *          nullptr if inputs aren't packed
+     */
+    const IoPack* inputPack() const noexcept { return input_pack_.get(); }
+
+    /**
+     * @returns Small outputs, which buffers are packed into a single buffer downloaded by a single copy,
+     *          nullptr if outputs aren't packed
+     */
+    const IoPack* outputPack() const noexcept { return output_pack_.get(); }
+
     const std::vector<OperationBase::Ptr>& getParams() const;
     const std::vector<OperationBase::Ptr>& getResults() const;
 
 private:
     void initSharedImmutableWorkbuffers(const std::vector<OperationBase::Ptr>& init_sequence);
-    void initExecuteSequence(const CreationContext& context, bool isStableParams, bool isStableResults);
-    static std::unique_ptr<MemoryManager> createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor);
+    void initExecuteSequence(const CreationContext& context,
+                             bool isStableParams,
+                             bool isStableResults,
+                             bool isExternalIo = false,
+                             unsigned parallelBranches = 1,
+                             bool packIo = false);
+    /**
+     * Packs buffers of small inputs and of small outputs of the model (see OperationBuffersExtractor::packTensors)
+     * @param nodes Nodes in the order of execution, the first packed input and the last packed output
+     *              are placed at offset 0 and transfer their packs
+     */
+    void initIoPacks(const std::vector<std::shared_ptr<ov::Node>>& nodes,
+                     OperationBuffersExtractor& opBuffersExtractor);
+    /**
+     * Schedules the sequence on streams of parallel branches, if it has any independent operations
+     * @param maxStreams Maximum number of streams of the branches
+     */
+    void initParallelBranches(unsigned maxStreams);
+    /**
+     * Creates operations of the nodes on ov::compilation_num_threads threads
+     * @returns Operations in the order of the nodes, nullptr for nodes which are views into their inputs
+     */
+    static std::vector<OperationBase::Ptr> createOperations(const CreationContext& context,
+                                                            const std::vector<std::shared_ptr<ov::Node>>& nodes,
+                                                            const OperationBuffersExtractor& opBuffersExtractor);
+    /**
+     * Replaces runs of small element-wise operations, which follow each other in the sequence, by
+     * PersistentSequenceOp (see ov::nvidia_gpu::persistent_kernel_max_elements)
+     * @param nodes Nodes of the operations of the sequence
+     */
+    static std::vector<OperationBase::Ptr> createPersistentSequences(
+        const CreationContext& context,
+        const std::vector<OperationBase::Ptr>& sequence,
+        const std::vector<std::shared_ptr<ov::Node>>& nodes);
+    static std::unique_ptr<MemoryManager> createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor,
+                                                              DeviceMemBlock::Ptr sharedConstantsBlob,
+                                                              std::unique_ptr<ConstantsUpload> constantsUpload);
+    static std::vector<MemoryManager::ExternalBufferBinding> createExternalBufferBindings(
+        const OperationBuffersExtractor& opBuffersExtractor);
     std::vector<DevicePointer<void*>> getSharedWorkbuffers(const IOperationExec& operation);
 
 protected:
-    using SubGraphOp = ov::op::util::SubGraphOp;
+    using SubGraphOp = ov::op::util::MultiSubGraphOp;
 
+    /**
+     * Creates the sequence of a body of the operation (e.g. of TensorIterator, Loop or a branch of If).
+     * Parameter and Result operations of the body are left out of the sequence, their buffers are filled
+     * and read by the operation
+     */
     SubGraph(const CreationContext& context,
              const SubGraphOp& node,
              IndexCollection&& inputIds,
-             IndexCollection&& outputIds);
+             IndexCollection&& outputIds,
+             std::size_t bodyIdx = 0);
 
     WorkbufferRequest GetWorkBufferRequest() const override;
 
+    /**
+     * Captures work launched by the function on the stream of the given body context into a separate graph.
+     * The work is launched on the stream of a separate thread context, while the stream of the inference request
+     * is being captured
+     */
+    CUDA::Graph captureBody(InferenceRequestContext& context,
+                            const ExternalBuffers& bodyBuffers,
+                            const std::function<void(InferenceRequestContext&)>& launch) const;
+
     template <typename TNode>
     std::size_t getTensorByteSize(const TNode& node) {
         return node.get_element_type().size() * shape_size(node.get_shape());
@@ -87,8 +212,29 @@ protected:
     std::vector<OperationBase::Ptr> results_;
     std::vector<OperationInfo> results_info_;
     std::shared_ptr<const ov::Model> model_;
+    std::size_t default_order_tensors_memory_size_ = 0;
+    std::size_t tensors_memory_size_ = 0;
+    std::map<std::string, std::size_t> live_memory_sizes_;
+    std::vector<MemoryLayoutEntry> memory_layout_;
+    std::size_t offloaded_constants_memory_size_ = 0;
+    std::size_t mutable_workbuffers_memory_size_ = 0;
+    std::size_t shared_mutable_workbuffers_memory_size_ = 0;
+    std::shared_ptr<const ParallelBranches> parallel_branches_;
+    std::shared_ptr<const IoPack> input_pack_;
+    std::shared_ptr<const IoPack> output_pack_;
 
     mutable CompatibleState is_cuda_graph_compatible_ = CompatibleState::NOT_INITIALIZED;
+
+    struct ExecutionPointersCache {
+        std::mutex mutex;
+        std::unordered_map<const void*, std::shared_ptr<ExecutionPointers>> pointers;
+    };
+    // Shared by copies of the subgraph, which have the same sequence
+    std::shared_ptr<ExecutionPointersCache> execution_pointers_ = std::make_shared<ExecutionPointersCache>();
+
+private:
+    mutable std::mutex body_capture_mutex_;
+    mutable std::unique_ptr<ThreadContext> body_thread_context_;
 };
 
 }  // namespace nvidia_gpu
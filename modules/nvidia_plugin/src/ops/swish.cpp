@@ -54,8 +54,11 @@ SwishOp::SwishOp(const CreationContext& context,
     size_t num_elements = ov::shape_size(input_shape);
     const size_t max_threads_per_block = context.device().props().maxThreadsPerBlock;
     const double beta = beta_from_constant(node);
-    kernel_ = kernel::Swish{
-        convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type), max_threads_per_block, num_elements, beta};
+    kernel_ = kernel::Swish{convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type),
+                            max_threads_per_block,
+                            num_elements,
+                            beta,
+                            context.fastMath()};
 }
 
 void SwishOp::Execute(const InferenceRequestContext& context,
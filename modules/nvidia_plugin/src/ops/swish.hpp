@@ -14,6 +14,7 @@ namespace nvidia_gpu {
 
 class SwishOp : public OperationBase {
 public:
+    static constexpr bool kInPlace = true;
     SwishOp(const CreationContext& context,
             const ov::Node& node,
             IndexCollection&& inputIds,
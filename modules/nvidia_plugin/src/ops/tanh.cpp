@@ -19,6 +19,17 @@ TanhOp::TanhOp(const CreationContext& context,
     : ActivationForwardCuDnnOpBase{
           std::make_unique<CUDA::TanhDescriptor>(), context, *node, move(inputIds), move(outputIds)} {}
 
-OPERATION_REGISTER(TanhOp, Tanh);
+static OperationBase::Ptr tanhFactory(const CreationContext& context,
+                                      const std::shared_ptr<ov::Node>& node,
+                                      OperationBase::IndexCollection&& inputIds,
+                                      OperationBase::IndexCollection&& outputIds) {
+    if (context.fastMath()) {
+        return std::make_shared<TanhFastOp>(
+            context, downcast<const ov::op::v0::Tanh>(node), std::move(inputIds), std::move(outputIds));
+    }
+    return std::make_shared<TanhOp>(context, node, std::move(inputIds), std::move(outputIds));
+}
+
+OPERATION_REGISTER_IN_PLACE_FACTORY(tanhFactory, Tanh)
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -5,6 +5,9 @@
 #pragma once
 
 #include "activation_forward_cudnn_base.hpp"
+#include "elementwise_unary.hpp"
+#include "kernels/tanh.hpp"
+#include "openvino/op/tanh.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -17,5 +20,14 @@ public:
            IndexCollection&& outputIds);
 };
 
+/**
+ * Element-wise Tanh with fast approximations of math, which replaces cuDNN activation when
+ * ov::nvidia_gpu::fast_math is enabled
+ */
+class TanhFastOp : public ElementwiseUnaryOp<ov::op::v0::Tanh, kernel::Tanh> {
+public:
+    using ElementwiseUnaryOp::ElementwiseUnaryOp;
+};
+
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -4,22 +4,35 @@
 
 #include "tensor_iterator.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cuda_inference_request_context.hpp>
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_iexecution_delegator.hpp>
 #include <kernels/details/cuda_type_traits.hpp>
 #include <kernels/details/tensor_helpers.hpp>
 #include <kernels/insert.hpp>
 #include <kernels/slice.hpp>
+#include <unordered_set>
+#include <utility>
 
 #include "converters.hpp"
 #include "cuda_operation_registry.hpp"
-#include "parameter.hpp"
-#include "result.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/**
+ * @returns true if slices along the axis are contiguous in memory
+ */
+bool isOutermostAxis(const ov::Shape& shape, int64_t axis) {
+    return std::all_of(shape.begin(), shape.begin() + axis, [](size_t dim) { return dim == 1; });
+}
+
+}  // namespace
+
 TensorIteratorOp::TensorIteratorOp(const CreationContext& context,
                                    const NodeOp& op,
                                    IndexCollection&& inputIds,
@@ -102,8 +115,12 @@ TensorIteratorOp::TensorIteratorOp(const CreationContext& context,
         }
     }
     max_threads_per_block_ = context.device().props().maxThreadsPerBlock;
+    initBodyBuffers();
 
     for (const auto& [inputIdx, portMap] : portmap_inputs_) {
+        if (aliased_inputs_.count(inputIdx) > 0) {
+            continue;
+        }
         const auto inputShape = inputs_info_[inputIdx].shape_;
         const auto inputType = inputs_info_[inputIdx].type_;
 
@@ -117,7 +134,7 @@ TensorIteratorOp::TensorIteratorOp(const CreationContext& context,
     }
 
     for (const auto& [resultIdx, outputIdx] : results_outputs_map_) {
-        if (portmap_outputs_.count(outputIdx) > 0) {
+        if (portmap_outputs_.count(outputIdx) > 0 && aliased_outputs_.count(outputIdx) == 0) {
             const auto& resultShape = results_info_[resultIdx].shape_;
             const auto outputShape = outputs_info_[outputIdx].shape_;
             const auto outputType = outputs_info_[outputIdx].type_;
@@ -131,53 +148,88 @@ TensorIteratorOp::TensorIteratorOp(const CreationContext& context,
             kernelmap_outputs_.emplace(outputIdx, kernel::Insert(element_type, props, max_threads_per_block_));
         }
     }
-
-    updateExecSequence();
 }
 
 void TensorIteratorOp::Execute(const InferenceRequestContext& context,
                                Inputs inputTensors,
                                Outputs outputTensors,
                                const Workbuffers& workbuffers) const {
+    executeIterations(context, inputTensors, outputTensors, workbuffers, {});
+}
+
+// Iterations are unrolled into the captured graph, so it is compatible if all operations of the body are compatible.
+// Bodies are captured under a lock on a stream of their own, so requests of throughput mode capture them in turn
+bool TensorIteratorOp::IsCudaGraphCompatible() const { return SubGraph::IsCudaGraphCompatible(); }
+
+void TensorIteratorOp::Capture(InferenceRequestContext& context,
+                               Inputs inputTensors,
+                               Outputs outputTensors,
+                               const Workbuffers& workbuffers) const {
+    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    // Bodies with the same buffers are captured once and added to the graph as often as needed
+    std::vector<CUDA::Graph> bodies;
+    const auto period = std::min(bodyBuffersPeriod(), num_iterations_);
+    for (int64_t iter = 0; iter < period; ++iter) {
+        ExternalBuffers bodyBuffers;
+        bindBodyBuffers(bodyBuffers, workbuffers, inputTensors, outputTensors, iter);
+        bodies.push_back(captureBody(context, bodyBuffers, [&](InferenceRequestContext& bodyContext) {
+            context.getExecutionDelegator().capture_sequence(this, *memory_manager_, mutableBuffer, bodyContext);
+        }));
+    }
+    executeIterations(context, inputTensors, outputTensors, workbuffers, bodies);
+}
+
+void TensorIteratorOp::executeIterations(const InferenceRequestContext& context,
+                                         Inputs inputTensors,
+                                         Outputs outputTensors,
+                                         const Workbuffers& workbuffers,
+                                         const std::vector<CUDA::Graph>& bodies) const {
     const auto& stream = context.getThreadContext().stream();
     const auto& memoryManager = *memory_manager_;
     auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
-    auto& cancellationToken = context.getCancellationToken();
     auto& executionDelegator = context.getExecutionDelegator();
     executionDelegator.set_stream(stream);
+    ExternalBuffers bodyBuffers;
+    const InferenceRequestContext bodyContext{context, context.getThreadContext(), bodyBuffers};
 
     // First iteration
-    for (const auto inputIdx : invariant_inputs_) {
-        const auto paramIdx = inputs_parameters_map_.at(inputIdx);
-        copyParam(stream, mutableBuffer, inputTensors, 0, inputIdx, paramIdx);
-    }
+    bindBodyBuffers(bodyBuffers, workbuffers, inputTensors, outputTensors, 0);
     for (const auto& [inputIdx, paramIdx] : inputs_parameters_map_) {
-        if (portmap_inputs_.count(inputIdx) == 0) {
-            copyParam(stream, mutableBuffer, inputTensors, 0, inputIdx, paramIdx);
+        if (portmap_inputs_.count(inputIdx) == 0 && aliased_inputs_.count(inputIdx) == 0) {
+            copyParam(stream, mutableBuffer, bodyBuffers, inputTensors, 0, inputIdx, paramIdx);
         }
     }
 
     for (int64_t iter = 0; iter < num_iterations_; ++iter) {
+        bindBodyBuffers(bodyBuffers, workbuffers, inputTensors, outputTensors, iter);
 
         // Input mapping of ports
         for (auto& it : portmap_inputs_) {
             const auto& inputIdx = it.first;
             const auto& paramIdx = inputs_parameters_map_.at(inputIdx);
-            copyParam(stream, mutableBuffer, inputTensors, iter, inputIdx, paramIdx);
+            if (aliased_inputs_.count(inputIdx) == 0) {
+                copyParam(stream, mutableBuffer, bodyBuffers, inputTensors, iter, inputIdx, paramIdx);
+            }
         }
 
         // Inner loop
-        executionDelegator.execute_sequence(this, memoryManager, mutableBuffer, context);
+        if (!bodies.empty()) {
+            CUDA::CaptureInfo{stream}.addChildGraphNode(bodies[iter % bodies.size()]);
+        } else {
+            executionDelegator.execute_sequence(this, memoryManager, mutableBuffer, bodyContext);
+        }
 
         // Back-edge mapping
         for (auto& [resultIdx, paramIdx] : results_parameters_map_) {
-            copyBackEdge(stream, mutableBuffer, resultIdx, paramIdx);
+            if (alternating_back_edges_.count(resultIdx) == 0) {
+                copyBackEdge(stream, mutableBuffer, bodyBuffers, resultIdx, paramIdx);
+            }
         }
 
         // Output mapping of ports
         for (const auto& [resultIdx, outputIdx] : results_outputs_map_) {
-            if (portmap_outputs_.count(outputIdx) > 0) {
-                copyResult(stream, mutableBuffer, outputTensors, iter, resultIdx, outputIdx);
+            if (portmap_outputs_.count(outputIdx) > 0 && aliased_outputs_.count(outputIdx) == 0) {
+                copyResult(stream, mutableBuffer, bodyBuffers, outputTensors, iter, resultIdx, outputIdx);
             }
         }
 
@@ -185,21 +237,115 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
         if (iterations_results_map_.count(iter) > 0) {
             for (const auto& resultIdx : iterations_results_map_.at(iter)) {
                 const auto& outputIdx = results_outputs_map_.at(resultIdx);
-                copyResult(stream, mutableBuffer, outputTensors, iter, resultIdx, outputIdx);
+                copyResult(stream, mutableBuffer, bodyBuffers, outputTensors, iter, resultIdx, outputIdx);
             }
         }
     }
 }
 
-// TODO: Investigate problem with multi-graphs in some networks
-// benchmark_app may hang in throughput mode
-bool TensorIteratorOp::IsCudaGraphCompatible() const { return false; }
+void TensorIteratorOp::initBodyBuffers() {
+    std::unordered_set<BufferID> bound;
+    auto bind = [&bound](std::optional<BufferID> buffer) { return buffer && bound.insert(*buffer).second; };
+    // Parameters are never written by the body, so invariant inputs and contiguous slices are read in place
+    for (const auto& [inputIdx, paramIdx] : inputs_parameters_map_) {
+        const auto buffer = externalBuffer(params_[paramIdx]->GetOutputIds()[0], true);
+        const auto& inputShape = inputs_info_[inputIdx].shape_;
+        const auto portMap = portmap_inputs_.find(inputIdx);
+        if (portMap == portmap_inputs_.end()) {
+            const bool isInvariant =
+                std::find(invariant_inputs_.begin(), invariant_inputs_.end(), inputIdx) != invariant_inputs_.end();
+            if (isInvariant && bind(buffer)) {
+                aliased_inputs_[inputIdx] = Alias{*buffer, 0};
+            }
+        } else if (isOutermostAxis(inputShape, portMap->second.axis) && bind(buffer)) {
+            const auto sliceSize = inputs_info_[inputIdx].size_ / inputShape[portMap->second.axis];
+            aliased_inputs_[inputIdx] = Alias{*buffer, sliceSize};
+        }
+    }
+    // Results of back edges are read by the next iteration, so only the others are written in place
+    for (const auto& [resultIdx, outputIdx] : results_outputs_map_) {
+        const auto portMap = portmap_outputs_.find(outputIdx);
+        if (portMap == portmap_outputs_.end() || results_parameters_map_.count(resultIdx) > 0) {
+            continue;
+        }
+        const auto& outputShape = outputs_info_[outputIdx].shape_;
+        const auto buffer = externalBuffer(results_[resultIdx]->GetInputIds()[0], false);
+        if (isOutermostAxis(outputShape, portMap->second.axis) && bind(buffer)) {
+            const auto sliceSize = outputs_info_[outputIdx].size_ / outputShape[portMap->second.axis];
+            aliased_outputs_[outputIdx] = Alias{*buffer, sliceSize};
+        }
+    }
+    std::unordered_set<BufferID> aliased = bound;
+    for (const auto& [resultIdx, paramIdx] : results_parameters_map_) {
+        const auto resultBuffer = externalBuffer(results_[resultIdx]->GetInputIds()[0], false);
+        const auto paramBuffer = externalBuffer(params_[paramIdx]->GetOutputIds()[0], true);
+        if (resultBuffer && paramBuffer && bound.count(*resultBuffer) == 0 && bound.count(*paramBuffer) == 0) {
+            bind(resultBuffer);
+            bind(paramBuffer);
+            alternating_back_edges_[resultIdx] = {*resultBuffer, *paramBuffer};
+        }
+    }
+    for (const auto& binding : memory_manager_->externalBufferBindings()) {
+        if (aliased.count(binding.bufferId) == 0) {
+            body_buffers_.emplace_back(binding.bufferId, binding.size);
+        }
+    }
+}
 
-void TensorIteratorOp::Capture(InferenceRequestContext& context,
-                               Inputs inputTensors,
-                               Outputs outputTensors,
-                               const Workbuffers& workbuffers) const {
-    Execute(context, inputTensors, outputTensors, workbuffers);
+std::optional<BufferID> TensorIteratorOp::externalBuffer(const TensorID& tensor, const bool isInput) const {
+    if (tensor.GetBuffer().GetId() != tensor.GetId()) {
+        return std::nullopt;
+    }
+    for (const auto& binding : memory_manager_->externalBufferBindings()) {
+        if (binding.bufferId == tensor.GetId() && binding.isInput == isInput) {
+            return binding.bufferId;
+        }
+    }
+    return std::nullopt;
+}
+
+int64_t TensorIteratorOp::bodyBuffersPeriod() const {
+    const auto isSlice = [](const auto& alias) { return alias.second.slice_size > 0; };
+    if (!aliased_outputs_.empty() || std::any_of(aliased_inputs_.begin(), aliased_inputs_.end(), isSlice)) {
+        return num_iterations_;
+    }
+    return alternating_back_edges_.empty() ? 1 : 2;
+}
+
+void TensorIteratorOp::bindBodyBuffers(ExternalBuffers& bodyBuffers,
+                                       const Workbuffers& workbuffers,
+                                       Inputs inputTensors,
+                                       Outputs outputTensors,
+                                       const std::int64_t iter) const {
+    for (std::size_t i = 0; i < body_buffers_.size(); ++i) {
+        bodyBuffers[body_buffers_[i].first] = workbuffers.mutable_buffers.at(i + 1).get();
+    }
+    for (const auto& [inputIdx, alias] : aliased_inputs_) {
+        std::size_t start = 0;
+        if (const auto portMap = portmap_inputs_.find(inputIdx); portMap != portmap_inputs_.end()) {
+            start = sliceStart(portMap->second, inputs_info_[inputIdx].shape_, iter);
+        }
+        bodyBuffers[alias.buffer] = (inputTensors[inputIdx].as_mutable() + start * alias.slice_size).get();
+    }
+    for (const auto& [outputIdx, alias] : aliased_outputs_) {
+        const auto start = sliceStart(portmap_outputs_.at(outputIdx), outputs_info_[outputIdx].shape_, iter);
+        bodyBuffers[alias.buffer] = (outputTensors[outputIdx] + start * alias.slice_size).get();
+    }
+    if (iter % 2 == 1) {
+        for (const auto& [resultIdx, buffers] : alternating_back_edges_) {
+            std::swap(bodyBuffers[buffers.first], bodyBuffers[buffers.second]);
+        }
+    }
+}
+
+std::size_t TensorIteratorOp::sliceStart(const PortMap& portMap, const ov::Shape& shape, const std::int64_t iter) {
+    std::size_t start;
+    if (portMap.start < 0) {
+        start = shape[portMap.axis] + portMap.start;
+    } else {
+        start = portMap.start;
+    }
+    return start + iter * portMap.stride;
 }
 
 WorkbufferRequest TensorIteratorOp::GetWorkBufferRequest() const {
@@ -211,7 +357,12 @@ WorkbufferRequest TensorIteratorOp::GetWorkBufferRequest() const {
     for (const auto& kernel_map : kernelmap_outputs_) {
         immutable_sizes.push_back(kernel_map.second.getImmutableWorkbufferSize());
     }
-    return {immutable_sizes, SubGraph::GetWorkBufferRequest().mutable_sizes};
+    // The body memory block is followed by the body buffers, which are allocated by the operation
+    auto mutable_sizes = SubGraph::GetWorkBufferRequest().mutable_sizes;
+    for (const auto& buffer : body_buffers_) {
+        mutable_sizes.push_back(buffer.second);
+    }
+    return {immutable_sizes, mutable_sizes};
 }
 
 void TensorIteratorOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
@@ -229,6 +380,7 @@ void TensorIteratorOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
 
 void TensorIteratorOp::copyParam(const CUDA::Stream& stream,
                                  const CUDA::DevicePointer<void*> mutableBuffer,
+                                 const ExternalBuffers& bodyBuffers,
                                  const IOperationExec::Inputs& inputTensors,
                                  const std::int64_t iter,
                                  const uint64_t inputIdx,
@@ -239,23 +391,15 @@ void TensorIteratorOp::copyParam(const CUDA::Stream& stream,
     if (portmap_inputs_.count(inputIdx) == 0) {
         auto& input = inputTensors[inputIdx];
         const auto& param = params_[paramIdx];
-        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
+        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer, bodyBuffers);
         OPENVINO_ASSERT(inputSize == paramSize, "Node name: ", GetName());
         stream.transfer(outputTensors[0], input, inputSize);
     } else {
         const auto& portMap = portmap_inputs_.at(inputIdx);
         const auto& param = params_[paramIdx];
-        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
-        const auto inputShape = inputs_info_[inputIdx].shape_;
-
+        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer, bodyBuffers);
         const auto& slice = kernelmap_inputs_.at(inputIdx);
-        std::size_t start;
-        if (portMap.start < 0) {
-            start = inputShape[portMap.axis] + portMap.start;
-        } else {
-            start = portMap.start;
-        }
-        start += iter * portMap.stride;
+        const auto start = sliceStart(portMap, inputs_info_[inputIdx].shape_, iter);
         auto input = inputTensors[inputIdx];
         slice(stream.get(), input.get(), outputTensors[0].get(), start);
     }
@@ -263,13 +407,14 @@ void TensorIteratorOp::copyParam(const CUDA::Stream& stream,
 
 void TensorIteratorOp::copyBackEdge(const CUDA::Stream& stream,
                                     CUDA::DevicePointer<void*> mutableBuffer,
+                                    const ExternalBuffers& bodyBuffers,
                                     const uint64_t resultIdx,
                                     const uint64_t paramIdx) const {
     auto& memoryManager = *memory_manager_;
     const auto& result = results_[resultIdx];
     const auto& param = params_[paramIdx];
-    auto paramTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
-    auto resultTensors = memoryManager.inputTensorPointers(*result, mutableBuffer);
+    auto paramTensors = memoryManager.outputTensorPointers(*param, mutableBuffer, bodyBuffers);
+    auto resultTensors = memoryManager.inputTensorPointers(*result, mutableBuffer, bodyBuffers);
     const std::size_t paramSize = params_info_[paramIdx].size_;
     const std::size_t resultSize = results_info_[resultIdx].size_;
     OPENVINO_ASSERT(paramSize == resultSize, "Node name: ", GetName());
@@ -278,6 +423,7 @@ void TensorIteratorOp::copyBackEdge(const CUDA::Stream& stream,
 
 void TensorIteratorOp::copyResult(const CUDA::Stream& stream,
                                   CUDA::DevicePointer<void*> mutableBuffer,
+                                  const ExternalBuffers& bodyBuffers,
                                   const IOperationExec::Outputs& outputTensors,
                                   const std::int64_t iter,
                                   const std::size_t resultIdx,
@@ -287,39 +433,20 @@ void TensorIteratorOp::copyResult(const CUDA::Stream& stream,
     const std::size_t outputSize = outputs_info_[outputIdx].size_;
     if (portmap_outputs_.count(outputIdx) == 0) {
         const auto result = results_[resultIdx];
-        auto inTensors = memoryManager.inputTensorPointers(*result, mutableBuffer);
+        auto inTensors = memoryManager.inputTensorPointers(*result, mutableBuffer, bodyBuffers);
         const auto output = outputTensors[outputIdx];
         OPENVINO_ASSERT(resultSize == outputSize, "Node name: ", GetName());
         stream.transfer(output, inTensors[0], outputSize);
     } else {
         auto output = outputTensors[outputIdx];
         const auto& result = results_[resultIdx];
-        auto inputTensors = memoryManager.inputTensorPointers(*result, mutableBuffer);
-        const auto portMap = portmap_outputs_.at(outputIdx);
-        const auto outputShape = outputs_info_[outputIdx].shape_;
-
+        auto inputTensors = memoryManager.inputTensorPointers(*result, mutableBuffer, bodyBuffers);
         const auto& insert = kernelmap_outputs_.at(outputIdx);
-        std::size_t start;
-        if (portMap.start < 0) {
-            start = outputShape[portMap.axis] + portMap.start;
-        } else {
-            start = portMap.start;
-        }
-        start += iter * portMap.stride;
+        const auto start = sliceStart(portmap_outputs_.at(outputIdx), outputs_info_[outputIdx].shape_, iter);
         insert(stream.get(), inputTensors[0].get(), output.get(), start);
     }
 }
 
-void TensorIteratorOp::updateExecSequence() {
-    std::vector<OperationBase::Ptr> newExecSequence;
-    for (const auto& op : exec_sequence_) {
-        if (!dynamic_cast<const ParameterOp*>(op.get()) && !dynamic_cast<const ResultOp*>(op.get())) {
-            newExecSequence.emplace_back(op);
-        }
-    }
-    exec_sequence_ = std::move(newExecSequence);
-}
-
 OPERATION_REGISTER(TensorIteratorOp, TensorIterator);
 
 }  // namespace nvidia_gpu
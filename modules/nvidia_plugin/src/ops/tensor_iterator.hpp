@@ -5,10 +5,13 @@
 #pragma once
 
 #include <cstdint>
+#include <cuda/graph.hpp>
 #include <cuda_operation_base.hpp>
 #include <kernels/insert.hpp>
 #include <kernels/slice.hpp>
+#include <memory>
 #include <openvino/op/tensor_iterator.hpp>
+#include <optional>
 
 #include "subgraph.hpp"
 
@@ -29,6 +32,12 @@ public:
 
     bool IsCudaGraphCompatible() const override;
 
+    /**
+     * Captures the body into a separate graph and adds it as a child graph node per iteration between
+     * the captured slice, back edge and insert operations of the iteration. The body is captured once if its
+     * buffers are the same in all iterations, twice if back edges alternate buffers and per iteration if
+     * its buffers alias the input or output tensors
+     */
     void Capture(InferenceRequestContext& context,
                  Inputs inputTensors,
                  Outputs outputTensors,
@@ -43,28 +52,71 @@ private:
         int64_t axis{0};
     };
 
+    /**
+     * External Parameter/Result buffer of the body, which points into an input or output tensor
+     * of the operation instead of being copied from or to it
+     */
+    struct Alias {
+        BufferID buffer{};
+        // Bytes between neighbouring slices along the axis of the port, 0 for invariant inputs
+        std::size_t slice_size{};
+    };
+
     WorkbufferRequest GetWorkBufferRequest() const override;
     void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
 
+    /**
+     * Finds Parameter/Result buffers of the body, which can be bound to the input and output tensors
+     * or can alternate between iterations, and the ones which need a buffer of the operation
+     */
+    void initBodyBuffers();
+    /**
+     * @returns External buffer of the body, which holds the whole tensor
+     */
+    std::optional<BufferID> externalBuffer(const TensorID& tensor, bool isInput) const;
+    /**
+     * @returns Number of iterations, after which the body buffers repeat
+     */
+    int64_t bodyBuffersPeriod() const;
+    /**
+     * Binds external buffers of the body for the iteration
+     */
+    void bindBodyBuffers(ExternalBuffers& bodyBuffers,
+                         const Workbuffers& workbuffers,
+                         Inputs inputTensors,
+                         Outputs outputTensors,
+                         std::int64_t iter) const;
+    static std::size_t sliceStart(const PortMap& portMap, const ov::Shape& shape, std::int64_t iter);
+
     void copyParam(const CUDA::Stream& stream,
                    CUDA::DevicePointer<void*> mutableBuffer,
+                   const ExternalBuffers& bodyBuffers,
                    const IOperationExec::Inputs& inputTensors,
                    std::int64_t iter,
                    uint64_t inputIdx,
                    uint64_t paramIdx) const;
     void copyBackEdge(const CUDA::Stream& stream,
                       CUDA::DevicePointer<void*> mutableBuffer,
+                      const ExternalBuffers& bodyBuffers,
                       uint64_t resultIdx,
                       uint64_t paramIdx) const;
     void copyResult(const CUDA::Stream& stream,
                     CUDA::DevicePointer<void*> mutableBuffer,
+                    const ExternalBuffers& bodyBuffers,
                     const IOperationExec::Outputs& outputTensors,
                     int64_t iter,
                     std::size_t resultIdx,
                     std::size_t outputIdx) const;
 
-    void updateExecSequence();
-
+    /**
+     * Executes the iterations. The body is executed by the operations of the body or, if they're given,
+     * by the child graph node of bodies[iter % bodies.size()] added to the graph captured from the stream
+     */
+    void executeIterations(const InferenceRequestContext& context,
+                           Inputs inputTensors,
+                           Outputs outputTensors,
+                           const Workbuffers& workbuffers,
+                           const std::vector<CUDA::Graph>& bodies) const;
     size_t max_threads_per_block_;
     const int64_t num_iterations_;
     std::vector<OperationInfo> inputs_info_;
@@ -78,6 +130,12 @@ private:
     std::unordered_map<uint64_t, PortMap> portmap_outputs_;
     std::unordered_map<uint64_t, kernel::Insert> kernelmap_outputs_;
     std::unordered_map<uint64_t, uint64_t> results_parameters_map_;
+    // Body buffers, which are allocated by the operation, and their sizes
+    std::vector<std::pair<BufferID, std::size_t>> body_buffers_;
+    std::unordered_map<uint64_t, Alias> aliased_inputs_;
+    std::unordered_map<uint64_t, Alias> aliased_outputs_;
+    // Back edges, which swap buffers of the Result and the Parameter every iteration instead of being copied
+    std::unordered_map<uint64_t, std::pair<BufferID, BufferID>> alternating_back_edges_;
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "token_merge.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <openvino/core/except.hpp>
+#include <utility>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+TokenMergeOp::TokenMergeOp(const CreationContext& context,
+                           const NodeOp& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    OPENVINO_ASSERT(node.get_input_size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(node.get_output_size() == 2, "Node name: ", GetName());
+    const auto& metric_shape = node.get_input_shape(0);
+    const auto& x_shape = node.get_input_shape(1);
+    OPENVINO_ASSERT(x_shape[0] != 0 && x_shape[1] != 0 && x_shape[2] != 0, "Node name: ", GetName());
+    kernel_ = kernel::TokenMerge{convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                                 x_shape[0],
+                                 x_shape[1],
+                                 metric_shape[2],
+                                 x_shape[2],
+                                 node.get_num_merged(),
+                                 node.has_class_token()};
+}
+
+void TokenMergeOp::Execute(const InferenceRequestContext& context,
+                           Inputs inputs,
+                           Outputs outputs,
+                           const Workbuffers& workbuffers) const {
+    OPENVINO_ASSERT(inputs.size() == 3, "Node name: ", GetName());
+    OPENVINO_ASSERT(outputs.size() == 2, "Node name: ", GetName());
+    OPENVINO_ASSERT(workbuffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(kernel_, "Node name: ", GetName());
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputs[0].get(),
+               inputs[1].get(),
+               inputs[2].get(),
+               workbuffers.mutable_buffers[0].get(),
+               outputs[0].get(),
+               outputs[1].get());
+}
+
+bool TokenMergeOp::IsCudaGraphCompatible() const { return true; }
+
+WorkbufferRequest TokenMergeOp::GetWorkBufferRequest() const { return {{}, {kernel_->workbuffer_size()}}; }
+
+OPERATION_REGISTER(TokenMergeOp, TokenMerge);
+}  // namespace nvidia_gpu
+}  // namespace ov
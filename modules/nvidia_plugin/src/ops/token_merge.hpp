@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/token_merge.hpp>
+
+#include "kernels/token_merge.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Executes token merging of ViT blocks by kernels of bipartite soft matching and of the weighted average
+ */
+class TokenMergeOp : public OperationBase {
+public:
+    using NodeOp = nodes::TokenMerge;
+    TokenMergeOp(const CreationContext& context,
+                 const NodeOp& node,
+                 IndexCollection&& inputIds,
+                 IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::TokenMerge> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -97,7 +97,6 @@ TopKOp::TopKOp(const CreationContext& context,
     const uint64_t axis = topKOp->get_axis();
     const size_t num_input_element = ov::shape_size(input_shape);
     const size_t num_output_element = ov::shape_size(output_shape);
-    workspace_size_ = num_input_element * (element_type.size() + index_element_type.size());
 
     OPENVINO_ASSERT(axis >= 0 && axis < input_shape.size(), "Node name: ", GetName());
     OPENVINO_ASSERT(axis >= 0 && axis < output_shape.size(), "Node name: ", GetName());
@@ -147,6 +146,9 @@ TopKOp::TopKOp(const CreationContext& context,
                            k,
                            workspace_chunk_size,
                            max_threads_per_block};
+    // Pairs of values and indices of all input elements are needed only if chunks are sorted by threads
+    workspace_size_ =
+        kernel_->usesWorkspace() ? num_input_element * (element_type.size() + index_element_type.size()) : 0;
 }
 
 void TopKOp::Execute(const InferenceRequestContext& context,
@@ -155,12 +157,12 @@ void TopKOp::Execute(const InferenceRequestContext& context,
                      const Workbuffers& buffers) const {
     OPENVINO_ASSERT(inputs.size() == 2, "Node name: ", GetName());
     OPENVINO_ASSERT(outputs.size() == 2, "Node name: ", GetName());
-    OPENVINO_ASSERT(buffers.mutable_buffers.size() == 1, "Node name: ", GetName());
+    OPENVINO_ASSERT(buffers.mutable_buffers.size() == (workspace_size_ > 0 ? 1 : 0), "Node name: ", GetName());
     OPENVINO_ASSERT(buffers.immutable_buffers.size() == 1, "Node name: ", GetName());
     auto& threadContext = context.getThreadContext();
     auto& stream = threadContext.stream();
     auto kernel_param = buffers.immutable_buffers[0];
-    auto workspace = buffers.mutable_buffers[0];
+    void* workspace = workspace_size_ > 0 ? static_cast<void*>(buffers.mutable_buffers[0].get()) : nullptr;
     auto in_tensor = inputs[0];
     auto out_value_tensor = outputs[0];
     auto out_index_tensor = outputs[1];
@@ -168,7 +170,7 @@ void TopKOp::Execute(const InferenceRequestContext& context,
                static_cast<const void*>(in_tensor.get()),
                static_cast<void*>(out_value_tensor.get()),
                static_cast<void*>(out_index_tensor.get()),
-               static_cast<void*>(workspace.get()),
+               workspace,
                static_cast<const void*>(kernel_param.get()));
 }
 
@@ -191,7 +193,12 @@ void TopKOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
     buffer_offset += sizeof(kernel_param_.output_strides);
 }
 
-WorkbufferRequest TopKOp::GetWorkBufferRequest() const { return {{sizeof(kernel_param_)}, {workspace_size_}}; }
+WorkbufferRequest TopKOp::GetWorkBufferRequest() const {
+    if (workspace_size_ == 0) {
+        return {{sizeof(kernel_param_)}, {}};
+    }
+    return {{sizeof(kernel_param_)}, {workspace_size_}};
+}
 
 OPERATION_REGISTER(TopKOp, TopK);
 }  // namespace nvidia_gpu
@@ -63,7 +63,11 @@ TransposeOp::TransposeOp(const CreationContext& context,
       outputMode_{tryToExtractPermutation(*node)},
       extents_{extractExtents(inputExtents_)},
       inputElementsType_{convertDataType<cudaDataType_t>(node->input(0).get_element_type())},
-      permutationElementsType_{extractPermutationElementsType(*node)} {
+      permutationElementsType_{extractPermutationElementsType(*node)},
+      kernel_{makeKernel(*node, outputMode_)} {
+    if (kernel_) {
+        return;
+    }
     if (!isInputElementsTypeSupported(inputElementsType_)) {
         throw_ov_exception(fmt::format("TransposeOp: unsupported inputElementsType_: {}", toString(inputElementsType_)));
     }
@@ -71,7 +75,6 @@ TransposeOp::TransposeOp(const CreationContext& context,
         throw_ov_exception(fmt::format("TransposeOp: unsupported permutationElementsType_: {}",
                                      ov::element::Type{permutationElementsType_}.get_type_name()));
     }
-    inputExtents_.size();
 }
 
 void TransposeOp::Execute(const InferenceRequestContext& context,
@@ -81,6 +84,11 @@ void TransposeOp::Execute(const InferenceRequestContext& context,
     OPENVINO_ASSERT(inputTensors.size() == 1 || inputTensors.size() == 2, "Node name: ", GetName());
     OPENVINO_ASSERT(outputTensors.size() == 1, "Node name: ", GetName());
 
+    if (kernel_) {
+        (*kernel_)(context.getThreadContext().stream().get(), inputTensors[0].get(), outputTensors[0].get());
+        return;
+    }
+
     cutensorTensorDescriptor_t inputDesc{}, outputDesc{};
     const std::vector<int> outputMode = permutation(context, inputTensors);
     auto& threadContext = context.getThreadContext();
@@ -186,6 +194,20 @@ std::optional<std::vector<int> > TransposeOp::tryToExtractPermutation(const ov::
     }
 }
 
+std::optional<kernel::Transpose> TransposeOp::makeKernel(const ov::Node& node,
+                                                        const std::optional<std::vector<int>>& permutation) {
+    if (!permutation) {
+        return std::nullopt;
+    }
+    const auto element_size = node.get_input_element_type(0).size();
+    const auto& shape = node.get_input_shape(0);
+    const std::vector<size_t> dims(shape.begin(), shape.end());
+    if (!kernel::Transpose::isSupported(element_size, dims, *permutation)) {
+        return std::nullopt;
+    }
+    return kernel::Transpose{element_size, dims, *permutation};
+}
+
 std::vector<int> TransposeOp::permutation(const InferenceRequestContext& context, Inputs inputTensors) const {
     if (outputMode_.has_value()) {
         return outputMode_.value();
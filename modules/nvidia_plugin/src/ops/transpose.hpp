@@ -9,9 +9,15 @@
 #include <unordered_map>
 #include <vector>
 
+#include "kernels/transpose.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * Transposes with a constant permutation run on the native kernel::Transpose, the others (and the ones it doesn't
+ * support) on cutensorPermutation.
+ */
 class TransposeOp : public OperationCuTensor {
 public:
     TransposeOp(const CreationContext& context,
@@ -45,6 +51,9 @@ private:
 
     static std::optional<std::vector<int>> tryToExtractPermutation(const ov::Node& node);
 
+    static std::optional<kernel::Transpose> makeKernel(const ov::Node& node,
+                                                       const std::optional<std::vector<int>>& permutation);
+
     std::vector<int> permutation(const InferenceRequestContext& context, Inputs inputTensors) const;
 
     ov::element::Type_t extractPermutationElementsType(const ov::Node& node);
@@ -65,6 +74,7 @@ private:
     ExtentsMap extents_;
     cudaDataType_t inputElementsType_;
     ov::element::Type_t permutationElementsType_;
+    std::optional<kernel::Transpose> kernel_;
 };
 
 }  // namespace nvidia_gpu
@@ -17,6 +17,7 @@
 #include "converters.hpp"
 #include "cuda/runtime.hpp"
 #include "cuda_op_buffers_extractor.hpp"
+#include "kernels/pointer_array.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -189,7 +190,8 @@ void VariadicSplitOp::Execute(const InferenceRequestContext& context,
     auto all_split_idxs = buffers.immutable_buffers.at(kSplitIdxIWBIdx);
     auto all_num_splits = buffers.immutable_buffers.at(kAxisSizesIWBIdx);
     auto axis_offset_sizes = buffers.immutable_buffers.at(kAxisOffsetSizesIWBIdx);
-    stream.upload(output_ptrs, outputs.data(), sizeof(void*) * axis_sizes_.size());
+    kernel::fillPointerArray(
+        stream.get(), output_ptrs.get(), reinterpret_cast<const void* const*>(outputs.data()), axis_sizes_.size());
     auto in = inputs[0];
     (*variadic_split_kernel_)(stream.get(),
                               static_cast<const void*>(in.get()),
@@ -199,7 +201,7 @@ void VariadicSplitOp::Execute(const InferenceRequestContext& context,
                               static_cast<const void*>(axis_offset_sizes.get()));
 }
 
-bool VariadicSplitOp::IsCudaGraphCompatible() const { return false; }
+bool VariadicSplitOp::IsCudaGraphCompatible() const { return true; }
 
 OPERATION_REGISTER(VariadicSplitOp, VariadicSplit);
 }  // namespace nvidia_gpu
@@ -6,6 +6,9 @@
 
 #include "cuda_op_buffers_extractor.hpp"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
@@ -15,12 +18,16 @@
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/op/concat.hpp"
+#include "openvino/op/gru_sequence.hpp"
 #include "openvino/op/lstm_sequence.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/op/split.hpp"
+#include "openvino/op/squeeze.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "transformations/common_optimizations/nop_elimination.hpp"
 #include "transformer/nodes/concat_optimized.hpp"
+#include "transformer/nodes/gru_sequence_stack.hpp"
 #include "transformer/nodes/lstm_sequence_optimized.hpp"
 
 
@@ -176,10 +183,11 @@ void get_last_transpose_or_reshape(const std::shared_ptr<ov::Node>& node, std::s
     }
 }
 
+template <typename TSequence>
 bool is_direction(const std::shared_ptr<ov::Node>& node,
                   const ov::op::RecurrentSequenceDirection& direction) {
-    if (auto lstm_sequence = ov::as_type_ptr<ov::op::v5::LSTMSequence>(node)) {
-        if (lstm_sequence->get_direction() == direction) {
+    if (auto sequence = ov::as_type_ptr<TSequence>(node)) {
+        if (sequence->get_direction() == direction) {
             return true;
         }
     }
@@ -187,15 +195,17 @@ bool is_direction(const std::shared_ptr<ov::Node>& node,
 }
 
 bool is_bidirectional(const std::shared_ptr<ov::Node>& node) {
-    return is_direction(node, ov::op::RecurrentSequenceDirection::BIDIRECTIONAL);
+    return is_direction<ov::op::v5::LSTMSequence>(node, ov::op::RecurrentSequenceDirection::BIDIRECTIONAL);
 }
 
+template <typename TSequence>
 bool is_forward(const std::shared_ptr<ov::Node>& node) {
-    return is_direction(node, ov::op::RecurrentSequenceDirection::FORWARD);
+    return is_direction<TSequence>(node, ov::op::RecurrentSequenceDirection::FORWARD);
 }
 
+template <typename TSequence>
 bool is_reverse(const std::shared_ptr<ov::Node>& node) {
-    return is_direction(node, ov::op::RecurrentSequenceDirection::REVERSE);
+    return is_direction<TSequence>(node, ov::op::RecurrentSequenceDirection::REVERSE);
 }
 
 std::vector<int64_t> gen_y_transpose_order(const std::shared_ptr<Node>& node) {
@@ -220,87 +230,237 @@ void output_replacer(const std::shared_ptr<ov::Node>& replacement,
         }
     }
 };
-}  // namespace
 
-bool bidirectional_lstm_sequence_composition(
-    const std::shared_ptr<ov::Node>& x,
-    const std::shared_ptr<ov::op::v5::LSTMSequence>& lstm_sequence_forward,
-    const std::shared_ptr<ov::op::v5::LSTMSequence>& lstm_sequence_reverse) {
+bool has_same_attributes(const ov::op::v5::LSTMSequence& forward, const ov::op::v5::LSTMSequence& reverse) {
+    return forward.get_hidden_size() == reverse.get_hidden_size() &&
+           forward.get_activations_alpha() == reverse.get_activations_alpha() &&
+           forward.get_activations_beta() == reverse.get_activations_beta() &&
+           forward.get_activations() == reverse.get_activations() && forward.get_clip() == reverse.get_clip();
+}
+
+bool has_same_attributes(const ov::op::v5::GRUSequence& forward, const ov::op::v5::GRUSequence& reverse) {
+    return forward.get_hidden_size() == reverse.get_hidden_size() &&
+           forward.get_activations_alpha() == reverse.get_activations_alpha() &&
+           forward.get_activations_beta() == reverse.get_activations_beta() &&
+           forward.get_activations() == reverse.get_activations() && forward.get_clip() == reverse.get_clip() &&
+           forward.get_linear_before_reset() == reverse.get_linear_before_reset();
+}
+
+std::shared_ptr<ov::Node> concat_inputs(const std::shared_ptr<ov::Node>& forward,
+                                        const std::shared_ptr<ov::Node>& reverse,
+                                        size_t index,
+                                        size_t axis) {
+    return std::make_shared<ov::op::v0::Concat>(
+        ov::OutputVector{forward->input_value(index), reverse->input_value(index)}, axis);
+}
+
+std::shared_ptr<ov::Node> make_bidirectional_sequence(const std::shared_ptr<ov::Node>& x,
+                                                      const std::shared_ptr<ov::op::v5::LSTMSequence>& forward,
+                                                      const std::shared_ptr<ov::op::v5::LSTMSequence>& reverse) {
+    return std::make_shared<ov::op::v5::LSTMSequence>(x,
+                                                      concat_inputs(forward, reverse, 1, 1),
+                                                      concat_inputs(forward, reverse, 2, 1),
+                                                      forward->input_value(3),
+                                                      concat_inputs(forward, reverse, 4, 0),
+                                                      concat_inputs(forward, reverse, 5, 0),
+                                                      concat_inputs(forward, reverse, 6, 0),
+                                                      forward->get_hidden_size(),
+                                                      ov::op::RecurrentSequenceDirection::BIDIRECTIONAL,
+                                                      forward->get_activations_alpha(),
+                                                      forward->get_activations_beta(),
+                                                      forward->get_activations(),
+                                                      forward->get_clip());
+}
+
+std::shared_ptr<ov::Node> make_bidirectional_sequence(const std::shared_ptr<ov::Node>& x,
+                                                      const std::shared_ptr<ov::op::v5::GRUSequence>& forward,
+                                                      const std::shared_ptr<ov::op::v5::GRUSequence>& reverse) {
+    return std::make_shared<ov::op::v5::GRUSequence>(x,
+                                                     concat_inputs(forward, reverse, 1, 1),
+                                                     forward->input_value(2),
+                                                     concat_inputs(forward, reverse, 3, 0),
+                                                     concat_inputs(forward, reverse, 4, 0),
+                                                     concat_inputs(forward, reverse, 5, 0),
+                                                     forward->get_hidden_size(),
+                                                     ov::op::RecurrentSequenceDirection::BIDIRECTIONAL,
+                                                     forward->get_activations(),
+                                                     forward->get_activations_alpha(),
+                                                     forward->get_activations_beta(),
+                                                     forward->get_clip(),
+                                                     forward->get_linear_before_reset());
+}
 
-    if (lstm_sequence_forward->get_hidden_size() != lstm_sequence_reverse->get_hidden_size() ||
-        lstm_sequence_forward->get_activations_alpha() != lstm_sequence_reverse->get_activations_alpha() ||
-        lstm_sequence_forward->get_activations_beta() != lstm_sequence_reverse->get_activations_beta() ||
-        lstm_sequence_forward->get_activations() != lstm_sequence_reverse->get_activations() ||
-        lstm_sequence_forward->get_clip() != lstm_sequence_reverse->get_clip()) {
+/**
+ * Replaces forward and reverse sequences over the same input, whose outputs are concatenated, by a bidirectional one.
+ * Output 0 is y, the rest are states (ho and co of LSTM or ho of GRU).
+ */
+template <typename TSequence>
+bool bidirectional_sequence_composition(const std::shared_ptr<ov::Node>& x,
+                                        const std::shared_ptr<TSequence>& sequence_forward,
+                                        const std::shared_ptr<TSequence>& sequence_reverse) {
+    if (!has_same_attributes(*sequence_forward, *sequence_reverse)) {
         return false;
     }
 
-    std::shared_ptr<Node> y_transpose = nullptr;
-    std::shared_ptr<Node> ho_transpose = nullptr;
-    std::shared_ptr<Node> co_transpose = nullptr;
-    auto y_replacement = find_concat(lstm_sequence_forward->output(0), y_transpose);
-    auto ho_replacement = find_concat(lstm_sequence_forward->output(1), ho_transpose);
-    auto co_replacement = find_concat(lstm_sequence_forward->output(2), co_transpose);
-    if (!y_replacement || !ho_replacement || !co_replacement) {
-        return false;
+    const size_t num_outputs = sequence_forward->get_output_size();
+    std::vector<std::shared_ptr<Node>> transposes(num_outputs);
+    std::vector<std::shared_ptr<Node>> replacements(num_outputs);
+    for (size_t i = 0; i < num_outputs; ++i) {
+        replacements[i] = find_concat(sequence_forward->output(i), transposes[i]);
+        if (!replacements[i]) {
+            return false;
+        }
     }
-    if (!(!y_transpose || is_y0_batch_transpose(y_transpose) || is_y0_sequence_transpose(y_transpose)) ||
-        !(!ho_transpose || is_h0_c0_transpose(ho_transpose)) ||
-        !(!co_transpose || is_h0_c0_transpose(co_transpose))) {
+    const auto& y_transpose = transposes[0];
+    if (!(!y_transpose || is_y0_batch_transpose(y_transpose) || is_y0_sequence_transpose(y_transpose))) {
         return false;
     }
-    auto concat_inputs = [&lstm_sequence_forward, &lstm_sequence_reverse](size_t index, size_t axis) {
-        return std::make_shared<ov::op::v0::Concat>(ov::OutputVector{
-            lstm_sequence_forward->input_value(index),
-            lstm_sequence_reverse->input_value(index)}, axis);
-    };
-    auto lstm_sequence_bidirectional =
-        std::make_shared<ov::op::v5::LSTMSequence>(x,
-            concat_inputs(1, 1),
-            concat_inputs(2, 1),
-            lstm_sequence_forward->input_value(3),
-            concat_inputs(4, 0),
-            concat_inputs(5, 0),
-            concat_inputs(6, 0),
-            lstm_sequence_forward->get_hidden_size(),
-            ov::op::RecurrentSequenceDirection::BIDIRECTIONAL,
-            lstm_sequence_forward->get_activations_alpha(),
-            lstm_sequence_forward->get_activations_beta(),
-            lstm_sequence_forward->get_activations(),
-            lstm_sequence_forward->get_clip());
-    auto y = lstm_sequence_bidirectional->output(0);
-    auto ho = lstm_sequence_bidirectional->output(1);
-    auto co = lstm_sequence_bidirectional->output(2);
-    ov::copy_runtime_info({lstm_sequence_forward, lstm_sequence_reverse}, lstm_sequence_bidirectional);
-
-    std::string original_names_mapping;
+    for (size_t i = 1; i < num_outputs; ++i) {
+        if (!(!transposes[i] || is_h0_c0_transpose(transposes[i]))) {
+            return false;
+        }
+    }
+    auto sequence_bidirectional = make_bidirectional_sequence(x, sequence_forward, sequence_reverse);
+    ov::copy_runtime_info({sequence_forward, sequence_reverse}, sequence_bidirectional);
+
     if (y_transpose) {
         auto transpose_y_const =
             std::make_shared<ov::op::v0::Constant>(y_transpose->input_value(1).get_element_type(),
             ov::Shape{4}, gen_y_transpose_order(y_transpose));
-        auto transpose_ho_co_const =
-            std::make_shared<ov::op::v0::Constant>(ho_transpose ? ho_transpose->input_value(1).get_element_type() : ov::element::i32,
-            ov::Shape{3}, std::vector<int64_t>{1, 0, 2});
-        auto transpose_y = std::make_shared<ov::op::v1::Transpose>(y, transpose_y_const);
-        auto transpose_ho = std::make_shared<ov::op::v1::Transpose>(ho, transpose_ho_co_const);
-        auto transpose_co = std::make_shared<ov::op::v1::Transpose>(co, transpose_ho_co_const);
-        transpose_y->set_friendly_name(y_replacement->get_friendly_name());
-        transpose_ho->set_friendly_name(ho_replacement->get_friendly_name());
-        transpose_co->set_friendly_name(co_replacement->get_friendly_name());
-        ov::copy_runtime_info(y_replacement, transpose_y);
-        ov::copy_runtime_info(ho_replacement, transpose_ho);
-        ov::copy_runtime_info(co_replacement, transpose_co);
-        output_replacer(y_replacement, transpose_y->output(0));
-        output_replacer(ho_replacement, transpose_ho->output(0));
-        output_replacer(co_replacement, transpose_co->output(0));
+        auto transpose_y =
+            std::make_shared<ov::op::v1::Transpose>(sequence_bidirectional->output(0), transpose_y_const);
+        transpose_y->set_friendly_name(replacements[0]->get_friendly_name());
+        ov::copy_runtime_info(replacements[0], transpose_y);
+        output_replacer(replacements[0], transpose_y->output(0));
+
+        const auto state_order_type =
+            transposes[1] ? transposes[1]->input_value(1).get_element_type() : ov::element::i32;
+        auto transpose_state_const = std::make_shared<ov::op::v0::Constant>(
+            state_order_type, ov::Shape{3}, std::vector<int64_t>{1, 0, 2});
+        for (size_t i = 1; i < num_outputs; ++i) {
+            auto transpose_state =
+                std::make_shared<ov::op::v1::Transpose>(sequence_bidirectional->output(i), transpose_state_const);
+            transpose_state->set_friendly_name(replacements[i]->get_friendly_name());
+            ov::copy_runtime_info(replacements[i], transpose_state);
+            output_replacer(replacements[i], transpose_state->output(0));
+        }
     } else {
-        output_replacer(y_replacement, y);
-        output_replacer(ho_replacement, ho);
-        output_replacer(co_replacement, co);
+        for (size_t i = 0; i < num_outputs; ++i) {
+            output_replacer(replacements[i], sequence_bidirectional->output(i));
+        }
+    }
+    return true;
+}
+
+template <typename TSequence>
+bool compose_bidirectional_sequences(const std::shared_ptr<ov::Model>& f) {
+    bool was_updated = false;
+    for (const auto& op : f->get_ordered_ops()) {
+        for (auto& output : op->outputs()) {
+            if (output.get_target_inputs().size() == 2) {
+                std::shared_ptr<TSequence> sequence_forward = nullptr;
+                std::shared_ptr<TSequence> sequence_reverse = nullptr;
+                for (auto& consumer : output.get_target_inputs()) {
+                    auto node = consumer.get_node()->shared_from_this();
+                    if (is_forward<TSequence>(node)) {
+                        sequence_forward = ov::as_type_ptr<TSequence>(node);
+                    } else if (is_reverse<TSequence>(node)) {
+                        sequence_reverse = ov::as_type_ptr<TSequence>(node);
+                    }
+                }
+                if (sequence_forward && sequence_reverse) {
+                    was_updated |= bidirectional_sequence_composition(op, sequence_forward, sequence_reverse);
+                }
+            }
+        }
+    }
+    return was_updated;
+}
+
+bool is_stackable(const std::shared_ptr<ov::Node>& node) {
+    auto sequence = ov::as_type_ptr<ov::op::v5::GRUSequence>(node);
+    if (!sequence || sequence->is_dynamic() ||
+        sequence->get_direction() != ov::op::RecurrentSequenceDirection::FORWARD ||
+        sequence->get_activations() != std::vector<std::string>{"sigmoid", "tanh"} || sequence->get_clip() != 0.0f) {
+        return false;
+    }
+    for (size_t i = 3; i < sequence->get_input_size(); ++i) {
+        if (!ov::as_type_ptr<ov::op::v0::Constant>(sequence->get_input_node_shared_ptr(i))) {
+            return false;
+        }
     }
     return true;
 }
 
+/**
+ * @returns Next layer of the stack, which takes y [batch_size, 1, seq_length, hidden_size] of the layer squeezed to
+ *          [batch_size, seq_length, hidden_size] as its only consumer
+ */
+std::shared_ptr<ov::op::v5::GRUSequence> find_next_layer(const std::shared_ptr<ov::op::v5::GRUSequence>& layer) {
+    const auto y_consumers = layer->get_output_target_inputs(0);
+    if (y_consumers.size() != 1) {
+        return nullptr;
+    }
+    const auto squeeze = y_consumers.begin()->get_node()->shared_from_this();
+    if (!ov::as_type_ptr<ov::op::v0::Squeeze>(squeeze) && !ov::as_type_ptr<ov::op::v1::Reshape>(squeeze)) {
+        return nullptr;
+    }
+    const auto& y_shape = layer->get_output_shape(0);
+    if (squeeze->is_dynamic() ||
+        squeeze->get_output_shape(0) != ov::Shape{y_shape[0], y_shape[2], y_shape[3]}) {
+        return nullptr;
+    }
+    const auto x_consumers = squeeze->get_output_target_inputs(0);
+    if (x_consumers.size() != 1 || x_consumers.begin()->get_index() != 0) {
+        return nullptr;
+    }
+    const auto next = x_consumers.begin()->get_node()->shared_from_this();
+    if (!is_stackable(next)) {
+        return nullptr;
+    }
+    auto next_layer = ov::as_type_ptr<ov::op::v5::GRUSequence>(next);
+    if (next_layer->get_hidden_size() != layer->get_hidden_size() ||
+        next_layer->get_linear_before_reset() != layer->get_linear_before_reset() ||
+        next_layer->input_value(2) != layer->input_value(2)) {
+        return nullptr;
+    }
+    return next_layer;
+}
+
+void fuse_gru_sequence_stack(const std::vector<std::shared_ptr<ov::op::v5::GRUSequence>>& layers) {
+    const auto& first = layers.front();
+    const auto& last = layers.back();
+    ov::OutputVector initial_states;
+    ov::OutputVector args{first->input_value(0), nullptr, first->input_value(2)};
+    for (const auto& layer : layers) {
+        initial_states.push_back(layer->input_value(1));
+        args.push_back(layer->input_value(3));
+        args.push_back(layer->input_value(4));
+        args.push_back(layer->input_value(5));
+    }
+    const ov::NodeVector fused_nodes(layers.begin(), layers.end());
+    args[1] = std::make_shared<ov::op::v0::Concat>(initial_states, 1);
+    ov::copy_runtime_info(fused_nodes, args[1].get_node_shared_ptr());
+    auto stack = std::make_shared<ov::nvidia_gpu::nodes::GRUSequenceStack>(
+        args, last->get_hidden_size(), last->get_linear_before_reset());
+    stack->set_friendly_name(last->get_friendly_name());
+    ov::copy_runtime_info(fused_nodes, stack);
+
+    last->output(0).replace(stack->output(0));
+    const bool states_used = std::any_of(layers.begin(), layers.end(), [](const auto& layer) {
+        return !layer->get_output_target_inputs(1).empty();
+    });
+    if (states_used) {
+        auto axis = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{1});
+        auto split = std::make_shared<ov::op::v1::Split>(stack->output(1), axis, layers.size());
+        ov::copy_runtime_info(stack, split);
+        for (size_t l = 0; l < layers.size(); ++l) {
+            layers[l]->output(1).replace(split->output(l));
+        }
+    }
+}
+}  // namespace
+
 bool bidirectional_lstm_sequence_cudnn_optimized(const std::shared_ptr<ov::op::v5::LSTMSequence>& lstm_sequence_bidirectional) {
     // Original OpenVINO:
     //   in              - [batch_size, seq_length, input_size]
@@ -427,25 +587,32 @@ bool bidirectional_lstm_sequence_cudnn_optimized(const std::shared_ptr<ov::op::v
 
 bool Convert2LSTMSequenceToBidirectionalLSTMSequence::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(Convert2LSTMSequenceToBidirectionalLSTMSequence);
+    return compose_bidirectional_sequences<ov::op::v5::LSTMSequence>(f);
+}
+
+bool Convert2GRUSequenceToBidirectionalGRUSequence::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(Convert2GRUSequenceToBidirectionalGRUSequence);
+    return compose_bidirectional_sequences<ov::op::v5::GRUSequence>(f);
+}
+
+bool GRUSequenceStackFusion::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(GRUSequenceStackFusion);
 
     bool was_updated = false;
+    std::unordered_set<std::shared_ptr<ov::Node>> visited;
     for (const auto& op : f->get_ordered_ops()) {
-        for (auto& output : op->outputs()) {
-            if (output.get_target_inputs().size() == 2) {
-                std::shared_ptr<ov::op::v5::LSTMSequence> lstm_sequence_forward = nullptr;
-                std::shared_ptr<ov::op::v5::LSTMSequence> lstm_sequence_reverse = nullptr;
-                for (auto& consumer : output.get_target_inputs()) {
-                    auto node = consumer.get_node()->shared_from_this();
-                    if (is_forward(node)) {
-                        lstm_sequence_forward = ov::as_type_ptr<ov::op::v5::LSTMSequence>(node);
-                    } else if (is_reverse(node)) {
-                        lstm_sequence_reverse = ov::as_type_ptr<ov::op::v5::LSTMSequence>(node);
-                    }
-                }
-                if (lstm_sequence_forward && lstm_sequence_reverse) {
-                    was_updated |= bidirectional_lstm_sequence_composition(op, lstm_sequence_forward, lstm_sequence_reverse);
-                }
-            }
+        // Layers are ordered topologically, so the first one found is the bottom of its stack
+        if (visited.count(op) || !is_stackable(op)) {
+            continue;
+        }
+        std::vector<std::shared_ptr<ov::op::v5::GRUSequence>> layers{ov::as_type_ptr<ov::op::v5::GRUSequence>(op)};
+        while (auto next_layer = find_next_layer(layers.back())) {
+            layers.push_back(next_layer);
+        }
+        visited.insert(layers.begin(), layers.end());
+        if (layers.size() > 1) {
+            fuse_gru_sequence_stack(layers);
+            was_updated = true;
         }
     }
     return was_updated;
@@ -468,8 +635,11 @@ bool BidirectionalSequenceComposition::run_on_model(const std::shared_ptr<ov::Mo
     Manager manager;
 
     manager.register_pass<Convert2LSTMSequenceToBidirectionalLSTMSequence>();
+    manager.register_pass<Convert2GRUSequenceToBidirectionalGRUSequence>();
     manager.register_pass<ov::pass::NopElimination>();
     manager.register_pass<ConvertBidirectionalLSTMSequenceToBidirectionalLSTMSequenceOptimized>();
+    // Layers of stacks are forward sequences, which are left after forward and reverse ones are composed
+    manager.register_pass<GRUSequenceStackFusion>();
 
     manager.run_passes(f);
 
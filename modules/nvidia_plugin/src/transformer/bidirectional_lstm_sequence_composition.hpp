@@ -16,12 +16,27 @@ public:
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 };
 
+class Convert2GRUSequenceToBidirectionalGRUSequence : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("Convert2GRUSequenceToBidirectionalGRUSequence", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+};
+
 class ConvertBidirectionalLSTMSequenceToBidirectionalLSTMSequenceOptimized : public ov::pass::ModelPass {
 public:
     OPENVINO_RTTI("ConvertBidirectionalLSTMSequenceToBidirectionalLSTMSequenceOptimized", "0");
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 };
 
+/**
+ * Fuses forward GRU sequences, each of which takes squeezed y of the previous one, into GRUSequenceStack
+ */
+class GRUSequenceStackFusion : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("GRUSequenceStackFusion", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+};
+
 class BidirectionalSequenceComposition : public ov::pass::ModelPass {
 public:
     OPENVINO_RTTI("BidirectionalSequenceComposition", "0");
@@ -0,0 +1,102 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "broadcast_elimination.hpp"
+
+#include <algorithm>
+
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+namespace {
+
+/**
+ * @returns true if the shape is broadcastable to the output shape by numpy rules
+ */
+bool isBroadcastableTo(const ov::Shape& shape, const ov::Shape& outputShape) {
+    if (shape.size() > outputShape.size()) {
+        return false;
+    }
+    const auto rankDiff = outputShape.size() - shape.size();
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] != 1 && shape[i] != outputShape[i + rankDiff]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @returns i-th dimension of the shape aligned to the right with a shape of the given rank
+ */
+size_t dimension(const ov::Shape& shape, size_t rank, size_t i) {
+    return i + shape.size() >= rank ? shape[i + shape.size() - rank] : 1;
+}
+
+bool isNumpyBroadcast(const ov::Node& node) {
+    if (const auto broadcast = ov::as_type<const ov::op::v1::Broadcast>(&node)) {
+        return broadcast->get_broadcast_spec().m_type == ov::op::AutoBroadcastType::NUMPY;
+    }
+    if (const auto broadcast = ov::as_type<const ov::op::v3::Broadcast>(&node)) {
+        const auto type = broadcast->get_broadcast_spec().m_type;
+        return type == ov::op::BroadcastType::NUMPY || type == ov::op::BroadcastType::BIDIRECTIONAL;
+    }
+    return false;
+}
+
+/**
+ * @returns true if the consumer computes the same output when its input is replaced by the input of Broadcast
+ */
+bool canConsumeUnbroadcasted(const ov::Input<ov::Node>& consumer, const ov::Shape& shape) {
+    const auto binary = ov::as_type<ov::op::util::BinaryElementwiseArithmetic>(consumer.get_node());
+    if (!binary || binary->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY) {
+        return false;
+    }
+    const auto& outputShape = binary->get_output_shape(0);
+    const auto& otherShape = binary->get_input_shape(1 - consumer.get_index());
+    // Dimensions, which only Broadcast expanded, should still be defined by the other input
+    for (size_t i = 0; i < outputShape.size(); ++i) {
+        if (std::max(dimension(shape, outputShape.size(), i), dimension(otherShape, outputShape.size(), i)) !=
+            outputShape[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+BroadcastElimination::BroadcastElimination() {
+    MATCHER_SCOPE(BroadcastElimination);
+    const auto broadcast = wrap_type<ov::op::v1::Broadcast, ov::op::v3::Broadcast>(has_static_shape());
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto broadcast = m.get_match_root();
+        if (!isNumpyBroadcast(*broadcast) || broadcast->get_input_partial_shape(0).is_dynamic()) {
+            return false;
+        }
+        const auto data = broadcast->input_value(0);
+        const auto& shape = data.get_shape();
+        if (!isBroadcastableTo(shape, broadcast->get_output_shape(0))) {
+            return false;
+        }
+        bool rewired = false;
+        for (auto& consumer : broadcast->get_output_target_inputs(0)) {
+            if (consumer.get_element_type() == data.get_element_type() && canConsumeUnbroadcasted(consumer, shape)) {
+                consumer.replace_source_output(data);
+                rewired = true;
+            }
+        }
+        return rewired;
+    };
+
+    register_matcher(std::make_shared<Matcher>(broadcast, matcher_name), callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
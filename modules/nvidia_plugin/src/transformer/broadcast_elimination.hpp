@@ -0,0 +1,22 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Connects element-wise arithmetic consumers of a numpy-style Broadcast directly to its input, since they
+ * broadcast it by themselves. The Broadcast is removed once it has no consumers left, so the broadcasted
+ * tensor is never materialized
+ */
+class BroadcastElimination : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("BroadcastElimination", "0");
+    BroadcastElimination();
+};
+
+}  // namespace ov::nvidia_gpu::pass
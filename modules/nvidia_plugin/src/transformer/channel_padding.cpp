@@ -0,0 +1,383 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "channel_padding.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <vector>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/avg_pool.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/elu.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/hsigmoid.hpp"
+#include "openvino/op/hswish.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/maximum.hpp"
+#include "openvino/op/minimum.hpp"
+#include "openvino/op/mish.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/pad.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/op/strided_slice.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/tanh.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+// Padding of tensors with 1 or 2 channels would multiply the work of the layer by 4-16 times
+constexpr size_t kMinPaddedSize = 3;
+
+/**
+ * Tensor, which is extended along the axis by channels of finite values ignored by its consumers
+ */
+struct PaddedTensor {
+    size_t axis;
+    // Size along the axis without padding
+    size_t size;
+};
+
+size_t alignmentOf(const ov::element::Type& type) {
+    if (type == ov::element::f16 || type == ov::element::bf16) {
+        return 8;
+    }
+    if (type == ov::element::i8 || type == ov::element::u8) {
+        return 16;
+    }
+    return 1;
+}
+
+size_t alignedSize(size_t size, size_t alignment) {
+    if (alignment <= 1 || size < kMinPaddedSize || size % alignment == 0) {
+        return size;
+    }
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @returns Constant extended by zeros along the axis up to the given size
+ */
+std::shared_ptr<ov::op::v0::Constant> padConstant(const std::shared_ptr<ov::op::v0::Constant>& constant,
+                                                  size_t axis,
+                                                  size_t size) {
+    const auto& shape = constant->get_shape();
+    if (shape[axis] == size) {
+        return constant;
+    }
+    const auto& type = constant->get_element_type();
+    const size_t outer = std::accumulate(shape.begin(), shape.begin() + axis, size_t{1}, std::multiplies<>());
+    const size_t inner =
+        std::accumulate(shape.begin() + axis + 1, shape.end(), size_t{1}, std::multiplies<>()) * type.size();
+    const size_t srcRow = shape[axis] * inner;
+    const size_t dstRow = size * inner;
+    std::vector<std::byte> dst(outer * dstRow, std::byte{0});
+    const auto src = static_cast<const std::byte*>(constant->get_data_ptr());
+    for (size_t i = 0; i < outer; ++i) {
+        std::copy_n(src + i * srcRow, srcRow, dst.data() + i * dstRow);
+    }
+    auto paddedShape = shape;
+    paddedShape[axis] = size;
+    auto padded = std::make_shared<ov::op::v0::Constant>(type, paddedShape, dst.data());
+    padded->set_friendly_name(constant->get_friendly_name());
+    ov::copy_runtime_info(constant, padded);
+    return padded;
+}
+
+std::shared_ptr<ov::Node> makePad(const ov::Output<ov::Node>& input, size_t axis, size_t size) {
+    const auto& shape = input.get_shape();
+    std::vector<int64_t> padsEnd(shape.size(), 0);
+    padsEnd[axis] = static_cast<int64_t>(size - shape[axis]);
+    auto pad = std::make_shared<ov::op::v1::Pad>(
+        input,
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{shape.size()}, std::vector<int64_t>(shape.size(), 0)),
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{shape.size()}, padsEnd),
+        ov::op::v0::Constant::create(input.get_element_type(), ov::Shape{}, {0}),
+        ov::op::PadMode::CONSTANT);
+    pad->set_friendly_name(input.get_node()->get_friendly_name() + "/padded");
+    return pad;
+}
+
+std::shared_ptr<ov::Node> makeSlice(const ov::Output<ov::Node>& input, const PaddedTensor& padded) {
+    const auto rank = input.get_shape().size();
+    std::vector<int64_t> end(rank, 0);
+    end[padded.axis] = static_cast<int64_t>(padded.size);
+    std::vector<int64_t> endMask(rank, 1);
+    endMask[padded.axis] = 0;
+    return std::make_shared<ov::op::v1::StridedSlice>(
+        input,
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{rank}, std::vector<int64_t>(rank, 0)),
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{rank}, end),
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{rank}, std::vector<int64_t>(rank, 1)),
+        std::vector<int64_t>(rank, 1),
+        endMask);
+}
+
+/**
+ * Operations which compute each channel from the same channel of their inputs and keep finite values finite,
+ * so padded channels never pollute other ones
+ */
+bool isChannelwiseUnary(const ov::Node& node) {
+    return ov::is_type<ov::op::v0::Relu>(&node) || ov::is_type<ov::op::v0::Sigmoid>(&node) ||
+           ov::is_type<ov::op::v0::Tanh>(&node) || ov::is_type<ov::op::v0::Clamp>(&node) ||
+           ov::is_type<ov::op::v0::Elu>(&node) || ov::is_type<ov::op::v0::Gelu>(&node) ||
+           ov::is_type<ov::op::v7::Gelu>(&node) || ov::is_type<ov::op::v4::Mish>(&node) ||
+           ov::is_type<ov::op::v4::HSwish>(&node) || ov::is_type<ov::op::v5::HSigmoid>(&node) ||
+           ov::is_type<ov::op::v0::Convert>(&node) ||
+           (ov::is_type<ov::op::v4::Swish>(&node) && node.get_input_size() == 1);
+}
+
+/**
+ * Binary operations, which keep values finite when constant operands are padded with zeros (unlike Divide)
+ */
+bool isChannelwiseBinary(const ov::Node& node) {
+    return ov::is_type<ov::op::v1::Add>(&node) || ov::is_type<ov::op::v1::Multiply>(&node) ||
+           ov::is_type<ov::op::v1::Subtract>(&node) || ov::is_type<ov::op::v1::Maximum>(&node) ||
+           ov::is_type<ov::op::v1::Minimum>(&node);
+}
+
+bool isChannelwiseSpatial(const ov::Node& node, size_t axis) {
+    if (ov::is_type<ov::op::v1::MaxPool>(&node) || ov::is_type<ov::op::v1::AvgPool>(&node)) {
+        return axis == 1;
+    }
+    const auto pad = ov::as_type<const ov::op::v1::Pad>(&node);
+    if (!pad || pad->get_pad_mode() != ov::op::PadMode::CONSTANT) {
+        return false;
+    }
+    const auto padsBegin = ov::as_type_ptr<ov::op::v0::Constant>(pad->get_input_node_shared_ptr(1));
+    const auto padsEnd = ov::as_type_ptr<ov::op::v0::Constant>(pad->get_input_node_shared_ptr(2));
+    return padsBegin && padsEnd && padsBegin->cast_vector<int64_t>().at(axis) == 0 &&
+           padsEnd->cast_vector<int64_t>().at(axis) == 0;
+}
+
+/**
+ * Pads regions of tensors in topological order of nodes
+ */
+class ChannelPadder {
+public:
+    /**
+     * @returns true if the node or its inputs are changed
+     */
+    bool pad(const std::shared_ptr<ov::Node>& node) {
+        if (!node->is_dynamic()) {
+            if (const auto conv = ov::as_type_ptr<ov::op::v1::Convolution>(node)) {
+                if (padConvolution(*conv)) {
+                    return true;
+                }
+            } else if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(node)) {
+                if (padMatMul(*matmul)) {
+                    return true;
+                }
+            } else if (propagate(*node)) {
+                return true;
+            }
+        }
+        return unpadInputs(*node);
+    }
+
+private:
+    const PaddedTensor* find(const ov::Output<ov::Node>& source) const {
+        const auto found = padded_.find(source);
+        return found != padded_.end() ? &found->second : nullptr;
+    }
+
+    bool padConvolution(ov::op::v1::Convolution& conv) {
+        const auto filter = ov::as_type_ptr<ov::op::v0::Constant>(conv.get_input_node_shared_ptr(1));
+        const auto alignment = alignmentOf(conv.get_output_element_type(0));
+        if (!filter || alignment == 1 || filter->get_shape().size() != 4) {
+            return false;
+        }
+        const auto shape = filter->get_shape();
+        const auto* input = find(conv.input_value(0));
+        if (input && (input->axis != 1 || input->size != shape[1])) {
+            return false;
+        }
+        const size_t outputChannels = alignedSize(shape[0], alignment);
+        size_t inputChannels = alignedSize(shape[1], alignment);
+        if (input) {
+            inputChannels = conv.get_input_shape(0)[1];
+        } else if (inputChannels == shape[1] && outputChannels == shape[0]) {
+            return false;
+        } else if (inputChannels != shape[1]) {
+            // Unaligned input (e.g. 3-channel image) is padded with zeros
+            conv.input(0).replace_source_output(makePad(conv.input_value(0), 1, inputChannels));
+        }
+        conv.input(1).replace_source_output(padConstant(padConstant(filter, 1, inputChannels), 0, outputChannels));
+        conv.validate_and_infer_types();
+        if (outputChannels != shape[0]) {
+            padded_.emplace(conv.output(0), PaddedTensor{1, shape[0]});
+        }
+        return true;
+    }
+
+    bool padMatMul(ov::op::v0::MatMul& matmul) {
+        const auto weights = ov::as_type_ptr<ov::op::v0::Constant>(matmul.get_input_node_shared_ptr(1));
+        const auto alignment = alignmentOf(matmul.get_output_element_type(0));
+        const auto rank = matmul.get_input_shape(0).size();
+        if (!weights || alignment == 1 || weights->get_shape().size() != 2 || rank < 2 || matmul.get_transpose_a()) {
+            return false;
+        }
+        const auto shape = weights->get_shape();
+        const size_t kAxis = matmul.get_transpose_b() ? 1 : 0;
+        const size_t nAxis = 1 - kAxis;
+        const auto* input = find(matmul.input_value(0));
+        if (input && (input->axis != rank - 1 || input->size != shape[kAxis])) {
+            return false;
+        }
+        const size_t n = alignedSize(shape[nAxis], alignment);
+        if (!input && n == shape[nAxis]) {
+            return false;
+        }
+        const size_t k = input ? matmul.get_input_shape(0)[rank - 1] : shape[kAxis];
+        matmul.input(1).replace_source_output(padConstant(padConstant(weights, kAxis, k), nAxis, n));
+        matmul.validate_and_infer_types();
+        if (n != shape[nAxis]) {
+            padded_.emplace(matmul.output(0), PaddedTensor{rank - 1, shape[nAxis]});
+        }
+        return true;
+    }
+
+    /**
+     * Extends the region through the channel-wise operation, which constant operands are padded as well
+     */
+    bool propagate(ov::Node& node) {
+        if (node.get_output_size() != 1) {
+            return false;
+        }
+        const PaddedTensor* padding = nullptr;
+        ov::Shape paddedShape;
+        for (const auto& input : node.inputs()) {
+            const auto* found = find(input.get_source_output());
+            if (!found) {
+                continue;
+            }
+            if (padding && (found->axis != padding->axis || found->size != padding->size ||
+                            input.get_shape() != paddedShape)) {
+                return false;
+            }
+            padding = found;
+            paddedShape = input.get_shape();
+        }
+        if (!padding) {
+            return false;
+        }
+        std::vector<std::pair<size_t, std::shared_ptr<ov::Node>>> operands;
+        if (isChannelwiseBinary(node)) {
+            for (const auto& input : node.inputs()) {
+                if (find(input.get_source_output())) {
+                    continue;
+                }
+                auto operand = padOperand(
+                    input.get_source_output(), paddedShape.size(), *padding, paddedShape[padding->axis]);
+                if (!operand) {
+                    return false;
+                }
+                operands.emplace_back(input.get_index(), std::move(operand));
+            }
+        } else if (!isChannelwiseUnary(node) && !isChannelwiseSpatial(node, padding->axis)) {
+            return false;
+        }
+        const auto output = *padding;
+        for (const auto& [index, operand] : operands) {
+            node.input(index).replace_source_output(operand);
+        }
+        node.validate_and_infer_types();
+        padded_.emplace(node.output(0), output);
+        return true;
+    }
+
+    /**
+     * @returns Constant operand of an element-wise operation padded along the axis of the data or nullptr if it
+     *          isn't a constant broadcasted along the axis or aligned to it
+     */
+    static std::shared_ptr<ov::Node> padOperand(const ov::Output<ov::Node>& operand,
+                                                size_t rank,
+                                                const PaddedTensor& padding,
+                                                size_t paddedSize) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(operand.get_node_shared_ptr());
+        if (!constant || constant->get_shape().size() > rank) {
+            return nullptr;
+        }
+        const auto& shape = constant->get_shape();
+        if (shape.size() + padding.axis < rank) {
+            return constant;
+        }
+        const size_t axis = padding.axis + shape.size() - rank;
+        if (shape[axis] == 1) {
+            return constant;
+        }
+        if (shape[axis] != padding.size || constant->get_element_type().bitwidth() % 8 != 0) {
+            return nullptr;
+        }
+        return padConstant(constant, axis, paddedSize);
+    }
+
+    /**
+     * Slices padded inputs of the node, which is outside of the region
+     */
+    bool unpadInputs(ov::Node& node) {
+        bool updated = false;
+        for (auto& input : node.inputs()) {
+            const auto source = input.get_source_output();
+            const auto* padding = find(source);
+            if (!padding) {
+                continue;
+            }
+            auto& slice = slices_[source];
+            if (!slice) {
+                slice = makeSlice(source, *padding);
+                const auto producer = source.get_node_shared_ptr();
+                const auto consumers = source.get_target_inputs();
+                const bool isModelOutput = std::any_of(consumers.begin(), consumers.end(), [](const auto& consumer) {
+                    return ov::is_type<ov::op::v0::Result>(consumer.get_node());
+                });
+                // Names of the tensor, by which outputs of the model are found, are moved to the unpadded tensor
+                slice->output(0).get_tensor().set_names(source.get_names());
+                source.get_tensor().set_names({});
+                if (isModelOutput) {
+                    const auto name = producer->get_friendly_name();
+                    producer->set_friendly_name(name + "/padded");
+                    slice->set_friendly_name(name);
+                    ov::copy_runtime_info(producer, slice);
+                } else {
+                    slice->set_friendly_name(producer->get_friendly_name() + "/unpadded");
+                }
+            }
+            input.replace_source_output(slice);
+            updated = true;
+        }
+        return updated;
+    }
+
+    std::map<ov::Output<ov::Node>, PaddedTensor> padded_;
+    std::map<ov::Output<ov::Node>, std::shared_ptr<ov::Node>> slices_;
+};
+
+}  // namespace
+
+bool ChannelPaddingTransformation::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(ChannelPaddingTransformation);
+    ChannelPadder padder;
+    bool updated = false;
+    for (const auto& op : model->get_ordered_ops()) {
+        updated |= padder.pad(op);
+    }
+    return updated;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,25 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Pads channels of FP16/BF16 (INT8) convolutions and K/N dimensions of MatMuls with constant weights to multiples
+ * of 8 (16), which tensor core algorithms of cuDNN and cuBLAS require. Weights are padded with zeros at compile time.
+ * Padded outputs flow through channel-wise operations (activations, per-channel constants, poolings and spatial
+ * paddings) into the next convolutions or MatMuls, whose zero weights ignore the padded channels, and are sliced
+ * back only where they leave such a region. Unaligned inputs of convolutions (e.g. 3-channel images) are padded
+ * with zeros
+ */
+class ChannelPaddingTransformation : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("ChannelPaddingTransformation", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -11,15 +11,29 @@
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 
 #include "nodes/concat_optimized.hpp"
+#include "nodes/fused_eltwise.hpp"
 
 using namespace ov::pass::pattern;
 
 namespace ov::nvidia_gpu::pass {
 namespace {
+/**
+ * @returns true if the producer of the output can write it into a strided slice of the concat, which is its only
+ * consumer (see ConcatOptimized::get_strided_slice)
+ */
+bool writes_strided_slice(const ov::Output<ov::Node>& output) {
+    return ov::is_type<ov::nvidia_gpu::nodes::FusedEltwise>(output.get_node()) &&
+           output.get_target_inputs().size() == 1;
+}
+
 bool change_concat_to_concat_optimized(Matcher& m) {
     using ov::nvidia_gpu::nodes::ConcatOptimized;
 
     auto concat = std::dynamic_pointer_cast<ov::op::v0::Concat>(m.get_match_root());
+    // Derived nodes (e.g. ConcatOptimized itself or ConcatConvert) are left as is
+    if (concat->get_type_info() != ov::op::v0::Concat::get_type_info_static()) {
+        return false;
+    }
     for (auto& in : concat->inputs()) {
         auto source_output = in.get_source_output();
         if (dynamic_cast<ov::op::v0::Constant*>(source_output.get_node())) {
@@ -48,7 +62,9 @@ bool change_concat_to_concat_optimized(Matcher& m) {
     auto num_chunks =
         std::accumulate(outputShape.begin(), outputShape.begin() + axis + 1, 1, std::multiplies<size_t>());
     const size_t sizeAboveAxis = num_chunks / outputShape[axis];
-    if (sizeAboveAxis != 1) {
+    if (sizeAboveAxis != 1 && !std::all_of(concat->inputs().begin(), concat->inputs().end(), [](const auto& in) {
+            return writes_strided_slice(in.get_source_output());
+        })) {
         return false;
     }
 
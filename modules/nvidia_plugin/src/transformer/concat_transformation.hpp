@@ -10,6 +10,10 @@
 
 namespace ov::nvidia_gpu::pass {
 
+/**
+ * Replaces Concat with ConcatOptimized, if its inputs can be placed into the output buffer by their producers:
+ * the axis is the outermost non-unit dimension, or every producer writes a strided slice of the output
+ */
 class ConcatTransformation : public ov::pass::MatcherPass {
 public:
     OPENVINO_RTTI("ConcatTransformation", "0");
@@ -0,0 +1,434 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "convert_fusion.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#include "nodes/concat_convert.hpp"
+#include "nodes/convert_color_preprocess.hpp"
+#include "nodes/convert_normalize.hpp"
+#include "nodes/gather_convert.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+namespace {
+
+bool isConvertedType(const ov::element::Type& type) {
+    return type == ov::element::f32 || type == ov::element::f16;
+}
+
+/**
+ * @returns Convert of floating point data, which is consumed only by the fused node
+ */
+std::shared_ptr<ov::op::v0::Convert> getFusedInputConvert(const ov::Output<ov::Node>& input) {
+    auto convert = ov::as_type_ptr<ov::op::v0::Convert>(input.get_node_shared_ptr());
+    if (!convert || convert->get_output_target_inputs(0).size() != 1 ||
+        !isConvertedType(convert->get_input_element_type(0)) || !isConvertedType(convert->get_output_element_type(0))) {
+        return nullptr;
+    }
+    return convert;
+}
+
+/**
+ * @returns Convert of floating point output of the node, which is its only consumer
+ */
+std::shared_ptr<ov::op::v0::Convert> getFusedOutputConvert(const ov::Node& node) {
+    const auto consumers = node.get_output_target_inputs(0);
+    if (consumers.size() != 1 || !isConvertedType(node.get_output_element_type(0))) {
+        return nullptr;
+    }
+    auto convert = ov::as_type_ptr<ov::op::v0::Convert>(consumers.begin()->get_node()->shared_from_this());
+    if (!convert || !isConvertedType(convert->get_output_element_type(0))) {
+        return nullptr;
+    }
+    return convert;
+}
+
+void replaceWithFused(const std::shared_ptr<ov::Node>& node,
+                      const std::shared_ptr<ov::Node>& outputConvert,
+                      ov::NodeVector&& fusedNodes,
+                      const std::shared_ptr<ov::Node>& fused) {
+    const auto& replaced = outputConvert ? outputConvert : node;
+    fusedNodes.push_back(node);
+    if (outputConvert) {
+        fusedNodes.push_back(outputConvert);
+    }
+    fused->set_friendly_name(replaced->get_friendly_name());
+    ov::copy_runtime_info(fusedNodes, fused);
+    ov::replace_node(replaced, fused);
+}
+
+bool fuseConvertsToConcat(Matcher& m) {
+    auto concat = ov::as_type_ptr<ov::op::v0::Concat>(m.get_match_root());
+    // ConcatOptimized doesn't copy data at all, so it is left as is
+    if (!concat || concat->get_type_info() != ov::op::v0::Concat::get_type_info_static()) {
+        return false;
+    }
+    // Converts of inputs are fused only if all inputs are converted from the same type
+    ov::OutputVector inputs;
+    ov::NodeVector fusedNodes;
+    for (const auto& input : concat->input_values()) {
+        const auto convert = getFusedInputConvert(input);
+        if (!convert || (!inputs.empty() && convert->get_input_element_type(0) != inputs[0].get_element_type())) {
+            inputs = concat->input_values();
+            fusedNodes.clear();
+            break;
+        }
+        inputs.push_back(convert->input_value(0));
+        fusedNodes.push_back(convert);
+    }
+    const auto outputConvert = getFusedOutputConvert(*concat);
+    if (fusedNodes.empty() && !outputConvert) {
+        return false;
+    }
+    const auto type = outputConvert ? outputConvert->get_output_element_type(0) : concat->get_output_element_type(0);
+    const auto fused = std::make_shared<nodes::ConcatConvert>(inputs, concat->get_axis(), type);
+    replaceWithFused(concat, outputConvert, std::move(fusedNodes), fused);
+    return true;
+}
+
+bool fuseConvertsToGather(Matcher& m) {
+    auto gather = ov::as_type_ptr<ov::op::v8::Gather>(m.get_match_root());
+    if (!gather || gather->get_type_info() != ov::op::v8::Gather::get_type_info_static()) {
+        return false;
+    }
+    auto data = gather->input_value(0);
+    ov::NodeVector fusedNodes;
+    if (const auto inputConvert = getFusedInputConvert(data)) {
+        data = inputConvert->input_value(0);
+        fusedNodes.push_back(inputConvert);
+    }
+    const auto outputConvert = getFusedOutputConvert(*gather);
+    if (fusedNodes.empty() && !outputConvert) {
+        return false;
+    }
+    const auto type = outputConvert ? outputConvert->get_output_element_type(0) : gather->get_output_element_type(0);
+    const auto fused = std::make_shared<nodes::GatherConvert>(
+        data, gather->input_value(1), gather->input_value(2), gather->get_batch_dims(), type);
+    replaceWithFused(gather, outputConvert, std::move(fusedNodes), fused);
+    return true;
+}
+
+bool isNormalizedType(const ov::element::Type& type) {
+    return type == ov::element::u8 || type == ov::element::i8 || type == ov::element::u16 ||
+           type == ov::element::i16 || type == ov::element::i32;
+}
+
+/**
+ * y = x * scale[c] + shift[c], values are broadcast along axis or are single values if axis is -1
+ */
+struct Affine {
+    int64_t axis = -1;
+    std::vector<float> scale{1.0f};
+    std::vector<float> shift{0.0f};
+};
+
+/**
+ * Values of a constant, which are broadcast to the data shape along axis or are a single value if axis is -1
+ */
+struct ChannelValues {
+    int64_t axis = -1;
+    std::vector<float> values;
+};
+
+std::optional<ChannelValues> getChannelValues(const ov::Output<ov::Node>& input, const ov::Shape& shape) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr());
+    if (!constant || constant->get_shape().size() > shape.size()) {
+        return std::nullopt;
+    }
+    const auto& constant_shape = constant->get_shape();
+    const size_t offset = shape.size() - constant_shape.size();
+    ChannelValues result;
+    for (size_t d = 0; d < constant_shape.size(); ++d) {
+        if (constant_shape[d] == 1) {
+            continue;
+        }
+        if (result.axis != -1 || constant_shape[d] != shape[offset + d]) {
+            return std::nullopt;
+        }
+        result.axis = static_cast<int64_t>(offset + d);
+    }
+    result.values = constant->cast_vector<float>();
+    return result;
+}
+
+/**
+ * Folds the element-wise operation of the input of the given index with a constant into the affine transform
+ */
+bool foldToAffine(const ov::Node& node, size_t index, const ov::Shape& shape, Affine& affine) {
+    const auto* eltwise = ov::as_type<const ov::op::util::BinaryElementwiseArithmetic>(&node);
+    if (!eltwise || eltwise->get_output_shape(0) != shape ||
+        eltwise->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY) {
+        return false;
+    }
+    const bool is_add = ov::is_type<ov::op::v1::Add>(&node);
+    const bool is_subtract = ov::is_type<ov::op::v1::Subtract>(&node);
+    const bool is_multiply = ov::is_type<ov::op::v1::Multiply>(&node);
+    const bool is_divide = ov::is_type<ov::op::v1::Divide>(&node);
+    // Constants are subtrahends and divisors only
+    if (!(is_add || is_multiply || ((is_subtract || is_divide) && index == 0))) {
+        return false;
+    }
+    const auto constant = getChannelValues(node.input_value(1 - index), shape);
+    if (!constant) {
+        return false;
+    }
+    if (constant->axis != -1) {
+        if (affine.axis == -1) {
+            const size_t channels = shape[constant->axis];
+            affine.axis = constant->axis;
+            affine.scale.assign(channels, affine.scale[0]);
+            affine.shift.assign(channels, affine.shift[0]);
+        } else if (affine.axis != constant->axis) {
+            return false;
+        }
+    }
+    for (size_t c = 0; c < affine.scale.size(); ++c) {
+        const float value = constant->values[constant->values.size() == 1 ? 0 : c];
+        if (is_add) {
+            affine.shift[c] += value;
+        } else if (is_subtract) {
+            affine.shift[c] -= value;
+        } else if (is_multiply) {
+            affine.scale[c] *= value;
+            affine.shift[c] *= value;
+        } else {
+            affine.scale[c] /= value;
+            affine.shift[c] /= value;
+        }
+    }
+    return true;
+}
+
+bool fuseConvertNormalize(Matcher& m) {
+    auto convert = ov::as_type_ptr<ov::op::v0::Convert>(m.get_match_root());
+    if (!convert || !isNormalizedType(convert->get_input_element_type(0)) ||
+        !isConvertedType(convert->get_output_element_type(0))) {
+        return false;
+    }
+    const auto& shape = convert->get_output_shape(0);
+    Affine affine;
+    std::shared_ptr<ov::Node> last = convert;
+    ov::NodeVector fusedNodes{convert};
+    for (;;) {
+        const auto consumers = last->get_output_target_inputs(0);
+        if (consumers.size() != 1) {
+            break;
+        }
+        const auto& consumer = *consumers.begin();
+        Affine folded = affine;
+        if (!foldToAffine(*consumer.get_node(), consumer.get_index(), shape, folded)) {
+            break;
+        }
+        affine = std::move(folded);
+        last = consumer.get_node()->shared_from_this();
+        fusedNodes.push_back(last);
+    }
+    if (last == convert) {
+        return false;
+    }
+    const ov::Shape channels{affine.scale.size()};
+    const auto scale = std::make_shared<ov::op::v0::Constant>(ov::element::f32, channels, affine.scale);
+    const auto shift = std::make_shared<ov::op::v0::Constant>(ov::element::f32, channels, affine.shift);
+    const auto fused = std::make_shared<nodes::ConvertNormalize>(convert->input_value(0),
+                                                                 scale,
+                                                                 shift,
+                                                                 std::max<int64_t>(affine.axis, 0),
+                                                                 convert->get_output_element_type(0));
+    fused->set_friendly_name(last->get_friendly_name());
+    ov::copy_runtime_info(fusedNodes, fused);
+    ov::replace_node(last, fused);
+    return true;
+}
+
+/**
+ * @returns Source coordinates of output pixels as {scale_y, offset_y, scale_x, offset_x}, if the node is
+ *          the bilinear resize of NHWC images
+ */
+std::optional<std::vector<float>> getResizeCoordinates(const ov::Node& node) {
+    using Interpolate = ov::op::v4::Interpolate;
+    const auto* interpolate = ov::as_type<const Interpolate>(&node);
+    if (!interpolate) {
+        return std::nullopt;
+    }
+    const auto& attrs = interpolate->get_attrs();
+    const auto is_zero = [](size_t pad) { return pad == 0; };
+    if ((attrs.mode != Interpolate::InterpolateMode::LINEAR &&
+         attrs.mode != Interpolate::InterpolateMode::LINEAR_ONNX) ||
+        attrs.antialias || attrs.shape_calculation_mode != Interpolate::ShapeCalcMode::SIZES ||
+        !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero)) {
+        return std::nullopt;
+    }
+    const auto& in = interpolate->get_input_shape(0);
+    const auto& out = interpolate->get_output_shape(0);
+    if (in.size() != 4 || out.size() != 4 || in[0] != out[0] || in[3] != out[3]) {
+        return std::nullopt;
+    }
+    std::vector<float> coordinates;
+    for (const size_t d : {1, 2}) {
+        const auto in_size = static_cast<float>(in[d]);
+        const auto out_size = static_cast<float>(out[d]);
+        float scale = in_size / out_size;
+        float offset = 0.0f;
+        switch (attrs.coordinate_transformation_mode) {
+            case Interpolate::CoordinateTransformMode::HALF_PIXEL:
+                offset = 0.5f * scale - 0.5f;
+                break;
+            case Interpolate::CoordinateTransformMode::PYTORCH_HALF_PIXEL:
+                offset = out[d] > 1 ? 0.5f * scale - 0.5f : 0.0f;
+                scale = out[d] > 1 ? scale : 0.0f;
+                break;
+            case Interpolate::CoordinateTransformMode::ASYMMETRIC:
+                break;
+            case Interpolate::CoordinateTransformMode::ALIGN_CORNERS:
+                scale = out[d] > 1 ? (in_size - 1.0f) / (out_size - 1.0f) : 0.0f;
+                break;
+            default:
+                return std::nullopt;
+        }
+        coordinates.push_back(scale);
+        coordinates.push_back(offset);
+    }
+    return coordinates;
+}
+
+bool isNhwcToNchwTranspose(const ov::Node& node) {
+    if (!ov::is_type<ov::op::v1::Transpose>(&node)) {
+        return false;
+    }
+    const auto order = ov::as_type_ptr<ov::op::v0::Constant>(node.get_input_node_shared_ptr(1));
+    return order && order->cast_vector<int64_t>() == std::vector<int64_t>{0, 3, 1, 2};
+}
+
+bool fuseConvertColorPreprocess(Matcher& m) {
+    const auto color = m.get_match_root();
+    nodes::ConvertColorPreprocess::Attributes attrs;
+    attrs.i420 = ov::is_type<ov::op::v8::I420toRGB>(color) || ov::is_type<ov::op::v8::I420toBGR>(color);
+    attrs.bgr = ov::is_type<ov::op::v8::NV12toBGR>(color) || ov::is_type<ov::op::v8::I420toBGR>(color);
+    auto type = color->get_output_element_type(0);
+    if (type != ov::element::u8 && !isConvertedType(type)) {
+        return false;
+    }
+    attrs.round = type.is_integral();
+    auto shape = color->get_output_shape(0);
+    attrs.height = static_cast<int64_t>(shape[1]);
+    attrs.width = static_cast<int64_t>(shape[2]);
+    Affine affine;
+    bool resized = false;
+    std::shared_ptr<ov::Node> last = color;
+    ov::NodeVector fusedNodes{color};
+    while (!attrs.nchw) {
+        const auto consumers = last->get_output_target_inputs(0);
+        if (consumers.size() != 1) {
+            break;
+        }
+        const auto& consumer = *consumers.begin();
+        const auto& node = *consumer.get_node();
+        Affine folded = affine;
+        if (const auto* convert = ov::as_type<const ov::op::v0::Convert>(&node)) {
+            if (!isConvertedType(convert->get_output_element_type(0))) {
+                break;
+            }
+            type = convert->get_output_element_type(0);
+        } else if (!type.is_real()) {
+            // Integer data is resized and normalized with rounding, which isn't reproduced
+            break;
+        } else if (const auto coordinates = resized ? std::nullopt : getResizeCoordinates(node)) {
+            resized = true;
+            attrs.source_coordinates = *coordinates;
+            shape = node.get_output_shape(0);
+            attrs.height = static_cast<int64_t>(shape[1]);
+            attrs.width = static_cast<int64_t>(shape[2]);
+        } else if (foldToAffine(node, consumer.get_index(), shape, folded) &&
+                   (folded.axis == -1 || folded.axis == 3)) {
+            affine = std::move(folded);
+        } else if (isNhwcToNchwTranspose(node)) {
+            attrs.nchw = true;
+        } else {
+            break;
+        }
+        last = consumer.get_node()->shared_from_this();
+        fusedNodes.push_back(last);
+    }
+    if (last == color || !type.is_real()) {
+        return false;
+    }
+    for (size_t c = 0; c < 3; ++c) {
+        attrs.scale[c] = affine.scale[affine.scale.size() == 1 ? 0 : c];
+        attrs.shift[c] = affine.shift[affine.shift.size() == 1 ? 0 : c];
+    }
+    attrs.destination_type = type;
+    const auto fused = std::make_shared<nodes::ConvertColorPreprocess>(color->input_values(), attrs);
+    fused->set_friendly_name(last->get_friendly_name());
+    ov::copy_runtime_info(fusedNodes, fused);
+    ov::replace_node(last, fused);
+    return true;
+}
+
+}  // namespace
+
+FuseConvertsToConcat::FuseConvertsToConcat() {
+    MATCHER_SCOPE(FuseConvertsToConcat);
+    auto concat = wrap_type<ov::op::v0::Concat>(has_static_shape());
+
+    matcher_pass_callback callback = [](Matcher& m) { return fuseConvertsToConcat(m); };
+
+    auto m = std::make_shared<Matcher>(concat, matcher_name);
+    register_matcher(m, callback);
+}
+
+FuseConvertsToGather::FuseConvertsToGather() {
+    MATCHER_SCOPE(FuseConvertsToGather);
+    auto gather = wrap_type<ov::op::v8::Gather>(has_static_shape());
+
+    matcher_pass_callback callback = [](Matcher& m) { return fuseConvertsToGather(m); };
+
+    auto m = std::make_shared<Matcher>(gather, matcher_name);
+    register_matcher(m, callback);
+}
+
+FuseConvertNormalize::FuseConvertNormalize() {
+    MATCHER_SCOPE(FuseConvertNormalize);
+    auto convert = wrap_type<ov::op::v0::Convert>(has_static_shape());
+
+    matcher_pass_callback callback = [](Matcher& m) { return fuseConvertNormalize(m); };
+
+    auto m = std::make_shared<Matcher>(convert, matcher_name);
+    register_matcher(m, callback);
+}
+
+FuseConvertColorPreprocess::FuseConvertColorPreprocess() {
+    MATCHER_SCOPE(FuseConvertColorPreprocess);
+    auto color = wrap_type<ov::op::v8::NV12toRGB, ov::op::v8::NV12toBGR, ov::op::v8::I420toRGB, ov::op::v8::I420toBGR>(
+        has_static_shape());
+
+    matcher_pass_callback callback = [](Matcher& m) { return fuseConvertColorPreprocess(m); };
+
+    auto m = std::make_shared<Matcher>(color, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Absorbs floating point Converts of all inputs and of the output of Concat into ConcatConvert,
+ * which converts data while it is copied
+ */
+class FuseConvertsToConcat : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseConvertsToConcat", "0");
+    FuseConvertsToConcat();
+};
+
+/**
+ * Absorbs floating point Converts of data and of the output of Gather into GatherConvert,
+ * so that only the gathered elements are converted
+ */
+class FuseConvertsToGather : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseConvertsToGather", "0");
+    FuseConvertsToGather();
+};
+
+/**
+ * Folds Add, Subtract, Multiply and Divide by scalar or per-channel constants, which follow Convert of integer data
+ * to floating point, e.g. the Convert -> Subtract(mean) -> Multiply(scale) chain of image preprocessing,
+ * into ConvertNormalize, which reads integer data and writes the normalized data by a single kernel
+ */
+class FuseConvertNormalize : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseConvertNormalize", "0");
+    FuseConvertNormalize();
+};
+
+/**
+ * Absorbs Convert to floating point, the bilinear resize, Add, Subtract, Multiply and Divide by scalar or
+ * per-channel constants and the NHWC -> NCHW Transpose, which follow NV12 or I420 color conversion,
+ * into ConvertColorPreprocess, so that camera images are preprocessed by a single kernel
+ */
+class FuseConvertColorPreprocess : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseConvertColorPreprocess", "0");
+    FuseConvertColorPreprocess();
+};
+
+}  // namespace ov::nvidia_gpu::pass
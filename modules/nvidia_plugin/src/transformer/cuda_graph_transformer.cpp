@@ -28,13 +28,33 @@
 #include "transformer/fuse_conv_biasadd_activation.hpp"
 
 #include "bidirectional_lstm_sequence_composition.hpp"
+#include "broadcast_elimination.hpp"
+#include "channel_padding.hpp"
 #include "concat_transformation.hpp"
+#include "convert_fusion.hpp"
 #include "detection_output_fix_input_types_transformation.hpp"
+#include "eltwise_fusion.hpp"
+#include "embedding_bag_fusion.hpp"
+#include "fake_quantize_matmul_transformation.hpp"
+#include "fp8_matmul_transformation.hpp"
 #include "fuse_matmul_add.hpp"
+#include "group_norm_fusion.hpp"
+#include "layer_norm_fusion.hpp"
 #include "matmul_transformations.hpp"
+#include "mixed_precision_transformation.hpp"
+#include "multi_head_attention_fusion.hpp"
+#include "nhwc_layout_propagation.hpp"
+#include "non_max_suppression_transformation.hpp"
+#include "pooling_fusion.hpp"
 #include "reduce_transformation.hpp"
 #include "remove_duplicated_results_transformation.hpp"
 #include "remove_redundant_convert_transformation.hpp"
+#include "shape_subgraph_folding.hpp"
+#include "sparse_matmul_transformation.hpp"
+#include "sub_pixel_convolution.hpp"
+#include "token_merge_fusion.hpp"
+#include "transpose_sinking_transformation.hpp"
+#include "weights_compression_transformation.hpp"
 #include "transformations/op_conversions/convert_divide.hpp"
 #include "transformations/op_conversions/convert_interpolate1_to_interpolate4.hpp"
 #include "transformations/op_conversions/convert_subtract.hpp"
@@ -42,6 +62,9 @@
 #include "transformations/op_conversions/gelu7_downgrade.hpp"
 #include "transformations/op_conversions/mvn6_decomposition.hpp"
 #include "transformations/op_conversions/hswish_decomposition.hpp"
+#include "transformations/op_conversions/log_softmax_decomposition.hpp"
+#include "transformations/op_conversions/reduce_l1_decomposition.hpp"
+#include "transformations/op_conversions/reduce_l2_decomposition.hpp"
 #include "transformations/common_optimizations/reshape_prelu.hpp"
 
 using namespace ov::nvidia_gpu;
@@ -50,7 +73,8 @@ void GraphTransformer::transform(const CUDA::Device& device,
                                  std::shared_ptr<ov::Model>& model,
                                  const Configuration& config) const {
     auto inference_precision = config.get_inference_precision();
-    if (inference_precision == ov::element::f16 && !isHalfSupported(device)) {
+    if ((inference_precision == ov::element::f16 && !isHalfSupported(device)) ||
+        (inference_precision == ov::element::bf16 && !isBf16Supported(device))) {
         inference_precision = ov::element::f32;
     }
 
@@ -67,8 +91,14 @@ void GraphTransformer::transform(const CUDA::Device& device,
     type_to_fuse_map empty_fuse_map = {};
     if (upscale_precision()) {
         fp_convert_precision_map.insert(std::make_pair(ov::element::f16, ov::element::f32));
+        fp_convert_precision_map.insert(std::make_pair(ov::element::bf16, ov::element::f32));
     } else if (downscale_precision()) {
         fp_convert_precision_map.insert(std::make_pair(ov::element::f32, ov::element::f16));
+        fp_convert_precision_map.insert(std::make_pair(ov::element::bf16, ov::element::f16));
+    } else if (inference_precision == ov::element::bf16) {
+        // BF16 has the range of FP32, so activations overflowing FP16 don't need to be kept in FP32
+        fp_convert_precision_map.insert(std::make_pair(ov::element::f32, ov::element::bf16));
+        fp_convert_precision_map.insert(std::make_pair(ov::element::f16, ov::element::bf16));
     }
 
     auto pass_config = std::make_shared<ov::pass::PassConfig>();
@@ -88,9 +118,12 @@ void GraphTransformer::transform(const CUDA::Device& device,
     pass_config->disable<ov::pass::Gelu7Downgrade>();
     pass_config->disable<ov::pass::ConvertGELU>();
     pass_config->disable<ov::pass::HSwishDecomposition>();
+    pass_config->disable<ov::pass::LogSoftmaxDecomposition>();
     pass_config->disable<ov::pass::ConvertReduceMaxToPooling>();
     pass_config->disable<ov::pass::ConvertReduceMeanToPooling>();
     pass_config->disable<ov::pass::ConvertReduceSumToPooling>();
+    pass_config->disable<ov::pass::ReduceL1Decomposition>();
+    pass_config->disable<ov::pass::ReduceL2Decomposition>();
     pass_config->disable<ov::pass::ShuffleChannelsFusion>();
 
     // Skip decomposition for LSTMSequence and GRUSequence
@@ -103,8 +136,19 @@ void GraphTransformer::transform(const CUDA::Device& device,
     [[maybe_unused]] const auto& originOpsSize = originOps.size();
 
     pass_manager.register_pass<ov::pass::InitNodeInfo>();
-    pass_manager.register_pass<ov::pass::ConvertPrecision>(fp_convert_precision_map, empty_fuse_map, true, false);
+    // Numerically sensitive operations are kept in f32, Converts on their boundaries are fused later
+    if (downscale_precision() && config.is_mixed_precision_enabled()) {
+        pass_manager.register_pass<ov::nvidia_gpu::pass::MixedPrecisionTransformation>();
+    }
+    // Parameters and Results are converted as well if inputs and outputs are transferred in the device precision,
+    // infer requests convert them on the host (see ov::nvidia_gpu::device_precision_io)
+    pass_manager.register_pass<ov::pass::ConvertPrecision>(
+        fp_convert_precision_map, empty_fuse_map, true, config.is_device_precision_io_enabled());
     pass_manager.register_pass<ov::pass::CommonOptimizations>();
+    // Shape computations surviving common optimizations would run as tiny kernels splitting CUDA graphs
+    pass_manager.register_pass<ov::nvidia_gpu::pass::ShapeSubgraphFolding>();
+    // Outputs of NMS are padded to static shapes before other passes, which skip nodes of dynamic shapes
+    pass_manager.register_pass<ov::nvidia_gpu::pass::NonMaxSuppressionTransformation>();
     pass_manager.register_pass<ov::pass::ReshapePRelu>();
     // Do we actually need this transformations in plugin?
     // Having duplicated results seems to be rare case in real world.
@@ -112,6 +156,7 @@ void GraphTransformer::transform(const CUDA::Device& device,
     // relies on number of outputs of original model
     // pass_manager.register_pass<ov::nvidia_gpu::pass::RemoveDuplicatedResultsTransformation>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::RemoveRedundantConvertTransformation>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::BroadcastElimination>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::BidirectionalSequenceComposition>();
     pass_manager.register_pass<ov::pass::ConvertSequenceToTensorIterator>();
 
@@ -123,8 +168,7 @@ void GraphTransformer::transform(const CUDA::Device& device,
             return (gru_seq->get_clip() == 0.0f &&
                     gru_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh"} &&
                     (gru_seq->get_input_size() != 1 || gru_seq->get_hidden_size() != 1) &&
-                    (gru_seq->get_direction() != ov::op::RecurrentSequenceDirection::REVERSE) &&
-                    (gru_seq->get_direction() != ov::op::RecurrentSequenceDirection::BIDIRECTIONAL));
+                    (gru_seq->get_direction() != ov::op::RecurrentSequenceDirection::REVERSE));
         } else if (const auto &lstm_seq = std::dynamic_pointer_cast<const ov::op::v5::LSTMSequence>(node)) {
             return (lstm_seq->get_clip() == 0.0f &&
                     lstm_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"} &&
@@ -143,20 +187,75 @@ void GraphTransformer::transform(const CUDA::Device& device,
                 return is_sequence_primitive_supported(node);
             });
 
+    // Strided deconvolutions become forward convolutions before the bias and activations are fused into convolutions
+    pass_manager.register_pass<ov::nvidia_gpu::pass::ConvolutionBackpropDataToSubPixelConvolution>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::ConvolutionAsymPaddingTransformation>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::GroupConvolutionAsymPaddingTransformation>();
+    // Channels are aligned for tensor cores before biases and activations are fused with their padded constants
+    if (device.props().major >= 7) {
+        pass_manager.register_pass<ov::nvidia_gpu::pass::ChannelPaddingTransformation>();
+    }
     pass_manager.register_pass<ov::nvidia_gpu::pass::CudaConvolutionFusion>();
+    // Pooling of activated outputs is fused into the kernel of depthwise convolutions
+    pass_manager.register_pass<ov::nvidia_gpu::pass::FuseMaxPoolToDepthwiseConvolution>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::ConvolutionBackpropDataAsymPaddingTransformation>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::GroupConvolutionBackpropDataAsymPaddingTransformation>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::FusedConvBackpropDataAsymPaddingTransformation>();
+    // Transposes are sunk to the operations which absorb them, e.g. MatMul or convolutions in NHWC layout
+    pass_manager.register_pass<ov::nvidia_gpu::pass::TransposeSinkingTransformation>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::TransposeMatMulTransformation>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::PrepackMatMulWeightsTransformation>();
+    // Attention is fused before FullyConnected, which could take the product of queries and keys with a constant mask
+    pass_manager.register_pass<ov::nvidia_gpu::pass::MultiHeadAttentionFusion>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::FullyConnectedTransformation>();
+    if (isInt8Supported(device)) {
+        pass_manager.register_pass<ov::nvidia_gpu::pass::FakeQuantizeMatMulTransformation>();
+    }
+#if CUDART_VERSION >= 11080
+    if (config.is_fp8_matmul_enabled() && isFp8Supported(device)) {
+        pass_manager.register_pass<ov::nvidia_gpu::pass::Fp8MatMulTransformation>();
+    }
+#endif
+    if (config.get_weights_compression() != ov::element::undefined) {
+        pass_manager.register_pass<ov::nvidia_gpu::pass::WeightsCompressionTransformation>(
+            config.get_weights_compression());
+    }
+#ifdef ENABLE_CUSPARSELT
+    // Weights pruned to 2:4 sparsity, which aren't converted by the explicitly enabled FP8 or weights compression
+    if (isSparseSupported(device)) {
+        pass_manager.register_pass<ov::nvidia_gpu::pass::SparseMatMulTransformation>();
+    }
+#endif
+    // Scale and activation are fused into FullyConnected, which isn't converted to quantized, compressed or sparse nodes
+    pass_manager.register_pass<ov::nvidia_gpu::pass::FuseFullyConnectedWithScale>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::SinkActivationToFullyConnected>();
+    // Classifier heads average the last activations and multiply them by weights in a single kernel
+    pass_manager.register_pass<ov::nvidia_gpu::pass::FuseGlobalAvgPoolToFullyConnected>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::ConcatTransformation>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::EmbeddingBagFusion>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::ReduceTransformation>();
     pass_manager.register_pass<ov::nvidia_gpu::pass::DetectionOutputFixInputTypesTransformation>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::FuseConvertsToConcat>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::FuseConvertsToGather>();
+    // Preprocessing of integer inputs isn't fused by EltwiseFusion, which handles floating point data only
+    pass_manager.register_pass<ov::nvidia_gpu::pass::FuseConvertColorPreprocess>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::FuseConvertNormalize>();
+    pass_manager.register_pass<ov::nvidia_gpu::pass::LayerNormFusion>();
+    // GroupNorm is fused before NhwcLayoutPropagation, which keeps it in NHWC regions of convolutions
+    pass_manager.register_pass<ov::nvidia_gpu::pass::GroupNormFusion>();
+    // Token merging of ViT blocks is fused, GatherElements and ScatterElementsUpdate aren't supported otherwise
+    pass_manager.register_pass<ov::nvidia_gpu::pass::TokenMergeFusion>();
 
     // Do we actually need to eliminate broadcast one more time at the end?
     pass_manager.register_pass<ov::pass::NopElimination>();
+    // NHWC layout is preferred by tensor cores, which are present since Volta
+    if (device.props().major >= 7) {
+        pass_manager.register_pass<ov::nvidia_gpu::pass::NhwcLayoutPropagation>();
+    }
+    // Element-wise operations of NHWC regions have inputs of the same shape, so they are fused regardless of layout
+    pass_manager.register_pass<ov::nvidia_gpu::pass::EltwiseFusion>();
+    // FusedEltwise nodes write strided slices, so that concats along inner axes are optimized after the fusion
+    pass_manager.register_pass<ov::nvidia_gpu::pass::ConcatTransformation>();
 
     pass_manager.run_passes(model);
 
@@ -0,0 +1,159 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "eltwise_fusion.hpp"
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "nodes/fused_eltwise.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+using nodes::FusedEltwise;
+
+bool isBroadcastableTo(const ov::Shape& shape, const ov::Shape& outputShape) {
+    if (shape.size() > outputShape.size()) {
+        return false;
+    }
+    const size_t rankDiff = outputShape.size() - shape.size();
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] != 1 && shape[i] != outputShape[i + rankDiff]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool isScalarConstant(const ov::Node& node) {
+    return ov::is_type<ov::op::v0::Constant>(&node) && ov::shape_size(node.get_output_shape(0)) == 1;
+}
+
+/**
+ * Boolean output is packed if it is read only by kernels of FusedEltwise, which are created before their producers
+ */
+bool isPackable(const ov::Node& root) {
+    const auto consumers = root.get_output_target_inputs(0);
+    return root.get_output_element_type(0) == ov::element::boolean && !consumers.empty() &&
+           std::all_of(consumers.begin(), consumers.end(), [](const ov::Input<ov::Node>& consumer) {
+               return ov::is_type<FusedEltwise>(consumer.get_node());
+           });
+}
+
+/**
+ * Producer is fused if all its consumers are in the group already, so that it isn't computed twice
+ */
+bool isConsumedInGroup(const ov::Node& producer, const std::unordered_set<const ov::Node*>& group) {
+    const auto consumers = producer.get_output_target_inputs(0);
+    return std::all_of(consumers.begin(), consumers.end(), [&group](const ov::Input<ov::Node>& consumer) {
+        return group.count(consumer.get_node()) > 0;
+    });
+}
+
+}  // namespace
+
+bool EltwiseFusion::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(EltwiseFusion);
+
+    const auto ops = model->get_ordered_ops();
+    std::unordered_map<const ov::Node*, size_t> order;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        order.emplace(ops[i].get(), i);
+    }
+    std::unordered_set<const ov::Node*> fused;
+    bool updated = false;
+    // Groups are grown from their outputs towards inputs, so that they are maximal
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it) {
+        const auto& root = *it;
+        if (fused.count(root.get()) > 0 || !FusedEltwise::is_fusible(*root)) {
+            continue;
+        }
+        const auto& outputShape = root->get_output_shape(0);
+        std::vector<std::shared_ptr<ov::Node>> group{root};
+        std::unordered_set<const ov::Node*> inGroup{root.get()};
+        for (size_t i = 0; i < group.size(); ++i) {
+            for (const auto& input : group[i]->input_values()) {
+                const auto producer = input.get_node_shared_ptr();
+                if (inGroup.count(producer.get()) > 0 || fused.count(producer.get()) > 0 ||
+                    !FusedEltwise::is_fusible(*producer) ||
+                    !isBroadcastableTo(producer->get_output_shape(0), outputShape) ||
+                    !isConsumedInGroup(*producer, inGroup)) {
+                    continue;
+                }
+                group.push_back(producer);
+                inGroup.insert(producer.get());
+            }
+        }
+        // Single operation is worth a kernel only if its mask is written packed
+        const bool packed = isPackable(*root);
+        if (group.size() < 2 && !packed) {
+            continue;
+        }
+        std::sort(group.begin(), group.end(), [&order](const auto& lhs, const auto& rhs) {
+            return order.at(lhs.get()) < order.at(rhs.get());
+        });
+
+        // Body is a copy of the group, which inputs are replaced by parameters
+        ov::OutputVector inputs;
+        ov::ParameterVector parameters;
+        std::map<ov::Output<ov::Node>, ov::Output<ov::Node>> bodyOutputs;
+        for (const auto& node : group) {
+            ov::OutputVector bodyInputs;
+            for (const auto& input : node->input_values()) {
+                auto found = bodyOutputs.find(input);
+                if (found == bodyOutputs.end()) {
+                    std::shared_ptr<ov::Node> bodyInput;
+                    if (isScalarConstant(*input.get_node())) {
+                        bodyInput = input.get_node()->clone_with_new_inputs({});
+                    } else {
+                        auto parameter =
+                            std::make_shared<ov::op::v0::Parameter>(input.get_element_type(), input.get_shape());
+                        parameters.push_back(parameter);
+                        inputs.push_back(input);
+                        bodyInput = parameter;
+                    }
+                    found = bodyOutputs.emplace(input, bodyInput->output(0)).first;
+                }
+                bodyInputs.push_back(found->second);
+            }
+            const auto bodyNode = node->clone_with_new_inputs(bodyInputs);
+            bodyOutputs.emplace(node->output(0), bodyNode->output(0));
+        }
+        if (inputs.empty()) {
+            // Group of constants is left for constant folding
+            continue;
+        }
+        const auto result = std::make_shared<ov::op::v0::Result>(bodyOutputs.at(root->output(0)));
+        const auto body = std::make_shared<ov::Model>(ov::ResultVector{result}, parameters);
+
+        const auto fusedEltwise = std::make_shared<FusedEltwise>(inputs, body);
+        fusedEltwise->set_friendly_name(root->get_friendly_name());
+        ov::NodeVector groupNodes(group.begin(), group.end());
+        ov::copy_runtime_info(groupNodes, fusedEltwise);
+        ov::replace_node(root, fusedEltwise);
+        if (packed) {
+            fusedEltwise->set_packed_output(true);
+            for (const auto& consumer : fusedEltwise->get_output_target_inputs(0)) {
+                consumer.get_node()->validate_and_infer_types();
+            }
+        }
+        for (const auto& node : group) {
+            fused.insert(node.get());
+        }
+        updated = true;
+    }
+    return updated;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,25 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Fuses maximal groups of connected element-wise operations (see nodes::FusedEltwise::is_fusible) into
+ * FusedEltwise, which computes them by a single generated kernel. A group has a single output: every operation
+ * except the last one is consumed only inside of the group, and outputs of all operations are broadcastable
+ * to the output of the group. Scalar constants are moved into the body of the node, other producers become
+ * its inputs. Boolean masks of comparisons, logical operations and Select are fused as well; a mask, which is
+ * consumed by several groups, is written by its own FusedEltwise packed to a bit per element
+ */
+class EltwiseFusion : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("EltwiseFusion", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
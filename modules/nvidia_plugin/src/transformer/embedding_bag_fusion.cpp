@@ -0,0 +1,94 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "embedding_bag_fusion.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/embeddingbag_packedsum.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/util/gather_base.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+namespace {
+
+bool isGatherOfRows(const ov::op::util::GatherBase& gather) {
+    const auto& indicesType = gather.get_input_element_type(1);
+    return gather.get_batch_dims() == 0 && gather.get_axis() == 0 && gather.get_input_partial_shape(1).rank() == 2 &&
+           (indicesType == ov::element::i32 || indicesType == ov::element::i64);
+}
+
+bool isReductionOverBag(const ov::Node& reduce) {
+    const auto axes = ov::as_type<ov::op::v0::Constant>(reduce.get_input_node_ptr(1));
+    if (!axes) {
+        return false;
+    }
+    const auto values = axes->cast_vector<int64_t>();
+    const auto rank = static_cast<int64_t>(reduce.get_input_shape(0).size());
+    return values.size() == 1 && (values.front() == 1 || values.front() == 1 - rank);
+}
+
+}  // namespace
+
+EmbeddingBagFusion::EmbeddingBagFusion() {
+    MATCHER_SCOPE(EmbeddingBagFusion);
+    const auto gather = wrap_type<ov::op::v1::Gather, ov::op::v7::Gather, ov::op::v8::Gather>(
+        {any_input(), any_input(), wrap_type<ov::op::v0::Constant>()},
+        [](const ov::Output<ov::Node>& output) { return has_static_shape()(output) && consumers_count(1)(output); });
+    const auto reduce = wrap_type<ov::op::v1::ReduceSum, ov::op::v1::ReduceMean>(
+        {gather, wrap_type<ov::op::v0::Constant>()}, has_static_shape());
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& patternMap = m.get_pattern_value_map();
+        const auto gatherNode = ov::as_type_ptr<ov::op::util::GatherBase>(patternMap.at(gather).get_node_shared_ptr());
+        const auto reduceNode = patternMap.at(reduce).get_node_shared_ptr();
+        if (!gatherNode || !isGatherOfRows(*gatherNode) || !isReductionOverBag(*reduceNode)) {
+            return false;
+        }
+        const auto table = gatherNode->input_value(0);
+        const auto indices = gatherNode->input_value(1);
+        const auto& indicesShape = indices.get_shape();
+        const auto& elementType = table.get_element_type();
+        if (!elementType.is_real()) {
+            return false;
+        }
+
+        ov::NodeVector newNodes;
+        std::shared_ptr<ov::Node> embeddingBag;
+        if (ov::is_type<ov::op::v1::ReduceMean>(reduceNode)) {
+            const auto weights = ov::op::v0::Constant::create(
+                elementType, indicesShape, std::vector<float>(ov::shape_size(indicesShape), 1.0f / indicesShape[1]));
+            embeddingBag = std::make_shared<ov::op::v3::EmbeddingBagPackedSum>(table, indices, weights);
+            newNodes.push_back(weights);
+        } else {
+            embeddingBag = std::make_shared<ov::op::v3::EmbeddingBagPackedSum>(table, indices);
+        }
+        newNodes.push_back(embeddingBag);
+
+        // ReduceSum with keep_dims has the unit dimension of the bag
+        std::shared_ptr<ov::Node> result = embeddingBag;
+        const auto& outputShape = reduceNode->get_output_shape(0);
+        if (embeddingBag->get_output_shape(0) != outputShape) {
+            const auto shape = ov::op::v0::Constant::create(ov::element::i64, {outputShape.size()}, outputShape);
+            result = std::make_shared<ov::op::v1::Reshape>(embeddingBag, shape, false);
+            newNodes.push_back(shape);
+            newNodes.push_back(result);
+        }
+        result->set_friendly_name(reduceNode->get_friendly_name());
+        ov::copy_runtime_info({gatherNode, reduceNode}, newNodes);
+        ov::replace_node(reduceNode, result);
+        return true;
+    };
+
+    register_matcher(std::make_shared<Matcher>(reduce, matcher_name), callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,22 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Fuses Gather of rows of an embedding table by indices [bags, bag size] followed by ReduceSum or ReduceMean over
+ * the bag into EmbeddingBagPackedSum, which doesn't store the gathered rows. Mean is computed by per sample weights
+ * equal to 1 / bag size
+ */
+class EmbeddingBagFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("EmbeddingBagFusion", "0");
+    EmbeddingBagFusion();
+};
+
+}  // namespace ov::nvidia_gpu::pass
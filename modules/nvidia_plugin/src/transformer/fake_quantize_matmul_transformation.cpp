@@ -0,0 +1,140 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "fake_quantize_matmul_transformation.hpp"
+
+#include <cmath>
+#include <optional>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/fake_quantize.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/fully_connected.hpp"
+#include "transformer/nodes/quantized_matmul.hpp"
+#include "weights_compression_transformation.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+struct ActivationsRange {
+    float low;
+    float high;
+    size_t levels;
+    float scale;
+};
+
+std::optional<float> scalar_value(const ov::Output<ov::Node>& output) {
+    const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || ov::shape_size(constant->get_output_shape(0)) != 1) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<float>()[0];
+}
+
+/**
+ * @returns Range of FakeQuantize if it maps values to themselves with the zero point in the middle of levels,
+ *          so that its levels are i8 values multiplied by a single scale
+ */
+std::optional<ActivationsRange> symmetric_range(const ov::op::v0::FakeQuantize& fq) {
+    const auto levels = fq.get_levels();
+    if (levels != 255 && levels != 256) {
+        return std::nullopt;
+    }
+    const auto input_low = scalar_value(fq.input_value(1));
+    const auto input_high = scalar_value(fq.input_value(2));
+    const auto output_low = scalar_value(fq.input_value(3));
+    const auto output_high = scalar_value(fq.input_value(4));
+    if (!input_low || !input_high || !output_low || !output_high || *input_low != *output_low ||
+        *input_high != *output_high || *input_low >= *input_high) {
+        return std::nullopt;
+    }
+    const float scale = (*input_high - *input_low) / static_cast<float>(levels - 1);
+    const float zero_point = static_cast<float>(levels / 2);
+    if (std::abs(*input_low / scale + zero_point) > 1e-3f) {
+        return std::nullopt;
+    }
+    return ActivationsRange{*input_low, *input_high, levels, scale};
+}
+
+template <typename TOperation>
+bool quantize_matmul(const std::shared_ptr<ov::Node>& node) {
+    const auto op = std::dynamic_pointer_cast<TOperation>(node);
+    if (!op || op->get_transpose_a() || op->is_dynamic()) {
+        return false;
+    }
+    const auto& element_type = op->get_input_element_type(0);
+    if ((element_type != ov::element::f32 && element_type != ov::element::f16) ||
+        op->get_input_element_type(1) != element_type) {
+        return false;
+    }
+    const auto fq = std::dynamic_pointer_cast<ov::op::v0::FakeQuantize>(op->get_input_node_shared_ptr(0));
+    const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op->get_input_node_shared_ptr(1));
+    if (!fq || !constant || constant->get_output_shape(0).size() != 2 || op->get_input_shape(0).empty()) {
+        return false;
+    }
+    const auto range = symmetric_range(*fq);
+    if (!range) {
+        return false;
+    }
+    // Int8 cuBLAS GEMM requires leading dimensions to be multiples of 4
+    const size_t k = op->get_input_shape(0).back();
+    const size_t n = op->get_output_shape(0).back();
+    if (k % 4 != 0 || n % 4 != 0) {
+        return false;
+    }
+    if (op->get_input_size() == 3 &&
+        ov::shape_size(op->get_input_shape(2)) != ov::shape_size(op->get_output_shape(0))) {
+        return false;
+    }
+
+    const auto quantized = quantize_weights(*constant, op->get_transpose_b(), ov::element::i8, ov::element::f32);
+    auto scales = quantized.scales->cast_vector<float>();
+    for (auto& scale : scales) {
+        scale *= range->scale;
+    }
+    const auto scales_constant = ov::op::v0::Constant::create(element_type, ov::Shape{scales.size()}, scales);
+    quantized.weights->set_friendly_name(constant->get_friendly_name() + "/quantized");
+    scales_constant->set_friendly_name(constant->get_friendly_name() + "/scales");
+
+    std::shared_ptr<nodes::QuantizedMatMul> quantized_matmul;
+    if (op->get_input_size() == 3) {
+        quantized_matmul = std::make_shared<nodes::QuantizedMatMul>(fq->input_value(0),
+                                                                    quantized.weights,
+                                                                    scales_constant,
+                                                                    op->get_input_source_output(2),
+                                                                    range->low,
+                                                                    range->high,
+                                                                    range->levels);
+    } else {
+        quantized_matmul = std::make_shared<nodes::QuantizedMatMul>(
+            fq->input_value(0), quantized.weights, scales_constant, range->low, range->high, range->levels);
+    }
+    quantized_matmul->set_friendly_name(op->get_friendly_name());
+    ov::copy_runtime_info({fq, constant, op}, {quantized.weights, scales_constant, quantized_matmul});
+    ov::replace_node(op, quantized_matmul);
+    return true;
+}
+
+}  // namespace
+
+FakeQuantizeMatMulTransformation::FakeQuantizeMatMulTransformation() {
+    MATCHER_SCOPE(FakeQuantizeMatMulTransformation);
+    auto matmul = wrap_type<ov::op::v0::MatMul, nodes::FullyConnected>();
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto node = m.get_match_root();
+        return quantize_matmul<ov::op::v0::MatMul>(node) || quantize_matmul<nodes::FullyConnected>(node);
+    };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,22 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Replaces MatMul and FullyConnected with constant weights, whose activations come from a symmetric per-tensor
+ * FakeQuantize of 255 or 256 levels, by QuantizedMatMul, which executes them in int8 with i32 accumulation.
+ * Scales of activations are taken from the FakeQuantize, weights are quantized per output channel
+ */
+class FakeQuantizeMatMulTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FakeQuantizeMatMulTransformation", "0");
+    FakeQuantizeMatMulTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
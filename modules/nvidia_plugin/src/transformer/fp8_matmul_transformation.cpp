@@ -0,0 +1,133 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "fp8_matmul_transformation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/fp8_matmul.hpp"
+#include "transformer/nodes/fully_connected.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+constexpr float max_f8e4m3_value = 448.0f;
+constexpr int min_f8e4m3_exponent = -6;
+constexpr int f8e4m3_exponent_bias = 7;
+constexpr int f8e4m3_mantissa_bits = 3;
+
+bool is_convertible(const ov::Node& node) {
+    if (node.is_dynamic()) {
+        return false;
+    }
+    const auto& element_type = node.get_input_element_type(0);
+    if ((element_type != ov::element::f32 && element_type != ov::element::f16) ||
+        node.get_input_element_type(1) != element_type) {
+        return false;
+    }
+    const auto weights = std::dynamic_pointer_cast<ov::op::v0::Constant>(node.get_input_node_shared_ptr(1));
+    if (!weights || weights->get_output_shape(0).size() != 2 || node.get_input_shape(0).empty()) {
+        return false;
+    }
+    // FP8 GEMM of cuBLASLt requires dimensions of matrices to be multiples of 16
+    const size_t k = node.get_input_shape(0).back();
+    const size_t n = node.get_output_shape(0).back();
+    if (k % 16 != 0 || n % 16 != 0) {
+        return false;
+    }
+    return node.get_input_size() != 3 ||
+           ov::shape_size(node.get_input_shape(2)) == ov::shape_size(node.get_output_shape(0));
+}
+
+template <typename TOperation>
+bool convert_to_fp8(const std::shared_ptr<ov::Node>& node) {
+    const auto op = std::dynamic_pointer_cast<TOperation>(node);
+    if (!op || op->get_transpose_a() || !is_convertible(*op)) {
+        return false;
+    }
+    const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op->get_input_node_shared_ptr(1));
+    const auto& shape = constant->get_output_shape(0);
+    const bool transpose_b = op->get_transpose_b();
+    const size_t n = transpose_b ? shape[0] : shape[1];
+    const size_t k = transpose_b ? shape[1] : shape[0];
+    const auto values = constant->cast_vector<float>();
+    float max_abs = 0.0f;
+    for (const auto value : values) {
+        max_abs = std::max(max_abs, std::abs(value));
+    }
+    const float scale = max_abs > 0.0f ? max_abs / max_f8e4m3_value : 1.0f;
+    std::vector<uint8_t> converted(n * k);
+    for (size_t in = 0; in < n; ++in) {
+        for (size_t ik = 0; ik < k; ++ik) {
+            const float value = transpose_b ? values[in * k + ik] : values[ik * n + in];
+            converted[in * k + ik] = float_to_f8e4m3(value / scale);
+        }
+    }
+    const auto weights = std::make_shared<ov::op::v0::Constant>(ov::element::u8, ov::Shape{n, k}, converted.data());
+    const auto scale_constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1}, {scale});
+    weights->set_friendly_name(constant->get_friendly_name() + "/fp8");
+    scale_constant->set_friendly_name(constant->get_friendly_name() + "/scale");
+
+    std::shared_ptr<nodes::Fp8MatMul> fp8_matmul;
+    if (op->get_input_size() == 3) {
+        fp8_matmul = std::make_shared<nodes::Fp8MatMul>(
+            op->get_input_source_output(0), weights, scale_constant, op->get_input_source_output(2));
+    } else {
+        fp8_matmul = std::make_shared<nodes::Fp8MatMul>(op->get_input_source_output(0), weights, scale_constant);
+    }
+    fp8_matmul->set_friendly_name(op->get_friendly_name());
+    ov::copy_runtime_info({constant, op}, {weights, scale_constant, fp8_matmul});
+    ov::replace_node(op, fp8_matmul);
+    return true;
+}
+
+}  // namespace
+
+uint8_t float_to_f8e4m3(float value) {
+    const uint8_t sign = std::signbit(value) ? 0x80 : 0;
+    if (std::isnan(value)) {
+        return sign | 0x7F;
+    }
+    const float abs_value = std::min(std::abs(value), max_f8e4m3_value);
+    int exponent = 0;
+    std::frexp(abs_value, &exponent);
+    // Values below the smallest normal one are subnormal with the same quantum as the smallest normal ones
+    int unbiased_exponent = std::max(exponent - 1, min_f8e4m3_exponent);
+    auto quanta = static_cast<int>(
+        std::nearbyint(std::ldexp(abs_value, f8e4m3_mantissa_bits - unbiased_exponent)));
+    constexpr int implicit_one = 1 << f8e4m3_mantissa_bits;
+    if (quanta == 2 * implicit_one) {
+        ++unbiased_exponent;
+        quanta = implicit_one;
+    }
+    if (quanta < implicit_one) {
+        return sign | static_cast<uint8_t>(quanta);
+    }
+    return sign | static_cast<uint8_t>((unbiased_exponent + f8e4m3_exponent_bias) << f8e4m3_mantissa_bits) |
+           static_cast<uint8_t>(quanta - implicit_one);
+}
+
+Fp8MatMulTransformation::Fp8MatMulTransformation() {
+    MATCHER_SCOPE(Fp8MatMulTransformation);
+    auto matmul = wrap_type<ov::op::v0::MatMul, nodes::FullyConnected>();
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto node = m.get_match_root();
+        return convert_to_fp8<ov::op::v0::MatMul>(node) || convert_to_fp8<nodes::FullyConnected>(node);
+    };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
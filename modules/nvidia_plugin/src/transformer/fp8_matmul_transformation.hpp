@@ -0,0 +1,28 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @returns Bits of the value rounded to the nearest E4M3 value, values beyond the finite range are saturated
+ */
+uint8_t float_to_f8e4m3(float value);
+
+/**
+ * Replaces MatMul and FullyConnected with constant weights by Fp8MatMul, which keeps weights in FP8 (E4M3)
+ * with a per-tensor scale and executes them on FP8 tensor cores
+ */
+class Fp8MatMulTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("Fp8MatMulTransformation", "0");
+    Fp8MatMulTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -420,6 +420,33 @@ ov::nvidia_gpu::pass::SinkActivationToFusedConvolution::SinkActivationToFusedCon
     register_matcher(m, callback);
 }
 
+ov::nvidia_gpu::pass::SinkActivationToFusedGroupConvolution::SinkActivationToFusedGroupConvolution() {
+    MATCHER_SCOPE(SinkActivationToFusedGroupConvolution);
+    // Depthwise convolutions of residual blocks are memory bound, so the activation saves a full pass over the output
+    auto fused_convolution = wrap_type<FusedGroupConvolution>(consumers_count(1));
+    auto activation = wrap_type<ov::op::v0::Relu, ov::op::v0::Sigmoid>({fused_convolution});
+
+    matcher_pass_callback callback = [](Matcher &m) {
+        return FusedConvCallbacks<FusedGroupConvolution>::sink_activation_to_fused_convolution(m);
+    };
+
+    auto m = std::make_shared<Matcher>(activation, matcher_name);
+    register_matcher(m, callback);
+}
+
+ov::nvidia_gpu::pass::SinkActivationToFusedConvBackpropData::SinkActivationToFusedConvBackpropData() {
+    MATCHER_SCOPE(SinkActivationToFusedConvBackpropData);
+    auto fused_convolution = wrap_type<FusedConvBackpropData>(consumers_count(1));
+    auto activation = wrap_type<ov::op::v0::Relu, ov::op::v0::Sigmoid, ov::op::v0::Tanh>({fused_convolution});
+
+    matcher_pass_callback callback = [](Matcher &m) {
+        return FusedConvCallbacks<FusedConvBackpropData>::sink_activation_to_fused_convolution(m);
+    };
+
+    auto m = std::make_shared<Matcher>(activation, matcher_name);
+    register_matcher(m, callback);
+}
+
 bool ov::nvidia_gpu::pass::CudaConvolutionFusion::run_on_model(const std::shared_ptr<ov::Model>& m) {
     RUN_ON_FUNCTION_SCOPE(CudaConvolutionFusion);
     ov::pass::Manager manager(get_pass_config());
@@ -435,10 +462,11 @@ bool ov::nvidia_gpu::pass::CudaConvolutionFusion::run_on_model(const std::shared
     auto fuse_group_conv_bias_add_activation = manager.register_pass<ov::pass::GraphRewrite>();
     ADD_MATCHER(fuse_group_conv_bias_add_activation, FuseGroupConvolutionWithBiasAdd)
     ADD_MATCHER(fuse_group_conv_bias_add_activation, FuseGroupConvolutionWithBiasAddAdd)
-    // TODO: Activations, should check performance first
+    ADD_MATCHER(fuse_group_conv_bias_add_activation, SinkActivationToFusedGroupConvolution)
     fuse_group_conv_bias_add_activation->set_name("ov::nvidia_gpu::pass::fuse_group_conv_bias_add_activation");
 
     manager.register_pass<CudaFuseConvBackpropDataAdd>();
+    manager.register_pass<SinkActivationToFusedConvBackpropData>();
     manager.register_pass<CudaFuseCleanUpNodesOrder>();
 
     manager.run_passes(m);
@@ -50,6 +50,18 @@ public:
     SinkActivationToFusedConvolution();
 };
 
+class SinkActivationToFusedGroupConvolution : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SinkActivationToFusedGroupConvolution", "0");
+    SinkActivationToFusedGroupConvolution();
+};
+
+class SinkActivationToFusedConvBackpropData : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SinkActivationToFusedConvBackpropData", "0");
+    SinkActivationToFusedConvBackpropData();
+};
+
 class CudaConvolutionFusion : public ov::pass::ModelPass {
 public:
     OPENVINO_RTTI("CudaConvolutionFusion", "0");
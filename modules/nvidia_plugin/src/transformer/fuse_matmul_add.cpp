@@ -10,12 +10,22 @@
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/pass/pattern/op/or.hpp"
 #include <openvino/op/add.hpp>
+#include <openvino/op/gelu.hpp>
 #include <openvino/op/matmul.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/relu.hpp>
 #include <ops/matmul.hpp>
 
 using namespace ov::pass::pattern;
 
+using ov::nvidia_gpu::nodes::ActivationMode;
+using ov::nvidia_gpu::nodes::FullyConnected;
+
 namespace {
+bool is_epilogue_type(const ov::element::Type& type) {
+    return type == ov::element::f32 || type == ov::element::f16 || type == ov::element::bf16;
+}
+
 std::pair<std::shared_ptr<ov::op::v0::MatMul>, std::shared_ptr<ov::op::v0::Constant>> get_matmul_constant_nodes(const std::shared_ptr<ov::Node>& add_node) {
     if (std::dynamic_pointer_cast<ov::op::v0::Constant>(add_node->get_input_node_shared_ptr(1))) {
         return {std::dynamic_pointer_cast<ov::op::v0::MatMul>(add_node->get_input_node_shared_ptr(0)),
@@ -48,17 +58,63 @@ bool is_add_to_be_fused(const ov::Output<ov::Node>& output) {
                                        ov::nvidia_gpu::MatMulOp::GetMatrixNumBatches(matrix_B_shape));
 
     auto const_shape = constant_node->get_output_shape(0);
+    if (const_shape.size() > matrix_shape.size()) {
+        return false;
+    }
     ov::nvidia_gpu::MatMulOp::BroadcastToMatrix(const_shape);
     const auto const_batch = ov::nvidia_gpu::MatMulOp::GetMatrixNumBatches(const_shape);
     const auto const_shape_size = ov::shape_size(const_shape);
     const auto matrix_shape_size = ov::shape_size(matrix_shape);
     const auto num_auto_const_batch = matrix_shape_size / const_shape_size;
     const auto matmul_shape_dividable = matrix_shape_size % const_shape_size;
-    if (matmul_batch < const_batch || matmul_shape_dividable != 0 || num_auto_const_batch > 1) {
+    // Bias vector broadcasted over rows is added by the cuBLASLt epilogue
+    const bool is_bias_vector = !matrix_shape.empty() && const_shape_size == matrix_shape.back() &&
+                                is_epilogue_type(add_node->get_element_type());
+    if (matmul_batch < const_batch || matmul_shape_dividable != 0 || (num_auto_const_batch > 1 && !is_bias_vector)) {
         return false;
     }
     return true;
 }
+
+std::shared_ptr<FullyConnected> get_fully_connected(const ov::Output<ov::Node>& output) {
+    const auto fully_connected = std::dynamic_pointer_cast<FullyConnected>(output.get_node_shared_ptr());
+    if (!fully_connected || fully_connected->is_dynamic() ||
+        fully_connected->get_activation() != ActivationMode::NO_ACTIVATION ||
+        !is_epilogue_type(fully_connected->get_output_element_type(0))) {
+        return nullptr;
+    }
+    return fully_connected;
+}
+
+bool is_scale_to_be_fused(const ov::Output<ov::Node>& output) {
+    const auto multiply = std::dynamic_pointer_cast<ov::op::v1::Multiply>(output.get_node_shared_ptr());
+    if (!multiply || multiply->is_dynamic()) {
+        return false;
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        const auto fully_connected = get_fully_connected(multiply->input_value(i));
+        const auto scale = std::dynamic_pointer_cast<ov::op::v0::Constant>(multiply->get_input_node_shared_ptr(1 - i));
+        if (fully_connected && scale && ov::shape_size(scale->get_output_shape(0)) == 1 &&
+            multiply->get_output_shape(0) == fully_connected->get_output_shape(0) &&
+            ov::is_type<ov::op::v0::Constant>(fully_connected->get_input_node_shared_ptr(2))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool is_activation_to_be_fused(const ov::Output<ov::Node>& output) {
+    const auto& node = output.get_node_shared_ptr();
+    if (const auto gelu = std::dynamic_pointer_cast<ov::op::v7::Gelu>(node)) {
+        // cuBLASLt epilogue computes the tanh approximation of GELU only
+        if (gelu->get_approximation_mode() != ov::op::GeluApproximationMode::TANH) {
+            return false;
+        }
+    } else if (!ov::is_type<ov::op::v0::Relu>(node)) {
+        return false;
+    }
+    return get_fully_connected(node->input_value(0)) != nullptr;
+}
 } // namespace
 
 namespace ov::nvidia_gpu::pass {
@@ -98,4 +154,66 @@ FullyConnectedTransformation::FullyConnectedTransformation() {
     register_matcher(m, callback);
 }
 
+FuseFullyConnectedWithScale::FuseFullyConnectedWithScale() {
+    MATCHER_SCOPE(FuseFullyConnectedWithScale);
+    auto fully_connected = wrap_type<FullyConnected>(consumers_count(1));
+    auto scale = wrap_type<ov::op::v0::Constant>();
+    auto multiply0 = wrap_type<ov::op::v1::Multiply>({fully_connected, scale}, is_scale_to_be_fused);
+    auto multiply1 = wrap_type<ov::op::v1::Multiply>({scale, fully_connected}, is_scale_to_be_fused);
+    auto result = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{multiply0, multiply1});
+
+    matcher_pass_callback callback = [](Matcher &m) {
+        const auto multiply = m.get_match_root();
+        auto fully_connected = std::dynamic_pointer_cast<FullyConnected>(multiply->get_input_node_shared_ptr(0));
+        auto scale = std::dynamic_pointer_cast<ov::op::v0::Constant>(multiply->get_input_node_shared_ptr(1));
+        if (!fully_connected) {
+            fully_connected = std::dynamic_pointer_cast<FullyConnected>(multiply->get_input_node_shared_ptr(1));
+            scale = std::dynamic_pointer_cast<ov::op::v0::Constant>(multiply->get_input_node_shared_ptr(0));
+        }
+        const auto scale_value = scale->cast_vector<float>().front();
+        // scale * (A x B + C) = scale * (A x B) + scale * C, so that the bias is scaled in place
+        const auto bias =
+            std::dynamic_pointer_cast<ov::op::v0::Constant>(fully_connected->get_input_node_shared_ptr(2));
+        auto bias_values = bias->cast_vector<float>();
+        for (auto& value : bias_values) {
+            value *= scale_value;
+        }
+        const auto scaled_bias =
+            ov::op::v0::Constant::create(bias->get_element_type(), bias->get_output_shape(0), bias_values);
+        ov::copy_runtime_info(bias, scaled_bias);
+        fully_connected->input(2).replace_source_output(scaled_bias);
+        fully_connected->set_output_scale(fully_connected->get_output_scale() * scale_value);
+
+        fully_connected->set_friendly_name(multiply->get_friendly_name());
+        ov::copy_runtime_info({fully_connected, multiply}, fully_connected);
+        ov::replace_node(multiply, fully_connected);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(result, matcher_name);
+    register_matcher(m, callback);
+}
+
+SinkActivationToFullyConnected::SinkActivationToFullyConnected() {
+    MATCHER_SCOPE(SinkActivationToFullyConnected);
+    auto fully_connected = wrap_type<FullyConnected>(consumers_count(1));
+    auto activation = wrap_type<ov::op::v0::Relu, ov::op::v7::Gelu>({fully_connected}, is_activation_to_be_fused);
+
+    matcher_pass_callback callback = [](Matcher &m) {
+        const auto activation_node = m.get_match_root();
+        const auto fully_connected =
+            std::dynamic_pointer_cast<FullyConnected>(activation_node->get_input_node_shared_ptr(0));
+        fully_connected->set_activation(ov::is_type<ov::op::v0::Relu>(activation_node) ? ActivationMode::RELU
+                                                                                        : ActivationMode::GELU);
+
+        fully_connected->set_friendly_name(activation_node->get_friendly_name());
+        ov::copy_runtime_info({fully_connected, activation_node}, fully_connected);
+        ov::replace_node(activation_node, fully_connected);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(activation, matcher_name);
+    register_matcher(m, callback);
+}
+
 }  // namespace ov::nvidia_gpu::pass
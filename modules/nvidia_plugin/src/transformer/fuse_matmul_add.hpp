@@ -14,4 +14,22 @@ public:
     FullyConnectedTransformation();
 };
 
+/**
+ * Folds multiplication of FullyConnected by a scalar constant into its output scale and bias
+ */
+class FuseFullyConnectedWithScale : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseFullyConnectedWithScale", "0");
+    FuseFullyConnectedWithScale();
+};
+
+/**
+ * Sinks Relu and tanh approximation of Gelu to FullyConnected, so that they are computed by the cuBLASLt epilogue
+ */
+class SinkActivationToFullyConnected : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SinkActivationToFullyConnected", "0");
+    SinkActivationToFullyConnected();
+};
+
 }  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,192 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "group_norm_fusion.hpp"
+
+#include <vector>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/group_norm.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+/**
+ * @returns true if MVN normalizes [N, G, ...] by all axes but the first two
+ */
+bool is_grouped(const ov::op::v6::MVN& mvn) {
+    const auto axes = std::dynamic_pointer_cast<ov::op::v0::Constant>(mvn.get_input_node_shared_ptr(1));
+    if (!axes) {
+        return false;
+    }
+    const auto rank = static_cast<int64_t>(mvn.get_output_shape(0).size());
+    std::vector<bool> reduced(rank, false);
+    for (auto axis : axes->cast_vector<int64_t>()) {
+        axis = axis < 0 ? axis + rank : axis;
+        if (axis < 2 || axis >= rank) {
+            return false;
+        }
+        reduced[axis] = true;
+    }
+    for (int64_t axis = 2; axis < rank; ++axis) {
+        if (!reduced[axis]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @returns true if the shape broadcasted to the output of the given rank has a value per channel (axis 1)
+ */
+bool is_per_channel(const ov::Shape& shape, size_t rank, size_t channels) {
+    if (shape.size() > rank || ov::shape_size(shape) != channels) {
+        return false;
+    }
+    const size_t offset = rank - shape.size();
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (offset + i != 1 && shape[i] != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @returns The only consumer of the node if it is an operation of the given type, whose other input
+ *          has a value per channel, otherwise nullptr
+ */
+template <typename TOperation>
+std::shared_ptr<TOperation> affine_consumer(const std::shared_ptr<ov::Node>& node, ov::Output<ov::Node>& parameter) {
+    const auto consumers = node->get_output_target_inputs(0);
+    if (consumers.size() != 1) {
+        return nullptr;
+    }
+    const auto consumer = consumers.begin()->get_node();
+    const auto op = std::dynamic_pointer_cast<TOperation>(consumer->shared_from_this());
+    if (!op || op->is_dynamic() || op->get_output_shape(0) != node->get_output_shape(0)) {
+        return nullptr;
+    }
+    const auto other = op->input_value(op->get_input_node_ptr(0) == node.get() ? 1 : 0);
+    if (other.get_node() == node.get()) {
+        return nullptr;
+    }
+    const auto& shape = node->get_output_shape(0);
+    if (!is_per_channel(other.get_shape(), shape.size(), shape[1])) {
+        return nullptr;
+    }
+    parameter = other;
+    return op;
+}
+
+/**
+ * @returns The only consumer of the node if it is Swish with beta 1 (SiLU), otherwise nullptr
+ */
+std::shared_ptr<ov::op::v4::Swish> silu_consumer(const std::shared_ptr<ov::Node>& node) {
+    const auto consumers = node->get_output_target_inputs(0);
+    if (consumers.size() != 1) {
+        return nullptr;
+    }
+    const auto swish = std::dynamic_pointer_cast<ov::op::v4::Swish>(consumers.begin()->get_node()->shared_from_this());
+    if (!swish || swish->is_dynamic()) {
+        return nullptr;
+    }
+    if (swish->get_input_size() > 1) {
+        const auto beta = std::dynamic_pointer_cast<ov::op::v0::Constant>(swish->get_input_node_shared_ptr(1));
+        if (!beta || beta->cast_vector<float>() != std::vector<float>{1.0f}) {
+            return nullptr;
+        }
+    }
+    return swish;
+}
+
+ov::Output<ov::Node> as_vector(const ov::Output<ov::Node>& parameter) {
+    if (parameter.get_shape().size() == 1) {
+        return parameter;
+    }
+    const auto length = ov::shape_size(parameter.get_shape());
+    if (const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(parameter.get_node_shared_ptr())) {
+        return std::make_shared<ov::op::v0::Constant>(*constant, ov::Shape{length});
+    }
+    const auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {static_cast<int64_t>(length)});
+    return std::make_shared<ov::op::v1::Reshape>(parameter, shape, false);
+}
+
+}  // namespace
+
+GroupNormFusion::GroupNormFusion() {
+    MATCHER_SCOPE(GroupNormFusion);
+    auto grouped = wrap_type<ov::op::v1::Reshape>({any_input(), any_input()});
+    auto mvn = wrap_type<ov::op::v6::MVN>({grouped, wrap_type<ov::op::v0::Constant>()});
+    auto ungrouped = wrap_type<ov::op::v1::Reshape>({mvn, any_input()});
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto mvn_node = std::dynamic_pointer_cast<ov::op::v6::MVN>(pattern_map.at(mvn).get_node_shared_ptr());
+        const auto grouped_node = pattern_map.at(grouped).get_node_shared_ptr();
+        const auto ungrouped_node = pattern_map.at(ungrouped).get_node_shared_ptr();
+        if (!mvn_node || mvn_node->is_dynamic() || grouped_node->is_dynamic() || ungrouped_node->is_dynamic() ||
+            !mvn_node->get_normalize_variance() || mvn_node->get_output_target_inputs(0).size() != 1) {
+            return false;
+        }
+        const auto data = grouped_node->input_value(0);
+        const auto& shape = data.get_shape();
+        const auto& grouped_shape = mvn_node->get_output_shape(0);
+        if (shape.size() < 2 || grouped_shape.size() < 3 || ungrouped_node->get_output_shape(0) != shape ||
+            grouped_shape[0] != shape[0] || grouped_shape[1] == 0 || shape[1] % grouped_shape[1] != 0 ||
+            !is_grouped(*mvn_node)) {
+            return false;
+        }
+        const auto& element_type = mvn_node->get_output_element_type(0);
+        if (element_type != ov::element::f32 && element_type != ov::element::f16 && element_type != ov::element::bf16) {
+            return false;
+        }
+        const auto channels = shape[1];
+
+        ov::NodeVector fused{grouped_node, mvn_node, ungrouped_node};
+        std::shared_ptr<ov::Node> last = ungrouped_node;
+        ov::Output<ov::Node> scale = ov::op::v0::Constant::create(element_type, ov::Shape{channels}, {1.0f});
+        ov::Output<ov::Node> bias = ov::op::v0::Constant::create(element_type, ov::Shape{channels}, {0.0f});
+        ov::Output<ov::Node> parameter;
+        if (const auto multiply = affine_consumer<ov::op::v1::Multiply>(last, parameter)) {
+            scale = as_vector(parameter);
+            last = multiply;
+            fused.push_back(multiply);
+        }
+        if (const auto add = affine_consumer<ov::op::v1::Add>(last, parameter)) {
+            bias = as_vector(parameter);
+            last = add;
+            fused.push_back(add);
+        }
+        const auto silu = silu_consumer(last);
+        if (silu) {
+            last = silu;
+            fused.push_back(silu);
+        }
+
+        const bool epsilon_inside_sqrt = mvn_node->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT;
+        const auto group_norm = std::make_shared<nodes::GroupNorm>(
+            data, scale, bias, grouped_shape[1], mvn_node->get_eps(), epsilon_inside_sqrt, silu != nullptr);
+        group_norm->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused, group_norm);
+        ov::replace_node(last, group_norm);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(ungrouped, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
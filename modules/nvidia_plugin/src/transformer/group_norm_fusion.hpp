@@ -0,0 +1,22 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Fuses group normalization decomposed into Reshape of data [N, C, ...] to [N, G, ...], MVN normalizing variance
+ * by all axes but the first two, Reshape back to the shape of data, the following Multiply by scale and Add of bias
+ * (both optional) of a value per channel and the optional Swish (SiLU) into GroupNorm
+ */
+class GroupNormFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("GroupNormFusion", "0");
+    GroupNormFusion();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,120 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "layer_norm_fusion.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/layer_norm.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool is_last_axis(const ov::op::v6::MVN& mvn) {
+    const auto axes = std::dynamic_pointer_cast<ov::op::v0::Constant>(mvn.get_input_node_shared_ptr(1));
+    if (!axes || ov::shape_size(axes->get_output_shape(0)) != 1) {
+        return false;
+    }
+    const auto axis = axes->cast_vector<int64_t>()[0];
+    const auto rank = static_cast<int64_t>(mvn.get_output_shape(0).size());
+    return axis == -1 || axis == rank - 1;
+}
+
+/**
+ * @returns The only consumer of the node if it is an operation of the given type, whose other input
+ *          has a value per element of the last dimension, otherwise nullptr
+ */
+template <typename TOperation>
+std::shared_ptr<TOperation> affine_consumer(const std::shared_ptr<ov::Node>& node, ov::Output<ov::Node>& parameter) {
+    const auto consumers = node->get_output_target_inputs(0);
+    if (consumers.size() != 1) {
+        return nullptr;
+    }
+    const auto consumer = consumers.begin()->get_node();
+    const auto op = std::dynamic_pointer_cast<TOperation>(consumer->shared_from_this());
+    if (!op || op->is_dynamic() || op->get_output_shape(0) != node->get_output_shape(0)) {
+        return nullptr;
+    }
+    const auto other = op->input_value(op->get_input_node_ptr(0) == node.get() ? 1 : 0);
+    if (other.get_node() == node.get()) {
+        return nullptr;
+    }
+    const auto length = node->get_output_shape(0).back();
+    const auto& shape = other.get_shape();
+    if (ov::shape_size(shape) != length || shape.empty() || shape.back() != length) {
+        return nullptr;
+    }
+    parameter = other;
+    return op;
+}
+
+ov::Output<ov::Node> as_vector(const ov::Output<ov::Node>& parameter) {
+    if (parameter.get_shape().size() == 1) {
+        return parameter;
+    }
+    const auto length = parameter.get_shape().back();
+    if (const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(parameter.get_node_shared_ptr())) {
+        return std::make_shared<ov::op::v0::Constant>(*constant, ov::Shape{length});
+    }
+    const auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {static_cast<int64_t>(length)});
+    return std::make_shared<ov::op::v1::Reshape>(parameter, shape, false);
+}
+
+}  // namespace
+
+LayerNormFusion::LayerNormFusion() {
+    MATCHER_SCOPE(LayerNormFusion);
+    auto mvn = wrap_type<ov::op::v6::MVN>({any_input(), wrap_type<ov::op::v0::Constant>()});
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto mvn = std::dynamic_pointer_cast<ov::op::v6::MVN>(m.get_match_root());
+        if (!mvn || mvn->is_dynamic() || !mvn->get_normalize_variance() || mvn->get_output_shape(0).empty() ||
+            !is_last_axis(*mvn)) {
+            return false;
+        }
+        const auto& element_type = mvn->get_output_element_type(0);
+        if (element_type != ov::element::f32 && element_type != ov::element::f16 && element_type != ov::element::bf16) {
+            return false;
+        }
+        const auto length = mvn->get_output_shape(0).back();
+
+        ov::NodeVector fused{mvn};
+        std::shared_ptr<ov::Node> last = mvn;
+        ov::Output<ov::Node> scale = ov::op::v0::Constant::create(element_type, ov::Shape{length}, {1.0f});
+        ov::Output<ov::Node> bias = ov::op::v0::Constant::create(element_type, ov::Shape{length}, {0.0f});
+        ov::Output<ov::Node> parameter;
+        if (const auto multiply = affine_consumer<ov::op::v1::Multiply>(last, parameter)) {
+            scale = as_vector(parameter);
+            last = multiply;
+            fused.push_back(multiply);
+        }
+        if (const auto add = affine_consumer<ov::op::v1::Add>(last, parameter)) {
+            bias = as_vector(parameter);
+            last = add;
+            fused.push_back(add);
+        }
+
+        const bool epsilon_inside_sqrt = mvn->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT;
+        const auto layer_norm = std::make_shared<nodes::LayerNorm>(
+            mvn->input_value(0), scale, bias, mvn->get_eps(), epsilon_inside_sqrt);
+        layer_norm->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused, layer_norm);
+        ov::replace_node(last, layer_norm);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(mvn, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,22 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Fuses MVN normalizing variance by the last axis and the following Multiply by scale and Add of bias
+ * (both optional) of the size of the last dimension into LayerNorm. The decomposed LayerNorm
+ * (ReduceMean, Subtract, Power, Sqrt, Divide) is fused into MVN by ov::pass::MVNFusion beforehand
+ */
+class LayerNormFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("LayerNormFusion", "0");
+    LayerNormFusion();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -8,8 +8,10 @@
 #include <cuda_op_buffers_extractor.hpp>
 #include <exec_graph_info.hpp>
 #include <gsl/span_ext>
+#include <numeric>
 #include "openvino/core/rt_info.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/transpose.hpp"
 
@@ -69,49 +71,38 @@ bool fuse_transpose_with_matmul(Matcher &m) {
         return false;
     }
 
-    auto transpose0 =
-        std::dynamic_pointer_cast<ov::op::v1::Transpose>(matmul->input(0).get_source_output().get_node_shared_ptr());
-    auto transpose1 =
-        std::dynamic_pointer_cast<ov::op::v1::Transpose>(matmul->input(1).get_source_output().get_node_shared_ptr());
+    // Transposes of the last two dimensions of both inputs are folded into flags of the MatMul
+    auto fused_transpose = [](const ov::Output<ov::Node> &input) -> std::shared_ptr<ov::op::v1::Transpose> {
+        auto transpose = std::dynamic_pointer_cast<ov::op::v1::Transpose>(input.get_node_shared_ptr());
+        if (!transpose) {
+            return nullptr;
+        }
+        auto permConstant = std::dynamic_pointer_cast<ov::op::v0::Constant>(
+            transpose->input(1).get_source_output().get_node_shared_ptr());
+        return permConstant && verify_permutation(permConstant) ? transpose : nullptr;
+    };
+    auto transpose0 = fused_transpose(matmul->input_value(0));
+    auto transpose1 = fused_transpose(matmul->input_value(1));
     if (!transpose0 && !transpose1) {
         return false;
     }
 
-    size_t input_idx;
-    std::shared_ptr<ov::op::v1::Transpose> transpose;
-    if (transpose0) {
-        input_idx = 0;
-        transpose = transpose0;
-    } else {
-        input_idx = 1;
-        transpose = transpose1;
-    }
-
-    auto permConstant =
-        std::dynamic_pointer_cast<ov::op::v0::Constant>(transpose->input(1).get_source_output().get_node_shared_ptr());
-    if (!verify_permutation(permConstant)) {
-        return false;
-    }
-
-    Output<Node> a;
-    Output<Node> b;
-    bool transpose_a = matmul->get_transpose_a();
-    bool transpose_b = matmul->get_transpose_b();
-    if (0 == input_idx) {
-        a = transpose->input(0).get_source_output();
-        b = matmul->input(1).get_source_output();
-        transpose_a = !transpose_a;
-    } else {
-        a = matmul->input(0).get_source_output();
-        b = transpose->input(0).get_source_output();
-        transpose_b = !transpose_b;
-    }
+    Output<Node> a = transpose0 ? transpose0->input_value(0) : matmul->input_value(0);
+    Output<Node> b = transpose1 ? transpose1->input_value(0) : matmul->input_value(1);
+    bool transpose_a = matmul->get_transpose_a() != (transpose0 != nullptr);
+    bool transpose_b = matmul->get_transpose_b() != (transpose1 != nullptr);
 
     auto newMatMul = std::make_shared<ov::op::v0::MatMul>(a, b, transpose_a, transpose_b);
 
     newMatMul->set_friendly_name(matmul->get_friendly_name());
 
-    ov::copy_runtime_info({transpose, matmul}, newMatMul);
+    ov::NodeVector fused{matmul};
+    for (const auto &transpose : {transpose0, transpose1}) {
+        if (transpose) {
+            fused.push_back(transpose);
+        }
+    }
+    ov::copy_runtime_info(fused, newMatMul);
     ov::replace_node(matmul, newMatMul);
 
     return true;
@@ -126,4 +117,50 @@ TransposeMatMulTransformation::TransposeMatMulTransformation() {
     register_matcher(m, callback);
 }
 
+bool prepack_matmul_weights(Matcher &m) {
+    auto matmul = std::dynamic_pointer_cast<ov::op::v0::MatMul>(m.get_match_root());
+    if (!matmul || matmul->get_transpose_b() || matmul->is_dynamic()) {
+        return false;
+    }
+    auto weights =
+        std::dynamic_pointer_cast<ov::op::v0::Constant>(matmul->input(1).get_source_output().get_node_shared_ptr());
+    // Shared weights would be duplicated, sub-byte types aren't supported by Transpose
+    if (!weights || weights->get_output_target_inputs(0).size() != 1 ||
+        weights->get_element_type().bitwidth() < 8) {
+        return false;
+    }
+    const auto rank = weights->get_output_shape(0).size();
+    if (rank < 2) {
+        return false;
+    }
+    std::vector<int64_t> order(rank);
+    std::iota(order.begin(), order.end(), 0);
+    std::swap(order[rank - 2], order[rank - 1]);
+    const auto transpose = std::make_shared<ov::op::v1::Transpose>(
+        weights, ov::op::v0::Constant::create(ov::element::i64, ov::Shape{rank}, order));
+    ov::OutputVector transposed(1);
+    if (!transpose->constant_fold(transposed, transpose->input_values())) {
+        return false;
+    }
+    auto packedWeights = transposed[0].get_node_shared_ptr();
+    packedWeights->set_friendly_name(weights->get_friendly_name());
+    ov::copy_runtime_info(weights, packedWeights);
+
+    auto newMatMul = std::make_shared<ov::op::v0::MatMul>(
+        matmul->input(0).get_source_output(), packedWeights, matmul->get_transpose_a(), true);
+    newMatMul->set_friendly_name(matmul->get_friendly_name());
+    ov::copy_runtime_info(matmul, newMatMul);
+    ov::replace_node(matmul, newMatMul);
+    return true;
+}
+
+PrepackMatMulWeightsTransformation::PrepackMatMulWeightsTransformation() {
+    MATCHER_SCOPE(PrepackMatMulWeightsTransformation);
+    auto matmul = wrap_type<ov::op::v0::MatMul>({any_input(), wrap_type<ov::op::v0::Constant>()});
+    matcher_pass_callback callback = [](Matcher &m) { return prepack_matmul_weights(m); };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
 }  // namespace ov::nvidia_gpu::pass
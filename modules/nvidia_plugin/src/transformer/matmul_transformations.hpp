@@ -14,4 +14,14 @@ public:
     TransposeMatMulTransformation();
 };
 
+/**
+ * Transposes constant weights of MatMul with transpose_b=false at compile time, so that both operands of
+ * GEMM are contiguous along the reduction dimension (TN layout of cuBLAS), which is preferred by tensor cores
+ */
+class PrepackMatMulWeightsTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("PrepackMatMulWeightsTransformation", "0");
+    PrepackMatMulWeightsTransformation();
+};
+
 }  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,93 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "mixed_precision_transformation.hpp"
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/exp.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/reduce_l1.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/util/arithmetic_reductions_keep_dims.hpp"
+#include "transformations/rt_info/disable_fp16_compression.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool is_attention_probabilities(const ov::Node& softmax) {
+    const auto consumers = softmax.get_output_target_inputs(0);
+    return consumers.size() == 1 &&
+           ov::is_type<ov::op::v0::MatMul>(consumers.begin()->get_node()) && consumers.begin()->get_index() == 0;
+}
+
+bool is_over_last_axis(const ov::op::v6::MVN& mvn) {
+    const auto axes = std::dynamic_pointer_cast<ov::op::v0::Constant>(mvn.get_input_node_shared_ptr(1));
+    const auto& rank = mvn.get_output_partial_shape(0).rank();
+    if (!axes || ov::shape_size(axes->get_output_shape(0)) != 1 || rank.is_dynamic()) {
+        return false;
+    }
+    const auto axis = axes->cast_vector<int64_t>()[0];
+    return axis == -1 || axis == rank.get_length() - 1;
+}
+
+/**
+ * @returns Whether the reduction sums more than MixedPrecisionTransformation::kLargeReductionSize elements,
+ *          true if the number of reduced elements isn't known
+ */
+bool is_large_reduction(const ov::op::util::ArithmeticReductionKeepDims& reduce) {
+    const auto axes = std::dynamic_pointer_cast<ov::op::v0::Constant>(reduce.get_input_node_shared_ptr(1));
+    const auto& shape = reduce.get_input_partial_shape(0);
+    if (!axes || shape.rank().is_dynamic()) {
+        return true;
+    }
+    const auto rank = shape.rank().get_length();
+    size_t size = 1;
+    for (auto axis : axes->cast_vector<int64_t>()) {
+        const auto& dim = shape[axis < 0 ? axis + rank : axis];
+        if (dim.is_dynamic()) {
+            return true;
+        }
+        size *= dim.get_length();
+    }
+    return size > MixedPrecisionTransformation::kLargeReductionSize;
+}
+
+bool is_precision_sensitive(const ov::Node& node) {
+    if (ov::is_type<ov::op::v0::Exp>(&node) || ov::is_type<ov::op::v5::LogSoftmax>(&node) ||
+        ov::is_type<ov::op::v0::MVN>(&node)) {
+        return true;
+    }
+    if (ov::is_type<ov::op::v1::Softmax>(&node) || ov::is_type<ov::op::v8::Softmax>(&node)) {
+        return !is_attention_probabilities(node);
+    }
+    if (const auto mvn = ov::as_type<const ov::op::v6::MVN>(&node)) {
+        return !is_over_last_axis(*mvn);
+    }
+    if (ov::is_type<ov::op::v1::ReduceSum>(&node) || ov::is_type<ov::op::v4::ReduceL1>(&node)) {
+        return is_large_reduction(*ov::as_type<const ov::op::util::ArithmeticReductionKeepDims>(&node));
+    }
+    return false;
+}
+
+}  // namespace
+
+bool MixedPrecisionTransformation::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    RUN_ON_FUNCTION_SCOPE(MixedPrecisionTransformation);
+    bool marked = false;
+    for (const auto& node : m->get_ordered_ops()) {
+        if (node->get_output_element_type(0) == ov::element::f32 && !ov::fp16_compression_is_disabled(node) &&
+            is_precision_sensitive(*node)) {
+            ov::disable_fp16_compression(node);
+            marked = true;
+        }
+    }
+    return marked;
+}
+
+}  // namespace ov::nvidia_gpu::pass
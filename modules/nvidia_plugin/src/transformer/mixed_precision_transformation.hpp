@@ -0,0 +1,26 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Marks numerically sensitive operations by ov::disable_fp16_compression, so that ov::pass::ConvertPrecision keeps
+ * them in f32 and inserts Converts only on the boundaries of them, while the rest of the model is converted to f16.
+ * The deny-list consists of Exp, LogSoftmax, Softmax (except probabilities of attention, which are fused into
+ * FusedMultiHeadAttention computing them in f32), MVN not over the last axis (MVN over the last axis is fused into
+ * LayerNorm accumulating in f32) and ReduceSum or ReduceL1 of more than kLargeReductionSize elements, whose sums
+ * overflow f16. Operations already marked in rt_info by the user are kept as well
+ */
+class MixedPrecisionTransformation : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("MixedPrecisionTransformation", "0");
+    static constexpr size_t kLargeReductionSize = 1024;
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
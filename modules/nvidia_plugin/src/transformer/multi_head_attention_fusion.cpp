@@ -0,0 +1,191 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "multi_head_attention_fusion.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#include "kernels/flash_attention.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/fused_multi_head_attention.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool has_single_consumer(const std::shared_ptr<ov::Node>& node) {
+    return node->get_output_target_inputs(0).size() == 1;
+}
+
+bool is_matmul(const std::shared_ptr<ov::Node>& node) {
+    return std::dynamic_pointer_cast<ov::op::v0::MatMul>(node) != nullptr;
+}
+
+/**
+ * Scores are the product of queries and keys, optionally scaled, while the mask may be scaled as well
+ * (e.g. (1 - mask) * -10000), so scaling alone doesn't tell scores from the mask
+ */
+bool is_scores(const std::shared_ptr<ov::Node>& node) {
+    if (is_matmul(node)) {
+        return true;
+    }
+    const bool is_scaling =
+        std::dynamic_pointer_cast<ov::op::v1::Multiply>(node) || std::dynamic_pointer_cast<ov::op::v1::Divide>(node);
+    if (!is_scaling) {
+        return false;
+    }
+    const auto& inputs = node->input_values();
+    return std::any_of(
+        inputs.begin(), inputs.end(), [](const auto& input) { return is_matmul(input.get_node_shared_ptr()); });
+}
+
+std::optional<float> scalar_value(const std::shared_ptr<ov::Node>& node) {
+    const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node);
+    if (!constant || ov::shape_size(constant->get_output_shape(0)) != 1) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<float>()[0];
+}
+
+bool is_softmax_by_last_axis(const std::shared_ptr<ov::Node>& node) {
+    const auto rank = static_cast<int64_t>(node->get_output_shape(0).size());
+    if (const auto softmax = std::dynamic_pointer_cast<ov::op::v1::Softmax>(node)) {
+        return static_cast<int64_t>(softmax->get_axis()) == rank - 1;
+    }
+    if (const auto softmax = std::dynamic_pointer_cast<ov::op::v8::Softmax>(node)) {
+        const auto axis = softmax->get_axis();
+        return axis == -1 || axis == rank - 1;
+    }
+    return false;
+}
+
+bool is_broadcastable(const ov::Shape& shape, const ov::Shape& target_shape) {
+    if (shape.size() > target_shape.size()) {
+        return false;
+    }
+    const auto offset = target_shape.size() - shape.size();
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] != 1 && shape[i] != target_shape[offset + i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool fuse_attention(const std::shared_ptr<ov::op::v0::MatMul>& output_matmul) {
+    if (output_matmul->is_dynamic() || output_matmul->get_transpose_a() || output_matmul->get_transpose_b()) {
+        return false;
+    }
+    const auto softmax = output_matmul->get_input_node_shared_ptr(0);
+    if (!is_softmax_by_last_axis(softmax) || !has_single_consumer(softmax)) {
+        return false;
+    }
+
+    ov::NodeVector fused{output_matmul, softmax};
+    auto node = softmax->get_input_node_shared_ptr(0);
+    std::optional<ov::Output<ov::Node>> mask;
+    if (std::dynamic_pointer_cast<ov::op::v1::Add>(node)) {
+        if (!has_single_consumer(node)) {
+            return false;
+        }
+        // The mask is the input which isn't produced by the scaled product of queries and keys
+        const size_t scores_input = is_scores(node->get_input_node_shared_ptr(0)) ? 0 : 1;
+        mask = node->input_value(1 - scores_input);
+        fused.push_back(node);
+        node = node->get_input_node_shared_ptr(scores_input);
+    }
+    float scale = 1.0f;
+    const bool is_divide = std::dynamic_pointer_cast<ov::op::v1::Divide>(node) != nullptr;
+    if (is_divide || std::dynamic_pointer_cast<ov::op::v1::Multiply>(node)) {
+        size_t scores_input = 0;
+        auto value = scalar_value(node->get_input_node_shared_ptr(1));
+        if (!value && !is_divide) {
+            value = scalar_value(node->get_input_node_shared_ptr(0));
+            scores_input = 1;
+        }
+        if (!value || !has_single_consumer(node) || (is_divide && *value == 0.0f)) {
+            return false;
+        }
+        scale = is_divide ? 1.0f / *value : *value;
+        fused.push_back(node);
+        node = node->get_input_node_shared_ptr(scores_input);
+    }
+    const auto scores_matmul = std::dynamic_pointer_cast<ov::op::v0::MatMul>(node);
+    if (!scores_matmul || scores_matmul->get_transpose_a() || !has_single_consumer(scores_matmul)) {
+        return false;
+    }
+    fused.push_back(scores_matmul);
+
+    const auto& q_shape = scores_matmul->get_input_shape(0);
+    const auto& k_shape = scores_matmul->get_input_shape(1);
+    const auto& v_shape = output_matmul->get_input_shape(1);
+    const auto& scores_shape = scores_matmul->get_output_shape(0);
+    const auto rank = q_shape.size();
+    if ((rank != 3 && rank != 4) || k_shape.size() != rank || v_shape.size() != rank) {
+        return false;
+    }
+    // Queries, keys and values are multiplied head by head, and values have the size of heads of queries
+    for (size_t i = 0; i < rank - 2; ++i) {
+        if (k_shape[i] != q_shape[i] || v_shape[i] != q_shape[i]) {
+            return false;
+        }
+    }
+    const auto& element_type = scores_matmul->get_input_element_type(0);
+    if ((element_type != ov::element::f32 && element_type != ov::element::f16 && element_type != ov::element::bf16) ||
+        v_shape[rank - 1] != q_shape[rank - 1] || q_shape[rank - 1] > kernel::FlashAttention::max_head_size) {
+        return false;
+    }
+    if (mask && (mask->get_partial_shape().is_dynamic() || !is_broadcastable(mask->get_shape(), scores_shape))) {
+        return false;
+    }
+
+    std::shared_ptr<nodes::FusedMultiHeadAttention> attention;
+    if (mask) {
+        attention = std::make_shared<nodes::FusedMultiHeadAttention>(scores_matmul->input_value(0),
+                                                                     scores_matmul->input_value(1),
+                                                                     output_matmul->input_value(1),
+                                                                     *mask,
+                                                                     scale,
+                                                                     scores_matmul->get_transpose_b());
+    } else {
+        attention = std::make_shared<nodes::FusedMultiHeadAttention>(scores_matmul->input_value(0),
+                                                                     scores_matmul->input_value(1),
+                                                                     output_matmul->input_value(1),
+                                                                     scale,
+                                                                     scores_matmul->get_transpose_b());
+    }
+    attention->set_friendly_name(output_matmul->get_friendly_name());
+    ov::copy_runtime_info(fused, attention);
+    ov::replace_node(output_matmul, attention);
+    return true;
+}
+
+}  // namespace
+
+MultiHeadAttentionFusion::MultiHeadAttentionFusion() {
+    MATCHER_SCOPE(MultiHeadAttentionFusion);
+    auto softmax = wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax>();
+    auto matmul = wrap_type<ov::op::v0::MatMul>({softmax, any_input()});
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto matmul = std::dynamic_pointer_cast<ov::op::v0::MatMul>(m.get_match_root());
+        return matmul && fuse_attention(matmul);
+    };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
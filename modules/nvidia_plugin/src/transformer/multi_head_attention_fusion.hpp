@@ -0,0 +1,21 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Fuses chains MatMul(Q, K) -> [Multiply or Divide by a scalar] -> [Add(mask)] -> Softmax(last axis) -> MatMul(V)
+ * of attention with static 3D or 4D shapes into FusedMultiHeadAttention
+ */
+class MultiHeadAttentionFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MultiHeadAttentionFusion", "0");
+    MultiHeadAttentionFusion();
+};
+
+}  // namespace ov::nvidia_gpu::pass
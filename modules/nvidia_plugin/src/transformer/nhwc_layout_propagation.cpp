@@ -0,0 +1,347 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "nhwc_layout_propagation.hpp"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "nodes/fused_convolution.hpp"
+#include "nodes/group_norm.hpp"
+#include "nodes/nhwc_reorder.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/elu.hpp"
+#include "openvino/op/exp.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/hsigmoid.hpp"
+#include "openvino/op/hswish.hpp"
+#include "openvino/op/maximum.hpp"
+#include "openvino/op/minimum.hpp"
+#include "openvino/op/mish.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/tanh.hpp"
+#include "openvino/op/transpose.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+using nodes::FusedConvolution;
+
+constexpr size_t kInputIndex = 0;
+constexpr size_t kFilterIndex = 1;
+constexpr size_t kAddIndex = 3;
+
+const std::vector<int64_t> kNhwcToNchwOrder{0, 3, 1, 2};
+const std::vector<int64_t> kNchwToNhwcOrder{0, 2, 3, 1};
+
+bool isNhwcConvolution(const ov::Node& node) {
+    const auto conv = ov::as_type<const FusedConvolution>(&node);
+    if (!conv || conv->is_nhwc_layout() || conv->is_dynamic() || conv->get_output_element_type(0) != ov::element::f16 ||
+        conv->get_output_shape(0).size() != 4) {
+        return false;
+    }
+    const auto filter = ov::as_type_ptr<ov::op::v0::Constant>(conv->get_input_node_shared_ptr(kFilterIndex));
+    return filter && filter->get_output_target_inputs(0).size() == 1;
+}
+
+/**
+ * Element-wise operation computes each output element from input elements with the same index,
+ * so it doesn't depend on the order of elements in memory
+ */
+bool isElementwise(const ov::Node& node) {
+    if (node.is_dynamic() || node.get_output_size() != 1) {
+        return false;
+    }
+    const auto& shape = node.get_output_shape(0);
+    for (const auto& input : node.inputs()) {
+        if (input.get_shape() != shape) {
+            return false;
+        }
+    }
+    if (node.get_input_size() == 1) {
+        return ov::is_type<ov::op::v0::Relu>(&node) || ov::is_type<ov::op::v0::Sigmoid>(&node) ||
+               ov::is_type<ov::op::v0::Tanh>(&node) || ov::is_type<ov::op::v0::Clamp>(&node) ||
+               ov::is_type<ov::op::v0::Elu>(&node) || ov::is_type<ov::op::v0::Exp>(&node) ||
+               ov::is_type<ov::op::v0::Gelu>(&node) || ov::is_type<ov::op::v7::Gelu>(&node) ||
+               ov::is_type<ov::op::v4::Swish>(&node) || ov::is_type<ov::op::v4::Mish>(&node) ||
+               ov::is_type<ov::op::v4::HSwish>(&node) || ov::is_type<ov::op::v5::HSigmoid>(&node);
+    }
+    if (node.get_input_size() == 2) {
+        return ov::is_type<ov::op::v1::Add>(&node) || ov::is_type<ov::op::v1::Multiply>(&node) ||
+               ov::is_type<ov::op::v1::Subtract>(&node) || ov::is_type<ov::op::v1::Divide>(&node) ||
+               ov::is_type<ov::op::v1::Maximum>(&node) || ov::is_type<ov::op::v1::Minimum>(&node);
+    }
+    return false;
+}
+
+/**
+ * GroupNorm computes the layout of its data from the layout flag, so it joins the region of its data
+ */
+bool isNhwcGroupNorm(const ov::Node& node) {
+    const auto groupNorm = ov::as_type<const nodes::GroupNorm>(&node);
+    return groupNorm && !groupNorm->is_nhwc_layout() && !groupNorm->is_dynamic() &&
+           groupNorm->get_output_shape(0).size() == 4;
+}
+
+bool isTranspose(const ov::Node& node, const std::vector<int64_t>& order) {
+    const auto transpose = ov::as_type<const ov::op::v1::Transpose>(&node);
+    if (!transpose || transpose->is_dynamic()) {
+        return false;
+    }
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(transpose->get_input_node_shared_ptr(1));
+    return constant && constant->cast_vector<int64_t>() == order;
+}
+
+/**
+ * Transpose of data in NHWC order to the NCHW shape produces a tensor, which is in NHWC layout in memory already,
+ * so the entry of the region is its input reshaped in place
+ */
+bool isAbsorbedEntry(const ov::Output<ov::Node>& source) {
+    return isTranspose(*source.get_node(), kNhwcToNchwOrder);
+}
+
+/**
+ * Transpose of the NCHW shape to NHWC is the same tensor in memory as the output of the region in NHWC layout
+ */
+bool isAbsorbedExit(const ov::Input<ov::Node>& consumer) {
+    return isTranspose(*consumer.get_node(), kNchwToNhwcOrder);
+}
+
+std::shared_ptr<ov::Node> makeInPlaceReshape(const ov::Output<ov::Node>& input, const ov::Shape& shape) {
+    return std::make_shared<ov::op::v1::Reshape>(
+        input, ov::op::v0::Constant::create(ov::element::i64, ov::Shape{shape.size()}, shape), false);
+}
+
+/**
+ * Inputs of convolution or GroupNorm which are in its layout, inputs of element-wise operations are in the layout
+ * of the region
+ */
+bool isLayoutInput(const ov::Input<ov::Node>& input) {
+    if (ov::is_type<FusedConvolution>(input.get_node())) {
+        return input.get_index() == kInputIndex || input.get_index() == kAddIndex;
+    }
+    if (ov::is_type<nodes::GroupNorm>(input.get_node())) {
+        return input.get_index() == 0;
+    }
+    return true;
+}
+
+/**
+ * Reorders KCRS filter of the convolution to KRSC order
+ */
+void reorderFilter(FusedConvolution& conv) {
+    const auto filter = ov::as_type_ptr<ov::op::v0::Constant>(conv.get_input_node_shared_ptr(kFilterIndex));
+    const auto& shape = filter->get_shape();
+    const size_t k = shape[0];
+    const size_t c = shape[1];
+    const size_t spatial = shape[2] * shape[3];
+    const size_t elementSize = filter->get_element_type().size();
+    const auto src = static_cast<const std::byte*>(filter->get_data_ptr());
+    std::vector<std::byte> dst(filter->get_byte_size());
+    for (size_t ik = 0; ik < k; ++ik) {
+        for (size_t ic = 0; ic < c; ++ic) {
+            for (size_t is = 0; is < spatial; ++is) {
+                std::copy_n(src + ((ik * c + ic) * spatial + is) * elementSize,
+                            elementSize,
+                            dst.data() + ((ik * spatial + is) * c + ic) * elementSize);
+            }
+        }
+    }
+    auto reordered = std::make_shared<ov::op::v0::Constant>(filter->get_element_type(), shape, dst.data());
+    reordered->set_friendly_name(filter->get_friendly_name());
+    ov::copy_runtime_info(filter, reordered);
+    conv.input(kFilterIndex).replace_source_output(reordered);
+}
+
+/**
+ * Region of nodes connected by edges in NHWC layout
+ */
+struct Region {
+    std::vector<ov::Node*> nodes;
+    size_t convolutions = 0;
+};
+
+}  // namespace
+
+bool NhwcLayoutPropagation::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(NhwcLayoutPropagation);
+
+    // Regions are grown in topological order and are merged by element-wise operations (union-find)
+    std::unordered_map<const ov::Node*, size_t> regionOf;
+    std::vector<size_t> parents;
+    auto find = [&](size_t region) {
+        while (parents[region] != region) {
+            region = parents[region] = parents[parents[region]];
+        }
+        return region;
+    };
+    const auto ops = model->get_ordered_ops();
+    for (const auto& op : ops) {
+        const bool isConvolution = isNhwcConvolution(*op);
+        if (isConvolution) {
+            regionOf.emplace(op.get(), parents.size());
+            parents.push_back(parents.size());
+        }
+        std::vector<size_t> inputRegions;
+        for (const auto& input : op->inputs()) {
+            if (!isLayoutInput(input)) {
+                continue;
+            }
+            const auto found = regionOf.find(input.get_source_output().get_node());
+            if (found != regionOf.end()) {
+                inputRegions.push_back(find(found->second));
+            } else if (!isConvolution) {
+                inputRegions.clear();
+                break;
+            }
+        }
+        if (inputRegions.empty() || (!isConvolution && !isElementwise(*op) && !isNhwcGroupNorm(*op))) {
+            continue;
+        }
+        const auto region = isConvolution ? find(regionOf.at(op.get())) : inputRegions.front();
+        for (const auto inputRegion : inputRegions) {
+            parents[inputRegion] = region;
+        }
+        regionOf[op.get()] = region;
+    }
+    if (regionOf.empty()) {
+        return false;
+    }
+
+    std::unordered_map<size_t, Region> regions;
+    for (const auto& op : ops) {
+        const auto found = regionOf.find(op.get());
+        if (found != regionOf.end()) {
+            auto& region = regions[find(found->second)];
+            region.nodes.push_back(op.get());
+            region.convolutions += ov::is_type<FusedConvolution>(op.get());
+        }
+    }
+
+    auto isInRegion = [&](const ov::Node* node, size_t region) {
+        const auto found = regionOf.find(node);
+        return found != regionOf.end() && find(found->second) == region;
+    };
+    auto isConsumedInRegion = [&](const ov::Input<ov::Node>& input, size_t region) {
+        return isInRegion(input.get_node(), region) && isLayoutInput(input);
+    };
+    bool updated = false;
+    for (const auto& idAndRegion : regions) {
+        const auto id = idAndRegion.first;
+        const auto& region = idAndRegion.second;
+        std::set<ov::Output<ov::Node>> entries;
+        std::vector<ov::Output<ov::Node>> exits;
+        std::vector<ov::Input<ov::Node>> absorbedExits;
+        for (const auto node : region.nodes) {
+            if (ov::is_type<FusedConvolution>(node)) {
+                for (const auto& input : node->inputs()) {
+                    const auto source = input.get_source_output();
+                    if (isLayoutInput(input) && !isInRegion(source.get_node(), id)) {
+                        entries.insert(source);
+                    }
+                }
+            }
+            for (const auto& output : node->outputs()) {
+                bool isExit = false;
+                for (const auto& consumer : output.get_target_inputs()) {
+                    if (isConsumedInRegion(consumer, id)) {
+                        continue;
+                    }
+                    if (isAbsorbedExit(consumer)) {
+                        absorbedExits.push_back(consumer);
+                    } else {
+                        isExit = true;
+                    }
+                }
+                if (isExit) {
+                    exits.push_back(output);
+                }
+            }
+        }
+        // Each boundary costs a pass over the tensor, which isn't paid off by a few convolutions
+        const auto numEntries = static_cast<size_t>(std::count_if(
+            entries.begin(), entries.end(), [](const auto& source) { return !isAbsorbedEntry(source); }));
+        if (region.convolutions <= numEntries + exits.size()) {
+            continue;
+        }
+
+        for (const auto& output : exits) {
+            const auto node = output.get_node_shared_ptr();
+            auto reorder = std::make_shared<nodes::NhwcReorder>(output, false);
+            reorder->set_friendly_name(node->get_friendly_name() + "/to_nchw");
+            bool isModelOutput = false;
+            for (auto consumer : output.get_target_inputs()) {
+                if (consumer.get_node() != reorder.get() && !isConsumedInRegion(consumer, id) &&
+                    !isAbsorbedExit(consumer)) {
+                    consumer.replace_source_output(reorder);
+                    isModelOutput |= ov::is_type<ov::op::v0::Result>(consumer.get_node());
+                }
+            }
+            // Names of the tensor in NCHW order, by which outputs of the model are found, are moved to the reorder
+            reorder->output(0).get_tensor().set_names(output.get_names());
+            output.get_tensor().set_names({});
+            if (isModelOutput) {
+                const auto name = node->get_friendly_name();
+                node->set_friendly_name(name + "/nhwc");
+                reorder->set_friendly_name(name);
+                ov::copy_runtime_info(node, reorder);
+            }
+        }
+        for (const auto& consumer : absorbedExits) {
+            const auto transpose = consumer.get_node()->shared_from_this();
+            const auto reshape = makeInPlaceReshape(consumer.get_source_output(), transpose->get_output_shape(0));
+            reshape->set_friendly_name(transpose->get_friendly_name());
+            ov::copy_runtime_info(transpose, reshape);
+            ov::replace_node(transpose, reshape);
+        }
+        std::map<ov::Output<ov::Node>, std::shared_ptr<ov::Node>> reorders;
+        for (const auto node : region.nodes) {
+            if (auto groupNorm = ov::as_type<nodes::GroupNorm>(node)) {
+                groupNorm->set_nhwc_layout(true);
+            }
+            auto conv = ov::as_type<FusedConvolution>(node);
+            if (!conv) {
+                continue;
+            }
+            for (auto& input : conv->inputs()) {
+                const auto source = input.get_source_output();
+                if (!entries.count(source) || !isLayoutInput(input)) {
+                    continue;
+                }
+                auto& reorder = reorders[source];
+                if (!reorder && isAbsorbedEntry(source)) {
+                    reorder = makeInPlaceReshape(source.get_node()->input_value(0), source.get_shape());
+                    reorder->set_friendly_name(source.get_node()->get_friendly_name() + "/nhwc");
+                    ov::copy_runtime_info(source.get_node_shared_ptr(), reorder);
+                } else if (!reorder) {
+                    reorder = std::make_shared<nodes::NhwcReorder>(source, true);
+                    reorder->set_friendly_name(source.get_node()->get_friendly_name() + "/to_nhwc");
+                }
+                input.replace_source_output(reorder);
+            }
+            reorderFilter(*conv);
+            conv->set_nhwc_layout(true);
+        }
+        updated = true;
+    }
+    return updated;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,26 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Assigns NHWC (channels last) layout in memory to regions of FP16 FusedConvolution nodes connected directly or
+ * through element-wise operations and GroupNorm nodes, so that cuDNN convolutions use tensor cores without internal
+ * transposes. Element-wise operations don't depend on the layout, GroupNorm nodes are switched to NHWC layout,
+ * filters of convolutions are reordered at compile time and NhwcReorder nodes are inserted only at the boundaries
+ * of a region. A region is converted only if it has more convolutions than boundaries. Shapes of all nodes stay in
+ * NCHW order. Transposes between NHWC and NCHW shapes at the boundaries are in the layout of the region in memory
+ * already, so they are replaced by in-place Reshapes
+ */
+class NhwcLayoutPropagation : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("NhwcLayoutPropagation", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
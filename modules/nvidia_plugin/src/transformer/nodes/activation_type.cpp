@@ -19,6 +19,7 @@ EnumNames<nvidia_gpu::nodes::ActivationMode>::get() {
          {"clipped_relu", nvidia_gpu::nodes::ActivationMode::CLIPPED_RELU},
          {"elu", nvidia_gpu::nodes::ActivationMode::ELU},
          {"swish", nvidia_gpu::nodes::ActivationMode::SWISH},
+         {"gelu", nvidia_gpu::nodes::ActivationMode::GELU},
          {"no_activation", nvidia_gpu::nodes::ActivationMode::NO_ACTIVATION}});
     return enum_names;
 }
@@ -12,9 +12,10 @@ namespace ov::nvidia_gpu::nodes {
 /**
  * @brief Activation modes for fused convolutions.
  *
- * Mirrors the cuDNN cudnnActivationMode_t enum
+ * Mirrors the cuDNN cudnnActivationMode_t enum. GELU is the tanh approximation which is supported only by
+ * epilogues of cuBLASLt matrix multiplications
  */
-enum class ActivationMode { SIGMOID, RELU, TANH, CLIPPED_RELU, ELU, SWISH, NO_ACTIVATION };
+enum class ActivationMode { SIGMOID, RELU, TANH, CLIPPED_RELU, ELU, SWISH, GELU, NO_ACTIVATION };
 
 }  // namespace ov::nvidia_gpu::nodes
 namespace ov {
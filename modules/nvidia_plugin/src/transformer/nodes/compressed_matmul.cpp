@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compressed_matmul.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+CompressedMatMul::CompressedMatMul(const ov::Output<Node>& A,
+                                   const ov::Output<Node>& weights,
+                                   const ov::Output<Node>& scales,
+                                   const ov::element::Type& weights_type)
+    : ov::op::Op(ov::OutputVector{A, weights, scales}), m_weights_type{weights_type} {
+    constructor_validate_and_infer_types();
+}
+
+CompressedMatMul::CompressedMatMul(const ov::Output<Node>& A,
+                                   const ov::Output<Node>& weights,
+                                   const ov::Output<Node>& scales,
+                                   const ov::Output<Node>& bias,
+                                   const ov::element::Type& weights_type)
+    : ov::op::Op(ov::OutputVector{A, weights, scales, bias}), m_weights_type{weights_type} {
+    constructor_validate_and_infer_types();
+}
+
+bool CompressedMatMul::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("weights_type", m_weights_type);
+    return true;
+}
+
+std::shared_ptr<ov::Node> CompressedMatMul::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    if (new_args.size() == 4) {
+        return std::make_shared<CompressedMatMul>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_weights_type);
+    }
+    check_new_args_count(this, new_args);
+    return std::make_shared<CompressedMatMul>(new_args.at(0), new_args.at(1), new_args.at(2), m_weights_type);
+}
+
+void CompressedMatMul::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          m_weights_type == ov::element::i8 || m_weights_type == ov::element::i4,
+                          "Weights type ",
+                          m_weights_type,
+                          " is not supported");
+    const auto storage_et = m_weights_type == ov::element::i4 ? ov::element::u8 : ov::element::i8;
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == storage_et,
+                          "Weights of type ",
+                          m_weights_type,
+                          " should be stored as ",
+                          storage_et,
+                          " (weights element type: ",
+                          get_input_element_type(1),
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(2) == result_et,
+                          "Scales and activations do not have the same element type (scales element type: ",
+                          get_input_element_type(2),
+                          ", activations element type: ",
+                          result_et,
+                          ").");
+    if (has_bias()) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(3) == result_et,
+                              "Bias and activations do not have the same element type (bias element type: ",
+                              get_input_element_type(3),
+                              ", activations element type: ",
+                              result_et,
+                              ").");
+    }
+
+    const auto& A_partial_shape = get_input_partial_shape(0);
+    const auto& weights_partial_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this, weights_partial_shape.rank().compatible(2), "Weights should be a matrix");
+    if (A_partial_shape.rank().is_dynamic() || weights_partial_shape.rank().is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic());
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, A_partial_shape.rank().get_length() >= 1, "Scalars are not supported as activations");
+    const auto& k = A_partial_shape[A_partial_shape.rank().get_length() - 1];
+    const auto& packed_k = weights_partial_shape[1];
+    if (k.is_static() && packed_k.is_static()) {
+        const auto expected_k = m_weights_type == ov::element::i4 ? (k.get_length() + 1) / 2 : k.get_length();
+        NODE_VALIDATION_CHECK(this,
+                              packed_k.get_length() == expected_k,
+                              "Incompatible dimensions of activations (",
+                              A_partial_shape,
+                              ") and weights (",
+                              weights_partial_shape,
+                              ").");
+    }
+    auto output_shape = A_partial_shape;
+    output_shape[output_shape.rank().get_length() - 1] = weights_partial_shape[0];
+    set_output_type(0, result_et, output_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
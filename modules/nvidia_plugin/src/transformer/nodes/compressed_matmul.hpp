@@ -0,0 +1,52 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * MatMul of activations A [..., K] by weights, which are quantized symmetrically per output channel.
+ * Inputs:
+ *   0: A [..., K] of floating point type
+ *   1: quantized weights [N, K] of i8 type, or [N, (K + 1) / 2] of u8 type with two i4 values per byte
+ *      (the value with even K index in the low nibble) for ov::element::i4 weights type
+ *   2: scales [N] of the type of A
+ *   3 (optional): bias of the output shape added to the result
+ * Output: A [..., N] of the type of A
+ */
+class CompressedMatMul : public ov::op::Op {
+public:
+    OPENVINO_OP("CompressedMatMul", "nvidia_gpu");
+
+    CompressedMatMul() = default;
+    ~CompressedMatMul() = default;
+
+    CompressedMatMul(const ov::Output<Node>& A,
+                     const ov::Output<Node>& weights,
+                     const ov::Output<Node>& scales,
+                     const ov::element::Type& weights_type);
+
+    CompressedMatMul(const ov::Output<Node>& A,
+                     const ov::Output<Node>& weights,
+                     const ov::Output<Node>& scales,
+                     const ov::Output<Node>& bias,
+                     const ov::element::Type& weights_type);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    const ov::element::Type& get_weights_type() const { return m_weights_type; }
+    bool has_bias() const { return get_input_size() == 4; }
+
+private:
+    ov::element::Type m_weights_type;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "concat_convert.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+ConcatConvert::ConcatConvert(const ov::OutputVector& args, int64_t axis, ov::element::Type destination_type)
+    : ov::op::v0::Concat(args, axis), m_destination_type{destination_type} {
+    constructor_validate_and_infer_types();
+}
+
+bool ConcatConvert::visit_attributes(ov::AttributeVisitor& visitor) {
+    ov::op::v0::Concat::visit_attributes(visitor);
+    visitor.on_attribute("destination_type", m_destination_type);
+    return true;
+}
+
+std::shared_ptr<ov::Node> ConcatConvert::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    return std::make_shared<ConcatConvert>(new_args, m_axis, m_destination_type);
+}
+
+void ConcatConvert::validate_and_infer_types() {
+    ov::op::v0::Concat::validate_and_infer_types();
+    NODE_VALIDATION_CHECK(this,
+                          m_destination_type.is_static(),
+                          "Destination type should be static (destination type: ",
+                          m_destination_type,
+                          ").");
+    set_output_type(0, m_destination_type, get_output_partial_shape(0));
+}
+
+}  // namespace ov::nvidia_gpu::nodes
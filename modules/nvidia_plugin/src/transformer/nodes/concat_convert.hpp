@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/concat.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Concat, which converts the concatenated data to destination_type, i.e. Convert(Concat(inputs)).
+ * Inputs and attributes are the same as the ones of Concat
+ * Output: concatenated data of destination_type
+ */
+class ConcatConvert : public ov::op::v0::Concat {
+public:
+    OPENVINO_OP("ConcatConvert", "nvidia_gpu", ov::op::v0::Concat);
+
+    ConcatConvert() = default;
+    ~ConcatConvert() = default;
+
+    ConcatConvert(const ov::OutputVector& args, int64_t axis, ov::element::Type destination_type);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    bool has_evaluate() const override { return false; }
+    bool constant_fold(ov::OutputVector&, const ov::OutputVector&) override { return false; }
+
+    const ov::element::Type& get_destination_type() const { return m_destination_type; }
+
+private:
+    ov::element::Type m_destination_type;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
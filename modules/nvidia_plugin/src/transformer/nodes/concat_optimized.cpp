@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "concat_optimized.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace ov::nvidia_gpu::nodes {
+
+std::optional<ConcatOptimized::StridedSlice> ConcatOptimized::get_strided_slice(
+    const ov::Output<const ov::Node>& output) {
+    const auto consumers = output.get_target_inputs();
+    if (consumers.size() != 1) {
+        return std::nullopt;
+    }
+    const auto concat = ov::as_type<const ConcatOptimized>(consumers.begin()->get_node());
+    if (!concat) {
+        return std::nullopt;
+    }
+    const auto& outputShape = concat->get_output_shape(0);
+    const auto axis = static_cast<size_t>(concat->get_axis() < 0 ? concat->get_axis() + outputShape.size()
+                                                                  : concat->get_axis());
+    const size_t sizeAboveAxis =
+        std::accumulate(outputShape.begin(), outputShape.begin() + axis, size_t{1}, std::multiplies<size_t>());
+    if (sizeAboveAxis == 1) {
+        return std::nullopt;
+    }
+    const size_t sizeBelowAxis =
+        std::accumulate(outputShape.begin() + axis + 1, outputShape.end(), size_t{1}, std::multiplies<size_t>());
+    return StridedSlice{output.get_shape()[axis] * sizeBelowAxis, outputShape[axis] * sizeBelowAxis};
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -5,9 +5,14 @@
 #pragma once
 
 #include <openvino/op/concat.hpp>
+#include <optional>
 
 namespace ov::nvidia_gpu::nodes {
 
+/**
+ * Concat, whose inputs are written by their producers directly into the output buffer. If the axis isn't
+ * the outermost non-unit dimension, every input occupies a strided slice of the output
+ */
 class ConcatOptimized : public ov::op::v0::Concat {
 public:
     using ov::op::v0::Concat::Concat;
@@ -17,5 +22,20 @@ public:
     std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
         return std::make_shared<ConcatOptimized>(new_args, m_axis);
     }
+
+    /**
+     * Slice of the output of ConcatOptimized: contiguous blocks of block_size elements, which are stride
+     * elements apart
+     */
+    struct StridedSlice {
+        size_t block_size;
+        size_t stride;
+    };
+
+    /**
+     * @returns Slice, which the output should be written to, if its only consumer is ConcatOptimized with
+     * a strided layout of inputs
+     */
+    static std::optional<StridedSlice> get_strided_slice(const ov::Output<const ov::Node>& output);
 };
 }  // namespace ov::nvidia_gpu::nodes
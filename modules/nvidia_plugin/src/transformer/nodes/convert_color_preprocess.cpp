@@ -0,0 +1,70 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_color_preprocess.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+ConvertColorPreprocess::ConvertColorPreprocess(const ov::OutputVector& planes, const Attributes& attrs)
+    : ov::op::Op(planes), m_attrs{attrs} {
+    constructor_validate_and_infer_types();
+}
+
+bool ConvertColorPreprocess::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("i420", m_attrs.i420);
+    visitor.on_attribute("bgr", m_attrs.bgr);
+    visitor.on_attribute("round", m_attrs.round);
+    visitor.on_attribute("nchw", m_attrs.nchw);
+    visitor.on_attribute("height", m_attrs.height);
+    visitor.on_attribute("width", m_attrs.width);
+    visitor.on_attribute("source_coordinates", m_attrs.source_coordinates);
+    visitor.on_attribute("scale", m_attrs.scale);
+    visitor.on_attribute("shift", m_attrs.shift);
+    visitor.on_attribute("destination_type", m_attrs.destination_type);
+    return true;
+}
+
+std::shared_ptr<ov::Node> ConvertColorPreprocess::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    return std::make_shared<ConvertColorPreprocess>(new_args, m_attrs);
+}
+
+size_t ConvertColorPreprocess::get_image_height() const {
+    const auto height = get_input_shape(0)[1];
+    return get_input_size() == 1 ? height * 2 / 3 : height;
+}
+
+void ConvertColorPreprocess::validate_and_infer_types() {
+    const size_t num_planes = m_attrs.i420 ? 3 : 2;
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == 1 || get_input_size() == num_planes,
+                          "Expected 1 or ",
+                          num_planes,
+                          " planes, got ",
+                          get_input_size());
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == get_input_element_type(0),
+                              "Planes should have the same element type");
+    }
+    NODE_VALIDATION_CHECK(this,
+                          m_attrs.destination_type.is_static() && m_attrs.destination_type.is_real(),
+                          "Destination type should be a floating point type (destination type: ",
+                          m_attrs.destination_type,
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          m_attrs.source_coordinates.size() == 4 && m_attrs.scale.size() == 3 &&
+                              m_attrs.shift.size() == 3,
+                          "Expected 4 source coordinate coefficients and 3 scale and shift values");
+    NODE_VALIDATION_CHECK(this, m_attrs.height > 0 && m_attrs.width > 0, "Output size should be positive");
+    const auto& shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.rank().compatible(4), "Planes should be 4D (shape: ", shape, ").");
+    const auto batch = shape.rank().is_static() ? shape[0] : ov::Dimension::dynamic();
+    const ov::Dimension height{m_attrs.height};
+    const ov::Dimension width{m_attrs.width};
+    const auto output_shape =
+        m_attrs.nchw ? ov::PartialShape{batch, 3, height, width} : ov::PartialShape{batch, height, width, 3};
+    set_output_type(0, m_attrs.destination_type, output_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * NV12 or I420 to RGB (or BGR) conversion followed by the bilinear resize, the per-channel affine transform
+ * y = x * scale[c] + shift[c] and optionally the NHWC -> NCHW transpose of the result, i.e. the fused
+ * preprocessing chain of camera images.
+ * Inputs are the ones of NV12toRGB or I420toRGB, i.e. a single plane [N, H * 3 / 2, W, 1] or separate planes.
+ * Attributes:
+ *   height, width: size of the output image;
+ *   source_coordinates: {scale_y, offset_y, scale_x, offset_x}, source coordinates of output pixels are
+ *                       out * scale + offset;
+ *   round: RGB values are rounded to integers before they are resized, as the integer color conversion does.
+ * Output: [N, height, width, 3] or [N, 3, height, width] of destination_type
+ */
+class ConvertColorPreprocess : public ov::op::Op {
+public:
+    OPENVINO_OP("ConvertColorPreprocess", "nvidia_gpu");
+
+    struct Attributes {
+        bool i420 = false;
+        bool bgr = false;
+        bool round = false;
+        bool nchw = false;
+        int64_t height = 0;
+        int64_t width = 0;
+        std::vector<float> source_coordinates{1.0f, 0.0f, 1.0f, 0.0f};
+        std::vector<float> scale{1.0f, 1.0f, 1.0f};
+        std::vector<float> shift{0.0f, 0.0f, 0.0f};
+        ov::element::Type destination_type;
+    };
+
+    ConvertColorPreprocess() = default;
+    ~ConvertColorPreprocess() = default;
+
+    ConvertColorPreprocess(const ov::OutputVector& planes, const Attributes& attrs);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    const Attributes& get_attrs() const { return m_attrs; }
+
+    /**
+     * @returns Height of the source image
+     */
+    size_t get_image_height() const;
+
+private:
+    Attributes m_attrs;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
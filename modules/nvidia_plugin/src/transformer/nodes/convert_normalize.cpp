@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_normalize.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+ConvertNormalize::ConvertNormalize(const ov::Output<Node>& data,
+                                   const ov::Output<Node>& scale,
+                                   const ov::Output<Node>& shift,
+                                   int64_t axis,
+                                   ov::element::Type destination_type)
+    : ov::op::Op(ov::OutputVector{data, scale, shift}), m_axis{axis}, m_destination_type{destination_type} {
+    constructor_validate_and_infer_types();
+}
+
+bool ConvertNormalize::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("axis", m_axis);
+    visitor.on_attribute("destination_type", m_destination_type);
+    return true;
+}
+
+std::shared_ptr<ov::Node> ConvertNormalize::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<ConvertNormalize>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_axis, m_destination_type);
+}
+
+void ConvertNormalize::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this,
+                          m_destination_type.is_static() && m_destination_type.is_real(),
+                          "Destination type should be a floating point type (destination type: ",
+                          m_destination_type,
+                          ").");
+    const auto& data_shape = get_input_partial_shape(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == ov::element::f32,
+                              "Input ",
+                              i,
+                              " should be of f32 type (input element type: ",
+                              get_input_element_type(i),
+                              ").");
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).rank().compatible(1),
+                              "Input ",
+                              i,
+                              " should be a vector (input shape: ",
+                              get_input_partial_shape(i),
+                              ").");
+    }
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(1).compatible(get_input_partial_shape(2)),
+                          "Scale and shift should have the same shape (scale shape: ",
+                          get_input_partial_shape(1),
+                          ", shift shape: ",
+                          get_input_partial_shape(2),
+                          ").");
+    if (data_shape.rank().is_static()) {
+        const auto rank = data_shape.rank().get_length();
+        NODE_VALIDATION_CHECK(this,
+                              (rank == 0 && m_axis == 0) || (m_axis >= 0 && m_axis < rank),
+                              "Axis ",
+                              m_axis,
+                              " is out of the range of data rank ",
+                              rank);
+        const auto& channels = get_input_partial_shape(1);
+        if (rank > 0 && channels.is_static() && channels[0] != 1) {
+            NODE_VALIDATION_CHECK(this,
+                                  data_shape[m_axis].compatible(channels[0]),
+                                  "Scale should have 1 or as many values as the axis dimension of data (scale shape: ",
+                                  channels,
+                                  ", data shape: ",
+                                  data_shape,
+                                  ").");
+        }
+    }
+    set_output_type(0, m_destination_type, data_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
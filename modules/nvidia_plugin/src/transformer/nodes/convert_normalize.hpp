@@ -0,0 +1,49 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Convert of data to destination_type followed by the per-channel affine transform of preprocessing, i.e.
+ * the folded chain Convert -> Subtract(mean) -> Multiply(scale):
+ *   y = float(x) * scale[c] + shift[c]
+ * where c is the index of the element along axis.
+ * Inputs:
+ *   0: data of any integer or floating point type
+ *   1: scale [C] of f32, where C is 1 or the size of the axis dimension of data
+ *   2: shift [C] of f32
+ * Output: transformed data of the shape of data and of destination_type
+ */
+class ConvertNormalize : public ov::op::Op {
+public:
+    OPENVINO_OP("ConvertNormalize", "nvidia_gpu");
+
+    ConvertNormalize() = default;
+    ~ConvertNormalize() = default;
+
+    ConvertNormalize(const ov::Output<Node>& data,
+                     const ov::Output<Node>& scale,
+                     const ov::Output<Node>& shift,
+                     int64_t axis,
+                     ov::element::Type destination_type);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    int64_t get_axis() const { return m_axis; }
+    const ov::element::Type& get_destination_type() const { return m_destination_type; }
+
+private:
+    int64_t m_axis = 0;
+    ov::element::Type m_destination_type;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "depthwise_convolution_max_pool.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+DepthwiseConvolutionMaxPool::DepthwiseConvolutionMaxPool(const ov::Output<Node>& data,
+                                                         const ov::Output<Node>& filter,
+                                                         const ov::Output<Node>& bias,
+                                                         const ov::Strides& strides,
+                                                         const ov::CoordinateDiff& pads_begin,
+                                                         const ov::CoordinateDiff& pads_end,
+                                                         const ov::Strides& dilations,
+                                                         ActivationMode activation,
+                                                         size_t pool_size)
+    : ov::op::Op(ov::OutputVector{data, filter, bias}),
+      m_strides{strides},
+      m_pads_begin{pads_begin},
+      m_pads_end{pads_end},
+      m_dilations{dilations},
+      m_activation{activation},
+      m_pool_size{pool_size} {
+    constructor_validate_and_infer_types();
+}
+
+bool DepthwiseConvolutionMaxPool::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("strides", m_strides);
+    visitor.on_attribute("pads_begin", m_pads_begin);
+    visitor.on_attribute("pads_end", m_pads_end);
+    visitor.on_attribute("dilations", m_dilations);
+    visitor.on_attribute("activation", m_activation);
+    visitor.on_attribute("pool_size", m_pool_size);
+    return true;
+}
+
+std::shared_ptr<ov::Node> DepthwiseConvolutionMaxPool::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<DepthwiseConvolutionMaxPool>(new_args.at(0),
+                                                         new_args.at(1),
+                                                         new_args.at(2),
+                                                         m_strides,
+                                                         m_pads_begin,
+                                                         m_pads_end,
+                                                         m_dilations,
+                                                         m_activation,
+                                                         m_pool_size);
+}
+
+ov::Shape DepthwiseConvolutionMaxPool::get_convolution_output_shape() const {
+    const auto& data_shape = get_input_shape(0);
+    const auto& filter_shape = get_input_shape(1);
+    ov::Shape shape{data_shape[0], data_shape[1]};
+    for (size_t i = 0; i < 2; ++i) {
+        const auto padded = static_cast<int64_t>(data_shape[i + 2]) + m_pads_begin[i] + m_pads_end[i];
+        const auto window = static_cast<int64_t>(m_dilations[i] * (filter_shape[i + 3] - 1) + 1);
+        shape.push_back(padded < window ? 0 : static_cast<size_t>((padded - window) / m_strides[i] + 1));
+    }
+    return shape;
+}
+
+void DepthwiseConvolutionMaxPool::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == result_et,
+                              "Input ",
+                              i,
+                              " and data do not have the same element type (input element type: ",
+                              get_input_element_type(i),
+                              ", data element type: ",
+                              result_et,
+                              ").");
+    }
+    NODE_VALIDATION_CHECK(this, m_pool_size > 0, "Pool size should be positive");
+    NODE_VALIDATION_CHECK(this,
+                          m_strides.size() == 2 && m_dilations.size() == 2 && m_pads_begin.size() == 2 &&
+                              m_pads_end.size() == 2,
+                          "Only 2D convolutions are supported");
+    if (get_input_partial_shape(0).is_dynamic() || get_input_partial_shape(1).is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic(4));
+        return;
+    }
+    const auto& data_shape = get_input_shape(0);
+    const auto& filter_shape = get_input_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          data_shape.size() == 4 && filter_shape.size() == 5 && filter_shape[0] == data_shape[1] &&
+                              filter_shape[1] == 1 && filter_shape[2] == 1,
+                          "Filter should be depthwise (data shape: ",
+                          data_shape,
+                          ", filter shape: ",
+                          filter_shape,
+                          ").");
+    auto shape = get_convolution_output_shape();
+    shape[2] /= m_pool_size;
+    shape[3] /= m_pool_size;
+    set_output_type(0, result_et, shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
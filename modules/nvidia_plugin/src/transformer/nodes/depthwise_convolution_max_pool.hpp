@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "activation_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Depthwise FusedGroupConvolution without addition followed by max pooling of its activated outputs by
+ * non-overlapping pool_size x pool_size windows, partial windows are dropped
+ * Inputs:
+ *   0: data [N, C, H, W] of floating point type
+ *   1: filter [C, 1, 1, K, K] of the type of data
+ *   2: bias of C elements in the shape of the bias of FusedGroupConvolution, of the type of data
+ * Output: [N, C, OH / pool_size, OW / pool_size] of the type of data, where OH x OW is the output of the convolution
+ */
+class DepthwiseConvolutionMaxPool : public ov::op::Op {
+public:
+    OPENVINO_OP("DepthwiseConvolutionMaxPool", "nvidia_gpu");
+
+    DepthwiseConvolutionMaxPool() = default;
+    ~DepthwiseConvolutionMaxPool() = default;
+
+    DepthwiseConvolutionMaxPool(const ov::Output<Node>& data,
+                                const ov::Output<Node>& filter,
+                                const ov::Output<Node>& bias,
+                                const ov::Strides& strides,
+                                const ov::CoordinateDiff& pads_begin,
+                                const ov::CoordinateDiff& pads_end,
+                                const ov::Strides& dilations,
+                                ActivationMode activation,
+                                size_t pool_size);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    const ov::Strides& get_strides() const { return m_strides; }
+    const ov::CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
+    const ov::CoordinateDiff& get_pads_end() const { return m_pads_end; }
+    const ov::Strides& get_dilations() const { return m_dilations; }
+    ActivationMode get_activation() const { return m_activation; }
+    size_t get_pool_size() const { return m_pool_size; }
+
+    /**
+     * @returns Output shape of the convolution before pooling
+     */
+    ov::Shape get_convolution_output_shape() const;
+
+private:
+    ov::Strides m_strides;
+    ov::CoordinateDiff m_pads_begin;
+    ov::CoordinateDiff m_pads_end;
+    ov::Strides m_dilations;
+    ActivationMode m_activation = ActivationMode::NO_ACTIVATION;
+    size_t m_pool_size = 1;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,78 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fp8_matmul.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+Fp8MatMul::Fp8MatMul(const ov::Output<Node>& A, const ov::Output<Node>& weights, const ov::Output<Node>& scale)
+    : ov::op::Op(ov::OutputVector{A, weights, scale}) {
+    constructor_validate_and_infer_types();
+}
+
+Fp8MatMul::Fp8MatMul(const ov::Output<Node>& A,
+                     const ov::Output<Node>& weights,
+                     const ov::Output<Node>& scale,
+                     const ov::Output<Node>& bias)
+    : ov::op::Op(ov::OutputVector{A, weights, scale, bias}) {
+    constructor_validate_and_infer_types();
+}
+
+bool Fp8MatMul::visit_attributes(ov::AttributeVisitor& visitor) { return true; }
+
+std::shared_ptr<ov::Node> Fp8MatMul::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    if (new_args.size() == 4) {
+        return std::make_shared<Fp8MatMul>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3));
+    }
+    check_new_args_count(this, new_args);
+    return std::make_shared<Fp8MatMul>(new_args.at(0), new_args.at(1), new_args.at(2));
+}
+
+void Fp8MatMul::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == ov::element::u8,
+                          "Weights should contain bits of E4M3 values in u8 type (weights element type: ",
+                          get_input_element_type(1),
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(2) == ov::element::f32 &&
+                              get_input_partial_shape(2).compatible(ov::PartialShape{1}),
+                          "Scale should be a single value of f32 type (scale element type: ",
+                          get_input_element_type(2),
+                          ", scale shape: ",
+                          get_input_partial_shape(2),
+                          ").");
+    if (has_bias()) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(3) == result_et,
+                              "Bias and activations do not have the same element type (bias element type: ",
+                              get_input_element_type(3),
+                              ", activations element type: ",
+                              result_et,
+                              ").");
+    }
+
+    const auto& A_partial_shape = get_input_partial_shape(0);
+    const auto& weights_partial_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this, weights_partial_shape.rank().compatible(2), "Weights should be a matrix");
+    if (A_partial_shape.rank().is_dynamic() || weights_partial_shape.rank().is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic());
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, A_partial_shape.rank().get_length() >= 1, "Scalars are not supported as activations");
+    const auto& k = A_partial_shape[A_partial_shape.rank().get_length() - 1];
+    NODE_VALIDATION_CHECK(this,
+                          k.compatible(weights_partial_shape[1]),
+                          "Incompatible dimensions of activations (",
+                          A_partial_shape,
+                          ") and weights (",
+                          weights_partial_shape,
+                          ").");
+    auto output_shape = A_partial_shape;
+    output_shape[output_shape.rank().get_length() - 1] = weights_partial_shape[0];
+    set_output_type(0, result_et, output_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,44 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * MatMul of activations A [..., K] by weights stored in FP8 (E4M3) with a per-tensor scale. Activations are
+ * converted to FP8 with a per-tensor scale computed from their maximal absolute value on execution.
+ * Inputs:
+ *   0: A [..., K] of floating point type
+ *   1: weights [N, K] of u8 type, which contains bits of E4M3 values
+ *   2: scale [1] of f32 type, which weights are multiplied by to restore them
+ *   3 (optional): bias of the output shape added to the result
+ * Output: A [..., N] of the type of A
+ */
+class Fp8MatMul : public ov::op::Op {
+public:
+    OPENVINO_OP("Fp8MatMul", "nvidia_gpu");
+
+    Fp8MatMul() = default;
+    ~Fp8MatMul() = default;
+
+    Fp8MatMul(const ov::Output<Node>& A, const ov::Output<Node>& weights, const ov::Output<Node>& scale);
+
+    Fp8MatMul(const ov::Output<Node>& A,
+              const ov::Output<Node>& weights,
+              const ov::Output<Node>& scale,
+              const ov::Output<Node>& bias);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    bool has_bias() const { return get_input_size() == 4; }
+};
+
+}  // namespace ov::nvidia_gpu::nodes
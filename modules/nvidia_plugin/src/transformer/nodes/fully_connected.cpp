@@ -18,21 +18,29 @@ FullyConnected::FullyConnected(const ov::Output<Node>& A,
                                const ov::Output<Node>& B,
                                const ov::Output<Node>& C,
                                const bool& transpose_a,
-                               const bool& transpose_b)
-    : ov::op::Op(ov::OutputVector{A, B, C}), m_transpose_a{transpose_a}, m_transpose_b{transpose_b} {
+                               const bool& transpose_b,
+                               ActivationMode activation,
+                               float output_scale)
+    : ov::op::Op(ov::OutputVector{A, B, C}),
+      m_transpose_a{transpose_a},
+      m_transpose_b{transpose_b},
+      m_activation{activation},
+      m_output_scale{output_scale} {
     constructor_validate_and_infer_types();
 }
 
 bool FullyConnected::visit_attributes(ov::AttributeVisitor& visitor) {
     visitor.on_attribute("transpose_a", m_transpose_a);
     visitor.on_attribute("transpose_b", m_transpose_b);
+    visitor.on_attribute("activation", m_activation);
+    visitor.on_attribute("output_scale", m_output_scale);
     return true;
 }
 
 std::shared_ptr<ov::Node> FullyConnected::clone_with_new_inputs(const ov::OutputVector& new_args) const {
     check_new_args_count(this, new_args);
     return std::make_shared<FullyConnected>(
-        new_args.at(0), new_args.at(1), new_args.at(2), m_transpose_a, m_transpose_b);
+        new_args.at(0), new_args.at(1), new_args.at(2), m_transpose_a, m_transpose_b, m_activation, m_output_scale);
 }
 
 void FullyConnected::validate_and_infer_types() {
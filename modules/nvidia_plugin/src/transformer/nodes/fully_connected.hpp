@@ -6,10 +6,15 @@
 
 #include <array>
 
+#include "activation_type.hpp"
 #include "openvino/op/op.hpp"
 
 namespace ov::nvidia_gpu::nodes {
 
+/**
+ * Computes activation(output_scale * (A x B) + C), where the scale and the activation are fused into the
+ * epilogue of cuBLASLt matrix multiplication
+ */
 class FullyConnected : public ov::op::Op {
 public:
     OPENVINO_OP("FullyConnected", "nvidia_gpu");
@@ -21,7 +26,9 @@ public:
                    const ov::Output<Node>& B,
                    const ov::Output<Node>& C,
                    const bool& transpose_a,
-                   const bool& transpose_b);
+                   const bool& transpose_b,
+                   ActivationMode activation = ActivationMode::NO_ACTIVATION,
+                   float output_scale = 1.0f);
 
     bool visit_attributes(ov::AttributeVisitor& visitor) override;
 
@@ -32,9 +39,17 @@ public:
     bool get_transpose_a() const { return m_transpose_a; }
     bool get_transpose_b() const { return m_transpose_b; }
 
+    void set_activation(ActivationMode mode) { m_activation = mode; }
+    ActivationMode get_activation() const { return m_activation; }
+
+    void set_output_scale(float scale) { m_output_scale = scale; }
+    float get_output_scale() const { return m_output_scale; }
+
 private:
     bool m_transpose_a;
     bool m_transpose_b;
+    ActivationMode m_activation = ActivationMode::NO_ACTIVATION;
+    float m_output_scale = 1.0f;
 };
 
 }  // namespace ov::nvidia_gpu::nodes
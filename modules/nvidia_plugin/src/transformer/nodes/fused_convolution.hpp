@@ -73,8 +73,9 @@ public:
 
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
         ov::check_new_args_count(this, new_args);
+        std::shared_ptr<BasicFusedConvolution<TBaseConvolution>> clone;
         if (new_args.size() == 3) {
-            return std::make_shared<BasicFusedConvolution<TBaseConvolution>>(new_args.at(0),
+            clone = std::make_shared<BasicFusedConvolution<TBaseConvolution>>(new_args.at(0),
                                                                              new_args.at(1),
                                                                              new_args.at(2),
                                                                              TBaseConvolution::m_strides,
@@ -84,7 +85,7 @@ public:
                                                                              TBaseConvolution::m_auto_pad,
                                                                              activation_);
         } else {
-            return std::make_shared<BasicFusedConvolution<TBaseConvolution>>(new_args.at(0),
+            clone = std::make_shared<BasicFusedConvolution<TBaseConvolution>>(new_args.at(0),
                                                                              new_args.at(1),
                                                                              new_args.at(2),
                                                                              new_args.at(3),
@@ -95,11 +96,14 @@ public:
                                                                              TBaseConvolution::m_auto_pad,
                                                                              activation_);
         }
+        clone->set_nhwc_layout(nhwc_layout_);
+        return clone;
     }
 
     bool visit_attributes(AttributeVisitor& visitor) override {
         TBaseConvolution::visit_attributes(visitor);
         visitor.on_attribute("activation", activation_);
+        visitor.on_attribute("nhwc_layout", nhwc_layout_);
         return true;
     }
 
@@ -131,8 +135,17 @@ public:
 
     ActivationMode get_activation() const { return activation_; }
 
+    /**
+     * Shapes of the node are in NCHW order, but its input, filter, add and output tensors are stored
+     * in NHWC (channels last) order in memory, see NhwcLayoutPropagation
+     */
+    void set_nhwc_layout(bool nhwc_layout) { nhwc_layout_ = nhwc_layout; }
+
+    bool is_nhwc_layout() const { return nhwc_layout_; }
+
 private:
     ActivationMode activation_;
+    bool nhwc_layout_ = false;
 };  // class TBaseConvolution
 
 using FusedConvolution = BasicFusedConvolution<ov::op::v1::Convolution>;
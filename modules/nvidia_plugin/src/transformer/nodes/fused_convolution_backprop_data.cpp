@@ -17,14 +17,16 @@ FusedConvBackpropData::FusedConvBackpropData(const ov::Output<Node>& data_batch,
                                              const ov::CoordinateDiff& pads_end,
                                              const ov::Strides& dilations,
                                              const ov::op::PadType& auto_pad,
-                                             const ov::CoordinateDiff& output_padding)
+                                             const ov::CoordinateDiff& output_padding,
+                                             ActivationMode activation)
     : ov::op::Op(ov::OutputVector{data_batch, filters, add}),
       strides_(strides),
       pads_begin_(pads_begin),
       pads_end_(pads_end),
       dilations_(dilations),
       auto_pad_(auto_pad),
-      output_padding_(output_padding) {
+      output_padding_(output_padding),
+      activation_(activation) {
     constructor_validate_and_infer_types();
 }
 
@@ -37,14 +39,16 @@ FusedConvBackpropData::FusedConvBackpropData(const ov::Output<Node>& data_batch,
                                              const ov::CoordinateDiff& pads_end,
                                              const ov::Strides& dilations,
                                              const ov::op::PadType& auto_pad,
-                                             const ov::CoordinateDiff& output_padding)
+                                             const ov::CoordinateDiff& output_padding,
+                                             ActivationMode activation)
     : ov::op::Op(ov::OutputVector{data_batch, filters, outputShape, add}),
       strides_(strides),
       pads_begin_(pads_begin),
       pads_end_(pads_end),
       dilations_(dilations),
       auto_pad_(auto_pad),
-      output_padding_(output_padding) {
+      output_padding_(output_padding),
+      activation_(activation) {
     constructor_validate_and_infer_types();
 }
 
@@ -55,6 +59,7 @@ bool FusedConvBackpropData::visit_attributes(ov::AttributeVisitor& visitor) {
     visitor.on_attribute("pads_end", pads_end_);
     visitor.on_attribute("auto_pad", auto_pad_);
     visitor.on_attribute("output_padding", output_padding_);
+    visitor.on_attribute("activation", activation_);
     return true;
 }
 
@@ -69,7 +74,8 @@ std::shared_ptr<ov::Node> FusedConvBackpropData::clone_with_new_inputs(const ov:
                                                        pads_end_,
                                                        dilations_,
                                                        auto_pad_,
-                                                       output_padding_);
+                                                       output_padding_,
+                                                       activation_);
     } else {
         return std::make_shared<FusedConvBackpropData>(new_args.at(0),
                                                        new_args.at(1),
@@ -80,7 +86,8 @@ std::shared_ptr<ov::Node> FusedConvBackpropData::clone_with_new_inputs(const ov:
                                                        pads_end_,
                                                        dilations_,
                                                        auto_pad_,
-                                                       output_padding_);
+                                                       output_padding_,
+                                                       activation_);
     }
 }
 
@@ -27,7 +27,8 @@ public:
                                    const ov::CoordinateDiff& pads_end,
                                    const ov::Strides& dilations,
                                    const ov::op::PadType& auto_pad,
-                                   const ov::CoordinateDiff& output_padding);
+                                   const ov::CoordinateDiff& output_padding,
+                                   ActivationMode activation = ActivationMode::NO_ACTIVATION);
     explicit FusedConvBackpropData(const ov::Output<Node>& data_batch,
                                    const ov::Output<Node>& filters,
                                    const ov::Output<Node>& outputShape,
@@ -37,7 +38,8 @@ public:
                                    const ov::CoordinateDiff& pads_end,
                                    const ov::Strides& dilations,
                                    const ov::op::PadType& auto_pad,
-                                   const ov::CoordinateDiff& output_padding);
+                                   const ov::CoordinateDiff& output_padding,
+                                   ActivationMode activation = ActivationMode::NO_ACTIVATION);
 
     bool visit_attributes(ov::AttributeVisitor& visitor) override;
 
@@ -61,6 +63,10 @@ public:
     const auto& get_auto_pad() const { return auto_pad_; }
     const auto& get_output_padding() const { return output_padding_; }
 
+    /// Activation is applied in place after the backward data convolution and the addition
+    void set_activation(ActivationMode mode) { activation_ = mode; }
+    ActivationMode get_activation() const { return activation_; }
+
 private:
     /// Used for the shape validation
     ov::Strides strides_;
@@ -69,6 +75,7 @@ private:
     ov::Strides dilations_;
     ov::op::PadType auto_pad_;
     ov::CoordinateDiff output_padding_;
+    ActivationMode activation_ = ActivationMode::NO_ACTIVATION;
 };
 
 }  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,176 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_eltwise.hpp"
+
+#include "openvino/op/abs.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/equal.hpp"
+#include "openvino/op/erf.hpp"
+#include "openvino/op/exp.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/greater.hpp"
+#include "openvino/op/greater_eq.hpp"
+#include "openvino/op/hsigmoid.hpp"
+#include "openvino/op/hswish.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/less_eq.hpp"
+#include "openvino/op/logical_and.hpp"
+#include "openvino/op/logical_not.hpp"
+#include "openvino/op/logical_or.hpp"
+#include "openvino/op/logical_xor.hpp"
+#include "openvino/op/maximum.hpp"
+#include "openvino/op/minimum.hpp"
+#include "openvino/op/mish.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/negative.hpp"
+#include "openvino/op/not_equal.hpp"
+#include "openvino/op/power.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/op/softplus.hpp"
+#include "openvino/op/sqrt.hpp"
+#include "openvino/op/squared_difference.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/tanh.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+namespace {
+
+bool is_value_type(const ov::element::Type& type) {
+    return type == ov::element::f32 || type == ov::element::f16 || type == ov::element::boolean;
+}
+
+bool is_numpy_broadcast(const ov::op::AutoBroadcastSpec& spec) {
+    return spec.m_type == ov::op::AutoBroadcastType::NUMPY || spec.m_type == ov::op::AutoBroadcastType::NONE;
+}
+
+}  // namespace
+
+FusedEltwise::FusedEltwise(const ov::OutputVector& inputs, const std::shared_ptr<ov::Model>& body)
+    : ov::op::Op(inputs), m_body{body} {
+    constructor_validate_and_infer_types();
+}
+
+bool FusedEltwise::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("body", m_body);
+    visitor.on_attribute("packed_output", m_packed_output);
+    return true;
+}
+
+std::shared_ptr<ov::Node> FusedEltwise::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    auto clone = std::make_shared<FusedEltwise>(new_args, m_body->clone());
+    clone->set_packed_output(m_packed_output);
+    return clone;
+}
+
+void FusedEltwise::set_packed_output(bool packed_output) {
+    m_packed_output = packed_output;
+    validate_and_infer_types();
+}
+
+void FusedEltwise::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, m_body, "Body is missing");
+    const auto& parameters = m_body->get_parameters();
+    NODE_VALIDATION_CHECK(this,
+                          parameters.size() == get_input_size(),
+                          "Number of inputs (",
+                          get_input_size(),
+                          ") doesn't match number of parameters of the body (",
+                          parameters.size(),
+                          ")");
+    NODE_VALIDATION_CHECK(this, m_body->get_results().size() == 1, "Body should have a single result");
+    for (size_t i = 0; i < get_input_size(); ++i) {
+        const auto& type = get_input_element_type(i);
+        const auto& parameter_type = parameters[i]->get_element_type();
+        const bool packed = type == ov::element::u1 && parameter_type == ov::element::boolean;
+        NODE_VALIDATION_CHECK(this,
+                              (type == parameter_type || packed) &&
+                                  get_input_partial_shape(i).compatible(parameters[i]->get_partial_shape()),
+                              "Input ",
+                              i,
+                              " doesn't match the parameter of the body (input: ",
+                              get_input_element_type(i),
+                              get_input_partial_shape(i),
+                              ", parameter: ",
+                              parameters[i]->get_element_type(),
+                              parameters[i]->get_partial_shape(),
+                              ")");
+    }
+    const auto& result = m_body->get_results().front();
+    const auto& result_type = result->get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          !m_packed_output || result_type == ov::element::boolean,
+                          "Only boolean output may be packed (output element type: ",
+                          result_type,
+                          ")");
+    set_output_type(0, m_packed_output ? ov::element::u1 : result_type, result->get_input_partial_shape(0));
+}
+
+bool FusedEltwise::is_fusible(const ov::Node& node) {
+    if (node.is_dynamic() || node.get_output_size() != 1 || !is_value_type(node.get_output_element_type(0))) {
+        return false;
+    }
+    for (const auto& input : node.inputs()) {
+        if (!is_value_type(input.get_element_type())) {
+            return false;
+        }
+    }
+    // Masks are computed from comparisons and combined by logical operations, which produce 0 or 1
+    if (const auto comparison = ov::as_type<const ov::op::util::BinaryElementwiseComparison>(&node)) {
+        return is_numpy_broadcast(comparison->get_autob()) &&
+               (ov::is_type<ov::op::v1::Equal>(&node) || ov::is_type<ov::op::v1::NotEqual>(&node) ||
+                ov::is_type<ov::op::v1::Less>(&node) || ov::is_type<ov::op::v1::LessEqual>(&node) ||
+                ov::is_type<ov::op::v1::Greater>(&node) || ov::is_type<ov::op::v1::GreaterEqual>(&node));
+    }
+    if (const auto logical = ov::as_type<const ov::op::util::BinaryElementwiseLogical>(&node)) {
+        return is_numpy_broadcast(logical->get_autob()) &&
+               (ov::is_type<ov::op::v1::LogicalAnd>(&node) || ov::is_type<ov::op::v1::LogicalOr>(&node) ||
+                ov::is_type<ov::op::v1::LogicalXor>(&node));
+    }
+    if (const auto select = ov::as_type<const ov::op::v1::Select>(&node)) {
+        return is_numpy_broadcast(select->get_auto_broadcast());
+    }
+    if (ov::is_type<ov::op::v1::LogicalNot>(&node)) {
+        return true;
+    }
+    // Arithmetic operations aren't defined on boolean values
+    if (node.get_output_element_type(0) == ov::element::boolean && !ov::is_type<ov::op::v0::Convert>(&node)) {
+        return false;
+    }
+    if (const auto binary = ov::as_type<const ov::op::util::BinaryElementwiseArithmetic>(&node)) {
+        if (!is_numpy_broadcast(binary->get_autob())) {
+            return false;
+        }
+        return ov::is_type<ov::op::v1::Add>(&node) || ov::is_type<ov::op::v1::Subtract>(&node) ||
+               ov::is_type<ov::op::v1::Multiply>(&node) || ov::is_type<ov::op::v1::Divide>(&node) ||
+               ov::is_type<ov::op::v1::Maximum>(&node) || ov::is_type<ov::op::v1::Minimum>(&node) ||
+               ov::is_type<ov::op::v1::Power>(&node) || ov::is_type<ov::op::v0::SquaredDifference>(&node);
+    }
+    if (const auto swish = ov::as_type<const ov::op::v4::Swish>(&node)) {
+        // Beta is inlined into the kernel, so it should be a constant
+        return swish->get_input_size() == 1 || ov::is_type<ov::op::v0::Constant>(swish->get_input_node_ptr(1));
+    }
+    return ov::is_type<ov::op::v0::Relu>(&node) || ov::is_type<ov::op::v0::Sigmoid>(&node) ||
+           ov::is_type<ov::op::v0::Tanh>(&node) || ov::is_type<ov::op::v0::Exp>(&node) ||
+           ov::is_type<ov::op::v0::Abs>(&node) || ov::is_type<ov::op::v0::Sqrt>(&node) ||
+           ov::is_type<ov::op::v0::Negative>(&node) || ov::is_type<ov::op::v0::Erf>(&node) ||
+           ov::is_type<ov::op::v0::Clamp>(&node) || ov::is_type<ov::op::v0::Convert>(&node) ||
+           ov::is_type<ov::op::v4::HSwish>(&node) || ov::is_type<ov::op::v0::Gelu>(&node) ||
+           ov::is_type<ov::op::v7::Gelu>(&node) || ov::is_type<ov::op::v4::Mish>(&node) ||
+           ov::is_type<ov::op::v4::SoftPlus>(&node) || ov::is_type<ov::op::v5::HSigmoid>(&node);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
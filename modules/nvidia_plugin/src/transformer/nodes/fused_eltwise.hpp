@@ -0,0 +1,49 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/model.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Chain of element-wise operations computed by a single kernel. The chain is kept as the body model, which has
+ * a Parameter for each input of the node and a single Result. Inputs are broadcasted to the output shape
+ * by numpy rules, scalar constants are kept inside of the body.
+ * Boolean output, which is consumed only by other FusedEltwise nodes, may be packed: it is then u1 of the same
+ * shape, which element i is the bit i % 32 of the 32-bit word i / 32. Packed inputs are read as boolean ones
+ */
+class FusedEltwise : public ov::op::Op {
+public:
+    OPENVINO_OP("FusedEltwise", "nvidia_gpu");
+
+    FusedEltwise() = default;
+    ~FusedEltwise() = default;
+
+    FusedEltwise(const ov::OutputVector& inputs, const std::shared_ptr<ov::Model>& body);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    const std::shared_ptr<ov::Model>& get_body() const { return m_body; }
+
+    bool is_packed_output() const { return m_packed_output; }
+    void set_packed_output(bool packed_output);
+
+    /**
+     * @returns true if the node is an element-wise operation on f32/f16 or boolean tensors, which may be in the body
+     */
+    static bool is_fusible(const ov::Node& node);
+
+private:
+    std::shared_ptr<ov::Model> m_body;
+    bool m_packed_output = false;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,93 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_multi_head_attention.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+FusedMultiHeadAttention::FusedMultiHeadAttention(const ov::Output<Node>& Q,
+                                                 const ov::Output<Node>& K,
+                                                 const ov::Output<Node>& V,
+                                                 float scale,
+                                                 bool transpose_k)
+    : ov::op::Op(ov::OutputVector{Q, K, V}), m_scale{scale}, m_transpose_k{transpose_k} {
+    constructor_validate_and_infer_types();
+}
+
+FusedMultiHeadAttention::FusedMultiHeadAttention(const ov::Output<Node>& Q,
+                                                 const ov::Output<Node>& K,
+                                                 const ov::Output<Node>& V,
+                                                 const ov::Output<Node>& mask,
+                                                 float scale,
+                                                 bool transpose_k)
+    : ov::op::Op(ov::OutputVector{Q, K, V, mask}), m_scale{scale}, m_transpose_k{transpose_k} {
+    constructor_validate_and_infer_types();
+}
+
+bool FusedMultiHeadAttention::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    return true;
+}
+
+std::shared_ptr<ov::Node> FusedMultiHeadAttention::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    if (new_args.size() == 4) {
+        return std::make_shared<FusedMultiHeadAttention>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_scale, m_transpose_k);
+    }
+    check_new_args_count(this, new_args);
+    return std::make_shared<FusedMultiHeadAttention>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_transpose_k);
+}
+
+void FusedMultiHeadAttention::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == result_et,
+                              "Input ",
+                              i,
+                              " and queries do not have the same element type (input element type: ",
+                              get_input_element_type(i),
+                              ", queries element type: ",
+                              result_et,
+                              ").");
+    }
+
+    const auto& q_shape = get_input_partial_shape(0);
+    const auto& k_shape = get_input_partial_shape(1);
+    const auto& v_shape = get_input_partial_shape(2);
+    if (q_shape.rank().is_dynamic() || k_shape.rank().is_dynamic() || v_shape.rank().is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic());
+        return;
+    }
+    const auto rank = q_shape.rank().get_length();
+    NODE_VALIDATION_CHECK(this,
+                          (rank == 3 || rank == 4) && k_shape.rank().get_length() == rank &&
+                              v_shape.rank().get_length() == rank,
+                          "Queries, keys and values should be 3D or 4D tensors of the same rank (queries shape: ",
+                          q_shape,
+                          ", keys shape: ",
+                          k_shape,
+                          ", values shape: ",
+                          v_shape,
+                          ").");
+    const auto& head_size = q_shape[rank - 1];
+    const auto& k_head_size = m_transpose_k ? k_shape[rank - 1] : k_shape[rank - 2];
+    const auto& kv_length = m_transpose_k ? k_shape[rank - 2] : k_shape[rank - 1];
+    NODE_VALIDATION_CHECK(this,
+                          head_size.compatible(k_head_size) && kv_length.compatible(v_shape[rank - 2]),
+                          "Incompatible shapes of queries (",
+                          q_shape,
+                          "), keys (",
+                          k_shape,
+                          ") and values (",
+                          v_shape,
+                          ").");
+    auto output_shape = q_shape;
+    output_shape[rank - 1] = v_shape[rank - 1];
+    set_output_type(0, result_et, output_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
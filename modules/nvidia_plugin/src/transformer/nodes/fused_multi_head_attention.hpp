@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Scaled dot product attention Softmax(Q x Kt * scale + mask) x V of heads of queries, which is equal to
+ * the chain MatMul -> Multiply -> Add -> Softmax -> MatMul, but doesn't produce the attention matrix
+ * Inputs:
+ *   0: Q [B, H, S, D] or [B, S, D] of floating point type
+ *   1: K [B, H, S_kv, D] if transpose_k is true, [B, H, D, S_kv] otherwise
+ *   2: V [B, H, S_kv, D_v]
+ *   3 (optional): additive mask broadcastable to [B, H, S, S_kv] by the NumPy rules
+ * Output: [B, H, S, D_v] of the type of Q
+ */
+class FusedMultiHeadAttention : public ov::op::Op {
+public:
+    OPENVINO_OP("FusedMultiHeadAttention", "nvidia_gpu");
+
+    FusedMultiHeadAttention() = default;
+    ~FusedMultiHeadAttention() = default;
+
+    FusedMultiHeadAttention(const ov::Output<Node>& Q,
+                            const ov::Output<Node>& K,
+                            const ov::Output<Node>& V,
+                            float scale,
+                            bool transpose_k);
+
+    FusedMultiHeadAttention(const ov::Output<Node>& Q,
+                            const ov::Output<Node>& K,
+                            const ov::Output<Node>& V,
+                            const ov::Output<Node>& mask,
+                            float scale,
+                            bool transpose_k);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+    bool has_mask() const { return get_input_size() == 4; }
+
+private:
+    float m_scale = 1.0f;
+    bool m_transpose_k = true;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
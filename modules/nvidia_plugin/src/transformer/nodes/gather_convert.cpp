@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_convert.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+GatherConvert::GatherConvert(const ov::Output<Node>& data,
+                             const ov::Output<Node>& indices,
+                             const ov::Output<Node>& axis,
+                             int64_t batch_dims,
+                             ov::element::Type destination_type)
+    : ov::op::v8::Gather(data, indices, axis, batch_dims), m_destination_type{destination_type} {
+    constructor_validate_and_infer_types();
+}
+
+bool GatherConvert::visit_attributes(ov::AttributeVisitor& visitor) {
+    ov::op::v8::Gather::visit_attributes(visitor);
+    visitor.on_attribute("destination_type", m_destination_type);
+    return true;
+}
+
+std::shared_ptr<ov::Node> GatherConvert::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<GatherConvert>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_batch_dims, m_destination_type);
+}
+
+void GatherConvert::validate_and_infer_types() {
+    ov::op::v8::Gather::validate_and_infer_types();
+    NODE_VALIDATION_CHECK(this,
+                          m_destination_type.is_static(),
+                          "Destination type should be static (destination type: ",
+                          m_destination_type,
+                          ").");
+    set_output_type(0, m_destination_type, get_output_partial_shape(0));
+}
+
+}  // namespace ov::nvidia_gpu::nodes
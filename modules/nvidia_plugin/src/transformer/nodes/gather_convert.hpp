@@ -0,0 +1,44 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/gather.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Gather, which converts the gathered data to destination_type, i.e. Convert(Gather(data, indices, axis)).
+ * Inputs and attributes are the same as the ones of Gather-8
+ * Output: gathered data of destination_type
+ */
+class GatherConvert : public ov::op::v8::Gather {
+public:
+    OPENVINO_OP("GatherConvert", "nvidia_gpu", ov::op::v8::Gather);
+
+    GatherConvert() = default;
+    ~GatherConvert() = default;
+
+    GatherConvert(const ov::Output<Node>& data,
+                  const ov::Output<Node>& indices,
+                  const ov::Output<Node>& axis,
+                  int64_t batch_dims,
+                  ov::element::Type destination_type);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    bool has_evaluate() const override { return false; }
+    bool constant_fold(ov::OutputVector&, const ov::OutputVector&) override { return false; }
+
+    const ov::element::Type& get_destination_type() const { return m_destination_type; }
+
+private:
+    ov::element::Type m_destination_type;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,71 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "global_avg_pool_fully_connected.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+GlobalAvgPoolFullyConnected::GlobalAvgPoolFullyConnected(const ov::Output<Node>& data,
+                                                         const ov::Output<Node>& B,
+                                                         const ov::Output<Node>& bias,
+                                                         bool transpose_b,
+                                                         ActivationMode activation,
+                                                         float output_scale)
+    : ov::op::Op(ov::OutputVector{data, B, bias}),
+      m_transpose_b{transpose_b},
+      m_activation{activation},
+      m_output_scale{output_scale} {
+    constructor_validate_and_infer_types();
+}
+
+bool GlobalAvgPoolFullyConnected::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("transpose_b", m_transpose_b);
+    visitor.on_attribute("activation", m_activation);
+    visitor.on_attribute("output_scale", m_output_scale);
+    return true;
+}
+
+std::shared_ptr<ov::Node> GlobalAvgPoolFullyConnected::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<GlobalAvgPoolFullyConnected>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_transpose_b, m_activation, m_output_scale);
+}
+
+void GlobalAvgPoolFullyConnected::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == result_et,
+                              "Input ",
+                              i,
+                              " and data do not have the same element type (input element type: ",
+                              get_input_element_type(i),
+                              ", data element type: ",
+                              result_et,
+                              ").");
+    }
+    const auto& data_shape = get_input_partial_shape(0);
+    const auto& b_shape = get_input_partial_shape(1);
+    if (data_shape.rank().is_dynamic() || b_shape.rank().is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic(2));
+        return;
+    }
+    NODE_VALIDATION_CHECK(this,
+                          data_shape.rank().get_length() >= 3,
+                          "Data should have batch, channel and spatial dimensions (data shape: ",
+                          data_shape,
+                          ").");
+    NODE_VALIDATION_CHECK(this, b_shape.rank().get_length() == 2, "B should be a matrix (B shape: ", b_shape, ").");
+    const auto& channels = b_shape[m_transpose_b ? 1 : 0];
+    NODE_VALIDATION_CHECK(this,
+                          data_shape[1].compatible(channels),
+                          "Channels of data don't match B (data shape: ",
+                          data_shape,
+                          ", B shape: ",
+                          b_shape,
+                          ").");
+    set_output_type(0, result_et, ov::PartialShape{data_shape[0], b_shape[m_transpose_b ? 0 : 1]});
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,51 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "activation_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Global average pooling of spatial dimensions of data followed by FullyConnected:
+ *   y = activation(output_scale * (mean(data) x B) + bias)
+ * Inputs:
+ *   0: data [N, C, spatial...] of floating point type
+ *   1: B [n, C] if transposed, [C, n] otherwise, of the type of data
+ *   2: bias of n elements of the type of data
+ * Output: [N, n] of the type of data
+ */
+class GlobalAvgPoolFullyConnected : public ov::op::Op {
+public:
+    OPENVINO_OP("GlobalAvgPoolFullyConnected", "nvidia_gpu");
+
+    GlobalAvgPoolFullyConnected() = default;
+    ~GlobalAvgPoolFullyConnected() = default;
+
+    GlobalAvgPoolFullyConnected(const ov::Output<Node>& data,
+                                const ov::Output<Node>& B,
+                                const ov::Output<Node>& bias,
+                                bool transpose_b,
+                                ActivationMode activation = ActivationMode::NO_ACTIVATION,
+                                float output_scale = 1.0f);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    bool get_transpose_b() const { return m_transpose_b; }
+    ActivationMode get_activation() const { return m_activation; }
+    float get_output_scale() const { return m_output_scale; }
+
+private:
+    bool m_transpose_b = false;
+    ActivationMode m_activation = ActivationMode::NO_ACTIVATION;
+    float m_output_scale = 1.0f;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "group_norm.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+GroupNorm::GroupNorm(const ov::Output<Node>& data,
+                     const ov::Output<Node>& scale,
+                     const ov::Output<Node>& bias,
+                     size_t num_groups,
+                     float epsilon,
+                     bool epsilon_inside_sqrt,
+                     bool silu)
+    : ov::op::Op(ov::OutputVector{data, scale, bias}),
+      m_num_groups{num_groups},
+      m_epsilon{epsilon},
+      m_epsilon_inside_sqrt{epsilon_inside_sqrt},
+      m_silu{silu} {
+    constructor_validate_and_infer_types();
+}
+
+bool GroupNorm::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("num_groups", m_num_groups);
+    visitor.on_attribute("epsilon", m_epsilon);
+    visitor.on_attribute("epsilon_inside_sqrt", m_epsilon_inside_sqrt);
+    visitor.on_attribute("silu", m_silu);
+    visitor.on_attribute("nhwc_layout", m_nhwc_layout);
+    return true;
+}
+
+std::shared_ptr<ov::Node> GroupNorm::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    auto clone = std::make_shared<GroupNorm>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_num_groups, m_epsilon, m_epsilon_inside_sqrt, m_silu);
+    clone->set_nhwc_layout(m_nhwc_layout);
+    return clone;
+}
+
+void GroupNorm::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == result_et,
+                              "Input ",
+                              i,
+                              " and data do not have the same element type (input element type: ",
+                              get_input_element_type(i),
+                              ", data element type: ",
+                              result_et,
+                              ").");
+    }
+    NODE_VALIDATION_CHECK(this, m_num_groups > 0, "The number of groups should be positive");
+    const auto& data_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          data_shape.rank().is_dynamic() || data_shape.rank().get_length() >= 2,
+                          "Data should have the batch and the channel dimensions");
+    if (data_shape.rank().is_static()) {
+        const auto& channels = data_shape[1];
+        NODE_VALIDATION_CHECK(this,
+                              channels.is_dynamic() || channels.get_length() % m_num_groups == 0,
+                              "The number of channels ",
+                              channels,
+                              " isn't a multiple of the number of groups ",
+                              m_num_groups);
+        for (size_t i = 1; i < get_input_size(); ++i) {
+            NODE_VALIDATION_CHECK(this,
+                                  get_input_partial_shape(i).compatible(ov::PartialShape{channels}),
+                                  "Input ",
+                                  i,
+                                  " should be a vector of the size of the channel dimension of data (input shape: ",
+                                  get_input_partial_shape(i),
+                                  ", data shape: ",
+                                  data_shape,
+                                  ").");
+        }
+    }
+    set_output_type(0, result_et, data_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Normalization of groups of channels of each sample to zero mean and unit variance followed by the per-channel
+ * affine transform and optionally by SiLU (x * sigmoid(x)):
+ *   y = (x - mean) / sqrt(variance + epsilon) * scale + bias
+ * (or / (sqrt(variance) + epsilon) if epsilon is added outside of the square root)
+ * Inputs:
+ *   0: data [N, C, ...] of floating point type, C is a multiple of the number of groups
+ *   1: scale [C] of the type of data
+ *   2: bias [C] of the type of data
+ * Output: normalized data of the shape and the type of data
+ * Data and the output are in NHWC layout in memory if the node is in an NHWC region
+ * (see ov::nvidia_gpu::pass::NhwcLayoutPropagation), their shapes are in NCHW order still
+ */
+class GroupNorm : public ov::op::Op {
+public:
+    OPENVINO_OP("GroupNorm", "nvidia_gpu");
+
+    GroupNorm() = default;
+    ~GroupNorm() = default;
+
+    GroupNorm(const ov::Output<Node>& data,
+              const ov::Output<Node>& scale,
+              const ov::Output<Node>& bias,
+              size_t num_groups,
+              float epsilon,
+              bool epsilon_inside_sqrt,
+              bool silu);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    size_t get_num_groups() const { return m_num_groups; }
+    float get_epsilon() const { return m_epsilon; }
+    bool is_epsilon_inside_sqrt() const { return m_epsilon_inside_sqrt; }
+    bool has_silu() const { return m_silu; }
+
+    void set_nhwc_layout(bool nhwc_layout) { m_nhwc_layout = nhwc_layout; }
+    bool is_nhwc_layout() const { return m_nhwc_layout; }
+
+private:
+    size_t m_num_groups = 1;
+    float m_epsilon = 0.0f;
+    bool m_epsilon_inside_sqrt = true;
+    bool m_silu = false;
+    bool m_nhwc_layout = false;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
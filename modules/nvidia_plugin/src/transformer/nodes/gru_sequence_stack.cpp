@@ -0,0 +1,81 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gru_sequence_stack.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+GRUSequenceStack::GRUSequenceStack(const ov::OutputVector& args,
+                                   const std::size_t hidden_size,
+                                   const bool linear_before_reset)
+    : ov::op::Op(args), m_hidden_size{hidden_size}, m_linear_before_reset{linear_before_reset} {
+    constructor_validate_and_infer_types();
+}
+
+bool GRUSequenceStack::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("hidden_size", m_hidden_size);
+    visitor.on_attribute("linear_before_reset", m_linear_before_reset);
+    return true;
+}
+
+std::shared_ptr<ov::Node> GRUSequenceStack::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    return std::make_shared<GRUSequenceStack>(new_args, m_hidden_size, m_linear_before_reset);
+}
+
+void GRUSequenceStack::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() >= 9 && get_input_size() % 3 == 0,
+                          "GRUSequenceStack expects X, initial_hidden_state, sequence_lengths and W, R, B of "
+                          "at least 2 layers, got ",
+                          get_input_size(),
+                          " inputs.");
+    const auto& result_et = get_input_element_type(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              i == 2 || get_input_element_type(i) == result_et,
+                              "Input ",
+                              i,
+                              " and X do not have the same element type (input element type: ",
+                              get_input_element_type(i),
+                              ", X element type: ",
+                              result_et,
+                              ").");
+    }
+    const auto& x_shape = get_input_partial_shape(0);
+    const auto& h_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          x_shape.rank().compatible(3) && h_shape.rank().compatible(3),
+                          "X and initial_hidden_state of GRUSequenceStack shall be 3D.");
+    const auto num_layers = static_cast<int64_t>(get_num_layers());
+    const auto hidden_size = static_cast<int64_t>(m_hidden_size);
+    auto batch_size = ov::Dimension::dynamic();
+    auto seq_length = ov::Dimension::dynamic();
+    if (x_shape.rank().is_static()) {
+        batch_size = x_shape[0];
+        seq_length = x_shape[1];
+    }
+    NODE_VALIDATION_CHECK(
+        this,
+        h_shape.compatible(ov::PartialShape{batch_size, num_layers, hidden_size}),
+        "initial_hidden_state of GRUSequenceStack shall be [batch_size, num_layers, hidden_size], got ",
+        h_shape,
+        ".");
+    for (int64_t l = 0; l < num_layers; ++l) {
+        const ov::Dimension input_size =
+            l > 0 ? ov::Dimension{hidden_size} : (x_shape.rank().is_static() ? x_shape[2] : ov::Dimension::dynamic());
+        const int64_t num_biases = m_linear_before_reset ? 4 : 3;
+        NODE_VALIDATION_CHECK(
+            this,
+            get_input_partial_shape(3 + 3 * l).compatible(ov::PartialShape{1, 3 * hidden_size, input_size}) &&
+                get_input_partial_shape(4 + 3 * l).compatible(ov::PartialShape{1, 3 * hidden_size, hidden_size}) &&
+                get_input_partial_shape(5 + 3 * l).compatible(ov::PartialShape{1, num_biases * hidden_size}),
+            "Weights of layer ",
+            l,
+            " of GRUSequenceStack have unexpected shapes.");
+    }
+    set_output_type(0, result_et, ov::PartialShape{batch_size, 1, seq_length, hidden_size});
+    set_output_type(1, result_et, ov::PartialShape{batch_size, num_layers, hidden_size});
+}
+
+}  // namespace ov::nvidia_gpu::nodes
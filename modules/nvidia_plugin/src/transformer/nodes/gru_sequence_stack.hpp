@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Stack of forward GRU sequences with default activations, each layer takes y of the previous one as x.
+ * Inputs:
+ *   0: X [batch_size, seq_length, input_size]
+ *   1: initial_hidden_state [batch_size, num_layers, hidden_size]
+ *   2: sequence_lengths [batch_size]
+ *   3 + 3 * l, 4 + 3 * l, 5 + 3 * l: W, R and B of l-th layer in the form of GRUSequence inputs,
+ *      input_size of W of layers after the first one is hidden_size
+ * Outputs:
+ *   0: Y of the last layer [batch_size, 1, seq_length, hidden_size]
+ *   1: Ho [batch_size, num_layers, hidden_size]
+ */
+class GRUSequenceStack : public ov::op::Op {
+public:
+    OPENVINO_OP("GRUSequenceStack", "nvidia_gpu");
+
+    GRUSequenceStack() = default;
+    ~GRUSequenceStack() = default;
+
+    GRUSequenceStack(const ov::OutputVector& args, std::size_t hidden_size, bool linear_before_reset);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    std::size_t get_hidden_size() const { return m_hidden_size; }
+    bool get_linear_before_reset() const { return m_linear_before_reset; }
+    std::size_t get_num_layers() const { return (get_input_size() - 3) / 3; }
+
+private:
+    std::size_t m_hidden_size = 0;
+    bool m_linear_before_reset = false;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
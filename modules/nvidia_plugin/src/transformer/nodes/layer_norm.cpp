@@ -0,0 +1,66 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_norm.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+LayerNorm::LayerNorm(const ov::Output<Node>& data,
+                     const ov::Output<Node>& scale,
+                     const ov::Output<Node>& bias,
+                     float epsilon,
+                     bool epsilon_inside_sqrt)
+    : ov::op::Op(ov::OutputVector{data, scale, bias}),
+      m_epsilon{epsilon},
+      m_epsilon_inside_sqrt{epsilon_inside_sqrt} {
+    constructor_validate_and_infer_types();
+}
+
+bool LayerNorm::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("epsilon", m_epsilon);
+    visitor.on_attribute("epsilon_inside_sqrt", m_epsilon_inside_sqrt);
+    return true;
+}
+
+std::shared_ptr<ov::Node> LayerNorm::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<LayerNorm>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_epsilon, m_epsilon_inside_sqrt);
+}
+
+void LayerNorm::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == result_et,
+                              "Input ",
+                              i,
+                              " and data do not have the same element type (input element type: ",
+                              get_input_element_type(i),
+                              ", data element type: ",
+                              result_et,
+                              ").");
+    }
+    const auto& data_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          data_shape.rank().is_dynamic() || data_shape.rank().get_length() >= 1,
+                          "Scalars are not supported as data");
+    if (data_shape.rank().is_static()) {
+        const auto& length = data_shape[data_shape.rank().get_length() - 1];
+        for (size_t i = 1; i < get_input_size(); ++i) {
+            NODE_VALIDATION_CHECK(this,
+                                  get_input_partial_shape(i).compatible(ov::PartialShape{length}),
+                                  "Input ",
+                                  i,
+                                  " should be a vector of the size of the last dimension of data (input shape: ",
+                                  get_input_partial_shape(i),
+                                  ", data shape: ",
+                                  data_shape,
+                                  ").");
+        }
+    }
+    set_output_type(0, result_et, data_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,48 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Normalization of the last dimension of data to zero mean and unit variance followed by the affine transform:
+ *   y = (x - mean) / sqrt(variance + epsilon) * scale + bias
+ * (or / (sqrt(variance) + epsilon) if epsilon is added outside of the square root)
+ * Inputs:
+ *   0: data [..., D] of floating point type
+ *   1: scale [D] of the type of data
+ *   2: bias [D] of the type of data
+ * Output: normalized data of the shape and the type of data
+ */
+class LayerNorm : public ov::op::Op {
+public:
+    OPENVINO_OP("LayerNorm", "nvidia_gpu");
+
+    LayerNorm() = default;
+    ~LayerNorm() = default;
+
+    LayerNorm(const ov::Output<Node>& data,
+              const ov::Output<Node>& scale,
+              const ov::Output<Node>& bias,
+              float epsilon,
+              bool epsilon_inside_sqrt);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    float get_epsilon() const { return m_epsilon; }
+    bool is_epsilon_inside_sqrt() const { return m_epsilon_inside_sqrt; }
+
+private:
+    float m_epsilon = 0.0f;
+    bool m_epsilon_inside_sqrt = true;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,35 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nhwc_reorder.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+NhwcReorder::NhwcReorder(const ov::Output<Node>& input, bool to_nhwc)
+    : ov::op::Op(ov::OutputVector{input}), m_to_nhwc{to_nhwc} {
+    constructor_validate_and_infer_types();
+}
+
+bool NhwcReorder::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("to_nhwc", m_to_nhwc);
+    return true;
+}
+
+std::shared_ptr<ov::Node> NhwcReorder::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<NhwcReorder>(new_args.at(0), m_to_nhwc);
+}
+
+void NhwcReorder::validate_and_infer_types() {
+    const auto& shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          shape.rank().is_dynamic() || shape.rank().get_length() == 4 ||
+                              shape.rank().get_length() == 5,
+                          "Only 4D and 5D tensors are supported (input shape: ",
+                          shape,
+                          ").");
+    set_output_type(0, get_input_element_type(0), shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
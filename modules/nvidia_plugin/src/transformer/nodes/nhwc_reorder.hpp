@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Reorders elements of a 4D or 5D tensor between NCHW and NHWC (channels last) order in memory.
+ * Shapes of the input and of the output are the same and are in NCHW order, so the node is an identity
+ * for the model and only marks the boundaries of regions with NHWC layout (see NhwcLayoutPropagation)
+ */
+class NhwcReorder : public ov::op::Op {
+public:
+    OPENVINO_OP("NhwcReorder", "nvidia_gpu");
+
+    NhwcReorder() = default;
+    ~NhwcReorder() = default;
+
+    /**
+     * @param to_nhwc Input is in NCHW order and output is in NHWC order if true, the opposite otherwise
+     */
+    NhwcReorder(const ov::Output<Node>& input, bool to_nhwc);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    bool is_to_nhwc() const { return m_to_nhwc; }
+
+private:
+    bool m_to_nhwc = true;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_max_suppression.hpp"
+
+#include <algorithm>
+
+namespace ov::nvidia_gpu::nodes {
+
+NonMaxSuppression::NonMaxSuppression(const ov::Output<Node>& boxes,
+                                     const ov::Output<Node>& scores,
+                                     int64_t max_output_boxes_per_class,
+                                     float iou_threshold,
+                                     float score_threshold,
+                                     bool center_point_box,
+                                     bool sort_result_descending,
+                                     const ov::element::Type& output_type)
+    : ov::op::Op(ov::OutputVector{boxes, scores}),
+      m_max_output_boxes_per_class{max_output_boxes_per_class},
+      m_iou_threshold{iou_threshold},
+      m_score_threshold{score_threshold},
+      m_center_point_box{center_point_box},
+      m_sort_result_descending{sort_result_descending},
+      m_output_type{output_type} {
+    constructor_validate_and_infer_types();
+}
+
+bool NonMaxSuppression::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("max_output_boxes_per_class", m_max_output_boxes_per_class);
+    visitor.on_attribute("iou_threshold", m_iou_threshold);
+    visitor.on_attribute("score_threshold", m_score_threshold);
+    visitor.on_attribute("center_point_box", m_center_point_box);
+    visitor.on_attribute("sort_result_descending", m_sort_result_descending);
+    visitor.on_attribute("output_type", m_output_type);
+    return true;
+}
+
+std::shared_ptr<ov::Node> NonMaxSuppression::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<NonMaxSuppression>(new_args.at(0),
+                                               new_args.at(1),
+                                               m_max_output_boxes_per_class,
+                                               m_iou_threshold,
+                                               m_score_threshold,
+                                               m_center_point_box,
+                                               m_sort_result_descending,
+                                               m_output_type);
+}
+
+void NonMaxSuppression::validate_and_infer_types() {
+    const auto& boxes_shape = get_input_partial_shape(0);
+    const auto& scores_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0) == get_input_element_type(1),
+                          "Boxes and scores do not have the same element type");
+    NODE_VALIDATION_CHECK(this,
+                          m_output_type == ov::element::i32 || m_output_type == ov::element::i64,
+                          "Output type must be i32 or i64");
+    NODE_VALIDATION_CHECK(this, m_max_output_boxes_per_class >= 0, "Max output boxes per class must be non-negative");
+    NODE_VALIDATION_CHECK(this,
+                          boxes_shape.compatible(ov::PartialShape{ov::Dimension{}, ov::Dimension{}, 4}) &&
+                              scores_shape.rank().compatible(3),
+                          "Boxes should be [num_batches, num_boxes, 4] and scores [num_batches, num_classes, num_boxes]");
+    ov::Dimension num_selected{};
+    if (boxes_shape.is_static() && scores_shape.is_static()) {
+        const auto num_boxes = static_cast<int64_t>(boxes_shape[1].get_length());
+        num_selected = scores_shape[0].get_length() * scores_shape[1].get_length() *
+                       std::min(num_boxes, m_max_output_boxes_per_class);
+    }
+    set_output_type(0, m_output_type, ov::PartialShape{num_selected, 3});
+    set_output_type(1, get_input_element_type(1), ov::PartialShape{num_selected, 3});
+    set_output_type(2, m_output_type, ov::PartialShape{1});
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * NonMaxSuppression-5/9 with constant thresholds and without Soft-NMS, whose outputs have static shapes, so that
+ * the number of selected boxes is known on the device only:
+ * Inputs:
+ *   0: boxes [num_batches, num_boxes, 4] of floating point type
+ *   1: scores [num_batches, num_classes, num_boxes] of the type of boxes
+ * Outputs:
+ *   0: selected_indices [num_batches * num_classes * min(num_boxes, max_output_boxes_per_class), 3] of output_type,
+ *      triplets (batch, class, box) of valid_outputs selected boxes are followed by triplets of -1
+ *   1: selected_scores of the same shape of the type of scores, triplets (batch, class, score) followed by -1
+ *   2: valid_outputs [1] of output_type
+ */
+class NonMaxSuppression : public ov::op::Op {
+public:
+    OPENVINO_OP("NonMaxSuppression", "nvidia_gpu");
+
+    NonMaxSuppression() = default;
+    ~NonMaxSuppression() = default;
+
+    NonMaxSuppression(const ov::Output<Node>& boxes,
+                      const ov::Output<Node>& scores,
+                      int64_t max_output_boxes_per_class,
+                      float iou_threshold,
+                      float score_threshold,
+                      bool center_point_box,
+                      bool sort_result_descending,
+                      const ov::element::Type& output_type);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    int64_t get_max_output_boxes_per_class() const { return m_max_output_boxes_per_class; }
+    float get_iou_threshold() const { return m_iou_threshold; }
+    float get_score_threshold() const { return m_score_threshold; }
+    bool is_center_point_box() const { return m_center_point_box; }
+    bool is_sort_result_descending() const { return m_sort_result_descending; }
+    const ov::element::Type& get_output_type() const { return m_output_type; }
+
+private:
+    int64_t m_max_output_boxes_per_class = 0;
+    float m_iou_threshold = 0.0f;
+    float m_score_threshold = 0.0f;
+    bool m_center_point_box = false;
+    bool m_sort_result_descending = true;
+    ov::element::Type m_output_type = ov::element::i64;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
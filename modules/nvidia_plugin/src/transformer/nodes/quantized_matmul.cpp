@@ -0,0 +1,111 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "quantized_matmul.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+QuantizedMatMul::QuantizedMatMul(const ov::Output<Node>& A,
+                                 const ov::Output<Node>& weights,
+                                 const ov::Output<Node>& scales,
+                                 float input_low,
+                                 float input_high,
+                                 size_t levels)
+    : ov::op::Op(ov::OutputVector{A, weights, scales}),
+      m_input_low{input_low},
+      m_input_high{input_high},
+      m_levels{levels} {
+    constructor_validate_and_infer_types();
+}
+
+QuantizedMatMul::QuantizedMatMul(const ov::Output<Node>& A,
+                                 const ov::Output<Node>& weights,
+                                 const ov::Output<Node>& scales,
+                                 const ov::Output<Node>& bias,
+                                 float input_low,
+                                 float input_high,
+                                 size_t levels)
+    : ov::op::Op(ov::OutputVector{A, weights, scales, bias}),
+      m_input_low{input_low},
+      m_input_high{input_high},
+      m_levels{levels} {
+    constructor_validate_and_infer_types();
+}
+
+bool QuantizedMatMul::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("input_low", m_input_low);
+    visitor.on_attribute("input_high", m_input_high);
+    visitor.on_attribute("levels", m_levels);
+    return true;
+}
+
+std::shared_ptr<ov::Node> QuantizedMatMul::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    if (new_args.size() == 4) {
+        return std::make_shared<QuantizedMatMul>(new_args.at(0),
+                                                 new_args.at(1),
+                                                 new_args.at(2),
+                                                 new_args.at(3),
+                                                 m_input_low,
+                                                 m_input_high,
+                                                 m_levels);
+    }
+    check_new_args_count(this, new_args);
+    return std::make_shared<QuantizedMatMul>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_input_low, m_input_high, m_levels);
+}
+
+void QuantizedMatMul::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this, m_levels == 255 || m_levels == 256, "Levels ", m_levels, " are not supported");
+    NODE_VALIDATION_CHECK(this,
+                          m_input_low < m_input_high,
+                          "Input low (",
+                          m_input_low,
+                          ") should be less than input high (",
+                          m_input_high,
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == ov::element::i8,
+                          "Weights should be of i8 type (weights element type: ",
+                          get_input_element_type(1),
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(2) == result_et,
+                          "Scales and activations do not have the same element type (scales element type: ",
+                          get_input_element_type(2),
+                          ", activations element type: ",
+                          result_et,
+                          ").");
+    if (has_bias()) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(3) == result_et,
+                              "Bias and activations do not have the same element type (bias element type: ",
+                              get_input_element_type(3),
+                              ", activations element type: ",
+                              result_et,
+                              ").");
+    }
+
+    const auto& A_partial_shape = get_input_partial_shape(0);
+    const auto& weights_partial_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this, weights_partial_shape.rank().compatible(2), "Weights should be a matrix");
+    if (A_partial_shape.rank().is_dynamic() || weights_partial_shape.rank().is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic());
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, A_partial_shape.rank().get_length() >= 1, "Scalars are not supported as activations");
+    const auto& k = A_partial_shape[A_partial_shape.rank().get_length() - 1];
+    NODE_VALIDATION_CHECK(this,
+                          k.compatible(weights_partial_shape[1]),
+                          "Incompatible dimensions of activations (",
+                          A_partial_shape,
+                          ") and weights (",
+                          weights_partial_shape,
+                          ").");
+    auto output_shape = A_partial_shape;
+    output_shape[output_shape.rank().get_length() - 1] = weights_partial_shape[0];
+    set_output_type(0, result_et, output_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * MatMul of activations A [..., K], which are fake quantized symmetrically to i8 by the range
+ * [input_low, input_high] of the given number of levels (255 or 256), by weights quantized symmetrically
+ * per output channel. Products are accumulated in i32.
+ * Inputs:
+ *   0: A [..., K] of floating point type
+ *   1: quantized weights [N, K] of i8 type
+ *   2: scales [N] of the type of A, which are products of the activations scale and weights scales
+ *   3 (optional): bias of the output shape added to the result
+ * Output: A [..., N] of the type of A
+ */
+class QuantizedMatMul : public ov::op::Op {
+public:
+    OPENVINO_OP("QuantizedMatMul", "nvidia_gpu");
+
+    QuantizedMatMul() = default;
+    ~QuantizedMatMul() = default;
+
+    QuantizedMatMul(const ov::Output<Node>& A,
+                    const ov::Output<Node>& weights,
+                    const ov::Output<Node>& scales,
+                    float input_low,
+                    float input_high,
+                    size_t levels);
+
+    QuantizedMatMul(const ov::Output<Node>& A,
+                    const ov::Output<Node>& weights,
+                    const ov::Output<Node>& scales,
+                    const ov::Output<Node>& bias,
+                    float input_low,
+                    float input_high,
+                    size_t levels);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    float get_input_low() const { return m_input_low; }
+    float get_input_high() const { return m_input_high; }
+    size_t get_levels() const { return m_levels; }
+    bool has_bias() const { return get_input_size() == 4; }
+
+private:
+    float m_input_low = 0.0f;
+    float m_input_high = 0.0f;
+    size_t m_levels = 0;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
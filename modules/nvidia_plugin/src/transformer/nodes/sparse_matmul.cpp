@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_matmul.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+SparseMatMul::SparseMatMul(const ov::Output<Node>& A, const std::shared_ptr<ov::op::v0::Constant>& weights)
+    : ov::op::Op(ov::OutputVector{A}), m_weights{weights} {
+    constructor_validate_and_infer_types();
+}
+
+SparseMatMul::SparseMatMul(const ov::Output<Node>& A,
+                           const std::shared_ptr<ov::op::v0::Constant>& weights,
+                           const ov::Output<Node>& bias)
+    : ov::op::Op(ov::OutputVector{A, bias}), m_weights{weights} {
+    constructor_validate_and_infer_types();
+}
+
+bool SparseMatMul::visit_attributes(ov::AttributeVisitor& visitor) { return true; }
+
+std::shared_ptr<ov::Node> SparseMatMul::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    if (new_args.size() == 2) {
+        return std::make_shared<SparseMatMul>(new_args.at(0), m_weights, new_args.at(1));
+    }
+    check_new_args_count(this, new_args);
+    return std::make_shared<SparseMatMul>(new_args.at(0), m_weights);
+}
+
+void SparseMatMul::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this, m_weights != nullptr, "Weights are not set");
+    NODE_VALIDATION_CHECK(this,
+                          m_weights->get_element_type() == result_et,
+                          "Weights and activations do not have the same element type (weights element type: ",
+                          m_weights->get_element_type(),
+                          ", activations element type: ",
+                          result_et,
+                          ").");
+    if (has_bias()) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(1) == result_et,
+                              "Bias and activations do not have the same element type (bias element type: ",
+                              get_input_element_type(1),
+                              ", activations element type: ",
+                              result_et,
+                              ").");
+    }
+
+    const auto& A_partial_shape = get_input_partial_shape(0);
+    const auto& weights_shape = m_weights->get_shape();
+    NODE_VALIDATION_CHECK(this, weights_shape.size() == 2, "Weights should be a matrix");
+    if (A_partial_shape.rank().is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic());
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, A_partial_shape.rank().get_length() >= 1, "Scalars are not supported as activations");
+    const auto& k = A_partial_shape[A_partial_shape.rank().get_length() - 1];
+    NODE_VALIDATION_CHECK(this,
+                          k.compatible(weights_shape[1]),
+                          "Incompatible dimensions of activations (",
+                          A_partial_shape,
+                          ") and weights (",
+                          weights_shape,
+                          ").");
+    auto output_shape = A_partial_shape;
+    output_shape[output_shape.rank().get_length() - 1] = weights_shape[0];
+    set_output_type(0, result_et, output_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * MatMul of activations A [..., K] by constant weights [N, K] pruned to 2:4 structured sparsity, i.e. each group
+ * of 4 consecutive values along K has at most 2 non-zero values. Weights aren't an input of the node, since they
+ * are compressed for sparse tensor cores when the operation is created and the dense ones aren't kept on the device.
+ * Inputs:
+ *   0: A [..., K] of floating point type
+ *   1 (optional): bias of the output shape added to the result
+ * Output: A [..., N] of the type of A
+ */
+class SparseMatMul : public ov::op::Op {
+public:
+    OPENVINO_OP("SparseMatMul", "nvidia_gpu");
+
+    SparseMatMul() = default;
+    ~SparseMatMul() = default;
+
+    SparseMatMul(const ov::Output<Node>& A, const std::shared_ptr<ov::op::v0::Constant>& weights);
+
+    SparseMatMul(const ov::Output<Node>& A,
+                 const std::shared_ptr<ov::op::v0::Constant>& weights,
+                 const ov::Output<Node>& bias);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    const std::shared_ptr<ov::op::v0::Constant>& get_weights() const { return m_weights; }
+    bool has_bias() const { return get_input_size() == 2; }
+
+private:
+    std::shared_ptr<ov::op::v0::Constant> m_weights;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
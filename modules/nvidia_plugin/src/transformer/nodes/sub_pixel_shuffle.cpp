@@ -0,0 +1,84 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sub_pixel_shuffle.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+SubPixelShuffle::SubPixelShuffle(const ov::Output<Node>& data,
+                                 size_t block_size,
+                                 const ov::Shape& crop_begin,
+                                 const ov::Shape& spatial_shape)
+    : ov::op::Op(ov::OutputVector{data}),
+      m_block_size{block_size},
+      m_crop_begin{crop_begin},
+      m_spatial_shape{spatial_shape} {
+    constructor_validate_and_infer_types();
+}
+
+bool SubPixelShuffle::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("block_size", m_block_size);
+    visitor.on_attribute("crop_begin", m_crop_begin);
+    visitor.on_attribute("spatial_shape", m_spatial_shape);
+    return true;
+}
+
+std::shared_ptr<ov::Node> SubPixelShuffle::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<SubPixelShuffle>(new_args.at(0), m_block_size, m_crop_begin, m_spatial_shape);
+}
+
+void SubPixelShuffle::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, m_block_size > 0, "Block size should be positive.");
+    NODE_VALIDATION_CHECK(this,
+                          m_crop_begin.size() == 2 && m_spatial_shape.size() == 2,
+                          "Crop and spatial shape should have 2 dimensions (crop begin: ",
+                          m_crop_begin,
+                          ", spatial shape: ",
+                          m_spatial_shape,
+                          ").");
+    const auto& data_et = get_input_element_type(0);
+    const auto& data_shape = get_input_partial_shape(0);
+    if (data_shape.rank().is_dynamic()) {
+        set_output_type(0, data_et, ov::PartialShape::dynamic(4));
+        return;
+    }
+    NODE_VALIDATION_CHECK(
+        this, data_shape.rank().get_length() == 4, "Data should have 4 dimensions (data shape: ", data_shape, ").");
+    const auto blocks = static_cast<int64_t>(m_block_size * m_block_size);
+    auto channels = data_shape[1];
+    if (channels.is_static()) {
+        NODE_VALIDATION_CHECK(this,
+                              channels.get_length() % blocks == 0,
+                              "Channels of data should be divisible by the square of block size (data shape: ",
+                              data_shape,
+                              ", block size: ",
+                              m_block_size,
+                              ").");
+        channels = channels.get_length() / blocks;
+    } else {
+        channels = ov::Dimension::dynamic();
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        const auto& dim = data_shape[i + 2];
+        const auto end = m_crop_begin[i] + m_spatial_shape[i];
+        NODE_VALIDATION_CHECK(this,
+                              dim.is_dynamic() || end <= static_cast<size_t>(dim.get_length()) * m_block_size,
+                              "Crop is out of the shuffled data (data shape: ",
+                              data_shape,
+                              ", crop begin: ",
+                              m_crop_begin,
+                              ", spatial shape: ",
+                              m_spatial_shape,
+                              ").");
+    }
+    set_output_type(0,
+                    data_et,
+                    ov::PartialShape{data_shape[0],
+                                     channels,
+                                     static_cast<int64_t>(m_spatial_shape[0]),
+                                     static_cast<int64_t>(m_spatial_shape[1])});
+}
+
+}  // namespace ov::nvidia_gpu::nodes
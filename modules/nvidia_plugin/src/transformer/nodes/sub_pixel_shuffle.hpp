@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * DepthToSpace in the blocks first mode followed by a crop of the spatial dimensions, which assembles the output of
+ * a deconvolution from the outputs of its sub-pixel convolution.
+ * Input: data [N, block_size * block_size * C, H, W]
+ * Output: [N, C, spatial_shape[0], spatial_shape[1]], which starts at crop_begin of the shuffled data
+ * [N, C, H * block_size, W * block_size]
+ */
+class SubPixelShuffle : public ov::op::Op {
+public:
+    OPENVINO_OP("SubPixelShuffle", "nvidia_gpu");
+
+    SubPixelShuffle() = default;
+    ~SubPixelShuffle() = default;
+
+    SubPixelShuffle(const ov::Output<Node>& data,
+                    size_t block_size,
+                    const ov::Shape& crop_begin,
+                    const ov::Shape& spatial_shape);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    size_t get_block_size() const { return m_block_size; }
+    const ov::Shape& get_crop_begin() const { return m_crop_begin; }
+    const ov::Shape& get_spatial_shape() const { return m_spatial_shape; }
+
+private:
+    size_t m_block_size = 1;
+    ov::Shape m_crop_begin;
+    ov::Shape m_spatial_shape;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
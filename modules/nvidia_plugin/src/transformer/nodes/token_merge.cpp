@@ -0,0 +1,92 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "token_merge.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+TokenMerge::TokenMerge(const ov::Output<Node>& metric,
+                       const ov::Output<Node>& x,
+                       const ov::Output<Node>& size,
+                       size_t num_merged,
+                       bool class_token)
+    : ov::op::Op(ov::OutputVector{metric, x, size}), m_num_merged{num_merged}, m_class_token{class_token} {
+    constructor_validate_and_infer_types();
+}
+
+bool TokenMerge::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("num_merged", m_num_merged);
+    visitor.on_attribute("class_token", m_class_token);
+    return true;
+}
+
+std::shared_ptr<ov::Node> TokenMerge::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<TokenMerge>(new_args.at(0), new_args.at(1), new_args.at(2), m_num_merged, m_class_token);
+}
+
+void TokenMerge::validate_and_infer_types() {
+    const auto& result_et = get_input_element_type(0);
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == result_et,
+                              "Input ",
+                              i,
+                              " and metric do not have the same element type (input element type: ",
+                              get_input_element_type(i),
+                              ", metric element type: ",
+                              result_et,
+                              ").");
+    }
+    for (size_t i = 0; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).rank().compatible(3),
+                              "Input ",
+                              i,
+                              " should be of rank 3 (input shape: ",
+                              get_input_partial_shape(i),
+                              ").");
+    }
+    const auto& metric_shape = get_input_partial_shape(0);
+    const auto& x_shape = get_input_partial_shape(1);
+    const auto& size_shape = get_input_partial_shape(2);
+    if (metric_shape.rank().is_dynamic() || x_shape.rank().is_dynamic()) {
+        set_output_type(0, result_et, ov::PartialShape::dynamic(3));
+        set_output_type(1, result_et, ov::PartialShape::dynamic(3));
+        return;
+    }
+    NODE_VALIDATION_CHECK(this,
+                          metric_shape[0].compatible(x_shape[0]) && metric_shape[1].compatible(x_shape[1]),
+                          "Metric and tokens should have the same batch and the same number of tokens (metric shape: ",
+                          metric_shape,
+                          ", tokens shape: ",
+                          x_shape,
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          size_shape.compatible(ov::PartialShape{x_shape[0], x_shape[1], 1}),
+                          "Sizes should be of shape [B, N, 1] (sizes shape: ",
+                          size_shape,
+                          ", tokens shape: ",
+                          x_shape,
+                          ").");
+    auto tokens = x_shape[1];
+    if (tokens.is_static()) {
+        const auto protected_tokens = m_class_token ? 1 : 0;
+        NODE_VALIDATION_CHECK(this,
+                              m_num_merged > 0 &&
+                                  static_cast<int64_t>(m_num_merged) <= (tokens.get_length() - protected_tokens) / 2,
+                              "The number of merged tokens ",
+                              m_num_merged,
+                              " should be positive and at most a half of ",
+                              tokens,
+                              " tokens, which may be merged");
+        tokens = tokens.get_length() - static_cast<int64_t>(m_num_merged);
+    } else {
+        tokens = ov::Dimension::dynamic();
+    }
+    set_output_type(0, result_et, ov::PartialShape{x_shape[0], tokens, x_shape[2]});
+    set_output_type(1, result_et, ov::PartialShape{x_shape[0], tokens, 1});
+}
+
+}  // namespace ov::nvidia_gpu::nodes
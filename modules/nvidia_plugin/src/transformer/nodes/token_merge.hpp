@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Token merging (ToMe) by bipartite soft matching followed by the weighted average of merged tokens by their sizes.
+ * Even tokens (set A) are matched with the most similar odd tokens (set B) by cosine similarity of their metric,
+ * r tokens of A with the most similar matches are merged into their matches, the rest of A is kept:
+ *   y = concat(unmerged A, B with merged A), sum of x * size of merged tokens / sum of their sizes
+ * Unmerged tokens of A are ordered by the similarity of their matches (descending), or by their positions if the
+ * first token is a class token, which is never merged
+ * Inputs:
+ *   0: metric [B, N, C] of floating point type (e.g. keys averaged over heads)
+ *   1: tokens x [B, N, D] of the type of metric
+ *   2: sizes of tokens [B, N, 1] of the type of metric
+ * Outputs:
+ *   0: merged tokens [B, N - r, D]
+ *   1: sizes of merged tokens [B, N - r, 1]
+ */
+class TokenMerge : public ov::op::Op {
+public:
+    OPENVINO_OP("TokenMerge", "nvidia_gpu");
+
+    TokenMerge() = default;
+    ~TokenMerge() = default;
+
+    TokenMerge(const ov::Output<Node>& metric,
+               const ov::Output<Node>& x,
+               const ov::Output<Node>& size,
+               size_t num_merged,
+               bool class_token);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    size_t get_num_merged() const { return m_num_merged; }
+    bool has_class_token() const { return m_class_token; }
+
+private:
+    size_t m_num_merged = 0;
+    bool m_class_token = false;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
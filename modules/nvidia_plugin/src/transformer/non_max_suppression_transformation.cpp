@@ -0,0 +1,86 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_max_suppression_transformation.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#include "nodes/non_max_suppression.hpp"
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/non_max_suppression.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+/**
+ * @returns Value of the optional scalar input, the default value if the input is absent or std::nullopt if it isn't
+ * constant
+ */
+template <typename T>
+std::optional<T> scalar_input(const ov::Node& node, size_t index, T default_value) {
+    if (node.get_input_size() <= index) {
+        return default_value;
+    }
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node.get_input_node_shared_ptr(index));
+    if (!constant || ov::shape_size(constant->get_shape()) != 1) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<T>()[0];
+}
+
+template <typename TNms>
+bool replace_non_max_suppression(const std::shared_ptr<TNms>& nms) {
+    const auto max_output_boxes_per_class = scalar_input<int64_t>(*nms, 2, 0);
+    const auto iou_threshold = scalar_input<float>(*nms, 3, 0.0f);
+    const auto score_threshold = scalar_input<float>(*nms, 4, 0.0f);
+    const auto soft_nms_sigma = scalar_input<float>(*nms, 5, 0.0f);
+    if (!max_output_boxes_per_class || !iou_threshold || !score_threshold || !soft_nms_sigma ||
+        *soft_nms_sigma != 0.0f || nms->get_input_partial_shape(0).is_dynamic() ||
+        nms->get_input_partial_shape(1).is_dynamic()) {
+        return false;
+    }
+    const auto static_nms =
+        std::make_shared<nodes::NonMaxSuppression>(nms->input_value(0),
+                                                   nms->input_value(1),
+                                                   std::max<int64_t>(*max_output_boxes_per_class, 0),
+                                                   *iou_threshold,
+                                                   *score_threshold,
+                                                   nms->get_box_encoding() == TNms::BoxEncodingType::CENTER,
+                                                   nms->get_sort_result_descending(),
+                                                   nms->get_output_type());
+    static_nms->set_friendly_name(nms->get_friendly_name());
+    ov::copy_runtime_info(nms, static_nms);
+    ov::replace_node(nms, static_nms);
+    return true;
+}
+
+}  // namespace
+
+NonMaxSuppressionTransformation::NonMaxSuppressionTransformation() {
+    MATCHER_SCOPE(NonMaxSuppressionTransformation);
+
+    const auto nms = wrap_type<ov::op::v5::NonMaxSuppression, ov::op::v9::NonMaxSuppression>();
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto root = m.get_match_root();
+        if (const auto nms9 = ov::as_type_ptr<ov::op::v9::NonMaxSuppression>(root)) {
+            return replace_non_max_suppression(nms9);
+        }
+        if (const auto nms5 = ov::as_type_ptr<ov::op::v5::NonMaxSuppression>(root)) {
+            return replace_non_max_suppression(nms5);
+        }
+        return false;
+    };
+
+    const auto m = std::make_shared<Matcher>(nms, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,21 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Replaces NonMaxSuppression-5/9 with constant thresholds and without Soft-NMS by nodes::NonMaxSuppression,
+ * whose outputs are padded to the maximal number of selected boxes, so that models with NMS have static shapes
+ */
+class NonMaxSuppressionTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("NonMaxSuppressionTransformation", "0");
+    NonMaxSuppressionTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,210 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "pooling_fusion.hpp"
+
+#include <algorithm>
+#include <kernels/depthwise_convolution.hpp>
+#include <kernels/gemv.hpp>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/avg_pool.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/depthwise_convolution_max_pool.hpp"
+#include "transformer/nodes/fully_connected.hpp"
+#include "transformer/nodes/fused_convolution.hpp"
+#include "transformer/nodes/global_avg_pool_fully_connected.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+using nodes::ActivationMode;
+
+bool is_kernel_type(const ov::element::Type& type) {
+    return type == ov::element::f32 || type == ov::element::f16 || type == ov::element::bf16;
+}
+
+bool is_zero(const ov::Shape& pads) {
+    return std::all_of(pads.begin(), pads.end(), [](size_t pad) { return pad == 0; });
+}
+
+bool is_depthwise_convolution_to_be_fused(const nodes::FusedGroupConvolution& conv) {
+    if (conv.is_dynamic() || conv.has_add_node() || conv.is_nhwc_layout() ||
+        !is_kernel_type(conv.get_output_element_type(0))) {
+        return false;
+    }
+    const auto activation = conv.get_activation();
+    if (activation != ActivationMode::NO_ACTIVATION && activation != ActivationMode::RELU &&
+        activation != ActivationMode::SIGMOID && activation != ActivationMode::TANH &&
+        activation != ActivationMode::SWISH) {
+        return false;
+    }
+    const auto& data_shape = conv.get_input_shape(0);
+    const auto& filter_shape = conv.get_input_shape(1);
+    return data_shape.size() == 4 && filter_shape.size() == 5 && filter_shape[0] == data_shape[1] &&
+           filter_shape[1] == 1 && filter_shape[2] == 1 && filter_shape[3] == filter_shape[4] &&
+           kernel::DepthwiseConvolution::isSupportedKernelSize(filter_shape[3]) &&
+           ov::shape_size(conv.get_input_shape(2)) == data_shape[1];
+}
+
+bool is_max_pool_to_be_fused(const ov::Output<ov::Node>& output) {
+    const auto pool = std::dynamic_pointer_cast<ov::op::v1::MaxPool>(output.get_node_shared_ptr());
+    if (!pool || pool->is_dynamic()) {
+        return false;
+    }
+    const auto conv = std::dynamic_pointer_cast<nodes::FusedGroupConvolution>(pool->get_input_node_shared_ptr(0));
+    if (!conv || !is_depthwise_convolution_to_be_fused(*conv)) {
+        return false;
+    }
+    const auto& kernel = pool->get_kernel();
+    if (kernel.size() != 2 || kernel[0] != kernel[1] || kernel[0] < 2 ||
+        pool->get_strides() != ov::Strides(kernel.begin(), kernel.end()) || !is_zero(pool->get_pads_begin()) ||
+        !is_zero(pool->get_pads_end())) {
+        return false;
+    }
+    // Partial windows are dropped by the kernel, so they are allowed only by the floor rounding
+    const auto& conv_shape = conv->get_output_shape(0);
+    const bool whole_windows = conv_shape[2] % kernel[0] == 0 && conv_shape[3] % kernel[0] == 0;
+    return pool->get_rounding_type() == ov::op::RoundingType::FLOOR || whole_windows;
+}
+
+/**
+ * @returns Data pooled by ReduceMean or AvgPool over all spatial dimensions, which is the only consumer of the data
+ *          and is the input of FullyConnected or is reshaped to it, otherwise empty output
+ */
+ov::Output<ov::Node> get_global_avg_pool_data(const nodes::FullyConnected& fully_connected) {
+    auto node = fully_connected.get_input_node_shared_ptr(0);
+    if ((ov::is_type<ov::op::v1::Reshape>(node) || ov::is_type<ov::op::v0::Squeeze>(node)) &&
+        node->get_output_target_inputs(0).size() == 1) {
+        node = node->get_input_node_shared_ptr(0);
+    }
+    const bool is_pool = ov::is_type<ov::op::v1::ReduceMean>(node) || ov::is_type<ov::op::v1::AvgPool>(node);
+    if (!is_pool || node->get_output_target_inputs(0).size() != 1 || node->is_dynamic()) {
+        return {};
+    }
+    const auto& data_shape = node->get_input_shape(0);
+    if (data_shape.size() < 3) {
+        return {};
+    }
+    if (const auto mean = std::dynamic_pointer_cast<ov::op::v1::ReduceMean>(node)) {
+        const auto axes = std::dynamic_pointer_cast<ov::op::v0::Constant>(mean->get_input_node_shared_ptr(1));
+        if (!axes) {
+            return {};
+        }
+        const auto rank = static_cast<int64_t>(data_shape.size());
+        std::vector<bool> reduced(data_shape.size());
+        for (auto axis : axes->cast_vector<int64_t>()) {
+            axis = axis < 0 ? axis + rank : axis;
+            if (axis < 2 || axis >= rank) {
+                return {};
+            }
+            reduced[axis] = true;
+        }
+        if (!std::all_of(reduced.begin() + 2, reduced.end(), [](bool value) { return value; })) {
+            return {};
+        }
+    } else {
+        const auto pool = std::dynamic_pointer_cast<ov::op::v1::AvgPool>(node);
+        if (pool->get_kernel() != ov::Shape(data_shape.begin() + 2, data_shape.end()) ||
+            !is_zero(pool->get_pads_begin()) || !is_zero(pool->get_pads_end())) {
+            return {};
+        }
+    }
+    return node->input_value(0);
+}
+
+bool is_fully_connected_to_be_fused(const ov::Output<ov::Node>& output) {
+    const auto fully_connected = std::dynamic_pointer_cast<nodes::FullyConnected>(output.get_node_shared_ptr());
+    if (!fully_connected || fully_connected->is_dynamic() || fully_connected->get_transpose_a() ||
+        !is_kernel_type(fully_connected->get_output_element_type(0))) {
+        return false;
+    }
+    const auto activation = fully_connected->get_activation();
+    if (activation != ActivationMode::NO_ACTIVATION && activation != ActivationMode::RELU &&
+        activation != ActivationMode::GELU) {
+        return false;
+    }
+    const auto& a_shape = fully_connected->get_input_shape(0);
+    const auto& b_shape = fully_connected->get_input_shape(1);
+    const auto& shape = fully_connected->get_output_shape(0);
+    if (a_shape.size() != 2 || b_shape.size() != 2 || shape.size() != 2 || shape[0] > kernel::Gemv::max_rows ||
+        ov::shape_size(fully_connected->get_input_shape(2)) != shape[1] ||
+        !ov::is_type<ov::op::v0::Constant>(fully_connected->get_input_node_ptr(1))) {
+        return false;
+    }
+    const auto data = get_global_avg_pool_data(*fully_connected);
+    if (!data.get_node()) {
+        return false;
+    }
+    const auto& data_shape = data.get_shape();
+    return data_shape[0] == a_shape[0] && data_shape[1] == a_shape[1];
+}
+
+}  // namespace
+
+FuseMaxPoolToDepthwiseConvolution::FuseMaxPoolToDepthwiseConvolution() {
+    MATCHER_SCOPE(FuseMaxPoolToDepthwiseConvolution);
+    auto conv = wrap_type<nodes::FusedGroupConvolution>(consumers_count(1));
+    auto pool = wrap_type<ov::op::v1::MaxPool>({conv}, is_max_pool_to_be_fused);
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto pool = std::dynamic_pointer_cast<ov::op::v1::MaxPool>(m.get_match_root());
+        const auto conv = std::dynamic_pointer_cast<nodes::FusedGroupConvolution>(pool->get_input_node_shared_ptr(0));
+        const auto fused = std::make_shared<nodes::DepthwiseConvolutionMaxPool>(conv->input_value(0),
+                                                                                conv->input_value(1),
+                                                                                conv->input_value(2),
+                                                                                conv->get_strides(),
+                                                                                conv->get_pads_begin(),
+                                                                                conv->get_pads_end(),
+                                                                                conv->get_dilations(),
+                                                                                conv->get_activation(),
+                                                                                pool->get_kernel()[0]);
+        fused->set_friendly_name(pool->get_friendly_name());
+        ov::copy_runtime_info({conv, pool}, fused);
+        ov::replace_node(pool, fused);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(pool, matcher_name);
+    register_matcher(m, callback);
+}
+
+FuseGlobalAvgPoolToFullyConnected::FuseGlobalAvgPoolToFullyConnected() {
+    MATCHER_SCOPE(FuseGlobalAvgPoolToFullyConnected);
+    auto fully_connected = wrap_type<nodes::FullyConnected>(is_fully_connected_to_be_fused);
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto fully_connected = std::dynamic_pointer_cast<nodes::FullyConnected>(m.get_match_root());
+        const auto data = get_global_avg_pool_data(*fully_connected);
+        ov::NodeVector fused_nodes{fully_connected};
+        for (auto node = fully_connected->get_input_node_shared_ptr(0); node != data.get_node_shared_ptr();
+             node = node->get_input_node_shared_ptr(0)) {
+            fused_nodes.push_back(node);
+        }
+        const auto fused = std::make_shared<nodes::GlobalAvgPoolFullyConnected>(data,
+                                                                                fully_connected->input_value(1),
+                                                                                fully_connected->input_value(2),
+                                                                                fully_connected->get_transpose_b(),
+                                                                                fully_connected->get_activation(),
+                                                                                fully_connected->get_output_scale());
+        fused->set_friendly_name(fully_connected->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, fused);
+        ov::replace_node(fully_connected, fused);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(fully_connected, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Fuses MaxPool with non-overlapping windows and without paddings, which follows depthwise FusedGroupConvolution
+ * without addition, into DepthwiseConvolutionMaxPool. Activated outputs of the convolution are pooled by the kernel
+ * of the convolution, so they aren't written to and read from memory.
+ * Other convolutions are executed by cuDNN, which doesn't pool in its epilogues
+ */
+class FuseMaxPoolToDepthwiseConvolution : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseMaxPoolToDepthwiseConvolution", "0");
+    FuseMaxPoolToDepthwiseConvolution();
+};
+
+/**
+ * Fuses global average pooling of spatial dimensions (ReduceMean or AvgPool) followed by optional Reshape or
+ * Squeeze to [N, C] and FullyConnected with few rows into GlobalAvgPoolFullyConnected, whose kernel computes
+ * the means and their product with the weights
+ */
+class FuseGlobalAvgPoolToFullyConnected : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseGlobalAvgPoolToFullyConnected", "0");
+    FuseGlobalAvgPoolToFullyConnected();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -8,6 +8,8 @@
 #include "openvino/core/rt_info.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/op/reduce_l1.hpp"
+#include "openvino/op/reduce_l2.hpp"
 #include "openvino/op/reduce_max.hpp"
 #include "openvino/op/reduce_mean.hpp"
 #include "openvino/op/reduce_min.hpp"
@@ -63,6 +65,26 @@ bool transform_reduce(Matcher &m) {
 }
 } // namespace
 
+ReduceL1Transformation::ReduceL1Transformation() {
+    MATCHER_SCOPE(ReduceL1Transformation);
+    auto reduce = wrap_type<ov::op::v4::ReduceL1>(is_reduce_to_be_transformed);
+    matcher_pass_callback callback = [](Matcher &m) {
+        return transform_reduce<ov::op::v4::ReduceL1>(m);
+        };
+    auto m = std::make_shared<Matcher>(reduce, matcher_name);
+    register_matcher(m, callback);
+}
+
+ReduceL2Transformation::ReduceL2Transformation() {
+    MATCHER_SCOPE(ReduceL2Transformation);
+    auto reduce = wrap_type<ov::op::v4::ReduceL2>(is_reduce_to_be_transformed);
+    matcher_pass_callback callback = [](Matcher &m) {
+        return transform_reduce<ov::op::v4::ReduceL2>(m);
+        };
+    auto m = std::make_shared<Matcher>(reduce, matcher_name);
+    register_matcher(m, callback);
+}
+
 ReduceMaxTransformation::ReduceMaxTransformation() {
     MATCHER_SCOPE(ReduceMaxTransformation);
     auto reduce = wrap_type<ov::op::v1::ReduceMax>(is_reduce_to_be_transformed);
@@ -119,6 +141,8 @@ bool ov::nvidia_gpu::pass::ReduceTransformation::run_on_model(const std::shared_
     manager.register_pass<ov::pass::ConvertReduceToReshape>();
 
     auto reduce_transformations = manager.register_pass<ov::pass::GraphRewrite>();
+    ADD_MATCHER(reduce_transformations, ReduceL1Transformation)
+    ADD_MATCHER(reduce_transformations, ReduceL2Transformation)
     ADD_MATCHER(reduce_transformations, ReduceMaxTransformation)
     ADD_MATCHER(reduce_transformations, ReduceMeanTransformation)
     ADD_MATCHER(reduce_transformations, ReduceMinTransformation)
@@ -14,6 +14,18 @@ public:
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 };
 
+class ReduceL1Transformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReduceL1Transformation", "0");
+    ReduceL1Transformation();
+};
+
+class ReduceL2Transformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReduceL2Transformation", "0");
+    ReduceL2Transformation();
+};
+
 class ReduceMaxTransformation : public ov::pass::MatcherPass {
 public:
     OPENVINO_RTTI("ReduceMaxTransformation", "0");
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "shape_subgraph_folding.hpp"
+
+#include <unordered_set>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/random_uniform.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/sink.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/pass/constant_folding.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/rt_info/disable_constant_folding.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool is_static_shape_of(const ov::Node& node) {
+    return (ov::is_type<ov::op::v0::ShapeOf>(&node) || ov::is_type<ov::op::v3::ShapeOf>(&node)) &&
+           node.get_input_partial_shape(0).is_static();
+}
+
+/**
+ * @returns true if the node may be replaced by its outputs computed at compile time
+ */
+bool is_foldable(const ov::Node& node) {
+    return node.get_output_size() > 0 && !ov::op::util::is_parameter(&node) && !ov::op::util::is_output(&node) &&
+           !ov::is_type<ov::op::Sink>(&node) && !ov::is_type<ov::op::util::MultiSubGraphOp>(&node) &&
+           !ov::is_type<ov::op::v8::RandomUniform>(&node);
+}
+
+}  // namespace
+
+bool ShapeSubgraphFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_FUNCTION_SCOPE(ShapeSubgraphFolding);
+    // Nodes computed from static shapes and constants only
+    std::unordered_set<const ov::Node*> shape_nodes;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (is_static_shape_of(*node)) {
+            shape_nodes.insert(node.get());
+            continue;
+        }
+        if (ov::op::util::is_constant(node) || !is_foldable(*node)) {
+            continue;
+        }
+        bool from_shapes = false;
+        bool known = true;
+        for (const auto& input : node->input_values()) {
+            const auto* source = input.get_node();
+            if (shape_nodes.count(source) > 0) {
+                from_shapes = true;
+            } else if (!ov::op::util::is_constant(source)) {
+                known = false;
+                break;
+            }
+        }
+        // Nodes of constants only are left to the common constant folding, which keeps decompression of weights
+        if (known && from_shapes) {
+            shape_nodes.insert(node.get());
+        }
+    }
+    if (shape_nodes.empty()) {
+        return false;
+    }
+    for (const auto& node : model->get_ordered_ops()) {
+        if (shape_nodes.count(node.get()) > 0) {
+            ov::pass::enable_constant_folding(node);
+        }
+    }
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::ConstantFolding>();
+    manager.run_passes(model);
+    return true;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,22 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Folds shape computations into constants: ShapeOf of static shapes and every node computed from them and
+ * constants only (e.g. Gather, Concat, Range and arithmetic feeding Reshape). Folding is enabled for such nodes
+ * even if it was disabled by common transformations, while subgraphs of weights aren't touched
+ */
+class ShapeSubgraphFolding : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("ShapeSubgraphFolding", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
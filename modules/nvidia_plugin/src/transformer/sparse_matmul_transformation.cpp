@@ -0,0 +1,110 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "sparse_matmul_transformation.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/fully_connected.hpp"
+#include "transformer/nodes/sparse_matmul.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+// cuSPARSELt requires dimensions of f16 matrices to be multiples of 16
+constexpr size_t dimension_alignment = 16;
+
+bool is_convertible(const ov::Node& node) {
+    if (node.is_dynamic() || node.get_input_element_type(0) != ov::element::f16 ||
+        node.get_input_element_type(1) != ov::element::f16) {
+        return false;
+    }
+    const auto weights = std::dynamic_pointer_cast<ov::op::v0::Constant>(node.get_input_node_shared_ptr(1));
+    if (!weights || weights->get_output_shape(0).size() != 2 || node.get_input_shape(0).empty()) {
+        return false;
+    }
+    const size_t k = node.get_input_shape(0).back();
+    const size_t n = node.get_output_shape(0).back();
+    const size_t m = ov::shape_size(node.get_input_shape(0)) / k;
+    if (k % dimension_alignment != 0 || n % dimension_alignment != 0 || m % dimension_alignment != 0) {
+        return false;
+    }
+    return node.get_input_size() != 3 ||
+           ov::shape_size(node.get_input_shape(2)) == ov::shape_size(node.get_output_shape(0));
+}
+
+/**
+ * @returns Weights [N, K] if each group of 4 consecutive values along K has at most 2 non-zero values,
+ *          otherwise nullptr
+ */
+std::shared_ptr<ov::op::v0::Constant> to_sparse_weights(const ov::op::v0::Constant& constant, bool transpose_b) {
+    const auto& shape = constant.get_output_shape(0);
+    const size_t n = transpose_b ? shape[0] : shape[1];
+    const size_t k = transpose_b ? shape[1] : shape[0];
+    const auto* values = constant.get_data_ptr<ov::float16>();
+    std::vector<ov::float16> weights(n * k);
+    for (size_t in = 0; in < n; ++in) {
+        for (size_t ik = 0; ik < k; ik += 4) {
+            int non_zeros = 0;
+            for (size_t i = ik; i < ik + 4; ++i) {
+                const auto value = transpose_b ? values[in * k + i] : values[i * n + in];
+                non_zeros += static_cast<float>(value) != 0.0f;
+                weights[in * k + i] = value;
+            }
+            if (non_zeros > 2) {
+                return nullptr;
+            }
+        }
+    }
+    return std::make_shared<ov::op::v0::Constant>(ov::element::f16, ov::Shape{n, k}, weights.data());
+}
+
+template <typename TOperation>
+bool convert_to_sparse(const std::shared_ptr<ov::Node>& node) {
+    const auto op = std::dynamic_pointer_cast<TOperation>(node);
+    if (!op || op->get_transpose_a() || !is_convertible(*op)) {
+        return false;
+    }
+    const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op->get_input_node_shared_ptr(1));
+    const auto weights = to_sparse_weights(*constant, op->get_transpose_b());
+    if (!weights) {
+        return false;
+    }
+    weights->set_friendly_name(constant->get_friendly_name() + "/sparse");
+
+    std::shared_ptr<nodes::SparseMatMul> sparse_matmul;
+    if (op->get_input_size() == 3) {
+        sparse_matmul =
+            std::make_shared<nodes::SparseMatMul>(op->get_input_source_output(0), weights, op->get_input_source_output(2));
+    } else {
+        sparse_matmul = std::make_shared<nodes::SparseMatMul>(op->get_input_source_output(0), weights);
+    }
+    sparse_matmul->set_friendly_name(op->get_friendly_name());
+    ov::copy_runtime_info({constant, op}, sparse_matmul);
+    ov::replace_node(op, sparse_matmul);
+    return true;
+}
+
+}  // namespace
+
+SparseMatMulTransformation::SparseMatMulTransformation() {
+    MATCHER_SCOPE(SparseMatMulTransformation);
+    auto matmul = wrap_type<ov::op::v0::MatMul, nodes::FullyConnected>();
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto node = m.get_match_root();
+        return convert_to_sparse<ov::op::v0::MatMul>(node) || convert_to_sparse<nodes::FullyConnected>(node);
+    };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,21 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Replaces f16 MatMul and FullyConnected, whose constant weights are pruned to 2:4 structured sparsity along K,
+ * by SparseMatMul executed by cuSPARSELt on sparse tensor cores. M, N and K should be multiples of 16
+ */
+class SparseMatMulTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SparseMatMulTransformation", "0");
+    SparseMatMulTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,195 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "sub_pixel_convolution.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/sub_pixel_shuffle.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+size_t div_up(size_t a, size_t b) { return (a + b - 1) / b; }
+
+bool is_deconvolution_to_be_rewritten(const ov::Output<ov::Node>& output) {
+    const auto deconv = std::dynamic_pointer_cast<ov::op::v1::ConvolutionBackpropData>(output.get_node_shared_ptr());
+    if (!deconv || deconv->is_dynamic() || deconv->get_input_size() != 2 ||
+        !ov::is_type<ov::op::v0::Constant>(deconv->get_input_node_ptr(1))) {
+        return false;
+    }
+    // Paddings are deduced from the output shape or by auto padding in other modes
+    const auto auto_pad = deconv->get_auto_pad();
+    if (auto_pad != ov::op::PadType::EXPLICIT && auto_pad != ov::op::PadType::NOTSET) {
+        return false;
+    }
+    const auto& type = deconv->get_output_element_type(0);
+    if (type != ov::element::f32 && type != ov::element::f16) {
+        return false;
+    }
+    const auto& strides = deconv->get_strides();
+    const auto& dilations = deconv->get_dilations();
+    const auto& pads_begin = deconv->get_pads_begin();
+    if (strides.size() != 2 || strides[0] != strides[1] || strides[0] < 2 ||
+        std::any_of(dilations.begin(), dilations.end(), [](size_t d) { return d != 1; }) ||
+        std::any_of(pads_begin.begin(), pads_begin.end(), [](std::ptrdiff_t pad) { return pad < 0; })) {
+        return false;
+    }
+    // Output paddings may take the crop past the phases computed by the convolution
+    const auto& in_shape = deconv->get_input_shape(0);
+    const auto& filter_shape = deconv->get_input_shape(1);
+    const auto& out_shape = deconv->get_output_shape(0);
+    const auto s = strides[0];
+    for (size_t i = 0; i < 2; ++i) {
+        const auto taps = div_up(filter_shape[i + 2], s);
+        if (static_cast<size_t>(pads_begin[i]) + out_shape[i + 2] > (in_shape[i + 2] + taps - 1) * s) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Weights [s * s * C_out, C_in, taps_y, taps_x] of the convolution, whose output channel (ry * s + rx) * C_out + c
+ * computes the output phase (ry, rx) of the channel c of the deconvolution. The taps of the phase are the weights
+ * of the deconvolution at ry + s * j, which are flipped, and zeros past the kernel
+ */
+std::shared_ptr<ov::op::v0::Constant> sub_pixel_weights(const ov::op::v0::Constant& weights, size_t s) {
+    const auto& shape = weights.get_shape();
+    const size_t in_channels = shape[0];
+    const size_t out_channels = shape[1];
+    const size_t kernel_y = shape[2];
+    const size_t kernel_x = shape[3];
+    const size_t taps_y = div_up(kernel_y, s);
+    const size_t taps_x = div_up(kernel_x, s);
+    const auto values = weights.cast_vector<float>();
+    const ov::Shape result_shape{s * s * out_channels, in_channels, taps_y, taps_x};
+    std::vector<float> result(ov::shape_size(result_shape), 0.0f);
+    for (size_t ry = 0; ry < s; ++ry) {
+        for (size_t rx = 0; rx < s; ++rx) {
+            for (size_t co = 0; co < out_channels; ++co) {
+                for (size_t ci = 0; ci < in_channels; ++ci) {
+                    for (size_t ty = 0; ty < taps_y; ++ty) {
+                        const size_t ky = ry + s * (taps_y - 1 - ty);
+                        for (size_t tx = 0; tx < taps_x && ky < kernel_y; ++tx) {
+                            const size_t kx = rx + s * (taps_x - 1 - tx);
+                            if (kx >= kernel_x) {
+                                continue;
+                            }
+                            const size_t oc = (ry * s + rx) * out_channels + co;
+                            result[((oc * in_channels + ci) * taps_y + ty) * taps_x + tx] =
+                                values[((ci * out_channels + co) * kernel_y + ky) * kernel_x + kx];
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return ov::op::v0::Constant::create(weights.get_element_type(), result_shape, result);
+}
+
+/**
+ * @returns Constant bias of C_out elements added to the channels of the deconvolution, or nullptr
+ */
+std::shared_ptr<ov::op::v0::Constant> get_bias(const ov::op::v1::Add& add, const ov::Node* deconv) {
+    const auto bias_index = add.get_input_node_ptr(0) == deconv ? 1 : 0;
+    const auto bias = std::dynamic_pointer_cast<ov::op::v0::Constant>(add.get_input_node_shared_ptr(bias_index));
+    if (!bias || bias->get_output_element_type(0) != deconv->get_output_element_type(0) ||
+        add.get_output_shape(0) != deconv->get_output_shape(0)) {
+        return nullptr;
+    }
+    const auto& shape = bias->get_shape();
+    const auto channels = deconv->get_output_shape(0)[1];
+    if (shape.size() < 3 || shape.size() > 4 || ov::shape_size(shape) != channels ||
+        shape[shape.size() - 3] != channels) {
+        return nullptr;
+    }
+    return bias;
+}
+
+}  // namespace
+
+ConvolutionBackpropDataToSubPixelConvolution::ConvolutionBackpropDataToSubPixelConvolution() {
+    MATCHER_SCOPE(ConvolutionBackpropDataToSubPixelConvolution);
+    auto deconv = wrap_type<ov::op::v1::ConvolutionBackpropData>(is_deconvolution_to_be_rewritten);
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto deconv = std::dynamic_pointer_cast<ov::op::v1::ConvolutionBackpropData>(m.get_match_root());
+        const auto weights = std::dynamic_pointer_cast<ov::op::v0::Constant>(deconv->get_input_node_shared_ptr(1));
+        const auto s = deconv->get_strides()[0];
+        const auto conv_weights = sub_pixel_weights(*weights, s);
+        const auto& conv_weights_shape = conv_weights->get_shape();
+        const std::ptrdiff_t pad_y = conv_weights_shape[2] - 1;
+        const std::ptrdiff_t pad_x = conv_weights_shape[3] - 1;
+        std::shared_ptr<ov::Node> last = std::make_shared<ov::op::v1::Convolution>(deconv->input_value(0),
+                                                                                   conv_weights,
+                                                                                   ov::Strides{1, 1},
+                                                                                   ov::CoordinateDiff{pad_y, pad_x},
+                                                                                   ov::CoordinateDiff{pad_y, pad_x},
+                                                                                   ov::Strides{1, 1});
+        ov::NodeVector rewritten{deconv, weights};
+        ov::NodeVector new_nodes{conv_weights, last};
+
+        // Element-wise operations commute with the shuffle, so the bias and the activation are applied to the phases
+        std::shared_ptr<ov::Node> root = deconv;
+        const auto consumers = deconv->get_output_target_inputs(0);
+        const auto add = consumers.size() == 1
+                             ? ov::as_type_ptr<ov::op::v1::Add>(consumers.begin()->get_node()->shared_from_this())
+                             : nullptr;
+        const auto bias = add ? get_bias(*add, deconv.get()) : nullptr;
+        if (bias) {
+            const auto values = bias->cast_vector<float>();
+            std::vector<float> phases_bias;
+            phases_bias.reserve(s * s * values.size());
+            for (size_t phase = 0; phase < s * s; ++phase) {
+                phases_bias.insert(phases_bias.end(), values.begin(), values.end());
+            }
+            const auto phases_bias_constant = ov::op::v0::Constant::create(
+                bias->get_element_type(), ov::Shape{1, phases_bias.size(), 1, 1}, phases_bias);
+            last = std::make_shared<ov::op::v1::Add>(last, phases_bias_constant);
+            new_nodes.insert(new_nodes.end(), {phases_bias_constant, last});
+            rewritten.push_back(add);
+            root = add;
+
+            const auto add_consumers = add->get_output_target_inputs(0);
+            const auto activation =
+                add_consumers.size() == 1 ? add_consumers.begin()->get_node()->shared_from_this() : nullptr;
+            if (ov::is_type<ov::op::v0::Relu>(activation) || ov::is_type<ov::op::v0::Sigmoid>(activation)) {
+                last = activation->clone_with_new_inputs({last});
+                new_nodes.push_back(last);
+                rewritten.push_back(activation);
+                root = activation;
+            }
+        }
+
+        const auto& pads_begin = deconv->get_pads_begin();
+        const auto& out_shape = deconv->get_output_shape(0);
+        const auto shuffle = std::make_shared<nodes::SubPixelShuffle>(
+            last,
+            s,
+            ov::Shape{static_cast<size_t>(pads_begin[0]), static_cast<size_t>(pads_begin[1])},
+            ov::Shape{out_shape[2], out_shape[3]});
+        new_nodes.push_back(shuffle);
+        shuffle->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(rewritten, new_nodes);
+        ov::replace_node(root, shuffle);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(deconv, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,24 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Rewrites 2D ConvolutionBackpropData with stride s > 1 in both dimensions and constant weights as a forward
+ * Convolution with stride 1 of the input into s * s * C channels, one group of C channels per output phase, followed
+ * by SubPixelShuffle, which interleaves the phases and crops the paddings. Forward convolutions are much faster than
+ * backward data algorithms of cuDNN, and they take the bias and the activation, which follow the deconvolution, into
+ * their epilogue by CudaConvolutionFusion
+ */
+class ConvolutionBackpropDataToSubPixelConvolution : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ConvolutionBackpropDataToSubPixelConvolution", "0");
+    ConvolutionBackpropDataToSubPixelConvolution();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,390 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "token_merge_fusion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather_elements.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/normalize_l2.hpp"
+#include "openvino/op/reduce_l2.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/scatter_elements_update.hpp"
+#include "openvino/op/scatter_update.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/strided_slice.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/token_merge.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+template <typename TOperation>
+std::shared_ptr<TOperation> as(const ov::Output<ov::Node>& output) {
+    return std::dynamic_pointer_cast<TOperation>(output.get_node_shared_ptr());
+}
+
+std::optional<std::vector<int64_t>> constant_values(const ov::Output<ov::Node>& output) {
+    const auto constant = as<ov::op::v0::Constant>(output);
+    if (!constant) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<int64_t>();
+}
+
+/**
+ * @returns true if the axis is the axis of tokens (1) of [B, N, C]
+ */
+bool is_token_axis(int64_t axis) { return axis == 1 || axis == -2; }
+
+bool is_token_axis(const ov::Output<ov::Node>& axis) {
+    const auto values = constant_values(axis);
+    return values && values->size() == 1 && is_token_axis(values->front());
+}
+
+/**
+ * @returns The output without Squeeze, Unsqueeze, Reshape, Convert and Broadcast, which only change the rank of
+ *          indices or expand them along channels
+ */
+ov::Output<ov::Node> skip_views(ov::Output<ov::Node> output) {
+    while (as<ov::op::v0::Squeeze>(output) || as<ov::op::v0::Unsqueeze>(output) || as<ov::op::v1::Reshape>(output) ||
+           as<ov::op::v0::Convert>(output) || as<ov::op::v1::Broadcast>(output) || as<ov::op::v3::Broadcast>(output)) {
+        output = output.get_node()->input_value(0);
+    }
+    return output;
+}
+
+/**
+ * Slice of tokens (axis 1) with bounds clamped to the number of tokens
+ */
+struct TokenSlice {
+    ov::Output<ov::Node> data;
+    int64_t start;
+    int64_t stop;
+    int64_t step;
+
+    /**
+     * @returns true if the slice takes every other token beginning from the given one
+     */
+    bool is_half(int64_t first) const {
+        return start == first && step == 2 && stop == static_cast<int64_t>(data.get_shape()[1]);
+    }
+};
+
+std::optional<TokenSlice> token_slice(const ov::Output<ov::Node>& output) {
+    const auto node = output.get_node_shared_ptr();
+    if (node->get_input_size() < 3 || node->get_input_partial_shape(0).is_dynamic()) {
+        return std::nullopt;
+    }
+    const auto& shape = node->get_input_shape(0);
+    if (shape.size() < 2) {
+        return std::nullopt;
+    }
+    const auto begin = constant_values(node->input_value(1));
+    const auto end = constant_values(node->input_value(2));
+    if (!begin || !end || begin->size() != end->size()) {
+        return std::nullopt;
+    }
+    std::vector<int64_t> steps(begin->size(), 1);
+    if (node->get_input_size() > 3) {
+        const auto values = constant_values(node->input_value(3));
+        if (!values || values->size() != begin->size()) {
+            return std::nullopt;
+        }
+        steps = *values;
+    }
+    int64_t start = 0;
+    int64_t stop = 0;
+    int64_t step = 0;
+    if (const auto slice = std::dynamic_pointer_cast<ov::op::v8::Slice>(node)) {
+        if (slice->get_input_size() < 5 || begin->size() != 1 || !is_token_axis(slice->input_value(4))) {
+            return std::nullopt;
+        }
+        start = begin->front();
+        stop = end->front();
+        step = steps.front();
+    } else if (const auto strided_slice = std::dynamic_pointer_cast<ov::op::v1::StridedSlice>(node)) {
+        auto mask = [](const std::vector<int64_t>& values, size_t axis) {
+            return axis < values.size() && values[axis] != 0;
+        };
+        if (begin->size() < 2 || begin->size() > shape.size()) {
+            return std::nullopt;
+        }
+        for (size_t axis = 0; axis < begin->size(); ++axis) {
+            if (mask(strided_slice->get_new_axis_mask(), axis) || mask(strided_slice->get_shrink_axis_mask(), axis) ||
+                mask(strided_slice->get_ellipsis_mask(), axis)) {
+                return std::nullopt;
+            }
+            const auto first = mask(strided_slice->get_begin_mask(), axis) ? 0 : (*begin)[axis];
+            const auto last = mask(strided_slice->get_end_mask(), axis) ? static_cast<int64_t>(shape[axis])
+                                                                         : (*end)[axis];
+            if (axis == 1) {
+                start = first;
+                stop = last;
+                step = steps[axis];
+            } else if (first != 0 || last < static_cast<int64_t>(shape[axis]) || steps[axis] != 1) {
+                return std::nullopt;
+            }
+        }
+    } else {
+        return std::nullopt;
+    }
+    if (step <= 0) {
+        return std::nullopt;
+    }
+    const auto tokens = static_cast<int64_t>(shape[1]);
+    auto clamp = [tokens](int64_t bound) {
+        return std::clamp(bound < 0 ? bound + tokens : bound, int64_t{0}, tokens);
+    };
+    return TokenSlice{node->input_value(0), clamp(start), clamp(stop), step};
+}
+
+/**
+ * Indices and the value of tokens merged by Concat of unmerged even tokens of the value and odd tokens with merged
+ * even tokens summed into them
+ */
+struct MergedTokens {
+    std::shared_ptr<ov::Node> unmerged;
+    std::shared_ptr<ov::Node> merged;
+    ov::Output<ov::Node> unmerged_index;
+    ov::Output<ov::Node> source_index;
+    ov::Output<ov::Node> destination_index;
+    ov::Output<ov::Node> value;
+};
+
+std::optional<MergedTokens> merged_tokens(const std::shared_ptr<ov::Node>& node) {
+    const auto concat = std::dynamic_pointer_cast<ov::op::v0::Concat>(node);
+    if (!concat || concat->get_input_size() != 2 || concat->is_dynamic() || concat->get_output_shape(0).size() != 3 ||
+        !is_token_axis(concat->get_axis())) {
+        return std::nullopt;
+    }
+    const auto unmerged = as<ov::op::v6::GatherElements>(concat->input_value(0));
+    const auto scatter = as<ov::op::v12::ScatterElementsUpdate>(concat->input_value(1));
+    if (!unmerged || !scatter || !is_token_axis(unmerged->get_axis()) || !is_token_axis(scatter->input_value(3)) ||
+        scatter->get_reduction() != ov::op::v12::ScatterElementsUpdate::Reduction::SUM ||
+        !scatter->get_use_init_val()) {
+        return std::nullopt;
+    }
+    const auto merged = as<ov::op::v6::GatherElements>(scatter->input_value(2));
+    if (!merged || !is_token_axis(merged->get_axis())) {
+        return std::nullopt;
+    }
+    const auto even = token_slice(unmerged->input_value(0));
+    const auto merged_even = token_slice(merged->input_value(0));
+    const auto odd = token_slice(scatter->input_value(0));
+    if (!even || !merged_even || !odd || !even->is_half(0) || !merged_even->is_half(0) || !odd->is_half(1) ||
+        merged_even->data != even->data || odd->data != even->data) {
+        return std::nullopt;
+    }
+    return MergedTokens{unmerged,
+                        scatter,
+                        skip_views(unmerged->input_value(1)),
+                        skip_views(merged->input_value(1)),
+                        skip_views(scatter->input_value(1)),
+                        even->data};
+}
+
+/**
+ * @returns true if the scores are masked by -inf in the row of the first even token (the class token)
+ */
+bool is_class_token_mask(const ov::op::v3::ScatterUpdate& mask) {
+    const auto indices = constant_values(mask.input_value(1));
+    const auto updates = as<ov::op::v0::Constant>(mask.input_value(2));
+    if (!indices || *indices != std::vector<int64_t>{0} || !updates || !is_token_axis(mask.input_value(3))) {
+        return false;
+    }
+    for (const auto value : updates->cast_vector<float>()) {
+        if (!std::isinf(value) || value > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TokenMergeFusion::TokenMergeFusion() {
+    MATCHER_SCOPE(TokenMergeFusion);
+    auto merged_x = wrap_type<ov::op::v0::Concat>();
+    auto merged_size = wrap_type<ov::op::v0::Concat>();
+    auto divide = wrap_type<ov::op::v1::Divide>({merged_x, merged_size});
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto divide_node = pattern_map.at(divide).get_node_shared_ptr();
+        const auto size_concat = pattern_map.at(merged_size).get_node_shared_ptr();
+        const auto x_tokens = merged_tokens(pattern_map.at(merged_x).get_node_shared_ptr());
+        const auto size_tokens = merged_tokens(size_concat);
+        if (divide_node->is_dynamic() || !x_tokens || !size_tokens ||
+            x_tokens->unmerged_index != size_tokens->unmerged_index ||
+            x_tokens->source_index != size_tokens->source_index ||
+            x_tokens->destination_index != size_tokens->destination_index) {
+            return false;
+        }
+        // Tokens are merged weighted by their sizes as x * size
+        const auto weighted = as<ov::op::v1::Multiply>(x_tokens->value);
+        if (!weighted) {
+            return false;
+        }
+        const auto& size = size_tokens->value;
+        const auto x = weighted->input_value(weighted->input_value(1) == size ? 0 : 1);
+        if (weighted->input_value(0) != size && weighted->input_value(1) != size) {
+            return false;
+        }
+        const auto& shape = x.get_shape();
+        if (shape.size() != 3 || shape != weighted->get_output_shape(0) ||
+            size.get_shape() != ov::Shape{shape[0], shape[1], 1}) {
+            return false;
+        }
+        const auto& element_type = x.get_element_type();
+        if (element_type != ov::element::f32 && element_type != ov::element::f16 && element_type != ov::element::bf16) {
+            return false;
+        }
+        const auto even_tokens = static_cast<int64_t>((shape[1] + 1) / 2);
+
+        // Merged even tokens and the rest of them are slices of even tokens ranked by their best scores, the rest is
+        // sorted back by positions if the class token is kept
+        const auto sources = token_slice(x_tokens->source_index);
+        if (!sources || sources->start != 0 || sources->step != 1 || sources->stop <= 0) {
+            return false;
+        }
+        const auto num_merged = sources->stop;
+        auto unmerged_index = x_tokens->unmerged_index;
+        const auto sort = as<ov::op::util::TopKBase>(unmerged_index);
+        if (sort) {
+            if (unmerged_index.get_index() != 0 || sort->get_mode() != ov::op::TopKMode::MIN || sort->get_axis() != 1) {
+                return false;
+            }
+            unmerged_index = skip_views(sort->input_value(0));
+        }
+        const auto unmerged = token_slice(unmerged_index);
+        if (!unmerged || unmerged->start != num_merged || unmerged->stop != even_tokens || unmerged->step != 1 ||
+            skip_views(unmerged->data) != skip_views(sources->data)) {
+            return false;
+        }
+        const auto ranks = skip_views(sources->data);
+        const auto rank = as<ov::op::util::TopKBase>(ranks);
+        if (!rank || ranks.get_index() != 1 || rank->get_mode() != ov::op::TopKMode::MAX ||
+            rank->get_sort_type() != ov::op::TopKSortType::SORT_VALUES || rank->get_axis() != 1 ||
+            rank->get_provided_k() != static_cast<size_t>(even_tokens)) {
+            return false;
+        }
+
+        // Destinations are the best matches of merged even tokens
+        const auto destinations = as<ov::op::v6::GatherElements>(x_tokens->destination_index);
+        if (!destinations || skip_views(destinations->input_value(1)) != x_tokens->source_index) {
+            return false;
+        }
+        const auto best = skip_views(rank->input_value(0));
+        const auto match = as<ov::op::util::TopKBase>(best);
+        if (!match || best.get_index() != 0 || skip_views(destinations->input_value(0)) != match->output(1) ||
+            match->get_mode() != ov::op::TopKMode::MAX || match->get_provided_k() != 1 || match->get_axis() != 2) {
+            return false;
+        }
+
+        // Scores are cosine similarities of even and odd tokens of the metric
+        auto scores = match->input_value(0);
+        const auto mask = as<ov::op::v3::ScatterUpdate>(scores);
+        if (mask) {
+            if (!is_class_token_mask(*mask)) {
+                return false;
+            }
+            scores = mask->input_value(0);
+        }
+        const bool class_token = mask != nullptr;
+        if (class_token != (sort != nullptr)) {
+            return false;
+        }
+        const auto product = as<ov::op::v0::MatMul>(scores);
+        if (!product || product->get_transpose_a()) {
+            return false;
+        }
+        auto odd_metric = product->input_value(1);
+        if (!product->get_transpose_b()) {
+            const auto transpose = as<ov::op::v1::Transpose>(odd_metric);
+            if (!transpose || constant_values(transpose->input_value(1)) != std::vector<int64_t>{0, 2, 1}) {
+                return false;
+            }
+            odd_metric = transpose->input_value(0);
+        }
+        const auto even_metric = token_slice(product->input_value(0));
+        const auto odd_slice = token_slice(odd_metric);
+        if (!even_metric || !odd_slice || !even_metric->is_half(0) || !odd_slice->is_half(1) ||
+            even_metric->data != odd_slice->data) {
+            return false;
+        }
+        // Metric is normalized by Divide by ReduceL2 or by NormalizeL2 fused from them
+        const auto normalize = even_metric->data.get_node_shared_ptr();
+        std::shared_ptr<ov::Node> norm;
+        if (ov::is_type<ov::op::v1::Divide>(normalize)) {
+            const auto reduce = as<ov::op::v4::ReduceL2>(normalize->input_value(1));
+            if (!reduce || !reduce->get_keep_dims() || reduce->input_value(0) != normalize->input_value(0)) {
+                return false;
+            }
+            norm = reduce;
+        } else if (ov::is_type<ov::op::v0::NormalizeL2>(normalize)) {
+            norm = normalize;
+        } else {
+            return false;
+        }
+        const auto axes = constant_values(norm->input_value(1));
+        if (!axes || (*axes != std::vector<int64_t>{-1} && *axes != std::vector<int64_t>{2})) {
+            return false;
+        }
+        const auto metric = normalize->input_value(0);
+        const auto& metric_shape = metric.get_shape();
+        if (metric_shape.size() != 3 || metric_shape[0] != shape[0] || metric_shape[1] != shape[1] ||
+            metric.get_element_type() != element_type) {
+            return false;
+        }
+
+        const auto token_merge =
+            std::make_shared<nodes::TokenMerge>(metric, x, size, static_cast<size_t>(num_merged), class_token);
+        token_merge->set_friendly_name(divide_node->get_friendly_name());
+        ov::NodeVector fused{divide_node,
+                             size_concat,
+                             pattern_map.at(merged_x).get_node_shared_ptr(),
+                             x_tokens->unmerged,
+                             x_tokens->merged,
+                             size_tokens->unmerged,
+                             size_tokens->merged,
+                             weighted,
+                             rank,
+                             match,
+                             product,
+                             normalize,
+                             norm};
+        if (mask) {
+            fused.push_back(mask);
+        }
+        ov::copy_runtime_info(fused, token_merge);
+        ov::replace_node(divide_node, {token_merge->output(0)});
+        ov::replace_node(size_concat, {token_merge->output(1)});
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(divide, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,24 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Fuses token merging (ToMe) of ViT blocks exported from bipartite_soft_matching and merge_wavg into TokenMerge:
+ * cosine similarities of even and odd tokens of the metric by MatMul of their normalized slices (optionally with
+ * the row of the class token masked by ScatterUpdate), the best match of each even token by TopK, ranks of even
+ * tokens by TopK of best scores, and weighted averages of tokens x * size and sizes merged by GatherElements of
+ * unmerged even tokens concatenated with ScatterElementsUpdate (sum) of merged ones into odd tokens, then divided
+ */
+class TokenMergeFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("TokenMergeFusion", "0");
+    TokenMergeFusion();
+};
+
+}  // namespace ov::nvidia_gpu::pass
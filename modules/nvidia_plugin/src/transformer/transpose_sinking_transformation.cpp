@@ -0,0 +1,278 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "transpose_sinking_transformation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/elu.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/arithmetic_reductions_keep_dims.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/logical_reduction_keep_dims.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+using Order = std::vector<size_t>;
+
+/**
+ * @returns Order of the static Transpose, if the node is such Transpose with a constant order
+ */
+std::optional<Order> getOrder(const ov::Node& node) {
+    const auto transpose = ov::as_type<const ov::op::v1::Transpose>(&node);
+    if (!transpose || transpose->is_dynamic()) {
+        return std::nullopt;
+    }
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!constant) {
+        return std::nullopt;
+    }
+    const auto values = constant->cast_vector<int64_t>();
+    // Empty order means reversal of dimensions, which is rare and isn't sunk
+    if (values.size() != transpose->get_output_shape(0).size()) {
+        return std::nullopt;
+    }
+    return Order(values.begin(), values.end());
+}
+
+bool isIdentity(const Order& order) {
+    for (size_t i = 0; i < order.size(); ++i) {
+        if (order[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Order inverse(const Order& order) {
+    Order inversed(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        inversed[order[i]] = i;
+    }
+    return inversed;
+}
+
+std::shared_ptr<ov::Node> makeTranspose(const ov::Output<ov::Node>& input, const Order& order) {
+    return std::make_shared<ov::op::v1::Transpose>(
+        input, ov::op::v0::Constant::create(ov::element::i64, ov::Shape{order.size()}, order));
+}
+
+/**
+ * Operation computes each output element from the input element with the same index
+ */
+bool isLayoutAgnosticUnary(const ov::Node& node) {
+    return node.get_input_size() == 1 && node.get_output_size() == 1 &&
+           (ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(&node) || ov::is_type<ov::op::v0::Convert>(&node) ||
+            ov::is_type<ov::op::v0::Clamp>(&node) || ov::is_type<ov::op::v0::Elu>(&node) ||
+            ov::is_type<ov::op::v4::Swish>(&node));
+}
+
+/**
+ * Replaces the node by the Transpose of the node computed on the input of the sunk Transpose
+ */
+void replaceBySunk(const std::shared_ptr<ov::Node>& transpose,
+                   const std::shared_ptr<ov::Node>& node,
+                   const std::shared_ptr<ov::Node>& sunk,
+                   const std::optional<Order>& order) {
+    if (!order) {
+        sunk->set_friendly_name(node->get_friendly_name());
+        ov::copy_runtime_info({transpose, node}, sunk);
+        ov::replace_node(node, sunk);
+        return;
+    }
+    sunk->set_friendly_name(node->get_friendly_name() + "/before_transpose");
+    ov::copy_runtime_info(node, sunk);
+    const auto moved = makeTranspose(sunk, *order);
+    moved->set_friendly_name(node->get_friendly_name());
+    ov::copy_runtime_info(transpose, moved);
+    ov::replace_node(node, moved);
+}
+
+bool mergeWithProducer(const std::shared_ptr<ov::Node>& transpose, const Order& order) {
+    const auto producer = transpose->get_input_node_shared_ptr(0);
+    const auto producerOrder = getOrder(*producer);
+    if (!producerOrder) {
+        return false;
+    }
+    Order merged(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        merged[i] = (*producerOrder)[order[i]];
+    }
+    const auto input = producer->input_value(0);
+    if (isIdentity(merged)) {
+        return ov::replace_output_update_name(transpose->output(0), input);
+    }
+    const auto mergedTranspose = makeTranspose(input, merged);
+    mergedTranspose->set_friendly_name(transpose->get_friendly_name());
+    ov::copy_runtime_info({producer, transpose}, mergedTranspose);
+    ov::replace_node(transpose, mergedTranspose);
+    return true;
+}
+
+bool sinkThroughUnary(const std::shared_ptr<ov::Node>& transpose,
+                      const Order& order,
+                      const std::shared_ptr<ov::Node>& unary) {
+    const auto sunk = unary->clone_with_new_inputs({transpose->input_value(0)});
+    replaceBySunk(transpose, unary, sunk, order);
+    return true;
+}
+
+/**
+ * Other input of the binary operation is either transposed in the same order or is a constant, which is transposed
+ * in the inverse order at compile time
+ */
+bool sinkThroughBinary(const std::shared_ptr<ov::Node>& transpose,
+                       const Order& order,
+                       const std::shared_ptr<ov::Node>& binary,
+                       size_t inputIndex) {
+    const auto& broadcast = binary->get_autob().m_type;
+    if (binary->is_dynamic() || binary->get_output_shape(0) != transpose->get_output_shape(0) ||
+        (broadcast != ov::op::AutoBroadcastType::NUMPY && broadcast != ov::op::AutoBroadcastType::NONE)) {
+        return false;
+    }
+    const auto other = binary->input_value(1 - inputIndex);
+    const auto otherNode = other.get_node_shared_ptr();
+    ov::Output<ov::Node> sunkOther;
+    if (getOrder(*otherNode) == order && otherNode->get_output_target_inputs(0).size() == 1) {
+        sunkOther = otherNode->input_value(0);
+    } else if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(otherNode)) {
+        auto shape = constant->get_shape();
+        if (ov::shape_size(shape) == 1) {
+            // Scalar is broadcast in any order
+            sunkOther = other;
+        } else {
+            // Rank of the constant doesn't exceed the rank of the output, which is the shape of the transposed data
+            shape.insert(shape.begin(), order.size() - shape.size(), 1);
+            const auto reshaped = std::make_shared<ov::op::v0::Constant>(*constant, shape);
+            const auto transposed = makeTranspose(reshaped, inverse(order));
+            ov::OutputVector folded(1);
+            if (!transposed->constant_fold(folded, transposed->input_values())) {
+                return false;
+            }
+            sunkOther = folded[0];
+            ov::copy_runtime_info(constant, sunkOther.get_node_shared_ptr());
+        }
+    } else {
+        return false;
+    }
+    ov::OutputVector inputs(2);
+    inputs[inputIndex] = transpose->input_value(0);
+    inputs[1 - inputIndex] = sunkOther;
+    const auto sunk = binary->clone_with_new_inputs(inputs);
+    replaceBySunk(transpose, binary, sunk, order);
+    return true;
+}
+
+/**
+ * Reduction of the transposed data is the reduction of the original axes followed by the transpose of the kept
+ * dimensions, which is omitted if their order isn't changed
+ */
+bool sinkThroughReduction(const std::shared_ptr<ov::Node>& transpose,
+                          const Order& order,
+                          const std::shared_ptr<ov::Node>& reduction) {
+    bool keepDims = false;
+    if (const auto arithmetic = ov::as_type_ptr<ov::op::util::ArithmeticReductionKeepDims>(reduction)) {
+        keepDims = arithmetic->get_keep_dims();
+    } else if (const auto logical = ov::as_type_ptr<ov::op::util::LogicalReductionKeepDims>(reduction)) {
+        keepDims = logical->get_keep_dims();
+    } else {
+        return false;
+    }
+    const auto axesConstant = ov::as_type_ptr<ov::op::v0::Constant>(reduction->get_input_node_shared_ptr(1));
+    if (!axesConstant || reduction->is_dynamic()) {
+        return false;
+    }
+    const auto rank = static_cast<int64_t>(order.size());
+    std::vector<bool> isReduced(order.size(), false);
+    std::vector<int64_t> axes;
+    for (auto axis : axesConstant->cast_vector<int64_t>()) {
+        if (axis < -rank || axis >= rank) {
+            return false;
+        }
+        axis = axis < 0 ? axis + rank : axis;
+        isReduced[axis] = true;
+        axes.push_back(static_cast<int64_t>(order[axis]));
+    }
+    const auto sunk = reduction->clone_with_new_inputs(
+        {transpose->input_value(0), ov::op::v0::Constant::create(ov::element::i64, ov::Shape{axes.size()}, axes)});
+    Order kept;
+    if (keepDims) {
+        kept = order;
+    } else {
+        // Kept dimensions of the input in the order of the output are renumbered in the order of the input
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (!isReduced[i]) {
+                kept.push_back(order[i]);
+            }
+        }
+        auto sorted = kept;
+        std::sort(sorted.begin(), sorted.end());
+        for (auto& dim : kept) {
+            dim = std::lower_bound(sorted.begin(), sorted.end(), dim) - sorted.begin();
+        }
+    }
+    replaceBySunk(transpose, reduction, sunk, isIdentity(kept) ? std::nullopt : std::make_optional(kept));
+    return true;
+}
+
+bool rewrite(const std::shared_ptr<ov::Node>& transpose) {
+    const auto order = getOrder(*transpose);
+    if (!order) {
+        return false;
+    }
+    if (isIdentity(*order)) {
+        return ov::replace_output_update_name(transpose->output(0), transpose->input_value(0));
+    }
+    if (mergeWithProducer(transpose, *order)) {
+        return true;
+    }
+    const auto consumers = transpose->get_output_target_inputs(0);
+    if (consumers.size() != 1) {
+        return false;
+    }
+    const auto& consumer = *consumers.begin();
+    const auto node = consumer.get_node()->shared_from_this();
+    if (isLayoutAgnosticUnary(*node)) {
+        return sinkThroughUnary(transpose, *order, node);
+    }
+    if (ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node)) {
+        return sinkThroughBinary(transpose, *order, node, consumer.get_index());
+    }
+    if (consumer.get_index() == 0) {
+        return sinkThroughReduction(transpose, *order, node);
+    }
+    return false;
+}
+
+}  // namespace
+
+bool TransposeSinkingTransformation::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(TransposeSinkingTransformation);
+    bool updated = false;
+    // Each rewrite changes the graph, so it is traversed again until there is nothing to rewrite
+    for (bool rewritten = true; rewritten;) {
+        rewritten = false;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (rewrite(op)) {
+                rewritten = updated = true;
+                break;
+            }
+        }
+    }
+    return updated;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,24 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Pushes Transposes with constant orders down through layout-agnostic operations (element-wise operations and
+ * Converts), merges consecutive Transposes and removes the ones with identity orders. Reductions absorb Transposes
+ * of their inputs by reducing the original axes, so that the remaining Transpose is applied to the smaller output
+ * or vanishes. Transposes which stop on MatMul or convolutions are absorbed by TransposeMatMulTransformation and
+ * NhwcLayoutPropagation respectively
+ */
+class TransposeSinkingTransformation : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("TransposeSinkingTransformation", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
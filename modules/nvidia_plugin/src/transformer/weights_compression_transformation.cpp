@@ -0,0 +1,128 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "weights_compression_transformation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformer/nodes/compressed_matmul.hpp"
+#include "transformer/nodes/fully_connected.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+QuantizedWeights quantize_weights(const ov::op::v0::Constant& constant,
+                                  bool transpose_b,
+                                  const ov::element::Type& weights_type,
+                                  const ov::element::Type& scales_type) {
+    const auto& shape = constant.get_output_shape(0);
+    const size_t n = transpose_b ? shape[0] : shape[1];
+    const size_t k = transpose_b ? shape[1] : shape[0];
+    const auto values = constant.cast_vector<float>();
+    auto value = [&](size_t in, size_t ik) { return transpose_b ? values[in * k + ik] : values[ik * n + in]; };
+
+    const bool is_i4 = weights_type == ov::element::i4;
+    const float max_quantized = is_i4 ? 7.0f : 127.0f;
+    const size_t row_size = is_i4 ? (k + 1) / 2 : k;
+    std::vector<float> scales(n);
+    std::vector<uint8_t> quantized(n * row_size, 0);
+    for (size_t in = 0; in < n; ++in) {
+        float max_abs = 0.0f;
+        for (size_t ik = 0; ik < k; ++ik) {
+            max_abs = std::max(max_abs, std::abs(value(in, ik)));
+        }
+        const float scale = max_abs > 0.0f ? max_abs / max_quantized : 1.0f;
+        scales[in] = scale;
+        for (size_t ik = 0; ik < k; ++ik) {
+            const auto q = static_cast<int8_t>(
+                std::clamp(std::nearbyint(value(in, ik) / scale), -max_quantized, max_quantized));
+            auto& byte = quantized[in * row_size + (is_i4 ? ik / 2 : ik)];
+            if (is_i4) {
+                byte |= (static_cast<uint8_t>(q) & 0x0F) << ((ik % 2) * 4);
+            } else {
+                byte = static_cast<uint8_t>(q);
+            }
+        }
+    }
+    return {std::make_shared<ov::op::v0::Constant>(
+                is_i4 ? ov::element::u8 : ov::element::i8, ov::Shape{n, row_size}, quantized.data()),
+            ov::op::v0::Constant::create(scales_type, ov::Shape{n}, scales)};
+}
+
+namespace {
+
+bool is_compressible(const ov::Node& node) {
+    if (node.is_dynamic()) {
+        return false;
+    }
+    const auto& element_type = node.get_input_element_type(0);
+    if ((element_type != ov::element::f32 && element_type != ov::element::f16) ||
+        node.get_input_element_type(1) != element_type) {
+        return false;
+    }
+    const auto weights = std::dynamic_pointer_cast<ov::op::v0::Constant>(node.get_input_node_shared_ptr(1));
+    if (!weights || weights->get_output_shape(0).size() != 2 ||
+        ov::shape_size(weights->get_output_shape(0)) < WeightsCompressionTransformation::min_compressed_weights_size) {
+        return false;
+    }
+    if (node.get_input_size() == 3 &&
+        ov::shape_size(node.get_input_shape(2)) != ov::shape_size(node.get_output_shape(0))) {
+        return false;
+    }
+    return node.get_input_shape(0).size() >= 1;
+}
+
+template <typename TOperation>
+bool compress_weights(const std::shared_ptr<ov::Node>& node, const ov::element::Type& weights_type) {
+    const auto op = std::dynamic_pointer_cast<TOperation>(node);
+    if (!op || op->get_transpose_a() || !is_compressible(*op)) {
+        return false;
+    }
+    const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op->get_input_node_shared_ptr(1));
+    const auto quantized =
+        quantize_weights(*constant, op->get_transpose_b(), weights_type, op->get_input_element_type(0));
+    quantized.weights->set_friendly_name(constant->get_friendly_name() + "/compressed");
+    quantized.scales->set_friendly_name(constant->get_friendly_name() + "/scales");
+
+    std::shared_ptr<nodes::CompressedMatMul> compressed;
+    if (op->get_input_size() == 3) {
+        compressed = std::make_shared<nodes::CompressedMatMul>(op->get_input_source_output(0),
+                                                               quantized.weights,
+                                                               quantized.scales,
+                                                               op->get_input_source_output(2),
+                                                               weights_type);
+    } else {
+        compressed = std::make_shared<nodes::CompressedMatMul>(
+            op->get_input_source_output(0), quantized.weights, quantized.scales, weights_type);
+    }
+    compressed->set_friendly_name(op->get_friendly_name());
+    ov::copy_runtime_info({constant, op}, {quantized.weights, quantized.scales, compressed});
+    ov::replace_node(op, compressed);
+    return true;
+}
+
+}  // namespace
+
+WeightsCompressionTransformation::WeightsCompressionTransformation(const ov::element::Type& weights_type) {
+    MATCHER_SCOPE(WeightsCompressionTransformation);
+    auto matmul = wrap_type<ov::op::v0::MatMul, nodes::FullyConnected>();
+
+    matcher_pass_callback callback = [weights_type](Matcher& m) {
+        const auto node = m.get_match_root();
+        return compress_weights<ov::op::v0::MatMul>(node, weights_type) ||
+               compress_weights<nodes::FullyConnected>(node, weights_type);
+    };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,41 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/constant.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+struct QuantizedWeights {
+    std::shared_ptr<ov::op::v0::Constant> weights;
+    std::shared_ptr<ov::op::v0::Constant> scales;
+};
+
+/**
+ * Quantizes 2D MatMul weights symmetrically with a scale per output channel
+ * @param transpose_b Weights are [N, K] if true, [K, N] otherwise
+ * @param weights_type i8 or i4 (two values per byte)
+ * @returns Quantized weights [N, K] (or [N, (K + 1) / 2] u8 for i4) and scales [N] of the scales type
+ */
+QuantizedWeights quantize_weights(const ov::op::v0::Constant& constant,
+                                  bool transpose_b,
+                                  const ov::element::Type& weights_type,
+                                  const ov::element::Type& scales_type);
+
+/**
+ * Replaces MatMul and FullyConnected with large constant weights by CompressedMatMul,
+ * which keeps weights quantized to the given element type (i8 or i4) with per output channel scales
+ */
+class WeightsCompressionTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("WeightsCompressionTransformation", "0");
+    explicit WeightsCompressionTransformation(const ov::element::Type& weights_type);
+
+    // Smaller weights don't take noticeable memory, so they aren't worth losing precision
+    static constexpr size_t min_compressed_weights_size = 65536;
+};
+
+}  // namespace ov::nvidia_gpu::pass
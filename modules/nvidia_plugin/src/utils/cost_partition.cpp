@@ -0,0 +1,263 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_partition.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/result.hpp>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::nvidia_gpu::utils {
+
+namespace {
+
+constexpr double kEpsilonSeconds = 1e-9;
+
+bool isConstant(const ov::Node& node) { return ov::is_type<ov::op::v0::Constant>(&node); }
+
+bool isHost(const ov::Node& node) {
+    return ov::is_type<ov::op::v0::Parameter>(&node) || ov::is_type<ov::op::v0::Result>(&node);
+}
+
+double tensorBytes(const ov::Output<ov::Node>& output) {
+    if (output.get_partial_shape().is_dynamic()) {
+        return 0;
+    }
+    return static_cast<double>(ov::shape_size(output.get_shape()) * output.get_element_type().size());
+}
+
+/**
+ * Placement of operations of the model and estimated latency of its sequential execution
+ */
+class Partition {
+public:
+    Partition(const ov::Model& model, const std::unordered_set<std::string>& supported, const PartitionCosts& costs)
+        : costs_{costs} {
+        for (const auto& node : model.get_ordered_ops()) {
+            if (isConstant(*node)) {
+                continue;
+            }
+            const auto index = nodes_.size();
+            indices_.emplace(node.get(), index);
+            nodes_.push_back(node.get());
+            movable_.push_back(!isHost(*node) && supported.count(node->get_friendly_name()) > 0);
+            onGpu_.push_back(movable_.back());
+            gpuSeconds_.push_back(movable_.back() ? costs.gpuSeconds(*node) : 0);
+            cpuSeconds_.push_back(isHost(*node) ? 0 : costs.cpuSeconds(*node));
+        }
+    }
+
+    double total() const {
+        double seconds = 0;
+        for (std::size_t i = 0; i < nodes_.size(); ++i) {
+            seconds += executionSeconds(i);
+            for (const auto& output : nodes_[i]->outputs()) {
+                seconds += crossingSeconds(output);
+            }
+        }
+        return seconds;
+    }
+
+    /**
+     * Moves operations on the boundary of device subgraphs one by one while the latency decreases
+     * @returns true if any operation is moved
+     */
+    bool refineBoundaries() {
+        bool moved = false;
+        for (bool improved = true; improved;) {
+            improved = false;
+            for (std::size_t i = 0; i < nodes_.size(); ++i) {
+                if (!movable_[i]) {
+                    continue;
+                }
+                const auto before = localSeconds(i);
+                onGpu_[i] = !onGpu_[i];
+                if (localSeconds(i) < before - kEpsilonSeconds) {
+                    improved = moved = true;
+                } else {
+                    onGpu_[i] = !onGpu_[i];
+                }
+            }
+        }
+        return moved;
+    }
+
+    /**
+     * Moves whole device subgraphs to CPU if it decreases the latency
+     * @returns true if any subgraph is moved
+     */
+    bool moveSubgraphs() {
+        bool moved = false;
+        for (const auto& subgraph : gpuSubgraphs()) {
+            const auto before = total();
+            for (const auto i : subgraph) {
+                onGpu_[i] = false;
+            }
+            if (total() < before - kEpsilonSeconds) {
+                moved = true;
+            } else {
+                for (const auto i : subgraph) {
+                    onGpu_[i] = true;
+                }
+            }
+        }
+        return moved;
+    }
+
+    std::unordered_set<std::string> gpuNodes(const ov::Model& model) const {
+        std::unordered_set<std::string> result;
+        for (std::size_t i = 0; i < nodes_.size(); ++i) {
+            if (onGpu_[i]) {
+                result.insert(nodes_[i]->get_friendly_name());
+            }
+        }
+        // Parameters, results and constants stay with the device if it executes all their neighbours
+        auto allOnGpu = [&](const std::vector<ov::Node*>& neighbours) {
+            return !neighbours.empty() && std::all_of(neighbours.begin(), neighbours.end(), [&](ov::Node* node) {
+                return result.count(node->get_friendly_name()) > 0;
+            });
+        };
+        std::unordered_set<std::string> boundary;
+        for (const auto& node : model.get_ordered_ops()) {
+            std::vector<ov::Node*> neighbours;
+            if (ov::is_type<ov::op::v0::Result>(node)) {
+                neighbours.push_back(node->get_input_node_ptr(0));
+            } else if (ov::is_type<ov::op::v0::Parameter>(node) || isConstant(*node)) {
+                for (const auto& input : node->output(0).get_target_inputs()) {
+                    neighbours.push_back(input.get_node());
+                }
+            } else {
+                continue;
+            }
+            if (allOnGpu(neighbours)) {
+                boundary.insert(node->get_friendly_name());
+            }
+        }
+        result.insert(boundary.begin(), boundary.end());
+        return result;
+    }
+
+private:
+    std::optional<std::size_t> indexOf(const ov::Node* node) const {
+        const auto it = indices_.find(node);
+        return it == indices_.end() ? std::nullopt : std::optional<std::size_t>{it->second};
+    }
+
+    double executionSeconds(std::size_t i) const { return onGpu_[i] ? gpuSeconds_[i] : cpuSeconds_[i]; }
+
+    /**
+     * @returns Time of the transfer of the tensor, if any of its consumers is on the other side of the boundary
+     */
+    double crossingSeconds(const ov::Output<ov::Node>& output) const {
+        const auto producer = indexOf(output.get_node());
+        if (!producer) {
+            return 0;
+        }
+        for (const auto& input : output.get_target_inputs()) {
+            const auto consumer = indexOf(input.get_node());
+            if (consumer && onGpu_[*consumer] != onGpu_[*producer]) {
+                return costs_.transferSeconds(tensorBytes(output));
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @returns Execution time of the operation and transfer times of tensors it produces and consumes
+     */
+    double localSeconds(std::size_t i) const {
+        double seconds = executionSeconds(i);
+        for (const auto& output : nodes_[i]->outputs()) {
+            seconds += crossingSeconds(output);
+        }
+        for (const auto& input : nodes_[i]->inputs()) {
+            seconds += crossingSeconds(input.get_source_output());
+        }
+        return seconds;
+    }
+
+    /**
+     * @returns Connected subgraphs of operations on the device
+     */
+    std::vector<std::vector<std::size_t>> gpuSubgraphs() const {
+        std::vector<std::vector<std::size_t>> subgraphs;
+        std::vector<bool> visited(nodes_.size(), false);
+        for (std::size_t start = 0; start < nodes_.size(); ++start) {
+            if (!onGpu_[start] || visited[start]) {
+                continue;
+            }
+            std::vector<std::size_t> subgraph;
+            std::vector<std::size_t> stack{start};
+            visited[start] = true;
+            while (!stack.empty()) {
+                const auto i = stack.back();
+                stack.pop_back();
+                subgraph.push_back(i);
+                auto visit = [&](const ov::Node* node) {
+                    const auto j = indexOf(node);
+                    if (j && onGpu_[*j] && !visited[*j]) {
+                        visited[*j] = true;
+                        stack.push_back(*j);
+                    }
+                };
+                for (const auto& input : nodes_[i]->inputs()) {
+                    visit(input.get_source_output().get_node());
+                }
+                for (const auto& output : nodes_[i]->outputs()) {
+                    for (const auto& input : output.get_target_inputs()) {
+                        visit(input.get_node());
+                    }
+                }
+            }
+            subgraphs.push_back(std::move(subgraph));
+        }
+        return subgraphs;
+    }
+
+    const PartitionCosts& costs_;
+    std::vector<ov::Node*> nodes_;
+    std::unordered_map<const ov::Node*, std::size_t> indices_;
+    std::vector<bool> movable_;
+    std::vector<bool> onGpu_;
+    std::vector<double> gpuSeconds_;
+    std::vector<double> cpuSeconds_;
+};
+
+}  // namespace
+
+PartitionCosts::PartitionCosts(const cudaDeviceProp& props)
+    : gpu{props}, cpuFlopsPerSecond{std::max(1u, std::thread::hardware_concurrency()) * 16 * 2.5e9} {}
+
+double PartitionCosts::gpuSeconds(const ov::Node& node) const {
+    return gpuLaunchSeconds +
+           std::max(estimateFlops(node) / gpu.flopsPerSecond, estimateBytes(node) / gpu.bytesPerSecond);
+}
+
+double PartitionCosts::cpuSeconds(const ov::Node& node) const {
+    return std::max(estimateFlops(node) / cpuFlopsPerSecond, estimateBytes(node) / cpuBytesPerSecond);
+}
+
+double PartitionCosts::transferSeconds(const double bytes) const {
+    return transferLatencySeconds + bytes / transferBytesPerSecond;
+}
+
+std::unordered_set<std::string> partitionByCost(const ov::Model& model,
+                                                const std::unordered_set<std::string>& supported,
+                                                const PartitionCosts& costs) {
+    Partition partition{model, supported, costs};
+    // Each accepted move strictly decreases the latency, so the search terminates
+    for (bool moved = true; moved;) {
+        moved = partition.refineBoundaries();
+        moved = partition.moveSubgraphs() || moved;
+    }
+    return partition.gpuNodes(model);
+}
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <openvino/core/model.hpp>
+#include <string>
+#include <unordered_set>
+
+#include "roofline.hpp"
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @brief Rough costs of execution of operations on the device and on CPU and of transfers between them,
+ *        which a partition of the model between the device and CPU is chosen by (see partitionByCost)
+ */
+struct PartitionCosts {
+    DevicePeak gpu;
+    // Overhead of launching an operation on the device, which dominates tiny operations
+    double gpuLaunchSeconds = 5e-6;
+    double cpuFlopsPerSecond;
+    double cpuBytesPerSecond = 20e9;
+    // Effective bandwidth and latency of a copy between host and device memory over PCIe
+    double transferBytesPerSecond = 12e9;
+    double transferLatencySeconds = 10e-6;
+
+    /**
+     * CPU peak is estimated from the number of hardware threads with 8-wide FMA at 2.5 GHz
+     */
+    explicit PartitionCosts(const cudaDeviceProp& props);
+
+    double gpuSeconds(const ov::Node& node) const;
+    double cpuSeconds(const ov::Node& node) const;
+    double transferSeconds(double bytes) const;
+};
+
+/**
+ * @brief Chooses operations of the model executed on the device, so that estimated latency of sequential execution
+ *        of the model including transfers of tensors crossing the boundary between the device and CPU is minimal
+ *
+ * Starting with all supported operations on the device, operations on the boundary of device subgraphs are moved
+ * one by one and whole device subgraphs are moved to CPU (or back) while the estimated latency decreases. So tiny
+ * operations whose launches and transfers cost more than their execution on CPU are left to CPU, and subgraphs
+ * are cut at tensors, which are cheap to transfer. Parameters and results are in host memory, constants follow
+ * their consumers and are never transferred.
+ * @param supported Friendly names of operations the device can execute
+ * @returns Friendly names of operations, which are executed on the device, a subset of supported ones
+ */
+std::unordered_set<std::string> partitionByCost(const ov::Model& model,
+                                                const std::unordered_set<std::string>& supported,
+                                                const PartitionCosts& costs);
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,103 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov::nvidia_gpu::utils {
+
+std::size_t LatencyHistogram::bucketIndex(const std::uint64_t latency) {
+    if (latency < kSubBuckets) {
+        return latency;
+    }
+    unsigned exponent = 0;
+    while ((latency >> exponent) > 1) {
+        ++exponent;
+    }
+    const auto shift = exponent - kSubBucketBits;
+    const auto subBucket = (latency >> shift) & (kSubBuckets - 1);
+    return (shift + 1) * kSubBuckets + subBucket;
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(const std::size_t index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    const auto shift = index / kSubBuckets - 1;
+    const auto lower = (kSubBuckets + index % kSubBuckets) << shift;
+    return lower + (std::uint64_t{1} << shift) - 1;
+}
+
+void LatencyHistogram::record(const Duration latency) {
+    const auto value = static_cast<std::uint64_t>(std::max<Duration::rep>(latency.count(), 0));
+    const auto index = bucketIndex(value);
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (buckets_.size() <= index) {
+        buckets_.resize(index + 1);
+    }
+    ++buckets_[index];
+    ++count_;
+    max_ = std::max(max_, value);
+}
+
+std::uint64_t LatencyHistogram::count() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return count_;
+}
+
+LatencyHistogram::Duration LatencyHistogram::max() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return Duration{max_};
+}
+
+LatencyHistogram::Duration LatencyHistogram::percentile(const double fraction) const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return percentileUnlocked(fraction);
+}
+
+std::vector<std::uint64_t> LatencyHistogram::summary() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (count_ == 0) {
+        return {};
+    }
+    return {static_cast<std::uint64_t>(percentileUnlocked(0.5).count()),
+            static_cast<std::uint64_t>(percentileUnlocked(0.9).count()),
+            static_cast<std::uint64_t>(percentileUnlocked(0.99).count()),
+            max_};
+}
+
+LatencyHistogram::Duration LatencyHistogram::percentileUnlocked(const double fraction) const {
+    if (count_ == 0) {
+        return Duration{0};
+    }
+    const auto rank = std::max<std::uint64_t>(static_cast<std::uint64_t>(std::ceil(fraction * count_)), 1);
+    std::uint64_t seen = 0;
+    for (std::size_t index = 0; index < buckets_.size(); ++index) {
+        seen += buckets_[index];
+        if (seen >= rank) {
+            return Duration{std::min(bucketUpperBound(index), max_)};
+        }
+    }
+    return Duration{max_};
+}
+
+LatencyHistogram& LatencyHistograms::operator[](const std::string& name) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return histograms_[name];
+}
+
+std::map<std::string, std::vector<std::uint64_t>> LatencyHistograms::summaries() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    std::map<std::string, std::vector<std::uint64_t>> result;
+    for (const auto& [name, histogram] : histograms_) {
+        if (auto summary = histogram.summary(); !summary.empty()) {
+            result.emplace(name, std::move(summary));
+        }
+    }
+    return result;
+}
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @brief Histogram of latencies in log-scaled buckets: each power of two is split into kSubBuckets buckets,
+ * so percentiles are reported with relative error below 1 / kSubBuckets and memory grows only with log of
+ * the maximal latency. Latencies are recorded concurrently by infer requests of the same compiled model
+ */
+class LatencyHistogram {
+public:
+    using Duration = std::chrono::microseconds;
+
+    static constexpr unsigned kSubBucketBits = 3;
+    static constexpr std::uint64_t kSubBuckets = 1u << kSubBucketBits;
+
+    void record(Duration latency);
+
+    std::uint64_t count() const;
+    Duration max() const;
+
+    /**
+     * @param fraction Fraction of recorded latencies in (0, 1], e.g. 0.99 for p99
+     * @returns Upper bound of the bucket of the percentile, which doesn't exceed the maximal latency
+     */
+    Duration percentile(double fraction) const;
+
+    /**
+     * @returns p50, p90, p99 and maximal latency in microseconds, empty if nothing is recorded
+     */
+    std::vector<std::uint64_t> summary() const;
+
+    static std::size_t bucketIndex(std::uint64_t latency);
+    static std::uint64_t bucketUpperBound(std::size_t index);
+
+private:
+    Duration percentileUnlocked(double fraction) const;
+
+    mutable std::mutex mtx_;
+    std::vector<std::uint64_t> buckets_;
+    std::uint64_t count_ = 0;
+    std::uint64_t max_ = 0;
+};
+
+/**
+ * @brief Histograms of latencies by name (e.g. stages of inferences)
+ */
+class LatencyHistograms {
+public:
+    /**
+     * @returns Histogram of the name, which is created on first use and lives as long as this object
+     */
+    LatencyHistogram& operator[](const std::string& name);
+
+    /**
+     * @returns LatencyHistogram::summary() of histograms which have recorded latencies
+     */
+    std::map<std::string, std::vector<std::uint64_t>> summaries() const;
+
+private:
+    mutable std::mutex mtx_;
+    std::map<std::string, LatencyHistogram> histograms_;
+};
+
+}  // namespace ov::nvidia_gpu::utils
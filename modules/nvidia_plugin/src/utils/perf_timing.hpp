@@ -11,40 +11,86 @@
 namespace ov::nvidia_gpu::utils {
 /**
  * @brief class PerformaceTiming measures time between two events
- * and accumulates results from sequential start/stop calls
+ * and accumulates results from sequential start/stop calls.
+ * Events are created on first record and recorded again by following measurements,
+ * so profiled inferences don't create and destroy events of each operation
  */
 class PerformaceTiming {
 public:
     PerformaceTiming() = default;
-    PerformaceTiming(const CUDA::Stream& stream, CUDA::Event::RecordMode mode = CUDA::Event::RecordMode::Default)
-        : start_{CUDA::Event{}} {
-        start_->record(stream, mode);
+    PerformaceTiming(const CUDA::Stream& stream, CUDA::Event::RecordMode mode = CUDA::Event::RecordMode::Default) {
+        setStart(stream, mode);
     }
     void setStart(const CUDA::Stream& stream, CUDA::Event::RecordMode mode = CUDA::Event::RecordMode::Default) {
-        start_.emplace(CUDA::Event{}.record(stream, mode));
+        record(start_, stream, mode);
+        started_ = true;
     }
     void setStop(const CUDA::Stream& stream, CUDA::Event::RecordMode mode = CUDA::Event::RecordMode::Default) {
-        stop_.emplace(CUDA::Event{}.record(stream, mode));
+        record(stop_, stream, mode);
+        stopped_ = true;
     }
-    float measure() {
-        if (start_.has_value() && stop_.has_value()) {
+    /**
+     * @param keep_events Events are kept if nodes of a captured CUDA graph record them again on each launch
+     */
+    float measure(bool keep_events = false) {
+        if (started_ && stopped_) {
             auto elapsed = stop_->elapsedSince(*start_);
             if (elapsed != std::numeric_limits<float>::quiet_NaN()) {
                 duration_ += stop_->elapsedSince(*start_);
             }
         }
-        clear();
+        if (!keep_events) {
+            clear();
+        }
         return duration_;
     }
     float duration() const noexcept { return duration_; }
+    /**
+     * @returns Time in ms from the start of the reference measurement to the start of this one,
+     *          std::nullopt if either of them isn't recorded
+     */
+    std::optional<float> startedSince(const PerformaceTiming& reference) const {
+        if (!started_ || !reference.started_) {
+            return std::nullopt;
+        }
+        return start_->elapsedSince(*reference.start_);
+    }
+    /**
+     * @returns Time in ms of the recorded measurement, std::nullopt if it isn't recorded
+     */
+    std::optional<float> elapsed() const {
+        if (!started_ || !stopped_) {
+            return std::nullopt;
+        }
+        return stop_->elapsedSince(*start_);
+    }
+    /**
+     * Forgets the recorded measurement, events are kept to be recorded again
+     */
     void clear() {
-        start_.reset();
-        stop_.reset();
+        started_ = false;
+        stopped_ = false;
+    }
+    /**
+     * Forgets the recorded measurement and the accumulated time, so the timing may be reused by another measurement
+     */
+    void reset() {
+        clear();
+        duration_ = 0;
     }
 
 private:
+    static void record(std::optional<CUDA::Event>& event, const CUDA::Stream& stream, CUDA::Event::RecordMode mode) {
+        if (!event.has_value()) {
+            event.emplace();
+        }
+        event->record(stream, mode);
+    }
+
     std::optional<CUDA::Event> start_{};
     std::optional<CUDA::Event> stop_{};
+    bool started_{};
+    bool stopped_{};
     float duration_{};
 };
 }  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,136 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_conversion.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <openvino/core/except.hpp>
+#include <openvino/core/type/float16.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define NVIDIA_GPU_HAS_F16C_DISPATCH 1
+#endif
+
+namespace ov::nvidia_gpu::utils {
+
+namespace {
+
+void f32ToF16Scalar(const float* src, ov::float16* dst, const std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = ov::float16{src[i]};
+    }
+}
+
+void f16ToF32Scalar(const ov::float16* src, float* dst, const std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+#ifdef NVIDIA_GPU_HAS_F16C_DISPATCH
+// The plugin isn't built for F16C, so the instructions are enabled for these functions only and dispatched at runtime
+__attribute__((target("avx,f16c"))) void f32ToF16F16c(const float* src, ov::float16* dst, const std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m128i values = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), values);
+    }
+    f32ToF16Scalar(src + i, dst + i, size - i);
+}
+
+__attribute__((target("avx,f16c"))) void f16ToF32F16c(const ov::float16* src, float* dst, const std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(values));
+    }
+    f16ToF32Scalar(src + i, dst + i, size - i);
+}
+
+bool hasF16c() {
+    static const bool supported = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    return supported;
+}
+#endif
+
+void f32ToF16(const float* src, ov::float16* dst, const std::size_t size) {
+#ifdef NVIDIA_GPU_HAS_F16C_DISPATCH
+    if (hasF16c()) {
+        f32ToF16F16c(src, dst, size);
+        return;
+    }
+#endif
+    f32ToF16Scalar(src, dst, size);
+}
+
+void f16ToF32(const ov::float16* src, float* dst, const std::size_t size) {
+#ifdef NVIDIA_GPU_HAS_F16C_DISPATCH
+    if (hasF16c()) {
+        f16ToF32F16c(src, dst, size);
+        return;
+    }
+#endif
+    f16ToF32Scalar(src, dst, size);
+}
+
+// BF16 is the upper half of f32, so conversions are integer operations, which the compiler vectorizes
+void f32ToBf16(const float* src, std::uint16_t* dst, const std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        std::uint32_t bits;
+        std::memcpy(&bits, src + i, sizeof(bits));
+        const bool nan = (bits & 0x7FFFFFFFu) > 0x7F800000u;
+        // Rounding to the nearest even, NaNs are kept quiet NaNs instead of being rounded to infinities
+        const std::uint32_t rounded = (bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16;
+        dst[i] = static_cast<std::uint16_t>(nan ? (bits >> 16) | 0x40u : rounded);
+    }
+}
+
+void bf16ToF32(const std::uint16_t* src, float* dst, const std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        const std::uint32_t bits = static_cast<std::uint32_t>(src[i]) << 16;
+        std::memcpy(dst + i, &bits, sizeof(bits));
+    }
+}
+
+}  // namespace
+
+bool isConvertiblePrecision(const ov::element::Type from, const ov::element::Type to) {
+    const auto is_half = [](const ov::element::Type type) {
+        return type == ov::element::f16 || type == ov::element::bf16;
+    };
+    return (from == ov::element::f32 && is_half(to)) || (is_half(from) && to == ov::element::f32);
+}
+
+void convertPrecision(const ov::Tensor& src, ov::Tensor& dst) {
+    OPENVINO_ASSERT(isConvertiblePrecision(src.get_element_type(), dst.get_element_type()),
+                    "Conversion from ",
+                    src.get_element_type(),
+                    " to ",
+                    dst.get_element_type(),
+                    " isn't supported");
+    OPENVINO_ASSERT(src.get_shape() == dst.get_shape(),
+                    "Shapes ",
+                    src.get_shape(),
+                    " and ",
+                    dst.get_shape(),
+                    " of converted tensors differ");
+    OPENVINO_ASSERT(src.is_continuous() && dst.is_continuous(), "Converted tensors should be continuous");
+    const auto size = src.get_size();
+    if (src.get_element_type() == ov::element::f32) {
+        const auto* values = static_cast<const float*>(src.data());
+        if (dst.get_element_type() == ov::element::f16) {
+            f32ToF16(values, static_cast<ov::float16*>(dst.data()), size);
+        } else {
+            f32ToBf16(values, static_cast<std::uint16_t*>(dst.data()), size);
+        }
+    } else if (src.get_element_type() == ov::element::f16) {
+        f16ToF32(static_cast<const ov::float16*>(src.data()), static_cast<float*>(dst.data()), size);
+    } else {
+        bf16ToF32(static_cast<const std::uint16_t*>(src.data()), static_cast<float*>(dst.data()), size);
+    }
+}
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,23 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/type/element_type.hpp>
+#include <openvino/runtime/tensor.hpp>
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @returns true if elements of the type are converted to (from) the other one by convertPrecision
+ */
+bool isConvertiblePrecision(ov::element::Type from, ov::element::Type to);
+
+/**
+ * Converts elements of the continuous tensor between f32 and f16 (bf16) into the continuous tensor of the same shape.
+ * f32 values are rounded to the nearest even, f16 conversions use F16C instructions if the CPU supports them
+ */
+void convertPrecision(const ov::Tensor& src, ov::Tensor& dst);
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,178 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roofline.hpp"
+
+#include <algorithm>
+#include <openvino/op/ops.hpp>
+#include <openvino/op/util/arithmetic_reduction.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <openvino/op/util/binary_elementwise_comparison.hpp>
+#include <openvino/op/util/binary_elementwise_logical.hpp>
+#include <openvino/op/util/logical_reduction.hpp>
+#include <openvino/op/util/max_pool_base.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+
+#include "transformer/nodes/compressed_matmul.hpp"
+#include "transformer/nodes/fp8_matmul.hpp"
+#include "transformer/nodes/fully_connected.hpp"
+#include "transformer/nodes/fused_convolution_backprop_data.hpp"
+#include "transformer/nodes/fused_eltwise.hpp"
+#include "transformer/nodes/fused_multi_head_attention.hpp"
+#include "transformer/nodes/layer_norm.hpp"
+#include "transformer/nodes/quantized_matmul.hpp"
+
+namespace ov::nvidia_gpu::utils {
+
+namespace {
+
+int fp32CoresPerMultiprocessor(const int major, const int minor) {
+    switch (major) {
+        case 3:
+            return 192;
+        case 5:
+            return 128;
+        case 6:
+            return minor == 0 ? 64 : 128;
+        case 7:
+            return 64;
+        case 8:
+            return minor == 0 ? 64 : 128;
+        default:
+            return 128;
+    }
+}
+
+double elements(const ov::Shape& shape) { return static_cast<double>(ov::shape_size(shape)); }
+
+double matMulFlops(const ov::Node& node, const bool transposeA) {
+    const auto& a = node.get_input_shape(0);
+    if (a.empty()) {
+        return 0;
+    }
+    const auto k = a.size() > 1 && transposeA ? a[a.size() - 2] : a.back();
+    return 2.0 * elements(node.get_output_shape(0)) * k;
+}
+
+// Each element of the output takes a multiply-add per element of the filter, which contributes to it
+double convolutionFlops(const ov::Node& node, const size_t outputChannelDims) {
+    const auto& filters = node.get_input_shape(1);
+    double outputChannels = 1;
+    for (size_t i = 0; i < outputChannelDims && i < filters.size(); ++i) {
+        outputChannels *= filters[i];
+    }
+    return 2.0 * elements(node.get_output_shape(0)) * elements(filters) / outputChannels;
+}
+
+double attentionFlops(const ov::Node& node) {
+    // Q x Kt and softmax of the attention matrix [..., S, S_kv], then multiplication by V [..., S_kv, D_v]
+    const auto& q = node.get_input_shape(0);
+    const auto& v = node.get_input_shape(2);
+    if (q.empty() || v.size() < 2) {
+        return 0;
+    }
+    const double keys = v[v.size() - 2];
+    const auto queries = elements(q) / q.back();
+    return 2.0 * keys * (elements(q) + elements(node.get_output_shape(0))) + 5.0 * queries * keys;
+}
+
+bool hasStaticShapes(const ov::Node& node) {
+    for (const auto& input : node.inputs()) {
+        if (input.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+    }
+    for (const auto& output : node.outputs()) {
+        if (output.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+DevicePeak::DevicePeak(const cudaDeviceProp& props)
+    : bytesPerSecond{2.0 * props.memoryClockRate * 1e3 * props.memoryBusWidth / 8},
+      flopsPerSecond{2.0 * props.multiProcessorCount * fp32CoresPerMultiprocessor(props.major, props.minor) *
+                     props.clockRate * 1e3} {}
+
+double DevicePeak::fraction(const double flops, const double bytes, const double seconds) const {
+    // The roofline bounds time of the execution by the slowest of compute and memory transfers
+    const auto minimalSeconds = std::max(flops / flopsPerSecond, bytes / bytesPerSecond);
+    return seconds > 0 ? minimalSeconds / seconds : 0;
+}
+
+double estimateFlops(const ov::Node& node) {
+    using namespace ov::op;
+    if (!hasStaticShapes(node) || node.get_output_size() == 0) {
+        return 0;
+    }
+    const auto outputElements = elements(node.get_output_shape(0));
+    if (const auto matMul = dynamic_cast<const v0::MatMul*>(&node)) {
+        return matMulFlops(node, matMul->get_transpose_a());
+    }
+    if (const auto fullyConnected = dynamic_cast<const nodes::FullyConnected*>(&node)) {
+        return matMulFlops(node, fullyConnected->get_transpose_a());
+    }
+    if (ov::is_type<nodes::CompressedMatMul>(&node) || ov::is_type<nodes::QuantizedMatMul>(&node) ||
+        ov::is_type<nodes::Fp8MatMul>(&node)) {
+        return matMulFlops(node, false);
+    }
+    if (ov::is_type<nodes::FusedMultiHeadAttention>(&node)) {
+        return attentionFlops(node);
+    }
+    // Fused convolutions are derived from v1::Convolution and v1::GroupConvolution
+    if (ov::is_type<v1::Convolution>(&node)) {
+        return convolutionFlops(node, 1);
+    }
+    if (ov::is_type<v1::GroupConvolution>(&node)) {
+        return convolutionFlops(node, 2);
+    }
+    if (ov::is_type<v1::ConvolutionBackpropData>(&node) || ov::is_type<nodes::FusedConvBackpropData>(&node)) {
+        // Each element of the input is scattered to output channels of the filter {C_in, C_out, ...}
+        const auto& filters = node.get_input_shape(1);
+        return 2.0 * elements(node.get_input_shape(0)) * elements(filters) / filters[0];
+    }
+    if (ov::is_type<v1::Softmax>(&node) || ov::is_type<v8::Softmax>(&node) || ov::is_type<v5::LogSoftmax>(&node)) {
+        // Maximum, subtraction, exponent, sum and division per element
+        return 5.0 * outputElements;
+    }
+    if (ov::is_type<v6::MVN>(&node) || ov::is_type<nodes::LayerNorm>(&node)) {
+        // Mean, variance and normalization per element
+        return 8.0 * outputElements;
+    }
+    if (const auto maxPool = dynamic_cast<const util::MaxPoolBase*>(&node)) {
+        return outputElements * elements(maxPool->get_kernel());
+    }
+    if (const auto avgPool = dynamic_cast<const v1::AvgPool*>(&node)) {
+        return outputElements * elements(avgPool->get_kernel());
+    }
+    if (ov::is_type<util::ArithmeticReduction>(&node) || ov::is_type<util::LogicalReduction>(&node)) {
+        return elements(node.get_input_shape(0));
+    }
+    if (ov::is_type<util::UnaryElementwiseArithmetic>(&node) || ov::is_type<util::BinaryElementwiseArithmetic>(&node) ||
+        ov::is_type<util::BinaryElementwiseComparison>(&node) || ov::is_type<util::BinaryElementwiseLogical>(&node) ||
+        ov::is_type<v4::Swish>(&node) || ov::is_type<v1::Select>(&node) || ov::is_type<nodes::FusedEltwise>(&node)) {
+        return outputElements;
+    }
+    return 0;
+}
+
+double estimateBytes(const ov::Node& node) {
+    // Constants are stored in immutable memory and aren't executed
+    if (ov::is_type<ov::op::v0::Constant>(&node) || !hasStaticShapes(node)) {
+        return 0;
+    }
+    double bits = 0;
+    for (const auto& input : node.inputs()) {
+        bits += elements(input.get_shape()) * input.get_element_type().bitwidth();
+    }
+    for (const auto& output : node.outputs()) {
+        bits += elements(output.get_shape()) * output.get_element_type().bitwidth();
+    }
+    return bits / 8;
+}
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <openvino/core/node.hpp>
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @brief Theoretical throughput of the device, which achieved throughput of operations is compared with
+ */
+struct DevicePeak {
+    double bytesPerSecond;
+    // Fused multiply-adds of FP32 CUDA cores count as two operations, tensor cores may exceed the peak
+    double flopsPerSecond;
+
+    explicit DevicePeak(const cudaDeviceProp& props);
+
+    /**
+     * @returns Arithmetic intensity (FLOPs per byte), above which operations are bound by compute
+     */
+    double ridgePoint() const { return flopsPerSecond / bytesPerSecond; }
+
+    /**
+     * @returns Fraction of the roofline min(peak FLOP/s, intensity * peak bandwidth) achieved by an execution
+     */
+    double fraction(double flops, double bytes, double seconds) const;
+};
+
+/**
+ * @returns Estimated floating point operations of an execution of the node computed from its shapes,
+ *          0 for operations which only move data or have dynamic shapes
+ */
+double estimateFlops(const ov::Node& node);
+
+/**
+ * @returns Bytes of inputs and outputs of the node, which are read and written at least once by an execution,
+ *          0 for constants and nodes with dynamic shapes
+ */
+double estimateBytes(const ov::Node& node);
+
+}  // namespace ov::nvidia_gpu::utils
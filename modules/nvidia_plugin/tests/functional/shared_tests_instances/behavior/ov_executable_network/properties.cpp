@@ -5,6 +5,7 @@
 #include "behavior/ov_executable_network/properties.hpp"
 
 #include <cuda_test_constants.hpp>
+#include <limits>
 
 #include "nvidia/properties.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -69,10 +70,46 @@ const std::vector<ov::AnyMap> default_properties = {{ov::num_streams(1)},
                                                     {ov::hint::num_requests(0)},
                                                     {ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)},
                                                     {ov::hint::execution_mode(ov::hint::ExecutionMode::PERFORMANCE)},
+                                                    {ov::hint::model_priority(ov::hint::Priority::MEDIUM)},
                                                     {ov::enable_profiling(false)},
                                                     {ov::device::id("0")},
                                                     {ov::nvidia_gpu::operation_benchmark(false)},
-                                                    {ov::nvidia_gpu::use_cuda_graph(true)}};
+                                                    {ov::nvidia_gpu::use_cuda_graph(true)},
+                                                    {ov::nvidia_gpu::bind_io_tensors(false)},
+                                                    {ov::nvidia_gpu::dynamic_batch_size(1)},
+                                                    {ov::nvidia_gpu::dynamic_batch_timeout(1)},
+                                                    {ov::nvidia_gpu::multi_device_ids("")},
+                                                    {ov::nvidia_gpu::pipeline_device_ids("")},
+                                                    {ov::cache_dir("")},
+                                                    {ov::nvidia_gpu::memory_pool_idle_timeout(0)},
+                                                    {ov::nvidia_gpu::memory_pool_wait_timeout(0)},
+                                                    {ov::nvidia_gpu::latency_budget(0)},
+                                                    {ov::nvidia_gpu::memory_pool_release_threshold(
+                                                        std::numeric_limits<uint64_t>::max())},
+                                                    {ov::nvidia_gpu::memory_aware_ordering(false)},
+                                                    {ov::nvidia_gpu::memory_budget(0.0)},
+                                                    {ov::nvidia_gpu::weights_compression(ov::element::undefined)},
+                                                    {ov::nvidia_gpu::fp8_matmul(false)},
+                                                    {ov::nvidia_gpu::constants_offload(false)},
+                                                    {ov::nvidia_gpu::persistent_kernel_max_elements(0)},
+                                                    {ov::nvidia_gpu::infer_requests_refinement(false)},
+                                                    {ov::nvidia_gpu::background_tuning(false)},
+                                                    {ov::nvidia_gpu::warmup_on_compile(false)},
+                                                    {ov::nvidia_gpu::nvtx_ranges(false)},
+                                                    {ov::nvidia_gpu::trace_file("")},
+                                                    {ov::nvidia_gpu::hardware_counters(false)},
+                                                    {ov::nvidia_gpu::memory_layout_file("")},
+                                                    {ov::nvidia_gpu::skipped_outputs("")},
+                                                    {ov::nvidia_gpu::micro_batch_size(0)},
+                                                    {ov::nvidia_gpu::tile_size(0)},
+                                                    {ov::nvidia_gpu::cost_aware_query(false)},
+                                                    {ov::nvidia_gpu::mixed_precision(true)},
+                                                    {ov::nvidia_gpu::device_precision_io(false)},
+                                                    {ov::nvidia_gpu::sm_fraction(1.0f)},
+                                                    {ov::nvidia_gpu::parallel_branches(1)},
+                                                    {ov::nvidia_gpu::fast_math(false)},
+                                                    {ov::nvidia_gpu::ipc_constants_dir("")},
+                                                    {ov::nvidia_gpu::extensions("")}};
 
 INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests,
                          OVCompiledModelPropertiesDefaultTests,
@@ -85,6 +122,7 @@ const std::vector<ov::AnyMap> properties = {
     {ov::num_streams(ov::streams::AUTO)},
     {ov::hint::inference_precision(ov::element::f32)},
     {ov::hint::inference_precision(ov::element::f16)},
+    {ov::hint::inference_precision(ov::element::bf16)},
     {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)},
     {ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)},
     {ov::hint::execution_mode(ov::hint::ExecutionMode::ACCURACY)},
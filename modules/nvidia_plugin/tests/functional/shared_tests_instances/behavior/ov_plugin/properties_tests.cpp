@@ -82,6 +82,7 @@ const std::vector<ov::AnyMap> properties = {
     {ov::num_streams(ov::streams::AUTO)},
     {ov::hint::inference_precision(ov::element::f32)},
     {ov::hint::inference_precision(ov::element::f16)},
+    {ov::hint::inference_precision(ov::element::bf16)},
     {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)},
     {ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)},
     {ov::hint::execution_mode(ov::hint::ExecutionMode::ACCURACY)},
@@ -9,6 +9,7 @@
 
 #include "common_test_utils/test_constants.hpp"
 #include "cuda_test_constants.hpp"
+#include "nvidia/properties.hpp"
 
 using namespace LayerTestsDefinitions;
 using namespace ngraph::helpers;
@@ -69,6 +70,25 @@ class CUDAActivationIntegerLayerTest : public ActivationLayerTest {
     }
 };
 
+// Approximations of ov::nvidia_gpu::fast_math are within 2^-11 relative error of tanh.approx.f32
+class CUDAActivationFastMathLayerTest : public ActivationLayerTest {
+    void SetUp() override {
+        ActivationLayerTest::SetUp();
+        configuration[ov::nvidia_gpu::fast_math.name()] = "YES";
+        threshold = 2e-3f;
+    }
+};
+
+const std::map<ActivationTypes, std::vector<std::vector<float>>> fastMathActivationTypes = {
+    {Sigmoid, {}},
+    {Tanh, {}},
+    {Elu, {{0.1f}}},
+    {Mish, {}},
+    {Swish, {{0.5f}}},
+    {Gelu, {}},
+    {GeluErf, {}},
+    {GeluTanh, {}}};
+
 // List of operations that should be tested also with integer precision
 const std::map<ActivationTypes, std::vector<std::vector<float>>> intActivationTypes = {
     {Abs, {}},
@@ -129,6 +149,16 @@ const auto basicPReluConstParamCases =
                        ::testing::ValuesIn(ov::test::utils::combineParams(preluBasic)),
                        ::testing::Values(ov::test::utils::DEVICE_NVIDIA));
 
+const auto fastMathCases =
+    ::testing::Combine(::testing::ValuesIn(ov::test::utils::combineParams(fastMathActivationTypes)),
+                       ::testing::Values(InferenceEngine::Precision::FP32),
+                       ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                       ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                       ::testing::Values(InferenceEngine::Layout::ANY),
+                       ::testing::Values(InferenceEngine::Layout::ANY),
+                       ::testing::ValuesIn(ov::test::utils::combineParams(basic)),
+                       ::testing::Values(ov::test::utils::DEVICE_NVIDIA));
+
 const auto basicIntegerOperations =
     ::testing::Combine(::testing::ValuesIn(ov::test::utils::combineParams(intActivationTypes)),
                        ::testing::ValuesIn(intPrecisions),
@@ -147,6 +177,8 @@ TEST_P(ActivationDynamicLayerTest, CompareWithRefs) { Run(); }
 
 TEST_P(CUDAActivationIntegerLayerTest, CompareWithRefs) { Run(); }
 
+TEST_P(CUDAActivationFastMathLayerTest, CompareWithRefs) { Run(); }
+
 INSTANTIATE_TEST_CASE_P(smoke_Cuda_Activation_Basic,
                         ActivationLayerTest,
                         basicCases,
@@ -163,6 +195,10 @@ INSTANTIATE_TEST_CASE_P(smoke_Cuda_Activation_PRelu_Const,
                         ActivationLayerTest,
                         basicPReluConstParamCases,
                         ActivationLayerTest::getTestCaseName);
+INSTANTIATE_TEST_CASE_P(smoke_Cuda_Activation_FastMath,
+                        CUDAActivationFastMathLayerTest,
+                        fastMathCases,
+                        CUDAActivationFastMathLayerTest::getTestCaseName);
 INSTANTIATE_TEST_CASE_P(smoke_Cuda_Integer_Activation_Basic,
                         CUDAActivationIntegerLayerTest,
                         basicIntegerOperations,
@@ -0,0 +1,124 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "nvidia/properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+using CompressedMatMulParams = std::tuple<std::vector<size_t>,  // Shape of activations [..., k]
+                                          size_t,               // Number of output channels n
+                                          bool,                 // Weights are transposed [n, k]
+                                          bool,                 // Bias is added
+                                          ov::element::Type,    // Type weights are compressed to
+                                          ov::element::Type,    // Element type
+                                          std::string           // Device name
+                                          >;
+
+class CompressedMatMulTest : public testing::WithParamInterface<CompressedMatMulParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CompressedMatMulParams>& obj) {
+        std::vector<size_t> input_shape;
+        size_t n;
+        bool transpose_b;
+        bool has_bias;
+        ov::element::Type weights_type;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(input_shape, n, transpose_b, has_bias, weights_type, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(input_shape) << "_";
+        result << "N=" << n << "_";
+        result << "TB=" << transpose_b << "_";
+        result << "Bias=" << has_bias << "_";
+        result << "WT=" << weights_type << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> input_shape;
+        size_t n;
+        bool transpose_b;
+        bool has_bias;
+        ov::element::Type weights_type;
+        ov::element::Type element_type;
+        std::tie(input_shape, n, transpose_b, has_bias, weights_type, element_type, targetDevice) = GetParam();
+        configuration[ov::nvidia_gpu::weights_compression.name()] = weights_type;
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 5e-2;
+        init_input_shapes(static_shapes_to_test_representation({input_shape}));
+
+        // Each row of weights has the maximal quantized value, so the scale of the row is the power of two step
+        // and all weights are quantized exactly, which lets the result be compared with the uncompressed MatMul
+        const size_t k = input_shape.back();
+        const int max_quantized = weights_type == ov::element::i4 ? 7 : 127;
+        const float step = weights_type == ov::element::i4 ? 1.0f / 16 : 1.0f / 1024;
+        std::vector<float> weights(n * k);
+        for (size_t in = 0; in < n; ++in) {
+            for (size_t ik = 0; ik < k; ++ik) {
+                auto quantized = static_cast<int>((in * 31 + ik * 17) % (2 * max_quantized + 1)) - max_quantized;
+                if (ik == in % k) {
+                    quantized = max_quantized;
+                }
+                weights[transpose_b ? in * k + ik : ik * n + in] = quantized * step;
+            }
+        }
+        const auto weights_shape = transpose_b ? ov::Shape{n, k} : ov::Shape{k, n};
+        auto param = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{input_shape});
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v0::MatMul>(
+            param, ov::op::v0::Constant::create(element_type, weights_shape, weights), false, transpose_b);
+        if (has_bias) {
+            // Bias of the size of the output is added by the compressed MatMul
+            std::vector<float> bias(ov::shape_size(output->get_output_shape(0)));
+            for (size_t i = 0; i < bias.size(); ++i) {
+                bias[i] = static_cast<float>(i % 13) / 8 - 0.75f;
+            }
+            output = std::make_shared<ov::op::v1::Add>(
+                output, ov::op::v0::Constant::create(element_type, output->get_output_shape(0), bias));
+        }
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)}, ov::ParameterVector{param}, "MatMul");
+    }
+};
+
+TEST_P(CompressedMatMulTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("CompressedMatMul");
+}
+
+// Few rows are multiplied by the GEMV kernel reading quantized weights, more rows by cuBLAS after dequantization.
+// Odd k leaves the last byte of rows of i4 weights half filled
+const std::vector<std::vector<size_t>> input_shapes = {{1, 256}, {5, 257}, {2, 4, 1023}, {9, 512}, {3, 7, 511}};
+
+INSTANTIATE_TEST_CASE_P(smoke_CompressedMatMul,
+                        CompressedMatMulTest,
+                        ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                           ::testing::Values(size_t{257}),
+                                           ::testing::Bool(),
+                                           ::testing::Bool(),
+                                           ::testing::Values(ov::element::i8, ov::element::i4),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        CompressedMatMulTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
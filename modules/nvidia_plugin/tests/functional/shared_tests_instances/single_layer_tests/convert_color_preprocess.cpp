@@ -0,0 +1,180 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+struct ImageShape {
+    std::vector<size_t> image;    // [batch, height, width] of the decoded image
+    std::vector<size_t> resized;  // [height, width] of the resized image, empty if the image isn't resized
+};
+
+/**
+ * Creates the conversion from either a single tensor or separate planes
+ */
+template <typename ColorOp>
+std::shared_ptr<ov::Node> make_color(const ov::OutputVector& planes) {
+    auto color = std::make_shared<ColorOp>();
+    color->set_arguments(planes);
+    color->validate_and_infer_types();
+    return color;
+}
+
+using ConvertColorPreprocessParams = std::tuple<ImageShape,
+                                                bool,               // I420 instead of NV12
+                                                bool,               // Planes are stored in a single tensor
+                                                bool,               // BGR instead of RGB
+                                                bool,               // Output is transposed to NCHW
+                                                ov::element::Type,  // Element type of the output
+                                                std::string         // Device name
+                                                >;
+
+class ConvertColorPreprocessTest : public testing::WithParamInterface<ConvertColorPreprocessParams>,
+                                   public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvertColorPreprocessParams>& obj) {
+        ImageShape shape;
+        bool i420;
+        bool single_plane;
+        bool bgr;
+        bool nchw;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(shape, i420, single_plane, bgr, nchw, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(shape.image) << "_";
+        result << "Resized=" << utils::vec2str(shape.resized) << "_";
+        result << "Format=" << (i420 ? "I420" : "NV12") << "_";
+        result << "SinglePlane=" << single_plane << "_";
+        result << "BGR=" << bgr << "_";
+        result << "NCHW=" << nchw << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ImageShape shape;
+        bool i420;
+        bool single_plane;
+        bool bgr;
+        bool nchw;
+        ov::element::Type element_type;
+        std::tie(shape, i420, single_plane, bgr, nchw, element_type, targetDevice) = GetParam();
+        // Pixels of the decoded image may be rounded differently, which is off by 1 before the normalization
+        abs_threshold = 0.05;
+        input_range = 256;
+        input_start = 0;
+        input_resolution = 1;
+
+        const auto batch = shape.image[0];
+        const auto height = shape.image[1];
+        const auto width = shape.image[2];
+        std::vector<ov::Shape> plane_shapes;
+        if (single_plane) {
+            plane_shapes.push_back({batch, height * 3 / 2, width, 1});
+        } else if (i420) {
+            const ov::Shape chroma_shape{batch, height / 2, width / 2, 1};
+            plane_shapes = {{batch, height, width, 1}, chroma_shape, chroma_shape};
+        } else {
+            plane_shapes = {{batch, height, width, 1}, {batch, height / 2, width / 2, 2}};
+        }
+        init_input_shapes(static_shapes_to_test_representation(plane_shapes));
+        ov::ParameterVector params;
+        ov::OutputVector planes;
+        for (const auto& plane_shape : plane_shapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::u8, plane_shape));
+            planes.push_back(params.back());
+        }
+
+        std::shared_ptr<ov::Node> output;
+        if (i420) {
+            output = bgr ? make_color<ov::op::v8::I420toBGR>(planes) : make_color<ov::op::v8::I420toRGB>(planes);
+        } else {
+            output = bgr ? make_color<ov::op::v8::NV12toBGR>(planes) : make_color<ov::op::v8::NV12toRGB>(planes);
+        }
+        output = std::make_shared<ov::op::v0::Convert>(output, element_type);
+        if (!shape.resized.empty()) {
+            ov::op::v4::Interpolate::InterpolateAttrs attrs;
+            attrs.mode = ov::op::v4::Interpolate::InterpolateMode::LINEAR;
+            attrs.shape_calculation_mode = ov::op::v4::Interpolate::ShapeCalcMode::SIZES;
+            attrs.coordinate_transformation_mode = ov::op::v4::Interpolate::CoordinateTransformMode::HALF_PIXEL;
+            attrs.pads_begin = {0, 0, 0, 0};
+            attrs.pads_end = {0, 0, 0, 0};
+            const std::vector<float> scales{static_cast<float>(shape.resized[0]) / height,
+                                            static_cast<float>(shape.resized[1]) / width};
+            output = std::make_shared<ov::op::v4::Interpolate>(
+                output,
+                ov::op::v0::Constant::create(ov::element::i64, {2}, shape.resized),
+                ov::op::v0::Constant::create(ov::element::f32, {2}, scales),
+                ov::op::v0::Constant::create(ov::element::i64, {2}, {1, 2}),
+                attrs);
+        }
+        // Normalization by means and deviations of ImageNet per channel
+        output = std::make_shared<ov::op::v1::Subtract>(
+            output, ov::op::v0::Constant::create(element_type, {1, 1, 1, 3}, {123.675f, 116.28f, 103.53f}));
+        output = std::make_shared<ov::op::v1::Multiply>(
+            output,
+            ov::op::v0::Constant::create(element_type, {1, 1, 1, 3}, {1 / 58.395f, 1 / 57.12f, 1 / 57.375f}));
+        if (nchw) {
+            output = std::make_shared<ov::op::v1::Transpose>(
+                output, ov::op::v0::Constant::create(ov::element::i64, {4}, {0, 3, 1, 2}));
+        }
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)}, params, "ConvertColorPreprocess");
+    }
+};
+
+TEST_P(ConvertColorPreprocessTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("ConvertColorPreprocess");
+}
+
+// Odd sizes of chroma planes and of resized images leave threads of the last block idle, while images are both
+// downscaled and upscaled
+const std::vector<ImageShape> image_shapes = {
+    {{1, 8, 12}, {}},
+    {{2, 6, 10}, {}},
+    {{1, 16, 24}, {7, 13}},
+    {{2, 10, 14}, {15, 21}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ConvertColorPreprocess,
+                        ConvertColorPreprocessTest,
+                        ::testing::Combine(::testing::ValuesIn(image_shapes),
+                                           ::testing::Bool(),
+                                           ::testing::Bool(),
+                                           ::testing::Bool(),
+                                           ::testing::Bool(),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        ConvertColorPreprocessTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_tests/cum_sum.hpp"
+
+#include <cuda_test_constants.hpp>
+#include <vector>
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> precisions = {InferenceEngine::Precision::FP32,
+                                                            InferenceEngine::Precision::FP16,
+                                                            InferenceEngine::Precision::I32};
+
+// Short sequences are scanned by a thread each
+const auto shortSequences = ::testing::Combine(::testing::Values(std::vector<size_t>{2, 3, 4, 5}),
+                                               ::testing::ValuesIn(precisions),
+                                               ::testing::ValuesIn(std::vector<int64_t>{0, 1, 2, -1}),
+                                               ::testing::Bool(),
+                                               ::testing::Bool(),
+                                               ::testing::Values(ov::test::utils::DEVICE_NVIDIA));
+
+// Long sequences of few rows are scanned by tiles with decoupled look-back
+const auto longSequences = ::testing::Combine(
+    ::testing::ValuesIn(std::vector<std::vector<size_t>>{{2, 5000}, {1, 20000, 1}, {3, 4099, 2}}),
+    ::testing::Values(InferenceEngine::Precision::FP32, InferenceEngine::Precision::I32),
+    ::testing::Values(1),
+    ::testing::Bool(),
+    ::testing::Bool(),
+    ::testing::Values(ov::test::utils::DEVICE_NVIDIA));
+
+INSTANTIATE_TEST_CASE_P(smoke_CumSum_Short, CumSumLayerTest, shortSequences, CumSumLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_CumSum_Long, CumSumLayerTest, longSequences, CumSumLayerTest::getTestCaseName);
+
+}  // namespace
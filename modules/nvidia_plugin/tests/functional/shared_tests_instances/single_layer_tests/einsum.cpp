@@ -0,0 +1,37 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_tests/einsum.hpp"
+
+#include <cuda_test_constants.hpp>
+#include <vector>
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> precisions = {InferenceEngine::Precision::FP32,
+                                                            InferenceEngine::Precision::FP16};
+
+const std::vector<EinsumEquationWithInput> equationsWithInput = {
+    {"ij->ji", {{1, 2}}},                                           // permutation
+    {"ij->i", {{2, 3}}},                                            // reduction
+    {"ii->i", {{3, 3}}},                                            // diagonal
+    {"ab,cd->abcd", {{1, 2}, {3, 4}}},                              // outer product
+    {"ab,ab->ab", {{2, 3}, {2, 3}}},                                // element-wise product
+    {"ij,jk->ik", {{2, 3}, {3, 5}}},                                // matrix multiplication
+    {"ab...,ac...,ade->...bc", {{2, 2, 3}, {2, 3, 3}, {2, 4, 5}}},  // ellipsis and summed labels
+    {"bhqd,bhkd->bhqk", {{2, 4, 16, 8}, {2, 4, 12, 8}}},            // attention scores
+    {"ijk,kl,lm->im", {{2, 3, 4}, {4, 5}, {5, 6}}},                 // chain of contractions
+    {"a...,...->a...", {{10, 1, 3}, {3}}},                          // broadcasting of ellipses
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_Einsum,
+                        EinsumLayerTest,
+                        ::testing::Combine(::testing::ValuesIn(precisions),
+                                           ::testing::ValuesIn(equationsWithInput),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        EinsumLayerTest::getTestCaseName);
+
+}  // namespace
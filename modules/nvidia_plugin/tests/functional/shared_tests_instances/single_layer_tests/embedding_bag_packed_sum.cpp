@@ -0,0 +1,113 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+using EmbeddingBagParams = std::tuple<std::vector<size_t>,  // Shape of the table [num_embeddings, embedding_size]
+                                      std::vector<size_t>,  // Shape of indices [num_bags, bag_size]
+                                      bool,                 // Bags are averaged by ReduceMean instead of ReduceSum
+                                      bool,                 // Reduction keeps dimensions
+                                      ov::element::Type,    // Type of indices
+                                      ov::element::Type,    // Element type
+                                      std::string           // Device name
+                                      >;
+
+class EmbeddingBagPackedSumFusionTest : public testing::WithParamInterface<EmbeddingBagParams>,
+                                        public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagParams>& obj) {
+        std::vector<size_t> table_shape;
+        std::vector<size_t> indices_shape;
+        bool mean;
+        bool keep_dims;
+        ov::element::Type index_type;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(table_shape, indices_shape, mean, keep_dims, index_type, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "TS=" << utils::vec2str(table_shape) << "_";
+        result << "IS=" << utils::vec2str(indices_shape) << "_";
+        result << "Mean=" << mean << "_";
+        result << "KeepDims=" << keep_dims << "_";
+        result << "IT=" << index_type << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> table_shape;
+        std::vector<size_t> indices_shape;
+        bool mean;
+        bool keep_dims;
+        ov::element::Type index_type;
+        ov::element::Type element_type;
+        std::tie(table_shape, indices_shape, mean, keep_dims, index_type, element_type, targetDevice) = GetParam();
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 1e-2;
+        init_input_shapes(static_shapes_to_test_representation({table_shape}));
+
+        // Rows are gathered repeatedly and out of order
+        std::vector<int64_t> indices(ov::shape_size(indices_shape));
+        for (size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = static_cast<int64_t>((i * 7 + 3) % table_shape[0]);
+        }
+        auto table = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{table_shape});
+        auto gather = std::make_shared<ov::op::v8::Gather>(
+            table,
+            ov::op::v0::Constant::create(index_type, ov::Shape{indices_shape}, indices),
+            ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+        const auto axes = ov::op::v0::Constant::create(ov::element::i64, {1}, {1});
+        std::shared_ptr<ov::Node> bags;
+        if (mean) {
+            bags = std::make_shared<ov::op::v1::ReduceMean>(gather, axes, keep_dims);
+        } else {
+            bags = std::make_shared<ov::op::v1::ReduceSum>(gather, axes, keep_dims);
+        }
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(bags)}, ov::ParameterVector{table}, "EmbeddingBag");
+    }
+};
+
+TEST_P(EmbeddingBagPackedSumFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("EmbeddingBagPackedSum");
+}
+
+// Embedding sizes which aren't multiples of the block size leave threads of the last block idle
+const std::vector<std::vector<size_t>> table_shapes = {{100, 64}, {37, 129}, {1000, 1}};
+const std::vector<std::vector<size_t>> indices_shapes = {{4, 3}, {1, 2}, {33, 17}};
+
+INSTANTIATE_TEST_CASE_P(smoke_EmbeddingBagPackedSumFusion,
+                        EmbeddingBagPackedSumFusionTest,
+                        ::testing::Combine(::testing::ValuesIn(table_shapes),
+                                           ::testing::ValuesIn(indices_shapes),
+                                           ::testing::Bool(),
+                                           ::testing::Bool(),
+                                           ::testing::Values(ov::element::i32, ov::element::i64),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        EmbeddingBagPackedSumFusionTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,100 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cuda/runtime.hpp>
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "nvidia/properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+using Fp8MatMulParams = std::tuple<std::vector<size_t>,  // Shape of activations [..., k]
+                                   size_t,               // Number of output channels n
+                                   bool,                 // Weights are transposed [n, k]
+                                   ov::element::Type,    // Element type
+                                   std::string           // Device name
+                                   >;
+
+class Fp8MatMulTest : public testing::WithParamInterface<Fp8MatMulParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<Fp8MatMulParams>& obj) {
+        std::vector<size_t> input_shape;
+        size_t n;
+        bool transpose_b;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(input_shape, n, transpose_b, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(input_shape) << "_";
+        result << "N=" << n << "_";
+        result << "TB=" << transpose_b << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> input_shape;
+        size_t n;
+        bool transpose_b;
+        ov::element::Type element_type;
+        std::tie(input_shape, n, transpose_b, element_type, targetDevice) = GetParam();
+        configuration[ov::nvidia_gpu::fp8_matmul.name()] = true;
+        init_input_shapes(static_shapes_to_test_representation({input_shape}));
+
+        // E4M3 keeps 3 bits of mantissa, so each product is off by a few percents and errors of the sum grow with
+        // the square root of k, while the products themselves are about 0.3 on average
+        const size_t k = input_shape.back();
+        abs_threshold = 0.1 * std::sqrt(static_cast<double>(k));
+        std::vector<float> weights(n * k);
+        for (size_t i = 0; i < weights.size(); ++i) {
+            weights[i] = static_cast<float>(static_cast<int>((i * 37) % 65) - 32) / 32;
+        }
+        const auto weights_shape = transpose_b ? ov::Shape{n, k} : ov::Shape{k, n};
+        auto param = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{input_shape});
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(
+            param, ov::op::v0::Constant::create(element_type, weights_shape, weights), false, transpose_b);
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(matmul)}, ov::ParameterVector{param}, "MatMul");
+    }
+};
+
+TEST_P(Fp8MatMulTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (CUDART_VERSION < 11080 || !CUDA::isFp8Supported(CUDA::Device{})) {
+        GTEST_SKIP() << "Device doesn't have FP8 tensor cores";
+    }
+    run();
+    check_fused_layer("Fp8MatMul");
+}
+
+// FP8 GEMM requires k and n to be multiples of 16, while numbers of rows are arbitrary
+const std::vector<std::vector<size_t>> input_shapes = {{1, 64}, {5, 256}, {2, 3, 512}};
+
+INSTANTIATE_TEST_CASE_P(smoke_Fp8MatMul,
+                        Fp8MatMulTest,
+                        ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                           ::testing::Values(size_t{16}, size_t{48}),
+                                           ::testing::Bool(),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        Fp8MatMulTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
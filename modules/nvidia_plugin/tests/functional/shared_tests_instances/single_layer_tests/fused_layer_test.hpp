@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+
+/**
+ * Base of tests of kernels executing fused subgraphs. The model is built of the operations the plugin fuses, so
+ * the reference is computed by these operations, while the device executes the kernel of the fused layer.
+ */
+class FusedLayerTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    /**
+     * Checks the compiled model executes the layer of the given type, e.g. the subgraph was fused
+     */
+    void check_fused_layer(const std::string& layer_type) const {
+        const auto runtime_model = compiledModel.get_runtime_model();
+        const auto ops = runtime_model->get_ops();
+        const bool fused = std::any_of(ops.begin(), ops.end(), [&](const auto& op) {
+            const auto& info = op->get_rt_info();
+            const auto type = info.find(ov::exec_model_info::LAYER_TYPE);
+            return type != info.end() && type->second.template as<std::string>() == layer_type;
+        });
+        ASSERT_TRUE(fused) << "Subgraph isn't fused into " << layer_type;
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& target_input_static_shapes) override {
+        inputs.clear();
+        const auto& func_inputs = function->inputs();
+        for (size_t i = 0; i < func_inputs.size(); ++i) {
+            const auto& param = func_inputs[i];
+            auto tensor = utils::create_and_fill_tensor(
+                param.get_element_type(), target_input_static_shapes[i], input_range, input_start, input_resolution);
+            inputs.insert({param.get_node_shared_ptr(), tensor});
+        }
+    }
+
+    // Inputs are filled by values of [input_start, input_start + input_range) with the step of 1 / input_resolution
+    uint32_t input_range = 2;
+    double input_start = -1.0;
+    int32_t input_resolution = 32;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,162 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/softmax.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+struct AttentionShape {
+    // Leading dimensions of queries, keys and values, e.g. {batch, heads} or {batch}
+    std::vector<size_t> heads;
+    size_t q_length;
+    size_t kv_length;
+    size_t head_size;
+};
+
+enum class AttentionMask {
+    None,
+    // Scores + mask
+    AfterScores,
+    // (mask * constant) + scores, the scaled mask is added before the scaled scores
+    ScaledBeforeScores,
+};
+
+std::ostream& operator<<(std::ostream& os, AttentionMask mask) {
+    switch (mask) {
+        case AttentionMask::None:
+            return os << "None";
+        case AttentionMask::AfterScores:
+            return os << "AfterScores";
+        case AttentionMask::ScaledBeforeScores:
+            return os << "ScaledBeforeScores";
+    }
+    return os;
+}
+
+using FusedMultiHeadAttentionParams = std::tuple<AttentionShape,
+                                                 bool,               // Keys are transposed by the MatMul
+                                                 AttentionMask,      // Mask
+                                                 ov::element::Type,  // Element type
+                                                 std::string         // Device name
+                                                 >;
+
+class FusedMultiHeadAttentionTest : public testing::WithParamInterface<FusedMultiHeadAttentionParams>,
+                                    public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FusedMultiHeadAttentionParams>& obj) {
+        AttentionShape shape;
+        bool transpose_k;
+        AttentionMask mask;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(shape, transpose_k, mask, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "H=" << utils::vec2str(shape.heads) << "_";
+        result << "QL=" << shape.q_length << "_";
+        result << "KVL=" << shape.kv_length << "_";
+        result << "HS=" << shape.head_size << "_";
+        result << "TK=" << transpose_k << "_";
+        result << "Mask=" << mask << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        AttentionShape shape;
+        bool transpose_k;
+        AttentionMask mask;
+        ov::element::Type element_type;
+        std::tie(shape, transpose_k, mask, element_type, targetDevice) = GetParam();
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 1e-2;
+
+        const auto make_shape = [&](size_t rows, size_t columns) {
+            auto dims = shape.heads;
+            dims.push_back(rows);
+            dims.push_back(columns);
+            return ov::Shape{dims};
+        };
+        const auto q_shape = make_shape(shape.q_length, shape.head_size);
+        const auto k_shape = transpose_k ? make_shape(shape.kv_length, shape.head_size)
+                                         : make_shape(shape.head_size, shape.kv_length);
+        const auto v_shape = make_shape(shape.kv_length, shape.head_size);
+        // The mask is broadcasted along heads and queries
+        auto mask_shape = ov::Shape(shape.heads.size() + 2, 1);
+        mask_shape.front() = shape.heads.front();
+        mask_shape.back() = shape.kv_length;
+        std::vector<ov::Shape> shapes{q_shape, k_shape, v_shape};
+        if (mask != AttentionMask::None) {
+            shapes.push_back(mask_shape);
+        }
+        init_input_shapes(static_shapes_to_test_representation(shapes));
+
+        ov::ParameterVector params;
+        for (const auto& input_shape : shapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(element_type, input_shape));
+        }
+        auto scores = std::make_shared<ov::op::v0::MatMul>(params[0], params[1], false, transpose_k);
+        const auto scale =
+            ov::op::v0::Constant::create(element_type, {}, {1.0f / std::sqrt(static_cast<float>(shape.head_size))});
+        std::shared_ptr<ov::Node> logits = std::make_shared<ov::op::v1::Multiply>(scores, scale);
+        if (mask == AttentionMask::AfterScores) {
+            logits = std::make_shared<ov::op::v1::Add>(logits, params[3]);
+        } else if (mask == AttentionMask::ScaledBeforeScores) {
+            // Values of the mask are in [-1, 1), so the scaled mask keeps the softmax finite
+            auto scaled_mask =
+                std::make_shared<ov::op::v1::Multiply>(params[3], ov::op::v0::Constant::create(element_type, {}, {8}));
+            logits = std::make_shared<ov::op::v1::Add>(scaled_mask, logits);
+        }
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(logits, -1);
+        auto output = std::make_shared<ov::op::v0::MatMul>(softmax, params[2]);
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)}, params, "FusedMultiHeadAttention");
+    }
+};
+
+TEST_P(FusedMultiHeadAttentionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("FusedMultiHeadAttention");
+}
+
+// Lengths aren't multiples of rows of blocks and tiles of keys, so the tails of both are computed
+const std::vector<AttentionShape> shapes = {
+    {{2, 4}, 16, 16, 8},
+    {{1, 3}, 37, 77, 24},
+    {{2}, 5, 129, 64},
+    {{1, 2}, 33, 65, 128},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_FusedMultiHeadAttention,
+                        FusedMultiHeadAttentionTest,
+                        ::testing::Combine(::testing::ValuesIn(shapes),
+                                           ::testing::Bool(),
+                                           ::testing::Values(AttentionMask::None,
+                                                             AttentionMask::AfterScores,
+                                                             AttentionMask::ScaledBeforeScores),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        FusedMultiHeadAttentionTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -45,6 +45,28 @@ INSTANTIATE_TEST_CASE_P(smoke_GroupConvolutionCUDA2D_Run,
                                            ::testing::Values(DEVICE_NVIDIA)),
                         GroupConvolutionLayerTest::getTestCaseName);
 
+// Depthwise convolutions are executed by the depthwise kernel instead of cuDNN
+const std::vector<std::vector<size_t>> depthwise_kernels = {{3, 3}, {5, 5}};
+const std::vector<std::vector<size_t>> depthwise_strides = {{1, 1}, {2, 2}};
+const std::vector<std::vector<size_t>> depthwise_dilations = {{1, 1}, {2, 2}};
+
+const auto depthwise_conv_2d_params = ::testing::Combine(::testing::ValuesIn(depthwise_kernels),
+                                                         ::testing::ValuesIn(depthwise_strides),
+                                                         ::testing::Values(std::vector<ptrdiff_t>{1, 2}),
+                                                         ::testing::Values(std::vector<ptrdiff_t>{2, 1}),
+                                                         ::testing::ValuesIn(depthwise_dilations),
+                                                         ::testing::Values(16),
+                                                         ::testing::Values(16),
+                                                         ::testing::Values(ov::op::PadType::EXPLICIT));
+
+INSTANTIATE_TEST_CASE_P(smoke_DepthwiseConvolutionCUDA2D_Run,
+                        GroupConvolutionLayerTest,
+                        ::testing::Combine(depthwise_conv_2d_params,
+                                           ::testing::ValuesIn(model_types),
+                                           ::testing::Values(static_shapes_to_test_representation(input_shapes)),
+                                           ::testing::Values(DEVICE_NVIDIA)),
+                        GroupConvolutionLayerTest::getTestCaseName);
+
 class GroupConvolutionLayerThresholdTest : public FiniteComparer<GroupConvolutionLayerTest> {
 protected:
     void SetUp() override { GroupConvolutionLayerTest::SetUp(); }
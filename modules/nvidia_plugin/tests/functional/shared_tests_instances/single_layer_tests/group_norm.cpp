@@ -0,0 +1,117 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/swish.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+using GroupNormParams = std::tuple<std::vector<size_t>,  // Input shape [batch, channels, ...]
+                                   size_t,               // Number of groups
+                                   bool,                 // SiLU follows the normalization
+                                   ov::element::Type,    // Element type
+                                   std::string           // Device name
+                                   >;
+
+class GroupNormTest : public testing::WithParamInterface<GroupNormParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<GroupNormParams>& obj) {
+        std::vector<size_t> input_shape;
+        size_t num_groups;
+        bool silu;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(input_shape, num_groups, silu, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(input_shape) << "_";
+        result << "G=" << num_groups << "_";
+        result << "SiLU=" << silu << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> input_shape;
+        size_t num_groups;
+        bool silu;
+        ov::element::Type element_type;
+        std::tie(input_shape, num_groups, silu, element_type, targetDevice) = GetParam();
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 1e-2;
+        init_input_shapes(static_shapes_to_test_representation({input_shape}));
+
+        // Group normalization decomposed like exporters of diffusion models do:
+        // Reshape [N, G, -1] -> MVN -> Reshape back -> Multiply [C, 1, 1] -> Add [C, 1, 1] (-> Swish)
+        const auto channels = input_shape[1];
+        auto param = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{input_shape});
+        const std::vector<int64_t> grouped_dims{
+            static_cast<int64_t>(input_shape[0]), static_cast<int64_t>(num_groups), -1};
+        const auto grouped_shape = ov::op::v0::Constant::create(ov::element::i64, {3}, grouped_dims);
+        auto grouped = std::make_shared<ov::op::v1::Reshape>(param, grouped_shape, false);
+        const auto axes = ov::op::v0::Constant::create(ov::element::i64, {1}, {2});
+        auto mvn = std::make_shared<ov::op::v6::MVN>(grouped, axes, true, 1e-5f, ov::op::MVNEpsMode::INSIDE_SQRT);
+        const auto shape = ov::op::v0::Constant::create(
+            ov::element::i64, {input_shape.size()}, std::vector<int64_t>(input_shape.begin(), input_shape.end()));
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v1::Reshape>(mvn, shape, false);
+
+        ov::Shape affine_shape(input_shape.size() - 1, 1);
+        affine_shape.front() = channels;
+        std::vector<float> scale(channels);
+        std::vector<float> bias(channels);
+        for (size_t i = 0; i < channels; ++i) {
+            scale[i] = static_cast<float>(i % 7) / 4 + 0.5f;
+            bias[i] = static_cast<float>(i % 5) / 4 - 0.5f;
+        }
+        output = std::make_shared<ov::op::v1::Multiply>(
+            output, ov::op::v0::Constant::create(element_type, affine_shape, scale));
+        output =
+            std::make_shared<ov::op::v1::Add>(output, ov::op::v0::Constant::create(element_type, affine_shape, bias));
+        if (silu) {
+            output = std::make_shared<ov::op::v4::Swish>(output);
+        }
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)}, ov::ParameterVector{param}, "GroupNorm");
+    }
+};
+
+TEST_P(GroupNormTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("GroupNorm");
+}
+
+// Odd spatial sizes leave threads of the last iteration idle, while groups larger than max_cached_size bytes
+// aren't kept in shared memory and are read twice
+const std::vector<GroupNormParams> params = {
+    {{2, 32, 16, 16}, 8, false, ov::element::f32, ov::test::utils::DEVICE_NVIDIA},
+    {{2, 32, 16, 16}, 8, true, ov::element::f16, ov::test::utils::DEVICE_NVIDIA},
+    {{1, 20, 7, 9}, 5, true, ov::element::f32, ov::test::utils::DEVICE_NVIDIA},
+    {{1, 20, 7, 9}, 20, false, ov::element::f16, ov::test::utils::DEVICE_NVIDIA},
+    {{3, 6, 11}, 3, true, ov::element::f32, ov::test::utils::DEVICE_NVIDIA},
+    {{1, 64, 40, 40}, 2, true, ov::element::f32, ov::test::utils::DEVICE_NVIDIA},
+    {{1, 64, 40, 40}, 2, false, ov::element::f16, ov::test::utils::DEVICE_NVIDIA},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_GroupNorm, GroupNormTest, ::testing::ValuesIn(params), GroupNormTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
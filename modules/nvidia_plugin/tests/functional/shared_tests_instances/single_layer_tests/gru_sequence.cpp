@@ -201,6 +201,25 @@ INSTANTIATE_TEST_CASE_P(
                        ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
     GRUSequenceTest::getTestCaseName);
 
+const std::vector<ov::op::RecurrentSequenceDirection> smoke_bidirectional{
+    ov::op::RecurrentSequenceDirection::BIDIRECTIONAL};
+INSTANTIATE_TEST_CASE_P(
+    smoke_GRUSequenceBidirectional,
+    CUDNNGRUSequenceTest,
+    ::testing::Combine(::testing::Values(mode),
+                       ::testing::ValuesIn(smoke_seq_lengths),
+                       ::testing::ValuesIn(smoke_batchs),
+                       ::testing::Values(10),
+                       // ::testing::ValuesIn(input_size), // hardcoded to 10 due to Combine supports up to 10 args
+                       ::testing::ValuesIn(activations),
+                       ::testing::ValuesIn(clip),
+                       ::testing::ValuesIn(linear_before_reset),
+                       ::testing::ValuesIn(smoke_bidirectional),
+                       ::testing::Values(InputLayerType::CONSTANT),
+                       ::testing::ValuesIn(netPrecisions),
+                       ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+    GRUSequenceTest::getTestCaseName);
+
 // -------------  LPCNet shapes  -------------
 const std::vector<size_t> lpcnet_seq_lengths{5, 10};
 const std::vector<size_t> lpcnet_batchs{1};
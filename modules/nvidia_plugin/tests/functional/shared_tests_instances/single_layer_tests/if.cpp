@@ -0,0 +1,50 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_tests/simple_if.hpp"
+
+#include <cuda_test_constants.hpp>
+#include <vector>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace ov::test::SubgraphTestsDefinitions;
+
+namespace {
+
+std::vector<std::vector<ov::test::InputShape>> inputShapes = {
+    {{{}, {{5, 7}}}, {{}, {{5, 7}}}},
+    {{{}, {{30, 20, 10}}}, {{}, {{30, 20, 10}}}},
+};
+
+std::vector<ov::test::ElementType> inTypes = {ov::element::f32, ov::element::f16};
+
+std::vector<bool> conditions = {true, false};
+
+INSTANTIATE_TEST_CASE_P(smoke_If,
+                        SimpleIfTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::ValuesIn(inTypes),
+                                           ::testing::ValuesIn(conditions),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        SimpleIfTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_If,
+                        SimpleIf2OutTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::ValuesIn(inTypes),
+                                           ::testing::ValuesIn(conditions),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        SimpleIf2OutTest::getTestCaseName);
+
+// The condition is an input of the model, so it is evaluated on device at inference
+INSTANTIATE_TEST_CASE_P(smoke_If,
+                        SimpleIfNotConstConditionTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::ValuesIn(inTypes),
+                                           ::testing::ValuesIn(conditions),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        SimpleIfNotConstConditionTest::getTestCaseName);
+
+}  // namespace
@@ -371,6 +371,33 @@ INSTANTIATE_TEST_CASE_P(smoke_InterpolateCubic_2D_Scale_Test,
                                            ::testing::Values(additional_config)),
                         InterpolateLayerTest::getTestCaseName);
 
+const std::vector<std::vector<float>> cubicTestUpscale2DScales = {{4.0f, 4.0f}};
+const std::vector<std::vector<size_t>> cubicTestUpscale2DSizes = {{40, 76}};
+const auto cubicUpscale2DParams = ::testing::Combine(::testing::Values(InterpolateMode::CUBIC),
+                                                     ::testing::ValuesIn(cubicShapeCalculationMode),
+                                                     ::testing::ValuesIn(cubicCoordinateTransformModes),
+                                                     ::testing::ValuesIn(cubicNearestModes),
+                                                     ::testing::ValuesIn(cubicAntialias),
+                                                     ::testing::ValuesIn(pads),
+                                                     ::testing::ValuesIn(pads),
+                                                     ::testing::ValuesIn(defaultCubeCoeff),
+                                                     ::testing::ValuesIn(cubicTest2DAxes),
+                                                     ::testing::ValuesIn(cubicTestUpscale2DScales));
+const std::vector<std::vector<size_t>> cubicInputUpscale2DShapes = {{2, 3, 10, 19}};
+INSTANTIATE_TEST_CASE_P(smoke_InterpolateCubic_2D_Upscale_Tiled_Test,
+                        CUDAInterpolateLayerTest,
+                        ::testing::Combine(cubicUpscale2DParams,
+                                           ::testing::ValuesIn(cubicNetPrecisions),
+                                           ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                                           ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                                           ::testing::Values(InferenceEngine::Layout::ANY),
+                                           ::testing::Values(InferenceEngine::Layout::ANY),
+                                           ::testing::ValuesIn(cubicInputUpscale2DShapes),
+                                           ::testing::ValuesIn(cubicTestUpscale2DSizes),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA),
+                                           ::testing::Values(additional_config)),
+                        InterpolateLayerTest::getTestCaseName);
+
 const std::vector<std::vector<int64_t>> cubicTest3DAxes = {{2, 3, 4}};
 const std::vector<std::vector<float>> cubicTest3DScales = {{0.5f, 0.4f, 0.6f}, {1.5f, 1.6f, 1.8f}};
 const std::vector<std::vector<size_t>> cubicTest3DSizes = {{6, 8, 10}, {10, 16, 18}, {10, 8, 18}};
@@ -0,0 +1,105 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+using LayerNormParams = std::tuple<std::vector<size_t>,  // Input shape
+                                   bool,                 // Scale and bias are multiplied and added after MVN
+                                   ov::op::MVNEpsMode,   // Mode of epsilon
+                                   ov::element::Type,    // Element type
+                                   std::string           // Device name
+                                   >;
+
+class LayerNormTest : public testing::WithParamInterface<LayerNormParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LayerNormParams>& obj) {
+        std::vector<size_t> input_shape;
+        bool affine;
+        ov::op::MVNEpsMode eps_mode;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(input_shape, affine, eps_mode, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(input_shape) << "_";
+        result << "Affine=" << affine << "_";
+        result << "EpsMode=" << eps_mode << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> input_shape;
+        bool affine;
+        ov::op::MVNEpsMode eps_mode;
+        ov::element::Type element_type;
+        std::tie(input_shape, affine, eps_mode, element_type, targetDevice) = GetParam();
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 1e-2;
+        init_input_shapes(static_shapes_to_test_representation({input_shape}));
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{input_shape});
+        const auto axes = ov::op::v0::Constant::create(ov::element::i64, {1}, {-1});
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v6::MVN>(param, axes, true, 1e-5f, eps_mode);
+        if (affine) {
+            // Scale and bias are [1, ..., length], which are reshaped to vectors by the fusion
+            const auto length = input_shape.back();
+            ov::Shape affine_shape(input_shape.size(), 1);
+            affine_shape.back() = length;
+            std::vector<float> scale(length);
+            std::vector<float> bias(length);
+            for (size_t i = 0; i < length; ++i) {
+                scale[i] = static_cast<float>(i % 7) / 4 + 0.5f;
+                bias[i] = static_cast<float>(i % 5) / 4 - 0.5f;
+            }
+            output = std::make_shared<ov::op::v1::Multiply>(
+                output, ov::op::v0::Constant::create(element_type, affine_shape, scale));
+            output = std::make_shared<ov::op::v1::Add>(ov::op::v0::Constant::create(element_type, {length}, bias),
+                                                       output);
+        }
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)}, ov::ParameterVector{param}, "LayerNorm");
+    }
+};
+
+TEST_P(LayerNormTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("LayerNorm");
+}
+
+// Lengths which aren't multiples of the warp size leave lanes idle, while rows longer than max_cached_length
+// aren't kept in registers and are read twice
+const std::vector<std::vector<size_t>> input_shapes = {{2, 5, 768}, {3, 37}, {1, 4, 1025}, {2, 4096}, {7, 1}};
+
+INSTANTIATE_TEST_CASE_P(smoke_LayerNorm,
+                        LayerNormTest,
+                        ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                           ::testing::Bool(),
+                                           ::testing::Values(ov::op::MVNEpsMode::INSIDE_SQRT,
+                                                             ov::op::MVNEpsMode::OUTSIDE_SQRT),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        LayerNormTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_tests/loop.hpp"
+
+#include <cuda_test_constants.hpp>
+#include <vector>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+std::vector<bool> execute_first_iteration{true, false};
+std::vector<bool> is_body_condition_const{true};
+std::vector<bool> body_condition{true};
+std::vector<int64_t> trip_count{1, 10};
+std::vector<std::vector<std::pair<std::vector<size_t>, LOOP_IN_TYPE>>> inputs = {
+    {{{32, 1, 10}, LOOP_IN_TYPE::INVARIANT}, {{32, 1, 10}, LOOP_IN_TYPE::INVARIANT}, {{32, 1, 10}, LOOP_IN_TYPE::MERGED}},
+};
+std::vector<InferenceEngine::Precision> netPrecisions = {InferenceEngine::Precision::FP32,
+                                                         InferenceEngine::Precision::FP16};
+
+INSTANTIATE_TEST_CASE_P(smoke_LoopCommonZeroClip,
+                        LoopTest,
+                        ::testing::Combine(::testing::ValuesIn(execute_first_iteration),
+                                           ::testing::ValuesIn(is_body_condition_const),
+                                           ::testing::ValuesIn(body_condition),
+                                           ::testing::ValuesIn(trip_count),
+                                           ::testing::ValuesIn(inputs),
+                                           ::testing::ValuesIn(netPrecisions),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        LoopTest::getTestCaseName);
+
+// Exits by the condition computed by the body aren't known at compilation, so outputs are of the last iteration only
+const std::vector<std::tuple<bool, int64_t, int64_t, int64_t>> static_loop_types{
+    // static_trip_count, max, dynamic_exit, axis
+    std::tuple<bool, int64_t, int64_t, int64_t>{true, 5, -1, -1},   // 5 iterations
+    std::tuple<bool, int64_t, int64_t, int64_t>{true, 5, 3, -1},    // exit by the body on the 3rd iteration
+    std::tuple<bool, int64_t, int64_t, int64_t>{true, 5, 7, -1},    // exit by the body isn't reached
+    std::tuple<bool, int64_t, int64_t, int64_t>{true, -1, 5, -1},   // infinite loop with exit by the body
+    std::tuple<bool, int64_t, int64_t, int64_t>{true, 5, -1, 1},    // 5 iterations with concatenated output
+    std::tuple<bool, int64_t, int64_t, int64_t>{false, 5, -1, -1},  // trip count as input
+    std::tuple<bool, int64_t, int64_t, int64_t>{false, 5, 3, -1},   // trip count as input, exit by the body
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_StaticShapeLoop,
+                        StaticShapeLoopTest,
+                        ::testing::Combine(::testing::Values(false),  // unrolling
+                                           ::testing::Values(true),   // static_continue_cond
+                                           ::testing::ValuesIn(static_loop_types),
+                                           ::testing::Values<int64_t>(7),  // start_value
+                                           ::testing::Values<InferenceEngine::SizeVector>({2, 1, 4}),
+                                           ::testing::Values(InferenceEngine::Precision::FP32,
+                                                             InferenceEngine::Precision::I32),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA),
+                                           ::testing::Values<std::map<std::string, std::string>>({})),
+                        StaticShapeLoopTest::getTestCaseName);
+
+}  // namespace
@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "nvidia/properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/maximum.hpp"
+#include "openvino/op/minimum.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/tanh.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+using PersistentSequenceParams = std::tuple<std::vector<size_t>,  // Input shape
+                                            ov::element::Type,    // Element type
+                                            std::string           // Device name
+                                            >;
+
+class PersistentSequenceTest : public testing::WithParamInterface<PersistentSequenceParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PersistentSequenceParams>& obj) {
+        std::vector<size_t> input_shape;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(input_shape, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(input_shape) << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> input_shape;
+        ov::element::Type element_type;
+        std::tie(input_shape, element_type, targetDevice) = GetParam();
+        configuration[ov::nvidia_gpu::persistent_kernel_max_elements.name()] = size_t{4096};
+        abs_threshold = element_type == ov::element::f32 ? 1e-5 : 1e-2;
+        init_input_shapes(static_shapes_to_test_representation({input_shape, input_shape}));
+
+        // Every operation is consumed by Concat as well, so that EltwiseFusion leaves them separate. They are
+        // ordered consecutively after both parameters, so the plugin executes the whole run by one launch of the
+        // persistent kernel, which writes all intermediate outputs
+        const auto a = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{input_shape});
+        const auto b = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{input_shape});
+        const auto sum = std::make_shared<ov::op::v1::Add>(a, b);
+        const auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(sum);
+        ov::OutputVector nodes{sum, sigmoid};
+        nodes.push_back(std::make_shared<ov::op::v0::Relu>(sum));
+        nodes.push_back(std::make_shared<ov::op::v1::Multiply>(nodes.back(), b));
+        nodes.push_back(std::make_shared<ov::op::v1::Subtract>(nodes.back(), a));
+        nodes.push_back(std::make_shared<ov::op::v0::Tanh>(nodes.back()));
+        nodes.push_back(std::make_shared<ov::op::v1::Maximum>(nodes.back(), b));
+        nodes.push_back(std::make_shared<ov::op::v1::Minimum>(nodes.back(), a));
+        // Sigmoid of values in [-2, 2) is far from 0, so the division is well conditioned
+        nodes.push_back(std::make_shared<ov::op::v1::Divide>(nodes.back(), sigmoid));
+        const auto concat = std::make_shared<ov::op::v0::Concat>(nodes, 0);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat)},
+                                               ov::ParameterVector{a, b},
+                                               "PersistentSequence");
+    }
+};
+
+TEST_P(PersistentSequenceTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+}
+
+// Sizes which aren't multiples of the block size leave threads of the last iteration of each step idle
+const std::vector<std::vector<size_t>> input_shapes = {{1, 16}, {3, 37}, {2, 512}, {4096}};
+
+INSTANTIATE_TEST_CASE_P(smoke_PersistentSequence,
+                        PersistentSequenceTest,
+                        ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        PersistentSequenceTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,136 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda/runtime.hpp>
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/fake_quantize.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+using QuantizedMatMulParams = std::tuple<std::vector<size_t>,  // Shape of activations [..., k]
+                                         size_t,               // Number of output channels n
+                                         bool,                 // Weights are transposed [n, k]
+                                         bool,                 // Bias is added
+                                         size_t,               // Levels of FakeQuantize
+                                         ov::element::Type,    // Element type
+                                         std::string           // Device name
+                                         >;
+
+class QuantizedMatMulTest : public testing::WithParamInterface<QuantizedMatMulParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<QuantizedMatMulParams>& obj) {
+        std::vector<size_t> input_shape;
+        size_t n;
+        bool transpose_b;
+        bool has_bias;
+        size_t levels;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(input_shape, n, transpose_b, has_bias, levels, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(input_shape) << "_";
+        result << "N=" << n << "_";
+        result << "TB=" << transpose_b << "_";
+        result << "Bias=" << has_bias << "_";
+        result << "Levels=" << levels << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> input_shape;
+        size_t n;
+        bool transpose_b;
+        bool has_bias;
+        size_t levels;
+        ov::element::Type element_type;
+        std::tie(input_shape, n, transpose_b, has_bias, levels, element_type, targetDevice) = GetParam();
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 5e-2;
+        // Activations exceed the range of FakeQuantize, so that they are clamped as well
+        input_range = 10;
+        input_start = -5.0;
+        init_input_shapes(static_shapes_to_test_representation({input_shape}));
+
+        // Levels of FakeQuantize are i8 values multiplied by the scale with the zero point in the middle
+        const float scale = 1.0f / 32;
+        const float low = (levels == 256 ? -128.0f : -127.0f) * scale;
+        const float high = 127.0f * scale;
+        auto param = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{input_shape});
+        const auto input_low = ov::op::v0::Constant::create(element_type, {}, {low});
+        const auto input_high = ov::op::v0::Constant::create(element_type, {}, {high});
+        auto fq =
+            std::make_shared<ov::op::v0::FakeQuantize>(param, input_low, input_high, input_low, input_high, levels);
+
+        // Each row of weights has the maximal i8 value, so that weights are quantized exactly
+        const size_t k = input_shape.back();
+        const float step = 1.0f / 1024;
+        std::vector<float> weights(n * k);
+        for (size_t in = 0; in < n; ++in) {
+            for (size_t ik = 0; ik < k; ++ik) {
+                auto quantized = static_cast<int>((in * 31 + ik * 17) % 255) - 127;
+                if (ik == in % k) {
+                    quantized = 127;
+                }
+                weights[transpose_b ? in * k + ik : ik * n + in] = quantized * step;
+            }
+        }
+        const auto weights_shape = transpose_b ? ov::Shape{n, k} : ov::Shape{k, n};
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v0::MatMul>(
+            fq, ov::op::v0::Constant::create(element_type, weights_shape, weights), false, transpose_b);
+        if (has_bias) {
+            std::vector<float> bias(ov::shape_size(output->get_output_shape(0)));
+            for (size_t i = 0; i < bias.size(); ++i) {
+                bias[i] = static_cast<float>(i % 13) / 8 - 0.75f;
+            }
+            output = std::make_shared<ov::op::v1::Add>(
+                output, ov::op::v0::Constant::create(element_type, output->get_output_shape(0), bias));
+        }
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)},
+                                               ov::ParameterVector{param},
+                                               "FakeQuantizeMatMul");
+    }
+};
+
+TEST_P(QuantizedMatMulTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!CUDA::isInt8Supported(CUDA::Device{})) {
+        GTEST_SKIP() << "Device doesn't support int8 GEMM";
+    }
+    run();
+    check_fused_layer("QuantizedMatMul");
+}
+
+// Int8 GEMM requires k and n to be multiples of 4, while numbers of rows are arbitrary
+const std::vector<std::vector<size_t>> input_shapes = {{1, 64}, {7, 1000}, {3, 5, 132}};
+
+INSTANTIATE_TEST_CASE_P(smoke_QuantizedMatMul,
+                        QuantizedMatMulTest,
+                        ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                           ::testing::Values(size_t{20}, size_t{256}),
+                                           ::testing::Bool(),
+                                           ::testing::Bool(),
+                                           ::testing::Values(size_t{255}, size_t{256}),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        QuantizedMatMulTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -164,11 +164,34 @@ const auto params_ReduceSum_accuracy = testing::Combine(testing::Values(std::vec
                                                         testing::Values(std::vector<size_t>{1000000}),
                                                         testing::Values(ov::test::utils::DEVICE_NVIDIA));
 
+// Shapes, which are reduced by warps, blocks, threads and split rows respectively
+const auto params_ReduceStrategies = testing::Combine(testing::Values(std::vector<int>{1}),
+                                                      testing::Values(opTypes[1]),
+                                                      testing::Values(true),
+                                                      testing::Values(ngraph::helpers::ReductionType::Mean,
+                                                                      ngraph::helpers::ReductionType::Max,
+                                                                      ngraph::helpers::ReductionType::L2),
+                                                      testing::Values(InferenceEngine::Precision::FP32),
+                                                      testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                                                      testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                                                      testing::Values(InferenceEngine::Layout::ANY),
+                                                      testing::Values(std::vector<size_t>{64, 300},
+                                                                      std::vector<size_t>{8, 5000},
+                                                                      std::vector<size_t>{4, 1000, 3},
+                                                                      std::vector<size_t>{2, 50000},
+                                                                      std::vector<size_t>{2, 20000, 3}),
+                                                      testing::Values(ov::test::utils::DEVICE_NVIDIA));
+
 INSTANTIATE_TEST_SUITE_P(smoke_ReduceSum_Accuracy,
                          ReduceOpsLayerTest,
                          params_ReduceSum_accuracy,
                          ReduceOpsLayerTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Reduce_Strategies,
+                         ReduceOpsLayerTest,
+                         params_ReduceStrategies,
+                         ReduceOpsLayerTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_ReduceOneAxis, ReduceOpsLayerTest, paramsOneAxis, ReduceOpsLayerTest::getTestCaseName);
 
 INSTANTIATE_TEST_SUITE_P(smoke_Reduce_Precisions,
@@ -0,0 +1,177 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cuda/runtime.hpp>
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gru_sequence.hpp"
+#include "openvino/op/lstm_sequence.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+struct RNNShape {
+    size_t batch;
+    size_t seq_length;
+    size_t input_size;
+    size_t hidden_size;
+};
+
+using RNNSequencePersistentParams = std::tuple<RNNShape,
+                                               bool,                                // GRU instead of LSTM
+                                               ov::op::RecurrentSequenceDirection,  // Direction
+                                               ov::element::Type,                   // Element type
+                                               std::string                          // Device name
+                                               >;
+
+class RNNSequencePersistentTest : public testing::WithParamInterface<RNNSequencePersistentParams>,
+                                  public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RNNSequencePersistentParams>& obj) {
+        RNNShape shape;
+        bool gru;
+        ov::op::RecurrentSequenceDirection direction;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(shape, gru, direction, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "Cell=" << (gru ? "GRU" : "LSTM") << "_";
+        result << "B=" << shape.batch << "_";
+        result << "L=" << shape.seq_length << "_";
+        result << "I=" << shape.input_size << "_";
+        result << "H=" << shape.hidden_size << "_";
+        result << "Direction=" << direction << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        RNNShape shape;
+        ov::op::RecurrentSequenceDirection direction;
+        ov::element::Type element_type;
+        std::tie(shape, gru_, direction, element_type, targetDevice) = GetParam();
+        // The profiler reports the type of the implementation executing the sequence
+        configuration[ov::enable_profiling.name()] = true;
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 2e-2;
+
+        const size_t num_directions = direction == ov::op::RecurrentSequenceDirection::BIDIRECTIONAL ? 2 : 1;
+        const size_t num_gates = gru_ ? 3 : 4;
+        const ov::Shape x_shape{shape.batch, shape.seq_length, shape.input_size};
+        const ov::Shape h_shape{shape.batch, num_directions, shape.hidden_size};
+        std::vector<ov::Shape> input_shapes{x_shape, h_shape};
+        if (!gru_) {
+            input_shapes.push_back(h_shape);
+        }
+        init_input_shapes(static_shapes_to_test_representation(input_shapes));
+        ov::ParameterVector params;
+        for (const auto& input_shape : input_shapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(element_type, input_shape));
+        }
+
+        // Sequence lengths are constants of the full length, which the persistent kernel requires
+        const auto seq_lengths = ov::op::v0::Constant::create(
+            ov::element::i64, {shape.batch}, std::vector<int64_t>(shape.batch, shape.seq_length));
+        const auto w = weights(element_type, {num_directions, num_gates * shape.hidden_size, shape.input_size}, 1);
+        const auto r = weights(element_type, {num_directions, num_gates * shape.hidden_size, shape.hidden_size}, 2);
+        // GRU with linear_before_reset has a separate bias of the hidden part of h, so both cells have 4 biases
+        const auto b = weights(element_type, {num_directions, 4 * shape.hidden_size}, 3);
+        std::shared_ptr<ov::Node> sequence;
+        if (gru_) {
+            sequence = std::make_shared<ov::op::v5::GRUSequence>(params[0],
+                                                                 params[1],
+                                                                 seq_lengths,
+                                                                 w,
+                                                                 r,
+                                                                 b,
+                                                                 shape.hidden_size,
+                                                                 direction,
+                                                                 std::vector<std::string>{"sigmoid", "tanh"},
+                                                                 std::vector<float>{},
+                                                                 std::vector<float>{},
+                                                                 0.0f,
+                                                                 true);
+        } else {
+            sequence = std::make_shared<ov::op::v5::LSTMSequence>(
+                params[0], params[1], params[2], seq_lengths, w, r, b, shape.hidden_size, direction);
+        }
+        ov::ResultVector results;
+        for (const auto& output : sequence->outputs()) {
+            results.push_back(std::make_shared<ov::op::v0::Result>(output));
+        }
+        function = std::make_shared<ov::Model>(results, params, "RNNSequence");
+    }
+
+    /**
+     * Weights are spread over [-0.5, 0.5) and scaled down with the size of the dot products, so that gates
+     * aren't saturated
+     */
+    static std::shared_ptr<ov::Node> weights(const ov::element::Type& type, const ov::Shape& shape, size_t seed) {
+        const auto length = static_cast<float>(shape.back());
+        std::vector<float> values(ov::shape_size(shape));
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<float>(static_cast<int>((i * 37 + seed * 11) % 101) - 50) / 100 /
+                        std::max(1.0f, std::sqrt(length) / 4);
+        }
+        return ov::op::v0::Constant::create(type, shape, values);
+    }
+
+    void check_persistent_kernel() {
+        const auto type = gru_ ? "GRUSequencePersistent" : "LSTMSequencePersistent";
+        const auto profiling_info = inferRequest.get_profiling_info();
+        const bool executed = std::any_of(profiling_info.begin(), profiling_info.end(), [&](const auto& info) {
+            return info.node_type == type;
+        });
+        ASSERT_TRUE(executed) << "Sequence isn't executed by " << type;
+    }
+
+    bool gru_ = false;
+};
+
+TEST_P(RNNSequencePersistentTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!CUDA::Device{}.props().cooperativeLaunch) {
+        GTEST_SKIP() << "Device doesn't support cooperative launches";
+    }
+    run();
+    check_persistent_kernel();
+}
+
+// Hidden sizes which aren't multiples of the warp size leave lanes idle, up to the limits of the kernel
+// (max_hidden_size and max_batch_size)
+const std::vector<RNNShape> shapes = {
+    {1, 1, 5, 13},
+    {3, 7, 64, 1},
+    {8, 20, 33, 64},
+    {2, 5, 17, 256},
+    {5, 3, 256, 255},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_RNNSequencePersistent,
+                        RNNSequencePersistentTest,
+                        ::testing::Combine(::testing::ValuesIn(shapes),
+                                           ::testing::Bool(),
+                                           ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                             ov::op::RecurrentSequenceDirection::REVERSE,
+                                                             ov::op::RecurrentSequenceDirection::BIDIRECTIONAL),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        RNNSequencePersistentTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
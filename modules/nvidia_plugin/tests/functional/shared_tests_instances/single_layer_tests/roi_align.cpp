@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_tests/roi_align.hpp"
+
+#include <cuda_test_constants.hpp>
+#include <vector>
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {InferenceEngine::Precision::FP32,
+                                                               InferenceEngine::Precision::FP16};
+
+const auto roiAlignParams = [](const std::string& mode) {
+    return ::testing::Combine(
+        ::testing::ValuesIn(std::vector<std::vector<size_t>>{{3, 8, 16, 16}, {2, 1, 16, 16}, {2, 1, 8, 16}}),
+        ::testing::Values(std::vector<size_t>{2, 4}),
+        ::testing::Values(2),
+        ::testing::Values(2),
+        ::testing::ValuesIn(std::vector<float>{1.0f, 0.625f}),
+        ::testing::ValuesIn(std::vector<int>{0, 2}),
+        ::testing::Values(mode),
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(ov::test::utils::DEVICE_NVIDIA));
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ROIAlign_Avg, ROIAlignLayerTest, roiAlignParams("avg"), ROIAlignLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_ROIAlign_Max, ROIAlignLayerTest, roiAlignParams("max"), ROIAlignLayerTest::getTestCaseName);
+
+}  // namespace
@@ -101,6 +101,24 @@ const auto params5D = testing::Combine(testing::ValuesIn(netPrecisions),
 
 INSTANTIATE_TEST_CASE_P(SoftMax5D, SoftMaxLayerTest, params5D, SoftMaxLayerTest::getTestCaseName);
 
+/********************* SoftMax 6D tests **************************/
+
+const std::vector<ov::Shape> inputShapes6D = {
+    {2, 3, 2, 3, 2, 3},
+};
+
+const std::vector<size_t> axis6D = {0, 2, 5};
+
+const auto params6D = testing::Combine(testing::ValuesIn(netPrecisions),
+                                       testing::Values(ov::element::undefined),
+                                       testing::Values(ov::element::undefined),
+                                       testing::ValuesIn(ov::test::static_shapes_to_test_representation(inputShapes6D)),
+                                       testing::ValuesIn(axis6D),
+                                       testing::Values(ov::test::utils::DEVICE_NVIDIA),
+                                       testing::Values(ov::AnyMap()));
+
+INSTANTIATE_TEST_CASE_P(SoftMax6D, SoftMaxLayerTest, params6D, SoftMaxLayerTest::getTestCaseName);
+
 /**************** SoftMax NN specific tests **********************/
 // resnet5: shape (1, 1001), axis 1
 // vgg: shape (1, 1000), axis 1
@@ -134,4 +152,19 @@ const auto vggParams = testing::Combine(testing::ValuesIn(netPrecisions),
 
 INSTANTIATE_TEST_CASE_P(SoftMax2Dvgg, SoftMaxLayerTest, vggParams, SoftMaxLayerTest::getTestCaseName);
 
+// Language model logits: rows longer than the warp specialisation handles
+const std::vector<ov::Shape> vocabShapes = {
+    {4, 50257},
+};
+
+const auto vocabParams = testing::Combine(testing::ValuesIn(netPrecisions),
+                                          testing::Values(ov::element::undefined),
+                                          testing::Values(ov::element::undefined),
+                                          testing::ValuesIn(ov::test::static_shapes_to_test_representation(vocabShapes)),
+                                          testing::Values(1),
+                                          testing::Values(ov::test::utils::DEVICE_NVIDIA),
+                                          testing::Values(ov::AnyMap()));
+
+INSTANTIATE_TEST_CASE_P(SoftMax2Dvocab, SoftMaxLayerTest, vocabParams, SoftMaxLayerTest::getTestCaseName);
+
 }  // namespace
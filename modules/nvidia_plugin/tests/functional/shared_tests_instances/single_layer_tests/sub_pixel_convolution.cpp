@@ -0,0 +1,152 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sigmoid.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+struct DeconvolutionShape {
+    std::vector<size_t> input;  // [batch, input channels, height, width]
+    size_t out_channels;
+    size_t kernel;
+    size_t stride;
+    std::ptrdiff_t pad_begin;
+    std::ptrdiff_t pad_end;
+    std::ptrdiff_t output_padding;
+};
+
+enum class Activation { None, Relu, Sigmoid };
+
+std::ostream& operator<<(std::ostream& os, const Activation activation) {
+    switch (activation) {
+        case Activation::None:
+            return os << "None";
+        case Activation::Relu:
+            return os << "Relu";
+        case Activation::Sigmoid:
+            return os << "Sigmoid";
+    }
+    return os;
+}
+
+using SubPixelConvolutionParams = std::tuple<DeconvolutionShape,
+                                             bool,               // Bias is added
+                                             Activation,         // Activation after the bias
+                                             ov::element::Type,  // Element type
+                                             std::string         // Device name
+                                             >;
+
+class SubPixelConvolutionTest : public testing::WithParamInterface<SubPixelConvolutionParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SubPixelConvolutionParams>& obj) {
+        DeconvolutionShape shape;
+        bool has_bias;
+        Activation activation;
+        ov::element::Type element_type;
+        std::string device;
+        std::tie(shape, has_bias, activation, element_type, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(shape.input) << "_";
+        result << "OC=" << shape.out_channels << "_";
+        result << "K=" << shape.kernel << "_";
+        result << "S=" << shape.stride << "_";
+        result << "PB=" << shape.pad_begin << "_";
+        result << "PE=" << shape.pad_end << "_";
+        result << "OP=" << shape.output_padding << "_";
+        result << "Bias=" << has_bias << "_";
+        result << "Activation=" << activation << "_";
+        result << "ET=" << element_type << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        DeconvolutionShape shape;
+        bool has_bias;
+        Activation activation;
+        ov::element::Type element_type;
+        std::tie(shape, has_bias, activation, element_type, targetDevice) = GetParam();
+        abs_threshold = element_type == ov::element::f32 ? 1e-4 : 2e-2;
+        init_input_shapes(static_shapes_to_test_representation({shape.input}));
+
+        const auto in_channels = shape.input[1];
+        const ov::Shape weights_shape{in_channels, shape.out_channels, shape.kernel, shape.kernel};
+        std::vector<float> weights(ov::shape_size(weights_shape));
+        for (size_t i = 0; i < weights.size(); ++i) {
+            weights[i] = static_cast<float>(static_cast<int>((i * 37) % 64) - 32) / 64;
+        }
+        auto param = std::make_shared<ov::op::v0::Parameter>(element_type, ov::Shape{shape.input});
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v1::ConvolutionBackpropData>(
+            param,
+            ov::op::v0::Constant::create(element_type, weights_shape, weights),
+            ov::Strides{shape.stride, shape.stride},
+            ov::CoordinateDiff{shape.pad_begin, shape.pad_begin},
+            ov::CoordinateDiff{shape.pad_end, shape.pad_end},
+            ov::Strides{1, 1},
+            ov::op::PadType::EXPLICIT,
+            ov::CoordinateDiff{shape.output_padding, shape.output_padding});
+        if (has_bias) {
+            std::vector<float> bias(shape.out_channels);
+            for (size_t i = 0; i < bias.size(); ++i) {
+                bias[i] = static_cast<float>(i % 5) / 4 - 0.5f;
+            }
+            output = std::make_shared<ov::op::v1::Add>(
+                output, ov::op::v0::Constant::create(element_type, {1, shape.out_channels, 1, 1}, bias));
+        }
+        if (activation == Activation::Relu) {
+            output = std::make_shared<ov::op::v0::Relu>(output);
+        } else if (activation == Activation::Sigmoid) {
+            output = std::make_shared<ov::op::v0::Sigmoid>(output);
+        }
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)},
+                                               ov::ParameterVector{param},
+                                               "Deconvolution");
+    }
+};
+
+TEST_P(SubPixelConvolutionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("SubPixelShuffle");
+}
+
+// Kernels which aren't multiples of the stride have zero taps in some phases, while paddings and output paddings
+// crop the phases unevenly at both ends
+const std::vector<DeconvolutionShape> shapes = {
+    {{1, 8, 7, 9}, 4, 4, 2, 1, 1, 0},
+    {{2, 3, 5, 5}, 5, 3, 2, 1, 1, 1},
+    {{1, 16, 6, 7}, 8, 2, 2, 0, 0, 0},
+    {{1, 4, 4, 6}, 3, 5, 3, 2, 1, 2},
+    {{1, 2, 3, 3}, 2, 7, 4, 0, 0, 0},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SubPixelConvolution,
+                        SubPixelConvolutionTest,
+                        ::testing::Combine(::testing::ValuesIn(shapes),
+                                           ::testing::Bool(),
+                                           ::testing::Values(Activation::None, Activation::Relu, Activation::Sigmoid),
+                                           ::testing::Values(ov::element::f32, ov::element::f16),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        SubPixelConvolutionTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,186 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cuda_test_constants.hpp>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "fused_layer_test.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather_elements.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_l2.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/scatter_elements_update.hpp"
+#include "openvino/op/scatter_update.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/topk.hpp"
+#include "openvino/op/unsqueeze.hpp"
+
+namespace ov {
+namespace test {
+namespace nvidia_gpu {
+namespace {
+
+std::shared_ptr<ov::Node> i64_constant(const std::vector<int64_t>& values) {
+    return ov::op::v0::Constant::create(ov::element::i64, ov::Shape{values.size()}, values);
+}
+
+std::shared_ptr<ov::Node> slice_tokens(const ov::Output<ov::Node>& data, int64_t start, int64_t stop, int64_t step) {
+    return std::make_shared<ov::op::v8::Slice>(
+        data, i64_constant({start}), i64_constant({stop}), i64_constant({step}), i64_constant({1}));
+}
+
+std::shared_ptr<ov::Node> topk(const ov::Output<ov::Node>& data, size_t k, int64_t axis, const std::string& mode) {
+    const auto count = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {k});
+    return std::make_shared<ov::op::v11::TopK>(data, count, axis, mode, "value");
+}
+
+using TokenMergeParams = std::tuple<std::vector<size_t>,  // Shape of x [batch, tokens, channels]
+                                    size_t,               // Channels of the metric
+                                    size_t,               // Number of merged tokens r
+                                    bool,                 // The first token is the class token, which isn't merged
+                                    std::string           // Device name
+                                    >;
+
+class TokenMergeTest : public testing::WithParamInterface<TokenMergeParams>, public FusedLayerTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TokenMergeParams>& obj) {
+        std::vector<size_t> shape;
+        size_t metric_channels;
+        size_t num_merged;
+        bool class_token;
+        std::string device;
+        std::tie(shape, metric_channels, num_merged, class_token, device) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::vec2str(shape) << "_";
+        result << "MC=" << metric_channels << "_";
+        result << "R=" << num_merged << "_";
+        result << "ClassToken=" << class_token << "_";
+        result << "trgDev=" << device;
+        return result.str();
+    }
+
+protected:
+    /**
+     * Token merging of ToMe (bipartite_soft_matching and merge_wavg) as it is exported to OpenVINO.
+     *
+     * Tokens are ranked by TopK of their scores, so the reference and the kernel agree only if scores don't tie
+     * after rounding. Hence the metric is continuous and data is f32, while sizes are counts of merged tokens.
+     */
+    void SetUp() override {
+        std::vector<size_t> shape;
+        size_t metric_channels;
+        size_t num_merged;
+        bool class_token;
+        std::tie(shape, metric_channels, num_merged, class_token, targetDevice) = GetParam();
+        abs_threshold = 1e-4;
+        const auto batch = shape[0];
+        const auto even_tokens = (shape[1] + 1) / 2;
+        const auto odd_tokens = shape[1] / 2;
+        const auto r = static_cast<int64_t>(num_merged);
+        const auto end = std::numeric_limits<int64_t>::max();
+        const auto type = ov::element::f32;
+        const ov::Shape metric_shape{batch, shape[1], metric_channels};
+        const ov::Shape size_shape{batch, shape[1], 1};
+        init_input_shapes(static_shapes_to_test_representation({metric_shape, shape, size_shape}));
+        auto metric = std::make_shared<ov::op::v0::Parameter>(type, metric_shape);
+        auto x = std::make_shared<ov::op::v0::Parameter>(type, ov::Shape{shape});
+        auto size = std::make_shared<ov::op::v0::Parameter>(type, size_shape);
+
+        auto norm = std::make_shared<ov::op::v4::ReduceL2>(metric, i64_constant({-1}), true);
+        auto normalized_metric = std::make_shared<ov::op::v1::Divide>(metric, norm);
+        std::shared_ptr<ov::Node> scores = std::make_shared<ov::op::v0::MatMul>(
+            slice_tokens(normalized_metric, 0, end, 2), slice_tokens(normalized_metric, 1, end, 2), false, true);
+        if (class_token) {
+            auto updates = ov::op::v0::Constant::create(
+                type,
+                ov::Shape{batch, 1, odd_tokens},
+                std::vector<float>(batch * odd_tokens, -std::numeric_limits<float>::infinity()));
+            scores = std::make_shared<ov::op::v3::ScatterUpdate>(scores, i64_constant({0}), updates, i64_constant({1}));
+        }
+        auto node = std::make_shared<ov::op::v11::TopK>(scores,
+                                                        ov::op::v0::Constant::create(ov::element::i64, {}, {1}),
+                                                        -1,
+                                                        ov::op::TopKMode::MAX,
+                                                        ov::op::TopKSortType::NONE);
+        auto node_max = std::make_shared<ov::op::v0::Squeeze>(node->output(0), i64_constant({2}));
+        auto ranks = topk(node_max, even_tokens, -1, "max");
+        auto edge = std::make_shared<ov::op::v0::Unsqueeze>(ranks->output(1), i64_constant({2}));
+        ov::Output<ov::Node> unmerged = slice_tokens(edge, r, end, 1);
+        if (class_token) {
+            unmerged = topk(unmerged, even_tokens - num_merged, 1, "min")->output(0);
+        }
+        auto sources = slice_tokens(edge, 0, r, 1);
+        auto destinations = std::make_shared<ov::op::v6::GatherElements>(node->output(1), sources, 1);
+
+        auto merge = [&](const ov::Output<ov::Node>& value) {
+            const auto channels = static_cast<int64_t>(value.get_shape()[2]);
+            auto expand = [&](const ov::Output<ov::Node>& index, size_t tokens) {
+                return std::make_shared<ov::op::v3::Broadcast>(
+                    index, i64_constant({static_cast<int64_t>(batch), static_cast<int64_t>(tokens), channels}));
+            };
+            auto even = slice_tokens(value, 0, end, 2);
+            auto odd = slice_tokens(value, 1, end, 2);
+            auto kept =
+                std::make_shared<ov::op::v6::GatherElements>(even, expand(unmerged, even_tokens - num_merged), 1);
+            auto merged = std::make_shared<ov::op::v6::GatherElements>(even, expand(sources, num_merged), 1);
+            using Reduction = ov::op::v12::ScatterElementsUpdate::Reduction;
+            auto summed = std::make_shared<ov::op::v12::ScatterElementsUpdate>(
+                odd, expand(destinations, num_merged), merged, i64_constant({1}), Reduction::SUM, true);
+            return std::make_shared<ov::op::v0::Concat>(ov::OutputVector{kept, summed}, 1);
+        };
+        auto merged_x = merge(std::make_shared<ov::op::v1::Multiply>(x, size));
+        auto merged_size = merge(size);
+        auto y = std::make_shared<ov::op::v1::Divide>(merged_x, merged_size);
+        function = std::make_shared<ov::Model>(
+            ov::OutputVector{y, merged_size}, ov::ParameterVector{metric, x, size}, "TokenMerge");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& target_input_static_shapes) override {
+        inputs.clear();
+        const auto& func_inputs = function->inputs();
+        for (size_t i = 0; i < func_inputs.size(); ++i) {
+            const auto& param = func_inputs[i];
+            // Sizes are counts of tokens merged by previous blocks, which are at least 1
+            const bool is_size = i == 2;
+            auto tensor = utils::create_and_fill_tensor(param.get_element_type(),
+                                                        target_input_static_shapes[i],
+                                                        is_size ? 4 : 2,
+                                                        is_size ? 1 : -1,
+                                                        is_size ? 1 : 1000);
+            inputs.insert({param.get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(TokenMergeTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_fused_layer("TokenMerge");
+}
+
+// Odd numbers of tokens have one more even token, while the number of channels isn't a multiple of the warp size
+const std::vector<TokenMergeParams> params = {
+    {{2, 16, 24}, 8, 5, false, ov::test::utils::DEVICE_NVIDIA},
+    {{1, 197, 64}, 64, 16, true, ov::test::utils::DEVICE_NVIDIA},
+    {{3, 51, 40}, 33, 25, false, ov::test::utils::DEVICE_NVIDIA},
+    {{2, 50, 100}, 16, 24, true, ov::test::utils::DEVICE_NVIDIA},
+    {{1, 5, 7}, 3, 1, true, ov::test::utils::DEVICE_NVIDIA},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TokenMerge, TokenMergeTest, ::testing::ValuesIn(params), TokenMergeTest::getTestCaseName);
+
+}  // namespace
+}  // namespace nvidia_gpu
+}  // namespace test
+}  // namespace ov
@@ -114,4 +114,35 @@ INSTANTIATE_TEST_CASE_P(TopK5D,
                                            ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
                         TopKLayerTest::getTestCaseName);
 
+// Chunks along the axis are long enough to be selected by blocks
+const std::vector<int64_t> kLarge = {
+    1,
+    10,
+    100,
+};
+
+const std::vector<int64_t> axes2D = {
+    0,
+    1,
+};
+
+const std::vector<std::vector<size_t>> shapesLarge2D = {
+    {100, 2000},
+    {2000, 100},
+};
+
+INSTANTIATE_TEST_CASE_P(TopK2DLarge,
+                        TopKLayerTest,
+                        ::testing::Combine(::testing::ValuesIn(kLarge),
+                                           ::testing::ValuesIn(axes2D),
+                                           ::testing::ValuesIn(modes),
+                                           ::testing::ValuesIn(sortTypes),
+                                           ::testing::ValuesIn(netPrecisions),
+                                           ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                                           ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                                           ::testing::Values(InferenceEngine::Layout::ANY),
+                                           ::testing::ValuesIn(shapesLarge2D),
+                                           ::testing::Values(ov::test::utils::DEVICE_NVIDIA)),
+                        TopKLayerTest::getTestCaseName);
+
 }  // namespace
@@ -41,4 +41,28 @@ INSTANTIATE_TEST_CASE_P(smoke_Transpose,
                         params,
                         TransposeLayerTest::getTestCaseName);
 
+// NCHW <-> NHWC become batched 2D transposes of tiles, head transposes of attention become copies of rows
+const std::vector<std::vector<ov::Shape>> native_input_shapes = {
+    {{2, 3, 17, 45}},
+    {{2, 64, 8, 8}},
+};
+
+const std::vector<std::vector<size_t>> native_input_order = {
+    std::vector<size_t>{0, 2, 3, 1},
+    std::vector<size_t>{0, 3, 1, 2},
+    std::vector<size_t>{0, 2, 1, 3},
+    std::vector<size_t>{3, 2, 1, 0},
+    std::vector<size_t>{0, 1, 2, 3},
+};
+
+const auto native_params = testing::Combine(testing::ValuesIn(native_input_order),
+                                            testing::Values(ov::element::f32, ov::element::f16, ov::element::i32),
+                                            testing::ValuesIn(static_shapes_to_test_representation(native_input_shapes)),
+                                            testing::Values(DEVICE_NVIDIA));
+
+INSTANTIATE_TEST_CASE_P(smoke_TransposeNative,
+                        TransposeLayerTest,
+                        native_params,
+                        TransposeLayerTest::getTestCaseName);
+
 }  // namespace
@@ -0,0 +1,156 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cudnn.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <cuda_operation_registry.hpp>
+#include <iostream>
+#include <optional>
+#include <sstream>
+
+#include "operation_benchmark.hpp"
+#include "regression_gate.hpp"
+
+using namespace ov::nvidia_gpu::microbenchmarks;
+
+namespace {
+
+std::string shapeName(const ov::Shape& shape) {
+    std::ostringstream name;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        name << (i ? "x" : "") << shape[i];
+    }
+    return name.str();
+}
+
+std::string versions() {
+    int driver = 0;
+    int runtime = 0;
+    cudaDriverGetVersion(&driver);
+    cudaRuntimeGetVersion(&runtime);
+    return fmt::format("driver {}, CUDA runtime {}, cuDNN {}", driver, runtime, cudnnGetVersion());
+}
+
+/**
+ * Options of the regression gate, which are removed from arguments before they are parsed by Google Benchmark
+ */
+struct GateOptions {
+    std::optional<std::string> baseline;
+    std::optional<std::string> baselineOut;
+    std::string diff = "regression_diff.json";
+    double threshold = 0.1;
+};
+
+GateOptions parseGateOptions(int& argc, char** argv) {
+    GateOptions options;
+    int kept = 1;
+    for (int i = 1; i < argc; ++i) {
+        const auto value = [&](const char* flag) -> std::optional<std::string> {
+            const auto length = std::strlen(flag);
+            if (std::strncmp(argv[i], flag, length) == 0 && argv[i][length] == '=') {
+                return std::string{argv[i] + length + 1};
+            }
+            return std::nullopt;
+        };
+        if (auto baseline = value("--baseline")) {
+            options.baseline = std::move(baseline);
+        } else if (auto baselineOut = value("--baseline_out")) {
+            options.baselineOut = std::move(baselineOut);
+        } else if (auto diff = value("--regression_diff")) {
+            options.diff = std::move(*diff);
+        } else if (auto threshold = value("--regression_threshold")) {
+            options.threshold = std::stod(*threshold);
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+    return options;
+}
+
+}  // namespace
+
+/**
+ * Benchmarks operations of the plugin on representative shapes and element types.
+ * Results are saved as JSON with --benchmark_out=<file> --benchmark_out_format=json
+ *
+ * Regression gate options:
+ *   --baseline_out=<file>          stores times of the run as the baseline of the device
+ *   --baseline=<file>              compares times with the baseline of the same device and fails with exit code 2
+ *                                  if any benchmark is slower than the threshold
+ *   --regression_diff=<file>       comparison with the baseline as JSON (regression_diff.json by default)
+ *   --regression_threshold=<ratio> tolerated slowdown (0.1 by default, i.e. 10%)
+ */
+int main(int argc, char** argv) {
+    const auto gate = parseGateOptions(argc, argv);
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    const CUDA::Device device{};
+    const auto props = device.props();
+    const ov::nvidia_gpu::utils::DevicePeak peak{props};
+    benchmark::AddCustomContext("device", props.name);
+    benchmark::AddCustomContext("peak_GB/s", fmt::format("{:.1f}", peak.bytesPerSecond / 1e9));
+    benchmark::AddCustomContext("peak_fp32_TFLOP/s", fmt::format("{:.2f}", peak.flopsPerSecond / 1e12));
+
+    static const auto cases = operationCases();
+    const std::vector<ov::element::Type> defaultTypes{
+        ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::i8};
+    for (const auto& operationCase : cases) {
+        const auto& types = operationCase.types.empty() ? defaultTypes : operationCase.types;
+        for (const auto& type : types) {
+            for (const auto& shape : operationCase.shapes) {
+                benchmark::RegisterBenchmark(
+                    fmt::format("{}/{}/{}", operationCase.name, type.get_type_name(), shapeName(shape)).c_str(),
+                    [&, type, shape](benchmark::State& state) {
+                        benchmarkOperation(state, device, peak, operationCase, type, shape);
+                    })
+                    ->UseManualTime()
+                    ->Unit(benchmark::kMicrosecond);
+            }
+        }
+    }
+
+    // Registered operations without cases are listed, so that gaps in coverage are visible in the results
+    std::string uncovered;
+    for (const auto& name : ov::nvidia_gpu::OperationRegistry::getInstance().getOperationNames()) {
+        if (std::none_of(cases.begin(), cases.end(), [&](const auto& c) { return c.name == name; })) {
+            uncovered += (uncovered.empty() ? "" : ",") + name;
+        }
+    }
+    benchmark::AddCustomContext("operations_without_benchmarks", uncovered);
+
+    std::optional<BenchmarkTimes> baseline;
+    if (gate.baseline) {
+        baseline = readBaseline(*gate.baseline);
+        if (baseline->device != props.name) {
+            std::cerr << fmt::format("Baseline {} is measured on {}, not on {}\n",
+                                     *gate.baseline, baseline->device, props.name);
+            return 1;
+        }
+    }
+
+    RecordingReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    const BenchmarkTimes current{props.name, versions(), reporter.times()};
+    if (gate.baselineOut) {
+        writeBaseline(*gate.baselineOut, current);
+    }
+    if (baseline) {
+        const auto regressions = writeRegressionDiff(gate.diff, *baseline, current, gate.threshold);
+        if (regressions > 0) {
+            std::cerr << fmt::format("{} benchmarks regressed by more than {:.0f}% (see {})\n",
+                                     regressions, gate.threshold * 100, gate.diff);
+            return 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "operation_benchmark.hpp"
+
+#include <algorithm>
+#include <cuda/event.hpp>
+#include <cuda_graph_context.hpp>
+#include <cuda_inference_request_context.hpp>
+#include <cuda_operation_registry.hpp>
+#include <cuda_simple_execution_delegator.hpp>
+#include <cuda_thread_context.hpp>
+#include <error.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace microbenchmarks {
+
+namespace {
+
+// Executions are measured in batches, so that time of a single small kernel isn't dominated by event latency
+constexpr int kExecutionsPerIteration = 10;
+
+std::vector<CUDA::Allocation> allocate(const CUDA::Stream& stream, const std::vector<size_t>& sizes) {
+    std::vector<CUDA::Allocation> allocations;
+    allocations.reserve(sizes.size());
+    for (const auto size : sizes) {
+        allocations.push_back(stream.malloc(std::max<size_t>(size, 1)));
+        // Inputs are zeroed, so that timings don't depend on NaNs or denormals of uninitialized memory
+        throwIfError(cudaMemsetAsync(allocations.back().get(), 0, std::max<size_t>(size, 1), stream.get()));
+    }
+    return allocations;
+}
+
+}  // namespace
+
+void benchmarkOperation(benchmark::State& state,
+                        const CUDA::Device& device,
+                        const utils::DevicePeak& peak,
+                        const OperationCase& operationCase,
+                        const ov::element::Type type,
+                        const ov::Shape& shape) {
+    ThreadContext threadContext{device};
+    const auto& stream = threadContext.stream();
+    std::shared_ptr<ov::Node> node;
+    OperationBase::Ptr operation;
+    try {
+        node = operationCase.create(type, shape);
+        std::vector<TensorID> inputIds;
+        for (unsigned i = 0; i < node->get_input_size(); ++i) {
+            inputIds.emplace_back(i);
+        }
+        std::vector<TensorID> outputIds;
+        for (unsigned i = 0; i < node->get_output_size(); ++i) {
+            outputIds.emplace_back(static_cast<unsigned>(node->get_input_size()) + i);
+        }
+        operation = OperationRegistry::getInstance().createOperation(
+            CreationContext{device, false}, node, std::move(inputIds), std::move(outputIds));
+    } catch (const std::exception& e) {
+        state.SkipWithMessage(e.what());
+        return;
+    }
+
+    std::vector<size_t> inputSizes;
+    for (const auto& input : node->inputs()) {
+        inputSizes.push_back(input.get_tensor().size());
+    }
+    std::vector<size_t> outputSizes;
+    for (const auto& output : node->outputs()) {
+        outputSizes.push_back(output.get_tensor().size());
+    }
+    const auto request = operation->GetWorkBufferRequest();
+    const auto inputAllocations = allocate(stream, inputSizes);
+    const auto outputAllocations = allocate(stream, outputSizes);
+    const auto immutableAllocations = allocate(stream, request.immutable_sizes);
+    const auto mutableAllocations = allocate(stream, request.mutable_sizes);
+    std::vector<CUDA::DevicePointer<const void*>> inputs(inputAllocations.begin(), inputAllocations.end());
+    std::vector<CUDA::DevicePointer<void*>> outputs(outputAllocations.begin(), outputAllocations.end());
+    IOperationExec::Buffers immutableBuffers(immutableAllocations.begin(), immutableAllocations.end());
+    if (!immutableBuffers.empty()) {
+        operation->InitSharedImmutableWorkbuffers(immutableBuffers);
+    }
+    Workbuffers workbuffers{{immutableBuffers.begin(), immutableBuffers.end()},
+                            {mutableAllocations.begin(), mutableAllocations.end()}};
+
+    const std::vector<std::shared_ptr<ov::Tensor>> emptyTensors;
+    const std::map<std::string, std::size_t> emptyMapping;
+    CancellationToken token;
+    SimpleExecutionDelegator executionDelegator;
+    CudaGraphContext cudaGraphContext;
+    const InferenceRequestContext context{emptyTensors,
+                                          emptyMapping,
+                                          emptyTensors,
+                                          emptyMapping,
+                                          threadContext,
+                                          token,
+                                          executionDelegator,
+                                          cudaGraphContext,
+                                          true};
+    try {
+        // The first execution includes lazy initialization (e.g. loading of kernels), so it isn't measured
+        operation->Execute(context, inputs, outputs, workbuffers);
+        stream.synchronize();
+    } catch (const std::exception& e) {
+        state.SkipWithMessage(e.what());
+        return;
+    }
+
+    CUDA::Event start;
+    CUDA::Event stop;
+    double seconds = 0;
+    for (auto _ : state) {
+        start.record(stream);
+        for (int i = 0; i < kExecutionsPerIteration; ++i) {
+            operation->Execute(context, inputs, outputs, workbuffers);
+        }
+        stop.record(stream);
+        stop.synchronize();
+        const auto iterationSeconds = stop.elapsedSince(start) / 1e3 / kExecutionsPerIteration;
+        state.SetIterationTime(iterationSeconds);
+        seconds += iterationSeconds;
+    }
+
+    const auto flops = utils::estimateFlops(*node);
+    const auto bytes = utils::estimateBytes(*node);
+    const auto executions = static_cast<double>(state.iterations());
+    const auto bytesPerSecond = bytes * executions / seconds;
+    state.counters["GB/s"] = bytesPerSecond / 1e9;
+    state.counters["bandwidth_utilization"] = bytesPerSecond / peak.bytesPerSecond;
+    if (flops > 0) {
+        const auto flopsPerSecond = flops * executions / seconds;
+        state.counters["TFLOP/s"] = flopsPerSecond / 1e12;
+        state.counters["compute_utilization"] = flopsPerSecond / peak.flopsPerSecond;
+    }
+    state.counters["roofline_fraction"] = peak.fraction(flops, bytes, seconds / executions);
+    state.SetLabel(std::string{operation->GetCategory()});
+}
+
+}  // namespace microbenchmarks
+}  // namespace nvidia_gpu
+}  // namespace ov
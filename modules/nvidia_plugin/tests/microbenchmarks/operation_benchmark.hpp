@@ -0,0 +1,32 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cuda/runtime.hpp>
+#include <utils/roofline.hpp>
+
+#include "operation_cases.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace microbenchmarks {
+
+/**
+ * Executes the operation created by OperationRegistry for the node of the case and reports time of an execution
+ * measured by CUDA events, achieved GB/s and TFLOP/s and their ratios to the peak of the device.
+ * Element types and shapes the plugin doesn't support are skipped with the message of the failure
+ */
+void benchmarkOperation(benchmark::State& state,
+                        const CUDA::Device& device,
+                        const utils::DevicePeak& peak,
+                        const OperationCase& operationCase,
+                        ov::element::Type type,
+                        const ov::Shape& shape);
+
+}  // namespace microbenchmarks
+}  // namespace nvidia_gpu
+}  // namespace ov
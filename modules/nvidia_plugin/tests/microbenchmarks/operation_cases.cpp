@@ -0,0 +1,197 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "operation_cases.hpp"
+
+#include <openvino/op/ops.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace microbenchmarks {
+
+namespace {
+
+const std::vector<ov::Shape> kElementwiseShapes{{1, 1024}, {64, 16384}, {256, 65536}};
+const std::vector<ov::Shape> kImageShapes{{1, 64, 56, 56}, {8, 128, 28, 28}, {32, 256, 14, 14}};
+const std::vector<ov::Shape> kRowShapes{{64, 1024}, {1024, 4096}, {8192, 512}};
+
+std::shared_ptr<ov::op::v0::Parameter> parameter(const ov::element::Type type, const ov::Shape& shape) {
+    return std::make_shared<ov::op::v0::Parameter>(type, shape);
+}
+
+std::shared_ptr<ov::op::v0::Constant> indices(const std::vector<int64_t>& values) {
+    return ov::op::v0::Constant::create(ov::element::i64, ov::Shape{values.size()}, values);
+}
+
+template <typename TOperation>
+OperationCase unary() {
+    return {TOperation::get_type_info_static().name,
+            [](const ov::element::Type type, const ov::Shape& shape) {
+                return std::make_shared<TOperation>(parameter(type, shape));
+            },
+            kElementwiseShapes};
+}
+
+template <typename TOperation>
+OperationCase binary(std::vector<ov::element::Type> types = {}) {
+    return {TOperation::get_type_info_static().name,
+            [](const ov::element::Type type, const ov::Shape& shape) {
+                return std::make_shared<TOperation>(parameter(type, shape), parameter(type, shape));
+            },
+            kElementwiseShapes,
+            std::move(types)};
+}
+
+template <typename TReduce>
+OperationCase reduce() {
+    return {TReduce::get_type_info_static().name,
+            [](const ov::element::Type type, const ov::Shape& shape) {
+                const auto axis = static_cast<int64_t>(shape.size()) - 1;
+                return std::make_shared<TReduce>(parameter(type, shape), indices({axis}), false);
+            },
+            kRowShapes};
+}
+
+template <typename TPool, typename... Args>
+OperationCase pool(Args... args) {
+    return {TPool::get_type_info_static().name,
+            [args...](const ov::element::Type type, const ov::Shape& shape) {
+                return std::make_shared<TPool>(parameter(type, shape),
+                                               ov::Strides{2, 2},
+                                               ov::Shape{0, 0},
+                                               ov::Shape{0, 0},
+                                               ov::Shape{2, 2},
+                                               args...);
+            },
+            kImageShapes};
+}
+
+}  // namespace
+
+std::vector<OperationCase> operationCases() {
+    using namespace ov::op;
+    const auto boolean = std::vector<ov::element::Type>{ov::element::boolean};
+    return {
+        unary<v0::Abs>(),
+        unary<v0::Cos>(),
+        unary<v0::Exp>(),
+        unary<v0::Floor>(),
+        unary<v7::Gelu>(),
+        unary<v4::HSwish>(),
+        unary<v0::Log>(),
+        unary<v4::Mish>(),
+        unary<v0::Relu>(),
+        unary<v0::Sigmoid>(),
+        unary<v0::Sin>(),
+        unary<v0::Sqrt>(),
+        unary<v4::Swish>(),
+        unary<v0::Tanh>(),
+        {v0::Elu::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v0::Elu>(parameter(type, shape), 1.0);
+         },
+         kElementwiseShapes},
+        {v0::Clamp::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v0::Clamp>(parameter(type, shape), 0.0, 6.0);
+         },
+         kElementwiseShapes},
+        binary<v1::Add>(),
+        binary<v1::Subtract>(),
+        binary<v1::Multiply>(),
+        binary<v1::Divide>(),
+        binary<v1::Maximum>(),
+        binary<v1::Minimum>(),
+        binary<v1::Power>(),
+        binary<v0::SquaredDifference>(),
+        binary<v1::FloorMod>(),
+        binary<v1::Equal>(),
+        binary<v1::Greater>(),
+        binary<v1::Less>(),
+        {v1::LogicalNot::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v1::LogicalNot>(parameter(type, shape));
+         },
+         kElementwiseShapes,
+         boolean},
+        {v0::Convert::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             const auto destination = type == ov::element::f32 ? ov::element::f16 : ov::element::f32;
+             return std::make_shared<v0::Convert>(parameter(type, shape), destination);
+         },
+         kElementwiseShapes},
+        {v1::Select::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v1::Select>(
+                 parameter(ov::element::boolean, shape), parameter(type, shape), parameter(type, shape));
+         },
+         kElementwiseShapes},
+        // Shapes are {M, K, N}
+        {v0::MatMul::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v0::MatMul>(parameter(type, {shape[0], shape[1]}),
+                                                 parameter(type, {shape[1], shape[2]}));
+         },
+         {{1, 4096, 4096}, {512, 1024, 1024}, {4096, 4096, 4096}}},
+        // 3x3 convolutions keeping the number of channels and the size of images
+        {v1::Convolution::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v1::Convolution>(parameter(type, shape),
+                                                      parameter(type, {shape[1], shape[1], 3, 3}),
+                                                      ov::Strides{1, 1},
+                                                      ov::CoordinateDiff{1, 1},
+                                                      ov::CoordinateDiff{1, 1},
+                                                      ov::Strides{1, 1});
+         },
+         kImageShapes},
+        pool<v1::MaxPool>(),
+        pool<v1::AvgPool>(true),
+        {v1::Softmax::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v1::Softmax>(parameter(type, shape), shape.size() - 1);
+         },
+         kRowShapes},
+        reduce<v1::ReduceSum>(),
+        reduce<v1::ReduceMean>(),
+        reduce<v1::ReduceMax>(),
+        {v1::Transpose::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v1::Transpose>(parameter(type, shape), indices({0, 2, 1, 3}));
+         },
+         {{1, 12, 128, 64}, {16, 12, 512, 64}, {32, 16, 1024, 64}}},
+        {v0::Concat::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v0::Concat>(ov::OutputVector{parameter(type, shape), parameter(type, shape)}, 1);
+         },
+         kImageShapes},
+        // Every other element of the last axis
+        {v1::StridedSlice::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             const std::vector<int64_t> begin(shape.size(), 0);
+             const std::vector<int64_t> end(shape.begin(), shape.end());
+             std::vector<int64_t> strides(shape.size(), 1);
+             strides.back() = 2;
+             return std::make_shared<v1::StridedSlice>(parameter(type, shape),
+                                                       indices(begin),
+                                                       indices(end),
+                                                       indices(strides),
+                                                       std::vector<int64_t>{},
+                                                       std::vector<int64_t>{});
+         },
+         kImageShapes},
+        // Rows of an embedding table {vocabulary, hidden size} taken by 512 tokens
+        {v8::Gather::get_type_info_static().name,
+         [](const ov::element::Type type, const ov::Shape& shape) {
+             return std::make_shared<v8::Gather>(
+                 parameter(type, shape),
+                 parameter(ov::element::i32, {1, 512}),
+                 ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {0}));
+         },
+         {{32000, 1024}, {32000, 4096}, {128000, 4096}}},
+    };
+}
+
+}  // namespace microbenchmarks
+}  // namespace nvidia_gpu
+}  // namespace ov
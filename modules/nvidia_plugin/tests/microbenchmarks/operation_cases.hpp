@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <openvino/core/node.hpp>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace microbenchmarks {
+
+/**
+ * @brief Node of a registered operation, which is benchmarked on representative shapes and element types
+ */
+struct OperationCase {
+    // Name the operation is registered by in OperationRegistry
+    std::string name;
+    // Creates the node, the meaning of the shape is specific to the case (e.g. M, K and N of MatMul)
+    std::function<std::shared_ptr<ov::Node>(ov::element::Type, const ov::Shape&)> create;
+    std::vector<ov::Shape> shapes;
+    // Element types the case is benchmarked with, f32, f16, bf16 and i8 if empty
+    std::vector<ov::element::Type> types;
+};
+
+std::vector<OperationCase> operationCases();
+
+}  // namespace microbenchmarks
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,138 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "regression_gate.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace microbenchmarks {
+
+namespace {
+
+constexpr char kDevicePrefix[] = "# device: ";
+constexpr char kVersionsPrefix[] = "# versions: ";
+
+bool startsWith(const std::string& line, const std::string& prefix) { return line.rfind(prefix, 0) == 0; }
+
+std::string jsonString(const std::string& value) {
+    std::string result{"\""};
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + '"';
+}
+
+}  // namespace
+
+BenchmarkTimes readBaseline(const std::string& path) {
+    std::ifstream file{path};
+    if (!file) {
+        throw std::runtime_error{fmt::format("Baseline {} can't be read", path)};
+    }
+    BenchmarkTimes baseline;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (startsWith(line, kDevicePrefix)) {
+            baseline.device = line.substr(sizeof(kDevicePrefix) - 1);
+        } else if (startsWith(line, kVersionsPrefix)) {
+            baseline.versions = line.substr(sizeof(kVersionsPrefix) - 1);
+        } else if (!line.empty() && line[0] != '#') {
+            // Names of benchmarks don't contain commas, so the time follows the last one
+            const auto comma = line.rfind(',');
+            if (comma == std::string::npos) {
+                throw std::runtime_error{fmt::format("Malformed line of baseline {}: {}", path, line)};
+            }
+            baseline.times[line.substr(0, comma)] = std::stod(line.substr(comma + 1));
+        }
+    }
+    return baseline;
+}
+
+void writeBaseline(const std::string& path, const BenchmarkTimes& times) {
+    std::ofstream file{path};
+    if (!file) {
+        throw std::runtime_error{fmt::format("Baseline {} can't be written", path)};
+    }
+    file << kDevicePrefix << times.device << '\n' << kVersionsPrefix << times.versions << '\n';
+    for (const auto& [name, time] : times.times) {
+        file << fmt::format("{},{:.4f}\n", name, time);
+    }
+}
+
+size_t writeRegressionDiff(const std::string& path,
+                           const BenchmarkTimes& baseline,
+                           const BenchmarkTimes& current,
+                           const double threshold) {
+    std::ofstream file{path};
+    if (!file) {
+        throw std::runtime_error{fmt::format("Regression diff {} can't be written", path)};
+    }
+    std::vector<std::string> entries;
+    size_t regressions = 0;
+    for (const auto& [name, time] : current.times) {
+        const auto base = baseline.times.find(name);
+        if (base == baseline.times.end()) {
+            entries.push_back(fmt::format(
+                R"({{"name":{},"current_us":{:.4f},"status":"new"}})", jsonString(name), time));
+            continue;
+        }
+        const auto ratio = base->second > 0 ? time / base->second : 1.0;
+        const char* status = "unchanged";
+        if (ratio > 1 + threshold) {
+            status = "regressed";
+            ++regressions;
+        } else if (ratio < 1 - threshold) {
+            status = "improved";
+        }
+        entries.push_back(fmt::format(R"({{"name":{},"baseline_us":{:.4f},"current_us":{:.4f},"ratio":{:.4f},)"
+                                      R"("status":"{}"}})",
+                                      jsonString(name),
+                                      base->second,
+                                      time,
+                                      ratio,
+                                      status));
+    }
+    for (const auto& [name, time] : baseline.times) {
+        if (current.times.count(name) == 0) {
+            entries.push_back(fmt::format(
+                R"({{"name":{},"baseline_us":{:.4f},"status":"missing"}})", jsonString(name), time));
+        }
+    }
+    file << "{\"device\":" << jsonString(current.device) << ",\"baseline_versions\":" << jsonString(baseline.versions)
+         << ",\"current_versions\":" << jsonString(current.versions) << ",\"threshold\":" << threshold
+         << ",\"regressions\":" << regressions << ",\"benchmarks\":[";
+    for (size_t i = 0; i < entries.size(); ++i) {
+        file << (i == 0 ? "\n" : ",\n") << entries[i];
+    }
+    file << "\n]}\n";
+    return regressions;
+}
+
+void RecordingReporter::ReportRuns(const std::vector<Run>& runs) {
+    for (const auto& run : runs) {
+        if (run.run_type != Run::RT_Iteration || run.skipped) {
+            continue;
+        }
+        const auto microseconds = run.GetAdjustedRealTime() / benchmark::GetTimeUnitMultiplier(run.time_unit) * 1e6;
+        // The fastest of repetitions is the least affected by noise of other work on the device
+        const auto [it, inserted] = times_.emplace(run.benchmark_name(), microseconds);
+        if (!inserted) {
+            it->second = std::min(it->second, microseconds);
+        }
+    }
+    ConsoleReporter::ReportRuns(runs);
+}
+
+}  // namespace microbenchmarks
+}  // namespace nvidia_gpu
+}  // namespace ov
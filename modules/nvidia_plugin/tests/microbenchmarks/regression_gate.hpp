@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace microbenchmarks {
+
+/**
+ * Times of benchmarks of operations on a device, which are stored as the baseline of the device
+ */
+struct BenchmarkTimes {
+    // Name of the device (GPU SKU), timings of different devices aren't comparable
+    std::string device;
+    // Versions of the driver, CUDA runtime and cuDNN the timings are measured with
+    std::string versions;
+    // Time of an execution in microseconds by name of the benchmark
+    std::map<std::string, double> times;
+};
+
+/**
+ * Reads the baseline written by writeBaseline(): "# device: <name>" and "# versions: <versions>" header lines
+ * followed by "<benchmark>,<microseconds>" lines
+ * @throws std::runtime_error if the file can't be read
+ */
+BenchmarkTimes readBaseline(const std::string& path);
+
+/**
+ * @throws std::runtime_error if the file can't be written
+ */
+void writeBaseline(const std::string& path, const BenchmarkTimes& times);
+
+/**
+ * Compares current times with the baseline and writes the comparison of each benchmark as JSON:
+ * status is "regressed" if the benchmark is slower than the baseline by more than the threshold,
+ * "improved" if it is faster by more than the threshold, "unchanged", "new" or "missing" otherwise
+ * @param threshold Tolerated relative slowdown, e.g. 0.1 for 10%
+ * @returns Number of regressed benchmarks
+ * @throws std::runtime_error if the file can't be written
+ */
+size_t writeRegressionDiff(const std::string& path,
+                           const BenchmarkTimes& baseline,
+                           const BenchmarkTimes& current,
+                           double threshold);
+
+/**
+ * Console reporter, which also records time of an execution of each benchmark which isn't skipped
+ */
+class RecordingReporter : public benchmark::ConsoleReporter {
+public:
+    void ReportRuns(const std::vector<Run>& runs) override;
+
+    const std::map<std::string, double>& times() const { return times_; }
+
+private:
+    std::map<std::string, double> times_;
+};
+
+}  // namespace microbenchmarks
+}  // namespace nvidia_gpu
+}  // namespace ov
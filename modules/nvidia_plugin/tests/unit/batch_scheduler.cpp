@@ -0,0 +1,81 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cuda_plugin.hpp"
+#include "nvidia/properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+constexpr std::size_t kBatchSize = 4;
+constexpr std::size_t kSize = 8;
+
+/**
+ * Creates stateful model accumulating its inputs, the state starts from zeros
+ */
+std::shared_ptr<ov::Model> create_accumulator_model() {
+    const ov::Shape shape{1, kSize};
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto variable =
+        std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, "sum"});
+    auto read_value = std::make_shared<ov::op::v6::ReadValue>(variable);
+    auto add = std::make_shared<ov::op::v1::Add>(read_value, input);
+    auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(
+        ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{input}, "Accumulator");
+}
+
+}  // namespace
+
+TEST(BatchSchedulerTest, StatesOfBatchedRequestsStayWithTheirSequences) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(create_accumulator_model(),
+                                                {ov::device::id("0"),
+                                                 ov::nvidia_gpu::dynamic_batch_size(kBatchSize),
+                                                 ov::nvidia_gpu::dynamic_batch_timeout(10)});
+    const auto& input = compiled_model->inputs().at(0);
+    const auto& output = compiled_model->outputs().at(0);
+
+    // The last sequence joins the batch after the first step, so it has one step less
+    constexpr std::size_t kSteps = 3;
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    std::vector<ov::Tensor> inputs;
+    for (std::size_t i = 0; i < kBatchSize; ++i) {
+        requests.push_back(compiled_model->create_infer_request());
+        inputs.emplace_back(ov::element::f32, ov::Shape{1, kSize});
+        std::fill_n(inputs.back().data<float>(), kSize, static_cast<float>(i + 1));
+        requests.back()->set_tensor(input, ov::get_tensor_impl(inputs.back()));
+    }
+    for (std::size_t step = 0; step < kSteps; ++step) {
+        const auto active = step == 0 ? kBatchSize - 1 : kBatchSize;
+        for (std::size_t i = 0; i < active; ++i) {
+            requests[i]->start_async();
+        }
+        for (std::size_t i = 0; i < active; ++i) {
+            requests[i]->wait();
+            const auto steps = i == kBatchSize - 1 ? step : step + 1;
+            const auto tensor = requests[i]->get_tensor(output);
+            const auto* data = static_cast<const float*>(tensor->data());
+            for (std::size_t k = 0; k < kSize; ++k) {
+                ASSERT_FLOAT_EQ(data[k], static_cast<float>(steps * (i + 1)))
+                    << "step " << step << ", sequence " << i << ", element " << k;
+            }
+        }
+    }
+}
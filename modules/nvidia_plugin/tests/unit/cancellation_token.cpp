@@ -24,4 +24,12 @@ TEST_F(CancellationTokenTest, Cancel_No_Throw_Callback) {
     CancellationToken token{[&is_cancelled] { is_cancelled = true; }};
     ASSERT_NO_THROW(token.cancel());
     ASSERT_TRUE(is_cancelled);
-}
\ No newline at end of file
+}
+TEST_F(CancellationTokenTest, Cancelled_Until_Reset) {
+    CancellationToken token{};
+    ASSERT_FALSE(token.isCancelled());
+    token.cancel();
+    ASSERT_TRUE(token.isCancelled());
+    token.reset();
+    ASSERT_FALSE(token.isCancelled());
+}
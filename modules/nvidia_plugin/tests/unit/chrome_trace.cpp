@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_chrome_trace.hpp>
+#include <sstream>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+ChromeTrace::Event makeEvent(const std::string& name, const std::size_t request) {
+    return {name, "stage", ChromeTrace::Clock::now(), ChromeTrace::Duration{1.0}, {request, std::nullopt}};
+}
+
+std::string written(const ChromeTrace& trace) {
+    std::stringstream stream;
+    trace.write(stream);
+    return stream.str();
+}
+
+}  // namespace
+
+TEST(ChromeTraceTest, EventsAreTagged) {
+    ChromeTrace trace{""};
+    trace.add({"conv", "operation", ChromeTrace::Clock::now(), ChromeTrace::Duration{2.5}, {3, 7}, true});
+    const auto json = written(trace);
+    ASSERT_NE(json.find(R"("name":"conv","cat":"operation","ph":"X")"), std::string::npos);
+    ASSERT_NE(json.find(R"("dur":2.500,"pid":1,"tid":3,"args":{"request":3,"block":7}})"), std::string::npos);
+}
+
+TEST(ChromeTraceTest, RingBufferKeepsLatestEvents) {
+    ChromeTrace trace{"", 2};
+    trace.add(makeEvent("first", 0));
+    trace.add(makeEvent("second", 0));
+    trace.add(makeEvent("third", 0));
+    const auto json = written(trace);
+    ASSERT_EQ(json.find("first"), std::string::npos);
+    const auto second = json.find("second");
+    const auto third = json.find("third");
+    ASSERT_NE(second, std::string::npos);
+    ASSERT_NE(third, std::string::npos);
+    ASSERT_LT(second, third);
+}
+
+TEST(ChromeTraceTest, NamesAreEscaped) {
+    ChromeTrace trace{""};
+    trace.add(makeEvent("a\"b\\c\n", 0));
+    ASSERT_NE(written(trace).find(R"("a\"b\\c\u000a")"), std::string::npos);
+}
+
+TEST(ChromeTraceTest, ScopeOfDisabledTraceDoesNothing) {
+    ChromeTrace trace{""};
+    { ChromeTrace::Scope scope{nullptr, "stage", {}}; }
+    { ChromeTrace::Scope scope{&trace, "launch", {1, std::nullopt}}; }
+    const auto json = written(trace);
+    ASSERT_EQ(json.find(R"("name":"stage")"), std::string::npos);
+    ASSERT_NE(json.find(R"("name":"launch")"), std::string::npos);
+}
+
+TEST(ChromeTraceTest, FileIsShared) {
+    auto trace = ChromeTrace::get("");
+    ASSERT_EQ(ChromeTrace::get(""), trace);
+    ASSERT_NE(trace->nextRequest(), trace->nextRequest());
+}
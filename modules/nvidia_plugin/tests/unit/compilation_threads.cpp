@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cuda_creation_context.hpp>
+#include <future>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "cuda_plugin.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+std::shared_ptr<ov::Model> create_convolutions_test_model(std::size_t num_convolutions) {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<float> distribution{-0.5f, 0.5f};
+    const std::size_t channels = 16;
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, channels, 32, 32});
+    ov::Output<ov::Node> output = param;
+    for (std::size_t i = 0; i < num_convolutions; ++i) {
+        std::vector<float> weights(channels * channels * 3 * 3);
+        for (auto& weight : weights) {
+            weight = distribution(generator);
+        }
+        auto filter =
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{channels, channels, 3, 3}, weights);
+        auto convolution = std::make_shared<ov::op::v1::Convolution>(output,
+                                                                     filter,
+                                                                     ov::Strides{1, 1},
+                                                                     ov::CoordinateDiff{1, 1},
+                                                                     ov::CoordinateDiff{1, 1},
+                                                                     ov::Strides{1, 1});
+        auto relu = std::make_shared<ov::op::v0::Relu>(convolution);
+        output = std::make_shared<ov::op::v1::Add>(relu, output);
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(output);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "Convolutions");
+}
+
+std::vector<float> infer(const std::shared_ptr<ov::Model>& model, int num_threads) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(model, {ov::device::id("0"), ov::compilation_num_threads(num_threads)});
+    auto request = compiled_model->create_infer_request();
+    const auto& input_port = compiled_model->inputs().at(0);
+    ov::Tensor input{input_port.get_element_type(), input_port.get_shape()};
+    for (std::size_t i = 0; i < input.get_size(); ++i) {
+        input.data<float>()[i] = static_cast<float>(i % 7) - 3.0f;
+    }
+    request->set_tensor(input_port, ov::get_tensor_impl(input));
+    request->infer();
+    const auto output = request->get_tensor(compiled_model->outputs().at(0));
+    const auto* data = static_cast<const float*>(output->data());
+    return {data, data + output->get_size()};
+}
+
+}  // namespace
+
+TEST(CompilationThreadsTest, ParallelCreationMatchesSerialCreation) {
+    const auto model = create_convolutions_test_model(16);
+    const auto serial = infer(model, 1);
+    // Operations created concurrently select the same algorithms, so results are bitwise equal
+    ASSERT_EQ(infer(model, 8), serial);
+}
+
+TEST(CompilationThreadsTest, BenchmarksOfWorkerThreadsAreSerialized) {
+    CreationOptions options;
+    options.compilation_num_threads = 8;
+    const CreationContext context{CUDA::Device{0}, true, options};
+    std::atomic<bool> benchmarked{false};
+    std::future<void> worker;
+    {
+        const auto lock = context.lockBenchmarks();
+        worker = std::async(std::launch::async, [&] {
+            const auto workerContext = context.forWorkerThread();
+            const auto workerLock = workerContext.lockBenchmarks();
+            benchmarked = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        ASSERT_FALSE(benchmarked);
+    }
+    worker.get();
+    ASSERT_TRUE(benchmarked);
+}
@@ -4,9 +4,14 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <nvidia/nvidia_config.hpp>
+#include <nvidia/properties.hpp>
 #include <ops/matmul.hpp>
+#include <thread>
 #include <typeinfo>
 
 #include "cuda_compiled_model.hpp"
@@ -47,7 +52,7 @@ public:
         execSequence.insert(execSequence.end(), graph_exec_sequence.begin(), graph_exec_sequence.end());
         return execSequence;
     }
-    const auto& GetMemoryManagerPool(const std::shared_ptr<CompiledModel>& compiled_model) {
+    auto GetMemoryManagerPool(const std::shared_ptr<CompiledModel>& compiled_model) {
         return compiled_model->get_memory_pool();
     }
 
@@ -126,7 +131,7 @@ TEST_P(NumStreams1CompileModelTest, CompileModel_OptimalNumberInferRequests_1_Su
     constexpr auto total_streams = 1;
     auto compiled_model = plugin->compile_model(model_, properties);
     auto cuda_compiled_model = std::dynamic_pointer_cast<CompiledModel>(compiled_model);
-    auto& memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
+    auto memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
     ASSERT_EQ(memoryManagerPool->Size(), total_streams);
     ASSERT_EQ(cuda_compiled_model->get_property(ov::num_streams.name()), ov::streams::Num(total_streams));
     ASSERT_EQ(cuda_compiled_model->get_property(ov::optimal_number_of_infer_requests.name()), uint32_t(total_streams));
@@ -165,7 +170,7 @@ TEST_P(NumStreams8CompileModelTest, CompileModel_OptimalNumberInferRequests_8_Su
     constexpr auto total_streams = 8;
     auto compiled_model = plugin->compile_model(model_, properties);
     auto cuda_compiled_model = std::dynamic_pointer_cast<CompiledModel>(compiled_model);
-    auto& memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
+    auto memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
     ASSERT_EQ(memoryManagerPool->Size(), total_streams);
     ASSERT_EQ(cuda_compiled_model->get_property(ov::num_streams.name()), ov::streams::Num(total_streams));
     ASSERT_EQ(cuda_compiled_model->get_property(ov::optimal_number_of_infer_requests.name()), uint32_t(total_streams));
@@ -208,7 +213,7 @@ TEST_P(NumStreams8ExclusiveCompileModelTest, CompileModel_OptimalNumberInferRequ
     constexpr auto total_streams = 1;
     auto compiled_model = plugin->compile_model(model_, properties);
     auto cuda_compiled_model = std::dynamic_pointer_cast<CompiledModel>(compiled_model);
-    auto& memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
+    auto memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
     ASSERT_EQ(memoryManagerPool->Size(), total_streams);
     ASSERT_EQ(cuda_compiled_model->get_property(ov::num_streams.name()), ov::streams::Num(total_streams));
     ASSERT_EQ(cuda_compiled_model->get_property(ov::optimal_number_of_infer_requests.name()), uint32_t(total_streams));
@@ -239,7 +244,7 @@ TEST_P(NumStreamsAUTOCompileModelTest, CompileModel_OptimalNumberInferRequests_A
     auto plugin = std::make_shared<Plugin>();
     auto compiled_model = plugin->compile_model(model_, properties);
     auto cuda_compiled_model = std::dynamic_pointer_cast<CompiledModel>(compiled_model);
-    auto& memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
+    auto memoryManagerPool = GetMemoryManagerPool(cuda_compiled_model);
     ASSERT_GT(memoryManagerPool->Size(), 1);
 }
 
@@ -247,3 +252,104 @@ INSTANTIATE_TEST_SUITE_P(CompileModelTest,
                          NumStreamsAUTOCompileModelTest,
                          ::testing::ValuesIn(num_streams_auto_properties),
                          CompileModelTest::getTestCaseName);
+
+TEST(CachedNumberInferRequestsCompileModelTest, CompileModel_OptimalNumberInferRequests_CachedEstimate_Success) {
+    const auto cache_dir = std::filesystem::temp_directory_path() / "nvidia_infer_requests_cache";
+    std::filesystem::remove_all(cache_dir);
+    const ov::AnyMap properties{
+        {ov::device::id.name(), "0"},
+        {ov::hint::performance_mode.name(), ov::util::to_string(ov::hint::PerformanceMode::THROUGHPUT)},
+        {ov::cache_dir.name(), cache_dir.string()},
+    };
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(create_matmul_test_model(), properties);
+    const auto estimate = compiled_model->get_property(ov::optimal_number_of_infer_requests.name()).as<uint32_t>();
+    compiled_model.reset();
+
+    // The estimate is stored in the tuning cache, it is replaced by a single infer request to check that it isn't
+    // measured again
+    std::filesystem::path cache_file;
+    std::string key;
+    for (const auto& entry : std::filesystem::directory_iterator{cache_dir}) {
+        std::ifstream file{entry.path()};
+        for (std::string line; std::getline(file, line);) {
+            if (line.rfind("infer_requests:", 0) == 0) {
+                cache_file = entry.path();
+                key = line.substr(0, line.find('\t'));
+                ASSERT_EQ(line.substr(key.size() + 1), std::to_string(estimate));
+            }
+        }
+    }
+    ASSERT_FALSE(key.empty());
+    std::ofstream{cache_file, std::ios::app} << key << "\t1\n";
+
+    compiled_model = plugin->compile_model(create_matmul_test_model(), properties);
+    const auto result = compiled_model->get_property(ov::optimal_number_of_infer_requests.name()).as<uint32_t>();
+    compiled_model.reset();
+    std::filesystem::remove_all(cache_dir);
+    ASSERT_EQ(result, 1);
+}
+
+TEST(BackgroundTuningCompileModelTest, CompileModel_BackgroundTuning_ReplacesExecutable) {
+    using namespace std::chrono_literals;
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = std::dynamic_pointer_cast<CompiledModel>(
+        plugin->compile_model(create_matmul_test_model(),
+                              {{ov::device::id.name(), "0"},
+                               {ov::nvidia_gpu::operation_benchmark.name(), true},
+                               {ov::nvidia_gpu::background_tuning.name(), true}}));
+    // Inferences started before the replacement keep the executable with heuristic algorithms
+    const auto heuristic = compiled_model->get_executable();
+    const auto deadline = std::chrono::steady_clock::now() + 60s;
+    while (!compiled_model->get_property(ov::nvidia_gpu::background_tuning_completed.name()).as<bool>()) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "Background tuning isn't completed";
+        std::this_thread::sleep_for(10ms);
+    }
+    const auto tuned = compiled_model->get_executable();
+    ASSERT_NE(tuned.topology_runner, heuristic.topology_runner);
+    ASSERT_NE(tuned.memory_pool, heuristic.memory_pool);
+    ASSERT_LE(tuned.memory_pool->Size(), heuristic.memory_pool->Size());
+}
+
+TEST(BackgroundTuningCompileModelTest, CompileModel_BackgroundTuningWithoutBenchmark_KeepsExecutable) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = std::dynamic_pointer_cast<CompiledModel>(plugin->compile_model(
+        create_matmul_test_model(), {{ov::device::id.name(), "0"}, {ov::nvidia_gpu::background_tuning.name(), true}}));
+    ASSERT_FALSE(compiled_model->get_property(ov::nvidia_gpu::background_tuning_completed.name()).as<bool>());
+}
+
+using WeightsUpdateCompileModelTest = CompileModelTest;
+TEST_P(WeightsUpdateCompileModelTest, UpdateWeights_SameTopology_ReplacesExecutable) {
+    auto plugin = std::make_shared<Plugin>();
+    auto cuda_compiled_model = std::dynamic_pointer_cast<CompiledModel>(plugin->compile_model(model_, properties));
+    const auto previous = cuda_compiled_model->get_executable();
+    auto weights = std::make_shared<ov::op::v0::Constant>(
+        ov::element::f32, ov::Shape{3, 2, 10, 20}, std::vector<float>(3 * 2 * 10 * 20, 2.0f));
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 2, 10, 10});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights, false, false);
+    auto updated_model = std::make_shared<ov::Model>(
+        ov::ResultVector{std::make_shared<ov::op::v0::Result>(matmul)}, ov::ParameterVector{param}, "MatMul");
+    cuda_compiled_model->set_property({ov::nvidia_gpu::weights_update(updated_model)});
+    const auto current = cuda_compiled_model->get_executable();
+    ASSERT_NE(current.topology_runner, previous.topology_runner);
+    ASSERT_NE(current.memory_pool, previous.memory_pool);
+    ASSERT_EQ(current.memory_pool->Size(), previous.memory_pool->Size());
+}
+
+TEST_P(WeightsUpdateCompileModelTest, UpdateWeights_OtherTopology_Throws) {
+    auto plugin = std::make_shared<Plugin>();
+    auto cuda_compiled_model = std::dynamic_pointer_cast<CompiledModel>(plugin->compile_model(model_, properties));
+    const auto previous = cuda_compiled_model->get_executable();
+    auto weights = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{3, 2, 10, 30});
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 2, 10, 10});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights, false, false);
+    auto other_model = std::make_shared<ov::Model>(
+        ov::ResultVector{std::make_shared<ov::op::v0::Result>(matmul)}, ov::ParameterVector{param}, "MatMul");
+    ASSERT_THROW(cuda_compiled_model->set_property({ov::nvidia_gpu::weights_update(other_model)}), ov::Exception);
+    ASSERT_EQ(cuda_compiled_model->get_executable().topology_runner, previous.topology_runner);
+}
+
+INSTANTIATE_TEST_SUITE_P(CompileModelTest,
+                         WeightsUpdateCompileModelTest,
+                         ::testing::ValuesIn(default_properties),
+                         CompileModelTest::getTestCaseName);
@@ -0,0 +1,84 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <utils/cost_partition.hpp>
+
+using namespace ov::nvidia_gpu::utils;
+
+namespace {
+
+PartitionCosts costs() {
+    PartitionCosts costs{cudaDeviceProp{}};
+    costs.gpu.flopsPerSecond = 10e12;
+    costs.gpu.bytesPerSecond = 500e9;
+    costs.cpuFlopsPerSecond = 100e9;
+    return costs;
+}
+
+std::unordered_set<std::string> all_names(const ov::Model& model) {
+    std::unordered_set<std::string> names;
+    for (const auto& node : model.get_ops()) {
+        names.insert(node->get_friendly_name());
+    }
+    return names;
+}
+
+}  // namespace
+
+TEST(CostPartitionTest, LargeMatMulStaysOnDevice) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{512, 1024});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1024, 1024}, std::vector<float>(1, 0.0f));
+    auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+    matMul->set_friendly_name("matmul");
+    auto result = std::make_shared<ov::op::v0::Result>(matMul);
+    ov::Model model{ov::ResultVector{result}, ov::ParameterVector{param}};
+    const auto gpu = partitionByCost(model, all_names(model), costs());
+    ASSERT_EQ(gpu.count("matmul"), 1);
+    ASSERT_EQ(gpu.count(weights->get_friendly_name()), 1);
+}
+
+TEST(CostPartitionTest, TinyOperationIsLeftToCpu) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{4});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    relu->set_friendly_name("relu");
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    ov::Model model{ov::ResultVector{result}, ov::ParameterVector{param}};
+    const auto gpu = partitionByCost(model, all_names(model), costs());
+    ASSERT_EQ(gpu.count("relu"), 0);
+    ASSERT_EQ(gpu.count(param->get_friendly_name()), 0);
+}
+
+TEST(CostPartitionTest, SubgraphIsCutAtSmallTensor) {
+    // Large input is reduced by the first operations, so the rest of tiny operations is cheaper on CPU
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{256, 4096});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{4096, 256}, std::vector<float>(1, 0.0f));
+    auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+    matMul->set_friendly_name("matmul");
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{0});
+    auto reduce = std::make_shared<ov::op::v1::ReduceSum>(matMul, axes);
+    reduce->set_friendly_name("reduce");
+    auto relu = std::make_shared<ov::op::v0::Relu>(reduce);
+    relu->set_friendly_name("relu");
+    auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(relu);
+    sigmoid->set_friendly_name("sigmoid");
+    auto result = std::make_shared<ov::op::v0::Result>(sigmoid);
+    ov::Model model{ov::ResultVector{result}, ov::ParameterVector{param}};
+    const auto gpu = partitionByCost(model, all_names(model), costs());
+    ASSERT_EQ(gpu.count("matmul"), 1);
+    ASSERT_EQ(gpu.count("relu"), 0);
+    ASSERT_EQ(gpu.count("sigmoid"), 0);
+}
+
+TEST(CostPartitionTest, UnsupportedOperationsAreNeverReported) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{512, 1024});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    relu->set_friendly_name("relu");
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    ov::Model model{ov::ResultVector{result}, ov::ParameterVector{param}};
+    const auto gpu = partitionByCost(model, {}, costs());
+    ASSERT_TRUE(gpu.empty());
+}
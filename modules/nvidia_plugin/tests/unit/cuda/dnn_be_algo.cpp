@@ -0,0 +1,103 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cuda/dnn_be_algo.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/**
+ * Operation graph of a 3x3 convolution of f32 tensors in NCHW layout, as built by ConvolutionCuDnnBE
+ */
+class DnnBETunedPlansTest : public testing::Test {
+protected:
+    void SetUp() override {
+        auto conv_desc = CUDA::DnnBEConvolutionDescriptorBuilder()
+                             .setMode(CUDNN_CROSS_CORRELATION)
+                             .setComputeType(CUDNN_DATA_FLOAT)
+                             .setNumberOfSpatialDimensions(2)
+                             .setPrePaddings(std::vector<int64_t>{1, 1})
+                             .setPostPaddings(std::vector<int64_t>{1, 1})
+                             .setDilations(std::vector<int64_t>{1, 1})
+                             .setFilterStrides(std::vector<int64_t>{1, 1})
+                             .build();
+        auto conv_op_desc = CUDA::DnnBEOperationConvolutionForwardDescriptorBuilder()
+                                .setXDesc(tensor('x', {1, 16, 32, 32}))
+                                .setWDesc(tensor('w', {16, 16, 3, 3}))
+                                .setYDesc(tensor('y', {1, 16, 32, 32}))
+                                .setConvDesc(conv_desc)
+                                .setScalingParams<CUDNN_TYPE_FLOAT>(1, 0)
+                                .build();
+        std::array<cudnnBackendDescriptor_t, 1> ops{conv_op_desc->get()};
+        graph_ = CUDA::DnnBEOperationGraphDescriptorBuilder().setDnnHandle(dnn_handle_).setOperations(ops).build();
+        plans_ = CUDA::getAllExecutionPlansFromHeuristics(graph_, *dnn_handle_);
+        ASSERT_FALSE(plans_.empty());
+    }
+
+    static std::shared_ptr<CUDA::DnnBETensorDescriptor> tensor(int64_t id, const std::vector<size_t>& shape) {
+        return CUDA::DnnBETensorDescriptorBuilder()
+            .setDataType(CUDNN_DATA_FLOAT)
+            .setShape(shape)
+            .setStrides(CUDA::generateStrides(shape, CUDNN_TENSOR_NCHW))
+            .setUniqueId(id)
+            .setAlignment(16)
+            .build();
+    }
+
+    std::shared_ptr<CUDA::DnnHandle> dnn_handle_ = std::make_shared<CUDA::DnnHandle>();
+    std::shared_ptr<CUDA::DnnBEOperationGraphDescriptor> graph_;
+    std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>> plans_;
+};
+
+}  // namespace
+
+TEST_F(DnnBETunedPlansTest, KnobsHaveRangesOfValues) {
+    bool has_range = false;
+    for (int64_t index = 0; index < graph_->getEngineCount(); ++index) {
+        std::shared_ptr<CUDA::DnnBEEngine> engine;
+        try {
+            engine = CUDA::DnnBEEngineBuilder().setOpEngineGraph(graph_).setGlobalIndex(index).build();
+        } catch (const ov::Exception&) {
+            continue;
+        }
+        for (const auto& knob : engine->getKnobs()) {
+            ASSERT_LE(knob.getMinValue(), knob.getMaxValue());
+            has_range = has_range || knob.getMinValue() < knob.getMaxValue();
+        }
+    }
+    ASSERT_TRUE(has_range);
+}
+
+TEST_F(DnnBETunedPlansTest, TunedPlansAreRebuiltFromCachedConfigs) {
+    const auto tuned_plans = CUDA::getTunedExecutionPlans(graph_, *dnn_handle_, std::numeric_limits<size_t>::max());
+    ASSERT_FALSE(tuned_plans.empty());
+    for (const auto& tuned_plan : tuned_plans) {
+        const auto cached_plan = CUDA::formatCachedPlan(plans_, tuned_plans, tuned_plan.plan);
+        ASSERT_EQ(cached_plan, tuned_plan.config);
+        // Configs of tuned plans aren't taken for indices of plans of heuristics
+        ASSERT_EQ(CUDA::findCachedPlan(plans_, cached_plan), nullptr);
+        const auto plan = CUDA::findTunedPlan(graph_, *dnn_handle_, cached_plan);
+        ASSERT_NE(plan, nullptr) << cached_plan;
+        ASSERT_EQ(plan->getWorkspaceSize(), tuned_plan.plan->getWorkspaceSize()) << cached_plan;
+    }
+}
+
+TEST_F(DnnBETunedPlansTest, PlansOfHeuristicsAreFoundByIndex) {
+    const auto tuned_plans = CUDA::getTunedExecutionPlans(graph_, *dnn_handle_, std::numeric_limits<size_t>::max());
+    const auto cached_plan = CUDA::formatCachedPlan(plans_, tuned_plans, plans_.back());
+    ASSERT_EQ(CUDA::findCachedPlan(plans_, cached_plan), plans_.back());
+    ASSERT_EQ(CUDA::findTunedPlan(graph_, *dnn_handle_, cached_plan), nullptr);
+    ASSERT_EQ(CUDA::findTunedPlan(graph_, *dnn_handle_, std::nullopt), nullptr);
+}
+
+TEST_F(DnnBETunedPlansTest, TunedPlansFitWorkspaceLimit) {
+    for (const auto& tuned_plan : CUDA::getTunedExecutionPlans(graph_, *dnn_handle_, 0)) {
+        ASSERT_EQ(tuned_plan.plan->getWorkspaceSize(), 0) << tuned_plan.config;
+    }
+}
@@ -0,0 +1,140 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cuda/runtime.hpp>
+#include <cuda/stl/algorithms/block.cuh>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+constexpr unsigned kBlockSize = 256;
+
+__global__ void exclusive_count_launch(const bool* flags, unsigned* counts, unsigned* total) {
+    unsigned block_total = 0;
+    counts[threadIdx.x] = CUDA::algorithms::block::exclusive_count(flags[threadIdx.x], block_total);
+    if (threadIdx.x == 0) {
+        *total = block_total;
+    }
+}
+
+__global__ void exclusive_sum_launch(const int* values, int* sums, int* total) {
+    int block_total = 0;
+    sums[threadIdx.x] = CUDA::algorithms::block::exclusive_sum(values[threadIdx.x], block_total);
+    if (threadIdx.x == 0) {
+        *total = block_total;
+    }
+}
+
+__global__ void radix_select_launch(
+    const float* values, const size_t count, const size_t k, float* kth, size_t* num_equal) {
+    using Key = CUDA::algorithms::OrderedKey<float>::type;
+    const auto selection = CUDA::algorithms::block::radix_select<Key>(
+        [&](size_t j) { return CUDA::algorithms::OrderedKey<float>::get(values[j]); }, count, k);
+    if (threadIdx.x == 0) {
+        // Bits of non-negative floats are ordered as their keys with the sign bit set
+        *kth = __uint_as_float(selection.threshold & 0x7FFFFFFFu);
+        *num_equal = selection.num_equal;
+    }
+}
+
+}  // namespace
+
+class BlockAlgorithmsTest : public testing::Test {
+protected:
+    CUDA::Stream stream{};
+    std::mt19937 gen{std::random_device{}()};
+};
+
+TEST_F(BlockAlgorithmsTest, ExclusiveCount) {
+    std::bernoulli_distribution dist{0.3};
+    bool flags[kBlockSize];
+    for (auto& flag : flags) {
+        flag = dist(gen);
+    }
+    const auto& defaultStream = CUDA::DefaultStream::stream();
+    auto dFlags = defaultStream.malloc(sizeof(flags));
+    auto dCounts = defaultStream.malloc(kBlockSize * sizeof(unsigned));
+    auto dTotal = defaultStream.malloc(sizeof(unsigned));
+    defaultStream.upload(dFlags, flags, sizeof(flags));
+    exclusive_count_launch<<<1, kBlockSize, 0, stream.get()>>>(static_cast<const bool*>(dFlags.get()),
+                                                               static_cast<unsigned*>(dCounts.get()),
+                                                               static_cast<unsigned*>(dTotal.get()));
+    stream.synchronize();
+    std::vector<unsigned> counts(kBlockSize);
+    unsigned total = 0;
+    defaultStream.download(counts.data(), dCounts, kBlockSize * sizeof(unsigned));
+    defaultStream.download(&total, dTotal, sizeof(total));
+
+    unsigned expected = 0;
+    for (unsigned i = 0; i < kBlockSize; ++i) {
+        ASSERT_EQ(counts[i], expected);
+        expected += flags[i];
+    }
+    ASSERT_EQ(total, expected);
+}
+
+TEST_F(BlockAlgorithmsTest, ExclusiveSum) {
+    std::uniform_int_distribution<int> dist{-1000, 1000};
+    std::vector<int> values(kBlockSize);
+    std::generate(values.begin(), values.end(), [&] { return dist(gen); });
+    const auto& defaultStream = CUDA::DefaultStream::stream();
+    const size_t size = kBlockSize * sizeof(int);
+    auto dValues = defaultStream.malloc(size);
+    auto dSums = defaultStream.malloc(size);
+    auto dTotal = defaultStream.malloc(sizeof(int));
+    defaultStream.upload(dValues, values.data(), size);
+    exclusive_sum_launch<<<1, kBlockSize, 0, stream.get()>>>(static_cast<const int*>(dValues.get()),
+                                                             static_cast<int*>(dSums.get()),
+                                                             static_cast<int*>(dTotal.get()));
+    stream.synchronize();
+    std::vector<int> sums(kBlockSize);
+    int total = 0;
+    defaultStream.download(sums.data(), dSums, size);
+    defaultStream.download(&total, dTotal, sizeof(total));
+
+    int expected = 0;
+    for (unsigned i = 0; i < kBlockSize; ++i) {
+        ASSERT_EQ(sums[i], expected);
+        expected += values[i];
+    }
+    ASSERT_EQ(total, expected);
+}
+
+TEST_F(BlockAlgorithmsTest, RadixSelect) {
+    constexpr size_t kCount = 5000;
+    // Few distinct values, so the k-th one has duplicates
+    std::uniform_int_distribution<int> dist{0, 100};
+    std::vector<float> values(kCount);
+    std::generate(values.begin(), values.end(), [&] { return dist(gen) * 0.5f; });
+    const auto& defaultStream = CUDA::DefaultStream::stream();
+    auto dValues = defaultStream.malloc(kCount * sizeof(float));
+    auto dKth = defaultStream.malloc(sizeof(float));
+    auto dNumEqual = defaultStream.malloc(sizeof(size_t));
+    defaultStream.upload(dValues, values.data(), kCount * sizeof(float));
+
+    std::vector<float> sorted = values;
+    std::sort(sorted.begin(), sorted.end(), std::greater<float>{});
+    for (const size_t k : {size_t{1}, size_t{17}, size_t{1000}, kCount}) {
+        radix_select_launch<<<1, kBlockSize, 0, stream.get()>>>(static_cast<const float*>(dValues.get()),
+                                                                kCount,
+                                                                k,
+                                                                static_cast<float*>(dKth.get()),
+                                                                static_cast<size_t*>(dNumEqual.get()));
+        stream.synchronize();
+        float kth = 0;
+        size_t numEqual = 0;
+        defaultStream.download(&kth, dKth, sizeof(kth));
+        defaultStream.download(&numEqual, dNumEqual, sizeof(numEqual));
+
+        ASSERT_FLOAT_EQ(kth, sorted[k - 1]);
+        ASSERT_EQ(numEqual, static_cast<size_t>(std::count(sorted.begin(), sorted.begin() + k, kth)));
+    }
+}
@@ -0,0 +1,149 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cuda/runtime.hpp>
+#include <cuda/stl/algorithms/device.hpp>
+#include <random>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+using namespace CUDA::algorithms;
+
+class DeviceAlgorithmsTest : public testing::Test {
+protected:
+    static constexpr size_t kNumItems = 10000;
+
+    CUDA::Stream stream{};
+    std::mt19937 gen{std::random_device{}()};
+};
+
+TEST_F(DeviceAlgorithmsTest, RadixSortKeysThenUnique) {
+    std::uniform_int_distribution<unsigned long long> dist{0, 1000};
+    std::vector<unsigned long long> keys(kNumItems);
+    std::generate(keys.begin(), keys.end(), [&] { return dist(gen); });
+    const device::RadixSortKeys<unsigned long long> sort{kNumItems};
+    const device::Unique<unsigned long long> unique{kNumItems};
+
+    const size_t size = kNumItems * sizeof(unsigned long long);
+    auto dKeys = stream.malloc(size);
+    auto dSorted = stream.malloc(size);
+    auto dUnique = stream.malloc(size);
+    auto dNumUnique = stream.malloc(sizeof(int));
+    auto dTemp = stream.malloc(device::sharedTempStorageSize(sort, unique));
+    stream.upload(dKeys, keys.data(), size);
+    sort(stream.get(),
+         dTemp.get(),
+         static_cast<const unsigned long long*>(dKeys.get()),
+         static_cast<unsigned long long*>(dSorted.get()));
+    unique(stream.get(),
+           dTemp.get(),
+           static_cast<const unsigned long long*>(dSorted.get()),
+           static_cast<unsigned long long*>(dUnique.get()),
+           static_cast<int*>(dNumUnique.get()));
+    std::vector<unsigned long long> result(kNumItems);
+    int numUnique = 0;
+    stream.download(result.data(), dUnique, size);
+    stream.download(&numUnique, dNumUnique, sizeof(numUnique));
+    stream.synchronize();
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    ASSERT_EQ(numUnique, static_cast<int>(keys.size()));
+    result.resize(numUnique);
+    ASSERT_EQ(result, keys);
+}
+
+TEST_F(DeviceAlgorithmsTest, SegmentedRadixSortPairsDescending) {
+    const std::vector<int> offsets{0, 10, 10, 4000, kNumItems};
+    const size_t numSegments = offsets.size() - 1;
+    std::uniform_real_distribution<float> dist{-100.0f, 100.0f};
+    std::vector<float> keys(kNumItems);
+    std::generate(keys.begin(), keys.end(), [&] { return dist(gen); });
+    std::vector<std::int32_t> values(kNumItems);
+    for (size_t i = 0; i < kNumItems; ++i) {
+        values[i] = static_cast<std::int32_t>(i);
+    }
+    const device::SegmentedRadixSortPairs<float, std::int32_t> sort{kNumItems, numSegments, true};
+
+    auto dKeys = stream.malloc(kNumItems * sizeof(float));
+    auto dSortedKeys = stream.malloc(kNumItems * sizeof(float));
+    auto dValues = stream.malloc(kNumItems * sizeof(std::int32_t));
+    auto dSortedValues = stream.malloc(kNumItems * sizeof(std::int32_t));
+    auto dOffsets = stream.malloc(offsets.size() * sizeof(int));
+    auto dTemp = stream.malloc(sort.tempStorageSize());
+    stream.upload(dKeys, keys.data(), kNumItems * sizeof(float));
+    stream.upload(dValues, values.data(), kNumItems * sizeof(std::int32_t));
+    stream.upload(dOffsets, offsets.data(), offsets.size() * sizeof(int));
+    const auto* begins = static_cast<const int*>(dOffsets.get());
+    sort(stream.get(),
+         dTemp.get(),
+         static_cast<const float*>(dKeys.get()),
+         static_cast<float*>(dSortedKeys.get()),
+         static_cast<const std::int32_t*>(dValues.get()),
+         static_cast<std::int32_t*>(dSortedValues.get()),
+         begins,
+         begins + 1);
+    std::vector<float> sortedKeys(kNumItems);
+    std::vector<std::int32_t> sortedValues(kNumItems);
+    stream.download(sortedKeys.data(), dSortedKeys, kNumItems * sizeof(float));
+    stream.download(sortedValues.data(), dSortedValues, kNumItems * sizeof(std::int32_t));
+    stream.synchronize();
+
+    for (size_t segment = 0; segment < numSegments; ++segment) {
+        for (int i = offsets[segment]; i < offsets[segment + 1]; ++i) {
+            ASSERT_EQ(keys[sortedValues[i]], sortedKeys[i]);
+            ASSERT_GE(sortedValues[i], offsets[segment]);
+            ASSERT_LT(sortedValues[i], offsets[segment + 1]);
+            if (i > offsets[segment]) {
+                ASSERT_GE(sortedKeys[i - 1], sortedKeys[i]);
+            }
+        }
+    }
+}
+
+TEST_F(DeviceAlgorithmsTest, ExclusiveSumThenSelectFlagged) {
+    std::bernoulli_distribution dist{0.25};
+    std::vector<char> flags(kNumItems);
+    std::vector<int> ones(kNumItems, 1);
+    std::generate(flags.begin(), flags.end(), [&] { return dist(gen); });
+    const device::ExclusiveSum<int> scan{kNumItems};
+    const device::SelectFlagged<int> select{kNumItems};
+
+    const size_t size = kNumItems * sizeof(int);
+    auto dFlags = stream.malloc(kNumItems * sizeof(bool));
+    auto dOnes = stream.malloc(size);
+    auto dPositions = stream.malloc(size);
+    auto dSelected = stream.malloc(size);
+    auto dNumSelected = stream.malloc(sizeof(int));
+    auto dTemp = stream.malloc(device::sharedTempStorageSize(scan, select));
+    stream.upload(dFlags, flags.data(), kNumItems * sizeof(bool));
+    stream.upload(dOnes, ones.data(), size);
+    // Positions of the items are their indices, the flagged ones are selected
+    scan(stream.get(), dTemp.get(), static_cast<const int*>(dOnes.get()), static_cast<int*>(dPositions.get()));
+    select(stream.get(),
+           dTemp.get(),
+           static_cast<const int*>(dPositions.get()),
+           static_cast<const bool*>(dFlags.get()),
+           static_cast<int*>(dSelected.get()),
+           static_cast<int*>(dNumSelected.get()));
+    std::vector<int> selected(kNumItems);
+    int numSelected = 0;
+    stream.download(selected.data(), dSelected, size);
+    stream.download(&numSelected, dNumSelected, sizeof(numSelected));
+    stream.synchronize();
+
+    std::vector<int> expected;
+    for (size_t i = 0; i < kNumItems; ++i) {
+        if (flags[i]) {
+            expected.push_back(static_cast<int>(i));
+        }
+    }
+    ASSERT_EQ(numSelected, static_cast<int>(expected.size()));
+    selected.resize(numSelected);
+    ASSERT_EQ(selected, expected);
+}
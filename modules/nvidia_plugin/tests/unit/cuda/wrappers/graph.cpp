@@ -89,6 +89,37 @@ TEST_F(CudaGraphCaptureCppWrappersTest, UpdateGraph) {
     ASSERT_THAT(result, ElementsAre(8, 10, 12, 14, 16, 18, 20, 22));
 }
 
+TEST_F(CudaGraphCaptureCppWrappersTest, ChildGraphCapture) {
+    // Body of a loop is captured once and each iteration replays it as a child graph node
+    CUDA::Stream bodyStream{};
+    CUDA::GraphCapture bodyCapture{bodyStream};
+    {
+        auto scope = bodyCapture.getScope();
+        enqueueVecAdd(bodyStream,
+                      dim3{},
+                      dim3{gsl::narrow<unsigned>(a.size())},
+                      static_cast<int*>(devA.get()),
+                      static_cast<int*>(devB.get()),
+                      static_cast<int*>(devA.get()),
+                      a.size());
+    }
+    const auto& body = bodyCapture.getGraph();
+    CUDA::GraphCapture capture{stream};
+    {
+        auto scope = capture.getScope();
+        stream.upload(devA, a.data(), buffer_size);
+        stream.upload(devB, b.data(), buffer_size);
+        CUDA::CaptureInfo{stream}.addChildGraphNode(body);
+        CUDA::CaptureInfo{stream}.addChildGraphNode(body);
+        CUDA::CaptureInfo{stream}.addChildGraphNode(body);
+        stream.download(result.data(), devA, buffer_size);
+    }
+    CUDA::GraphExec exec{capture.getGraph()};
+    exec.launch(stream);
+    stream.synchronize();
+    ASSERT_THAT(result, ElementsAre(24, 28, 32, 36, 40, 44, 48, 52));
+}
+
 TEST_F(CudaGraphCaptureCppWrappersTest, EventCapture) {
     CUDA::Event event0{};
     CUDA::Event event1{};
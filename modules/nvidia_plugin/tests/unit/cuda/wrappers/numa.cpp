@@ -0,0 +1,30 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <cuda/numa.hpp>
+#include <cuda/runtime.hpp>
+
+TEST(NumaNodeTest, UnknownNodePlacesNothing) {
+    const CUDA::NumaNode node{};
+    ASSERT_FALSE(node.isKnown());
+    ASSERT_FALSE(node.bindCurrentThread());
+    ASSERT_EQ(node.allocate(4096), nullptr);
+}
+
+TEST(NumaNodeTest, PinnedHostAllocatorPlacesPageLockedMemoryOnNode) {
+#ifndef __linux__
+    GTEST_SKIP() << "NUMA placement is supported on Linux only";
+#endif
+    // Node 0 exists on every Linux host, even on a single node one
+    const CUDA::PinnedHostAllocator allocator{CUDA::NumaNode{0}};
+    constexpr std::size_t size = 1 << 20;
+    void* p = allocator.allocate(size);
+    ASSERT_NE(p, nullptr);
+    ASSERT_EQ(CUDA::memoryType(p), cudaMemoryTypeHost);
+    std::memset(p, 1, size);
+    allocator.deallocate(p, size);
+}
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cuda.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <cuda_graph_topology_runner.hpp>
+#include <memory>
 #include <cuda_simple_execution_delegator.hpp>
 #include <ops/parameter.hpp>
 #include <ops/result.hpp>
@@ -123,3 +126,64 @@ TEST_F(CudaGraphTopologyRunnerTest, CheckMemcpyNodesAreNotUpdatedIfPointersUncha
     runner_.UpdateContext(inferRequestContext, deviceMemBlock_);
     EXPECT_EQ(cudaGraphContext_, oldCudaGraphContext);
 }
+
+TEST_F(CudaGraphTopologyRunnerTest, CheckChangedPointersDontRecaptureGraphs) {
+    runner_.UpdateContext(inferRequestContext_, deviceMemBlock_);
+    EXPECT_EQ(runner_.GetCaptureMisses(), 1);
+    std::vector<std::shared_ptr<ov::Tensor>> inputTensors{PopulateTensors(model_->inputs())};
+    std::vector<std::shared_ptr<ov::Tensor>> outputTensors{PopulateTensors(model_->outputs())};
+    InferenceRequestContext inferRequestContext{inputTensors,
+                                                inputIndeces_,
+                                                outputTensors,
+                                                outputIndeces_,
+                                                threadContext_,
+                                                cancellationToken_,
+                                                simpleExecutionDelegator_,
+                                                cudaGraphContext_,
+                                                false};
+    runner_.UpdateContext(inferRequestContext, deviceMemBlock_);
+    runner_.UpdateContext(inferRequestContext_, deviceMemBlock_);
+    EXPECT_EQ(runner_.GetCaptureHits(), 2);
+    EXPECT_EQ(runner_.GetCaptureMisses(), 1);
+}
+
+TEST_F(CudaGraphTopologyRunnerTest, CheckGraphsAreRelocatedToAnotherMemoryBlock) {
+    for (const auto& tensor : inputTensors_) {
+        auto* data = tensor->data<float>();
+        for (std::size_t i = 0; i < tensor->get_size(); ++i) {
+            data[i] = static_cast<float>(i % 11) * 0.125f;
+        }
+    }
+    runner_.UpdateContext(inferRequestContext_, deviceMemBlock_);
+    runner_.Run(inferRequestContext_, deviceMemBlock_);
+    threadContext_.stream().synchronize();
+    // Pointers into memory blocks are found by comparing graphs of the first two blocks, the next ones relocate them
+    std::vector<CudaGraphContext> cudaGraphContexts(2);
+    std::vector<std::unique_ptr<DeviceMemBlock>> deviceMemBlocks;
+    for (auto& cudaGraphContext : cudaGraphContexts) {
+        std::vector<std::shared_ptr<ov::Tensor>> outputTensors{PopulateTensors(model_->outputs())};
+        InferenceRequestContext inferRequestContext{inputTensors_,
+                                                    inputIndeces_,
+                                                    outputTensors,
+                                                    outputIndeces_,
+                                                    threadContext_,
+                                                    cancellationToken_,
+                                                    simpleExecutionDelegator_,
+                                                    cudaGraphContext,
+                                                    false};
+        const auto& deviceMemBlock = deviceMemBlocks.emplace_back(std::make_unique<DeviceMemBlock>(
+            runner_.GetSubGraph().memoryManager()->mutableTensorsMemoryModel()));
+        runner_.UpdateContext(inferRequestContext, *deviceMemBlock);
+        EXPECT_TRUE(cudaGraphContext.is_initialized());
+        EXPECT_EQ(cudaGraphContext.get_graphs_count(), runner_.GetCudaGraphsCount());
+        runner_.Run(inferRequestContext, *deviceMemBlock);
+        threadContext_.stream().synchronize();
+        for (std::size_t i = 0; i < outputTensors.size(); ++i) {
+            const auto size = outputTensors[i]->get_byte_size();
+            ASSERT_EQ(std::memcmp(outputTensors[i]->data(), outputTensors_[i]->data(), size), 0);
+        }
+    }
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 12040
+    EXPECT_EQ(runner_.GetCaptureMisses(), 2);
+#endif
+}
@@ -0,0 +1,9 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "device_fault.cuh"
+
+__global__ void DeviceFault() { __trap(); }
+
+void enqueueDeviceFault(const CUDA::Stream& stream) { stream.run(1, 1, DeviceFault); }
@@ -0,0 +1,12 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/runtime.hpp>
+
+/**
+ * Enqueues a kernel which aborts on the device, leaving the context with a sticky error
+ */
+void enqueueDeviceFault(const CUDA::Stream& stream);
@@ -0,0 +1,43 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cuda/runtime.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+TEST(DeviceMemoryPool, PoolDoesNotWaitForWorkOfOtherStreams) {
+    const std::size_t size = 256 << 20;
+    auto pool = std::make_shared<CUDA::DeviceMemoryPool>(CUDA::Device::currentId(),
+                                                         std::numeric_limits<std::uint64_t>::max());
+    CUDA::Stream busy_stream;
+    auto used = pool->malloc(size);
+    for (int i = 0; i < 256; ++i) {
+        busy_stream.memset(CUDA::DevicePointer<void*>{used.get()}, 0x2A, size);
+    }
+    {
+        // Allocation, free and destruction of another pool wait only for the stream of the pool
+        auto other_pool = std::make_shared<CUDA::DeviceMemoryPool>(CUDA::Device::currentId(), 0);
+        auto allocation = other_pool->malloc(1 << 20);
+    }
+    { auto allocation = pool->malloc(1 << 20); }
+    const auto status = cudaStreamQuery(busy_stream.get());
+    busy_stream.synchronize();
+    ASSERT_EQ(status, cudaErrorNotReady);
+}
+
+TEST(DeviceMemoryPool, AllocationIsUsableByAnyStreamWithoutSynchronization) {
+    const std::size_t size = 1 << 20;
+    auto pool = std::make_shared<CUDA::DeviceMemoryPool>(CUDA::Device::currentId(), 0);
+    CUDA::Stream stream;
+    auto allocation = pool->malloc(size);
+    stream.memset(CUDA::DevicePointer<void*>{allocation.get()}, 0x2A, size);
+    std::vector<std::uint8_t> content(size);
+    stream.download(content.data(), CUDA::DevicePointer<const void*>{allocation.get()}, size);
+    stream.synchronize();
+    ASSERT_EQ(content, std::vector<std::uint8_t>(size, 0x2A));
+}
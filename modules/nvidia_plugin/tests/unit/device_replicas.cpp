@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_config.hpp>
+#include <cuda_device_replicas.hpp>
+#include <nvidia/properties.hpp>
+#include <openvino/core/except.hpp>
+#include <optional>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+DeviceReplicas create_replicas(std::size_t size) {
+    // Dispatch doesn't use compiled models of replicas
+    return DeviceReplicas{std::vector<std::shared_ptr<const ov::ICompiledModel>>(size)};
+}
+
+}  // namespace
+
+TEST(DeviceReplicasTest, InferencesAreSpreadOverReplicas) {
+    auto replicas = create_replicas(3);
+    std::vector<DeviceReplicas::Lease> leases;
+    for (std::size_t i = 0; i < 6; ++i) {
+        leases.push_back(replicas.acquire());
+    }
+    std::vector<std::size_t> loads(replicas.size(), 0);
+    for (const auto& lease : leases) {
+        ++loads.at(lease.index());
+    }
+    ASSERT_EQ(loads, std::vector<std::size_t>(replicas.size(), 2));
+}
+
+TEST(DeviceReplicasTest, InferenceIsDispatchedToLeastLoadedReplica) {
+    auto replicas = create_replicas(3);
+    auto first = replicas.acquire();
+    std::optional<DeviceReplicas::Lease> second{replicas.acquire()};
+    auto third = replicas.acquire();
+    const auto released = second->index();
+    second.reset();
+    ASSERT_EQ(replicas.acquire().index(), released);
+}
+
+TEST(DeviceReplicasTest, SingleMultiDeviceIdIsDeviceOfModel) {
+    const Configuration config{ov::AnyMap{ov::device::id("0"), ov::nvidia_gpu::multi_device_ids("1")}};
+    ASSERT_EQ(config.get_device_id(), 1);
+    ASSERT_EQ(config.get_multi_device_ids(), std::vector<int>{1});
+}
+
+TEST(DeviceReplicasTest, SinglePipelineDeviceIdIsDeviceOfModel) {
+    const Configuration config{ov::AnyMap{ov::nvidia_gpu::pipeline_device_ids("1")}};
+    ASSERT_EQ(config.get_device_id(), 1);
+}
+
+TEST(DeviceReplicasTest, ReplicasAndPipelineStagesThrow) {
+    const ov::AnyMap properties{ov::nvidia_gpu::multi_device_ids("0,1"), ov::nvidia_gpu::pipeline_device_ids("1")};
+    ASSERT_THROW(Configuration{properties}, ov::Exception);
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "cuda_plugin.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "ops/matmul.hpp"
+
+using namespace ov::nvidia_gpu;
+
+TEST(ExecutionModeTest, OnlyFp32MatMulUsesTf32) {
+    ASSERT_EQ(MatMulOp::GetGemmComputeType(CUDA_R_32F, CUDA_R_32F, true), CUBLAS_COMPUTE_32F_FAST_TF32);
+    ASSERT_EQ(MatMulOp::GetGemmComputeType(CUDA_R_32F, CUDA_R_32F, false), CUBLAS_COMPUTE_32F);
+    // Half precision products are accumulated in fp32 regardless of TF32
+    ASSERT_EQ(MatMulOp::GetGemmComputeType(CUDA_R_16F, CUDA_R_32F, true), CUBLAS_COMPUTE_32F);
+    ASSERT_EQ(MatMulOp::GetGemmComputeType(CUDA_R_16F, CUDA_R_16F, true), CUBLAS_COMPUTE_16F);
+}
+
+TEST(ExecutionModeTest, AccuracyModeKeepsFp32MatMulPrecision) {
+    constexpr std::size_t m = 16;
+    constexpr std::size_t k = 256;
+    constexpr std::size_t n = 16;
+    // Values differ from 1 only by bits of mantissa, which TF32 rounds down
+    auto value = [](std::size_t i) { return 1.0f + 1.0f / (1 << 12) + static_cast<float>(i % 64) / (1 << 20); };
+    std::vector<float> b_values(k * n);
+    for (std::size_t i = 0; i < b_values.size(); ++i) {
+        b_values[i] = value(i * 7 + 3);
+    }
+    auto a = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{m, k});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(
+        a, ov::op::v0::Constant::create(ov::element::f32, {k, n}, b_values), false, false);
+    auto model = std::make_shared<ov::Model>(
+        ov::ResultVector{std::make_shared<ov::op::v0::Result>(matmul)}, ov::ParameterVector{a}, "MatMul");
+
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(
+        model, {ov::device::id("0"), ov::hint::execution_mode(ov::hint::ExecutionMode::ACCURACY)});
+    auto request = compiled_model->create_infer_request();
+    ov::Tensor a_tensor{ov::element::f32, ov::Shape{m, k}};
+    auto* a_data = a_tensor.data<float>();
+    for (std::size_t i = 0; i < a_tensor.get_size(); ++i) {
+        a_data[i] = value(i * 13 + 5);
+    }
+    request->set_tensor(compiled_model->inputs().at(0), ov::get_tensor_impl(a_tensor));
+    request->infer();
+    const auto output = request->get_tensor(compiled_model->outputs().at(0));
+    const auto* c_data = static_cast<const float*>(output->data());
+    for (std::size_t row = 0; row < m; ++row) {
+        for (std::size_t col = 0; col < n; ++col) {
+            double expected = 0;
+            for (std::size_t i = 0; i < k; ++i) {
+                expected += static_cast<double>(a_data[row * k + i]) * b_values[i * n + col];
+            }
+            // TF32 would make each product about 5e-4 smaller
+            ASSERT_NEAR(c_data[row * n + col], expected, expected * 2e-5) << "at " << row << ", " << col;
+        }
+    }
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_extension_loader.hpp>
+#include <memory>
+#include <openvino/core/except.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/relu.hpp>
+#include <ops/extension.hpp>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+class ScaleOperation : public ExtensionOperation {
+public:
+    void execute(const ExtensionContext&,
+                 const std::vector<const void*>&,
+                 const std::vector<void*>&,
+                 const std::vector<const void*>&,
+                 const std::vector<void*>&) const override {}
+
+    std::vector<std::size_t> immutable_workbuffer_sizes() const override { return {16}; }
+    std::vector<std::size_t> mutable_workbuffer_sizes() const override { return {256, 512}; }
+    void init_immutable_workbuffers(const std::vector<void*>& buffers) override { initialized = buffers; }
+    bool is_cuda_graph_compatible() const override { return true; }
+
+    std::vector<void*> initialized;
+};
+
+}  // namespace
+
+TEST(ExtensionOpTest, ForwardsWorkbuffersAndGraphCompatibility) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{4});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto operation = std::make_shared<ScaleOperation>();
+    CUDA::Device device{};
+    ExtensionOp op{CreationContext{device, false}, *relu, {TensorID{0}}, {TensorID{1}}, operation, nullptr};
+
+    ASSERT_TRUE(op.IsCudaGraphCompatible());
+    const auto request = op.GetWorkBufferRequest();
+    ASSERT_EQ(request.immutable_sizes, std::vector<std::size_t>{16});
+    ASSERT_EQ(request.mutable_sizes, (std::vector<std::size_t>{256, 512}));
+
+    int buffer = 0;
+    op.InitSharedImmutableWorkbuffers({CUDA::DevicePointer<void*>{&buffer}});
+    ASSERT_EQ(operation->initialized, std::vector<void*>{&buffer});
+}
+
+TEST(ExtensionOpTest, MissingLibraryIsReported) {
+    ASSERT_THROW(loadExtensions("libmissing_nvidia_gpu_extensions.so"), ov::Exception);
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_implementation_selection.hpp>
+#include <error.hpp>
+#include <ops/nop_op.hpp>
+
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+struct ImplementationSelectionTest : testing::Test {
+    std::shared_ptr<ov::Node> node = std::make_shared<ov::op::v0::Relu>(
+        std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 8}));
+    CreationContext context{CUDA::Device{}, false};
+
+    ImplementationCandidate candidate(const std::string& name, bool supported, bool benchmarkOnly = false) {
+        return {name,
+                [this, name, supported]() -> OperationBase::Ptr {
+                    if (!supported) {
+                        throw_ov_exception(name + " doesn't support the node");
+                    }
+                    return std::make_shared<NopOp>(context, *node, OperationBase::IndexCollection{},
+                                                   OperationBase::IndexCollection{});
+                },
+                benchmarkOnly};
+    }
+};
+
+}  // namespace
+
+TEST_F(ImplementationSelectionTest, FirstSupportedCandidateIsCreatedWithoutBenchmark) {
+    const auto operation = createFastestImplementation(
+        context, *node, shapesTuningKey(*node), {candidate("A", false), candidate("B", true), candidate("C", true)});
+    ASSERT_NE(operation, nullptr);
+    ASSERT_EQ(node->get_rt_info().count(IMPLEMENTATION_NAME), 0);
+}
+
+TEST_F(ImplementationSelectionTest, BenchmarkOnlyCandidateIsSkippedWithoutBenchmark) {
+    ASSERT_THROW(createFastestImplementation(
+                     context, *node, shapesTuningKey(*node), {candidate("A", false), candidate("B", true, true)}),
+                 ov::Exception);
+}
+
+TEST_F(ImplementationSelectionTest, CachedCandidateIsCreated) {
+    auto cache = std::make_shared<TuningCache>(std::string{});
+    cache->store("implementation:" + shapesTuningKey(*node), "C");
+    CreationOptions options;
+    options.tuning_cache = cache;
+    const CreationContext cachedContext{CUDA::Device{}, false, options};
+    createFastestImplementation(
+        cachedContext, *node, shapesTuningKey(*node), {candidate("B", true), candidate("C", true, true)});
+    ASSERT_EQ(node->get_rt_info().at(IMPLEMENTATION_NAME).as<std::string>(), "C");
+}
+
+TEST_F(ImplementationSelectionTest, OccupancyBlockSizeIsCreatedWithoutBenchmark) {
+    unsigned maxThreadsPerBlock = 0;
+    createWithTunedBlockSize(context, *node, [&](const CreationContext& tunedContext) -> OperationBase::Ptr {
+        maxThreadsPerBlock = tunedContext.maxThreadsPerBlock();
+        return std::make_shared<NopOp>(
+            tunedContext, *node, OperationBase::IndexCollection{}, OperationBase::IndexCollection{});
+    });
+    ASSERT_EQ(maxThreadsPerBlock, CUDA::Device{}.occupancyBlockSize());
+}
+
+TEST_F(ImplementationSelectionTest, CachedBlockSizeIsCreated) {
+    auto cache = std::make_shared<TuningCache>(std::string{});
+    cache->store("implementation:block_size:" + shapesTuningKey(*node), "ThreadsPerBlock128");
+    CreationOptions options;
+    options.tuning_cache = cache;
+    const CreationContext cachedContext{CUDA::Device{}, false, options};
+    unsigned maxThreadsPerBlock = 0;
+    createWithTunedBlockSize(cachedContext, *node, [&](const CreationContext& tunedContext) -> OperationBase::Ptr {
+        maxThreadsPerBlock = tunedContext.maxThreadsPerBlock();
+        return std::make_shared<NopOp>(
+            tunedContext, *node, OperationBase::IndexCollection{}, OperationBase::IndexCollection{});
+    });
+    ASSERT_EQ(maxThreadsPerBlock, 128);
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cuda_operation_registry.hpp>
+#include <memory>
+#include <vector>
+
+#include "cuda_plugin.hpp"
+#include "device_fault.cuh"
+#include "nvidia/properties.hpp"
+#include "openvino/op/op.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+/**
+ * Identity which fails the given number of its next executions after submitting work overwriting its output
+ */
+class FailingIdentityNode : public ov::op::Op {
+public:
+    OPENVINO_OP("FailingIdentity", "nvidia_gpu_test");
+
+    explicit FailingIdentityNode(const ov::Output<ov::Node>& arg) : ov::op::Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<FailingIdentityNode>(new_args.at(0));
+    }
+
+    inline static std::atomic<int> failures{0};
+};
+
+class FailingIdentityOp : public OperationBase {
+public:
+    FailingIdentityOp(const CreationContext& context,
+                      const ov::Node& node,
+                      IndexCollection&& inputIds,
+                      IndexCollection&& outputIds)
+        : OperationBase{context, node, move(inputIds), move(outputIds)},
+          size_{ov::shape_size(node.get_output_shape(0)) * node.get_output_element_type(0).size()} {}
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers&) const override {
+        const auto& stream = context.getThreadContext().stream();
+        if (FailingIdentityNode::failures.fetch_sub(1) > 0) {
+            // Work of the failed inference is still pending when the next inference takes the memory block
+            for (int i = 0; i < 64; ++i) {
+                stream.memset(outputTensors[0], 0x7F, size_);
+            }
+            throw std::runtime_error{"FailingIdentity failed"};
+        }
+        FailingIdentityNode::failures.store(0);
+        stream.transfer(outputTensors[0], inputTensors[0], size_);
+    }
+
+private:
+    std::size_t size_;
+};
+
+OPERATION_REGISTER(FailingIdentityOp, FailingIdentity);
+
+/**
+ * Identity whose kernel aborts on the device instead of copying its input
+ */
+class DeviceFaultNode : public ov::op::Op {
+public:
+    OPENVINO_OP("DeviceFault", "nvidia_gpu_test");
+
+    explicit DeviceFaultNode(const ov::Output<ov::Node>& arg) : ov::op::Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<DeviceFaultNode>(new_args.at(0));
+    }
+};
+
+class DeviceFaultOp : public OperationBase {
+public:
+    using OperationBase::OperationBase;
+
+    void Execute(const InferenceRequestContext& context, Inputs, Outputs, const Workbuffers&) const override {
+        enqueueDeviceFault(context.getThreadContext().stream());
+    }
+};
+
+OPERATION_REGISTER(DeviceFaultOp, DeviceFault);
+
+std::shared_ptr<ov::Model> create_failing_test_model(const ov::Shape& shape) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto identity = std::make_shared<FailingIdentityNode>(relu);
+    auto next_relu = std::make_shared<ov::op::v0::Relu>(identity);
+    auto result = std::make_shared<ov::op::v0::Result>(next_relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "FailingIdentity");
+}
+
+}  // namespace
+
+TEST(InferRequestTest, InferenceAfterFailedInferenceIsNotRacedByItsPendingWork) {
+    const ov::Shape shape{1 << 22};
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(
+        create_failing_test_model(shape),
+        {ov::device::id("0"), ov::nvidia_gpu::use_cuda_graph(false), ov::hint::num_requests(1)});
+    auto request = compiled_model->create_infer_request();
+    ov::Tensor input{ov::element::f32, shape};
+    std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+    request->set_tensor(compiled_model->inputs().at(0), ov::get_tensor_impl(input));
+
+    FailingIdentityNode::failures.store(1);
+    ASSERT_ANY_THROW(request->infer());
+    ASSERT_NO_THROW(request->infer());
+    const auto output = request->get_tensor(compiled_model->outputs().at(0));
+    const auto* data = static_cast<const float*>(output->data());
+    ASSERT_TRUE(std::all_of(data, data + output->get_size(), [](float value) { return value == 1.0f; }));
+}
+
+TEST(InferRequestTest, InferenceFailedOnDeviceThrows) {
+    // Sticky error of the aborted kernel breaks the context of the process, so the inference runs in a child
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    const ov::Shape shape{16};
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto fault = std::make_shared<DeviceFaultNode>(param);
+    auto result = std::make_shared<ov::op::v0::Result>(fault);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "DeviceFault");
+    EXPECT_EXIT(
+        {
+            auto plugin = std::make_shared<Plugin>();
+            auto compiled_model =
+                plugin->compile_model(model, {ov::device::id("0"), ov::nvidia_gpu::use_cuda_graph(false)});
+            auto request = compiled_model->create_infer_request();
+            ov::Tensor input{ov::element::f32, shape};
+            request->set_tensor(compiled_model->inputs().at(0), ov::get_tensor_impl(input));
+            try {
+                request->infer();
+            } catch (const ov::Exception&) {
+                std::_Exit(0);
+            }
+            std::_Exit(1);
+        },
+        ::testing::ExitedWithCode(0),
+        "");
+}
+
+TEST(InferRequestTest, RemoteTensorOfAnotherDeviceIsRejected) {
+    if (CUDA::Device::count() < 2) {
+        GTEST_SKIP() << "Test requires several devices";
+    }
+    const ov::Shape shape{16};
+    auto plugin = std::make_shared<Plugin>();
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "Relu");
+    auto compiled_model = plugin->compile_model(model, {ov::device::id("0")});
+    auto request = compiled_model->create_infer_request();
+    // Peer access is enabled only for inputs of pipeline stages, so memory of the other device isn't accessible
+    auto context = plugin->get_default_context({ov::device::id("1")});
+    const auto input = context->create_tensor(ov::element::f32, shape, {});
+    request->set_tensor(compiled_model->inputs().at(0), {input._ptr, input._so});
+    ASSERT_THROW(request->infer(), ov::Exception);
+}
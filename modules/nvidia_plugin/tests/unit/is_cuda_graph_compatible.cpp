@@ -9,12 +9,18 @@
 #include "cuda/graph.hpp"
 #include "cuda_compiled_model.hpp"
 #include "cuda_operation_registry.hpp"
+#include "cuda_plugin.hpp"
 #include "cuda_profiler.hpp"
 #include "cuda_runtime.h"
 #include "cuda_simple_execution_delegator.hpp"
+#include "nvidia/properties.hpp"
 #include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/lstm_sequence.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/relu.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
 
 namespace {
 
@@ -130,7 +136,7 @@ struct ReluIsCudaGraphCompatibleTest : IsCudaGraphCompatibleTest {
     }
 };
 
-TEST_F(ReluIsCudaGraphCompatibleTest, Compatibile) { run(); }
+TEST_F(ReluIsCudaGraphCompatibleTest, Compatible) { run(); }
 
 struct ConcatIsCudaGraphCompatibleTest : IsCudaGraphCompatibleTest {
     void run() {
@@ -209,7 +215,7 @@ struct ConcatIsCudaGraphCompatibleTest : IsCudaGraphCompatibleTest {
 
         // Run with or without CudaGraph usage
         bool isCompatible = checkAndRun(operation, context, inputs, outputs, workbuffers);
-        ASSERT_FALSE(isCompatible);
+        ASSERT_TRUE(isCompatible);
 
         // Download output
         std::vector<ElementType> output(outSize);
@@ -228,6 +234,84 @@ struct ConcatIsCudaGraphCompatibleTest : IsCudaGraphCompatibleTest {
     }
 };
 
-TEST_F(ConcatIsCudaGraphCompatibleTest, NotCompatible) { run(); }
+TEST_F(ConcatIsCudaGraphCompatibleTest, Compatible) { run(); }
+
+
+/**
+ * Creates LSTM sequence between element-wise operations, which have sequence lengths given by a parameter,
+ * so that the sequence is executed by cuDNN
+ */
+std::shared_ptr<ov::Model> createLSTMSequenceModel() {
+    constexpr std::size_t batch = 2;
+    constexpr std::size_t seqLength = 6;
+    constexpr std::size_t inputSize = 8;
+    constexpr std::size_t hiddenSize = 16;
+    auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, seqLength, inputSize});
+    auto h = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, 1, hiddenSize});
+    auto c = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, 1, hiddenSize});
+    auto seqLengths = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{batch});
+    auto weights = [](const ov::Shape& shape) {
+        std::vector<float> values(ov::shape_size(shape));
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<float>(static_cast<int>(i * 37 % 101) - 50) / 200;
+        }
+        return ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    };
+    auto sequence = std::make_shared<ov::op::v5::LSTMSequence>(std::make_shared<ov::op::v0::Relu>(x),
+                                                               h,
+                                                               c,
+                                                               seqLengths,
+                                                               weights({1, 4 * hiddenSize, inputSize}),
+                                                               weights({1, 4 * hiddenSize, hiddenSize}),
+                                                               weights({1, 4 * hiddenSize}),
+                                                               hiddenSize,
+                                                               ov::op::RecurrentSequenceDirection::FORWARD);
+    auto relu = std::make_shared<ov::op::v0::Relu>(sequence->output(0));
+    return std::make_shared<ov::Model>(ov::OutputVector{relu, sequence->output(1), sequence->output(2)},
+                                       ov::ParameterVector{x, h, c, seqLengths},
+                                       "LSTMSequence");
+}
+
+std::vector<std::vector<float>> inferLSTMSequenceModel(bool useCudaGraph, std::size_t& numberOfCudaGraphs) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiledModel = plugin->compile_model(createLSTMSequenceModel(),
+                                               {ov::device::id("0"), ov::nvidia_gpu::use_cuda_graph(useCudaGraph)});
+    numberOfCudaGraphs = compiledModel->get_property(ov::nvidia_gpu::number_of_cuda_graphs.name()).as<size_t>();
+    auto request = compiledModel->create_infer_request();
+    std::vector<ov::Tensor> inputs;
+    for (const auto& input : compiledModel->inputs()) {
+        inputs.emplace_back(input.get_element_type(), input.get_shape());
+        if (input.get_element_type() == ov::element::i32) {
+            // Sequences of different lengths
+            auto* data = inputs.back().data<int32_t>();
+            for (std::size_t i = 0; i < inputs.back().get_size(); ++i) {
+                data[i] = static_cast<int32_t>(6 - 2 * i);
+            }
+        } else {
+            std::vector<float> values(inputs.back().get_size());
+            IsCudaGraphCompatibleTest::generate<float>(values);
+            std::copy(values.begin(), values.end(), inputs.back().data<float>());
+        }
+        request->set_tensor(input, ov::get_tensor_impl(inputs.back()));
+    }
+    request->infer();
+    std::vector<std::vector<float>> outputs;
+    for (const auto& output : compiledModel->outputs()) {
+        const auto tensor = request->get_tensor(output);
+        const auto* data = static_cast<const float*>(tensor->data());
+        outputs.emplace_back(data, data + tensor->get_size());
+    }
+    return outputs;
+}
+
+TEST(LSTMSequenceIsCudaGraphCompatibleTest, CapturedWithNeighboursIntoSingleGraph) {
+    std::size_t numberOfCudaGraphs = 0;
+    const auto outputs = inferLSTMSequenceModel(true, numberOfCudaGraphs);
+    // The model isn't split by the sequence into eagerly executed segments
+    ASSERT_EQ(numberOfCudaGraphs, 1);
+    std::size_t numberOfEagerCudaGraphs = 0;
+    const auto refOutputs = inferLSTMSequenceModel(false, numberOfEagerCudaGraphs);
+    ASSERT_EQ(outputs, refOutputs);
+}
 
 }  // namespace
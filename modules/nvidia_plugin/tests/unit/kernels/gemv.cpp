@@ -0,0 +1,125 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cuda/runtime.hpp>
+#include <kernels/gemv.hpp>
+#include <random>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+struct GemvTestParams {
+    size_t rows;
+    size_t k;
+    size_t n;
+    bool transpose_b;
+    size_t pool_size = 1;
+};
+
+std::vector<float> referenceGemv(const kernel::Gemv::Params& params,
+                                 const std::vector<float>& a,
+                                 const std::vector<float>& b,
+                                 const std::vector<float>& bias,
+                                 const std::vector<float>& c) {
+    // Pooled activations are averaged before they are multiplied
+    std::vector<float> means(params.rows * params.k);
+    for (size_t i = 0; i < means.size(); ++i) {
+        float sum = 0.0f;
+        for (size_t p = 0; p < params.pool_size; ++p) {
+            sum += a[i * params.pool_size + p];
+        }
+        means[i] = sum / static_cast<float>(params.pool_size);
+    }
+    std::vector<float> result(params.rows * params.n);
+    for (size_t r = 0; r < params.rows; ++r) {
+        for (size_t in = 0; in < params.n; ++in) {
+            float sum = 0.0f;
+            for (size_t ik = 0; ik < params.k; ++ik) {
+                const float w = params.transpose_b ? b[in * params.k + ik] : b[ik * params.n + in];
+                sum += means[r * params.k + ik] * w;
+            }
+            const float y = params.alpha * sum + params.beta * c[r * params.n + in] + bias[in];
+            result[r * params.n + in] = params.activation == kernel::Gemv::Activation::Relu ? std::max(y, 0.0f) : y;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+class GemvKernelTest : public testing::TestWithParam<GemvTestParams> {
+protected:
+    std::mt19937 gen{std::random_device{}()};
+};
+
+TEST_P(GemvKernelTest, MatchesReference) {
+    const auto& test = GetParam();
+    const kernel::Gemv::Params params{kernel::Type_t::f32,
+                                      test.rows,
+                                      test.k,
+                                      test.n,
+                                      test.transpose_b,
+                                      kernel::Gemv::Activation::Relu,
+                                      0.5f,
+                                      1.0f,
+                                      test.pool_size};
+    const CUDA::Device device{};
+    const kernel::Gemv gemv{params,
+                            static_cast<size_t>(device.props().multiProcessorCount),
+                            static_cast<size_t>(device.props().maxThreadsPerBlock)};
+
+    std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+    auto random = [&](size_t size) {
+        std::vector<float> values(size);
+        std::generate(values.begin(), values.end(), [&] { return dist(gen); });
+        return values;
+    };
+    const auto a = random(test.rows * test.k * test.pool_size);
+    const auto b = random(test.k * test.n);
+    const auto bias = random(test.n);
+    const auto c = random(test.rows * test.n);
+
+    CUDA::Stream stream{};
+    auto dA = stream.malloc(a.size() * sizeof(float));
+    auto dB = stream.malloc(b.size() * sizeof(float));
+    auto dBias = stream.malloc(bias.size() * sizeof(float));
+    auto dC = stream.malloc(c.size() * sizeof(float));
+    auto dWorkspace = stream.malloc(std::max<size_t>(gemv.workspaceSize(), 1));
+    stream.upload(dA, a.data(), a.size() * sizeof(float));
+    stream.upload(dB, b.data(), b.size() * sizeof(float));
+    stream.upload(dBias, bias.data(), bias.size() * sizeof(float));
+    stream.upload(dC, c.data(), c.size() * sizeof(float));
+    gemv(stream.get(), dA.get(), dB.get(), dBias.get(), dC.get(), dWorkspace.get());
+    std::vector<float> result(c.size());
+    stream.download(result.data(), dC, result.size() * sizeof(float));
+    stream.synchronize();
+
+    const auto expected = referenceGemv(params, a, b, bias, c);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(result[i], expected[i], 1e-3f * test.k) << "i = " << i;
+    }
+}
+
+// Vectorized and scalar loads, K split between blocks and not split
+INSTANTIATE_TEST_CASE_P(GemvKernel,
+                        GemvKernelTest,
+                        testing::Values(GemvTestParams{1, 4096, 64, true},
+                                        GemvTestParams{8, 4096, 64, false},
+                                        GemvTestParams{3, 1023, 4099, true},
+                                        GemvTestParams{5, 1023, 4099, false},
+                                        GemvTestParams{1, 64, 8192, true},
+                                        GemvTestParams{2, 64, 8192, false}));
+
+// Global average pooling of [rows, k, pool_size] fused with K split between blocks and not split
+INSTANTIATE_TEST_CASE_P(PooledGemvKernel,
+                        GemvKernelTest,
+                        testing::Values(GemvTestParams{1, 1280, 1000, true, 49},
+                                        GemvTestParams{4, 1280, 1000, false, 49},
+                                        GemvTestParams{2, 64, 10, true, 3},
+                                        GemvTestParams{1, 2048, 16, false, 100}));
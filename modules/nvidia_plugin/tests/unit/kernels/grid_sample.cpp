@@ -0,0 +1,95 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda/runtime.hpp>
+#include <kernels/grid_sample.hpp>
+#include <random>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+using Mode = kernel::GridSample::Mode;
+using Padding = kernel::GridSample::Padding;
+
+constexpr size_t N = 2, C = 3, H = 5, W = 7;
+
+std::vector<float> gridSample(const std::vector<float>& input,
+                              const std::vector<float>& grid,
+                              size_t outH,
+                              size_t outW,
+                              Mode mode,
+                              Padding padding,
+                              bool alignCorners) {
+    kernel::GridSample gridSample{kernel::Type_t::f32,
+                                  mode,
+                                  padding,
+                                  alignCorners,
+                                  N,
+                                  C,
+                                  H,
+                                  W,
+                                  outH,
+                                  outW,
+                                  static_cast<size_t>(CUDA::Device{}.props().maxThreadsPerBlock)};
+    CUDA::Stream stream{};
+    auto dInput = stream.malloc(input.size() * sizeof(float));
+    stream.upload(dInput, input.data(), input.size() * sizeof(float));
+    auto dGrid = stream.malloc(grid.size() * sizeof(float));
+    stream.upload(dGrid, grid.data(), grid.size() * sizeof(float));
+    std::vector<float> out(N * C * outH * outW);
+    auto dOut = stream.malloc(out.size() * sizeof(float));
+    gridSample(stream.get(), dInput.get(), dGrid.get(), dOut.get());
+    stream.download(out.data(), dOut, out.size() * sizeof(float));
+    stream.synchronize();
+    return out;
+}
+
+std::vector<float> randomInput() {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<float> value{-1.0f, 1.0f};
+    std::vector<float> input(N * C * H * W);
+    for (auto& v : input) {
+        v = value(generator);
+    }
+    return input;
+}
+
+}  // namespace
+
+TEST(GridSampleKernelTest, GridOfInputPixels) {
+    const auto input = randomInput();
+    std::vector<float> grid(N * H * W * 2);
+    for (size_t i = 0; i < N * H * W; ++i) {
+        grid[i * 2] = -1.0f + 2.0f * (i % W) / (W - 1);
+        grid[i * 2 + 1] = -1.0f + 2.0f * (i / W % H) / (H - 1);
+    }
+    for (const auto mode : {Mode::nearest, Mode::bilinear, Mode::bicubic}) {
+        for (const auto padding : {Padding::zeros, Padding::border, Padding::reflection}) {
+            const auto out = gridSample(input, grid, H, W, mode, padding, true);
+            for (size_t i = 0; i < out.size(); ++i) {
+                ASSERT_NEAR(out[i], input[i], 1e-5f) << "at " << i;
+            }
+        }
+    }
+}
+
+TEST(GridSampleKernelTest, PointsOutsideOfInput) {
+    const auto input = randomInput();
+    // Top left and bottom right points far outside of the input
+    const std::vector<float> grid{-5.0f, -5.0f, 5.0f, 5.0f, -5.0f, -5.0f, 5.0f, 5.0f};
+    for (const auto mode : {Mode::nearest, Mode::bilinear, Mode::bicubic}) {
+        const auto border = gridSample(input, grid, 1, 2, mode, Padding::border, false);
+        const auto zeros = gridSample(input, grid, 1, 2, mode, Padding::zeros, false);
+        for (size_t plane = 0; plane < N * C; ++plane) {
+            ASSERT_NEAR(border[plane * 2], input[plane * H * W], 1e-5f);
+            ASSERT_NEAR(border[plane * 2 + 1], input[(plane + 1) * H * W - 1], 1e-5f);
+            ASSERT_EQ(zeros[plane * 2], 0.0f);
+            ASSERT_EQ(zeros[plane * 2 + 1], 0.0f);
+        }
+    }
+}
@@ -0,0 +1,175 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cuda/runtime.hpp>
+#include <kernels/sparse_conv.hpp>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+// Exhaustive search of the custom operations
+std::vector<float> referenceSparseConv(const std::vector<float>& features,
+                                       const std::vector<float>& inpPos,
+                                       const std::vector<float>& outPos,
+                                       const std::vector<float>& kernel,
+                                       const float* offset,
+                                       int kd,
+                                       int kh,
+                                       int kw,
+                                       int IC,
+                                       int OC,
+                                       bool transposed) {
+    const size_t numOutPoints = outPos.size() / 3;
+    size_t numInpPoints = inpPos.size() / 3;
+    for (size_t i = 0; i < numInpPoints; ++i) {
+        if (inpPos[i * 3] < 0) {
+            numInpPoints = i;
+            break;
+        }
+    }
+    const float rw = kw * 0.51f;
+    const float rh = kh * 0.51f;
+    const float rd = kd * 0.51f;
+    std::vector<float> out(numOutPoints * OC);
+    for (size_t i = 0; i < numOutPoints; ++i) {
+        const float xi = outPos[i * 3] - offset[0];
+        const float yi = outPos[i * 3 + 1] - offset[1];
+        const float zi = outPos[i * 3 + 2] - offset[2];
+        for (size_t j = 0; j < numInpPoints; ++j) {
+            const float xj = inpPos[j * 3];
+            const float yj = inpPos[j * 3 + 1];
+            const float zj = inpPos[j * 3 + 2];
+            if (xi - rw <= xj && xj <= xi + rw && yi - rh <= yj && yj <= yi + rh && zi - rd <= zj && zj <= zi + rd) {
+                int w = std::min(static_cast<int>(xj - xi + kw * 0.5f), kw - 1);
+                int h = std::min(static_cast<int>(yj - yi + kh * 0.5f), kh - 1);
+                int d = std::min(static_cast<int>(zj - zi + kd * 0.5f), kd - 1);
+                if (transposed) {
+                    w = kw - 1 - w;
+                    h = kh - 1 - h;
+                    d = kd - 1 - d;
+                }
+                for (int ic = 0; ic < IC; ++ic) {
+                    for (int oc = 0; oc < OC; ++oc) {
+                        out[i * OC + oc] +=
+                            kernel[OC * (ic + IC * (w + kw * (h + kh * d))) + oc] * features[j * IC + ic];
+                    }
+                }
+            }
+        }
+    }
+    return out;
+}
+
+void checkSparseConv(bool transposed) {
+    constexpr int kd = 3, kh = 3, kw = 3, IC = 40, OC = 36;
+    constexpr size_t numInpPoints = 500, numOutPoints = 300;
+    std::mt19937 generator{42};
+    // Both voxel centers and arbitrary positions, so some inputs share an offset of the kernel of an output
+    std::uniform_int_distribution<int> voxel{0, 15};
+    std::uniform_real_distribution<float> position{0.0f, 16.0f};
+    std::uniform_real_distribution<float> value{-1.0f, 1.0f};
+    std::vector<float> inpPos(numInpPoints * 3);
+    for (size_t i = 0; i < inpPos.size(); ++i) {
+        inpPos[i] = i < inpPos.size() / 2 ? voxel(generator) + 0.5f : position(generator);
+    }
+    // Points after the first one with negative x are ignored
+    inpPos[(numInpPoints - 10) * 3] = -1.0f;
+    std::vector<float> outPos(numOutPoints * 3);
+    for (auto& p : outPos) {
+        p = voxel(generator) + 0.5f;
+    }
+    std::vector<float> features(numInpPoints * IC);
+    std::vector<float> kernel(kd * kh * kw * IC * OC);
+    for (auto& v : features) {
+        v = value(generator);
+    }
+    for (auto& v : kernel) {
+        v = value(generator);
+    }
+    const float offset[3] = {0.1f, -0.2f, 0.3f};
+    const auto expected =
+        referenceSparseConv(features, inpPos, outPos, kernel, offset, kd, kh, kw, IC, OC, transposed);
+
+    kernel::SparseConv sparseConv{numInpPoints,
+                                  numOutPoints,
+                                  kd,
+                                  kh,
+                                  kw,
+                                  IC,
+                                  OC,
+                                  transposed,
+                                  static_cast<size_t>(CUDA::Device{}.props().maxThreadsPerBlock)};
+    CUDA::Stream stream{};
+    auto upload = [&](const std::vector<float>& host) {
+        auto allocation = stream.malloc(host.size() * sizeof(float));
+        stream.upload(allocation, host.data(), host.size() * sizeof(float));
+        return allocation;
+    };
+    auto dFeatures = upload(features);
+    auto dInpPos = upload(inpPos);
+    auto dOutPos = upload(outPos);
+    auto dKernel = upload(kernel);
+    auto dOffset = upload(std::vector<float>(offset, offset + 3));
+    auto dOut = stream.malloc(expected.size() * sizeof(float));
+    auto workspace = stream.malloc(sparseConv.workspaceSize());
+    sparseConv(stream.get(),
+               static_cast<const float*>(dFeatures.get()),
+               static_cast<const float*>(dInpPos.get()),
+               static_cast<const float*>(dOutPos.get()),
+               static_cast<const float*>(dKernel.get()),
+               static_cast<const float*>(dOffset.get()),
+               static_cast<float*>(dOut.get()),
+               workspace.get());
+    std::vector<float> out(expected.size());
+    stream.download(out.data(), dOut, out.size() * sizeof(float));
+    stream.synchronize();
+    for (size_t i = 0; i < out.size(); ++i) {
+        ASSERT_NEAR(out[i], expected[i], 1e-3f) << "at " << i;
+    }
+}
+
+}  // namespace
+
+TEST(SparseConvKernelTest, SparseConv) { checkSparseConv(false); }
+
+TEST(SparseConvKernelTest, SparseConvTranspose) { checkSparseConv(true); }
+
+TEST(SparseConvKernelTest, CalculateGrid) {
+    const std::vector<float> inpPos{
+        3.5f, 0.5f, 1.5f, 2.5f, 1.5f, 0.5f, 5.5f, 2.5f, 2.5f, 0.5f, 0.5f, 0.5f, -1.0f, 0.0f, 0.0f};
+    const size_t numPoints = inpPos.size() / 3;
+    std::set<std::tuple<int, int, int>> cells;
+    for (size_t i = 0; i + 1 < numPoints; ++i) {
+        cells.emplace(static_cast<int>(inpPos[i * 3]) & ~1,
+                      static_cast<int>(inpPos[i * 3 + 1]) & ~1,
+                      static_cast<int>(inpPos[i * 3 + 2]) & ~1);
+    }
+    std::vector<float> expected;
+    for (const auto& [x, y, z] : cells) {
+        expected.insert(expected.end(), {0.5f + x, 0.5f + y, 0.5f + z});
+    }
+    expected.resize(numPoints * 3);
+    expected[cells.size() * 3] = -1.0f;
+
+    kernel::CalculateGrid calculateGrid{numPoints, static_cast<size_t>(CUDA::Device{}.props().maxThreadsPerBlock)};
+    CUDA::Stream stream{};
+    auto dInpPos = stream.malloc(inpPos.size() * sizeof(float));
+    stream.upload(dInpPos, inpPos.data(), inpPos.size() * sizeof(float));
+    auto dOut = stream.malloc(expected.size() * sizeof(float));
+    auto workspace = stream.malloc(calculateGrid.workspaceSize());
+    calculateGrid(
+        stream.get(), static_cast<const float*>(dInpPos.get()), static_cast<float*>(dOut.get()), workspace.get());
+    std::vector<float> out(expected.size());
+    stream.download(out.data(), dOut, out.size() * sizeof(float));
+    stream.synchronize();
+    ASSERT_EQ(out, expected);
+}
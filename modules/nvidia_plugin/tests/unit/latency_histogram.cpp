@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <utils/latency_histogram.hpp>
+
+using namespace ov::nvidia_gpu::utils;
+using std::chrono::microseconds;
+
+TEST(LatencyHistogramTest, BucketsCoverLatencies) {
+    for (std::uint64_t latency = 0; latency < 100000; ++latency) {
+        const auto index = LatencyHistogram::bucketIndex(latency);
+        ASSERT_GE(LatencyHistogram::bucketUpperBound(index), latency);
+        if (index > 0) {
+            ASSERT_LT(LatencyHistogram::bucketUpperBound(index - 1), latency);
+        }
+    }
+}
+
+TEST(LatencyHistogramTest, Empty) {
+    LatencyHistogram histogram;
+    ASSERT_EQ(histogram.count(), 0);
+    ASSERT_EQ(histogram.percentile(0.99), microseconds{0});
+    ASSERT_TRUE(histogram.summary().empty());
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 1000; ++i) {
+        histogram.record(microseconds{i});
+    }
+    ASSERT_EQ(histogram.count(), 1000);
+    ASSERT_EQ(histogram.max(), microseconds{1000});
+    const auto error = 1.0 / LatencyHistogram::kSubBuckets;
+    for (const double fraction : {0.5, 0.9, 0.99}) {
+        const auto expected = fraction * 1000;
+        const auto actual = static_cast<double>(histogram.percentile(fraction).count());
+        ASSERT_GE(actual, expected);
+        ASSERT_LE(actual, expected * (1 + error));
+    }
+    ASSERT_EQ(histogram.percentile(1.0), microseconds{1000});
+}
+
+TEST(LatencyHistogramTest, SpikeIsReportedByMaxOnly) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 999; ++i) {
+        histogram.record(microseconds{100});
+    }
+    histogram.record(microseconds{50000});
+    const auto summary = histogram.summary();
+    ASSERT_EQ(summary.size(), 4);
+    // p50 and p99 are reported by the upper bound of the bucket of 100us
+    ASSERT_EQ(summary[0], LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(100)));
+    ASSERT_EQ(summary[2], summary[0]);
+    ASSERT_EQ(summary[3], 50000);
+}
+
+TEST(LatencyHistogramTest, NamedHistograms) {
+    LatencyHistograms histograms;
+    histograms["3. execution time"].record(microseconds{10});
+    histograms["1. input preprocessing"];
+    const auto summaries = histograms.summaries();
+    ASSERT_EQ(summaries.size(), 1);
+    ASSERT_EQ(summaries.at("3. execution time").back(), 10);
+}
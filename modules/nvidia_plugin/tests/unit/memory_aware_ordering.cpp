@@ -0,0 +1,73 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "cuda_memory_aware_ordering.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/tile.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+struct Branch {
+    std::shared_ptr<ov::Node> tile;
+    std::shared_ptr<ov::Node> reduce;
+};
+
+Branch create_branch(const std::shared_ptr<ov::Node>& input) {
+    auto repeats = ov::op::v0::Constant::create(ov::element::i64, {2}, {1, 1024});
+    auto tile = std::make_shared<ov::op::v0::Tile>(input, repeats);
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, {1}, {1});
+    auto reduce = std::make_shared<ov::op::v1::ReduceSum>(tile, axes, true);
+    return {tile, reduce};
+}
+
+size_t position(const std::vector<MemoryAwareOrdering::NodePtr>& nodes, const std::shared_ptr<ov::Node>& node) {
+    return std::distance(nodes.begin(), std::find(nodes.begin(), nodes.end(), node));
+}
+
+}  // namespace
+
+class MemoryAwareOrderingTest : public testing::Test {
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        branches_ = {create_branch(param), create_branch(param)};
+        ov::ResultVector results;
+        for (const auto& branch : branches_) {
+            results.push_back(std::make_shared<ov::op::v0::Result>(branch.reduce));
+        }
+        model_ = std::make_shared<ov::Model>(results, ov::ParameterVector{param});
+    }
+
+protected:
+    std::vector<Branch> branches_;
+    std::shared_ptr<ov::Model> model_;
+};
+
+TEST_F(MemoryAwareOrderingTest, OrderIsTopological) {
+    const auto ordered_nodes = model_->get_ordered_ops();
+    const auto nodes = MemoryAwareOrdering::reorder(ordered_nodes);
+    ASSERT_EQ(nodes.size(), ordered_nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (const auto& input : nodes[i]->inputs()) {
+            ASSERT_LT(position(nodes, input.get_source_output().get_node_shared_ptr()), i);
+        }
+    }
+}
+
+TEST_F(MemoryAwareOrderingTest, BigTensorIsConsumedBeforeNextOneIsProduced) {
+    const auto nodes = MemoryAwareOrdering::reorder(model_->get_ordered_ops());
+    const bool first_is_0 = position(nodes, branches_[0].tile) < position(nodes, branches_[1].tile);
+    const auto& first = branches_[first_is_0 ? 0 : 1];
+    const auto& second = branches_[first_is_0 ? 1 : 0];
+    ASSERT_LT(position(nodes, first.reduce), position(nodes, second.tile));
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/cuda_constant_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+TEST(ConstantCacheTest, IdenticalConstantsShareDeviceMemory) {
+    std::vector<char> weights(ConstantCache::kMinSharedConstantSize, 1);
+    const auto copy = weights;
+    auto first = ConstantCache::instance().getOrUpload(weights);
+    auto second = ConstantCache::instance().getOrUpload(copy);
+    ASSERT_EQ(first->get(), second->get());
+
+    weights.back() = 2;
+    auto other = ConstantCache::instance().getOrUpload(weights);
+    ASSERT_NE(first->get(), other->get());
+
+    std::vector<char> uploaded(weights.size());
+    CUDA::DefaultStream::stream().download(uploaded.data(), *other, uploaded.size());
+    ASSERT_EQ(uploaded, weights);
+}
+
+TEST(ConstantCacheTest, ConstantIsUploadedAgainWhenNoModelUsesIt) {
+    std::vector<char> weights(ConstantCache::kMinSharedConstantSize, 3);
+    std::weak_ptr<const CUDA::DefaultAllocation> released = ConstantCache::instance().getOrUpload(weights);
+    ASSERT_TRUE(released.expired());
+    auto allocation = ConstantCache::instance().getOrUpload(weights);
+    ASSERT_NE(allocation, nullptr);
+}
+
+TEST(ConstantCacheTest, ExportedConstantIsPublishedInIpcDirectory) {
+    if (!ConstantCache::isIpcSupported()) {
+        GTEST_SKIP() << "CUDA IPC isn't supported on this platform";
+    }
+    const auto dir = std::filesystem::temp_directory_path() / "nvidia_ipc_constants_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    std::vector<char> weights(ConstantCache::kMinSharedConstantSize, 4);
+    auto exported = ConstantCache::instance().getOrUpload(weights, dir.string());
+    ASSERT_EQ(std::distance(std::filesystem::directory_iterator{dir}, std::filesystem::directory_iterator{}), 1);
+
+    // Own records aren't imported, the process finds exported memory among its constants
+    auto found = ConstantCache::instance().getOrUpload(weights, dir.string());
+    ASSERT_EQ(exported->get(), found->get());
+
+    std::vector<char> uploaded(weights.size());
+    CUDA::DefaultStream::stream().download(uploaded.data(), *found, uploaded.size());
+    ASSERT_EQ(uploaded, weights);
+    std::filesystem::remove_all(dir);
+}
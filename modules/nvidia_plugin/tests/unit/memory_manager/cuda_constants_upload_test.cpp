@@ -0,0 +1,84 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/cuda_constants_upload.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cuda/runtime.hpp>
+#include <memory>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+std::vector<char> pattern(std::size_t size, unsigned seed) {
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>((i * 7 + seed * 13) & 0xFF);
+    }
+    return data;
+}
+
+std::vector<char> download(const void* devicePtr, std::size_t size) {
+    std::vector<char> data(size);
+    CUDA::DefaultStream::stream().download(data.data(), CUDA::DevicePointer<const void*>{devicePtr}, size);
+    return data;
+}
+
+}  // namespace
+
+TEST(ConstantsUpload, UploadsPageableConstantsThroughStagingChunks) {
+    constexpr auto chunk = ConstantsUpload::kChunkSize;
+    // The second constant is split between two staging windows, while the third one reuses the first chunk
+    const std::vector<std::size_t> offsets{0, 1024, 2 * chunk + 512};
+    const std::vector<std::size_t> sizes{1000, chunk + 5000, 3000};
+    auto block = CUDA::DefaultStream::stream().malloc(offsets.back() + sizes.back());
+    auto* blockPtr = static_cast<char*>(block.get());
+    std::vector<std::vector<char>> data;
+    std::vector<ConstantsUpload::Region> regions;
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        data.push_back(pattern(sizes[i], i));
+        regions.push_back({blockPtr + offsets[i], data.back()});
+    }
+    ConstantsUpload upload{regions};
+    upload.wait();
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(download(blockPtr + offsets[i], sizes[i]), data[i]) << "constant " << i;
+    }
+}
+
+TEST(ConstantsUpload, UploadsPageLockedConstantsDirectly) {
+    constexpr std::size_t size = 4096;
+    void* pinned = nullptr;
+    throwIfError(cudaMallocHost(&pinned, size));
+    std::unique_ptr<void, decltype(&cudaFreeHost)> pinnedHolder{pinned, cudaFreeHost};
+    const auto pinnedData = pattern(size, 1);
+    std::copy(pinnedData.begin(), pinnedData.end(), static_cast<char*>(pinned));
+    const auto pageableData = pattern(size, 2);
+
+    auto block = CUDA::DefaultStream::stream().malloc(2 * size);
+    auto* blockPtr = static_cast<char*>(block.get());
+    ConstantsUpload upload{{{blockPtr, {static_cast<const char*>(pinned), size}},
+                            {blockPtr + size, pageableData}}};
+    upload.wait();
+    ASSERT_EQ(download(blockPtr, size), pinnedData);
+    ASSERT_EQ(download(blockPtr + size, size), pageableData);
+}
+
+TEST(ConstantsUpload, WaitCanBeCalledSeveralTimes) {
+    ConstantsUpload empty{std::vector<ConstantsUpload::Region>{}};
+    empty.wait();
+    empty.wait();
+
+    const auto data = pattern(256, 3);
+    auto block = CUDA::DefaultStream::stream().malloc(data.size());
+    {
+        // Destructor waits for completion of the upload
+        ConstantsUpload upload{{{block.get(), data}}};
+    }
+    ASSERT_EQ(download(block.get(), data.size()), data);
+}
@@ -6,6 +6,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "memory_manager/model/cuda_memory_model.hpp"
 
 TEST(DeviceMemBlock, ZeroSizeMemoryBlock) {
@@ -84,3 +86,24 @@ TEST(DeviceMemBlock, NullPtrIfTensorNotFound) {
     ASSERT_TRUE(mem_block->deviceTensorPtr(TensorID{0}) == nullptr);
     ASSERT_TRUE(mem_block->deviceTensorPtr(TensorID{4}) == nullptr);
 }
+
+TEST(DeviceMemBlock, WorkOfNextUserIsOrderedAfterRelease) {
+    using namespace ov::nvidia_gpu;
+
+    const size_t block_size = 1 << 20;
+    auto model = std::make_shared<MemoryModel>(block_size, std::unordered_map<BufferID, ptrdiff_t>{{1, 0x0}});
+    auto mem_block = std::make_unique<DeviceMemBlock>(model);
+    void* data = mem_block->deviceTensorPtr(TensorID{1});
+
+    CUDA::Stream released_stream;
+    CUDA::Stream next_stream;
+    // Nothing was released yet, so the next stream doesn't wait
+    mem_block->waitRelease(next_stream);
+    released_stream.memset(CUDA::DevicePointer<void*>{data}, 0x2A, block_size);
+    mem_block->recordRelease(released_stream);
+    mem_block->waitRelease(next_stream);
+    std::vector<uint8_t> content(block_size);
+    next_stream.download(content.data(), CUDA::DevicePointer<const void*>{data}, block_size);
+    next_stream.synchronize();
+    ASSERT_EQ(content, std::vector<uint8_t>(block_size, 0x2A));
+}
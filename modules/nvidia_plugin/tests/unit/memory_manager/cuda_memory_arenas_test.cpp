@@ -0,0 +1,107 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/cuda_memory_arenas.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cuda/virtual_memory.hpp>
+#include <vector>
+
+#include "memory_manager/cuda_device_mem_block.hpp"
+#include "memory_manager/model/cuda_memory_model.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+constexpr std::size_t reserved_size = 64 << 20;
+
+}  // namespace
+
+TEST(VirtualMemory, GrowsInPlaceKeepingContent) {
+    CUDA::Device device{};
+    if (!CUDA::VirtualMemory::isSupported(device)) {
+        GTEST_SKIP() << "Virtual memory management isn't supported by the device";
+    }
+    CUDA::VirtualMemory memory{device, reserved_size};
+    memory.resize(1);
+    const auto base = memory.get();
+    const auto chunk = memory.size();
+    ASSERT_GT(chunk, 0);
+    std::vector<std::uint8_t> pattern(chunk, 0x5A);
+    ASSERT_EQ(cudaMemcpy(base, pattern.data(), chunk, cudaMemcpyHostToDevice), cudaSuccess);
+
+    memory.resize(3 * chunk);
+    ASSERT_EQ(memory.get(), base);
+    ASSERT_EQ(memory.size(), 3 * chunk);
+    std::vector<std::uint8_t> content(chunk);
+    ASSERT_EQ(cudaMemcpy(content.data(), base, chunk, cudaMemcpyDeviceToHost), cudaSuccess);
+    ASSERT_EQ(content, pattern);
+
+    memory.resize(chunk);
+    ASSERT_EQ(memory.get(), base);
+    ASSERT_EQ(memory.size(), chunk);
+    ASSERT_ANY_THROW(memory.resize(memory.reservedSize() + 1));
+}
+
+TEST(MemoryArenas, BlockOfLargerModelReusesReleasedArena) {
+    CUDA::Device device{};
+    if (!CUDA::VirtualMemory::isSupported(device)) {
+        GTEST_SKIP() << "Virtual memory management isn't supported by the device";
+    }
+    auto arenas = std::make_shared<MemoryArenas>(device, reserved_size);
+    auto small_model = std::make_shared<MemoryModel>(0x1000, std::unordered_map<BufferID, ptrdiff_t>{{1, 0x0}});
+    auto large_model = std::make_shared<MemoryModel>(8 << 20, std::unordered_map<BufferID, ptrdiff_t>{{1, 0x100}});
+
+    void* base = nullptr;
+    {
+        DeviceMemBlock block{small_model, arenas};
+        base = block.deviceTensorPtr(TensorID{1});
+        ASSERT_NE(base, nullptr);
+        ASSERT_EQ(arenas->idleSize(), 0);
+    }
+    ASSERT_GT(arenas->idleSize(), 0);
+    {
+        DeviceMemBlock block{large_model, arenas};
+        ASSERT_EQ(block.deviceTensorPtr(TensorID{1}), static_cast<std::uint8_t*>(base) + 0x100);
+        DeviceMemBlock other{small_model, arenas};
+        ASSERT_NE(other.deviceTensorPtr(TensorID{1}), base);
+        ASSERT_EQ(arenas->size(), 2);
+    }
+    // Only the largest released arena keeps its memory
+    ASSERT_GE(arenas->idleSize(), std::size_t{8 << 20});
+    ASSERT_LT(arenas->idleSize(), std::size_t{16 << 20});
+}
+
+TEST(MemoryArenas, EmptyBlockTakesNoArena) {
+    CUDA::Device device{};
+    if (!CUDA::VirtualMemory::isSupported(device)) {
+        GTEST_SKIP() << "Virtual memory management isn't supported by the device";
+    }
+    auto arenas = std::make_shared<MemoryArenas>(device, reserved_size);
+    DeviceMemBlock block{std::make_shared<MemoryModel>(0, std::unordered_map<BufferID, ptrdiff_t>{}), arenas};
+    ASSERT_EQ(arenas->size(), 0);
+    ASSERT_TRUE(block.workbuffers().mutable_buffers.empty());
+}
+
+TEST(MemoryArenas, BlockOfSmallerModelKeepsReleasedArenaMapped) {
+    CUDA::Device device{};
+    if (!CUDA::VirtualMemory::isSupported(device)) {
+        GTEST_SKIP() << "Virtual memory management isn't supported by the device";
+    }
+    auto arenas = std::make_shared<MemoryArenas>(device, reserved_size);
+    auto small_model = std::make_shared<MemoryModel>(0x1000, std::unordered_map<BufferID, ptrdiff_t>{{1, 0x0}});
+    auto large_model = std::make_shared<MemoryModel>(8 << 20, std::unordered_map<BufferID, ptrdiff_t>{{1, 0x0}});
+    { DeviceMemBlock block{large_model, arenas}; }
+    const auto mapped_size = arenas->idleSize();
+    ASSERT_GE(mapped_size, std::size_t{8 << 20});
+    {
+        DeviceMemBlock block{small_model, arenas};
+        ASSERT_EQ(arenas->idleSize(), 0);
+    }
+    // The arena isn't shrunk for the smaller blob, so the next larger blob doesn't map it again
+    ASSERT_EQ(arenas->idleSize(), mapped_size);
+    ASSERT_EQ(arenas->size(), 1);
+}
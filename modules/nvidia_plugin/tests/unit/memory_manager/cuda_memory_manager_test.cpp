@@ -200,3 +200,27 @@ TEST_F(MemoryManagerTest, ConstantsCanNotBeOutputs) {
                                                            mutableMemoryModel_->deviceMemoryBlockSize());
     ASSERT_THROW(memory_manager->outputTensorPointers(*this, allocation), ov::Exception);
 }
+
+TEST_F(MemoryManagerTest, InternalTensorPtr) {
+    using namespace ov::nvidia_gpu;
+
+    auto memory_manager = std::make_unique<MemoryManager>(immutableTensors_, mutableMemoryModel_);
+    auto allocation = CUDA::DefaultStream::stream().malloc(mutableMemoryModel_->deviceMemoryBlockSize());
+    const CUDA::DevicePointer<void*> buffer{allocation.get()};
+
+    // Constants are resolved for inputs only
+    EXPECT_EQ(memory_manager->internalTensorPtr(sharedConstantIds_[0], buffer, false),
+              immutableTensors_->deviceTensorPtr(sharedConstantIds_[0]));
+    EXPECT_EQ(memory_manager->internalTensorPtr(sharedConstantIds_[0], buffer, true), nullptr);
+
+    for (const auto& id : mutableTensorIDs_) {
+        ptrdiff_t offset = -1;
+        ASSERT_TRUE(mutableMemoryModel_->offsetForBuffer(id.GetId(), offset));
+        const void* expected = static_cast<uint8_t*>(allocation.get()) + offset;
+        EXPECT_EQ(memory_manager->internalTensorPtr(id, buffer, false), expected);
+        EXPECT_EQ(memory_manager->internalTensorPtr(id, buffer, true), expected);
+    }
+
+    // Tensors of external buffers aren't resolved
+    EXPECT_EQ(memory_manager->internalTensorPtr(TensorID{9999}, buffer, false), nullptr);
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/cuda_offloaded_constant.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+class OffloadedConstantTest : public testing::TestWithParam<OffloadedConstant::Placement> {};
+
+}  // namespace
+
+TEST_P(OffloadedConstantTest, DeviceReadsContent) {
+    std::vector<char> data(100 * 1024 + 3);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    const auto allocation = OffloadedConstant::create(data, GetParam());
+    ASSERT_NE(allocation, nullptr);
+    // Copying on the device reads the memory the way kernels do
+    auto copy = CUDA::DefaultStream::stream().malloc(data.size());
+    CUDA::DefaultStream::stream().transfer(CUDA::DevicePointer<void*>{copy.get()},
+                                           CUDA::DevicePointer<const void*>{allocation->get()},
+                                           data.size());
+    std::vector<char> result(data.size());
+    CUDA::DefaultStream::stream().download(result.data(), copy, result.size());
+    ASSERT_EQ(result, data);
+}
+
+INSTANTIATE_TEST_SUITE_P(OffloadedConstant,
+                         OffloadedConstantTest,
+                         testing::Values(OffloadedConstant::Placement::Managed,
+                                         OffloadedConstant::Placement::MappedHost));
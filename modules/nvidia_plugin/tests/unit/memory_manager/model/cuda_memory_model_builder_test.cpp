@@ -129,3 +129,43 @@ TEST(MemoryModelBuilder, NoAllocations) {
 
     EXPECT_EQ(model->deviceMemoryBlockSize(), 0);
 }
+
+/*
+  Scratch buffers of different operations never overlap in time, so all of them
+  share an arena sized to the greatest need of a single operation:
+
+    Op index: |  0  |  1  |  2
+          t0  | ===========
+          s1  |     | === |
+          s2  |     |     | ===
+          s3  |     |     | ===
+ */
+TEST(MemoryModelBuilder, ScratchAllocationsShareMemory) {
+    using namespace ov::nvidia_gpu;
+
+    MemoryModelBuilder builder;
+    const size_t allocation_size = applyAllignment(1);
+    builder.addAllocation(0, 0, 1, allocation_size);
+    builder.addScratchAllocation(1, 1, allocation_size);
+    builder.addScratchAllocation(2, 2, allocation_size);
+    builder.addScratchAllocation(3, 2, allocation_size);
+
+    MemoryModel::Ptr model = builder.build();
+    ptrdiff_t offset2 = -1;
+    ptrdiff_t offset3 = -1;
+    ASSERT_TRUE(model->offsetForBuffer(2, offset2));
+    ASSERT_TRUE(model->offsetForBuffer(3, offset3));
+    EXPECT_NE(offset2, offset3);
+    EXPECT_EQ(model->deviceMemoryBlockSize(), 2 * allocation_size);
+    EXPECT_LE(builder.scratchMemorySize(), allocation_size);
+}
+
+TEST(MemoryModelBuilder, HandleDuplicateScratchAllocation) {
+    using namespace ov::nvidia_gpu;
+
+    MemoryModelBuilder builder;
+    builder.addAllocation(1, 0, 1, 128);
+
+    ASSERT_THROW(builder.addScratchAllocation(1, 0, 128), ov::Exception);
+    ASSERT_THROW(builder.addScratchAllocation(2, 0, 0), ov::Exception);
+}
@@ -4,6 +4,12 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
+#include <openvino/runtime/exception.hpp>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "memory_manager/cuda_memory_pool.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
 
@@ -16,6 +22,10 @@ class MemoryPoolTest : public testing::Test {
 
 public:
     size_t GetNumAvailableMemoryManagers(MemoryPool& memManPool) { return memManPool.memory_blocks_.size(); }
+    size_t GetNumAllocatedMemoryManagers(MemoryPool& memManPool) {
+        std::lock_guard<std::mutex> lock{memManPool.mtx_};
+        return memManPool.num_allocated_;
+    }
 };
 
 TEST_F(MemoryPoolTest, MemoryManagerProxy_Success) {
@@ -40,3 +50,142 @@ TEST_F(MemoryPoolTest, MemoryManagerProxy_Success) {
     }
     ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 2);
 }
+
+TEST_F(MemoryPoolTest, MemoryBlocksAreAllocatedOnDemandAndReleasedWhenIdle) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(3, memoryModel, 1, 50ms);
+    ASSERT_EQ(memoryPool->Size(), 3);
+    ASSERT_EQ(GetNumAllocatedMemoryManagers(*memoryPool), 1);
+    {
+        auto memoryManagerProxy0 = memoryPool->WaitAndGet(cancellationToken);
+        auto memoryManagerProxy1 = memoryPool->WaitAndGet(cancellationToken);
+        ASSERT_EQ(GetNumAllocatedMemoryManagers(*memoryPool), 2);
+    }
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 2);
+    for (int i = 0; i < 100 && GetNumAllocatedMemoryManagers(*memoryPool) > 0; ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+    ASSERT_EQ(GetNumAllocatedMemoryManagers(*memoryPool), 0);
+    auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+    ASSERT_EQ(GetNumAllocatedMemoryManagers(*memoryPool), 1);
+}
+
+TEST_F(MemoryPoolTest, WaitTimeoutThrowsBusy) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel, 1, 0ms, 20ms);
+    {
+        auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+        ASSERT_THROW(memoryPool->WaitAndGet(cancellationToken), ov::Busy);
+    }
+    auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+    const auto statistics = memoryPool->GetWaitStatistics();
+    ASSERT_EQ(statistics.queueDepth, 0);
+    ASSERT_EQ(statistics.numWaits, 2);
+    ASSERT_EQ(statistics.numTimeouts, 1);
+    ASSERT_GE(statistics.maxWaitTime, 20ms);
+}
+
+TEST_F(MemoryPoolTest, ExpiredDeadlineThrowsCancelled) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel);
+    {
+        auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+        CancellationToken expiringToken{};
+        expiringToken.setDeadline(CancellationToken::Clock::now() + 20ms);
+        ASSERT_THROW(memoryPool->WaitAndGet(expiringToken), ov::Cancelled);
+    }
+    const auto statistics = memoryPool->GetWaitStatistics();
+    ASSERT_EQ(statistics.queueDepth, 0);
+    ASSERT_EQ(statistics.numTimeouts, 0);
+}
+
+TEST_F(MemoryPoolTest, OccupancyIsPublished) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(2, memoryModel, 1, 0ms, 20ms);
+    ASSERT_EQ(memoryPool->NumBusy(), 0);
+    ASSERT_EQ(memoryPool->NumFree(), 1);
+    {
+        auto memoryManagerProxy0 = memoryPool->WaitAndGet(cancellationToken);
+        ASSERT_EQ(memoryPool->NumBusy(), 1);
+        ASSERT_EQ(memoryPool->NumFree(), 0);
+        auto memoryManagerProxy1 = memoryPool->WaitAndGet(cancellationToken);
+        ASSERT_EQ(memoryPool->NumBusy(), 2);
+        ASSERT_EQ(memoryPool->NumFree(), 0);
+        ASSERT_THROW(memoryPool->WaitAndGet(cancellationToken), ov::Busy);
+    }
+    ASSERT_EQ(memoryPool->NumBusy(), 0);
+    ASSERT_EQ(memoryPool->NumFree(), 2);
+    ASSERT_GE(memoryPool->TotalWaitTime(), 20ms);
+    ASSERT_EQ(memoryPool->TotalWaitTime(), memoryPool->GetWaitStatistics().totalWaitTime);
+}
+
+TEST_F(MemoryPoolTest, WaitersAreServedInOrderOfArrival) {
+    using namespace std::chrono_literals;
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel);
+    std::mutex servedMutex;
+    std::vector<int> served;
+    std::vector<std::thread> waiters;
+    {
+        CancellationToken cancellationToken{};
+        auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+        for (int i = 0; i < 4; ++i) {
+            waiters.emplace_back([&, i] {
+                CancellationToken token{};
+                auto proxy = memoryPool->WaitAndGet(token);
+                std::lock_guard<std::mutex> lock{servedMutex};
+                served.push_back(i);
+            });
+            // The next waiter arrives only after the previous one is queued
+            while (memoryPool->GetWaitStatistics().queueDepth < i + 1) {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        ASSERT_EQ(memoryPool->GetWaitStatistics().maxQueueDepth, 4);
+    }
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    ASSERT_EQ(served, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST_F(MemoryPoolTest, CancelledWaiterLeavesQueue) {
+    using namespace std::chrono_literals;
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel);
+    CancellationToken cancellationToken{};
+    std::optional<MemoryPool::Proxy> memoryManagerProxy{memoryPool->WaitAndGet(cancellationToken)};
+    CancellationToken cancelledToken{};
+    auto cancelled = std::async(std::launch::async, [&] { memoryPool->WaitAndGet(cancelledToken); });
+    while (memoryPool->GetWaitStatistics().queueDepth < 1) {
+        std::this_thread::sleep_for(1ms);
+    }
+    CancellationToken nextToken{};
+    auto next = std::async(std::launch::async, [&] { return memoryPool->WaitAndGet(nextToken); });
+    while (memoryPool->GetWaitStatistics().queueDepth < 2) {
+        std::this_thread::sleep_for(1ms);
+    }
+    cancelledToken.cancel();
+    memoryPool->Interrupt();
+    ASSERT_THROW(cancelled.get(), ov::Cancelled);
+    ASSERT_EQ(memoryPool->GetWaitStatistics().queueDepth, 1);
+    // The cancelled waiter no longer blocks the head of the queue, so the next waiter is served after release
+    memoryManagerProxy.reset();
+    ASSERT_EQ(next.wait_for(1s), std::future_status::ready);
+    ASSERT_NO_THROW(next.get());
+    ASSERT_EQ(memoryPool->GetWaitStatistics().queueDepth, 0);
+}
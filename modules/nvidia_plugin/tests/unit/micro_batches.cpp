@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cuda_plugin.hpp"
+#include "nvidia/properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+constexpr std::size_t kChannels = 16;
+
+/**
+ * Creates model computing y = x * scale + shift per sample, scale and shift vary over channels
+ */
+std::shared_ptr<ov::Model> create_model(std::size_t batch_size) {
+    auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch_size, kChannels});
+    std::vector<float> scale(kChannels);
+    std::vector<float> shift(kChannels);
+    for (std::size_t c = 0; c < kChannels; ++c) {
+        scale[c] = 0.5f + c;
+        shift[c] = -1.0f * c;
+    }
+    auto multiply = std::make_shared<ov::op::v1::Multiply>(
+        x, ov::op::v0::Constant::create(ov::element::f32, {1, kChannels}, scale));
+    auto add = std::make_shared<ov::op::v1::Add>(
+        multiply, ov::op::v0::Constant::create(ov::element::f32, {1, kChannels}, shift));
+    return std::make_shared<ov::Model>(
+        ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)}, ov::ParameterVector{x}, "ScaleShift");
+}
+
+}  // namespace
+
+TEST(MicroBatchesTest, OutputsOfMicroBatchesAreWrittenToTheirSlices) {
+    constexpr std::size_t batch_size = 8;
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model =
+        plugin->compile_model(create_model(batch_size), {ov::device::id("0"), ov::nvidia_gpu::micro_batch_size(2)});
+    auto request = compiled_model->create_infer_request();
+    ov::Tensor x{ov::element::f32, ov::Shape{batch_size, kChannels}};
+    auto* x_data = x.data<float>();
+    for (std::size_t i = 0; i < x.get_size(); ++i) {
+        x_data[i] = static_cast<float>(i % 13) - 6;
+    }
+    request->set_tensor(compiled_model->inputs().at(0), ov::get_tensor_impl(x));
+    // Micro-batches are taken by lanes of infer requests in turns, so several inferences reuse them
+    for (int inference = 0; inference < 2; ++inference) {
+        request->infer();
+        const auto y = request->get_tensor(compiled_model->outputs().at(0));
+        ASSERT_EQ(y->get_shape(), x.get_shape());
+        const auto* y_data = static_cast<const float*>(y->data());
+        for (std::size_t i = 0; i < x.get_size(); ++i) {
+            const auto c = i % kChannels;
+            ASSERT_FLOAT_EQ(y_data[i], x_data[i] * (0.5f + c) - 1.0f * c) << "element " << i;
+        }
+    }
+}
+
+TEST(MicroBatchesTest, BatchNotDivisibleByMicroBatchIsRejected) {
+    auto plugin = std::make_shared<Plugin>();
+    ASSERT_THROW(plugin->compile_model(create_model(6), {ov::device::id("0"), ov::nvidia_gpu::micro_batch_size(4)}),
+                 ov::Exception);
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <openvino/op/add.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/parameter.hpp>
+#include <ops/components/numpy_broadcast_params.h>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+std::shared_ptr<ov::op::v0::Parameter> makeInput() {
+    return std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 3, 4, 5});
+}
+
+kernel::NumpyBroadcastMapper mapper(const ov::Node& node, size_t input_idx) {
+    return NumpyBroadcastParams::create(node, input_idx)->mapper({});
+}
+
+}  // namespace
+
+TEST(NumpyBroadcastParamsTest, ScalarConstantIsPassedByValue) {
+    auto input = makeInput();
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 1}, {0.5f});
+    auto multiply = std::make_shared<ov::op::v1::Multiply>(scale, input);
+
+    const auto scale_mapper = mapper(*multiply, 0);
+    ASSERT_TRUE(scale_mapper.scalar());
+    ASSERT_EQ(scale_mapper.scalarValue<float>(), 0.5f);
+    ASSERT_TRUE(mapper(*multiply, 1).identity());
+}
+
+TEST(NumpyBroadcastParamsTest, PerChannelConstant) {
+    auto input = makeInput();
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{3, 1, 1}, std::vector<float>(3, 1.0f));
+    auto add = std::make_shared<ov::op::v1::Add>(input, bias);
+
+    const auto bias_mapper = mapper(*add, 1);
+    ASSERT_TRUE(bias_mapper.perChannel());
+    ASSERT_EQ(bias_mapper.numChannels().divisor(), 3u);
+    ASSERT_EQ(bias_mapper.innerSize().divisor(), 4u * 5u);
+}
+
+TEST(NumpyBroadcastParamsTest, NotContiguousConstantIsBroadcasted) {
+    auto input = makeInput();
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{3, 1, 5}, std::vector<float>(15, 1.0f));
+    auto add = std::make_shared<ov::op::v1::Add>(input, bias);
+
+    const auto bias_mapper = mapper(*add, 1);
+    ASSERT_FALSE(bias_mapper.perChannel());
+    ASSERT_FALSE(bias_mapper.scalar());
+    ASSERT_FALSE(bias_mapper.identity());
+}
+
+TEST(NumpyBroadcastParamsTest, BroadcastedParameterIsNotSpecialized) {
+    auto input = makeInput();
+    auto bias = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1});
+    auto add = std::make_shared<ov::op::v1::Add>(input, bias);
+
+    const auto bias_mapper = mapper(*add, 1);
+    ASSERT_FALSE(bias_mapper.scalar());
+    ASSERT_FALSE(bias_mapper.identity());
+}
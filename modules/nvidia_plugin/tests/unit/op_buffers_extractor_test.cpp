@@ -4,19 +4,29 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <vector>
 
 #include "cuda_op_buffers_extractor.hpp"
+#include "memory_manager/model/details/cuda_memory_utils.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/assign.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/pad.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
 #include "openvino/op/relu.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/split.hpp"
 #include "openvino/op/squeeze.hpp"
+#include "openvino/op/strided_slice.hpp"
 #include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "transformer/nodes/concat_optimized.hpp"
 
 /*
@@ -288,6 +298,42 @@ TEST_F(OperationBufferExtractorTest, CheckImmutableBufferContent) {
     EXPECT_THAT(immutableBuffer<int32_t>(OutputBufferIndex::Constant_Reshape_Pattern), ElementsAre(0, 1));
 }
 
+TEST_F(OperationBufferExtractorTest, CheckMemoryLayout) {
+    using ::testing::ElementsAre;
+    const auto layout = extractor_->memoryLayout(exec_sequence_);
+    ASSERT_EQ(layout.size(), 12);
+    auto entry = [&layout](OutputBufferIndex::Type idx) {
+        return *std::find_if(layout.begin(), layout.end(), [idx](const auto& e) { return e.id == idx; });
+    };
+    auto tensor = [this](OpIndex::Type op_idx) { return exec_sequence_.at(op_idx)->get_friendly_name() + ":0"; };
+
+    const auto add_bias = entry(OutputBufferIndex::Add_Bias);
+    EXPECT_EQ(add_bias.block, "mutable");
+    EXPECT_EQ(add_bias.kind, "tensor");
+    EXPECT_EQ(add_bias.producer, OpIndex::Add_Bias);
+    EXPECT_EQ(add_bias.last_consumer, OpIndex::Relu);
+    EXPECT_EQ(add_bias.op, exec_sequence_.at(OpIndex::Add_Bias)->get_friendly_name());
+    EXPECT_EQ(add_bias.size, 12);
+    EXPECT_GE(add_bias.offset, 0);
+    EXPECT_THAT(add_bias.tensors, ElementsAre(tensor(OpIndex::Add_Bias), tensor(OpIndex::Unsqueeze)));
+
+    const auto bias = entry(OutputBufferIndex::Constant_Bias);
+    EXPECT_EQ(bias.block, "constants");
+    EXPECT_EQ(bias.kind, "constant");
+    EXPECT_EQ(bias.op, exec_sequence_.at(OpIndex::Constant_Bias)->get_friendly_name());
+    EXPECT_GE(bias.offset, 0);
+
+    EXPECT_EQ(entry(OutputBufferIndex::Squeeze_Mutable_Workbuffer).kind, "workbuffer");
+    EXPECT_EQ(entry(OutputBufferIndex::Squeeze_Imutable_Workbuffer).block, "immutable_workbuffers");
+
+    // Buffers of each block are ordered by offsets
+    for (size_t i = 1; i < layout.size(); ++i) {
+        if (layout[i].block == layout[i - 1].block) {
+            EXPECT_LE(layout[i - 1].offset, layout[i].offset);
+        }
+    }
+}
+
 TEST_F(OperationBufferExtractorTest, CheckSameInputOutputForReshapeOnlyOps) {
     EXPECT_EQ(inputBufferIndices(OpIndex::Unsqueeze).at(0), outputBufferIndices(OpIndex::Unsqueeze).at(0));
     EXPECT_EQ(inputBufferIndices(OpIndex::Squeeze).at(0), outputBufferIndices(OpIndex::Squeeze).at(0));
@@ -299,6 +345,19 @@ TEST_F(OperationBufferExtractorTest, CheckMutableWorkbufferIndices) {
     ASSERT_THAT(buffer_indices_.mutableIds, ElementsAre(OutputBufferIndex::Squeeze_Mutable_Workbuffer));
 }
 
+TEST_F(OperationBufferExtractorTest, CheckLiveMutableBuffersSizesIncludeMutableWorkbuffers) {
+    const ov::nvidia_gpu::OperationBuffersExtractor tensors_only{exec_sequence_};
+    const auto live_tensors_sizes = tensors_only.liveMutableBuffersSizes();
+    const auto live_sizes = extractor_->liveMutableBuffersSizes();
+    ASSERT_EQ(live_sizes.size(), exec_sequence_.size());
+    ASSERT_EQ(live_tensors_sizes.size(), exec_sequence_.size());
+    for (std::size_t i = 0; i < live_sizes.size(); ++i) {
+        // The mutable work buffer of Squeeze is alive only while Squeeze is executed
+        const std::size_t workbuffer_size = i == OpIndex::Squeeze ? 256 : 0;
+        EXPECT_EQ(live_sizes[i], live_tensors_sizes[i] + workbuffer_size) << "at node " << i;
+    }
+}
+
 TEST_F(OperationBufferExtractorTest, CheckImmutableWorkbufferIndices) {
     using ov::nvidia_gpu::WorkbufferRequest;
     using ::testing::ElementsAre;
@@ -306,6 +365,93 @@ TEST_F(OperationBufferExtractorTest, CheckImmutableWorkbufferIndices) {
     ASSERT_THAT(buffer_indices_.immutableIds, ElementsAre(OutputBufferIndex::Squeeze_Imutable_Workbuffer));
 }
 
+TEST_F(OperationBufferExtractorTest, CheckNoExternalBuffersByDefault) {
+    ASSERT_TRUE(extractor_->externalBuffers().empty());
+}
+
+TEST_F(OperationBufferExtractorTest, CheckExternalIoBuffers) {
+    using ::testing::ElementsAre;
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence_, false, false, true};
+
+    const auto& external_buffers = extractor.externalBuffers();
+    ASSERT_EQ(external_buffers.size(), 2);
+    EXPECT_EQ(external_buffers[0].id, OutputBufferIndex::Parameter);
+    EXPECT_EQ(external_buffers[0].node, exec_sequence_.at(OpIndex::Parameter));
+    EXPECT_EQ(external_buffers[0].size, 12);
+    EXPECT_EQ(external_buffers[1].id, OutputBufferIndex::Add_Squeeze_Multiply);
+    EXPECT_EQ(external_buffers[1].node, exec_sequence_.at(OpIndex::Result));
+    EXPECT_EQ(external_buffers[1].size, 12);
+
+    auto buffer_indices = extractor.mutableBuffersIds();
+    std::sort(buffer_indices.begin(), buffer_indices.end());
+    ASSERT_THAT(buffer_indices,
+                ElementsAre(OutputBufferIndex::Multiply, OutputBufferIndex::Add_Bias, OutputBufferIndex::Relu));
+}
+
+TEST_F(OperationBufferExtractorTest, CheckInPlaceOutputsReuseDyingInputs) {
+    using ::testing::ElementsAre;
+    const auto is_in_place = [](const ov::Node& node, size_t) {
+        return ov::is_type<ov::op::v1::Multiply>(&node) || ov::is_type<ov::op::v1::Add>(&node) ||
+               ov::is_type<ov::op::v0::Relu>(&node);
+    };
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence_, false, false, false, is_in_place};
+    const auto outputs = [&](OpIndex::Type op_idx) { return extractor.outputTensorIds(*exec_sequence_.at(op_idx)); };
+
+    // Parameter and constant inputs are never overwritten
+    EXPECT_THAT(outputs(OpIndex::Multiply), ElementsAre(TensorID{OutputBufferIndex::Multiply}));
+    // Output of Multiply is still used by the last Add
+    EXPECT_THAT(outputs(OpIndex::Add_Bias), ElementsAre(TensorID{OutputBufferIndex::Add_Bias}));
+    // Input of Relu dies at it (through Unsqueeze), so does Squeeze output at the last Add
+    EXPECT_THAT(outputs(OpIndex::Relu), ElementsAre(TensorID{OutputBufferIndex::Add_Bias}));
+    EXPECT_THAT(outputs(OpIndex::Add_Squeeze_Multiply), ElementsAre(TensorID{OutputBufferIndex::Add_Bias}));
+
+    auto buffer_indices = extractor.mutableBuffersIds();
+    std::sort(buffer_indices.begin(), buffer_indices.end());
+    ASSERT_THAT(buffer_indices,
+                ElementsAre(OutputBufferIndex::Parameter, OutputBufferIndex::Multiply, OutputBufferIndex::Add_Bias));
+    EXPECT_EQ(extractor.mutableBufferLifespanEnd(OutputBufferIndex::Add_Bias), OpIndex::Result);
+}
+
+TEST_F(OperationBufferExtractorTest, CheckInPlaceOutputsReuseOnlyAllowedInputs) {
+    using ::testing::ElementsAre;
+    const auto is_in_place = [](const ov::Node& node, size_t input_idx) {
+        return ov::is_type<ov::op::v1::Add>(&node) && input_idx == 1;
+    };
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence_, false, false, false, is_in_place};
+    const auto outputs = [&](OpIndex::Type op_idx) { return extractor.outputTensorIds(*exec_sequence_.at(op_idx)); };
+
+    EXPECT_THAT(outputs(OpIndex::Relu), ElementsAre(TensorID{OutputBufferIndex::Relu}));
+    // Squeeze output dies at the last Add as well, but it's the first input of Add
+    EXPECT_THAT(outputs(OpIndex::Add_Squeeze_Multiply), ElementsAre(TensorID{OutputBufferIndex::Multiply}));
+}
+
+TEST(OperationBufferExtractorNamesTest, NodesWithSameNamesHaveOwnTensors) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3});
+    auto relu_0 = std::make_shared<ov::op::v0::Relu>(input);
+    auto relu_1 = std::make_shared<ov::op::v0::Relu>(relu_0);
+    auto add = std::make_shared<ov::op::v1::Add>(relu_0, relu_1);
+    for (const auto& node : ov::NodeVector{input, relu_0, relu_1, add}) {
+        node->set_friendly_name("node");
+    }
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{input});
+    const auto exec_sequence = model->get_ordered_ops();
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence};
+
+    // Tensors are told apart by the nodes, which produce them, rather than by names of the nodes
+    const auto input_id = extractor.outputTensorIds(*input).at(0);
+    const auto relu_0_id = extractor.outputTensorIds(*relu_0).at(0);
+    const auto relu_1_id = extractor.outputTensorIds(*relu_1).at(0);
+    EXPECT_NE(relu_0_id.GetId(), input_id.GetId());
+    EXPECT_NE(relu_1_id.GetId(), relu_0_id.GetId());
+    EXPECT_EQ(extractor.inputTensorIds(*relu_0).at(0).GetId(), input_id.GetId());
+    EXPECT_EQ(extractor.inputTensorIds(*relu_1).at(0).GetId(), relu_0_id.GetId());
+    const auto add_inputs = extractor.inputTensorIds(*add);
+    ASSERT_EQ(add_inputs.size(), 2);
+    EXPECT_EQ(add_inputs[0].GetId(), relu_0_id.GetId());
+    EXPECT_EQ(add_inputs[1].GetId(), relu_1_id.GetId());
+    EXPECT_EQ(extractor.mutableBuffersIds().size(), 4);
+}
+
 class OperationBufferExtractorConcatOptimizedTest : public testing::Test {
     /**
      * Creates a graph with the following structure (left to right):
@@ -579,3 +725,258 @@ TEST_F(OperationBufferExtractorConcatOptimizedV2Test, CheckImmutableBuffersIndic
                             OutputBufferIndex::Constant_Adder_1,
                             OutputBufferIndex::Constant_Reshape_1_Pattern));
 }
+
+TEST(OperationBufferExtractorViewTest, SplitAlongOutermostAxisIsView) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 3});
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, {}, {1});
+    auto split = std::make_shared<ov::op::v1::Split>(input, axis, 2);
+    auto relu_0 = std::make_shared<ov::op::v0::Relu>(split->output(0));
+    auto relu_1 = std::make_shared<ov::op::v0::Relu>(split->output(1));
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{relu_0, relu_1}, ov::ParameterVector{input});
+    const auto exec_sequence = model->get_ordered_ops();
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence};
+
+    ASSERT_TRUE(extractor.isViewNode(*split));
+    const auto input_id = extractor.outputTensorIds(*input).at(0);
+    const auto outputs = extractor.outputTensorIds(*split);
+    ASSERT_EQ(outputs.size(), 2);
+    EXPECT_EQ(outputs[0].GetBuffer().GetId(), input_id.GetId());
+    EXPECT_EQ(outputs[0].GetOffset(), 0);
+    EXPECT_EQ(outputs[1].GetBuffer().GetId(), input_id.GetId());
+    EXPECT_EQ(outputs[1].GetOffset(), 2 * 3 * sizeof(float));
+    // Only Parameter and Relu outputs occupy buffers
+    EXPECT_EQ(extractor.mutableBuffersIds().size(), 3);
+}
+
+TEST(OperationBufferExtractorViewTest, SplitAlongInnerAxisIsNotView) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 4});
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, {}, {1});
+    auto split = std::make_shared<ov::op::v1::Split>(input, axis, 2);
+    auto model = std::make_shared<ov::Model>(split->outputs(), ov::ParameterVector{input});
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{model->get_ordered_ops()};
+
+    ASSERT_FALSE(extractor.isViewNode(*split));
+}
+
+TEST(OperationBufferExtractorViewTest, StridedSliceOfOutermostAxisIsView) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{6, 2});
+    auto begin = ov::op::v0::Constant::create(ov::element::i64, {2}, {-4, 0});
+    auto end = ov::op::v0::Constant::create(ov::element::i64, {2}, {5, 0});
+    const std::vector<int64_t> mask{0, 1};
+    auto slice = std::make_shared<ov::op::v1::StridedSlice>(input, begin, end, mask, mask);
+    auto model = std::make_shared<ov::Model>(slice->outputs(), ov::ParameterVector{input});
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{model->get_ordered_ops()};
+
+    ASSERT_TRUE(extractor.isViewNode(*slice));
+    EXPECT_EQ(extractor.outputTensorIds(*slice).at(0).GetOffset(), 2 * 2 * sizeof(float));
+}
+
+TEST(OperationBufferExtractorViewTest, PadAtEndOfOutermostAxisGrowsInputBuffer) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto pads_begin = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 0, 0});
+    auto pads_end = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 2, 0});
+    auto pad_value = ov::op::v0::Constant::create(ov::element::f32, {}, {0.0f});
+    auto pad = std::make_shared<ov::op::v1::Pad>(relu, pads_begin, pads_end, pad_value, ov::op::PadMode::CONSTANT);
+    auto result = std::make_shared<ov::op::v0::Relu>(pad);
+    auto model = std::make_shared<ov::Model>(result->outputs(), ov::ParameterVector{input});
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{model->get_ordered_ops()};
+
+    ASSERT_TRUE(ov::nvidia_gpu::OperationBuffersExtractor::isTailPadNode(*pad));
+    const auto relu_id = extractor.outputTensorIds(*relu).at(0);
+    const auto pad_id = extractor.outputTensorIds(*pad).at(0);
+    EXPECT_EQ(pad_id.GetBuffer().GetId(), relu_id.GetBuffer().GetId());
+    EXPECT_EQ(pad_id.GetOffset(), 0);
+    EXPECT_EQ(extractor.mutableBufferSize(relu_id.GetBuffer().GetId()), 5 * 2 * sizeof(float));
+}
+
+TEST(OperationBufferExtractorViewTest, PadOfInnerAxisDoesNotGrowInputBuffer) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto pads_begin = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 0, 0});
+    auto pads_end = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 0, 1});
+    auto pad_value = ov::op::v0::Constant::create(ov::element::f32, {}, {0.0f});
+    auto pad = std::make_shared<ov::op::v1::Pad>(relu, pads_begin, pads_end, pad_value, ov::op::PadMode::CONSTANT);
+    auto model = std::make_shared<ov::Model>(pad->outputs(), ov::ParameterVector{input});
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{model->get_ordered_ops()};
+
+    ASSERT_FALSE(ov::nvidia_gpu::OperationBuffersExtractor::isTailPadNode(*pad));
+    EXPECT_NE(extractor.outputTensorIds(*pad).at(0).GetBuffer().GetId(),
+              extractor.outputTensorIds(*relu).at(0).GetBuffer().GetId());
+}
+
+namespace {
+
+std::shared_ptr<ov::op::util::Variable> createVariable() {
+    return std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{2, 3}, ov::element::f32, "state"});
+}
+
+}  // namespace
+
+TEST(OperationBufferExtractorVariableTest, ReadValueOutputIsState) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 3});
+    auto variable = createVariable();
+    auto init = ov::op::v0::Constant::create(ov::element::f32, {2, 3}, std::vector<float>(6, 0.0f));
+    auto read_value = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::op::v1::Add>(read_value, input);
+    auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    auto model = std::make_shared<ov::Model>(
+        ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{input});
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{model->get_ordered_ops()};
+
+    const auto state = extractor.outputTensorIds(*read_value).at(0);
+    EXPECT_EQ(extractor.inputTensorIds(*read_value).back(), state);
+    EXPECT_EQ(extractor.outputTensorIds(*assign).back(), state);
+    const auto& external_buffers = extractor.externalBuffers();
+    ASSERT_EQ(external_buffers.size(), 1);
+    EXPECT_EQ(external_buffers[0].id, state.GetId());
+    EXPECT_EQ(external_buffers[0].variable, "state");
+    EXPECT_EQ(external_buffers[0].size, 6 * sizeof(float));
+    // Add reads the state while writing its output, so Assign copies the output into the state
+    const auto mutable_buffers = extractor.mutableBuffersIds();
+    EXPECT_EQ(std::count(mutable_buffers.begin(), mutable_buffers.end(), state.GetId()), 0);
+    EXPECT_EQ(std::count(mutable_buffers.begin(),
+                         mutable_buffers.end(),
+                         extractor.outputTensorIds(*add).at(0).GetBuffer().GetId()),
+              1);
+}
+
+TEST(OperationBufferExtractorVariableTest, DownloadedReadValueOutputIsNotState) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 3});
+    auto variable = createVariable();
+    auto init = ov::op::v0::Constant::create(ov::element::f32, {2, 3}, std::vector<float>(6, 0.0f));
+    auto read_value = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::op::v1::Add>(read_value, input);
+    auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+    auto result = std::make_shared<ov::op::v0::Result>(read_value);
+    auto model = std::make_shared<ov::Model>(
+        ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{input});
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{model->get_ordered_ops()};
+
+    const auto state = extractor.inputTensorIds(*read_value).back();
+    EXPECT_NE(state, extractor.outputTensorIds(*read_value).at(0));
+    EXPECT_EQ(extractor.outputTensorIds(*assign).back(), state);
+    const auto& external_buffers = extractor.externalBuffers();
+    ASSERT_EQ(external_buffers.size(), 1);
+    EXPECT_EQ(external_buffers[0].id, state.GetId());
+    EXPECT_EQ(external_buffers[0].variable, "state");
+}
+
+TEST(OperationBufferExtractorPackTest, SmallParametersArePackedIntoSingleBuffer) {
+    auto input_0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3});
+    auto input_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{5});
+    auto input_2 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input_1);
+    auto add = std::make_shared<ov::op::v1::Add>(input_0, input_2);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{relu, add},
+                                             ov::ParameterVector{input_0, input_1, input_2});
+    const auto exec_sequence = model->get_ordered_ops();
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence};
+    const auto buffers_count = extractor.mutableBuffersIds().size();
+
+    const auto packed = extractor.packTensors(
+        {{input_0, input_0->output(0)}, {input_1, input_1->output(0)}, {input_2, input_2->output(0)}});
+
+    const auto size_0 = ov::nvidia_gpu::applyAllignment(3 * sizeof(float));
+    const auto size_1 = ov::nvidia_gpu::applyAllignment(5 * sizeof(float));
+    ASSERT_EQ(packed.offsets.size(), 3);
+    EXPECT_EQ(packed.offsets[0].first, input_0);
+    EXPECT_EQ(packed.offsets[0].second, 0);
+    EXPECT_EQ(packed.offsets[1].second, size_0);
+    EXPECT_EQ(packed.offsets[2].second, size_0 + size_1);
+    EXPECT_EQ(packed.size, 2 * size_0 + size_1);
+
+    const auto pack_id = extractor.outputTensorIds(*input_0).at(0).GetBuffer().GetId();
+    for (const auto& [node, offset] : packed.offsets) {
+        const auto tensor = extractor.outputTensorIds(*node).at(0);
+        EXPECT_EQ(tensor.GetBuffer().GetId(), pack_id);
+        EXPECT_EQ(tensor.GetOffset(), offset);
+    }
+    // Buffers of the inputs are replaced by the buffer of the pack
+    EXPECT_EQ(extractor.mutableBuffersIds().size(), buffers_count - 2);
+    EXPECT_EQ(extractor.mutableBufferSize(pack_id), packed.size);
+    // The pack lives until any of its inputs is used
+    const auto index_of = [&](const auto& node) {
+        return std::find(exec_sequence.begin(), exec_sequence.end(), node) - exec_sequence.begin();
+    };
+    EXPECT_EQ(extractor.mutableBufferLifespanEnd(pack_id), std::max(index_of(relu), index_of(add)));
+}
+
+TEST(OperationBufferExtractorPackTest, SingleTensorIsNotPacked) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{input});
+    ov::nvidia_gpu::OperationBuffersExtractor extractor{model->get_ordered_ops()};
+    const auto input_id = extractor.outputTensorIds(*input).at(0);
+
+    const auto packed = extractor.packTensors({{input, input->output(0)}});
+
+    EXPECT_TRUE(packed.offsets.empty());
+    EXPECT_EQ(packed.size, 0);
+    EXPECT_EQ(extractor.outputTensorIds(*input).at(0), input_id);
+    EXPECT_EQ(extractor.outputTensorIds(*input).at(0).GetOffset(), 0);
+}
+
+class OperationBufferExtractorOffloadTest : public testing::Test {
+    /**
+     * Creates a graph with large constants (left to right):
+     * ```
+     * Parameter (Indices) --> Gather --------------------------> Result
+     *                        /
+     *     Constant (Table 128 KiB)
+     *
+     * Parameter --> Add --> Multiply --> Result
+     *              /       /
+     *  Constant (128 KiB)  Constant (256 KiB)
+     * ```
+     */
+    void SetUp() override {
+        auto indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{4});
+        table_ = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{256, 128}, std::vector<float>{1});
+        auto gather = std::make_shared<ov::op::v8::Gather>(
+            table_, indices, ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0}));
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{256, 128});
+        bias_ = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{256, 128}, std::vector<float>{2});
+        scale_ =
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{2, 256, 128}, std::vector<float>{3});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(std::make_shared<ov::op::v1::Add>(input, bias_), scale_);
+        model_ = std::make_shared<ov::Model>(ov::NodeVector{gather, multiply}, ov::ParameterVector{indices, input});
+        exec_sequence_ = model_->get_ordered_ops();
+        extractor_ = std::make_unique<ov::nvidia_gpu::OperationBuffersExtractor>(exec_sequence_);
+    }
+
+protected:
+    static std::size_t byteSize(const std::shared_ptr<ov::op::v0::Constant>& constant) {
+        return constant->get_byte_size();
+    }
+
+    std::size_t residentSize() const {
+        return extractor_->createConstantMemoryModel()->deviceMemoryBlockSize() +
+               extractor_->createMutableMemoryModel()->deviceMemoryBlockSize() + byteSize(bias_) + byteSize(scale_);
+    }
+
+    std::shared_ptr<ov::Model> model_;
+    std::shared_ptr<ov::op::v0::Constant> table_;
+    std::shared_ptr<ov::op::v0::Constant> bias_;
+    std::shared_ptr<ov::op::v0::Constant> scale_;
+    std::vector<std::shared_ptr<ov::Node>> exec_sequence_;
+    std::unique_ptr<ov::nvidia_gpu::OperationBuffersExtractor> extractor_;
+};
+
+TEST_F(OperationBufferExtractorOffloadTest, GatherTableIsOffloadedEvenIfConstantsFit) {
+    ASSERT_EQ(extractor_->offloadedConstantsSize(), 0);
+    extractor_->offloadConstants(std::numeric_limits<std::size_t>::max());
+    ASSERT_EQ(extractor_->offloadedConstantsSize(), byteSize(table_));
+}
+
+TEST_F(OperationBufferExtractorOffloadTest, LargestConstantsAreOffloadedUntilRestFits) {
+    extractor_->offloadConstants(residentSize() - 1);
+    ASSERT_EQ(extractor_->offloadedConstantsSize(), byteSize(table_) + byteSize(scale_));
+    extractor_->offloadConstants(residentSize() - byteSize(scale_) - 1);
+    ASSERT_EQ(extractor_->offloadedConstantsSize(), byteSize(table_) + byteSize(scale_) + byteSize(bias_));
+    // Offloading is recalculated from scratch
+    extractor_->offloadConstants(residentSize());
+    ASSERT_EQ(extractor_->offloadedConstantsSize(), byteSize(table_));
+}
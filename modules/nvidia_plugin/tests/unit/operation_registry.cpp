@@ -7,6 +7,9 @@
 #include <cuda_operation_registry.hpp>
 #include <memory>
 #include <openvino/op/op.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/relu.hpp>
+#include <openvino/op/scatter_nd_update.hpp>
 #include <ops/parameter.hpp>
 #include <typeinfo>
 #include <vector>
@@ -85,3 +88,16 @@ TEST_F(OperationRegistryTest, BuildOperationAndCheckTenorIds_Success) {
     ASSERT_EQ(std::vector<TensorID>(inputIds.begin(), inputIds.end()), dummyInputBufferIds);
     ASSERT_EQ(std::vector<TensorID>(outputIds.begin(), outputIds.end()), dummyOutputBufferIds);
 }
+
+TEST_F(OperationRegistryTest, IsInPlaceOperation_ByTypeNameOfNode) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{4});
+    auto indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{2, 1});
+    auto updates = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto scatter = std::make_shared<ov::op::v3::ScatterNDUpdate>(input, indices, updates);
+    const auto& registry = OperationRegistry::getInstance();
+    ASSERT_TRUE(registry.isInPlaceOperation(*relu, 0));
+    ASSERT_FALSE(registry.isInPlaceOperation(*input, 0));
+    ASSERT_TRUE(registry.isInPlaceOperation(*scatter, 0));
+    ASSERT_FALSE(registry.isInPlaceOperation(*scatter, 2));
+}
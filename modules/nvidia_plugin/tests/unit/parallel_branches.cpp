@@ -0,0 +1,29 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "cuda_parallel_branches.hpp"
+
+using namespace ov::nvidia_gpu;
+
+TEST(ParallelBranchesTest, ConcurrencyEndsOfChain) {
+    const ParallelBranches::Dependencies dependencies{{}, {0}, {1}, {0, 2}};
+    const std::vector<std::size_t> expected{0, 1, 2, 3};
+    ASSERT_EQ(ParallelBranches::concurrencyEnds(dependencies), expected);
+}
+
+TEST(ParallelBranchesTest, ConcurrencyEndsOfBranches) {
+    // 0 forks into branches 1 -> 3 and 2, which are joined by 4
+    const ParallelBranches::Dependencies dependencies{{}, {0}, {0}, {1}, {2, 3}, {4}};
+    const std::vector<std::size_t> expected{0, 2, 3, 3, 4, 5};
+    ASSERT_EQ(ParallelBranches::concurrencyEnds(dependencies), expected);
+}
+
+TEST(ParallelBranchesTest, ConcurrencyEndsOfIndependentOperations) {
+    // Chains 0 -> 2 and 1 -> 3 are joined by 4
+    const ParallelBranches::Dependencies dependencies{{}, {}, {0}, {1}, {2, 3}};
+    const std::vector<std::size_t> expected{3, 2, 3, 3, 4};
+    ASSERT_EQ(ParallelBranches::concurrencyEnds(dependencies), expected);
+}
@@ -98,3 +98,34 @@ TEST_F(ParameterTest, canExecuteAsync) {
     ASSERT_NO_THROW(stream.synchronize());
     ASSERT_EQ(0, memcmp(data.get(), tensor->data(), size));
 }
+
+TEST_F(ParameterTest, uploadsSamplesIntoSlicesOfBatch) {
+    CancellationToken token{};
+    SimpleExecutionDelegator simpleExecutionDelegator{};
+    ov::nvidia_gpu::CudaGraphContext cudaGraphContext{};
+    constexpr size_t numSamples = 4;
+    std::vector<std::vector<std::shared_ptr<ov::Tensor>>> samples(1);
+    for (size_t i = 0; i < numSamples; ++i) {
+        samples[0].push_back(std::make_shared<ov::Tensor>(ov::element::u8, ov::Shape{size / numSamples}));
+        ov::test::utils::fill_tensor_random(*samples[0].back().get());
+    }
+    InferenceRequestContext context{tensors,
+                                    tensors_mapping,
+                                    empty_tensor,
+                                    empty_mapping,
+                                    threadContext,
+                                    token,
+                                    simpleExecutionDelegator,
+                                    cudaGraphContext,
+                                    false,
+                                    nullptr,
+                                    &samples};
+    auto& stream = context.getThreadContext().stream();
+    operation->Execute(context, inputs, outputs, {});
+    auto data = std::make_unique<uint8_t[]>(size);
+    stream.download(data.get(), outputs[0], size);
+    stream.synchronize();
+    for (size_t i = 0; i < numSamples; ++i) {
+        ASSERT_EQ(0, memcmp(data.get() + i * size / numSamples, samples[0][i]->data(), size / numSamples));
+    }
+}
@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <utils/perf_timing.hpp>
+
+using ov::nvidia_gpu::utils::PerformaceTiming;
+
+TEST(PerformaceTimingTest, MeasurementsAreAccumulatedByReusedEvents) {
+    CUDA::Device{}.setCurrent();
+    CUDA::Stream stream{};
+    PerformaceTiming timing;
+    ASSERT_FALSE(timing.elapsed().has_value());
+
+    float accumulated = 0;
+    for (int i = 0; i < 3; ++i) {
+        timing.setStart(stream);
+        timing.setStop(stream);
+        stream.synchronize();
+        const auto elapsed = timing.elapsed();
+        ASSERT_TRUE(elapsed.has_value());
+        accumulated += *elapsed;
+        ASSERT_FLOAT_EQ(timing.measure(), accumulated);
+        // The measurement is forgotten, while its events are kept for the next one
+        ASSERT_FALSE(timing.elapsed().has_value());
+    }
+
+    timing.reset();
+    ASSERT_EQ(timing.duration(), 0);
+    ASSERT_FALSE(timing.elapsed().has_value());
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "cuda_pipeline_stages.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+using namespace ov::nvidia_gpu;
+using Source = PipelineStages::Source;
+
+namespace {
+
+/**
+ * Creates chain of additions of equally sized constants, so every operation has the same weight
+ */
+std::shared_ptr<ov::Model> create_chain_model(std::size_t length) {
+    const ov::Shape shape{1, 64};
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    ov::Output<ov::Node> output = param;
+    for (std::size_t i = 0; i < length; ++i) {
+        auto constant = ov::op::v0::Constant::create(ov::element::f32, shape, std::vector<float>(64, 1.0f));
+        output = std::make_shared<ov::op::v1::Add>(output, constant);
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(output);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+std::size_t count_additions(const ov::Model& model) {
+    std::size_t count = 0;
+    for (const auto& op : model.get_ops()) {
+        count += ov::is_type<ov::op::v1::Add>(op) ? 1 : 0;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(PipelineStagesTest, ChainIsSplitIntoBalancedStages) {
+    const auto partition = PipelineStages::split(create_chain_model(4), 2);
+    ASSERT_EQ(partition.stages.size(), 2);
+    ASSERT_EQ(count_additions(*partition.stages[0].model), 2);
+    ASSERT_EQ(count_additions(*partition.stages[1].model), 2);
+    ASSERT_EQ(partition.stages[0].inputs, (std::vector<Source>{Source{std::nullopt, 0}}));
+    ASSERT_EQ(partition.stages[1].inputs, (std::vector<Source>{Source{0, 0}}));
+    ASSERT_EQ(partition.stages[0].model->get_results().size(), 1);
+    ASSERT_EQ(partition.outputs, (std::vector<Source>{Source{1, 0}}));
+}
+
+TEST(PipelineStagesTest, InputConsumedByLaterStageIsPassedDirectly) {
+    const ov::Shape shape{1, 64};
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto add0 = std::make_shared<ov::op::v1::Add>(param, param);
+    auto add1 = std::make_shared<ov::op::v1::Add>(add0, add0);
+    auto add2 = std::make_shared<ov::op::v1::Add>(add1, param);
+    auto add3 = std::make_shared<ov::op::v1::Add>(add2, add2);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add3)},
+                                             ov::ParameterVector{param});
+    const auto partition = PipelineStages::split(model, 2);
+    ASSERT_EQ(partition.stages[1].inputs, (std::vector<Source>{Source{0, 0}, Source{std::nullopt, 0}}));
+}
+
+TEST(PipelineStagesTest, TooManyStagesThrow) {
+    ASSERT_THROW(PipelineStages::split(create_chain_model(2), 3), ov::Exception);
+}
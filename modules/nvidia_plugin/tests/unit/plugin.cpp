@@ -9,6 +9,7 @@
 #include <ops/parameter.hpp>
 #include <ops/result.hpp>
 #include <random>
+#include <sstream>
 #include <typeinfo>
 
 #include "cuda_compiled_model.hpp"
@@ -52,6 +53,20 @@ TEST_F(PluginTest, CompileModel_OutRangeId_Failed) {
                  ov::Exception);
 }
 
+TEST_F(PluginTest, CompileModel_DeviceUuid_Success) {
+    auto plugin = std::make_shared<Plugin>();
+    const auto uuid = CUDA::Device{0}.uuid();
+    ASSERT_EQ(Configuration::parse_device_id(uuid), 0);
+    ASSERT_EQ(Configuration::parse_device_id("NVIDIA." + uuid), 0);
+    ASSERT_NO_THROW(plugin->compile_model(model_, {{ov::device::id.name(), "NVIDIA." + uuid}}));
+}
+
+TEST_F(PluginTest, CompileModel_UnknownUuid_Failed) {
+    auto plugin = std::make_shared<Plugin>();
+    ASSERT_THROW(plugin->compile_model(model_, {{ov::device::id.name(), "MIG-00000000-0000-0000-0000-000000000000"}}),
+                 ov::Exception);
+}
+
 TEST_F(PluginTest, CompileModel_CudaThreadPool_Success) {
     using namespace std::chrono_literals;
 
@@ -158,3 +173,35 @@ TEST_F(PluginTest, CompileModel_CudaThreadPool_AllJobs_Heavy_Success) {
     ASSERT_EQ(threadContexts.size(), numConcurrentStreams);
     ASSERT_EQ(numHandledJobs, numJobs);
 }
+
+TEST_F(PluginTest, ExportModel_StartsWithVersionAndComputeCapability) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiledModel = plugin->compile_model(model_, {{ov::device::id.name(), "0"}});
+    std::stringstream blob;
+    compiledModel->export_model(blob);
+
+    std::uint32_t header[2] = {};
+    std::int32_t computeCapability[2] = {};
+    blob.read(reinterpret_cast<char*>(header), sizeof(header));
+    blob.read(reinterpret_cast<char*>(computeCapability), sizeof(computeCapability));
+    ASSERT_EQ(header[0], CompiledModel::export_magic);
+    ASSERT_EQ(header[1], CompiledModel::export_version);
+    const auto props = CUDA::Device{0}.props();
+    ASSERT_EQ(computeCapability[0], props.major);
+    ASSERT_EQ(computeCapability[1], props.minor);
+}
+
+TEST_F(PluginTest, ImportModel_OtherVersionOrArchitecture_Failed) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiledModel = plugin->compile_model(model_, {{ov::device::id.name(), "0"}});
+    std::stringstream blob;
+    compiledModel->export_model(blob);
+    const auto exported = blob.str();
+    // Offsets of the version and of the major compute capability in the header
+    for (const std::size_t offset : {sizeof(std::uint32_t), 2 * sizeof(std::uint32_t)}) {
+        auto tampered = exported;
+        tampered[offset] ^= 0x7F;
+        std::istringstream stream{tampered};
+        ASSERT_THROW(plugin->import_model(stream, {{ov::device::id.name(), "0"}}), ov::Exception);
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <openvino/core/type/float16.hpp>
+#include <utils/precision_conversion.hpp>
+#include <vector>
+
+using namespace ov::nvidia_gpu::utils;
+
+namespace {
+
+// Not a multiple of the SIMD width, so the tail is converted as well
+const std::vector<float> kValues{0.0f, 1.0f, -2.5f, 0.1f, 65504.0f, 1e-8f, 3.14159f, -1024.0f, 7.0f, 100000.0f, 0.5f};
+
+ov::Tensor make_f32_tensor(const std::vector<float>& values) {
+    ov::Tensor tensor{ov::element::f32, ov::Shape{values.size()}};
+    std::copy(values.begin(), values.end(), tensor.data<float>());
+    return tensor;
+}
+
+}  // namespace
+
+TEST(PrecisionConversionTest, F16RoundTrip) {
+    const auto src = make_f32_tensor(kValues);
+    ov::Tensor half{ov::element::f16, src.get_shape()};
+    ov::Tensor dst{ov::element::f32, src.get_shape()};
+    convertPrecision(src, half);
+    convertPrecision(half, dst);
+    for (std::size_t i = 0; i < kValues.size(); ++i) {
+        ASSERT_EQ(static_cast<float>(half.data<ov::float16>()[i]), static_cast<float>(ov::float16{kValues[i]}));
+        ASSERT_EQ(dst.data<float>()[i], static_cast<float>(ov::float16{kValues[i]}));
+    }
+    // Values out of the range of f16 are converted to infinities
+    ASSERT_TRUE(std::isinf(dst.data<float>()[9]));
+}
+
+TEST(PrecisionConversionTest, Bf16RoundsToNearestEven) {
+    // 1 + 2^-8 is the tie between 1 and 1 + 2^-7, 1 + 3 * 2^-8 is the tie between 1 + 2^-7 and 1 + 2^-6
+    const auto src = make_f32_tensor({1.0f + std::ldexp(1.0f, -8),
+                                      1.0f + 3 * std::ldexp(1.0f, -8),
+                                      -2.5f,
+                                      std::numeric_limits<float>::quiet_NaN()});
+    ov::Tensor half{ov::element::bf16, src.get_shape()};
+    ov::Tensor dst{ov::element::f32, src.get_shape()};
+    convertPrecision(src, half);
+    convertPrecision(half, dst);
+    ASSERT_EQ(dst.data<float>()[0], 1.0f);
+    ASSERT_EQ(dst.data<float>()[1], 1.0f + std::ldexp(1.0f, -6));
+    ASSERT_EQ(dst.data<float>()[2], -2.5f);
+    ASSERT_TRUE(std::isnan(dst.data<float>()[3]));
+}
+
+TEST(PrecisionConversionTest, UnsupportedConversionIsRejected) {
+    ASSERT_FALSE(isConvertiblePrecision(ov::element::f16, ov::element::bf16));
+    ASSERT_FALSE(isConvertiblePrecision(ov::element::f64, ov::element::f32));
+    const auto src = make_f32_tensor(kValues);
+    ov::Tensor dst{ov::element::i32, src.get_shape()};
+    ASSERT_THROW(convertPrecision(src, dst), ov::Exception);
+}
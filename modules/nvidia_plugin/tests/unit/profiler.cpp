@@ -0,0 +1,42 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "cuda_plugin.hpp"
+#include "nvidia/properties.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "test_networks.hpp"
+
+using namespace ov::nvidia_gpu;
+
+TEST(ProfilerTest, OperationsOfCudaGraphsAreProfiled) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(
+        create_matmul_test_model(),
+        {ov::device::id("0"), ov::enable_profiling(true), ov::nvidia_gpu::use_cuda_graph(true)});
+    // Profiling doesn't disable CUDA graphs
+    ASSERT_GT(compiled_model->get_property(ov::nvidia_gpu::number_of_cuda_graphs.name()).as<size_t>(), 0);
+
+    auto request = compiled_model->create_infer_request();
+    const auto& input = compiled_model->inputs().at(0);
+    ov::Tensor tensor{input.get_element_type(), input.get_shape()};
+    std::fill_n(tensor.data<float>(), tensor.get_size(), 1.0f);
+    request->set_tensor(input, ov::get_tensor_impl(tensor));
+    // The first inference captures the graph, the next ones launch it
+    for (int i = 0; i < 3; ++i) {
+        request->infer();
+        const auto profiling_info = request->get_profiling_info();
+        const auto matmul = std::find_if(profiling_info.begin(), profiling_info.end(), [](const auto& info) {
+            return info.node_type == "MatMul";
+        });
+        ASSERT_NE(matmul, profiling_info.end()) << "inference " << i;
+        ASSERT_EQ(matmul->status, ov::ProfilingInfo::Status::EXECUTED) << "inference " << i;
+        ASSERT_GT(matmul->real_time.count(), 0) << "inference " << i;
+    }
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda/runtime.hpp>
+#include <memory>
+
+#include "cuda_plugin.hpp"
+#include "nvidia/remote_properties.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+void* device_ptr(const ov::SoPtr<ov::IRemoteTensor>& tensor) {
+    return tensor->get_properties().at(ov::nvidia_gpu::device_ptr.name()).as<void*>();
+}
+
+}  // namespace
+
+TEST(RemoteTensorTest, EmptyTensorIsAllocatedByFirstShape) {
+    auto plugin = std::make_shared<Plugin>();
+    auto context = plugin->get_default_context({ov::device::id("0")});
+    auto tensor = context->create_tensor(ov::element::f32, ov::Shape{0}, {});
+    ASSERT_EQ(device_ptr(tensor), nullptr);
+    tensor->set_shape({2, 8});
+    ASSERT_NE(device_ptr(tensor), nullptr);
+    ASSERT_EQ(tensor->get_shape(), (ov::Shape{2, 8}));
+}
+
+TEST(RemoteTensorTest, AllocationKeepsCurrentDevice) {
+    if (CUDA::Device::count() < 2) {
+        GTEST_SKIP() << "Test requires several devices";
+    }
+    auto plugin = std::make_shared<Plugin>();
+    auto context = plugin->get_default_context({ov::device::id("0")});
+    CUDA::Device{1}.setCurrent();
+    auto tensor = context->create_tensor(ov::element::f32, ov::Shape{16}, {});
+    tensor->set_shape({64});
+    ASSERT_EQ(CUDA::Device::currentId(), 1);
+    CUDA::Device{0}.setCurrent();
+}
@@ -117,3 +117,27 @@ TEST_F(ResultTest, canExecuteAsync) {
     ASSERT_NO_THROW(stream.synchronize());
     ASSERT_EQ(0, memcmp(data.get(), tensor->data(), size));
 }
+
+TEST_F(ResultTest, skippedOutputIsNotDownloaded) {
+    CancellationToken token{};
+    SimpleExecutionDelegator simpleExecutionDelegator{};
+    ov::nvidia_gpu::CudaGraphContext cudaGraphContext{};
+    const std::vector<bool> skippedOutputs{true};
+    InferenceRequestContext context{empty_tensor,
+                                    empty_mapping,
+                                    tensors,
+                                    tensors_mapping,
+                                    threadContext,
+                                    token,
+                                    simpleExecutionDelegator,
+                                    cudaGraphContext,
+                                    false,
+                                    &skippedOutputs};
+    auto& stream = context.getThreadContext().stream();
+    const auto expected = std::vector<uint8_t>(tensor->data<uint8_t>(), tensor->data<uint8_t>() + size);
+    const std::vector<uint8_t> zeros(size);
+    stream.upload(inputs[0].as_mutable(), zeros.data(), size);
+    operation->Execute(context, inputs, outputs, {});
+    context.getThreadContext().synchronize();
+    ASSERT_EQ(0, memcmp(expected.data(), tensor->data(), size));
+}
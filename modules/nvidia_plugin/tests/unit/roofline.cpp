@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <utils/roofline.hpp>
+
+using namespace ov::nvidia_gpu::utils;
+
+namespace {
+
+std::shared_ptr<ov::op::v0::Parameter> parameter(const ov::element::Type type, const ov::PartialShape& shape) {
+    return std::make_shared<ov::op::v0::Parameter>(type, shape);
+}
+
+}  // namespace
+
+TEST(RooflineTest, MatMul) {
+    const auto matMul = std::make_shared<ov::op::v0::MatMul>(parameter(ov::element::f32, {64, 128}),
+                                                             parameter(ov::element::f32, {256, 128}),
+                                                             false,
+                                                             true);
+    ASSERT_DOUBLE_EQ(estimateFlops(*matMul), 2.0 * 64 * 128 * 256);
+    ASSERT_DOUBLE_EQ(estimateBytes(*matMul), 4.0 * (64 * 128 + 256 * 128 + 64 * 256));
+}
+
+TEST(RooflineTest, Convolution) {
+    const auto convolution = std::make_shared<ov::op::v1::Convolution>(parameter(ov::element::f16, {1, 8, 16, 16}),
+                                                                       parameter(ov::element::f16, {32, 8, 3, 3}),
+                                                                       ov::Strides{1, 1},
+                                                                       ov::CoordinateDiff{1, 1},
+                                                                       ov::CoordinateDiff{1, 1},
+                                                                       ov::Strides{1, 1});
+    ASSERT_DOUBLE_EQ(estimateFlops(*convolution), 2.0 * (32 * 16 * 16) * (8 * 3 * 3));
+}
+
+TEST(RooflineTest, DataMovement) {
+    const auto transpose = std::make_shared<ov::op::v1::Transpose>(
+        parameter(ov::element::f32, {2, 3, 4}), ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 2, 1}));
+    ASSERT_EQ(estimateFlops(*transpose), 0);
+    ASSERT_DOUBLE_EQ(estimateBytes(*transpose), 4.0 * 24 * 2 + 8.0 * 3);
+    ASSERT_EQ(estimateBytes(*transpose->get_input_node_ptr(1)), 0);
+}
+
+TEST(RooflineTest, DynamicShapes) {
+    const auto relu = std::make_shared<ov::op::v0::Relu>(parameter(ov::element::f32, {-1, 16}));
+    ASSERT_EQ(estimateFlops(*relu), 0);
+    ASSERT_EQ(estimateBytes(*relu), 0);
+}
+
+TEST(RooflineTest, PeakFraction) {
+    cudaDeviceProp props{};
+    props.memoryClockRate = 1000000;
+    props.memoryBusWidth = 256;
+    props.multiProcessorCount = 10;
+    props.major = 7;
+    props.clockRate = 1000000;
+    const DevicePeak peak{props};
+    ASSERT_DOUBLE_EQ(peak.bytesPerSecond, 2.0 * 1e9 * 32);
+    ASSERT_DOUBLE_EQ(peak.flopsPerSecond, 2.0 * 10 * 64 * 1e9);
+    // Memory bound execution taking twice the time of transfers
+    ASSERT_DOUBLE_EQ(peak.fraction(1, peak.bytesPerSecond, 2.0), 0.5);
+    // Compute bound execution at the peak
+    ASSERT_DOUBLE_EQ(peak.fraction(peak.flopsPerSecond, 1, 1.0), 1.0);
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "cuda_plugin.hpp"
+#include "cuda_shape_buckets.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/exp.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+std::shared_ptr<ov::Model> create_model(const ov::PartialShape& shape) {
+    auto param0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto param1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto add = std::make_shared<ov::op::v1::Add>(param0, param1);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param0, param1});
+}
+
+/**
+ * Sum of exponents of biased elements along the given axis, so padding of the axis isn't zero anymore when it's summed
+ */
+std::shared_ptr<ov::Model> create_reduction_model(const ov::PartialShape& shape, std::int64_t axis) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1}, {0.5f});
+    auto exp = std::make_shared<ov::op::v0::Exp>(std::make_shared<ov::op::v1::Add>(param, bias));
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {axis});
+    auto sum = std::make_shared<ov::op::v1::ReduceSum>(exp, axes, false);
+    auto result = std::make_shared<ov::op::v0::Result>(sum);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+}  // namespace
+
+TEST(ShapeBucketsTest, DynamicDimensionsAreRoundedToPowerOfTwo) {
+    ShapeBuckets buckets{create_model({1, -1, 8}), Configuration{}, nullptr, nullptr};
+    ASSERT_EQ(buckets.get_bucket_shapes({{1, 37, 8}, {1, 37, 8}}), (ShapeBuckets::Shapes{{1, 64, 8}, {1, 64, 8}}));
+    ASSERT_EQ(buckets.get_bucket_shapes({{1, 64, 8}, {1, 64, 8}}), (ShapeBuckets::Shapes{{1, 64, 8}, {1, 64, 8}}));
+    ASSERT_EQ(buckets.size(), 0);
+}
+
+TEST(ShapeBucketsTest, BucketIsLimitedByUpperBound) {
+    ShapeBuckets buckets{create_model({1, ov::Dimension{1, 48}}), Configuration{}, nullptr, nullptr};
+    ASSERT_EQ(buckets.get_bucket_shapes({{1, 37}, {1, 37}}), (ShapeBuckets::Shapes{{1, 48}, {1, 48}}));
+    ASSERT_EQ(buckets.get_bucket_shapes({{1, 5}, {1, 5}}), (ShapeBuckets::Shapes{{1, 8}, {1, 8}}));
+}
+
+TEST(ShapeBucketsTest, OutputShapesAreInferredForActualInputs) {
+    ShapeBuckets buckets{create_model({-1, -1}), Configuration{}, nullptr, nullptr};
+    const auto& output_shapes = buckets.get_output_shapes({{3, 5}, {3, 5}});
+    ASSERT_EQ(output_shapes, (ShapeBuckets::Shapes{{3, 5}}));
+}
+
+TEST(ShapeBucketsTest, IncompatibleShapeThrows) {
+    ShapeBuckets buckets{create_model({1, -1, 8}), Configuration{}, nullptr, nullptr};
+    ASSERT_THROW(buckets.get_bucket_shapes({{1, 37, 4}, {1, 37, 8}}), ov::Exception);
+}
+
+TEST(ShapeBucketsTest, ReductionAlongPaddedAxisIsRejected) {
+    ASSERT_THROW((ShapeBuckets{create_reduction_model({1, -1, 8}, 1), Configuration{}, nullptr, nullptr}),
+                 ov::Exception);
+    ASSERT_THROW((ShapeBuckets{create_reduction_model({1, -1, 8}, -2), Configuration{}, nullptr, nullptr}),
+                 ov::Exception);
+}
+
+TEST(ShapeBucketsTest, SoftmaxAlongPaddedAxisIsRejected) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, -1});
+    auto softmax = std::make_shared<ov::op::v8::Softmax>(param, -1);
+    auto result = std::make_shared<ov::op::v0::Result>(softmax);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    ASSERT_THROW((ShapeBuckets{model, Configuration{}, nullptr, nullptr}), ov::Exception);
+}
+
+TEST(ShapeBucketsTest, ReductionAlongStaticAxisOfPaddedInputMatchesReference) {
+    const ov::Shape shape{1, 37, 8};
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(create_reduction_model({1, -1, 8}, 2), {ov::device::id("0")});
+    auto request = compiled_model->create_infer_request();
+    ov::Tensor input{ov::element::f32, shape};
+    for (std::size_t i = 0; i < input.get_size(); ++i) {
+        input.data<float>()[i] = static_cast<float>(i % 5) * 0.25f - 0.5f;
+    }
+    request->set_tensor(compiled_model->inputs().at(0), ov::get_tensor_impl(input));
+    request->infer();
+    const auto output = request->get_tensor(compiled_model->outputs().at(0));
+    ASSERT_EQ(output->get_shape(), (ov::Shape{1, 37}));
+    const auto* data = static_cast<const float*>(output->data());
+    for (std::size_t row = 0; row < shape[1]; ++row) {
+        float expected = 0.0f;
+        for (std::size_t i = 0; i < shape[2]; ++i) {
+            expected += std::exp(input.data<float>()[row * shape[2] + i] + 0.5f);
+        }
+        ASSERT_NEAR(data[row], expected, 1e-4f * expected) << "at row " << row;
+    }
+}
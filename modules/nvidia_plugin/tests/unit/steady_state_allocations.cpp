@@ -0,0 +1,125 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cuda_chrome_trace.hpp>
+#include <cuda_graph_topology_runner.hpp>
+#include <cuda_simple_execution_delegator.hpp>
+#include <memory_manager/cuda_memory_pool.hpp>
+#include <new>
+#include <ops/parameter.hpp>
+#include <ops/result.hpp>
+
+#include "test_networks.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+// Allocations of the test thread are counted only within AllocationCounter scopes
+std::atomic<std::size_t> numAllocations{0};
+thread_local bool countAllocations = false;
+
+class AllocationCounter {
+public:
+    AllocationCounter() : start_{numAllocations.load()} { countAllocations = true; }
+    ~AllocationCounter() { countAllocations = false; }
+
+    std::size_t count() const { return numAllocations.load() - start_; }
+
+private:
+    std::size_t start_;
+};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (countAllocations) {
+        numAllocations.fetch_add(1);
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+class SteadyStateAllocationsTest : public testing::Test {
+protected:
+    static std::map<std::string, std::size_t> PopulateInputIndices(std::shared_ptr<ov::Model> model) {
+        std::map<std::string, std::size_t> inputIndices;
+        for (const auto& parameter : model->get_parameters()) {
+            inputIndices.emplace(ParameterOp::GetInputTensorName(*parameter), model->get_parameter_index(parameter));
+        }
+        return inputIndices;
+    }
+
+    static std::map<std::string, std::size_t> PopulateOutputIndices(std::shared_ptr<ov::Model> model) {
+        std::map<std::string, std::size_t> outputIndices;
+        for (auto& result : model->get_results()) {
+            const auto& result_index = model->get_result_index(result->input_value(0));
+            for (const auto& outputName : ResultOp::GetOutputTensorName(*result)) {
+                outputIndices.emplace(outputName, result_index);
+            }
+        }
+        return outputIndices;
+    }
+
+    static std::vector<std::shared_ptr<ov::Tensor>> PopulateTensors(const std::vector<ov::Output<ov::Node>>& nodes) {
+        std::vector<std::shared_ptr<ov::Tensor>> ret;
+        for (const auto& node : nodes)
+            ret.push_back(std::make_shared<ov::Tensor>(node.get_element_type(), node.get_shape()));
+        return ret;
+    }
+
+    void Infer(DeviceMemBlock& memoryBlock) {
+        InferenceRequestContext context{inputTensors_,
+                                        inputIndices_,
+                                        outputTensors_,
+                                        outputIndices_,
+                                        threadContext_,
+                                        cancellationToken_,
+                                        simpleExecutionDelegator_,
+                                        memoryBlock.cudaGraphContext(),
+                                        false};
+        runner_.UpdateContext(context, memoryBlock);
+        runner_.Run(context, memoryBlock);
+    }
+
+    std::shared_ptr<ov::Model> model_{create_matmul_test_model()};
+    CreationContext creationContext_{{}, false};
+    ThreadContext threadContext_{{}};
+    CancellationToken cancellationToken_{};
+    CudaGraphTopologyRunner runner_{creationContext_, model_};
+    SimpleExecutionDelegator simpleExecutionDelegator_{};
+    std::vector<std::shared_ptr<ov::Tensor>> inputTensors_{PopulateTensors(model_->inputs())};
+    std::vector<std::shared_ptr<ov::Tensor>> outputTensors_{PopulateTensors(model_->outputs())};
+    std::map<std::string, std::size_t> inputIndices_{PopulateInputIndices(model_)};
+    std::map<std::string, std::size_t> outputIndices_{PopulateOutputIndices(model_)};
+};
+
+TEST_F(SteadyStateAllocationsTest, InferenceDoesNotAllocateAfterWarmUp) {
+    const auto memoryModel = runner_.GetSubGraph().memoryManager()->mutableTensorsMemoryModel();
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel);
+    {
+        auto proxy = memoryPool->WaitAndGet(cancellationToken_);
+        Infer(proxy.Get());
+    }
+    threadContext_.stream().synchronize();
+
+    AllocationCounter counter;
+    for (int i = 0; i < 100; ++i) {
+        ChromeTrace::Scope scope{nullptr, "memory pool wait", {}};
+        auto proxy = memoryPool->WaitAndGet(cancellationToken_);
+        Infer(proxy.Get());
+    }
+    ASSERT_EQ(counter.count(), 0);
+    threadContext_.stream().synchronize();
+}
@@ -0,0 +1,146 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "cuda_plugin.hpp"
+#include "nvidia/properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/tensor_iterator.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+constexpr std::size_t kIterations = 5;
+constexpr std::size_t kManyIterations = 4096;
+constexpr std::size_t kChannels = 4;
+
+/**
+ * Creates TensorIterator computing h[i] = (x[i] + h[i - 1]) * w, which has the sliced input x and the concatenated
+ * output h along an outermost axis, the invariant input w and the back edge h, so that all of them are bound to
+ * the body in place
+ */
+std::shared_ptr<ov::Model> create_tensor_iterator_model(const std::size_t iterations = kIterations) {
+    const ov::Shape slice_shape{1, 1, kChannels};
+    auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, iterations, kChannels});
+    auto h = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, slice_shape);
+    auto w = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, slice_shape);
+
+    auto body_x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, slice_shape);
+    auto body_h = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, slice_shape);
+    auto body_w = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, slice_shape);
+    auto next_h = std::make_shared<ov::op::v1::Multiply>(std::make_shared<ov::op::v1::Add>(body_x, body_h), body_w);
+    auto body_result = std::make_shared<ov::op::v0::Result>(next_h);
+    auto body = std::make_shared<ov::Model>(ov::ResultVector{body_result}, ov::ParameterVector{body_x, body_h, body_w});
+
+    auto tensor_iterator = std::make_shared<ov::op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(body_x, x, 0, 1, 1, -1, 1);
+    tensor_iterator->set_merged_input(body_h, h, body_result);
+    tensor_iterator->set_invariant_input(body_w, w);
+    auto all_h = tensor_iterator->get_concatenated_slices(body_result, 0, 1, 1, -1, 1);
+    auto last_h = tensor_iterator->get_iter_value(body_result, -1);
+    return std::make_shared<ov::Model>(ov::OutputVector{all_h, last_h}, ov::ParameterVector{x, h, w}, "TensorIterator");
+}
+
+ov::Tensor make_tensor(const ov::Shape& shape, float start, float step) {
+    ov::Tensor tensor{ov::element::f32, shape};
+    auto* data = tensor.data<float>();
+    for (std::size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = start + step * i;
+    }
+    return tensor;
+}
+
+/**
+ * Checks outputs of the model of create_tensor_iterator_model() against the recurrence computed on the host
+ */
+void check_outputs(ov::IAsyncInferRequest& request,
+                   const ov::ICompiledModel& compiled_model,
+                   const ov::Tensor& x,
+                   const ov::Tensor& h,
+                   const ov::Tensor& w) {
+    const auto iterations = x.get_shape().at(1);
+    const auto all_h = request.get_tensor(compiled_model.outputs().at(0));
+    const auto last_h = request.get_tensor(compiled_model.outputs().at(1));
+    const auto* all_h_data = static_cast<const float*>(all_h->data());
+    const auto* last_h_data = static_cast<const float*>(last_h->data());
+    std::vector<float> state(h.data<float>(), h.data<float>() + kChannels);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t c = 0; c < kChannels; ++c) {
+            state[c] = (x.data<float>()[i * kChannels + c] + state[c]) * w.data<float>()[c];
+            ASSERT_FLOAT_EQ(all_h_data[i * kChannels + c], state[c]) << "iteration " << i << ", channel " << c;
+        }
+    }
+    for (std::size_t c = 0; c < kChannels; ++c) {
+        ASSERT_FLOAT_EQ(last_h_data[c], state[c]) << "channel " << c;
+    }
+}
+
+class TensorIteratorTest : public testing::TestWithParam<bool> {};
+
+}  // namespace
+
+TEST_P(TensorIteratorTest, BodyBuffersBoundInPlace) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(create_tensor_iterator_model(),
+                                                {ov::device::id("0"), ov::nvidia_gpu::use_cuda_graph(GetParam())});
+    auto request = compiled_model->create_infer_request();
+    const auto x = make_tensor({1, kIterations, kChannels}, -2.0f, 0.25f);
+    const auto h = make_tensor({1, 1, kChannels}, 1.0f, -0.5f);
+    const auto w = make_tensor({1, 1, kChannels}, 0.5f, 0.25f);
+    const auto& inputs = compiled_model->inputs();
+    request->set_tensor(inputs.at(0), ov::get_tensor_impl(x));
+    request->set_tensor(inputs.at(1), ov::get_tensor_impl(h));
+    request->set_tensor(inputs.at(2), ov::get_tensor_impl(w));
+
+    // Buffers of back edges are alternated, so several inferences check that they restart from the initial state
+    for (int inference = 0; inference < 3; ++inference) {
+        request->infer();
+        check_outputs(*request, *compiled_model, x, h, w);
+    }
+}
+
+TEST(TensorIteratorGraphTest, ManyIterationsCapturedByConcurrentRequests) {
+    auto plugin = std::make_shared<Plugin>();
+    auto compiled_model = plugin->compile_model(create_tensor_iterator_model(kManyIterations),
+                                                {ov::device::id("0"),
+                                                 ov::nvidia_gpu::use_cuda_graph(true),
+                                                 ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                                 ov::hint::num_requests(4)});
+    const auto x = make_tensor({1, kManyIterations, kChannels}, -2.0f, 1.0f / kManyIterations);
+    const auto h = make_tensor({1, 1, kChannels}, 1.0f, -0.5f);
+    const auto w = make_tensor({1, 1, kChannels}, 0.5f, 0.125f);
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    for (int i = 0; i < 4; ++i) {
+        auto request = compiled_model->create_infer_request();
+        const auto& inputs = compiled_model->inputs();
+        request->set_tensor(inputs.at(0), ov::get_tensor_impl(x));
+        request->set_tensor(inputs.at(1), ov::get_tensor_impl(h));
+        request->set_tensor(inputs.at(2), ov::get_tensor_impl(w));
+        requests.push_back(std::move(request));
+    }
+    // Requests capture their graphs concurrently on the first inference, which must neither hang nor mix bodies
+    for (int inference = 0; inference < 2; ++inference) {
+        for (const auto& request : requests) {
+            request->start_async();
+        }
+        for (const auto& request : requests) {
+            ASSERT_TRUE(request->wait_for(std::chrono::minutes{1})) << "inference " << inference;
+            check_outputs(*request, *compiled_model, x, h, w);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TensorIteratorTest, TensorIteratorTest, testing::Bool());
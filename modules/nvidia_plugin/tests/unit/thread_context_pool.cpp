@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_thread_context_pool.hpp>
+
+using namespace ov::nvidia_gpu;
+
+TEST(ThreadContextPoolTest, ReleasedContextIsReused) {
+    auto pool = std::make_shared<ThreadContextPool>(CUDA::Device{});
+    const ThreadContext* first = nullptr;
+    {
+        const auto lease = pool->acquire();
+        first = &lease.get();
+    }
+    const auto lease = pool->acquire();
+    ASSERT_EQ(&lease.get(), first);
+    ASSERT_EQ(pool->size(), 1);
+}
+
+TEST(ThreadContextPoolTest, ConcurrentLeasesHaveDifferentContexts) {
+    auto pool = std::make_shared<ThreadContextPool>(CUDA::Device{});
+    const auto lease0 = pool->acquire();
+    const auto lease1 = pool->acquire();
+    ASSERT_NE(&lease0.get(), &lease1.get());
+    ASSERT_NE(lease0.get().stream().get(), lease1.get().stream().get());
+    ASSERT_EQ(pool->size(), 2);
+}
+
+TEST(ThreadContextPoolTest, HighPriorityContextsAreKeptApart) {
+    auto pool = std::make_shared<ThreadContextPool>(CUDA::Device{});
+    const ThreadContext* normal = nullptr;
+    {
+        const auto lease = pool->acquire();
+        normal = &lease.get();
+    }
+    const auto lease = pool->acquire(true);
+    ASSERT_NE(&lease.get(), normal);
+}
+
+TEST(ThreadContextPoolTest, PoolIsSharedByDevice) {
+    const auto pool = ThreadContextPool::forDevice(CUDA::Device{});
+    ASSERT_EQ(ThreadContextPool::forDevice(CUDA::Device{}), pool);
+}
+
+TEST(ThreadContextPoolTest, PartitionContextsWorkInGreenContext) {
+    if (!CUDA::GreenContext::isSupported()) {
+        GTEST_SKIP() << "Green contexts aren't supported by the driver";
+    }
+    const CUDA::Device device{};
+    const auto partition = CUDA::GreenContext::reserve(device, 1);
+    ASSERT_GE(partition->smCount(), 1u);
+    ASSERT_LT(partition->smCount(), static_cast<unsigned>(device.props().multiProcessorCount));
+    ASSERT_EQ(CUDA::GreenContext::reserve(device, 1), partition);
+
+    auto pool = std::make_shared<ThreadContextPool>(device, partition);
+    const auto lease = pool->acquire();
+    const auto& stream = lease.get().stream();
+    auto buffer = stream.malloc(sizeof(int));
+    const int value = 42;
+    int result = 0;
+    stream.upload(buffer, &value, sizeof(value));
+    stream.download(&result, buffer, sizeof(result));
+    stream.synchronize();
+    device.setCurrent();
+    ASSERT_EQ(result, value);
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_thread_pool.hpp>
+#include <future>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+int streamPriority(const CUDA::Stream& stream) {
+    int priority = 0;
+    throwIfError(cudaStreamGetPriority(stream.get(), &priority));
+    return priority;
+}
+
+/**
+ * @returns Priorities of the compute, upload and download streams of the context of a task of the given priority
+ */
+std::vector<int> taskStreamPriorities(CudaThreadPool& pool, ov::hint::Priority priority) {
+    std::promise<std::vector<int>> priorities;
+    pool.run(
+        [&] {
+            const auto& context = pool.get_thread_context();
+            priorities.set_value({streamPriority(context.stream()),
+                                  streamPriority(context.uploadStream()),
+                                  streamPriority(context.downloadStream())});
+        },
+        priority);
+    return priorities.get_future().get();
+}
+
+}  // namespace
+
+TEST(CudaThreadPoolTest, HighPriorityTaskRunsOnGreatestPriorityStreams) {
+    int leastPriority = 0;
+    int greatestPriority = 0;
+    throwIfError(cudaDeviceGetStreamPriorityRange(&leastPriority, &greatestPriority));
+    CudaThreadPool pool{CUDA::Device{}, 1};
+    ASSERT_EQ(taskStreamPriorities(pool, ov::hint::Priority::HIGH), std::vector<int>(3, greatestPriority));
+}
+
+TEST(CudaThreadPoolTest, MediumAndLowPriorityTasksRunOnDefaultPriorityStreams) {
+    CudaThreadPool pool{CUDA::Device{}, 1};
+    // High priority context of the thread isn't reused by tasks of lower priority
+    taskStreamPriorities(pool, ov::hint::Priority::HIGH);
+    ASSERT_EQ(taskStreamPriorities(pool, ov::hint::Priority::MEDIUM), std::vector<int>(3, 0));
+    ASSERT_EQ(taskStreamPriorities(pool, ov::hint::Priority::LOW), std::vector<int>(3, 0));
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "cuda_tiles.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+std::shared_ptr<ov::op::v0::Parameter> create_image() {
+    return std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 4, -1, -1});
+}
+
+std::shared_ptr<ov::Node> create_conv(const ov::Output<ov::Node>& input, std::size_t stride) {
+    auto weights =
+        ov::op::v0::Constant::create(ov::element::f32, ov::Shape{4, 4, 3, 3}, std::vector<float>(4 * 4 * 3 * 3, 1.0f));
+    return std::make_shared<ov::op::v1::Convolution>(input,
+                                                     weights,
+                                                     ov::Strides{stride, stride},
+                                                     ov::CoordinateDiff{1, 1},
+                                                     ov::CoordinateDiff{1, 1},
+                                                     ov::Strides{1, 1});
+}
+
+std::shared_ptr<ov::Model> create_model(const ov::OutputVector& outputs,
+                                        const std::shared_ptr<ov::op::v0::Parameter>& image) {
+    ov::ResultVector results;
+    for (const auto& output : outputs) {
+        results.push_back(std::make_shared<ov::op::v0::Result>(output));
+    }
+    return std::make_shared<ov::Model>(results, ov::ParameterVector{image});
+}
+
+}  // namespace
+
+TEST(TilesTest, HaloGrowsWithConvolutions) {
+    auto image = create_image();
+    auto conv0 = create_conv(image, 1);
+    auto relu = std::make_shared<ov::op::v0::Relu>(conv0);
+    auto conv1 = create_conv(relu, 2);
+    const auto geometry = Tiles::analyze(*create_model({conv0, conv1}, image));
+    // The first convolution reads 1 pixel around, the second one reads 1 pixel before its input pixels of stride 1
+    ASSERT_EQ(geometry.halo, 2u);
+    ASSERT_EQ(geometry.output_strides, (std::vector<std::size_t>{1, 2}));
+}
+
+TEST(TilesTest, PoolingWithoutOverlapKeepsHalo) {
+    auto image = create_image();
+    auto conv = create_conv(image, 1);
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1, 1}, std::vector<float>(4, 1.0f));
+    auto add = std::make_shared<ov::op::v1::Add>(conv, bias);
+    auto pool = std::make_shared<ov::op::v1::MaxPool>(
+        add, ov::Strides{2, 2}, ov::Shape{0, 0}, ov::Shape{0, 0}, ov::Shape{2, 2});
+    const auto geometry = Tiles::analyze(*create_model({pool}, image));
+    ASSERT_EQ(geometry.halo, 1u);
+    ASSERT_EQ(geometry.output_strides, (std::vector<std::size_t>{2}));
+}
+
+TEST(TilesTest, OperandVaryingOverPixelsIsRejected) {
+    auto image = create_image();
+    auto mask = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 8}, std::vector<float>(8, 1.0f));
+    auto add = std::make_shared<ov::op::v1::Add>(image, mask);
+    ASSERT_THROW(Tiles::analyze(*create_model({add}, image)), ov::Exception);
+}
+
+TEST(TilesTest, ReshapeOfImageIsRejected) {
+    auto image = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {4, 64});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(image, shape, false);
+    ASSERT_THROW(Tiles::analyze(*create_model({reshape}, image)), ov::Exception);
+}
+
+TEST(TilesTest, TilesCoverDimensionWithinBorders) {
+    const auto spans = Tiles::split(10, 6, 1);
+    ASSERT_EQ(spans.size(), 3u);
+    // The first tile is at the border, its core begins at the border
+    ASSERT_EQ(spans[0].origin, 0u);
+    ASSERT_EQ(spans[0].begin, 0u);
+    ASSERT_EQ(spans[0].end, 4u);
+    ASSERT_EQ(spans[1].origin, 3u);
+    ASSERT_EQ(spans[1].begin, 4u);
+    ASSERT_EQ(spans[1].end, 8u);
+    // The last tile is shifted inside of the dimension
+    ASSERT_EQ(spans[2].origin, 4u);
+    ASSERT_EQ(spans[2].begin, 8u);
+    ASSERT_EQ(spans[2].end, 10u);
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_topology_hash.hpp>
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+std::shared_ptr<ov::Model> createModel(float weight, const ov::Shape& shape = {1, 8}) {
+    auto parameter = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto constant =
+        ov::op::v0::Constant::create(ov::element::f32, shape, std::vector<float>(ov::shape_size(shape), weight));
+    auto add = std::make_shared<ov::op::v1::Add>(parameter, constant);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter});
+}
+
+}  // namespace
+
+TEST(TopologyHash, DoesNotDependOnWeights) {
+    ASSERT_EQ(topologyHash(*createModel(1.0f)), topologyHash(*createModel(2.0f)));
+}
+
+TEST(TopologyHash, DependsOnShapes) {
+    ASSERT_NE(topologyHash(*createModel(1.0f)), topologyHash(*createModel(1.0f, {1, 16})));
+}
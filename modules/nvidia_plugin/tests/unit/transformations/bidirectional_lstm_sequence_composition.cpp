@@ -11,10 +11,13 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/gru_sequence.hpp"
 #include "openvino/op/split.hpp"
+#include "openvino/op/squeeze.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/init_node_info.hpp"
 #include "transformations/utils/utils.hpp"
+#include "transformer/nodes/gru_sequence_stack.hpp"
 #include "transformer/nodes/lstm_sequence_optimized.hpp"
 
 using ov::nvidia_gpu::nodes::LSTMSequenceOptimized;
@@ -746,4 +749,136 @@ TEST(bidirectional_lstm_sequence_composition, LSTMSequence_compose_no_tranpose)
     auto res = compare_functions(model, model_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(bidirectional_lstm_sequence_composition, GRUSequence_compose_no_tranpose) {
+    shared_ptr<ov::Model> model, model_ref;
+    InputParameters params;
+    params.activations = {"sigmoid", "tanh"};
+    {
+        auto inputs = get_inputs(params);
+        auto constants = get_constants(params, 3);
+        auto axis_0 = op::v0::Constant::create(element::i64, Shape{}, {0});
+        auto axis_1 = op::v0::Constant::create(element::i64, Shape{}, {1});
+        auto H_split = std::make_shared<op::v1::Split>(inputs.H, axis_1, 2);
+        auto W_split = std::make_shared<op::v1::Split>(constants.W, axis_0, 2);
+        auto R_split = std::make_shared<op::v1::Split>(constants.R, axis_0, 2);
+        auto B_split = std::make_shared<op::v1::Split>(constants.B, axis_0, 2);
+
+        auto gru_seq_forward = std::make_shared<ov::op::v5::GRUSequence>(inputs.X,
+                                                                         H_split->output(0),
+                                                                         constants.S,
+                                                                         W_split->output(0),
+                                                                         R_split->output(0),
+                                                                         B_split->output(0),
+                                                                         params.hidden_size,
+                                                                         op::RecurrentSequenceDirection::FORWARD);
+        auto gru_seq_reverse = std::make_shared<ov::op::v5::GRUSequence>(inputs.X,
+                                                                         H_split->output(1),
+                                                                         constants.S,
+                                                                         W_split->output(1),
+                                                                         R_split->output(1),
+                                                                         B_split->output(1),
+                                                                         params.hidden_size,
+                                                                         op::RecurrentSequenceDirection::REVERSE);
+
+        auto concat_0 =
+            std::make_shared<op::v0::Concat>(OutputVector{gru_seq_forward->output(0), gru_seq_reverse->output(0)}, 1);
+        auto concat_1 =
+            std::make_shared<op::v0::Concat>(OutputVector{gru_seq_forward->output(1), gru_seq_reverse->output(1)}, 1);
+
+        model = std::make_shared<Model>(OutputVector{concat_0, concat_1}, ParameterVector{inputs.X, inputs.H});
+    }
+
+    {
+        auto inputs = get_inputs(params);
+        auto constants = get_constants(params, 3);
+        auto gru_seq = std::make_shared<ov::op::v5::GRUSequence>(inputs.X,
+                                                                 inputs.H,
+                                                                 constants.S,
+                                                                 constants.W,
+                                                                 constants.R,
+                                                                 constants.B,
+                                                                 params.hidden_size,
+                                                                 op::RecurrentSequenceDirection::BIDIRECTIONAL);
+        model_ref = std::make_shared<Model>(OutputVector{gru_seq->output(0), gru_seq->output(1)},
+                                            ParameterVector{inputs.X, inputs.H});
+    }
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::BidirectionalSequenceComposition>();
+    pass_manager.run_passes(model);
+    ASSERT_NO_THROW(check_rt_info(model));
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(bidirectional_lstm_sequence_composition, GRUSequence_stack) {
+    shared_ptr<ov::Model> model, model_ref;
+    InputParameters params;
+    params.seq_length = 10;
+    params.input_size = 16;
+    params.hidden_size = 32;
+    params.direction = ov::op::RecurrentSequenceDirection::FORWARD;
+    InputParameters upper_params = params;
+    upper_params.input_size = params.hidden_size;
+    auto create_inputs = [&] {
+        auto inputs = get_inputs(params);
+        auto H1 = std::make_shared<op::v0::Parameter>(element::f32, Shape{params.batch_size, 1, params.hidden_size});
+        return std::make_pair(inputs, H1);
+    };
+    {
+        auto [inputs, H1] = create_inputs();
+        auto constants_0 = get_constants(params, 3);
+        auto constants_1 = get_constants(upper_params, 3);
+        auto gru_seq_0 = std::make_shared<ov::op::v5::GRUSequence>(inputs.X,
+                                                                   inputs.H,
+                                                                   constants_0.S,
+                                                                   constants_0.W,
+                                                                   constants_0.R,
+                                                                   constants_0.B,
+                                                                   params.hidden_size,
+                                                                   params.direction);
+        auto squeeze = std::make_shared<op::v0::Squeeze>(gru_seq_0->output(0),
+                                                         op::v0::Constant::create(element::i64, Shape{1}, {1}));
+        auto gru_seq_1 = std::make_shared<ov::op::v5::GRUSequence>(squeeze,
+                                                                   H1,
+                                                                   constants_0.S,
+                                                                   constants_1.W,
+                                                                   constants_1.R,
+                                                                   constants_1.B,
+                                                                   params.hidden_size,
+                                                                   params.direction);
+        model = std::make_shared<Model>(OutputVector{gru_seq_1->output(0), gru_seq_0->output(1), gru_seq_1->output(1)},
+                                        ParameterVector{inputs.X, inputs.H, H1});
+    }
+
+    {
+        auto [inputs, H1] = create_inputs();
+        auto constants_0 = get_constants(params, 3);
+        auto constants_1 = get_constants(upper_params, 3);
+        auto H = std::make_shared<op::v0::Concat>(OutputVector{inputs.H, H1}, 1);
+        auto stack = std::make_shared<nvidia_gpu::nodes::GRUSequenceStack>(OutputVector{inputs.X,
+                                                                                        H,
+                                                                                        constants_0.S,
+                                                                                        constants_0.W,
+                                                                                        constants_0.R,
+                                                                                        constants_0.B,
+                                                                                        constants_1.W,
+                                                                                        constants_1.R,
+                                                                                        constants_1.B},
+                                                                           params.hidden_size,
+                                                                           false);
+        auto H_split = std::make_shared<op::v1::Split>(
+            stack->output(1), op::v0::Constant::create(element::i64, Shape{}, {1}), 2);
+        model_ref = std::make_shared<Model>(OutputVector{stack->output(0), H_split->output(0), H_split->output(1)},
+                                            ParameterVector{inputs.X, inputs.H, H1});
+    }
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::BidirectionalSequenceComposition>();
+    pass_manager.run_passes(model);
+    ASSERT_NO_THROW(check_rt_info(model));
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
 }  // namespace testing
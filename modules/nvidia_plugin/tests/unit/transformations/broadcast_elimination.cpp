@@ -0,0 +1,68 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/broadcast_elimination.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "transformation_test_utils.hpp"
+
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+TEST(broadcast_elimination, broadcast_to_eltwise_is_removed) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 8, 16});
+    auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{16});
+    auto target_shape = op::v0::Constant::create(element::i64, Shape{3}, {2, 8, 16});
+    auto broadcast = make_shared<op::v3::Broadcast>(bias, target_shape);
+    auto add = make_shared<op::v1::Add>(input, broadcast);
+    auto model = make_shared<Model>(add, ParameterVector{input, bias});
+
+    run_transformation<nvidia_gpu::pass::BroadcastElimination>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v3::Broadcast>(model), 0);
+    ASSERT_EQ(add->get_input_node_shared_ptr(1), bias);
+    ASSERT_EQ(add->get_output_shape(0), (Shape{2, 8, 16}));
+}
+
+TEST(broadcast_elimination, broadcast_defining_output_shape_is_kept) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16});
+    auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{16});
+    auto target_shape = op::v0::Constant::create(element::i64, Shape{2}, {4, 16});
+    auto broadcast = make_shared<op::v3::Broadcast>(bias, target_shape);
+    auto multiply = make_shared<op::v1::Multiply>(input, broadcast);
+    auto model = make_shared<Model>(multiply, ParameterVector{input, bias});
+
+    run_transformation<nvidia_gpu::pass::BroadcastElimination>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v3::Broadcast>(model), 1);
+}
+
+TEST(broadcast_elimination, broadcast_with_other_consumers_is_kept) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{4, 16});
+    auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16});
+    auto target_shape = op::v0::Constant::create(element::i64, Shape{2}, {4, 16});
+    auto broadcast = make_shared<op::v3::Broadcast>(bias, target_shape);
+    auto add = make_shared<op::v1::Add>(input, broadcast);
+    auto relu = make_shared<op::v0::Relu>(broadcast);
+    auto model = make_shared<Model>(OutputVector{add, relu}, ParameterVector{input, bias});
+
+    run_transformation<nvidia_gpu::pass::BroadcastElimination>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v3::Broadcast>(model), 1);
+    ASSERT_EQ(add->get_input_node_shared_ptr(1), bias);
+    ASSERT_EQ(relu->get_input_node_shared_ptr(0), broadcast);
+}
+
+}  // namespace testing
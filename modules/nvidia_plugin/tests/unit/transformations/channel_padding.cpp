@@ -0,0 +1,91 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/channel_padding.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/pad.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/strided_slice.hpp"
+#include "transformation_test_utils.hpp"
+
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Node> create_conv(const Output<Node>& input, size_t out_channels) {
+    const auto in_channels = input.get_shape()[1];
+    auto filter = op::v0::Constant::create(element::f16,
+                                           Shape{out_channels, in_channels, 3, 3},
+                                           vector<float>(out_channels * in_channels * 9, 1.0f));
+    return make_shared<op::v1::Convolution>(
+        input, filter, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1}, Strides{1, 1});
+}
+
+}  // namespace
+
+TEST(channel_padding, image_and_inner_channels_are_padded_up_to_output) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, Shape{1, 3, 8, 8});
+    auto conv0 = create_conv(input, 12);
+    auto bias = op::v0::Constant::create(element::f16, Shape{1, 12, 1, 1}, vector<float>(12, 0.5f));
+    auto add = make_shared<op::v1::Add>(conv0, bias);
+    auto relu = make_shared<op::v0::Relu>(add);
+    auto conv1 = create_conv(relu, 12);
+    auto model = make_shared<Model>(conv1, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ChannelPaddingTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Pad>(model), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::StridedSlice>(model), 1);
+    ASSERT_EQ(conv0->get_input_shape(0), (Shape{1, 8, 8, 8}));
+    ASSERT_EQ(conv0->get_input_shape(1), (Shape{16, 8, 3, 3}));
+    ASSERT_EQ(add->get_input_shape(1), (Shape{1, 16, 1, 1}));
+    ASSERT_EQ(relu->get_output_shape(0), (Shape{1, 16, 8, 8}));
+    // Padded channels of the activation are ignored by zero weights of the next convolution
+    ASSERT_EQ(conv1->get_input_shape(1), (Shape{16, 16, 3, 3}));
+    const auto slice = model->get_result()->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(is_type<op::v1::StridedSlice>(slice));
+    ASSERT_EQ(slice->get_output_shape(0), (Shape{1, 12, 8, 8}));
+    ASSERT_EQ(model->get_result()->get_output_shape(0), (Shape{1, 12, 8, 8}));
+}
+
+TEST(channel_padding, classifier_head_is_padded_and_sliced) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, Shape{4, 64});
+    auto weights = op::v0::Constant::create(element::f16, Shape{1000, 64}, vector<float>(1000 * 64, 1.0f));
+    auto matmul = make_shared<op::v0::MatMul>(input, weights, false, true);
+    auto bias = op::v0::Constant::create(element::f16, Shape{1000}, vector<float>(1000, 1.0f));
+    auto add = make_shared<op::v1::Add>(matmul, bias);
+    auto model = make_shared<Model>(add, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ChannelPaddingTransformation>(model);
+
+    ASSERT_EQ(matmul->get_input_shape(1), (Shape{1008, 64}));
+    ASSERT_EQ(add->get_input_shape(1), (Shape{1008}));
+    ASSERT_EQ(count_ops_of_type<op::v1::StridedSlice>(model), 1);
+    ASSERT_EQ(model->get_result()->get_output_shape(0), (Shape{4, 1000}));
+}
+
+TEST(channel_padding, fp32_model_is_not_changed) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 8, 8});
+    auto filter = op::v0::Constant::create(element::f32, Shape{12, 3, 3, 3}, vector<float>(12 * 3 * 9, 1.0f));
+    auto conv = make_shared<op::v1::Convolution>(
+        input, filter, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1}, Strides{1, 1});
+    auto model = make_shared<Model>(conv, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ChannelPaddingTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Pad>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::StridedSlice>(model), 0);
+    ASSERT_EQ(conv->get_input_shape(1), (Shape{12, 3, 3, 3}));
+}
+
+}  // namespace testing
@@ -11,17 +11,31 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/relu.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/init_node_info.hpp"
 #include "transformations/utils/utils.hpp"
 #include "transformer/nodes/concat_optimized.hpp"
+#include "transformer/nodes/fused_eltwise.hpp"
 
 using ov::nvidia_gpu::nodes::ConcatOptimized;
+using ov::nvidia_gpu::nodes::FusedEltwise;
 using namespace ov;
 using namespace std;
 
 namespace testing {
 
+namespace {
+
+shared_ptr<FusedEltwise> make_fused_relu(const Output<Node>& input) {
+    auto parameter = make_shared<op::v0::Parameter>(input.get_element_type(), input.get_shape());
+    auto relu = make_shared<op::v0::Relu>(parameter);
+    auto body = make_shared<Model>(relu, ParameterVector{parameter});
+    return make_shared<FusedEltwise>(OutputVector{input}, body);
+}
+
+}  // namespace
+
 TEST(concat_optimized, concat_2_inputs_axis_1) {
     shared_ptr<ov::Model> model, model_ref;
     int64_t axis = 1;
@@ -129,4 +143,39 @@ TEST(concat_optimized, concat_dynamic_fail) {
     ASSERT_EQ(count_ops_of_type<ConcatOptimized>(model), 0);
 }
 
+TEST(concat_optimized, concat_inner_axis_of_fused_eltwise) {
+    auto input0 = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 4});
+    auto input1 = make_shared<op::v0::Parameter>(element::f32, Shape{2, 5, 4});
+    auto fused0 = make_fused_relu(input0);
+    auto fused1 = make_fused_relu(input1);
+    auto concat = make_shared<op::v0::Concat>(OutputVector{fused0, fused1}, 1);
+    auto model = make_shared<Model>(concat, ParameterVector{input0, input1});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::ConcatTransformation>();
+    pass_manager.run_passes(model);
+
+    ASSERT_EQ(count_ops_of_type<ConcatOptimized>(model), 1);
+    const auto slice = ConcatOptimized::get_strided_slice(static_pointer_cast<const Node>(fused1)->output(0));
+    ASSERT_TRUE(slice);
+    ASSERT_EQ(slice->block_size, 20);
+    ASSERT_EQ(slice->stride, 32);
+}
+
+TEST(concat_optimized, concat_inner_axis_of_parameters_fail) {
+    auto input0 = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 4});
+    auto input1 = make_shared<op::v0::Parameter>(element::f32, Shape{2, 5, 4});
+    auto fused0 = make_fused_relu(input0);
+    auto concat = make_shared<op::v0::Concat>(OutputVector{fused0, input1}, 1);
+    auto model = make_shared<Model>(concat, ParameterVector{input0, input1});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::ConcatTransformation>();
+    pass_manager.run_passes(model);
+
+    ASSERT_EQ(count_ops_of_type<ConcatOptimized>(model), 0);
+}
+
 }  // namespace testing
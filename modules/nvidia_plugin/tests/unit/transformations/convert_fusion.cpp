@@ -0,0 +1,251 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/convert_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/concat_convert.hpp"
+#include "transformer/nodes/convert_color_preprocess.hpp"
+#include "transformer/nodes/convert_normalize.hpp"
+#include "transformer/nodes/gather_convert.hpp"
+
+using ov::nvidia_gpu::nodes::ConcatConvert;
+using ov::nvidia_gpu::nodes::ConvertColorPreprocess;
+using ov::nvidia_gpu::nodes::ConvertNormalize;
+using ov::nvidia_gpu::nodes::GatherConvert;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+void run_convert_fusions(const shared_ptr<Model>& model) {
+    run_transformation<nvidia_gpu::pass::FuseConvertsToConcat,
+                       nvidia_gpu::pass::FuseConvertsToGather,
+                       nvidia_gpu::pass::FuseConvertColorPreprocess,
+                       nvidia_gpu::pass::FuseConvertNormalize>(model);
+}
+
+}  // namespace
+
+TEST(convert_fusion, concat_input_and_output_converts) {
+    auto input0 = make_shared<op::v0::Parameter>(element::f16, Shape{2, 4});
+    auto input1 = make_shared<op::v0::Parameter>(element::f16, Shape{2, 8});
+    auto convert0 = make_shared<op::v0::Convert>(input0, element::f32);
+    auto convert1 = make_shared<op::v0::Convert>(input1, element::f32);
+    auto concat = make_shared<op::v0::Concat>(OutputVector{convert0, convert1}, 1);
+    auto convert = make_shared<op::v0::Convert>(concat, element::f16);
+    auto model = make_shared<Model>(convert, ParameterVector{input0, input1});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    const auto fused = dynamic_pointer_cast<ConcatConvert>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_input_element_type(0), element::f16);
+    ASSERT_EQ(fused->get_output_element_type(0), element::f16);
+    ASSERT_EQ(fused->get_output_shape(0), (Shape{2, 12}));
+}
+
+TEST(convert_fusion, concat_inputs_of_different_types_are_not_fused) {
+    auto input0 = make_shared<op::v0::Parameter>(element::f16, Shape{2, 4});
+    auto input1 = make_shared<op::v0::Parameter>(element::f32, Shape{2, 8});
+    auto convert0 = make_shared<op::v0::Convert>(input0, element::f32);
+    auto concat = make_shared<op::v0::Concat>(OutputVector{convert0, input1}, 1);
+    auto relu = make_shared<op::v0::Relu>(concat);
+    auto model = make_shared<Model>(relu, ParameterVector{input0, input1});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 1);
+    ASSERT_EQ(count_ops_of_type<ConcatConvert>(model), 0);
+}
+
+TEST(convert_fusion, gather_output_convert) {
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{100, 16});
+    auto indices = make_shared<op::v0::Parameter>(element::i32, Shape{8});
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {0});
+    auto gather = make_shared<op::v8::Gather>(data, indices, axis);
+    auto convert = make_shared<op::v0::Convert>(gather, element::f16);
+    auto model = make_shared<Model>(convert, ParameterVector{data, indices});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    const auto fused = dynamic_pointer_cast<GatherConvert>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_output_element_type(0), element::f16);
+    ASSERT_EQ(fused->get_output_shape(0), (Shape{8, 16}));
+}
+
+TEST(convert_fusion, gather_data_with_other_consumers_is_not_fused) {
+    auto data = make_shared<op::v0::Parameter>(element::f16, Shape{100, 16});
+    auto indices = make_shared<op::v0::Parameter>(element::i32, Shape{8});
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {0});
+    auto convert = make_shared<op::v0::Convert>(data, element::f32);
+    auto gather = make_shared<op::v8::Gather>(convert, indices, axis);
+    auto relu = make_shared<op::v0::Relu>(convert);
+    auto model = make_shared<Model>(OutputVector{gather, relu}, ParameterVector{data, indices});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 1);
+    ASSERT_EQ(count_ops_of_type<GatherConvert>(model), 0);
+}
+
+TEST(convert_fusion, convert_subtract_multiply_per_channel) {
+    auto input = make_shared<op::v0::Parameter>(element::u8, Shape{1, 3, 4, 4});
+    auto convert = make_shared<op::v0::Convert>(input, element::f32);
+    auto mean = op::v0::Constant::create(element::f32, Shape{1, 3, 1, 1}, {1.0f, 2.0f, 3.0f});
+    auto subtract = make_shared<op::v1::Subtract>(convert, mean);
+    auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+    auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+    auto model = make_shared<Model>(multiply, ParameterVector{input});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    const auto fused = dynamic_pointer_cast<ConvertNormalize>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_input_element_type(0), element::u8);
+    ASSERT_EQ(fused->get_output_element_type(0), element::f32);
+    ASSERT_EQ(fused->get_output_shape(0), (Shape{1, 3, 4, 4}));
+    ASSERT_EQ(fused->get_axis(), 1);
+    const auto fused_scale = dynamic_pointer_cast<op::v0::Constant>(fused->get_input_node_shared_ptr(1));
+    const auto fused_shift = dynamic_pointer_cast<op::v0::Constant>(fused->get_input_node_shared_ptr(2));
+    ASSERT_TRUE(fused_scale && fused_shift);
+    ASSERT_EQ(fused_scale->cast_vector<float>(), (vector<float>{0.5f, 0.5f, 0.5f}));
+    ASSERT_EQ(fused_shift->cast_vector<float>(), (vector<float>{-0.5f, -1.0f, -1.5f}));
+}
+
+TEST(convert_fusion, convert_divide_scalar) {
+    auto input = make_shared<op::v0::Parameter>(element::i8, Shape{2, 8});
+    auto convert = make_shared<op::v0::Convert>(input, element::f16);
+    auto divisor = op::v0::Constant::create(element::f16, Shape{1}, {4.0f});
+    auto divide = make_shared<op::v1::Divide>(convert, divisor);
+    auto model = make_shared<Model>(divide, ParameterVector{input});
+
+    run_convert_fusions(model);
+
+    const auto fused = dynamic_pointer_cast<ConvertNormalize>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_output_element_type(0), element::f16);
+    ASSERT_EQ(fused->get_input_shape(1), (Shape{1}));
+    const auto fused_scale = dynamic_pointer_cast<op::v0::Constant>(fused->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(fused_scale);
+    ASSERT_EQ(fused_scale->cast_vector<float>(), (vector<float>{0.25f}));
+}
+
+TEST(convert_fusion, convert_constants_along_different_axes_are_partially_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::u8, Shape{1, 3, 4, 4});
+    auto convert = make_shared<op::v0::Convert>(input, element::f32);
+    auto mean = op::v0::Constant::create(element::f32, Shape{1, 3, 1, 1}, {1.0f, 2.0f, 3.0f});
+    auto subtract = make_shared<op::v1::Subtract>(convert, mean);
+    auto scale = op::v0::Constant::create(element::f32, Shape{1, 1, 1, 4}, {1.0f, 2.0f, 3.0f, 4.0f});
+    auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+    auto model = make_shared<Model>(multiply, ParameterVector{input});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<ConvertNormalize>(model), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 1);
+}
+
+TEST(convert_fusion, convert_of_float_data_is_not_normalized) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, Shape{1, 3, 4, 4});
+    auto convert = make_shared<op::v0::Convert>(input, element::f32);
+    auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+    auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+    auto model = make_shared<Model>(multiply, ParameterVector{input});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 1);
+    ASSERT_EQ(count_ops_of_type<ConvertNormalize>(model), 0);
+}
+
+TEST(convert_fusion, nv12_resize_normalize_transpose) {
+    auto y = make_shared<op::v0::Parameter>(element::u8, Shape{1, 8, 12, 1});
+    auto uv = make_shared<op::v0::Parameter>(element::u8, Shape{1, 4, 6, 2});
+    auto color = make_shared<op::v8::NV12toRGB>(y, uv);
+    auto convert = make_shared<op::v0::Convert>(color, element::f32);
+    op::v4::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = op::v4::Interpolate::InterpolateMode::LINEAR;
+    attrs.shape_calculation_mode = op::v4::Interpolate::ShapeCalcMode::SIZES;
+    attrs.coordinate_transformation_mode = op::v4::Interpolate::CoordinateTransformMode::HALF_PIXEL;
+    attrs.pads_begin = {0, 0, 0, 0};
+    attrs.pads_end = {0, 0, 0, 0};
+    auto sizes = op::v0::Constant::create(element::i64, Shape{2}, {4, 6});
+    auto scales = op::v0::Constant::create(element::f32, Shape{2}, {0.5f, 0.5f});
+    auto axes = op::v0::Constant::create(element::i64, Shape{2}, {1, 2});
+    auto resize = make_shared<op::v4::Interpolate>(convert, sizes, scales, axes, attrs);
+    auto mean = op::v0::Constant::create(element::f32, Shape{1, 1, 1, 3}, {1.0f, 2.0f, 3.0f});
+    auto subtract = make_shared<op::v1::Subtract>(resize, mean);
+    auto divisor = op::v0::Constant::create(element::f32, Shape{}, {2.0f});
+    auto divide = make_shared<op::v1::Divide>(subtract, divisor);
+    auto order = op::v0::Constant::create(element::i64, Shape{4}, {0, 3, 1, 2});
+    auto transpose = make_shared<op::v1::Transpose>(divide, order);
+    auto model = make_shared<Model>(transpose, ParameterVector{y, uv});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v4::Interpolate>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(model), 0);
+    const auto fused = dynamic_pointer_cast<ConvertColorPreprocess>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_input_size(), 2);
+    ASSERT_EQ(fused->get_output_element_type(0), element::f32);
+    ASSERT_EQ(fused->get_output_shape(0), (Shape{1, 3, 4, 6}));
+    const auto& fused_attrs = fused->get_attrs();
+    ASSERT_TRUE(fused_attrs.round);
+    ASSERT_FALSE(fused_attrs.i420);
+    ASSERT_FALSE(fused_attrs.bgr);
+    ASSERT_EQ(fused_attrs.source_coordinates, (vector<float>{2.0f, 0.5f, 2.0f, 0.5f}));
+    ASSERT_EQ(fused_attrs.scale, (vector<float>{0.5f, 0.5f, 0.5f}));
+    ASSERT_EQ(fused_attrs.shift, (vector<float>{-0.5f, -1.0f, -1.5f}));
+}
+
+TEST(convert_fusion, nv12_with_integer_resize_is_not_fused) {
+    auto y = make_shared<op::v0::Parameter>(element::u8, Shape{1, 8, 12, 1});
+    auto uv = make_shared<op::v0::Parameter>(element::u8, Shape{1, 4, 6, 2});
+    auto color = make_shared<op::v8::NV12toRGB>(y, uv);
+    op::v4::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = op::v4::Interpolate::InterpolateMode::LINEAR;
+    attrs.shape_calculation_mode = op::v4::Interpolate::ShapeCalcMode::SIZES;
+    attrs.pads_begin = {0, 0, 0, 0};
+    attrs.pads_end = {0, 0, 0, 0};
+    auto sizes = op::v0::Constant::create(element::i64, Shape{2}, {4, 6});
+    auto scales = op::v0::Constant::create(element::f32, Shape{2}, {0.5f, 0.5f});
+    auto axes = op::v0::Constant::create(element::i64, Shape{2}, {1, 2});
+    auto resize = make_shared<op::v4::Interpolate>(color, sizes, scales, axes, attrs);
+    auto model = make_shared<Model>(resize, ParameterVector{y, uv});
+
+    run_convert_fusions(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v8::NV12toRGB>(model), 1);
+    ASSERT_EQ(count_ops_of_type<ConvertColorPreprocess>(model), 0);
+}
+
+}  // namespace testing
@@ -49,3 +49,41 @@ TEST(TransformationTests, cuda_transformations_f16) {
     auto res = compare_functions(model, model_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, cuda_transformations_bf16) {
+    std::shared_ptr<ov::Model> model, model_ref;
+    {
+        // Example model
+        auto data = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::Shape{3, 1, 2});
+        auto divide_constant = ov::opset10::Constant::create(ov::element::f32, ov::Shape{1}, {2});
+        auto divide = std::make_shared<ov::opset10::Divide>(data, divide_constant);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{divide}, ov::ParameterVector{data});
+
+        // Run transformation
+        const CUDA::Device device{};
+        const auto config =
+            ov::nvidia_gpu::Configuration(ov::AnyMap{ov::hint::inference_precision(ov::element::bf16)});
+        ov::nvidia_gpu::GraphTransformer().transform(device, model, config);
+
+        // Check that after applying transformation all runtime info attributes was correctly propagated
+        ASSERT_NO_THROW(check_rt_info(model));
+
+        if (!CUDA::isBf16Supported(device)) {
+            GTEST_SKIP() << "bf16 precision isn't fully supported on the device";
+        }
+    }
+
+    {
+        // Example reference model
+        auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 1, 2});
+        auto convert_bf16 = std::make_shared<ov::opset10::Convert>(data, ov::element::bf16);
+        auto mul_constant = ov::opset10::Constant::create(ov::element::bf16, ov::Shape{1, 1, 1}, {0.5});
+        auto mul = std::make_shared<ov::opset10::Multiply>(convert_bf16, mul_constant);
+        auto convert_f32 = std::make_shared<ov::opset10::Convert>(mul, ov::element::f32);
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{convert_f32}, ov::ParameterVector{data});
+    }
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
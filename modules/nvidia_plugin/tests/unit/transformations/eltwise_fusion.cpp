@@ -0,0 +1,177 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/eltwise_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/clamp.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/greater.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/logical_not.hpp"
+#include "openvino/op/mish.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/swish.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/fused_eltwise.hpp"
+
+using ov::nvidia_gpu::nodes::FusedEltwise;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+TEST(eltwise_fusion, chain_with_broadcast_and_scalar) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, Shape{2, 8, 16});
+    auto bias = op::v0::Constant::create(element::f16, Shape{16}, {1});
+    auto add = make_shared<op::v1::Add>(input, bias);
+    auto scale = op::v0::Constant::create(element::f16, Shape{}, {0.5f});
+    auto multiply = make_shared<op::v1::Multiply>(add, scale);
+    auto swish = make_shared<op::v4::Swish>(multiply);
+    auto convert = make_shared<op::v0::Convert>(swish, element::f32);
+    auto clamp = make_shared<op::v0::Clamp>(convert, -1.0, 1.0);
+    auto model = make_shared<Model>(clamp, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 1);
+    const auto fused = dynamic_pointer_cast<FusedEltwise>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_input_size(), 2);
+    ASSERT_EQ(fused->get_output_element_type(0), element::f32);
+    ASSERT_EQ(fused->get_output_shape(0), (Shape{2, 8, 16}));
+    // Scalar constant is inlined into the body
+    ASSERT_EQ(count_ops_of_type<op::v0::Constant>(fused->get_body()), 1);
+    ASSERT_EQ(fused->get_body()->get_ordered_ops().size(), 9);
+}
+
+TEST(eltwise_fusion, intermediate_with_external_consumer_is_not_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{4, 32});
+    auto relu = make_shared<op::v0::Relu>(input);
+    auto softmax = make_shared<op::v8::Softmax>(relu, 1);
+    auto add = make_shared<op::v1::Add>(relu, softmax);
+    auto multiply = make_shared<op::v1::Multiply>(add, add);
+    auto model = make_shared<Model>(multiply, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(model), 1);
+    const auto fused = dynamic_pointer_cast<FusedEltwise>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_input_size(), 2);
+}
+
+TEST(eltwise_fusion, bias_and_mish_after_normalization) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 16, 8, 8});
+    auto axes = op::v0::Constant::create(element::i64, Shape{2}, {2, 3});
+    auto mvn = make_shared<op::v6::MVN>(input, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    auto bias = op::v0::Constant::create(element::f32, Shape{16, 1, 1}, {1});
+    auto add = make_shared<op::v1::Add>(mvn, bias);
+    auto mish = make_shared<op::v4::Mish>(add);
+    auto model = make_shared<Model>(mish, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 1);
+    ASSERT_EQ(count_ops_of_type<op::v4::Mish>(model), 0);
+    const auto fused = dynamic_pointer_cast<FusedEltwise>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_input_size(), 2);
+    ASSERT_TRUE(dynamic_pointer_cast<op::v6::MVN>(fused->get_input_node_shared_ptr(0)));
+}
+
+TEST(eltwise_fusion, single_operation_is_not_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{4, 32});
+    auto relu = make_shared<op::v0::Relu>(input);
+    auto softmax = make_shared<op::v8::Softmax>(relu, 1);
+    auto model = make_shared<Model>(softmax, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 0);
+}
+
+TEST(eltwise_fusion, integer_operations_are_not_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::i32, Shape{4, 32});
+    auto add = make_shared<op::v1::Add>(input, op::v0::Constant::create(element::i32, Shape{}, {1}));
+    auto multiply = make_shared<op::v1::Multiply>(add, add);
+    auto model = make_shared<Model>(multiply, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 0);
+}
+
+TEST(eltwise_fusion, mask_chain_is_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4, 16});
+    auto threshold = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+    auto less = make_shared<op::v1::Less>(input, threshold);
+    auto mask = make_shared<op::v1::LogicalNot>(less);
+    auto fill = op::v0::Constant::create(element::f32, Shape{}, {-10000.0f});
+    auto select = make_shared<op::v1::Select>(mask, input, fill);
+    auto model = make_shared<Model>(select, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Select>(model), 0);
+    const auto fused = dynamic_pointer_cast<FusedEltwise>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_input_size(), 1);
+    ASSERT_EQ(fused->get_output_element_type(0), element::f32);
+    ASSERT_FALSE(fused->is_packed_output());
+}
+
+TEST(eltwise_fusion, shared_mask_is_packed) {
+    auto a = make_shared<op::v0::Parameter>(element::f16, Shape{4, 40});
+    auto b = make_shared<op::v0::Parameter>(element::f16, Shape{4, 40});
+    auto mask = make_shared<op::v1::Greater>(a, b);
+    auto zero = op::v0::Constant::create(element::f16, Shape{}, {0.0f});
+    auto relu_a = make_shared<op::v0::Relu>(make_shared<op::v1::Select>(mask, a, zero));
+    auto relu_b = make_shared<op::v0::Relu>(make_shared<op::v1::Select>(mask, zero, b));
+    auto softmax_a = make_shared<op::v8::Softmax>(relu_a, 1);
+    auto softmax_b = make_shared<op::v8::Softmax>(relu_b, 1);
+    auto model = make_shared<Model>(OutputVector{softmax_a, softmax_b}, ParameterVector{a, b});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 3);
+    ASSERT_EQ(count_ops_of_type<op::v1::Greater>(model), 0);
+    const auto consumer = dynamic_pointer_cast<FusedEltwise>(softmax_a->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(consumer);
+    const auto producer = dynamic_pointer_cast<FusedEltwise>(consumer->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(producer);
+    ASSERT_TRUE(producer->is_packed_output());
+    ASSERT_EQ(producer->get_output_element_type(0), element::u1);
+    ASSERT_EQ(producer->get_output_shape(0), (Shape{4, 40}));
+    ASSERT_EQ(producer->get_output_target_inputs(0).size(), 2);
+}
+
+TEST(eltwise_fusion, mask_of_result_is_not_packed) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{4, 32});
+    auto zero = op::v0::Constant::create(element::f32, Shape{}, {0.0f});
+    auto mask = make_shared<op::v1::Greater>(make_shared<op::v0::Relu>(input), zero);
+    auto model = make_shared<Model>(mask, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::EltwiseFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<FusedEltwise>(model), 1);
+    const auto fused = dynamic_pointer_cast<FusedEltwise>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fused);
+    ASSERT_FALSE(fused->is_packed_output());
+    ASSERT_EQ(fused->get_output_element_type(0), element::boolean);
+}
+
+}  // namespace testing
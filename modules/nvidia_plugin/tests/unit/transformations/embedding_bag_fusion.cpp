@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/embedding_bag_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/embeddingbag_packedsum.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/relu.hpp"
+#include "transformation_test_utils.hpp"
+
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+TEST(embedding_bag_fusion, gather_reduce_sum) {
+    auto table = make_shared<op::v0::Parameter>(element::f32, Shape{1000, 64});
+    auto indices = make_shared<op::v0::Parameter>(element::i64, Shape{8, 20});
+    auto gather = make_shared<op::v8::Gather>(table, indices, op::v0::Constant::create(element::i64, Shape{}, {0}));
+    auto reduce =
+        make_shared<op::v1::ReduceSum>(gather, op::v0::Constant::create(element::i64, Shape{1}, {1}), false);
+    auto model = make_shared<Model>(reduce, ParameterVector{table, indices});
+
+    run_transformation<nvidia_gpu::pass::EmbeddingBagFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v8::Gather>(model), 0);
+    const auto bag =
+        dynamic_pointer_cast<op::v3::EmbeddingBagPackedSum>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(bag);
+    ASSERT_EQ(bag->get_input_size(), 2);
+    ASSERT_EQ(bag->get_output_shape(0), (Shape{8, 64}));
+}
+
+TEST(embedding_bag_fusion, gather_reduce_mean_keep_dims) {
+    auto table = make_shared<op::v0::Parameter>(element::f16, Shape{1000, 64});
+    auto indices = make_shared<op::v0::Parameter>(element::i32, Shape{8, 4});
+    auto gather = make_shared<op::v8::Gather>(table, indices, op::v0::Constant::create(element::i64, Shape{}, {0}));
+    auto reduce =
+        make_shared<op::v1::ReduceMean>(gather, op::v0::Constant::create(element::i64, Shape{1}, {-2}), true);
+    auto model = make_shared<Model>(reduce, ParameterVector{table, indices});
+
+    run_transformation<nvidia_gpu::pass::EmbeddingBagFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::ReduceMean>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v3::EmbeddingBagPackedSum>(model), 1);
+    ASSERT_EQ(model->get_output_shape(0), (Shape{8, 1, 64}));
+}
+
+TEST(embedding_bag_fusion, gather_with_other_consumers_is_not_fused) {
+    auto table = make_shared<op::v0::Parameter>(element::f32, Shape{1000, 64});
+    auto indices = make_shared<op::v0::Parameter>(element::i64, Shape{8, 20});
+    auto gather = make_shared<op::v8::Gather>(table, indices, op::v0::Constant::create(element::i64, Shape{}, {0}));
+    auto reduce =
+        make_shared<op::v1::ReduceSum>(gather, op::v0::Constant::create(element::i64, Shape{1}, {1}), false);
+    auto relu = make_shared<op::v0::Relu>(gather);
+    auto model = make_shared<Model>(OutputVector{reduce, relu}, ParameterVector{table, indices});
+
+    run_transformation<nvidia_gpu::pass::EmbeddingBagFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v3::EmbeddingBagPackedSum>(model), 0);
+}
+
+}  // namespace testing
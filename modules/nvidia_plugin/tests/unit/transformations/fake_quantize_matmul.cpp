@@ -0,0 +1,88 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/fake_quantize_matmul_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/fake_quantize.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/quantized_matmul.hpp"
+
+using ov::nvidia_gpu::nodes::QuantizedMatMul;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Model> create_model(size_t k, size_t n, float low, float high, size_t levels) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, k});
+    auto input_low = op::v0::Constant::create(element::f32, Shape{}, {low});
+    auto input_high = op::v0::Constant::create(element::f32, Shape{}, {high});
+    auto fq = make_shared<op::v0::FakeQuantize>(input, input_low, input_high, input_low, input_high, levels);
+    vector<float> values(k * n);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(static_cast<int>(i % 31) - 15) * 0.1f;
+    }
+    auto weights = op::v0::Constant::create(element::f32, Shape{k, n}, values);
+    auto matmul = make_shared<op::v0::MatMul>(fq, weights);
+    return make_shared<Model>(matmul, ParameterVector{input});
+}
+
+}  // namespace
+
+TEST(fake_quantize_matmul, symmetric_fake_quantize_is_fused_to_int8_matmul) {
+    const size_t k = 32;
+    const size_t n = 16;
+    const float scale = 0.05f;
+    auto model = create_model(k, n, -128 * scale, 127 * scale, 256);
+    run_transformation<nvidia_gpu::pass::FakeQuantizeMatMulTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::MatMul>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::FakeQuantize>(model), 0);
+    ASSERT_EQ(count_ops_of_type<QuantizedMatMul>(model), 1);
+    shared_ptr<QuantizedMatMul> quantized;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto matmul = dynamic_pointer_cast<QuantizedMatMul>(node)) {
+            quantized = matmul;
+        }
+    }
+    ASSERT_EQ(quantized->get_output_shape(0), (Shape{2, n}));
+    ASSERT_EQ(quantized->get_levels(), 256);
+    ASSERT_EQ(quantized->get_input_element_type(1), element::i8);
+    ASSERT_EQ(quantized->get_input_shape(1), (Shape{n, k}));
+    ASSERT_NE(dynamic_pointer_cast<op::v0::Parameter>(quantized->get_input_node_shared_ptr(0)), nullptr);
+    // Scales of weights are 1.5 / 127, since the largest absolute weight of each column is 1.5
+    const auto scales =
+        dynamic_pointer_cast<op::v0::Constant>(quantized->get_input_node_shared_ptr(2))->cast_vector<float>();
+    for (const auto value : scales) {
+        ASSERT_NEAR(value, scale * 1.5f / 127, 1e-6f);
+    }
+}
+
+TEST(fake_quantize_matmul, asymmetric_fake_quantize_is_not_fused) {
+    auto model = create_model(32, 16, 0.0f, 2.55f, 256);
+    auto model_ref = model->clone();
+    run_transformation<nvidia_gpu::pass::FakeQuantizeMatMulTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<QuantizedMatMul>(model), 0);
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(fake_quantize_matmul, unaligned_dimensions_are_not_fused) {
+    auto model = create_model(30, 16, -12.8f, 12.7f, 256);
+    run_transformation<nvidia_gpu::pass::FakeQuantizeMatMulTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<QuantizedMatMul>(model), 0);
+}
+
+}  // namespace testing
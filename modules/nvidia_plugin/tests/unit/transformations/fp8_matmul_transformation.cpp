@@ -0,0 +1,110 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/fp8_matmul_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/fp8_matmul.hpp"
+
+using ov::nvidia_gpu::nodes::Fp8MatMul;
+using ov::nvidia_gpu::pass::float_to_f8e4m3;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+float f8e4m3_to_float(uint8_t bits) {
+    const float sign = (bits & 0x80) ? -1.0f : 1.0f;
+    const int exponent = (bits >> 3) & 0x0F;
+    const int mantissa = bits & 0x07;
+    if (exponent == 0) {
+        return sign * std::ldexp(static_cast<float>(mantissa), -9);
+    }
+    return sign * std::ldexp(static_cast<float>(8 + mantissa), exponent - 10);
+}
+
+shared_ptr<Model> create_model(const Shape& input_shape, const Shape& weights_shape, bool transpose_b) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, input_shape);
+    vector<float> values(shape_size(weights_shape));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(static_cast<int>(i % 29) - 14) * 0.25f;
+    }
+    auto weights = op::v0::Constant::create(element::f16, weights_shape, values);
+    auto matmul = make_shared<op::v0::MatMul>(input, weights, false, transpose_b);
+    return make_shared<Model>(matmul, ParameterVector{input});
+}
+
+}  // namespace
+
+TEST(fp8_matmul, values_are_rounded_to_nearest_e4m3) {
+    ASSERT_EQ(float_to_f8e4m3(0.0f), 0x00);
+    ASSERT_EQ(float_to_f8e4m3(-0.0f), 0x80);
+    ASSERT_EQ(float_to_f8e4m3(1.0f), 0x38);
+    ASSERT_EQ(float_to_f8e4m3(448.0f), 0x7E);
+    ASSERT_EQ(float_to_f8e4m3(1000.0f), 0x7E);
+    ASSERT_EQ(float_to_f8e4m3(-448.0f), 0xFE);
+    ASSERT_EQ(float_to_f8e4m3(std::ldexp(1.0f, -6)), 0x08);
+    ASSERT_EQ(float_to_f8e4m3(std::ldexp(1.0f, -9)), 0x01);
+    // Ties are rounded to even mantissas
+    ASSERT_EQ(float_to_f8e4m3(1.0625f), 0x38);
+    ASSERT_EQ(float_to_f8e4m3(1.1875f), 0x3A);
+    for (int bits = 0; bits < 0x7F; ++bits) {
+        ASSERT_EQ(float_to_f8e4m3(f8e4m3_to_float(static_cast<uint8_t>(bits))), bits);
+    }
+}
+
+TEST(fp8_matmul, matmul_weights_are_converted_to_fp8_with_per_tensor_scale) {
+    const size_t k = 64;
+    const size_t n = 32;
+    auto model = create_model(Shape{4, k}, Shape{k, n}, false);
+    run_transformation<nvidia_gpu::pass::Fp8MatMulTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::MatMul>(model), 0);
+    ASSERT_EQ(count_ops_of_type<Fp8MatMul>(model), 1);
+    shared_ptr<Fp8MatMul> fp8;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto matmul = dynamic_pointer_cast<Fp8MatMul>(node)) {
+            fp8 = matmul;
+        }
+    }
+    ASSERT_EQ(fp8->get_output_shape(0), (Shape{4, n}));
+    ASSERT_EQ(fp8->get_output_element_type(0), element::f16);
+    const auto weights = dynamic_pointer_cast<op::v0::Constant>(fp8->get_input_node_shared_ptr(1));
+    ASSERT_EQ(weights->get_output_shape(0), (Shape{n, k}));
+    const auto scale =
+        dynamic_pointer_cast<op::v0::Constant>(fp8->get_input_node_shared_ptr(2))->cast_vector<float>();
+    ASSERT_EQ(scale.size(), 1);
+    // The largest absolute weight 3.5 is mapped to the largest E4M3 value
+    ASSERT_FLOAT_EQ(scale[0], 3.5f / 448.0f);
+    const auto* bits = weights->get_data_ptr<uint8_t>();
+    for (size_t in = 0; in < n; ++in) {
+        for (size_t ik = 0; ik < k; ++ik) {
+            const float expected = static_cast<float>(static_cast<int>((ik * n + in) % 29) - 14) * 0.25f;
+            ASSERT_NEAR(f8e4m3_to_float(bits[in * k + ik]) * scale[0], expected, std::abs(expected) / 16 + 1e-6f);
+        }
+    }
+}
+
+TEST(fp8_matmul, unaligned_dimensions_are_not_converted) {
+    auto model = create_model(Shape{4, 40}, Shape{24, 40}, true);
+    auto model_ref = model->clone();
+    run_transformation<nvidia_gpu::pass::Fp8MatMulTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<Fp8MatMul>(model), 0);
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+}  // namespace testing
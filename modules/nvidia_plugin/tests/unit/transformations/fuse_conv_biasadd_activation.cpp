@@ -36,7 +36,8 @@ enum class ModelType {
     GroupConvBiasAdd,
     GroupConvBiasMulAdd,
     GroupConvBiasConvBiasAdd,
-    ConvBackpropAdd
+    ConvBackpropAdd,
+    ConvBackpropAddRelu
 };
 
 const std::vector<ModelType> conv_model_types = {
@@ -48,9 +49,10 @@ const std::vector<ModelType> group_conv_model_types = {ModelType::GroupConvBias,
                                                        ModelType::GroupConvBiasAdd,
                                                        ModelType::GroupConvBiasConvBiasAdd,
                                                        ModelType::GroupConvBiasMulAdd};
-const std::vector<ActivationMode> group_conv_activation_types = {ActivationMode::NO_ACTIVATION};
+const std::vector<ActivationMode> group_conv_activation_types = {
+    ActivationMode::NO_ACTIVATION, ActivationMode::RELU, ActivationMode::SIGMOID};
 
-const std::vector<ModelType> conv_backprop_model_types = {ModelType::ConvBackpropAdd};
+const std::vector<ModelType> conv_backprop_model_types = {ModelType::ConvBackpropAdd, ModelType::ConvBackpropAddRelu};
 const std::vector<ActivationMode> conv_backprop_activation_types = {ActivationMode::NO_ACTIVATION};
 
 struct ConvParams {
@@ -422,6 +424,10 @@ std::shared_ptr<Result> createModelBackprop(const ModelType& model_type,
         auto conv = add_conv_backprop(input_node);
         auto bias = add_eltwise(conv);
         last_op = bias;
+    } else if (model_type == ModelType::ConvBackpropAddRelu) {
+        auto conv = add_conv_backprop(input_node);
+        auto bias = add_eltwise(conv);
+        last_op = std::make_shared<Relu>(bias);
     }
     return std::make_shared<Result>(last_op);
 }
@@ -430,7 +436,9 @@ std::shared_ptr<Result> createRefModelBackprop(const ModelType& model_type,
                                                const ov::Output<ov::Node>& input_node,
                                                const ConvBackPropParams& conv_params) {
     std::shared_ptr<ov::Node> last_op = nullptr;
-    if (model_type == ModelType::ConvBackpropAdd) {
+    if (model_type == ModelType::ConvBackpropAdd || model_type == ModelType::ConvBackpropAddRelu) {
+        const auto activation = model_type == ModelType::ConvBackpropAddRelu ? ActivationMode::RELU
+                                                                              : ActivationMode::NO_ACTIVATION;
         auto fused_conv = std::make_shared<FusedConvBackpropData>(
             input_node,
             Constant::create(ov::element::f32, conv_params.filter_shape, {0.01}),
@@ -440,7 +448,8 @@ std::shared_ptr<Result> createRefModelBackprop(const ModelType& model_type,
             conv_params.pads_end,
             conv_params.dilation,
             conv_params.pad_type,
-            conv_params.output_pad);
+            conv_params.output_pad,
+            activation);
         last_op = fused_conv;
     }
     return std::make_shared<Result>(last_op);
@@ -477,6 +486,8 @@ public:
         std::ostringstream result;
         if (model_type == ModelType::ConvBackpropAdd) {
             result << "ConvBackpropAdd";
+        } else if (model_type == ModelType::ConvBackpropAddRelu) {
+            result << "ConvBackpropAddRelu";
         }
         result << "_" << conv_params.stride;
         result << "_" << conv_params.dilation;
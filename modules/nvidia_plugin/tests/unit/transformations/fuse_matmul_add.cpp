@@ -11,11 +11,15 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/init_node_info.hpp"
 #include "transformations/utils/utils.hpp"
 #include "transformer/nodes/fully_connected.hpp"
 
+using ov::nvidia_gpu::nodes::ActivationMode;
 using ov::nvidia_gpu::nodes::FullyConnected;
 using namespace ov;
 using namespace std;
@@ -188,4 +192,83 @@ TEST(fuse_matmul_add, parameters_matmul_dynamic) {
     }
 }
 
+TEST(fuse_matmul_add, parameters_matmul_add_bias_vector) {
+    shared_ptr<ov::Model> model, model_ref;
+    {
+        auto input0 = make_shared<op::v0::Parameter>(element::f32, Shape{8, 16, 512});
+        auto input1 = make_shared<op::v0::Parameter>(element::f32, Shape{1024, 512});
+        auto matmul = make_shared<op::v0::MatMul>(input0, input1, false, true);
+        auto const_node = op::v0::Constant::create(element::f32, Shape{1024}, {1});
+        auto add = make_shared<op::v1::Add>(matmul, const_node);
+        model = make_shared<Model>(add, ParameterVector{input0, input1});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::InitNodeInfo>();
+        pass_manager.register_pass<nvidia_gpu::pass::FullyConnectedTransformation>();
+        pass_manager.run_passes(model);
+
+        ASSERT_EQ(count_ops_of_type<op::v0::MatMul>(model), 0);
+    }
+    {
+        auto input0 = make_shared<op::v0::Parameter>(element::f32, Shape{8, 16, 512});
+        auto input1 = make_shared<op::v0::Parameter>(element::f32, Shape{1024, 512});
+        auto const_node = op::v0::Constant::create(element::f32, Shape{1024}, {1});
+        auto fc = make_shared<FullyConnected>(input0, input1, const_node, false, true);
+        model_ref = make_shared<Model>(fc, ParameterVector{input0, input1});
+    }
+
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(fuse_matmul_add, fully_connected_scale_activation) {
+    shared_ptr<ov::Model> model;
+    {
+        auto input0 = make_shared<op::v0::Parameter>(element::f32, Shape{16, 512});
+        auto input1 = make_shared<op::v0::Parameter>(element::f32, Shape{1024, 512});
+        auto matmul = make_shared<op::v0::MatMul>(input0, input1, false, true);
+        auto bias = op::v0::Constant::create(element::f32, Shape{1024}, {2});
+        auto add = make_shared<op::v1::Add>(matmul, bias);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+        auto multiply = make_shared<op::v1::Multiply>(scale, add);
+        auto relu = make_shared<op::v0::Relu>(multiply);
+        model = make_shared<Model>(relu, ParameterVector{input0, input1});
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::FullyConnectedTransformation>();
+    pass_manager.register_pass<nvidia_gpu::pass::FuseFullyConnectedWithScale>();
+    pass_manager.register_pass<nvidia_gpu::pass::SinkActivationToFullyConnected>();
+    pass_manager.run_passes(model);
+
+    ASSERT_EQ(model->get_ops().size(), 5);
+    const auto fc = dynamic_pointer_cast<FullyConnected>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(fc);
+    ASSERT_EQ(fc->get_activation(), ActivationMode::RELU);
+    ASSERT_FLOAT_EQ(fc->get_output_scale(), 0.5f);
+    const auto bias = dynamic_pointer_cast<op::v0::Constant>(fc->get_input_node_shared_ptr(2));
+    ASSERT_TRUE(bias);
+    ASSERT_FLOAT_EQ(bias->cast_vector<float>().front(), 1.0f);
+}
+
+TEST(fuse_matmul_add, fully_connected_gelu_erf_fail) {
+    shared_ptr<ov::Model> model;
+    {
+        auto input0 = make_shared<op::v0::Parameter>(element::f32, Shape{1, 512});
+        auto input1 = make_shared<op::v0::Parameter>(element::f32, Shape{1024, 512});
+        auto bias = op::v0::Constant::create(element::f32, Shape{1, 1024}, {1});
+        auto fc = make_shared<FullyConnected>(input0, input1, bias, false, true);
+        auto gelu = make_shared<op::v7::Gelu>(fc, op::GeluApproximationMode::ERF);
+        model = make_shared<Model>(gelu, ParameterVector{input0, input1});
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::SinkActivationToFullyConnected>();
+    pass_manager.run_passes(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v7::Gelu>(model), 1);
+}
+
 }  // namespace testing
@@ -0,0 +1,97 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/group_norm_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/swish.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/group_norm.hpp"
+
+using ov::nvidia_gpu::nodes::GroupNorm;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Node> create_decomposed_group_norm(const shared_ptr<Node>& input,
+                                              const Shape& grouped_shape,
+                                              const vector<int64_t>& axes) {
+    auto grouped = make_shared<op::v1::Reshape>(
+        input, op::v0::Constant::create(element::i64, Shape{grouped_shape.size()}, grouped_shape), false);
+    auto mvn_axes = op::v0::Constant::create(element::i64, Shape{axes.size()}, axes);
+    auto mvn = make_shared<op::v6::MVN>(grouped, mvn_axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    const auto& shape = input->get_output_shape(0);
+    return make_shared<op::v1::Reshape>(
+        mvn, op::v0::Constant::create(element::i64, Shape{shape.size()}, shape), false);
+}
+
+}  // namespace
+
+TEST(group_norm_fusion, group_norm_with_affine_transform_and_silu) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, Shape{2, 8, 4, 4});
+    auto norm = create_decomposed_group_norm(input, Shape{2, 4, 32}, {-1});
+    auto scale = op::v0::Constant::create(element::f16, Shape{8, 1, 1}, vector<float>(8, 2.0f));
+    auto bias = op::v0::Constant::create(element::f16, Shape{1, 8, 1, 1}, vector<float>(8, 0.5f));
+    auto multiply = make_shared<op::v1::Multiply>(norm, scale);
+    auto add = make_shared<op::v1::Add>(bias, multiply);
+    auto swish = make_shared<op::v4::Swish>(add);
+    auto model = make_shared<Model>(swish, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::GroupNormFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v6::MVN>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v4::Swish>(model), 0);
+    const auto group_norm = dynamic_pointer_cast<GroupNorm>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_NE(group_norm, nullptr);
+    ASSERT_EQ(group_norm->get_num_groups(), 4u);
+    ASSERT_FLOAT_EQ(group_norm->get_epsilon(), 1e-5f);
+    ASSERT_TRUE(group_norm->is_epsilon_inside_sqrt());
+    ASSERT_TRUE(group_norm->has_silu());
+    ASSERT_EQ(group_norm->get_input_node_shared_ptr(0), input);
+    ASSERT_EQ(group_norm->get_input_shape(1), (Shape{8}));
+    ASSERT_EQ(group_norm->get_input_shape(2), (Shape{8}));
+}
+
+TEST(group_norm_fusion, group_norm_by_multiple_axes_without_affine_transform) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 3, 5});
+    auto model = make_shared<Model>(create_decomposed_group_norm(input, Shape{1, 3, 2, 3, 5}, {2, 3, 4}),
+                                    ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::GroupNormFusion>(model);
+
+    const auto group_norm = dynamic_pointer_cast<GroupNorm>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_NE(group_norm, nullptr);
+    ASSERT_EQ(group_norm->get_num_groups(), 3u);
+    ASSERT_FALSE(group_norm->has_silu());
+    const auto scale = dynamic_pointer_cast<op::v0::Constant>(group_norm->get_input_node_shared_ptr(1));
+    const auto bias = dynamic_pointer_cast<op::v0::Constant>(group_norm->get_input_node_shared_ptr(2));
+    ASSERT_EQ(scale->cast_vector<float>(), vector<float>(6, 1.0f));
+    ASSERT_EQ(bias->cast_vector<float>(), vector<float>(6, 0.0f));
+}
+
+TEST(group_norm_fusion, mvn_not_by_groups_is_not_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 8, 4, 4});
+    auto model = make_shared<Model>(create_decomposed_group_norm(input, Shape{2, 4, 2, 16}, {-1}),
+                                    ParameterVector{input});
+    auto model_ref = model->clone();
+    run_transformation<nvidia_gpu::pass::GroupNormFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<GroupNorm>(model), 0);
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+}  // namespace testing
@@ -0,0 +1,83 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/layer_norm_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/parameter.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/layer_norm.hpp"
+
+using ov::nvidia_gpu::nodes::LayerNorm;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<op::v6::MVN> create_mvn(const shared_ptr<Node>& input, int64_t axis) {
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {axis});
+    return make_shared<op::v6::MVN>(input, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+}
+
+}  // namespace
+
+TEST(layer_norm_fusion, mvn_with_scale_and_bias) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 16, 64});
+    auto mvn = create_mvn(input, -1);
+    auto scale = op::v0::Constant::create(element::f32, Shape{1, 1, 64}, vector<float>(64, 2.0f));
+    auto bias = op::v0::Constant::create(element::f32, Shape{64}, vector<float>(64, 0.5f));
+    auto multiply = make_shared<op::v1::Multiply>(mvn, scale);
+    auto add = make_shared<op::v1::Add>(bias, multiply);
+    auto model = make_shared<Model>(add, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::LayerNormFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v6::MVN>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 0);
+    ASSERT_EQ(count_ops_of_type<LayerNorm>(model), 1);
+    const auto layer_norm = dynamic_pointer_cast<LayerNorm>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_NE(layer_norm, nullptr);
+    ASSERT_FLOAT_EQ(layer_norm->get_epsilon(), 1e-5f);
+    ASSERT_TRUE(layer_norm->is_epsilon_inside_sqrt());
+    ASSERT_EQ(layer_norm->get_input_shape(1), (Shape{64}));
+    const auto fused_scale = dynamic_pointer_cast<op::v0::Constant>(layer_norm->get_input_node_shared_ptr(1));
+    ASSERT_NE(fused_scale, nullptr);
+    ASSERT_EQ(fused_scale->cast_vector<float>(), vector<float>(64, 2.0f));
+    ASSERT_EQ(layer_norm->get_input_node_shared_ptr(2), bias);
+}
+
+TEST(layer_norm_fusion, mvn_without_affine_transform) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, Shape{8, 32});
+    auto model = make_shared<Model>(create_mvn(input, 1), ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::LayerNormFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<LayerNorm>(model), 1);
+    const auto layer_norm = dynamic_pointer_cast<LayerNorm>(model->get_result()->get_input_node_shared_ptr(0));
+    const auto scale = dynamic_pointer_cast<op::v0::Constant>(layer_norm->get_input_node_shared_ptr(1));
+    const auto bias = dynamic_pointer_cast<op::v0::Constant>(layer_norm->get_input_node_shared_ptr(2));
+    ASSERT_EQ(scale->cast_vector<float>(), vector<float>(32, 1.0f));
+    ASSERT_EQ(bias->cast_vector<float>(), vector<float>(32, 0.0f));
+}
+
+TEST(layer_norm_fusion, mvn_by_other_axes_is_not_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 16, 64});
+    auto model = make_shared<Model>(create_mvn(input, 1), ParameterVector{input});
+    auto model_ref = model->clone();
+    run_transformation<nvidia_gpu::pass::LayerNormFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<LayerNorm>(model), 0);
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+}  // namespace testing
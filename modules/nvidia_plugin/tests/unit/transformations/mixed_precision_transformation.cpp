@@ -0,0 +1,102 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/mixed_precision_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/exp.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/softmax.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformations/rt_info/disable_fp16_compression.hpp"
+
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Node> make_reduce_sum(const Output<Node>& input, const vector<int64_t>& axes) {
+    const auto axes_const = op::v0::Constant::create(element::i64, Shape{axes.size()}, axes);
+    return make_shared<op::v1::ReduceSum>(input, axes_const, true);
+}
+
+}  // namespace
+
+TEST(mixed_precision_transformation, exp_and_softmax) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 16});
+    auto exp = make_shared<op::v0::Exp>(input);
+    auto relu = make_shared<op::v0::Relu>(exp);
+    auto softmax = make_shared<op::v8::Softmax>(relu, -1);
+    auto model = make_shared<Model>(softmax, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::MixedPrecisionTransformation>(model);
+
+    EXPECT_TRUE(fp16_compression_is_disabled(exp));
+    EXPECT_FALSE(fp16_compression_is_disabled(relu));
+    EXPECT_TRUE(fp16_compression_is_disabled(softmax));
+}
+
+TEST(mixed_precision_transformation, attention_probabilities) {
+    auto query = make_shared<op::v0::Parameter>(element::f32, Shape{1, 8, 64, 32});
+    auto key = make_shared<op::v0::Parameter>(element::f32, Shape{1, 8, 64, 32});
+    auto value = make_shared<op::v0::Parameter>(element::f32, Shape{1, 8, 64, 32});
+    auto scores = make_shared<op::v0::MatMul>(query, key, false, true);
+    auto softmax = make_shared<op::v8::Softmax>(scores, -1);
+    auto attention = make_shared<op::v0::MatMul>(softmax, value);
+    auto model = make_shared<Model>(attention, ParameterVector{query, key, value});
+
+    run_transformation<nvidia_gpu::pass::MixedPrecisionTransformation>(model);
+
+    EXPECT_FALSE(fp16_compression_is_disabled(softmax));
+}
+
+TEST(mixed_precision_transformation, mvn) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 8, 16, 16});
+    auto last_axis = op::v0::Constant::create(element::i64, Shape{1}, {-1});
+    auto spatial_axes = op::v0::Constant::create(element::i64, Shape{2}, {2, 3});
+    auto layer_norm = make_shared<op::v6::MVN>(input, last_axis, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    auto instance_norm = make_shared<op::v6::MVN>(layer_norm, spatial_axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    auto model = make_shared<Model>(instance_norm, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::MixedPrecisionTransformation>(model);
+
+    EXPECT_FALSE(fp16_compression_is_disabled(layer_norm));
+    EXPECT_TRUE(fp16_compression_is_disabled(instance_norm));
+}
+
+TEST(mixed_precision_transformation, reduce_sum) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{4, 16, 128});
+    auto small = make_reduce_sum(input, {1});
+    auto large = make_reduce_sum(input, {1, 2});
+    auto dynamic_input = make_shared<op::v0::Parameter>(element::f32, PartialShape{4, Dimension::dynamic()});
+    auto dynamic = make_reduce_sum(dynamic_input, {1});
+    auto model = make_shared<Model>(OutputVector{small, large, dynamic}, ParameterVector{input, dynamic_input});
+
+    run_transformation<nvidia_gpu::pass::MixedPrecisionTransformation>(model);
+
+    EXPECT_FALSE(fp16_compression_is_disabled(small));
+    EXPECT_TRUE(fp16_compression_is_disabled(large));
+    EXPECT_TRUE(fp16_compression_is_disabled(dynamic));
+}
+
+TEST(mixed_precision_transformation, f16_model) {
+    auto input = make_shared<op::v0::Parameter>(element::f16, Shape{2, 16});
+    auto exp = make_shared<op::v0::Exp>(input);
+    auto model = make_shared<Model>(exp, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::MixedPrecisionTransformation>(model);
+
+    EXPECT_FALSE(fp16_compression_is_disabled(exp));
+}
+
+}  // namespace testing
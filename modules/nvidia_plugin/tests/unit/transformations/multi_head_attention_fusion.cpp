@@ -0,0 +1,130 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/multi_head_attention_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/softmax.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/fused_multi_head_attention.hpp"
+
+using ov::nvidia_gpu::nodes::FusedMultiHeadAttention;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+constexpr size_t batch = 2;
+constexpr size_t heads = 4;
+constexpr size_t length = 16;
+constexpr size_t head_size = 8;
+
+shared_ptr<FusedMultiHeadAttention> find_attention(const shared_ptr<Model>& model) {
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto attention = dynamic_pointer_cast<FusedMultiHeadAttention>(node)) {
+            return attention;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST(multi_head_attention_fusion, scaled_masked_attention) {
+    const Shape shape{batch, heads, length, head_size};
+    auto q = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto k = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto v = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto mask = make_shared<op::v0::Parameter>(element::f32, Shape{batch, 1, 1, length});
+    auto scores = make_shared<op::v0::MatMul>(q, k, false, true);
+    auto scaled = make_shared<op::v1::Multiply>(scores, op::v0::Constant::create(element::f32, Shape{}, {0.125f}));
+    auto masked = make_shared<op::v1::Add>(scaled, mask);
+    auto softmax = make_shared<op::v8::Softmax>(masked, -1);
+    auto output = make_shared<op::v0::MatMul>(softmax, v);
+    auto model = make_shared<Model>(output, ParameterVector{q, k, v, mask});
+    run_transformation<nvidia_gpu::pass::MultiHeadAttentionFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::MatMul>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v8::Softmax>(model), 0);
+    const auto attention = find_attention(model);
+    ASSERT_NE(attention, nullptr);
+    ASSERT_TRUE(attention->has_mask());
+    ASSERT_TRUE(attention->get_transpose_k());
+    ASSERT_FLOAT_EQ(attention->get_scale(), 0.125f);
+    ASSERT_EQ(attention->get_output_shape(0), shape);
+    ASSERT_EQ(attention->get_input_node_shared_ptr(3), mask);
+}
+
+TEST(multi_head_attention_fusion, divided_attention_with_transposed_keys) {
+    auto q = make_shared<op::v0::Parameter>(element::f16, Shape{batch, length, head_size});
+    auto k = make_shared<op::v0::Parameter>(element::f16, Shape{batch, head_size, length});
+    auto v = make_shared<op::v0::Parameter>(element::f16, Shape{batch, length, head_size});
+    auto scores = make_shared<op::v0::MatMul>(q, k);
+    auto scaled = make_shared<op::v1::Divide>(scores, op::v0::Constant::create(element::f16, Shape{}, {4.0f}));
+    auto softmax = make_shared<op::v1::Softmax>(scaled, 2);
+    auto output = make_shared<op::v0::MatMul>(softmax, v);
+    auto model = make_shared<Model>(output, ParameterVector{q, k, v});
+    run_transformation<nvidia_gpu::pass::MultiHeadAttentionFusion>(model);
+
+    const auto attention = find_attention(model);
+    ASSERT_NE(attention, nullptr);
+    ASSERT_FALSE(attention->has_mask());
+    ASSERT_FALSE(attention->get_transpose_k());
+    ASSERT_FLOAT_EQ(attention->get_scale(), 0.25f);
+    ASSERT_EQ(attention->get_output_shape(0), (Shape{batch, length, head_size}));
+}
+
+TEST(multi_head_attention_fusion, scaled_mask_added_before_scores) {
+    const Shape shape{batch, heads, length, head_size};
+    auto q = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto k = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto v = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto mask = make_shared<op::v0::Parameter>(element::f32, Shape{batch, 1, 1, length});
+    auto scaled_mask =
+        make_shared<op::v1::Multiply>(mask, op::v0::Constant::create(element::f32, Shape{}, {-10000.0f}));
+    auto scores = make_shared<op::v0::MatMul>(q, k, false, true);
+    auto masked = make_shared<op::v1::Add>(scaled_mask, scores);
+    auto softmax = make_shared<op::v8::Softmax>(masked, -1);
+    auto output = make_shared<op::v0::MatMul>(softmax, v);
+    auto model = make_shared<Model>(output, ParameterVector{q, k, v, mask});
+    run_transformation<nvidia_gpu::pass::MultiHeadAttentionFusion>(model);
+
+    const auto attention = find_attention(model);
+    ASSERT_NE(attention, nullptr);
+    ASSERT_TRUE(attention->has_mask());
+    ASSERT_FLOAT_EQ(attention->get_scale(), 1.0f);
+    ASSERT_EQ(attention->get_input_node_shared_ptr(3), scaled_mask);
+}
+
+TEST(multi_head_attention_fusion, attention_with_used_scores_is_not_fused) {
+    const Shape shape{batch, heads, length, head_size};
+    auto q = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto k = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto v = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto scores = make_shared<op::v0::MatMul>(q, k, false, true);
+    auto softmax = make_shared<op::v8::Softmax>(scores, -1);
+    auto output = make_shared<op::v0::MatMul>(softmax, v);
+    auto relu = make_shared<op::v0::Relu>(scores);
+    auto model = make_shared<Model>(OutputVector{output, relu}, ParameterVector{q, k, v});
+    auto model_ref = model->clone();
+    run_transformation<nvidia_gpu::pass::MultiHeadAttentionFusion>(model);
+
+    ASSERT_EQ(find_attention(model), nullptr);
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+}  // namespace testing
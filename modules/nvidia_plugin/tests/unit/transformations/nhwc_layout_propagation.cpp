@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/nhwc_layout_propagation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/opsets/opset10.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/init_node_info.hpp"
+#include "transformer/nodes/fused_convolution.hpp"
+#include "transformer/nodes/group_norm.hpp"
+#include "transformer/nodes/nhwc_reorder.hpp"
+
+using ov::nvidia_gpu::nodes::FusedConvolution;
+using ov::nvidia_gpu::nodes::GroupNorm;
+using ov::nvidia_gpu::nodes::NhwcReorder;
+using ActivationMode = ov::nvidia_gpu::nodes::ActivationMode;
+using namespace ov;
+using namespace ov::opset10;
+using namespace std;
+
+namespace {
+
+constexpr size_t kChannels = 2;
+
+shared_ptr<Node> createConvolution(const Output<Node>& input) {
+    vector<float> filter_values(kChannels * kChannels * 2);
+    iota(filter_values.begin(), filter_values.end(), 0.0f);
+    auto filter = Constant::create(element::f16, Shape{kChannels, kChannels, 1, 2}, filter_values);
+    auto bias = Constant::create(element::f16, Shape{1, kChannels, 1, 1}, {0});
+    return make_shared<FusedConvolution>(input,
+                                         filter,
+                                         bias,
+                                         Strides{1, 1},
+                                         CoordinateDiff{0, 0},
+                                         CoordinateDiff{0, 1},
+                                         Strides{1, 1},
+                                         op::PadType::EXPLICIT,
+                                         ActivationMode::RELU);
+}
+
+shared_ptr<Model> createModel(size_t num_convolutions) {
+    auto input = make_shared<Parameter>(element::f16, Shape{1, kChannels, 4, 4});
+    Output<Node> output = input;
+    for (size_t i = 0; i < num_convolutions; ++i) {
+        output = createConvolution(output);
+        if (i % 2 == 1) {
+            output = make_shared<Sigmoid>(output);
+        }
+    }
+    return make_shared<Model>(make_shared<Result>(output), ParameterVector{input});
+}
+
+void runPass(const shared_ptr<Model>& model) {
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::NhwcLayoutPropagation>();
+    pass_manager.run_passes(model);
+}
+
+}  // namespace
+
+TEST(nhwc_layout_propagation, convert_region_of_convolutions) {
+    const auto model = createModel(4);
+    runPass(model);
+
+    ASSERT_EQ(count_ops_of_type<NhwcReorder>(model), 2);
+    for (const auto& node : model->get_ops()) {
+        if (const auto conv = as_type_ptr<FusedConvolution>(node)) {
+            ASSERT_TRUE(conv->is_nhwc_layout());
+            ASSERT_EQ(as_type_ptr<Constant>(conv->get_input_node_shared_ptr(1))->cast_vector<float>(),
+                      (vector<float>{0, 2, 1, 3, 4, 6, 5, 7}));
+        }
+    }
+    const auto reorder = as_type_ptr<NhwcReorder>(model->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(reorder);
+    ASSERT_FALSE(reorder->is_to_nhwc());
+}
+
+TEST(nhwc_layout_propagation, keep_few_convolutions) {
+    const auto model = createModel(2);
+    runPass(model);
+
+    ASSERT_EQ(count_ops_of_type<NhwcReorder>(model), 0);
+    for (const auto& node : model->get_ops()) {
+        if (const auto conv = as_type_ptr<FusedConvolution>(node)) {
+            ASSERT_FALSE(conv->is_nhwc_layout());
+        }
+    }
+}
+
+TEST(nhwc_layout_propagation, absorb_transposes_at_boundaries) {
+    auto input = make_shared<Parameter>(element::f16, Shape{1, 4, 4, kChannels});
+    auto to_nchw = make_shared<Transpose>(input, Constant::create(element::i64, Shape{4}, {0, 3, 1, 2}));
+    auto conv = createConvolution(createConvolution(to_nchw));
+    auto to_nhwc = make_shared<Transpose>(conv, Constant::create(element::i64, Shape{4}, {0, 2, 3, 1}));
+    const auto model = make_shared<Model>(make_shared<Result>(to_nhwc), ParameterVector{input});
+    runPass(model);
+
+    ASSERT_EQ(count_ops_of_type<NhwcReorder>(model), 0);
+    ASSERT_EQ(count_ops_of_type<Transpose>(model), 0);
+    ASSERT_EQ(count_ops_of_type<Reshape>(model), 2);
+    const auto output = model->get_results()[0]->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(as_type_ptr<Reshape>(output));
+    ASSERT_EQ(output->get_output_shape(0), (Shape{1, 4, 4, kChannels}));
+    ASSERT_TRUE(as_type_ptr<FusedConvolution>(output->get_input_node_shared_ptr(0))->is_nhwc_layout());
+}
+
+TEST(nhwc_layout_propagation, group_norm_joins_region) {
+    auto input = make_shared<Parameter>(element::f16, Shape{1, kChannels, 4, 4});
+    auto scale = Constant::create(element::f16, Shape{kChannels}, {1});
+    auto bias = Constant::create(element::f16, Shape{kChannels}, {0});
+    auto conv = createConvolution(createConvolution(input));
+    auto group_norm = make_shared<GroupNorm>(conv, scale, bias, 1, 1e-5f, true, true);
+    auto output = createConvolution(createConvolution(group_norm));
+    const auto model = make_shared<Model>(make_shared<Result>(output), ParameterVector{input});
+    runPass(model);
+
+    ASSERT_EQ(count_ops_of_type<NhwcReorder>(model), 2);
+    ASSERT_TRUE(group_norm->is_nhwc_layout());
+}
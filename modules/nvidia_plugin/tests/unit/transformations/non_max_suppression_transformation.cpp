@@ -0,0 +1,83 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/non_max_suppression_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/non_max_suppression.hpp"
+#include "openvino/op/parameter.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/non_max_suppression.hpp"
+
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Model> create_nms9(const Shape& boxes_shape, const Shape& scores_shape, float soft_nms_sigma) {
+    auto boxes = make_shared<op::v0::Parameter>(element::f32, boxes_shape);
+    auto scores = make_shared<op::v0::Parameter>(element::f32, scores_shape);
+    auto max_output = op::v0::Constant::create(element::i64, Shape{}, {10});
+    auto iou_threshold = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+    auto score_threshold = op::v0::Constant::create(element::f32, Shape{}, {0.1f});
+    auto sigma = op::v0::Constant::create(element::f32, Shape{}, {soft_nms_sigma});
+    auto nms = make_shared<op::v9::NonMaxSuppression>(boxes,
+                                                      scores,
+                                                      max_output,
+                                                      iou_threshold,
+                                                      score_threshold,
+                                                      sigma,
+                                                      op::v9::NonMaxSuppression::BoxEncodingType::CENTER,
+                                                      false,
+                                                      element::i32);
+    return make_shared<Model>(nms->outputs(), ParameterVector{boxes, scores});
+}
+
+}  // namespace
+
+TEST(non_max_suppression_transformation, nms9_to_static_outputs) {
+    auto model = create_nms9(Shape{2, 100, 4}, Shape{2, 3, 100}, 0.0f);
+    run_transformation<nvidia_gpu::pass::NonMaxSuppressionTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v9::NonMaxSuppression>(model), 0);
+    ASSERT_EQ(count_ops_of_type<nvidia_gpu::nodes::NonMaxSuppression>(model), 1);
+    const auto nms = dynamic_pointer_cast<nvidia_gpu::nodes::NonMaxSuppression>(
+        model->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(nms, nullptr);
+    ASSERT_EQ(nms->get_max_output_boxes_per_class(), 10);
+    ASSERT_FLOAT_EQ(nms->get_iou_threshold(), 0.5f);
+    ASSERT_FLOAT_EQ(nms->get_score_threshold(), 0.1f);
+    ASSERT_TRUE(nms->is_center_point_box());
+    ASSERT_FALSE(nms->is_sort_result_descending());
+    ASSERT_EQ(nms->get_output_element_type(0), element::i32);
+    ASSERT_EQ(nms->get_output_shape(0), (Shape{60, 3}));
+    ASSERT_EQ(nms->get_output_shape(1), (Shape{60, 3}));
+    ASSERT_EQ(nms->get_output_shape(2), (Shape{1}));
+}
+
+TEST(non_max_suppression_transformation, soft_nms_is_not_transformed) {
+    auto model = create_nms9(Shape{1, 10, 4}, Shape{1, 1, 10}, 0.5f);
+    run_transformation<nvidia_gpu::pass::NonMaxSuppressionTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v9::NonMaxSuppression>(model), 1);
+    ASSERT_EQ(count_ops_of_type<nvidia_gpu::nodes::NonMaxSuppression>(model), 0);
+}
+
+TEST(non_max_suppression_transformation, dynamic_boxes_are_not_transformed) {
+    auto model = create_nms9(Shape{1, 10, 4}, Shape{1, 1, 10}, 0.0f);
+    model->get_parameters()[0]->set_partial_shape(PartialShape{1, Dimension::dynamic(), 4});
+    model->get_parameters()[1]->set_partial_shape(PartialShape{1, 1, Dimension::dynamic()});
+    model->validate_nodes_and_infer_types();
+    run_transformation<nvidia_gpu::pass::NonMaxSuppressionTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<nvidia_gpu::nodes::NonMaxSuppression>(model), 0);
+}
+
+}  // namespace testing
@@ -0,0 +1,147 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/pooling_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/avg_pool.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reshape.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/depthwise_convolution_max_pool.hpp"
+#include "transformer/nodes/fully_connected.hpp"
+#include "transformer/nodes/fused_convolution.hpp"
+#include "transformer/nodes/global_avg_pool_fully_connected.hpp"
+
+using ov::nvidia_gpu::nodes::ActivationMode;
+using ov::nvidia_gpu::nodes::DepthwiseConvolutionMaxPool;
+using ov::nvidia_gpu::nodes::FullyConnected;
+using ov::nvidia_gpu::nodes::FusedGroupConvolution;
+using ov::nvidia_gpu::nodes::GlobalAvgPoolFullyConnected;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<FusedGroupConvolution> create_depthwise_convolution(const shared_ptr<Node>& input, size_t kernel_size) {
+    const auto channels = input->get_output_shape(0)[1];
+    const Shape filter_shape{channels, 1, 1, kernel_size, kernel_size};
+    auto filter =
+        op::v0::Constant::create(element::f32, filter_shape, vector<float>(shape_size(filter_shape), 0.1f));
+    auto bias = op::v0::Constant::create(element::f32, Shape{1, channels, 1, 1}, vector<float>(channels, 0.5f));
+    const auto pad = static_cast<std::ptrdiff_t>(kernel_size / 2);
+    return make_shared<FusedGroupConvolution>(input,
+                                              filter,
+                                              bias,
+                                              Strides{1, 1},
+                                              CoordinateDiff{pad, pad},
+                                              CoordinateDiff{pad, pad},
+                                              Strides{1, 1},
+                                              op::PadType::EXPLICIT,
+                                              ActivationMode::RELU);
+}
+
+shared_ptr<op::v1::MaxPool> create_max_pool(const shared_ptr<Node>& input, size_t size, size_t stride) {
+    return make_shared<op::v1::MaxPool>(
+        input, Strides{stride, stride}, Shape{0, 0}, Shape{0, 0}, Shape{size, size}, op::RoundingType::FLOOR);
+}
+
+shared_ptr<FullyConnected> create_fully_connected(const shared_ptr<Node>& input, size_t n) {
+    const auto k = input->get_output_shape(0)[1];
+    auto weights = op::v0::Constant::create(element::f32, Shape{n, k}, vector<float>(n * k, 0.1f));
+    auto bias = op::v0::Constant::create(element::f32, Shape{n}, vector<float>(n, 0.5f));
+    return make_shared<FullyConnected>(input, weights, bias, false, true, ActivationMode::RELU, 2.0f);
+}
+
+shared_ptr<Node> flatten(const shared_ptr<Node>& input) {
+    const auto& shape = input->get_output_shape(0);
+    auto target = op::v0::Constant::create(element::i64, Shape{2}, {shape[0], shape[1]});
+    return make_shared<op::v1::Reshape>(input, target, false);
+}
+
+}  // namespace
+
+TEST(pooling_fusion, max_pool_of_depthwise_convolution) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 32, 28, 28});
+    auto conv = create_depthwise_convolution(input, 3);
+    auto pool = create_max_pool(conv, 2, 2);
+    auto model = make_shared<Model>(pool, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::FuseMaxPoolToDepthwiseConvolution>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::MaxPool>(model), 0);
+    ASSERT_EQ(count_ops_of_type<FusedGroupConvolution>(model), 0);
+    const auto fused =
+        dynamic_pointer_cast<DepthwiseConvolutionMaxPool>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_NE(fused, nullptr);
+    ASSERT_EQ(fused->get_pool_size(), 2);
+    ASSERT_EQ(fused->get_activation(), ActivationMode::RELU);
+    ASSERT_EQ(fused->get_convolution_output_shape(), (Shape{1, 32, 28, 28}));
+    ASSERT_EQ(fused->get_output_shape(0), (Shape{1, 32, 14, 14}));
+}
+
+TEST(pooling_fusion, overlapping_max_pool_is_not_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 32, 28, 28});
+    auto conv = create_depthwise_convolution(input, 3);
+    auto pool = create_max_pool(conv, 3, 2);
+    auto model = make_shared<Model>(pool, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::FuseMaxPoolToDepthwiseConvolution>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::MaxPool>(model), 1);
+    ASSERT_EQ(count_ops_of_type<DepthwiseConvolutionMaxPool>(model), 0);
+}
+
+TEST(pooling_fusion, reduce_mean_and_fully_connected) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 64, 7, 7});
+    auto axes = op::v0::Constant::create(element::i64, Shape{2}, {-1, 2});
+    auto mean = make_shared<op::v1::ReduceMean>(input, axes, true);
+    auto fully_connected = create_fully_connected(flatten(mean), 10);
+    auto model = make_shared<Model>(fully_connected, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::FuseGlobalAvgPoolToFullyConnected>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::ReduceMean>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(model), 0);
+    ASSERT_EQ(count_ops_of_type<FullyConnected>(model), 0);
+    const auto fused =
+        dynamic_pointer_cast<GlobalAvgPoolFullyConnected>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_NE(fused, nullptr);
+    ASSERT_EQ(fused->get_input_node_shared_ptr(0), input);
+    ASSERT_TRUE(fused->get_transpose_b());
+    ASSERT_EQ(fused->get_activation(), ActivationMode::RELU);
+    ASSERT_FLOAT_EQ(fused->get_output_scale(), 2.0f);
+    ASSERT_EQ(fused->get_output_shape(0), (Shape{2, 10}));
+}
+
+TEST(pooling_fusion, global_avg_pool_and_fully_connected) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 64, 7, 7});
+    auto pool = make_shared<op::v1::AvgPool>(
+        input, Strides{1, 1}, Shape{0, 0}, Shape{0, 0}, Shape{7, 7}, true, op::RoundingType::FLOOR);
+    auto model = make_shared<Model>(create_fully_connected(flatten(pool), 10), ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::FuseGlobalAvgPoolToFullyConnected>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::AvgPool>(model), 0);
+    ASSERT_EQ(count_ops_of_type<GlobalAvgPoolFullyConnected>(model), 1);
+}
+
+TEST(pooling_fusion, partial_mean_is_not_fused) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 64, 7, 7});
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {3});
+    auto mean = make_shared<op::v1::ReduceMean>(input, axes, false);
+    auto target = op::v0::Constant::create(element::i64, Shape{2}, {1, 64 * 7});
+    auto reshape = make_shared<op::v1::Reshape>(mean, target, false);
+    auto model = make_shared<Model>(create_fully_connected(reshape, 10), ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::FuseGlobalAvgPoolToFullyConnected>(model);
+
+    ASSERT_EQ(count_ops_of_type<FullyConnected>(model), 1);
+    ASSERT_EQ(count_ops_of_type<GlobalAvgPoolFullyConnected>(model), 0);
+}
+
+}  // namespace testing
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/opsets/opset10.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/init_node_info.hpp"
+#include "transformer/matmul_transformations.hpp"
+
+using namespace ov;
+using namespace std;
+
+TEST(prepack_matmul_weights, transpose_constant_weights) {
+    std::shared_ptr<Model> model;
+    {
+        auto input = make_shared<opset10::Parameter>(element::f32, Shape{4, 2});
+        auto weights = opset10::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+        auto matmul = make_shared<opset10::MatMul>(input, weights, false, false);
+        model = make_shared<Model>(matmul, ParameterVector{input});
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::PrepackMatMulWeightsTransformation>();
+    pass_manager.run_passes(model);
+
+    const auto matmul = ov::as_type_ptr<opset10::MatMul>(model->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(matmul);
+    ASSERT_TRUE(matmul->get_transpose_b());
+    const auto weights = ov::as_type_ptr<opset10::Constant>(matmul->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(weights);
+    ASSERT_EQ(weights->get_shape(), (Shape{3, 2}));
+    ASSERT_EQ(weights->cast_vector<float>(), (std::vector<float>{1, 4, 2, 5, 3, 6}));
+}
+
+TEST(prepack_matmul_weights, keep_shared_weights) {
+    std::shared_ptr<Model> model;
+    {
+        auto input = make_shared<opset10::Parameter>(element::f32, Shape{4, 2});
+        auto weights = opset10::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+        auto matmul0 = make_shared<opset10::MatMul>(input, weights, false, false);
+        auto matmul1 = make_shared<opset10::MatMul>(matmul0, weights, false, false);
+        model = make_shared<Model>(matmul1, ParameterVector{input});
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::PrepackMatMulWeightsTransformation>();
+    pass_manager.run_passes(model);
+
+    for (const auto& node : model->get_ops()) {
+        if (const auto matmul = ov::as_type_ptr<opset10::MatMul>(node)) {
+            ASSERT_FALSE(matmul->get_transpose_b());
+        }
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/shape_subgraph_folding.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformations/rt_info/disable_constant_folding.hpp"
+
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+TEST(shape_subgraph_folding, shape_of_gather_concat_reshape) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 4});
+    auto shape_of = make_shared<op::v3::ShapeOf>(input, element::i64);
+    pass::disable_constant_folding(shape_of);
+    auto indices = op::v0::Constant::create(element::i64, Shape{1}, {0});
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {0});
+    auto batch = make_shared<op::v8::Gather>(shape_of, indices, axis);
+    auto rest = op::v0::Constant::create(element::i64, Shape{1}, {-1});
+    auto concat = make_shared<op::v0::Concat>(OutputVector{batch, rest}, 0);
+    auto reshape = make_shared<op::v1::Reshape>(input, concat, true);
+    auto model = make_shared<Model>(reshape, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ShapeSubgraphFolding>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v3::ShapeOf>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v8::Gather>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Concat>(model), 0);
+    const auto pattern = dynamic_pointer_cast<op::v0::Constant>(
+        model->get_result()->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(1));
+    ASSERT_NE(pattern, nullptr);
+    ASSERT_EQ(pattern->cast_vector<int64_t>(), (vector<int64_t>{2, -1}));
+}
+
+TEST(shape_subgraph_folding, weights_decompression_is_kept) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto weights = op::v0::Constant::create(element::f16, Shape{2, 3}, vector<float>(6, 1.0f));
+    auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+    pass::disable_constant_folding(convert);
+    auto shape_of = make_shared<op::v3::ShapeOf>(convert, element::i64);
+    auto reshape = make_shared<op::v1::Reshape>(input, shape_of, false);
+    auto model = make_shared<Model>(OutputVector{reshape, convert}, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ShapeSubgraphFolding>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v3::ShapeOf>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 1);
+}
+
+}  // namespace testing
@@ -0,0 +1,105 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/sparse_matmul_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/sparse_matmul.hpp"
+
+using ov::nvidia_gpu::nodes::SparseMatMul;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+/**
+ * @returns Value of weights [n, k], which has 2 non-zero values in each group of 4 values along k if sparse
+ */
+float weight(size_t in, size_t ik, bool sparse) {
+    const float value = static_cast<float>(static_cast<int>((in * 7 + ik) % 13) - 6) * 0.5f + 0.25f;
+    return sparse && (ik + in) % 4 >= 2 ? 0.0f : value;
+}
+
+shared_ptr<Model> create_model(const Shape& input_shape, size_t n, bool transpose_b, bool sparse) {
+    const size_t k = input_shape.back();
+    auto input = make_shared<op::v0::Parameter>(element::f16, input_shape);
+    vector<float> values(n * k);
+    for (size_t in = 0; in < n; ++in) {
+        for (size_t ik = 0; ik < k; ++ik) {
+            values[transpose_b ? in * k + ik : ik * n + in] = weight(in, ik, sparse);
+        }
+    }
+    auto weights = op::v0::Constant::create(element::f16, transpose_b ? Shape{n, k} : Shape{k, n}, values);
+    auto matmul = make_shared<op::v0::MatMul>(input, weights, false, transpose_b);
+    return make_shared<Model>(matmul, ParameterVector{input});
+}
+
+size_t count_sparse_matmuls(const shared_ptr<Model>& model) {
+    size_t count = 0;
+    for (const auto& node : model->get_ops()) {
+        count += is_type<SparseMatMul>(node);
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(sparse_matmul, sparse_weights_are_transposed_to_n_k) {
+    const size_t k = 64;
+    const size_t n = 32;
+    for (const bool transpose_b : {false, true}) {
+        auto model = create_model(Shape{16, k}, n, transpose_b, true);
+        run_transformation<nvidia_gpu::pass::SparseMatMulTransformation>(model);
+        ASSERT_NO_THROW(check_rt_info(model));
+
+        const auto sparse_matmul =
+            as_type_ptr<SparseMatMul>(model->get_results()[0]->get_input_node_shared_ptr(0));
+        ASSERT_TRUE(sparse_matmul);
+        ASSERT_EQ(sparse_matmul->get_output_shape(0), (Shape{16, n}));
+        const auto& weights = sparse_matmul->get_weights();
+        ASSERT_EQ(weights->get_shape(), (Shape{n, k}));
+        const auto values = weights->cast_vector<float>();
+        for (size_t in = 0; in < n; ++in) {
+            for (size_t ik = 0; ik < k; ++ik) {
+                ASSERT_EQ(values[in * k + ik], weight(in, ik, true));
+            }
+        }
+    }
+}
+
+TEST(sparse_matmul, dense_weights_are_not_converted) {
+    auto model = create_model(Shape{16, 64}, 32, true, false);
+    run_transformation<nvidia_gpu::pass::SparseMatMulTransformation>(model);
+    ASSERT_EQ(count_sparse_matmuls(model), 0);
+}
+
+TEST(sparse_matmul, unaligned_dimensions_are_not_converted) {
+    auto rows = create_model(Shape{10, 64}, 32, true, true);
+    run_transformation<nvidia_gpu::pass::SparseMatMulTransformation>(rows);
+    ASSERT_EQ(count_sparse_matmuls(rows), 0);
+
+    auto columns = create_model(Shape{16, 64}, 24, true, true);
+    run_transformation<nvidia_gpu::pass::SparseMatMulTransformation>(columns);
+    ASSERT_EQ(count_sparse_matmuls(columns), 0);
+}
+
+TEST(sparse_matmul, f32_is_not_converted) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{16, 64});
+    auto weights = op::v0::Constant::create(element::f32, Shape{64, 32}, vector<float>(64 * 32, 0.0f));
+    auto matmul = make_shared<op::v0::MatMul>(input, weights);
+    auto model = make_shared<Model>(matmul, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::SparseMatMulTransformation>(model);
+    ASSERT_EQ(count_sparse_matmuls(model), 0);
+}
+
+}  // namespace testing
@@ -0,0 +1,124 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/sub_pixel_convolution.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/sub_pixel_shuffle.hpp"
+
+using ov::nvidia_gpu::nodes::SubPixelShuffle;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<op::v1::ConvolutionBackpropData> create_deconvolution(const shared_ptr<Node>& input,
+                                                                 size_t out_channels,
+                                                                 size_t kernel_size,
+                                                                 size_t stride,
+                                                                 std::ptrdiff_t pad,
+                                                                 std::ptrdiff_t output_padding = 0) {
+    const auto in_channels = input->get_output_shape(0)[1];
+    const Shape weights_shape{in_channels, out_channels, kernel_size, kernel_size};
+    vector<float> weights(shape_size(weights_shape));
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = static_cast<float>(i);
+    }
+    return make_shared<op::v1::ConvolutionBackpropData>(
+        input,
+        op::v0::Constant::create(element::f32, weights_shape, weights),
+        Strides{stride, stride},
+        CoordinateDiff{pad, pad},
+        CoordinateDiff{pad, pad},
+        Strides{1, 1},
+        op::PadType::EXPLICIT,
+        CoordinateDiff{output_padding, output_padding});
+}
+
+}  // namespace
+
+TEST(sub_pixel_convolution, stride_2_deconvolution) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 8, 16, 16});
+    auto deconv = create_deconvolution(input, 4, 4, 2, 1);
+    ASSERT_EQ(deconv->get_output_shape(0), (Shape{1, 4, 32, 32}));
+    auto model = make_shared<Model>(deconv, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ConvolutionBackpropDataToSubPixelConvolution>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::ConvolutionBackpropData>(model), 0);
+    const auto shuffle = dynamic_pointer_cast<SubPixelShuffle>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_NE(shuffle, nullptr);
+    ASSERT_EQ(shuffle->get_block_size(), 2);
+    ASSERT_EQ(shuffle->get_crop_begin(), (Shape{1, 1}));
+    ASSERT_EQ(shuffle->get_output_shape(0), (Shape{1, 4, 32, 32}));
+    const auto conv = dynamic_pointer_cast<op::v1::Convolution>(shuffle->get_input_node_shared_ptr(0));
+    ASSERT_NE(conv, nullptr);
+    ASSERT_EQ(conv->get_strides(), (Strides{1, 1}));
+    ASSERT_EQ(conv->get_pads_begin(), (CoordinateDiff{1, 1}));
+    ASSERT_EQ(conv->get_output_shape(0), (Shape{1, 16, 17, 17}));
+
+    // Phase (1, 0) of output channel 2 and input channel 3 takes flipped weights at rows 1, 3 and columns 0, 2
+    const auto weights = dynamic_pointer_cast<op::v0::Constant>(conv->get_input_node_shared_ptr(1));
+    ASSERT_NE(weights, nullptr);
+    ASSERT_EQ(weights->get_shape(), (Shape{16, 8, 2, 2}));
+    const auto values = weights->cast_vector<float>();
+    const auto original = [](size_t ci, size_t co, size_t ky, size_t kx) {
+        return static_cast<float>(((ci * 4 + co) * 4 + ky) * 4 + kx);
+    };
+    const size_t oc = (1 * 2 + 0) * 4 + 2;
+    const auto tap = [&](size_t ty, size_t tx) { return values[((oc * 8 + 3) * 2 + ty) * 2 + tx]; };
+    ASSERT_EQ(tap(0, 0), original(3, 2, 3, 2));
+    ASSERT_EQ(tap(0, 1), original(3, 2, 3, 0));
+    ASSERT_EQ(tap(1, 0), original(3, 2, 1, 2));
+    ASSERT_EQ(tap(1, 1), original(3, 2, 1, 0));
+}
+
+TEST(sub_pixel_convolution, bias_and_activation_are_applied_to_phases) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 8, 16, 16});
+    auto deconv = create_deconvolution(input, 4, 3, 2, 1, 1);
+    auto bias = op::v0::Constant::create(element::f32, Shape{1, 4, 1, 1}, {1.0f, 2.0f, 3.0f, 4.0f});
+    auto add = make_shared<op::v1::Add>(deconv, bias);
+    auto relu = make_shared<op::v0::Relu>(add);
+    auto model = make_shared<Model>(relu, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ConvolutionBackpropDataToSubPixelConvolution>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::ConvolutionBackpropData>(model), 0);
+    const auto shuffle = dynamic_pointer_cast<SubPixelShuffle>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_NE(shuffle, nullptr);
+    ASSERT_EQ(shuffle->get_output_shape(0), (Shape{1, 4, 32, 32}));
+    const auto new_relu = shuffle->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(is_type<op::v0::Relu>(new_relu));
+    const auto new_add = new_relu->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(is_type<op::v1::Add>(new_add));
+    ASSERT_TRUE(is_type<op::v1::Convolution>(new_add->get_input_node_shared_ptr(0)));
+    const auto new_bias = dynamic_pointer_cast<op::v0::Constant>(new_add->get_input_node_shared_ptr(1));
+    ASSERT_NE(new_bias, nullptr);
+    ASSERT_EQ(new_bias->get_shape(), (Shape{1, 16, 1, 1}));
+    const auto values = new_bias->cast_vector<float>();
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], static_cast<float>(i % 4 + 1));
+    }
+}
+
+TEST(sub_pixel_convolution, unit_stride_deconvolution_is_kept) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 8, 16, 16});
+    auto deconv = create_deconvolution(input, 4, 3, 1, 1);
+    auto model = make_shared<Model>(deconv, ParameterVector{input});
+    run_transformation<nvidia_gpu::pass::ConvolutionBackpropDataToSubPixelConvolution>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::ConvolutionBackpropData>(model), 1);
+    ASSERT_EQ(count_ops_of_type<SubPixelShuffle>(model), 0);
+}
+
+}  // namespace testing
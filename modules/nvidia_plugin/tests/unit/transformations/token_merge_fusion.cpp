@@ -0,0 +1,164 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/token_merge_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather_elements.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_l2.hpp"
+#include "openvino/op/scatter_elements_update.hpp"
+#include "openvino/op/scatter_update.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/topk.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/token_merge.hpp"
+
+using ov::nvidia_gpu::nodes::TokenMerge;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Node> i64_constant(const vector<int64_t>& values) {
+    return op::v0::Constant::create(element::i64, Shape{values.size()}, values);
+}
+
+shared_ptr<Node> slice_tokens(const Output<Node>& data, int64_t start, int64_t stop, int64_t step) {
+    return make_shared<op::v8::Slice>(
+        data, i64_constant({start}), i64_constant({stop}), i64_constant({step}), i64_constant({1}));
+}
+
+shared_ptr<Node> topk(const Output<Node>& data, size_t k, int64_t axis, const string& mode) {
+    const auto count = op::v0::Constant::create(element::i64, Shape{}, {k});
+    return make_shared<op::v11::TopK>(data, count, axis, mode, "value");
+}
+
+/**
+ * Creates token merging of ToMe (bipartite_soft_matching and merge_wavg) as it is exported to OpenVINO
+ */
+shared_ptr<Model> create_token_merging(const element::Type& type,
+                                       const Shape& shape,
+                                       size_t metric_channels,
+                                       size_t num_merged,
+                                       bool class_token,
+                                       bool normalized = true) {
+    const auto batch = shape[0];
+    const auto even_tokens = (shape[1] + 1) / 2;
+    const auto odd_tokens = shape[1] / 2;
+    const auto r = static_cast<int64_t>(num_merged);
+    const auto end = numeric_limits<int64_t>::max();
+    auto metric = make_shared<op::v0::Parameter>(type, Shape{batch, shape[1], metric_channels});
+    auto x = make_shared<op::v0::Parameter>(type, shape);
+    auto size = make_shared<op::v0::Parameter>(type, Shape{batch, shape[1], 1});
+
+    shared_ptr<Node> normalized_metric = metric;
+    if (normalized) {
+        auto norm = make_shared<op::v4::ReduceL2>(metric, i64_constant({-1}), true);
+        normalized_metric = make_shared<op::v1::Divide>(metric, norm);
+    }
+    shared_ptr<Node> scores = make_shared<op::v0::MatMul>(
+        slice_tokens(normalized_metric, 0, end, 2), slice_tokens(normalized_metric, 1, end, 2), false, true);
+    if (class_token) {
+        auto updates = op::v0::Constant::create(
+            type, Shape{batch, 1, odd_tokens}, vector<float>(batch * odd_tokens, -numeric_limits<float>::infinity()));
+        scores = make_shared<op::v3::ScatterUpdate>(scores, i64_constant({0}), updates, i64_constant({1}));
+    }
+    auto node = make_shared<op::v11::TopK>(scores,
+                                           op::v0::Constant::create(element::i64, Shape{}, {1}),
+                                           -1,
+                                           op::TopKMode::MAX,
+                                           op::TopKSortType::NONE);
+    auto node_max = make_shared<op::v0::Squeeze>(node->output(0), i64_constant({2}));
+    auto edge = make_shared<op::v0::Unsqueeze>(topk(node_max, even_tokens, -1, "max")->output(1), i64_constant({2}));
+    Output<Node> unmerged = slice_tokens(edge, r, end, 1);
+    if (class_token) {
+        unmerged = topk(unmerged, even_tokens - num_merged, 1, "min")->output(0);
+    }
+    auto sources = slice_tokens(edge, 0, r, 1);
+    auto destinations = make_shared<op::v6::GatherElements>(node->output(1), sources, 1);
+
+    auto merge = [&](const Output<Node>& value) {
+        const auto channels = value.get_shape()[2];
+        auto expand = [&](const Output<Node>& index, size_t tokens) {
+            return make_shared<op::v3::Broadcast>(index, i64_constant({static_cast<int64_t>(batch),
+                                                                       static_cast<int64_t>(tokens),
+                                                                       static_cast<int64_t>(channels)}));
+        };
+        auto even = slice_tokens(value, 0, end, 2);
+        auto odd = slice_tokens(value, 1, end, 2);
+        auto kept = make_shared<op::v6::GatherElements>(even, expand(unmerged, even_tokens - num_merged), 1);
+        auto merged = make_shared<op::v6::GatherElements>(even, expand(sources, num_merged), 1);
+        auto summed = make_shared<op::v12::ScatterElementsUpdate>(odd,
+                                                                  expand(destinations, num_merged),
+                                                                  merged,
+                                                                  i64_constant({1}),
+                                                                  op::v12::ScatterElementsUpdate::Reduction::SUM,
+                                                                  true);
+        return make_shared<op::v0::Concat>(OutputVector{kept, summed}, 1);
+    };
+    auto merged_x = merge(make_shared<op::v1::Multiply>(x, size));
+    auto merged_size = merge(size);
+    auto y = make_shared<op::v1::Divide>(merged_x, merged_size);
+    return make_shared<Model>(OutputVector{y, merged_size}, ParameterVector{metric, x, size});
+}
+
+}  // namespace
+
+TEST(token_merge_fusion, token_merging) {
+    auto model = create_token_merging(element::f16, Shape{2, 16, 24}, 8, 5, false);
+    run_transformation<nvidia_gpu::pass::TokenMergeFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v6::GatherElements>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v12::ScatterElementsUpdate>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v11::TopK>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::MatMul>(model), 0);
+    const auto token_merge =
+        dynamic_pointer_cast<TokenMerge>(model->output(0).get_node()->get_input_node_shared_ptr(0));
+    ASSERT_NE(token_merge, nullptr);
+    ASSERT_EQ(model->output(1).get_node()->input_value(0), token_merge->output(1));
+    ASSERT_EQ(token_merge->get_num_merged(), 5u);
+    ASSERT_FALSE(token_merge->has_class_token());
+    ASSERT_EQ(token_merge->get_output_shape(0), (Shape{2, 11, 24}));
+    ASSERT_EQ(token_merge->get_output_shape(1), (Shape{2, 11, 1}));
+    ASSERT_EQ(token_merge->get_input_shape(0), (Shape{2, 16, 8}));
+}
+
+TEST(token_merge_fusion, token_merging_with_class_token) {
+    auto model = create_token_merging(element::f32, Shape{1, 197, 64}, 64, 16, true);
+    run_transformation<nvidia_gpu::pass::TokenMergeFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v3::ScatterUpdate>(model), 0);
+    const auto token_merge =
+        dynamic_pointer_cast<TokenMerge>(model->output(0).get_node()->get_input_node_shared_ptr(0));
+    ASSERT_NE(token_merge, nullptr);
+    ASSERT_EQ(token_merge->get_num_merged(), 16u);
+    ASSERT_TRUE(token_merge->has_class_token());
+    ASSERT_EQ(token_merge->get_output_shape(0), (Shape{1, 181, 64}));
+}
+
+TEST(token_merge_fusion, not_fused_without_normalized_metric) {
+    auto model = create_token_merging(element::f32, Shape{1, 16, 8}, 8, 4, false, false);
+    run_transformation<nvidia_gpu::pass::TokenMergeFusion>(model);
+
+    ASSERT_EQ(count_ops_of_type<TokenMerge>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v12::ScatterElementsUpdate>(model), 2);
+}
+
+}  // namespace testing
@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "openvino/core/model.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/init_node_info.hpp"
+
+namespace testing {
+
+/**
+ * Runs the given passes of the plugin on the model one by one after InitNodeInfo, as GraphTransformer does
+ */
+template <typename... TPasses>
+void run_transformation(const std::shared_ptr<ov::Model>& model) {
+    ov::pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    (pass_manager.register_pass<TPasses>(), ...);
+    pass_manager.run_passes(model);
+}
+
+/**
+ * Runs the pass constructed from the given arguments on the model after InitNodeInfo
+ */
+template <typename TPass, typename Arg, typename... Args>
+void run_transformation(const std::shared_ptr<ov::Model>& model, Arg&& arg, Args&&... args) {
+    ov::pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<TPass>(std::forward<Arg>(arg), std::forward<Args>(args)...);
+    pass_manager.run_passes(model);
+}
+
+}  // namespace testing
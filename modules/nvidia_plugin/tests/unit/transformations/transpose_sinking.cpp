@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/transpose_sinking_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/opsets/opset10.hpp"
+#include "transformation_test_utils.hpp"
+
+using namespace ov;
+using namespace ov::opset10;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Node> transpose(const Output<Node>& input, const vector<int64_t>& order) {
+    return make_shared<Transpose>(input, Constant::create(element::i64, Shape{order.size()}, order));
+}
+
+}  // namespace
+
+TEST(transpose_sinking, inverse_transposes_cancel_through_eltwise) {
+    auto input = make_shared<Parameter>(element::f32, Shape{2, 3, 4, 5});
+    auto relu = make_shared<Relu>(transpose(input, {0, 2, 3, 1}));
+    auto bias = Constant::create(element::f32, Shape{3}, {1, 2, 3});
+    auto add = make_shared<Add>(relu, bias);
+    auto convert = make_shared<Convert>(transpose(add, {0, 3, 1, 2}), element::f16);
+    auto model = make_shared<Model>(convert, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::TransposeSinkingTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<Transpose>(model), 0);
+    const auto output = model->get_result()->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(dynamic_pointer_cast<Convert>(output));
+    const auto sunk_add = dynamic_pointer_cast<Add>(output->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(sunk_add);
+    // Bias is transposed in the inverse order at compile time
+    ASSERT_EQ(sunk_add->get_input_shape(1), (Shape{1, 3, 1, 1}));
+    ASSERT_EQ(model->get_result()->get_input_shape(0), (Shape{2, 3, 4, 5}));
+}
+
+TEST(transpose_sinking, reduction_absorbs_transpose) {
+    auto input = make_shared<Parameter>(element::f32, Shape{2, 3, 4});
+    auto axes = Constant::create(element::i64, Shape{1}, {0});
+    auto reduce = make_shared<ReduceSum>(transpose(input, {2, 0, 1}), axes, false);
+    auto model = make_shared<Model>(reduce, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::TransposeSinkingTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<Transpose>(model), 0);
+    const auto sunk = dynamic_pointer_cast<ReduceSum>(model->get_result()->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(sunk);
+    ASSERT_EQ(sunk->get_reduction_axes(), (AxisSet{2}));
+    ASSERT_EQ(sunk->get_output_shape(0), (Shape{2, 3}));
+}
+
+TEST(transpose_sinking, transpose_with_several_consumers_is_kept) {
+    auto input = make_shared<Parameter>(element::f32, Shape{2, 3});
+    auto transposed = transpose(input, {1, 0});
+    auto relu = make_shared<Relu>(transposed);
+    auto sigmoid = make_shared<Sigmoid>(transposed);
+    auto model = make_shared<Model>(OutputVector{relu, sigmoid}, ParameterVector{input});
+
+    run_transformation<nvidia_gpu::pass::TransposeSinkingTransformation>(model);
+
+    ASSERT_EQ(count_ops_of_type<Transpose>(model), 1);
+    ASSERT_TRUE(dynamic_pointer_cast<Transpose>(relu->get_input_node_shared_ptr(0)));
+}
+
+}  // namespace testing
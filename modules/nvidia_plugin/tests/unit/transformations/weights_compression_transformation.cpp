@@ -0,0 +1,109 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/weights_compression_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "transformation_test_utils.hpp"
+#include "transformer/nodes/compressed_matmul.hpp"
+
+using ov::nvidia_gpu::nodes::CompressedMatMul;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+
+shared_ptr<Model> create_model(const Shape& weights_shape, bool transpose_b, const vector<float>& weights_values) {
+    const size_t k = transpose_b ? weights_shape[1] : weights_shape[0];
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, k});
+    auto weights = op::v0::Constant::create(element::f32, weights_shape, weights_values);
+    auto matmul = make_shared<op::v0::MatMul>(input, weights, false, transpose_b);
+    return make_shared<Model>(matmul, ParameterVector{input});
+}
+
+shared_ptr<CompressedMatMul> find_compressed_matmul(const shared_ptr<Model>& model) {
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto compressed = dynamic_pointer_cast<CompressedMatMul>(node)) {
+            return compressed;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST(weights_compression, matmul_weights_are_quantized_to_i8_per_output_channel) {
+    const size_t k = 256;
+    const size_t n = 256;
+    vector<float> values(k * n);
+    for (size_t ik = 0; ik < k; ++ik) {
+        for (size_t in = 0; in < n; ++in) {
+            values[ik * n + in] = (static_cast<float>(ik % 17) - 8.0f) * static_cast<float>(in + 1);
+        }
+    }
+    auto model = create_model(Shape{k, n}, false, values);
+    run_transformation<nvidia_gpu::pass::WeightsCompressionTransformation>(model, element::i8);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::MatMul>(model), 0);
+    const auto compressed = find_compressed_matmul(model);
+    ASSERT_NE(compressed, nullptr);
+    ASSERT_EQ(compressed->get_output_shape(0), (Shape{1, n}));
+    const auto weights = dynamic_pointer_cast<op::v0::Constant>(compressed->get_input_node_shared_ptr(1));
+    const auto scales = dynamic_pointer_cast<op::v0::Constant>(compressed->get_input_node_shared_ptr(2));
+    ASSERT_EQ(weights->get_element_type(), element::i8);
+    ASSERT_EQ(weights->get_output_shape(0), (Shape{n, k}));
+    const auto quantized = weights->cast_vector<int>();
+    const auto scale_values = scales->cast_vector<float>();
+    for (size_t in = 0; in < n; ++in) {
+        for (size_t ik = 0; ik < k; ++ik) {
+            ASSERT_NEAR(quantized[in * k + ik] * scale_values[in], values[ik * n + in], scale_values[in] / 2);
+        }
+    }
+}
+
+TEST(weights_compression, transposed_weights_are_packed_to_i4) {
+    const size_t n = 256;
+    const size_t k = 257;
+    vector<float> values(n * k);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(static_cast<int>(i % 15) - 7);
+    }
+    auto model = create_model(Shape{n, k}, true, values);
+    run_transformation<nvidia_gpu::pass::WeightsCompressionTransformation>(model, element::i4);
+
+    const auto compressed = find_compressed_matmul(model);
+    ASSERT_NE(compressed, nullptr);
+    const auto weights = dynamic_pointer_cast<op::v0::Constant>(compressed->get_input_node_shared_ptr(1));
+    ASSERT_EQ(weights->get_element_type(), element::u8);
+    ASSERT_EQ(weights->get_output_shape(0), (Shape{n, (k + 1) / 2}));
+    const auto* packed = weights->get_data_ptr<uint8_t>();
+    const auto scale_values =
+        dynamic_pointer_cast<op::v0::Constant>(compressed->get_input_node_shared_ptr(2))->cast_vector<float>();
+    for (size_t in = 0; in < n; ++in) {
+        for (size_t ik = 0; ik < k; ++ik) {
+            const int nibble = (packed[in * ((k + 1) / 2) + ik / 2] >> ((ik % 2) * 4)) & 0x0F;
+            ASSERT_NEAR(((nibble ^ 0x08) - 0x08) * scale_values[in], values[in * k + ik], 1e-5f);
+        }
+    }
+}
+
+TEST(weights_compression, small_weights_are_not_compressed) {
+    auto model = create_model(Shape{64, 64}, false, vector<float>(64 * 64, 1.0f));
+    auto model_ref = model->clone();
+    run_transformation<nvidia_gpu::pass::WeightsCompressionTransformation>(model, element::i8);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::MatMul>(model), 1);
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+}  // namespace testing
@@ -0,0 +1,104 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_tuning_cache.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+class TuningCacheTest : public testing::Test {
+protected:
+    void SetUp() override {
+        const auto* test = testing::UnitTest::GetInstance()->current_test_info();
+        cacheDir_ = std::filesystem::temp_directory_path() / ("nvidia_tuning_cache_" + std::string{test->name()});
+        std::filesystem::remove_all(cacheDir_);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(cacheDir_); }
+
+    std::shared_ptr<TuningCache> open() const { return TuningCache::open(cacheDir_.string(), CUDA::Device{}); }
+
+    /**
+     * @returns The only file of the cache directory
+     */
+    std::filesystem::path cacheFile() const {
+        std::filesystem::path file;
+        for (const auto& entry : std::filesystem::directory_iterator{cacheDir_}) {
+            EXPECT_TRUE(file.empty());
+            file = entry.path();
+        }
+        return file;
+    }
+
+    std::filesystem::path cacheDir_;
+};
+
+}  // namespace
+
+TEST_F(TuningCacheTest, NoCacheWithoutDirectory) { ASSERT_EQ(TuningCache::open({}, CUDA::Device{}), nullptr); }
+
+TEST_F(TuningCacheTest, CompilationsShareCacheOfDirectory) {
+    auto cache = open();
+    ASSERT_NE(cache, nullptr);
+    ASSERT_EQ(open(), cache);
+    ASSERT_FALSE(cache->find("convolution:1").has_value());
+}
+
+TEST_F(TuningCacheTest, StoredAlgorithmsAreReloadedFromFile) {
+    {
+        auto cache = open();
+        cache->store("convolution:1", "algo 1");
+        cache->store("convolution:2", "algo 2");
+        cache->store("convolution:1", "algo 3");
+    }
+    // The cache isn't alive anymore, so the file is read again
+    auto cache = open();
+    ASSERT_EQ(cache->find("convolution:1"), "algo 3");
+    ASSERT_EQ(cache->find("convolution:2"), "algo 2");
+}
+
+TEST_F(TuningCacheTest, PartiallyWrittenLinesAreSkipped) {
+    open()->store("convolution:1", "algo 1");
+    {
+        std::ofstream file{cacheFile(), std::ios::app};
+        file << "convolution:2\n"
+             << "convolution:3\t\n";
+    }
+    auto cache = open();
+    ASSERT_EQ(cache->find("convolution:1"), "algo 1");
+    ASSERT_FALSE(cache->find("convolution:2").has_value());
+    ASSERT_FALSE(cache->find("convolution:3").has_value());
+}
+
+TEST_F(TuningCacheTest, ModelCacheRecordsAlgorithmsFoundOnDisk) {
+    open()->store("convolution:1", "algo 1");
+    auto modelCache = TuningCache::createForModel(cacheDir_.string(), CUDA::Device{});
+    ASSERT_EQ(modelCache->find("convolution:1"), "algo 1");
+    modelCache->store("convolution:2", "algo 2");
+    // Algorithms stored by the model are written on disk as well
+    ASSERT_EQ(open()->find("convolution:2"), "algo 2");
+
+    std::stringstream exported;
+    modelCache->write(exported);
+    auto importedCache = TuningCache::createForModel({}, CUDA::Device{});
+    importedCache->read(exported);
+    ASSERT_EQ(importedCache->find("convolution:1"), "algo 1");
+    ASSERT_EQ(importedCache->find("convolution:2"), "algo 2");
+}
+
+TEST_F(TuningCacheTest, ModelCacheWritesOnlyAlgorithmsOfModel) {
+    open()->store("convolution:1", "algo 1");
+    auto modelCache = TuningCache::createForModel(cacheDir_.string(), CUDA::Device{});
+    modelCache->store("convolution:2", "algo 2");
+    std::stringstream exported;
+    modelCache->write(exported);
+    ASSERT_EQ(exported.str(), "convolution:2\talgo 2\n");
+}
@@ -0,0 +1,258 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <nvidia/properties.hpp>
+#include <openvino/openvino.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string model;
+    std::string device = "NVIDIA";
+    std::vector<size_t> batches{1};
+    std::vector<size_t> requests{1};
+    std::vector<bool> cuda_graphs{false, true};
+    double seconds = 10;
+    bool profiling = true;
+};
+
+struct Configuration {
+    size_t batch;
+    size_t requests;
+    bool cuda_graph;
+};
+
+void print_usage() {
+    std::cout << "Usage: ov_nvidia_model_benchmark -m <model.xml> [options]\n"
+                 "  -m <path>        IR of the model\n"
+                 "  -d <device>      device, NVIDIA by default (e.g. NVIDIA.1)\n"
+                 "  -b <list>        comma-separated batch sizes, the batch of the model by default\n"
+                 "  -nireq <list>    comma-separated numbers of infer requests running concurrently, 1 by default\n"
+                 "  -graph <list>    comma-separated values of NVIDIA_USE_CUDA_GRAPH (0, 1), both by default\n"
+                 "  -t <seconds>     duration of a configuration, 10 by default\n"
+                 "  -no_profiling    don't enable profiling, which is required for the breakdown by stages\n";
+}
+
+std::vector<size_t> parse_list(const std::string& value) {
+    std::vector<size_t> values;
+    std::istringstream stream{value};
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        values.push_back(std::stoul(item));
+    }
+    if (values.empty()) {
+        throw std::invalid_argument{"Empty list of values"};
+    }
+    return values;
+}
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    bool default_batch = true;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument{"Missing value of " + arg};
+            }
+            return argv[++i];
+        };
+        if (arg == "-m") {
+            options.model = value();
+        } else if (arg == "-d") {
+            options.device = value();
+        } else if (arg == "-b") {
+            options.batches = parse_list(value());
+            default_batch = false;
+        } else if (arg == "-nireq") {
+            options.requests = parse_list(value());
+        } else if (arg == "-graph") {
+            options.cuda_graphs.clear();
+            for (const auto flag : parse_list(value())) {
+                options.cuda_graphs.push_back(flag != 0);
+            }
+        } else if (arg == "-t") {
+            options.seconds = std::stod(value());
+        } else if (arg == "-no_profiling") {
+            options.profiling = false;
+        } else {
+            throw std::invalid_argument{"Unknown option " + arg};
+        }
+    }
+    if (options.model.empty()) {
+        throw std::invalid_argument{"Model isn't specified"};
+    }
+    if (default_batch) {
+        // 0 keeps the batch of the model
+        options.batches = {0};
+    }
+    return options;
+}
+
+double percentile(const std::vector<double>& sorted, const double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    const auto index = static_cast<size_t>(p / 100 * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+/**
+ * @returns Batch of the model if it is static and could be determined by layouts of inputs, 1 otherwise
+ */
+size_t model_batch(const std::shared_ptr<const ov::Model>& model) {
+    try {
+        const auto batch = ov::get_batch(model);
+        return batch.is_static() ? static_cast<size_t>(batch.get_length()) : 1;
+    } catch (const ov::Exception&) {
+        return 1;
+    }
+}
+
+/**
+ * Keeps every infer request busy until the end of the duration and collects latencies of inferences in ms
+ */
+std::vector<double> run(std::vector<ov::InferRequest>& requests, const double seconds) {
+    const auto deadline =
+        Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>{seconds});
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::vector<double> latencies;
+    std::vector<Clock::time_point> starts(requests.size());
+    size_t running = requests.size();
+    std::exception_ptr error;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        requests[i].set_callback([&, i](std::exception_ptr exception) {
+            const auto end = Clock::now();
+            std::unique_lock<std::mutex> lock{mutex};
+            if (exception) {
+                error = exception;
+            } else {
+                latencies.push_back(std::chrono::duration<double, std::milli>(end - starts[i]).count());
+            }
+            if (exception || end >= deadline) {
+                if (--running == 0) {
+                    finished.notify_one();
+                }
+                return;
+            }
+            starts[i] = Clock::now();
+            lock.unlock();
+            requests[i].start_async();
+        });
+    }
+    for (size_t i = 0; i < requests.size(); ++i) {
+        starts[i] = Clock::now();
+        requests[i].start_async();
+    }
+    std::unique_lock<std::mutex> lock{mutex};
+    finished.wait(lock, [&] { return running == 0; });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return latencies;
+}
+
+void benchmark(ov::Core& core, const Options& options, const Configuration& configuration) {
+    auto model = core.read_model(options.model);
+    if (configuration.batch != 0) {
+        ov::set_batch(model, static_cast<int64_t>(configuration.batch));
+    }
+    auto compiled_model = core.compile_model(model,
+                                             options.device,
+                                             ov::nvidia_gpu::use_cuda_graph(configuration.cuda_graph),
+                                             ov::enable_profiling(options.profiling),
+                                             ov::hint::num_requests(static_cast<uint32_t>(configuration.requests)));
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < configuration.requests; ++i) {
+        requests.push_back(compiled_model.create_infer_request());
+        for (const auto& input : compiled_model.inputs()) {
+            auto tensor = requests.back().get_tensor(input);
+            std::memset(tensor.data(), 0, tensor.get_byte_size());
+        }
+    }
+    // Warm-up inferences include lazy initialization (e.g. capturing of CUDA graphs), so they aren't measured
+    for (auto& request : requests) {
+        request.infer();
+    }
+
+    const auto start = Clock::now();
+    auto latencies = run(requests, options.seconds);
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    std::sort(latencies.begin(), latencies.end());
+    const auto batch = configuration.batch != 0 ? configuration.batch : model_batch(model);
+
+    std::cout << "batch " << batch << ", infer requests " << configuration.requests << ", CUDA graph "
+              << (configuration.cuda_graph ? "on" : "off") << '\n';
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  throughput             " << latencies.size() * batch / elapsed << " FPS\n";
+    std::cout << "  latency p50/p90/p99    " << percentile(latencies, 50) << " / " << percentile(latencies, 90)
+              << " / " << percentile(latencies, 99) << " ms\n";
+    std::cout << "  CUDA graphs            " << compiled_model.get_property(ov::nvidia_gpu::number_of_cuda_graphs)
+              << " (launches " << compiled_model.get_property(ov::nvidia_gpu::cuda_graph_launches) << ", eager "
+              << compiled_model.get_property(ov::nvidia_gpu::eager_launches) << ")\n";
+    const auto blocks = compiled_model.get_property(ov::nvidia_gpu::number_of_memory_blocks);
+    const auto block_size = compiled_model.get_property(ov::nvidia_gpu::infer_request_memory_size);
+    std::cout << "  memory pool            " << blocks << " x " << block_size / double(1 << 20) << " MiB, waits "
+              << compiled_model.get_property(ov::nvidia_gpu::memory_pool_total_wait_time) << " ms (max queue "
+              << compiled_model.get_property(ov::nvidia_gpu::memory_pool_max_queue_depth) << ")\n";
+    if (options.profiling) {
+        // Stages are named "<number>. <stage>" by the plugin, other entries are operations
+        std::cout << "  stages p50/p99 (us)\n";
+        for (const auto& [name, values] : compiled_model.get_property(ov::nvidia_gpu::latency_percentiles)) {
+            if (!name.empty() && std::isdigit(static_cast<unsigned char>(name.front())) &&
+                name.find(". ") != std::string::npos && values.size() >= 3) {
+                std::cout << "    " << std::left << std::setw(34) << name << std::right << values[0] << " / "
+                          << values[2] << '\n';
+            }
+        }
+    }
+    std::cout << std::endl;
+}
+
+}  // namespace
+
+/**
+ * Sweeps batch sizes, numbers of infer requests and CUDA graphs on a model and reports throughput, latencies and
+ * internals of the plugin (breakdown by stages, CUDA graphs and the memory pool) for each configuration
+ */
+int main(int argc, char** argv) {
+    Options options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        print_usage();
+        return 1;
+    }
+    ov::Core core;
+    int status = 0;
+    for (const auto cuda_graph : options.cuda_graphs) {
+        for (const auto batch : options.batches) {
+            for (const auto requests : options.requests) {
+                try {
+                    benchmark(core, options, {batch, requests, cuda_graph});
+                } catch (const std::exception& e) {
+                    std::cerr << "batch " << batch << ", infer requests " << requests << ", CUDA graph "
+                              << (cuda_graph ? "on" : "off") << " failed: " << e.what() << "\n\n";
+                    status = 1;
+                }
+            }
+        }
+    }
+    return status;
+}
@@ -0,0 +1,220 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <nvidia/properties.hpp>
+#include <openvino/openvino.hpp>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Shapes of inputs by their names, the empty name stands for the only input of the model
+using InputShapes = std::map<std::string, ov::PartialShape>;
+
+struct Options {
+    std::vector<std::string> models;
+    std::vector<InputShapes> shapes;
+    std::vector<std::optional<ov::element::Type>> precisions{std::nullopt};
+    std::string output;
+    std::string device = "NVIDIA";
+};
+
+void print_usage() {
+    std::cout << "Usage: ov_nvidia_offline_tuning -m <model.xml> [-m <model.xml> ...] -o <directory> [options]\n"
+                 "  -m <path>        IR of a model, may be repeated\n"
+                 "  -o <directory>   directory of the tuning cache, ov::cache_dir of production compilations\n"
+                 "  -shape <shapes>  static shapes of inputs, e.g. [1,3,224,224] or data[1,3,224,224],mask[1,1,9,9],\n"
+                 "                   may be repeated, models are tuned for each of them (shapes of the IR by default)\n"
+                 "  -p <list>        comma-separated inference precisions (f16, bf16, f32), default of the device\n"
+                 "  -d <device>      device, NVIDIA by default (e.g. NVIDIA.1)\n";
+}
+
+std::vector<std::string> split(const std::string& value) {
+    std::vector<std::string> items;
+    std::istringstream stream{value};
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    if (items.empty()) {
+        throw std::invalid_argument{"Empty list of values"};
+    }
+    return items;
+}
+
+InputShapes parse_shapes(const std::string& value) {
+    InputShapes shapes;
+    std::size_t position = 0;
+    while (position < value.size()) {
+        const auto begin = value.find('[', position);
+        const auto end = value.find(']', begin);
+        if (begin == std::string::npos || end == std::string::npos) {
+            throw std::invalid_argument{"Shapes " + value + " should be like name[1,3,224,224]"};
+        }
+        auto name = value.substr(position, begin - position);
+        if (!name.empty() && name.front() == ',') {
+            name.erase(0, 1);
+        }
+        const ov::PartialShape shape{value.substr(begin, end - begin + 1)};
+        if (shape.is_dynamic()) {
+            throw std::invalid_argument{"Shape " + shape.to_string() + " should be static"};
+        }
+        shapes[name] = shape;
+        position = end + 1;
+    }
+    return shapes;
+}
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument{"Missing value of " + arg};
+            }
+            return argv[++i];
+        };
+        if (arg == "-m") {
+            options.models.push_back(value());
+        } else if (arg == "-o") {
+            options.output = value();
+        } else if (arg == "-shape") {
+            options.shapes.push_back(parse_shapes(value()));
+        } else if (arg == "-p") {
+            options.precisions.clear();
+            for (const auto& precision : split(value())) {
+                options.precisions.emplace_back(ov::element::Type{precision});
+            }
+        } else if (arg == "-d") {
+            options.device = value();
+        } else {
+            throw std::invalid_argument{"Unknown option " + arg};
+        }
+    }
+    if (options.models.empty()) {
+        throw std::invalid_argument{"Model isn't specified"};
+    }
+    if (options.output.empty()) {
+        throw std::invalid_argument{"Output directory isn't specified"};
+    }
+    if (options.shapes.empty()) {
+        // Shapes of the IR are kept
+        options.shapes.emplace_back();
+    }
+    return options;
+}
+
+/**
+ * @returns Numbers of entries of tuning caches in the directory by their files (one file per GPU model, driver
+ *          and cuDNN version)
+ */
+std::map<std::string, std::size_t> count_entries(const std::string& directory) {
+    std::map<std::string, std::size_t> entries;
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator{directory, error}) {
+        const auto name = file.path().filename().string();
+        if (name.rfind("nvidia_tuning_", 0) != 0 || file.path().extension() != ".cache") {
+            continue;
+        }
+        std::ifstream stream{file.path()};
+        std::size_t lines = 0;
+        for (std::string line; std::getline(stream, line);) {
+            ++lines;
+        }
+        entries[file.path().string()] = lines;
+    }
+    return entries;
+}
+
+std::string describe(const InputShapes& shapes) {
+    if (shapes.empty()) {
+        return "shapes of the model";
+    }
+    std::string description;
+    for (const auto& [name, shape] : shapes) {
+        description += (description.empty() ? "" : ",") + name + shape.to_string();
+    }
+    return description;
+}
+
+/**
+ * Compiles the model with benchmarks of operations, which store selected algorithms, implementations, engine knobs
+ * and launch configurations into the tuning cache of the output directory
+ */
+void tune(ov::Core& core,
+          const Options& options,
+          const std::string& path,
+          const InputShapes& shapes,
+          const std::optional<ov::element::Type>& precision) {
+    auto model = core.read_model(path);
+    if (shapes.size() == 1 && shapes.begin()->first.empty()) {
+        model->reshape(shapes.begin()->second);
+    } else if (!shapes.empty()) {
+        model->reshape(shapes);
+    }
+    if (model->is_dynamic()) {
+        throw std::invalid_argument{"Model has dynamic shapes, its static shapes should be given by -shape"};
+    }
+    ov::AnyMap config{ov::cache_dir(options.output),
+                      ov::nvidia_gpu::operation_benchmark(true),
+                      ov::nvidia_gpu::background_tuning(false)};
+    if (precision) {
+        config.emplace(ov::hint::inference_precision.name(), *precision);
+    }
+    const auto start = Clock::now();
+    core.compile_model(model, options.device, config);
+    std::cout << "  compiled in " << std::fixed << std::setprecision(2)
+              << std::chrono::duration<double>(Clock::now() - start).count() << " s\n";
+}
+
+}  // namespace
+
+/**
+ * Tunes models for the GPU offline, so production compilations with ov::cache_dir of the output directory (e.g. baked
+ * into a container image) reuse benchmarked algorithms at the cost of heuristics
+ */
+int main(int argc, char** argv) {
+    Options options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        print_usage();
+        return 1;
+    }
+    const auto initial_entries = count_entries(options.output);
+    ov::Core core;
+    int status = 0;
+    for (const auto& model : options.models) {
+        for (const auto& shapes : options.shapes) {
+            for (const auto& precision : options.precisions) {
+                std::cout << model << ", " << describe(shapes) << ", precision "
+                          << (precision ? precision->get_type_name() : "default") << '\n';
+                try {
+                    tune(core, options, model, shapes, precision);
+                } catch (const std::exception& e) {
+                    std::cerr << "  failed: " << e.what() << '\n';
+                    status = 1;
+                }
+            }
+        }
+    }
+    for (const auto& [file, entries] : count_entries(options.output)) {
+        const auto initial = initial_entries.find(file);
+        std::cout << file << ": " << entries << " entries ("
+                  << entries - (initial != initial_entries.end() ? initial->second : 0) << " new)\n";
+    }
+    return status;
+}